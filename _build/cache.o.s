@@ -0,0 +1,612 @@
+   1              		.file	"cache.c"
+   2              		.text
+   3              		.p2align 4
+   4              		.globl	cache_hash
+   6              	cache_hash:
+   7              	.LFB14:
+   8              		.cfi_startproc
+   9 0000 4889F8   		movq	%rdi, %rax
+  10 0003 4885D2   		testq	%rdx, %rdx
+  11 0006 7423     		je	.L1
+  12 0008 48BFB301 		movabsq	$1099511628211, %rdi
+  12      00000001 
+  12      0000
+  13 0012 4801F2   		addq	%rsi, %rdx
+  14              		.p2align 4,,10
+  15 0015 0F1F00   		.p2align 3
+  16              	.L3:
+  17 0018 0FB60E   		movzbl	(%rsi), %ecx
+  18 001b 4883C601 		addq	$1, %rsi
+  19 001f 4831C8   		xorq	%rcx, %rax
+  20 0022 480FAFC7 		imulq	%rdi, %rax
+  21 0026 4839F2   		cmpq	%rsi, %rdx
+  22 0029 75ED     		jne	.L3
+  23              	.L1:
+  24 002b C3       		ret
+  25              		.cfi_endproc
+  26              	.LFE14:
+  28              		.section	.rodata.str1.1,"aMS",@progbits,1
+  29              	.LC0:
+  30 0000 726200   		.string	"rb"
+  31              		.text
+  32 002c 0F1F4000 		.p2align 4
+  33              		.globl	cache_hash_file
+  35              	cache_hash_file:
+  36              	.LFB15:
+  37              		.cfi_startproc
+  38 0030 4155     		pushq	%r13
+  39              		.cfi_def_cfa_offset 16
+  40              		.cfi_offset 13, -16
+  41 0032 4989D5   		movq	%rdx, %r13
+  42 0035 4154     		pushq	%r12
+  43              		.cfi_def_cfa_offset 24
+  44              		.cfi_offset 12, -24
+  45 0037 55       		pushq	%rbp
+  46              		.cfi_def_cfa_offset 32
+  47              		.cfi_offset 6, -32
+  48 0038 53       		pushq	%rbx
+  49              		.cfi_def_cfa_offset 40
+  50              		.cfi_offset 3, -40
+  51 0039 4889FB   		movq	%rdi, %rbx
+  52 003c 4889F7   		movq	%rsi, %rdi
+  53 003f 488D3500 		leaq	.LC0(%rip), %rsi
+  53      000000
+  54 0046 4881EC08 		subq	$65544, %rsp
+  54      000100
+  55              		.cfi_def_cfa_offset 65584
+  56 004d E8000000 		call	fopen@PLT
+  56      00
+  57 0052 4885C0   		testq	%rax, %rax
+  58 0055 745C     		je	.L12
+  59 0057 4989C4   		movq	%rax, %r12
+  60 005a 4889E5   		movq	%rsp, %rbp
+  61 005d EB0F     		jmp	.L8
+  62 005f 90       		.p2align 4,,10
+  63              		.p2align 3
+  64              	.L10:
+  65 0060 4889DF   		movq	%rbx, %rdi
+  66 0063 4889EE   		movq	%rbp, %rsi
+  67 0066 E8000000 		call	cache_hash@PLT
+  67      00
+  68 006b 4889C3   		movq	%rax, %rbx
+  69              	.L8:
+  70 006e BA000001 		movl	$65536, %edx
+  70      00
+  71 0073 4C89E1   		movq	%r12, %rcx
+  72 0076 BE010000 		movl	$1, %esi
+  72      00
+  73 007b 4889EF   		movq	%rbp, %rdi
+  74 007e E8000000 		call	fread@PLT
+  74      00
+  75 0083 4889C2   		movq	%rax, %rdx
+  76 0086 4885C0   		testq	%rax, %rax
+  77 0089 75D5     		jne	.L10
+  78 008b 4C89E7   		movq	%r12, %rdi
+  79 008e E8000000 		call	ferror@PLT
+  79      00
+  80 0093 4C89E7   		movq	%r12, %rdi
+  81 0096 85C0     		testl	%eax, %eax
+  82 0098 410F9445 		sete	0(%r13)
+  82      00
+  83 009d E8000000 		call	fclose@PLT
+  83      00
+  84              	.L9:
+  85 00a2 4881C408 		addq	$65544, %rsp
+  85      000100
+  86              		.cfi_remember_state
+  87              		.cfi_def_cfa_offset 40
+  88 00a9 4889D8   		movq	%rbx, %rax
+  89 00ac 5B       		popq	%rbx
+  90              		.cfi_def_cfa_offset 32
+  91 00ad 5D       		popq	%rbp
+  92              		.cfi_def_cfa_offset 24
+  93 00ae 415C     		popq	%r12
+  94              		.cfi_def_cfa_offset 16
+  95 00b0 415D     		popq	%r13
+  96              		.cfi_def_cfa_offset 8
+  97 00b2 C3       		ret
+  98              	.L12:
+  99              		.cfi_restore_state
+ 100 00b3 41C64500 		movb	$0, 0(%r13)
+ 100      00
+ 101 00b8 EBE8     		jmp	.L9
+ 102              		.cfi_endproc
+ 103              	.LFE15:
+ 105              		.section	.rodata.str1.1
+ 106              	.LC1:
+ 107 0003 51445350 		.string	"QDSP_CACHE_DIR"
+ 107      5F434143 
+ 107      48455F44 
+ 107      495200
+ 108              		.text
+ 109 00ba 660F1F44 		.p2align 4
+ 109      0000
+ 110              		.globl	cache_enabled
+ 112              	cache_enabled:
+ 113              	.LFB17:
+ 114              		.cfi_startproc
+ 115 00c0 4883EC08 		subq	$8, %rsp
+ 116              		.cfi_def_cfa_offset 16
+ 117 00c4 488D3D00 		leaq	.LC1(%rip), %rdi
+ 117      000000
+ 118 00cb E8000000 		call	getenv@PLT
+ 118      00
+ 119 00d0 4885C0   		testq	%rax, %rax
+ 120 00d3 740B     		je	.L16
+ 121 00d5 803800   		cmpb	$0, (%rax)
+ 122 00d8 0F95C0   		setne	%al
+ 123 00db 4883C408 		addq	$8, %rsp
+ 124              		.cfi_remember_state
+ 125              		.cfi_def_cfa_offset 8
+ 126 00df C3       		ret
+ 127              		.p2align 4,,10
+ 128              		.p2align 3
+ 129              	.L16:
+ 130              		.cfi_restore_state
+ 131 00e0 31C0     		xorl	%eax, %eax
+ 132 00e2 4883C408 		addq	$8, %rsp
+ 133              		.cfi_def_cfa_offset 8
+ 134 00e6 C3       		ret
+ 135              		.cfi_endproc
+ 136              	.LFE17:
+ 138              		.section	.rodata.str1.1
+ 139              	.LC2:
+ 140 0012 25732F25 		.string	"%s/%s-%016llx.bin"
+ 140      732D2530 
+ 140      31366C6C 
+ 140      782E6269 
+ 140      6E00
+ 141              	.LC3:
+ 142 0024 25732E25 		.string	"%s.%ld.tmp"
+ 142      6C642E74 
+ 142      6D7000
+ 143              	.LC4:
+ 144 002f 776200   		.string	"wb"
+ 145              	.LC5:
+ 146 0032 25733A20 		.string	"%s: Could not create %s: %s\n"
+ 146      436F756C 
+ 146      64206E6F 
+ 146      74206372 
+ 146      65617465 
+ 147              	.LC6:
+ 148 004f 25733A20 		.string	"%s: %s\n"
+ 148      25730A00 
+ 149              	.LC7:
+ 150 0057 25733A20 		.string	"%s: Could not write %s\n"
+ 150      436F756C 
+ 150      64206E6F 
+ 150      74207772 
+ 150      69746520 
+ 151              		.text
+ 152 00e7 660F1F84 		.p2align 4
+ 152      00000000 
+ 152      00
+ 153              		.globl	cache_store
+ 155              	cache_store:
+ 156              	.LFB20:
+ 157              		.cfi_startproc
+ 158 00f0 55       		pushq	%rbp
+ 159              		.cfi_def_cfa_offset 16
+ 160              		.cfi_offset 6, -16
+ 161 00f1 4889E5   		movq	%rsp, %rbp
+ 162              		.cfi_def_cfa_register 6
+ 163 00f4 4157     		pushq	%r15
+ 164              		.cfi_offset 15, -24
+ 165 00f6 4989FF   		movq	%rdi, %r15
+ 166 00f9 4156     		pushq	%r14
+ 167 00fb 4155     		pushq	%r13
+ 168              		.cfi_offset 14, -32
+ 169              		.cfi_offset 13, -40
+ 170 00fd 4989F5   		movq	%rsi, %r13
+ 171 0100 4154     		pushq	%r12
+ 172              		.cfi_offset 12, -48
+ 173 0102 4989CC   		movq	%rcx, %r12
+ 174 0105 53       		pushq	%rbx
+ 175 0106 4881EC98 		subq	$8344, %rsp
+ 175      200000
+ 176              		.cfi_offset 3, -56
+ 177 010d 48895424 		movq	%rdx, 8(%rsp)
+ 177      08
+ 178 0112 E8000000 		call	cache_enabled@PLT
+ 178      00
+ 179 0117 84C0     		testb	%al, %al
+ 180 0119 751D     		jne	.L37
+ 181              	.L19:
+ 182 011b 31DB     		xorl	%ebx, %ebx
+ 183              	.L18:
+ 184 011d 4881C498 		addq	$8344, %rsp
+ 184      200000
+ 185 0124 89D8     		movl	%ebx, %eax
+ 186 0126 5B       		popq	%rbx
+ 187 0127 415C     		popq	%r12
+ 188 0129 415D     		popq	%r13
+ 189 012b 415E     		popq	%r14
+ 190 012d 415F     		popq	%r15
+ 191 012f 5D       		popq	%rbp
+ 192              		.cfi_remember_state
+ 193              		.cfi_def_cfa 7, 8
+ 194 0130 C3       		ret
+ 195              		.p2align 4,,10
+ 196 0131 0F1F8000 		.p2align 3
+ 196      000000
+ 197              	.L37:
+ 198              		.cfi_restore_state
+ 199 0138 488D3D00 		leaq	.LC1(%rip), %rdi
+ 199      000000
+ 200 013f 89C3     		movl	%eax, %ebx
+ 201 0141 E8000000 		call	getenv@PLT
+ 201      00
+ 202 0146 4889C1   		movq	%rax, %rcx
+ 203 0149 4885C0   		testq	%rax, %rax
+ 204 014c 7409     		je	.L20
+ 205 014e 31C0     		xorl	%eax, %eax
+ 206 0150 803900   		cmpb	$0, (%rcx)
+ 207 0153 480F44C8 		cmove	%rax, %rcx
+ 208              	.L20:
+ 209 0157 4C8D7424 		leaq	112(%rsp), %r14
+ 209      70
+ 210 015c 4D89E9   		movq	%r13, %r9
+ 211 015f 4D89F8   		movq	%r15, %r8
+ 212 0162 488D1500 		leaq	.LC2(%rip), %rdx
+ 212      000000
+ 213 0169 BE001000 		movl	$4096, %esi
+ 213      00
+ 214 016e 4C89F7   		movq	%r14, %rdi
+ 215 0171 31C0     		xorl	%eax, %eax
+ 216 0173 E8000000 		call	snprintf@PLT
+ 216      00
+ 217 0178 4C8DBC24 		leaq	4208(%rsp), %r15
+ 217      70100000 
+ 218 0180 E8000000 		call	getpid@PLT
+ 218      00
+ 219 0185 4C89F1   		movq	%r14, %rcx
+ 220 0188 BE201000 		movl	$4128, %esi
+ 220      00
+ 221 018d 4C89FF   		movq	%r15, %rdi
+ 222 0190 4C63C0   		movslq	%eax, %r8
+ 223 0193 488D1500 		leaq	.LC3(%rip), %rdx
+ 223      000000
+ 224 019a 31C0     		xorl	%eax, %eax
+ 225 019c E8000000 		call	snprintf@PLT
+ 225      00
+ 226 01a1 488D4424 		leaq	48(%rsp), %rax
+ 226      30
+ 227 01a6 4C896C24 		movq	%r13, 24(%rsp)
+ 227      18
+ 228 01ab C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 229 01af 48890424 		movq	%rax, (%rsp)
+ 230 01b3 488D3500 		leaq	.LC4(%rip), %rsi
+ 230      000000
+ 231 01ba 4C89FF   		movq	%r15, %rdi
+ 232 01bd 48B85144 		movabsq	$3549752688664331345, %rax
+ 232      53504341 
+ 232      4331
+ 233 01c7 48894424 		movq	%rax, 16(%rsp)
+ 233      10
+ 234 01cc C5F96F4C 		vmovdqa	16(%rsp), %xmm1
+ 234      2410
+ 235 01d2 48C74424 		movq	$0, 104(%rsp)
+ 235      68000000 
+ 235      00
+ 236 01db 4C896424 		movq	%r12, 32(%rsp)
+ 236      20
+ 237 01e0 4C896424 		movq	%r12, 64(%rsp)
+ 237      40
+ 238 01e5 62F17F28 		vmovdqu8	%ymm0, 72(%rsp)
+ 238      7F842448 
+ 238      000000
+ 239 01f0 C5F97F4C 		vmovdqa	%xmm1, 48(%rsp)
+ 239      2430
+ 240 01f6 C5F877   		vzeroupper
+ 241 01f9 E8000000 		call	fopen@PLT
+ 241      00
+ 242 01fe 4989C5   		movq	%rax, %r13
+ 243 0201 4885C0   		testq	%rax, %rax
+ 244 0204 0F84A300 		je	.L38
+ 244      0000
+ 245 020a 488B3C24 		movq	(%rsp), %rdi
+ 246 020e 4889C1   		movq	%rax, %rcx
+ 247 0211 BA010000 		movl	$1, %edx
+ 247      00
+ 248 0216 BE400000 		movl	$64, %esi
+ 248      00
+ 249 021b E8000000 		call	fwrite@PLT
+ 249      00
+ 250 0220 4C89EF   		movq	%r13, %rdi
+ 251 0223 4883F801 		cmpq	$1, %rax
+ 252 0227 742F     		je	.L39
+ 253              	.L36:
+ 254 0229 E8000000 		call	fclose@PLT
+ 254      00
+ 255              	.L27:
+ 256 022e 31FF     		xorl	%edi, %edi
+ 257 0230 4C89F1   		movq	%r14, %rcx
+ 258 0233 488D1500 		leaq	__func__.0(%rip), %rdx
+ 258      000000
+ 259 023a 31C0     		xorl	%eax, %eax
+ 260 023c 488D3500 		leaq	.LC7(%rip), %rsi
+ 260      000000
+ 261 0243 E8000000 		call	debugprint@PLT
+ 261      00
+ 262 0248 4C89FF   		movq	%r15, %rdi
+ 263 024b E8000000 		call	unlink@PLT
+ 263      00
+ 264 0250 E9C6FEFF 		jmp	.L19
+ 264      FF
+ 265              		.p2align 4,,10
+ 266 0255 0F1F00   		.p2align 3
+ 267              	.L39:
+ 268 0258 488B7C24 		movq	8(%rsp), %rdi
+ 268      08
+ 269 025d 4C89E9   		movq	%r13, %rcx
+ 270 0260 4C89E2   		movq	%r12, %rdx
+ 271 0263 BE010000 		movl	$1, %esi
+ 271      00
+ 272 0268 E8000000 		call	fwrite@PLT
+ 272      00
+ 273 026d 4C89EF   		movq	%r13, %rdi
+ 274 0270 4C39E0   		cmpq	%r12, %rax
+ 275 0273 75B4     		jne	.L36
+ 276 0275 E8000000 		call	fclose@PLT
+ 276      00
+ 277 027a 85C0     		testl	%eax, %eax
+ 278 027c 75B0     		jne	.L27
+ 279 027e 4C89F6   		movq	%r14, %rsi
+ 280 0281 4C89FF   		movq	%r15, %rdi
+ 281 0284 E8000000 		call	rename@PLT
+ 281      00
+ 282 0289 85C0     		testl	%eax, %eax
+ 283 028b 75A1     		jne	.L27
+ 284 028d 4C89F1   		movq	%r14, %rcx
+ 285 0290 488D1500 		leaq	__func__.0(%rip), %rdx
+ 285      000000
+ 286 0297 BF010000 		movl	$1, %edi
+ 286      00
+ 287 029c 488D3500 		leaq	.LC6(%rip), %rsi
+ 287      000000
+ 288 02a3 E8000000 		call	debugprint@PLT
+ 288      00
+ 289 02a8 E970FEFF 		jmp	.L18
+ 289      FF
+ 290              	.L38:
+ 291 02ad E8000000 		call	__errno_location@PLT
+ 291      00
+ 292 02b2 8B38     		movl	(%rax), %edi
+ 293 02b4 E8000000 		call	strerror@PLT
+ 293      00
+ 294 02b9 4C89F9   		movq	%r15, %rcx
+ 295 02bc 488D1500 		leaq	__func__.0(%rip), %rdx
+ 295      000000
+ 296 02c3 31FF     		xorl	%edi, %edi
+ 297 02c5 4989C0   		movq	%rax, %r8
+ 298 02c8 488D3500 		leaq	.LC5(%rip), %rsi
+ 298      000000
+ 299 02cf 31C0     		xorl	%eax, %eax
+ 300 02d1 E8000000 		call	debugprint@PLT
+ 300      00
+ 301 02d6 E940FEFF 		jmp	.L19
+ 301      FF
+ 302              		.cfi_endproc
+ 303              	.LFE20:
+ 305 02db 0F1F4400 		.p2align 4
+ 305      00
+ 306              		.globl	cache_release
+ 308              	cache_release:
+ 309              	.LFB21:
+ 310              		.cfi_startproc
+ 311 02e0 53       		pushq	%rbx
+ 312              		.cfi_def_cfa_offset 16
+ 313              		.cfi_offset 3, -16
+ 314 02e1 4889FB   		movq	%rdi, %rbx
+ 315 02e4 488B3F   		movq	(%rdi), %rdi
+ 316 02e7 4885FF   		testq	%rdi, %rdi
+ 317 02ea 7409     		je	.L41
+ 318 02ec 488B7308 		movq	8(%rbx), %rsi
+ 319 02f0 E8000000 		call	munmap@PLT
+ 319      00
+ 320              	.L41:
+ 321 02f5 48C70300 		movq	$0, (%rbx)
+ 321      000000
+ 322 02fc 5B       		popq	%rbx
+ 323              		.cfi_def_cfa_offset 8
+ 324 02fd C3       		ret
+ 325              		.cfi_endproc
+ 326              	.LFE21:
+ 328              		.section	.rodata.str1.8,"aMS",@progbits,1
+ 329              		.align 8
+ 330              	.LC8:
+ 331 0000 25733A20 		.string	"%s: Ignoring invalid cache entry %s\n"
+ 331      49676E6F 
+ 331      72696E67 
+ 331      20696E76 
+ 331      616C6964 
+ 332              		.text
+ 333 02fe 6690     		.p2align 4
+ 334              		.globl	cache_load
+ 336              	cache_load:
+ 337              	.LFB19:
+ 338              		.cfi_startproc
+ 339 0300 4156     		pushq	%r14
+ 340              		.cfi_def_cfa_offset 16
+ 341              		.cfi_offset 14, -16
+ 342 0302 4155     		pushq	%r13
+ 343              		.cfi_def_cfa_offset 24
+ 344              		.cfi_offset 13, -24
+ 345 0304 4989F5   		movq	%rsi, %r13
+ 346 0307 4154     		pushq	%r12
+ 347              		.cfi_def_cfa_offset 32
+ 348              		.cfi_offset 12, -32
+ 349 0309 4989D4   		movq	%rdx, %r12
+ 350 030c 55       		pushq	%rbp
+ 351              		.cfi_def_cfa_offset 40
+ 352              		.cfi_offset 6, -40
+ 353 030d 4889FD   		movq	%rdi, %rbp
+ 354 0310 53       		pushq	%rbx
+ 355              		.cfi_def_cfa_offset 48
+ 356              		.cfi_offset 3, -48
+ 357 0311 4881EC90 		subq	$4240, %rsp
+ 357      100000
+ 358              		.cfi_def_cfa_offset 4288
+ 359 0318 48C70700 		movq	$0, (%rdi)
+ 359      000000
+ 360 031f E8000000 		call	cache_enabled@PLT
+ 360      00
+ 361 0324 84C0     		testb	%al, %al
+ 362 0326 7518     		jne	.L62
+ 363              	.L48:
+ 364 0328 31DB     		xorl	%ebx, %ebx
+ 365              	.L46:
+ 366 032a 4881C490 		addq	$4240, %rsp
+ 366      100000
+ 367              		.cfi_remember_state
+ 368              		.cfi_def_cfa_offset 48
+ 369 0331 89D8     		movl	%ebx, %eax
+ 370 0333 5B       		popq	%rbx
+ 371              		.cfi_def_cfa_offset 40
+ 372 0334 5D       		popq	%rbp
+ 373              		.cfi_def_cfa_offset 32
+ 374 0335 415C     		popq	%r12
+ 375              		.cfi_def_cfa_offset 24
+ 376 0337 415D     		popq	%r13
+ 377              		.cfi_def_cfa_offset 16
+ 378 0339 415E     		popq	%r14
+ 379              		.cfi_def_cfa_offset 8
+ 380 033b C3       		ret
+ 381 033c 0F1F4000 		.p2align 4,,10
+ 382              		.p2align 3
+ 383              	.L62:
+ 384              		.cfi_restore_state
+ 385 0340 488D3D00 		leaq	.LC1(%rip), %rdi
+ 385      000000
+ 386 0347 89C3     		movl	%eax, %ebx
+ 387 0349 E8000000 		call	getenv@PLT
+ 387      00
+ 388 034e 4889C1   		movq	%rax, %rcx
+ 389 0351 4885C0   		testq	%rax, %rax
+ 390 0354 7409     		je	.L49
+ 391 0356 31C0     		xorl	%eax, %eax
+ 392 0358 803900   		cmpb	$0, (%rcx)
+ 393 035b 480F44C8 		cmove	%rax, %rcx
+ 394              	.L49:
+ 395 035f 4C8DB424 		leaq	144(%rsp), %r14
+ 395      90000000 
+ 396 0367 4D89E8   		movq	%r13, %r8
+ 397 036a 4D89E1   		movq	%r12, %r9
+ 398 036d 488D1500 		leaq	.LC2(%rip), %rdx
+ 398      000000
+ 399 0374 BE001000 		movl	$4096, %esi
+ 399      00
+ 400 0379 4C89F7   		movq	%r14, %rdi
+ 401 037c 31C0     		xorl	%eax, %eax
+ 402 037e E8000000 		call	snprintf@PLT
+ 402      00
+ 403 0383 31F6     		xorl	%esi, %esi
+ 404 0385 4C89F7   		movq	%r14, %rdi
+ 405 0388 31C0     		xorl	%eax, %eax
+ 406 038a E8000000 		call	open@PLT
+ 406      00
+ 407 038f 4189C5   		movl	%eax, %r13d
+ 408 0392 85C0     		testl	%eax, %eax
+ 409 0394 7892     		js	.L48
+ 410 0396 4889E6   		movq	%rsp, %rsi
+ 411 0399 89C7     		movl	%eax, %edi
+ 412 039b E8000000 		call	fstat@PLT
+ 412      00
+ 413 03a0 85C0     		testl	%eax, %eax
+ 414 03a2 750B     		jne	.L51
+ 415 03a4 488B7424 		movq	48(%rsp), %rsi
+ 415      30
+ 416 03a9 4883FE3F 		cmpq	$63, %rsi
+ 417 03ad 7F11     		jg	.L52
+ 418              	.L51:
+ 419 03af 4489EF   		movl	%r13d, %edi
+ 420 03b2 E8000000 		call	close@PLT
+ 420      00
+ 421 03b7 E96CFFFF 		jmp	.L48
+ 421      FF
+ 422 03bc 0F1F4000 		.p2align 4,,10
+ 423              		.p2align 3
+ 424              	.L52:
+ 425 03c0 48897508 		movq	%rsi, 8(%rbp)
+ 426 03c4 4531C9   		xorl	%r9d, %r9d
+ 427 03c7 4589E8   		movl	%r13d, %r8d
+ 428 03ca B9010000 		movl	$1, %ecx
+ 428      00
+ 429 03cf BA010000 		movl	$1, %edx
+ 429      00
+ 430 03d4 31FF     		xorl	%edi, %edi
+ 431 03d6 E8000000 		call	mmap@PLT
+ 431      00
+ 432 03db 4489EF   		movl	%r13d, %edi
+ 433 03de 48894500 		movq	%rax, 0(%rbp)
+ 434 03e2 E8000000 		call	close@PLT
+ 434      00
+ 435 03e7 488B4500 		movq	0(%rbp), %rax
+ 436 03eb 4883F8FF 		cmpq	$-1, %rax
+ 437 03ef 747F     		je	.L63
+ 438 03f1 48BA5144 		movabsq	$3549752688664331345, %rdx
+ 438      53504341 
+ 438      4331
+ 439 03fb 483910   		cmpq	%rdx, (%rax)
+ 440 03fe 7548     		jne	.L55
+ 441 0400 4C396008 		cmpq	%r12, 8(%rax)
+ 442 0404 7542     		jne	.L55
+ 443 0406 488B5508 		movq	8(%rbp), %rdx
+ 444 040a 488B4810 		movq	16(%rax), %rcx
+ 445 040e 4883EA40 		subq	$64, %rdx
+ 446 0412 4839D1   		cmpq	%rdx, %rcx
+ 447 0415 7531     		jne	.L55
+ 448 0417 4883C040 		addq	$64, %rax
+ 449 041b 48894D18 		movq	%rcx, 24(%rbp)
+ 450 041f 4C89F1   		movq	%r14, %rcx
+ 451 0422 488D1500 		leaq	__func__.1(%rip), %rdx
+ 451      000000
+ 452 0429 48894510 		movq	%rax, 16(%rbp)
+ 453 042d 488D3500 		leaq	.LC6(%rip), %rsi
+ 453      000000
+ 454 0434 BF010000 		movl	$1, %edi
+ 454      00
+ 455 0439 31C0     		xorl	%eax, %eax
+ 456 043b E8000000 		call	debugprint@PLT
+ 456      00
+ 457 0440 E9E5FEFF 		jmp	.L46
+ 457      FF
+ 458              		.p2align 4,,10
+ 459 0445 0F1F00   		.p2align 3
+ 460              	.L55:
+ 461 0448 31FF     		xorl	%edi, %edi
+ 462 044a 4C89F1   		movq	%r14, %rcx
+ 463 044d 488D1500 		leaq	__func__.1(%rip), %rdx
+ 463      000000
+ 464 0454 31C0     		xorl	%eax, %eax
+ 465 0456 488D3500 		leaq	.LC8(%rip), %rsi
+ 465      000000
+ 466 045d E8000000 		call	debugprint@PLT
+ 466      00
+ 467 0462 4889EF   		movq	%rbp, %rdi
+ 468 0465 E8000000 		call	cache_release@PLT
+ 468      00
+ 469 046a E9B9FEFF 		jmp	.L48
+ 469      FF
+ 470 046f 90       		.p2align 4,,10
+ 471              		.p2align 3
+ 472              	.L63:
+ 473 0470 48C74500 		movq	$0, 0(%rbp)
+ 473      00000000 
+ 474 0478 E9ABFEFF 		jmp	.L48
+ 474      FF
+ 475              		.cfi_endproc
+ 476              	.LFE19:
+ 478              		.section	.rodata
+ 479              		.align 8
+ 482              	__func__.0:
+ 483 0000 63616368 		.string	"cache_store"
+ 483      655F7374 
+ 483      6F726500 
+ 484 000c 00000000 		.align 8
+ 487              	__func__.1:
+ 488 0010 63616368 		.string	"cache_load"
+ 488      655F6C6F 
+ 488      616400
+ 489              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 490              		.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,545 @@
+   1              		.file	"codegen.c"
+   2              		.text
+   3              		.section	.rodata.str1.1,"aMS",@progbits,1
+   4              	.LC0:
+   5 0000 66393735 		.string	"f975-dirty"
+   5      2D646972 
+   5      747900
+   6              		.section	.rodata.str1.8,"aMS",@progbits,1
+   7              		.align 8
+   8              	.LC1:
+   9 0000 2F2A2047 		.string	"/* Generated by qdsp %s for fs=%u, channels=%d\n"
+   9      656E6572 
+   9      61746564 
+   9      20627920 
+   9      71647370 
+  10              		.align 8
+  11              	.LC2:
+  12 0030 25733A20 		.string	"%s: '%s' does not support code generation\n"
+  12      27257327 
+  12      20646F65 
+  12      73206E6F 
+  12      74207375 
+  13              		.section	.rodata.str1.1
+  14              	.LC3:
+  15 000b 202A2020 		.string	" *   -p %s\n"
+  15      202D7020 
+  15      25730A00 
+  16              	.LC4:
+  17 0017 202A2F0A 		.string	" */\n"
+  17      00
+  18              		.section	.rodata.str1.8
+  19 005b 00000000 		.align 8
+  19      00
+  20              	.LC5:
+  21 0060 23696E63 		.string	"#include <math.h>\n#include <string.h>\n\n"
+  21      6C756465 
+  21      203C6D61 
+  21      74682E68 
+  21      3E0A2369 
+  22              		.section	.rodata.str1.1
+  23              	.LC6:
+  24 001c 23646566 		.string	"#define NCHANNELS %d\n\n"
+  24      696E6520 
+  24      4E434841 
+  24      4E4E454C 
+  24      53202564 
+  25              		.section	.rodata.str1.8
+  26              		.align 8
+  27              	.LC7:
+  28 0088 636F6E73 		.string	"const int qdsp_chain_nchannels = NCHANNELS;\n"
+  28      7420696E 
+  28      74207164 
+  28      73705F63 
+  28      6861696E 
+  29 00b5 000000   		.align 8
+  30              	.LC8:
+  31 00b8 636F6E73 		.string	"const unsigned int qdsp_chain_fs = %u;\n\n"
+  31      7420756E 
+  31      7369676E 
+  31      65642069 
+  31      6E742071 
+  32 00e1 00000000 		.align 8
+  32      000000
+  33              	.LC9:
+  34 00e8 0A766F69 		.string	"\nvoid qdsp_chain_process(const float * const * inbufs, float * const * outbufs, int nfra
+  34      64207164 
+  34      73705F63 
+  34      6861696E 
+  34      5F70726F 
+  35              		.align 8
+  36              	.LC10:
+  37 0148 20202020 		.string	"    for (int c = 0; c < NCHANNELS; c++) {\n"
+  37      666F7220 
+  37      28696E74 
+  37      2063203D 
+  37      20303B20 
+  38 0173 00000000 		.align 8
+  38      00
+  39              	.LC11:
+  40 0178 20202020 		.string	"        const float * restrict inbuf = inbufs[c];\n"
+  40      20202020 
+  40      636F6E73 
+  40      7420666C 
+  40      6F617420 
+  41 01ab 00000000 		.align 8
+  41      00
+  42              	.LC12:
+  43 01b0 20202020 		.string	"        float * restrict outbuf = outbufs[c];\n"
+  43      20202020 
+  43      666C6F61 
+  43      74202A20 
+  43      72657374 
+  44 01df 00       		.align 8
+  45              	.LC13:
+  46 01e0 20202020 		.string	"        for (int n = 0; n < nframes; n++) {\n"
+  46      20202020 
+  46      666F7220 
+  46      28696E74 
+  46      206E203D 
+  47 020d 000000   		.align 8
+  48              	.LC14:
+  49 0210 20202020 		.string	"            float x = inbuf[n];\n"
+  49      20202020 
+  49      20202020 
+  49      666C6F61 
+  49      74207820 
+  50              		.section	.rodata.str1.1
+  51              	.LC15:
+  52 0033 20202020 		.string	"            outbuf[n] = x;\n"
+  52      20202020 
+  52      20202020 
+  52      6F757462 
+  52      75665B6E 
+  53              	.LC16:
+  54 004f 20202020 		.string	"        }\n"
+  54      20202020 
+  54      7D0A00
+  55              	.LC17:
+  56 005a 20202020 		.string	"    }\n}\n\n"
+  56      7D0A7D0A 
+  56      0A00
+  57              		.section	.rodata.str1.8
+  58 0231 00000000 		.align 8
+  58      000000
+  59              	.LC18:
+  60 0238 766F6964 		.string	"void qdsp_chain_reset(void)\n{\n"
+  60      20716473 
+  60      705F6368 
+  60      61696E5F 
+  60      72657365 
+  61              		.section	.rodata.str1.1
+  62              	.LC19:
+  63 0064 7D0A00   		.string	"}\n"
+  64              		.text
+  65              		.p2align 4
+  66              		.globl	codegen_dsp
+  68              	codegen_dsp:
+  69              	.LFB15:
+  70              		.cfi_startproc
+  71 0000 4156     		pushq	%r14
+  72              		.cfi_def_cfa_offset 16
+  73              		.cfi_offset 14, -16
+  74 0002 31C0     		xorl	%eax, %eax
+  75 0004 4C8D3500 		leaq	__func__.0(%rip), %r14
+  75      000000
+  76 000b 4155     		pushq	%r13
+  77              		.cfi_def_cfa_offset 24
+  78              		.cfi_offset 13, -24
+  79 000d 4C8D2D00 		leaq	.LC2(%rip), %r13
+  79      000000
+  80 0014 4154     		pushq	%r12
+  81              		.cfi_def_cfa_offset 32
+  82              		.cfi_offset 12, -32
+  83 0016 4989FC   		movq	%rdi, %r12
+  84 0019 55       		pushq	%rbp
+  85              		.cfi_def_cfa_offset 40
+  86              		.cfi_offset 6, -40
+  87 001a 4889FD   		movq	%rdi, %rbp
+  88 001d 53       		pushq	%rbx
+  89              		.cfi_def_cfa_offset 48
+  90              		.cfi_offset 3, -48
+  91 001e 4889F3   		movq	%rsi, %rbx
+  92 0021 4885FF   		testq	%rdi, %rdi
+  93 0024 7513     		jne	.L2
+  94 0026 EB60     		jmp	.L5
+  95 0028 0F1F8400 		.p2align 4,,10
+  95      00000000 
+  96              		.p2align 3
+  97              	.L4:
+  98 0030 488B6D00 		movq	0(%rbp), %rbp
+  99 0034 4885ED   		testq	%rbp, %rbp
+ 100 0037 7437     		je	.L39
+ 101              	.L2:
+ 102 0039 4883BDF8 		cmpq	$0, 248(%rbp)
+ 102      00000000 
+ 103 0041 75ED     		jne	.L4
+ 104 0043 488B8DB0 		movq	176(%rbp), %rcx
+ 104      000000
+ 105 004a 31C0     		xorl	%eax, %eax
+ 106 004c 4C89F2   		movq	%r14, %rdx
+ 107 004f 4C89EE   		movq	%r13, %rsi
+ 108 0052 31FF     		xorl	%edi, %edi
+ 109 0054 E8000000 		call	debugprint@PLT
+ 109      00
+ 110 0059 488B6D00 		movq	0(%rbp), %rbp
+ 111 005d B8010000 		movl	$1, %eax
+ 111      00
+ 112 0062 4885ED   		testq	%rbp, %rbp
+ 113 0065 75D2     		jne	.L2
+ 114 0067 660F1F84 		.p2align 4,,10
+ 114      00000000 
+ 114      00
+ 115              		.p2align 3
+ 116              	.L39:
+ 117 0070 85C0     		testl	%eax, %eax
+ 118 0072 7414     		je	.L5
+ 119              	.L18:
+ 120 0074 5B       		popq	%rbx
+ 121              		.cfi_remember_state
+ 122              		.cfi_def_cfa_offset 40
+ 123 0075 B8010000 		movl	$1, %eax
+ 123      00
+ 124 007a 5D       		popq	%rbp
+ 125              		.cfi_def_cfa_offset 32
+ 126 007b 415C     		popq	%r12
+ 127              		.cfi_def_cfa_offset 24
+ 128 007d 415D     		popq	%r13
+ 129              		.cfi_def_cfa_offset 16
+ 130 007f 415E     		popq	%r14
+ 131              		.cfi_def_cfa_offset 8
+ 132 0081 C3       		ret
+ 133              		.p2align 4,,10
+ 134 0082 660F1F44 		.p2align 3
+ 134      0000
+ 135              	.L5:
+ 136              		.cfi_restore_state
+ 137 0088 418B8C24 		movl	152(%r12), %ecx
+ 137      98000000 
+ 138 0090 4889DF   		movq	%rbx, %rdi
+ 139 0093 31C0     		xorl	%eax, %eax
+ 140 0095 4C89E5   		movq	%r12, %rbp
+ 141 0098 458B8424 		movl	156(%r12), %r8d
+ 141      9C000000 
+ 142 00a0 488D1500 		leaq	.LC0(%rip), %rdx
+ 142      000000
+ 143 00a7 488D3500 		leaq	.LC1(%rip), %rsi
+ 143      000000
+ 144 00ae 4C8D2D00 		leaq	.LC3(%rip), %r13
+ 144      000000
+ 145 00b5 E8000000 		call	fprintf@PLT
+ 145      00
+ 146 00ba 660F1F44 		.p2align 4,,10
+ 146      0000
+ 147              		.p2align 3
+ 148              	.L3:
+ 149 00c0 488B95B0 		movq	176(%rbp), %rdx
+ 149      000000
+ 150 00c7 4C89EE   		movq	%r13, %rsi
+ 151 00ca 4889DF   		movq	%rbx, %rdi
+ 152 00cd 31C0     		xorl	%eax, %eax
+ 153 00cf E8000000 		call	fprintf@PLT
+ 153      00
+ 154 00d4 488B6D00 		movq	0(%rbp), %rbp
+ 155 00d8 4885ED   		testq	%rbp, %rbp
+ 156 00db 75E3     		jne	.L3
+ 157 00dd 4889D9   		movq	%rbx, %rcx
+ 158 00e0 BA040000 		movl	$4, %edx
+ 158      00
+ 159 00e5 BE010000 		movl	$1, %esi
+ 159      00
+ 160 00ea 4C89E5   		movq	%r12, %rbp
+ 161 00ed 488D3D00 		leaq	.LC4(%rip), %rdi
+ 161      000000
+ 162 00f4 4531F6   		xorl	%r14d, %r14d
+ 163 00f7 E8000000 		call	fwrite@PLT
+ 163      00
+ 164 00fc 4889D9   		movq	%rbx, %rcx
+ 165 00ff BA270000 		movl	$39, %edx
+ 165      00
+ 166 0104 BE010000 		movl	$1, %esi
+ 166      00
+ 167 0109 488D3D00 		leaq	.LC5(%rip), %rdi
+ 167      000000
+ 168 0110 E8000000 		call	fwrite@PLT
+ 168      00
+ 169 0115 418B9424 		movl	156(%r12), %edx
+ 169      9C000000 
+ 170 011d 488D3500 		leaq	.LC6(%rip), %rsi
+ 170      000000
+ 171 0124 31C0     		xorl	%eax, %eax
+ 172 0126 4889DF   		movq	%rbx, %rdi
+ 173 0129 E8000000 		call	fprintf@PLT
+ 173      00
+ 174 012e 4889D9   		movq	%rbx, %rcx
+ 175 0131 BA2C0000 		movl	$44, %edx
+ 175      00
+ 176 0136 BE010000 		movl	$1, %esi
+ 176      00
+ 177 013b 488D3D00 		leaq	.LC7(%rip), %rdi
+ 177      000000
+ 178 0142 E8000000 		call	fwrite@PLT
+ 178      00
+ 179 0147 418B9424 		movl	152(%r12), %edx
+ 179      98000000 
+ 180 014f 488D3500 		leaq	.LC8(%rip), %rsi
+ 180      000000
+ 181 0156 31C0     		xorl	%eax, %eax
+ 182 0158 4889DF   		movq	%rbx, %rdi
+ 183 015b E8000000 		call	fprintf@PLT
+ 183      00
+ 184 0160 EB13     		jmp	.L8
+ 185              		.p2align 4,,10
+ 186 0162 660F1F44 		.p2align 3
+ 186      0000
+ 187              	.L40:
+ 188 0168 488B6D00 		movq	0(%rbp), %rbp
+ 189 016c 4183C601 		addl	$1, %r14d
+ 190 0170 4885ED   		testq	%rbp, %rbp
+ 191 0173 741E     		je	.L7
+ 192              	.L8:
+ 193 0175 4489F1   		movl	%r14d, %ecx
+ 194 0178 31D2     		xorl	%edx, %edx
+ 195 017a 4889DE   		movq	%rbx, %rsi
+ 196 017d 4889EF   		movq	%rbp, %rdi
+ 197 0180 FF95F800 		call	*248(%rbp)
+ 197      0000
+ 198 0186 4189C5   		movl	%eax, %r13d
+ 199 0189 85C0     		testl	%eax, %eax
+ 200 018b 74DB     		je	.L40
+ 201 018d 41BD0100 		movl	$1, %r13d
+ 201      0000
+ 202              	.L7:
+ 203 0193 4889D9   		movq	%rbx, %rcx
+ 204 0196 BA5F0000 		movl	$95, %edx
+ 204      00
+ 205 019b BE010000 		movl	$1, %esi
+ 205      00
+ 206 01a0 4C89E5   		movq	%r12, %rbp
+ 207 01a3 488D3D00 		leaq	.LC9(%rip), %rdi
+ 207      000000
+ 208 01aa 4531F6   		xorl	%r14d, %r14d
+ 209 01ad E8000000 		call	fwrite@PLT
+ 209      00
+ 210 01b2 4889D9   		movq	%rbx, %rcx
+ 211 01b5 BA2A0000 		movl	$42, %edx
+ 211      00
+ 212 01ba BE010000 		movl	$1, %esi
+ 212      00
+ 213 01bf 488D3D00 		leaq	.LC10(%rip), %rdi
+ 213      000000
+ 214 01c6 E8000000 		call	fwrite@PLT
+ 214      00
+ 215 01cb 4889D9   		movq	%rbx, %rcx
+ 216 01ce BA320000 		movl	$50, %edx
+ 216      00
+ 217 01d3 BE010000 		movl	$1, %esi
+ 217      00
+ 218 01d8 488D3D00 		leaq	.LC11(%rip), %rdi
+ 218      000000
+ 219 01df E8000000 		call	fwrite@PLT
+ 219      00
+ 220 01e4 4889D9   		movq	%rbx, %rcx
+ 221 01e7 BA2E0000 		movl	$46, %edx
+ 221      00
+ 222 01ec BE010000 		movl	$1, %esi
+ 222      00
+ 223 01f1 488D3D00 		leaq	.LC12(%rip), %rdi
+ 223      000000
+ 224 01f8 E8000000 		call	fwrite@PLT
+ 224      00
+ 225 01fd EB0E     		jmp	.L10
+ 226 01ff 90       		.p2align 4,,10
+ 227              		.p2align 3
+ 228              	.L41:
+ 229 0200 488B6D00 		movq	0(%rbp), %rbp
+ 230 0204 4183C601 		addl	$1, %r14d
+ 231 0208 4885ED   		testq	%rbp, %rbp
+ 232 020b 741E     		je	.L9
+ 233              	.L10:
+ 234 020d 4489F1   		movl	%r14d, %ecx
+ 235 0210 BA010000 		movl	$1, %edx
+ 235      00
+ 236 0215 4889DE   		movq	%rbx, %rsi
+ 237 0218 4889EF   		movq	%rbp, %rdi
+ 238 021b FF95F800 		call	*248(%rbp)
+ 238      0000
+ 239 0221 85C0     		testl	%eax, %eax
+ 240 0223 74DB     		je	.L41
+ 241 0225 41BD0100 		movl	$1, %r13d
+ 241      0000
+ 242              	.L9:
+ 243 022b 4889D9   		movq	%rbx, %rcx
+ 244 022e BA2C0000 		movl	$44, %edx
+ 244      00
+ 245 0233 BE010000 		movl	$1, %esi
+ 245      00
+ 246 0238 4C89E5   		movq	%r12, %rbp
+ 247 023b 488D3D00 		leaq	.LC13(%rip), %rdi
+ 247      000000
+ 248 0242 4531F6   		xorl	%r14d, %r14d
+ 249 0245 E8000000 		call	fwrite@PLT
+ 249      00
+ 250 024a 4889D9   		movq	%rbx, %rcx
+ 251 024d BA200000 		movl	$32, %edx
+ 251      00
+ 252 0252 BE010000 		movl	$1, %esi
+ 252      00
+ 253 0257 488D3D00 		leaq	.LC14(%rip), %rdi
+ 253      000000
+ 254 025e E8000000 		call	fwrite@PLT
+ 254      00
+ 255 0263 EB10     		jmp	.L12
+ 256              		.p2align 4,,10
+ 257 0265 0F1F00   		.p2align 3
+ 258              	.L42:
+ 259 0268 488B6D00 		movq	0(%rbp), %rbp
+ 260 026c 4183C601 		addl	$1, %r14d
+ 261 0270 4885ED   		testq	%rbp, %rbp
+ 262 0273 741E     		je	.L11
+ 263              	.L12:
+ 264 0275 4489F1   		movl	%r14d, %ecx
+ 265 0278 BA020000 		movl	$2, %edx
+ 265      00
+ 266 027d 4889DE   		movq	%rbx, %rsi
+ 267 0280 4889EF   		movq	%rbp, %rdi
+ 268 0283 FF95F800 		call	*248(%rbp)
+ 268      0000
+ 269 0289 85C0     		testl	%eax, %eax
+ 270 028b 74DB     		je	.L42
+ 271 028d 41BD0100 		movl	$1, %r13d
+ 271      0000
+ 272              	.L11:
+ 273 0293 4889D9   		movq	%rbx, %rcx
+ 274 0296 BA1B0000 		movl	$27, %edx
+ 274      00
+ 275 029b BE010000 		movl	$1, %esi
+ 275      00
+ 276 02a0 4C89E5   		movq	%r12, %rbp
+ 277 02a3 488D3D00 		leaq	.LC15(%rip), %rdi
+ 277      000000
+ 278 02aa 4531F6   		xorl	%r14d, %r14d
+ 279 02ad E8000000 		call	fwrite@PLT
+ 279      00
+ 280 02b2 4889D9   		movq	%rbx, %rcx
+ 281 02b5 BA0A0000 		movl	$10, %edx
+ 281      00
+ 282 02ba BE010000 		movl	$1, %esi
+ 282      00
+ 283 02bf 488D3D00 		leaq	.LC16(%rip), %rdi
+ 283      000000
+ 284 02c6 E8000000 		call	fwrite@PLT
+ 284      00
+ 285 02cb EB10     		jmp	.L14
+ 286 02cd 0F1F00   		.p2align 4,,10
+ 287              		.p2align 3
+ 288              	.L43:
+ 289 02d0 488B6D00 		movq	0(%rbp), %rbp
+ 290 02d4 4183C601 		addl	$1, %r14d
+ 291 02d8 4885ED   		testq	%rbp, %rbp
+ 292 02db 741E     		je	.L13
+ 293              	.L14:
+ 294 02dd 4489F1   		movl	%r14d, %ecx
+ 295 02e0 BA030000 		movl	$3, %edx
+ 295      00
+ 296 02e5 4889DE   		movq	%rbx, %rsi
+ 297 02e8 4889EF   		movq	%rbp, %rdi
+ 298 02eb FF95F800 		call	*248(%rbp)
+ 298      0000
+ 299 02f1 85C0     		testl	%eax, %eax
+ 300 02f3 74DB     		je	.L43
+ 301 02f5 41BD0100 		movl	$1, %r13d
+ 301      0000
+ 302              	.L13:
+ 303 02fb 4889D9   		movq	%rbx, %rcx
+ 304 02fe BA090000 		movl	$9, %edx
+ 304      00
+ 305 0303 BE010000 		movl	$1, %esi
+ 305      00
+ 306 0308 31ED     		xorl	%ebp, %ebp
+ 307 030a 488D3D00 		leaq	.LC17(%rip), %rdi
+ 307      000000
+ 308 0311 E8000000 		call	fwrite@PLT
+ 308      00
+ 309 0316 4889D9   		movq	%rbx, %rcx
+ 310 0319 BA1E0000 		movl	$30, %edx
+ 310      00
+ 311 031e BE010000 		movl	$1, %esi
+ 311      00
+ 312 0323 488D3D00 		leaq	.LC18(%rip), %rdi
+ 312      000000
+ 313 032a E8000000 		call	fwrite@PLT
+ 313      00
+ 314 032f EB13     		jmp	.L16
+ 315              		.p2align 4,,10
+ 316 0331 0F1F8000 		.p2align 3
+ 316      000000
+ 317              	.L45:
+ 318 0338 4D8B2424 		movq	(%r12), %r12
+ 319 033c 83C501   		addl	$1, %ebp
+ 320 033f 4D85E4   		testq	%r12, %r12
+ 321 0342 743C     		je	.L44
+ 322              	.L16:
+ 323 0344 89E9     		movl	%ebp, %ecx
+ 324 0346 BA040000 		movl	$4, %edx
+ 324      00
+ 325 034b 4889DE   		movq	%rbx, %rsi
+ 326 034e 4C89E7   		movq	%r12, %rdi
+ 327 0351 41FF9424 		call	*248(%r12)
+ 327      F8000000 
+ 328 0359 85C0     		testl	%eax, %eax
+ 329 035b 74DB     		je	.L45
+ 330 035d 4889D9   		movq	%rbx, %rcx
+ 331 0360 BA020000 		movl	$2, %edx
+ 331      00
+ 332 0365 BE010000 		movl	$1, %esi
+ 332      00
+ 333 036a 488D3D00 		leaq	.LC19(%rip), %rdi
+ 333      000000
+ 334 0371 E8000000 		call	fwrite@PLT
+ 334      00
+ 335 0376 E9F9FCFF 		jmp	.L18
+ 335      FF
+ 336 037b 0F1F4400 		.p2align 4,,10
+ 336      00
+ 337              		.p2align 3
+ 338              	.L44:
+ 339 0380 4889D9   		movq	%rbx, %rcx
+ 340 0383 BA020000 		movl	$2, %edx
+ 340      00
+ 341 0388 BE010000 		movl	$1, %esi
+ 341      00
+ 342 038d 488D3D00 		leaq	.LC19(%rip), %rdi
+ 342      000000
+ 343 0394 E8000000 		call	fwrite@PLT
+ 343      00
+ 344 0399 4585ED   		testl	%r13d, %r13d
+ 345 039c 0F85D2FC 		jne	.L18
+ 345      FFFF
+ 346 03a2 4889DF   		movq	%rbx, %rdi
+ 347 03a5 E8000000 		call	ferror@PLT
+ 347      00
+ 348 03aa 5B       		popq	%rbx
+ 349              		.cfi_def_cfa_offset 40
+ 350 03ab 5D       		popq	%rbp
+ 351              		.cfi_def_cfa_offset 32
+ 352 03ac 85C0     		testl	%eax, %eax
+ 353 03ae 415C     		popq	%r12
+ 354              		.cfi_def_cfa_offset 24
+ 355 03b0 415D     		popq	%r13
+ 356              		.cfi_def_cfa_offset 16
+ 357 03b2 0F95C0   		setne	%al
+ 358 03b5 415E     		popq	%r14
+ 359              		.cfi_def_cfa_offset 8
+ 360 03b7 0FB6C0   		movzbl	%al, %eax
+ 361 03ba C3       		ret
+ 362              		.cfi_endproc
+ 363              	.LFE15:
+ 365              		.section	.rodata
+ 366              		.align 8
+ 369              	__func__.0:
+ 370 0000 636F6465 		.string	"codegen_dsp"
+ 370      67656E5F 
+ 370      64737000 
+ 371              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 372              		.section	.note.GNU-stack,"",@progbits
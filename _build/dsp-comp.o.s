@@ -0,0 +1,3967 @@
+   1              		.file	"dsp-comp.c"
+   2              		.text
+   3              		.p2align 4
+   5              	comp_smooth:
+   6              	.LFB6402:
+   7              		.cfi_startproc
+   8 0000 4154     		pushq	%r12
+   9              		.cfi_def_cfa_offset 16
+  10              		.cfi_offset 12, -16
+  11 0002 C5FA106F 		vmovss	76(%rdi), %xmm5
+  11      4C
+  12 0007 4989F1   		movq	%rsi, %r9
+  13 000a 4189D2   		movl	%edx, %r10d
+  14 000d 55       		pushq	%rbp
+  15              		.cfi_def_cfa_offset 24
+  16              		.cfi_offset 6, -24
+  17 000e C5FA1077 		vmovss	80(%rdi), %xmm6
+  17      50
+  18 0013 4589C4   		movl	%r8d, %r12d
+  19 0016 4963E8   		movslq	%r8d, %rbp
+  20 0019 53       		pushq	%rbx
+  21              		.cfi_def_cfa_offset 32
+  22              		.cfi_offset 3, -32
+  23 001a 4585C0   		testl	%r8d, %r8d
+  24 001d 0F8EFC00 		jle	.L2
+  24      0000
+  25 0023 31C0     		xorl	%eax, %eax
+  26 0025 4C8D5C24 		leaq	-32(%rsp), %r11
+  26      E0
+  27 002a 660F1F44 		.p2align 4,,10
+  27      0000
+  28              		.p2align 3
+  29              	.L3:
+  30 0030 488B14C1 		movq	(%rcx,%rax,8), %rdx
+  31 0034 C5FA1002 		vmovss	(%rdx), %xmm0
+  32 0038 C4C17A11 		vmovss	%xmm0, (%r11,%rax,4)
+  32      0483
+  33 003e 4883C001 		addq	$1, %rax
+  34 0042 4839E8   		cmpq	%rbp, %rax
+  35 0045 75E9     		jne	.L3
+  36 0047 4585D2   		testl	%r10d, %r10d
+  37 004a 0F8E9900 		jle	.L7
+  37      0000
+  38              	.L5:
+  39 0050 4963F2   		movslq	%r10d, %rsi
+  40 0053 498D1CAB 		leaq	(%r11,%rbp,4), %rbx
+  41 0057 4531C0   		xorl	%r8d, %r8d
+  42 005a 48C1E602 		salq	$2, %rsi
+  43              	.L6:
+  44 005e 4585E4   		testl	%r12d, %r12d
+  45 0061 0F8EA500 		jle	.L23
+  45      0000
+  46 0067 C5FA101D 		vmovss	.LC1(%rip), %xmm3
+  46      00000000 
+  47 006f C5FA1025 		vmovss	.LC0(%rip), %xmm4
+  47      00000000 
+  48 0077 660F1F84 		.p2align 4,,10
+  48      00000000 
+  48      00
+  49              		.p2align 3
+  50              	.L11:
+  51 0080 4C89D8   		movq	%r11, %rax
+  52 0083 4C89CA   		movq	%r9, %rdx
+  53 0086 662E0F1F 		.p2align 4,,10
+  53      84000000 
+  53      0000
+  54              		.p2align 3
+  55              	.L10:
+  56 0090 C5FA100A 		vmovss	(%rdx), %xmm1
+  57 0094 C5FA1000 		vmovss	(%rax), %xmm0
+  58 0098 4883C004 		addq	$4, %rax
+  59 009c C5FA5CD1 		vsubss	%xmm1, %xmm0, %xmm2
+  60 00a0 C5F2C2C0 		vcmpltss	%xmm0, %xmm1, %xmm0
+  60      01
+  61 00a5 C4E3494A 		vblendvps	%xmm0, %xmm5, %xmm6, %xmm0
+  61      C500
+  62 00ab C5FA59C2 		vmulss	%xmm2, %xmm0, %xmm0
+  63 00af C5FA58C1 		vaddss	%xmm1, %xmm0, %xmm0
+  64 00b3 C5FA5CD1 		vsubss	%xmm1, %xmm0, %xmm2
+  65 00b7 C5E854D4 		vandps	%xmm4, %xmm2, %xmm2
+  66 00bb C5EAC2D3 		vcmpltss	%xmm3, %xmm2, %xmm2
+  66      01
+  67 00c0 C4E3794A 		vblendvps	%xmm2, %xmm1, %xmm0, %xmm1
+  67      C920
+  68 00c6 C5FA1148 		vmovss	%xmm1, -4(%rax)
+  68      FC
+  69 00cb C5F2584F 		vaddss	72(%rdi), %xmm1, %xmm1
+  69      48
+  70 00d0 C5FA110A 		vmovss	%xmm1, (%rdx)
+  71 00d4 4801F2   		addq	%rsi, %rdx
+  72 00d7 4839D8   		cmpq	%rbx, %rax
+  73 00da 75B4     		jne	.L10
+  74 00dc 4183C001 		addl	$1, %r8d
+  75 00e0 4983C104 		addq	$4, %r9
+  76 00e4 4539D0   		cmpl	%r10d, %r8d
+  77 00e7 7C97     		jl	.L11
+  78              	.L7:
+  79 00e9 31C0     		xorl	%eax, %eax
+  80 00eb 0F1F4400 		.p2align 4,,10
+  80      00
+  81              		.p2align 3
+  82              	.L14:
+  83 00f0 488B14C1 		movq	(%rcx,%rax,8), %rdx
+  84 00f4 C4C17A10 		vmovss	(%r11,%rax,4), %xmm0
+  84      0483
+  85 00fa 4883C001 		addq	$1, %rax
+  86 00fe C5FA1102 		vmovss	%xmm0, (%rdx)
+  87 0102 4839E8   		cmpq	%rbp, %rax
+  88 0105 75E9     		jne	.L14
+  89              	.L24:
+  90 0107 5B       		popq	%rbx
+  91              		.cfi_remember_state
+  92              		.cfi_def_cfa_offset 24
+  93 0108 5D       		popq	%rbp
+  94              		.cfi_def_cfa_offset 16
+  95 0109 415C     		popq	%r12
+  96              		.cfi_def_cfa_offset 8
+  97 010b C3       		ret
+  98              	.L23:
+  99              		.cfi_restore_state
+ 100 010c 4183C001 		addl	$1, %r8d
+ 101 0110 4983C104 		addq	$4, %r9
+ 102 0114 4539C2   		cmpl	%r8d, %r10d
+ 103 0117 0F8F41FF 		jg	.L6
+ 103      FFFF
+ 104 011d EBE8     		jmp	.L24
+ 105              	.L2:
+ 106 011f 4C8D5C24 		leaq	-32(%rsp), %r11
+ 106      E0
+ 107 0124 85D2     		testl	%edx, %edx
+ 108 0126 0F8F24FF 		jg	.L5
+ 108      FFFF
+ 109 012c EBD9     		jmp	.L24
+ 110              		.cfi_endproc
+ 111              	.LFE6402:
+ 113 012e 6690     		.p2align 4
+ 115              	comp_idle:
+ 116              	.LFB6403:
+ 117              		.cfi_startproc
+ 118 0130 4154     		pushq	%r12
+ 119              		.cfi_def_cfa_offset 16
+ 120              		.cfi_offset 12, -16
+ 121 0132 C5F057C9 		vxorps	%xmm1, %xmm1, %xmm1
+ 122 0136 4989FC   		movq	%rdi, %r12
+ 123 0139 55       		pushq	%rbp
+ 124              		.cfi_def_cfa_offset 24
+ 125              		.cfi_offset 6, -24
+ 126 013a 89F5     		movl	%esi, %ebp
+ 127 013c 53       		pushq	%rbx
+ 128              		.cfi_def_cfa_offset 32
+ 129              		.cfi_offset 3, -32
+ 130 013d 4889D3   		movq	%rdx, %rbx
+ 131 0140 4883EC10 		subq	$16, %rsp
+ 132              		.cfi_def_cfa_offset 48
+ 133 0144 C5FA1067 		vmovss	56(%rdi), %xmm4
+ 133      38
+ 134 0149 C5FA1015 		vmovss	.LC2(%rip), %xmm2
+ 134      00000000 
+ 135 0151 C5EA5C57 		vsubss	52(%rdi), %xmm2, %xmm2
+ 135      34
+ 136 0156 C5EA5957 		vmulss	68(%rdi), %xmm2, %xmm2
+ 136      44
+ 137 015b C5FA1164 		vmovss	%xmm4, 4(%rsp)
+ 137      2404
+ 138 0161 C5EA58C4 		vaddss	%xmm4, %xmm2, %xmm0
+ 139 0165 C5FA1154 		vmovss	%xmm2, 12(%rsp)
+ 139      240C
+ 140 016b E8000000 		call	fmaxf@PLT
+ 140      00
+ 141 0170 C5FA1064 		vmovss	4(%rsp), %xmm4
+ 141      2404
+ 142 0176 C5F828C8 		vmovaps	%xmm0, %xmm1
+ 143 017a C5DA58C4 		vaddss	%xmm4, %xmm4, %xmm0
+ 144 017e C5FA1164 		vmovss	%xmm4, 8(%rsp)
+ 144      2408
+ 145 0184 E8000000 		call	fminf@PLT
+ 145      00
+ 146 0189 C5FA1054 		vmovss	12(%rsp), %xmm2
+ 146      240C
+ 147 018f C5FA1064 		vmovss	8(%rsp), %xmm4
+ 147      2408
+ 148 0195 C5F057C9 		vxorps	%xmm1, %xmm1, %xmm1
+ 149 0199 C5FA1144 		vmovss	%xmm0, 4(%rsp)
+ 149      2404
+ 150 019f C5EA5CC4 		vsubss	%xmm4, %xmm2, %xmm0
+ 151 01a3 E8000000 		call	fmaxf@PLT
+ 151      00
+ 152 01a8 C5FA105C 		vmovss	4(%rsp), %xmm3
+ 152      2404
+ 153 01ae C5E259DB 		vmulss	%xmm3, %xmm3, %xmm3
+ 154 01b2 C4C16259 		vmulss	60(%r12), %xmm3, %xmm3
+ 154      5C243C
+ 155 01b9 C5E258D8 		vaddss	%xmm0, %xmm3, %xmm3
+ 156 01bd C4C16259 		vmulss	64(%r12), %xmm3, %xmm2
+ 156      542440
+ 157 01c4 C5FA101B 		vmovss	(%rbx), %xmm3
+ 158 01c8 C5F82FDA 		vcomiss	%xmm2, %xmm3
+ 159 01cc 7662     		jbe	.L33
+ 160 01ce C4C17A10 		vmovss	76(%r12), %xmm0
+ 160      44244C
+ 161              	.L30:
+ 162 01d5 C5F057C9 		vxorps	%xmm1, %xmm1, %xmm1
+ 163 01d9 C5FA1154 		vmovss	%xmm2, 8(%rsp)
+ 163      2408
+ 164 01df C5F22ACD 		vcvtsi2ssl	%ebp, %xmm1, %xmm1
+ 165 01e3 C5FA115C 		vmovss	%xmm3, 4(%rsp)
+ 165      2404
+ 166 01e9 E8000000 		call	powf@PLT
+ 166      00
+ 167 01ee C5FA1054 		vmovss	8(%rsp), %xmm2
+ 167      2408
+ 168 01f4 C5FA105C 		vmovss	4(%rsp), %xmm3
+ 168      2404
+ 169 01fa C5E25CDA 		vsubss	%xmm2, %xmm3, %xmm3
+ 170 01fe C5E259D8 		vmulss	%xmm0, %xmm3, %xmm3
+ 171 0202 C5E258DA 		vaddss	%xmm2, %xmm3, %xmm3
+ 172 0206 C5E25CC2 		vsubss	%xmm2, %xmm3, %xmm0
+ 173 020a C5F85405 		vandps	.LC0(%rip), %xmm0, %xmm0
+ 173      00000000 
+ 174 0212 C5FAC205 		vcmpltss	.LC1(%rip), %xmm0, %xmm0
+ 174      00000000 
+ 174      01
+ 175 021b C4E3614A 		vblendvps	%xmm0, %xmm2, %xmm3, %xmm2
+ 175      D200
+ 176 0221 C5FA1113 		vmovss	%xmm2, (%rbx)
+ 177 0225 4883C410 		addq	$16, %rsp
+ 178              		.cfi_remember_state
+ 179              		.cfi_def_cfa_offset 32
+ 180 0229 5B       		popq	%rbx
+ 181              		.cfi_def_cfa_offset 24
+ 182 022a 5D       		popq	%rbp
+ 183              		.cfi_def_cfa_offset 16
+ 184 022b 415C     		popq	%r12
+ 185              		.cfi_def_cfa_offset 8
+ 186 022d C3       		ret
+ 187 022e 6690     		.p2align 4,,10
+ 188              		.p2align 3
+ 189              	.L33:
+ 190              		.cfi_restore_state
+ 191 0230 C4C17A10 		vmovss	80(%r12), %xmm0
+ 191      442450
+ 192 0237 EB9C     		jmp	.L30
+ 193              		.cfi_endproc
+ 194              	.LFE6403:
+ 196 0239 0F1F8000 		.p2align 4
+ 196      000000
+ 198              	peak_block:
+ 199              	.LFB6406:
+ 200              		.cfi_startproc
+ 201 0240 4C8D5424 		leaq	8(%rsp), %r10
+ 201      08
+ 202              		.cfi_def_cfa 10, 0
+ 203 0245 4883E4E0 		andq	$-32, %rsp
+ 204 0249 4189C8   		movl	%ecx, %r8d
+ 205 024c 41FF72F8 		pushq	-8(%r10)
+ 206 0250 55       		pushq	%rbp
+ 207 0251 4889E5   		movq	%rsp, %rbp
+ 208              		.cfi_escape 0x10,0x6,0x2,0x76,0
+ 209 0254 4157     		pushq	%r15
+ 210              		.cfi_escape 0x10,0xf,0x2,0x76,0x78
+ 211 0256 4989FF   		movq	%rdi, %r15
+ 212 0259 4156     		pushq	%r14
+ 213              		.cfi_escape 0x10,0xe,0x2,0x76,0x70
+ 214 025b 4989F6   		movq	%rsi, %r14
+ 215 025e 4155     		pushq	%r13
+ 216 0260 4154     		pushq	%r12
+ 217 0262 4152     		pushq	%r10
+ 218              		.cfi_escape 0xf,0x3,0x76,0x58,0x6
+ 219              		.cfi_escape 0x10,0xd,0x2,0x76,0x68
+ 220              		.cfi_escape 0x10,0xc,0x2,0x76,0x60
+ 221 0264 53       		pushq	%rbx
+ 222 0265 4883EC20 		subq	$32, %rsp
+ 223              		.cfi_escape 0x10,0x3,0x2,0x76,0x50
+ 224 0269 8955CC   		movl	%edx, -52(%rbp)
+ 225 026c 83F907   		cmpl	$7, %ecx
+ 226 026f 0F8E0301 		jle	.L44
+ 226      0000
+ 227 0275 C4E27D18 		vbroadcastss	.LC5(%rip), %ymm2
+ 227      15000000 
+ 227      00
+ 228 027e 8D41F8   		leal	-8(%rcx), %eax
+ 229 0281 4C8B16   		movq	(%rsi), %r10
+ 230 0284 31C9     		xorl	%ecx, %ecx
+ 231 0286 C1E803   		shrl	$3, %eax
+ 232 0289 8D7801   		leal	1(%rax), %edi
+ 233 028c 8D42FE   		leal	-2(%rdx), %eax
+ 234 028f 4989F9   		movq	%rdi, %r9
+ 235 0292 488D74C6 		leaq	16(%rsi,%rax,8), %rsi
+ 235      10
+ 236 0297 48C1E705 		salq	$5, %rdi
+ 237 029b 0F1F4400 		.p2align 4,,10
+ 237      00
+ 238              		.p2align 3
+ 239              	.L39:
+ 240 02a0 837DCC01 		cmpl	$1, -52(%rbp)
+ 241 02a4 C4C16C54 		vandps	(%r10,%rcx), %ymm2, %ymm0
+ 241      040A
+ 242 02aa 7E19     		jle	.L37
+ 243 02ac 498D4608 		leaq	8(%r14), %rax
+ 244              		.p2align 4,,10
+ 245              		.p2align 3
+ 246              	.L38:
+ 247 02b0 488B10   		movq	(%rax), %rdx
+ 248 02b3 4883C008 		addq	$8, %rax
+ 249 02b7 C5EC540C 		vandps	(%rdx,%rcx), %ymm2, %ymm1
+ 249      0A
+ 250 02bc C5FC5FC1 		vmaxps	%ymm1, %ymm0, %ymm0
+ 251 02c0 4839F0   		cmpq	%rsi, %rax
+ 252 02c3 75EB     		jne	.L38
+ 253              	.L37:
+ 254 02c5 C4C17C11 		vmovups	%ymm0, (%r15,%rcx)
+ 254      040F
+ 255 02cb 4883C120 		addq	$32, %rcx
+ 256 02cf 4839F9   		cmpq	%rdi, %rcx
+ 257 02d2 75CC     		jne	.L39
+ 258 02d4 428D04CD 		leal	0(,%r9,8), %eax
+ 258      00000000 
+ 259 02dc C5F877   		vzeroupper
+ 260              	.L36:
+ 261 02df 4139C0   		cmpl	%eax, %r8d
+ 262 02e2 7E7F     		jle	.L49
+ 263 02e4 4863D0   		movslq	%eax, %rdx
+ 264 02e7 4129C0   		subl	%eax, %r8d
+ 265 02ea 498B3E   		movq	(%r14), %rdi
+ 266 02ed 498D0410 		leaq	(%r8,%rdx), %rax
+ 267 02f1 488D1C95 		leaq	0(,%rdx,4), %rbx
+ 267      00000000 
+ 268 02f9 48C1E002 		salq	$2, %rax
+ 269 02fd 48897DC0 		movq	%rdi, -64(%rbp)
+ 270 0301 488945B8 		movq	%rax, -72(%rbp)
+ 271 0305 8B45CC   		movl	-52(%rbp), %eax
+ 272 0308 83E802   		subl	$2, %eax
+ 273 030b 4D8D64C6 		leaq	16(%r14,%rax,8), %r12
+ 273      10
+ 274              		.p2align 4,,10
+ 275              		.p2align 3
+ 276              	.L43:
+ 277 0310 488B45C0 		movq	-64(%rbp), %rax
+ 278 0314 837DCC01 		cmpl	$1, -52(%rbp)
+ 279 0318 C5FA100C 		vmovss	(%rax,%rbx), %xmm1
+ 279      18
+ 280 031d C5F0540D 		vandps	.LC0(%rip), %xmm1, %xmm1
+ 280      00000000 
+ 281 0325 7E2C     		jle	.L41
+ 282 0327 4D8D6E08 		leaq	8(%r14), %r13
+ 283 032b 0F1F4400 		.p2align 4,,10
+ 283      00
+ 284              		.p2align 3
+ 285              	.L42:
+ 286 0330 498B5500 		movq	0(%r13), %rdx
+ 287 0334 4983C508 		addq	$8, %r13
+ 288 0338 C5FA1004 		vmovss	(%rdx,%rbx), %xmm0
+ 288      1A
+ 289 033d C5F85405 		vandps	.LC0(%rip), %xmm0, %xmm0
+ 289      00000000 
+ 290 0345 E8000000 		call	fmaxf@PLT
+ 290      00
+ 291 034a C5F828C8 		vmovaps	%xmm0, %xmm1
+ 292 034e 4D39EC   		cmpq	%r13, %r12
+ 293 0351 75DD     		jne	.L42
+ 294              	.L41:
+ 295 0353 C4C17A11 		vmovss	%xmm1, (%r15,%rbx)
+ 295      0C1F
+ 296 0359 4883C304 		addq	$4, %rbx
+ 297 035d 48395DB8 		cmpq	%rbx, -72(%rbp)
+ 298 0361 75AD     		jne	.L43
+ 299              	.L49:
+ 300 0363 4883C420 		addq	$32, %rsp
+ 301 0367 5B       		popq	%rbx
+ 302 0368 415A     		popq	%r10
+ 303              		.cfi_remember_state
+ 304              		.cfi_def_cfa 10, 0
+ 305 036a 415C     		popq	%r12
+ 306 036c 415D     		popq	%r13
+ 307 036e 415E     		popq	%r14
+ 308 0370 415F     		popq	%r15
+ 309 0372 5D       		popq	%rbp
+ 310 0373 498D62F8 		leaq	-8(%r10), %rsp
+ 311              		.cfi_def_cfa 7, 8
+ 312 0377 C3       		ret
+ 313              	.L44:
+ 314              		.cfi_restore_state
+ 315 0378 31C0     		xorl	%eax, %eax
+ 316 037a E960FFFF 		jmp	.L36
+ 316      FF
+ 317              		.cfi_endproc
+ 318              	.LFE6406:
+ 320 037f 90       		.p2align 4
+ 322              	exp2_block:
+ 323              	.LFB6404:
+ 324              		.cfi_startproc
+ 325 0380 83FE07   		cmpl	$7, %esi
+ 326 0383 0F8EAF01 		jle	.L56
+ 326      0000
+ 327 0389 448D46F8 		leal	-8(%rsi), %r8d
+ 328 038d 4889F8   		movq	%rdi, %rax
+ 329 0390 C4627D18 		vbroadcastss	.LC7(%rip), %ymm11
+ 329      1D000000 
+ 329      00
+ 330 0399 C4627D18 		vbroadcastss	.LC9(%rip), %ymm10
+ 330      15000000 
+ 330      00
+ 331 03a2 C4627D18 		vbroadcastss	.LC12(%rip), %ymm9
+ 331      0D000000 
+ 331      00
+ 332 03ab 41C1E803 		shrl	$3, %r8d
+ 333 03af C4627D18 		vbroadcastss	.LC14(%rip), %ymm8
+ 333      05000000 
+ 333      00
+ 334 03b8 C4E27D18 		vbroadcastss	.LC16(%rip), %ymm7
+ 334      3D000000 
+ 334      00
+ 335 03c1 4489C2   		movl	%r8d, %edx
+ 336 03c4 C4E27D18 		vbroadcastss	.LC18(%rip), %ymm6
+ 336      35000000 
+ 336      00
+ 337 03cd C4E27D18 		vbroadcastss	.LC20(%rip), %ymm5
+ 337      2D000000 
+ 337      00
+ 338 03d6 48C1E205 		salq	$5, %rdx
+ 339 03da C4E27D18 		vbroadcastss	.LC22(%rip), %ymm4
+ 339      25000000 
+ 339      00
+ 340 03e3 488D4C17 		leaq	32(%rdi,%rdx), %rcx
+ 340      20
+ 341 03e8 BA7F0000 		movl	$127, %edx
+ 341      00
+ 342 03ed 62F27D28 		vpbroadcastd	%edx, %ymm3
+ 342      7CDA
+ 343              		.p2align 4,,10
+ 344 03f3 0F1F4400 		.p2align 3
+ 344      00
+ 345              	.L53:
+ 346 03f8 C5FC1010 		vmovups	(%rax), %ymm2
+ 347 03fc 4883C020 		addq	$32, %rax
+ 348 0400 C4C16C5F 		vmaxps	%ymm11, %ymm2, %ymm0
+ 348      C3
+ 349 0405 C4C17C5D 		vminps	%ymm10, %ymm0, %ymm0
+ 349      C2
+ 350 040a 62F37D28 		vrndscaleps	$1, %ymm0, %ymm1
+ 350      08C801
+ 351 0411 C5FC5CC1 		vsubps	%ymm1, %ymm0, %ymm0
+ 352 0415 C5FD5BD1 		vcvtps2dq	%ymm1, %ymm2
+ 353 0419 C5EDFED3 		vpaddd	%ymm3, %ymm2, %ymm2
+ 354 041d C5ED72F2 		vpslld	$23, %ymm2, %ymm2
+ 354      17
+ 355 0422 C5FC28C8 		vmovaps	%ymm0, %ymm1
+ 356 0426 C4C23D98 		vfmadd132ps	%ymm9, %ymm8, %ymm1
+ 356      C9
+ 357 042b C4E24598 		vfmadd132ps	%ymm0, %ymm7, %ymm1
+ 357      C8
+ 358 0430 C4E24D98 		vfmadd132ps	%ymm0, %ymm6, %ymm1
+ 358      C8
+ 359 0435 C4E25598 		vfmadd132ps	%ymm0, %ymm5, %ymm1
+ 359      C8
+ 360 043a C4E25D98 		vfmadd132ps	%ymm1, %ymm4, %ymm0
+ 360      C1
+ 361 043f C5FC59C2 		vmulps	%ymm2, %ymm0, %ymm0
+ 362 0443 C5FC1140 		vmovups	%ymm0, -32(%rax)
+ 362      E0
+ 363 0448 4839C1   		cmpq	%rax, %rcx
+ 364 044b 75AB     		jne	.L53
+ 365 044d 428D04C5 		leal	8(,%r8,8), %eax
+ 365      08000000 
+ 366 0455 C5F877   		vzeroupper
+ 367              	.L52:
+ 368 0458 39C6     		cmpl	%eax, %esi
+ 369 045a 0F8ED000 		jle	.L61
+ 369      0000
+ 370 0460 4C8D5424 		leaq	8(%rsp), %r10
+ 370      08
+ 371              		.cfi_def_cfa 10, 0
+ 372 0465 4883E4E0 		andq	$-32, %rsp
+ 373 0469 4863D0   		movslq	%eax, %rdx
+ 374 046c 29C6     		subl	%eax, %esi
+ 375 046e 41FF72F8 		pushq	-8(%r10)
+ 376 0472 4801D6   		addq	%rdx, %rsi
+ 377 0475 55       		pushq	%rbp
+ 378 0476 4889E5   		movq	%rsp, %rbp
+ 379              		.cfi_escape 0x10,0x6,0x2,0x76,0
+ 380 0479 4154     		pushq	%r12
+ 381              		.cfi_escape 0x10,0xc,0x2,0x76,0x78
+ 382 047b 4C8D2497 		leaq	(%rdi,%rdx,4), %r12
+ 383 047f 4152     		pushq	%r10
+ 384              		.cfi_escape 0xf,0x3,0x76,0x70,0x6
+ 385 0481 53       		pushq	%rbx
+ 386              		.cfi_escape 0x10,0x3,0x2,0x76,0x68
+ 387 0482 488D1CB7 		leaq	(%rdi,%rsi,4), %rbx
+ 388 0486 4883EC18 		subq	$24, %rsp
+ 389 048a 660F1F44 		.p2align 4,,10
+ 389      0000
+ 390              		.p2align 3
+ 391              	.L55:
+ 392 0490 C4C17A10 		vmovss	(%r12), %xmm0
+ 392      0424
+ 393 0496 4983C404 		addq	$4, %r12
+ 394 049a C5FA100D 		vmovss	.LC7(%rip), %xmm1
+ 394      00000000 
+ 395 04a2 E8000000 		call	fmaxf@PLT
+ 395      00
+ 396 04a7 C5FA100D 		vmovss	.LC9(%rip), %xmm1
+ 396      00000000 
+ 397 04af E8000000 		call	fminf@PLT
+ 397      00
+ 398 04b4 62F37D08 		vrndscaless	$9, %xmm0, %xmm0, %xmm2
+ 398      0AD009
+ 399 04bb C5FA5CCA 		vsubss	%xmm2, %xmm0, %xmm1
+ 400 04bf C5F25905 		vmulss	.LC12(%rip), %xmm1, %xmm0
+ 400      00000000 
+ 401 04c7 C5FA2CC2 		vcvttss2sil	%xmm2, %eax
+ 402 04cb C5FA5805 		vaddss	.LC14(%rip), %xmm0, %xmm0
+ 402      00000000 
+ 403 04d3 C5FA59C1 		vmulss	%xmm1, %xmm0, %xmm0
+ 404 04d7 C5FA5805 		vaddss	.LC16(%rip), %xmm0, %xmm0
+ 404      00000000 
+ 405 04df 83C07F   		addl	$127, %eax
+ 406 04e2 C1E017   		sall	$23, %eax
+ 407 04e5 C5F96ED8 		vmovd	%eax, %xmm3
+ 408 04e9 C5FA59C1 		vmulss	%xmm1, %xmm0, %xmm0
+ 409 04ed C5FA5805 		vaddss	.LC18(%rip), %xmm0, %xmm0
+ 409      00000000 
+ 410 04f5 C5FA59C1 		vmulss	%xmm1, %xmm0, %xmm0
+ 411 04f9 C5FA5805 		vaddss	.LC20(%rip), %xmm0, %xmm0
+ 411      00000000 
+ 412 0501 C5FA59C1 		vmulss	%xmm1, %xmm0, %xmm0
+ 413 0505 C5FA5805 		vaddss	.LC22(%rip), %xmm0, %xmm0
+ 413      00000000 
+ 414 050d C5FA59C3 		vmulss	%xmm3, %xmm0, %xmm0
+ 415 0511 C4C17A11 		vmovss	%xmm0, -4(%r12)
+ 415      4424FC
+ 416 0518 4C39E3   		cmpq	%r12, %rbx
+ 417 051b 0F856FFF 		jne	.L55
+ 417      FFFF
+ 418 0521 4883C418 		addq	$24, %rsp
+ 419 0525 5B       		popq	%rbx
+ 420 0526 415A     		popq	%r10
+ 421              		.cfi_def_cfa 10, 0
+ 422 0528 415C     		popq	%r12
+ 423 052a 5D       		popq	%rbp
+ 424 052b 498D62F8 		leaq	-8(%r10), %rsp
+ 425              		.cfi_def_cfa 7, 8
+ 426 052f C3       		ret
+ 427              		.p2align 4,,10
+ 428              		.p2align 3
+ 429              	.L61:
+ 430              		.cfi_restore 3
+ 431              		.cfi_restore 6
+ 432              		.cfi_restore 12
+ 433 0530 C3       		ret
+ 434              		.p2align 4,,10
+ 435 0531 0F1F8000 		.p2align 3
+ 435      000000
+ 436              	.L56:
+ 437 0538 31C0     		xorl	%eax, %eax
+ 438 053a E919FFFF 		jmp	.L52
+ 438      FF
+ 439              		.cfi_endproc
+ 440              	.LFE6404:
+ 442 053f 90       		.p2align 4
+ 443              		.globl	destroy_comp
+ 445              	destroy_comp:
+ 446              	.LFB6417:
+ 447              		.cfi_startproc
+ 448 0540 53       		pushq	%rbx
+ 449              		.cfi_def_cfa_offset 16
+ 450              		.cfi_offset 3, -16
+ 451 0541 488B9FC0 		movq	192(%rdi), %rbx
+ 451      000000
+ 452 0548 488B7B78 		movq	120(%rbx), %rdi
+ 453 054c E8000000 		call	free@PLT
+ 453      00
+ 454 0551 4889DF   		movq	%rbx, %rdi
+ 455 0554 5B       		popq	%rbx
+ 456              		.cfi_def_cfa_offset 8
+ 457 0555 E9000000 		jmp	free@PLT
+ 457      00
+ 458              		.cfi_endproc
+ 459              	.LFE6417:
+ 461 055a 660F1F44 		.p2align 4
+ 461      0000
+ 462              		.globl	clone_comp
+ 464              	clone_comp:
+ 465              	.LFB6419:
+ 466              		.cfi_startproc
+ 467 0560 55       		pushq	%rbp
+ 468              		.cfi_def_cfa_offset 16
+ 469              		.cfi_offset 6, -16
+ 470 0561 4889E5   		movq	%rsp, %rbp
+ 471              		.cfi_def_cfa_register 6
+ 472 0564 4154     		pushq	%r12
+ 473              		.cfi_offset 12, -24
+ 474 0566 4989F4   		movq	%rsi, %r12
+ 475 0569 53       		pushq	%rbx
+ 476              		.cfi_offset 3, -32
+ 477 056a 4889FB   		movq	%rdi, %rbx
+ 478 056d BF800000 		movl	$128, %edi
+ 478      00
+ 479 0572 E8000000 		call	malloc@PLT
+ 479      00
+ 480 0577 4885C0   		testq	%rax, %rax
+ 481 057a 743B     		je	.L68
+ 482 057c 498B9424 		movq	192(%r12), %rdx
+ 482      C0000000 
+ 483 0584 62F1FE48 		vmovdqu64	(%rdx), %zmm0
+ 483      6F02
+ 484 058a 62F1FE48 		vmovdqu64	%zmm0, (%rax)
+ 484      7F00
+ 485 0590 62F1FE48 		vmovdqu64	64(%rdx), %zmm1
+ 485      6F4A01
+ 486 0597 488983C0 		movq	%rax, 192(%rbx)
+ 486      000000
+ 487 059e 62F1FE48 		vmovdqu64	%zmm1, 64(%rax)
+ 487      7F4801
+ 488 05a5 48C74078 		movq	$0, 120(%rax)
+ 488      00000000 
+ 489 05ad 31C0     		xorl	%eax, %eax
+ 490 05af C5F877   		vzeroupper
+ 491              	.L66:
+ 492 05b2 5B       		popq	%rbx
+ 493 05b3 415C     		popq	%r12
+ 494 05b5 5D       		popq	%rbp
+ 495              		.cfi_remember_state
+ 496              		.cfi_def_cfa 7, 8
+ 497 05b6 C3       		ret
+ 498              	.L68:
+ 499              		.cfi_restore_state
+ 500 05b7 B8010000 		movl	$1, %eax
+ 500      00
+ 501 05bc EBF4     		jmp	.L66
+ 502              		.cfi_endproc
+ 503              	.LFE6419:
+ 505 05be 6690     		.p2align 4
+ 507              	comp_target_block:
+ 508              	.LFB6401:
+ 509              		.cfi_startproc
+ 510 05c0 4C8D5424 		leaq	8(%rsp), %r10
+ 510      08
+ 511              		.cfi_def_cfa 10, 0
+ 512 05c5 4883E4E0 		andq	$-32, %rsp
+ 513 05c9 41FF72F8 		pushq	-8(%r10)
+ 514 05cd 55       		pushq	%rbp
+ 515 05ce 4889E5   		movq	%rsp, %rbp
+ 516              		.cfi_escape 0x10,0x6,0x2,0x76,0
+ 517 05d1 4156     		pushq	%r14
+ 518 05d3 4155     		pushq	%r13
+ 519              		.cfi_escape 0x10,0xe,0x2,0x76,0x78
+ 520              		.cfi_escape 0x10,0xd,0x2,0x76,0x70
+ 521 05d5 4989F5   		movq	%rsi, %r13
+ 522 05d8 89CE     		movl	%ecx, %esi
+ 523 05da 4154     		pushq	%r12
+ 524              		.cfi_escape 0x10,0xc,0x2,0x76,0x68
+ 525 05dc 4989FC   		movq	%rdi, %r12
+ 526 05df 4152     		pushq	%r10
+ 527              		.cfi_escape 0xf,0x3,0x76,0x60,0x6
+ 528 05e1 53       		pushq	%rbx
+ 529 05e2 4883EC28 		subq	$40, %rsp
+ 530              		.cfi_escape 0x10,0x3,0x2,0x76,0x58
+ 531 05e6 C5FA1067 		vmovss	56(%rdi), %xmm4
+ 531      38
+ 532 05eb C4627D18 		vbroadcastss	68(%rdi), %ymm9
+ 532      4F44
+ 533 05f1 C4627D18 		vbroadcastss	52(%rdi), %ymm10
+ 533      5734
+ 534 05f7 C4E27D18 		vbroadcastss	60(%rdi), %ymm7
+ 534      7F3C
+ 535 05fd C4E27D18 		vbroadcastss	%xmm4, %ymm2
+ 535      D4
+ 536 0602 C4627D18 		vbroadcastss	64(%rdi), %ymm8
+ 536      4740
+ 537 0608 C5DA58E4 		vaddss	%xmm4, %xmm4, %xmm4
+ 538 060c 83F907   		cmpl	$7, %ecx
+ 539 060f 0F8E8302 		jle	.L75
+ 539      0000
+ 540 0615 8D41F8   		leal	-8(%rcx), %eax
+ 541 0618 41B881FF 		movl	$-127, %r8d
+ 541      FFFF
+ 542 061e 62E27D28 		vbroadcastss	.LC5(%rip), %ymm19
+ 542      181D0000 
+ 542      0000
+ 543 0628 62E27D28 		vbroadcastss	.LC24(%rip), %ymm18
+ 543      18150000 
+ 543      0000
+ 544 0632 C1E803   		shrl	$3, %eax
+ 545 0635 62D27D28 		vpbroadcastd	%r8d, %ymm6
+ 545      7CF0
+ 546 063b 62E27D28 		vbroadcastss	.LC27(%rip), %ymm17
+ 546      180D0000 
+ 546      0000
+ 547 0645 49B80000 		movabsq	$4575657222473777152, %r8
+ 547      803F0000 
+ 547      803F
+ 548 064f 8D4801   		leal	1(%rax), %ecx
+ 549 0652 C4E27D18 		vbroadcastss	%xmm4, %ymm4
+ 549      E4
+ 550 0657 31C0     		xorl	%eax, %eax
+ 551 0659 62E27D28 		vbroadcastss	.LC30(%rip), %ymm16
+ 551      18050000 
+ 551      0000
+ 552 0663 C4627D18 		vbroadcastss	.LC32(%rip), %ymm15
+ 552      3D000000 
+ 552      00
+ 553 066c 4889CF   		movq	%rcx, %rdi
+ 554 066f C4627D18 		vbroadcastss	.LC34(%rip), %ymm14
+ 554      35000000 
+ 554      00
+ 555 0678 48C1E105 		salq	$5, %rcx
+ 556 067c C4627D18 		vbroadcastss	.LC36(%rip), %ymm13
+ 556      2D000000 
+ 556      00
+ 557 0685 62D2FD28 		vpbroadcastq	%r8, %ymm5
+ 557      7CE8
+ 558 068b C4627D18 		vbroadcastss	.LC38(%rip), %ymm12
+ 558      25000000 
+ 558      00
+ 559 0694 C5E057DB 		vxorps	%xmm3, %xmm3, %xmm3
+ 560 0698 C4627D18 		vbroadcastss	.LC40(%rip), %ymm11
+ 560      1D000000 
+ 560      00
+ 561              		.p2align 4,,10
+ 562 06a1 0F1F8000 		.p2align 3
+ 562      000000
+ 563              	.L72:
+ 564 06a8 62F16420 		vandps	(%rdx,%rax), %ymm19, %ymm1
+ 564      540C02
+ 565 06af 62A17C28 		vmovaps	%ymm16, %ymm20
+ 565      28E0
+ 566 06b5 62B17428 		vmaxps	%ymm18, %ymm1, %ymm1
+ 566      5FCA
+ 567 06bb C5FD72D1 		vpsrld	$23, %ymm1, %ymm0
+ 567      17
+ 568 06c0 62B17428 		vandps	%ymm17, %ymm1, %ymm1
+ 568      54C9
+ 569 06c6 C5D5EBC9 		vpor	%ymm1, %ymm5, %ymm1
+ 570 06ca C5FDFEC6 		vpaddd	%ymm6, %ymm0, %ymm0
+ 571 06ce 62E20528 		vfmadd132ps	%ymm1, %ymm15, %ymm20
+ 571      98E1
+ 572 06d4 C5FC5BC0 		vcvtdq2ps	%ymm0, %ymm0
+ 573 06d8 62E20D28 		vfmadd132ps	%ymm1, %ymm14, %ymm20
+ 573      98E1
+ 574 06de 62E21528 		vfmadd132ps	%ymm1, %ymm13, %ymm20
+ 574      98E1
+ 575 06e4 62E21D28 		vfmadd132ps	%ymm1, %ymm12, %ymm20
+ 575      98E1
+ 576 06ea 62B22528 		vfmadd132ps	%ymm20, %ymm11, %ymm1
+ 576      98CC
+ 577 06f0 C5FC58C1 		vaddps	%ymm1, %ymm0, %ymm0
+ 578 06f4 C4C17C5C 		vsubps	%ymm10, %ymm0, %ymm0
+ 578      C2
+ 579 06f9 C4C17C59 		vmulps	%ymm9, %ymm0, %ymm0
+ 579      C1
+ 580 06fe C5FC58CA 		vaddps	%ymm2, %ymm0, %ymm1
+ 581 0702 C5FC5CC2 		vsubps	%ymm2, %ymm0, %ymm0
+ 582 0706 C5F45FCB 		vmaxps	%ymm3, %ymm1, %ymm1
+ 583 070a C5FC5FC3 		vmaxps	%ymm3, %ymm0, %ymm0
+ 584 070e C5F45DCC 		vminps	%ymm4, %ymm1, %ymm1
+ 585 0712 C5F459C9 		vmulps	%ymm1, %ymm1, %ymm1
+ 586 0716 C5F459CF 		vmulps	%ymm7, %ymm1, %ymm1
+ 587 071a C5F458C8 		vaddps	%ymm0, %ymm1, %ymm1
+ 588 071e C4C17459 		vmulps	%ymm8, %ymm1, %ymm1
+ 588      C8
+ 589 0723 C4C17C11 		vmovups	%ymm1, 0(%r13,%rax)
+ 589      4C0500
+ 590 072a 4883C020 		addq	$32, %rax
+ 591 072e 4839C1   		cmpq	%rax, %rcx
+ 592 0731 0F8571FF 		jne	.L72
+ 592      FFFF
+ 593 0737 8D04FD00 		leal	0(,%rdi,8), %eax
+ 593      000000
+ 594              	.L71:
+ 595 073e 39C6     		cmpl	%eax, %esi
+ 596 0740 0F8E4A01 		jle	.L78
+ 596      0000
+ 597 0746 4863C8   		movslq	%eax, %rcx
+ 598 0749 29C6     		subl	%eax, %esi
+ 599 074b 488D3C8D 		leaq	0(,%rcx,4), %rdi
+ 599      00000000 
+ 600 0753 4801CE   		addq	%rcx, %rsi
+ 601 0756 4901FD   		addq	%rdi, %r13
+ 602 0759 4C8D343A 		leaq	(%rdx,%rdi), %r14
+ 603 075d 488D1CB2 		leaq	(%rdx,%rsi,4), %rbx
+ 604 0761 C5F877   		vzeroupper
+ 605              		.p2align 4,,10
+ 606 0764 0F1F4000 		.p2align 3
+ 607              	.L74:
+ 608 0768 C4C17A10 		vmovss	(%r14), %xmm0
+ 608      06
+ 609 076d 4983C604 		addq	$4, %r14
+ 610 0771 4983C504 		addq	$4, %r13
+ 611 0775 C5FA100D 		vmovss	.LC24(%rip), %xmm1
+ 611      00000000 
+ 612 077d C5F85405 		vandps	.LC0(%rip), %xmm0, %xmm0
+ 612      00000000 
+ 613 0785 E8000000 		call	fmaxf@PLT
+ 613      00
+ 614 078a C5D057ED 		vxorps	%xmm5, %xmm5, %xmm5
+ 615 078e C4C17A10 		vmovss	56(%r12), %xmm4
+ 615      642438
+ 616 0795 C5F057C9 		vxorps	%xmm1, %xmm1, %xmm1
+ 617 0799 C5F97EC0 		vmovd	%xmm0, %eax
+ 618 079d 89C2     		movl	%eax, %edx
+ 619 079f C1E817   		shrl	$23, %eax
+ 620 07a2 C5FA1165 		vmovss	%xmm4, -52(%rbp)
+ 620      CC
+ 621 07a7 81E2FFFF 		andl	$8388607, %edx
+ 621      7F00
+ 622 07ad 83E87F   		subl	$127, %eax
+ 623 07b0 81CA0000 		orl	$1065353216, %edx
+ 623      803F
+ 624 07b6 C5F96EC2 		vmovd	%edx, %xmm0
+ 625 07ba C5FA5915 		vmulss	.LC30(%rip), %xmm0, %xmm2
+ 625      00000000 
+ 626 07c2 C5EA5C15 		vsubss	.LC41(%rip), %xmm2, %xmm2
+ 626      00000000 
+ 627 07ca C5EA59D0 		vmulss	%xmm0, %xmm2, %xmm2
+ 628 07ce C5EA5815 		vaddss	.LC34(%rip), %xmm2, %xmm2
+ 628      00000000 
+ 629 07d6 C5EA59D0 		vmulss	%xmm0, %xmm2, %xmm2
+ 630 07da C5EA5C15 		vsubss	.LC42(%rip), %xmm2, %xmm2
+ 630      00000000 
+ 631 07e2 C5EA59D0 		vmulss	%xmm0, %xmm2, %xmm2
+ 632 07e6 C5EA5815 		vaddss	.LC38(%rip), %xmm2, %xmm2
+ 632      00000000 
+ 633 07ee C5EA59D0 		vmulss	%xmm0, %xmm2, %xmm2
+ 634 07f2 C5D22AC0 		vcvtsi2ssl	%eax, %xmm5, %xmm0
+ 635 07f6 C5EA5C15 		vsubss	.LC43(%rip), %xmm2, %xmm2
+ 635      00000000 
+ 636 07fe C5EA58D0 		vaddss	%xmm0, %xmm2, %xmm2
+ 637 0802 C4C16A5C 		vsubss	52(%r12), %xmm2, %xmm2
+ 637      542434
+ 638 0809 C4C16A59 		vmulss	68(%r12), %xmm2, %xmm2
+ 638      542444
+ 639 0810 C5EA58C4 		vaddss	%xmm4, %xmm2, %xmm0
+ 640 0814 C5FA1155 		vmovss	%xmm2, -60(%rbp)
+ 640      C4
+ 641 0819 E8000000 		call	fmaxf@PLT
+ 641      00
+ 642 081e C5FA1065 		vmovss	-52(%rbp), %xmm4
+ 642      CC
+ 643 0823 C5F828C8 		vmovaps	%xmm0, %xmm1
+ 644 0827 C5DA58C4 		vaddss	%xmm4, %xmm4, %xmm0
+ 645 082b C5FA1165 		vmovss	%xmm4, -56(%rbp)
+ 645      C8
+ 646 0830 E8000000 		call	fminf@PLT
+ 646      00
+ 647 0835 C5FA1065 		vmovss	-56(%rbp), %xmm4
+ 647      C8
+ 648 083a C5FA1055 		vmovss	-60(%rbp), %xmm2
+ 648      C4
+ 649 083f C5F057C9 		vxorps	%xmm1, %xmm1, %xmm1
+ 650 0843 C5FA1145 		vmovss	%xmm0, -52(%rbp)
+ 650      CC
+ 651 0848 C5EA5CC4 		vsubss	%xmm4, %xmm2, %xmm0
+ 652 084c E8000000 		call	fmaxf@PLT
+ 652      00
+ 653 0851 C5FA105D 		vmovss	-52(%rbp), %xmm3
+ 653      CC
+ 654 0856 C5E259DB 		vmulss	%xmm3, %xmm3, %xmm3
+ 655 085a C4C16259 		vmulss	60(%r12), %xmm3, %xmm3
+ 655      5C243C
+ 656 0861 C5E258D8 		vaddss	%xmm0, %xmm3, %xmm3
+ 657 0865 C4C16259 		vmulss	64(%r12), %xmm3, %xmm3
+ 657      5C2440
+ 658 086c C4C17A11 		vmovss	%xmm3, -4(%r13)
+ 658      5DFC
+ 659 0872 4C39F3   		cmpq	%r14, %rbx
+ 660 0875 0F85EDFE 		jne	.L74
+ 660      FFFF
+ 661              	.L79:
+ 662 087b 4883C428 		addq	$40, %rsp
+ 663 087f 5B       		popq	%rbx
+ 664 0880 415A     		popq	%r10
+ 665              		.cfi_remember_state
+ 666              		.cfi_def_cfa 10, 0
+ 667 0882 415C     		popq	%r12
+ 668 0884 415D     		popq	%r13
+ 669 0886 415E     		popq	%r14
+ 670 0888 5D       		popq	%rbp
+ 671 0889 498D62F8 		leaq	-8(%r10), %rsp
+ 672              		.cfi_def_cfa 7, 8
+ 673 088d C3       		ret
+ 674 088e 6690     		.p2align 4,,10
+ 675              		.p2align 3
+ 676              	.L78:
+ 677              		.cfi_restore_state
+ 678 0890 C5F877   		vzeroupper
+ 679 0893 EBE6     		jmp	.L79
+ 680              		.p2align 4,,10
+ 681 0895 0F1F00   		.p2align 3
+ 682              	.L75:
+ 683 0898 31C0     		xorl	%eax, %eax
+ 684 089a E99FFEFF 		jmp	.L71
+ 684      FF
+ 685              		.cfi_endproc
+ 686              	.LFE6401:
+ 688 089f 90       		.p2align 4
+ 689              		.globl	comp_process
+ 691              	comp_process:
+ 692              	.LFB6408:
+ 693              		.cfi_startproc
+ 694 08a0 55       		pushq	%rbp
+ 695              		.cfi_def_cfa_offset 16
+ 696              		.cfi_offset 6, -16
+ 697 08a1 C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 698 08a5 4889E5   		movq	%rsp, %rbp
+ 699              		.cfi_def_cfa_register 6
+ 700 08a8 4157     		pushq	%r15
+ 701 08aa 4156     		pushq	%r14
+ 702 08ac 4155     		pushq	%r13
+ 703 08ae 4154     		pushq	%r12
+ 704 08b0 53       		pushq	%rbx
+ 705              		.cfi_offset 15, -24
+ 706              		.cfi_offset 14, -32
+ 707              		.cfi_offset 13, -40
+ 708              		.cfi_offset 12, -48
+ 709              		.cfi_offset 3, -56
+ 710 08b1 4889FB   		movq	%rdi, %rbx
+ 711 08b4 4883E4E0 		andq	$-32, %rsp
+ 712 08b8 4881ECC0 		subq	$192, %rsp
+ 712      000000
+ 713 08bf 4C8BB7C0 		movq	192(%rdi), %r14
+ 713      000000
+ 714 08c6 448BAF9C 		movl	156(%rdi), %r13d
+ 714      000000
+ 715 08cd 448BA7A4 		movl	164(%rdi), %r12d
+ 715      000000
+ 716 08d4 62F17F48 		vmovdqu8	%zmm0, 128(%rsp)
+ 716      7F442402 
+ 717 08dc 410FB64E 		movzbl	48(%r14), %ecx
+ 717      30
+ 718 08e1 4585ED   		testl	%r13d, %r13d
+ 719 08e4 0F8EFE02 		jle	.L82
+ 719      0000
+ 720 08ea 498D4654 		leaq	84(%r14), %rax
+ 721 08ee 4D63CD   		movslq	%r13d, %r9
+ 722 08f1 4531FF   		xorl	%r15d, %r15d
+ 723 08f4 48894424 		movq	%rax, 24(%rsp)
+ 723      18
+ 724 08f9 4989C2   		movq	%rax, %r10
+ 725 08fc 31C0     		xorl	%eax, %eax
+ 726 08fe EB16     		jmp	.L87
+ 727              		.p2align 4,,10
+ 728              		.p2align 3
+ 729              	.L123:
+ 730 0900 488954C4 		movq	%rdx, 64(%rsp,%rax,8)
+ 730      40
+ 731              	.L85:
+ 732 0905 4883C001 		addq	$1, %rax
+ 733 0909 4983C204 		addq	$4, %r10
+ 734 090d 4C39C8   		cmpq	%r9, %rax
+ 735 0910 0F848800 		je	.L121
+ 735      0000
+ 736              	.L87:
+ 737 0916 488B9388 		movq	136(%rbx), %rdx
+ 737      000000
+ 738 091d 803C0200 		cmpb	$0, (%rdx,%rax)
+ 739 0921 0F85A901 		jne	.L122
+ 739      0000
+ 740 0927 498B5678 		movq	120(%r14), %rdx
+ 741 092b 84C9     		testb	%cl, %cl
+ 742 092d 75D1     		jne	.L123
+ 743 092f 4489E1   		movl	%r12d, %ecx
+ 744 0932 4E8994FC 		movq	%r10, 128(%rsp,%r15,8)
+ 744      80000000 
+ 745 093a 4C89F7   		movq	%r14, %rdi
+ 746 093d 410FAFCF 		imull	%r15d, %ecx
+ 747 0941 4C894C24 		movq	%r9, 32(%rsp)
+ 747      20
+ 748 0946 4C895424 		movq	%r10, 40(%rsp)
+ 748      28
+ 749 094b 48894424 		movq	%rax, 48(%rsp)
+ 749      30
+ 750 0950 4863C9   		movslq	%ecx, %rcx
+ 751 0953 488D348A 		leaq	(%rdx,%rcx,4), %rsi
+ 752 0957 418D4F01 		leal	1(%r15), %ecx
+ 753 095b 488B54C3 		movq	8(%rbx,%rax,8), %rdx
+ 753      08
+ 754 0960 488974C4 		movq	%rsi, 64(%rsp,%rax,8)
+ 754      40
+ 755 0965 894C2438 		movl	%ecx, 56(%rsp)
+ 756 0969 4489E1   		movl	%r12d, %ecx
+ 757 096c C5F877   		vzeroupper
+ 758 096f E84CFCFF 		call	comp_target_block
+ 758      FF
+ 759 0974 488B4424 		movq	48(%rsp), %rax
+ 759      30
+ 760 0979 4C8B5424 		movq	40(%rsp), %r10
+ 760      28
+ 761 097e 4C8B4C24 		movq	32(%rsp), %r9
+ 761      20
+ 762 0983 410FB64E 		movzbl	48(%r14), %ecx
+ 762      30
+ 763 0988 4883C001 		addq	$1, %rax
+ 764 098c 4C637C24 		movslq	56(%rsp), %r15
+ 764      38
+ 765 0991 4983C204 		addq	$4, %r10
+ 766 0995 4C39C8   		cmpq	%r9, %rax
+ 767 0998 0F8578FF 		jne	.L87
+ 767      FFFF
+ 768              	.L121:
+ 769 099e 84C9     		testb	%cl, %cl
+ 770 09a0 0F857201 		jne	.L124
+ 770      0000
+ 771 09a6 4D8B6E78 		movq	120(%r14), %r13
+ 772 09aa 4589F8   		movl	%r15d, %r8d
+ 773 09ad 4489E2   		movl	%r12d, %edx
+ 774 09b0 4C89F7   		movq	%r14, %rdi
+ 775 09b3 488D8C24 		leaq	128(%rsp), %rcx
+ 775      80000000 
+ 776 09bb 4C894C24 		movq	%r9, 56(%rsp)
+ 776      38
+ 777 09c0 4C89EE   		movq	%r13, %rsi
+ 778 09c3 E838F6FF 		call	comp_smooth
+ 778      FF
+ 779 09c8 4489FE   		movl	%r15d, %esi
+ 780 09cb 4C89EF   		movq	%r13, %rdi
+ 781 09ce 410FAFF4 		imull	%r12d, %esi
+ 782 09d2 E8A9F9FF 		call	exp2_block
+ 782      FF
+ 783 09d7 4C8B4C24 		movq	56(%rsp), %r9
+ 783      38
+ 784              	.L97:
+ 785 09dc 458D6C24 		leal	-8(%r12), %r13d
+ 785      F8
+ 786 09e1 4D63F4   		movslq	%r12d, %r14
+ 787 09e4 4531FF   		xorl	%r15d, %r15d
+ 788 09e7 41C1ED03 		shrl	$3, %r13d
+ 789 09eb 4A8D04B5 		leaq	0(,%r14,4), %rax
+ 789      00000000 
+ 790 09f3 418D4D01 		leal	1(%r13), %ecx
+ 791 09f7 48894424 		movq	%rax, 48(%rsp)
+ 791      30
+ 792 09fc 4989CD   		movq	%rcx, %r13
+ 793 09ff 48C1E105 		salq	$5, %rcx
+ 794 0a03 4989CE   		movq	%rcx, %r14
+ 795 0a06 41C1E503 		sall	$3, %r13d
+ 796 0a0a EB2A     		jmp	.L106
+ 797 0a0c 0F1F4000 		.p2align 4,,10
+ 798              		.p2align 3
+ 799              	.L126:
+ 800 0a10 4C894C24 		movq	%r9, 56(%rsp)
+ 800      38
+ 801 0a15 488B5424 		movq	48(%rsp), %rdx
+ 801      30
+ 802 0a1a 31F6     		xorl	%esi, %esi
+ 803 0a1c C5F877   		vzeroupper
+ 804 0a1f E8000000 		call	memset@PLT
+ 804      00
+ 805 0a24 4C8B4C24 		movq	56(%rsp), %r9
+ 805      38
+ 806              	.L100:
+ 807 0a29 4983C701 		addq	$1, %r15
+ 808 0a2d 4D39F9   		cmpq	%r15, %r9
+ 809 0a30 0F848700 		je	.L125
+ 809      0000
+ 810              	.L106:
+ 811 0a36 488B8388 		movq	136(%rbx), %rax
+ 811      000000
+ 812 0a3d 488BB390 		movq	144(%rbx), %rsi
+ 812      000000
+ 813 0a44 4A8B54FB 		movq	8(%rbx,%r15,8), %rdx
+ 813      08
+ 814 0a49 4A8B7CFB 		movq	72(%rbx,%r15,8), %rdi
+ 814      48
+ 815 0a4e 420FB604 		movzbl	(%rax,%r15), %eax
+ 815      38
+ 816 0a53 4288043E 		movb	%al, (%rsi,%r15)
+ 817 0a57 84C0     		testb	%al, %al
+ 818 0a59 75B5     		jne	.L126
+ 819 0a5b 4A8B74FC 		movq	64(%rsp,%r15,8), %rsi
+ 819      40
+ 820 0a60 4183FC07 		cmpl	$7, %r12d
+ 821 0a64 0F8E5E01 		jle	.L110
+ 821      0000
+ 822 0a6a 31C0     		xorl	%eax, %eax
+ 823 0a6c 0F1F4000 		.p2align 4,,10
+ 824              		.p2align 3
+ 825              	.L102:
+ 826 0a70 C5FC100C 		vmovups	(%rsi,%rax), %ymm1
+ 826      06
+ 827 0a75 C5F45904 		vmulps	(%rdx,%rax), %ymm1, %ymm0
+ 827      02
+ 828 0a7a C5FC1104 		vmovups	%ymm0, (%rdi,%rax)
+ 828      07
+ 829 0a7f 4883C020 		addq	$32, %rax
+ 830 0a83 4939C6   		cmpq	%rax, %r14
+ 831 0a86 75E8     		jne	.L102
+ 832 0a88 4589E8   		movl	%r13d, %r8d
+ 833              	.L101:
+ 834 0a8b 4963C0   		movslq	%r8d, %rax
+ 835 0a8e 4539C4   		cmpl	%r8d, %r12d
+ 836 0a91 7E96     		jle	.L100
+ 837              		.p2align 4,,10
+ 838 0a93 0F1F4400 		.p2align 3
+ 838      00
+ 839              	.L104:
+ 840 0a98 C5FA1004 		vmovss	(%rdx,%rax,4), %xmm0
+ 840      82
+ 841 0a9d C5FA5904 		vmulss	(%rsi,%rax,4), %xmm0, %xmm0
+ 841      86
+ 842 0aa2 C5FA1104 		vmovss	%xmm0, (%rdi,%rax,4)
+ 842      87
+ 843 0aa7 4883C001 		addq	$1, %rax
+ 844 0aab 4139C4   		cmpl	%eax, %r12d
+ 845 0aae 7FE8     		jg	.L104
+ 846 0ab0 4983C701 		addq	$1, %r15
+ 847 0ab4 4D39F9   		cmpq	%r15, %r9
+ 848 0ab7 0F8579FF 		jne	.L106
+ 848      FFFF
+ 849              	.L125:
+ 850 0abd C5F877   		vzeroupper
+ 851              	.L119:
+ 852 0ac0 488D65D8 		leaq	-40(%rbp), %rsp
+ 853 0ac4 5B       		popq	%rbx
+ 854 0ac5 415C     		popq	%r12
+ 855 0ac7 415D     		popq	%r13
+ 856 0ac9 415E     		popq	%r14
+ 857 0acb 415F     		popq	%r15
+ 858 0acd 5D       		popq	%rbp
+ 859              		.cfi_remember_state
+ 860              		.cfi_def_cfa 7, 8
+ 861 0ace C3       		ret
+ 862 0acf 90       		.p2align 4,,10
+ 863              		.p2align 3
+ 864              	.L122:
+ 865              		.cfi_restore_state
+ 866 0ad0 84C9     		testb	%cl, %cl
+ 867 0ad2 0F852DFE 		jne	.L85
+ 867      FFFF
+ 868 0ad8 4C894C24 		movq	%r9, 32(%rsp)
+ 868      20
+ 869 0add 4C89D2   		movq	%r10, %rdx
+ 870 0ae0 4489E6   		movl	%r12d, %esi
+ 871 0ae3 4C89F7   		movq	%r14, %rdi
+ 872 0ae6 884C2428 		movb	%cl, 40(%rsp)
+ 873 0aea 48894424 		movq	%rax, 48(%rsp)
+ 873      30
+ 874 0aef 4C895424 		movq	%r10, 56(%rsp)
+ 874      38
+ 875 0af4 C5F877   		vzeroupper
+ 876 0af7 E834F6FF 		call	comp_idle
+ 876      FF
+ 877 0afc 4C8B5424 		movq	56(%rsp), %r10
+ 877      38
+ 878 0b01 488B4424 		movq	48(%rsp), %rax
+ 878      30
+ 879 0b06 0FB64C24 		movzbl	40(%rsp), %ecx
+ 879      28
+ 880 0b0b 4C8B4C24 		movq	32(%rsp), %r9
+ 880      20
+ 881 0b10 E9F0FDFF 		jmp	.L85
+ 881      FF
+ 882              		.p2align 4,,10
+ 883 0b15 0F1F00   		.p2align 3
+ 884              	.L124:
+ 885 0b18 488B9388 		movq	136(%rbx), %rdx
+ 885      000000
+ 886 0b1f 31C0     		xorl	%eax, %eax
+ 887 0b21 EB15     		jmp	.L92
+ 888              		.p2align 4,,10
+ 889 0b23 0F1F4400 		.p2align 3
+ 889      00
+ 890              	.L94:
+ 891 0b28 83C001   		addl	$1, %eax
+ 892 0b2b 4883C201 		addq	$1, %rdx
+ 893 0b2f 4139C5   		cmpl	%eax, %r13d
+ 894 0b32 0F849800 		je	.L108
+ 894      0000
+ 895              	.L92:
+ 896 0b38 803A00   		cmpb	$0, (%rdx)
+ 897 0b3b 75EB     		jne	.L94
+ 898              	.L89:
+ 899 0b3d 4139C5   		cmpl	%eax, %r13d
+ 900 0b40 0F848A00 		je	.L108
+ 900      0000
+ 901 0b46 498B7E78 		movq	120(%r14), %rdi
+ 902 0b4a 488D7308 		leaq	8(%rbx), %rsi
+ 903 0b4e 4489E1   		movl	%r12d, %ecx
+ 904 0b51 4489EA   		movl	%r13d, %edx
+ 905 0b54 C5F877   		vzeroupper
+ 906 0b57 E8E4F6FF 		call	peak_block
+ 906      FF
+ 907 0b5c 498B7678 		movq	120(%r14), %rsi
+ 908 0b60 4489E1   		movl	%r12d, %ecx
+ 909 0b63 4C89F7   		movq	%r14, %rdi
+ 910 0b66 4889F2   		movq	%rsi, %rdx
+ 911 0b69 E852FAFF 		call	comp_target_block
+ 911      FF
+ 912 0b6e 488B4C24 		movq	24(%rsp), %rcx
+ 912      18
+ 913 0b73 4963C7   		movslq	%r15d, %rax
+ 914 0b76 458D4701 		leal	1(%r15), %r8d
+ 915 0b7a 48898CC4 		movq	%rcx, 128(%rsp,%rax,8)
+ 915      80000000 
+ 916              	.L96:
+ 917 0b82 4D8B7E78 		movq	120(%r14), %r15
+ 918 0b86 4489E2   		movl	%r12d, %edx
+ 919 0b89 4C89F7   		movq	%r14, %rdi
+ 920 0b8c 44894424 		movl	%r8d, 56(%rsp)
+ 920      38
+ 921 0b91 488D8C24 		leaq	128(%rsp), %rcx
+ 921      80000000 
+ 922 0b99 4C89FE   		movq	%r15, %rsi
+ 923 0b9c E85FF4FF 		call	comp_smooth
+ 923      FF
+ 924 0ba1 8B742438 		movl	56(%rsp), %esi
+ 925 0ba5 4C89FF   		movq	%r15, %rdi
+ 926 0ba8 410FAFF4 		imull	%r12d, %esi
+ 927 0bac E8CFF7FF 		call	exp2_block
+ 927      FF
+ 928 0bb1 4D63CD   		movslq	%r13d, %r9
+ 929 0bb4 4585ED   		testl	%r13d, %r13d
+ 930 0bb7 0F8F1FFE 		jg	.L97
+ 930      FFFF
+ 931 0bbd E9FEFEFF 		jmp	.L119
+ 931      FF
+ 932              		.p2align 4,,10
+ 933 0bc2 660F1F44 		.p2align 3
+ 933      0000
+ 934              	.L110:
+ 935 0bc8 4531C0   		xorl	%r8d, %r8d
+ 936 0bcb E9BBFEFF 		jmp	.L101
+ 936      FF
+ 937              	.L108:
+ 938 0bd0 488B5424 		movq	24(%rsp), %rdx
+ 938      18
+ 939 0bd5 4489E6   		movl	%r12d, %esi
+ 940 0bd8 4C89F7   		movq	%r14, %rdi
+ 941 0bdb C5F877   		vzeroupper
+ 942 0bde E84DF5FF 		call	comp_idle
+ 942      FF
+ 943 0be3 4589F8   		movl	%r15d, %r8d
+ 944 0be6 EB9A     		jmp	.L96
+ 945              	.L82:
+ 946 0be8 84C9     		testb	%cl, %cl
+ 947 0bea 7413     		je	.L127
+ 948 0bec 498D4E54 		leaq	84(%r14), %rcx
+ 949 0bf0 4531FF   		xorl	%r15d, %r15d
+ 950 0bf3 31C0     		xorl	%eax, %eax
+ 951 0bf5 48894C24 		movq	%rcx, 24(%rsp)
+ 951      18
+ 952 0bfa E93EFFFF 		jmp	.L89
+ 952      FF
+ 953              	.L127:
+ 954 0bff 498B5E78 		movq	120(%r14), %rbx
+ 955 0c03 4C89F7   		movq	%r14, %rdi
+ 956 0c06 4489E2   		movl	%r12d, %edx
+ 957 0c09 4531C0   		xorl	%r8d, %r8d
+ 958 0c0c 488D8C24 		leaq	128(%rsp), %rcx
+ 958      80000000 
+ 959 0c14 4889DE   		movq	%rbx, %rsi
+ 960 0c17 E8E4F3FF 		call	comp_smooth
+ 960      FF
+ 961 0c1c 488D65D8 		leaq	-40(%rbp), %rsp
+ 962 0c20 4889DF   		movq	%rbx, %rdi
+ 963 0c23 31F6     		xorl	%esi, %esi
+ 964 0c25 5B       		popq	%rbx
+ 965 0c26 415C     		popq	%r12
+ 966 0c28 415D     		popq	%r13
+ 967 0c2a 415E     		popq	%r14
+ 968 0c2c 415F     		popq	%r15
+ 969 0c2e 5D       		popq	%rbp
+ 970              		.cfi_def_cfa 7, 8
+ 971 0c2f E94CF7FF 		jmp	exp2_block
+ 971      FF
+ 972              		.cfi_endproc
+ 973              	.LFE6408:
+ 975 0c34 66662E0F 		.p2align 4
+ 975      1F840000 
+ 975      00000090 
+ 976              		.globl	comp_preroll
+ 978              	comp_preroll:
+ 979              	.LFB6418:
+ 980              		.cfi_startproc
+ 981 0c40 4156     		pushq	%r14
+ 982              		.cfi_def_cfa_offset 16
+ 983              		.cfi_offset 14, -16
+ 984 0c42 C5E857D2 		vxorps	%xmm2, %xmm2, %xmm2
+ 985 0c46 C4C1F97E 		vmovq	%xmm0, %r14
+ 985      C6
+ 986 0c4b 55       		pushq	%rbp
+ 987              		.cfi_def_cfa_offset 24
+ 988              		.cfi_offset 6, -24
+ 989 0c4c 53       		pushq	%rbx
+ 990              		.cfi_def_cfa_offset 32
+ 991              		.cfi_offset 3, -32
+ 992 0c4d 4883EC20 		subq	$32, %rsp
+ 993              		.cfi_def_cfa_offset 64
+ 994 0c51 488BAFC0 		movq	192(%rdi), %rbp
+ 994      000000
+ 995 0c58 8B9F9800 		movl	152(%rdi), %ebx
+ 995      0000
+ 996 0c5e 62F16F08 		vcvtusi2sdl	%ebx, %xmm2, %xmm2
+ 996      7BD3
+ 997 0c64 C5EB5945 		vmulsd	32(%rbp), %xmm2, %xmm0
+ 997      20
+ 998 0c69 C5F92F05 		vcomisd	.LC45(%rip), %xmm0
+ 998      00000000 
+ 999 0c71 0F83E900 		jnb	.L148
+ 999      0000
+ 1000 0c77 C5EB5945 		vmulsd	24(%rbp), %xmm2, %xmm0
+ 1000      18
+ 1001 0c7c C5F92F05 		vcomisd	.LC45(%rip), %xmm0
+ 1001      00000000 
+ 1002 0c84 733A     		jnb	.L149
+ 1003              	.L139:
+ 1004 0c86 C5F957C0 		vxorpd	%xmm0, %xmm0, %xmm0
+ 1005              	.L134:
+ 1006 0c8a C5EB5915 		vmulsd	.LC47(%rip), %xmm2, %xmm2
+ 1006      00000000 
+ 1007 0c92 C5F92FD0 		vcomisd	%xmm0, %xmm2
+ 1008 0c96 7618     		jbe	.L146
+ 1009 0c98 4883C420 		addq	$32, %rsp
+ 1010              		.cfi_remember_state
+ 1011              		.cfi_def_cfa_offset 32
+ 1012 0c9c 62F17F08 		vcvttsd2usi	%xmm0, %eax
+ 1012      78C0
+ 1013 0ca2 5B       		popq	%rbx
+ 1014              		.cfi_def_cfa_offset 24
+ 1015 0ca3 5D       		popq	%rbp
+ 1016              		.cfi_def_cfa_offset 16
+ 1017 0ca4 415E     		popq	%r14
+ 1018              		.cfi_def_cfa_offset 8
+ 1019 0ca6 C3       		ret
+ 1020 0ca7 660F1F84 		.p2align 4,,10
+ 1020      00000000 
+ 1020      00
+ 1021              		.p2align 3
+ 1022              	.L146:
+ 1023              		.cfi_restore_state
+ 1024 0cb0 4883C420 		addq	$32, %rsp
+ 1025              		.cfi_remember_state
+ 1026              		.cfi_def_cfa_offset 32
+ 1027 0cb4 6BC33C   		imull	$60, %ebx, %eax
+ 1028 0cb7 5B       		popq	%rbx
+ 1029              		.cfi_def_cfa_offset 24
+ 1030 0cb8 5D       		popq	%rbp
+ 1031              		.cfi_def_cfa_offset 16
+ 1032 0cb9 415E     		popq	%r14
+ 1033              		.cfi_def_cfa_offset 8
+ 1034 0cbb C3       		ret
+ 1035 0cbc 0F1F4000 		.p2align 4,,10
+ 1036              		.p2align 3
+ 1037              	.L149:
+ 1038              		.cfi_restore_state
+ 1039 0cc0 C5FB101D 		vmovsd	.LC46(%rip), %xmm3
+ 1039      00000000 
+ 1040 0cc8 C5F157C9 		vxorpd	%xmm1, %xmm1, %xmm1
+ 1041              	.L138:
+ 1042 0ccc C5E35EC0 		vdivsd	%xmm0, %xmm3, %xmm0
+ 1043 0cd0 C5FB1154 		vmovsd	%xmm2, 16(%rsp)
+ 1043      2410
+ 1044 0cd6 C5FB114C 		vmovsd	%xmm1, 8(%rsp)
+ 1044      2408
+ 1045 0cdc E8000000 		call	exp@PLT
+ 1045      00
+ 1046 0ce1 C5FB104C 		vmovsd	8(%rsp), %xmm1
+ 1046      2408
+ 1047 0ce7 C5FB1054 		vmovsd	16(%rsp), %xmm2
+ 1047      2410
+ 1048 0ced C5FB5AC0 		vcvtsd2ss	%xmm0, %xmm0, %xmm0
+ 1049 0cf1 C5FA5AC0 		vcvtss2sd	%xmm0, %xmm0, %xmm0
+ 1050              	.L131:
+ 1051 0cf5 C5FB1154 		vmovsd	%xmm2, 8(%rsp)
+ 1051      2408
+ 1052 0cfb E8000000 		call	fmax@PLT
+ 1052      00
+ 1053 0d00 C5FB1054 		vmovsd	8(%rsp), %xmm2
+ 1053      2408
+ 1054 0d06 C5FB10D8 		vmovsd	%xmm0, %xmm0, %xmm3
+ 1055 0d0a C5F957C0 		vxorpd	%xmm0, %xmm0, %xmm0
+ 1056 0d0e C5F92FD8 		vcomisd	%xmm0, %xmm3
+ 1057 0d12 0F866EFF 		jbe	.L139
+ 1057      FFFF
+ 1058 0d18 C4C1F96E 		vmovq	%r14, %xmm0
+ 1058      C6
+ 1059 0d1d C5FB1154 		vmovsd	%xmm2, 24(%rsp)
+ 1059      2418
+ 1060 0d23 C5FB115C 		vmovsd	%xmm3, 16(%rsp)
+ 1060      2410
+ 1061 0d29 E8000000 		call	log@PLT
+ 1061      00
+ 1062 0d2e C5FB105C 		vmovsd	16(%rsp), %xmm3
+ 1062      2410
+ 1063 0d34 C5FB1144 		vmovsd	%xmm0, 8(%rsp)
+ 1063      2408
+ 1064 0d3a C5E310C3 		vmovsd	%xmm3, %xmm3, %xmm0
+ 1065 0d3e E8000000 		call	log@PLT
+ 1065      00
+ 1066 0d43 C5FB104C 		vmovsd	8(%rsp), %xmm1
+ 1066      2408
+ 1067 0d49 C5FB1054 		vmovsd	24(%rsp), %xmm2
+ 1067      2418
+ 1068 0d4f C5F35EC0 		vdivsd	%xmm0, %xmm1, %xmm0
+ 1069 0d53 62F3FD08 		vrndscalesd	$10, %xmm0, %xmm0, %xmm0
+ 1069      0BC00A
+ 1070 0d5a E92BFFFF 		jmp	.L134
+ 1070      FF
+ 1071 0d5f 90       		.p2align 4,,10
+ 1072              		.p2align 3
+ 1073              	.L148:
+ 1074 0d60 C5FB101D 		vmovsd	.LC46(%rip), %xmm3
+ 1074      00000000 
+ 1075 0d68 C5FB1154 		vmovsd	%xmm2, 8(%rsp)
+ 1075      2408
+ 1076 0d6e C5E35EC0 		vdivsd	%xmm0, %xmm3, %xmm0
+ 1077 0d72 C5FB115C 		vmovsd	%xmm3, 16(%rsp)
+ 1077      2410
+ 1078 0d78 E8000000 		call	exp@PLT
+ 1078      00
+ 1079 0d7d C5FB1054 		vmovsd	8(%rsp), %xmm2
+ 1079      2408
+ 1080 0d83 C5FB5AC8 		vcvtsd2ss	%xmm0, %xmm0, %xmm1
+ 1081 0d87 C5EB5945 		vmulsd	24(%rbp), %xmm2, %xmm0
+ 1081      18
+ 1082 0d8c C5F25AC9 		vcvtss2sd	%xmm1, %xmm1, %xmm1
+ 1083 0d90 C5F92F05 		vcomisd	.LC45(%rip), %xmm0
+ 1083      00000000 
+ 1084 0d98 730E     		jnb	.L150
+ 1085 0d9a C5F957C0 		vxorpd	%xmm0, %xmm0, %xmm0
+ 1086 0d9e E952FFFF 		jmp	.L131
+ 1086      FF
+ 1087              		.p2align 4,,10
+ 1088 0da3 0F1F4400 		.p2align 3
+ 1088      00
+ 1089              	.L150:
+ 1090 0da8 C5FB105C 		vmovsd	16(%rsp), %xmm3
+ 1090      2410
+ 1091 0dae E919FFFF 		jmp	.L138
+ 1091      FF
+ 1092              		.cfi_endproc
+ 1093              	.LFE6418:
+ 1095              		.section	.rodata.str1.8,"aMS",@progbits,1
+ 1096              		.align 8
+ 1097              	.LC52:
+ 1098 0000 436F756C 		.string	"Could not allocate memory for compressor gains.\n"
+ 1098      64206E6F 
+ 1098      7420616C 
+ 1098      6C6F6361 
+ 1098      7465206D 
+ 1099              		.text
+ 1100 0db3 66662E0F 		.p2align 4
+ 1100      1F840000 
+ 1100      00000066 
+ 1100      90
+ 1101              		.globl	comp_init
+ 1103              	comp_init:
+ 1104              	.LFB6416:
+ 1105              		.cfi_startproc
+ 1106 0dc0 55       		pushq	%rbp
+ 1107              		.cfi_def_cfa_offset 16
+ 1108              		.cfi_offset 6, -16
+ 1109 0dc1 4889E5   		movq	%rsp, %rbp
+ 1110              		.cfi_def_cfa_register 6
+ 1111 0dc4 4155     		pushq	%r13
+ 1112 0dc6 4154     		pushq	%r12
+ 1113              		.cfi_offset 13, -24
+ 1114              		.cfi_offset 12, -32
+ 1115 0dc8 4989FC   		movq	%rdi, %r12
+ 1116 0dcb 53       		pushq	%rbx
+ 1117 0dcc 4883EC18 		subq	$24, %rsp
+ 1118              		.cfi_offset 3, -40
+ 1119 0dd0 488B9FC0 		movq	192(%rdi), %rbx
+ 1119      000000
+ 1120 0dd7 C5FB1015 		vmovsd	.LC45(%rip), %xmm2
+ 1120      00000000 
+ 1121 0ddf C5FB1043 		vmovsd	8(%rbx), %xmm0
+ 1121      08
+ 1122 0de4 C5F92FC2 		vcomisd	%xmm2, %xmm0
+ 1123 0de8 0F826201 		jb	.L169
+ 1123      0000
+ 1124 0dee C5FA100D 		vmovss	.LC22(%rip), %xmm1
+ 1124      00000000 
+ 1125 0df6 C5EB10DA 		vmovsd	%xmm2, %xmm2, %xmm3
+ 1126              	.L152:
+ 1127 0dfa C5EB5EC0 		vdivsd	%xmm0, %xmm2, %xmm0
+ 1128 0dfe C5FB5CC2 		vsubsd	%xmm2, %xmm0, %xmm0
+ 1129 0e02 C5FB59C3 		vmulsd	%xmm3, %xmm0, %xmm0
+ 1130 0e06 C5FB101D 		vmovsd	.LC49(%rip), %xmm3
+ 1130      00000000 
+ 1131 0e0e C5FB5AC0 		vcvtsd2ss	%xmm0, %xmm0, %xmm0
+ 1132 0e12 C5F814C1 		vunpcklps	%xmm1, %xmm0, %xmm0
+ 1133 0e16 C5FB104B 		vmovsd	16(%rbx), %xmm1
+ 1133      10
+ 1134 0e1b C5F81343 		vmovlps	%xmm0, 64(%rbx)
+ 1134      40
+ 1135 0e20 C5FB1003 		vmovsd	(%rbx), %xmm0
+ 1136 0e24 C5F35ECB 		vdivsd	%xmm3, %xmm1, %xmm1
+ 1137 0e28 C5FB5EC3 		vdivsd	%xmm3, %xmm0, %xmm0
+ 1138 0e2c C5F3590D 		vmulsd	.LC50(%rip), %xmm1, %xmm1
+ 1138      00000000 
+ 1139 0e34 C5F914C1 		vunpcklpd	%xmm1, %xmm0, %xmm0
+ 1140 0e38 C5F95AC0 		vcvtpd2psx	%xmm0, %xmm0
+ 1141 0e3c C5FA16C8 		vmovshdup	%xmm0, %xmm1
+ 1142 0e40 C5F81343 		vmovlps	%xmm0, 52(%rbx)
+ 1142      34
+ 1143 0e45 C5F857C0 		vxorps	%xmm0, %xmm0, %xmm0
+ 1144 0e49 C5F82FC8 		vcomiss	%xmm0, %xmm1
+ 1145 0e4d 0F86ED00 		jbe	.L170
+ 1145      0000
+ 1146 0e53 C5F25AC9 		vcvtss2sd	%xmm1, %xmm1, %xmm1
+ 1147 0e57 C5F3590D 		vmulsd	.LC51(%rip), %xmm1, %xmm1
+ 1147      00000000 
+ 1148 0e5f C5EB5EC9 		vdivsd	%xmm1, %xmm2, %xmm1
+ 1149 0e63 C5F35AC9 		vcvtsd2ss	%xmm1, %xmm1, %xmm1
+ 1150              	.L154:
+ 1151 0e67 C5FB1043 		vmovsd	40(%rbx), %xmm0
+ 1151      28
+ 1152 0e6c C5FA114B 		vmovss	%xmm1, 60(%rbx)
+ 1152      3C
+ 1153 0e71 C5F057C9 		vxorps	%xmm1, %xmm1, %xmm1
+ 1154 0e75 62D17708 		vcvtusi2sdl	152(%r12), %xmm1, %xmm1
+ 1154      7B4C2426 
+ 1155 0e7d C5FB5EC3 		vdivsd	%xmm3, %xmm0, %xmm0
+ 1156 0e81 C5F3595B 		vmulsd	24(%rbx), %xmm1, %xmm3
+ 1156      18
+ 1157 0e86 C5F92FDA 		vcomisd	%xmm2, %xmm3
+ 1158 0e8a C5FB5AC0 		vcvtsd2ss	%xmm0, %xmm0, %xmm0
+ 1159 0e8e C5FA1143 		vmovss	%xmm0, 72(%rbx)
+ 1159      48
+ 1160 0e93 C5F857C0 		vxorps	%xmm0, %xmm0, %xmm0
+ 1161 0e97 722B     		jb	.L156
+ 1162 0e99 C5FB1005 		vmovsd	.LC46(%rip), %xmm0
+ 1162      00000000 
+ 1163 0ea1 C5FB114D 		vmovsd	%xmm1, -40(%rbp)
+ 1163      D8
+ 1164 0ea6 C5FB5EC3 		vdivsd	%xmm3, %xmm0, %xmm0
+ 1165 0eaa E8000000 		call	exp@PLT
+ 1165      00
+ 1166 0eaf 488B0500 		movq	.LC45(%rip), %rax
+ 1166      000000
+ 1167 0eb6 C5FB104D 		vmovsd	-40(%rbp), %xmm1
+ 1167      D8
+ 1168 0ebb C5FB5AC0 		vcvtsd2ss	%xmm0, %xmm0, %xmm0
+ 1169 0ebf C4E1F96E 		vmovq	%rax, %xmm2
+ 1169      D0
+ 1170              	.L156:
+ 1171 0ec4 C5F3594B 		vmulsd	32(%rbx), %xmm1, %xmm1
+ 1171      20
+ 1172 0ec9 C5FA1143 		vmovss	%xmm0, 76(%rbx)
+ 1172      4C
+ 1173 0ece C5F857C0 		vxorps	%xmm0, %xmm0, %xmm0
+ 1174 0ed2 C5F92FCA 		vcomisd	%xmm2, %xmm1
+ 1175 0ed6 7215     		jb	.L158
+ 1176 0ed8 C5FB1005 		vmovsd	.LC46(%rip), %xmm0
+ 1176      00000000 
+ 1177 0ee0 C5FB5EC1 		vdivsd	%xmm1, %xmm0, %xmm0
+ 1178 0ee4 E8000000 		call	exp@PLT
+ 1178      00
+ 1179 0ee9 C5FB5AC0 		vcvtsd2ss	%xmm0, %xmm0, %xmm0
+ 1180              	.L158:
+ 1181 0eed C5FA1143 		vmovss	%xmm0, 80(%rbx)
+ 1181      50
+ 1182 0ef2 C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 1183 0ef6 488B7B78 		movq	120(%rbx), %rdi
+ 1184 0efa 62F17F28 		vmovdqu8	%ymm0, 84(%rbx)
+ 1184      7F835400 
+ 1184      0000
+ 1185 0f04 418BB424 		movl	156(%r12), %esi
+ 1185      9C000000 
+ 1186 0f0c 410FAFB4 		imull	164(%r12), %esi
+ 1186      24A40000 
+ 1186      00
+ 1187 0f15 4863F6   		movslq	%esi, %rsi
+ 1188 0f18 48C1E602 		salq	$2, %rsi
+ 1189 0f1c C5F877   		vzeroupper
+ 1190 0f1f E8000000 		call	realloc@PLT
+ 1190      00
+ 1191 0f24 48894378 		movq	%rax, 120(%rbx)
+ 1192 0f28 4885C0   		testq	%rax, %rax
+ 1193 0f2b 7438     		je	.L175
+ 1194 0f2d 4883C418 		addq	$24, %rsp
+ 1195 0f31 5B       		popq	%rbx
+ 1196 0f32 415C     		popq	%r12
+ 1197 0f34 415D     		popq	%r13
+ 1198 0f36 5D       		popq	%rbp
+ 1199              		.cfi_remember_state
+ 1200              		.cfi_def_cfa 7, 8
+ 1201 0f37 C3       		ret
+ 1202 0f38 0F1F8400 		.p2align 4,,10
+ 1202      00000000 
+ 1203              		.p2align 3
+ 1204              	.L170:
+ 1205              		.cfi_restore_state
+ 1206 0f40 C5F057C9 		vxorps	%xmm1, %xmm1, %xmm1
+ 1207 0f44 E91EFFFF 		jmp	.L154
+ 1207      FF
+ 1208 0f49 0F1F8000 		.p2align 4,,10
+ 1208      000000
+ 1209              		.p2align 3
+ 1210              	.L169:
+ 1211 0f50 C5FB101D 		vmovsd	.LC46(%rip), %xmm3
+ 1211      00000000 
+ 1212 0f58 C5FA100D 		vmovss	.LC48(%rip), %xmm1
+ 1212      00000000 
+ 1213 0f60 E995FEFF 		jmp	.L152
+ 1213      FF
+ 1214              	.L175:
+ 1215 0f65 4883C418 		addq	$24, %rsp
+ 1216 0f69 488D3D00 		leaq	.LC52(%rip), %rdi
+ 1216      000000
+ 1217 0f70 5B       		popq	%rbx
+ 1218 0f71 415C     		popq	%r12
+ 1219 0f73 415D     		popq	%r13
+ 1220 0f75 5D       		popq	%rbp
+ 1221              		.cfi_def_cfa 7, 8
+ 1222 0f76 E9000000 		jmp	endprogram@PLT
+ 1222      00
+ 1223              		.cfi_endproc
+ 1224              	.LFE6416:
+ 1226 0f7b 0F1F4400 		.p2align 4
+ 1226      00
+ 1228              	comp_process_2_64:
+ 1229              	.LFB6409:
+ 1230              		.cfi_startproc
+ 1231 0f80 55       		pushq	%rbp
+ 1232              		.cfi_def_cfa_offset 16
+ 1233              		.cfi_offset 6, -16
+ 1234 0f81 4889E5   		movq	%rsp, %rbp
+ 1235              		.cfi_def_cfa_register 6
+ 1236 0f84 4157     		pushq	%r15
+ 1237 0f86 4156     		pushq	%r14
+ 1238 0f88 4155     		pushq	%r13
+ 1239 0f8a 4154     		pushq	%r12
+ 1240 0f8c 53       		pushq	%rbx
+ 1241              		.cfi_offset 15, -24
+ 1242              		.cfi_offset 14, -32
+ 1243              		.cfi_offset 13, -40
+ 1244              		.cfi_offset 12, -48
+ 1245              		.cfi_offset 3, -56
+ 1246 0f8d 4889FB   		movq	%rdi, %rbx
+ 1247 0f90 4883E4E0 		andq	$-32, %rsp
+ 1248 0f94 4881ECA0 		subq	$160, %rsp
+ 1248      000000
+ 1249 0f9b 83BFA400 		cmpl	$64, 164(%rdi)
+ 1249      000040
+ 1250 0fa2 0F858001 		jne	.L177
+ 1250      0000
+ 1251 0fa8 488B4708 		movq	8(%rdi), %rax
+ 1252 0fac 480B4748 		orq	72(%rdi), %rax
+ 1253 0fb0 480B4710 		orq	16(%rdi), %rax
+ 1254 0fb4 480B4750 		orq	80(%rdi), %rax
+ 1255 0fb8 A81F     		testb	$31, %al
+ 1256 0fba 0F856801 		jne	.L177
+ 1256      0000
+ 1257 0fc0 4C8BBFC0 		movq	192(%rdi), %r15
+ 1257      000000
+ 1258 0fc7 C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 1259 0fcb 4531E4   		xorl	%r12d, %r12d
+ 1260 0fce 4531ED   		xorl	%r13d, %r13d
+ 1261 0fd1 62F17F48 		vmovdqu8	%zmm0, 96(%rsp)
+ 1261      7F842460 
+ 1261      000000
+ 1262 0fdc 498D4754 		leaq	84(%r15), %rax
+ 1263 0fe0 410FB64F 		movzbl	48(%r15), %ecx
+ 1263      30
+ 1264 0fe5 48894424 		movq	%rax, 16(%rsp)
+ 1264      10
+ 1265 0fea 4989C6   		movq	%rax, %r14
+ 1266 0fed EB15     		jmp	.L182
+ 1267 0fef 90       		.p2align 4,,10
+ 1268              		.p2align 3
+ 1269              	.L202:
+ 1270 0ff0 4A8954E4 		movq	%rdx, 32(%rsp,%r12,8)
+ 1270      20
+ 1271              	.L181:
+ 1272 0ff5 4983C604 		addq	$4, %r14
+ 1273 0ff9 4D85E4   		testq	%r12, %r12
+ 1274 0ffc 7567     		jne	.L200
+ 1275              	.L191:
+ 1276 0ffe 41BC0100 		movl	$1, %r12d
+ 1276      0000
+ 1277              	.L182:
+ 1278 1004 488B9388 		movq	136(%rbx), %rdx
+ 1278      000000
+ 1279 100b 42803C22 		cmpb	$0, (%rdx,%r12)
+ 1279      00
+ 1280 1010 0F852A01 		jne	.L201
+ 1280      0000
+ 1281 1016 498B5778 		movq	120(%r15), %rdx
+ 1282 101a 84C9     		testb	%cl, %cl
+ 1283 101c 75D2     		jne	.L202
+ 1284 101e 4489E9   		movl	%r13d, %ecx
+ 1285 1021 418D4501 		leal	1(%r13), %eax
+ 1286 1025 4E8974EC 		movq	%r14, 96(%rsp,%r13,8)
+ 1286      60
+ 1287 102a 4C89FF   		movq	%r15, %rdi
+ 1288 102d C1E106   		sall	$6, %ecx
+ 1289 1030 8944241C 		movl	%eax, 28(%rsp)
+ 1290 1034 4863C9   		movslq	%ecx, %rcx
+ 1291 1037 488D348A 		leaq	(%rdx,%rcx,4), %rsi
+ 1292 103b 4A8B54E3 		movq	8(%rbx,%r12,8), %rdx
+ 1292      08
+ 1293 1040 B9400000 		movl	$64, %ecx
+ 1293      00
+ 1294 1045 4A8974E4 		movq	%rsi, 32(%rsp,%r12,8)
+ 1294      20
+ 1295 104a C5F877   		vzeroupper
+ 1296 104d E86EF5FF 		call	comp_target_block
+ 1296      FF
+ 1297 1052 4983C604 		addq	$4, %r14
+ 1298 1056 410FB64F 		movzbl	48(%r15), %ecx
+ 1298      30
+ 1299 105b 4C636C24 		movslq	28(%rsp), %r13
+ 1299      1C
+ 1300 1060 4D85E4   		testq	%r12, %r12
+ 1301 1063 7499     		je	.L191
+ 1302              	.L200:
+ 1303 1065 84C9     		testb	%cl, %cl
+ 1304 1067 0F850301 		jne	.L203
+ 1304      0000
+ 1305              	.L185:
+ 1306 106d 4D8B7778 		movq	120(%r15), %r14
+ 1307 1071 488D4C24 		leaq	96(%rsp), %rcx
+ 1307      60
+ 1308 1076 4589E8   		movl	%r13d, %r8d
+ 1309 1079 4C89FF   		movq	%r15, %rdi
+ 1310 107c BA400000 		movl	$64, %edx
+ 1310      00
+ 1311 1081 4C89F6   		movq	%r14, %rsi
+ 1312 1084 E877EFFF 		call	comp_smooth
+ 1312      FF
+ 1313 1089 4489EE   		movl	%r13d, %esi
+ 1314 108c 4C89F7   		movq	%r14, %rdi
+ 1315 108f C1E606   		sall	$6, %esi
+ 1316 1092 E8E9F2FF 		call	exp2_block
+ 1316      FF
+ 1317 1097 31C9     		xorl	%ecx, %ecx
+ 1318 1099 C5F1EFC9 		vpxor	%xmm1, %xmm1, %xmm1
+ 1319 109d EB24     		jmp	.L189
+ 1320 109f 90       		.p2align 4,,10
+ 1321              		.p2align 3
+ 1322              	.L205:
+ 1323 10a0 62F17F48 		vmovdqu8	%zmm1, (%rdx)
+ 1323      7F0A
+ 1324 10a6 62F17F48 		vmovdqu8	%zmm1, 64(%rdx)
+ 1324      7F4A01
+ 1325 10ad 62F17F48 		vmovdqu8	%zmm1, 128(%rdx)
+ 1325      7F4A02
+ 1326 10b4 62F17F48 		vmovdqu8	%zmm1, 192(%rdx)
+ 1326      7F4A03
+ 1327 10bb 4885C9   		testq	%rcx, %rcx
+ 1328 10be 7550     		jne	.L204
+ 1329              	.L192:
+ 1330 10c0 4C89E1   		movq	%r12, %rcx
+ 1331              	.L189:
+ 1332 10c3 488B8388 		movq	136(%rbx), %rax
+ 1332      000000
+ 1333 10ca 488BBB90 		movq	144(%rbx), %rdi
+ 1333      000000
+ 1334 10d1 488B74CB 		movq	8(%rbx,%rcx,8), %rsi
+ 1334      08
+ 1335 10d6 488B54CB 		movq	72(%rbx,%rcx,8), %rdx
+ 1335      48
+ 1336 10db 0FB60408 		movzbl	(%rax,%rcx), %eax
+ 1337 10df 88040F   		movb	%al, (%rdi,%rcx)
+ 1338 10e2 84C0     		testb	%al, %al
+ 1339 10e4 75BA     		jne	.L205
+ 1340 10e6 488B7CCC 		movq	32(%rsp,%rcx,8), %rdi
+ 1340      20
+ 1341 10eb 31C0     		xorl	%eax, %eax
+ 1342 10ed 0F1F00   		.p2align 4,,10
+ 1343              		.p2align 3
+ 1344              	.L188:
+ 1345 10f0 C5FC1014 		vmovups	(%rdi,%rax), %ymm2
+ 1345      07
+ 1346 10f5 C5EC5904 		vmulps	(%rsi,%rax), %ymm2, %ymm0
+ 1346      06
+ 1347 10fa C5FC2904 		vmovaps	%ymm0, (%rdx,%rax)
+ 1347      02
+ 1348 10ff 4883C020 		addq	$32, %rax
+ 1349 1103 483D0001 		cmpq	$256, %rax
+ 1349      0000
+ 1350 1109 75E5     		jne	.L188
+ 1351 110b 4885C9   		testq	%rcx, %rcx
+ 1352 110e 74B0     		je	.L192
+ 1353              	.L204:
+ 1354 1110 C5F877   		vzeroupper
+ 1355 1113 488D65D8 		leaq	-40(%rbp), %rsp
+ 1356 1117 5B       		popq	%rbx
+ 1357 1118 415C     		popq	%r12
+ 1358 111a 415D     		popq	%r13
+ 1359 111c 415E     		popq	%r14
+ 1360 111e 415F     		popq	%r15
+ 1361 1120 5D       		popq	%rbp
+ 1362              		.cfi_remember_state
+ 1363              		.cfi_def_cfa 7, 8
+ 1364 1121 C3       		ret
+ 1365              		.p2align 4,,10
+ 1366 1122 660F1F44 		.p2align 3
+ 1366      0000
+ 1367              	.L177:
+ 1368              		.cfi_restore_state
+ 1369 1128 488D65D8 		leaq	-40(%rbp), %rsp
+ 1370 112c 4889DF   		movq	%rbx, %rdi
+ 1371 112f 5B       		popq	%rbx
+ 1372 1130 415C     		popq	%r12
+ 1373 1132 415D     		popq	%r13
+ 1374 1134 415E     		popq	%r14
+ 1375 1136 415F     		popq	%r15
+ 1376 1138 5D       		popq	%rbp
+ 1377              		.cfi_remember_state
+ 1378              		.cfi_def_cfa 7, 8
+ 1379 1139 E9000000 		jmp	comp_process@PLT
+ 1379      00
+ 1380 113e 6690     		.p2align 4,,10
+ 1381              		.p2align 3
+ 1382              	.L201:
+ 1383              		.cfi_restore_state
+ 1384 1140 84C9     		testb	%cl, %cl
+ 1385 1142 0F85ADFE 		jne	.L181
+ 1385      FFFF
+ 1386 1148 884C241C 		movb	%cl, 28(%rsp)
+ 1387 114c 4C89F2   		movq	%r14, %rdx
+ 1388 114f BE400000 		movl	$64, %esi
+ 1388      00
+ 1389 1154 4C89FF   		movq	%r15, %rdi
+ 1390 1157 C5F877   		vzeroupper
+ 1391 115a E8D1EFFF 		call	comp_idle
+ 1391      FF
+ 1392 115f 0FB64C24 		movzbl	28(%rsp), %ecx
+ 1392      1C
+ 1393 1164 E98CFEFF 		jmp	.L181
+ 1393      FF
+ 1394 1169 0F1F8000 		.p2align 4,,10
+ 1394      000000
+ 1395              		.p2align 3
+ 1396              	.L203:
+ 1397 1170 488B8388 		movq	136(%rbx), %rax
+ 1397      000000
+ 1398 1177 803800   		cmpb	$0, (%rax)
+ 1399 117a 7420     		je	.L184
+ 1400 117c 80780100 		cmpb	$0, 1(%rax)
+ 1401 1180 741A     		je	.L184
+ 1402 1182 488B5424 		movq	16(%rsp), %rdx
+ 1402      10
+ 1403 1187 BE400000 		movl	$64, %esi
+ 1403      00
+ 1404 118c 4C89FF   		movq	%r15, %rdi
+ 1405 118f C5F877   		vzeroupper
+ 1406 1192 E899EFFF 		call	comp_idle
+ 1406      FF
+ 1407 1197 E9D1FEFF 		jmp	.L185
+ 1407      FF
+ 1408              	.L184:
+ 1409 119c 498B7F78 		movq	120(%r15), %rdi
+ 1410 11a0 488D7308 		leaq	8(%rbx), %rsi
+ 1411 11a4 B9400000 		movl	$64, %ecx
+ 1411      00
+ 1412 11a9 BA020000 		movl	$2, %edx
+ 1412      00
+ 1413 11ae C5F877   		vzeroupper
+ 1414 11b1 E88AF0FF 		call	peak_block
+ 1414      FF
+ 1415 11b6 498B7778 		movq	120(%r15), %rsi
+ 1416 11ba B9400000 		movl	$64, %ecx
+ 1416      00
+ 1417 11bf 4C89FF   		movq	%r15, %rdi
+ 1418 11c2 4889F2   		movq	%rsi, %rdx
+ 1419 11c5 E8F6F3FF 		call	comp_target_block
+ 1419      FF
+ 1420 11ca 488B7424 		movq	16(%rsp), %rsi
+ 1420      10
+ 1421 11cf 4963C5   		movslq	%r13d, %rax
+ 1422 11d2 4183C501 		addl	$1, %r13d
+ 1423 11d6 488974C4 		movq	%rsi, 96(%rsp,%rax,8)
+ 1423      60
+ 1424 11db E98DFEFF 		jmp	.L185
+ 1424      FF
+ 1425              		.cfi_endproc
+ 1426              	.LFE6409:
+ 1428              		.p2align 4
+ 1430              	comp_process_2_128:
+ 1431              	.LFB6410:
+ 1432              		.cfi_startproc
+ 1433 11e0 55       		pushq	%rbp
+ 1434              		.cfi_def_cfa_offset 16
+ 1435              		.cfi_offset 6, -16
+ 1436 11e1 4889E5   		movq	%rsp, %rbp
+ 1437              		.cfi_def_cfa_register 6
+ 1438 11e4 4157     		pushq	%r15
+ 1439 11e6 4156     		pushq	%r14
+ 1440 11e8 4155     		pushq	%r13
+ 1441 11ea 4154     		pushq	%r12
+ 1442 11ec 53       		pushq	%rbx
+ 1443              		.cfi_offset 15, -24
+ 1444              		.cfi_offset 14, -32
+ 1445              		.cfi_offset 13, -40
+ 1446              		.cfi_offset 12, -48
+ 1447              		.cfi_offset 3, -56
+ 1448 11ed 4889FB   		movq	%rdi, %rbx
+ 1449 11f0 4883E4E0 		andq	$-32, %rsp
+ 1450 11f4 4881ECA0 		subq	$160, %rsp
+ 1450      000000
+ 1451 11fb 81BFA400 		cmpl	$128, 164(%rdi)
+ 1451      00008000 
+ 1451      0000
+ 1452 1205 0F857501 		jne	.L207
+ 1452      0000
+ 1453 120b 488B4708 		movq	8(%rdi), %rax
+ 1454 120f 480B4748 		orq	72(%rdi), %rax
+ 1455 1213 480B4710 		orq	16(%rdi), %rax
+ 1456 1217 480B4750 		orq	80(%rdi), %rax
+ 1457 121b A81F     		testb	$31, %al
+ 1458 121d 0F855D01 		jne	.L207
+ 1458      0000
+ 1459 1223 4C8BBFC0 		movq	192(%rdi), %r15
+ 1459      000000
+ 1460 122a C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 1461 122e 4531E4   		xorl	%r12d, %r12d
+ 1462 1231 4531ED   		xorl	%r13d, %r13d
+ 1463 1234 62F17F48 		vmovdqu8	%zmm0, 96(%rsp)
+ 1463      7F842460 
+ 1463      000000
+ 1464 123f 498D4754 		leaq	84(%r15), %rax
+ 1465 1243 410FB64F 		movzbl	48(%r15), %ecx
+ 1465      30
+ 1466 1248 48894424 		movq	%rax, 16(%rsp)
+ 1466      10
+ 1467 124d 4989C6   		movq	%rax, %r14
+ 1468 1250 EB1A     		jmp	.L212
+ 1469              		.p2align 4,,10
+ 1470 1252 660F1F44 		.p2align 3
+ 1470      0000
+ 1471              	.L232:
+ 1472 1258 4A8954E4 		movq	%rdx, 32(%rsp,%r12,8)
+ 1472      20
+ 1473              	.L211:
+ 1474 125d 4983C604 		addq	$4, %r14
+ 1475 1261 4D85E4   		testq	%r12, %r12
+ 1476 1264 7567     		jne	.L230
+ 1477              	.L221:
+ 1478 1266 41BC0100 		movl	$1, %r12d
+ 1478      0000
+ 1479              	.L212:
+ 1480 126c 488B9388 		movq	136(%rbx), %rdx
+ 1480      000000
+ 1481 1273 42803C22 		cmpb	$0, (%rdx,%r12)
+ 1481      00
+ 1482 1278 0F852201 		jne	.L231
+ 1482      0000
+ 1483 127e 498B5778 		movq	120(%r15), %rdx
+ 1484 1282 84C9     		testb	%cl, %cl
+ 1485 1284 75D2     		jne	.L232
+ 1486 1286 4489E9   		movl	%r13d, %ecx
+ 1487 1289 418D4501 		leal	1(%r13), %eax
+ 1488 128d 4E8974EC 		movq	%r14, 96(%rsp,%r13,8)
+ 1488      60
+ 1489 1292 4C89FF   		movq	%r15, %rdi
+ 1490 1295 C1E107   		sall	$7, %ecx
+ 1491 1298 8944241C 		movl	%eax, 28(%rsp)
+ 1492 129c 4863C9   		movslq	%ecx, %rcx
+ 1493 129f 488D348A 		leaq	(%rdx,%rcx,4), %rsi
+ 1494 12a3 4A8B54E3 		movq	8(%rbx,%r12,8), %rdx
+ 1494      08
+ 1495 12a8 B9800000 		movl	$128, %ecx
+ 1495      00
+ 1496 12ad 4A8974E4 		movq	%rsi, 32(%rsp,%r12,8)
+ 1496      20
+ 1497 12b2 C5F877   		vzeroupper
+ 1498 12b5 E806F3FF 		call	comp_target_block
+ 1498      FF
+ 1499 12ba 4983C604 		addq	$4, %r14
+ 1500 12be 410FB64F 		movzbl	48(%r15), %ecx
+ 1500      30
+ 1501 12c3 4C636C24 		movslq	28(%rsp), %r13
+ 1501      1C
+ 1502 12c8 4D85E4   		testq	%r12, %r12
+ 1503 12cb 7499     		je	.L221
+ 1504              	.L230:
+ 1505 12cd 84C9     		testb	%cl, %cl
+ 1506 12cf 0F85FB00 		jne	.L233
+ 1506      0000
+ 1507              	.L215:
+ 1508 12d5 4D8B7778 		movq	120(%r15), %r14
+ 1509 12d9 488D4C24 		leaq	96(%rsp), %rcx
+ 1509      60
+ 1510 12de 4589E8   		movl	%r13d, %r8d
+ 1511 12e1 4C89FF   		movq	%r15, %rdi
+ 1512 12e4 BA800000 		movl	$128, %edx
+ 1512      00
+ 1513 12e9 4C89F6   		movq	%r14, %rsi
+ 1514 12ec E80FEDFF 		call	comp_smooth
+ 1514      FF
+ 1515 12f1 4489EE   		movl	%r13d, %esi
+ 1516 12f4 4C89F7   		movq	%r14, %rdi
+ 1517 12f7 C1E607   		sall	$7, %esi
+ 1518 12fa E881F0FF 		call	exp2_block
+ 1518      FF
+ 1519 12ff 31F6     		xorl	%esi, %esi
+ 1520 1301 31C0     		xorl	%eax, %eax
+ 1521 1303 EB16     		jmp	.L219
+ 1522              		.p2align 4,,10
+ 1523 1305 0F1F00   		.p2align 3
+ 1524              	.L235:
+ 1525 1308 B9400000 		movl	$64, %ecx
+ 1525      00
+ 1526 130d 4C89C7   		movq	%r8, %rdi
+ 1527 1310 F348AB   		rep stosq
+ 1528 1313 4885F6   		testq	%rsi, %rsi
+ 1529 1316 7552     		jne	.L234
+ 1530              	.L222:
+ 1531 1318 4C89E6   		movq	%r12, %rsi
+ 1532              	.L219:
+ 1533 131b 488B9388 		movq	136(%rbx), %rdx
+ 1533      000000
+ 1534 1322 488BBB90 		movq	144(%rbx), %rdi
+ 1534      000000
+ 1535 1329 488B4CF3 		movq	8(%rbx,%rsi,8), %rcx
+ 1535      08
+ 1536 132e 4C8B44F3 		movq	72(%rbx,%rsi,8), %r8
+ 1536      48
+ 1537 1333 0FB61432 		movzbl	(%rdx,%rsi), %edx
+ 1538 1337 881437   		movb	%dl, (%rdi,%rsi)
+ 1539 133a 84D2     		testb	%dl, %dl
+ 1540 133c 75CA     		jne	.L235
+ 1541 133e 488B7CF4 		movq	32(%rsp,%rsi,8), %rdi
+ 1541      20
+ 1542 1343 31D2     		xorl	%edx, %edx
+ 1543              		.p2align 4,,10
+ 1544 1345 0F1F00   		.p2align 3
+ 1545              	.L218:
+ 1546 1348 C5FC100C 		vmovups	(%rdi,%rdx), %ymm1
+ 1546      17
+ 1547 134d C5F45904 		vmulps	(%rcx,%rdx), %ymm1, %ymm0
+ 1547      11
+ 1548 1352 C4C17C29 		vmovaps	%ymm0, (%r8,%rdx)
+ 1548      0410
+ 1549 1358 4883C220 		addq	$32, %rdx
+ 1550 135c 4881FA00 		cmpq	$512, %rdx
+ 1550      020000
+ 1551 1363 75E3     		jne	.L218
+ 1552 1365 4885F6   		testq	%rsi, %rsi
+ 1553 1368 74AE     		je	.L222
+ 1554              	.L234:
+ 1555 136a C5F877   		vzeroupper
+ 1556 136d 488D65D8 		leaq	-40(%rbp), %rsp
+ 1557 1371 5B       		popq	%rbx
+ 1558 1372 415C     		popq	%r12
+ 1559 1374 415D     		popq	%r13
+ 1560 1376 415E     		popq	%r14
+ 1561 1378 415F     		popq	%r15
+ 1562 137a 5D       		popq	%rbp
+ 1563              		.cfi_remember_state
+ 1564              		.cfi_def_cfa 7, 8
+ 1565 137b C3       		ret
+ 1566 137c 0F1F4000 		.p2align 4,,10
+ 1567              		.p2align 3
+ 1568              	.L207:
+ 1569              		.cfi_restore_state
+ 1570 1380 488D65D8 		leaq	-40(%rbp), %rsp
+ 1571 1384 4889DF   		movq	%rbx, %rdi
+ 1572 1387 5B       		popq	%rbx
+ 1573 1388 415C     		popq	%r12
+ 1574 138a 415D     		popq	%r13
+ 1575 138c 415E     		popq	%r14
+ 1576 138e 415F     		popq	%r15
+ 1577 1390 5D       		popq	%rbp
+ 1578              		.cfi_remember_state
+ 1579              		.cfi_def_cfa 7, 8
+ 1580 1391 E9000000 		jmp	comp_process@PLT
+ 1580      00
+ 1581 1396 662E0F1F 		.p2align 4,,10
+ 1581      84000000 
+ 1581      0000
+ 1582              		.p2align 3
+ 1583              	.L231:
+ 1584              		.cfi_restore_state
+ 1585 13a0 84C9     		testb	%cl, %cl
+ 1586 13a2 0F85B5FE 		jne	.L211
+ 1586      FFFF
+ 1587 13a8 884C241C 		movb	%cl, 28(%rsp)
+ 1588 13ac 4C89F2   		movq	%r14, %rdx
+ 1589 13af BE800000 		movl	$128, %esi
+ 1589      00
+ 1590 13b4 4C89FF   		movq	%r15, %rdi
+ 1591 13b7 C5F877   		vzeroupper
+ 1592 13ba E871EDFF 		call	comp_idle
+ 1592      FF
+ 1593 13bf 0FB64C24 		movzbl	28(%rsp), %ecx
+ 1593      1C
+ 1594 13c4 E994FEFF 		jmp	.L211
+ 1594      FF
+ 1595 13c9 0F1F8000 		.p2align 4,,10
+ 1595      000000
+ 1596              		.p2align 3
+ 1597              	.L233:
+ 1598 13d0 488B8388 		movq	136(%rbx), %rax
+ 1598      000000
+ 1599 13d7 803800   		cmpb	$0, (%rax)
+ 1600 13da 7420     		je	.L214
+ 1601 13dc 80780100 		cmpb	$0, 1(%rax)
+ 1602 13e0 741A     		je	.L214
+ 1603 13e2 488B5424 		movq	16(%rsp), %rdx
+ 1603      10
+ 1604 13e7 BE800000 		movl	$128, %esi
+ 1604      00
+ 1605 13ec 4C89FF   		movq	%r15, %rdi
+ 1606 13ef C5F877   		vzeroupper
+ 1607 13f2 E839EDFF 		call	comp_idle
+ 1607      FF
+ 1608 13f7 E9D9FEFF 		jmp	.L215
+ 1608      FF
+ 1609              	.L214:
+ 1610 13fc 498B7F78 		movq	120(%r15), %rdi
+ 1611 1400 488D7308 		leaq	8(%rbx), %rsi
+ 1612 1404 B9800000 		movl	$128, %ecx
+ 1612      00
+ 1613 1409 BA020000 		movl	$2, %edx
+ 1613      00
+ 1614 140e C5F877   		vzeroupper
+ 1615 1411 E82AEEFF 		call	peak_block
+ 1615      FF
+ 1616 1416 498B7778 		movq	120(%r15), %rsi
+ 1617 141a B9800000 		movl	$128, %ecx
+ 1617      00
+ 1618 141f 4C89FF   		movq	%r15, %rdi
+ 1619 1422 4889F2   		movq	%rsi, %rdx
+ 1620 1425 E896F1FF 		call	comp_target_block
+ 1620      FF
+ 1621 142a 488B7424 		movq	16(%rsp), %rsi
+ 1621      10
+ 1622 142f 4963C5   		movslq	%r13d, %rax
+ 1623 1432 4183C501 		addl	$1, %r13d
+ 1624 1436 488974C4 		movq	%rsi, 96(%rsp,%rax,8)
+ 1624      60
+ 1625 143b E995FEFF 		jmp	.L215
+ 1625      FF
+ 1626              		.cfi_endproc
+ 1627              	.LFE6410:
+ 1629              		.p2align 4
+ 1631              	comp_process_2_256:
+ 1632              	.LFB6411:
+ 1633              		.cfi_startproc
+ 1634 1440 55       		pushq	%rbp
+ 1635              		.cfi_def_cfa_offset 16
+ 1636              		.cfi_offset 6, -16
+ 1637 1441 4889E5   		movq	%rsp, %rbp
+ 1638              		.cfi_def_cfa_register 6
+ 1639 1444 4157     		pushq	%r15
+ 1640 1446 4156     		pushq	%r14
+ 1641 1448 4155     		pushq	%r13
+ 1642 144a 4154     		pushq	%r12
+ 1643 144c 53       		pushq	%rbx
+ 1644              		.cfi_offset 15, -24
+ 1645              		.cfi_offset 14, -32
+ 1646              		.cfi_offset 13, -40
+ 1647              		.cfi_offset 12, -48
+ 1648              		.cfi_offset 3, -56
+ 1649 144d 4889FB   		movq	%rdi, %rbx
+ 1650 1450 4883E4E0 		andq	$-32, %rsp
+ 1651 1454 4881ECA0 		subq	$160, %rsp
+ 1651      000000
+ 1652 145b 81BFA400 		cmpl	$256, 164(%rdi)
+ 1652      00000001 
+ 1652      0000
+ 1653 1465 0F857501 		jne	.L237
+ 1653      0000
+ 1654 146b 488B4708 		movq	8(%rdi), %rax
+ 1655 146f 480B4748 		orq	72(%rdi), %rax
+ 1656 1473 480B4710 		orq	16(%rdi), %rax
+ 1657 1477 480B4750 		orq	80(%rdi), %rax
+ 1658 147b A81F     		testb	$31, %al
+ 1659 147d 0F855D01 		jne	.L237
+ 1659      0000
+ 1660 1483 4C8BBFC0 		movq	192(%rdi), %r15
+ 1660      000000
+ 1661 148a C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 1662 148e 4531E4   		xorl	%r12d, %r12d
+ 1663 1491 4531ED   		xorl	%r13d, %r13d
+ 1664 1494 62F17F48 		vmovdqu8	%zmm0, 96(%rsp)
+ 1664      7F842460 
+ 1664      000000
+ 1665 149f 498D4754 		leaq	84(%r15), %rax
+ 1666 14a3 410FB64F 		movzbl	48(%r15), %ecx
+ 1666      30
+ 1667 14a8 48894424 		movq	%rax, 16(%rsp)
+ 1667      10
+ 1668 14ad 4989C6   		movq	%rax, %r14
+ 1669 14b0 EB1A     		jmp	.L242
+ 1670              		.p2align 4,,10
+ 1671 14b2 660F1F44 		.p2align 3
+ 1671      0000
+ 1672              	.L262:
+ 1673 14b8 4A8954E4 		movq	%rdx, 32(%rsp,%r12,8)
+ 1673      20
+ 1674              	.L241:
+ 1675 14bd 4983C604 		addq	$4, %r14
+ 1676 14c1 4D85E4   		testq	%r12, %r12
+ 1677 14c4 7567     		jne	.L260
+ 1678              	.L251:
+ 1679 14c6 41BC0100 		movl	$1, %r12d
+ 1679      0000
+ 1680              	.L242:
+ 1681 14cc 488B9388 		movq	136(%rbx), %rdx
+ 1681      000000
+ 1682 14d3 42803C22 		cmpb	$0, (%rdx,%r12)
+ 1682      00
+ 1683 14d8 0F852201 		jne	.L261
+ 1683      0000
+ 1684 14de 498B5778 		movq	120(%r15), %rdx
+ 1685 14e2 84C9     		testb	%cl, %cl
+ 1686 14e4 75D2     		jne	.L262
+ 1687 14e6 4489E9   		movl	%r13d, %ecx
+ 1688 14e9 418D4501 		leal	1(%r13), %eax
+ 1689 14ed 4E8974EC 		movq	%r14, 96(%rsp,%r13,8)
+ 1689      60
+ 1690 14f2 4C89FF   		movq	%r15, %rdi
+ 1691 14f5 C1E108   		sall	$8, %ecx
+ 1692 14f8 8944241C 		movl	%eax, 28(%rsp)
+ 1693 14fc 4863C9   		movslq	%ecx, %rcx
+ 1694 14ff 488D348A 		leaq	(%rdx,%rcx,4), %rsi
+ 1695 1503 4A8B54E3 		movq	8(%rbx,%r12,8), %rdx
+ 1695      08
+ 1696 1508 B9000100 		movl	$256, %ecx
+ 1696      00
+ 1697 150d 4A8974E4 		movq	%rsi, 32(%rsp,%r12,8)
+ 1697      20
+ 1698 1512 C5F877   		vzeroupper
+ 1699 1515 E8A6F0FF 		call	comp_target_block
+ 1699      FF
+ 1700 151a 4983C604 		addq	$4, %r14
+ 1701 151e 410FB64F 		movzbl	48(%r15), %ecx
+ 1701      30
+ 1702 1523 4C636C24 		movslq	28(%rsp), %r13
+ 1702      1C
+ 1703 1528 4D85E4   		testq	%r12, %r12
+ 1704 152b 7499     		je	.L251
+ 1705              	.L260:
+ 1706 152d 84C9     		testb	%cl, %cl
+ 1707 152f 0F85FB00 		jne	.L263
+ 1707      0000
+ 1708              	.L245:
+ 1709 1535 4D8B7778 		movq	120(%r15), %r14
+ 1710 1539 488D4C24 		leaq	96(%rsp), %rcx
+ 1710      60
+ 1711 153e 4589E8   		movl	%r13d, %r8d
+ 1712 1541 4C89FF   		movq	%r15, %rdi
+ 1713 1544 BA000100 		movl	$256, %edx
+ 1713      00
+ 1714 1549 4C89F6   		movq	%r14, %rsi
+ 1715 154c E8AFEAFF 		call	comp_smooth
+ 1715      FF
+ 1716 1551 4489EE   		movl	%r13d, %esi
+ 1717 1554 4C89F7   		movq	%r14, %rdi
+ 1718 1557 C1E608   		sall	$8, %esi
+ 1719 155a E821EEFF 		call	exp2_block
+ 1719      FF
+ 1720 155f 31F6     		xorl	%esi, %esi
+ 1721 1561 31C0     		xorl	%eax, %eax
+ 1722 1563 EB16     		jmp	.L249
+ 1723              		.p2align 4,,10
+ 1724 1565 0F1F00   		.p2align 3
+ 1725              	.L265:
+ 1726 1568 B9800000 		movl	$128, %ecx
+ 1726      00
+ 1727 156d 4C89C7   		movq	%r8, %rdi
+ 1728 1570 F348AB   		rep stosq
+ 1729 1573 4885F6   		testq	%rsi, %rsi
+ 1730 1576 7552     		jne	.L264
+ 1731              	.L252:
+ 1732 1578 4C89E6   		movq	%r12, %rsi
+ 1733              	.L249:
+ 1734 157b 488B9388 		movq	136(%rbx), %rdx
+ 1734      000000
+ 1735 1582 488BBB90 		movq	144(%rbx), %rdi
+ 1735      000000
+ 1736 1589 488B4CF3 		movq	8(%rbx,%rsi,8), %rcx
+ 1736      08
+ 1737 158e 4C8B44F3 		movq	72(%rbx,%rsi,8), %r8
+ 1737      48
+ 1738 1593 0FB61432 		movzbl	(%rdx,%rsi), %edx
+ 1739 1597 881437   		movb	%dl, (%rdi,%rsi)
+ 1740 159a 84D2     		testb	%dl, %dl
+ 1741 159c 75CA     		jne	.L265
+ 1742 159e 488B7CF4 		movq	32(%rsp,%rsi,8), %rdi
+ 1742      20
+ 1743 15a3 31D2     		xorl	%edx, %edx
+ 1744              		.p2align 4,,10
+ 1745 15a5 0F1F00   		.p2align 3
+ 1746              	.L248:
+ 1747 15a8 C5FC100C 		vmovups	(%rdi,%rdx), %ymm1
+ 1747      17
+ 1748 15ad C5F45904 		vmulps	(%rcx,%rdx), %ymm1, %ymm0
+ 1748      11
+ 1749 15b2 C4C17C29 		vmovaps	%ymm0, (%r8,%rdx)
+ 1749      0410
+ 1750 15b8 4883C220 		addq	$32, %rdx
+ 1751 15bc 4881FA00 		cmpq	$1024, %rdx
+ 1751      040000
+ 1752 15c3 75E3     		jne	.L248
+ 1753 15c5 4885F6   		testq	%rsi, %rsi
+ 1754 15c8 74AE     		je	.L252
+ 1755              	.L264:
+ 1756 15ca C5F877   		vzeroupper
+ 1757 15cd 488D65D8 		leaq	-40(%rbp), %rsp
+ 1758 15d1 5B       		popq	%rbx
+ 1759 15d2 415C     		popq	%r12
+ 1760 15d4 415D     		popq	%r13
+ 1761 15d6 415E     		popq	%r14
+ 1762 15d8 415F     		popq	%r15
+ 1763 15da 5D       		popq	%rbp
+ 1764              		.cfi_remember_state
+ 1765              		.cfi_def_cfa 7, 8
+ 1766 15db C3       		ret
+ 1767 15dc 0F1F4000 		.p2align 4,,10
+ 1768              		.p2align 3
+ 1769              	.L237:
+ 1770              		.cfi_restore_state
+ 1771 15e0 488D65D8 		leaq	-40(%rbp), %rsp
+ 1772 15e4 4889DF   		movq	%rbx, %rdi
+ 1773 15e7 5B       		popq	%rbx
+ 1774 15e8 415C     		popq	%r12
+ 1775 15ea 415D     		popq	%r13
+ 1776 15ec 415E     		popq	%r14
+ 1777 15ee 415F     		popq	%r15
+ 1778 15f0 5D       		popq	%rbp
+ 1779              		.cfi_remember_state
+ 1780              		.cfi_def_cfa 7, 8
+ 1781 15f1 E9000000 		jmp	comp_process@PLT
+ 1781      00
+ 1782 15f6 662E0F1F 		.p2align 4,,10
+ 1782      84000000 
+ 1782      0000
+ 1783              		.p2align 3
+ 1784              	.L261:
+ 1785              		.cfi_restore_state
+ 1786 1600 84C9     		testb	%cl, %cl
+ 1787 1602 0F85B5FE 		jne	.L241
+ 1787      FFFF
+ 1788 1608 884C241C 		movb	%cl, 28(%rsp)
+ 1789 160c 4C89F2   		movq	%r14, %rdx
+ 1790 160f BE000100 		movl	$256, %esi
+ 1790      00
+ 1791 1614 4C89FF   		movq	%r15, %rdi
+ 1792 1617 C5F877   		vzeroupper
+ 1793 161a E811EBFF 		call	comp_idle
+ 1793      FF
+ 1794 161f 0FB64C24 		movzbl	28(%rsp), %ecx
+ 1794      1C
+ 1795 1624 E994FEFF 		jmp	.L241
+ 1795      FF
+ 1796 1629 0F1F8000 		.p2align 4,,10
+ 1796      000000
+ 1797              		.p2align 3
+ 1798              	.L263:
+ 1799 1630 488B8388 		movq	136(%rbx), %rax
+ 1799      000000
+ 1800 1637 803800   		cmpb	$0, (%rax)
+ 1801 163a 7420     		je	.L244
+ 1802 163c 80780100 		cmpb	$0, 1(%rax)
+ 1803 1640 741A     		je	.L244
+ 1804 1642 488B5424 		movq	16(%rsp), %rdx
+ 1804      10
+ 1805 1647 BE000100 		movl	$256, %esi
+ 1805      00
+ 1806 164c 4C89FF   		movq	%r15, %rdi
+ 1807 164f C5F877   		vzeroupper
+ 1808 1652 E8D9EAFF 		call	comp_idle
+ 1808      FF
+ 1809 1657 E9D9FEFF 		jmp	.L245
+ 1809      FF
+ 1810              	.L244:
+ 1811 165c 498B7F78 		movq	120(%r15), %rdi
+ 1812 1660 488D7308 		leaq	8(%rbx), %rsi
+ 1813 1664 B9000100 		movl	$256, %ecx
+ 1813      00
+ 1814 1669 BA020000 		movl	$2, %edx
+ 1814      00
+ 1815 166e C5F877   		vzeroupper
+ 1816 1671 E8CAEBFF 		call	peak_block
+ 1816      FF
+ 1817 1676 498B7778 		movq	120(%r15), %rsi
+ 1818 167a B9000100 		movl	$256, %ecx
+ 1818      00
+ 1819 167f 4C89FF   		movq	%r15, %rdi
+ 1820 1682 4889F2   		movq	%rsi, %rdx
+ 1821 1685 E836EFFF 		call	comp_target_block
+ 1821      FF
+ 1822 168a 488B7424 		movq	16(%rsp), %rsi
+ 1822      10
+ 1823 168f 4963C5   		movslq	%r13d, %rax
+ 1824 1692 4183C501 		addl	$1, %r13d
+ 1825 1696 488974C4 		movq	%rsi, 96(%rsp,%rax,8)
+ 1825      60
+ 1826 169b E995FEFF 		jmp	.L245
+ 1826      FF
+ 1827              		.cfi_endproc
+ 1828              	.LFE6411:
+ 1830              		.p2align 4
+ 1832              	comp_process_8_64:
+ 1833              	.LFB6412:
+ 1834              		.cfi_startproc
+ 1835 16a0 55       		pushq	%rbp
+ 1836              		.cfi_def_cfa_offset 16
+ 1837              		.cfi_offset 6, -16
+ 1838 16a1 4889E5   		movq	%rsp, %rbp
+ 1839              		.cfi_def_cfa_register 6
+ 1840 16a4 4157     		pushq	%r15
+ 1841 16a6 4156     		pushq	%r14
+ 1842 16a8 4155     		pushq	%r13
+ 1843 16aa 4154     		pushq	%r12
+ 1844 16ac 53       		pushq	%rbx
+ 1845              		.cfi_offset 15, -24
+ 1846              		.cfi_offset 14, -32
+ 1847              		.cfi_offset 13, -40
+ 1848              		.cfi_offset 12, -48
+ 1849              		.cfi_offset 3, -56
+ 1850 16ad 4889FB   		movq	%rdi, %rbx
+ 1851 16b0 4883E4C0 		andq	$-64, %rsp
+ 1852 16b4 4881ECC0 		subq	$192, %rsp
+ 1852      000000
+ 1853 16bb 83BFA400 		cmpl	$64, 164(%rdi)
+ 1853      000040
+ 1854 16c2 0F853B02 		jne	.L267
+ 1854      0000
+ 1855 16c8 62F1FE48 		vmovdqu64	8(%rdi), %zmm2
+ 1855      6F970800 
+ 1855      0000
+ 1856 16d2 62F1ED48 		vporq	72(%rdi), %zmm2, %zmm0
+ 1856      EB874800 
+ 1856      0000
+ 1857 16dc C5FD6FC8 		vmovdqa	%ymm0, %ymm1
+ 1858 16e0 62F3FD48 		vextracti64x4	$0x1, %zmm0, %ymm0
+ 1858      3BC001
+ 1859 16e7 C5F5EBC8 		vpor	%ymm0, %ymm1, %ymm1
+ 1860 16eb 62F3FD28 		vextracti64x2	$0x1, %ymm1, %xmm0
+ 1860      39C801
+ 1861 16f2 C5F9EBC1 		vpor	%xmm1, %xmm0, %xmm0
+ 1862 16f6 C5F173D8 		vpsrldq	$8, %xmm0, %xmm1
+ 1862      08
+ 1863 16fb C5F9EBC1 		vpor	%xmm1, %xmm0, %xmm0
+ 1864 16ff C4E1F97E 		vmovq	%xmm0, %rax
+ 1864      C0
+ 1865 1704 A81F     		testb	$31, %al
+ 1866 1706 0F85F401 		jne	.L290
+ 1866      0000
+ 1867 170c 4C8BBFC0 		movq	192(%rdi), %r15
+ 1867      000000
+ 1868 1713 C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 1869 1717 4531E4   		xorl	%r12d, %r12d
+ 1870 171a 62F1FD48 		vmovdqa64	%zmm0, 128(%rsp)
+ 1870      7F442402 
+ 1871 1722 498D4754 		leaq	84(%r15), %rax
+ 1872 1726 410FB64F 		movzbl	48(%r15), %ecx
+ 1872      30
+ 1873 172b 48894424 		movq	%rax, 48(%rsp)
+ 1873      30
+ 1874 1730 4989C5   		movq	%rax, %r13
+ 1875 1733 31C0     		xorl	%eax, %eax
+ 1876 1735 EB1C     		jmp	.L272
+ 1877 1737 660F1F84 		.p2align 4,,10
+ 1877      00000000 
+ 1877      00
+ 1878              		.p2align 3
+ 1879              	.L295:
+ 1880 1740 4A8954E4 		movq	%rdx, 64(%rsp,%r12,8)
+ 1880      40
+ 1881              	.L271:
+ 1882 1745 4983C401 		addq	$1, %r12
+ 1883 1749 4983C504 		addq	$4, %r13
+ 1884 174d 4983FC08 		cmpq	$8, %r12
+ 1885 1751 7462     		je	.L293
+ 1886              	.L272:
+ 1887 1753 488B9388 		movq	136(%rbx), %rdx
+ 1887      000000
+ 1888 175a 42803C22 		cmpb	$0, (%rdx,%r12)
+ 1888      00
+ 1889 175f 0F85BB01 		jne	.L294
+ 1889      0000
+ 1890 1765 498B5778 		movq	120(%r15), %rdx
+ 1891 1769 84C9     		testb	%cl, %cl
+ 1892 176b 75D3     		jne	.L295
+ 1893 176d 89C1     		movl	%eax, %ecx
+ 1894 176f 4C89ACC4 		movq	%r13, 128(%rsp,%rax,8)
+ 1894      80000000 
+ 1895 1777 448D7001 		leal	1(%rax), %r14d
+ 1896 177b 4C89FF   		movq	%r15, %rdi
+ 1897 177e C1E106   		sall	$6, %ecx
+ 1898 1781 4863C9   		movslq	%ecx, %rcx
+ 1899 1784 488D348A 		leaq	(%rdx,%rcx,4), %rsi
+ 1900 1788 4A8B54E3 		movq	8(%rbx,%r12,8), %rdx
+ 1900      08
+ 1901 178d B9400000 		movl	$64, %ecx
+ 1901      00
+ 1902 1792 4A8974E4 		movq	%rsi, 64(%rsp,%r12,8)
+ 1902      40
+ 1903 1797 C5F877   		vzeroupper
+ 1904 179a E821EEFF 		call	comp_target_block
+ 1904      FF
+ 1905 179f 4983C401 		addq	$1, %r12
+ 1906 17a3 410FB64F 		movzbl	48(%r15), %ecx
+ 1906      30
+ 1907 17a8 4963C6   		movslq	%r14d, %rax
+ 1908 17ab 4983C504 		addq	$4, %r13
+ 1909 17af 4983FC08 		cmpq	$8, %r12
+ 1910 17b3 759E     		jne	.L272
+ 1911              	.L293:
+ 1912 17b5 84C9     		testb	%cl, %cl
+ 1913 17b7 0F84B201 		je	.L273
+ 1913      0000
+ 1914 17bd 488B8B88 		movq	136(%rbx), %rcx
+ 1914      000000
+ 1915 17c4 31D2     		xorl	%edx, %edx
+ 1916 17c6 EB16     		jmp	.L274
+ 1917 17c8 0F1F8400 		.p2align 4,,10
+ 1917      00000000 
+ 1918              		.p2align 3
+ 1919              	.L276:
+ 1920 17d0 4883C201 		addq	$1, %rdx
+ 1921 17d4 4883FA08 		cmpq	$8, %rdx
+ 1922 17d8 0F847401 		je	.L275
+ 1922      0000
+ 1923              	.L274:
+ 1924 17de 803C1100 		cmpb	$0, (%rcx,%rdx)
+ 1925 17e2 75EC     		jne	.L276
+ 1926 17e4 8944243C 		movl	%eax, 60(%rsp)
+ 1927 17e8 498B7F78 		movq	120(%r15), %rdi
+ 1928 17ec 488D7308 		leaq	8(%rbx), %rsi
+ 1929 17f0 B9400000 		movl	$64, %ecx
+ 1929      00
+ 1930 17f5 BA080000 		movl	$8, %edx
+ 1930      00
+ 1931 17fa C5F877   		vzeroupper
+ 1932 17fd E83EEAFF 		call	peak_block
+ 1932      FF
+ 1933 1802 498B7778 		movq	120(%r15), %rsi
+ 1934 1806 B9400000 		movl	$64, %ecx
+ 1934      00
+ 1935 180b 4C89FF   		movq	%r15, %rdi
+ 1936 180e 4889F2   		movq	%rsi, %rdx
+ 1937 1811 E8AAEDFF 		call	comp_target_block
+ 1937      FF
+ 1938 1816 48634424 		movslq	60(%rsp), %rax
+ 1938      3C
+ 1939 181b 488B7424 		movq	48(%rsp), %rsi
+ 1939      30
+ 1940 1820 4889B4C4 		movq	%rsi, 128(%rsp,%rax,8)
+ 1940      80000000 
+ 1941 1828 448D6001 		leal	1(%rax), %r12d
+ 1942              	.L277:
+ 1943 182c 4D8B6F78 		movq	120(%r15), %r13
+ 1944 1830 BA400000 		movl	$64, %edx
+ 1944      00
+ 1945 1835 4589E0   		movl	%r12d, %r8d
+ 1946 1838 4C89FF   		movq	%r15, %rdi
+ 1947 183b 488D8C24 		leaq	128(%rsp), %rcx
+ 1947      80000000 
+ 1948 1843 4C89EE   		movq	%r13, %rsi
+ 1949 1846 E8B5E7FF 		call	comp_smooth
+ 1949      FF
+ 1950 184b 4489E6   		movl	%r12d, %esi
+ 1951 184e 4C89EF   		movq	%r13, %rdi
+ 1952 1851 C1E606   		sall	$6, %esi
+ 1953 1854 E827EBFF 		call	exp2_block
+ 1953      FF
+ 1954 1859 31D2     		xorl	%edx, %edx
+ 1955 185b C5F1EFC9 		vpxor	%xmm1, %xmm1, %xmm1
+ 1956 185f EB2C     		jmp	.L281
+ 1957              		.p2align 4,,10
+ 1958 1861 0F1F8000 		.p2align 3
+ 1958      000000
+ 1959              	.L297:
+ 1960 1868 4883C201 		addq	$1, %rdx
+ 1961 186c 62F17F48 		vmovdqu8	%zmm1, (%rcx)
+ 1961      7F09
+ 1962 1872 62F17F48 		vmovdqu8	%zmm1, 64(%rcx)
+ 1962      7F4901
+ 1963 1879 62F17F48 		vmovdqu8	%zmm1, 128(%rcx)
+ 1963      7F4902
+ 1964 1880 62F17F48 		vmovdqu8	%zmm1, 192(%rcx)
+ 1964      7F4903
+ 1965 1887 4883FA08 		cmpq	$8, %rdx
+ 1966 188b 7458     		je	.L296
+ 1967              	.L281:
+ 1968 188d 488B8388 		movq	136(%rbx), %rax
+ 1968      000000
+ 1969 1894 488BBB90 		movq	144(%rbx), %rdi
+ 1969      000000
+ 1970 189b 488B74D3 		movq	8(%rbx,%rdx,8), %rsi
+ 1970      08
+ 1971 18a0 488B4CD3 		movq	72(%rbx,%rdx,8), %rcx
+ 1971      48
+ 1972 18a5 0FB60410 		movzbl	(%rax,%rdx), %eax
+ 1973 18a9 880417   		movb	%al, (%rdi,%rdx)
+ 1974 18ac 84C0     		testb	%al, %al
+ 1975 18ae 75B8     		jne	.L297
+ 1976 18b0 488B7CD4 		movq	64(%rsp,%rdx,8), %rdi
+ 1976      40
+ 1977 18b5 31C0     		xorl	%eax, %eax
+ 1978 18b7 660F1F84 		.p2align 4,,10
+ 1978      00000000 
+ 1978      00
+ 1979              		.p2align 3
+ 1980              	.L280:
+ 1981 18c0 C5FC101C 		vmovups	(%rdi,%rax), %ymm3
+ 1981      07
+ 1982 18c5 C5E45904 		vmulps	(%rsi,%rax), %ymm3, %ymm0
+ 1982      06
+ 1983 18ca C5FC2904 		vmovaps	%ymm0, (%rcx,%rax)
+ 1983      01
+ 1984 18cf 4883C020 		addq	$32, %rax
+ 1985 18d3 483D0001 		cmpq	$256, %rax
+ 1985      0000
+ 1986 18d9 75E5     		jne	.L280
+ 1987 18db 4883C201 		addq	$1, %rdx
+ 1988 18df 4883FA08 		cmpq	$8, %rdx
+ 1989 18e3 75A8     		jne	.L281
+ 1990              	.L296:
+ 1991 18e5 C5F877   		vzeroupper
+ 1992 18e8 488D65D8 		leaq	-40(%rbp), %rsp
+ 1993 18ec 5B       		popq	%rbx
+ 1994 18ed 415C     		popq	%r12
+ 1995 18ef 415D     		popq	%r13
+ 1996 18f1 415E     		popq	%r14
+ 1997 18f3 415F     		popq	%r15
+ 1998 18f5 5D       		popq	%rbp
+ 1999              		.cfi_remember_state
+ 2000              		.cfi_def_cfa 7, 8
+ 2001 18f6 C3       		ret
+ 2002 18f7 660F1F84 		.p2align 4,,10
+ 2002      00000000 
+ 2002      00
+ 2003              		.p2align 3
+ 2004              	.L290:
+ 2005              		.cfi_restore_state
+ 2006 1900 C5F877   		vzeroupper
+ 2007              	.L267:
+ 2008 1903 488D65D8 		leaq	-40(%rbp), %rsp
+ 2009 1907 4889DF   		movq	%rbx, %rdi
+ 2010 190a 5B       		popq	%rbx
+ 2011 190b 415C     		popq	%r12
+ 2012 190d 415D     		popq	%r13
+ 2013 190f 415E     		popq	%r14
+ 2014 1911 415F     		popq	%r15
+ 2015 1913 5D       		popq	%rbp
+ 2016              		.cfi_remember_state
+ 2017              		.cfi_def_cfa 7, 8
+ 2018 1914 E9000000 		jmp	comp_process@PLT
+ 2018      00
+ 2019 1919 0F1F8000 		.p2align 4,,10
+ 2019      000000
+ 2020              		.p2align 3
+ 2021              	.L294:
+ 2022              		.cfi_restore_state
+ 2023 1920 84C9     		testb	%cl, %cl
+ 2024 1922 0F851DFE 		jne	.L271
+ 2024      FFFF
+ 2025 1928 884C243B 		movb	%cl, 59(%rsp)
+ 2026 192c 4C89EA   		movq	%r13, %rdx
+ 2027 192f BE400000 		movl	$64, %esi
+ 2027      00
+ 2028 1934 4C89FF   		movq	%r15, %rdi
+ 2029 1937 8944243C 		movl	%eax, 60(%rsp)
+ 2030 193b C5F877   		vzeroupper
+ 2031 193e E8EDE7FF 		call	comp_idle
+ 2031      FF
+ 2032 1943 48634424 		movslq	60(%rsp), %rax
+ 2032      3C
+ 2033 1948 0FB64C24 		movzbl	59(%rsp), %ecx
+ 2033      3B
+ 2034 194d E9F3FDFF 		jmp	.L271
+ 2034      FF
+ 2035              	.L275:
+ 2036 1952 8944243C 		movl	%eax, 60(%rsp)
+ 2037 1956 488B5424 		movq	48(%rsp), %rdx
+ 2037      30
+ 2038 195b BE400000 		movl	$64, %esi
+ 2038      00
+ 2039 1960 4C89FF   		movq	%r15, %rdi
+ 2040 1963 C5F877   		vzeroupper
+ 2041 1966 E8C5E7FF 		call	comp_idle
+ 2041      FF
+ 2042 196b 8B44243C 		movl	60(%rsp), %eax
+ 2043              	.L273:
+ 2044 196f 4189C4   		movl	%eax, %r12d
+ 2045 1972 E9B5FEFF 		jmp	.L277
+ 2045      FF
+ 2046              		.cfi_endproc
+ 2047              	.LFE6412:
+ 2049 1977 660F1F84 		.p2align 4
+ 2049      00000000 
+ 2049      00
+ 2051              	comp_process_8_128:
+ 2052              	.LFB6413:
+ 2053              		.cfi_startproc
+ 2054 1980 55       		pushq	%rbp
+ 2055              		.cfi_def_cfa_offset 16
+ 2056              		.cfi_offset 6, -16
+ 2057 1981 4889E5   		movq	%rsp, %rbp
+ 2058              		.cfi_def_cfa_register 6
+ 2059 1984 4157     		pushq	%r15
+ 2060 1986 4156     		pushq	%r14
+ 2061 1988 4155     		pushq	%r13
+ 2062 198a 4154     		pushq	%r12
+ 2063 198c 53       		pushq	%rbx
+ 2064              		.cfi_offset 15, -24
+ 2065              		.cfi_offset 14, -32
+ 2066              		.cfi_offset 13, -40
+ 2067              		.cfi_offset 12, -48
+ 2068              		.cfi_offset 3, -56
+ 2069 198d 4889FB   		movq	%rdi, %rbx
+ 2070 1990 4883E4C0 		andq	$-64, %rsp
+ 2071 1994 4881ECC0 		subq	$192, %rsp
+ 2071      000000
+ 2072 199b 81BFA400 		cmpl	$128, 164(%rdi)
+ 2072      00008000 
+ 2072      0000
+ 2073 19a5 0F851802 		jne	.L299
+ 2073      0000
+ 2074 19ab 62F1FE48 		vmovdqu64	8(%rdi), %zmm2
+ 2074      6F970800 
+ 2074      0000
+ 2075 19b5 62F1ED48 		vporq	72(%rdi), %zmm2, %zmm0
+ 2075      EB874800 
+ 2075      0000
+ 2076 19bf C5FD6FC8 		vmovdqa	%ymm0, %ymm1
+ 2077 19c3 62F3FD48 		vextracti64x4	$0x1, %zmm0, %ymm0
+ 2077      3BC001
+ 2078 19ca C5F5EBC8 		vpor	%ymm0, %ymm1, %ymm1
+ 2079 19ce 62F3FD28 		vextracti64x2	$0x1, %ymm1, %xmm0
+ 2079      39C801
+ 2080 19d5 C5F9EBC1 		vpor	%xmm1, %xmm0, %xmm0
+ 2081 19d9 C5F173D8 		vpsrldq	$8, %xmm0, %xmm1
+ 2081      08
+ 2082 19de C5F9EBC1 		vpor	%xmm1, %xmm0, %xmm0
+ 2083 19e2 C4E1F97E 		vmovq	%xmm0, %rax
+ 2083      C0
+ 2084 19e7 A81F     		testb	$31, %al
+ 2085 19e9 0F85D101 		jne	.L322
+ 2085      0000
+ 2086 19ef 4C8BBFC0 		movq	192(%rdi), %r15
+ 2086      000000
+ 2087 19f6 C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 2088 19fa 4531E4   		xorl	%r12d, %r12d
+ 2089 19fd 62F1FD48 		vmovdqa64	%zmm0, 128(%rsp)
+ 2089      7F442402 
+ 2090 1a05 498D4754 		leaq	84(%r15), %rax
+ 2091 1a09 410FB64F 		movzbl	48(%r15), %ecx
+ 2091      30
+ 2092 1a0e 48894424 		movq	%rax, 48(%rsp)
+ 2092      30
+ 2093 1a13 4989C5   		movq	%rax, %r13
+ 2094 1a16 31C0     		xorl	%eax, %eax
+ 2095 1a18 EB19     		jmp	.L304
+ 2096 1a1a 660F1F44 		.p2align 4,,10
+ 2096      0000
+ 2097              		.p2align 3
+ 2098              	.L327:
+ 2099 1a20 4A8954E4 		movq	%rdx, 64(%rsp,%r12,8)
+ 2099      40
+ 2100              	.L303:
+ 2101 1a25 4983C401 		addq	$1, %r12
+ 2102 1a29 4983C504 		addq	$4, %r13
+ 2103 1a2d 4983FC08 		cmpq	$8, %r12
+ 2104 1a31 7462     		je	.L325
+ 2105              	.L304:
+ 2106 1a33 488B9388 		movq	136(%rbx), %rdx
+ 2106      000000
+ 2107 1a3a 42803C22 		cmpb	$0, (%rdx,%r12)
+ 2107      00
+ 2108 1a3f 0F859B01 		jne	.L326
+ 2108      0000
+ 2109 1a45 498B5778 		movq	120(%r15), %rdx
+ 2110 1a49 84C9     		testb	%cl, %cl
+ 2111 1a4b 75D3     		jne	.L327
+ 2112 1a4d 89C1     		movl	%eax, %ecx
+ 2113 1a4f 4C89ACC4 		movq	%r13, 128(%rsp,%rax,8)
+ 2113      80000000 
+ 2114 1a57 448D7001 		leal	1(%rax), %r14d
+ 2115 1a5b 4C89FF   		movq	%r15, %rdi
+ 2116 1a5e C1E107   		sall	$7, %ecx
+ 2117 1a61 4863C9   		movslq	%ecx, %rcx
+ 2118 1a64 488D348A 		leaq	(%rdx,%rcx,4), %rsi
+ 2119 1a68 4A8B54E3 		movq	8(%rbx,%r12,8), %rdx
+ 2119      08
+ 2120 1a6d B9800000 		movl	$128, %ecx
+ 2120      00
+ 2121 1a72 4A8974E4 		movq	%rsi, 64(%rsp,%r12,8)
+ 2121      40
+ 2122 1a77 C5F877   		vzeroupper
+ 2123 1a7a E841EBFF 		call	comp_target_block
+ 2123      FF
+ 2124 1a7f 4983C401 		addq	$1, %r12
+ 2125 1a83 410FB64F 		movzbl	48(%r15), %ecx
+ 2125      30
+ 2126 1a88 4963C6   		movslq	%r14d, %rax
+ 2127 1a8b 4983C504 		addq	$4, %r13
+ 2128 1a8f 4983FC08 		cmpq	$8, %r12
+ 2129 1a93 759E     		jne	.L304
+ 2130              	.L325:
+ 2131 1a95 84C9     		testb	%cl, %cl
+ 2132 1a97 0F849201 		je	.L305
+ 2132      0000
+ 2133 1a9d 488B8B88 		movq	136(%rbx), %rcx
+ 2133      000000
+ 2134 1aa4 31D2     		xorl	%edx, %edx
+ 2135 1aa6 EB16     		jmp	.L306
+ 2136 1aa8 0F1F8400 		.p2align 4,,10
+ 2136      00000000 
+ 2137              		.p2align 3
+ 2138              	.L308:
+ 2139 1ab0 4883C201 		addq	$1, %rdx
+ 2140 1ab4 4883FA08 		cmpq	$8, %rdx
+ 2141 1ab8 0F845401 		je	.L307
+ 2141      0000
+ 2142              	.L306:
+ 2143 1abe 803C1100 		cmpb	$0, (%rcx,%rdx)
+ 2144 1ac2 75EC     		jne	.L308
+ 2145 1ac4 8944243C 		movl	%eax, 60(%rsp)
+ 2146 1ac8 498B7F78 		movq	120(%r15), %rdi
+ 2147 1acc 488D7308 		leaq	8(%rbx), %rsi
+ 2148 1ad0 B9800000 		movl	$128, %ecx
+ 2148      00
+ 2149 1ad5 BA080000 		movl	$8, %edx
+ 2149      00
+ 2150 1ada C5F877   		vzeroupper
+ 2151 1add E85EE7FF 		call	peak_block
+ 2151      FF
+ 2152 1ae2 498B7778 		movq	120(%r15), %rsi
+ 2153 1ae6 B9800000 		movl	$128, %ecx
+ 2153      00
+ 2154 1aeb 4C89FF   		movq	%r15, %rdi
+ 2155 1aee 4889F2   		movq	%rsi, %rdx
+ 2156 1af1 E8CAEAFF 		call	comp_target_block
+ 2156      FF
+ 2157 1af6 48634424 		movslq	60(%rsp), %rax
+ 2157      3C
+ 2158 1afb 488B7424 		movq	48(%rsp), %rsi
+ 2158      30
+ 2159 1b00 4889B4C4 		movq	%rsi, 128(%rsp,%rax,8)
+ 2159      80000000 
+ 2160 1b08 448D6001 		leal	1(%rax), %r12d
+ 2161              	.L309:
+ 2162 1b0c 4D8B6F78 		movq	120(%r15), %r13
+ 2163 1b10 4589E0   		movl	%r12d, %r8d
+ 2164 1b13 BA800000 		movl	$128, %edx
+ 2164      00
+ 2165 1b18 4C89FF   		movq	%r15, %rdi
+ 2166 1b1b 488D8C24 		leaq	128(%rsp), %rcx
+ 2166      80000000 
+ 2167 1b23 4C89EE   		movq	%r13, %rsi
+ 2168 1b26 E8D5E4FF 		call	comp_smooth
+ 2168      FF
+ 2169 1b2b 4489E6   		movl	%r12d, %esi
+ 2170 1b2e 4C89EF   		movq	%r13, %rdi
+ 2171 1b31 C1E607   		sall	$7, %esi
+ 2172 1b34 E847E8FF 		call	exp2_block
+ 2172      FF
+ 2173 1b39 31F6     		xorl	%esi, %esi
+ 2174 1b3b 31C0     		xorl	%eax, %eax
+ 2175 1b3d EB16     		jmp	.L313
+ 2176 1b3f 90       		.p2align 4,,10
+ 2177              		.p2align 3
+ 2178              	.L329:
+ 2179 1b40 B9400000 		movl	$64, %ecx
+ 2179      00
+ 2180 1b45 4C89C7   		movq	%r8, %rdi
+ 2181 1b48 4883C601 		addq	$1, %rsi
+ 2182 1b4c F348AB   		rep stosq
+ 2183 1b4f 4883FE08 		cmpq	$8, %rsi
+ 2184 1b53 7452     		je	.L328
+ 2185              	.L313:
+ 2186 1b55 488B9388 		movq	136(%rbx), %rdx
+ 2186      000000
+ 2187 1b5c 488BBB90 		movq	144(%rbx), %rdi
+ 2187      000000
+ 2188 1b63 488B4CF3 		movq	8(%rbx,%rsi,8), %rcx
+ 2188      08
+ 2189 1b68 4C8B44F3 		movq	72(%rbx,%rsi,8), %r8
+ 2189      48
+ 2190 1b6d 0FB61432 		movzbl	(%rdx,%rsi), %edx
+ 2191 1b71 881437   		movb	%dl, (%rdi,%rsi)
+ 2192 1b74 84D2     		testb	%dl, %dl
+ 2193 1b76 75C8     		jne	.L329
+ 2194 1b78 488B7CF4 		movq	64(%rsp,%rsi,8), %rdi
+ 2194      40
+ 2195 1b7d 31D2     		xorl	%edx, %edx
+ 2196 1b7f 90       		.p2align 4,,10
+ 2197              		.p2align 3
+ 2198              	.L312:
+ 2199 1b80 C5FC101C 		vmovups	(%rdi,%rdx), %ymm3
+ 2199      17
+ 2200 1b85 C5E45904 		vmulps	(%rcx,%rdx), %ymm3, %ymm0
+ 2200      11
+ 2201 1b8a C4C17C29 		vmovaps	%ymm0, (%r8,%rdx)
+ 2201      0410
+ 2202 1b90 4883C220 		addq	$32, %rdx
+ 2203 1b94 4881FA00 		cmpq	$512, %rdx
+ 2203      020000
+ 2204 1b9b 75E3     		jne	.L312
+ 2205 1b9d 4883C601 		addq	$1, %rsi
+ 2206 1ba1 4883FE08 		cmpq	$8, %rsi
+ 2207 1ba5 75AE     		jne	.L313
+ 2208              	.L328:
+ 2209 1ba7 C5F877   		vzeroupper
+ 2210 1baa 488D65D8 		leaq	-40(%rbp), %rsp
+ 2211 1bae 5B       		popq	%rbx
+ 2212 1baf 415C     		popq	%r12
+ 2213 1bb1 415D     		popq	%r13
+ 2214 1bb3 415E     		popq	%r14
+ 2215 1bb5 415F     		popq	%r15
+ 2216 1bb7 5D       		popq	%rbp
+ 2217              		.cfi_remember_state
+ 2218              		.cfi_def_cfa 7, 8
+ 2219 1bb8 C3       		ret
+ 2220 1bb9 0F1F8000 		.p2align 4,,10
+ 2220      000000
+ 2221              		.p2align 3
+ 2222              	.L322:
+ 2223              		.cfi_restore_state
+ 2224 1bc0 C5F877   		vzeroupper
+ 2225              	.L299:
+ 2226 1bc3 488D65D8 		leaq	-40(%rbp), %rsp
+ 2227 1bc7 4889DF   		movq	%rbx, %rdi
+ 2228 1bca 5B       		popq	%rbx
+ 2229 1bcb 415C     		popq	%r12
+ 2230 1bcd 415D     		popq	%r13
+ 2231 1bcf 415E     		popq	%r14
+ 2232 1bd1 415F     		popq	%r15
+ 2233 1bd3 5D       		popq	%rbp
+ 2234              		.cfi_remember_state
+ 2235              		.cfi_def_cfa 7, 8
+ 2236 1bd4 E9000000 		jmp	comp_process@PLT
+ 2236      00
+ 2237 1bd9 0F1F8000 		.p2align 4,,10
+ 2237      000000
+ 2238              		.p2align 3
+ 2239              	.L326:
+ 2240              		.cfi_restore_state
+ 2241 1be0 84C9     		testb	%cl, %cl
+ 2242 1be2 0F853DFE 		jne	.L303
+ 2242      FFFF
+ 2243 1be8 884C243B 		movb	%cl, 59(%rsp)
+ 2244 1bec 4C89EA   		movq	%r13, %rdx
+ 2245 1bef BE800000 		movl	$128, %esi
+ 2245      00
+ 2246 1bf4 4C89FF   		movq	%r15, %rdi
+ 2247 1bf7 8944243C 		movl	%eax, 60(%rsp)
+ 2248 1bfb C5F877   		vzeroupper
+ 2249 1bfe E82DE5FF 		call	comp_idle
+ 2249      FF
+ 2250 1c03 48634424 		movslq	60(%rsp), %rax
+ 2250      3C
+ 2251 1c08 0FB64C24 		movzbl	59(%rsp), %ecx
+ 2251      3B
+ 2252 1c0d E913FEFF 		jmp	.L303
+ 2252      FF
+ 2253              	.L307:
+ 2254 1c12 8944243C 		movl	%eax, 60(%rsp)
+ 2255 1c16 488B5424 		movq	48(%rsp), %rdx
+ 2255      30
+ 2256 1c1b BE800000 		movl	$128, %esi
+ 2256      00
+ 2257 1c20 4C89FF   		movq	%r15, %rdi
+ 2258 1c23 C5F877   		vzeroupper
+ 2259 1c26 E805E5FF 		call	comp_idle
+ 2259      FF
+ 2260 1c2b 8B44243C 		movl	60(%rsp), %eax
+ 2261              	.L305:
+ 2262 1c2f 4189C4   		movl	%eax, %r12d
+ 2263 1c32 E9D5FEFF 		jmp	.L309
+ 2263      FF
+ 2264              		.cfi_endproc
+ 2265              	.LFE6413:
+ 2267 1c37 660F1F84 		.p2align 4
+ 2267      00000000 
+ 2267      00
+ 2269              	comp_process_8_256:
+ 2270              	.LFB6414:
+ 2271              		.cfi_startproc
+ 2272 1c40 55       		pushq	%rbp
+ 2273              		.cfi_def_cfa_offset 16
+ 2274              		.cfi_offset 6, -16
+ 2275 1c41 4889E5   		movq	%rsp, %rbp
+ 2276              		.cfi_def_cfa_register 6
+ 2277 1c44 4157     		pushq	%r15
+ 2278 1c46 4156     		pushq	%r14
+ 2279 1c48 4155     		pushq	%r13
+ 2280 1c4a 4154     		pushq	%r12
+ 2281 1c4c 53       		pushq	%rbx
+ 2282              		.cfi_offset 15, -24
+ 2283              		.cfi_offset 14, -32
+ 2284              		.cfi_offset 13, -40
+ 2285              		.cfi_offset 12, -48
+ 2286              		.cfi_offset 3, -56
+ 2287 1c4d 4889FB   		movq	%rdi, %rbx
+ 2288 1c50 4883E4C0 		andq	$-64, %rsp
+ 2289 1c54 4881ECC0 		subq	$192, %rsp
+ 2289      000000
+ 2290 1c5b 81BFA400 		cmpl	$256, 164(%rdi)
+ 2290      00000001 
+ 2290      0000
+ 2291 1c65 0F851802 		jne	.L331
+ 2291      0000
+ 2292 1c6b 62F1FE48 		vmovdqu64	8(%rdi), %zmm2
+ 2292      6F970800 
+ 2292      0000
+ 2293 1c75 62F1ED48 		vporq	72(%rdi), %zmm2, %zmm0
+ 2293      EB874800 
+ 2293      0000
+ 2294 1c7f C5FD6FC8 		vmovdqa	%ymm0, %ymm1
+ 2295 1c83 62F3FD48 		vextracti64x4	$0x1, %zmm0, %ymm0
+ 2295      3BC001
+ 2296 1c8a C5F5EBC8 		vpor	%ymm0, %ymm1, %ymm1
+ 2297 1c8e 62F3FD28 		vextracti64x2	$0x1, %ymm1, %xmm0
+ 2297      39C801
+ 2298 1c95 C5F9EBC1 		vpor	%xmm1, %xmm0, %xmm0
+ 2299 1c99 C5F173D8 		vpsrldq	$8, %xmm0, %xmm1
+ 2299      08
+ 2300 1c9e C5F9EBC1 		vpor	%xmm1, %xmm0, %xmm0
+ 2301 1ca2 C4E1F97E 		vmovq	%xmm0, %rax
+ 2301      C0
+ 2302 1ca7 A81F     		testb	$31, %al
+ 2303 1ca9 0F85D101 		jne	.L354
+ 2303      0000
+ 2304 1caf 4C8BBFC0 		movq	192(%rdi), %r15
+ 2304      000000
+ 2305 1cb6 C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 2306 1cba 4531E4   		xorl	%r12d, %r12d
+ 2307 1cbd 62F1FD48 		vmovdqa64	%zmm0, 128(%rsp)
+ 2307      7F442402 
+ 2308 1cc5 498D4754 		leaq	84(%r15), %rax
+ 2309 1cc9 410FB64F 		movzbl	48(%r15), %ecx
+ 2309      30
+ 2310 1cce 48894424 		movq	%rax, 48(%rsp)
+ 2310      30
+ 2311 1cd3 4989C5   		movq	%rax, %r13
+ 2312 1cd6 31C0     		xorl	%eax, %eax
+ 2313 1cd8 EB19     		jmp	.L336
+ 2314 1cda 660F1F44 		.p2align 4,,10
+ 2314      0000
+ 2315              		.p2align 3
+ 2316              	.L359:
+ 2317 1ce0 4A8954E4 		movq	%rdx, 64(%rsp,%r12,8)
+ 2317      40
+ 2318              	.L335:
+ 2319 1ce5 4983C401 		addq	$1, %r12
+ 2320 1ce9 4983C504 		addq	$4, %r13
+ 2321 1ced 4983FC08 		cmpq	$8, %r12
+ 2322 1cf1 7462     		je	.L357
+ 2323              	.L336:
+ 2324 1cf3 488B9388 		movq	136(%rbx), %rdx
+ 2324      000000
+ 2325 1cfa 42803C22 		cmpb	$0, (%rdx,%r12)
+ 2325      00
+ 2326 1cff 0F859B01 		jne	.L358
+ 2326      0000
+ 2327 1d05 498B5778 		movq	120(%r15), %rdx
+ 2328 1d09 84C9     		testb	%cl, %cl
+ 2329 1d0b 75D3     		jne	.L359
+ 2330 1d0d 89C1     		movl	%eax, %ecx
+ 2331 1d0f 4C89ACC4 		movq	%r13, 128(%rsp,%rax,8)
+ 2331      80000000 
+ 2332 1d17 448D7001 		leal	1(%rax), %r14d
+ 2333 1d1b 4C89FF   		movq	%r15, %rdi
+ 2334 1d1e C1E108   		sall	$8, %ecx
+ 2335 1d21 4863C9   		movslq	%ecx, %rcx
+ 2336 1d24 488D348A 		leaq	(%rdx,%rcx,4), %rsi
+ 2337 1d28 4A8B54E3 		movq	8(%rbx,%r12,8), %rdx
+ 2337      08
+ 2338 1d2d B9000100 		movl	$256, %ecx
+ 2338      00
+ 2339 1d32 4A8974E4 		movq	%rsi, 64(%rsp,%r12,8)
+ 2339      40
+ 2340 1d37 C5F877   		vzeroupper
+ 2341 1d3a E881E8FF 		call	comp_target_block
+ 2341      FF
+ 2342 1d3f 4983C401 		addq	$1, %r12
+ 2343 1d43 410FB64F 		movzbl	48(%r15), %ecx
+ 2343      30
+ 2344 1d48 4963C6   		movslq	%r14d, %rax
+ 2345 1d4b 4983C504 		addq	$4, %r13
+ 2346 1d4f 4983FC08 		cmpq	$8, %r12
+ 2347 1d53 759E     		jne	.L336
+ 2348              	.L357:
+ 2349 1d55 84C9     		testb	%cl, %cl
+ 2350 1d57 0F849201 		je	.L337
+ 2350      0000
+ 2351 1d5d 488B8B88 		movq	136(%rbx), %rcx
+ 2351      000000
+ 2352 1d64 31D2     		xorl	%edx, %edx
+ 2353 1d66 EB16     		jmp	.L338
+ 2354 1d68 0F1F8400 		.p2align 4,,10
+ 2354      00000000 
+ 2355              		.p2align 3
+ 2356              	.L340:
+ 2357 1d70 4883C201 		addq	$1, %rdx
+ 2358 1d74 4883FA08 		cmpq	$8, %rdx
+ 2359 1d78 0F845401 		je	.L339
+ 2359      0000
+ 2360              	.L338:
+ 2361 1d7e 803C1100 		cmpb	$0, (%rcx,%rdx)
+ 2362 1d82 75EC     		jne	.L340
+ 2363 1d84 8944243C 		movl	%eax, 60(%rsp)
+ 2364 1d88 498B7F78 		movq	120(%r15), %rdi
+ 2365 1d8c 488D7308 		leaq	8(%rbx), %rsi
+ 2366 1d90 B9000100 		movl	$256, %ecx
+ 2366      00
+ 2367 1d95 BA080000 		movl	$8, %edx
+ 2367      00
+ 2368 1d9a C5F877   		vzeroupper
+ 2369 1d9d E89EE4FF 		call	peak_block
+ 2369      FF
+ 2370 1da2 498B7778 		movq	120(%r15), %rsi
+ 2371 1da6 B9000100 		movl	$256, %ecx
+ 2371      00
+ 2372 1dab 4C89FF   		movq	%r15, %rdi
+ 2373 1dae 4889F2   		movq	%rsi, %rdx
+ 2374 1db1 E80AE8FF 		call	comp_target_block
+ 2374      FF
+ 2375 1db6 48634424 		movslq	60(%rsp), %rax
+ 2375      3C
+ 2376 1dbb 488B7424 		movq	48(%rsp), %rsi
+ 2376      30
+ 2377 1dc0 4889B4C4 		movq	%rsi, 128(%rsp,%rax,8)
+ 2377      80000000 
+ 2378 1dc8 448D6001 		leal	1(%rax), %r12d
+ 2379              	.L341:
+ 2380 1dcc 4D8B6F78 		movq	120(%r15), %r13
+ 2381 1dd0 4589E0   		movl	%r12d, %r8d
+ 2382 1dd3 BA000100 		movl	$256, %edx
+ 2382      00
+ 2383 1dd8 4C89FF   		movq	%r15, %rdi
+ 2384 1ddb 488D8C24 		leaq	128(%rsp), %rcx
+ 2384      80000000 
+ 2385 1de3 4C89EE   		movq	%r13, %rsi
+ 2386 1de6 E815E2FF 		call	comp_smooth
+ 2386      FF
+ 2387 1deb 4489E6   		movl	%r12d, %esi
+ 2388 1dee 4C89EF   		movq	%r13, %rdi
+ 2389 1df1 C1E608   		sall	$8, %esi
+ 2390 1df4 E887E5FF 		call	exp2_block
+ 2390      FF
+ 2391 1df9 31F6     		xorl	%esi, %esi
+ 2392 1dfb 31C0     		xorl	%eax, %eax
+ 2393 1dfd EB16     		jmp	.L345
+ 2394 1dff 90       		.p2align 4,,10
+ 2395              		.p2align 3
+ 2396              	.L361:
+ 2397 1e00 B9800000 		movl	$128, %ecx
+ 2397      00
+ 2398 1e05 4C89C7   		movq	%r8, %rdi
+ 2399 1e08 4883C601 		addq	$1, %rsi
+ 2400 1e0c F348AB   		rep stosq
+ 2401 1e0f 4883FE08 		cmpq	$8, %rsi
+ 2402 1e13 7452     		je	.L360
+ 2403              	.L345:
+ 2404 1e15 488B9388 		movq	136(%rbx), %rdx
+ 2404      000000
+ 2405 1e1c 488BBB90 		movq	144(%rbx), %rdi
+ 2405      000000
+ 2406 1e23 488B4CF3 		movq	8(%rbx,%rsi,8), %rcx
+ 2406      08
+ 2407 1e28 4C8B44F3 		movq	72(%rbx,%rsi,8), %r8
+ 2407      48
+ 2408 1e2d 0FB61432 		movzbl	(%rdx,%rsi), %edx
+ 2409 1e31 881437   		movb	%dl, (%rdi,%rsi)
+ 2410 1e34 84D2     		testb	%dl, %dl
+ 2411 1e36 75C8     		jne	.L361
+ 2412 1e38 488B7CF4 		movq	64(%rsp,%rsi,8), %rdi
+ 2412      40
+ 2413 1e3d 31D2     		xorl	%edx, %edx
+ 2414 1e3f 90       		.p2align 4,,10
+ 2415              		.p2align 3
+ 2416              	.L344:
+ 2417 1e40 C5FC101C 		vmovups	(%rdi,%rdx), %ymm3
+ 2417      17
+ 2418 1e45 C5E45904 		vmulps	(%rcx,%rdx), %ymm3, %ymm0
+ 2418      11
+ 2419 1e4a C4C17C29 		vmovaps	%ymm0, (%r8,%rdx)
+ 2419      0410
+ 2420 1e50 4883C220 		addq	$32, %rdx
+ 2421 1e54 4881FA00 		cmpq	$1024, %rdx
+ 2421      040000
+ 2422 1e5b 75E3     		jne	.L344
+ 2423 1e5d 4883C601 		addq	$1, %rsi
+ 2424 1e61 4883FE08 		cmpq	$8, %rsi
+ 2425 1e65 75AE     		jne	.L345
+ 2426              	.L360:
+ 2427 1e67 C5F877   		vzeroupper
+ 2428 1e6a 488D65D8 		leaq	-40(%rbp), %rsp
+ 2429 1e6e 5B       		popq	%rbx
+ 2430 1e6f 415C     		popq	%r12
+ 2431 1e71 415D     		popq	%r13
+ 2432 1e73 415E     		popq	%r14
+ 2433 1e75 415F     		popq	%r15
+ 2434 1e77 5D       		popq	%rbp
+ 2435              		.cfi_remember_state
+ 2436              		.cfi_def_cfa 7, 8
+ 2437 1e78 C3       		ret
+ 2438 1e79 0F1F8000 		.p2align 4,,10
+ 2438      000000
+ 2439              		.p2align 3
+ 2440              	.L354:
+ 2441              		.cfi_restore_state
+ 2442 1e80 C5F877   		vzeroupper
+ 2443              	.L331:
+ 2444 1e83 488D65D8 		leaq	-40(%rbp), %rsp
+ 2445 1e87 4889DF   		movq	%rbx, %rdi
+ 2446 1e8a 5B       		popq	%rbx
+ 2447 1e8b 415C     		popq	%r12
+ 2448 1e8d 415D     		popq	%r13
+ 2449 1e8f 415E     		popq	%r14
+ 2450 1e91 415F     		popq	%r15
+ 2451 1e93 5D       		popq	%rbp
+ 2452              		.cfi_remember_state
+ 2453              		.cfi_def_cfa 7, 8
+ 2454 1e94 E9000000 		jmp	comp_process@PLT
+ 2454      00
+ 2455 1e99 0F1F8000 		.p2align 4,,10
+ 2455      000000
+ 2456              		.p2align 3
+ 2457              	.L358:
+ 2458              		.cfi_restore_state
+ 2459 1ea0 84C9     		testb	%cl, %cl
+ 2460 1ea2 0F853DFE 		jne	.L335
+ 2460      FFFF
+ 2461 1ea8 884C243B 		movb	%cl, 59(%rsp)
+ 2462 1eac 4C89EA   		movq	%r13, %rdx
+ 2463 1eaf BE000100 		movl	$256, %esi
+ 2463      00
+ 2464 1eb4 4C89FF   		movq	%r15, %rdi
+ 2465 1eb7 8944243C 		movl	%eax, 60(%rsp)
+ 2466 1ebb C5F877   		vzeroupper
+ 2467 1ebe E86DE2FF 		call	comp_idle
+ 2467      FF
+ 2468 1ec3 48634424 		movslq	60(%rsp), %rax
+ 2468      3C
+ 2469 1ec8 0FB64C24 		movzbl	59(%rsp), %ecx
+ 2469      3B
+ 2470 1ecd E913FEFF 		jmp	.L335
+ 2470      FF
+ 2471              	.L339:
+ 2472 1ed2 8944243C 		movl	%eax, 60(%rsp)
+ 2473 1ed6 488B5424 		movq	48(%rsp), %rdx
+ 2473      30
+ 2474 1edb BE000100 		movl	$256, %esi
+ 2474      00
+ 2475 1ee0 4C89FF   		movq	%r15, %rdi
+ 2476 1ee3 C5F877   		vzeroupper
+ 2477 1ee6 E845E2FF 		call	comp_idle
+ 2477      FF
+ 2478 1eeb 8B44243C 		movl	60(%rsp), %eax
+ 2479              	.L337:
+ 2480 1eef 4189C4   		movl	%eax, %r12d
+ 2481 1ef2 E9D5FEFF 		jmp	.L341
+ 2481      FF
+ 2482              		.cfi_endproc
+ 2483              	.LFE6414:
+ 2485              		.section	.rodata.str1.1,"aMS",@progbits,1
+ 2486              	.LC54:
+ 2487 0000 7400     		.string	"t"
+ 2488              	.LC55:
+ 2489 0002 726100   		.string	"ra"
+ 2490              	.LC56:
+ 2491 0005 6B00     		.string	"k"
+ 2492              	.LC57:
+ 2493 0007 6100     		.string	"a"
+ 2494              	.LC58:
+ 2495 0009 7200     		.string	"r"
+ 2496              	.LC59:
+ 2497 000b 6700     		.string	"g"
+ 2498              	.LC60:
+ 2499 000d 6C00     		.string	"l"
+ 2500              	.LC63:
+ 2501 000f 25732073 		.string	"%s subopts: %s\n"
+ 2501      75626F70 
+ 2501      74733A20 
+ 2501      25730A00 
+ 2502              		.section	.rodata.str1.8
+ 2503 0031 00000000 		.align 8
+ 2503      000000
+ 2504              	.LC64:
+ 2505 0038 25733A20 		.string	"%s: Missing value for suboption '%s'\n"
+ 2505      4D697373 
+ 2505      696E6720 
+ 2505      76616C75 
+ 2505      6520666F 
+ 2506 005e 0000     		.align 8
+ 2507              	.LC65:
+ 2508 0060 25733A20 		.string	"%s: No match found for token: /%s/\n"
+ 2508      4E6F206D 
+ 2508      61746368 
+ 2508      20666F75 
+ 2508      6E642066 
+ 2509 0084 00000000 		.align 8
+ 2510              	.LC66:
+ 2511 0088 25733A20 		.string	"%s: The ratio must be positive, knee, attack and release not negative\n"
+ 2511      54686520 
+ 2511      72617469 
+ 2511      6F206D75 
+ 2511      73742062 
+ 2512 00cf 00       		.align 8
+ 2513              	.LC67:
+ 2514 00d0 25733A20 		.string	"%s: threshold=%g, ratio=%g, knee=%g, attack=%g, release=%g, makeup=%g, link=%d\n"
+ 2514      74687265 
+ 2514      73686F6C 
+ 2514      643D2567 
+ 2514      2C207261 
+ 2515              		.text
+ 2516 1ef7 660F1F84 		.p2align 4
+ 2516      00000000 
+ 2516      00
+ 2517              		.globl	create_comp
+ 2519              	create_comp:
+ 2520              	.LFB6420:
+ 2521              		.cfi_startproc
+ 2522 1f00 4C8D5424 		leaq	8(%rsp), %r10
+ 2522      08
+ 2523              		.cfi_def_cfa 10, 0
+ 2524 1f05 4883E4E0 		andq	$-32, %rsp
+ 2525 1f09 488D1500 		leaq	.LC56(%rip), %rdx
+ 2525      000000
+ 2526 1f10 41FF72F8 		pushq	-8(%r10)
+ 2527 1f14 488D0500 		leaq	.LC57(%rip), %rax
+ 2527      000000
+ 2528 1f1b 55       		pushq	%rbp
+ 2529 1f1c 4889E5   		movq	%rsp, %rbp
+ 2530              		.cfi_escape 0x10,0x6,0x2,0x76,0
+ 2531 1f1f 4157     		pushq	%r15
+ 2532 1f21 4156     		pushq	%r14
+ 2533              		.cfi_escape 0x10,0xf,0x2,0x76,0x78
+ 2534              		.cfi_escape 0x10,0xe,0x2,0x76,0x70
+ 2535 1f23 4C8D7D88 		leaq	-120(%rbp), %r15
+ 2536 1f27 4C8D7590 		leaq	-112(%rbp), %r14
+ 2537 1f2b 4155     		pushq	%r13
+ 2538              		.cfi_escape 0x10,0xd,0x2,0x76,0x68
+ 2539 1f2d 4C8D2D00 		leaq	.L370(%rip), %r13
+ 2539      000000
+ 2540 1f34 4154     		pushq	%r12
+ 2541              		.cfi_escape 0x10,0xc,0x2,0x76,0x60
+ 2542 1f36 4989F4   		movq	%rsi, %r12
+ 2543 1f39 BE800000 		movl	$128, %esi
+ 2543      00
+ 2544 1f3e 4152     		pushq	%r10
+ 2545              		.cfi_escape 0xf,0x3,0x76,0x58,0x6
+ 2546 1f40 53       		pushq	%rbx
+ 2547 1f41 4883C480 		addq	$-128, %rsp
+ 2548              		.cfi_escape 0x10,0x3,0x2,0x76,0x50
+ 2549 1f45 4889BD78 		movq	%rdi, -136(%rbp)
+ 2549      FFFFFF
+ 2550 1f4c C5FA7E35 		vmovq	destroy_comp@GOTPCREL(%rip), %xmm6
+ 2550      00000000 
+ 2551 1f54 BF010000 		movl	$1, %edi
+ 2551      00
+ 2552 1f59 C4E3C922 		vpinsrq	$1, clone_comp@GOTPCREL(%rip), %xmm6, %xmm0
+ 2552      05000000 
+ 2552      0001
+ 2553 1f63 48C745C8 		movq	$0, -56(%rbp)
+ 2553      00000000 
+ 2554 1f6b C5FA7E3D 		vmovq	comp_process@GOTPCREL(%rip), %xmm7
+ 2554      00000000 
+ 2555 1f73 C4E3C122 		vpinsrq	$1, comp_init@GOTPCREL(%rip), %xmm7, %xmm1
+ 2555      0D000000 
+ 2555      0001
+ 2556 1f7d C4E37538 		vinserti128	$0x1, %xmm0, %ymm1, %ymm5
+ 2556      E801
+ 2557 1f83 C4E1F96E 		vmovq	%rdx, %xmm1
+ 2557      CA
+ 2558 1f88 488D1500 		leaq	.LC54(%rip), %rdx
+ 2558      000000
+ 2559 1f8f C4E3F122 		vpinsrq	$1, %rax, %xmm1, %xmm1
+ 2559      C801
+ 2560 1f95 C4E1F96E 		vmovq	%rdx, %xmm0
+ 2560      C2
+ 2561 1f9a 488D0500 		leaq	.LC55(%rip), %rax
+ 2561      000000
+ 2562 1fa1 C5FD7FAD 		vmovdqa	%ymm5, -176(%rbp)
+ 2562      50FFFFFF 
+ 2563 1fa9 C4E3F922 		vpinsrq	$1, %rax, %xmm0, %xmm0
+ 2563      C001
+ 2564 1faf 488D1500 		leaq	.LC58(%rip), %rdx
+ 2564      000000
+ 2565 1fb6 488D0500 		leaq	.LC59(%rip), %rax
+ 2565      000000
+ 2566 1fbd C4E37D38 		vinserti128	$0x1, %xmm1, %ymm0, %ymm0
+ 2566      C101
+ 2567 1fc3 C5FD7F45 		vmovdqa	%ymm0, -112(%rbp)
+ 2567      90
+ 2568 1fc8 C4E1F96E 		vmovq	%rdx, %xmm0
+ 2568      C2
+ 2569 1fcd C4E3F922 		vpinsrq	$1, %rax, %xmm0, %xmm0
+ 2569      C001
+ 2570 1fd3 488D0500 		leaq	.LC60(%rip), %rax
+ 2570      000000
+ 2571 1fda 488945C0 		movq	%rax, -64(%rbp)
+ 2572 1fde C5F97F45 		vmovdqa	%xmm0, -80(%rbp)
+ 2572      B0
+ 2573 1fe3 C5F877   		vzeroupper
+ 2574 1fe6 E8000000 		call	calloc@PLT
+ 2574      00
+ 2575 1feb 488D1500 		leaq	__func__.0(%rip), %rdx
+ 2575      000000
+ 2576 1ff2 C5FD2805 		vmovapd	.LC61(%rip), %ymm0
+ 2576      00000000 
+ 2577 1ffa 4889C3   		movq	%rax, %rbx
+ 2578 1ffd 488B8578 		movq	-136(%rbp), %rax
+ 2578      FFFFFF
+ 2579 2004 488D3500 		leaq	.LC63(%rip), %rsi
+ 2579      000000
+ 2580 200b BF010000 		movl	$1, %edi
+ 2580      00
+ 2581 2010 C5FD1103 		vmovupd	%ymm0, (%rbx)
+ 2582 2014 488998C0 		movq	%rbx, 192(%rax)
+ 2582      000000
+ 2583 201b 488B0500 		movq	.LC62(%rip), %rax
+ 2583      000000
+ 2584 2022 498B0C24 		movq	(%r12), %rcx
+ 2585 2026 48894320 		movq	%rax, 32(%rbx)
+ 2586 202a 31C0     		xorl	%eax, %eax
+ 2587 202c C5F877   		vzeroupper
+ 2588 202f E8000000 		call	debugprint@PLT
+ 2588      00
+ 2589 2034 498B0424 		movq	(%r12), %rax
+ 2590 2038 803800   		cmpb	$0, (%rax)
+ 2591 203b 745C     		je	.L378
+ 2592 203d 0F1F00   		.p2align 4,,10
+ 2593              		.p2align 3
+ 2594              	.L363:
+ 2595 2040 4C89FA   		movq	%r15, %rdx
+ 2596 2043 4C89F6   		movq	%r14, %rsi
+ 2597 2046 4C89E7   		movq	%r12, %rdi
+ 2598 2049 E8000000 		call	getsubopt@PLT
+ 2598      00
+ 2599 204e 85C0     		testl	%eax, %eax
+ 2600 2050 7810     		js	.L366
+ 2601 2052 83F806   		cmpl	$6, %eax
+ 2602 2055 740B     		je	.L366
+ 2603 2057 48837D88 		cmpq	$0, -120(%rbp)
+ 2603      00
+ 2604 205c 0F84C601 		je	.L393
+ 2604      0000
+ 2605              	.L366:
+ 2606 2062 83F806   		cmpl	$6, %eax
+ 2607 2065 0F870A01 		ja	.L368
+ 2607      0000
+ 2608 206b 89C0     		movl	%eax, %eax
+ 2609 206d 49634485 		movslq	0(%r13,%rax,4), %rax
+ 2609      00
+ 2610 2072 4C01E8   		addq	%r13, %rax
+ 2611 2075 FFE0     		jmp	*%rax
+ 2612              		.section	.rodata
+ 2613              		.align 4
+ 2614              		.align 4
+ 2615              	.L370:
+ 2616 0000 00000000 		.long	.L376-.L370
+ 2617 0004 00000000 		.long	.L375-.L370
+ 2618 0008 00000000 		.long	.L374-.L370
+ 2619 000c 00000000 		.long	.L373-.L370
+ 2620 0010 00000000 		.long	.L372-.L370
+ 2621 0014 00000000 		.long	.L371-.L370
+ 2622 0018 00000000 		.long	.L369-.L370
+ 2623              		.text
+ 2624 2077 660F1F84 		.p2align 4,,10
+ 2624      00000000 
+ 2624      00
+ 2625              		.p2align 3
+ 2626              	.L371:
+ 2627 2080 488B7D88 		movq	-120(%rbp), %rdi
+ 2628 2084 31F6     		xorl	%esi, %esi
+ 2629 2086 E8000000 		call	strtod@PLT
+ 2629      00
+ 2630 208b C5FB1143 		vmovsd	%xmm0, 40(%rbx)
+ 2630      28
+ 2631              		.p2align 4,,10
+ 2632              		.p2align 3
+ 2633              	.L377:
+ 2634 2090 498B0424 		movq	(%r12), %rax
+ 2635 2094 803800   		cmpb	$0, (%rax)
+ 2636 2097 75A7     		jne	.L363
+ 2637              	.L378:
+ 2638 2099 C5FB104B 		vmovsd	8(%rbx), %xmm1
+ 2638      08
+ 2639 209e C5F957C0 		vxorpd	%xmm0, %xmm0, %xmm0
+ 2640 20a2 C5F92FC1 		vcomisd	%xmm1, %xmm0
+ 2641 20a6 7328     		jnb	.L364
+ 2642 20a8 C5FB1053 		vmovsd	16(%rbx), %xmm2
+ 2642      10
+ 2643 20ad C5F92FC2 		vcomisd	%xmm2, %xmm0
+ 2644 20b1 771D     		ja	.L364
+ 2645 20b3 C5FB105B 		vmovsd	24(%rbx), %xmm3
+ 2645      18
+ 2646 20b8 C5F92FC3 		vcomisd	%xmm3, %xmm0
+ 2647 20bc 7712     		ja	.L364
+ 2648 20be C5FB1063 		vmovsd	32(%rbx), %xmm4
+ 2648      20
+ 2649 20c3 4531E4   		xorl	%r12d, %r12d
+ 2650 20c6 C5F92FC4 		vcomisd	%xmm4, %xmm0
+ 2651 20ca 0F86DA00 		jbe	.L379
+ 2651      0000
+ 2652              		.p2align 4,,10
+ 2653              		.p2align 3
+ 2654              	.L364:
+ 2655 20d0 488D1500 		leaq	__func__.0(%rip), %rdx
+ 2655      000000
+ 2656 20d7 488D3500 		leaq	.LC66(%rip), %rsi
+ 2656      000000
+ 2657 20de 31FF     		xorl	%edi, %edi
+ 2658 20e0 31C0     		xorl	%eax, %eax
+ 2659 20e2 E8000000 		call	debugprint@PLT
+ 2659      00
+ 2660 20e7 E9A40000 		jmp	.L367
+ 2660      00
+ 2661 20ec 0F1F4000 		.p2align 4,,10
+ 2662              		.p2align 3
+ 2663              	.L372:
+ 2664 20f0 488B7D88 		movq	-120(%rbp), %rdi
+ 2665 20f4 31F6     		xorl	%esi, %esi
+ 2666 20f6 E8000000 		call	strtod@PLT
+ 2666      00
+ 2667 20fb C5FB1143 		vmovsd	%xmm0, 32(%rbx)
+ 2667      20
+ 2668 2100 EB8E     		jmp	.L377
+ 2669              		.p2align 4,,10
+ 2670 2102 660F1F44 		.p2align 3
+ 2670      0000
+ 2671              	.L376:
+ 2672 2108 488B7D88 		movq	-120(%rbp), %rdi
+ 2673 210c 31F6     		xorl	%esi, %esi
+ 2674 210e E8000000 		call	strtod@PLT
+ 2674      00
+ 2675 2113 C5FB1103 		vmovsd	%xmm0, (%rbx)
+ 2676 2117 E974FFFF 		jmp	.L377
+ 2676      FF
+ 2677 211c 0F1F4000 		.p2align 4,,10
+ 2678              		.p2align 3
+ 2679              	.L369:
+ 2680 2120 C6433001 		movb	$1, 48(%rbx)
+ 2681 2124 E967FFFF 		jmp	.L377
+ 2681      FF
+ 2682 2129 0F1F8000 		.p2align 4,,10
+ 2682      000000
+ 2683              		.p2align 3
+ 2684              	.L374:
+ 2685 2130 488B7D88 		movq	-120(%rbp), %rdi
+ 2686 2134 31F6     		xorl	%esi, %esi
+ 2687 2136 E8000000 		call	strtod@PLT
+ 2687      00
+ 2688 213b C5FB1143 		vmovsd	%xmm0, 16(%rbx)
+ 2688      10
+ 2689 2140 E94BFFFF 		jmp	.L377
+ 2689      FF
+ 2690              		.p2align 4,,10
+ 2691 2145 0F1F00   		.p2align 3
+ 2692              	.L375:
+ 2693 2148 488B7D88 		movq	-120(%rbp), %rdi
+ 2694 214c 31F6     		xorl	%esi, %esi
+ 2695 214e E8000000 		call	strtod@PLT
+ 2695      00
+ 2696 2153 C5FB1143 		vmovsd	%xmm0, 8(%rbx)
+ 2696      08
+ 2697 2158 E933FFFF 		jmp	.L377
+ 2697      FF
+ 2698 215d 0F1F00   		.p2align 4,,10
+ 2699              		.p2align 3
+ 2700              	.L373:
+ 2701 2160 488B7D88 		movq	-120(%rbp), %rdi
+ 2702 2164 31F6     		xorl	%esi, %esi
+ 2703 2166 E8000000 		call	strtod@PLT
+ 2703      00
+ 2704 216b C5FB1143 		vmovsd	%xmm0, 24(%rbx)
+ 2704      18
+ 2705 2170 E91BFFFF 		jmp	.L377
+ 2705      FF
+ 2706              	.L368:
+ 2707 2175 488B4D88 		movq	-120(%rbp), %rcx
+ 2708 2179 488D1500 		leaq	__func__.0(%rip), %rdx
+ 2708      000000
+ 2709 2180 31FF     		xorl	%edi, %edi
+ 2710 2182 31C0     		xorl	%eax, %eax
+ 2711 2184 488D3500 		leaq	.LC65(%rip), %rsi
+ 2711      000000
+ 2712 218b E8000000 		call	debugprint@PLT
+ 2712      00
+ 2713              	.L367:
+ 2714 2190 C5FB1063 		vmovsd	32(%rbx), %xmm4
+ 2714      20
+ 2715 2195 C5FB105B 		vmovsd	24(%rbx), %xmm3
+ 2715      18
+ 2716 219a 41BC0100 		movl	$1, %r12d
+ 2716      0000
+ 2717 21a0 C5FB1053 		vmovsd	16(%rbx), %xmm2
+ 2717      10
+ 2718 21a5 C5FB104B 		vmovsd	8(%rbx), %xmm1
+ 2718      08
+ 2719              	.L379:
+ 2720 21aa 0FB64B30 		movzbl	48(%rbx), %ecx
+ 2721 21ae C5FB1003 		vmovsd	(%rbx), %xmm0
+ 2722 21b2 B8060000 		movl	$6, %eax
+ 2722      00
+ 2723 21b7 488D1500 		leaq	__func__.0(%rip), %rdx
+ 2723      000000
+ 2724 21be C5FB106B 		vmovsd	40(%rbx), %xmm5
+ 2724      28
+ 2725 21c3 488D3500 		leaq	.LC67(%rip), %rsi
+ 2725      000000
+ 2726 21ca BF010000 		movl	$1, %edi
+ 2726      00
+ 2727 21cf E8000000 		call	debugprint@PLT
+ 2727      00
+ 2728 21d4 488B8D78 		movq	-136(%rbp), %rcx
+ 2728      FFFFFF
+ 2729 21db 488D0500 		leaq	comp_process_kernels(%rip), %rax
+ 2729      000000
+ 2730 21e2 C5FD6FB5 		vmovdqa	-176(%rbp), %ymm6
+ 2730      50FFFFFF 
+ 2731 21ea 488981C8 		movq	%rax, 200(%rcx)
+ 2731      000000
+ 2732 21f1 488B0500 		movq	comp_preroll@GOTPCREL(%rip), %rax
+ 2732      000000
+ 2733 21f8 C5FE7FB1 		vmovdqu	%ymm6, 208(%rcx)
+ 2733      D0000000 
+ 2734 2200 488981F0 		movq	%rax, 240(%rcx)
+ 2734      000000
+ 2735 2207 4489E0   		movl	%r12d, %eax
+ 2736 220a C5F877   		vzeroupper
+ 2737 220d 4883EC80 		subq	$-128, %rsp
+ 2738 2211 5B       		popq	%rbx
+ 2739 2212 415A     		popq	%r10
+ 2740              		.cfi_remember_state
+ 2741              		.cfi_def_cfa 10, 0
+ 2742 2214 415C     		popq	%r12
+ 2743 2216 415D     		popq	%r13
+ 2744 2218 415E     		popq	%r14
+ 2745 221a 415F     		popq	%r15
+ 2746 221c 5D       		popq	%rbp
+ 2747 221d 498D62F8 		leaq	-8(%r10), %rsp
+ 2748              		.cfi_def_cfa 7, 8
+ 2749 2221 C3       		ret
+ 2750              		.p2align 4,,10
+ 2751 2222 660F1F44 		.p2align 3
+ 2751      0000
+ 2752              	.L393:
+ 2753              		.cfi_restore_state
+ 2754 2228 4898     		cltq
+ 2755 222a 488D1500 		leaq	__func__.0(%rip), %rdx
+ 2755      000000
+ 2756 2231 488D3500 		leaq	.LC64(%rip), %rsi
+ 2756      000000
+ 2757 2238 31FF     		xorl	%edi, %edi
+ 2758 223a 488B4CC5 		movq	-112(%rbp,%rax,8), %rcx
+ 2758      90
+ 2759 223f 31C0     		xorl	%eax, %eax
+ 2760 2241 E8000000 		call	debugprint@PLT
+ 2760      00
+ 2761 2246 E945FFFF 		jmp	.L367
+ 2761      FF
+ 2762              		.cfi_endproc
+ 2763              	.LFE6420:
+ 2765              		.section	.rodata.str1.1
+ 2766              	.LC68:
+ 2767 001f 2020436F 		.string	"  Compressor options\n"
+ 2767      6D707265 
+ 2767      73736F72 
+ 2767      206F7074 
+ 2767      696F6E73 
+ 2768              	.LC69:
+ 2769 0035 20202020 		.string	"    Name: comp\n"
+ 2769      4E616D65 
+ 2769      3A20636F 
+ 2769      6D700A00 
+ 2770              		.section	.rodata.str1.8
+ 2771              		.align 8
+ 2772              	.LC71:
+ 2773 0120 20202020 		.string	"        t = threshold (dBFS, default %g)\n"
+ 2773      20202020 
+ 2773      74203D20 
+ 2773      74687265 
+ 2773      73686F6C 
+ 2774 014a 00000000 		.align 8
+ 2774      0000
+ 2775              	.LC72:
+ 2776 0150 20202020 		.string	"        ra = ratio, above 1 compresses above the threshold, below 1 expands below it (def
+ 2776      20202020 
+ 2776      7261203D 
+ 2776      20726174 
+ 2776      696F2C20 
+ 2777 01b3 00000000 		.align 8
+ 2777      00
+ 2778              	.LC74:
+ 2779 01b8 20202020 		.string	"        k = knee width (dB, default %g)\n"
+ 2779      20202020 
+ 2779      6B203D20 
+ 2779      6B6E6565 
+ 2779      20776964 
+ 2780 01e1 00000000 		.align 8
+ 2780      000000
+ 2781              	.LC76:
+ 2782 01e8 20202020 		.string	"        a = attack time (seconds, default %g)\n"
+ 2782      20202020 
+ 2782      61203D20 
+ 2782      61747461 
+ 2782      636B2074 
+ 2783 0217 00       		.align 8
+ 2784              	.LC77:
+ 2785 0218 20202020 		.string	"        r = release time (seconds, default %g)\n"
+ 2785      20202020 
+ 2785      72203D20 
+ 2785      72656C65 
+ 2785      61736520 
+ 2786              		.section	.rodata.str1.1
+ 2787              	.LC78:
+ 2788 0045 20202020 		.string	"        g = makeup gain (dB)\n"
+ 2788      20202020 
+ 2788      67203D20 
+ 2788      6D616B65 
+ 2788      75702067 
+ 2789              		.section	.rodata.str1.8
+ 2790              		.align 8
+ 2791              	.LC79:
+ 2792 0248 20202020 		.string	"        l = link all channels, they get the gain of the loudest one\n"
+ 2792      20202020 
+ 2792      6C203D20 
+ 2792      6C696E6B 
+ 2792      20616C6C 
+ 2793 028d 000000   		.align 8
+ 2794              	.LC80:
+ 2795 0290 20202020 		.string	"    Example: -p comp,t=-24,ra=3,k=6,a=0.002,r=0.15,g=6,l\n"
+ 2795      4578616D 
+ 2795      706C653A 
+ 2795      202D7020 
+ 2795      636F6D70 
+ 2796              		.text
+ 2797 224b 0F1F4400 		.p2align 4
+ 2797      00
+ 2798              		.globl	help_comp
+ 2800              	help_comp:
+ 2801              	.LFB6421:
+ 2802              		.cfi_startproc
+ 2803 2250 4883EC08 		subq	$8, %rsp
+ 2804              		.cfi_def_cfa_offset 16
+ 2805 2254 488D3500 		leaq	.LC68(%rip), %rsi
+ 2805      000000
+ 2806 225b 31FF     		xorl	%edi, %edi
+ 2807 225d 31C0     		xorl	%eax, %eax
+ 2808 225f E8000000 		call	debugprint@PLT
+ 2808      00
+ 2809 2264 488D3500 		leaq	.LC69(%rip), %rsi
+ 2809      000000
+ 2810 226b 31FF     		xorl	%edi, %edi
+ 2811 226d 31C0     		xorl	%eax, %eax
+ 2812 226f E8000000 		call	debugprint@PLT
+ 2812      00
+ 2813 2274 488D3500 		leaq	.LC71(%rip), %rsi
+ 2813      000000
+ 2814 227b 31FF     		xorl	%edi, %edi
+ 2815 227d C5FB1005 		vmovsd	.LC70(%rip), %xmm0
+ 2815      00000000 
+ 2816 2285 B8010000 		movl	$1, %eax
+ 2816      00
+ 2817 228a E8000000 		call	debugprint@PLT
+ 2817      00
+ 2818 228f 488D3500 		leaq	.LC72(%rip), %rsi
+ 2818      000000
+ 2819 2296 31FF     		xorl	%edi, %edi
+ 2820 2298 C5FB1005 		vmovsd	.LC51(%rip), %xmm0
+ 2820      00000000 
+ 2821 22a0 B8010000 		movl	$1, %eax
+ 2821      00
+ 2822 22a5 E8000000 		call	debugprint@PLT
+ 2822      00
+ 2823 22aa 488D3500 		leaq	.LC74(%rip), %rsi
+ 2823      000000
+ 2824 22b1 31FF     		xorl	%edi, %edi
+ 2825 22b3 C5FB1005 		vmovsd	.LC73(%rip), %xmm0
+ 2825      00000000 
+ 2826 22bb B8010000 		movl	$1, %eax
+ 2826      00
+ 2827 22c0 E8000000 		call	debugprint@PLT
+ 2827      00
+ 2828 22c5 488D3500 		leaq	.LC76(%rip), %rsi
+ 2828      000000
+ 2829 22cc 31FF     		xorl	%edi, %edi
+ 2830 22ce C5FB1005 		vmovsd	.LC75(%rip), %xmm0
+ 2830      00000000 
+ 2831 22d6 B8010000 		movl	$1, %eax
+ 2831      00
+ 2832 22db E8000000 		call	debugprint@PLT
+ 2832      00
+ 2833 22e0 488D3500 		leaq	.LC77(%rip), %rsi
+ 2833      000000
+ 2834 22e7 31FF     		xorl	%edi, %edi
+ 2835 22e9 C5FB1005 		vmovsd	.LC62(%rip), %xmm0
+ 2835      00000000 
+ 2836 22f1 B8010000 		movl	$1, %eax
+ 2836      00
+ 2837 22f6 E8000000 		call	debugprint@PLT
+ 2837      00
+ 2838 22fb 488D3500 		leaq	.LC78(%rip), %rsi
+ 2838      000000
+ 2839 2302 31FF     		xorl	%edi, %edi
+ 2840 2304 31C0     		xorl	%eax, %eax
+ 2841 2306 E8000000 		call	debugprint@PLT
+ 2841      00
+ 2842 230b 488D3500 		leaq	.LC79(%rip), %rsi
+ 2842      000000
+ 2843 2312 31FF     		xorl	%edi, %edi
+ 2844 2314 31C0     		xorl	%eax, %eax
+ 2845 2316 E8000000 		call	debugprint@PLT
+ 2845      00
+ 2846 231b 488D3500 		leaq	.LC80(%rip), %rsi
+ 2846      000000
+ 2847 2322 31FF     		xorl	%edi, %edi
+ 2848 2324 31C0     		xorl	%eax, %eax
+ 2849 2326 4883C408 		addq	$8, %rsp
+ 2850              		.cfi_def_cfa_offset 8
+ 2851 232a E9000000 		jmp	debugprint@PLT
+ 2851      00
+ 2852              		.cfi_endproc
+ 2853              	.LFE6421:
+ 2855              		.section	.rodata
+ 2856 001c 00000000 		.align 8
+ 2859              	__func__.0:
+ 2860 0020 63726561 		.string	"create_comp"
+ 2860      74655F63 
+ 2860      6F6D7000 
+ 2861              		.section	.data.rel.ro,"aw"
+ 2862              		.align 32
+ 2865              	comp_process_kernels:
+ 2866 0000 02000000 		.long	2
+ 2867 0004 40000000 		.long	64
+ 2868 0008 00000000 		.quad	comp_process_2_64
+ 2868      00000000 
+ 2869 0010 02000000 		.long	2
+ 2870 0014 80000000 		.long	128
+ 2871 0018 00000000 		.quad	comp_process_2_128
+ 2871      00000000 
+ 2872 0020 02000000 		.long	2
+ 2873 0024 00010000 		.long	256
+ 2874 0028 00000000 		.quad	comp_process_2_256
+ 2874      00000000 
+ 2875 0030 08000000 		.long	8
+ 2876 0034 40000000 		.long	64
+ 2877 0038 00000000 		.quad	comp_process_8_64
+ 2877      00000000 
+ 2878 0040 08000000 		.long	8
+ 2879 0044 80000000 		.long	128
+ 2880 0048 00000000 		.quad	comp_process_8_128
+ 2880      00000000 
+ 2881 0050 08000000 		.long	8
+ 2882 0054 00010000 		.long	256
+ 2883 0058 00000000 		.quad	comp_process_8_256
+ 2883      00000000 
+ 2884 0060 00000000 		.long	0
+ 2885 0064 00000000 		.long	0
+ 2886 0068 00000000 		.quad	comp_process
+ 2886      00000000 
+ 2887              		.section	.rodata.cst16,"aM",@progbits,16
+ 2888              		.align 16
+ 2889              	.LC0:
+ 2890 0000 FFFFFF7F 		.long	2147483647
+ 2891 0004 00000000 		.long	0
+ 2892 0008 00000000 		.long	0
+ 2893 000c 00000000 		.long	0
+ 2894              		.section	.rodata.cst4,"aM",@progbits,4
+ 2895              		.align 4
+ 2896              	.LC1:
+ 2897 0000 BD378635 		.long	897988541
+ 2898              		.align 4
+ 2899              	.LC2:
+ 2900 0004 89E004C2 		.long	-1039867767
+ 2901              		.set	.LC5,.LC0
+ 2902              		.align 4
+ 2903              	.LC7:
+ 2904 0008 0000FCC2 		.long	-1023672320
+ 2905              		.align 4
+ 2906              	.LC9:
+ 2907 000c 0000FE42 		.long	1123942400
+ 2908              		.align 4
+ 2909              	.LC12:
+ 2910 0010 767BEA3A 		.long	988445558
+ 2911              		.align 4
+ 2912              	.LC14:
+ 2913 0014 C895163C 		.long	1008113096
+ 2914              		.align 4
+ 2915              	.LC16:
+ 2916 0018 C004643D 		.long	1029964992
+ 2917              		.align 4
+ 2918              	.LC18:
+ 2919 001c AEF7753E 		.long	1047918510
+ 2920              		.align 4
+ 2921              	.LC20:
+ 2922 0020 2572313F 		.long	1060205093
+ 2923              		.align 4
+ 2924              	.LC22:
+ 2925 0024 0000803F 		.long	1065353216
+ 2926              		.align 4
+ 2927              	.LC24:
+ 2928 0028 FFE6DB2E 		.long	786163455
+ 2929              		.align 4
+ 2930              	.LC27:
+ 2931 002c FFFF7F00 		.long	8388607
+ 2932              		.align 4
+ 2933              	.LC30:
+ 2934 0030 F1E1313D 		.long	1026679281
+ 2935              		.align 4
+ 2936              	.LC32:
+ 2937 0034 1D4ACFBE 		.long	-1093711331
+ 2938              		.align 4
+ 2939              	.LC34:
+ 2940 0038 6904CC3F 		.long	1070335081
+ 2941              		.align 4
+ 2942              	.LC36:
+ 2943 003c 90845FC0 		.long	-1067481968
+ 2944              		.align 4
+ 2945              	.LC38:
+ 2946 0040 D27FA140 		.long	1084325842
+ 2947              		.align 4
+ 2948              	.LC40:
+ 2949 0044 065B32C0 		.long	-1070441722
+ 2950              		.align 4
+ 2951              	.LC41:
+ 2952 0048 1D4ACF3E 		.long	1053772317
+ 2953              		.align 4
+ 2954              	.LC42:
+ 2955 004c 90845F40 		.long	1080001680
+ 2956              		.align 4
+ 2957              	.LC43:
+ 2958 0050 065B3240 		.long	1077041926
+ 2959              		.section	.rodata.cst8,"aM",@progbits,8
+ 2960              		.align 8
+ 2961              	.LC45:
+ 2962 0000 00000000 		.long	0
+ 2963 0004 0000F03F 		.long	1072693248
+ 2964              		.align 8
+ 2965              	.LC46:
+ 2966 0008 00000000 		.long	0
+ 2967 000c 0000F0BF 		.long	-1074790400
+ 2968              		.align 8
+ 2969              	.LC47:
+ 2970 0010 00000000 		.long	0
+ 2971 0014 00004E40 		.long	1078853632
+ 2972              		.section	.rodata.cst4
+ 2973              		.align 4
+ 2974              	.LC48:
+ 2975 0054 000080BF 		.long	-1082130432
+ 2976              		.section	.rodata.cst8
+ 2977              		.align 8
+ 2978              	.LC49:
+ 2979 0018 7E58C724 		.long	617044094
+ 2980 001c 18151840 		.long	1075320088
+ 2981              		.align 8
+ 2982              	.LC50:
+ 2983 0020 00000000 		.long	0
+ 2984 0024 0000E03F 		.long	1071644672
+ 2985              		.set	.LC51,.LC61+8
+ 2986              		.section	.rodata.cst32,"aM",@progbits,32
+ 2987              		.align 32
+ 2988              	.LC61:
+ 2989 0000 00000000 		.long	0
+ 2990 0004 000034C0 		.long	-1070333952
+ 2991 0008 00000000 		.long	0
+ 2992 000c 00001040 		.long	1074790400
+ 2993 0010 00000000 		.long	0
+ 2994 0014 00001840 		.long	1075314688
+ 2995 0018 7B14AE47 		.long	1202590843
+ 2996 001c E17A743F 		.long	1064598241
+ 2997              		.section	.rodata.cst8
+ 2998              		.align 8
+ 2999              	.LC62:
+ 3000 0028 9A999999 		.long	-1717986918
+ 3001 002c 9999B93F 		.long	1069128089
+ 3002              		.set	.LC70,.LC61
+ 3003              		.set	.LC73,.LC61+16
+ 3004              		.set	.LC75,.LC61+24
+ 3005              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 3006              		.section	.note.GNU-stack,"",@progbits
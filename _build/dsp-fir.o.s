@@ -0,0 +1,3343 @@
+   1              		.file	"dsp-fir.c"
+   2              		.text
+   3              		.p2align 4
+   4              		.globl	fir_preroll
+   6              	fir_preroll:
+   7              	.LFB6411:
+   8              		.cfi_startproc
+   9 0000 488B87C0 		movq	192(%rdi), %rax
+   9      000000
+  10 0007 8B4040   		movl	64(%rax), %eax
+  11 000a 83E801   		subl	$1, %eax
+  12 000d C3       		ret
+  13              		.cfi_endproc
+  14              	.LFE6411:
+  16 000e 6690     		.p2align 4
+  17              		.globl	fir_init
+  19              	fir_init:
+  20              	.LFB6408:
+  21              		.cfi_startproc
+  22 0010 55       		pushq	%rbp
+  23              		.cfi_def_cfa_offset 16
+  24              		.cfi_offset 6, -16
+  25 0011 4889E5   		movq	%rsp, %rbp
+  26              		.cfi_def_cfa_register 6
+  27 0014 4154     		pushq	%r12
+  28              		.cfi_offset 12, -24
+  29 0016 4989FC   		movq	%rdi, %r12
+  30 0019 53       		pushq	%rbx
+  31              		.cfi_offset 3, -32
+  32 001a 488B9FC0 		movq	192(%rdi), %rbx
+  32      000000
+  33 0021 488B7B08 		movq	8(%rbx), %rdi
+  34 0025 E8000000 		call	free@PLT
+  34      00
+  35 002a 418BBC24 		movl	156(%r12), %edi
+  35      9C000000 
+  36 0032 0FAF7B40 		imull	64(%rbx), %edi
+  37 0036 48C1E702 		salq	$2, %rdi
+  38 003a E8000000 		call	valloc@PLT
+  38      00
+  39 003f 418B9424 		movl	156(%r12), %edx
+  39      9C000000 
+  40 0047 31F6     		xorl	%esi, %esi
+  41 0049 0FAF5340 		imull	64(%rbx), %edx
+  42 004d 48894308 		movq	%rax, 8(%rbx)
+  43 0051 4889C7   		movq	%rax, %rdi
+  44 0054 48C1E202 		salq	$2, %rdx
+  45 0058 E8000000 		call	memset@PLT
+  45      00
+  46 005d C7434400 		movl	$0, 68(%rbx)
+  46      000000
+  47 0064 C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+  48 0068 62F17F28 		vmovdqu8	%ymm0, 72(%rbx)
+  48      7F834800 
+  48      0000
+  49 0072 C5F877   		vzeroupper
+  50 0075 5B       		popq	%rbx
+  51 0076 415C     		popq	%r12
+  52 0078 5D       		popq	%rbp
+  53              		.cfi_def_cfa 7, 8
+  54 0079 C3       		ret
+  55              		.cfi_endproc
+  56              	.LFE6408:
+  58              		.section	.rodata.str1.8,"aMS",@progbits,1
+  59              		.align 8
+  60              	.LC1:
+  61 0000 73746174 		.string	"static const float s%d_h[%u] = {\n"
+  61      69632063 
+  61      6F6E7374 
+  61      20666C6F 
+  61      61742073 
+  62              		.section	.rodata.str1.1,"aMS",@progbits,1
+  63              	.LC2:
+  64 0000 20202020 		.string	"    %af,\n"
+  64      2561662C 
+  64      0A00
+  65              	.LC3:
+  66 000a 7D3B0A00 		.string	"};\n"
+  67              		.section	.rodata.str1.8
+  68 0022 00000000 		.align 8
+  68      0000
+  69              	.LC4:
+  70 0028 73746174 		.string	"static float s%d_z[NCHANNELS][%u];\n"
+  70      69632066 
+  70      6C6F6174 
+  70      20732564 
+  70      5F7A5B4E 
+  71              		.section	.rodata.str1.1
+  72              	.LC5:
+  73 000e 73746174 		.string	"static int s%d_pos;\n"
+  73      69632069 
+  73      6E742073 
+  73      25645F70 
+  73      6F733B0A 
+  74              	.LC6:
+  75 0023 20202020 		.string	"        int s%d_p = s%d_pos;\n"
+  75      20202020 
+  75      696E7420 
+  75      7325645F 
+  75      70203D20 
+  76              	.LC7:
+  77 0041 20202020 		.string	"            {\n"
+  77      20202020 
+  77      20202020 
+  77      7B0A00
+  78              		.section	.rodata.str1.8
+  79 004c 00000000 		.align 8
+  80              	.LC8:
+  81 0050 20202020 		.string	"                float * restrict z = &s%d_z[c][s%d_p];\n"
+  81      20202020 
+  81      20202020 
+  81      20202020 
+  81      666C6F61 
+  82              		.align 8
+  83              	.LC9:
+  84 0088 20202020 		.string	"                float acc = 0.0f;\n"
+  84      20202020 
+  84      20202020 
+  84      20202020 
+  84      666C6F61 
+  85 00ab 00000000 		.align 8
+  85      00
+  86              	.LC10:
+  87 00b0 20202020 		.string	"                z[0] = z[%u] = x;\n"
+  87      20202020 
+  87      20202020 
+  87      20202020 
+  87      7A5B305D 
+  88 00d3 00000000 		.align 8
+  88      00
+  89              	.LC11:
+  90 00d8 20202020 		.string	"                for (int i = 0; i < %u; i++)\n"
+  90      20202020 
+  90      20202020 
+  90      20202020 
+  90      666F7220 
+  91 0106 0000     		.align 8
+  92              	.LC12:
+  93 0108 20202020 		.string	"                    acc += s%d_h[i] * z[i];\n"
+  93      20202020 
+  93      20202020 
+  93      20202020 
+  93      20202020 
+  94              		.section	.rodata.str1.1
+  95              	.LC13:
+  96 0050 20202020 		.string	"                x = acc;\n"
+  96      20202020 
+  96      20202020 
+  96      20202020 
+  96      78203D20 
+  97              		.section	.rodata.str1.8
+  98 0135 000000   		.align 8
+  99              	.LC14:
+ 100 0138 20202020 		.string	"                s%d_p = s%d_p ? s%d_p - 1 : %u;\n"
+ 100      20202020 
+ 100      20202020 
+ 100      20202020 
+ 100      7325645F 
+ 101              		.section	.rodata.str1.1
+ 102              	.LC15:
+ 103 006a 20202020 		.string	"            }\n"
+ 103      20202020 
+ 103      20202020 
+ 103      7D0A00
+ 104              		.section	.rodata.str1.8
+ 105 0169 00000000 		.align 8
+ 105      000000
+ 106              	.LC16:
+ 107 0170 20202020 		.string	"        if (c == NCHANNELS - 1) s%d_pos = s%d_p;\n"
+ 107      20202020 
+ 107      69662028 
+ 107      63203D3D 
+ 107      204E4348 
+ 108 01a2 00000000 		.align 8
+ 108      0000
+ 109              	.LC17:
+ 110 01a8 20202020 		.string	"    memset(s%d_z, 0, sizeof(s%d_z));\n"
+ 110      6D656D73 
+ 110      65742873 
+ 110      25645F7A 
+ 110      2C20302C 
+ 111              		.section	.rodata.str1.1
+ 112              	.LC18:
+ 113 0079 20202020 		.string	"    s%d_pos = 0;\n"
+ 113      7325645F 
+ 113      706F7320 
+ 113      3D20303B 
+ 113      0A00
+ 114              		.text
+ 115 007a 660F1F44 		.p2align 4
+ 115      0000
+ 116              		.globl	fir_codegen
+ 118              	fir_codegen:
+ 119              	.LFB6409:
+ 120              		.cfi_startproc
+ 121 0080 4157     		pushq	%r15
+ 122              		.cfi_def_cfa_offset 16
+ 123              		.cfi_offset 15, -16
+ 124 0082 4156     		pushq	%r14
+ 125              		.cfi_def_cfa_offset 24
+ 126              		.cfi_offset 14, -24
+ 127 0084 4155     		pushq	%r13
+ 128              		.cfi_def_cfa_offset 32
+ 129              		.cfi_offset 13, -32
+ 130 0086 4154     		pushq	%r12
+ 131              		.cfi_def_cfa_offset 40
+ 132              		.cfi_offset 12, -40
+ 133 0088 4189CC   		movl	%ecx, %r12d
+ 134 008b 55       		pushq	%rbp
+ 135              		.cfi_def_cfa_offset 48
+ 136              		.cfi_offset 6, -48
+ 137 008c 4889F5   		movq	%rsi, %rbp
+ 138 008f 89D6     		movl	%edx, %esi
+ 139 0091 53       		pushq	%rbx
+ 140              		.cfi_def_cfa_offset 56
+ 141              		.cfi_offset 3, -56
+ 142 0092 4883EC08 		subq	$8, %rsp
+ 143              		.cfi_def_cfa_offset 64
+ 144 0096 4C8BAFC0 		movq	192(%rdi), %r13
+ 144      000000
+ 145 009d 418B5540 		movl	64(%r13), %edx
+ 146 00a1 498B4510 		movq	16(%r13), %rax
+ 147 00a5 4889D3   		movq	%rdx, %rbx
+ 148 00a8 4C8D3490 		leaq	(%rax,%rdx,4), %r14
+ 149 00ac 83FA01   		cmpl	$1, %edx
+ 150 00af 7623     		jbe	.L6
+ 151 00b1 4C89F0   		movq	%r14, %rax
+ 152 00b4 C5F857C0 		vxorps	%xmm0, %xmm0, %xmm0
+ 153 00b8 EB12     		jmp	.L7
+ 154 00ba 660F1F44 		.p2align 4,,10
+ 154      0000
+ 155              		.p2align 3
+ 156              	.L9:
+ 157 00c0 83EB01   		subl	$1, %ebx
+ 158 00c3 4883C004 		addq	$4, %rax
+ 159 00c7 83FB01   		cmpl	$1, %ebx
+ 160 00ca 7454     		je	.L8
+ 161              	.L7:
+ 162 00cc C5F82E00 		vucomiss	(%rax), %xmm0
+ 163 00d0 7A02     		jp	.L6
+ 164 00d2 74EC     		je	.L9
+ 165              	.L6:
+ 166 00d4 83FE04   		cmpl	$4, %esi
+ 167 00d7 772E     		ja	.L24
+ 168 00d9 488D1500 		leaq	.L13(%rip), %rdx
+ 168      000000
+ 169 00e0 486304B2 		movslq	(%rdx,%rsi,4), %rax
+ 170 00e4 4801D0   		addq	%rdx, %rax
+ 171 00e7 FFE0     		jmp	*%rax
+ 172              		.section	.rodata
+ 173              		.align 4
+ 174              		.align 4
+ 175              	.L13:
+ 176 0000 00000000 		.long	.L17-.L13
+ 177 0004 00000000 		.long	.L16-.L13
+ 178 0008 00000000 		.long	.L15-.L13
+ 179 000c 00000000 		.long	.L14-.L13
+ 180 0010 00000000 		.long	.L12-.L13
+ 181              		.text
+ 182 00e9 0F1F8000 		.p2align 4,,10
+ 182      000000
+ 183              		.p2align 3
+ 184              	.L14:
+ 185 00f0 4489E1   		movl	%r12d, %ecx
+ 186 00f3 4489E2   		movl	%r12d, %edx
+ 187 00f6 488D3500 		leaq	.LC16(%rip), %rsi
+ 187      000000
+ 188 00fd 4889EF   		movq	%rbp, %rdi
+ 189 0100 31C0     		xorl	%eax, %eax
+ 190 0102 E8000000 		call	fprintf@PLT
+ 190      00
+ 191              	.L24:
+ 192 0107 4883C408 		addq	$8, %rsp
+ 193              		.cfi_remember_state
+ 194              		.cfi_def_cfa_offset 56
+ 195 010b 31C0     		xorl	%eax, %eax
+ 196 010d 5B       		popq	%rbx
+ 197              		.cfi_def_cfa_offset 48
+ 198 010e 5D       		popq	%rbp
+ 199              		.cfi_def_cfa_offset 40
+ 200 010f 415C     		popq	%r12
+ 201              		.cfi_def_cfa_offset 32
+ 202 0111 415D     		popq	%r13
+ 203              		.cfi_def_cfa_offset 24
+ 204 0113 415E     		popq	%r14
+ 205              		.cfi_def_cfa_offset 16
+ 206 0115 415F     		popq	%r15
+ 207              		.cfi_def_cfa_offset 8
+ 208 0117 C3       		ret
+ 209 0118 0F1F8400 		.p2align 4,,10
+ 209      00000000 
+ 210              		.p2align 3
+ 211              	.L8:
+ 212              		.cfi_restore_state
+ 213 0120 83FE04   		cmpl	$4, %esi
+ 214 0123 77E2     		ja	.L24
+ 215 0125 488D1500 		leaq	.L22(%rip), %rdx
+ 215      000000
+ 216 012c 486304B2 		movslq	(%rdx,%rsi,4), %rax
+ 217 0130 4801D0   		addq	%rdx, %rax
+ 218 0133 FFE0     		jmp	*%rax
+ 219              		.section	.rodata
+ 220              		.align 4
+ 221              		.align 4
+ 222              	.L22:
+ 223 0014 00000000 		.long	.L20-.L22
+ 224 0018 00000000 		.long	.L16-.L22
+ 225 001c 00000000 		.long	.L15-.L22
+ 226 0020 00000000 		.long	.L14-.L22
+ 227 0024 00000000 		.long	.L12-.L22
+ 228              		.text
+ 229              		.p2align 4,,10
+ 230 0135 0F1F00   		.p2align 3
+ 231              	.L12:
+ 232 0138 4489E2   		movl	%r12d, %edx
+ 233 013b 4889EF   		movq	%rbp, %rdi
+ 234 013e 4489E1   		movl	%r12d, %ecx
+ 235 0141 31C0     		xorl	%eax, %eax
+ 236 0143 488D3500 		leaq	.LC17(%rip), %rsi
+ 236      000000
+ 237 014a E8000000 		call	fprintf@PLT
+ 237      00
+ 238 014f 4489E2   		movl	%r12d, %edx
+ 239 0152 4889EF   		movq	%rbp, %rdi
+ 240 0155 31C0     		xorl	%eax, %eax
+ 241 0157 488D3500 		leaq	.LC18(%rip), %rsi
+ 241      000000
+ 242 015e E8000000 		call	fprintf@PLT
+ 242      00
+ 243 0163 EBA2     		jmp	.L24
+ 244              		.p2align 4,,10
+ 245 0165 0F1F00   		.p2align 3
+ 246              	.L16:
+ 247 0168 4489E1   		movl	%r12d, %ecx
+ 248 016b 4489E2   		movl	%r12d, %edx
+ 249 016e 488D3500 		leaq	.LC6(%rip), %rsi
+ 249      000000
+ 250 0175 4889EF   		movq	%rbp, %rdi
+ 251 0178 31C0     		xorl	%eax, %eax
+ 252 017a E8000000 		call	fprintf@PLT
+ 252      00
+ 253 017f EB86     		jmp	.L24
+ 254              		.p2align 4,,10
+ 255 0181 0F1F8000 		.p2align 3
+ 255      000000
+ 256              	.L15:
+ 257 0188 4889E9   		movq	%rbp, %rcx
+ 258 018b BA0E0000 		movl	$14, %edx
+ 258      00
+ 259 0190 BE010000 		movl	$1, %esi
+ 259      00
+ 260 0195 488D3D00 		leaq	.LC7(%rip), %rdi
+ 260      000000
+ 261 019c E8000000 		call	fwrite@PLT
+ 261      00
+ 262 01a1 4489E1   		movl	%r12d, %ecx
+ 263 01a4 4489E2   		movl	%r12d, %edx
+ 264 01a7 4889EF   		movq	%rbp, %rdi
+ 265 01aa 488D3500 		leaq	.LC8(%rip), %rsi
+ 265      000000
+ 266 01b1 31C0     		xorl	%eax, %eax
+ 267 01b3 E8000000 		call	fprintf@PLT
+ 267      00
+ 268 01b8 4889E9   		movq	%rbp, %rcx
+ 269 01bb BA220000 		movl	$34, %edx
+ 269      00
+ 270 01c0 BE010000 		movl	$1, %esi
+ 270      00
+ 271 01c5 488D3D00 		leaq	.LC9(%rip), %rdi
+ 271      000000
+ 272 01cc E8000000 		call	fwrite@PLT
+ 272      00
+ 273 01d1 89DA     		movl	%ebx, %edx
+ 274 01d3 4889EF   		movq	%rbp, %rdi
+ 275 01d6 31C0     		xorl	%eax, %eax
+ 276 01d8 488D3500 		leaq	.LC10(%rip), %rsi
+ 276      000000
+ 277 01df E8000000 		call	fprintf@PLT
+ 277      00
+ 278 01e4 89DA     		movl	%ebx, %edx
+ 279 01e6 4889EF   		movq	%rbp, %rdi
+ 280 01e9 31C0     		xorl	%eax, %eax
+ 281 01eb 488D3500 		leaq	.LC11(%rip), %rsi
+ 281      000000
+ 282 01f2 E8000000 		call	fprintf@PLT
+ 282      00
+ 283 01f7 4489E2   		movl	%r12d, %edx
+ 284 01fa 4889EF   		movq	%rbp, %rdi
+ 285 01fd 31C0     		xorl	%eax, %eax
+ 286 01ff 488D3500 		leaq	.LC12(%rip), %rsi
+ 286      000000
+ 287 0206 E8000000 		call	fprintf@PLT
+ 287      00
+ 288 020b 4889E9   		movq	%rbp, %rcx
+ 289 020e BA190000 		movl	$25, %edx
+ 289      00
+ 290 0213 BE010000 		movl	$1, %esi
+ 290      00
+ 291 0218 488D3D00 		leaq	.LC13(%rip), %rdi
+ 291      000000
+ 292 021f E8000000 		call	fwrite@PLT
+ 292      00
+ 293 0224 4489E1   		movl	%r12d, %ecx
+ 294 0227 4489E2   		movl	%r12d, %edx
+ 295 022a 4889EF   		movq	%rbp, %rdi
+ 296 022d 448D4BFF 		leal	-1(%rbx), %r9d
+ 297 0231 4589E0   		movl	%r12d, %r8d
+ 298 0234 488D3500 		leaq	.LC14(%rip), %rsi
+ 298      000000
+ 299 023b 31C0     		xorl	%eax, %eax
+ 300 023d E8000000 		call	fprintf@PLT
+ 300      00
+ 301 0242 4889E9   		movq	%rbp, %rcx
+ 302 0245 BA0E0000 		movl	$14, %edx
+ 302      00
+ 303 024a BE010000 		movl	$1, %esi
+ 303      00
+ 304 024f 488D3D00 		leaq	.LC15(%rip), %rdi
+ 304      000000
+ 305 0256 E8000000 		call	fwrite@PLT
+ 305      00
+ 306 025b E9A7FEFF 		jmp	.L24
+ 306      FF
+ 307              		.p2align 4,,10
+ 308              		.p2align 3
+ 309              	.L17:
+ 310 0260 31C0     		xorl	%eax, %eax
+ 311 0262 89D9     		movl	%ebx, %ecx
+ 312 0264 4489E2   		movl	%r12d, %edx
+ 313 0267 4889EF   		movq	%rbp, %rdi
+ 314 026a 488D3500 		leaq	.LC1(%rip), %rsi
+ 314      000000
+ 315 0271 E8000000 		call	fprintf@PLT
+ 315      00
+ 316 0276 85DB     		testl	%ebx, %ebx
+ 317 0278 7436     		je	.L18
+ 318              	.L21:
+ 319 027a 4531FF   		xorl	%r15d, %r15d
+ 320 027d 0F1F00   		.p2align 4,,10
+ 321              		.p2align 3
+ 322              	.L19:
+ 323 0280 4489F8   		movl	%r15d, %eax
+ 324 0283 C5F157C9 		vxorpd	%xmm1, %xmm1, %xmm1
+ 325 0287 4889EF   		movq	%rbp, %rdi
+ 326 028a 4183C701 		addl	$1, %r15d
+ 327 028e F7D0     		notl	%eax
+ 328 0290 41034540 		addl	64(%r13), %eax
+ 329 0294 488D3500 		leaq	.LC2(%rip), %rsi
+ 329      000000
+ 330 029b C4C1725A 		vcvtss2sd	(%r14,%rax,4), %xmm1, %xmm0
+ 330      0486
+ 331 02a1 B8010000 		movl	$1, %eax
+ 331      00
+ 332 02a6 E8000000 		call	fprintf@PLT
+ 332      00
+ 333 02ab 4139DF   		cmpl	%ebx, %r15d
+ 334 02ae 75D0     		jne	.L19
+ 335              	.L18:
+ 336 02b0 4889E9   		movq	%rbp, %rcx
+ 337 02b3 BA030000 		movl	$3, %edx
+ 337      00
+ 338 02b8 BE010000 		movl	$1, %esi
+ 338      00
+ 339 02bd 488D3D00 		leaq	.LC3(%rip), %rdi
+ 339      000000
+ 340 02c4 E8000000 		call	fwrite@PLT
+ 340      00
+ 341 02c9 4489E2   		movl	%r12d, %edx
+ 342 02cc 4889EF   		movq	%rbp, %rdi
+ 343 02cf 8D0C1B   		leal	(%rbx,%rbx), %ecx
+ 344 02d2 488D3500 		leaq	.LC4(%rip), %rsi
+ 344      000000
+ 345 02d9 31C0     		xorl	%eax, %eax
+ 346 02db E8000000 		call	fprintf@PLT
+ 346      00
+ 347 02e0 4489E2   		movl	%r12d, %edx
+ 348 02e3 4889EF   		movq	%rbp, %rdi
+ 349 02e6 31C0     		xorl	%eax, %eax
+ 350 02e8 488D3500 		leaq	.LC5(%rip), %rsi
+ 350      000000
+ 351 02ef E8000000 		call	fprintf@PLT
+ 351      00
+ 352 02f4 E90EFEFF 		jmp	.L24
+ 352      FF
+ 353              	.L20:
+ 354 02f9 B9010000 		movl	$1, %ecx
+ 354      00
+ 355 02fe 4489E2   		movl	%r12d, %edx
+ 356 0301 4889EF   		movq	%rbp, %rdi
+ 357 0304 31C0     		xorl	%eax, %eax
+ 358 0306 488D3500 		leaq	.LC1(%rip), %rsi
+ 358      000000
+ 359 030d E8000000 		call	fprintf@PLT
+ 359      00
+ 360 0312 E963FFFF 		jmp	.L21
+ 360      FF
+ 361              		.cfi_endproc
+ 362              	.LFE6409:
+ 364 0317 660F1F84 		.p2align 4
+ 364      00000000 
+ 364      00
+ 365              		.globl	destroy_fir
+ 367              	destroy_fir:
+ 368              	.LFB6410:
+ 369              		.cfi_startproc
+ 370 0320 53       		pushq	%rbx
+ 371              		.cfi_def_cfa_offset 16
+ 372              		.cfi_offset 3, -16
+ 373 0321 488B9FC0 		movq	192(%rdi), %rbx
+ 373      000000
+ 374 0328 807B1800 		cmpb	$0, 24(%rbx)
+ 375 032c 7510     		jne	.L30
+ 376 032e 48837B20 		cmpq	$0, 32(%rbx)
+ 376      00
+ 377 0333 741B     		je	.L31
+ 378 0335 488D7B20 		leaq	32(%rbx), %rdi
+ 379 0339 E8000000 		call	cache_release@PLT
+ 379      00
+ 380              	.L30:
+ 381 033e 488B7B08 		movq	8(%rbx), %rdi
+ 382 0342 E8000000 		call	free@PLT
+ 382      00
+ 383 0347 4889DF   		movq	%rbx, %rdi
+ 384 034a 5B       		popq	%rbx
+ 385              		.cfi_remember_state
+ 386              		.cfi_def_cfa_offset 8
+ 387 034b E9000000 		jmp	free@PLT
+ 387      00
+ 388              		.p2align 4,,10
+ 389              		.p2align 3
+ 390              	.L31:
+ 391              		.cfi_restore_state
+ 392 0350 488B7B10 		movq	16(%rbx), %rdi
+ 393 0354 E8000000 		call	free@PLT
+ 393      00
+ 394 0359 EBE3     		jmp	.L30
+ 395              		.cfi_endproc
+ 396              	.LFE6410:
+ 398 035b 0F1F4400 		.p2align 4
+ 398      00
+ 399              		.globl	clone_fir
+ 401              	clone_fir:
+ 402              	.LFB6412:
+ 403              		.cfi_startproc
+ 404 0360 55       		pushq	%rbp
+ 405              		.cfi_def_cfa_offset 16
+ 406              		.cfi_offset 6, -16
+ 407 0361 4889E5   		movq	%rsp, %rbp
+ 408              		.cfi_def_cfa_register 6
+ 409 0364 4154     		pushq	%r12
+ 410              		.cfi_offset 12, -24
+ 411 0366 4989F4   		movq	%rsi, %r12
+ 412 0369 53       		pushq	%rbx
+ 413              		.cfi_offset 3, -32
+ 414 036a 4889FB   		movq	%rdi, %rbx
+ 415 036d BF680000 		movl	$104, %edi
+ 415      00
+ 416 0372 E8000000 		call	malloc@PLT
+ 416      00
+ 417 0377 4885C0   		testq	%rax, %rax
+ 418 037a 7445     		je	.L35
+ 419 037c 498B9424 		movq	192(%r12), %rdx
+ 419      C0000000 
+ 420 0384 62F1FE48 		vmovdqu64	(%rdx), %zmm0
+ 420      6F02
+ 421 038a 62F1FE48 		vmovdqu64	%zmm0, (%rax)
+ 421      7F00
+ 422 0390 62F1FE48 		vmovdqu64	40(%rdx), %zmm1
+ 422      6F8A2800 
+ 422      0000
+ 423 039a 48C74008 		movq	$0, 8(%rax)
+ 423      00000000 
+ 424 03a2 C6401801 		movb	$1, 24(%rax)
+ 425 03a6 488983C0 		movq	%rax, 192(%rbx)
+ 425      000000
+ 426 03ad 62F1FE48 		vmovdqu64	%zmm1, 40(%rax)
+ 426      7F882800 
+ 426      0000
+ 427 03b7 31C0     		xorl	%eax, %eax
+ 428 03b9 C5F877   		vzeroupper
+ 429              	.L33:
+ 430 03bc 5B       		popq	%rbx
+ 431 03bd 415C     		popq	%r12
+ 432 03bf 5D       		popq	%rbp
+ 433              		.cfi_remember_state
+ 434              		.cfi_def_cfa 7, 8
+ 435 03c0 C3       		ret
+ 436              	.L35:
+ 437              		.cfi_restore_state
+ 438 03c1 B8010000 		movl	$1, %eax
+ 438      00
+ 439 03c6 EBF4     		jmp	.L33
+ 440              		.cfi_endproc
+ 441              	.LFE6412:
+ 443 03c8 0F1F8400 		.p2align 4
+ 443      00000000 
+ 444              		.globl	fir_process
+ 446              	fir_process:
+ 447              	.LFB6401:
+ 448              		.cfi_startproc
+ 449 03d0 55       		pushq	%rbp
+ 450              		.cfi_def_cfa_offset 16
+ 451              		.cfi_offset 6, -16
+ 452 03d1 4889E5   		movq	%rsp, %rbp
+ 453              		.cfi_def_cfa_register 6
+ 454 03d4 4157     		pushq	%r15
+ 455 03d6 4156     		pushq	%r14
+ 456 03d8 4155     		pushq	%r13
+ 457 03da 4154     		pushq	%r12
+ 458 03dc 53       		pushq	%rbx
+ 459 03dd 4883E4E0 		andq	$-32, %rsp
+ 460 03e1 4883EC40 		subq	$64, %rsp
+ 461              		.cfi_offset 15, -24
+ 462              		.cfi_offset 14, -32
+ 463              		.cfi_offset 13, -40
+ 464              		.cfi_offset 12, -48
+ 465              		.cfi_offset 3, -56
+ 466 03e5 4C8BAFC0 		movq	192(%rdi), %r13
+ 466      000000
+ 467 03ec 8B879C00 		movl	156(%rdi), %eax
+ 467      0000
+ 468 03f2 48897C24 		movq	%rdi, 40(%rsp)
+ 468      28
+ 469 03f7 48638FA4 		movslq	164(%rdi), %rcx
+ 469      000000
+ 470 03fe 418B5D44 		movl	68(%r13), %ebx
+ 471 0402 83F802   		cmpl	$2, %eax
+ 472 0405 0F844202 		je	.L38
+ 472      0000
+ 473 040b 4863F9   		movslq	%ecx, %rdi
+ 474 040e 4C63C0   		movslq	%eax, %r8
+ 475 0411 4531E4   		xorl	%r12d, %r12d
+ 476 0414 48897C24 		movq	%rdi, 8(%rsp)
+ 476      08
+ 477 0419 48C1E702 		salq	$2, %rdi
+ 478 041d 48897C24 		movq	%rdi, 24(%rsp)
+ 478      18
+ 479 0422 85C0     		testl	%eax, %eax
+ 480 0424 0F84E101 		je	.L51
+ 480      0000
+ 481 042a 894C2414 		movl	%ecx, 20(%rsp)
+ 482 042e 4C894424 		movq	%r8, 48(%rsp)
+ 482      30
+ 483 0433 EB5D     		jmp	.L69
+ 484              		.p2align 4,,10
+ 485 0435 0F1F00   		.p2align 3
+ 486              	.L94:
+ 487 0438 438B74A5 		movl	72(%r13,%r12,4), %esi
+ 487      48
+ 488 043d 413B7540 		cmpl	64(%r13), %esi
+ 489 0441 0F82E901 		jb	.L93
+ 489      0000
+ 490 0447 41C60201 		movb	$1, (%r10)
+ 491 044b 803800   		cmpb	$0, (%rax)
+ 492 044e 7509     		jne	.L62
+ 493 0450 43C744A5 		movl	$0, 72(%r13,%r12,4)
+ 493      48000000 
+ 493      00
+ 494              	.L62:
+ 495 0459 488B5424 		movq	24(%rsp), %rdx
+ 495      18
+ 496 045e 31F6     		xorl	%esi, %esi
+ 497 0460 C5F877   		vzeroupper
+ 498 0463 E8000000 		call	memset@PLT
+ 498      00
+ 499 0468 488B4424 		movq	8(%rsp), %rax
+ 499      08
+ 500 046d 31D2     		xorl	%edx, %edx
+ 501 046f 4801D8   		addq	%rbx, %rax
+ 502 0472 418B5D40 		movl	64(%r13), %ebx
+ 503 0476 48F7F3   		divq	%rbx
+ 504 0479 4889D3   		movq	%rdx, %rbx
+ 505              	.L63:
+ 506 047c 488B4424 		movq	48(%rsp), %rax
+ 506      30
+ 507 0481 4983C401 		addq	$1, %r12
+ 508 0485 4939C4   		cmpq	%rax, %r12
+ 509 0488 0F847A01 		je	.L90
+ 509      0000
+ 510              	.L95:
+ 511 048e 418B5D44 		movl	68(%r13), %ebx
+ 512              	.L69:
+ 513 0492 488B4C24 		movq	40(%rsp), %rcx
+ 513      28
+ 514 0497 488B8188 		movq	136(%rcx), %rax
+ 514      000000
+ 515 049e 4C8B9190 		movq	144(%rcx), %r10
+ 515      000000
+ 516 04a5 4A8B54E1 		movq	8(%rcx,%r12,8), %rdx
+ 516      08
+ 517 04aa 4A8B7CE1 		movq	72(%rcx,%r12,8), %rdi
+ 517      48
+ 518 04af 4C01E0   		addq	%r12, %rax
+ 519 04b2 4D01E2   		addq	%r12, %r10
+ 520 04b5 803800   		cmpb	$0, (%rax)
+ 521 04b8 0F857AFF 		jne	.L94
+ 521      FFFF
+ 522 04be 41C60200 		movb	$0, (%r10)
+ 523 04c2 803800   		cmpb	$0, (%rax)
+ 524 04c5 0F845301 		je	.L73
+ 524      0000
+ 525 04cb 438B74A5 		movl	72(%r13,%r12,4), %esi
+ 525      48
+ 526 04d0 418B4540 		movl	64(%r13), %eax
+ 527 04d4 39C6     		cmpl	%eax, %esi
+ 528 04d6 0F825D01 		jb	.L72
+ 528      0000
+ 529              	.L61:
+ 530 04dc 89C1     		movl	%eax, %ecx
+ 531 04de 4D8B5508 		movq	8(%r13), %r10
+ 532 04e2 4989CB   		movq	%rcx, %r11
+ 533 04e5 48894C24 		movq	%rcx, 56(%rsp)
+ 533      38
+ 534 04ea 8B4C2414 		movl	20(%rsp), %ecx
+ 535 04ee 4D0FAFDC 		imulq	%r12, %r11
+ 536 04f2 4F8D0C9A 		leaq	(%r10,%r11,4), %r9
+ 537 04f6 85C9     		testl	%ecx, %ecx
+ 538 04f8 7E82     		jle	.L63
+ 539 04fa 4189C2   		movl	%eax, %r10d
+ 540 04fd 4D8B7510 		movq	16(%r13), %r14
+ 541 0501 83E801   		subl	$1, %eax
+ 542 0504 4C896424 		movq	%r12, 32(%rsp)
+ 542      20
+ 543 0509 41D1EA   		shrl	%r10d
+ 544 050c C4C1F96E 		vmovq	%r13, %xmm3
+ 544      DD
+ 545 0511 4489D6   		movl	%r10d, %esi
+ 546 0514 4D89F0   		movq	%r14, %r8
+ 547 0517 4989C6   		movq	%rax, %r14
+ 548 051a 488D0CB5 		leaq	0(,%rsi,4), %rcx
+ 548      00000000 
+ 549 0522 C4E1F96E 		vmovq	%rcx, %xmm2
+ 549      D1
+ 550 0527 488B4C24 		movq	24(%rsp), %rcx
+ 550      18
+ 551 052c C4C1F97E 		vmovq	%xmm2, %r12
+ 551      D4
+ 552 0531 4C8D1C0A 		leaq	(%rdx,%rcx), %r11
+ 553 0535 C4E1F97E 		vmovq	%xmm2, %rcx
+ 553      D1
+ 554 053a 4D8D3C09 		leaq	(%r9,%rcx), %r15
+ 555 053e 4D89DD   		movq	%r11, %r13
+ 556 0541 4889F9   		movq	%rdi, %rcx
+ 557 0544 4589D3   		movl	%r10d, %r11d
+ 558 0547 4989D2   		movq	%rdx, %r10
+ 559 054a 660F1F44 		.p2align 4,,10
+ 559      0000
+ 560              		.p2align 3
+ 561              	.L67:
+ 562 0550 C4C17A10 		vmovss	(%r10), %xmm0
+ 562      02
+ 563 0555 4C89F0   		movq	%r14, %rax
+ 564 0558 4829D8   		subq	%rbx, %rax
+ 565 055b C4C17A11 		vmovss	%xmm0, (%r9,%rbx,4)
+ 565      0499
+ 566 0561 C5F857C0 		vxorps	%xmm0, %xmm0, %xmm0
+ 567 0565 498D1480 		leaq	(%r8,%rax,4), %rdx
+ 568 0569 C5FC28C8 		vmovaps	%ymm0, %ymm1
+ 569 056d 4585DB   		testl	%r11d, %r11d
+ 570 0570 742D     		je	.L64
+ 571 0572 31C0     		xorl	%eax, %eax
+ 572 0574 4A8D3C22 		leaq	(%rdx,%r12), %rdi
+ 573 0578 0F1F8400 		.p2align 4,,10
+ 573      00000000 
+ 574              		.p2align 3
+ 575              	.L65:
+ 576 0580 C5FC103C 		vmovups	(%rdx,%rax,4), %ymm7
+ 576      82
+ 577 0585 C5FC1014 		vmovups	(%rdi,%rax,4), %ymm2
+ 577      87
+ 578 058a C4C245B8 		vfmadd231ps	(%r9,%rax,4), %ymm7, %ymm1
+ 578      0C81
+ 579 0590 C4C26DB8 		vfmadd231ps	(%r15,%rax,4), %ymm2, %ymm0
+ 579      0487
+ 580 0596 4883C008 		addq	$8, %rax
+ 581 059a 4839F0   		cmpq	%rsi, %rax
+ 582 059d 72E1     		jb	.L65
+ 583              	.L64:
+ 584 059f C5F77CC9 		vhaddps	%ymm1, %ymm1, %ymm1
+ 585 05a3 C5FF7CC0 		vhaddps	%ymm0, %ymm0, %ymm0
+ 586 05a7 4883C301 		addq	$1, %rbx
+ 587 05ab 31C0     		xorl	%eax, %eax
+ 588 05ad 48395C24 		cmpq	%rbx, 56(%rsp)
+ 588      38
+ 589 05b2 480F44D8 		cmove	%rax, %rbx
+ 590 05b6 4983C204 		addq	$4, %r10
+ 591 05ba 4883C104 		addq	$4, %rcx
+ 592 05be C5F77CC9 		vhaddps	%ymm1, %ymm1, %ymm1
+ 593 05c2 C5FF7CC0 		vhaddps	%ymm0, %ymm0, %ymm0
+ 594 05c6 C4E37D19 		vextractf128	$0x1, %ymm1, %xmm5
+ 594      CD01
+ 595 05cc C4E37D19 		vextractf128	$0x1, %ymm0, %xmm6
+ 595      C601
+ 596 05d2 C5D058C9 		vaddps	%xmm1, %xmm5, %xmm1
+ 597 05d6 C5C858C0 		vaddps	%xmm0, %xmm6, %xmm0
+ 598 05da C5F258C0 		vaddss	%xmm0, %xmm1, %xmm0
+ 599 05de C5FA1141 		vmovss	%xmm0, -4(%rcx)
+ 599      FC
+ 600 05e3 4D39EA   		cmpq	%r13, %r10
+ 601 05e6 0F8564FF 		jne	.L67
+ 601      FFFF
+ 602 05ec 4C8B6424 		movq	32(%rsp), %r12
+ 602      20
+ 603 05f1 488B4424 		movq	48(%rsp), %rax
+ 603      30
+ 604 05f6 C4C1F97E 		vmovq	%xmm3, %r13
+ 604      DD
+ 605 05fb 4983C401 		addq	$1, %r12
+ 606 05ff 4939C4   		cmpq	%rax, %r12
+ 607 0602 0F8586FE 		jne	.L95
+ 607      FFFF
+ 608              	.L90:
+ 609 0608 C5F877   		vzeroupper
+ 610              	.L51:
+ 611 060b 41895D44 		movl	%ebx, 68(%r13)
+ 612 060f 488D65D8 		leaq	-40(%rbp), %rsp
+ 613 0613 5B       		popq	%rbx
+ 614 0614 415C     		popq	%r12
+ 615 0616 415D     		popq	%r13
+ 616 0618 415E     		popq	%r14
+ 617 061a 415F     		popq	%r15
+ 618 061c 5D       		popq	%rbp
+ 619              		.cfi_remember_state
+ 620              		.cfi_def_cfa 7, 8
+ 621 061d C3       		ret
+ 622              	.L73:
+ 623              		.cfi_restore_state
+ 624 061e 43C744A5 		movl	$0, 72(%r13,%r12,4)
+ 624      48000000 
+ 624      00
+ 625 0627 418B4540 		movl	64(%r13), %eax
+ 626 062b E9ACFEFF 		jmp	.L61
+ 626      FF
+ 627              	.L93:
+ 628 0630 41C60200 		movb	$0, (%r10)
+ 629 0634 803800   		cmpb	$0, (%rax)
+ 630 0637 74E5     		je	.L73
+ 631              	.L72:
+ 632 0639 8B442414 		movl	20(%rsp), %eax
+ 633 063d 01C6     		addl	%eax, %esi
+ 634 063f 438974A5 		movl	%esi, 72(%r13,%r12,4)
+ 634      48
+ 635 0644 418B4540 		movl	64(%r13), %eax
+ 636 0648 E98FFEFF 		jmp	.L61
+ 636      FF
+ 637              	.L38:
+ 638 064d 488B4424 		movq	40(%rsp), %rax
+ 638      28
+ 639 0652 458B4540 		movl	64(%r13), %r8d
+ 640 0656 31FF     		xorl	%edi, %edi
+ 641 0658 488B9088 		movq	136(%rax), %rdx
+ 641      000000
+ 642 065f 488BB090 		movq	144(%rax), %rsi
+ 642      000000
+ 643 0666 0FB602   		movzbl	(%rdx), %eax
+ 644 0669 84C0     		testb	%al, %al
+ 645 066b 740F     		je	.L41
+ 646 066d 45394548 		cmpl	%r8d, 72(%r13)
+ 647 0671 400F93C7 		setnb	%dil
+ 648 0675 0F93C0   		setnb	%al
+ 649 0678 400FB6FF 		movzbl	%dil, %edi
+ 650              	.L41:
+ 651 067c 8806     		movb	%al, (%rsi)
+ 652 067e 803A00   		cmpb	$0, (%rdx)
+ 653 0681 7478     		je	.L96
+ 654 0683 418B4548 		movl	72(%r13), %eax
+ 655 0687 4439C0   		cmpl	%r8d, %eax
+ 656 068a 7306     		jnb	.L43
+ 657 068c 01C8     		addl	%ecx, %eax
+ 658 068e 41894548 		movl	%eax, 72(%r13)
+ 659              	.L43:
+ 660 0692 807A0100 		cmpb	$0, 1(%rdx)
+ 661 0696 4189DC   		movl	%ebx, %r12d
+ 662 0699 7471     		je	.L44
+ 663              	.L99:
+ 664 069b 418B454C 		movl	76(%r13), %eax
+ 665 069f 4439C0   		cmpl	%r8d, %eax
+ 666 06a2 0F827201 		jb	.L97
+ 666      0000
+ 667 06a8 C6460101 		movb	$1, 1(%rsi)
+ 668 06ac 807A0100 		cmpb	$0, 1(%rdx)
+ 669 06b0 0F848601 		je	.L98
+ 669      0000
+ 670              	.L49:
+ 671 06b6 85FF     		testl	%edi, %edi
+ 672 06b8 746D     		je	.L48
+ 673 06ba 4C8B7424 		movq	40(%rsp), %r14
+ 673      28
+ 674 06bf 4863D9   		movslq	%ecx, %rbx
+ 675 06c2 31F6     		xorl	%esi, %esi
+ 676 06c4 4C8D3C9D 		leaq	0(,%rbx,4), %r15
+ 676      00000000 
+ 677 06cc 498B7E48 		movq	72(%r14), %rdi
+ 678 06d0 4C89FA   		movq	%r15, %rdx
+ 679 06d3 E8000000 		call	memset@PLT
+ 679      00
+ 680 06d8 498B7E50 		movq	80(%r14), %rdi
+ 681 06dc 4C89FA   		movq	%r15, %rdx
+ 682 06df 31F6     		xorl	%esi, %esi
+ 683 06e1 E8000000 		call	memset@PLT
+ 683      00
+ 684 06e6 418B4D40 		movl	64(%r13), %ecx
+ 685 06ea 498D041C 		leaq	(%r12,%rbx), %rax
+ 686 06ee 31D2     		xorl	%edx, %edx
+ 687 06f0 48F7F1   		divq	%rcx
+ 688 06f3 4889D3   		movq	%rdx, %rbx
+ 689 06f6 E910FFFF 		jmp	.L51
+ 689      FF
+ 690              	.L96:
+ 691 06fb 807A0100 		cmpb	$0, 1(%rdx)
+ 692 06ff 41C74548 		movl	$0, 72(%r13)
+ 692      00000000 
+ 693 0707 4189DC   		movl	%ebx, %r12d
+ 694 070a 758F     		jne	.L99
+ 695              	.L44:
+ 696 070c C6460100 		movb	$0, 1(%rsi)
+ 697 0710 807A0100 		cmpb	$0, 1(%rdx)
+ 698 0714 0F840A01 		je	.L71
+ 698      0000
+ 699 071a 418B454C 		movl	76(%r13), %eax
+ 700 071e 4439C0   		cmpl	%r8d, %eax
+ 701 0721 0F820A01 		jb	.L70
+ 701      0000
+ 702              	.L48:
+ 703 0727 488B4424 		movq	40(%rsp), %rax
+ 703      28
+ 704 072c 498B7508 		movq	8(%r13), %rsi
+ 705 0730 4489C2   		movl	%r8d, %edx
+ 706 0733 4C8B5808 		movq	8(%rax), %r11
+ 707 0737 4C8B4810 		movq	16(%rax), %r9
+ 708 073b 488D3C96 		leaq	(%rsi,%rdx,4), %rdi
+ 709 073f 85C9     		testl	%ecx, %ecx
+ 710 0741 0F8EC4FE 		jle	.L51
+ 710      FFFF
+ 711 0747 4C8B7850 		movq	80(%rax), %r15
+ 712 074b 488B5848 		movq	72(%rax), %rbx
+ 713 074f 418D40FF 		leal	-1(%r8), %eax
+ 714 0753 4531F6   		xorl	%r14d, %r14d
+ 715 0756 48894424 		movq	%rax, 48(%rsp)
+ 715      30
+ 716 075b 488D048D 		leaq	0(,%rcx,4), %rax
+ 716      00000000 
+ 717 0763 4D8B5510 		movq	16(%r13), %r10
+ 718 0767 4531C0   		xorl	%r8d, %r8d
+ 719 076a 48894424 		movq	%rax, 56(%rsp)
+ 719      38
+ 720              	.L56:
+ 721 076f C4817A10 		vmovss	(%r11,%r8), %xmm0
+ 721      0403
+ 722 0775 488B4C24 		movq	48(%rsp), %rcx
+ 722      30
+ 723 077a C4A17A11 		vmovss	%xmm0, (%rsi,%r12,4)
+ 723      04A6
+ 724 0780 C4817A10 		vmovss	(%r9,%r8), %xmm0
+ 724      0401
+ 725 0786 4C29E1   		subq	%r12, %rcx
+ 726 0789 48C1E102 		salq	$2, %rcx
+ 727 078d C4A17A11 		vmovss	%xmm0, (%rdi,%r12,4)
+ 727      04A7
+ 728 0793 C5F857C0 		vxorps	%xmm0, %xmm0, %xmm0
+ 729 0797 C5FC28C8 		vmovaps	%ymm0, %ymm1
+ 730 079b 4885D2   		testq	%rdx, %rdx
+ 731 079e 7422     		je	.L53
+ 732 07a0 31C0     		xorl	%eax, %eax
+ 733 07a2 4C01D1   		addq	%r10, %rcx
+ 734              		.p2align 4,,10
+ 735 07a5 0F1F00   		.p2align 3
+ 736              	.L54:
+ 737 07a8 C5FC102C 		vmovups	(%rcx,%rax,4), %ymm5
+ 737      81
+ 738 07ad C4E255B8 		vfmadd231ps	(%rsi,%rax,4), %ymm5, %ymm1
+ 738      0C86
+ 739 07b3 C4E255B8 		vfmadd231ps	(%rdi,%rax,4), %ymm5, %ymm0
+ 739      0487
+ 740 07b9 4883C008 		addq	$8, %rax
+ 741 07bd 4839D0   		cmpq	%rdx, %rax
+ 742 07c0 72E6     		jb	.L54
+ 743              	.L53:
+ 744 07c2 C5F77CC9 		vhaddps	%ymm1, %ymm1, %ymm1
+ 745 07c6 C5FF7CC0 		vhaddps	%ymm0, %ymm0, %ymm0
+ 746 07ca 4983C401 		addq	$1, %r12
+ 747 07ce 488B4424 		movq	56(%rsp), %rax
+ 747      38
+ 748 07d3 4C39E2   		cmpq	%r12, %rdx
+ 749 07d6 4D0F44E6 		cmove	%r14, %r12
+ 750 07da C5F77CC9 		vhaddps	%ymm1, %ymm1, %ymm1
+ 751 07de C5FF7CC0 		vhaddps	%ymm0, %ymm0, %ymm0
+ 752 07e2 C4E37D19 		vextractf128	$0x1, %ymm1, %xmm3
+ 752      CB01
+ 753 07e8 C4E37D19 		vextractf128	$0x1, %ymm0, %xmm2
+ 753      C201
+ 754 07ee C5E058C9 		vaddps	%xmm1, %xmm3, %xmm1
+ 755 07f2 C5E858C0 		vaddps	%xmm0, %xmm2, %xmm0
+ 756 07f6 C4A17A11 		vmovss	%xmm1, (%rbx,%r8)
+ 756      0C03
+ 757 07fc C4817A11 		vmovss	%xmm0, (%r15,%r8)
+ 757      0407
+ 758 0802 4983C004 		addq	$4, %r8
+ 759 0806 4939C0   		cmpq	%rax, %r8
+ 760 0809 0F8560FF 		jne	.L56
+ 760      FFFF
+ 761 080f 4489E3   		movl	%r12d, %ebx
+ 762 0812 C5F877   		vzeroupper
+ 763 0815 E9F1FDFF 		jmp	.L51
+ 763      FF
+ 764              	.L97:
+ 765 081a C6460100 		movb	$0, 1(%rsi)
+ 766 081e 807A0100 		cmpb	$0, 1(%rdx)
+ 767 0822 750D     		jne	.L70
+ 768              	.L71:
+ 769 0824 41C7454C 		movl	$0, 76(%r13)
+ 769      00000000 
+ 770 082c E9F6FEFF 		jmp	.L48
+ 770      FF
+ 771              	.L70:
+ 772 0831 01C8     		addl	%ecx, %eax
+ 773 0833 4189454C 		movl	%eax, 76(%r13)
+ 774 0837 E9EBFEFF 		jmp	.L48
+ 774      FF
+ 775              	.L98:
+ 776 083c 41C7454C 		movl	$0, 76(%r13)
+ 776      00000000 
+ 777 0844 E96DFEFF 		jmp	.L49
+ 777      FF
+ 778              		.cfi_endproc
+ 779              	.LFE6401:
+ 781 0849 0F1F8000 		.p2align 4
+ 781      000000
+ 783              	fir_process_2_64:
+ 784              	.LFB6402:
+ 785              		.cfi_startproc
+ 786 0850 83BFA400 		cmpl	$64, 164(%rdi)
+ 786      000040
+ 787 0857 753F     		jne	.L130
+ 788 0859 55       		pushq	%rbp
+ 789              		.cfi_def_cfa_offset 16
+ 790              		.cfi_offset 6, -16
+ 791 085a 4889E5   		movq	%rsp, %rbp
+ 792              		.cfi_def_cfa_register 6
+ 793 085d 4157     		pushq	%r15
+ 794 085f 4156     		pushq	%r14
+ 795 0861 4155     		pushq	%r13
+ 796 0863 4154     		pushq	%r12
+ 797 0865 53       		pushq	%rbx
+ 798              		.cfi_offset 15, -24
+ 799              		.cfi_offset 14, -32
+ 800              		.cfi_offset 13, -40
+ 801              		.cfi_offset 12, -48
+ 802              		.cfi_offset 3, -56
+ 803 0866 4C8B5F08 		movq	8(%rdi), %r11
+ 804 086a 4C8B5748 		movq	72(%rdi), %r10
+ 805 086e 488B5F10 		movq	16(%rdi), %rbx
+ 806 0872 4C89D8   		movq	%r11, %rax
+ 807 0875 4C8B6750 		movq	80(%rdi), %r12
+ 808 0879 4C09D0   		orq	%r10, %rax
+ 809 087c 4809D8   		orq	%rbx, %rax
+ 810 087f 4C09E0   		orq	%r12, %rax
+ 811 0882 A81F     		testb	$31, %al
+ 812 0884 741A     		je	.L133
+ 813 0886 5B       		popq	%rbx
+ 814              		.cfi_restore 3
+ 815 0887 415C     		popq	%r12
+ 816              		.cfi_restore 12
+ 817 0889 415D     		popq	%r13
+ 818              		.cfi_restore 13
+ 819 088b 415E     		popq	%r14
+ 820              		.cfi_restore 14
+ 821 088d 415F     		popq	%r15
+ 822              		.cfi_restore 15
+ 823 088f 5D       		popq	%rbp
+ 824              		.cfi_restore 6
+ 825              		.cfi_def_cfa 7, 8
+ 826 0890 E9000000 		jmp	fir_process@PLT
+ 826      00
+ 827              		.p2align 4,,10
+ 828 0895 0F1F00   		.p2align 3
+ 829              	.L130:
+ 830 0898 E9000000 		jmp	fir_process@PLT
+ 830      00
+ 831 089d 0F1F00   		.p2align 4,,10
+ 832              		.p2align 3
+ 833              	.L133:
+ 834              		.cfi_def_cfa 6, 16
+ 835              		.cfi_offset 3, -56
+ 836              		.cfi_offset 6, -16
+ 837              		.cfi_offset 12, -48
+ 838              		.cfi_offset 13, -40
+ 839              		.cfi_offset 14, -32
+ 840              		.cfi_offset 15, -24
+ 841 08a0 488B8788 		movq	136(%rdi), %rax
+ 841      000000
+ 842 08a7 4C8BBFC0 		movq	192(%rdi), %r15
+ 842      000000
+ 843 08ae 31F6     		xorl	%esi, %esi
+ 844 08b0 488B8F90 		movq	144(%rdi), %rcx
+ 844      000000
+ 845 08b7 0FB610   		movzbl	(%rax), %edx
+ 846 08ba 458B4744 		movl	68(%r15), %r8d
+ 847 08be 458B4F40 		movl	64(%r15), %r9d
+ 848 08c2 84D2     		testb	%dl, %dl
+ 849 08c4 740F     		je	.L102
+ 850 08c6 45394F48 		cmpl	%r9d, 72(%r15)
+ 851 08ca 400F93C6 		setnb	%sil
+ 852 08ce 0F93C2   		setnb	%dl
+ 853 08d1 400FB6F6 		movzbl	%sil, %esi
+ 854              	.L102:
+ 855 08d5 8811     		movb	%dl, (%rcx)
+ 856 08d7 803800   		cmpb	$0, (%rax)
+ 857 08da 0F859000 		jne	.L103
+ 857      0000
+ 858 08e0 41C74748 		movl	$0, 72(%r15)
+ 858      00000000 
+ 859              	.L104:
+ 860 08e8 80780100 		cmpb	$0, 1(%rax)
+ 861 08ec 0F849E00 		je	.L105
+ 861      0000
+ 862 08f2 418B574C 		movl	76(%r15), %edx
+ 863 08f6 4439CA   		cmpl	%r9d, %edx
+ 864 08f9 0F82A401 		jb	.L134
+ 864      0000
+ 865 08ff C6410101 		movb	$1, 1(%rcx)
+ 866 0903 80780100 		cmpb	$0, 1(%rax)
+ 867 0907 7508     		jne	.L110
+ 868 0909 41C7474C 		movl	$0, 76(%r15)
+ 868      00000000 
+ 869              	.L110:
+ 870 0911 85F6     		testl	%esi, %esi
+ 871 0913 0F848D00 		je	.L109
+ 871      0000
+ 872 0919 C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 873 091d 31D2     		xorl	%edx, %edx
+ 874 091f 62D17F48 		vmovdqu8	%zmm0, (%r10)
+ 874      7F02
+ 875 0925 62D17F48 		vmovdqu8	%zmm0, 64(%r10)
+ 875      7F4201
+ 876 092c 62D17F48 		vmovdqu8	%zmm0, 128(%r10)
+ 876      7F4202
+ 877 0933 62D17F48 		vmovdqu8	%zmm0, 192(%r10)
+ 877      7F4203
+ 878 093a 488B4750 		movq	80(%rdi), %rax
+ 879 093e 62F17F48 		vmovdqu8	%zmm0, (%rax)
+ 879      7F00
+ 880 0944 62F17F48 		vmovdqu8	%zmm0, 64(%rax)
+ 880      7F4001
+ 881 094b 62F17F48 		vmovdqu8	%zmm0, 128(%rax)
+ 881      7F4002
+ 882 0952 62F17F48 		vmovdqu8	%zmm0, 192(%rax)
+ 882      7F4003
+ 883 0959 418B4F40 		movl	64(%r15), %ecx
+ 884 095d 498D4040 		leaq	64(%r8), %rax
+ 885 0961 48F7F1   		divq	%rcx
+ 886 0964 41895744 		movl	%edx, 68(%r15)
+ 887 0968 E9FF0000 		jmp	.L128
+ 887      00
+ 888 096d 0F1F00   		.p2align 4,,10
+ 889              		.p2align 3
+ 890              	.L103:
+ 891 0970 418B5748 		movl	72(%r15), %edx
+ 892 0974 4439CA   		cmpl	%r9d, %edx
+ 893 0977 0F836BFF 		jnb	.L104
+ 893      FFFF
+ 894 097d 83C240   		addl	$64, %edx
+ 895 0980 41895748 		movl	%edx, 72(%r15)
+ 896 0984 E95FFFFF 		jmp	.L104
+ 896      FF
+ 897 0989 0F1F8000 		.p2align 4,,10
+ 897      000000
+ 898              		.p2align 3
+ 899              	.L105:
+ 900 0990 C6410100 		movb	$0, 1(%rcx)
+ 901 0994 80780100 		cmpb	$0, 1(%rax)
+ 902 0998 0F85EC00 		jne	.L108
+ 902      0000
+ 903              	.L118:
+ 904 099e 41C7474C 		movl	$0, 76(%r15)
+ 904      00000000 
+ 905              	.L109:
+ 906 09a6 498B4F08 		movq	8(%r15), %rcx
+ 907 09aa 4489CA   		movl	%r9d, %edx
+ 908 09ad 4D8B6F10 		movq	16(%r15), %r13
+ 909 09b1 458D71FF 		leal	-1(%r9), %r14d
+ 910 09b5 4531C9   		xorl	%r9d, %r9d
+ 911 09b8 488D3491 		leaq	(%rcx,%rdx,4), %rsi
+ 912 09bc 0F1F4000 		.p2align 4,,10
+ 913              		.p2align 3
+ 914              	.L116:
+ 915 09c0 C4817A10 		vmovss	(%r11,%r9), %xmm0
+ 915      040B
+ 916 09c6 4C89F0   		movq	%r14, %rax
+ 917 09c9 4C29C0   		subq	%r8, %rax
+ 918 09cc C4A17A11 		vmovss	%xmm0, (%rcx,%r8,4)
+ 918      0481
+ 919 09d2 C4A17A10 		vmovss	(%rbx,%r9), %xmm0
+ 919      040B
+ 920 09d8 488D3C85 		leaq	0(,%rax,4), %rdi
+ 920      00000000 
+ 921 09e0 C4A17A11 		vmovss	%xmm0, (%rsi,%r8,4)
+ 921      0486
+ 922 09e6 4885D2   		testq	%rdx, %rdx
+ 923 09e9 0F849100 		je	.L120
+ 923      0000
+ 924 09ef C5F857C0 		vxorps	%xmm0, %xmm0, %xmm0
+ 925 09f3 31C0     		xorl	%eax, %eax
+ 926 09f5 4C01EF   		addq	%r13, %rdi
+ 927 09f8 C5FC28C8 		vmovaps	%ymm0, %ymm1
+ 928 09fc 0F1F4000 		.p2align 4,,10
+ 929              		.p2align 3
+ 930              	.L114:
+ 931 0a00 C5FC1024 		vmovups	(%rdi,%rax,4), %ymm4
+ 931      87
+ 932 0a05 C4E25DB8 		vfmadd231ps	(%rcx,%rax,4), %ymm4, %ymm1
+ 932      0C81
+ 933 0a0b C4E25DB8 		vfmadd231ps	(%rsi,%rax,4), %ymm4, %ymm0
+ 933      0486
+ 934 0a11 4883C008 		addq	$8, %rax
+ 935 0a15 4839D0   		cmpq	%rdx, %rax
+ 936 0a18 72E6     		jb	.L114
+ 937              	.L113:
+ 938 0a1a C5F77CC9 		vhaddps	%ymm1, %ymm1, %ymm1
+ 939 0a1e C5FF7CC0 		vhaddps	%ymm0, %ymm0, %ymm0
+ 940 0a22 4983C001 		addq	$1, %r8
+ 941 0a26 31C0     		xorl	%eax, %eax
+ 942 0a28 4C39C2   		cmpq	%r8, %rdx
+ 943 0a2b 4C0F44C0 		cmove	%rax, %r8
+ 944 0a2f C5F77CC9 		vhaddps	%ymm1, %ymm1, %ymm1
+ 945 0a33 C5FF7CC0 		vhaddps	%ymm0, %ymm0, %ymm0
+ 946 0a37 C4E37D19 		vextractf128	$0x1, %ymm1, %xmm3
+ 946      CB01
+ 947 0a3d C4E37D19 		vextractf128	$0x1, %ymm0, %xmm2
+ 947      C201
+ 948 0a43 C5E058C9 		vaddps	%xmm1, %xmm3, %xmm1
+ 949 0a47 C5E858C0 		vaddps	%xmm0, %xmm2, %xmm0
+ 950 0a4b C4817A11 		vmovss	%xmm1, (%r10,%r9)
+ 950      0C0A
+ 951 0a51 C4817A11 		vmovss	%xmm0, (%r12,%r9)
+ 951      040C
+ 952 0a57 4983C104 		addq	$4, %r9
+ 953 0a5b 4981F900 		cmpq	$256, %r9
+ 953      010000
+ 954 0a62 0F8558FF 		jne	.L116
+ 954      FFFF
+ 955 0a68 45894744 		movl	%r8d, 68(%r15)
+ 956              	.L128:
+ 957 0a6c C5F877   		vzeroupper
+ 958 0a6f 5B       		popq	%rbx
+ 959 0a70 415C     		popq	%r12
+ 960 0a72 415D     		popq	%r13
+ 961 0a74 415E     		popq	%r14
+ 962 0a76 415F     		popq	%r15
+ 963 0a78 5D       		popq	%rbp
+ 964              		.cfi_remember_state
+ 965              		.cfi_def_cfa 7, 8
+ 966 0a79 C3       		ret
+ 967 0a7a 660F1F44 		.p2align 4,,10
+ 967      0000
+ 968              		.p2align 3
+ 969              	.L120:
+ 970              		.cfi_restore_state
+ 971 0a80 C5F857C0 		vxorps	%xmm0, %xmm0, %xmm0
+ 972 0a84 C5FC28C8 		vmovaps	%ymm0, %ymm1
+ 973 0a88 EB90     		jmp	.L113
+ 974              	.L108:
+ 975 0a8a 418B574C 		movl	76(%r15), %edx
+ 976 0a8e 4439CA   		cmpl	%r9d, %edx
+ 977 0a91 0F830FFF 		jnb	.L109
+ 977      FFFF
+ 978              	.L117:
+ 979 0a97 83C240   		addl	$64, %edx
+ 980 0a9a 4189574C 		movl	%edx, 76(%r15)
+ 981 0a9e E903FFFF 		jmp	.L109
+ 981      FF
+ 982              	.L134:
+ 983 0aa3 C6410100 		movb	$0, 1(%rcx)
+ 984 0aa7 80780100 		cmpb	$0, 1(%rax)
+ 985 0aab 75EA     		jne	.L117
+ 986 0aad E9ECFEFF 		jmp	.L118
+ 986      FF
+ 987              		.cfi_endproc
+ 988              	.LFE6402:
+ 990 0ab2 66662E0F 		.p2align 4
+ 990      1F840000 
+ 990      0000000F 
+ 990      1F00
+ 992              	fir_process_2_128:
+ 993              	.LFB6403:
+ 994              		.cfi_startproc
+ 995 0ac0 81BFA400 		cmpl	$128, 164(%rdi)
+ 995      00008000 
+ 995      0000
+ 996 0aca 4889FA   		movq	%rdi, %rdx
+ 997 0acd 7541     		jne	.L165
+ 998 0acf 55       		pushq	%rbp
+ 999              		.cfi_def_cfa_offset 16
+ 1000              		.cfi_offset 6, -16
+ 1001 0ad0 4889E5   		movq	%rsp, %rbp
+ 1002              		.cfi_def_cfa_register 6
+ 1003 0ad3 4157     		pushq	%r15
+ 1004 0ad5 4156     		pushq	%r14
+ 1005 0ad7 4155     		pushq	%r13
+ 1006 0ad9 4154     		pushq	%r12
+ 1007 0adb 53       		pushq	%rbx
+ 1008              		.cfi_offset 15, -24
+ 1009              		.cfi_offset 14, -32
+ 1010              		.cfi_offset 13, -40
+ 1011              		.cfi_offset 12, -48
+ 1012              		.cfi_offset 3, -56
+ 1013 0adc 4C8B5F08 		movq	8(%rdi), %r11
+ 1014 0ae0 4C8B5748 		movq	72(%rdi), %r10
+ 1015 0ae4 488B5F10 		movq	16(%rdi), %rbx
+ 1016 0ae8 4C89D8   		movq	%r11, %rax
+ 1017 0aeb 4C8B6750 		movq	80(%rdi), %r12
+ 1018 0aef 4C09D0   		orq	%r10, %rax
+ 1019 0af2 4809D8   		orq	%rbx, %rax
+ 1020 0af5 4C09E0   		orq	%r12, %rax
+ 1021 0af8 A81F     		testb	$31, %al
+ 1022 0afa 741C     		je	.L168
+ 1023 0afc 5B       		popq	%rbx
+ 1024              		.cfi_restore 3
+ 1025 0afd 415C     		popq	%r12
+ 1026              		.cfi_restore 12
+ 1027 0aff 415D     		popq	%r13
+ 1028              		.cfi_restore 13
+ 1029 0b01 415E     		popq	%r14
+ 1030              		.cfi_restore 14
+ 1031 0b03 415F     		popq	%r15
+ 1032              		.cfi_restore 15
+ 1033 0b05 5D       		popq	%rbp
+ 1034              		.cfi_restore 6
+ 1035              		.cfi_def_cfa 7, 8
+ 1036 0b06 E9000000 		jmp	fir_process@PLT
+ 1036      00
+ 1037 0b0b 0F1F4400 		.p2align 4,,10
+ 1037      00
+ 1038              		.p2align 3
+ 1039              	.L165:
+ 1040 0b10 E9000000 		jmp	fir_process@PLT
+ 1040      00
+ 1041              		.p2align 4,,10
+ 1042 0b15 0F1F00   		.p2align 3
+ 1043              	.L168:
+ 1044              		.cfi_def_cfa 6, 16
+ 1045              		.cfi_offset 3, -56
+ 1046              		.cfi_offset 6, -16
+ 1047              		.cfi_offset 12, -48
+ 1048              		.cfi_offset 13, -40
+ 1049              		.cfi_offset 14, -32
+ 1050              		.cfi_offset 15, -24
+ 1051 0b18 488B8788 		movq	136(%rdi), %rax
+ 1051      000000
+ 1052 0b1f 4C8BBFC0 		movq	192(%rdi), %r15
+ 1052      000000
+ 1053 0b26 4531C9   		xorl	%r9d, %r9d
+ 1054 0b29 488BB790 		movq	144(%rdi), %rsi
+ 1054      000000
+ 1055 0b30 0FB608   		movzbl	(%rax), %ecx
+ 1056 0b33 458B4744 		movl	68(%r15), %r8d
+ 1057 0b37 418B7F40 		movl	64(%r15), %edi
+ 1058 0b3b 84C9     		testb	%cl, %cl
+ 1059 0b3d 740F     		je	.L137
+ 1060 0b3f 41397F48 		cmpl	%edi, 72(%r15)
+ 1061 0b43 410F93C1 		setnb	%r9b
+ 1062 0b47 0F93C1   		setnb	%cl
+ 1063 0b4a 450FB6C9 		movzbl	%r9b, %r9d
+ 1064              	.L137:
+ 1065 0b4e 880E     		movb	%cl, (%rsi)
+ 1066 0b50 803800   		cmpb	$0, (%rax)
+ 1067 0b53 0F85AF00 		jne	.L138
+ 1067      0000
+ 1068 0b59 41C74748 		movl	$0, 72(%r15)
+ 1068      00000000 
+ 1069              	.L139:
+ 1070 0b61 80780100 		cmpb	$0, 1(%rax)
+ 1071 0b65 0F84B500 		je	.L140
+ 1071      0000
+ 1072 0b6b 418B4F4C 		movl	76(%r15), %ecx
+ 1073 0b6f 39F9     		cmpl	%edi, %ecx
+ 1074 0b71 0F82BB01 		jb	.L169
+ 1074      0000
+ 1075 0b77 C6460101 		movb	$1, 1(%rsi)
+ 1076 0b7b 80780100 		cmpb	$0, 1(%rax)
+ 1077 0b7f 7508     		jne	.L145
+ 1078 0b81 41C7474C 		movl	$0, 76(%r15)
+ 1078      00000000 
+ 1079              	.L145:
+ 1080 0b89 4585C9   		testl	%r9d, %r9d
+ 1081 0b8c 0F84A400 		je	.L144
+ 1081      0000
+ 1082 0b92 498D7A08 		leaq	8(%r10), %rdi
+ 1083 0b96 49C70200 		movq	$0, (%r10)
+ 1083      000000
+ 1084 0b9d 31C0     		xorl	%eax, %eax
+ 1085 0b9f 49C782F8 		movq	$0, 504(%r10)
+ 1085      01000000 
+ 1085      000000
+ 1086 0baa 4883E7F8 		andq	$-8, %rdi
+ 1087 0bae 4929FA   		subq	%rdi, %r10
+ 1088 0bb1 418D8A00 		leal	512(%r10), %ecx
+ 1088      020000
+ 1089 0bb8 C1E903   		shrl	$3, %ecx
+ 1090 0bbb F348AB   		rep stosq
+ 1091 0bbe 488B5250 		movq	80(%rdx), %rdx
+ 1092 0bc2 488D7A08 		leaq	8(%rdx), %rdi
+ 1093 0bc6 48C70200 		movq	$0, (%rdx)
+ 1093      000000
+ 1094 0bcd 48C782F8 		movq	$0, 504(%rdx)
+ 1094      01000000 
+ 1094      000000
+ 1095 0bd8 4883E7F8 		andq	$-8, %rdi
+ 1096 0bdc 4829FA   		subq	%rdi, %rdx
+ 1097 0bdf 8D8A0002 		leal	512(%rdx), %ecx
+ 1097      0000
+ 1098 0be5 31D2     		xorl	%edx, %edx
+ 1099 0be7 C1E903   		shrl	$3, %ecx
+ 1100 0bea F348AB   		rep stosq
+ 1101 0bed 498D8080 		leaq	128(%r8), %rax
+ 1101      000000
+ 1102 0bf4 418B4F40 		movl	64(%r15), %ecx
+ 1103 0bf8 48F7F1   		divq	%rcx
+ 1104 0bfb 41895744 		movl	%edx, 68(%r15)
+ 1105 0bff E9FB0000 		jmp	.L163
+ 1105      00
+ 1106              		.p2align 4,,10
+ 1107 0c04 0F1F4000 		.p2align 3
+ 1108              	.L138:
+ 1109 0c08 418B4F48 		movl	72(%r15), %ecx
+ 1110 0c0c 39F9     		cmpl	%edi, %ecx
+ 1111 0c0e 0F834DFF 		jnb	.L139
+ 1111      FFFF
+ 1112 0c14 83E980   		subl	$-128, %ecx
+ 1113 0c17 41894F48 		movl	%ecx, 72(%r15)
+ 1114 0c1b E941FFFF 		jmp	.L139
+ 1114      FF
+ 1115              		.p2align 4,,10
+ 1116              		.p2align 3
+ 1117              	.L140:
+ 1118 0c20 C6460100 		movb	$0, 1(%rsi)
+ 1119 0c24 80780100 		cmpb	$0, 1(%rax)
+ 1120 0c28 0F85EC00 		jne	.L143
+ 1120      0000
+ 1121              	.L153:
+ 1122 0c2e 41C7474C 		movl	$0, 76(%r15)
+ 1122      00000000 
+ 1123              	.L144:
+ 1124 0c36 498B4F08 		movq	8(%r15), %rcx
+ 1125 0c3a 89FA     		movl	%edi, %edx
+ 1126 0c3c 4D8B6F10 		movq	16(%r15), %r13
+ 1127 0c40 448D77FF 		leal	-1(%rdi), %r14d
+ 1128 0c44 4531C9   		xorl	%r9d, %r9d
+ 1129 0c47 488D3491 		leaq	(%rcx,%rdx,4), %rsi
+ 1130 0c4b 0F1F4400 		.p2align 4,,10
+ 1130      00
+ 1131              		.p2align 3
+ 1132              	.L151:
+ 1133 0c50 C4817A10 		vmovss	(%r11,%r9), %xmm0
+ 1133      040B
+ 1134 0c56 4C89F0   		movq	%r14, %rax
+ 1135 0c59 4C29C0   		subq	%r8, %rax
+ 1136 0c5c C4A17A11 		vmovss	%xmm0, (%rcx,%r8,4)
+ 1136      0481
+ 1137 0c62 C4A17A10 		vmovss	(%rbx,%r9), %xmm0
+ 1137      040B
+ 1138 0c68 488D3C85 		leaq	0(,%rax,4), %rdi
+ 1138      00000000 
+ 1139 0c70 C4A17A11 		vmovss	%xmm0, (%rsi,%r8,4)
+ 1139      0486
+ 1140 0c76 4885D2   		testq	%rdx, %rdx
+ 1141 0c79 0F849100 		je	.L155
+ 1141      0000
+ 1142 0c7f C5F857C0 		vxorps	%xmm0, %xmm0, %xmm0
+ 1143 0c83 31C0     		xorl	%eax, %eax
+ 1144 0c85 4C01EF   		addq	%r13, %rdi
+ 1145 0c88 C5FC28C8 		vmovaps	%ymm0, %ymm1
+ 1146 0c8c 0F1F4000 		.p2align 4,,10
+ 1147              		.p2align 3
+ 1148              	.L149:
+ 1149 0c90 C5FC1024 		vmovups	(%rdi,%rax,4), %ymm4
+ 1149      87
+ 1150 0c95 C4E25DB8 		vfmadd231ps	(%rcx,%rax,4), %ymm4, %ymm1
+ 1150      0C81
+ 1151 0c9b C4E25DB8 		vfmadd231ps	(%rsi,%rax,4), %ymm4, %ymm0
+ 1151      0486
+ 1152 0ca1 4883C008 		addq	$8, %rax
+ 1153 0ca5 4839D0   		cmpq	%rdx, %rax
+ 1154 0ca8 72E6     		jb	.L149
+ 1155              	.L148:
+ 1156 0caa C5F77CC9 		vhaddps	%ymm1, %ymm1, %ymm1
+ 1157 0cae C5FF7CC0 		vhaddps	%ymm0, %ymm0, %ymm0
+ 1158 0cb2 4983C001 		addq	$1, %r8
+ 1159 0cb6 31C0     		xorl	%eax, %eax
+ 1160 0cb8 4C39C2   		cmpq	%r8, %rdx
+ 1161 0cbb 4C0F44C0 		cmove	%rax, %r8
+ 1162 0cbf C5F77CC9 		vhaddps	%ymm1, %ymm1, %ymm1
+ 1163 0cc3 C5FF7CC0 		vhaddps	%ymm0, %ymm0, %ymm0
+ 1164 0cc7 C4E37D19 		vextractf128	$0x1, %ymm1, %xmm3
+ 1164      CB01
+ 1165 0ccd C4E37D19 		vextractf128	$0x1, %ymm0, %xmm2
+ 1165      C201
+ 1166 0cd3 C5E058C9 		vaddps	%xmm1, %xmm3, %xmm1
+ 1167 0cd7 C5E858C0 		vaddps	%xmm0, %xmm2, %xmm0
+ 1168 0cdb C4817A11 		vmovss	%xmm1, (%r10,%r9)
+ 1168      0C0A
+ 1169 0ce1 C4817A11 		vmovss	%xmm0, (%r12,%r9)
+ 1169      040C
+ 1170 0ce7 4983C104 		addq	$4, %r9
+ 1171 0ceb 4981F900 		cmpq	$512, %r9
+ 1171      020000
+ 1172 0cf2 0F8558FF 		jne	.L151
+ 1172      FFFF
+ 1173 0cf8 45894744 		movl	%r8d, 68(%r15)
+ 1174 0cfc C5F877   		vzeroupper
+ 1175              	.L163:
+ 1176 0cff 5B       		popq	%rbx
+ 1177 0d00 415C     		popq	%r12
+ 1178 0d02 415D     		popq	%r13
+ 1179 0d04 415E     		popq	%r14
+ 1180 0d06 415F     		popq	%r15
+ 1181 0d08 5D       		popq	%rbp
+ 1182              		.cfi_remember_state
+ 1183              		.cfi_def_cfa 7, 8
+ 1184 0d09 C3       		ret
+ 1185 0d0a 660F1F44 		.p2align 4,,10
+ 1185      0000
+ 1186              		.p2align 3
+ 1187              	.L155:
+ 1188              		.cfi_restore_state
+ 1189 0d10 C5F857C0 		vxorps	%xmm0, %xmm0, %xmm0
+ 1190 0d14 C5FC28C8 		vmovaps	%ymm0, %ymm1
+ 1191 0d18 EB90     		jmp	.L148
+ 1192              	.L143:
+ 1193 0d1a 418B4F4C 		movl	76(%r15), %ecx
+ 1194 0d1e 39F9     		cmpl	%edi, %ecx
+ 1195 0d20 0F8310FF 		jnb	.L144
+ 1195      FFFF
+ 1196              	.L152:
+ 1197 0d26 83E980   		subl	$-128, %ecx
+ 1198 0d29 41894F4C 		movl	%ecx, 76(%r15)
+ 1199 0d2d E904FFFF 		jmp	.L144
+ 1199      FF
+ 1200              	.L169:
+ 1201 0d32 C6460100 		movb	$0, 1(%rsi)
+ 1202 0d36 80780100 		cmpb	$0, 1(%rax)
+ 1203 0d3a 75EA     		jne	.L152
+ 1204 0d3c E9EDFEFF 		jmp	.L153
+ 1204      FF
+ 1205              		.cfi_endproc
+ 1206              	.LFE6403:
+ 1208 0d41 66662E0F 		.p2align 4
+ 1208      1F840000 
+ 1208      0000000F 
+ 1208      1F4000
+ 1210              	fir_process_2_256:
+ 1211              	.LFB6404:
+ 1212              		.cfi_startproc
+ 1213 0d50 81BFA400 		cmpl	$256, 164(%rdi)
+ 1213      00000001 
+ 1213      0000
+ 1214 0d5a 4889FA   		movq	%rdi, %rdx
+ 1215 0d5d 7541     		jne	.L200
+ 1216 0d5f 55       		pushq	%rbp
+ 1217              		.cfi_def_cfa_offset 16
+ 1218              		.cfi_offset 6, -16
+ 1219 0d60 4889E5   		movq	%rsp, %rbp
+ 1220              		.cfi_def_cfa_register 6
+ 1221 0d63 4157     		pushq	%r15
+ 1222 0d65 4156     		pushq	%r14
+ 1223 0d67 4155     		pushq	%r13
+ 1224 0d69 4154     		pushq	%r12
+ 1225 0d6b 53       		pushq	%rbx
+ 1226              		.cfi_offset 15, -24
+ 1227              		.cfi_offset 14, -32
+ 1228              		.cfi_offset 13, -40
+ 1229              		.cfi_offset 12, -48
+ 1230              		.cfi_offset 3, -56
+ 1231 0d6c 4C8B5F08 		movq	8(%rdi), %r11
+ 1232 0d70 4C8B5748 		movq	72(%rdi), %r10
+ 1233 0d74 488B5F10 		movq	16(%rdi), %rbx
+ 1234 0d78 4C89D8   		movq	%r11, %rax
+ 1235 0d7b 4C8B6750 		movq	80(%rdi), %r12
+ 1236 0d7f 4C09D0   		orq	%r10, %rax
+ 1237 0d82 4809D8   		orq	%rbx, %rax
+ 1238 0d85 4C09E0   		orq	%r12, %rax
+ 1239 0d88 A81F     		testb	$31, %al
+ 1240 0d8a 741C     		je	.L203
+ 1241 0d8c 5B       		popq	%rbx
+ 1242              		.cfi_restore 3
+ 1243 0d8d 415C     		popq	%r12
+ 1244              		.cfi_restore 12
+ 1245 0d8f 415D     		popq	%r13
+ 1246              		.cfi_restore 13
+ 1247 0d91 415E     		popq	%r14
+ 1248              		.cfi_restore 14
+ 1249 0d93 415F     		popq	%r15
+ 1250              		.cfi_restore 15
+ 1251 0d95 5D       		popq	%rbp
+ 1252              		.cfi_restore 6
+ 1253              		.cfi_def_cfa 7, 8
+ 1254 0d96 E9000000 		jmp	fir_process@PLT
+ 1254      00
+ 1255 0d9b 0F1F4400 		.p2align 4,,10
+ 1255      00
+ 1256              		.p2align 3
+ 1257              	.L200:
+ 1258 0da0 E9000000 		jmp	fir_process@PLT
+ 1258      00
+ 1259              		.p2align 4,,10
+ 1260 0da5 0F1F00   		.p2align 3
+ 1261              	.L203:
+ 1262              		.cfi_def_cfa 6, 16
+ 1263              		.cfi_offset 3, -56
+ 1264              		.cfi_offset 6, -16
+ 1265              		.cfi_offset 12, -48
+ 1266              		.cfi_offset 13, -40
+ 1267              		.cfi_offset 14, -32
+ 1268              		.cfi_offset 15, -24
+ 1269 0da8 488B8788 		movq	136(%rdi), %rax
+ 1269      000000
+ 1270 0daf 4C8BBFC0 		movq	192(%rdi), %r15
+ 1270      000000
+ 1271 0db6 4531C9   		xorl	%r9d, %r9d
+ 1272 0db9 488BB790 		movq	144(%rdi), %rsi
+ 1272      000000
+ 1273 0dc0 0FB608   		movzbl	(%rax), %ecx
+ 1274 0dc3 458B4744 		movl	68(%r15), %r8d
+ 1275 0dc7 418B7F40 		movl	64(%r15), %edi
+ 1276 0dcb 84C9     		testb	%cl, %cl
+ 1277 0dcd 740F     		je	.L172
+ 1278 0dcf 41397F48 		cmpl	%edi, 72(%r15)
+ 1279 0dd3 410F93C1 		setnb	%r9b
+ 1280 0dd7 0F93C1   		setnb	%cl
+ 1281 0dda 450FB6C9 		movzbl	%r9b, %r9d
+ 1282              	.L172:
+ 1283 0dde 880E     		movb	%cl, (%rsi)
+ 1284 0de0 803800   		cmpb	$0, (%rax)
+ 1285 0de3 0F85AF00 		jne	.L173
+ 1285      0000
+ 1286 0de9 41C74748 		movl	$0, 72(%r15)
+ 1286      00000000 
+ 1287              	.L174:
+ 1288 0df1 80780100 		cmpb	$0, 1(%rax)
+ 1289 0df5 0F84BD00 		je	.L175
+ 1289      0000
+ 1290 0dfb 418B4F4C 		movl	76(%r15), %ecx
+ 1291 0dff 39F9     		cmpl	%edi, %ecx
+ 1292 0e01 0F82C601 		jb	.L204
+ 1292      0000
+ 1293 0e07 C6460101 		movb	$1, 1(%rsi)
+ 1294 0e0b 80780100 		cmpb	$0, 1(%rax)
+ 1295 0e0f 7508     		jne	.L180
+ 1296 0e11 41C7474C 		movl	$0, 76(%r15)
+ 1296      00000000 
+ 1297              	.L180:
+ 1298 0e19 4585C9   		testl	%r9d, %r9d
+ 1299 0e1c 0F84AC00 		je	.L179
+ 1299      0000
+ 1300 0e22 498D7A08 		leaq	8(%r10), %rdi
+ 1301 0e26 49C70200 		movq	$0, (%r10)
+ 1301      000000
+ 1302 0e2d 31C0     		xorl	%eax, %eax
+ 1303 0e2f 49C782F8 		movq	$0, 1016(%r10)
+ 1303      03000000 
+ 1303      000000
+ 1304 0e3a 4883E7F8 		andq	$-8, %rdi
+ 1305 0e3e 4929FA   		subq	%rdi, %r10
+ 1306 0e41 418D8A00 		leal	1024(%r10), %ecx
+ 1306      040000
+ 1307 0e48 C1E903   		shrl	$3, %ecx
+ 1308 0e4b F348AB   		rep stosq
+ 1309 0e4e 488B5250 		movq	80(%rdx), %rdx
+ 1310 0e52 488D7A08 		leaq	8(%rdx), %rdi
+ 1311 0e56 48C70200 		movq	$0, (%rdx)
+ 1311      000000
+ 1312 0e5d 48C782F8 		movq	$0, 1016(%rdx)
+ 1312      03000000 
+ 1312      000000
+ 1313 0e68 4883E7F8 		andq	$-8, %rdi
+ 1314 0e6c 4829FA   		subq	%rdi, %rdx
+ 1315 0e6f 8D8A0004 		leal	1024(%rdx), %ecx
+ 1315      0000
+ 1316 0e75 31D2     		xorl	%edx, %edx
+ 1317 0e77 C1E903   		shrl	$3, %ecx
+ 1318 0e7a F348AB   		rep stosq
+ 1319 0e7d 498D8000 		leaq	256(%r8), %rax
+ 1319      010000
+ 1320 0e84 418B4F40 		movl	64(%r15), %ecx
+ 1321 0e88 48F7F1   		divq	%rcx
+ 1322 0e8b 41895744 		movl	%edx, 68(%r15)
+ 1323 0e8f E9030100 		jmp	.L198
+ 1323      00
+ 1324              		.p2align 4,,10
+ 1325 0e94 0F1F4000 		.p2align 3
+ 1326              	.L173:
+ 1327 0e98 418B4F48 		movl	72(%r15), %ecx
+ 1328 0e9c 39F9     		cmpl	%edi, %ecx
+ 1329 0e9e 0F834DFF 		jnb	.L174
+ 1329      FFFF
+ 1330 0ea4 81C10001 		addl	$256, %ecx
+ 1330      0000
+ 1331 0eaa 41894F48 		movl	%ecx, 72(%r15)
+ 1332 0eae E93EFFFF 		jmp	.L174
+ 1332      FF
+ 1333              		.p2align 4,,10
+ 1334 0eb3 0F1F4400 		.p2align 3
+ 1334      00
+ 1335              	.L175:
+ 1336 0eb8 C6460100 		movb	$0, 1(%rsi)
+ 1337 0ebc 80780100 		cmpb	$0, 1(%rax)
+ 1338 0ec0 0F85EC00 		jne	.L178
+ 1338      0000
+ 1339              	.L188:
+ 1340 0ec6 41C7474C 		movl	$0, 76(%r15)
+ 1340      00000000 
+ 1341              	.L179:
+ 1342 0ece 498B4F08 		movq	8(%r15), %rcx
+ 1343 0ed2 89FA     		movl	%edi, %edx
+ 1344 0ed4 4D8B6F10 		movq	16(%r15), %r13
+ 1345 0ed8 448D77FF 		leal	-1(%rdi), %r14d
+ 1346 0edc 4531C9   		xorl	%r9d, %r9d
+ 1347 0edf 488D3491 		leaq	(%rcx,%rdx,4), %rsi
+ 1348              		.p2align 4,,10
+ 1349 0ee3 0F1F4400 		.p2align 3
+ 1349      00
+ 1350              	.L186:
+ 1351 0ee8 C4817A10 		vmovss	(%r11,%r9), %xmm0
+ 1351      040B
+ 1352 0eee 4C89F0   		movq	%r14, %rax
+ 1353 0ef1 4C29C0   		subq	%r8, %rax
+ 1354 0ef4 C4A17A11 		vmovss	%xmm0, (%rcx,%r8,4)
+ 1354      0481
+ 1355 0efa C4A17A10 		vmovss	(%rbx,%r9), %xmm0
+ 1355      040B
+ 1356 0f00 488D3C85 		leaq	0(,%rax,4), %rdi
+ 1356      00000000 
+ 1357 0f08 C4A17A11 		vmovss	%xmm0, (%rsi,%r8,4)
+ 1357      0486
+ 1358 0f0e 4885D2   		testq	%rdx, %rdx
+ 1359 0f11 0F849100 		je	.L190
+ 1359      0000
+ 1360 0f17 C5F857C0 		vxorps	%xmm0, %xmm0, %xmm0
+ 1361 0f1b 31C0     		xorl	%eax, %eax
+ 1362 0f1d 4C01EF   		addq	%r13, %rdi
+ 1363 0f20 C5FC28C8 		vmovaps	%ymm0, %ymm1
+ 1364              		.p2align 4,,10
+ 1365 0f24 0F1F4000 		.p2align 3
+ 1366              	.L184:
+ 1367 0f28 C5FC1024 		vmovups	(%rdi,%rax,4), %ymm4
+ 1367      87
+ 1368 0f2d C4E25DB8 		vfmadd231ps	(%rcx,%rax,4), %ymm4, %ymm1
+ 1368      0C81
+ 1369 0f33 C4E25DB8 		vfmadd231ps	(%rsi,%rax,4), %ymm4, %ymm0
+ 1369      0486
+ 1370 0f39 4883C008 		addq	$8, %rax
+ 1371 0f3d 4839D0   		cmpq	%rdx, %rax
+ 1372 0f40 72E6     		jb	.L184
+ 1373              	.L183:
+ 1374 0f42 C5F77CC9 		vhaddps	%ymm1, %ymm1, %ymm1
+ 1375 0f46 C5FF7CC0 		vhaddps	%ymm0, %ymm0, %ymm0
+ 1376 0f4a 4983C001 		addq	$1, %r8
+ 1377 0f4e 31C0     		xorl	%eax, %eax
+ 1378 0f50 4C39C2   		cmpq	%r8, %rdx
+ 1379 0f53 4C0F44C0 		cmove	%rax, %r8
+ 1380 0f57 C5F77CC9 		vhaddps	%ymm1, %ymm1, %ymm1
+ 1381 0f5b C5FF7CC0 		vhaddps	%ymm0, %ymm0, %ymm0
+ 1382 0f5f C4E37D19 		vextractf128	$0x1, %ymm1, %xmm3
+ 1382      CB01
+ 1383 0f65 C4E37D19 		vextractf128	$0x1, %ymm0, %xmm2
+ 1383      C201
+ 1384 0f6b C5E058C9 		vaddps	%xmm1, %xmm3, %xmm1
+ 1385 0f6f C5E858C0 		vaddps	%xmm0, %xmm2, %xmm0
+ 1386 0f73 C4817A11 		vmovss	%xmm1, (%r10,%r9)
+ 1386      0C0A
+ 1387 0f79 C4817A11 		vmovss	%xmm0, (%r12,%r9)
+ 1387      040C
+ 1388 0f7f 4983C104 		addq	$4, %r9
+ 1389 0f83 4981F900 		cmpq	$1024, %r9
+ 1389      040000
+ 1390 0f8a 0F8558FF 		jne	.L186
+ 1390      FFFF
+ 1391 0f90 45894744 		movl	%r8d, 68(%r15)
+ 1392 0f94 C5F877   		vzeroupper
+ 1393              	.L198:
+ 1394 0f97 5B       		popq	%rbx
+ 1395 0f98 415C     		popq	%r12
+ 1396 0f9a 415D     		popq	%r13
+ 1397 0f9c 415E     		popq	%r14
+ 1398 0f9e 415F     		popq	%r15
+ 1399 0fa0 5D       		popq	%rbp
+ 1400              		.cfi_remember_state
+ 1401              		.cfi_def_cfa 7, 8
+ 1402 0fa1 C3       		ret
+ 1403              		.p2align 4,,10
+ 1404 0fa2 660F1F44 		.p2align 3
+ 1404      0000
+ 1405              	.L190:
+ 1406              		.cfi_restore_state
+ 1407 0fa8 C5F857C0 		vxorps	%xmm0, %xmm0, %xmm0
+ 1408 0fac C5FC28C8 		vmovaps	%ymm0, %ymm1
+ 1409 0fb0 EB90     		jmp	.L183
+ 1410              	.L178:
+ 1411 0fb2 418B4F4C 		movl	76(%r15), %ecx
+ 1412 0fb6 39F9     		cmpl	%edi, %ecx
+ 1413 0fb8 0F8310FF 		jnb	.L179
+ 1413      FFFF
+ 1414              	.L187:
+ 1415 0fbe 81C10001 		addl	$256, %ecx
+ 1415      0000
+ 1416 0fc4 41894F4C 		movl	%ecx, 76(%r15)
+ 1417 0fc8 E901FFFF 		jmp	.L179
+ 1417      FF
+ 1418              	.L204:
+ 1419 0fcd C6460100 		movb	$0, 1(%rsi)
+ 1420 0fd1 80780100 		cmpb	$0, 1(%rax)
+ 1421 0fd5 75E7     		jne	.L187
+ 1422 0fd7 E9EAFEFF 		jmp	.L188
+ 1422      FF
+ 1423              		.cfi_endproc
+ 1424              	.LFE6404:
+ 1426 0fdc 0F1F4000 		.p2align 4
+ 1428              	fir_process_8_64:
+ 1429              	.LFB6405:
+ 1430              		.cfi_startproc
+ 1431 0fe0 83BFA400 		cmpl	$64, 164(%rdi)
+ 1431      000040
+ 1432 0fe7 0F853702 		jne	.L206
+ 1432      0000
+ 1433 0fed 62F1FE48 		vmovdqu64	72(%rdi), %zmm4
+ 1433      6FA74800 
+ 1433      0000
+ 1434 0ff7 62F1DD48 		vporq	8(%rdi), %zmm4, %zmm0
+ 1434      EB870800 
+ 1434      0000
+ 1435 1001 62F3FD48 		vextracti64x4	$0x1, %zmm0, %ymm1
+ 1435      3BC101
+ 1436 1008 C5F5EBC8 		vpor	%ymm0, %ymm1, %ymm1
+ 1437 100c 62F3FD28 		vextracti64x2	$0x1, %ymm1, %xmm0
+ 1437      39C801
+ 1438 1013 C5F9EBC1 		vpor	%xmm1, %xmm0, %xmm0
+ 1439 1017 C5F173D8 		vpsrldq	$8, %xmm0, %xmm1
+ 1439      08
+ 1440 101c C5F9EBC1 		vpor	%xmm1, %xmm0, %xmm0
+ 1441 1020 C4E1F97E 		vmovq	%xmm0, %rax
+ 1441      C0
+ 1442 1025 A81F     		testb	$31, %al
+ 1443 1027 0F85F401 		jne	.L226
+ 1443      0000
+ 1444 102d 55       		pushq	%rbp
+ 1445              		.cfi_def_cfa_offset 16
+ 1446              		.cfi_offset 6, -16
+ 1447 102e 31C9     		xorl	%ecx, %ecx
+ 1448 1030 C5C9EFF6 		vpxor	%xmm6, %xmm6, %xmm6
+ 1449 1034 4989F9   		movq	%rdi, %r9
+ 1450 1037 4889E5   		movq	%rsp, %rbp
+ 1451              		.cfi_def_cfa_register 6
+ 1452 103a 4157     		pushq	%r15
+ 1453 103c 4156     		pushq	%r14
+ 1454 103e 4155     		pushq	%r13
+ 1455 1040 4154     		pushq	%r12
+ 1456 1042 53       		pushq	%rbx
+ 1457 1043 4883E4C0 		andq	$-64, %rsp
+ 1458              		.cfi_offset 15, -24
+ 1459              		.cfi_offset 14, -32
+ 1460              		.cfi_offset 13, -40
+ 1461              		.cfi_offset 12, -48
+ 1462              		.cfi_offset 3, -56
+ 1463 1047 488B9FC0 		movq	192(%rdi), %rbx
+ 1463      000000
+ 1464 104e 4889DE   		movq	%rbx, %rsi
+ 1465 1051 EB5A     		jmp	.L217
+ 1466              		.p2align 4,,10
+ 1467 1053 0F1F4400 		.p2align 3
+ 1467      00
+ 1468              	.L232:
+ 1469 1058 448B448E 		movl	72(%rsi,%rcx,4), %r8d
+ 1469      48
+ 1470 105d 443B4640 		cmpl	64(%rsi), %r8d
+ 1471 1061 0F82E601 		jb	.L208
+ 1471      0000
+ 1472 1067 41C60201 		movb	$1, (%r10)
+ 1473 106b 803800   		cmpb	$0, (%rax)
+ 1474 106e 7508     		jne	.L209
+ 1475 1070 C7448E48 		movl	$0, 72(%rsi,%rcx,4)
+ 1475      00000000 
+ 1476              	.L209:
+ 1477 1078 62F17F48 		vmovdqu8	%zmm6, (%rdi)
+ 1477      7F37
+ 1478 107e 488D4240 		leaq	64(%rdx), %rax
+ 1479 1082 31D2     		xorl	%edx, %edx
+ 1480 1084 4883C101 		addq	$1, %rcx
+ 1481 1088 62F17F48 		vmovdqu8	%zmm6, 64(%rdi)
+ 1481      7F7701
+ 1482 108f 62F17F48 		vmovdqu8	%zmm6, 128(%rdi)
+ 1482      7F7702
+ 1483 1096 62F17F48 		vmovdqu8	%zmm6, 192(%rdi)
+ 1483      7F7703
+ 1484 109d 8B7E40   		movl	64(%rsi), %edi
+ 1485 10a0 48F7F7   		divq	%rdi
+ 1486 10a3 4883F908 		cmpq	$8, %rcx
+ 1487 10a7 0F845F01 		je	.L231
+ 1487      0000
+ 1488              	.L217:
+ 1489 10ad 498B8188 		movq	136(%r9), %rax
+ 1489      000000
+ 1490 10b4 4D8B9190 		movq	144(%r9), %r10
+ 1490      000000
+ 1491 10bb 498B5CC9 		movq	8(%r9,%rcx,8), %rbx
+ 1491      08
+ 1492 10c0 498B7CC9 		movq	72(%r9,%rcx,8), %rdi
+ 1492      48
+ 1493 10c5 4801C8   		addq	%rcx, %rax
+ 1494 10c8 4901CA   		addq	%rcx, %r10
+ 1495 10cb 8B5644   		movl	68(%rsi), %edx
+ 1496 10ce 803800   		cmpb	$0, (%rax)
+ 1497 10d1 7585     		jne	.L232
+ 1498 10d3 41C60200 		movb	$0, (%r10)
+ 1499 10d7 803800   		cmpb	$0, (%rax)
+ 1500 10da 0F845D01 		je	.L220
+ 1500      0000
+ 1501 10e0 448B448E 		movl	72(%rsi,%rcx,4), %r8d
+ 1501      48
+ 1502 10e5 8B4640   		movl	64(%rsi), %eax
+ 1503 10e8 4139C0   		cmpl	%eax, %r8d
+ 1504 10eb 0F826501 		jb	.L219
+ 1504      0000
+ 1505              	.L211:
+ 1506 10f1 4189C6   		movl	%eax, %r14d
+ 1507 10f4 4C8B4608 		movq	8(%rsi), %r8
+ 1508 10f8 4189C5   		movl	%eax, %r13d
+ 1509 10fb 4531E4   		xorl	%r12d, %r12d
+ 1510 10fe 4D89F2   		movq	%r14, %r10
+ 1511 1101 41D1ED   		shrl	%r13d
+ 1512 1104 4C897424 		movq	%r14, -8(%rsp)
+ 1512      F8
+ 1513 1109 4C8B7610 		movq	16(%rsi), %r14
+ 1514 110d 4C0FAFD1 		imulq	%rcx, %r10
+ 1515 1111 83E801   		subl	$1, %eax
+ 1516 1114 48894C24 		movq	%rcx, -16(%rsp)
+ 1516      F0
+ 1517 1119 4C89E1   		movq	%r12, %rcx
+ 1518 111c C4E1F96E 		vmovq	%rsi, %xmm5
+ 1518      EE
+ 1519 1121 C4C1F96E 		vmovq	%r9, %xmm7
+ 1519      F9
+ 1520 1126 4889FE   		movq	%rdi, %rsi
+ 1521 1129 4D89F1   		movq	%r14, %r9
+ 1522 112c 4989C6   		movq	%rax, %r14
+ 1523 112f 4F8D0490 		leaq	(%r8,%r10,4), %r8
+ 1524 1133 4589EA   		movl	%r13d, %r10d
+ 1525 1136 4E8D3C95 		leaq	0(,%r10,4), %r15
+ 1525      00000000 
+ 1526 113e 4F8D1C38 		leaq	(%r8,%r15), %r11
+ 1527 1142 4C89FF   		movq	%r15, %rdi
+ 1528 1145 4989DF   		movq	%rbx, %r15
+ 1529 1148 4489EB   		movl	%r13d, %ebx
+ 1530 114b 0F1F4400 		.p2align 4,,10
+ 1530      00
+ 1531              		.p2align 3
+ 1532              	.L216:
+ 1533 1150 C4C17A10 		vmovss	(%r15,%rcx), %xmm0
+ 1533      040F
+ 1534 1156 4C89F0   		movq	%r14, %rax
+ 1535 1159 4829D0   		subq	%rdx, %rax
+ 1536 115c 4D8D2481 		leaq	(%r9,%rax,4), %r12
+ 1537 1160 C4C17A11 		vmovss	%xmm0, (%r8,%rdx,4)
+ 1537      0490
+ 1538 1166 85DB     		testl	%ebx, %ebx
+ 1539 1168 0F84C200 		je	.L221
+ 1539      0000
+ 1540 116e C5F857C0 		vxorps	%xmm0, %xmm0, %xmm0
+ 1541 1172 31C0     		xorl	%eax, %eax
+ 1542 1174 4D8D2C3C 		leaq	(%r12,%rdi), %r13
+ 1543 1178 C5FC28C8 		vmovaps	%ymm0, %ymm1
+ 1544 117c 0F1F4000 		.p2align 4,,10
+ 1545              		.p2align 3
+ 1546              	.L214:
+ 1547 1180 C4C17C10 		vmovups	(%r12,%rax,4), %ymm4
+ 1547      2484
+ 1548 1186 C4C17C10 		vmovups	0(%r13,%rax,4), %ymm2
+ 1548      548500
+ 1549 118d C4C25DB8 		vfmadd231ps	(%r8,%rax,4), %ymm4, %ymm1
+ 1549      0C80
+ 1550 1193 C4C26DB8 		vfmadd231ps	(%r11,%rax,4), %ymm2, %ymm0
+ 1550      0483
+ 1551 1199 4883C008 		addq	$8, %rax
+ 1552 119d 4C39D0   		cmpq	%r10, %rax
+ 1553 11a0 72DE     		jb	.L214
+ 1554              	.L213:
+ 1555 11a2 C5F77CC9 		vhaddps	%ymm1, %ymm1, %ymm1
+ 1556 11a6 C5FF7CC0 		vhaddps	%ymm0, %ymm0, %ymm0
+ 1557 11aa 4883C201 		addq	$1, %rdx
+ 1558 11ae 31C0     		xorl	%eax, %eax
+ 1559 11b0 48395424 		cmpq	%rdx, -8(%rsp)
+ 1559      F8
+ 1560 11b5 480F44D0 		cmove	%rax, %rdx
+ 1561 11b9 C5F77CC9 		vhaddps	%ymm1, %ymm1, %ymm1
+ 1562 11bd C5FF7CC0 		vhaddps	%ymm0, %ymm0, %ymm0
+ 1563 11c1 C4E37D19 		vextractf128	$0x1, %ymm1, %xmm2
+ 1563      CA01
+ 1564 11c7 C4E37D19 		vextractf128	$0x1, %ymm0, %xmm3
+ 1564      C301
+ 1565 11cd C5E858C9 		vaddps	%xmm1, %xmm2, %xmm1
+ 1566 11d1 C5E058C0 		vaddps	%xmm0, %xmm3, %xmm0
+ 1567 11d5 C5F258C0 		vaddss	%xmm0, %xmm1, %xmm0
+ 1568 11d9 C5FA1104 		vmovss	%xmm0, (%rsi,%rcx)
+ 1568      0E
+ 1569 11de 4883C104 		addq	$4, %rcx
+ 1570 11e2 4881F900 		cmpq	$256, %rcx
+ 1570      010000
+ 1571 11e9 0F8561FF 		jne	.L216
+ 1571      FFFF
+ 1572 11ef 488B4C24 		movq	-16(%rsp), %rcx
+ 1572      F0
+ 1573 11f4 C4E1F97E 		vmovq	%xmm5, %rsi
+ 1573      EE
+ 1574 11f9 C4C1F97E 		vmovq	%xmm7, %r9
+ 1574      F9
+ 1575 11fe 4883C101 		addq	$1, %rcx
+ 1576 1202 4883F908 		cmpq	$8, %rcx
+ 1577 1206 0F85A1FE 		jne	.L217
+ 1577      FFFF
+ 1578              	.L231:
+ 1579 120c 895644   		movl	%edx, 68(%rsi)
+ 1580 120f C5F877   		vzeroupper
+ 1581 1212 488D65D8 		leaq	-40(%rbp), %rsp
+ 1582 1216 5B       		popq	%rbx
+ 1583 1217 415C     		popq	%r12
+ 1584 1219 415D     		popq	%r13
+ 1585 121b 415E     		popq	%r14
+ 1586 121d 415F     		popq	%r15
+ 1587 121f 5D       		popq	%rbp
+ 1588              		.cfi_def_cfa 7, 8
+ 1589 1220 C3       		ret
+ 1590              	.L226:
+ 1591              		.cfi_restore 3
+ 1592              		.cfi_restore 6
+ 1593              		.cfi_restore 12
+ 1594              		.cfi_restore 13
+ 1595              		.cfi_restore 14
+ 1596              		.cfi_restore 15
+ 1597 1221 C5F877   		vzeroupper
+ 1598              	.L206:
+ 1599 1224 E9000000 		jmp	fir_process@PLT
+ 1599      00
+ 1600 1229 0F1F8000 		.p2align 4,,10
+ 1600      000000
+ 1601              		.p2align 3
+ 1602              	.L221:
+ 1603              		.cfi_def_cfa 6, 16
+ 1604              		.cfi_offset 3, -56
+ 1605              		.cfi_offset 6, -16
+ 1606              		.cfi_offset 12, -48
+ 1607              		.cfi_offset 13, -40
+ 1608              		.cfi_offset 14, -32
+ 1609              		.cfi_offset 15, -24
+ 1610 1230 C5F857C0 		vxorps	%xmm0, %xmm0, %xmm0
+ 1611 1234 C5FC28C8 		vmovaps	%ymm0, %ymm1
+ 1612 1238 E965FFFF 		jmp	.L213
+ 1612      FF
+ 1613              	.L220:
+ 1614 123d C7448E48 		movl	$0, 72(%rsi,%rcx,4)
+ 1614      00000000 
+ 1615 1245 8B4640   		movl	64(%rsi), %eax
+ 1616 1248 E9A4FEFF 		jmp	.L211
+ 1616      FF
+ 1617              	.L208:
+ 1618 124d 41C60200 		movb	$0, (%r10)
+ 1619 1251 803800   		cmpb	$0, (%rax)
+ 1620 1254 74E7     		je	.L220
+ 1621              	.L219:
+ 1622 1256 4183C040 		addl	$64, %r8d
+ 1623 125a 4489448E 		movl	%r8d, 72(%rsi,%rcx,4)
+ 1623      48
+ 1624 125f 8B4640   		movl	64(%rsi), %eax
+ 1625 1262 E98AFEFF 		jmp	.L211
+ 1625      FF
+ 1626              		.cfi_endproc
+ 1627              	.LFE6405:
+ 1629 1267 660F1F84 		.p2align 4
+ 1629      00000000 
+ 1629      00
+ 1631              	fir_process_8_128:
+ 1632              	.LFB6406:
+ 1633              		.cfi_startproc
+ 1634 1270 55       		pushq	%rbp
+ 1635              		.cfi_def_cfa_offset 16
+ 1636              		.cfi_offset 6, -16
+ 1637 1271 4889E5   		movq	%rsp, %rbp
+ 1638              		.cfi_def_cfa_register 6
+ 1639 1274 4157     		pushq	%r15
+ 1640              		.cfi_offset 15, -24
+ 1641 1276 4989FF   		movq	%rdi, %r15
+ 1642 1279 4156     		pushq	%r14
+ 1643 127b 4155     		pushq	%r13
+ 1644 127d 4154     		pushq	%r12
+ 1645 127f 53       		pushq	%rbx
+ 1646 1280 4883E4C0 		andq	$-64, %rsp
+ 1647              		.cfi_offset 14, -32
+ 1648              		.cfi_offset 13, -40
+ 1649              		.cfi_offset 12, -48
+ 1650              		.cfi_offset 3, -56
+ 1651 1284 81BFA400 		cmpl	$128, 164(%rdi)
+ 1651      00008000 
+ 1651      0000
+ 1652 128e 0F851802 		jne	.L234
+ 1652      0000
+ 1653 1294 62F1FE48 		vmovdqu64	72(%rdi), %zmm4
+ 1653      6FA74800 
+ 1653      0000
+ 1654 129e 62F1DD48 		vporq	8(%rdi), %zmm4, %zmm0
+ 1654      EB870800 
+ 1654      0000
+ 1655 12a8 62F3FD48 		vextracti64x4	$0x1, %zmm0, %ymm1
+ 1655      3BC101
+ 1656 12af C5F5EBC8 		vpor	%ymm0, %ymm1, %ymm1
+ 1657 12b3 62F3FD28 		vextracti64x2	$0x1, %ymm1, %xmm0
+ 1657      39C801
+ 1658 12ba C5F9EBC1 		vpor	%xmm1, %xmm0, %xmm0
+ 1659 12be C5F173D8 		vpsrldq	$8, %xmm0, %xmm1
+ 1659      08
+ 1660 12c3 C5F9EBC1 		vpor	%xmm1, %xmm0, %xmm0
+ 1661 12c7 C4E1F97E 		vmovq	%xmm0, %rax
+ 1661      C0
+ 1662 12cc A81F     		testb	$31, %al
+ 1663 12ce 0F85D501 		jne	.L254
+ 1663      0000
+ 1664 12d4 4C8B9FC0 		movq	192(%rdi), %r11
+ 1664      000000
+ 1665 12db 4531D2   		xorl	%r10d, %r10d
+ 1666 12de C4E1F96E 		vmovq	%rdi, %xmm7
+ 1666      FF
+ 1667 12e3 4D89DE   		movq	%r11, %r14
+ 1668 12e6 EB53     		jmp	.L245
+ 1669 12e8 0F1F8400 		.p2align 4,,10
+ 1669      00000000 
+ 1670              		.p2align 3
+ 1671              	.L258:
+ 1672 12f0 438B4C96 		movl	72(%r14,%r10,4), %ecx
+ 1672      48
+ 1673 12f5 413B4E40 		cmpl	64(%r14), %ecx
+ 1674 12f9 0F82E801 		jb	.L236
+ 1674      0000
+ 1675 12ff C60601   		movb	$1, (%rsi)
+ 1676 1302 803800   		cmpb	$0, (%rax)
+ 1677 1305 7509     		jne	.L237
+ 1678 1307 43C74496 		movl	$0, 72(%r14,%r10,4)
+ 1678      48000000 
+ 1678      00
+ 1679              	.L237:
+ 1680 1310 31C0     		xorl	%eax, %eax
+ 1681 1312 B9400000 		movl	$64, %ecx
+ 1681      00
+ 1682 1317 4C89FF   		movq	%r15, %rdi
+ 1683 131a 4983C201 		addq	$1, %r10
+ 1684 131e F348AB   		rep stosq
+ 1685 1321 488D8280 		leaq	128(%rdx), %rax
+ 1685      000000
+ 1686 1328 31D2     		xorl	%edx, %edx
+ 1687 132a 418B4E40 		movl	64(%r14), %ecx
+ 1688 132e 48F7F1   		divq	%rcx
+ 1689 1331 4983FA08 		cmpq	$8, %r10
+ 1690 1335 0F845801 		je	.L257
+ 1690      0000
+ 1691              	.L245:
+ 1692 133b C4E1F97E 		vmovq	%xmm7, %rax
+ 1692      F8
+ 1693 1340 C4E1F97E 		vmovq	%xmm7, %rbx
+ 1693      FB
+ 1694 1345 418B5644 		movl	68(%r14), %edx
+ 1695 1349 4E8B5CD0 		movq	8(%rax,%r10,8), %r11
+ 1695      08
+ 1696 134e 4E8B7CD0 		movq	72(%rax,%r10,8), %r15
+ 1696      48
+ 1697 1353 488B8088 		movq	136(%rax), %rax
+ 1697      000000
+ 1698 135a 488BB390 		movq	144(%rbx), %rsi
+ 1698      000000
+ 1699 1361 4C01D0   		addq	%r10, %rax
+ 1700 1364 4C01D6   		addq	%r10, %rsi
+ 1701 1367 803800   		cmpb	$0, (%rax)
+ 1702 136a 7584     		jne	.L258
+ 1703 136c C60600   		movb	$0, (%rsi)
+ 1704 136f 803800   		cmpb	$0, (%rax)
+ 1705 1372 0F845D01 		je	.L248
+ 1705      0000
+ 1706 1378 438B4C96 		movl	72(%r14,%r10,4), %ecx
+ 1706      48
+ 1707 137d 418B4640 		movl	64(%r14), %eax
+ 1708 1381 39C1     		cmpl	%eax, %ecx
+ 1709 1383 0F826601 		jb	.L247
+ 1709      0000
+ 1710              	.L239:
+ 1711 1389 89C7     		movl	%eax, %edi
+ 1712 138b 4189C4   		movl	%eax, %r12d
+ 1713 138e 498B4E08 		movq	8(%r14), %rcx
+ 1714 1392 C4C17A7E 		vmovq	16(%r14), %xmm5
+ 1714      6E10
+ 1715 1398 4889FE   		movq	%rdi, %rsi
+ 1716 139b 41D1EC   		shrl	%r12d
+ 1717 139e 83E801   		subl	$1, %eax
+ 1718 13a1 4C895424 		movq	%r10, -16(%rsp)
+ 1718      F0
+ 1719 13a6 490FAFF2 		imulq	%r10, %rsi
+ 1720 13aa 4589E0   		movl	%r12d, %r8d
+ 1721 13ad 48894424 		movq	%rax, -8(%rsp)
+ 1721      F8
+ 1722 13b2 4589E2   		movl	%r12d, %r10d
+ 1723 13b5 4E8D2C85 		leaq	0(,%r8,4), %r13
+ 1723      00000000 
+ 1724 13bd C4E1F97E 		vmovq	%xmm5, %rax
+ 1724      E8
+ 1725 13c2 31DB     		xorl	%ebx, %ebx
+ 1726 13c4 4989FC   		movq	%rdi, %r12
+ 1727 13c7 C4C1F96E 		vmovq	%r14, %xmm5
+ 1727      EE
+ 1728 13cc 4989C6   		movq	%rax, %r14
+ 1729 13cf 488D34B1 		leaq	(%rcx,%rsi,4), %rsi
+ 1730 13d3 4C89E9   		movq	%r13, %rcx
+ 1731 13d6 4E8D0C2E 		leaq	(%rsi,%r13), %r9
+ 1732 13da 4D89DD   		movq	%r11, %r13
+ 1733 13dd 4989CB   		movq	%rcx, %r11
+ 1734              		.p2align 4,,10
+ 1735              		.p2align 3
+ 1736              	.L244:
+ 1737 13e0 488B4424 		movq	-8(%rsp), %rax
+ 1737      F8
+ 1738 13e5 C4C17A10 		vmovss	0(%r13,%rbx), %xmm0
+ 1738      441D00
+ 1739 13ec 4829D0   		subq	%rdx, %rax
+ 1740 13ef C5FA1104 		vmovss	%xmm0, (%rsi,%rdx,4)
+ 1740      96
+ 1741 13f4 498D0C86 		leaq	(%r14,%rax,4), %rcx
+ 1742 13f8 4585D2   		testl	%r10d, %r10d
+ 1743 13fb 0F84C700 		je	.L249
+ 1743      0000
+ 1744 1401 C5F857C0 		vxorps	%xmm0, %xmm0, %xmm0
+ 1745 1405 31C0     		xorl	%eax, %eax
+ 1746 1407 4A8D3C19 		leaq	(%rcx,%r11), %rdi
+ 1747 140b C5FC28C8 		vmovaps	%ymm0, %ymm1
+ 1748 140f 90       		.p2align 4,,10
+ 1749              		.p2align 3
+ 1750              	.L242:
+ 1751 1410 C5FC1034 		vmovups	(%rcx,%rax,4), %ymm6
+ 1751      81
+ 1752 1415 C5FC1024 		vmovups	(%rdi,%rax,4), %ymm4
+ 1752      87
+ 1753 141a C4E24DB8 		vfmadd231ps	(%rsi,%rax,4), %ymm6, %ymm1
+ 1753      0C86
+ 1754 1420 C4C25DB8 		vfmadd231ps	(%r9,%rax,4), %ymm4, %ymm0
+ 1754      0481
+ 1755 1426 4883C008 		addq	$8, %rax
+ 1756 142a 4C39C0   		cmpq	%r8, %rax
+ 1757 142d 72E1     		jb	.L242
+ 1758              	.L241:
+ 1759 142f C5F77CC9 		vhaddps	%ymm1, %ymm1, %ymm1
+ 1760 1433 C5FF7CC0 		vhaddps	%ymm0, %ymm0, %ymm0
+ 1761 1437 4883C201 		addq	$1, %rdx
+ 1762 143b 31C0     		xorl	%eax, %eax
+ 1763 143d 4939D4   		cmpq	%rdx, %r12
+ 1764 1440 480F44D0 		cmove	%rax, %rdx
+ 1765 1444 C5F77CC9 		vhaddps	%ymm1, %ymm1, %ymm1
+ 1766 1448 C5FF7CC0 		vhaddps	%ymm0, %ymm0, %ymm0
+ 1767 144c C4E37D19 		vextractf128	$0x1, %ymm1, %xmm2
+ 1767      CA01
+ 1768 1452 C4E37D19 		vextractf128	$0x1, %ymm0, %xmm3
+ 1768      C301
+ 1769 1458 C5E858C9 		vaddps	%xmm1, %xmm2, %xmm1
+ 1770 145c C5E058C0 		vaddps	%xmm0, %xmm3, %xmm0
+ 1771 1460 C5F258C0 		vaddss	%xmm0, %xmm1, %xmm0
+ 1772 1464 C4C17A11 		vmovss	%xmm0, (%r15,%rbx)
+ 1772      041F
+ 1773 146a 4883C304 		addq	$4, %rbx
+ 1774 146e 4881FB00 		cmpq	$512, %rbx
+ 1774      020000
+ 1775 1475 0F8565FF 		jne	.L244
+ 1775      FFFF
+ 1776 147b 4C8B5424 		movq	-16(%rsp), %r10
+ 1776      F0
+ 1777 1480 C4C1F97E 		vmovq	%xmm5, %r14
+ 1777      EE
+ 1778 1485 4983C201 		addq	$1, %r10
+ 1779 1489 4983FA08 		cmpq	$8, %r10
+ 1780 148d 0F85A8FE 		jne	.L245
+ 1780      FFFF
+ 1781              	.L257:
+ 1782 1493 41895644 		movl	%edx, 68(%r14)
+ 1783 1497 C5F877   		vzeroupper
+ 1784 149a 488D65D8 		leaq	-40(%rbp), %rsp
+ 1785 149e 5B       		popq	%rbx
+ 1786 149f 415C     		popq	%r12
+ 1787 14a1 415D     		popq	%r13
+ 1788 14a3 415E     		popq	%r14
+ 1789 14a5 415F     		popq	%r15
+ 1790 14a7 5D       		popq	%rbp
+ 1791              		.cfi_remember_state
+ 1792              		.cfi_def_cfa 7, 8
+ 1793 14a8 C3       		ret
+ 1794              	.L254:
+ 1795              		.cfi_restore_state
+ 1796 14a9 C5F877   		vzeroupper
+ 1797              	.L234:
+ 1798 14ac 488D65D8 		leaq	-40(%rbp), %rsp
+ 1799 14b0 4C89FF   		movq	%r15, %rdi
+ 1800 14b3 5B       		popq	%rbx
+ 1801 14b4 415C     		popq	%r12
+ 1802 14b6 415D     		popq	%r13
+ 1803 14b8 415E     		popq	%r14
+ 1804 14ba 415F     		popq	%r15
+ 1805 14bc 5D       		popq	%rbp
+ 1806              		.cfi_remember_state
+ 1807              		.cfi_def_cfa 7, 8
+ 1808 14bd E9000000 		jmp	fir_process@PLT
+ 1808      00
+ 1809              		.p2align 4,,10
+ 1810 14c2 660F1F44 		.p2align 3
+ 1810      0000
+ 1811              	.L249:
+ 1812              		.cfi_restore_state
+ 1813 14c8 C5F857C0 		vxorps	%xmm0, %xmm0, %xmm0
+ 1814 14cc C5FC28C8 		vmovaps	%ymm0, %ymm1
+ 1815 14d0 E95AFFFF 		jmp	.L241
+ 1815      FF
+ 1816              	.L248:
+ 1817 14d5 43C74496 		movl	$0, 72(%r14,%r10,4)
+ 1817      48000000 
+ 1817      00
+ 1818 14de 418B4640 		movl	64(%r14), %eax
+ 1819 14e2 E9A2FEFF 		jmp	.L239
+ 1819      FF
+ 1820              	.L236:
+ 1821 14e7 C60600   		movb	$0, (%rsi)
+ 1822 14ea 803800   		cmpb	$0, (%rax)
+ 1823 14ed 74E6     		je	.L248
+ 1824              	.L247:
+ 1825 14ef 83E980   		subl	$-128, %ecx
+ 1826 14f2 43894C96 		movl	%ecx, 72(%r14,%r10,4)
+ 1826      48
+ 1827 14f7 418B4640 		movl	64(%r14), %eax
+ 1828 14fb E989FEFF 		jmp	.L239
+ 1828      FF
+ 1829              		.cfi_endproc
+ 1830              	.LFE6406:
+ 1832              		.p2align 4
+ 1834              	fir_process_8_256:
+ 1835              	.LFB6407:
+ 1836              		.cfi_startproc
+ 1837 1500 55       		pushq	%rbp
+ 1838              		.cfi_def_cfa_offset 16
+ 1839              		.cfi_offset 6, -16
+ 1840 1501 4889E5   		movq	%rsp, %rbp
+ 1841              		.cfi_def_cfa_register 6
+ 1842 1504 4157     		pushq	%r15
+ 1843              		.cfi_offset 15, -24
+ 1844 1506 4989FF   		movq	%rdi, %r15
+ 1845 1509 4156     		pushq	%r14
+ 1846 150b 4155     		pushq	%r13
+ 1847 150d 4154     		pushq	%r12
+ 1848 150f 53       		pushq	%rbx
+ 1849 1510 4883E4C0 		andq	$-64, %rsp
+ 1850              		.cfi_offset 14, -32
+ 1851              		.cfi_offset 13, -40
+ 1852              		.cfi_offset 12, -48
+ 1853              		.cfi_offset 3, -56
+ 1854 1514 81BFA400 		cmpl	$256, 164(%rdi)
+ 1854      00000001 
+ 1854      0000
+ 1855 151e 0F851802 		jne	.L260
+ 1855      0000
+ 1856 1524 62F1FE48 		vmovdqu64	72(%rdi), %zmm4
+ 1856      6FA74800 
+ 1856      0000
+ 1857 152e 62F1DD48 		vporq	8(%rdi), %zmm4, %zmm0
+ 1857      EB870800 
+ 1857      0000
+ 1858 1538 62F3FD48 		vextracti64x4	$0x1, %zmm0, %ymm1
+ 1858      3BC101
+ 1859 153f C5F5EBC8 		vpor	%ymm0, %ymm1, %ymm1
+ 1860 1543 62F3FD28 		vextracti64x2	$0x1, %ymm1, %xmm0
+ 1860      39C801
+ 1861 154a C5F9EBC1 		vpor	%xmm1, %xmm0, %xmm0
+ 1862 154e C5F173D8 		vpsrldq	$8, %xmm0, %xmm1
+ 1862      08
+ 1863 1553 C5F9EBC1 		vpor	%xmm1, %xmm0, %xmm0
+ 1864 1557 C4E1F97E 		vmovq	%xmm0, %rax
+ 1864      C0
+ 1865 155c A81F     		testb	$31, %al
+ 1866 155e 0F85D501 		jne	.L280
+ 1866      0000
+ 1867 1564 4C8B9FC0 		movq	192(%rdi), %r11
+ 1867      000000
+ 1868 156b 4531D2   		xorl	%r10d, %r10d
+ 1869 156e C4E1F96E 		vmovq	%rdi, %xmm7
+ 1869      FF
+ 1870 1573 4D89DE   		movq	%r11, %r14
+ 1871 1576 EB53     		jmp	.L271
+ 1872 1578 0F1F8400 		.p2align 4,,10
+ 1872      00000000 
+ 1873              		.p2align 3
+ 1874              	.L284:
+ 1875 1580 438B4C96 		movl	72(%r14,%r10,4), %ecx
+ 1875      48
+ 1876 1585 413B4E40 		cmpl	64(%r14), %ecx
+ 1877 1589 0F82E801 		jb	.L262
+ 1877      0000
+ 1878 158f C60601   		movb	$1, (%rsi)
+ 1879 1592 803800   		cmpb	$0, (%rax)
+ 1880 1595 7509     		jne	.L263
+ 1881 1597 43C74496 		movl	$0, 72(%r14,%r10,4)
+ 1881      48000000 
+ 1881      00
+ 1882              	.L263:
+ 1883 15a0 31C0     		xorl	%eax, %eax
+ 1884 15a2 B9800000 		movl	$128, %ecx
+ 1884      00
+ 1885 15a7 4C89FF   		movq	%r15, %rdi
+ 1886 15aa 4983C201 		addq	$1, %r10
+ 1887 15ae F348AB   		rep stosq
+ 1888 15b1 488D8200 		leaq	256(%rdx), %rax
+ 1888      010000
+ 1889 15b8 31D2     		xorl	%edx, %edx
+ 1890 15ba 418B4E40 		movl	64(%r14), %ecx
+ 1891 15be 48F7F1   		divq	%rcx
+ 1892 15c1 4983FA08 		cmpq	$8, %r10
+ 1893 15c5 0F845801 		je	.L283
+ 1893      0000
+ 1894              	.L271:
+ 1895 15cb C4E1F97E 		vmovq	%xmm7, %rax
+ 1895      F8
+ 1896 15d0 C4E1F97E 		vmovq	%xmm7, %rbx
+ 1896      FB
+ 1897 15d5 418B5644 		movl	68(%r14), %edx
+ 1898 15d9 4E8B5CD0 		movq	8(%rax,%r10,8), %r11
+ 1898      08
+ 1899 15de 4E8B7CD0 		movq	72(%rax,%r10,8), %r15
+ 1899      48
+ 1900 15e3 488B8088 		movq	136(%rax), %rax
+ 1900      000000
+ 1901 15ea 488BB390 		movq	144(%rbx), %rsi
+ 1901      000000
+ 1902 15f1 4C01D0   		addq	%r10, %rax
+ 1903 15f4 4C01D6   		addq	%r10, %rsi
+ 1904 15f7 803800   		cmpb	$0, (%rax)
+ 1905 15fa 7584     		jne	.L284
+ 1906 15fc C60600   		movb	$0, (%rsi)
+ 1907 15ff 803800   		cmpb	$0, (%rax)
+ 1908 1602 0F845D01 		je	.L274
+ 1908      0000
+ 1909 1608 438B4C96 		movl	72(%r14,%r10,4), %ecx
+ 1909      48
+ 1910 160d 418B4640 		movl	64(%r14), %eax
+ 1911 1611 39C1     		cmpl	%eax, %ecx
+ 1912 1613 0F826601 		jb	.L273
+ 1912      0000
+ 1913              	.L265:
+ 1914 1619 89C7     		movl	%eax, %edi
+ 1915 161b 4189C4   		movl	%eax, %r12d
+ 1916 161e 498B4E08 		movq	8(%r14), %rcx
+ 1917 1622 C4C17A7E 		vmovq	16(%r14), %xmm5
+ 1917      6E10
+ 1918 1628 4889FE   		movq	%rdi, %rsi
+ 1919 162b 41D1EC   		shrl	%r12d
+ 1920 162e 83E801   		subl	$1, %eax
+ 1921 1631 4C895424 		movq	%r10, -16(%rsp)
+ 1921      F0
+ 1922 1636 490FAFF2 		imulq	%r10, %rsi
+ 1923 163a 4589E0   		movl	%r12d, %r8d
+ 1924 163d 48894424 		movq	%rax, -8(%rsp)
+ 1924      F8
+ 1925 1642 4589E2   		movl	%r12d, %r10d
+ 1926 1645 4E8D2C85 		leaq	0(,%r8,4), %r13
+ 1926      00000000 
+ 1927 164d C4E1F97E 		vmovq	%xmm5, %rax
+ 1927      E8
+ 1928 1652 31DB     		xorl	%ebx, %ebx
+ 1929 1654 4989FC   		movq	%rdi, %r12
+ 1930 1657 C4C1F96E 		vmovq	%r14, %xmm5
+ 1930      EE
+ 1931 165c 4989C6   		movq	%rax, %r14
+ 1932 165f 488D34B1 		leaq	(%rcx,%rsi,4), %rsi
+ 1933 1663 4C89E9   		movq	%r13, %rcx
+ 1934 1666 4E8D0C2E 		leaq	(%rsi,%r13), %r9
+ 1935 166a 4D89DD   		movq	%r11, %r13
+ 1936 166d 4989CB   		movq	%rcx, %r11
+ 1937              		.p2align 4,,10
+ 1938              		.p2align 3
+ 1939              	.L270:
+ 1940 1670 488B4424 		movq	-8(%rsp), %rax
+ 1940      F8
+ 1941 1675 C4C17A10 		vmovss	0(%r13,%rbx), %xmm0
+ 1941      441D00
+ 1942 167c 4829D0   		subq	%rdx, %rax
+ 1943 167f C5FA1104 		vmovss	%xmm0, (%rsi,%rdx,4)
+ 1943      96
+ 1944 1684 498D0C86 		leaq	(%r14,%rax,4), %rcx
+ 1945 1688 4585D2   		testl	%r10d, %r10d
+ 1946 168b 0F84C700 		je	.L275
+ 1946      0000
+ 1947 1691 C5F857C0 		vxorps	%xmm0, %xmm0, %xmm0
+ 1948 1695 31C0     		xorl	%eax, %eax
+ 1949 1697 4A8D3C19 		leaq	(%rcx,%r11), %rdi
+ 1950 169b C5FC28C8 		vmovaps	%ymm0, %ymm1
+ 1951 169f 90       		.p2align 4,,10
+ 1952              		.p2align 3
+ 1953              	.L268:
+ 1954 16a0 C5FC1034 		vmovups	(%rcx,%rax,4), %ymm6
+ 1954      81
+ 1955 16a5 C5FC1024 		vmovups	(%rdi,%rax,4), %ymm4
+ 1955      87
+ 1956 16aa C4E24DB8 		vfmadd231ps	(%rsi,%rax,4), %ymm6, %ymm1
+ 1956      0C86
+ 1957 16b0 C4C25DB8 		vfmadd231ps	(%r9,%rax,4), %ymm4, %ymm0
+ 1957      0481
+ 1958 16b6 4883C008 		addq	$8, %rax
+ 1959 16ba 4C39C0   		cmpq	%r8, %rax
+ 1960 16bd 72E1     		jb	.L268
+ 1961              	.L267:
+ 1962 16bf C5F77CC9 		vhaddps	%ymm1, %ymm1, %ymm1
+ 1963 16c3 C5FF7CC0 		vhaddps	%ymm0, %ymm0, %ymm0
+ 1964 16c7 4883C201 		addq	$1, %rdx
+ 1965 16cb 31C0     		xorl	%eax, %eax
+ 1966 16cd 4939D4   		cmpq	%rdx, %r12
+ 1967 16d0 480F44D0 		cmove	%rax, %rdx
+ 1968 16d4 C5F77CC9 		vhaddps	%ymm1, %ymm1, %ymm1
+ 1969 16d8 C5FF7CC0 		vhaddps	%ymm0, %ymm0, %ymm0
+ 1970 16dc C4E37D19 		vextractf128	$0x1, %ymm1, %xmm2
+ 1970      CA01
+ 1971 16e2 C4E37D19 		vextractf128	$0x1, %ymm0, %xmm3
+ 1971      C301
+ 1972 16e8 C5E858C9 		vaddps	%xmm1, %xmm2, %xmm1
+ 1973 16ec C5E058C0 		vaddps	%xmm0, %xmm3, %xmm0
+ 1974 16f0 C5F258C0 		vaddss	%xmm0, %xmm1, %xmm0
+ 1975 16f4 C4C17A11 		vmovss	%xmm0, (%r15,%rbx)
+ 1975      041F
+ 1976 16fa 4883C304 		addq	$4, %rbx
+ 1977 16fe 4881FB00 		cmpq	$1024, %rbx
+ 1977      040000
+ 1978 1705 0F8565FF 		jne	.L270
+ 1978      FFFF
+ 1979 170b 4C8B5424 		movq	-16(%rsp), %r10
+ 1979      F0
+ 1980 1710 C4C1F97E 		vmovq	%xmm5, %r14
+ 1980      EE
+ 1981 1715 4983C201 		addq	$1, %r10
+ 1982 1719 4983FA08 		cmpq	$8, %r10
+ 1983 171d 0F85A8FE 		jne	.L271
+ 1983      FFFF
+ 1984              	.L283:
+ 1985 1723 41895644 		movl	%edx, 68(%r14)
+ 1986 1727 C5F877   		vzeroupper
+ 1987 172a 488D65D8 		leaq	-40(%rbp), %rsp
+ 1988 172e 5B       		popq	%rbx
+ 1989 172f 415C     		popq	%r12
+ 1990 1731 415D     		popq	%r13
+ 1991 1733 415E     		popq	%r14
+ 1992 1735 415F     		popq	%r15
+ 1993 1737 5D       		popq	%rbp
+ 1994              		.cfi_remember_state
+ 1995              		.cfi_def_cfa 7, 8
+ 1996 1738 C3       		ret
+ 1997              	.L280:
+ 1998              		.cfi_restore_state
+ 1999 1739 C5F877   		vzeroupper
+ 2000              	.L260:
+ 2001 173c 488D65D8 		leaq	-40(%rbp), %rsp
+ 2002 1740 4C89FF   		movq	%r15, %rdi
+ 2003 1743 5B       		popq	%rbx
+ 2004 1744 415C     		popq	%r12
+ 2005 1746 415D     		popq	%r13
+ 2006 1748 415E     		popq	%r14
+ 2007 174a 415F     		popq	%r15
+ 2008 174c 5D       		popq	%rbp
+ 2009              		.cfi_remember_state
+ 2010              		.cfi_def_cfa 7, 8
+ 2011 174d E9000000 		jmp	fir_process@PLT
+ 2011      00
+ 2012              		.p2align 4,,10
+ 2013 1752 660F1F44 		.p2align 3
+ 2013      0000
+ 2014              	.L275:
+ 2015              		.cfi_restore_state
+ 2016 1758 C5F857C0 		vxorps	%xmm0, %xmm0, %xmm0
+ 2017 175c C5FC28C8 		vmovaps	%ymm0, %ymm1
+ 2018 1760 E95AFFFF 		jmp	.L267
+ 2018      FF
+ 2019              	.L274:
+ 2020 1765 43C74496 		movl	$0, 72(%r14,%r10,4)
+ 2020      48000000 
+ 2020      00
+ 2021 176e 418B4640 		movl	64(%r14), %eax
+ 2022 1772 E9A2FEFF 		jmp	.L265
+ 2022      FF
+ 2023              	.L262:
+ 2024 1777 C60600   		movb	$0, (%rsi)
+ 2025 177a 803800   		cmpb	$0, (%rax)
+ 2026 177d 74E6     		je	.L274
+ 2027              	.L273:
+ 2028 177f 81C10001 		addl	$256, %ecx
+ 2028      0000
+ 2029 1785 43894C96 		movl	%ecx, 72(%r14,%r10,4)
+ 2029      48
+ 2030 178a 418B4640 		movl	64(%r14), %eax
+ 2031 178e E986FEFF 		jmp	.L265
+ 2031      FF
+ 2032              		.cfi_endproc
+ 2033              	.LFE6407:
+ 2035              		.section	.rodata.str1.1
+ 2036              	.LC19:
+ 2037 008b 7761726D 		.string	"warm"
+ 2037      00
+ 2038              	.LC20:
+ 2039 0090 636F6C64 		.string	"cold"
+ 2039      00
+ 2040              	.LC21:
+ 2041 0095 6800     		.string	"h"
+ 2042              	.LC22:
+ 2043 0097 25732073 		.string	"%s subopts: %s\n"
+ 2043      75626F70 
+ 2043      74733A20 
+ 2043      25730A00 
+ 2044              		.section	.rodata.str1.8
+ 2045 01ce 0000     		.align 8
+ 2046              	.LC23:
+ 2047 01d0 25733A20 		.string	"%s: Missing value for suboption '%s'\n"
+ 2047      4D697373 
+ 2047      696E6720 
+ 2047      76616C75 
+ 2047      6520666F 
+ 2048              		.section	.rodata.str1.1
+ 2049              	.LC24:
+ 2050 00a7 25733A20 		.string	"%s: coeff_filename=%s\n"
+ 2050      636F6566 
+ 2050      665F6669 
+ 2050      6C656E61 
+ 2050      6D653D25 
+ 2051              		.section	.rodata.str1.8
+ 2052 01f6 0000     		.align 8
+ 2053              	.LC25:
+ 2054 01f8 25733A20 		.string	"%s: No match found for token: /%s/\n"
+ 2054      4E6F206D 
+ 2054      61746368 
+ 2054      20666F75 
+ 2054      6E642066 
+ 2055              		.section	.rodata.str1.1
+ 2056              	.LC26:
+ 2057 00be 66697200 		.string	"fir"
+ 2058              	.LC27:
+ 2059 00c2 7200     		.string	"r"
+ 2060              	.LC28:
+ 2061 00c4 25733A20 		.string	"%s: Unable to open file: %s\n"
+ 2061      556E6162 
+ 2061      6C652074 
+ 2061      6F206F70 
+ 2061      656E2066 
+ 2062              	.LC29:
+ 2063 00e1 25660A00 		.string	"%f\n"
+ 2064              	.LC30:
+ 2065 00e5 25733A20 		.string	"%s: Read error in file: %s\n"
+ 2065      52656164 
+ 2065      20657272 
+ 2065      6F722069 
+ 2065      6E206669 
+ 2066              	.LC31:
+ 2067 0101 25733A20 		.string	"%s: hlen=%zu\n"
+ 2067      686C656E 
+ 2067      3D257A75 
+ 2067      0A00
+ 2068              	.LC32:
+ 2069 010f 25733A20 		.string	"%s: coeff[1]=%e\n"
+ 2069      636F6566 
+ 2069      665B315D 
+ 2069      3D25650A 
+ 2069      00
+ 2070              		.section	.rodata.str1.8
+ 2071 021c 00000000 		.align 8
+ 2072              	.LC35:
+ 2073 0220 6669723A 		.string	"fir: %s start, %u taps ready in %.3f ms\n"
+ 2073      20257320 
+ 2073      73746172 
+ 2073      742C2025 
+ 2073      75207461 
+ 2074              		.section	.rodata.str1.1
+ 2075              	.LC36:
+ 2076 0120 6669723A 		.string	"fir: Use AVX\n"
+ 2076      20557365 
+ 2076      20415658 
+ 2076      0A00
+ 2077              		.text
+ 2078 1793 66662E0F 		.p2align 4
+ 2078      1F840000 
+ 2078      00000066 
+ 2078      90
+ 2079              		.globl	create_fir
+ 2081              	create_fir:
+ 2082              	.LFB6414:
+ 2083              		.cfi_startproc
+ 2084 17a0 4C8D5424 		leaq	8(%rsp), %r10
+ 2084      08
+ 2085              		.cfi_def_cfa 10, 0
+ 2086 17a5 4883E4E0 		andq	$-32, %rsp
+ 2087 17a9 488D0500 		leaq	.LC21(%rip), %rax
+ 2087      000000
+ 2088 17b0 41FF72F8 		pushq	-8(%r10)
+ 2089 17b4 55       		pushq	%rbp
+ 2090 17b5 4889E5   		movq	%rsp, %rbp
+ 2091              		.cfi_escape 0x10,0x6,0x2,0x76,0
+ 2092 17b8 4157     		pushq	%r15
+ 2093 17ba 4156     		pushq	%r14
+ 2094 17bc 4155     		pushq	%r13
+ 2095              		.cfi_escape 0x10,0xf,0x2,0x76,0x78
+ 2096              		.cfi_escape 0x10,0xe,0x2,0x76,0x70
+ 2097              		.cfi_escape 0x10,0xd,0x2,0x76,0x68
+ 2098 17be 4C8D2D00 		leaq	__func__.1(%rip), %r13
+ 2098      000000
+ 2099 17c5 4154     		pushq	%r12
+ 2100 17c7 4152     		pushq	%r10
+ 2101              		.cfi_escape 0xf,0x3,0x76,0x58,0x6
+ 2102              		.cfi_escape 0x10,0xc,0x2,0x76,0x60
+ 2103 17c9 53       		pushq	%rbx
+ 2104              		.cfi_escape 0x10,0x3,0x2,0x76,0x50
+ 2105 17ca 4889F3   		movq	%rsi, %rbx
+ 2106 17cd 4883C480 		addq	$-128, %rsp
+ 2107 17d1 48897D88 		movq	%rdi, -120(%rbp)
+ 2108 17d5 BF680000 		movl	$104, %edi
+ 2108      00
+ 2109 17da C5FA7E25 		vmovq	destroy_fir@GOTPCREL(%rip), %xmm4
+ 2109      00000000 
+ 2110 17e2 C5FA7E2D 		vmovq	fir_process@GOTPCREL(%rip), %xmm5
+ 2110      00000000 
+ 2111 17ea 488945A0 		movq	%rax, -96(%rbp)
+ 2112 17ee C4E3D922 		vpinsrq	$1, clone_fir@GOTPCREL(%rip), %xmm4, %xmm0
+ 2112      05000000 
+ 2112      0001
+ 2113 17f8 48C745A8 		movq	$0, -88(%rbp)
+ 2113      00000000 
+ 2114 1800 C4E3D122 		vpinsrq	$1, fir_init@GOTPCREL(%rip), %xmm5, %xmm1
+ 2114      0D000000 
+ 2114      0001
+ 2115 180a C6459700 		movb	$0, -105(%rbp)
+ 2116 180e C5FA7E1D 		vmovq	fir_preroll@GOTPCREL(%rip), %xmm3
+ 2116      00000000 
+ 2117 1816 C4E3E122 		vpinsrq	$1, fir_codegen@GOTPCREL(%rip), %xmm3, %xmm2
+ 2117      15000000 
+ 2117      0001
+ 2118 1820 C4E37538 		vinserti128	$0x1, %xmm0, %ymm1, %ymm6
+ 2118      F001
+ 2119 1826 C5F97F95 		vmovdqa	%xmm2, -144(%rbp)
+ 2119      70FFFFFF 
+ 2120 182e C5FD7FB5 		vmovdqa	%ymm6, -176(%rbp)
+ 2120      50FFFFFF 
+ 2121 1836 C5F877   		vzeroupper
+ 2122 1839 E8000000 		call	malloc@PLT
+ 2122      00
+ 2123 183e 4C89EA   		movq	%r13, %rdx
+ 2124 1841 C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 2125 1845 4989C4   		movq	%rax, %r12
+ 2126 1848 488B4588 		movq	-120(%rbp), %rax
+ 2127 184c 488D3500 		leaq	.LC22(%rip), %rsi
+ 2127      000000
+ 2128 1853 BF010000 		movl	$1, %edi
+ 2128      00
+ 2129 1858 49C74424 		movq	$0, 16(%r12)
+ 2129      10000000 
+ 2129      00
+ 2130 1861 4C89A0C0 		movq	%r12, 192(%rax)
+ 2130      000000
+ 2131 1868 488B0B   		movq	(%rbx), %rcx
+ 2132 186b 31C0     		xorl	%eax, %eax
+ 2133 186d 41C64424 		movb	$0, 24(%r12)
+ 2133      1800
+ 2134 1873 49C74424 		movq	$0, 32(%r12)
+ 2134      20000000 
+ 2134      00
+ 2135 187c 41C74424 		movl	$0, 64(%r12)
+ 2135      40000000 
+ 2135      00
+ 2136 1885 C4C17A7F 		vmovdqu	%xmm0, (%r12)
+ 2136      0424
+ 2137 188b E8000000 		call	debugprint@PLT
+ 2137      00
+ 2138 1890 488B03   		movq	(%rbx), %rax
+ 2139 1893 803800   		cmpb	$0, (%rax)
+ 2140 1896 744D     		je	.L286
+ 2141 1898 4C8D7D98 		leaq	-104(%rbp), %r15
+ 2142 189c 4C8D75A0 		leaq	-96(%rbp), %r14
+ 2143              		.p2align 4,,10
+ 2144              		.p2align 3
+ 2145              	.L290:
+ 2146 18a0 4C89FA   		movq	%r15, %rdx
+ 2147 18a3 4C89F6   		movq	%r14, %rsi
+ 2148 18a6 4889DF   		movq	%rbx, %rdi
+ 2149 18a9 E8000000 		call	getsubopt@PLT
+ 2149      00
+ 2150 18ae 488B4D98 		movq	-104(%rbp), %rcx
+ 2151 18b2 85C0     		testl	%eax, %eax
+ 2152 18b4 0F856602 		jne	.L287
+ 2152      0000
+ 2153 18ba 4885C9   		testq	%rcx, %rcx
+ 2154 18bd 0F84C502 		je	.L320
+ 2154      0000
+ 2155 18c3 49890C24 		movq	%rcx, (%r12)
+ 2156 18c7 31C0     		xorl	%eax, %eax
+ 2157 18c9 4C89EA   		movq	%r13, %rdx
+ 2158 18cc 488D3500 		leaq	.LC24(%rip), %rsi
+ 2158      000000
+ 2159 18d3 BF010000 		movl	$1, %edi
+ 2159      00
+ 2160 18d8 E8000000 		call	debugprint@PLT
+ 2160      00
+ 2161 18dd 488B03   		movq	(%rbx), %rax
+ 2162 18e0 803800   		cmpb	$0, (%rax)
+ 2163 18e3 75BB     		jne	.L290
+ 2164              	.L286:
+ 2165 18e5 488B4588 		movq	-120(%rbp), %rax
+ 2166 18e9 488D1D00 		leaq	fir_process_kernels(%rip), %rbx
+ 2166      000000
+ 2167 18f0 49833C24 		cmpq	$0, (%r12)
+ 2167      00
+ 2168 18f5 C5FD6FBD 		vmovdqa	-176(%rbp), %ymm7
+ 2168      50FFFFFF 
+ 2169 18fd 488998C8 		movq	%rbx, 200(%rax)
+ 2169      000000
+ 2170 1904 C5FE7FB8 		vmovdqu	%ymm7, 208(%rax)
+ 2170      D0000000 
+ 2171 190c C5F96FBD 		vmovdqa	-144(%rbp), %xmm7
+ 2171      70FFFFFF 
+ 2172 1914 C5FA7FB8 		vmovdqu	%xmm7, 240(%rax)
+ 2172      F0000000 
+ 2173 191c 0F847E02 		je	.L318
+ 2173      0000
+ 2174 1922 488D75B0 		leaq	-80(%rbp), %rsi
+ 2175 1926 BF010000 		movl	$1, %edi
+ 2175      00
+ 2176 192b C5F877   		vzeroupper
+ 2177 192e E8000000 		call	clock_gettime@PLT
+ 2177      00
+ 2178 1933 E8000000 		call	cache_enabled@PLT
+ 2178      00
+ 2179 1938 48C74588 		movq	$0, -120(%rbp)
+ 2179      00000000 
+ 2180 1940 84C0     		testb	%al, %al
+ 2181 1942 0F855003 		jne	.L321
+ 2181      0000
+ 2182              	.L292:
+ 2183 1948 807D9700 		cmpb	$0, -105(%rbp)
+ 2184 194c 741D     		je	.L293
+ 2185 194e 488B5588 		movq	-120(%rbp), %rdx
+ 2186 1952 498D7C24 		leaq	32(%r12), %rdi
+ 2186      20
+ 2187 1957 488D3500 		leaq	.LC26(%rip), %rsi
+ 2187      000000
+ 2188 195e E8000000 		call	cache_load@PLT
+ 2188      00
+ 2189 1963 84C0     		testb	%al, %al
+ 2190 1965 0F853D02 		jne	.L322
+ 2190      0000
+ 2191              	.L293:
+ 2192 196b 498B0424 		movq	(%r12), %rax
+ 2193 196f 488D3500 		leaq	.LC27(%rip), %rsi
+ 2193      000000
+ 2194 1976 4889C7   		movq	%rax, %rdi
+ 2195 1979 48898550 		movq	%rax, -176(%rbp)
+ 2195      FFFFFF
+ 2196 1980 E8000000 		call	fopen@PLT
+ 2196      00
+ 2197 1985 4989C5   		movq	%rax, %r13
+ 2198 1988 4885C0   		testq	%rax, %rax
+ 2199 198b 0F843F03 		je	.L323
+ 2199      0000
+ 2200 1991 BF000400 		movl	$1024, %edi
+ 2200      00
+ 2201 1996 41BF0001 		movl	$256, %r15d
+ 2201      0000
+ 2202 199c 31DB     		xorl	%ebx, %ebx
+ 2203 199e E8000000 		call	malloc@PLT
+ 2203      00
+ 2204 19a3 4989C6   		movq	%rax, %r14
+ 2205 19a6 662E0F1F 		.p2align 4,,10
+ 2205      84000000 
+ 2205      0000
+ 2206              		.p2align 3
+ 2207              	.L297:
+ 2208 19b0 4C89EF   		movq	%r13, %rdi
+ 2209 19b3 E8000000 		call	feof@PLT
+ 2209      00
+ 2210 19b8 85C0     		testl	%eax, %eax
+ 2211 19ba 7554     		jne	.L324
+ 2212              	.L300:
+ 2213 19bc 31C0     		xorl	%eax, %eax
+ 2214 19be 498D149E 		leaq	(%r14,%rbx,4), %rdx
+ 2215 19c2 488D3500 		leaq	.LC29(%rip), %rsi
+ 2215      000000
+ 2216 19c9 4C89EF   		movq	%r13, %rdi
+ 2217 19cc E8000000 		call	__isoc99_fscanf@PLT
+ 2217      00
+ 2218 19d1 83F801   		cmpl	$1, %eax
+ 2219 19d4 0F857E02 		jne	.L325
+ 2219      0000
+ 2220 19da 4883C301 		addq	$1, %rbx
+ 2221 19de 4C39FB   		cmpq	%r15, %rbx
+ 2222 19e1 75CD     		jne	.L297
+ 2223 19e3 4C89F7   		movq	%r14, %rdi
+ 2224 19e6 488D34DD 		leaq	0(,%rbx,8), %rsi
+ 2224      00000000 
+ 2225 19ee 4C8D3C1B 		leaq	(%rbx,%rbx), %r15
+ 2226 19f2 E8000000 		call	realloc@PLT
+ 2226      00
+ 2227 19f7 4C89EF   		movq	%r13, %rdi
+ 2228 19fa 4989C6   		movq	%rax, %r14
+ 2229 19fd E8000000 		call	feof@PLT
+ 2229      00
+ 2230 1a02 85C0     		testl	%eax, %eax
+ 2231 1a04 74B6     		je	.L300
+ 2232 1a06 662E0F1F 		.p2align 4,,10
+ 2232      84000000 
+ 2232      0000
+ 2233              		.p2align 3
+ 2234              	.L324:
+ 2235 1a10 4C89EF   		movq	%r13, %rdi
+ 2236 1a13 4C8D3D00 		leaq	__func__.0(%rip), %r15
+ 2236      000000
+ 2237 1a1a 4989DD   		movq	%rbx, %r13
+ 2238 1a1d E8000000 		call	fclose@PLT
+ 2238      00
+ 2239 1a22 4983E5F0 		andq	$-16, %r13
+ 2240 1a26 4889D9   		movq	%rbx, %rcx
+ 2241 1a29 4C89FA   		movq	%r15, %rdx
+ 2242 1a2c 31C0     		xorl	%eax, %eax
+ 2243 1a2e 488D3500 		leaq	.LC31(%rip), %rsi
+ 2243      000000
+ 2244 1a35 BF020000 		movl	$2, %edi
+ 2244      00
+ 2245 1a3a 4983C510 		addq	$16, %r13
+ 2246 1a3e E8000000 		call	debugprint@PLT
+ 2246      00
+ 2247 1a43 4C89FA   		movq	%r15, %rdx
+ 2248 1a46 C5D157ED 		vxorpd	%xmm5, %xmm5, %xmm5
+ 2249 1a4a 488D3500 		leaq	.LC32(%rip), %rsi
+ 2249      000000
+ 2250 1a51 BF020000 		movl	$2, %edi
+ 2250      00
+ 2251 1a56 B8010000 		movl	$1, %eax
+ 2251      00
+ 2252 1a5b C4C1525A 		vcvtss2sd	4(%r14), %xmm5, %xmm0
+ 2252      4604
+ 2253 1a61 E8000000 		call	debugprint@PLT
+ 2253      00
+ 2254 1a66 4A8D04ED 		leaq	0(,%r13,8), %rax
+ 2254      00000000 
+ 2255 1a6e 4889C7   		movq	%rax, %rdi
+ 2256 1a71 48898550 		movq	%rax, -176(%rbp)
+ 2256      FFFFFF
+ 2257 1a78 E8000000 		call	valloc@PLT
+ 2257      00
+ 2258 1a7d 488B9550 		movq	-176(%rbp), %rdx
+ 2258      FFFFFF
+ 2259 1a84 31F6     		xorl	%esi, %esi
+ 2260 1a86 4889C7   		movq	%rax, %rdi
+ 2261 1a89 4989C7   		movq	%rax, %r15
+ 2262 1a8c E8000000 		call	memset@PLT
+ 2262      00
+ 2263 1a91 4885DB   		testq	%rbx, %rbx
+ 2264 1a94 7430     		je	.L304
+ 2265 1a96 488B9550 		movq	-176(%rbp), %rdx
+ 2265      FFFFFF
+ 2266 1a9d 4C89F0   		movq	%r14, %rax
+ 2267 1aa0 498D0C9E 		leaq	(%r14,%rbx,4), %rcx
+ 2268 1aa4 498D5417 		leaq	-4(%r15,%rdx), %rdx
+ 2268      FC
+ 2269 1aa9 0F1F8000 		.p2align 4,,10
+ 2269      000000
+ 2270              		.p2align 3
+ 2271              	.L303:
+ 2272 1ab0 C5FA1000 		vmovss	(%rax), %xmm0
+ 2273 1ab4 4883C004 		addq	$4, %rax
+ 2274 1ab8 4883EA04 		subq	$4, %rdx
+ 2275 1abc C5FA1142 		vmovss	%xmm0, 4(%rdx)
+ 2275      04
+ 2276 1ac1 4839C1   		cmpq	%rax, %rcx
+ 2277 1ac4 75EA     		jne	.L303
+ 2278              	.L304:
+ 2279 1ac6 4A8D14AD 		leaq	0(,%r13,4), %rdx
+ 2279      00000000 
+ 2280 1ace 4C89FF   		movq	%r15, %rdi
+ 2281 1ad1 498D3417 		leaq	(%r15,%rdx), %rsi
+ 2282 1ad5 E8000000 		call	memcpy@PLT
+ 2282      00
+ 2283 1ada 4C89F7   		movq	%r14, %rdi
+ 2284 1add E8000000 		call	free@PLT
+ 2284      00
+ 2285 1ae2 807D9700 		cmpb	$0, -105(%rbp)
+ 2286 1ae6 45896C24 		movl	%r13d, 64(%r12)
+ 2286      40
+ 2287 1aeb 4D897C24 		movq	%r15, 16(%r12)
+ 2287      10
+ 2288 1af0 0F84CD00 		je	.L294
+ 2288      0000
+ 2289 1af6 438D4C2D 		leal	(%r13,%r13), %ecx
+ 2289      00
+ 2290 1afb 488B7588 		movq	-120(%rbp), %rsi
+ 2291 1aff 4C89FA   		movq	%r15, %rdx
+ 2292 1b02 488D3D00 		leaq	.LC26(%rip), %rdi
+ 2292      000000
+ 2293 1b09 48C1E102 		salq	$2, %rcx
+ 2294 1b0d E8000000 		call	cache_store@PLT
+ 2294      00
+ 2295 1b12 E9AC0000 		jmp	.L294
+ 2295      00
+ 2296 1b17 660F1F84 		.p2align 4,,10
+ 2296      00000000 
+ 2296      00
+ 2297              		.p2align 3
+ 2298              	.L287:
+ 2299 1b20 4C89EA   		movq	%r13, %rdx
+ 2300 1b23 488D3500 		leaq	.LC25(%rip), %rsi
+ 2300      000000
+ 2301 1b2a 31FF     		xorl	%edi, %edi
+ 2302 1b2c 31C0     		xorl	%eax, %eax
+ 2303 1b2e E8000000 		call	debugprint@PLT
+ 2303      00
+ 2304              	.L289:
+ 2305 1b33 488B4588 		movq	-120(%rbp), %rax
+ 2306 1b37 488D1D00 		leaq	fir_process_kernels(%rip), %rbx
+ 2306      000000
+ 2307 1b3e C5FD6F95 		vmovdqa	-176(%rbp), %ymm2
+ 2307      50FFFFFF 
+ 2308 1b46 C5F96F9D 		vmovdqa	-144(%rbp), %xmm3
+ 2308      70FFFFFF 
+ 2309 1b4e 488998C8 		movq	%rbx, 200(%rax)
+ 2309      000000
+ 2310 1b55 C5FE7F90 		vmovdqu	%ymm2, 208(%rax)
+ 2310      D0000000 
+ 2311 1b5d C5FA7F98 		vmovdqu	%xmm3, 240(%rax)
+ 2311      F0000000 
+ 2312 1b65 C5F877   		vzeroupper
+ 2313              	.L291:
+ 2314 1b68 B8010000 		movl	$1, %eax
+ 2314      00
+ 2315              	.L285:
+ 2316 1b6d 4883EC80 		subq	$-128, %rsp
+ 2317 1b71 5B       		popq	%rbx
+ 2318 1b72 415A     		popq	%r10
+ 2319              		.cfi_remember_state
+ 2320              		.cfi_def_cfa 10, 0
+ 2321 1b74 415C     		popq	%r12
+ 2322 1b76 415D     		popq	%r13
+ 2323 1b78 415E     		popq	%r14
+ 2324 1b7a 415F     		popq	%r15
+ 2325 1b7c 5D       		popq	%rbp
+ 2326 1b7d 498D62F8 		leaq	-8(%r10), %rsp
+ 2327              		.cfi_def_cfa 7, 8
+ 2328 1b81 C3       		ret
+ 2329              		.p2align 4,,10
+ 2330 1b82 660F1F44 		.p2align 3
+ 2330      0000
+ 2331              	.L320:
+ 2332              		.cfi_restore_state
+ 2333 1b88 488B4DA0 		movq	-96(%rbp), %rcx
+ 2334 1b8c 4C89EA   		movq	%r13, %rdx
+ 2335 1b8f 488D3500 		leaq	.LC23(%rip), %rsi
+ 2335      000000
+ 2336 1b96 31FF     		xorl	%edi, %edi
+ 2337 1b98 E8000000 		call	debugprint@PLT
+ 2337      00
+ 2338 1b9d EB94     		jmp	.L289
+ 2339 1b9f 90       		.p2align 4,,10
+ 2340              		.p2align 3
+ 2341              	.L318:
+ 2342 1ba0 C5F877   		vzeroupper
+ 2343 1ba3 EBC3     		jmp	.L291
+ 2344              		.p2align 4,,10
+ 2345 1ba5 0F1F00   		.p2align 3
+ 2346              	.L322:
+ 2347 1ba8 498B4424 		movq	48(%r12), %rax
+ 2347      30
+ 2348 1bad 49894424 		movq	%rax, 16(%r12)
+ 2348      10
+ 2349 1bb2 B8030000 		movl	$3, %eax
+ 2349      00
+ 2350 1bb7 C4C2FBF7 		shrx	%rax, 56(%r12), %rax
+ 2350      442438
+ 2351 1bbe 41894424 		movl	%eax, 64(%r12)
+ 2351      40
+ 2352              	.L294:
+ 2353 1bc3 488D75C0 		leaq	-64(%rbp), %rsi
+ 2354 1bc7 BF010000 		movl	$1, %edi
+ 2354      00
+ 2355 1bcc E8000000 		call	clock_gettime@PLT
+ 2355      00
+ 2356 1bd1 E8000000 		call	cache_enabled@PLT
+ 2356      00
+ 2357 1bd6 84C0     		testb	%al, %al
+ 2358 1bd8 7462     		je	.L305
+ 2359 1bda C5D957E4 		vxorpd	%xmm4, %xmm4, %xmm4
+ 2360 1bde 488B45C0 		movq	-64(%rbp), %rax
+ 2361 1be2 482B45B0 		subq	-80(%rbp), %rax
+ 2362 1be6 488D1500 		leaq	.LC20(%rip), %rdx
+ 2362      000000
+ 2363 1bed C4E1DB2A 		vcvtsi2sdq	%rax, %xmm4, %xmm0
+ 2363      C0
+ 2364 1bf2 488B45C8 		movq	-56(%rbp), %rax
+ 2365 1bf6 482B45B8 		subq	-72(%rbp), %rax
+ 2366 1bfa 488D3500 		leaq	.LC35(%rip), %rsi
+ 2366      000000
+ 2367 1c01 C4E1DB2A 		vcvtsi2sdq	%rax, %xmm4, %xmm1
+ 2367      C8
+ 2368 1c06 49837C24 		cmpq	$0, 32(%r12)
+ 2368      2000
+ 2369 1c0c 488D0500 		leaq	.LC19(%rip), %rax
+ 2369      000000
+ 2370 1c13 418B4C24 		movl	64(%r12), %ecx
+ 2370      40
+ 2371 1c18 C5FB5905 		vmulsd	.LC33(%rip), %xmm0, %xmm0
+ 2371      00000000 
+ 2372 1c20 480F45D0 		cmovne	%rax, %rdx
+ 2373 1c24 31FF     		xorl	%edi, %edi
+ 2374 1c26 B8010000 		movl	$1, %eax
+ 2374      00
+ 2375 1c2b C5F3590D 		vmulsd	.LC34(%rip), %xmm1, %xmm1
+ 2375      00000000 
+ 2376 1c33 C5FB58C1 		vaddsd	%xmm1, %xmm0, %xmm0
+ 2377 1c37 E8000000 		call	debugprint@PLT
+ 2377      00
+ 2378              	.L305:
+ 2379 1c3c 31C0     		xorl	%eax, %eax
+ 2380 1c3e 488D3500 		leaq	.LC36(%rip), %rsi
+ 2380      000000
+ 2381 1c45 31FF     		xorl	%edi, %edi
+ 2382 1c47 E8000000 		call	debugprint@PLT
+ 2382      00
+ 2383 1c4c 31C0     		xorl	%eax, %eax
+ 2384 1c4e E91AFFFF 		jmp	.L285
+ 2384      FF
+ 2385              		.p2align 4,,10
+ 2386 1c53 0F1F4400 		.p2align 3
+ 2386      00
+ 2387              	.L325:
+ 2388 1c58 488B8D50 		movq	-176(%rbp), %rcx
+ 2388      FFFFFF
+ 2389 1c5f 488D1500 		leaq	__func__.0(%rip), %rdx
+ 2389      000000
+ 2390 1c66 31FF     		xorl	%edi, %edi
+ 2391 1c68 31C0     		xorl	%eax, %eax
+ 2392 1c6a 488D3500 		leaq	.LC30(%rip), %rsi
+ 2392      000000
+ 2393 1c71 E8000000 		call	debugprint@PLT
+ 2393      00
+ 2394 1c76 4C89EF   		movq	%r13, %rdi
+ 2395 1c79 E8000000 		call	fclose@PLT
+ 2395      00
+ 2396 1c7e 4C89F7   		movq	%r14, %rdi
+ 2397 1c81 E8000000 		call	free@PLT
+ 2397      00
+ 2398 1c86 49C74424 		movq	$0, 16(%r12)
+ 2398      10000000 
+ 2398      00
+ 2399 1c8f E9D4FEFF 		jmp	.L291
+ 2399      FF
+ 2400              		.p2align 4,,10
+ 2401 1c94 0F1F4000 		.p2align 3
+ 2402              	.L321:
+ 2403 1c98 C745C010 		movl	$16, -64(%rbp)
+ 2403      000000
+ 2404 1c9f 498B3424 		movq	(%r12), %rsi
+ 2405 1ca3 488D5597 		leaq	-105(%rbp), %rdx
+ 2406 1ca7 48BF2523 		movabsq	$-3750763034362895579, %rdi
+ 2406      2284E49C 
+ 2406      F2CB
+ 2407 1cb1 E8000000 		call	cache_hash_file@PLT
+ 2407      00
+ 2408 1cb6 488D75C0 		leaq	-64(%rbp), %rsi
+ 2409 1cba BA040000 		movl	$4, %edx
+ 2409      00
+ 2410 1cbf 4889C7   		movq	%rax, %rdi
+ 2411 1cc2 E8000000 		call	cache_hash@PLT
+ 2411      00
+ 2412 1cc7 48894588 		movq	%rax, -120(%rbp)
+ 2413 1ccb E978FCFF 		jmp	.L292
+ 2413      FF
+ 2414              	.L323:
+ 2415 1cd0 488B8D50 		movq	-176(%rbp), %rcx
+ 2415      FFFFFF
+ 2416 1cd7 31C0     		xorl	%eax, %eax
+ 2417 1cd9 488D1500 		leaq	__func__.0(%rip), %rdx
+ 2417      000000
+ 2418 1ce0 31FF     		xorl	%edi, %edi
+ 2419 1ce2 488D3500 		leaq	.LC28(%rip), %rsi
+ 2419      000000
+ 2420 1ce9 E8000000 		call	debugprint@PLT
+ 2420      00
+ 2421 1cee 31C0     		xorl	%eax, %eax
+ 2422 1cf0 49894424 		movq	%rax, 16(%r12)
+ 2422      10
+ 2423 1cf5 E96EFEFF 		jmp	.L291
+ 2423      FF
+ 2424              		.cfi_endproc
+ 2425              	.LFE6414:
+ 2427              		.section	.rodata.str1.1
+ 2428              	.LC38:
+ 2429 012e 20204649 		.string	"  FIR filter options\n"
+ 2429      52206669 
+ 2429      6C746572 
+ 2429      206F7074 
+ 2429      696F6E73 
+ 2430              	.LC39:
+ 2431 0144 20202020 		.string	"    Name: fir\n"
+ 2431      4E616D65 
+ 2431      3A206669 
+ 2431      720A00
+ 2432              		.section	.rodata.str1.8
+ 2433 0249 00000000 		.align 8
+ 2433      000000
+ 2434              	.LC40:
+ 2435 0250 20202020 		.string	"        h = coefficient filename\n"
+ 2435      20202020 
+ 2435      68203D20 
+ 2435      636F6566 
+ 2435      66696369 
+ 2436 0272 00000000 		.align 8
+ 2436      0000
+ 2437              	.LC41:
+ 2438 0278 20202020 		.string	"    Example: -p fir,h=coeffs.txt\n"
+ 2438      4578616D 
+ 2438      706C653A 
+ 2438      202D7020 
+ 2438      6669722C 
+ 2439 029a 00000000 		.align 8
+ 2439      0000
+ 2440              	.LC42:
+ 2441 02a0 20202020 		.string	"    Note: Coefficient file should contain one coefficient per line\n"
+ 2441      4E6F7465 
+ 2441      3A20436F 
+ 2441      65666669 
+ 2441      6369656E 
+ 2442 02e4 00000000 		.align 8
+ 2443              	.LC43:
+ 2444 02e8 20202020 		.string	"    Note: Prepared coefficients are cached in $QDSP_CACHE_DIR, if set\n"
+ 2444      4E6F7465 
+ 2444      3A205072 
+ 2444      65706172 
+ 2444      65642063 
+ 2445              		.text
+ 2446 1cfa 660F1F44 		.p2align 4
+ 2446      0000
+ 2447              		.globl	help_fir
+ 2449              	help_fir:
+ 2450              	.LFB6415:
+ 2451              		.cfi_startproc
+ 2452 1d00 4883EC08 		subq	$8, %rsp
+ 2453              		.cfi_def_cfa_offset 16
+ 2454 1d04 488D3500 		leaq	.LC38(%rip), %rsi
+ 2454      000000
+ 2455 1d0b 31FF     		xorl	%edi, %edi
+ 2456 1d0d 31C0     		xorl	%eax, %eax
+ 2457 1d0f E8000000 		call	debugprint@PLT
+ 2457      00
+ 2458 1d14 488D3500 		leaq	.LC39(%rip), %rsi
+ 2458      000000
+ 2459 1d1b 31FF     		xorl	%edi, %edi
+ 2460 1d1d 31C0     		xorl	%eax, %eax
+ 2461 1d1f E8000000 		call	debugprint@PLT
+ 2461      00
+ 2462 1d24 488D3500 		leaq	.LC40(%rip), %rsi
+ 2462      000000
+ 2463 1d2b 31FF     		xorl	%edi, %edi
+ 2464 1d2d 31C0     		xorl	%eax, %eax
+ 2465 1d2f E8000000 		call	debugprint@PLT
+ 2465      00
+ 2466 1d34 488D3500 		leaq	.LC41(%rip), %rsi
+ 2466      000000
+ 2467 1d3b 31FF     		xorl	%edi, %edi
+ 2468 1d3d 31C0     		xorl	%eax, %eax
+ 2469 1d3f E8000000 		call	debugprint@PLT
+ 2469      00
+ 2470 1d44 488D3500 		leaq	.LC42(%rip), %rsi
+ 2470      000000
+ 2471 1d4b 31FF     		xorl	%edi, %edi
+ 2472 1d4d 31C0     		xorl	%eax, %eax
+ 2473 1d4f E8000000 		call	debugprint@PLT
+ 2473      00
+ 2474 1d54 488D3500 		leaq	.LC43(%rip), %rsi
+ 2474      000000
+ 2475 1d5b 31FF     		xorl	%edi, %edi
+ 2476 1d5d 31C0     		xorl	%eax, %eax
+ 2477 1d5f 4883C408 		addq	$8, %rsp
+ 2478              		.cfi_def_cfa_offset 8
+ 2479 1d63 E9000000 		jmp	debugprint@PLT
+ 2479      00
+ 2480              		.cfi_endproc
+ 2481              	.LFE6415:
+ 2483              		.section	.rodata
+ 2484 0028 00000000 		.align 16
+ 2484      00000000 
+ 2487              	__func__.0:
+ 2488 0030 6669725F 		.string	"fir_prepare_coeffs"
+ 2488      70726570 
+ 2488      6172655F 
+ 2488      636F6566 
+ 2488      667300
+ 2489 0043 00000000 		.align 8
+ 2489      00
+ 2492              	__func__.1:
+ 2493 0048 63726561 		.string	"create_fir"
+ 2493      74655F66 
+ 2493      697200
+ 2494              		.section	.data.rel.ro,"aw"
+ 2495              		.align 32
+ 2498              	fir_process_kernels:
+ 2499 0000 02000000 		.long	2
+ 2500 0004 40000000 		.long	64
+ 2501 0008 00000000 		.quad	fir_process_2_64
+ 2501      00000000 
+ 2502 0010 02000000 		.long	2
+ 2503 0014 80000000 		.long	128
+ 2504 0018 00000000 		.quad	fir_process_2_128
+ 2504      00000000 
+ 2505 0020 02000000 		.long	2
+ 2506 0024 00010000 		.long	256
+ 2507 0028 00000000 		.quad	fir_process_2_256
+ 2507      00000000 
+ 2508 0030 08000000 		.long	8
+ 2509 0034 40000000 		.long	64
+ 2510 0038 00000000 		.quad	fir_process_8_64
+ 2510      00000000 
+ 2511 0040 08000000 		.long	8
+ 2512 0044 80000000 		.long	128
+ 2513 0048 00000000 		.quad	fir_process_8_128
+ 2513      00000000 
+ 2514 0050 08000000 		.long	8
+ 2515 0054 00010000 		.long	256
+ 2516 0058 00000000 		.quad	fir_process_8_256
+ 2516      00000000 
+ 2517 0060 00000000 		.long	0
+ 2518 0064 00000000 		.long	0
+ 2519 0068 00000000 		.quad	fir_process
+ 2519      00000000 
+ 2520              		.section	.rodata.cst8,"aM",@progbits,8
+ 2521              		.align 8
+ 2522              	.LC33:
+ 2523 0000 00000000 		.long	0
+ 2524 0004 00408F40 		.long	1083129856
+ 2525              		.align 8
+ 2526              	.LC34:
+ 2527 0008 8DEDB5A0 		.long	-1598689907
+ 2528 000c F7C6B03E 		.long	1051772663
+ 2529              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 2530              		.section	.note.GNU-stack,"",@progbits
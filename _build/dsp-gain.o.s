@@ -0,0 +1,7548 @@
+   1              		.file	"dsp-gain.c"
+   2              		.text
+   3              		.p2align 4
+   5              	gain_ramp:
+   6              	.LFB6406:
+   7              		.cfi_startproc
+   8 0000 4154     		pushq	%r12
+   9              		.cfi_def_cfa_offset 16
+  10              		.cfi_offset 12, -16
+  11 0002 C5E057DB 		vxorps	%xmm3, %xmm3, %xmm3
+  12 0006 55       		pushq	%rbp
+  13              		.cfi_def_cfa_offset 24
+  14              		.cfi_offset 6, -24
+  15 0007 89F5     		movl	%esi, %ebp
+  16 0009 53       		pushq	%rbx
+  17              		.cfi_def_cfa_offset 32
+  18              		.cfi_offset 3, -32
+  19 000a 4889FB   		movq	%rdi, %rbx
+  20 000d 4883EC10 		subq	$16, %rsp
+  21              		.cfi_def_cfa_offset 48
+  22 0011 8B4744   		movl	68(%rdi), %eax
+  23 0014 C5E25A17 		vcvtss2sd	(%rdi), %xmm3, %xmm2
+  24 0018 C5F96EC0 		vmovd	%eax, %xmm0
+  25 001c C5F82E47 		vucomiss	92(%rdi), %xmm0
+  25      5C
+  26 0021 0F8AA900 		jp	.L23
+  26      0000
+  27 0027 0F85A300 		jne	.L23
+  27      0000
+  28 002d 448B6758 		movl	88(%rdi), %r12d
+  29 0031 4585E4   		testl	%r12d, %r12d
+  30 0034 0F848401 		je	.L8
+  30      0000
+  31 003a 4139F4   		cmpl	%esi, %r12d
+  32 003d 410F4EF4 		cmovle	%r12d, %esi
+  33 0041 807F6000 		cmpb	$0, 96(%rdi)
+  34 0045 0F848501 		je	.L38
+  34      0000
+  35              	.L10:
+  36 004b 488B5370 		movq	112(%rbx), %rdx
+  37 004f 85F6     		testl	%esi, %esi
+  38 0051 0F8E8301 		jle	.L22
+  38      0000
+  39 0057 4863CE   		movslq	%esi, %rcx
+  40 005a C5FB104B 		vmovsd	104(%rbx), %xmm1
+  40      68
+  41 005f 4889D0   		movq	%rdx, %rax
+  42 0062 488D0C8A 		leaq	(%rdx,%rcx,4), %rcx
+  43 0066 662E0F1F 		.p2align 4,,10
+  43      84000000 
+  43      0000
+  44              		.p2align 3
+  45              	.L14:
+  46 0070 C5EB59D1 		vmulsd	%xmm1, %xmm2, %xmm2
+  47 0074 4883C004 		addq	$4, %rax
+  48 0078 C5EB5AC2 		vcvtsd2ss	%xmm2, %xmm2, %xmm0
+  49 007c C5FA1140 		vmovss	%xmm0, -4(%rax)
+  49      FC
+  50 0081 4839C1   		cmpq	%rax, %rcx
+  51 0084 75EA     		jne	.L14
+  52 0086 89F1     		movl	%esi, %ecx
+  53              	.L13:
+  54 0088 4129F4   		subl	%esi, %r12d
+  55 008b 44896358 		movl	%r12d, 88(%rbx)
+  56 008f 0F85D000 		jne	.L16
+  56      0000
+  57              	.L40:
+  58 0095 C5FA1053 		vmovss	92(%rbx), %xmm2
+  58      5C
+  59              	.L17:
+  60 009a 39E9     		cmpl	%ebp, %ecx
+  61 009c 7D1F     		jge	.L20
+  62 009e 4863F1   		movslq	%ecx, %rsi
+  63 00a1 29CD     		subl	%ecx, %ebp
+  64 00a3 4801F5   		addq	%rsi, %rbp
+  65 00a6 488D04B2 		leaq	(%rdx,%rsi,4), %rax
+  66 00aa 488D0CAA 		leaq	(%rdx,%rbp,4), %rcx
+  67 00ae 6690     		.p2align 4,,10
+  68              		.p2align 3
+  69              	.L18:
+  70 00b0 C5FA1110 		vmovss	%xmm2, (%rax)
+  71 00b4 4883C004 		addq	$4, %rax
+  72 00b8 4839C1   		cmpq	%rax, %rcx
+  73 00bb 75F3     		jne	.L18
+  74              	.L20:
+  75 00bd C5FA1113 		vmovss	%xmm2, (%rbx)
+  76 00c1 4883C410 		addq	$16, %rsp
+  77              		.cfi_remember_state
+  78              		.cfi_def_cfa_offset 32
+  79 00c5 4889D0   		movq	%rdx, %rax
+  80 00c8 5B       		popq	%rbx
+  81              		.cfi_def_cfa_offset 24
+  82 00c9 5D       		popq	%rbp
+  83              		.cfi_def_cfa_offset 16
+  84 00ca 415C     		popq	%r12
+  85              		.cfi_def_cfa_offset 8
+  86 00cc C3       		ret
+  87 00cd 0F1F00   		.p2align 4,,10
+  88              		.p2align 3
+  89              	.L23:
+  90              		.cfi_restore_state
+  91 00d0 448B6354 		movl	84(%rbx), %r12d
+  92 00d4 807B5000 		cmpb	$0, 80(%rbx)
+  93 00d8 C5FA1143 		vmovss	%xmm0, 92(%rbx)
+  93      5C
+  94 00dd C5FA5AC0 		vcvtss2sd	%xmm0, %xmm0, %xmm0
+  95 00e1 C4C1632A 		vcvtsi2sdl	%r12d, %xmm3, %xmm1
+  95      CC
+  96 00e6 44896358 		movl	%r12d, 88(%rbx)
+  97 00ea 0F858000 		jne	.L39
+  97      0000
+  98              	.L4:
+  99 00f0 C5FB5CC2 		vsubsd	%xmm2, %xmm0, %xmm0
+ 100 00f4 C6436000 		movb	$0, 96(%rbx)
+ 101 00f8 C5FB5EC9 		vdivsd	%xmm1, %xmm0, %xmm1
+ 102 00fc C5FB114B 		vmovsd	%xmm1, 104(%rbx)
+ 102      68
+ 103 0101 4585E4   		testl	%r12d, %r12d
+ 104 0104 0F84B400 		je	.L8
+ 104      0000
+ 105 010a 4139EC   		cmpl	%ebp, %r12d
+ 106 010d 89EE     		movl	%ebp, %esi
+ 107 010f 410F4EF4 		cmovle	%r12d, %esi
+ 108              	.L21:
+ 109 0113 488B5370 		movq	112(%rbx), %rdx
+ 110 0117 4863FE   		movslq	%esi, %rdi
+ 111 011a B8010000 		movl	$1, %eax
+ 111      00
+ 112 011f 31C9     		xorl	%ecx, %ecx
+ 113 0121 85F6     		testl	%esi, %esi
+ 114 0123 7E27     		jle	.L12
+ 115              		.p2align 4,,10
+ 116 0125 0F1F00   		.p2align 3
+ 117              	.L15:
+ 118 0128 C5E32AC0 		vcvtsi2sdl	%eax, %xmm3, %xmm0
+ 119 012c 4889C1   		movq	%rax, %rcx
+ 120 012f C5FB59C1 		vmulsd	%xmm1, %xmm0, %xmm0
+ 121 0133 C5FB58C2 		vaddsd	%xmm2, %xmm0, %xmm0
+ 122 0137 C5FB5AC0 		vcvtsd2ss	%xmm0, %xmm0, %xmm0
+ 123 013b C5FA1144 		vmovss	%xmm0, -4(%rdx,%rax,4)
+ 123      82FC
+ 124 0141 4883C001 		addq	$1, %rax
+ 125 0145 4839CF   		cmpq	%rcx, %rdi
+ 126 0148 75DE     		jne	.L15
+ 127 014a 89F1     		movl	%esi, %ecx
+ 128              	.L12:
+ 129 014c C5E32ADE 		vcvtsi2sdl	%esi, %xmm3, %xmm3
+ 130 0150 4129F4   		subl	%esi, %r12d
+ 131 0153 44896358 		movl	%r12d, 88(%rbx)
+ 132 0157 C5E359C1 		vmulsd	%xmm1, %xmm3, %xmm0
+ 133 015b C5EB58D0 		vaddsd	%xmm0, %xmm2, %xmm2
+ 134 015f 0F8430FF 		je	.L40
+ 134      FFFF
+ 135              	.L16:
+ 136 0165 C5EB5AD2 		vcvtsd2ss	%xmm2, %xmm2, %xmm2
+ 137 0169 E92CFFFF 		jmp	.L17
+ 137      FF
+ 138 016e 6690     		.p2align 4,,10
+ 139              		.p2align 3
+ 140              	.L39:
+ 141 0170 C5EB59E8 		vmulsd	%xmm0, %xmm2, %xmm5
+ 142 0174 C5D957E4 		vxorpd	%xmm4, %xmm4, %xmm4
+ 143 0178 C5F92FEC 		vcomisd	%xmm4, %xmm5
+ 144 017c 0F866EFF 		jbe	.L4
+ 144      FFFF
+ 145 0182 C5FB101D 		vmovsd	.LC1(%rip), %xmm3
+ 145      00000000 
+ 146 018a C5FB5EC2 		vdivsd	%xmm2, %xmm0, %xmm0
+ 147 018e C6436001 		movb	$1, 96(%rbx)
+ 148 0192 C5FB1154 		vmovsd	%xmm2, 8(%rsp)
+ 148      2408
+ 149 0198 C5E35EC9 		vdivsd	%xmm1, %xmm3, %xmm1
+ 150 019c E8000000 		call	pow@PLT
+ 150      00
+ 151 01a1 4139EC   		cmpl	%ebp, %r12d
+ 152 01a4 89EE     		movl	%ebp, %esi
+ 153 01a6 C5FB1054 		vmovsd	8(%rsp), %xmm2
+ 153      2408
+ 154 01ac 410F4EF4 		cmovle	%r12d, %esi
+ 155 01b0 4585E4   		testl	%r12d, %r12d
+ 156 01b3 C5FB1143 		vmovsd	%xmm0, 104(%rbx)
+ 156      68
+ 157 01b8 0F858DFE 		jne	.L10
+ 157      FFFF
+ 158              	.L8:
+ 159 01be 4883C410 		addq	$16, %rsp
+ 160              		.cfi_remember_state
+ 161              		.cfi_def_cfa_offset 32
+ 162 01c2 31D2     		xorl	%edx, %edx
+ 163 01c4 5B       		popq	%rbx
+ 164              		.cfi_def_cfa_offset 24
+ 165 01c5 4889D0   		movq	%rdx, %rax
+ 166 01c8 5D       		popq	%rbp
+ 167              		.cfi_def_cfa_offset 16
+ 168 01c9 415C     		popq	%r12
+ 169              		.cfi_def_cfa_offset 8
+ 170 01cb C3       		ret
+ 171 01cc 0F1F4000 		.p2align 4,,10
+ 172              		.p2align 3
+ 173              	.L38:
+ 174              		.cfi_restore_state
+ 175 01d0 C5FB104F 		vmovsd	104(%rdi), %xmm1
+ 175      68
+ 176 01d5 E939FFFF 		jmp	.L21
+ 176      FF
+ 177              	.L22:
+ 178 01da 31C9     		xorl	%ecx, %ecx
+ 179 01dc E9A7FEFF 		jmp	.L13
+ 179      FF
+ 180              		.cfi_endproc
+ 181              	.LFE6406:
+ 183 01e1 66662E0F 		.p2align 4
+ 183      1F840000 
+ 183      0000000F 
+ 183      1F4000
+ 185              	lagrange_gain_and_clip_block:
+ 186              	.LFB6400:
+ 187              		.cfi_startproc
+ 188 01f0 4C8D5424 		leaq	8(%rsp), %r10
+ 188      08
+ 189              		.cfi_def_cfa 10, 0
+ 190 01f5 4883E4E0 		andq	$-32, %rsp
+ 191 01f9 41FF72F8 		pushq	-8(%r10)
+ 192 01fd 55       		pushq	%rbp
+ 193 01fe 4889E5   		movq	%rsp, %rbp
+ 194              		.cfi_escape 0x10,0x6,0x2,0x76,0
+ 195 0201 4156     		pushq	%r14
+ 196              		.cfi_escape 0x10,0xe,0x2,0x76,0x78
+ 197 0203 4989FE   		movq	%rdi, %r14
+ 198 0206 4155     		pushq	%r13
+ 199              		.cfi_escape 0x10,0xd,0x2,0x76,0x70
+ 200 0208 4189D5   		movl	%edx, %r13d
+ 201 020b 4154     		pushq	%r12
+ 202 020d 4152     		pushq	%r10
+ 203              		.cfi_escape 0xf,0x3,0x76,0x60,0x6
+ 204              		.cfi_escape 0x10,0xc,0x2,0x76,0x68
+ 205 020f 53       		pushq	%rbx
+ 206              		.cfi_escape 0x10,0x3,0x2,0x76,0x58
+ 207 0210 4889F3   		movq	%rsi, %rbx
+ 208 0213 4883EC48 		subq	$72, %rsp
+ 209 0217 C5FA1039 		vmovss	(%rcx), %xmm7
+ 210 021b C5F05735 		vxorps	.LC2(%rip), %xmm1, %xmm6
+ 210      00000000 
+ 211 0223 C5FA1145 		vmovss	%xmm0, -84(%rbp)
+ 211      AC
+ 212 0228 C5FA1051 		vmovss	8(%rcx), %xmm2
+ 212      08
+ 213 022d C5FA114D 		vmovss	%xmm1, -88(%rbp)
+ 213      A8
+ 214 0232 C5FA1175 		vmovss	%xmm6, -64(%rbp)
+ 214      C0
+ 215 0237 C4E27D18 		vbroadcastss	%xmm6, %ymm5
+ 215      EE
+ 216 023c C4E27D18 		vbroadcastss	%xmm7, %ymm6
+ 216      F7
+ 217 0241 C5FA117D 		vmovss	%xmm7, -68(%rbp)
+ 217      BC
+ 218 0246 C4627D18 		vbroadcastss	%xmm2, %ymm8
+ 218      C2
+ 219 024b C5FA1079 		vmovss	4(%rcx), %xmm7
+ 219      04
+ 220 0250 C5FA1155 		vmovss	%xmm2, -76(%rbp)
+ 220      B4
+ 221 0255 C5FA1051 		vmovss	12(%rcx), %xmm2
+ 221      0C
+ 222 025a C5FA117D 		vmovss	%xmm7, -72(%rbp)
+ 222      B8
+ 223 025f C5FA1155 		vmovss	%xmm2, -80(%rbp)
+ 223      B0
+ 224 0264 83FA07   		cmpl	$7, %edx
+ 225 0267 0F8E3B01 		jle	.L46
+ 225      0000
+ 226 026d 8D42F8   		leal	-8(%rdx), %eax
+ 227 0270 C4E27D18 		vbroadcastss	%xmm0, %ymm3
+ 227      D8
+ 228 0275 C4E27D18 		vbroadcastss	%xmm1, %ymm4
+ 228      E1
+ 229 027a C1E803   		shrl	$3, %eax
+ 230 027d C4E27D18 		vbroadcastss	%xmm7, %ymm7
+ 230      FF
+ 231 0282 C4E27D18 		vbroadcastss	%xmm2, %ymm2
+ 231      D2
+ 232 0287 8D5001   		leal	1(%rax), %edx
+ 233 028a 31C0     		xorl	%eax, %eax
+ 234 028c 4889D1   		movq	%rdx, %rcx
+ 235 028f 48C1E205 		salq	$5, %rdx
+ 236              		.p2align 4,,10
+ 237 0293 0F1F4400 		.p2align 3
+ 237      00
+ 238              	.L43:
+ 239 0298 C5C4594C 		vmulps	8(%rbx,%rax), %ymm7, %ymm1
+ 239      0308
+ 240 029e C5CC5944 		vmulps	12(%rbx,%rax), %ymm6, %ymm0
+ 240      030C
+ 241 02a4 C5FC58C1 		vaddps	%ymm1, %ymm0, %ymm0
+ 242 02a8 C5BC594C 		vmulps	4(%rbx,%rax), %ymm8, %ymm1
+ 242      0304
+ 243 02ae C5FC58C1 		vaddps	%ymm1, %ymm0, %ymm0
+ 244 02b2 C5EC590C 		vmulps	(%rbx,%rax), %ymm2, %ymm1
+ 244      03
+ 245 02b7 C5FC58C1 		vaddps	%ymm1, %ymm0, %ymm0
+ 246 02bb C5FC59C3 		vmulps	%ymm3, %ymm0, %ymm0
+ 247 02bf C5FC5DC4 		vminps	%ymm4, %ymm0, %ymm0
+ 248 02c3 C5FC5FC5 		vmaxps	%ymm5, %ymm0, %ymm0
+ 249 02c7 C4C17C11 		vmovups	%ymm0, (%r14,%rax)
+ 249      0406
+ 250 02cd 4883C020 		addq	$32, %rax
+ 251 02d1 4839C2   		cmpq	%rax, %rdx
+ 252 02d4 75C2     		jne	.L43
+ 253 02d6 8D04CD00 		leal	0(,%rcx,8), %eax
+ 253      000000
+ 254              	.L42:
+ 255 02dd 4139C5   		cmpl	%eax, %r13d
+ 256 02e0 0F8EBA00 		jle	.L49
+ 256      0000
+ 257 02e6 4863C8   		movslq	%eax, %rcx
+ 258 02e9 4129C5   		subl	%eax, %r13d
+ 259 02ec 4C8D248D 		leaq	0(,%rcx,4), %r12
+ 259      00000000 
+ 260 02f4 4901CD   		addq	%rcx, %r13
+ 261 02f7 4A8D1423 		leaq	(%rbx,%r12), %rdx
+ 262 02fb 49C1E502 		salq	$2, %r13
+ 263 02ff C5FA100A 		vmovss	(%rdx), %xmm1
+ 264 0303 C5FA1062 		vmovss	4(%rdx), %xmm4
+ 264      04
+ 265 0308 C5FA105A 		vmovss	8(%rdx), %xmm3
+ 265      08
+ 266 030d C5F877   		vzeroupper
+ 267              		.p2align 4,,10
+ 268              		.p2align 3
+ 269              	.L45:
+ 270 0310 C5F828EB 		vmovaps	%xmm3, %xmm5
+ 271 0314 C4A17A10 		vmovss	12(%rbx,%r12), %xmm3
+ 271      5C230C
+ 272 031b C5FA1165 		vmovss	%xmm4, -52(%rbp)
+ 272      CC
+ 273 0320 C5E25945 		vmulss	-68(%rbp), %xmm3, %xmm0
+ 273      BC
+ 274 0325 C5FA116D 		vmovss	%xmm5, -56(%rbp)
+ 274      C8
+ 275 032a C5D25955 		vmulss	-72(%rbp), %xmm5, %xmm2
+ 275      B8
+ 276 032f C5FA115D 		vmovss	%xmm3, -60(%rbp)
+ 276      C4
+ 277 0334 C5F2594D 		vmulss	-80(%rbp), %xmm1, %xmm1
+ 277      B0
+ 278 0339 C5EA58D0 		vaddss	%xmm0, %xmm2, %xmm2
+ 279 033d C5DA5945 		vmulss	-76(%rbp), %xmm4, %xmm0
+ 279      B4
+ 280 0342 C5FA58C2 		vaddss	%xmm2, %xmm0, %xmm0
+ 281 0346 C5F258C8 		vaddss	%xmm0, %xmm1, %xmm1
+ 282 034a C5F2594D 		vmulss	-84(%rbp), %xmm1, %xmm1
+ 282      AC
+ 283 034f C5FA1045 		vmovss	-88(%rbp), %xmm0
+ 283      A8
+ 284 0354 E8000000 		call	fminf@PLT
+ 284      00
+ 285 0359 C5F828C8 		vmovaps	%xmm0, %xmm1
+ 286 035d C5FA1045 		vmovss	-64(%rbp), %xmm0
+ 286      C0
+ 287 0362 E8000000 		call	fmaxf@PLT
+ 287      00
+ 288 0367 C5FA1065 		vmovss	-52(%rbp), %xmm4
+ 288      CC
+ 289 036c C5FA106D 		vmovss	-56(%rbp), %xmm5
+ 289      C8
+ 290 0371 C4817A11 		vmovss	%xmm0, (%r14,%r12)
+ 290      0426
+ 291 0377 4983C404 		addq	$4, %r12
+ 292 037b C5FA105D 		vmovss	-60(%rbp), %xmm3
+ 292      C4
+ 293 0380 4D39E5   		cmpq	%r12, %r13
+ 294 0383 C5F828CC 		vmovaps	%xmm4, %xmm1
+ 295 0387 C5F828E5 		vmovaps	%xmm5, %xmm4
+ 296 038b 7583     		jne	.L45
+ 297              	.L50:
+ 298 038d 4883C448 		addq	$72, %rsp
+ 299 0391 5B       		popq	%rbx
+ 300 0392 415A     		popq	%r10
+ 301              		.cfi_remember_state
+ 302              		.cfi_def_cfa 10, 0
+ 303 0394 415C     		popq	%r12
+ 304 0396 415D     		popq	%r13
+ 305 0398 415E     		popq	%r14
+ 306 039a 5D       		popq	%rbp
+ 307 039b 498D62F8 		leaq	-8(%r10), %rsp
+ 308              		.cfi_def_cfa 7, 8
+ 309 039f C3       		ret
+ 310              		.p2align 4,,10
+ 311              		.p2align 3
+ 312              	.L49:
+ 313              		.cfi_restore_state
+ 314 03a0 C5F877   		vzeroupper
+ 315 03a3 EBE8     		jmp	.L50
+ 316              		.p2align 4,,10
+ 317 03a5 0F1F00   		.p2align 3
+ 318              	.L46:
+ 319 03a8 31C0     		xorl	%eax, %eax
+ 320 03aa E92EFFFF 		jmp	.L42
+ 320      FF
+ 321              		.cfi_endproc
+ 322              	.LFE6400:
+ 324              		.section	.rodata.str1.8,"aMS",@progbits,1
+ 325              		.align 8
+ 326              	.LC12:
+ 327 0000 25733A20 		.string	"%s: delay_samples=%d, taps=%d\n"
+ 327      64656C61 
+ 327      795F7361 
+ 327      6D706C65 
+ 327      733D2564 
+ 328 001f 00       		.align 8
+ 329              	.LC13:
+ 330 0020 436F756C 		.string	"Could not allocate memory for delay line.\n"
+ 330      64206E6F 
+ 330      7420616C 
+ 330      6C6F6361 
+ 330      7465206D 
+ 331 004b 00000000 		.align 8
+ 331      00
+ 332              	.LC14:
+ 333 0050 436F756C 		.string	"Could not allocate memory for gain ramp.\n"
+ 333      64206E6F 
+ 333      7420616C 
+ 333      6C6F6361 
+ 333      7465206D 
+ 334              		.section	.rodata.str1.1,"aMS",@progbits,1
+ 335              	.LC20:
+ 336 0000 25733A20 		.string	"%s: lookahead=%d, latency=%d\n"
+ 336      6C6F6F6B 
+ 336      61686561 
+ 336      643D2564 
+ 336      2C206C61 
+ 337              		.section	.rodata.str1.8
+ 338 007a 00000000 		.align 8
+ 338      0000
+ 339              	.LC21:
+ 340 0080 436F756C 		.string	"Could not allocate memory for limiter.\n"
+ 340      64206E6F 
+ 340      7420616C 
+ 340      6C6F6361 
+ 340      7465206D 
+ 341              		.text
+ 342 03af 90       		.p2align 4
+ 343              		.globl	gain_init
+ 345              	gain_init:
+ 346              	.LFB6417:
+ 347              		.cfi_startproc
+ 348 03b0 4C8D5424 		leaq	8(%rsp), %r10
+ 348      08
+ 349              		.cfi_def_cfa 10, 0
+ 350 03b5 4883E4C0 		andq	$-64, %rsp
+ 351 03b9 C5E157DB 		vxorpd	%xmm3, %xmm3, %xmm3
+ 352 03bd 41FF72F8 		pushq	-8(%r10)
+ 353 03c1 55       		pushq	%rbp
+ 354 03c2 4889E5   		movq	%rsp, %rbp
+ 355              		.cfi_escape 0x10,0x6,0x2,0x76,0
+ 356 03c5 4157     		pushq	%r15
+ 357 03c7 4156     		pushq	%r14
+ 358 03c9 4155     		pushq	%r13
+ 359 03cb 4154     		pushq	%r12
+ 360              		.cfi_escape 0x10,0xf,0x2,0x76,0x78
+ 361              		.cfi_escape 0x10,0xe,0x2,0x76,0x70
+ 362              		.cfi_escape 0x10,0xd,0x2,0x76,0x68
+ 363              		.cfi_escape 0x10,0xc,0x2,0x76,0x60
+ 364 03cd 4989FC   		movq	%rdi, %r12
+ 365 03d0 4152     		pushq	%r10
+ 366              		.cfi_escape 0xf,0x3,0x76,0x58,0x6
+ 367 03d2 53       		pushq	%rbx
+ 368 03d3 4883EC40 		subq	$64, %rsp
+ 369              		.cfi_escape 0x10,0x3,0x2,0x76,0x50
+ 370 03d7 488B9FC0 		movq	192(%rdi), %rbx
+ 370      000000
+ 371 03de 62F16708 		vcvtusi2sdl	152(%rdi), %xmm3, %xmm0
+ 371      7B4726
+ 372 03e5 C5FB101D 		vmovsd	.LC7(%rip), %xmm3
+ 372      00000000 
+ 373 03ed C5FB5943 		vmulsd	8(%rbx), %xmm0, %xmm0
+ 373      08
+ 374 03f2 C5FB580D 		vaddsd	.LC5(%rip), %xmm0, %xmm1
+ 374      00000000 
+ 375 03fa 62F3F508 		vrndscalesd	$9, %xmm1, %xmm1, %xmm1
+ 375      0BC909
+ 376 0401 C5FB5CD1 		vsubsd	%xmm1, %xmm0, %xmm2
+ 377 0405 C5E95415 		vandpd	.LC6(%rip), %xmm2, %xmm2
+ 377      00000000 
+ 378 040d C5F92FDA 		vcomisd	%xmm2, %xmm3
+ 379 0411 0F867105 		jbe	.L85
+ 379      0000
+ 380 0417 C5FB2CC9 		vcvttsd2sil	%xmm1, %ecx
+ 381 041b C7431401 		movl	$1, 20(%rbx)
+ 381      000000
+ 382 0422 41B80100 		movl	$1, %r8d
+ 382      0000
+ 383 0428 894B10   		movl	%ecx, 16(%rbx)
+ 384              	.L55:
+ 385 042b 31C0     		xorl	%eax, %eax
+ 386 042d 488D1500 		leaq	__func__.4(%rip), %rdx
+ 386      000000
+ 387 0434 BF020000 		movl	$2, %edi
+ 387      00
+ 388 0439 488D3500 		leaq	.LC12(%rip), %rsi
+ 388      000000
+ 389 0440 E8000000 		call	debugprint@PLT
+ 389      00
+ 390 0445 418B9424 		movl	164(%r12), %edx
+ 390      A4000000 
+ 391 044d 8B4314   		movl	20(%rbx), %eax
+ 392 0450 C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 393 0454 034310   		addl	16(%rbx), %eax
+ 394 0457 488B7B28 		movq	40(%rbx), %rdi
+ 395 045b C7433C00 		movl	$0, 60(%rbx)
+ 395      000000
+ 396 0462 62F17F28 		vmovdqu8	%ymm0, 128(%rbx)
+ 396      7F4304
+ 397 0469 8D4410FF 		leal	-1(%rax,%rdx), %eax
+ 398 046d 894338   		movl	%eax, 56(%rbx)
+ 399 0470 410FAF84 		imull	156(%r12), %eax
+ 399      249C0000 
+ 399      00
+ 400 0479 4863F0   		movslq	%eax, %rsi
+ 401 047c 48C1E602 		salq	$2, %rsi
+ 402 0480 C5F877   		vzeroupper
+ 403 0483 E8000000 		call	realloc@PLT
+ 403      00
+ 404 0488 8B5338   		movl	56(%rbx), %edx
+ 405 048b 31F6     		xorl	%esi, %esi
+ 406 048d 410FAF94 		imull	156(%r12), %edx
+ 406      249C0000 
+ 406      00
+ 407 0496 48894328 		movq	%rax, 40(%rbx)
+ 408 049a 4889C7   		movq	%rax, %rdi
+ 409 049d 4863D2   		movslq	%edx, %rdx
+ 410 04a0 48C1E202 		salq	$2, %rdx
+ 411 04a4 E8000000 		call	memset@PLT
+ 411      00
+ 412 04a9 8B7314   		movl	20(%rbx), %esi
+ 413 04ac 4103B424 		addl	164(%r12), %esi
+ 413      A4000000 
+ 414 04b4 83EE01   		subl	$1, %esi
+ 415 04b7 488B7B30 		movq	48(%rbx), %rdi
+ 416 04bb 4863F6   		movslq	%esi, %rsi
+ 417 04be 48C1E602 		salq	$2, %rsi
+ 418 04c2 E8000000 		call	realloc@PLT
+ 418      00
+ 419 04c7 48837B28 		cmpq	$0, 40(%rbx)
+ 419      00
+ 420 04cc 48894330 		movq	%rax, 48(%rbx)
+ 421 04d0 0F84D205 		je	.L73
+ 421      0000
+ 422 04d6 4885C0   		testq	%rax, %rax
+ 423 04d9 0F84C905 		je	.L73
+ 423      0000
+ 424              	.L58:
+ 425 04df C5E157DB 		vxorpd	%xmm3, %xmm3, %xmm3
+ 426 04e3 8B4344   		movl	68(%rbx), %eax
+ 427 04e6 C7435800 		movl	$0, 88(%rbx)
+ 427      000000
+ 428 04ed 62D16708 		vcvtusi2sdl	152(%r12), %xmm3, %xmm0
+ 428      7B442426 
+ 429 04f5 C5FB5943 		vmulsd	72(%rbx), %xmm0, %xmm0
+ 429      48
+ 430 04fa 488B7B70 		movq	112(%rbx), %rdi
+ 431 04fe C5FB5805 		vaddsd	.LC5(%rip), %xmm0, %xmm0
+ 431      00000000 
+ 432 0506 89435C   		movl	%eax, 92(%rbx)
+ 433 0509 C5F96F0D 		vmovdqa	.LC24(%rip), %xmm1
+ 433      00000000 
+ 434 0511 8903     		movl	%eax, (%rbx)
+ 435 0513 C5FB2CC0 		vcvttsd2sil	%xmm0, %eax
+ 436 0517 C5F96EC0 		vmovd	%eax, %xmm0
+ 437 051b C4E2793D 		vpmaxsd	%xmm1, %xmm0, %xmm0
+ 437      C1
+ 438 0520 C5F97E43 		vmovd	%xmm0, 84(%rbx)
+ 438      54
+ 439 0525 4963B424 		movslq	164(%r12), %rsi
+ 439      A4000000 
+ 440 052d 48C1E602 		salq	$2, %rsi
+ 441 0531 E8000000 		call	realloc@PLT
+ 441      00
+ 442 0536 48894370 		movq	%rax, 112(%rbx)
+ 443 053a 4885C0   		testq	%rax, %rax
+ 444 053d 0F847605 		je	.L89
+ 444      0000
+ 445              	.L60:
+ 446 0543 488B5B78 		movq	120(%rbx), %rbx
+ 447 0547 4885DB   		testq	%rbx, %rbx
+ 448 054a 0F841D04 		je	.L87
+ 448      0000
+ 449 0550 C5E157DB 		vxorpd	%xmm3, %xmm3, %xmm3
+ 450 0554 B8010000 		movl	$1, %eax
+ 450      00
+ 451 0559 4C8D6B1C 		leaq	28(%rbx), %r13
+ 452 055d 62D16708 		vcvtusi2sdl	152(%r12), %xmm3, %xmm0
+ 452      7B442426 
+ 453 0565 C5FB590B 		vmulsd	(%rbx), %xmm0, %xmm1
+ 454 0569 C5F3580D 		vaddsd	.LC5(%rip), %xmm1, %xmm1
+ 454      00000000 
+ 455 0571 C5FB5943 		vmulsd	8(%rbx), %xmm0, %xmm0
+ 455      08
+ 456 0576 C5FB2CC9 		vcvttsd2sil	%xmm1, %ecx
+ 457 057a C5FB100D 		vmovsd	.LC15(%rip), %xmm1
+ 457      00000000 
+ 458 0582 C5F35EC0 		vdivsd	%xmm0, %xmm1, %xmm0
+ 459 0586 85C9     		testl	%ecx, %ecx
+ 460 0588 0F4FC1   		cmovg	%ecx, %eax
+ 461 058b 894310   		movl	%eax, 16(%rbx)
+ 462 058e 89459C   		movl	%eax, -100(%rbp)
+ 463 0591 C5FB5AC0 		vcvtsd2ss	%xmm0, %xmm0, %xmm0
+ 464 0595 E8000000 		call	expf@PLT
+ 464      00
+ 465 059a C5FB1025 		vmovsd	.LC1(%rip), %xmm4
+ 465      00000000 
+ 466 05a2 48C745A0 		movq	$1, -96(%rbp)
+ 466      01000000 
+ 467 05aa C5FA1143 		vmovss	%xmm0, 20(%rbx)
+ 467      14
+ 468 05af C5FB1015 		vmovsd	.LC4(%rip), %xmm2
+ 468      00000000 
+ 469 05b7 C5FB1005 		vmovsd	.LC3(%rip), %xmm0
+ 469      00000000 
+ 470 05bf C5FB1165 		vmovsd	%xmm4, -80(%rbp)
+ 470      B0
+ 471 05c4 C5DB10CC 		vmovsd	%xmm4, %xmm4, %xmm1
+ 472              	.L62:
+ 473 05c8 C5F35925 		vmulsd	.LC18(%rip), %xmm1, %xmm4
+ 473      00000000 
+ 474 05d0 C5FB5845 		vaddsd	-80(%rbp), %xmm0, %xmm0
+ 474      B0
+ 475 05d5 4D89EE   		movq	%r13, %r14
+ 476 05d8 41BFFAFF 		movl	$-6, %r15d
+ 476      FFFF
+ 477 05de C5FB101D 		vmovsd	.LC19(%rip), %xmm3
+ 477      00000000 
+ 478 05e6 C5E35CCC 		vsubsd	%xmm4, %xmm3, %xmm1
+ 479 05ea C5F3590D 		vmulsd	.LC16(%rip), %xmm1, %xmm1
+ 479      00000000 
+ 480 05f2 C5E157DB 		vxorpd	%xmm3, %xmm3, %xmm3
+ 481 05f6 C5FB1165 		vmovsd	%xmm4, -88(%rbp)
+ 481      A8
+ 482 05fb C5EB5ED1 		vdivsd	%xmm1, %xmm2, %xmm2
+ 483 05ff C5EB5915 		vmulsd	.LC5(%rip), %xmm2, %xmm2
+ 483      00000000 
+ 484 0607 C5EB59C0 		vmulsd	%xmm0, %xmm2, %xmm0
+ 485 060b C5FB5AC0 		vcvtsd2ss	%xmm0, %xmm0, %xmm0
+ 486 060f C4C17A11 		vmovss	%xmm0, -4(%r13)
+ 486      45FC
+ 487 0615 C5FA5AC0 		vcvtss2sd	%xmm0, %xmm0, %xmm0
+ 488 0619 C5FB58E3 		vaddsd	%xmm3, %xmm0, %xmm4
+ 489 061d C5FB1165 		vmovsd	%xmm4, -64(%rbp)
+ 489      C0
+ 490              		.p2align 4,,10
+ 491 0622 660F1F44 		.p2align 3
+ 491      0000
+ 492              	.L63:
+ 493 0628 C5C957F6 		vxorpd	%xmm6, %xmm6, %xmm6
+ 494 062c 4983C604 		addq	$4, %r14
+ 495 0630 C4C14B2A 		vcvtsi2sdl	%r15d, %xmm6, %xmm0
+ 495      C7
+ 496 0635 C5FB5C45 		vsubsd	-88(%rbp), %xmm0, %xmm0
+ 496      A8
+ 497 063a 4183C701 		addl	$1, %r15d
+ 498 063e C5FB593D 		vmulsd	.LC16(%rip), %xmm0, %xmm7
+ 498      00000000 
+ 499 0646 C5C310C7 		vmovsd	%xmm7, %xmm7, %xmm0
+ 500 064a C5FB117D 		vmovsd	%xmm7, -56(%rbp)
+ 500      C8
+ 501 064f E8000000 		call	sin@PLT
+ 501      00
+ 502 0654 C5FB1025 		vmovsd	.LC17(%rip), %xmm4
+ 502      00000000 
+ 503 065c C5FB1145 		vmovsd	%xmm0, -72(%rbp)
+ 503      B8
+ 504 0661 C5DB5945 		vmulsd	-56(%rbp), %xmm4, %xmm0
+ 504      C8
+ 505 0666 E8000000 		call	cos@PLT
+ 505      00
+ 506 066b C5FB1055 		vmovsd	-72(%rbp), %xmm2
+ 506      B8
+ 507 0670 C5FB10C8 		vmovsd	%xmm0, %xmm0, %xmm1
+ 508 0674 C5EB5E45 		vdivsd	-56(%rbp), %xmm2, %xmm0
+ 508      C8
+ 509 0679 C5F3584D 		vaddsd	-80(%rbp), %xmm1, %xmm1
+ 509      B0
+ 510 067e C5FB5905 		vmulsd	.LC5(%rip), %xmm0, %xmm0
+ 510      00000000 
+ 511 0686 C5FB59C1 		vmulsd	%xmm1, %xmm0, %xmm0
+ 512 068a C5FB5AC0 		vcvtsd2ss	%xmm0, %xmm0, %xmm0
+ 513 068e C4C17A11 		vmovss	%xmm0, -4(%r14)
+ 513      46FC
+ 514 0694 C5FA5AC0 		vcvtss2sd	%xmm0, %xmm0, %xmm0
+ 515 0698 C5FB5875 		vaddsd	-64(%rbp), %xmm0, %xmm6
+ 515      C0
+ 516 069d C5FB1175 		vmovsd	%xmm6, -64(%rbp)
+ 516      C0
+ 517 06a2 4183FF09 		cmpl	$9, %r15d
+ 518 06a6 7580     		jne	.L63
+ 519 06a8 62D17C48 		vmovups	-4(%r13), %zmm3
+ 519      109DFCFF 
+ 519      FFFF
+ 520 06b2 62F2FD48 		vbroadcastsd	%xmm6, %zmm2
+ 520      19D6
+ 521 06b8 488345A0 		addq	$1, -96(%rbp)
+ 521      01
+ 522 06bd 62D17C48 		vcvtps2pd	-4(%r13), %zmm1
+ 522      5A8DFCFF 
+ 522      FFFF
+ 523 06c7 488B45A0 		movq	-96(%rbp), %rax
+ 524 06cb 62F1F548 		vdivpd	%zmm2, %zmm1, %zmm1
+ 524      5ECA
+ 525 06d1 62F1FD48 		vcvtpd2ps	%zmm1, %ymm1
+ 525      5AC9
+ 526 06d7 62F37D48 		vextractf32x8	$0x1, %zmm3, %ymm0
+ 526      1BD801
+ 527 06de 62F17C48 		vcvtps2pd	%ymm0, %zmm0
+ 527      5AC0
+ 528 06e4 62F1FD48 		vdivpd	%zmm2, %zmm0, %zmm0
+ 528      5EC2
+ 529 06ea 62F1FD48 		vcvtpd2ps	%zmm0, %ymm0
+ 529      5AC0
+ 530 06f0 62F3F548 		vinsertf64x4	$0x1, %ymm0, %zmm1, %zmm0
+ 530      1AC001
+ 531 06f7 62D17C48 		vmovups	%zmm0, -4(%r13)
+ 531      1185FCFF 
+ 531      FFFF
+ 532 0701 4883F804 		cmpq	$4, %rax
+ 533 0705 7469     		je	.L64
+ 534 0707 C5D957E4 		vxorpd	%xmm4, %xmm4, %xmm4
+ 535 070b 4983C540 		addq	$64, %r13
+ 536 070f C5DB2A4D 		vcvtsi2sdl	-96(%rbp), %xmm4, %xmm1
+ 536      A0
+ 537 0714 C5F3591D 		vmulsd	.LC18(%rip), %xmm1, %xmm3
+ 537      00000000 
+ 538 071c C5FB1025 		vmovsd	.LC19(%rip), %xmm4
+ 538      00000000 
+ 539 0724 C5FB114D 		vmovsd	%xmm1, -72(%rbp)
+ 539      B8
+ 540 0729 C5DB5CDB 		vsubsd	%xmm3, %xmm4, %xmm3
+ 541 072d C5E3591D 		vmulsd	.LC16(%rip), %xmm3, %xmm3
+ 541      00000000 
+ 542 0735 C5E310C3 		vmovsd	%xmm3, %xmm3, %xmm0
+ 543 0739 C5FB115D 		vmovsd	%xmm3, -64(%rbp)
+ 543      C0
+ 544 073e C5F877   		vzeroupper
+ 545 0741 E8000000 		call	sin@PLT
+ 545      00
+ 546 0746 C5FB105D 		vmovsd	-64(%rbp), %xmm3
+ 546      C0
+ 547 074b C5FB1145 		vmovsd	%xmm0, -56(%rbp)
+ 547      C8
+ 548 0750 C5E35905 		vmulsd	.LC17(%rip), %xmm3, %xmm0
+ 548      00000000 
+ 549 0758 E8000000 		call	cos@PLT
+ 549      00
+ 550 075d C5FB104D 		vmovsd	-72(%rbp), %xmm1
+ 550      B8
+ 551 0762 C5FB1055 		vmovsd	-56(%rbp), %xmm2
+ 551      C8
+ 552 0767 E95CFEFF 		jmp	.L62
+ 552      FF
+ 553 076c 0F1F4000 		.p2align 4,,10
+ 554              		.p2align 3
+ 555              	.L64:
+ 556 0770 8B459C   		movl	-100(%rbp), %eax
+ 557 0773 488D1500 		leaq	__func__.3(%rip), %rdx
+ 557      000000
+ 558 077a BF020000 		movl	$2, %edi
+ 558      00
+ 559 077f 488D3500 		leaq	.LC20(%rip), %rsi
+ 559      000000
+ 560 0786 448D4008 		leal	8(%rax), %r8d
+ 561 078a 89C1     		movl	%eax, %ecx
+ 562 078c 31C0     		xorl	%eax, %eax
+ 563 078e C5F877   		vzeroupper
+ 564 0791 E8000000 		call	debugprint@PLT
+ 564      00
+ 565 0796 8B5310   		movl	16(%rbx), %edx
+ 566 0799 C5E157DB 		vxorpd	%xmm3, %xmm3, %xmm3
+ 567 079d 488BBBD8 		movq	216(%rbx), %rdi
+ 567      000000
+ 568 07a4 C5E32AC2 		vcvtsi2sdl	%edx, %xmm3, %xmm0
+ 569 07a8 8D4202   		leal	2(%rdx), %eax
+ 570 07ab 89831001 		movl	%eax, 272(%rbx)
+ 570      0000
+ 571 07b1 418B8424 		movl	164(%r12), %eax
+ 571      A4000000 
+ 572 07b9 48C78314 		movq	$0, 276(%rbx)
+ 572      01000000 
+ 572      000000
+ 573 07c4 8D4C0208 		leal	8(%rdx,%rax), %ecx
+ 574 07c8 8D700F   		leal	15(%rax), %esi
+ 575 07cb C783FC00 		movl	$0, 252(%rbx)
+ 575      00000000 
+ 575      0000
+ 576 07d5 898BF800 		movl	%ecx, 248(%rbx)
+ 576      0000
+ 577 07db 48B90000 		movabsq	$4575657221408423936, %rcx
+ 577      00000000 
+ 577      803F
+ 578 07e5 48898B1C 		movq	%rcx, 284(%rbx)
+ 578      010000
+ 579 07ec 410FAFB4 		imull	156(%r12), %esi
+ 579      249C0000 
+ 579      00
+ 580 07f5 C7833001 		movl	$0, 304(%rbx)
+ 580      00000000 
+ 580      0000
+ 581 07ff C5FB1183 		vmovsd	%xmm0, 312(%rbx)
+ 581      38010000 
+ 582 0807 4863F6   		movslq	%esi, %rsi
+ 583 080a 48C1E602 		salq	$2, %rsi
+ 584 080e E8000000 		call	realloc@PLT
+ 584      00
+ 585 0813 4963B424 		movslq	164(%r12), %rsi
+ 585      A4000000 
+ 586 081b 488BBBE0 		movq	224(%rbx), %rdi
+ 586      000000
+ 587 0822 488983D8 		movq	%rax, 216(%rbx)
+ 587      000000
+ 588 0829 48C1E602 		salq	$2, %rsi
+ 589 082d E8000000 		call	realloc@PLT
+ 589      00
+ 590 0832 4963B424 		movslq	164(%r12), %rsi
+ 590      A4000000 
+ 591 083a 488BBBE8 		movq	232(%rbx), %rdi
+ 591      000000
+ 592 0841 488983E0 		movq	%rax, 224(%rbx)
+ 592      000000
+ 593 0848 48C1E602 		salq	$2, %rsi
+ 594 084c E8000000 		call	realloc@PLT
+ 594      00
+ 595 0851 8BB3F800 		movl	248(%rbx), %esi
+ 595      0000
+ 596 0857 410FAFB4 		imull	156(%r12), %esi
+ 596      249C0000 
+ 596      00
+ 597 0860 488983E8 		movq	%rax, 232(%rbx)
+ 597      000000
+ 598 0867 488BBBF0 		movq	240(%rbx), %rdi
+ 598      000000
+ 599 086e 4863F6   		movslq	%esi, %rsi
+ 600 0871 48C1E602 		salq	$2, %rsi
+ 601 0875 E8000000 		call	realloc@PLT
+ 601      00
+ 602 087a 4863B310 		movslq	272(%rbx), %rsi
+ 602      010000
+ 603 0881 488BBB00 		movq	256(%rbx), %rdi
+ 603      010000
+ 604 0888 488983F0 		movq	%rax, 240(%rbx)
+ 604      000000
+ 605 088f 48C1E602 		salq	$2, %rsi
+ 606 0893 E8000000 		call	realloc@PLT
+ 606      00
+ 607 0898 4863B310 		movslq	272(%rbx), %rsi
+ 607      010000
+ 608 089f 488BBB08 		movq	264(%rbx), %rdi
+ 608      010000
+ 609 08a6 48898300 		movq	%rax, 256(%rbx)
+ 609      010000
+ 610 08ad 48C1E602 		salq	$2, %rsi
+ 611 08b1 E8000000 		call	realloc@PLT
+ 611      00
+ 612 08b6 48637310 		movslq	16(%rbx), %rsi
+ 613 08ba 488BBB28 		movq	296(%rbx), %rdi
+ 613      010000
+ 614 08c1 48898308 		movq	%rax, 264(%rbx)
+ 614      010000
+ 615 08c8 48C1E602 		salq	$2, %rsi
+ 616 08cc E8000000 		call	realloc@PLT
+ 616      00
+ 617 08d1 488BBBD8 		movq	216(%rbx), %rdi
+ 617      000000
+ 618 08d8 48898328 		movq	%rax, 296(%rbx)
+ 618      010000
+ 619 08df 4885FF   		testq	%rdi, %rdi
+ 620 08e2 0F856801 		jne	.L90
+ 620      0000
+ 621              	.L65:
+ 622 08e8 488D3D00 		leaq	.LC21(%rip), %rdi
+ 622      000000
+ 623 08ef E8000000 		call	endprogram@PLT
+ 623      00
+ 624 08f4 488BBBD8 		movq	216(%rbx), %rdi
+ 624      000000
+ 625              	.L66:
+ 626 08fb 418B8424 		movl	164(%r12), %eax
+ 626      A4000000 
+ 627 0903 31F6     		xorl	%esi, %esi
+ 628 0905 8D500F   		leal	15(%rax), %edx
+ 629 0908 410FAF94 		imull	156(%r12), %edx
+ 629      249C0000 
+ 629      00
+ 630 0911 4863D2   		movslq	%edx, %rdx
+ 631 0914 48C1E202 		salq	$2, %rdx
+ 632 0918 E8000000 		call	memset@PLT
+ 632      00
+ 633 091d 8B93F800 		movl	248(%rbx), %edx
+ 633      0000
+ 634 0923 488BBBF0 		movq	240(%rbx), %rdi
+ 634      000000
+ 635 092a 31F6     		xorl	%esi, %esi
+ 636 092c 410FAF94 		imull	156(%r12), %edx
+ 636      249C0000 
+ 636      00
+ 637 0935 4863D2   		movslq	%edx, %rdx
+ 638 0938 48C1E202 		salq	$2, %rdx
+ 639 093c E8000000 		call	memset@PLT
+ 639      00
+ 640 0941 48635310 		movslq	16(%rbx), %rdx
+ 641 0945 85D2     		testl	%edx, %edx
+ 642 0947 7E24     		jle	.L87
+ 643 0949 488B8328 		movq	296(%rbx), %rax
+ 643      010000
+ 644 0950 C5FA1005 		vmovss	.LC22(%rip), %xmm0
+ 644      00000000 
+ 645 0958 488D1490 		leaq	(%rax,%rdx,4), %rdx
+ 646 095c 0F1F4000 		.p2align 4,,10
+ 647              		.p2align 3
+ 648              	.L69:
+ 649 0960 C5FA1100 		vmovss	%xmm0, (%rax)
+ 650 0964 4883C004 		addq	$4, %rax
+ 651 0968 4839D0   		cmpq	%rdx, %rax
+ 652 096b 75F3     		jne	.L69
+ 653              	.L87:
+ 654 096d 4883C440 		addq	$64, %rsp
+ 655 0971 5B       		popq	%rbx
+ 656 0972 415A     		popq	%r10
+ 657              		.cfi_remember_state
+ 658              		.cfi_def_cfa 10, 0
+ 659 0974 415C     		popq	%r12
+ 660 0976 415D     		popq	%r13
+ 661 0978 415E     		popq	%r14
+ 662 097a 415F     		popq	%r15
+ 663 097c 5D       		popq	%rbp
+ 664 097d 498D62F8 		leaq	-8(%r10), %rsp
+ 665              		.cfi_def_cfa 7, 8
+ 666 0981 C3       		ret
+ 667              		.p2align 4,,10
+ 668 0982 660F1F44 		.p2align 3
+ 668      0000
+ 669              	.L85:
+ 670              		.cfi_restore_state
+ 671 0988 C5FB1025 		vmovsd	.LC8(%rip), %xmm4
+ 671      00000000 
+ 672 0990 31C9     		xorl	%ecx, %ecx
+ 673 0992 C5F92FC4 		vcomisd	%xmm4, %xmm0
+ 674 0996 721A     		jb	.L56
+ 675 0998 62F3FD08 		vrndscalesd	$9, %xmm0, %xmm0, %xmm1
+ 675      0BC809
+ 676 099f C5FB2CC9 		vcvttsd2sil	%xmm1, %ecx
+ 677 09a3 C5E157DB 		vxorpd	%xmm3, %xmm3, %xmm3
+ 678 09a7 83E901   		subl	$1, %ecx
+ 679 09aa C5E32AC9 		vcvtsi2sdl	%ecx, %xmm3, %xmm1
+ 680 09ae C5FB5CC1 		vsubsd	%xmm1, %xmm0, %xmm0
+ 681              	.L56:
+ 682 09b2 C5FB5CE4 		vsubsd	%xmm4, %xmm0, %xmm4
+ 683 09b6 894B10   		movl	%ecx, 16(%rbx)
+ 684 09b9 C5FB101D 		vmovsd	.LC1(%rip), %xmm3
+ 684      00000000 
+ 685 09c1 41B80400 		movl	$4, %r8d
+ 685      0000
+ 686 09c7 C5FA7E2D 		vmovq	.LC10(%rip), %xmm5
+ 686      00000000 
+ 687 09cf C7431404 		movl	$4, 20(%rbx)
+ 687      000000
+ 688 09d6 C5FB1035 		vmovsd	.LC11(%rip), %xmm6
+ 688      00000000 
+ 689 09de C5FB5CCB 		vsubsd	%xmm3, %xmm0, %xmm1
+ 690 09e2 C5FB5C1D 		vsubsd	.LC9(%rip), %xmm0, %xmm3
+ 690      00000000 
+ 691 09ea C5F957D5 		vxorpd	%xmm5, %xmm0, %xmm2
+ 692 09ee C5DB59C0 		vmulsd	%xmm0, %xmm4, %xmm0
+ 693 09f2 C5EB59D1 		vmulsd	%xmm1, %xmm2, %xmm2
+ 694 09f6 C5F157CD 		vxorpd	%xmm5, %xmm1, %xmm1
+ 695 09fa C5F359CC 		vmulsd	%xmm4, %xmm1, %xmm1
+ 696 09fe C5FB59C3 		vmulsd	%xmm3, %xmm0, %xmm0
+ 697 0a02 C5FB5905 		vmulsd	.LC5(%rip), %xmm0, %xmm0
+ 697      00000000 
+ 698 0a0a C5F359CB 		vmulsd	%xmm3, %xmm1, %xmm1
+ 699 0a0e C5E359DA 		vmulsd	%xmm2, %xmm3, %xmm3
+ 700 0a12 C5E957D5 		vxorpd	%xmm5, %xmm2, %xmm2
+ 701 0a16 C5EB59D4 		vmulsd	%xmm4, %xmm2, %xmm2
+ 702 0a1a C5E3591D 		vmulsd	.LC5(%rip), %xmm3, %xmm3
+ 702      00000000 
+ 703 0a22 C5F35ECE 		vdivsd	%xmm6, %xmm1, %xmm1
+ 704 0a26 C5EB5ED6 		vdivsd	%xmm6, %xmm2, %xmm2
+ 705 0a2a C5F114C0 		vunpcklpd	%xmm0, %xmm1, %xmm0
+ 706 0a2e C5E114D2 		vunpcklpd	%xmm2, %xmm3, %xmm2
+ 707 0a32 C4E37D18 		vinsertf128	$0x1, %xmm2, %ymm0, %ymm0
+ 707      C201
+ 708 0a38 C5FD5AC0 		vcvtpd2psy	%ymm0, %xmm0
+ 709 0a3c C5F81143 		vmovups	%xmm0, 24(%rbx)
+ 709      18
+ 710 0a41 C5F877   		vzeroupper
+ 711 0a44 E9E2F9FF 		jmp	.L55
+ 711      FF
+ 712 0a49 0F1F8000 		.p2align 4,,10
+ 712      000000
+ 713              		.p2align 3
+ 714              	.L90:
+ 715 0a50 4883BBE0 		cmpq	$0, 224(%rbx)
+ 715      00000000 
+ 716 0a58 0F848AFE 		je	.L65
+ 716      FFFF
+ 717 0a5e 4883BBE8 		cmpq	$0, 232(%rbx)
+ 717      00000000 
+ 718 0a66 0F847CFE 		je	.L65
+ 718      FFFF
+ 719 0a6c 4883BBF0 		cmpq	$0, 240(%rbx)
+ 719      00000000 
+ 720 0a74 0F846EFE 		je	.L65
+ 720      FFFF
+ 721 0a7a 4883BB00 		cmpq	$0, 256(%rbx)
+ 721      01000000 
+ 722 0a82 0F8460FE 		je	.L65
+ 722      FFFF
+ 723 0a88 4883BB08 		cmpq	$0, 264(%rbx)
+ 723      01000000 
+ 724 0a90 0F8452FE 		je	.L65
+ 724      FFFF
+ 725 0a96 4885C0   		testq	%rax, %rax
+ 726 0a99 0F855CFE 		jne	.L66
+ 726      FFFF
+ 727 0a9f E944FEFF 		jmp	.L65
+ 727      FF
+ 728              		.p2align 4,,10
+ 729 0aa4 0F1F4000 		.p2align 3
+ 730              	.L73:
+ 731 0aa8 488D3D00 		leaq	.LC13(%rip), %rdi
+ 731      000000
+ 732 0aaf E8000000 		call	endprogram@PLT
+ 732      00
+ 733 0ab4 E926FAFF 		jmp	.L58
+ 733      FF
+ 734              	.L89:
+ 735 0ab9 488D3D00 		leaq	.LC14(%rip), %rdi
+ 735      000000
+ 736 0ac0 E8000000 		call	endprogram@PLT
+ 736      00
+ 737 0ac5 E979FAFF 		jmp	.L60
+ 737      FF
+ 738              		.cfi_endproc
+ 739              	.LFE6417:
+ 741              		.section	.rodata.str1.8
+ 742              		.align 8
+ 743              	.LC25:
+ 744 00a8 25733A20 		.string	"%s: The limiter does not support code generation\n"
+ 744      54686520 
+ 744      6C696D69 
+ 744      74657220 
+ 744      646F6573 
+ 745 00da 00000000 		.align 8
+ 745      0000
+ 746              	.LC26:
+ 747 00e0 73746174 		.string	"static float s%d_delay[NCHANNELS][%d];\n"
+ 747      69632066 
+ 747      6C6F6174 
+ 747      20732564 
+ 747      5F64656C 
+ 748              		.section	.rodata.str1.1
+ 749              	.LC27:
+ 750 001e 73746174 		.string	"static int s%d_offset;\n"
+ 750      69632069 
+ 750      6E742073 
+ 750      25645F6F 
+ 750      66667365 
+ 751              		.section	.rodata.str1.8
+ 752              		.align 8
+ 753              	.LC28:
+ 754 0108 20202020 		.string	"        int s%d_k = s%d_offset;\n"
+ 754      20202020 
+ 754      696E7420 
+ 754      7325645F 
+ 754      6B203D20 
+ 755 0129 00000000 		.align 8
+ 755      000000
+ 756              	.LC29:
+ 757 0130 20202020 		.string	"            s%d_delay[c][s%d_k] = x;\n"
+ 757      20202020 
+ 757      20202020 
+ 757      7325645F 
+ 757      64656C61 
+ 758              		.section	.rodata.str1.1
+ 759              	.LC30:
+ 760 0036 20202020 		.string	"            x = 0.0f"
+ 760      20202020 
+ 760      20202020 
+ 760      78203D20 
+ 760      302E3066 
+ 761              		.section	.rodata.str1.8
+ 762 0156 0000     		.align 8
+ 763              	.LC31:
+ 764 0158 202B2025 		.string	" + %af * s%d_delay[c][(s%d_k + %d) %% %d]"
+ 764      6166202A 
+ 764      20732564 
+ 764      5F64656C 
+ 764      61795B63 
+ 765              		.section	.rodata.str1.1
+ 766              	.LC32:
+ 767 004b 3B0A00   		.string	";\n"
+ 768              		.section	.rodata.str1.8
+ 769 0182 00000000 		.align 8
+ 769      0000
+ 770              	.LC33:
+ 771 0188 20202020 		.string	"            if (++s%d_k == %d) s%d_k = 0;\n"
+ 771      20202020 
+ 771      20202020 
+ 771      69662028 
+ 771      2B2B7325 
+ 772 01b3 00000000 		.align 8
+ 772      00
+ 773              	.LC34:
+ 774 01b8 20202020 		.string	"            x = fmaxf(fminf(%af * x, %af), -%af);\n"
+ 774      20202020 
+ 774      20202020 
+ 774      78203D20 
+ 774      666D6178 
+ 775 01eb 00000000 		.align 8
+ 775      00
+ 776              	.LC35:
+ 777 01f0 20202020 		.string	"        if (c == NCHANNELS - 1) s%d_offset = s%d_k;\n"
+ 777      20202020 
+ 777      69662028 
+ 777      63203D3D 
+ 777      204E4348 
+ 778 0225 000000   		.align 8
+ 779              	.LC36:
+ 780 0228 20202020 		.string	"    memset(s%d_delay, 0, sizeof(s%d_delay));\n"
+ 780      6D656D73 
+ 780      65742873 
+ 780      25645F64 
+ 780      656C6179 
+ 781              		.section	.rodata.str1.1
+ 782              	.LC37:
+ 783 004e 20202020 		.string	"    s%d_offset = 0;\n"
+ 783      7325645F 
+ 783      6F666673 
+ 783      6574203D 
+ 783      20303B0A 
+ 784              		.text
+ 785 0aca 660F1F44 		.p2align 4
+ 785      0000
+ 786              		.globl	gain_codegen
+ 788              	gain_codegen:
+ 789              	.LFB6418:
+ 790              		.cfi_startproc
+ 791 0ad0 4157     		pushq	%r15
+ 792              		.cfi_def_cfa_offset 16
+ 793              		.cfi_offset 15, -16
+ 794 0ad2 89D0     		movl	%edx, %eax
+ 795 0ad4 4156     		pushq	%r14
+ 796              		.cfi_def_cfa_offset 24
+ 797              		.cfi_offset 14, -24
+ 798 0ad6 4155     		pushq	%r13
+ 799              		.cfi_def_cfa_offset 32
+ 800              		.cfi_offset 13, -32
+ 801 0ad8 4154     		pushq	%r12
+ 802              		.cfi_def_cfa_offset 40
+ 803              		.cfi_offset 12, -40
+ 804 0ada 4189CC   		movl	%ecx, %r12d
+ 805 0add 55       		pushq	%rbp
+ 806              		.cfi_def_cfa_offset 48
+ 807              		.cfi_offset 6, -48
+ 808 0ade 53       		pushq	%rbx
+ 809              		.cfi_def_cfa_offset 56
+ 810              		.cfi_offset 3, -56
+ 811 0adf 4883EC08 		subq	$8, %rsp
+ 812              		.cfi_def_cfa_offset 64
+ 813 0ae3 488B9FC0 		movq	192(%rdi), %rbx
+ 813      000000
+ 814 0aea 48837B78 		cmpq	$0, 120(%rbx)
+ 814      00
+ 815 0aef 8B4B10   		movl	16(%rbx), %ecx
+ 816 0af2 8B5314   		movl	20(%rbx), %edx
+ 817 0af5 7529     		jne	.L108
+ 818 0af7 448D2C11 		leal	(%rcx,%rdx), %r13d
+ 819 0afb 83F804   		cmpl	$4, %eax
+ 820 0afe 7756     		ja	.L94
+ 821 0b00 488D1500 		leaq	.L96(%rip), %rdx
+ 821      000000
+ 822 0b07 4889F5   		movq	%rsi, %rbp
+ 823 0b0a 48630482 		movslq	(%rdx,%rax,4), %rax
+ 824 0b0e 4801D0   		addq	%rdx, %rax
+ 825 0b11 4183FD01 		cmpl	$1, %r13d
+ 826 0b15 FFE0     		jmp	*%rax
+ 827              		.section	.rodata
+ 828              		.align 4
+ 829              		.align 4
+ 830              	.L96:
+ 831 0000 00000000 		.long	.L100-.L96
+ 832 0004 00000000 		.long	.L99-.L96
+ 833 0008 00000000 		.long	.L98-.L96
+ 834 000c 00000000 		.long	.L97-.L96
+ 835 0010 00000000 		.long	.L95-.L96
+ 836              		.text
+ 837 0b17 660F1F84 		.p2align 4,,10
+ 837      00000000 
+ 837      00
+ 838              		.p2align 3
+ 839              	.L108:
+ 840 0b20 31C0     		xorl	%eax, %eax
+ 841 0b22 488D1500 		leaq	__func__.2(%rip), %rdx
+ 841      000000
+ 842 0b29 488D3500 		leaq	.LC25(%rip), %rsi
+ 842      000000
+ 843 0b30 31FF     		xorl	%edi, %edi
+ 844 0b32 E8000000 		call	debugprint@PLT
+ 844      00
+ 845 0b37 4883C408 		addq	$8, %rsp
+ 846              		.cfi_remember_state
+ 847              		.cfi_def_cfa_offset 56
+ 848 0b3b B8010000 		movl	$1, %eax
+ 848      00
+ 849 0b40 5B       		popq	%rbx
+ 850              		.cfi_def_cfa_offset 48
+ 851 0b41 5D       		popq	%rbp
+ 852              		.cfi_def_cfa_offset 40
+ 853 0b42 415C     		popq	%r12
+ 854              		.cfi_def_cfa_offset 32
+ 855 0b44 415D     		popq	%r13
+ 856              		.cfi_def_cfa_offset 24
+ 857 0b46 415E     		popq	%r14
+ 858              		.cfi_def_cfa_offset 16
+ 859 0b48 415F     		popq	%r15
+ 860              		.cfi_def_cfa_offset 8
+ 861 0b4a C3       		ret
+ 862 0b4b 0F1F4400 		.p2align 4,,10
+ 862      00
+ 863              		.p2align 3
+ 864              	.L97:
+ 865              		.cfi_restore_state
+ 866 0b50 0F8FEA00 		jg	.L109
+ 866      0000
+ 867              	.L94:
+ 868 0b56 31C0     		xorl	%eax, %eax
+ 869              	.L110:
+ 870 0b58 4883C408 		addq	$8, %rsp
+ 871              		.cfi_remember_state
+ 872              		.cfi_def_cfa_offset 56
+ 873 0b5c 5B       		popq	%rbx
+ 874              		.cfi_def_cfa_offset 48
+ 875 0b5d 5D       		popq	%rbp
+ 876              		.cfi_def_cfa_offset 40
+ 877 0b5e 415C     		popq	%r12
+ 878              		.cfi_def_cfa_offset 32
+ 879 0b60 415D     		popq	%r13
+ 880              		.cfi_def_cfa_offset 24
+ 881 0b62 415E     		popq	%r14
+ 882              		.cfi_def_cfa_offset 16
+ 883 0b64 415F     		popq	%r15
+ 884              		.cfi_def_cfa_offset 8
+ 885 0b66 C3       		ret
+ 886 0b67 660F1F84 		.p2align 4,,10
+ 886      00000000 
+ 886      00
+ 887              		.p2align 3
+ 888              	.L95:
+ 889              		.cfi_restore_state
+ 890 0b70 7EE4     		jle	.L94
+ 891 0b72 4489E1   		movl	%r12d, %ecx
+ 892 0b75 4489E2   		movl	%r12d, %edx
+ 893 0b78 488D3500 		leaq	.LC36(%rip), %rsi
+ 893      000000
+ 894 0b7f 4889EF   		movq	%rbp, %rdi
+ 895 0b82 31C0     		xorl	%eax, %eax
+ 896 0b84 E8000000 		call	fprintf@PLT
+ 896      00
+ 897 0b89 4489E2   		movl	%r12d, %edx
+ 898 0b8c 4889EF   		movq	%rbp, %rdi
+ 899 0b8f 31C0     		xorl	%eax, %eax
+ 900 0b91 488D3500 		leaq	.LC37(%rip), %rsi
+ 900      000000
+ 901 0b98 E8000000 		call	fprintf@PLT
+ 901      00
+ 902 0b9d 31C0     		xorl	%eax, %eax
+ 903 0b9f EBB7     		jmp	.L110
+ 904              		.p2align 4,,10
+ 905 0ba1 0F1F8000 		.p2align 3
+ 905      000000
+ 906              	.L100:
+ 907 0ba8 7EAC     		jle	.L94
+ 908 0baa 4489E9   		movl	%r13d, %ecx
+ 909 0bad 4489E2   		movl	%r12d, %edx
+ 910 0bb0 488D3500 		leaq	.LC26(%rip), %rsi
+ 910      000000
+ 911 0bb7 4889EF   		movq	%rbp, %rdi
+ 912 0bba 31C0     		xorl	%eax, %eax
+ 913 0bbc E8000000 		call	fprintf@PLT
+ 913      00
+ 914 0bc1 4489E2   		movl	%r12d, %edx
+ 915 0bc4 4889EF   		movq	%rbp, %rdi
+ 916 0bc7 31C0     		xorl	%eax, %eax
+ 917 0bc9 488D3500 		leaq	.LC27(%rip), %rsi
+ 917      000000
+ 918 0bd0 E8000000 		call	fprintf@PLT
+ 918      00
+ 919 0bd5 31C0     		xorl	%eax, %eax
+ 920 0bd7 E97CFFFF 		jmp	.L110
+ 920      FF
+ 921 0bdc 0F1F4000 		.p2align 4,,10
+ 922              		.p2align 3
+ 923              	.L99:
+ 924 0be0 0F8E70FF 		jle	.L94
+ 924      FFFF
+ 925 0be6 4489E1   		movl	%r12d, %ecx
+ 926 0be9 4489E2   		movl	%r12d, %edx
+ 927 0bec 488D3500 		leaq	.LC28(%rip), %rsi
+ 927      000000
+ 928 0bf3 4889EF   		movq	%rbp, %rdi
+ 929 0bf6 31C0     		xorl	%eax, %eax
+ 930 0bf8 E8000000 		call	fprintf@PLT
+ 930      00
+ 931 0bfd 31C0     		xorl	%eax, %eax
+ 932 0bff E954FFFF 		jmp	.L110
+ 932      FF
+ 933              		.p2align 4,,10
+ 934 0c04 0F1F4000 		.p2align 3
+ 935              	.L98:
+ 936 0c08 7F56     		jg	.L111
+ 937              	.L101:
+ 938 0c0a C5E157DB 		vxorpd	%xmm3, %xmm3, %xmm3
+ 939 0c0e 488D3500 		leaq	.LC34(%rip), %rsi
+ 939      000000
+ 940 0c15 4889EF   		movq	%rbp, %rdi
+ 941 0c18 B8030000 		movl	$3, %eax
+ 941      00
+ 942 0c1d C5E25A4B 		vcvtss2sd	64(%rbx), %xmm3, %xmm1
+ 942      40
+ 943 0c22 C5F310D1 		vmovsd	%xmm1, %xmm1, %xmm2
+ 944 0c26 C5E25A03 		vcvtss2sd	(%rbx), %xmm3, %xmm0
+ 945 0c2a E8000000 		call	fprintf@PLT
+ 945      00
+ 946 0c2f 31C0     		xorl	%eax, %eax
+ 947 0c31 E922FFFF 		jmp	.L110
+ 947      FF
+ 948 0c36 662E0F1F 		.p2align 4,,10
+ 948      84000000 
+ 948      0000
+ 949              		.p2align 3
+ 950              	.L109:
+ 951 0c40 4489E1   		movl	%r12d, %ecx
+ 952 0c43 4489E2   		movl	%r12d, %edx
+ 953 0c46 488D3500 		leaq	.LC35(%rip), %rsi
+ 953      000000
+ 954 0c4d 4889EF   		movq	%rbp, %rdi
+ 955 0c50 31C0     		xorl	%eax, %eax
+ 956 0c52 E8000000 		call	fprintf@PLT
+ 956      00
+ 957 0c57 31C0     		xorl	%eax, %eax
+ 958 0c59 E9FAFEFF 		jmp	.L110
+ 958      FF
+ 959 0c5e 6690     		.p2align 4,,10
+ 960              		.p2align 3
+ 961              	.L111:
+ 962 0c60 4489E1   		movl	%r12d, %ecx
+ 963 0c63 4489E2   		movl	%r12d, %edx
+ 964 0c66 488D3500 		leaq	.LC29(%rip), %rsi
+ 964      000000
+ 965 0c6d 4889EF   		movq	%rbp, %rdi
+ 966 0c70 31C0     		xorl	%eax, %eax
+ 967 0c72 E8000000 		call	fprintf@PLT
+ 967      00
+ 968 0c77 4889E9   		movq	%rbp, %rcx
+ 969 0c7a BA140000 		movl	$20, %edx
+ 969      00
+ 970 0c7f BE010000 		movl	$1, %esi
+ 970      00
+ 971 0c84 488D3D00 		leaq	.LC30(%rip), %rdi
+ 971      000000
+ 972 0c8b E8000000 		call	fwrite@PLT
+ 972      00
+ 973 0c90 8B4314   		movl	20(%rbx), %eax
+ 974 0c93 85C0     		testl	%eax, %eax
+ 975 0c95 7E55     		jle	.L102
+ 976 0c97 4531F6   		xorl	%r14d, %r14d
+ 977 0c9a 4C8D3D00 		leaq	.LC31(%rip), %r15
+ 977      000000
+ 978              	.L104:
+ 979 0ca1 488B3D00 		movq	.LC1(%rip), %rdi
+ 979      000000
+ 980 0ca8 4589E8   		movl	%r13d, %r8d
+ 981 0cab 442B4310 		subl	16(%rbx), %r8d
+ 982 0caf 4529F0   		subl	%r14d, %r8d
+ 983 0cb2 C4E1F96E 		vmovq	%rdi, %xmm0
+ 983      C7
+ 984 0cb7 83F801   		cmpl	$1, %eax
+ 985 0cba 740B     		je	.L103
+ 986 0cbc C5D957E4 		vxorpd	%xmm4, %xmm4, %xmm4
+ 987 0cc0 C4A15A5A 		vcvtss2sd	24(%rbx,%r14,4), %xmm4, %xmm0
+ 987      44B318
+ 988              	.L103:
+ 989 0cc7 4589E9   		movl	%r13d, %r9d
+ 990 0cca 4489E1   		movl	%r12d, %ecx
+ 991 0ccd 4489E2   		movl	%r12d, %edx
+ 992 0cd0 4C89FE   		movq	%r15, %rsi
+ 993 0cd3 4889EF   		movq	%rbp, %rdi
+ 994 0cd6 B8010000 		movl	$1, %eax
+ 994      00
+ 995 0cdb 4983C601 		addq	$1, %r14
+ 996 0cdf E8000000 		call	fprintf@PLT
+ 996      00
+ 997 0ce4 8B4314   		movl	20(%rbx), %eax
+ 998 0ce7 4439F0   		cmpl	%r14d, %eax
+ 999 0cea 7FB5     		jg	.L104
+ 1000              	.L102:
+ 1001 0cec 4889E9   		movq	%rbp, %rcx
+ 1002 0cef BA020000 		movl	$2, %edx
+ 1002      00
+ 1003 0cf4 BE010000 		movl	$1, %esi
+ 1003      00
+ 1004 0cf9 488D3D00 		leaq	.LC32(%rip), %rdi
+ 1004      000000
+ 1005 0d00 E8000000 		call	fwrite@PLT
+ 1005      00
+ 1006 0d05 4589E0   		movl	%r12d, %r8d
+ 1007 0d08 4489E9   		movl	%r13d, %ecx
+ 1008 0d0b 4489E2   		movl	%r12d, %edx
+ 1009 0d0e 488D3500 		leaq	.LC33(%rip), %rsi
+ 1009      000000
+ 1010 0d15 4889EF   		movq	%rbp, %rdi
+ 1011 0d18 31C0     		xorl	%eax, %eax
+ 1012 0d1a E8000000 		call	fprintf@PLT
+ 1012      00
+ 1013 0d1f E9E6FEFF 		jmp	.L101
+ 1013      FF
+ 1014              		.cfi_endproc
+ 1015              	.LFE6418:
+ 1017 0d24 66662E0F 		.p2align 4
+ 1017      1F840000 
+ 1017      00000090 
+ 1018              		.globl	destroy_gain
+ 1020              	destroy_gain:
+ 1021              	.LFB6419:
+ 1022              		.cfi_startproc
+ 1023 0d30 55       		pushq	%rbp
+ 1024              		.cfi_def_cfa_offset 16
+ 1025              		.cfi_offset 6, -16
+ 1026 0d31 4889FD   		movq	%rdi, %rbp
+ 1027 0d34 53       		pushq	%rbx
+ 1028              		.cfi_def_cfa_offset 24
+ 1029              		.cfi_offset 3, -24
+ 1030 0d35 4883EC08 		subq	$8, %rsp
+ 1031              		.cfi_def_cfa_offset 32
+ 1032 0d39 488B9FC0 		movq	192(%rdi), %rbx
+ 1032      000000
+ 1033 0d40 488B7B28 		movq	40(%rbx), %rdi
+ 1034 0d44 E8000000 		call	free@PLT
+ 1034      00
+ 1035 0d49 488B7B30 		movq	48(%rbx), %rdi
+ 1036 0d4d E8000000 		call	free@PLT
+ 1036      00
+ 1037 0d52 488B7B70 		movq	112(%rbx), %rdi
+ 1038 0d56 E8000000 		call	free@PLT
+ 1038      00
+ 1039 0d5b 488B5B78 		movq	120(%rbx), %rbx
+ 1040 0d5f 4885DB   		testq	%rbx, %rbx
+ 1041 0d62 745C     		je	.L113
+ 1042 0d64 488BBBD8 		movq	216(%rbx), %rdi
+ 1042      000000
+ 1043 0d6b E8000000 		call	free@PLT
+ 1043      00
+ 1044 0d70 488BBBE0 		movq	224(%rbx), %rdi
+ 1044      000000
+ 1045 0d77 E8000000 		call	free@PLT
+ 1045      00
+ 1046 0d7c 488BBBE8 		movq	232(%rbx), %rdi
+ 1046      000000
+ 1047 0d83 E8000000 		call	free@PLT
+ 1047      00
+ 1048 0d88 488BBBF0 		movq	240(%rbx), %rdi
+ 1048      000000
+ 1049 0d8f E8000000 		call	free@PLT
+ 1049      00
+ 1050 0d94 488BBB00 		movq	256(%rbx), %rdi
+ 1050      010000
+ 1051 0d9b E8000000 		call	free@PLT
+ 1051      00
+ 1052 0da0 488BBB08 		movq	264(%rbx), %rdi
+ 1052      010000
+ 1053 0da7 E8000000 		call	free@PLT
+ 1053      00
+ 1054 0dac 488BBB28 		movq	296(%rbx), %rdi
+ 1054      010000
+ 1055 0db3 E8000000 		call	free@PLT
+ 1055      00
+ 1056 0db8 4889DF   		movq	%rbx, %rdi
+ 1057 0dbb E8000000 		call	free@PLT
+ 1057      00
+ 1058              	.L113:
+ 1059 0dc0 488BBDC0 		movq	192(%rbp), %rdi
+ 1059      000000
+ 1060 0dc7 4883C408 		addq	$8, %rsp
+ 1061              		.cfi_def_cfa_offset 24
+ 1062 0dcb 5B       		popq	%rbx
+ 1063              		.cfi_def_cfa_offset 16
+ 1064 0dcc 5D       		popq	%rbp
+ 1065              		.cfi_def_cfa_offset 8
+ 1066 0dcd E9000000 		jmp	free@PLT
+ 1066      00
+ 1067              		.cfi_endproc
+ 1068              	.LFE6419:
+ 1070 0dd2 66662E0F 		.p2align 4
+ 1070      1F840000 
+ 1070      0000000F 
+ 1070      1F00
+ 1071              		.globl	gain_preroll
+ 1073              	gain_preroll:
+ 1074              	.LFB6420:
+ 1075              		.cfi_startproc
+ 1076 0de0 4154     		pushq	%r12
+ 1077              		.cfi_def_cfa_offset 16
+ 1078              		.cfi_offset 12, -16
+ 1079 0de2 55       		pushq	%rbp
+ 1080              		.cfi_def_cfa_offset 24
+ 1081              		.cfi_offset 6, -24
+ 1082 0de3 53       		pushq	%rbx
+ 1083              		.cfi_def_cfa_offset 32
+ 1084              		.cfi_offset 3, -32
+ 1085 0de4 4883EC10 		subq	$16, %rsp
+ 1086              		.cfi_def_cfa_offset 48
+ 1087 0de8 488B97C0 		movq	192(%rdi), %rdx
+ 1087      000000
+ 1088 0def 4C8B6278 		movq	120(%rdx), %r12
+ 1089 0df3 8B4214   		movl	20(%rdx), %eax
+ 1090 0df6 034210   		addl	16(%rdx), %eax
+ 1091 0df9 89C3     		movl	%eax, %ebx
+ 1092 0dfb 8D40FF   		leal	-1(%rax), %eax
+ 1093 0dfe 4D85E4   		testq	%r12, %r12
+ 1094 0e01 7463     		je	.L118
+ 1095 0e03 4889FD   		movq	%rdi, %rbp
+ 1096 0e06 E8000000 		call	log@PLT
+ 1096      00
+ 1097 0e0b C5E957D2 		vxorpd	%xmm2, %xmm2, %xmm2
+ 1098 0e0f C5FB1144 		vmovsd	%xmm0, 8(%rsp)
+ 1098      2408
+ 1099 0e15 C4C16A5A 		vcvtss2sd	20(%r12), %xmm2, %xmm0
+ 1099      442414
+ 1100 0e1c E8000000 		call	log@PLT
+ 1100      00
+ 1101 0e21 418B5424 		movl	16(%r12), %edx
+ 1101      10
+ 1102 0e26 C5FB104C 		vmovsd	8(%rsp), %xmm1
+ 1102      2408
+ 1103 0e2c C5E957D2 		vxorpd	%xmm2, %xmm2, %xmm2
+ 1104 0e30 418B8424 		movl	272(%r12), %eax
+ 1104      10010000 
+ 1105 0e38 C5F35EC0 		vdivsd	%xmm0, %xmm1, %xmm0
+ 1106 0e3c 8D445010 		leal	16(%rax,%rdx,2), %eax
+ 1107 0e40 8D540307 		leal	7(%rbx,%rax), %edx
+ 1108 0e44 8B859800 		movl	152(%rbp), %eax
+ 1108      0000
+ 1109 0e4a 62F16F08 		vcvtusi2sdl	%eax, %xmm2, %xmm1
+ 1109      7BC8
+ 1110 0e50 C5F3590D 		vmulsd	.LC38(%rip), %xmm1, %xmm1
+ 1110      00000000 
+ 1111 0e58 C5F92FC8 		vcomisd	%xmm0, %xmm1
+ 1112 0e5c 7612     		jbe	.L125
+ 1113 0e5e 62F17F08 		vcvttsd2usi	%xmm0, %eax
+ 1113      78C0
+ 1114 0e64 01D0     		addl	%edx, %eax
+ 1115              	.L118:
+ 1116 0e66 4883C410 		addq	$16, %rsp
+ 1117              		.cfi_remember_state
+ 1118              		.cfi_def_cfa_offset 32
+ 1119 0e6a 5B       		popq	%rbx
+ 1120              		.cfi_def_cfa_offset 24
+ 1121 0e6b 5D       		popq	%rbp
+ 1122              		.cfi_def_cfa_offset 16
+ 1123 0e6c 415C     		popq	%r12
+ 1124              		.cfi_def_cfa_offset 8
+ 1125 0e6e C3       		ret
+ 1126 0e6f 90       		.p2align 4,,10
+ 1127              		.p2align 3
+ 1128              	.L125:
+ 1129              		.cfi_restore_state
+ 1130 0e70 6BC03C   		imull	$60, %eax, %eax
+ 1131 0e73 01D0     		addl	%edx, %eax
+ 1132 0e75 EBEF     		jmp	.L118
+ 1133              		.cfi_endproc
+ 1134              	.LFE6420:
+ 1136 0e77 660F1F84 		.p2align 4
+ 1136      00000000 
+ 1136      00
+ 1137              		.globl	clone_gain
+ 1139              	clone_gain:
+ 1140              	.LFB6421:
+ 1141              		.cfi_startproc
+ 1142 0e80 55       		pushq	%rbp
+ 1143              		.cfi_def_cfa_offset 16
+ 1144              		.cfi_offset 6, -16
+ 1145 0e81 4889E5   		movq	%rsp, %rbp
+ 1146              		.cfi_def_cfa_register 6
+ 1147 0e84 4155     		pushq	%r13
+ 1148              		.cfi_offset 13, -24
+ 1149 0e86 4989F5   		movq	%rsi, %r13
+ 1150 0e89 4154     		pushq	%r12
+ 1151              		.cfi_offset 12, -32
+ 1152 0e8b 4989FC   		movq	%rdi, %r12
+ 1153 0e8e BFA00000 		movl	$160, %edi
+ 1153      00
+ 1154 0e93 53       		pushq	%rbx
+ 1155 0e94 4883EC08 		subq	$8, %rsp
+ 1156              		.cfi_offset 3, -40
+ 1157 0e98 E8000000 		call	malloc@PLT
+ 1157      00
+ 1158 0e9d 4885C0   		testq	%rax, %rax
+ 1159 0ea0 0F848F00 		je	.L131
+ 1159      0000
+ 1160 0ea6 4889C3   		movq	%rax, %rbx
+ 1161 0ea9 498B85C0 		movq	192(%r13), %rax
+ 1161      000000
+ 1162 0eb0 C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 1163 0eb4 62F1FE48 		vmovdqu64	(%rax), %zmm1
+ 1163      6F08
+ 1164 0eba 62F1FE48 		vmovdqu64	%zmm1, (%rbx)
+ 1164      7F0B
+ 1165 0ec0 62F1FE48 		vmovdqu64	64(%rax), %zmm2
+ 1165      6F5001
+ 1166 0ec7 62F1FE48 		vmovdqu64	%zmm2, 64(%rbx)
+ 1166      7F5301
+ 1167 0ece C5FE6F98 		vmovdqu	128(%rax), %ymm3
+ 1167      80000000 
+ 1168 0ed6 4C8B6B78 		movq	120(%rbx), %r13
+ 1169 0eda 48C74370 		movq	$0, 112(%rbx)
+ 1169      00000000 
+ 1170 0ee2 C5FE7F9B 		vmovdqu	%ymm3, 128(%rbx)
+ 1170      80000000 
+ 1171 0eea C5FA7F43 		vmovdqu	%xmm0, 40(%rbx)
+ 1171      28
+ 1172 0eef 4D85ED   		testq	%r13, %r13
+ 1173 0ef2 743C     		je	.L138
+ 1174 0ef4 BE400100 		movl	$320, %esi
+ 1174      00
+ 1175 0ef9 BF010000 		movl	$1, %edi
+ 1175      00
+ 1176 0efe C5F877   		vzeroupper
+ 1177 0f01 E8000000 		call	calloc@PLT
+ 1177      00
+ 1178 0f06 4885C0   		testq	%rax, %rax
+ 1179 0f09 742A     		je	.L131
+ 1180 0f0b C4C17910 		vmovupd	0(%r13), %xmm4
+ 1180      6500
+ 1181 0f11 48894378 		movq	%rax, 120(%rbx)
+ 1182 0f15 C5F91120 		vmovupd	%xmm4, (%rax)
+ 1183              	.L130:
+ 1184 0f19 49899C24 		movq	%rbx, 192(%r12)
+ 1184      C0000000 
+ 1185 0f21 31C0     		xorl	%eax, %eax
+ 1186              	.L127:
+ 1187 0f23 4883C408 		addq	$8, %rsp
+ 1188 0f27 5B       		popq	%rbx
+ 1189 0f28 415C     		popq	%r12
+ 1190 0f2a 415D     		popq	%r13
+ 1191 0f2c 5D       		popq	%rbp
+ 1192              		.cfi_remember_state
+ 1193              		.cfi_def_cfa 7, 8
+ 1194 0f2d C3       		ret
+ 1195 0f2e 6690     		.p2align 4,,10
+ 1196              		.p2align 3
+ 1197              	.L138:
+ 1198              		.cfi_restore_state
+ 1199 0f30 C5F877   		vzeroupper
+ 1200 0f33 EBE4     		jmp	.L130
+ 1201              	.L131:
+ 1202 0f35 B8010000 		movl	$1, %eax
+ 1202      00
+ 1203 0f3a EBE7     		jmp	.L127
+ 1204              		.cfi_endproc
+ 1205              	.LFE6421:
+ 1207              		.section	.rodata.str1.1
+ 1208              	.LC39:
+ 1209 0063 6700     		.string	"g"
+ 1210              	.LC40:
+ 1211 0065 676C00   		.string	"gl"
+ 1212              	.LC41:
+ 1213 0068 25732073 		.string	"%s subopts: %s\n"
+ 1213      75626F70 
+ 1213      74733A20 
+ 1213      25730A00 
+ 1214              		.section	.rodata.str1.8
+ 1215 0256 0000     		.align 8
+ 1216              	.LC42:
+ 1217 0258 25733A20 		.string	"%s: Missing value for suboption '%s'\n"
+ 1217      4D697373 
+ 1217      696E6720 
+ 1217      76616C75 
+ 1217      6520666F 
+ 1218 027e 0000     		.align 8
+ 1219              	.LC45:
+ 1220 0280 25733A20 		.string	"%s: No match found for token: /%s/\n"
+ 1220      4E6F206D 
+ 1220      61746368 
+ 1220      20666F75 
+ 1220      6E642066 
+ 1221              		.text
+ 1222 0f3c 0F1F4000 		.p2align 4
+ 1223              		.globl	control_gain
+ 1225              	control_gain:
+ 1226              	.LFB6422:
+ 1227              		.cfi_startproc
+ 1228 0f40 4156     		pushq	%r14
+ 1229              		.cfi_def_cfa_offset 16
+ 1230              		.cfi_offset 14, -16
+ 1231 0f42 488D0500 		leaq	.LC40(%rip), %rax
+ 1231      000000
+ 1232 0f49 4889F1   		movq	%rsi, %rcx
+ 1233 0f4c 4155     		pushq	%r13
+ 1234              		.cfi_def_cfa_offset 24
+ 1235              		.cfi_offset 13, -24
+ 1236 0f4e 4C8D2D00 		leaq	__func__.1(%rip), %r13
+ 1236      000000
+ 1237 0f55 4154     		pushq	%r12
+ 1238              		.cfi_def_cfa_offset 32
+ 1239              		.cfi_offset 12, -32
+ 1240 0f57 4C89EA   		movq	%r13, %rdx
+ 1241 0f5a 55       		pushq	%rbp
+ 1242              		.cfi_def_cfa_offset 40
+ 1243              		.cfi_offset 6, -40
+ 1244 0f5b 53       		pushq	%rbx
+ 1245              		.cfi_def_cfa_offset 48
+ 1246              		.cfi_offset 3, -48
+ 1247 0f5c 488D1D00 		leaq	.LC39(%rip), %rbx
+ 1247      000000
+ 1248 0f63 C4E1F96E 		vmovq	%rbx, %xmm0
+ 1248      C3
+ 1249 0f68 C4E3F922 		vpinsrq	$1, %rax, %xmm0, %xmm0
+ 1249      C001
+ 1250 0f6e 31C0     		xorl	%eax, %eax
+ 1251 0f70 4883EC40 		subq	$64, %rsp
+ 1252              		.cfi_def_cfa_offset 112
+ 1253 0f74 4C8BB7C0 		movq	192(%rdi), %r14
+ 1253      000000
+ 1254 0f7b BF010000 		movl	$1, %edi
+ 1254      00
+ 1255 0f80 48897424 		movq	%rsi, 8(%rsp)
+ 1255      08
+ 1256 0f85 488D3500 		leaq	.LC41(%rip), %rsi
+ 1256      000000
+ 1257 0f8c 48C74424 		movq	$0, 48(%rsp)
+ 1257      30000000 
+ 1257      00
+ 1258 0f95 C5F97F44 		vmovdqa	%xmm0, 32(%rsp)
+ 1258      2420
+ 1259 0f9b E8000000 		call	debugprint@PLT
+ 1259      00
+ 1260 0fa0 488B4424 		movq	8(%rsp), %rax
+ 1260      08
+ 1261 0fa5 803800   		cmpb	$0, (%rax)
+ 1262 0fa8 747D     		je	.L141
+ 1263 0faa 4C8D6424 		leaq	24(%rsp), %r12
+ 1263      18
+ 1264 0faf 488D6C24 		leaq	32(%rsp), %rbp
+ 1264      20
+ 1265 0fb4 488D5C24 		leaq	8(%rsp), %rbx
+ 1265      08
+ 1266              	.L150:
+ 1267 0fb9 4C89E2   		movq	%r12, %rdx
+ 1268 0fbc 4889EE   		movq	%rbp, %rsi
+ 1269 0fbf 4889DF   		movq	%rbx, %rdi
+ 1270 0fc2 E8000000 		call	getsubopt@PLT
+ 1270      00
+ 1271 0fc7 85C0     		testl	%eax, %eax
+ 1272 0fc9 7465     		je	.L142
+ 1273 0fcb 83F801   		cmpl	$1, %eax
+ 1274 0fce 7430     		je	.L143
+ 1275 0fd0 488B4C24 		movq	24(%rsp), %rcx
+ 1275      18
+ 1276 0fd5 4C89EA   		movq	%r13, %rdx
+ 1277 0fd8 31FF     		xorl	%edi, %edi
+ 1278 0fda 31C0     		xorl	%eax, %eax
+ 1279 0fdc 488D3500 		leaq	.LC45(%rip), %rsi
+ 1279      000000
+ 1280 0fe3 E8000000 		call	debugprint@PLT
+ 1280      00
+ 1281              	.L146:
+ 1282 0fe8 B8010000 		movl	$1, %eax
+ 1282      00
+ 1283              	.L140:
+ 1284 0fed 4883C440 		addq	$64, %rsp
+ 1285              		.cfi_remember_state
+ 1286              		.cfi_def_cfa_offset 48
+ 1287 0ff1 5B       		popq	%rbx
+ 1288              		.cfi_def_cfa_offset 40
+ 1289 0ff2 5D       		popq	%rbp
+ 1290              		.cfi_def_cfa_offset 32
+ 1291 0ff3 415C     		popq	%r12
+ 1292              		.cfi_def_cfa_offset 24
+ 1293 0ff5 415D     		popq	%r13
+ 1294              		.cfi_def_cfa_offset 16
+ 1295 0ff7 415E     		popq	%r14
+ 1296              		.cfi_def_cfa_offset 8
+ 1297 0ff9 C3       		ret
+ 1298 0ffa 660F1F44 		.p2align 4,,10
+ 1298      0000
+ 1299              		.p2align 3
+ 1300              	.L143:
+ 1301              		.cfi_restore_state
+ 1302 1000 488B7C24 		movq	24(%rsp), %rdi
+ 1302      18
+ 1303 1005 4885FF   		testq	%rdi, %rdi
+ 1304 1008 745A     		je	.L154
+ 1305 100a 31F6     		xorl	%esi, %esi
+ 1306 100c E8000000 		call	strtod@PLT
+ 1306      00
+ 1307 1011 C5FB5AC0 		vcvtsd2ss	%xmm0, %xmm0, %xmm0
+ 1308 1015 C5F97EC0 		vmovd	%xmm0, %eax
+ 1309 1019 41894644 		movl	%eax, 68(%r14)
+ 1310              	.L147:
+ 1311 101d 488B4424 		movq	8(%rsp), %rax
+ 1311      08
+ 1312 1022 803800   		cmpb	$0, (%rax)
+ 1313 1025 7592     		jne	.L150
+ 1314              	.L141:
+ 1315 1027 31C0     		xorl	%eax, %eax
+ 1316 1029 EBC2     		jmp	.L140
+ 1317 102b 0F1F4400 		.p2align 4,,10
+ 1317      00
+ 1318              		.p2align 3
+ 1319              	.L142:
+ 1320 1030 488B7C24 		movq	24(%rsp), %rdi
+ 1320      18
+ 1321 1035 4885FF   		testq	%rdi, %rdi
+ 1322 1038 7445     		je	.L155
+ 1323 103a 31F6     		xorl	%esi, %esi
+ 1324 103c E8000000 		call	strtod@PLT
+ 1324      00
+ 1325 1041 C5FB5E0D 		vdivsd	.LC43(%rip), %xmm0, %xmm1
+ 1325      00000000 
+ 1326 1049 C5FA1005 		vmovss	.LC44(%rip), %xmm0
+ 1326      00000000 
+ 1327 1051 C5F35AC9 		vcvtsd2ss	%xmm1, %xmm1, %xmm1
+ 1328 1055 E8000000 		call	powf@PLT
+ 1328      00
+ 1329 105a C5F97EC0 		vmovd	%xmm0, %eax
+ 1330 105e 41894644 		movl	%eax, 68(%r14)
+ 1331 1062 EBB9     		jmp	.L147
+ 1332              	.L154:
+ 1333 1064 488B4C24 		movq	40(%rsp), %rcx
+ 1333      28
+ 1334 1069 4C89EA   		movq	%r13, %rdx
+ 1335 106c 488D3500 		leaq	.LC42(%rip), %rsi
+ 1335      000000
+ 1336 1073 31C0     		xorl	%eax, %eax
+ 1337 1075 E8000000 		call	debugprint@PLT
+ 1337      00
+ 1338 107a E969FFFF 		jmp	.L146
+ 1338      FF
+ 1339              	.L155:
+ 1340 107f 488B4C24 		movq	32(%rsp), %rcx
+ 1340      20
+ 1341 1084 4C89EA   		movq	%r13, %rdx
+ 1342 1087 488D3500 		leaq	.LC42(%rip), %rsi
+ 1342      000000
+ 1343 108e 31C0     		xorl	%eax, %eax
+ 1344 1090 E8000000 		call	debugprint@PLT
+ 1344      00
+ 1345 1095 E94EFFFF 		jmp	.L146
+ 1345      FF
+ 1346              		.cfi_endproc
+ 1347              	.LFE6422:
+ 1349 109a 660F1F44 		.p2align 4
+ 1349      0000
+ 1351              	gain_and_clip_block:
+ 1352              	.LFB6398:
+ 1353              		.cfi_startproc
+ 1354 10a0 4C8D5424 		leaq	8(%rsp), %r10
+ 1354      08
+ 1355              		.cfi_def_cfa 10, 0
+ 1356 10a5 4883E4E0 		andq	$-32, %rsp
+ 1357 10a9 89D1     		movl	%edx, %ecx
+ 1358 10ab 41FF72F8 		pushq	-8(%r10)
+ 1359 10af 55       		pushq	%rbp
+ 1360 10b0 4889E5   		movq	%rsp, %rbp
+ 1361              		.cfi_escape 0x10,0x6,0x2,0x76,0
+ 1362 10b3 4155     		pushq	%r13
+ 1363 10b5 4154     		pushq	%r12
+ 1364 10b7 4152     		pushq	%r10
+ 1365              		.cfi_escape 0xf,0x3,0x76,0x68,0x6
+ 1366              		.cfi_escape 0x10,0xd,0x2,0x76,0x78
+ 1367              		.cfi_escape 0x10,0xc,0x2,0x76,0x70
+ 1368 10b9 53       		pushq	%rbx
+ 1369              		.cfi_escape 0x10,0x3,0x2,0x76,0x60
+ 1370 10ba 4889FB   		movq	%rdi, %rbx
+ 1371 10bd 4883EC30 		subq	$48, %rsp
+ 1372 10c1 C5FA1145 		vmovss	%xmm0, -56(%rbp)
+ 1372      C8
+ 1373 10c6 C5F0572D 		vxorps	.LC2(%rip), %xmm1, %xmm5
+ 1373      00000000 
+ 1374 10ce C5FA114D 		vmovss	%xmm1, -60(%rbp)
+ 1374      C4
+ 1375 10d3 C5FA116D 		vmovss	%xmm5, -52(%rbp)
+ 1375      CC
+ 1376 10d8 83FA07   		cmpl	$7, %edx
+ 1377 10db 0F8EC700 		jle	.L161
+ 1377      0000
+ 1378 10e1 8D42F8   		leal	-8(%rdx), %eax
+ 1379 10e4 C4E27D18 		vbroadcastss	%xmm1, %ymm3
+ 1379      D9
+ 1380 10e9 C4E27D18 		vbroadcastss	%xmm0, %ymm2
+ 1380      D0
+ 1381 10ee C1E803   		shrl	$3, %eax
+ 1382 10f1 C4E27D18 		vbroadcastss	%xmm5, %ymm1
+ 1382      CD
+ 1383 10f6 8D5001   		leal	1(%rax), %edx
+ 1384 10f9 31C0     		xorl	%eax, %eax
+ 1385 10fb 4889D7   		movq	%rdx, %rdi
+ 1386 10fe 48C1E205 		salq	$5, %rdx
+ 1387              		.p2align 4,,10
+ 1388 1102 660F1F44 		.p2align 3
+ 1388      0000
+ 1389              	.L158:
+ 1390 1108 C5EC5904 		vmulps	(%rsi,%rax), %ymm2, %ymm0
+ 1390      06
+ 1391 110d C5FC5DC3 		vminps	%ymm3, %ymm0, %ymm0
+ 1392 1111 C5FC5FC1 		vmaxps	%ymm1, %ymm0, %ymm0
+ 1393 1115 C5FC1104 		vmovups	%ymm0, (%rbx,%rax)
+ 1393      03
+ 1394 111a 4883C020 		addq	$32, %rax
+ 1395 111e 4839D0   		cmpq	%rdx, %rax
+ 1396 1121 75E5     		jne	.L158
+ 1397 1123 8D04FD00 		leal	0(,%rdi,8), %eax
+ 1397      000000
+ 1398              	.L157:
+ 1399 112a 39C1     		cmpl	%eax, %ecx
+ 1400 112c 7E72     		jle	.L164
+ 1401 112e 4863D0   		movslq	%eax, %rdx
+ 1402 1131 29C1     		subl	%eax, %ecx
+ 1403 1133 488D3C95 		leaq	0(,%rdx,4), %rdi
+ 1403      00000000 
+ 1404 113b 4801D1   		addq	%rdx, %rcx
+ 1405 113e 4801FB   		addq	%rdi, %rbx
+ 1406 1141 4C8D243E 		leaq	(%rsi,%rdi), %r12
+ 1407 1145 4C8D2C8E 		leaq	(%rsi,%rcx,4), %r13
+ 1408 1149 C5F877   		vzeroupper
+ 1409 114c 0F1F4000 		.p2align 4,,10
+ 1410              		.p2align 3
+ 1411              	.L160:
+ 1412 1150 C5FA1065 		vmovss	-56(%rbp), %xmm4
+ 1412      C8
+ 1413 1155 C4C15A59 		vmulss	(%r12), %xmm4, %xmm1
+ 1413      0C24
+ 1414 115b 4983C404 		addq	$4, %r12
+ 1415 115f 4883C304 		addq	$4, %rbx
+ 1416 1163 C5FA1045 		vmovss	-60(%rbp), %xmm0
+ 1416      C4
+ 1417 1168 E8000000 		call	fminf@PLT
+ 1417      00
+ 1418 116d C5F828C8 		vmovaps	%xmm0, %xmm1
+ 1419 1171 C5FA1045 		vmovss	-52(%rbp), %xmm0
+ 1419      CC
+ 1420 1176 E8000000 		call	fmaxf@PLT
+ 1420      00
+ 1421 117b C5FA1143 		vmovss	%xmm0, -4(%rbx)
+ 1421      FC
+ 1422 1180 4D39EC   		cmpq	%r13, %r12
+ 1423 1183 75CB     		jne	.L160
+ 1424              	.L165:
+ 1425 1185 4883C430 		addq	$48, %rsp
+ 1426 1189 5B       		popq	%rbx
+ 1427 118a 415A     		popq	%r10
+ 1428              		.cfi_remember_state
+ 1429              		.cfi_def_cfa 10, 0
+ 1430 118c 415C     		popq	%r12
+ 1431 118e 415D     		popq	%r13
+ 1432 1190 5D       		popq	%rbp
+ 1433 1191 498D62F8 		leaq	-8(%r10), %rsp
+ 1434              		.cfi_def_cfa 7, 8
+ 1435 1195 C3       		ret
+ 1436 1196 662E0F1F 		.p2align 4,,10
+ 1436      84000000 
+ 1436      0000
+ 1437              		.p2align 3
+ 1438              	.L164:
+ 1439              		.cfi_restore_state
+ 1440 11a0 C5F877   		vzeroupper
+ 1441 11a3 EBE0     		jmp	.L165
+ 1442              		.p2align 4,,10
+ 1443 11a5 0F1F00   		.p2align 3
+ 1444              	.L161:
+ 1445 11a8 31C0     		xorl	%eax, %eax
+ 1446 11aa E97BFFFF 		jmp	.L157
+ 1446      FF
+ 1447              		.cfi_endproc
+ 1448              	.LFE6398:
+ 1450 11af 90       		.p2align 4
+ 1452              	ramp_and_clip_block:
+ 1453              	.LFB6399:
+ 1454              		.cfi_startproc
+ 1455 11b0 4C8D5424 		leaq	8(%rsp), %r10
+ 1455      08
+ 1456              		.cfi_def_cfa 10, 0
+ 1457 11b5 4883E4E0 		andq	$-32, %rsp
+ 1458 11b9 C5F828E0 		vmovaps	%xmm0, %xmm4
+ 1459 11bd 41FF72F8 		pushq	-8(%r10)
+ 1460 11c1 55       		pushq	%rbp
+ 1461 11c2 4889E5   		movq	%rsp, %rbp
+ 1462              		.cfi_escape 0x10,0x6,0x2,0x76,0
+ 1463 11c5 4157     		pushq	%r15
+ 1464              		.cfi_escape 0x10,0xf,0x2,0x76,0x78
+ 1465 11c7 4989CF   		movq	%rcx, %r15
+ 1466 11ca 4156     		pushq	%r14
+ 1467              		.cfi_escape 0x10,0xe,0x2,0x76,0x70
+ 1468 11cc 4989F6   		movq	%rsi, %r14
+ 1469 11cf 4155     		pushq	%r13
+ 1470              		.cfi_escape 0x10,0xd,0x2,0x76,0x68
+ 1471 11d1 4989FD   		movq	%rdi, %r13
+ 1472 11d4 4154     		pushq	%r12
+ 1473              		.cfi_escape 0x10,0xc,0x2,0x76,0x60
+ 1474 11d6 4189D4   		movl	%edx, %r12d
+ 1475 11d9 4152     		pushq	%r10
+ 1476              		.cfi_escape 0xf,0x3,0x76,0x58,0x6
+ 1477 11db 53       		pushq	%rbx
+ 1478 11dc 4883EC20 		subq	$32, %rsp
+ 1479              		.cfi_escape 0x10,0x3,0x2,0x76,0x50
+ 1480 11e0 C5FA1145 		vmovss	%xmm0, -56(%rbp)
+ 1480      C8
+ 1481 11e5 C5D8572D 		vxorps	.LC2(%rip), %xmm4, %xmm5
+ 1481      00000000 
+ 1482 11ed C5FA116D 		vmovss	%xmm5, -52(%rbp)
+ 1482      CC
+ 1483 11f2 83FA07   		cmpl	$7, %edx
+ 1484 11f5 0F8ECD00 		jle	.L172
+ 1484      0000
+ 1485 11fb 8D42F8   		leal	-8(%rdx), %eax
+ 1486 11fe C4E27D18 		vbroadcastss	%xmm0, %ymm2
+ 1486      D0
+ 1487 1203 C4E27D18 		vbroadcastss	%xmm5, %ymm1
+ 1487      CD
+ 1488 1208 C1E803   		shrl	$3, %eax
+ 1489 120b 8D5001   		leal	1(%rax), %edx
+ 1490 120e 31C0     		xorl	%eax, %eax
+ 1491 1210 4889D1   		movq	%rdx, %rcx
+ 1492 1213 48C1E205 		salq	$5, %rdx
+ 1493 1217 660F1F84 		.p2align 4,,10
+ 1493      00000000 
+ 1493      00
+ 1494              		.p2align 3
+ 1495              	.L169:
+ 1496 1220 C4C17C10 		vmovups	(%r14,%rax), %ymm3
+ 1496      1C06
+ 1497 1226 C4C16459 		vmulps	(%r15,%rax), %ymm3, %ymm0
+ 1497      0407
+ 1498 122c C5FC5DC2 		vminps	%ymm2, %ymm0, %ymm0
+ 1499 1230 C5FC5FC1 		vmaxps	%ymm1, %ymm0, %ymm0
+ 1500 1234 C4C17C11 		vmovups	%ymm0, 0(%r13,%rax)
+ 1500      440500
+ 1501 123b 4883C020 		addq	$32, %rax
+ 1502 123f 4839C2   		cmpq	%rax, %rdx
+ 1503 1242 75DC     		jne	.L169
+ 1504 1244 8D04CD00 		leal	0(,%rcx,8), %eax
+ 1504      000000
+ 1505              	.L168:
+ 1506 124b 4139C4   		cmpl	%eax, %r12d
+ 1507 124e 7E70     		jle	.L175
+ 1508 1250 4863D0   		movslq	%eax, %rdx
+ 1509 1253 4129C4   		subl	%eax, %r12d
+ 1510 1256 4901D4   		addq	%rdx, %r12
+ 1511 1259 488D1C95 		leaq	0(,%rdx,4), %rbx
+ 1511      00000000 
+ 1512 1261 49C1E402 		salq	$2, %r12
+ 1513 1265 C5F877   		vzeroupper
+ 1514 1268 0F1F8400 		.p2align 4,,10
+ 1514      00000000 
+ 1515              		.p2align 3
+ 1516              	.L171:
+ 1517 1270 C4C17A10 		vmovss	(%r15,%rbx), %xmm1
+ 1517      0C1F
+ 1518 1276 C4C17259 		vmulss	(%r14,%rbx), %xmm1, %xmm1
+ 1518      0C1E
+ 1519 127c C5FA1045 		vmovss	-56(%rbp), %xmm0
+ 1519      C8
+ 1520 1281 E8000000 		call	fminf@PLT
+ 1520      00
+ 1521 1286 C5F828C8 		vmovaps	%xmm0, %xmm1
+ 1522 128a C5FA1045 		vmovss	-52(%rbp), %xmm0
+ 1522      CC
+ 1523 128f E8000000 		call	fmaxf@PLT
+ 1523      00
+ 1524 1294 C4C17A11 		vmovss	%xmm0, 0(%r13,%rbx)
+ 1524      441D00
+ 1525 129b 4883C304 		addq	$4, %rbx
+ 1526 129f 4939DC   		cmpq	%rbx, %r12
+ 1527 12a2 75CC     		jne	.L171
+ 1528              	.L176:
+ 1529 12a4 4883C420 		addq	$32, %rsp
+ 1530 12a8 5B       		popq	%rbx
+ 1531 12a9 415A     		popq	%r10
+ 1532              		.cfi_remember_state
+ 1533              		.cfi_def_cfa 10, 0
+ 1534 12ab 415C     		popq	%r12
+ 1535 12ad 415D     		popq	%r13
+ 1536 12af 415E     		popq	%r14
+ 1537 12b1 415F     		popq	%r15
+ 1538 12b3 5D       		popq	%rbp
+ 1539 12b4 498D62F8 		leaq	-8(%r10), %rsp
+ 1540              		.cfi_def_cfa 7, 8
+ 1541 12b8 C3       		ret
+ 1542 12b9 0F1F8000 		.p2align 4,,10
+ 1542      000000
+ 1543              		.p2align 3
+ 1544              	.L175:
+ 1545              		.cfi_restore_state
+ 1546 12c0 C5F877   		vzeroupper
+ 1547 12c3 EBDF     		jmp	.L176
+ 1548              		.p2align 4,,10
+ 1549 12c5 0F1F00   		.p2align 3
+ 1550              	.L172:
+ 1551 12c8 31C0     		xorl	%eax, %eax
+ 1552 12ca E97CFFFF 		jmp	.L168
+ 1552      FF
+ 1553              		.cfi_endproc
+ 1554              	.LFE6399:
+ 1556 12cf 90       		.p2align 4
+ 1558              	limit:
+ 1559              	.LFB6405:
+ 1560              		.cfi_startproc
+ 1561 12d0 4C8D5424 		leaq	8(%rsp), %r10
+ 1561      08
+ 1562              		.cfi_def_cfa 10, 0
+ 1563 12d5 4883E4E0 		andq	$-32, %rsp
+ 1564 12d9 4189D0   		movl	%edx, %r8d
+ 1565 12dc 41FF72F8 		pushq	-8(%r10)
+ 1566 12e0 55       		pushq	%rbp
+ 1567 12e1 4889E5   		movq	%rsp, %rbp
+ 1568              		.cfi_escape 0x10,0x6,0x2,0x76,0
+ 1569 12e4 4157     		pushq	%r15
+ 1570              		.cfi_escape 0x10,0xf,0x2,0x76,0x78
+ 1571 12e6 4989F7   		movq	%rsi, %r15
+ 1572 12e9 4156     		pushq	%r14
+ 1573 12eb 4155     		pushq	%r13
+ 1574 12ed 4154     		pushq	%r12
+ 1575 12ef 4152     		pushq	%r10
+ 1576              		.cfi_escape 0xf,0x3,0x76,0x58,0x6
+ 1577              		.cfi_escape 0x10,0xe,0x2,0x76,0x70
+ 1578              		.cfi_escape 0x10,0xd,0x2,0x76,0x68
+ 1579              		.cfi_escape 0x10,0xc,0x2,0x76,0x60
+ 1580 12f1 53       		pushq	%rbx
+ 1581 12f2 4881EC60 		subq	$352, %rsp
+ 1581      010000
+ 1582              		.cfi_escape 0x10,0x3,0x2,0x76,0x50
+ 1583 12f9 8B96F800 		movl	248(%rsi), %edx
+ 1583      0000
+ 1584 12ff 4889BDB8 		movq	%rdi, -328(%rbp)
+ 1584      FEFFFF
+ 1585 1306 89CF     		movl	%ecx, %edi
+ 1586 1308 898DE4FE 		movl	%ecx, -284(%rbp)
+ 1586      FFFF
+ 1587 130e 8B8EFC00 		movl	252(%rsi), %ecx
+ 1587      0000
+ 1588 1314 8B7610   		movl	16(%rsi), %esi
+ 1589 1317 89D0     		movl	%edx, %eax
+ 1590 1319 89D3     		movl	%edx, %ebx
+ 1591 131b 8995E0FE 		movl	%edx, -288(%rbp)
+ 1591      FFFF
+ 1592 1321 C5FA1185 		vmovss	%xmm0, -292(%rbp)
+ 1592      DCFEFFFF 
+ 1593 1329 29F0     		subl	%esi, %eax
+ 1594 132b 8D4408F8 		leal	-8(%rax,%rcx), %eax
+ 1595 132f 99       		cltd
+ 1596 1330 F7FB     		idivl	%ebx
+ 1597 1332 89D8     		movl	%ebx, %eax
+ 1598 1334 29D0     		subl	%edx, %eax
+ 1599 1336 4189D4   		movl	%edx, %r12d
+ 1600 1339 39F8     		cmpl	%edi, %eax
+ 1601 133b 0F4FC7   		cmovg	%edi, %eax
+ 1602 133e 89C3     		movl	%eax, %ebx
+ 1603 1340 4585C0   		testl	%r8d, %r8d
+ 1604 1343 0F8E6607 		jle	.L179
+ 1604      0000
+ 1605 1349 4863C7   		movslq	%edi, %rax
+ 1606 134c 4C8D4DD0 		leaq	-48(%rbp), %r9
+ 1607 1350 48C785C0 		movq	$0, -320(%rbp)
+ 1607      FEFFFF00 
+ 1607      000000
+ 1608 135b 4C8DB510 		leaq	-240(%rbp), %r14
+ 1608      FFFFFF
+ 1609 1362 48C1E002 		salq	$2, %rax
+ 1610 1366 899DACFE 		movl	%ebx, -340(%rbp)
+ 1610      FFFF
+ 1611 136c 488985C8 		movq	%rax, -312(%rbp)
+ 1611      FEFFFF
+ 1612 1373 4883C03C 		addq	$60, %rax
+ 1613 1377 488985B0 		movq	%rax, -336(%rbp)
+ 1613      FEFFFF
+ 1614 137e 4963C0   		movslq	%r8d, %rax
+ 1615 1381 488985D0 		movq	%rax, -304(%rbp)
+ 1615      FEFFFF
+ 1616 1388 8D47F0   		leal	-16(%rdi), %eax
+ 1617 138b C1E804   		shrl	$4, %eax
+ 1618 138e 8995A4FE 		movl	%edx, -348(%rbp)
+ 1618      FFFF
+ 1619 1394 8D4801   		leal	1(%rax), %ecx
+ 1620 1397 4C898D98 		movq	%r9, -360(%rbp)
+ 1620      FEFFFF
+ 1621 139e 4889C8   		movq	%rcx, %rax
+ 1622 13a1 48C1E104 		salq	$4, %rcx
+ 1623 13a5 448985A8 		movl	%r8d, -344(%rbp)
+ 1623      FEFFFF
+ 1624 13ac 4D89F8   		movq	%r15, %r8
+ 1625 13af 48898DF8 		movq	%rcx, -264(%rbp)
+ 1625      FEFFFF
+ 1626 13b6 C1E004   		sall	$4, %eax
+ 1627 13b9 31C9     		xorl	%ecx, %ecx
+ 1628 13bb 4D89F7   		movq	%r14, %r15
+ 1629 13be 8985D8FE 		movl	%eax, -296(%rbp)
+ 1629      FFFF
+ 1630 13c4 48898D00 		movq	%rcx, -256(%rbp)
+ 1630      FFFFFF
+ 1631              	.L188:
+ 1632 13cb 488B9500 		movq	-256(%rbp), %rdx
+ 1632      FFFFFF
+ 1633 13d2 488B85B8 		movq	-328(%rbp), %rax
+ 1633      FEFFFF
+ 1634 13d9 4C8985F0 		movq	%r8, -272(%rbp)
+ 1634      FEFFFF
+ 1635 13e0 4C8B9DC0 		movq	-320(%rbp), %r11
+ 1635      FEFFFF
+ 1636 13e7 4D0398D8 		addq	216(%r8), %r11
+ 1636      000000
+ 1637 13ee 488B74D0 		movq	72(%rax,%rdx,8), %rsi
+ 1637      48
+ 1638 13f3 488B95C8 		movq	-312(%rbp), %rdx
+ 1638      FEFFFF
+ 1639 13fa 498D7B3C 		leaq	60(%r11), %rdi
+ 1640 13fe 4C899D08 		movq	%r11, -248(%rbp)
+ 1640      FFFFFF
+ 1641 1405 E8000000 		call	memcpy@PLT
+ 1641      00
+ 1642 140a 4C8B85F0 		movq	-272(%rbp), %r8
+ 1642      FEFFFF
+ 1643 1411 31FF     		xorl	%edi, %edi
+ 1644 1413 83BDE4FE 		cmpl	$15, -284(%rbp)
+ 1644      FFFF0F
+ 1645 141a 4C8B9D08 		movq	-248(%rbp), %r11
+ 1645      FFFFFF
+ 1646 1421 498B98E0 		movq	224(%r8), %rbx
+ 1646      000000
+ 1647 1428 0F8E4301 		jle	.L181
+ 1647      0000
+ 1648 142e 31D2     		xorl	%edx, %edx
+ 1649 1430 4C89C1   		movq	%r8, %rcx
+ 1650 1433 4C8B9500 		movq	-256(%rbp), %r10
+ 1650      FFFFFF
+ 1651 143a 4D8D6B20 		leaq	32(%r11), %r13
+ 1652 143e C4E27D18 		vbroadcastss	.LC47(%rip), %ymm5
+ 1652      2D000000 
+ 1652      00
+ 1653 1447 4C8B8D98 		movq	-360(%rbp), %r9
+ 1653      FEFFFF
+ 1654 144e 4D8D7040 		leaq	64(%r8), %r14
+ 1655 1452 4989D0   		movq	%rdx, %r8
+ 1656 1455 488D8570 		leaq	-144(%rbp), %rax
+ 1656      FFFFFF
+ 1657 145c 4C89DA   		movq	%r11, %rdx
+ 1658 145f C5C857F6 		vxorps	%xmm6, %xmm6, %xmm6
+ 1659 1463 4989CB   		movq	%rcx, %r11
+ 1660 1466 662E0F1F 		.p2align 4,,10
+ 1660      84000000 
+ 1660      0000
+ 1661              		.p2align 3
+ 1662              	.L186:
+ 1663 1470 4C899D08 		movq	%r11, -248(%rbp)
+ 1663      FFFFFF
+ 1664 1477 4D89DC   		movq	%r11, %r12
+ 1665 147a 4C89EF   		movq	%r13, %rdi
+ 1666 147d 4D89C3   		movq	%r8, %r11
+ 1667 1480 C5FC29B5 		vmovaps	%ymm6, -240(%rbp)
+ 1667      10FFFFFF 
+ 1668 1488 C5FC29B5 		vmovaps	%ymm6, -144(%rbp)
+ 1668      70FFFFFF 
+ 1669 1490 C5FC29B5 		vmovaps	%ymm6, -208(%rbp)
+ 1669      30FFFFFF 
+ 1670 1498 C5FC2975 		vmovaps	%ymm6, -112(%rbp)
+ 1670      90
+ 1671 149d C5FC29B5 		vmovaps	%ymm6, -176(%rbp)
+ 1671      50FFFFFF 
+ 1672 14a5 C5FC2975 		vmovaps	%ymm6, -80(%rbp)
+ 1672      B0
+ 1673 14aa 660F1F44 		.p2align 4,,10
+ 1673      0000
+ 1674              		.p2align 3
+ 1675              	.L183:
+ 1676 14b0 C5FC1057 		vmovups	-32(%rdi), %ymm2
+ 1676      E0
+ 1677 14b5 4D89F8   		movq	%r15, %r8
+ 1678 14b8 4C89FE   		movq	%r15, %rsi
+ 1679 14bb 4C89E1   		movq	%r12, %rcx
+ 1680 14be C5FC100F 		vmovups	(%rdi), %ymm1
+ 1681              	.L182:
+ 1682 14c2 C4E27D18 		vbroadcastss	24(%rcx), %ymm0
+ 1682      4118
+ 1683 14c8 4883C620 		addq	$32, %rsi
+ 1684 14cc 4883C140 		addq	$64, %rcx
+ 1685 14d0 C5FC28D8 		vmovaps	%ymm0, %ymm3
+ 1686 14d4 C4E275A8 		vfmadd213ps	64(%rsi), %ymm1, %ymm0
+ 1686      4640
+ 1687 14da C4E26DA8 		vfmadd213ps	-32(%rsi), %ymm2, %ymm3
+ 1687      5EE0
+ 1688 14e0 C5FC2946 		vmovaps	%ymm0, 64(%rsi)
+ 1688      40
+ 1689 14e5 C5FC295E 		vmovaps	%ymm3, -32(%rsi)
+ 1689      E0
+ 1690 14ea 4839C6   		cmpq	%rax, %rsi
+ 1691 14ed 75D3     		jne	.L182
+ 1692 14ef 4983C404 		addq	$4, %r12
+ 1693 14f3 4883C704 		addq	$4, %rdi
+ 1694 14f7 4D39F4   		cmpq	%r14, %r12
+ 1695 14fa 75B4     		jne	.L183
+ 1696 14fc 4C89C1   		movq	%r8, %rcx
+ 1697 14ff 4D89D8   		movq	%r11, %r8
+ 1698 1502 4C8B9D08 		movq	-248(%rbp), %r11
+ 1698      FFFFFF
+ 1699 1509 4A8D3485 		leaq	0(,%r8,4), %rsi
+ 1699      00000000 
+ 1700              	.L185:
+ 1701 1511 C5D45509 		vandnps	(%rcx), %ymm5, %ymm1
+ 1702 1515 C5D45544 		vandnps	28(%rdx,%rsi), %ymm5, %ymm0
+ 1702      321C
+ 1703 151b C5FC5FC1 		vmaxps	%ymm1, %ymm0, %ymm0
+ 1704 151f C5D45549 		vandnps	32(%rcx), %ymm5, %ymm1
+ 1704      20
+ 1705 1524 C5FC5FC1 		vmaxps	%ymm1, %ymm0, %ymm0
+ 1706 1528 C5D45549 		vandnps	64(%rcx), %ymm5, %ymm1
+ 1706      40
+ 1707 152d C5FC5FC1 		vmaxps	%ymm1, %ymm0, %ymm0
+ 1708 1531 4D85D2   		testq	%r10, %r10
+ 1709 1534 7405     		je	.L184
+ 1710 1536 C5FC5F04 		vmaxps	(%rbx,%rsi), %ymm0, %ymm0
+ 1710      33
+ 1711              	.L184:
+ 1712 153b 4883C160 		addq	$96, %rcx
+ 1713 153f C5FC1104 		vmovups	%ymm0, (%rbx,%rsi)
+ 1713      33
+ 1714 1544 4883C620 		addq	$32, %rsi
+ 1715 1548 4C39C9   		cmpq	%r9, %rcx
+ 1716 154b 75C4     		jne	.L185
+ 1717 154d 4983C010 		addq	$16, %r8
+ 1718 1551 4983C540 		addq	$64, %r13
+ 1719 1555 4C3985F8 		cmpq	%r8, -264(%rbp)
+ 1719      FEFFFF
+ 1720 155c 0F850EFF 		jne	.L186
+ 1720      FFFF
+ 1721 1562 4D89D8   		movq	%r11, %r8
+ 1722 1565 8BBDD8FE 		movl	-296(%rbp), %edi
+ 1722      FFFF
+ 1723 156b 4989D3   		movq	%rdx, %r11
+ 1724 156e C5F877   		vzeroupper
+ 1725              	.L181:
+ 1726 1571 39BDE4FE 		cmpl	%edi, -284(%rbp)
+ 1726      FFFF
+ 1727 1577 0F8E0801 		jle	.L194
+ 1727      0000
+ 1728 157d 8B85E4FE 		movl	-284(%rbp), %eax
+ 1728      FFFF
+ 1729 1583 4C63F7   		movslq	%edi, %r14
+ 1730 1586 4C899D90 		movq	%r11, -368(%rbp)
+ 1730      FEFFFF
+ 1731 158d 4D8DA0D8 		leaq	216(%r8), %r12
+ 1731      000000
+ 1732 1594 4C898588 		movq	%r8, -376(%rbp)
+ 1732      FEFFFF
+ 1733 159b 4F8D2CB3 		leaq	(%r11,%r14,4), %r13
+ 1734 159f 29F8     		subl	%edi, %eax
+ 1735 15a1 4C89BD80 		movq	%r15, -384(%rbp)
+ 1735      FEFFFF
+ 1736 15a8 4D89F7   		movq	%r14, %r15
+ 1737 15ab 4C01F0   		addq	%r14, %rax
+ 1738 15ae 4D89EE   		movq	%r13, %r14
+ 1739 15b1 488985F0 		movq	%rax, -272(%rbp)
+ 1739      FEFFFF
+ 1740 15b8 498D4018 		leaq	24(%r8), %rax
+ 1741 15bc 488985E8 		movq	%rax, -280(%rbp)
+ 1741      FEFFFF
+ 1742              		.p2align 4,,10
+ 1743 15c3 0F1F4400 		.p2align 3
+ 1743      00
+ 1744              	.L193:
+ 1745 15c8 C4C17A10 		vmovss	28(%r14), %xmm0
+ 1745      461C
+ 1746 15ce C4C17A10 		vmovss	(%r14), %xmm7
+ 1746      3E
+ 1747 15d3 C5F85405 		vandps	.LC48(%rip), %xmm0, %xmm0
+ 1747      00000000 
+ 1748 15db 4C8BADE8 		movq	-280(%rbp), %r13
+ 1748      FEFFFF
+ 1749 15e2 C5FA11BD 		vmovss	%xmm7, -248(%rbp)
+ 1749      08FFFFFF 
+ 1750 15ea C5F828C8 		vmovaps	%xmm0, %xmm1
+ 1751              	.L191:
+ 1752 15ee C5FA10A5 		vmovss	-248(%rbp), %xmm4
+ 1752      08FFFFFF 
+ 1753 15f6 C4C15A59 		vmulss	0(%r13), %xmm4, %xmm3
+ 1753      5D00
+ 1754 15fc B8010000 		movl	$1, %eax
+ 1754      00
+ 1755              		.p2align 4,,10
+ 1756 1601 0F1F8000 		.p2align 3
+ 1756      000000
+ 1757              	.L190:
+ 1758 1608 C4C17A10 		vmovss	0(%r13,%rax,4), %xmm2
+ 1758      548500
+ 1759 160f C4C16A59 		vmulss	(%r14,%rax,4), %xmm2, %xmm2
+ 1759      1486
+ 1760 1615 4883C001 		addq	$1, %rax
+ 1761 1619 C5E258DA 		vaddss	%xmm2, %xmm3, %xmm3
+ 1762 161d 4883F810 		cmpq	$16, %rax
+ 1763 1621 75E5     		jne	.L190
+ 1764 1623 C5E05405 		vandps	.LC48(%rip), %xmm3, %xmm0
+ 1764      00000000 
+ 1765 162b 4983C540 		addq	$64, %r13
+ 1766 162f E8000000 		call	fmaxf@PLT
+ 1766      00
+ 1767 1634 C5F828C8 		vmovaps	%xmm0, %xmm1
+ 1768 1638 4D39E5   		cmpq	%r12, %r13
+ 1769 163b 75B1     		jne	.L191
+ 1770 163d 4883BD00 		cmpq	$0, -256(%rbp)
+ 1770      FFFFFF00 
+ 1771 1645 740B     		je	.L192
+ 1772 1647 C4A17A10 		vmovss	(%rbx,%r15,4), %xmm1
+ 1772      0CBB
+ 1773 164d E8000000 		call	fmaxf@PLT
+ 1773      00
+ 1774              	.L192:
+ 1775 1652 488B85F0 		movq	-272(%rbp), %rax
+ 1775      FEFFFF
+ 1776 1659 C4A17A11 		vmovss	%xmm0, (%rbx,%r15,4)
+ 1776      04BB
+ 1777 165f 4983C701 		addq	$1, %r15
+ 1778 1663 4983C604 		addq	$4, %r14
+ 1779 1667 4939C7   		cmpq	%rax, %r15
+ 1780 166a 0F8558FF 		jne	.L193
+ 1780      FFFF
+ 1781 1670 4C8B9D90 		movq	-368(%rbp), %r11
+ 1781      FEFFFF
+ 1782 1677 4C8B8588 		movq	-376(%rbp), %r8
+ 1782      FEFFFF
+ 1783 167e 4C8BBD80 		movq	-384(%rbp), %r15
+ 1783      FEFFFF
+ 1784              	.L194:
+ 1785 1685 488B85C8 		movq	-312(%rbp), %rax
+ 1785      FEFFFF
+ 1786 168c BA3C0000 		movl	$60, %edx
+ 1786      00
+ 1787 1691 4C89DF   		movq	%r11, %rdi
+ 1788 1694 4C898508 		movq	%r8, -248(%rbp)
+ 1788      FFFFFF
+ 1789 169b 498D3403 		leaq	(%r11,%rax), %rsi
+ 1790 169f E8000000 		call	memmove@PLT
+ 1790      00
+ 1791 16a4 48838500 		addq	$1, -256(%rbp)
+ 1791      FFFFFF01 
+ 1792 16ac 488B9DB0 		movq	-336(%rbp), %rbx
+ 1792      FEFFFF
+ 1793 16b3 488B8500 		movq	-256(%rbp), %rax
+ 1793      FFFFFF
+ 1794 16ba 48019DC0 		addq	%rbx, -320(%rbp)
+ 1794      FEFFFF
+ 1795 16c1 483985D0 		cmpq	%rax, -304(%rbp)
+ 1795      FEFFFF
+ 1796 16c8 4C8B8508 		movq	-248(%rbp), %r8
+ 1796      FFFFFF
+ 1797 16cf 0F85F6FC 		jne	.L188
+ 1797      FFFF
+ 1798 16d5 4D89C7   		movq	%r8, %r15
+ 1799 16d8 C5C157FF 		vxorpd	%xmm7, %xmm7, %xmm7
+ 1800 16dc C5FB100D 		vmovsd	.LC1(%rip), %xmm1
+ 1800      00000000 
+ 1801 16e4 8B85E4FE 		movl	-284(%rbp), %eax
+ 1801      FFFF
+ 1802 16ea C4C1432A 		vcvtsi2sdl	16(%r15), %xmm7, %xmm0
+ 1802      4710
+ 1803 16f0 8B9DACFE 		movl	-340(%rbp), %ebx
+ 1803      FFFF
+ 1804 16f6 448B85A8 		movl	-344(%rbp), %r8d
+ 1804      FEFFFF
+ 1805 16fd 448BA5A4 		movl	-348(%rbp), %r12d
+ 1805      FEFFFF
+ 1806 1704 458BB710 		movl	272(%r15), %r14d
+ 1806      010000
+ 1807 170b C5F35EC8 		vdivsd	%xmm0, %xmm1, %xmm1
+ 1808 170f 85C0     		testl	%eax, %eax
+ 1809 1711 0F8EC303 		jle	.L241
+ 1809      0000
+ 1810              	.L195:
+ 1811 1717 C4417A7E 		vmovq	224(%r15), %xmm8
+ 1811      87E00000 
+ 1811      00
+ 1812 1720 44898508 		movl	%r8d, -248(%rbp)
+ 1812      FFFFFF
+ 1813 1727 4531DB   		xorl	%r11d, %r11d
+ 1814 172a 4531D2   		xorl	%r10d, %r10d
+ 1815 172d 418BB718 		movl	280(%r15), %esi
+ 1815      010000
+ 1816 1734 498BBF08 		movq	264(%r15), %rdi
+ 1816      010000
+ 1817 173b 418B8714 		movl	276(%r15), %eax
+ 1817      010000
+ 1818 1742 4D8B8F00 		movq	256(%r15), %r9
+ 1818      010000
+ 1819 1749 C4C17B10 		vmovsd	312(%r15), %xmm4
+ 1819      A7380100 
+ 1819      00
+ 1820 1752 4D8BAFE8 		movq	232(%r15), %r13
+ 1820      000000
+ 1821 1759 C4C17A7E 		vmovq	296(%r15), %xmm7
+ 1821      BF280100 
+ 1821      00
+ 1822              	.L208:
+ 1823 1762 C5FA10B5 		vmovss	-292(%rbp), %xmm6
+ 1823      DCFEFFFF 
+ 1824 176a C461F97E 		vmovq	%xmm8, %rdx
+ 1824      C2
+ 1825 176f C4A17A10 		vmovss	(%rdx,%r11,4), %xmm0
+ 1825      049A
+ 1826 1775 C5F82FC6 		vcomiss	%xmm6, %xmm0
+ 1827 1779 0F865601 		jbe	.L237
+ 1827      0000
+ 1828 177f C5CA5EC0 		vdivss	%xmm0, %xmm6, %xmm0
+ 1829              	.L198:
+ 1830 1783 458B871C 		movl	284(%r15), %r8d
+ 1830      010000
+ 1831 178a 418D5001 		leal	1(%r8), %edx
+ 1832 178e 4189971C 		movl	%edx, 284(%r15)
+ 1832      010000
+ 1833 1795 85F6     		testl	%esi, %esi
+ 1834 1797 7429     		je	.L200
+ 1835 1799 4863D0   		movslq	%eax, %rdx
+ 1836 179c 4489C1   		movl	%r8d, %ecx
+ 1837 179f 2B0C97   		subl	(%rdi,%rdx,4), %ecx
+ 1838 17a2 4439F1   		cmpl	%r14d, %ecx
+ 1839 17a5 721B     		jb	.L200
+ 1840 17a7 83C001   		addl	$1, %eax
+ 1841 17aa 4439F0   		cmpl	%r14d, %eax
+ 1842 17ad 410F44C2 		cmove	%r10d, %eax
+ 1843 17b1 83EE01   		subl	$1, %esi
+ 1844 17b4 4189B718 		movl	%esi, 280(%r15)
+ 1844      010000
+ 1845 17bb 41898714 		movl	%eax, 276(%r15)
+ 1845      010000
+ 1846              	.L200:
+ 1847 17c2 8D5406FF 		leal	-1(%rsi,%rax), %edx
+ 1848 17c6 4429F0   		subl	%r14d, %eax
+ 1849 17c9 4489A500 		movl	%r12d, -256(%rbp)
+ 1849      FFFFFF
+ 1850 17d0 4989FC   		movq	%rdi, %r12
+ 1851 17d3 8D48FF   		leal	-1(%rax), %ecx
+ 1852 17d6 89CF     		movl	%ecx, %edi
+ 1853 17d8 EB1E     		jmp	.L204
+ 1854 17da 660F1F44 		.p2align 4,,10
+ 1854      0000
+ 1855              		.p2align 3
+ 1856              	.L242:
+ 1857 17e0 4863C8   		movslq	%eax, %rcx
+ 1858 17e3 83EA01   		subl	$1, %edx
+ 1859 17e6 C4C1782F 		vcomiss	(%r9,%rcx,4), %xmm0
+ 1859      0489
+ 1860 17ec 7719     		ja	.L203
+ 1861 17ee 83EE01   		subl	$1, %esi
+ 1862 17f1 4189B718 		movl	%esi, 280(%r15)
+ 1862      010000
+ 1863              	.L204:
+ 1864 17f8 89D0     		movl	%edx, %eax
+ 1865 17fa 8D0C37   		leal	(%rdi,%rsi), %ecx
+ 1866 17fd 4439F2   		cmpl	%r14d, %edx
+ 1867 1800 0F4DC1   		cmovge	%ecx, %eax
+ 1868 1803 85F6     		testl	%esi, %esi
+ 1869 1805 75D9     		jne	.L242
+ 1870              	.L203:
+ 1871 1807 83C001   		addl	$1, %eax
+ 1872 180a 4C89E7   		movq	%r12, %rdi
+ 1873 180d 448BA500 		movl	-256(%rbp), %r12d
+ 1873      FFFFFF
+ 1874 1814 4439F0   		cmpl	%r14d, %eax
+ 1875 1817 0F84C500 		je	.L211
+ 1875      0000
+ 1876 181d 4898     		cltq
+ 1877 181f 488D1485 		leaq	0(,%rax,4), %rdx
+ 1877      00000000 
+ 1878 1827 498D0411 		leaq	(%r9,%rdx), %rax
+ 1879 182b 4801FA   		addq	%rdi, %rdx
+ 1880              	.L205:
+ 1881 182e C5FA1100 		vmovss	%xmm0, (%rax)
+ 1882 1832 C4C17A10 		vmovss	288(%r15), %xmm2
+ 1882      97200100 
+ 1882      00
+ 1883 183b 448902   		movl	%r8d, (%rdx)
+ 1884 183e 49639714 		movslq	276(%r15), %rdx
+ 1884      010000
+ 1885 1845 418B8718 		movl	280(%r15), %eax
+ 1885      010000
+ 1886 184c C4C17A10 		vmovss	(%r9,%rdx,4), %xmm0
+ 1886      0491
+ 1887 1852 8D7001   		leal	1(%rax), %esi
+ 1888 1855 4889D0   		movq	%rdx, %rax
+ 1889 1858 C5F82FD0 		vcomiss	%xmm0, %xmm2
+ 1890 185c 4189B718 		movl	%esi, 280(%r15)
+ 1890      010000
+ 1891 1863 770E     		ja	.L206
+ 1892 1865 C5EA5CD0 		vsubss	%xmm0, %xmm2, %xmm2
+ 1893 1869 C4C16A59 		vmulss	20(%r15), %xmm2, %xmm2
+ 1893      5714
+ 1894 186f C5FA58C2 		vaddss	%xmm2, %xmm0, %xmm0
+ 1895              	.L206:
+ 1896 1873 49639730 		movslq	304(%r15), %rdx
+ 1896      010000
+ 1897 187a C4C1F97E 		vmovq	%xmm7, %r8
+ 1897      F8
+ 1898 187f C4C17A11 		vmovss	%xmm0, 288(%r15)
+ 1898      87200100 
+ 1898      00
+ 1899 1888 4889D1   		movq	%rdx, %rcx
+ 1900 188b 498D1490 		leaq	(%r8,%rdx,4), %rdx
+ 1901 188f C5FA5C12 		vsubss	(%rdx), %xmm0, %xmm2
+ 1902 1893 83C101   		addl	$1, %ecx
+ 1903 1896 C5FA1102 		vmovss	%xmm0, (%rdx)
+ 1904 189a C5EA5AD2 		vcvtss2sd	%xmm2, %xmm2, %xmm2
+ 1905 189e C5DB58E2 		vaddsd	%xmm2, %xmm4, %xmm4
+ 1906 18a2 413B4F10 		cmpl	16(%r15), %ecx
+ 1907 18a6 7502     		jne	.L207
+ 1908 18a8 31C9     		xorl	%ecx, %ecx
+ 1909              	.L207:
+ 1910 18aa C5F359D4 		vmulsd	%xmm4, %xmm1, %xmm2
+ 1911 18ae 41898F30 		movl	%ecx, 304(%r15)
+ 1911      010000
+ 1912 18b5 4D8D4301 		leaq	1(%r11), %r8
+ 1913 18b9 C5EB5AD2 		vcvtsd2ss	%xmm2, %xmm2, %xmm2
+ 1914 18bd C4817A11 		vmovss	%xmm2, 0(%r13,%r11,4)
+ 1914      549D00
+ 1915 18c4 443985E4 		cmpl	%r8d, -284(%rbp)
+ 1915      FEFFFF
+ 1916 18cb 7E20     		jle	.L243
+ 1917 18cd 4D89C3   		movq	%r8, %r11
+ 1918 18d0 E98DFEFF 		jmp	.L208
+ 1918      FF
+ 1919              	.L237:
+ 1920 18d5 C5FA1005 		vmovss	.LC22(%rip), %xmm0
+ 1920      00000000 
+ 1921 18dd E9A1FEFF 		jmp	.L198
+ 1921      FF
+ 1922              	.L211:
+ 1923 18e2 4889FA   		movq	%rdi, %rdx
+ 1924 18e5 4C89C8   		movq	%r9, %rax
+ 1925 18e8 E941FFFF 		jmp	.L205
+ 1925      FF
+ 1926              	.L243:
+ 1927 18ed 496387FC 		movslq	252(%r15), %rax
+ 1927      000000
+ 1928 18f4 448B8508 		movl	-248(%rbp), %r8d
+ 1928      FFFFFF
+ 1929 18fb C4C17B11 		vmovsd	%xmm4, 312(%r15)
+ 1929      A7380100 
+ 1929      00
+ 1930 1904 C5FA1102 		vmovss	%xmm0, (%rdx)
+ 1931 1908 41898F30 		movl	%ecx, 304(%r15)
+ 1931      010000
+ 1932 190f 89C1     		movl	%eax, %ecx
+ 1933 1911 C4817A11 		vmovss	%xmm2, 0(%r13,%r11,4)
+ 1933      549D00
+ 1934 1918 4585C0   		testl	%r8d, %r8d
+ 1935 191b 0F8E6001 		jle	.L196
+ 1935      0000
+ 1936 1921 4963D0   		movslq	%r8d, %rdx
+ 1937 1924 488995D0 		movq	%rdx, -304(%rbp)
+ 1937      FEFFFF
+ 1938              	.L197:
+ 1939 192b 4963D4   		movslq	%r12d, %rdx
+ 1940 192e 4C8BB5B8 		movq	-328(%rbp), %r14
+ 1940      FEFFFF
+ 1941 1935 4531ED   		xorl	%r13d, %r13d
+ 1942 1938 48C1E202 		salq	$2, %rdx
+ 1943 193c 48899508 		movq	%rdx, -248(%rbp)
+ 1943      FFFFFF
+ 1944 1943 4863D3   		movslq	%ebx, %rdx
+ 1945 1946 48C1E202 		salq	$2, %rdx
+ 1946 194a 48899500 		movq	%rdx, -256(%rbp)
+ 1946      FFFFFF
+ 1947 1951 8B95E4FE 		movl	-284(%rbp), %edx
+ 1947      FFFF
+ 1948 1957 29DA     		subl	%ebx, %edx
+ 1949 1959 8995F0FE 		movl	%edx, -272(%rbp)
+ 1949      FFFF
+ 1950 195f 486395E0 		movslq	-288(%rbp), %rdx
+ 1950      FEFFFF
+ 1951 1966 48C1E202 		salq	$2, %rdx
+ 1952 196a 488995F8 		movq	%rdx, -264(%rbp)
+ 1952      FEFFFF
+ 1953 1971 488B95D0 		movq	-304(%rbp), %rdx
+ 1953      FEFFFF
+ 1954 1978 4D8D0CD6 		leaq	(%r14,%rdx,8), %r9
+ 1955 197c EB07     		jmp	.L209
+ 1956              	.L244:
+ 1957 197e 496387FC 		movslq	252(%r15), %rax
+ 1957      000000
+ 1958              	.L209:
+ 1959 1985 448B9DE0 		movl	-288(%rbp), %r11d
+ 1959      FEFFFF
+ 1960 198c 498B7648 		movq	72(%r14), %rsi
+ 1961 1990 4C898DC0 		movq	%r9, -320(%rbp)
+ 1961      FEFFFF
+ 1962 1997 8B95E4FE 		movl	-284(%rbp), %edx
+ 1962      FFFF
+ 1963 199d 4D8BA7F0 		movq	240(%r15), %r12
+ 1963      000000
+ 1964 19a4 4129C3   		subl	%eax, %r11d
+ 1965 19a7 4889B5E8 		movq	%rsi, -280(%rbp)
+ 1965      FEFFFF
+ 1966 19ae 4D01EC   		addq	%r13, %r12
+ 1967 19b1 4139D3   		cmpl	%edx, %r11d
+ 1968 19b4 440F4FDA 		cmovg	%edx, %r11d
+ 1969 19b8 498D3C84 		leaq	(%r12,%rax,4), %rdi
+ 1970 19bc 4983C608 		addq	$8, %r14
+ 1971 19c0 4D63D3   		movslq	%r11d, %r10
+ 1972 19c3 44899DC8 		movl	%r11d, -312(%rbp)
+ 1972      FEFFFF
+ 1973 19ca 49C1E202 		salq	$2, %r10
+ 1974 19ce 4C89D2   		movq	%r10, %rdx
+ 1975 19d1 4C8995D0 		movq	%r10, -304(%rbp)
+ 1975      FEFFFF
+ 1976 19d8 E8000000 		call	memcpy@PLT
+ 1976      00
+ 1977 19dd 448B9DC8 		movl	-312(%rbp), %r11d
+ 1977      FEFFFF
+ 1978 19e4 4C89E7   		movq	%r12, %rdi
+ 1979 19e7 8B95E4FE 		movl	-284(%rbp), %edx
+ 1979      FFFF
+ 1980 19ed 4C8B95D0 		movq	-304(%rbp), %r10
+ 1980      FEFFFF
+ 1981 19f4 488BB5E8 		movq	-280(%rbp), %rsi
+ 1981      FEFFFF
+ 1982 19fb 4429DA   		subl	%r11d, %edx
+ 1983 19fe 4863D2   		movslq	%edx, %rdx
+ 1984 1a01 4C01D6   		addq	%r10, %rsi
+ 1985 1a04 48C1E202 		salq	$2, %rdx
+ 1986 1a08 E8000000 		call	memcpy@PLT
+ 1986      00
+ 1987 1a0d 488B8508 		movq	-248(%rbp), %rax
+ 1987      FFFFFF
+ 1988 1a14 498B7E40 		movq	64(%r14), %rdi
+ 1989 1a18 89DA     		movl	%ebx, %edx
+ 1990 1a1a 498B8FE8 		movq	232(%r15), %rcx
+ 1990      000000
+ 1991 1a21 C5FA1085 		vmovss	-292(%rbp), %xmm0
+ 1991      DCFEFFFF 
+ 1992 1a29 498D3404 		leaq	(%r12,%rax), %rsi
+ 1993 1a2d E87EF7FF 		call	ramp_and_clip_block
+ 1993      FF
+ 1994 1a32 488B8500 		movq	-256(%rbp), %rax
+ 1994      FFFFFF
+ 1995 1a39 498B8FE8 		movq	232(%r15), %rcx
+ 1995      000000
+ 1996 1a40 4C89E6   		movq	%r12, %rsi
+ 1997 1a43 C5FA1085 		vmovss	-292(%rbp), %xmm0
+ 1997      DCFEFFFF 
+ 1998 1a4b 8B95F0FE 		movl	-272(%rbp), %edx
+ 1998      FFFF
+ 1999 1a51 4801C1   		addq	%rax, %rcx
+ 2000 1a54 49034640 		addq	64(%r14), %rax
+ 2001 1a58 4889C7   		movq	%rax, %rdi
+ 2002 1a5b E850F7FF 		call	ramp_and_clip_block
+ 2002      FF
+ 2003 1a60 488B85F8 		movq	-264(%rbp), %rax
+ 2003      FEFFFF
+ 2004 1a67 4C8B8DC0 		movq	-320(%rbp), %r9
+ 2004      FEFFFF
+ 2005 1a6e 4901C5   		addq	%rax, %r13
+ 2006 1a71 4D39CE   		cmpq	%r9, %r14
+ 2007 1a74 0F8504FF 		jne	.L244
+ 2007      FFFF
+ 2008 1a7a 418B8FFC 		movl	252(%r15), %ecx
+ 2008      000000
+ 2009              	.L196:
+ 2010 1a81 8B85E4FE 		movl	-284(%rbp), %eax
+ 2010      FFFF
+ 2011 1a87 01C8     		addl	%ecx, %eax
+ 2012 1a89 99       		cltd
+ 2013 1a8a F7BDE0FE 		idivl	-288(%rbp)
+ 2013      FFFF
+ 2014 1a90 418997FC 		movl	%edx, 252(%r15)
+ 2014      000000
+ 2015 1a97 4881C460 		addq	$352, %rsp
+ 2015      010000
+ 2016 1a9e 5B       		popq	%rbx
+ 2017 1a9f 415A     		popq	%r10
+ 2018              		.cfi_remember_state
+ 2019              		.cfi_def_cfa 10, 0
+ 2020 1aa1 415C     		popq	%r12
+ 2021 1aa3 415D     		popq	%r13
+ 2022 1aa5 415E     		popq	%r14
+ 2023 1aa7 415F     		popq	%r15
+ 2024 1aa9 5D       		popq	%rbp
+ 2025 1aaa 498D62F8 		leaq	-8(%r10), %rsp
+ 2026              		.cfi_def_cfa 7, 8
+ 2027 1aae C3       		ret
+ 2028              	.L179:
+ 2029              		.cfi_restore_state
+ 2030 1aaf C5C157FF 		vxorpd	%xmm7, %xmm7, %xmm7
+ 2031 1ab3 8B95E4FE 		movl	-284(%rbp), %edx
+ 2031      FFFF
+ 2032 1ab9 C5FB100D 		vmovsd	.LC1(%rip), %xmm1
+ 2032      00000000 
+ 2033 1ac1 C5C32AC6 		vcvtsi2sdl	%esi, %xmm7, %xmm0
+ 2034 1ac5 458BB710 		movl	272(%r15), %r14d
+ 2034      010000
+ 2035 1acc C5F35EC8 		vdivsd	%xmm0, %xmm1, %xmm1
+ 2036 1ad0 85D2     		testl	%edx, %edx
+ 2037 1ad2 0F8F3FFC 		jg	.L195
+ 2037      FFFF
+ 2038 1ad8 EBA7     		jmp	.L196
+ 2039              	.L241:
+ 2040 1ada 496387FC 		movslq	252(%r15), %rax
+ 2040      000000
+ 2041 1ae1 E945FEFF 		jmp	.L197
+ 2041      FF
+ 2042              		.cfi_endproc
+ 2043              	.LFE6405:
+ 2045 1ae6 662E0F1F 		.p2align 4
+ 2045      84000000 
+ 2045      0000
+ 2046              		.globl	gain_process
+ 2048              	gain_process:
+ 2049              	.LFB6408:
+ 2050              		.cfi_startproc
+ 2051 1af0 4157     		pushq	%r15
+ 2052              		.cfi_def_cfa_offset 16
+ 2053              		.cfi_offset 15, -16
+ 2054 1af2 4156     		pushq	%r14
+ 2055              		.cfi_def_cfa_offset 24
+ 2056              		.cfi_offset 14, -24
+ 2057 1af4 4155     		pushq	%r13
+ 2058              		.cfi_def_cfa_offset 32
+ 2059              		.cfi_offset 13, -32
+ 2060 1af6 4154     		pushq	%r12
+ 2061              		.cfi_def_cfa_offset 40
+ 2062              		.cfi_offset 12, -40
+ 2063 1af8 4989FC   		movq	%rdi, %r12
+ 2064 1afb 55       		pushq	%rbp
+ 2065              		.cfi_def_cfa_offset 48
+ 2066              		.cfi_offset 6, -48
+ 2067 1afc 53       		pushq	%rbx
+ 2068              		.cfi_def_cfa_offset 56
+ 2069              		.cfi_offset 3, -56
+ 2070 1afd 4883EC78 		subq	$120, %rsp
+ 2071              		.cfi_def_cfa_offset 176
+ 2072 1b01 488BAFC0 		movq	192(%rdi), %rbp
+ 2072      000000
+ 2073 1b08 8B879C00 		movl	156(%rdi), %eax
+ 2073      0000
+ 2074 1b0e 448BB7A4 		movl	164(%rdi), %r14d
+ 2074      000000
+ 2075 1b15 89442414 		movl	%eax, 20(%rsp)
+ 2076 1b19 8B4514   		movl	20(%rbp), %eax
+ 2077 1b1c 4889EF   		movq	%rbp, %rdi
+ 2078 1b1f 034510   		addl	16(%rbp), %eax
+ 2079 1b22 8B5D38   		movl	56(%rbp), %ebx
+ 2080 1b25 448D50FF 		leal	-1(%rax), %r10d
+ 2081 1b29 8B453C   		movl	60(%rbp), %eax
+ 2082 1b2c 895C2410 		movl	%ebx, 16(%rsp)
+ 2083 1b30 89DE     		movl	%ebx, %esi
+ 2084 1b32 01D8     		addl	%ebx, %eax
+ 2085 1b34 44895424 		movl	%r10d, 8(%rsp)
+ 2085      08
+ 2086 1b39 4429D0   		subl	%r10d, %eax
+ 2087 1b3c 99       		cltd
+ 2088 1b3d F7FB     		idivl	%ebx
+ 2089 1b3f 4863DA   		movslq	%edx, %rbx
+ 2090 1b42 29DE     		subl	%ebx, %esi
+ 2091 1b44 4139F6   		cmpl	%esi, %r14d
+ 2092 1b47 89742450 		movl	%esi, 80(%rsp)
+ 2093 1b4b 410F4EF6 		cmovle	%r14d, %esi
+ 2094 1b4f 8974244C 		movl	%esi, 76(%rsp)
+ 2095 1b53 4489F6   		movl	%r14d, %esi
+ 2096 1b56 E8A5E4FF 		call	gain_ramp
+ 2096      FF
+ 2097 1b5b 488B7578 		movq	120(%rbp), %rsi
+ 2098 1b5f 448B5424 		movl	8(%rsp), %r10d
+ 2098      08
+ 2099 1b64 4989C1   		movq	%rax, %r9
+ 2100 1b67 4885F6   		testq	%rsi, %rsi
+ 2101 1b6a 0F84D003 		je	.L277
+ 2101      0000
+ 2102 1b70 8B542414 		movl	20(%rsp), %edx
+ 2103 1b74 85D2     		testl	%edx, %edx
+ 2104 1b76 0F8E1504 		jle	.L251
+ 2104      0000
+ 2105 1b7c C5FA100D 		vmovss	.LC50(%rip), %xmm1
+ 2105      00000000 
+ 2106 1b84 41BBFFFF 		movl	$2147483647, %r11d
+ 2106      FF7F
+ 2107              	.L248:
+ 2108 1b8a 488D049D 		leaq	0(,%rbx,4), %rax
+ 2108      00000000 
+ 2109 1b92 4C89E7   		movq	%r12, %rdi
+ 2110 1b95 31DB     		xorl	%ebx, %ebx
+ 2111 1b97 4989EC   		movq	%rbp, %r12
+ 2112 1b9a 48894424 		movq	%rax, 64(%rsp)
+ 2112      40
+ 2113 1b9f 4963C6   		movslq	%r14d, %rax
+ 2114 1ba2 4531FF   		xorl	%r15d, %r15d
+ 2115 1ba5 48C1E002 		salq	$2, %rax
+ 2116 1ba9 44895424 		movl	%r10d, 36(%rsp)
+ 2116      24
+ 2117 1bae 48894424 		movq	%rax, 96(%rsp)
+ 2117      60
+ 2118 1bb3 48634424 		movslq	76(%rsp), %rax
+ 2118      4C
+ 2119 1bb8 4C894C24 		movq	%r9, 24(%rsp)
+ 2119      18
+ 2120 1bbd 48C1E002 		salq	$2, %rax
+ 2121 1bc1 44895C24 		movl	%r11d, 72(%rsp)
+ 2121      48
+ 2122 1bc6 48894424 		movq	%rax, 104(%rsp)
+ 2122      68
+ 2123 1bcb 438D0416 		leal	(%r14,%r10), %eax
+ 2124 1bcf 89442454 		movl	%eax, 84(%rsp)
+ 2125 1bd3 488D4518 		leaq	24(%rbp), %rax
+ 2126 1bd7 4889DD   		movq	%rbx, %rbp
+ 2127 1bda 4889FB   		movq	%rdi, %rbx
+ 2128 1bdd 48894424 		movq	%rax, 88(%rsp)
+ 2128      58
+ 2129 1be2 C5FA114C 		vmovss	%xmm1, 32(%rsp)
+ 2129      2420
+ 2130 1be8 EB3B     		jmp	.L261
+ 2131 1bea 660F1F44 		.p2align 4,,10
+ 2131      0000
+ 2132              		.p2align 3
+ 2133              	.L279:
+ 2134 1bf0 8B7C2448 		movl	72(%rsp), %edi
+ 2135 1bf4 4139BCAC 		cmpl	%edi, 128(%r12,%rbp,4)
+ 2135      80000000 
+ 2136 1bfc 7C4F     		jl	.L252
+ 2137 1bfe C60201   		movb	$1, (%rdx)
+ 2138 1c01 488B5424 		movq	96(%rsp), %rdx
+ 2138      60
+ 2139 1c06 31F6     		xorl	%esi, %esi
+ 2140 1c08 4C89DF   		movq	%r11, %rdi
+ 2141 1c0b E8000000 		call	memset@PLT
+ 2141      00
+ 2142              	.L253:
+ 2143 1c10 8B442410 		movl	16(%rsp), %eax
+ 2144 1c14 4883C501 		addq	$1, %rbp
+ 2145 1c18 4101C7   		addl	%eax, %r15d
+ 2146 1c1b 396C2414 		cmpl	%ebp, 20(%rsp)
+ 2147 1c1f 0F8E4B02 		jle	.L278
+ 2147      0000
+ 2148              	.L261:
+ 2149 1c25 488B8388 		movq	136(%rbx), %rax
+ 2149      000000
+ 2150 1c2c 488B9390 		movq	144(%rbx), %rdx
+ 2150      000000
+ 2151 1c33 4C8B6CEB 		movq	8(%rbx,%rbp,8), %r13
+ 2151      08
+ 2152 1c38 4C8B5CEB 		movq	72(%rbx,%rbp,8), %r11
+ 2152      48
+ 2153 1c3d 4801E8   		addq	%rbp, %rax
+ 2154 1c40 4801EA   		addq	%rbp, %rdx
+ 2155 1c43 498B4C24 		movq	40(%r12), %rcx
+ 2155      28
+ 2156 1c48 803800   		cmpb	$0, (%rax)
+ 2157 1c4b 75A3     		jne	.L279
+ 2158              	.L252:
+ 2159 1c4d C60200   		movb	$0, (%rdx)
+ 2160 1c50 803800   		cmpb	$0, (%rax)
+ 2161 1c53 753B     		jne	.L254
+ 2162 1c55 41C784AC 		movl	$0, 128(%r12,%rbp,4)
+ 2162      80000000 
+ 2162      00000000 
+ 2163              	.L255:
+ 2164 1c61 8B442424 		movl	36(%rsp), %eax
+ 2165 1c65 85C0     		testl	%eax, %eax
+ 2166 1c67 7548     		jne	.L256
+ 2167              	.L280:
+ 2168 1c69 488B4424 		movq	24(%rsp), %rax
+ 2168      18
+ 2169 1c6e 4885C0   		testq	%rax, %rax
+ 2170 1c71 0F84D901 		je	.L257
+ 2170      0000
+ 2171 1c77 4889C1   		movq	%rax, %rcx
+ 2172 1c7a 4489F2   		movl	%r14d, %edx
+ 2173 1c7d 4C89EE   		movq	%r13, %rsi
+ 2174 1c80 4C89DF   		movq	%r11, %rdi
+ 2175 1c83 C5FA1044 		vmovss	32(%rsp), %xmm0
+ 2175      2420
+ 2176 1c89 E822F5FF 		call	ramp_and_clip_block
+ 2176      FF
+ 2177 1c8e EB80     		jmp	.L253
+ 2178              		.p2align 4,,10
+ 2179              		.p2align 3
+ 2180              	.L254:
+ 2181 1c90 418B84AC 		movl	128(%r12,%rbp,4), %eax
+ 2181      80000000 
+ 2182 1c98 39442410 		cmpl	%eax, 16(%rsp)
+ 2183 1c9c 7EC3     		jle	.L255
+ 2184 1c9e 4401F0   		addl	%r14d, %eax
+ 2185 1ca1 418984AC 		movl	%eax, 128(%r12,%rbp,4)
+ 2185      80000000 
+ 2186 1ca9 8B442424 		movl	36(%rsp), %eax
+ 2187 1cad 85C0     		testl	%eax, %eax
+ 2188 1caf 74B8     		je	.L280
+ 2189              	.L256:
+ 2190 1cb1 4963C7   		movslq	%r15d, %rax
+ 2191 1cb4 4C89EE   		movq	%r13, %rsi
+ 2192 1cb7 4C895C24 		movq	%r11, 56(%rsp)
+ 2192      38
+ 2193 1cbc 488D3C81 		leaq	(%rcx,%rax,4), %rdi
+ 2194 1cc0 49634424 		movslq	60(%r12), %rax
+ 2194      3C
+ 2195 1cc5 8B4C2410 		movl	16(%rsp), %ecx
+ 2196 1cc9 48897C24 		movq	%rdi, 8(%rsp)
+ 2196      08
+ 2197 1cce 29C1     		subl	%eax, %ecx
+ 2198 1cd0 488D3C87 		leaq	(%rdi,%rax,4), %rdi
+ 2199 1cd4 4439F1   		cmpl	%r14d, %ecx
+ 2200 1cd7 410F4FCE 		cmovg	%r14d, %ecx
+ 2201 1cdb 4863D1   		movslq	%ecx, %rdx
+ 2202 1cde 894C2430 		movl	%ecx, 48(%rsp)
+ 2203 1ce2 4C8D0495 		leaq	0(,%rdx,4), %r8
+ 2203      00000000 
+ 2204 1cea 4C89C2   		movq	%r8, %rdx
+ 2205 1ced 4C894424 		movq	%r8, 40(%rsp)
+ 2205      28
+ 2206 1cf2 E8000000 		call	memcpy@PLT
+ 2206      00
+ 2207 1cf7 8B4C2430 		movl	48(%rsp), %ecx
+ 2208 1cfb 4489F0   		movl	%r14d, %eax
+ 2209 1cfe 4C8B4424 		movq	40(%rsp), %r8
+ 2209      28
+ 2210 1d03 488B7C24 		movq	8(%rsp), %rdi
+ 2210      08
+ 2211 1d08 29C8     		subl	%ecx, %eax
+ 2212 1d0a 4B8D7405 		leaq	0(%r13,%r8), %rsi
+ 2212      00
+ 2213 1d0f 4898     		cltq
+ 2214 1d11 488D1485 		leaq	0(,%rax,4), %rdx
+ 2214      00000000 
+ 2215 1d19 E8000000 		call	memcpy@PLT
+ 2215      00
+ 2216 1d1e 488B4424 		movq	8(%rsp), %rax
+ 2216      08
+ 2217 1d23 488B4C24 		movq	64(%rsp), %rcx
+ 2217      40
+ 2218 1d28 41837C24 		cmpl	$1, 20(%r12)
+ 2218      1401
+ 2219 1d2e 4C8B5C24 		movq	56(%rsp), %r11
+ 2219      38
+ 2220 1d33 488D3408 		leaq	(%rax,%rcx), %rsi
+ 2221 1d37 0F84B300 		je	.L281
+ 2221      0000
+ 2222 1d3d 8B442450 		movl	80(%rsp), %eax
+ 2223 1d41 448B6C24 		movl	84(%rsp), %r13d
+ 2223      54
+ 2224 1d46 4C895C24 		movq	%r11, 48(%rsp)
+ 2224      30
+ 2225 1d4b 452B6C24 		subl	16(%r12), %r13d
+ 2225      10
+ 2226 1d50 498B7C24 		movq	48(%r12), %rdi
+ 2226      30
+ 2227 1d55 4439E8   		cmpl	%r13d, %eax
+ 2228 1d58 410F4FC5 		cmovg	%r13d, %eax
+ 2229 1d5c 4129C5   		subl	%eax, %r13d
+ 2230 1d5f 4863D0   		movslq	%eax, %rdx
+ 2231 1d62 4D63ED   		movslq	%r13d, %r13
+ 2232 1d65 48C1E202 		salq	$2, %rdx
+ 2233 1d69 48837C24 		cmpq	$0, 24(%rsp)
+ 2233      1800
+ 2234 1d6f 4A8D04AD 		leaq	0(,%r13,4), %rax
+ 2234      00000000 
+ 2235 1d77 4C8D2C17 		leaq	(%rdi,%rdx), %r13
+ 2236 1d7b 48894424 		movq	%rax, 40(%rsp)
+ 2236      28
+ 2237 1d80 0F843A01 		je	.L260
+ 2237      0000
+ 2238 1d86 E8000000 		call	memcpy@PLT
+ 2238      00
+ 2239 1d8b 488B5424 		movq	40(%rsp), %rdx
+ 2239      28
+ 2240 1d90 488B7424 		movq	8(%rsp), %rsi
+ 2240      08
+ 2241 1d95 4C89EF   		movq	%r13, %rdi
+ 2242 1d98 E8000000 		call	memcpy@PLT
+ 2242      00
+ 2243 1d9d 4C8B5C24 		movq	48(%rsp), %r11
+ 2243      30
+ 2244 1da2 498B7424 		movq	48(%r12), %rsi
+ 2244      30
+ 2245 1da7 4489F2   		movl	%r14d, %edx
+ 2246 1daa C5FA100D 		vmovss	.LC50(%rip), %xmm1
+ 2246      00000000 
+ 2247 1db2 488B4C24 		movq	88(%rsp), %rcx
+ 2247      58
+ 2248 1db7 C5FA1005 		vmovss	.LC22(%rip), %xmm0
+ 2248      00000000 
+ 2249 1dbf 4C89DF   		movq	%r11, %rdi
+ 2250 1dc2 4C895C24 		movq	%r11, 8(%rsp)
+ 2250      08
+ 2251 1dc7 E824E4FF 		call	lagrange_gain_and_clip_block
+ 2251      FF
+ 2252 1dcc 4C8B5C24 		movq	8(%rsp), %r11
+ 2252      08
+ 2253 1dd1 488B4C24 		movq	24(%rsp), %rcx
+ 2253      18
+ 2254 1dd6 4489F2   		movl	%r14d, %edx
+ 2255 1dd9 C5FA1044 		vmovss	32(%rsp), %xmm0
+ 2255      2420
+ 2256 1ddf 4C89DE   		movq	%r11, %rsi
+ 2257 1de2 4C89DF   		movq	%r11, %rdi
+ 2258 1de5 E8C6F3FF 		call	ramp_and_clip_block
+ 2258      FF
+ 2259 1dea E921FEFF 		jmp	.L253
+ 2259      FF
+ 2260 1def 90       		.p2align 4,,10
+ 2261              		.p2align 3
+ 2262              	.L281:
+ 2263 1df0 8B7C244C 		movl	76(%rsp), %edi
+ 2264 1df4 488B4C24 		movq	104(%rsp), %rcx
+ 2264      68
+ 2265 1df9 4489F0   		movl	%r14d, %eax
+ 2266 1dfc 4C8B4C24 		movq	24(%rsp), %r9
+ 2266      18
+ 2267 1e01 29F8     		subl	%edi, %eax
+ 2268 1e03 4D8D2C0B 		leaq	(%r11,%rcx), %r13
+ 2269 1e07 89442428 		movl	%eax, 40(%rsp)
+ 2270 1e0b 4D85C9   		testq	%r9, %r9
+ 2271 1e0e 0F84EC00 		je	.L259
+ 2271      0000
+ 2272 1e14 C5FA1044 		vmovss	32(%rsp), %xmm0
+ 2272      2420
+ 2273 1e1a 4C89C9   		movq	%r9, %rcx
+ 2274 1e1d 89FA     		movl	%edi, %edx
+ 2275 1e1f 4C89DF   		movq	%r11, %rdi
+ 2276 1e22 E889F3FF 		call	ramp_and_clip_block
+ 2276      FF
+ 2277 1e27 488B7424 		movq	24(%rsp), %rsi
+ 2277      18
+ 2278 1e2c 8B542428 		movl	40(%rsp), %edx
+ 2279 1e30 4C89EF   		movq	%r13, %rdi
+ 2280 1e33 488B4C24 		movq	104(%rsp), %rcx
+ 2280      68
+ 2281 1e38 C5FA1044 		vmovss	32(%rsp), %xmm0
+ 2281      2420
+ 2282 1e3e 4801F1   		addq	%rsi, %rcx
+ 2283 1e41 488B7424 		movq	8(%rsp), %rsi
+ 2283      08
+ 2284 1e46 E865F3FF 		call	ramp_and_clip_block
+ 2284      FF
+ 2285 1e4b E9C0FDFF 		jmp	.L253
+ 2285      FF
+ 2286              		.p2align 4,,10
+ 2287              		.p2align 3
+ 2288              	.L257:
+ 2289 1e50 C4C17A10 		vmovss	(%r12), %xmm0
+ 2289      0424
+ 2290 1e56 4489F2   		movl	%r14d, %edx
+ 2291 1e59 4C89EE   		movq	%r13, %rsi
+ 2292 1e5c 4C89DF   		movq	%r11, %rdi
+ 2293 1e5f C5FA104C 		vmovss	32(%rsp), %xmm1
+ 2293      2420
+ 2294 1e65 E836F2FF 		call	gain_and_clip_block
+ 2294      FF
+ 2295 1e6a E9A1FDFF 		jmp	.L253
+ 2295      FF
+ 2296 1e6f 90       		.p2align 4,,10
+ 2297              		.p2align 3
+ 2298              	.L278:
+ 2299 1e70 448B5424 		movl	36(%rsp), %r10d
+ 2299      24
+ 2300 1e75 4C89E5   		movq	%r12, %rbp
+ 2301 1e78 4989DC   		movq	%rbx, %r12
+ 2302 1e7b 488B7578 		movq	120(%rbp), %rsi
+ 2303 1e7f 4585D2   		testl	%r10d, %r10d
+ 2304 1e82 740E     		je	.L262
+ 2305 1e84 8B453C   		movl	60(%rbp), %eax
+ 2306 1e87 4401F0   		addl	%r14d, %eax
+ 2307 1e8a 99       		cltd
+ 2308 1e8b F77C2410 		idivl	16(%rsp)
+ 2309 1e8f 89553C   		movl	%edx, 60(%rbp)
+ 2310              	.L262:
+ 2311 1e92 4885F6   		testq	%rsi, %rsi
+ 2312 1e95 0F84CF00 		je	.L275
+ 2312      0000
+ 2313              	.L264:
+ 2314 1e9b C5FA1045 		vmovss	64(%rbp), %xmm0
+ 2314      40
+ 2315 1ea0 8B542414 		movl	20(%rsp), %edx
+ 2316 1ea4 4883C478 		addq	$120, %rsp
+ 2317              		.cfi_remember_state
+ 2318              		.cfi_def_cfa_offset 56
+ 2319 1ea8 4489F1   		movl	%r14d, %ecx
+ 2320 1eab 5B       		popq	%rbx
+ 2321              		.cfi_def_cfa_offset 48
+ 2322 1eac 4C89E7   		movq	%r12, %rdi
+ 2323 1eaf 5D       		popq	%rbp
+ 2324              		.cfi_def_cfa_offset 40
+ 2325 1eb0 415C     		popq	%r12
+ 2326              		.cfi_def_cfa_offset 32
+ 2327 1eb2 415D     		popq	%r13
+ 2328              		.cfi_def_cfa_offset 24
+ 2329 1eb4 415E     		popq	%r14
+ 2330              		.cfi_def_cfa_offset 16
+ 2331 1eb6 415F     		popq	%r15
+ 2332              		.cfi_def_cfa_offset 8
+ 2333 1eb8 E913F4FF 		jmp	limit
+ 2333      FF
+ 2334 1ebd 0F1F00   		.p2align 4,,10
+ 2335              		.p2align 3
+ 2336              	.L260:
+ 2337              		.cfi_restore_state
+ 2338 1ec0 E8000000 		call	memcpy@PLT
+ 2338      00
+ 2339 1ec5 488B5424 		movq	40(%rsp), %rdx
+ 2339      28
+ 2340 1eca 488B7424 		movq	8(%rsp), %rsi
+ 2340      08
+ 2341 1ecf 4C89EF   		movq	%r13, %rdi
+ 2342 1ed2 E8000000 		call	memcpy@PLT
+ 2342      00
+ 2343 1ed7 C4C17A10 		vmovss	(%r12), %xmm0
+ 2343      0424
+ 2344 1edd 498B7424 		movq	48(%r12), %rsi
+ 2344      30
+ 2345 1ee2 4489F2   		movl	%r14d, %edx
+ 2346 1ee5 C5FA104C 		vmovss	32(%rsp), %xmm1
+ 2346      2420
+ 2347 1eeb 488B4C24 		movq	88(%rsp), %rcx
+ 2347      58
+ 2348 1ef0 488B7C24 		movq	48(%rsp), %rdi
+ 2348      30
+ 2349 1ef5 E8F6E2FF 		call	lagrange_gain_and_clip_block
+ 2349      FF
+ 2350 1efa E911FDFF 		jmp	.L253
+ 2350      FF
+ 2351 1eff 90       		.p2align 4,,10
+ 2352              		.p2align 3
+ 2353              	.L259:
+ 2354 1f00 C4C17A10 		vmovss	(%r12), %xmm0
+ 2354      0424
+ 2355 1f06 C5FA104C 		vmovss	32(%rsp), %xmm1
+ 2355      2420
+ 2356 1f0c 4C89DF   		movq	%r11, %rdi
+ 2357 1f0f 8B54244C 		movl	76(%rsp), %edx
+ 2358 1f13 E888F1FF 		call	gain_and_clip_block
+ 2358      FF
+ 2359 1f18 C4C17A10 		vmovss	(%r12), %xmm0
+ 2359      0424
+ 2360 1f1e 8B542428 		movl	40(%rsp), %edx
+ 2361 1f22 4C89EF   		movq	%r13, %rdi
+ 2362 1f25 C5FA104C 		vmovss	32(%rsp), %xmm1
+ 2362      2420
+ 2363 1f2b 488B7424 		movq	8(%rsp), %rsi
+ 2363      08
+ 2364 1f30 E86BF1FF 		call	gain_and_clip_block
+ 2364      FF
+ 2365 1f35 E9D6FCFF 		jmp	.L253
+ 2365      FF
+ 2366 1f3a 660F1F44 		.p2align 4,,10
+ 2366      0000
+ 2367              		.p2align 3
+ 2368              	.L277:
+ 2369 1f40 C5FA104D 		vmovss	64(%rbp), %xmm1
+ 2369      40
+ 2370 1f45 4585D2   		testl	%r10d, %r10d
+ 2371 1f48 7436     		je	.L282
+ 2372 1f4a 8B4C2414 		movl	20(%rsp), %ecx
+ 2373 1f4e 448B5C24 		movl	16(%rsp), %r11d
+ 2373      10
+ 2374 1f53 85C9     		testl	%ecx, %ecx
+ 2375 1f55 0F8F2FFC 		jg	.L248
+ 2375      FFFF
+ 2376 1f5b 8B4D3C   		movl	60(%rbp), %ecx
+ 2377 1f5e 4401F1   		addl	%r14d, %ecx
+ 2378 1f61 89C8     		movl	%ecx, %eax
+ 2379 1f63 99       		cltd
+ 2380 1f64 41F7FB   		idivl	%r11d
+ 2381 1f67 89553C   		movl	%edx, 60(%rbp)
+ 2382              	.L275:
+ 2383 1f6a 4883C478 		addq	$120, %rsp
+ 2384              		.cfi_remember_state
+ 2385              		.cfi_def_cfa_offset 56
+ 2386 1f6e 5B       		popq	%rbx
+ 2387              		.cfi_def_cfa_offset 48
+ 2388 1f6f 5D       		popq	%rbp
+ 2389              		.cfi_def_cfa_offset 40
+ 2390 1f70 415C     		popq	%r12
+ 2391              		.cfi_def_cfa_offset 32
+ 2392 1f72 415D     		popq	%r13
+ 2393              		.cfi_def_cfa_offset 24
+ 2394 1f74 415E     		popq	%r14
+ 2395              		.cfi_def_cfa_offset 16
+ 2396 1f76 415F     		popq	%r15
+ 2397              		.cfi_def_cfa_offset 8
+ 2398 1f78 C3       		ret
+ 2399 1f79 0F1F8000 		.p2align 4,,10
+ 2399      000000
+ 2400              		.p2align 3
+ 2401              	.L282:
+ 2402              		.cfi_restore_state
+ 2403 1f80 8B742414 		movl	20(%rsp), %esi
+ 2404 1f84 4531DB   		xorl	%r11d, %r11d
+ 2405 1f87 85F6     		testl	%esi, %esi
+ 2406 1f89 0F8FFBFB 		jg	.L248
+ 2406      FFFF
+ 2407 1f8f EBD9     		jmp	.L275
+ 2408              	.L251:
+ 2409 1f91 4585D2   		testl	%r10d, %r10d
+ 2410 1f94 0F8401FF 		je	.L264
+ 2410      FFFF
+ 2411 1f9a 8B453C   		movl	60(%rbp), %eax
+ 2412 1f9d 4401F0   		addl	%r14d, %eax
+ 2413 1fa0 99       		cltd
+ 2414 1fa1 F77C2410 		idivl	16(%rsp)
+ 2415 1fa5 89553C   		movl	%edx, 60(%rbp)
+ 2416 1fa8 E9EEFEFF 		jmp	.L264
+ 2416      FF
+ 2417              		.cfi_endproc
+ 2418              	.LFE6408:
+ 2420 1fad 0F1F00   		.p2align 4
+ 2422              	gain_process_8_256:
+ 2423              	.LFB6414:
+ 2424              		.cfi_startproc
+ 2425 1fb0 4155     		pushq	%r13
+ 2426              		.cfi_def_cfa_offset 16
+ 2427              		.cfi_offset 13, -16
+ 2428 1fb2 4C8D6C24 		leaq	16(%rsp), %r13
+ 2428      10
+ 2429              		.cfi_def_cfa 13, 0
+ 2430 1fb7 4883E4C0 		andq	$-64, %rsp
+ 2431 1fbb 41FF75F8 		pushq	-8(%r13)
+ 2432 1fbf 55       		pushq	%rbp
+ 2433 1fc0 4889E5   		movq	%rsp, %rbp
+ 2434              		.cfi_escape 0x10,0x6,0x2,0x76,0
+ 2435 1fc3 4157     		pushq	%r15
+ 2436 1fc5 4156     		pushq	%r14
+ 2437 1fc7 4155     		pushq	%r13
+ 2438              		.cfi_escape 0xf,0x3,0x76,0x68,0x6
+ 2439              		.cfi_escape 0x10,0xf,0x2,0x76,0x78
+ 2440              		.cfi_escape 0x10,0xe,0x2,0x76,0x70
+ 2441 1fc9 4154     		pushq	%r12
+ 2442              		.cfi_escape 0x10,0xc,0x2,0x76,0x60
+ 2443 1fcb 4989FC   		movq	%rdi, %r12
+ 2444 1fce 53       		pushq	%rbx
+ 2445 1fcf 4881EC88 		subq	$136, %rsp
+ 2445      000000
+ 2446              		.cfi_escape 0x10,0x3,0x2,0x76,0x58
+ 2447 1fd6 81BFA400 		cmpl	$256, 164(%rdi)
+ 2447      00000001 
+ 2447      0000
+ 2448 1fe0 7547     		jne	.L284
+ 2449 1fe2 62F1FE48 		vmovdqu64	8(%rdi), %zmm5
+ 2449      6FAF0800 
+ 2449      0000
+ 2450 1fec 62F1D548 		vporq	72(%rdi), %zmm5, %zmm0
+ 2450      EB874800 
+ 2450      0000
+ 2451 1ff6 C5FD6FC8 		vmovdqa	%ymm0, %ymm1
+ 2452 1ffa 62F3FD48 		vextracti64x4	$0x1, %zmm0, %ymm0
+ 2452      3BC001
+ 2453 2001 C5F5EBC8 		vpor	%ymm0, %ymm1, %ymm1
+ 2454 2005 C5F96FC1 		vmovdqa	%xmm1, %xmm0
+ 2455 2009 62F3FD28 		vextracti64x2	$0x1, %ymm1, %xmm1
+ 2455      39C901
+ 2456 2010 C5F9EBC1 		vpor	%xmm1, %xmm0, %xmm0
+ 2457 2014 C5F173D8 		vpsrldq	$8, %xmm0, %xmm1
+ 2457      08
+ 2458 2019 C5F9EBC1 		vpor	%xmm1, %xmm0, %xmm0
+ 2459 201d C4E1F97E 		vmovq	%xmm0, %rax
+ 2459      C0
+ 2460 2022 A81F     		testb	$31, %al
+ 2461 2024 742A     		je	.L314
+ 2462 2026 C5F877   		vzeroupper
+ 2463              	.L284:
+ 2464 2029 4881C488 		addq	$136, %rsp
+ 2464      000000
+ 2465 2030 4C89E7   		movq	%r12, %rdi
+ 2466 2033 5B       		popq	%rbx
+ 2467 2034 415C     		popq	%r12
+ 2468 2036 415D     		popq	%r13
+ 2469              		.cfi_remember_state
+ 2470              		.cfi_def_cfa 13, 0
+ 2471 2038 415E     		popq	%r14
+ 2472 203a 415F     		popq	%r15
+ 2473 203c 5D       		popq	%rbp
+ 2474 203d 498D65F0 		leaq	-16(%r13), %rsp
+ 2475              		.cfi_def_cfa 7, 16
+ 2476 2041 415D     		popq	%r13
+ 2477              		.cfi_def_cfa_offset 8
+ 2478 2043 E9000000 		jmp	gain_process@PLT
+ 2478      00
+ 2479 2048 0F1F8400 		.p2align 4,,10
+ 2479      00000000 
+ 2480              		.p2align 3
+ 2481              	.L314:
+ 2482              		.cfi_restore_state
+ 2483 2050 4C8BB7C0 		movq	192(%rdi), %r14
+ 2483      000000
+ 2484 2057 BE000100 		movl	$256, %esi
+ 2484      00
+ 2485 205c 418B4614 		movl	20(%r14), %eax
+ 2486 2060 41034610 		addl	16(%r14), %eax
+ 2487 2064 458B5E38 		movl	56(%r14), %r11d
+ 2488 2068 8D78FF   		leal	-1(%rax), %edi
+ 2489 206b 8945A8   		movl	%eax, -88(%rbp)
+ 2490 206e 418B463C 		movl	60(%r14), %eax
+ 2491 2072 897DC4   		movl	%edi, -60(%rbp)
+ 2492 2075 44895DC8 		movl	%r11d, -56(%rbp)
+ 2493 2079 4401D8   		addl	%r11d, %eax
+ 2494 207c 29F8     		subl	%edi, %eax
+ 2495 207e 4C89F7   		movq	%r14, %rdi
+ 2496 2081 99       		cltd
+ 2497 2082 41F7FB   		idivl	%r11d
+ 2498 2085 4489D8   		movl	%r11d, %eax
+ 2499 2088 4863DA   		movslq	%edx, %rbx
+ 2500 208b 29D8     		subl	%ebx, %eax
+ 2501 208d 89C1     		movl	%eax, %ecx
+ 2502 208f 898564FF 		movl	%eax, -156(%rbp)
+ 2502      FFFF
+ 2503 2095 B8000100 		movl	$256, %eax
+ 2503      00
+ 2504 209a 39C1     		cmpl	%eax, %ecx
+ 2505 209c 0F4EC1   		cmovle	%ecx, %eax
+ 2506 209f 894590   		movl	%eax, -112(%rbp)
+ 2507 20a2 C5F877   		vzeroupper
+ 2508 20a5 E856DFFF 		call	gain_ramp
+ 2508      FF
+ 2509 20aa 49837E78 		cmpq	$0, 120(%r14)
+ 2509      00
+ 2510 20af 448B5DC8 		movl	-56(%rbp), %r11d
+ 2511 20b3 4989C1   		movq	%rax, %r9
+ 2512 20b6 0F849C04 		je	.L315
+ 2512      0000
+ 2513 20bc C74594FF 		movl	$2147483647, -108(%rbp)
+ 2513      FFFF7F
+ 2514 20c3 C5FA100D 		vmovss	.LC50(%rip), %xmm1
+ 2514      00000000 
+ 2515              	.L285:
+ 2516 20cb 488D049D 		leaq	0(,%rbx,4), %rax
+ 2516      00000000 
+ 2517 20d3 4C89E7   		movq	%r12, %rdi
+ 2518 20d6 31DB     		xorl	%ebx, %ebx
+ 2519 20d8 4D89F4   		movq	%r14, %r12
+ 2520 20db 48898568 		movq	%rax, -152(%rbp)
+ 2520      FFFFFF
+ 2521 20e2 48634590 		movslq	-112(%rbp), %rax
+ 2522 20e6 4D89CE   		movq	%r9, %r14
+ 2523 20e9 4531D2   		xorl	%r10d, %r10d
+ 2524 20ec C5F05715 		vxorps	.LC2(%rip), %xmm1, %xmm2
+ 2524      00000000 
+ 2525 20f4 C5FA114D 		vmovss	%xmm1, -64(%rbp)
+ 2525      C0
+ 2526 20f9 4989F9   		movq	%rdi, %r9
+ 2527 20fc 48C1E002 		salq	$2, %rax
+ 2528 2100 C4E27D18 		vbroadcastss	%xmm2, %ymm2
+ 2528      D2
+ 2529 2105 48898558 		movq	%rax, -168(%rbp)
+ 2529      FFFFFF
+ 2530 210c C5FC2995 		vmovaps	%ymm2, -144(%rbp)
+ 2530      70FFFFFF 
+ 2531 2114 EB38     		jmp	.L299
+ 2532 2116 662E0F1F 		.p2align 4,,10
+ 2532      84000000 
+ 2532      0000
+ 2533              		.p2align 3
+ 2534              	.L317:
+ 2535 2120 8B7D94   		movl	-108(%rbp), %edi
+ 2536 2123 4139BC9C 		cmpl	%edi, 128(%r12,%rbx,4)
+ 2536      80000000 
+ 2537 212b 7C49     		jl	.L286
+ 2538 212d B9800000 		movl	$128, %ecx
+ 2538      00
+ 2539 2132 31C0     		xorl	%eax, %eax
+ 2540 2134 4C89EF   		movq	%r13, %rdi
+ 2541 2137 C60201   		movb	$1, (%rdx)
+ 2542 213a F348AB   		rep stosq
+ 2543              	.L287:
+ 2544 213d 4883C301 		addq	$1, %rbx
+ 2545 2141 4501DA   		addl	%r11d, %r10d
+ 2546 2144 4883FB08 		cmpq	$8, %rbx
+ 2547 2148 0F84A100 		je	.L316
+ 2547      0000
+ 2548              	.L299:
+ 2549 214e 498B8188 		movq	136(%r9), %rax
+ 2549      000000
+ 2550 2155 498B9190 		movq	144(%r9), %rdx
+ 2550      000000
+ 2551 215c 498B74D9 		movq	8(%r9,%rbx,8), %rsi
+ 2551      08
+ 2552 2161 4D8B6CD9 		movq	72(%r9,%rbx,8), %r13
+ 2552      48
+ 2553 2166 4801D8   		addq	%rbx, %rax
+ 2554 2169 4801DA   		addq	%rbx, %rdx
+ 2555 216c 498B4C24 		movq	40(%r12), %rcx
+ 2555      28
+ 2556 2171 803800   		cmpb	$0, (%rax)
+ 2557 2174 75AA     		jne	.L317
+ 2558              	.L286:
+ 2559 2176 C60200   		movb	$0, (%rdx)
+ 2560 2179 803800   		cmpb	$0, (%rax)
+ 2561 217c 0F85CE00 		jne	.L288
+ 2561      0000
+ 2562 2182 41C7849C 		movl	$0, 128(%r12,%rbx,4)
+ 2562      80000000 
+ 2562      00000000 
+ 2563              	.L289:
+ 2564 218e 8B55C4   		movl	-60(%rbp), %edx
+ 2565 2191 85D2     		testl	%edx, %edx
+ 2566 2193 0F85E000 		jne	.L290
+ 2566      0000
+ 2567              	.L318:
+ 2568 2199 C4E27D18 		vbroadcastss	-64(%rbp), %ymm3
+ 2568      5DC0
+ 2569 219f 4D85F6   		testq	%r14, %r14
+ 2570 21a2 0F84C802 		je	.L291
+ 2570      0000
+ 2571 21a8 C5FC2895 		vmovaps	-144(%rbp), %ymm2
+ 2571      70FFFFFF 
+ 2572 21b0 31C0     		xorl	%eax, %eax
+ 2573              		.p2align 4,,10
+ 2574 21b2 660F1F44 		.p2align 3
+ 2574      0000
+ 2575              	.L292:
+ 2576 21b8 C4C17C10 		vmovups	(%r14,%rax), %ymm6
+ 2576      3406
+ 2577 21be C5CC5904 		vmulps	(%rsi,%rax), %ymm6, %ymm0
+ 2577      06
+ 2578 21c3 C5FC5DC3 		vminps	%ymm3, %ymm0, %ymm0
+ 2579 21c7 C5FC5FC2 		vmaxps	%ymm2, %ymm0, %ymm0
+ 2580 21cb C4C17C29 		vmovaps	%ymm0, 0(%r13,%rax)
+ 2580      440500
+ 2581 21d2 4883C020 		addq	$32, %rax
+ 2582 21d6 483D0004 		cmpq	$1024, %rax
+ 2582      0000
+ 2583 21dc 75DA     		jne	.L292
+ 2584 21de 4883C301 		addq	$1, %rbx
+ 2585 21e2 4501DA   		addl	%r11d, %r10d
+ 2586 21e5 4883FB08 		cmpq	$8, %rbx
+ 2587 21e9 0F855FFF 		jne	.L299
+ 2587      FFFF
+ 2588              	.L316:
+ 2589 21ef 8B45C4   		movl	-60(%rbp), %eax
+ 2590 21f2 4D89E6   		movq	%r12, %r14
+ 2591 21f5 4D89CC   		movq	%r9, %r12
+ 2592 21f8 85C0     		testl	%eax, %eax
+ 2593 21fa 7411     		je	.L300
+ 2594 21fc 418B463C 		movl	60(%r14), %eax
+ 2595 2200 05000100 		addl	$256, %eax
+ 2595      00
+ 2596 2205 99       		cltd
+ 2597 2206 41F7FB   		idivl	%r11d
+ 2598 2209 4189563C 		movl	%edx, 60(%r14)
+ 2599              	.L300:
+ 2600 220d 498B7678 		movq	120(%r14), %rsi
+ 2601 2211 4885F6   		testq	%rsi, %rsi
+ 2602 2214 0F841E03 		je	.L312
+ 2602      0000
+ 2603 221a C4C17A10 		vmovss	64(%r14), %xmm0
+ 2603      4640
+ 2604 2220 C5F877   		vzeroupper
+ 2605 2223 4C89E7   		movq	%r12, %rdi
+ 2606 2226 4881C488 		addq	$136, %rsp
+ 2606      000000
+ 2607 222d 5B       		popq	%rbx
+ 2608 222e 415C     		popq	%r12
+ 2609 2230 B9000100 		movl	$256, %ecx
+ 2609      00
+ 2610 2235 BA080000 		movl	$8, %edx
+ 2610      00
+ 2611 223a 415D     		popq	%r13
+ 2612              		.cfi_remember_state
+ 2613              		.cfi_def_cfa 13, 0
+ 2614 223c 415E     		popq	%r14
+ 2615 223e 415F     		popq	%r15
+ 2616 2240 5D       		popq	%rbp
+ 2617 2241 498D65F0 		leaq	-16(%r13), %rsp
+ 2618              		.cfi_def_cfa 7, 16
+ 2619 2245 415D     		popq	%r13
+ 2620              		.cfi_def_cfa_offset 8
+ 2621 2247 E984F0FF 		jmp	limit
+ 2621      FF
+ 2622 224c 0F1F4000 		.p2align 4,,10
+ 2623              		.p2align 3
+ 2624              	.L288:
+ 2625              		.cfi_restore_state
+ 2626 2250 418B849C 		movl	128(%r12,%rbx,4), %eax
+ 2626      80000000 
+ 2627 2258 4139C3   		cmpl	%eax, %r11d
+ 2628 225b 0F8E2DFF 		jle	.L289
+ 2628      FFFF
+ 2629 2261 8B55C4   		movl	-60(%rbp), %edx
+ 2630 2264 05000100 		addl	$256, %eax
+ 2630      00
+ 2631 2269 4189849C 		movl	%eax, 128(%r12,%rbx,4)
+ 2631      80000000 
+ 2632 2271 85D2     		testl	%edx, %edx
+ 2633 2273 0F8420FF 		je	.L318
+ 2633      FFFF
+ 2634              	.L290:
+ 2635 2279 4963C2   		movslq	%r10d, %rax
+ 2636 227c 4589DF   		movl	%r11d, %r15d
+ 2637 227f BA000100 		movl	$256, %edx
+ 2637      00
+ 2638 2284 4C894D98 		movq	%r9, -104(%rbp)
+ 2639 2288 488D0C81 		leaq	(%rcx,%rax,4), %rcx
+ 2640 228c 49634424 		movslq	60(%r12), %rax
+ 2640      3C
+ 2641 2291 448955A0 		movl	%r10d, -96(%rbp)
+ 2642 2295 44895DAC 		movl	%r11d, -84(%rbp)
+ 2643 2299 4129C7   		subl	%eax, %r15d
+ 2644 229c 48894DC8 		movq	%rcx, -56(%rbp)
+ 2645 22a0 488D3C81 		leaq	(%rcx,%rax,4), %rdi
+ 2646 22a4 4139D7   		cmpl	%edx, %r15d
+ 2647 22a7 488975B8 		movq	%rsi, -72(%rbp)
+ 2648 22ab 440F4FFA 		cmovg	%edx, %r15d
+ 2649 22af 4963D7   		movslq	%r15d, %rdx
+ 2650 22b2 4C8D0495 		leaq	0(,%rdx,4), %r8
+ 2650      00000000 
+ 2651 22ba 4C8945B0 		movq	%r8, -80(%rbp)
+ 2652 22be 4C89C2   		movq	%r8, %rdx
+ 2653 22c1 C5F877   		vzeroupper
+ 2654 22c4 E8000000 		call	memcpy@PLT
+ 2654      00
+ 2655 22c9 488B75B8 		movq	-72(%rbp), %rsi
+ 2656 22cd 4C8B45B0 		movq	-80(%rbp), %r8
+ 2657 22d1 B8000100 		movl	$256, %eax
+ 2657      00
+ 2658 22d6 488B7DC8 		movq	-56(%rbp), %rdi
+ 2659 22da 4429F8   		subl	%r15d, %eax
+ 2660 22dd 4C01C6   		addq	%r8, %rsi
+ 2661 22e0 4898     		cltq
+ 2662 22e2 488D1485 		leaq	0(,%rax,4), %rdx
+ 2662      00000000 
+ 2663 22ea E8000000 		call	memcpy@PLT
+ 2663      00
+ 2664 22ef 488B45C8 		movq	-56(%rbp), %rax
+ 2665 22f3 488BBD68 		movq	-152(%rbp), %rdi
+ 2665      FFFFFF
+ 2666 22fa B9000100 		movl	$256, %ecx
+ 2666      00
+ 2667 22ff 41837C24 		cmpl	$1, 20(%r12)
+ 2667      1401
+ 2668 2305 448B5DAC 		movl	-84(%rbp), %r11d
+ 2669 2309 448B55A0 		movl	-96(%rbp), %r10d
+ 2670 230d 4C8B4D98 		movq	-104(%rbp), %r9
+ 2671 2311 488D3438 		leaq	(%rax,%rdi), %rsi
+ 2672 2315 0F84E500 		je	.L319
+ 2672      0000
+ 2673 231b 8B45A8   		movl	-88(%rbp), %eax
+ 2674 231e 498B7C24 		movq	48(%r12), %rdi
+ 2674      30
+ 2675 2323 498D4C24 		leaq	24(%r12), %rcx
+ 2675      18
+ 2676 2328 4C894D98 		movq	%r9, -104(%rbp)
+ 2677 232c 448955A0 		movl	%r10d, -96(%rbp)
+ 2678 2330 448DB8FF 		leal	255(%rax), %r15d
+ 2678      000000
+ 2679 2337 8B8564FF 		movl	-156(%rbp), %eax
+ 2679      FFFF
+ 2680 233d 452B7C24 		subl	16(%r12), %r15d
+ 2680      10
+ 2681 2342 44895DAC 		movl	%r11d, -84(%rbp)
+ 2682 2346 48894DB0 		movq	%rcx, -80(%rbp)
+ 2683 234a 4439F8   		cmpl	%r15d, %eax
+ 2684 234d 410F4FC7 		cmovg	%r15d, %eax
+ 2685 2351 4129C7   		subl	%eax, %r15d
+ 2686 2354 4863D0   		movslq	%eax, %rdx
+ 2687 2357 4D63FF   		movslq	%r15d, %r15
+ 2688 235a 48C1E202 		salq	$2, %rdx
+ 2689 235e 4A8D04BD 		leaq	0(,%r15,4), %rax
+ 2689      00000000 
+ 2690 2366 4C8D3C17 		leaq	(%rdi,%rdx), %r15
+ 2691 236a 488945B8 		movq	%rax, -72(%rbp)
+ 2692 236e 4D85F6   		testq	%r14, %r14
+ 2693 2371 0F843101 		je	.L297
+ 2693      0000
+ 2694 2377 E8000000 		call	memcpy@PLT
+ 2694      00
+ 2695 237c 488B55B8 		movq	-72(%rbp), %rdx
+ 2696 2380 488B75C8 		movq	-56(%rbp), %rsi
+ 2697 2384 4C89FF   		movq	%r15, %rdi
+ 2698 2387 E8000000 		call	memcpy@PLT
+ 2698      00
+ 2699 238c 498B7424 		movq	48(%r12), %rsi
+ 2699      30
+ 2700 2391 488B4DB0 		movq	-80(%rbp), %rcx
+ 2701 2395 4C89EF   		movq	%r13, %rdi
+ 2702 2398 C5FA100D 		vmovss	.LC50(%rip), %xmm1
+ 2702      00000000 
+ 2703 23a0 BA000100 		movl	$256, %edx
+ 2703      00
+ 2704 23a5 C5FA1005 		vmovss	.LC22(%rip), %xmm0
+ 2704      00000000 
+ 2705 23ad E83EDEFF 		call	lagrange_gain_and_clip_block
+ 2705      FF
+ 2706 23b2 448B5DAC 		movl	-84(%rbp), %r11d
+ 2707 23b6 448B55A0 		movl	-96(%rbp), %r10d
+ 2708 23ba 31C0     		xorl	%eax, %eax
+ 2709 23bc C4E27D18 		vbroadcastss	-64(%rbp), %ymm3
+ 2709      5DC0
+ 2710 23c2 4C8B4D98 		movq	-104(%rbp), %r9
+ 2711 23c6 C5FC2895 		vmovaps	-144(%rbp), %ymm2
+ 2711      70FFFFFF 
+ 2712 23ce 6690     		.p2align 4,,10
+ 2713              		.p2align 3
+ 2714              	.L298:
+ 2715 23d0 C4C17C10 		vmovups	(%r14,%rax), %ymm7
+ 2715      3C06
+ 2716 23d6 C4C14459 		vmulps	0(%r13,%rax), %ymm7, %ymm0
+ 2716      440500
+ 2717 23dd C5FC5DC3 		vminps	%ymm3, %ymm0, %ymm0
+ 2718 23e1 C5FC5FC2 		vmaxps	%ymm2, %ymm0, %ymm0
+ 2719 23e5 C4C17C29 		vmovaps	%ymm0, 0(%r13,%rax)
+ 2719      440500
+ 2720 23ec 4883C020 		addq	$32, %rax
+ 2721 23f0 483D0004 		cmpq	$1024, %rax
+ 2721      0000
+ 2722 23f6 75D8     		jne	.L298
+ 2723 23f8 E940FDFF 		jmp	.L287
+ 2723      FF
+ 2724 23fd 0F1F00   		.p2align 4,,10
+ 2725              		.p2align 3
+ 2726              	.L319:
+ 2727 2400 8B4590   		movl	-112(%rbp), %eax
+ 2728 2403 488BBD58 		movq	-168(%rbp), %rdi
+ 2728      FFFFFF
+ 2729 240a 4C894DA0 		movq	%r9, -96(%rbp)
+ 2730 240e 448955AC 		movl	%r10d, -84(%rbp)
+ 2731 2412 29C1     		subl	%eax, %ecx
+ 2732 2414 44895DB0 		movl	%r11d, -80(%rbp)
+ 2733 2418 4D8D7C3D 		leaq	0(%r13,%rdi), %r15
+ 2733      00
+ 2734 241d 894DB8   		movl	%ecx, -72(%rbp)
+ 2735 2420 4D85F6   		testq	%r14, %r14
+ 2736 2423 0F84C700 		je	.L296
+ 2736      0000
+ 2737 2429 C5FA1045 		vmovss	-64(%rbp), %xmm0
+ 2737      C0
+ 2738 242e 89C2     		movl	%eax, %edx
+ 2739 2430 4C89F1   		movq	%r14, %rcx
+ 2740 2433 4C89EF   		movq	%r13, %rdi
+ 2741 2436 E875EDFF 		call	ramp_and_clip_block
+ 2741      FF
+ 2742 243b 488BBD58 		movq	-168(%rbp), %rdi
+ 2742      FFFFFF
+ 2743 2442 C5FA1045 		vmovss	-64(%rbp), %xmm0
+ 2743      C0
+ 2744 2447 8B55B8   		movl	-72(%rbp), %edx
+ 2745 244a 488B75C8 		movq	-56(%rbp), %rsi
+ 2746 244e 498D0C3E 		leaq	(%r14,%rdi), %rcx
+ 2747 2452 4C89FF   		movq	%r15, %rdi
+ 2748 2455 E856EDFF 		call	ramp_and_clip_block
+ 2748      FF
+ 2749 245a 448B5DB0 		movl	-80(%rbp), %r11d
+ 2750 245e 448B55AC 		movl	-84(%rbp), %r10d
+ 2751 2462 4C8B4DA0 		movq	-96(%rbp), %r9
+ 2752 2466 E9D2FCFF 		jmp	.L287
+ 2752      FF
+ 2753 246b 0F1F4400 		.p2align 4,,10
+ 2753      00
+ 2754              		.p2align 3
+ 2755              	.L291:
+ 2756 2470 C4C27D18 		vbroadcastss	(%r12), %ymm4
+ 2756      2424
+ 2757 2476 31C0     		xorl	%eax, %eax
+ 2758 2478 C5FC2895 		vmovaps	-144(%rbp), %ymm2
+ 2758      70FFFFFF 
+ 2759              		.p2align 4,,10
+ 2760              		.p2align 3
+ 2761              	.L293:
+ 2762 2480 C5DC5904 		vmulps	(%rsi,%rax), %ymm4, %ymm0
+ 2762      06
+ 2763 2485 C5FC5DC3 		vminps	%ymm3, %ymm0, %ymm0
+ 2764 2489 C5FC5FC2 		vmaxps	%ymm2, %ymm0, %ymm0
+ 2765 248d C4C17C29 		vmovaps	%ymm0, 0(%r13,%rax)
+ 2765      440500
+ 2766 2494 4883C020 		addq	$32, %rax
+ 2767 2498 483D0004 		cmpq	$1024, %rax
+ 2767      0000
+ 2768 249e 75E0     		jne	.L293
+ 2769 24a0 E998FCFF 		jmp	.L287
+ 2769      FF
+ 2770              		.p2align 4,,10
+ 2771 24a5 0F1F00   		.p2align 3
+ 2772              	.L297:
+ 2773 24a8 E8000000 		call	memcpy@PLT
+ 2773      00
+ 2774 24ad 488B55B8 		movq	-72(%rbp), %rdx
+ 2775 24b1 488B75C8 		movq	-56(%rbp), %rsi
+ 2776 24b5 4C89FF   		movq	%r15, %rdi
+ 2777 24b8 E8000000 		call	memcpy@PLT
+ 2777      00
+ 2778 24bd C4C17A10 		vmovss	(%r12), %xmm0
+ 2778      0424
+ 2779 24c3 488B4DB0 		movq	-80(%rbp), %rcx
+ 2780 24c7 4C89EF   		movq	%r13, %rdi
+ 2781 24ca 498B7424 		movq	48(%r12), %rsi
+ 2781      30
+ 2782 24cf C5FA104D 		vmovss	-64(%rbp), %xmm1
+ 2782      C0
+ 2783 24d4 BA000100 		movl	$256, %edx
+ 2783      00
+ 2784 24d9 E812DDFF 		call	lagrange_gain_and_clip_block
+ 2784      FF
+ 2785 24de 4C8B4D98 		movq	-104(%rbp), %r9
+ 2786 24e2 448B55A0 		movl	-96(%rbp), %r10d
+ 2787 24e6 448B5DAC 		movl	-84(%rbp), %r11d
+ 2788 24ea E94EFCFF 		jmp	.L287
+ 2788      FF
+ 2789 24ef 90       		.p2align 4,,10
+ 2790              		.p2align 3
+ 2791              	.L296:
+ 2792 24f0 C4C17A10 		vmovss	(%r12), %xmm0
+ 2792      0424
+ 2793 24f6 C5FA104D 		vmovss	-64(%rbp), %xmm1
+ 2793      C0
+ 2794 24fb 4C89EF   		movq	%r13, %rdi
+ 2795 24fe 8B5590   		movl	-112(%rbp), %edx
+ 2796 2501 E89AEBFF 		call	gain_and_clip_block
+ 2796      FF
+ 2797 2506 8B55B8   		movl	-72(%rbp), %edx
+ 2798 2509 488B75C8 		movq	-56(%rbp), %rsi
+ 2799 250d 4C89FF   		movq	%r15, %rdi
+ 2800 2510 C4C17A10 		vmovss	(%r12), %xmm0
+ 2800      0424
+ 2801 2516 C5FA104D 		vmovss	-64(%rbp), %xmm1
+ 2801      C0
+ 2802 251b E880EBFF 		call	gain_and_clip_block
+ 2802      FF
+ 2803 2520 448B5DB0 		movl	-80(%rbp), %r11d
+ 2804 2524 448B55AC 		movl	-84(%rbp), %r10d
+ 2805 2528 4C8B4DA0 		movq	-96(%rbp), %r9
+ 2806 252c E90CFCFF 		jmp	.L287
+ 2806      FF
+ 2807              		.p2align 4,,10
+ 2808 2531 0F1F8000 		.p2align 3
+ 2808      000000
+ 2809              	.L312:
+ 2810 2538 C5F877   		vzeroupper
+ 2811 253b 4881C488 		addq	$136, %rsp
+ 2811      000000
+ 2812 2542 5B       		popq	%rbx
+ 2813 2543 415C     		popq	%r12
+ 2814 2545 415D     		popq	%r13
+ 2815              		.cfi_remember_state
+ 2816              		.cfi_def_cfa 13, 0
+ 2817 2547 415E     		popq	%r14
+ 2818 2549 415F     		popq	%r15
+ 2819 254b 5D       		popq	%rbp
+ 2820 254c 498D65F0 		leaq	-16(%r13), %rsp
+ 2821              		.cfi_def_cfa 7, 16
+ 2822 2550 415D     		popq	%r13
+ 2823              		.cfi_def_cfa_offset 8
+ 2824 2552 C3       		ret
+ 2825              		.p2align 4,,10
+ 2826 2553 0F1F4400 		.p2align 3
+ 2826      00
+ 2827              	.L315:
+ 2828              		.cfi_restore_state
+ 2829 2558 8B4DC4   		movl	-60(%rbp), %ecx
+ 2830 255b 31C0     		xorl	%eax, %eax
+ 2831 255d C4C17A10 		vmovss	64(%r14), %xmm1
+ 2831      4E40
+ 2832 2563 85C9     		testl	%ecx, %ecx
+ 2833 2565 410F45C3 		cmovne	%r11d, %eax
+ 2834 2569 894594   		movl	%eax, -108(%rbp)
+ 2835 256c E95AFBFF 		jmp	.L285
+ 2835      FF
+ 2836              		.cfi_endproc
+ 2837              	.LFE6414:
+ 2839 2571 66662E0F 		.p2align 4
+ 2839      1F840000 
+ 2839      0000000F 
+ 2839      1F4000
+ 2841              	gain_process_8_64:
+ 2842              	.LFB6412:
+ 2843              		.cfi_startproc
+ 2844 2580 4155     		pushq	%r13
+ 2845              		.cfi_def_cfa_offset 16
+ 2846              		.cfi_offset 13, -16
+ 2847 2582 4C8D6C24 		leaq	16(%rsp), %r13
+ 2847      10
+ 2848              		.cfi_def_cfa 13, 0
+ 2849 2587 4883E4C0 		andq	$-64, %rsp
+ 2850 258b 41FF75F8 		pushq	-8(%r13)
+ 2851 258f 55       		pushq	%rbp
+ 2852 2590 4889E5   		movq	%rsp, %rbp
+ 2853              		.cfi_escape 0x10,0x6,0x2,0x76,0
+ 2854 2593 4157     		pushq	%r15
+ 2855 2595 4156     		pushq	%r14
+ 2856              		.cfi_escape 0x10,0xf,0x2,0x76,0x78
+ 2857              		.cfi_escape 0x10,0xe,0x2,0x76,0x70
+ 2858 2597 4989FE   		movq	%rdi, %r14
+ 2859 259a 4155     		pushq	%r13
+ 2860              		.cfi_escape 0xf,0x3,0x76,0x68,0x6
+ 2861 259c 4154     		pushq	%r12
+ 2862 259e 53       		pushq	%rbx
+ 2863 259f 4881EC88 		subq	$136, %rsp
+ 2863      000000
+ 2864              		.cfi_escape 0x10,0xc,0x2,0x76,0x60
+ 2865              		.cfi_escape 0x10,0x3,0x2,0x76,0x58
+ 2866 25a6 83BFA400 		cmpl	$64, 164(%rdi)
+ 2866      000040
+ 2867 25ad 7547     		jne	.L321
+ 2868 25af 62F1FE48 		vmovdqu64	8(%rdi), %zmm5
+ 2868      6FAF0800 
+ 2868      0000
+ 2869 25b9 62F1D548 		vporq	72(%rdi), %zmm5, %zmm0
+ 2869      EB874800 
+ 2869      0000
+ 2870 25c3 C5FD6FC8 		vmovdqa	%ymm0, %ymm1
+ 2871 25c7 62F3FD48 		vextracti64x4	$0x1, %zmm0, %ymm0
+ 2871      3BC001
+ 2872 25ce C5F5EBC8 		vpor	%ymm0, %ymm1, %ymm1
+ 2873 25d2 C5F96FC1 		vmovdqa	%xmm1, %xmm0
+ 2874 25d6 62F3FD28 		vextracti64x2	$0x1, %ymm1, %xmm1
+ 2874      39C901
+ 2875 25dd C5F9EBC1 		vpor	%xmm1, %xmm0, %xmm0
+ 2876 25e1 C5F173D8 		vpsrldq	$8, %xmm0, %xmm1
+ 2876      08
+ 2877 25e6 C5F9EBC1 		vpor	%xmm1, %xmm0, %xmm0
+ 2878 25ea C4E1F97E 		vmovq	%xmm0, %rax
+ 2878      C0
+ 2879 25ef A81F     		testb	$31, %al
+ 2880 25f1 7425     		je	.L351
+ 2881 25f3 C5F877   		vzeroupper
+ 2882              	.L321:
+ 2883 25f6 4881C488 		addq	$136, %rsp
+ 2883      000000
+ 2884 25fd 4C89F7   		movq	%r14, %rdi
+ 2885 2600 5B       		popq	%rbx
+ 2886 2601 415C     		popq	%r12
+ 2887 2603 415D     		popq	%r13
+ 2888              		.cfi_remember_state
+ 2889              		.cfi_def_cfa 13, 0
+ 2890 2605 415E     		popq	%r14
+ 2891 2607 415F     		popq	%r15
+ 2892 2609 5D       		popq	%rbp
+ 2893 260a 498D65F0 		leaq	-16(%r13), %rsp
+ 2894              		.cfi_def_cfa 7, 16
+ 2895 260e 415D     		popq	%r13
+ 2896              		.cfi_def_cfa_offset 8
+ 2897 2610 E9000000 		jmp	gain_process@PLT
+ 2897      00
+ 2898              		.p2align 4,,10
+ 2899 2615 0F1F00   		.p2align 3
+ 2900              	.L351:
+ 2901              		.cfi_restore_state
+ 2902 2618 4C8B97C0 		movq	192(%rdi), %r10
+ 2902      000000
+ 2903 261f BE400000 		movl	$64, %esi
+ 2903      00
+ 2904 2624 418B4214 		movl	20(%r10), %eax
+ 2905 2628 41034210 		addl	16(%r10), %eax
+ 2906 262c 4C8955C8 		movq	%r10, -56(%rbp)
+ 2907 2630 458B5A38 		movl	56(%r10), %r11d
+ 2908 2634 8D78FF   		leal	-1(%rax), %edi
+ 2909 2637 8945A8   		movl	%eax, -88(%rbp)
+ 2910 263a 418B423C 		movl	60(%r10), %eax
+ 2911 263e 897DC4   		movl	%edi, -60(%rbp)
+ 2912 2641 44895DC0 		movl	%r11d, -64(%rbp)
+ 2913 2645 4401D8   		addl	%r11d, %eax
+ 2914 2648 29F8     		subl	%edi, %eax
+ 2915 264a 4C89D7   		movq	%r10, %rdi
+ 2916 264d 99       		cltd
+ 2917 264e 41F7FB   		idivl	%r11d
+ 2918 2651 4489D8   		movl	%r11d, %eax
+ 2919 2654 4863DA   		movslq	%edx, %rbx
+ 2920 2657 29D8     		subl	%ebx, %eax
+ 2921 2659 89C1     		movl	%eax, %ecx
+ 2922 265b 898564FF 		movl	%eax, -156(%rbp)
+ 2922      FFFF
+ 2923 2661 B8400000 		movl	$64, %eax
+ 2923      00
+ 2924 2666 39C1     		cmpl	%eax, %ecx
+ 2925 2668 0F4EC1   		cmovle	%ecx, %eax
+ 2926 266b 894590   		movl	%eax, -112(%rbp)
+ 2927 266e C5F877   		vzeroupper
+ 2928 2671 E88AD9FF 		call	gain_ramp
+ 2928      FF
+ 2929 2676 4C8B55C8 		movq	-56(%rbp), %r10
+ 2930 267a 448B5DC0 		movl	-64(%rbp), %r11d
+ 2931 267e 4989C1   		movq	%rax, %r9
+ 2932 2681 49837A78 		cmpq	$0, 120(%r10)
+ 2932      00
+ 2933 2686 0F84A404 		je	.L352
+ 2933      0000
+ 2934 268c C74594FF 		movl	$2147483647, -108(%rbp)
+ 2934      FFFF7F
+ 2935 2693 C5FA100D 		vmovss	.LC50(%rip), %xmm1
+ 2935      00000000 
+ 2936              	.L322:
+ 2937 269b 4C89F7   		movq	%r14, %rdi
+ 2938 269e 4531E4   		xorl	%r12d, %r12d
+ 2939 26a1 4D89CE   		movq	%r9, %r14
+ 2940 26a4 4531C0   		xorl	%r8d, %r8d
+ 2941 26a7 488D049D 		leaq	0(,%rbx,4), %rax
+ 2941      00000000 
+ 2942 26af 4D89D7   		movq	%r10, %r15
+ 2943 26b2 4989F9   		movq	%rdi, %r9
+ 2944 26b5 C5FA114D 		vmovss	%xmm1, -64(%rbp)
+ 2944      C0
+ 2945 26ba 48898568 		movq	%rax, -152(%rbp)
+ 2945      FFFFFF
+ 2946 26c1 48634590 		movslq	-112(%rbp), %rax
+ 2947 26c5 C5F05715 		vxorps	.LC2(%rip), %xmm1, %xmm2
+ 2947      00000000 
+ 2948 26cd 48C1E002 		salq	$2, %rax
+ 2949 26d1 C4E27D18 		vbroadcastss	%xmm2, %ymm2
+ 2949      D2
+ 2950 26d6 48898558 		movq	%rax, -168(%rbp)
+ 2950      FFFFFF
+ 2951 26dd C5FC2995 		vmovaps	%ymm2, -144(%rbp)
+ 2951      70FFFFFF 
+ 2952 26e5 EB49     		jmp	.L336
+ 2953 26e7 660F1F84 		.p2align 4,,10
+ 2953      00000000 
+ 2953      00
+ 2954              		.p2align 3
+ 2955              	.L354:
+ 2956 26f0 8B7D94   		movl	-108(%rbp), %edi
+ 2957 26f3 4339BCA7 		cmpl	%edi, 128(%r15,%r12,4)
+ 2957      80000000 
+ 2958 26fb 7C5A     		jl	.L323
+ 2959 26fd C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 2960 2701 C60201   		movb	$1, (%rdx)
+ 2961 2704 62F17F48 		vmovdqu8	%zmm0, (%rbx)
+ 2961      7F03
+ 2962 270a 62F17F48 		vmovdqu8	%zmm0, 64(%rbx)
+ 2962      7F4301
+ 2963 2711 62F17F48 		vmovdqu8	%zmm0, 128(%rbx)
+ 2963      7F4302
+ 2964 2718 62F17F48 		vmovdqu8	%zmm0, 192(%rbx)
+ 2964      7F4303
+ 2965              	.L324:
+ 2966 271f 4983C401 		addq	$1, %r12
+ 2967 2723 4501D8   		addl	%r11d, %r8d
+ 2968 2726 4983FC08 		cmpq	$8, %r12
+ 2969 272a 0F849D00 		je	.L353
+ 2969      0000
+ 2970              	.L336:
+ 2971 2730 498B8188 		movq	136(%r9), %rax
+ 2971      000000
+ 2972 2737 498B9190 		movq	144(%r9), %rdx
+ 2972      000000
+ 2973 273e 4B8B74E1 		movq	8(%r9,%r12,8), %rsi
+ 2973      08
+ 2974 2743 4B8B5CE1 		movq	72(%r9,%r12,8), %rbx
+ 2974      48
+ 2975 2748 4C01E0   		addq	%r12, %rax
+ 2976 274b 4C01E2   		addq	%r12, %rdx
+ 2977 274e 498B4F28 		movq	40(%r15), %rcx
+ 2978 2752 803800   		cmpb	$0, (%rax)
+ 2979 2755 7599     		jne	.L354
+ 2980              	.L323:
+ 2981 2757 C60200   		movb	$0, (%rdx)
+ 2982 275a 803800   		cmpb	$0, (%rax)
+ 2983 275d 0F85CD00 		jne	.L325
+ 2983      0000
+ 2984 2763 43C784A7 		movl	$0, 128(%r15,%r12,4)
+ 2984      80000000 
+ 2984      00000000 
+ 2985              	.L326:
+ 2986 276f 8B55C4   		movl	-60(%rbp), %edx
+ 2987 2772 85D2     		testl	%edx, %edx
+ 2988 2774 0F85DD00 		jne	.L327
+ 2988      0000
+ 2989              	.L355:
+ 2990 277a C4E27D18 		vbroadcastss	-64(%rbp), %ymm3
+ 2990      5DC0
+ 2991 2780 4D85F6   		testq	%r14, %r14
+ 2992 2783 0F84BF02 		je	.L328
+ 2992      0000
+ 2993 2789 C5FC2895 		vmovaps	-144(%rbp), %ymm2
+ 2993      70FFFFFF 
+ 2994 2791 31C0     		xorl	%eax, %eax
+ 2995              		.p2align 4,,10
+ 2996 2793 0F1F4400 		.p2align 3
+ 2996      00
+ 2997              	.L329:
+ 2998 2798 C4C17C10 		vmovups	(%r14,%rax), %ymm6
+ 2998      3406
+ 2999 279e C5CC5904 		vmulps	(%rsi,%rax), %ymm6, %ymm0
+ 2999      06
+ 3000 27a3 C5FC5DC3 		vminps	%ymm3, %ymm0, %ymm0
+ 3001 27a7 C5FC5FC2 		vmaxps	%ymm2, %ymm0, %ymm0
+ 3002 27ab C5FC2904 		vmovaps	%ymm0, (%rbx,%rax)
+ 3002      03
+ 3003 27b0 4883C020 		addq	$32, %rax
+ 3004 27b4 483D0001 		cmpq	$256, %rax
+ 3004      0000
+ 3005 27ba 75DC     		jne	.L329
+ 3006 27bc 4983C401 		addq	$1, %r12
+ 3007 27c0 4501D8   		addl	%r11d, %r8d
+ 3008 27c3 4983FC08 		cmpq	$8, %r12
+ 3009 27c7 0F8563FF 		jne	.L336
+ 3009      FFFF
+ 3010              	.L353:
+ 3011 27cd 8B45C4   		movl	-60(%rbp), %eax
+ 3012 27d0 4D89FA   		movq	%r15, %r10
+ 3013 27d3 4D89CE   		movq	%r9, %r14
+ 3014 27d6 85C0     		testl	%eax, %eax
+ 3015 27d8 740F     		je	.L337
+ 3016 27da 418B473C 		movl	60(%r15), %eax
+ 3017 27de 83C040   		addl	$64, %eax
+ 3018 27e1 99       		cltd
+ 3019 27e2 41F7FB   		idivl	%r11d
+ 3020 27e5 4189573C 		movl	%edx, 60(%r15)
+ 3021              	.L337:
+ 3022 27e9 498B7278 		movq	120(%r10), %rsi
+ 3023 27ed 4885F6   		testq	%rsi, %rsi
+ 3024 27f0 0F841A03 		je	.L349
+ 3024      0000
+ 3025 27f6 C4C17A10 		vmovss	64(%r10), %xmm0
+ 3025      4240
+ 3026 27fc C5F877   		vzeroupper
+ 3027 27ff 4C89F7   		movq	%r14, %rdi
+ 3028 2802 4881C488 		addq	$136, %rsp
+ 3028      000000
+ 3029 2809 5B       		popq	%rbx
+ 3030 280a 415C     		popq	%r12
+ 3031 280c B9400000 		movl	$64, %ecx
+ 3031      00
+ 3032 2811 BA080000 		movl	$8, %edx
+ 3032      00
+ 3033 2816 415D     		popq	%r13
+ 3034              		.cfi_remember_state
+ 3035              		.cfi_def_cfa 13, 0
+ 3036 2818 415E     		popq	%r14
+ 3037 281a 415F     		popq	%r15
+ 3038 281c 5D       		popq	%rbp
+ 3039 281d 498D65F0 		leaq	-16(%r13), %rsp
+ 3040              		.cfi_def_cfa 7, 16
+ 3041 2821 415D     		popq	%r13
+ 3042              		.cfi_def_cfa_offset 8
+ 3043 2823 E9A8EAFF 		jmp	limit
+ 3043      FF
+ 3044 2828 0F1F8400 		.p2align 4,,10
+ 3044      00000000 
+ 3045              		.p2align 3
+ 3046              	.L325:
+ 3047              		.cfi_restore_state
+ 3048 2830 438B84A7 		movl	128(%r15,%r12,4), %eax
+ 3048      80000000 
+ 3049 2838 4139C3   		cmpl	%eax, %r11d
+ 3050 283b 0F8E2EFF 		jle	.L326
+ 3050      FFFF
+ 3051 2841 8B55C4   		movl	-60(%rbp), %edx
+ 3052 2844 83C040   		addl	$64, %eax
+ 3053 2847 438984A7 		movl	%eax, 128(%r15,%r12,4)
+ 3053      80000000 
+ 3054 284f 85D2     		testl	%edx, %edx
+ 3055 2851 0F8423FF 		je	.L355
+ 3055      FFFF
+ 3056              	.L327:
+ 3057 2857 4963C0   		movslq	%r8d, %rax
+ 3058 285a 4589DD   		movl	%r11d, %r13d
+ 3059 285d BA400000 		movl	$64, %edx
+ 3059      00
+ 3060 2862 4C894D98 		movq	%r9, -104(%rbp)
+ 3061 2866 488D0C81 		leaq	(%rcx,%rax,4), %rcx
+ 3062 286a 4963473C 		movslq	60(%r15), %rax
+ 3063 286e 448945A0 		movl	%r8d, -96(%rbp)
+ 3064 2872 44895DAC 		movl	%r11d, -84(%rbp)
+ 3065 2876 4129C5   		subl	%eax, %r13d
+ 3066 2879 48894DC8 		movq	%rcx, -56(%rbp)
+ 3067 287d 488D3C81 		leaq	(%rcx,%rax,4), %rdi
+ 3068 2881 4139D5   		cmpl	%edx, %r13d
+ 3069 2884 488975B8 		movq	%rsi, -72(%rbp)
+ 3070 2888 440F4FEA 		cmovg	%edx, %r13d
+ 3071 288c 4963D5   		movslq	%r13d, %rdx
+ 3072 288f 4C8D1495 		leaq	0(,%rdx,4), %r10
+ 3072      00000000 
+ 3073 2897 4C8955B0 		movq	%r10, -80(%rbp)
+ 3074 289b 4C89D2   		movq	%r10, %rdx
+ 3075 289e C5F877   		vzeroupper
+ 3076 28a1 E8000000 		call	memcpy@PLT
+ 3076      00
+ 3077 28a6 488B75B8 		movq	-72(%rbp), %rsi
+ 3078 28aa 4C8B55B0 		movq	-80(%rbp), %r10
+ 3079 28ae B8400000 		movl	$64, %eax
+ 3079      00
+ 3080 28b3 488B7DC8 		movq	-56(%rbp), %rdi
+ 3081 28b7 4429E8   		subl	%r13d, %eax
+ 3082 28ba 4C01D6   		addq	%r10, %rsi
+ 3083 28bd 4898     		cltq
+ 3084 28bf 488D1485 		leaq	0(,%rax,4), %rdx
+ 3084      00000000 
+ 3085 28c7 E8000000 		call	memcpy@PLT
+ 3085      00
+ 3086 28cc 488B45C8 		movq	-56(%rbp), %rax
+ 3087 28d0 488BBD68 		movq	-152(%rbp), %rdi
+ 3087      FFFFFF
+ 3088 28d7 B9400000 		movl	$64, %ecx
+ 3088      00
+ 3089 28dc 41837F14 		cmpl	$1, 20(%r15)
+ 3089      01
+ 3090 28e1 448B5DAC 		movl	-84(%rbp), %r11d
+ 3091 28e5 448B45A0 		movl	-96(%rbp), %r8d
+ 3092 28e9 4C8B4D98 		movq	-104(%rbp), %r9
+ 3093 28ed 488D3438 		leaq	(%rax,%rdi), %rsi
+ 3094 28f1 0F84E100 		je	.L356
+ 3094      0000
+ 3095 28f7 8B45A8   		movl	-88(%rbp), %eax
+ 3096 28fa 498B7F30 		movq	48(%r15), %rdi
+ 3097 28fe 498D4F18 		leaq	24(%r15), %rcx
+ 3098 2902 4C894D98 		movq	%r9, -104(%rbp)
+ 3099 2906 448945A0 		movl	%r8d, -96(%rbp)
+ 3100 290a 448D683F 		leal	63(%rax), %r13d
+ 3101 290e 8B8564FF 		movl	-156(%rbp), %eax
+ 3101      FFFF
+ 3102 2914 452B6F10 		subl	16(%r15), %r13d
+ 3103 2918 44895DAC 		movl	%r11d, -84(%rbp)
+ 3104 291c 48894DB0 		movq	%rcx, -80(%rbp)
+ 3105 2920 4439E8   		cmpl	%r13d, %eax
+ 3106 2923 410F4FC5 		cmovg	%r13d, %eax
+ 3107 2927 4129C5   		subl	%eax, %r13d
+ 3108 292a 4863D0   		movslq	%eax, %rdx
+ 3109 292d 4D63ED   		movslq	%r13d, %r13
+ 3110 2930 48C1E202 		salq	$2, %rdx
+ 3111 2934 4A8D04AD 		leaq	0(,%r13,4), %rax
+ 3111      00000000 
+ 3112 293c 4C8D2C17 		leaq	(%rdi,%rdx), %r13
+ 3113 2940 488945B8 		movq	%rax, -72(%rbp)
+ 3114 2944 4D85F6   		testq	%r14, %r14
+ 3115 2947 0F843B01 		je	.L334
+ 3115      0000
+ 3116 294d E8000000 		call	memcpy@PLT
+ 3116      00
+ 3117 2952 488B55B8 		movq	-72(%rbp), %rdx
+ 3118 2956 488B75C8 		movq	-56(%rbp), %rsi
+ 3119 295a 4C89EF   		movq	%r13, %rdi
+ 3120 295d E8000000 		call	memcpy@PLT
+ 3120      00
+ 3121 2962 498B7730 		movq	48(%r15), %rsi
+ 3122 2966 488B4DB0 		movq	-80(%rbp), %rcx
+ 3123 296a 4889DF   		movq	%rbx, %rdi
+ 3124 296d C5FA100D 		vmovss	.LC50(%rip), %xmm1
+ 3124      00000000 
+ 3125 2975 BA400000 		movl	$64, %edx
+ 3125      00
+ 3126 297a C5FA1005 		vmovss	.LC22(%rip), %xmm0
+ 3126      00000000 
+ 3127 2982 E869D8FF 		call	lagrange_gain_and_clip_block
+ 3127      FF
+ 3128 2987 448B5DAC 		movl	-84(%rbp), %r11d
+ 3129 298b 448B45A0 		movl	-96(%rbp), %r8d
+ 3130 298f 31C0     		xorl	%eax, %eax
+ 3131 2991 C4E27D18 		vbroadcastss	-64(%rbp), %ymm3
+ 3131      5DC0
+ 3132 2997 4C8B4D98 		movq	-104(%rbp), %r9
+ 3133 299b C5FC2895 		vmovaps	-144(%rbp), %ymm2
+ 3133      70FFFFFF 
+ 3134              		.p2align 4,,10
+ 3135 29a3 0F1F4400 		.p2align 3
+ 3135      00
+ 3136              	.L335:
+ 3137 29a8 C4C17C10 		vmovups	(%r14,%rax), %ymm7
+ 3137      3C06
+ 3138 29ae C5C45904 		vmulps	(%rbx,%rax), %ymm7, %ymm0
+ 3138      03
+ 3139 29b3 C5FC5DC3 		vminps	%ymm3, %ymm0, %ymm0
+ 3140 29b7 C5FC5FC2 		vmaxps	%ymm2, %ymm0, %ymm0
+ 3141 29bb C5FC2904 		vmovaps	%ymm0, (%rbx,%rax)
+ 3141      03
+ 3142 29c0 4883C020 		addq	$32, %rax
+ 3143 29c4 483D0001 		cmpq	$256, %rax
+ 3143      0000
+ 3144 29ca 75DC     		jne	.L335
+ 3145 29cc E94EFDFF 		jmp	.L324
+ 3145      FF
+ 3146              		.p2align 4,,10
+ 3147 29d1 0F1F8000 		.p2align 3
+ 3147      000000
+ 3148              	.L356:
+ 3149 29d8 8B4590   		movl	-112(%rbp), %eax
+ 3150 29db 488BBD58 		movq	-168(%rbp), %rdi
+ 3150      FFFFFF
+ 3151 29e2 4C894DA0 		movq	%r9, -96(%rbp)
+ 3152 29e6 448945AC 		movl	%r8d, -84(%rbp)
+ 3153 29ea 29C1     		subl	%eax, %ecx
+ 3154 29ec 44895DB0 		movl	%r11d, -80(%rbp)
+ 3155 29f0 4C8D2C3B 		leaq	(%rbx,%rdi), %r13
+ 3156 29f4 894DB8   		movl	%ecx, -72(%rbp)
+ 3157 29f7 4D85F6   		testq	%r14, %r14
+ 3158 29fa 0F84D000 		je	.L333
+ 3158      0000
+ 3159 2a00 C5FA1045 		vmovss	-64(%rbp), %xmm0
+ 3159      C0
+ 3160 2a05 89C2     		movl	%eax, %edx
+ 3161 2a07 4C89F1   		movq	%r14, %rcx
+ 3162 2a0a 4889DF   		movq	%rbx, %rdi
+ 3163 2a0d E89EE7FF 		call	ramp_and_clip_block
+ 3163      FF
+ 3164 2a12 488BBD58 		movq	-168(%rbp), %rdi
+ 3164      FFFFFF
+ 3165 2a19 C5FA1045 		vmovss	-64(%rbp), %xmm0
+ 3165      C0
+ 3166 2a1e 8B55B8   		movl	-72(%rbp), %edx
+ 3167 2a21 488B75C8 		movq	-56(%rbp), %rsi
+ 3168 2a25 498D0C3E 		leaq	(%r14,%rdi), %rcx
+ 3169 2a29 4C89EF   		movq	%r13, %rdi
+ 3170 2a2c E87FE7FF 		call	ramp_and_clip_block
+ 3170      FF
+ 3171 2a31 448B5DB0 		movl	-80(%rbp), %r11d
+ 3172 2a35 448B45AC 		movl	-84(%rbp), %r8d
+ 3173 2a39 4C8B4DA0 		movq	-96(%rbp), %r9
+ 3174 2a3d E9DDFCFF 		jmp	.L324
+ 3174      FF
+ 3175              		.p2align 4,,10
+ 3176 2a42 660F1F44 		.p2align 3
+ 3176      0000
+ 3177              	.L328:
+ 3178 2a48 C4C27D18 		vbroadcastss	(%r15), %ymm4
+ 3178      27
+ 3179 2a4d 31C0     		xorl	%eax, %eax
+ 3180 2a4f C5FC2895 		vmovaps	-144(%rbp), %ymm2
+ 3180      70FFFFFF 
+ 3181 2a57 660F1F84 		.p2align 4,,10
+ 3181      00000000 
+ 3181      00
+ 3182              		.p2align 3
+ 3183              	.L330:
+ 3184 2a60 C5DC5904 		vmulps	(%rsi,%rax), %ymm4, %ymm0
+ 3184      06
+ 3185 2a65 C5FC5DC3 		vminps	%ymm3, %ymm0, %ymm0
+ 3186 2a69 C5FC5FC2 		vmaxps	%ymm2, %ymm0, %ymm0
+ 3187 2a6d C5FC2904 		vmovaps	%ymm0, (%rbx,%rax)
+ 3187      03
+ 3188 2a72 4883C020 		addq	$32, %rax
+ 3189 2a76 483D0001 		cmpq	$256, %rax
+ 3189      0000
+ 3190 2a7c 75E2     		jne	.L330
+ 3191 2a7e E99CFCFF 		jmp	.L324
+ 3191      FF
+ 3192              		.p2align 4,,10
+ 3193 2a83 0F1F4400 		.p2align 3
+ 3193      00
+ 3194              	.L334:
+ 3195 2a88 E8000000 		call	memcpy@PLT
+ 3195      00
+ 3196 2a8d 488B55B8 		movq	-72(%rbp), %rdx
+ 3197 2a91 488B75C8 		movq	-56(%rbp), %rsi
+ 3198 2a95 4C89EF   		movq	%r13, %rdi
+ 3199 2a98 E8000000 		call	memcpy@PLT
+ 3199      00
+ 3200 2a9d 498B7730 		movq	48(%r15), %rsi
+ 3201 2aa1 488B4DB0 		movq	-80(%rbp), %rcx
+ 3202 2aa5 4889DF   		movq	%rbx, %rdi
+ 3203 2aa8 C4C17A10 		vmovss	(%r15), %xmm0
+ 3203      07
+ 3204 2aad C5FA104D 		vmovss	-64(%rbp), %xmm1
+ 3204      C0
+ 3205 2ab2 BA400000 		movl	$64, %edx
+ 3205      00
+ 3206 2ab7 E834D7FF 		call	lagrange_gain_and_clip_block
+ 3206      FF
+ 3207 2abc 4C8B4D98 		movq	-104(%rbp), %r9
+ 3208 2ac0 448B45A0 		movl	-96(%rbp), %r8d
+ 3209 2ac4 448B5DAC 		movl	-84(%rbp), %r11d
+ 3210 2ac8 E952FCFF 		jmp	.L324
+ 3210      FF
+ 3211 2acd 0F1F00   		.p2align 4,,10
+ 3212              		.p2align 3
+ 3213              	.L333:
+ 3214 2ad0 C4C17A10 		vmovss	(%r15), %xmm0
+ 3214      07
+ 3215 2ad5 C5FA104D 		vmovss	-64(%rbp), %xmm1
+ 3215      C0
+ 3216 2ada 4889DF   		movq	%rbx, %rdi
+ 3217 2add 8B5590   		movl	-112(%rbp), %edx
+ 3218 2ae0 E8BBE5FF 		call	gain_and_clip_block
+ 3218      FF
+ 3219 2ae5 8B55B8   		movl	-72(%rbp), %edx
+ 3220 2ae8 488B75C8 		movq	-56(%rbp), %rsi
+ 3221 2aec 4C89EF   		movq	%r13, %rdi
+ 3222 2aef C4C17A10 		vmovss	(%r15), %xmm0
+ 3222      07
+ 3223 2af4 C5FA104D 		vmovss	-64(%rbp), %xmm1
+ 3223      C0
+ 3224 2af9 E8A2E5FF 		call	gain_and_clip_block
+ 3224      FF
+ 3225 2afe 448B5DB0 		movl	-80(%rbp), %r11d
+ 3226 2b02 448B45AC 		movl	-84(%rbp), %r8d
+ 3227 2b06 4C8B4DA0 		movq	-96(%rbp), %r9
+ 3228 2b0a E910FCFF 		jmp	.L324
+ 3228      FF
+ 3229 2b0f 90       		.p2align 4,,10
+ 3230              		.p2align 3
+ 3231              	.L349:
+ 3232 2b10 C5F877   		vzeroupper
+ 3233 2b13 4881C488 		addq	$136, %rsp
+ 3233      000000
+ 3234 2b1a 5B       		popq	%rbx
+ 3235 2b1b 415C     		popq	%r12
+ 3236 2b1d 415D     		popq	%r13
+ 3237              		.cfi_remember_state
+ 3238              		.cfi_def_cfa 13, 0
+ 3239 2b1f 415E     		popq	%r14
+ 3240 2b21 415F     		popq	%r15
+ 3241 2b23 5D       		popq	%rbp
+ 3242 2b24 498D65F0 		leaq	-16(%r13), %rsp
+ 3243              		.cfi_def_cfa 7, 16
+ 3244 2b28 415D     		popq	%r13
+ 3245              		.cfi_def_cfa_offset 8
+ 3246 2b2a C3       		ret
+ 3247 2b2b 0F1F4400 		.p2align 4,,10
+ 3247      00
+ 3248              		.p2align 3
+ 3249              	.L352:
+ 3250              		.cfi_restore_state
+ 3251 2b30 8B4DC4   		movl	-60(%rbp), %ecx
+ 3252 2b33 31C0     		xorl	%eax, %eax
+ 3253 2b35 C4C17A10 		vmovss	64(%r10), %xmm1
+ 3253      4A40
+ 3254 2b3b 85C9     		testl	%ecx, %ecx
+ 3255 2b3d 410F45C3 		cmovne	%r11d, %eax
+ 3256 2b41 894594   		movl	%eax, -108(%rbp)
+ 3257 2b44 E952FBFF 		jmp	.L322
+ 3257      FF
+ 3258              		.cfi_endproc
+ 3259              	.LFE6412:
+ 3261 2b49 0F1F8000 		.p2align 4
+ 3261      000000
+ 3263              	gain_process_2_256:
+ 3264              	.LFB6411:
+ 3265              		.cfi_startproc
+ 3266 2b50 4155     		pushq	%r13
+ 3267              		.cfi_def_cfa_offset 16
+ 3268              		.cfi_offset 13, -16
+ 3269 2b52 4C8D6C24 		leaq	16(%rsp), %r13
+ 3269      10
+ 3270              		.cfi_def_cfa 13, 0
+ 3271 2b57 4883E4E0 		andq	$-32, %rsp
+ 3272 2b5b 41FF75F8 		pushq	-8(%r13)
+ 3273 2b5f 55       		pushq	%rbp
+ 3274 2b60 4889E5   		movq	%rsp, %rbp
+ 3275              		.cfi_escape 0x10,0x6,0x2,0x76,0
+ 3276 2b63 4157     		pushq	%r15
+ 3277 2b65 4156     		pushq	%r14
+ 3278 2b67 4155     		pushq	%r13
+ 3279              		.cfi_escape 0xf,0x3,0x76,0x68,0x6
+ 3280              		.cfi_escape 0x10,0xf,0x2,0x76,0x78
+ 3281              		.cfi_escape 0x10,0xe,0x2,0x76,0x70
+ 3282 2b69 4154     		pushq	%r12
+ 3283 2b6b 53       		pushq	%rbx
+ 3284              		.cfi_escape 0x10,0xc,0x2,0x76,0x60
+ 3285              		.cfi_escape 0x10,0x3,0x2,0x76,0x58
+ 3286 2b6c 4889FB   		movq	%rdi, %rbx
+ 3287 2b6f 4881EC88 		subq	$136, %rsp
+ 3287      000000
+ 3288 2b76 81BFA400 		cmpl	$256, 164(%rdi)
+ 3288      00000001 
+ 3288      0000
+ 3289 2b80 7514     		jne	.L358
+ 3290 2b82 488B4708 		movq	8(%rdi), %rax
+ 3291 2b86 480B4748 		orq	72(%rdi), %rax
+ 3292 2b8a 480B4710 		orq	16(%rdi), %rax
+ 3293 2b8e 480B4750 		orq	80(%rdi), %rax
+ 3294 2b92 A81F     		testb	$31, %al
+ 3295 2b94 7422     		je	.L387
+ 3296              	.L358:
+ 3297 2b96 4881C488 		addq	$136, %rsp
+ 3297      000000
+ 3298 2b9d 4889DF   		movq	%rbx, %rdi
+ 3299 2ba0 5B       		popq	%rbx
+ 3300 2ba1 415C     		popq	%r12
+ 3301 2ba3 415D     		popq	%r13
+ 3302              		.cfi_remember_state
+ 3303              		.cfi_def_cfa 13, 0
+ 3304 2ba5 415E     		popq	%r14
+ 3305 2ba7 415F     		popq	%r15
+ 3306 2ba9 5D       		popq	%rbp
+ 3307 2baa 498D65F0 		leaq	-16(%r13), %rsp
+ 3308              		.cfi_def_cfa 7, 16
+ 3309 2bae 415D     		popq	%r13
+ 3310              		.cfi_def_cfa_offset 8
+ 3311 2bb0 E9000000 		jmp	gain_process@PLT
+ 3311      00
+ 3312              		.p2align 4,,10
+ 3313 2bb5 0F1F00   		.p2align 3
+ 3314              	.L387:
+ 3315              		.cfi_restore_state
+ 3316 2bb8 4C8BB7C0 		movq	192(%rdi), %r14
+ 3316      000000
+ 3317 2bbf BE000100 		movl	$256, %esi
+ 3317      00
+ 3318 2bc4 418B4614 		movl	20(%r14), %eax
+ 3319 2bc8 41034610 		addl	16(%r14), %eax
+ 3320 2bcc 458B5E38 		movl	56(%r14), %r11d
+ 3321 2bd0 8D78FF   		leal	-1(%rax), %edi
+ 3322 2bd3 8945A8   		movl	%eax, -88(%rbp)
+ 3323 2bd6 418B463C 		movl	60(%r14), %eax
+ 3324 2bda 897DC4   		movl	%edi, -60(%rbp)
+ 3325 2bdd 44895DC8 		movl	%r11d, -56(%rbp)
+ 3326 2be1 4401D8   		addl	%r11d, %eax
+ 3327 2be4 29F8     		subl	%edi, %eax
+ 3328 2be6 4C89F7   		movq	%r14, %rdi
+ 3329 2be9 99       		cltd
+ 3330 2bea 41F7FB   		idivl	%r11d
+ 3331 2bed 4489D8   		movl	%r11d, %eax
+ 3332 2bf0 4C63E2   		movslq	%edx, %r12
+ 3333 2bf3 4429E0   		subl	%r12d, %eax
+ 3334 2bf6 89C1     		movl	%eax, %ecx
+ 3335 2bf8 898564FF 		movl	%eax, -156(%rbp)
+ 3335      FFFF
+ 3336 2bfe B8000100 		movl	$256, %eax
+ 3336      00
+ 3337 2c03 39C1     		cmpl	%eax, %ecx
+ 3338 2c05 0F4EC1   		cmovle	%ecx, %eax
+ 3339 2c08 894590   		movl	%eax, -112(%rbp)
+ 3340 2c0b E8F0D3FF 		call	gain_ramp
+ 3340      FF
+ 3341 2c10 49837E78 		cmpq	$0, 120(%r14)
+ 3341      00
+ 3342 2c15 448B5DC8 		movl	-56(%rbp), %r11d
+ 3343 2c19 4989C1   		movq	%rax, %r9
+ 3344 2c1c 0F848E04 		je	.L388
+ 3344      0000
+ 3345 2c22 C74594FF 		movl	$2147483647, -108(%rbp)
+ 3345      FFFF7F
+ 3346 2c29 C5FA100D 		vmovss	.LC50(%rip), %xmm1
+ 3346      00000000 
+ 3347              	.L359:
+ 3348 2c31 4889DF   		movq	%rbx, %rdi
+ 3349 2c34 4531C0   		xorl	%r8d, %r8d
+ 3350 2c37 4C89F3   		movq	%r14, %rbx
+ 3351 2c3a 4531D2   		xorl	%r10d, %r10d
+ 3352 2c3d 4A8D04A5 		leaq	0(,%r12,4), %rax
+ 3352      00000000 
+ 3353 2c45 4D89CE   		movq	%r9, %r14
+ 3354 2c48 4D89C5   		movq	%r8, %r13
+ 3355 2c4b 4989F9   		movq	%rdi, %r9
+ 3356 2c4e 48898568 		movq	%rax, -152(%rbp)
+ 3356      FFFFFF
+ 3357 2c55 48634590 		movslq	-112(%rbp), %rax
+ 3358 2c59 C5F05715 		vxorps	.LC2(%rip), %xmm1, %xmm2
+ 3358      00000000 
+ 3359 2c61 C5FA114D 		vmovss	%xmm1, -64(%rbp)
+ 3359      C0
+ 3360 2c66 48C1E002 		salq	$2, %rax
+ 3361 2c6a C4E27D18 		vbroadcastss	%xmm2, %ymm2
+ 3361      D2
+ 3362 2c6f 48898558 		movq	%rax, -168(%rbp)
+ 3362      FFFFFF
+ 3363 2c76 C5FC2995 		vmovaps	%ymm2, -144(%rbp)
+ 3363      70FFFFFF 
+ 3364 2c7e EB2F     		jmp	.L373
+ 3365              		.p2align 4,,10
+ 3366              		.p2align 3
+ 3367              	.L390:
+ 3368 2c80 8B7D94   		movl	-108(%rbp), %edi
+ 3369 2c83 4239BCAB 		cmpl	%edi, 128(%rbx,%r13,4)
+ 3369      80000000 
+ 3370 2c8b 7C49     		jl	.L360
+ 3371 2c8d B9800000 		movl	$128, %ecx
+ 3371      00
+ 3372 2c92 31C0     		xorl	%eax, %eax
+ 3373 2c94 4C89E7   		movq	%r12, %rdi
+ 3374 2c97 C60201   		movb	$1, (%rdx)
+ 3375 2c9a F348AB   		rep stosq
+ 3376              	.L361:
+ 3377 2c9d 4501DA   		addl	%r11d, %r10d
+ 3378 2ca0 4D85ED   		testq	%r13, %r13
+ 3379 2ca3 0F85A000 		jne	.L389
+ 3379      0000
+ 3380              	.L378:
+ 3381 2ca9 41BD0100 		movl	$1, %r13d
+ 3381      0000
+ 3382              	.L373:
+ 3383 2caf 498B8188 		movq	136(%r9), %rax
+ 3383      000000
+ 3384 2cb6 498B9190 		movq	144(%r9), %rdx
+ 3384      000000
+ 3385 2cbd 4B8B74E9 		movq	8(%r9,%r13,8), %rsi
+ 3385      08
+ 3386 2cc2 4F8B64E9 		movq	72(%r9,%r13,8), %r12
+ 3386      48
+ 3387 2cc7 4C01E8   		addq	%r13, %rax
+ 3388 2cca 4C01EA   		addq	%r13, %rdx
+ 3389 2ccd 488B4B28 		movq	40(%rbx), %rcx
+ 3390 2cd1 803800   		cmpb	$0, (%rax)
+ 3391 2cd4 75AA     		jne	.L390
+ 3392              	.L360:
+ 3393 2cd6 C60200   		movb	$0, (%rdx)
+ 3394 2cd9 803800   		cmpb	$0, (%rax)
+ 3395 2cdc 0F85CE00 		jne	.L362
+ 3395      0000
+ 3396 2ce2 42C784AB 		movl	$0, 128(%rbx,%r13,4)
+ 3396      80000000 
+ 3396      00000000 
+ 3397              	.L363:
+ 3398 2cee 8B55C4   		movl	-60(%rbp), %edx
+ 3399 2cf1 85D2     		testl	%edx, %edx
+ 3400 2cf3 0F85E000 		jne	.L364
+ 3400      0000
+ 3401              	.L391:
+ 3402 2cf9 C4E27D18 		vbroadcastss	-64(%rbp), %ymm3
+ 3402      5DC0
+ 3403 2cff 4D85F6   		testq	%r14, %r14
+ 3404 2d02 0F84C802 		je	.L365
+ 3404      0000
+ 3405 2d08 C5FC2895 		vmovaps	-144(%rbp), %ymm2
+ 3405      70FFFFFF 
+ 3406 2d10 31C0     		xorl	%eax, %eax
+ 3407              		.p2align 4,,10
+ 3408 2d12 660F1F44 		.p2align 3
+ 3408      0000
+ 3409              	.L366:
+ 3410 2d18 C4C17C10 		vmovups	(%r14,%rax), %ymm5
+ 3410      2C06
+ 3411 2d1e C5D45904 		vmulps	(%rsi,%rax), %ymm5, %ymm0
+ 3411      06
+ 3412 2d23 C5FC5DC3 		vminps	%ymm3, %ymm0, %ymm0
+ 3413 2d27 C5FC5FC2 		vmaxps	%ymm2, %ymm0, %ymm0
+ 3414 2d2b C4C17C29 		vmovaps	%ymm0, (%r12,%rax)
+ 3414      0404
+ 3415 2d31 4883C020 		addq	$32, %rax
+ 3416 2d35 483D0004 		cmpq	$1024, %rax
+ 3416      0000
+ 3417 2d3b 75DB     		jne	.L366
+ 3418 2d3d 4501DA   		addl	%r11d, %r10d
+ 3419 2d40 4D85ED   		testq	%r13, %r13
+ 3420 2d43 0F8460FF 		je	.L378
+ 3420      FFFF
+ 3421              	.L389:
+ 3422 2d49 8B45C4   		movl	-60(%rbp), %eax
+ 3423 2d4c 4989DE   		movq	%rbx, %r14
+ 3424 2d4f 4C89CB   		movq	%r9, %rbx
+ 3425 2d52 85C0     		testl	%eax, %eax
+ 3426 2d54 7411     		je	.L374
+ 3427 2d56 418B463C 		movl	60(%r14), %eax
+ 3428 2d5a 05000100 		addl	$256, %eax
+ 3428      00
+ 3429 2d5f 99       		cltd
+ 3430 2d60 41F7FB   		idivl	%r11d
+ 3431 2d63 4189563C 		movl	%edx, 60(%r14)
+ 3432              	.L374:
+ 3433 2d67 498B7678 		movq	120(%r14), %rsi
+ 3434 2d6b 4885F6   		testq	%rsi, %rsi
+ 3435 2d6e 0F841C03 		je	.L385
+ 3435      0000
+ 3436 2d74 C4C17A10 		vmovss	64(%r14), %xmm0
+ 3436      4640
+ 3437 2d7a C5F877   		vzeroupper
+ 3438 2d7d 4889DF   		movq	%rbx, %rdi
+ 3439 2d80 4881C488 		addq	$136, %rsp
+ 3439      000000
+ 3440 2d87 5B       		popq	%rbx
+ 3441 2d88 415C     		popq	%r12
+ 3442 2d8a B9000100 		movl	$256, %ecx
+ 3442      00
+ 3443 2d8f BA020000 		movl	$2, %edx
+ 3443      00
+ 3444 2d94 415D     		popq	%r13
+ 3445              		.cfi_remember_state
+ 3446              		.cfi_def_cfa 13, 0
+ 3447 2d96 415E     		popq	%r14
+ 3448 2d98 415F     		popq	%r15
+ 3449 2d9a 5D       		popq	%rbp
+ 3450 2d9b 498D65F0 		leaq	-16(%r13), %rsp
+ 3451              		.cfi_def_cfa 7, 16
+ 3452 2d9f 415D     		popq	%r13
+ 3453              		.cfi_def_cfa_offset 8
+ 3454 2da1 E92AE5FF 		jmp	limit
+ 3454      FF
+ 3455 2da6 662E0F1F 		.p2align 4,,10
+ 3455      84000000 
+ 3455      0000
+ 3456              		.p2align 3
+ 3457              	.L362:
+ 3458              		.cfi_restore_state
+ 3459 2db0 428B84AB 		movl	128(%rbx,%r13,4), %eax
+ 3459      80000000 
+ 3460 2db8 4139C3   		cmpl	%eax, %r11d
+ 3461 2dbb 0F8E2DFF 		jle	.L363
+ 3461      FFFF
+ 3462 2dc1 8B55C4   		movl	-60(%rbp), %edx
+ 3463 2dc4 05000100 		addl	$256, %eax
+ 3463      00
+ 3464 2dc9 428984AB 		movl	%eax, 128(%rbx,%r13,4)
+ 3464      80000000 
+ 3465 2dd1 85D2     		testl	%edx, %edx
+ 3466 2dd3 0F8420FF 		je	.L391
+ 3466      FFFF
+ 3467              	.L364:
+ 3468 2dd9 4963C2   		movslq	%r10d, %rax
+ 3469 2ddc 4589DF   		movl	%r11d, %r15d
+ 3470 2ddf BA000100 		movl	$256, %edx
+ 3470      00
+ 3471 2de4 4C894D98 		movq	%r9, -104(%rbp)
+ 3472 2de8 488D0C81 		leaq	(%rcx,%rax,4), %rcx
+ 3473 2dec 4863433C 		movslq	60(%rbx), %rax
+ 3474 2df0 448955A0 		movl	%r10d, -96(%rbp)
+ 3475 2df4 44895DAC 		movl	%r11d, -84(%rbp)
+ 3476 2df8 4129C7   		subl	%eax, %r15d
+ 3477 2dfb 48894DC8 		movq	%rcx, -56(%rbp)
+ 3478 2dff 488D3C81 		leaq	(%rcx,%rax,4), %rdi
+ 3479 2e03 4139D7   		cmpl	%edx, %r15d
+ 3480 2e06 488975B8 		movq	%rsi, -72(%rbp)
+ 3481 2e0a 440F4FFA 		cmovg	%edx, %r15d
+ 3482 2e0e 4963D7   		movslq	%r15d, %rdx
+ 3483 2e11 4C8D0495 		leaq	0(,%rdx,4), %r8
+ 3483      00000000 
+ 3484 2e19 4C8945B0 		movq	%r8, -80(%rbp)
+ 3485 2e1d 4C89C2   		movq	%r8, %rdx
+ 3486 2e20 C5F877   		vzeroupper
+ 3487 2e23 E8000000 		call	memcpy@PLT
+ 3487      00
+ 3488 2e28 488B75B8 		movq	-72(%rbp), %rsi
+ 3489 2e2c 4C8B45B0 		movq	-80(%rbp), %r8
+ 3490 2e30 B8000100 		movl	$256, %eax
+ 3490      00
+ 3491 2e35 488B7DC8 		movq	-56(%rbp), %rdi
+ 3492 2e39 4429F8   		subl	%r15d, %eax
+ 3493 2e3c 4C01C6   		addq	%r8, %rsi
+ 3494 2e3f 4898     		cltq
+ 3495 2e41 488D1485 		leaq	0(,%rax,4), %rdx
+ 3495      00000000 
+ 3496 2e49 E8000000 		call	memcpy@PLT
+ 3496      00
+ 3497 2e4e 488B45C8 		movq	-56(%rbp), %rax
+ 3498 2e52 488BBD68 		movq	-152(%rbp), %rdi
+ 3498      FFFFFF
+ 3499 2e59 B9000100 		movl	$256, %ecx
+ 3499      00
+ 3500 2e5e 837B1401 		cmpl	$1, 20(%rbx)
+ 3501 2e62 448B5DAC 		movl	-84(%rbp), %r11d
+ 3502 2e66 448B55A0 		movl	-96(%rbp), %r10d
+ 3503 2e6a 4C8B4D98 		movq	-104(%rbp), %r9
+ 3504 2e6e 488D3438 		leaq	(%rax,%rdi), %rsi
+ 3505 2e72 0F84E800 		je	.L392
+ 3505      0000
+ 3506 2e78 8B45A8   		movl	-88(%rbp), %eax
+ 3507 2e7b 488B7B30 		movq	48(%rbx), %rdi
+ 3508 2e7f 488D4B18 		leaq	24(%rbx), %rcx
+ 3509 2e83 4C894D98 		movq	%r9, -104(%rbp)
+ 3510 2e87 448955A0 		movl	%r10d, -96(%rbp)
+ 3511 2e8b 448DB8FF 		leal	255(%rax), %r15d
+ 3511      000000
+ 3512 2e92 8B8564FF 		movl	-156(%rbp), %eax
+ 3512      FFFF
+ 3513 2e98 442B7B10 		subl	16(%rbx), %r15d
+ 3514 2e9c 44895DAC 		movl	%r11d, -84(%rbp)
+ 3515 2ea0 48894DB0 		movq	%rcx, -80(%rbp)
+ 3516 2ea4 4439F8   		cmpl	%r15d, %eax
+ 3517 2ea7 410F4FC7 		cmovg	%r15d, %eax
+ 3518 2eab 4129C7   		subl	%eax, %r15d
+ 3519 2eae 4863D0   		movslq	%eax, %rdx
+ 3520 2eb1 4D63FF   		movslq	%r15d, %r15
+ 3521 2eb4 48C1E202 		salq	$2, %rdx
+ 3522 2eb8 4A8D04BD 		leaq	0(,%r15,4), %rax
+ 3522      00000000 
+ 3523 2ec0 4C8D3C17 		leaq	(%rdi,%rdx), %r15
+ 3524 2ec4 488945B8 		movq	%rax, -72(%rbp)
+ 3525 2ec8 4D85F6   		testq	%r14, %r14
+ 3526 2ecb 0F843701 		je	.L371
+ 3526      0000
+ 3527 2ed1 E8000000 		call	memcpy@PLT
+ 3527      00
+ 3528 2ed6 488B55B8 		movq	-72(%rbp), %rdx
+ 3529 2eda 488B75C8 		movq	-56(%rbp), %rsi
+ 3530 2ede 4C89FF   		movq	%r15, %rdi
+ 3531 2ee1 E8000000 		call	memcpy@PLT
+ 3531      00
+ 3532 2ee6 488B7330 		movq	48(%rbx), %rsi
+ 3533 2eea 488B4DB0 		movq	-80(%rbp), %rcx
+ 3534 2eee 4C89E7   		movq	%r12, %rdi
+ 3535 2ef1 C5FA100D 		vmovss	.LC50(%rip), %xmm1
+ 3535      00000000 
+ 3536 2ef9 BA000100 		movl	$256, %edx
+ 3536      00
+ 3537 2efe C5FA1005 		vmovss	.LC22(%rip), %xmm0
+ 3537      00000000 
+ 3538 2f06 E8E5D2FF 		call	lagrange_gain_and_clip_block
+ 3538      FF
+ 3539 2f0b 448B5DAC 		movl	-84(%rbp), %r11d
+ 3540 2f0f 448B55A0 		movl	-96(%rbp), %r10d
+ 3541 2f13 31C0     		xorl	%eax, %eax
+ 3542 2f15 C4E27D18 		vbroadcastss	-64(%rbp), %ymm3
+ 3542      5DC0
+ 3543 2f1b 4C8B4D98 		movq	-104(%rbp), %r9
+ 3544 2f1f C5FC2895 		vmovaps	-144(%rbp), %ymm2
+ 3544      70FFFFFF 
+ 3545 2f27 660F1F84 		.p2align 4,,10
+ 3545      00000000 
+ 3545      00
+ 3546              		.p2align 3
+ 3547              	.L372:
+ 3548 2f30 C4C17C10 		vmovups	(%r14,%rax), %ymm6
+ 3548      3406
+ 3549 2f36 C4C14C59 		vmulps	(%r12,%rax), %ymm6, %ymm0
+ 3549      0404
+ 3550 2f3c C5FC5DC3 		vminps	%ymm3, %ymm0, %ymm0
+ 3551 2f40 C5FC5FC2 		vmaxps	%ymm2, %ymm0, %ymm0
+ 3552 2f44 C4C17C29 		vmovaps	%ymm0, (%r12,%rax)
+ 3552      0404
+ 3553 2f4a 4883C020 		addq	$32, %rax
+ 3554 2f4e 483D0004 		cmpq	$1024, %rax
+ 3554      0000
+ 3555 2f54 75DA     		jne	.L372
+ 3556 2f56 E942FDFF 		jmp	.L361
+ 3556      FF
+ 3557 2f5b 0F1F4400 		.p2align 4,,10
+ 3557      00
+ 3558              		.p2align 3
+ 3559              	.L392:
+ 3560 2f60 8B4590   		movl	-112(%rbp), %eax
+ 3561 2f63 488BBD58 		movq	-168(%rbp), %rdi
+ 3561      FFFFFF
+ 3562 2f6a 4C894DA0 		movq	%r9, -96(%rbp)
+ 3563 2f6e 448955AC 		movl	%r10d, -84(%rbp)
+ 3564 2f72 29C1     		subl	%eax, %ecx
+ 3565 2f74 44895DB0 		movl	%r11d, -80(%rbp)
+ 3566 2f78 4D8D3C3C 		leaq	(%r12,%rdi), %r15
+ 3567 2f7c 894DB8   		movl	%ecx, -72(%rbp)
+ 3568 2f7f 4D85F6   		testq	%r14, %r14
+ 3569 2f82 0F84C800 		je	.L370
+ 3569      0000
+ 3570 2f88 C5FA1045 		vmovss	-64(%rbp), %xmm0
+ 3570      C0
+ 3571 2f8d 89C2     		movl	%eax, %edx
+ 3572 2f8f 4C89F1   		movq	%r14, %rcx
+ 3573 2f92 4C89E7   		movq	%r12, %rdi
+ 3574 2f95 E816E2FF 		call	ramp_and_clip_block
+ 3574      FF
+ 3575 2f9a 488BBD58 		movq	-168(%rbp), %rdi
+ 3575      FFFFFF
+ 3576 2fa1 C5FA1045 		vmovss	-64(%rbp), %xmm0
+ 3576      C0
+ 3577 2fa6 8B55B8   		movl	-72(%rbp), %edx
+ 3578 2fa9 488B75C8 		movq	-56(%rbp), %rsi
+ 3579 2fad 498D0C3E 		leaq	(%r14,%rdi), %rcx
+ 3580 2fb1 4C89FF   		movq	%r15, %rdi
+ 3581 2fb4 E8F7E1FF 		call	ramp_and_clip_block
+ 3581      FF
+ 3582 2fb9 448B5DB0 		movl	-80(%rbp), %r11d
+ 3583 2fbd 448B55AC 		movl	-84(%rbp), %r10d
+ 3584 2fc1 4C8B4DA0 		movq	-96(%rbp), %r9
+ 3585 2fc5 E9D3FCFF 		jmp	.L361
+ 3585      FF
+ 3586 2fca 660F1F44 		.p2align 4,,10
+ 3586      0000
+ 3587              		.p2align 3
+ 3588              	.L365:
+ 3589 2fd0 C4E27D18 		vbroadcastss	(%rbx), %ymm4
+ 3589      23
+ 3590 2fd5 31C0     		xorl	%eax, %eax
+ 3591 2fd7 C5FC2895 		vmovaps	-144(%rbp), %ymm2
+ 3591      70FFFFFF 
+ 3592 2fdf 90       		.p2align 4,,10
+ 3593              		.p2align 3
+ 3594              	.L367:
+ 3595 2fe0 C5DC5904 		vmulps	(%rsi,%rax), %ymm4, %ymm0
+ 3595      06
+ 3596 2fe5 C5FC5DC3 		vminps	%ymm3, %ymm0, %ymm0
+ 3597 2fe9 C5FC5FC2 		vmaxps	%ymm2, %ymm0, %ymm0
+ 3598 2fed C4C17C29 		vmovaps	%ymm0, (%r12,%rax)
+ 3598      0404
+ 3599 2ff3 4883C020 		addq	$32, %rax
+ 3600 2ff7 483D0004 		cmpq	$1024, %rax
+ 3600      0000
+ 3601 2ffd 75E1     		jne	.L367
+ 3602 2fff E999FCFF 		jmp	.L361
+ 3602      FF
+ 3603              		.p2align 4,,10
+ 3604 3004 0F1F4000 		.p2align 3
+ 3605              	.L371:
+ 3606 3008 E8000000 		call	memcpy@PLT
+ 3606      00
+ 3607 300d 488B55B8 		movq	-72(%rbp), %rdx
+ 3608 3011 488B75C8 		movq	-56(%rbp), %rsi
+ 3609 3015 4C89FF   		movq	%r15, %rdi
+ 3610 3018 E8000000 		call	memcpy@PLT
+ 3610      00
+ 3611 301d 488B7330 		movq	48(%rbx), %rsi
+ 3612 3021 488B4DB0 		movq	-80(%rbp), %rcx
+ 3613 3025 4C89E7   		movq	%r12, %rdi
+ 3614 3028 C5FA1003 		vmovss	(%rbx), %xmm0
+ 3615 302c C5FA104D 		vmovss	-64(%rbp), %xmm1
+ 3615      C0
+ 3616 3031 BA000100 		movl	$256, %edx
+ 3616      00
+ 3617 3036 E8B5D1FF 		call	lagrange_gain_and_clip_block
+ 3617      FF
+ 3618 303b 4C8B4D98 		movq	-104(%rbp), %r9
+ 3619 303f 448B55A0 		movl	-96(%rbp), %r10d
+ 3620 3043 448B5DAC 		movl	-84(%rbp), %r11d
+ 3621 3047 E951FCFF 		jmp	.L361
+ 3621      FF
+ 3622 304c 0F1F4000 		.p2align 4,,10
+ 3623              		.p2align 3
+ 3624              	.L370:
+ 3625 3050 C5FA1003 		vmovss	(%rbx), %xmm0
+ 3626 3054 C5FA104D 		vmovss	-64(%rbp), %xmm1
+ 3626      C0
+ 3627 3059 4C89E7   		movq	%r12, %rdi
+ 3628 305c 8B5590   		movl	-112(%rbp), %edx
+ 3629 305f E83CE0FF 		call	gain_and_clip_block
+ 3629      FF
+ 3630 3064 8B55B8   		movl	-72(%rbp), %edx
+ 3631 3067 488B75C8 		movq	-56(%rbp), %rsi
+ 3632 306b 4C89FF   		movq	%r15, %rdi
+ 3633 306e C5FA1003 		vmovss	(%rbx), %xmm0
+ 3634 3072 C5FA104D 		vmovss	-64(%rbp), %xmm1
+ 3634      C0
+ 3635 3077 E824E0FF 		call	gain_and_clip_block
+ 3635      FF
+ 3636 307c 448B5DB0 		movl	-80(%rbp), %r11d
+ 3637 3080 448B55AC 		movl	-84(%rbp), %r10d
+ 3638 3084 4C8B4DA0 		movq	-96(%rbp), %r9
+ 3639 3088 E910FCFF 		jmp	.L361
+ 3639      FF
+ 3640 308d 0F1F00   		.p2align 4,,10
+ 3641              		.p2align 3
+ 3642              	.L385:
+ 3643 3090 C5F877   		vzeroupper
+ 3644 3093 4881C488 		addq	$136, %rsp
+ 3644      000000
+ 3645 309a 5B       		popq	%rbx
+ 3646 309b 415C     		popq	%r12
+ 3647 309d 415D     		popq	%r13
+ 3648              		.cfi_remember_state
+ 3649              		.cfi_def_cfa 13, 0
+ 3650 309f 415E     		popq	%r14
+ 3651 30a1 415F     		popq	%r15
+ 3652 30a3 5D       		popq	%rbp
+ 3653 30a4 498D65F0 		leaq	-16(%r13), %rsp
+ 3654              		.cfi_def_cfa 7, 16
+ 3655 30a8 415D     		popq	%r13
+ 3656              		.cfi_def_cfa_offset 8
+ 3657 30aa C3       		ret
+ 3658 30ab 0F1F4400 		.p2align 4,,10
+ 3658      00
+ 3659              		.p2align 3
+ 3660              	.L388:
+ 3661              		.cfi_restore_state
+ 3662 30b0 8B4DC4   		movl	-60(%rbp), %ecx
+ 3663 30b3 31C0     		xorl	%eax, %eax
+ 3664 30b5 C4C17A10 		vmovss	64(%r14), %xmm1
+ 3664      4E40
+ 3665 30bb 85C9     		testl	%ecx, %ecx
+ 3666 30bd 410F45C3 		cmovne	%r11d, %eax
+ 3667 30c1 894594   		movl	%eax, -108(%rbp)
+ 3668 30c4 E968FBFF 		jmp	.L359
+ 3668      FF
+ 3669              		.cfi_endproc
+ 3670              	.LFE6411:
+ 3672 30c9 0F1F8000 		.p2align 4
+ 3672      000000
+ 3674              	gain_process_2_64:
+ 3675              	.LFB6409:
+ 3676              		.cfi_startproc
+ 3677 30d0 4155     		pushq	%r13
+ 3678              		.cfi_def_cfa_offset 16
+ 3679              		.cfi_offset 13, -16
+ 3680 30d2 4C8D6C24 		leaq	16(%rsp), %r13
+ 3680      10
+ 3681              		.cfi_def_cfa 13, 0
+ 3682 30d7 4883E4E0 		andq	$-32, %rsp
+ 3683 30db 41FF75F8 		pushq	-8(%r13)
+ 3684 30df 55       		pushq	%rbp
+ 3685 30e0 4889E5   		movq	%rsp, %rbp
+ 3686              		.cfi_escape 0x10,0x6,0x2,0x76,0
+ 3687 30e3 4157     		pushq	%r15
+ 3688 30e5 4156     		pushq	%r14
+ 3689 30e7 4155     		pushq	%r13
+ 3690              		.cfi_escape 0xf,0x3,0x76,0x68,0x6
+ 3691              		.cfi_escape 0x10,0xf,0x2,0x76,0x78
+ 3692              		.cfi_escape 0x10,0xe,0x2,0x76,0x70
+ 3693 30e9 4154     		pushq	%r12
+ 3694 30eb 53       		pushq	%rbx
+ 3695              		.cfi_escape 0x10,0xc,0x2,0x76,0x60
+ 3696              		.cfi_escape 0x10,0x3,0x2,0x76,0x58
+ 3697 30ec 4889FB   		movq	%rdi, %rbx
+ 3698 30ef 4881EC88 		subq	$136, %rsp
+ 3698      000000
+ 3699 30f6 83BFA400 		cmpl	$64, 164(%rdi)
+ 3699      000040
+ 3700 30fd 7514     		jne	.L394
+ 3701 30ff 488B4708 		movq	8(%rdi), %rax
+ 3702 3103 480B4748 		orq	72(%rdi), %rax
+ 3703 3107 480B4710 		orq	16(%rdi), %rax
+ 3704 310b 480B4750 		orq	80(%rdi), %rax
+ 3705 310f A81F     		testb	$31, %al
+ 3706 3111 7425     		je	.L423
+ 3707              	.L394:
+ 3708 3113 4881C488 		addq	$136, %rsp
+ 3708      000000
+ 3709 311a 4889DF   		movq	%rbx, %rdi
+ 3710 311d 5B       		popq	%rbx
+ 3711 311e 415C     		popq	%r12
+ 3712 3120 415D     		popq	%r13
+ 3713              		.cfi_remember_state
+ 3714              		.cfi_def_cfa 13, 0
+ 3715 3122 415E     		popq	%r14
+ 3716 3124 415F     		popq	%r15
+ 3717 3126 5D       		popq	%rbp
+ 3718 3127 498D65F0 		leaq	-16(%r13), %rsp
+ 3719              		.cfi_def_cfa 7, 16
+ 3720 312b 415D     		popq	%r13
+ 3721              		.cfi_def_cfa_offset 8
+ 3722 312d E9000000 		jmp	gain_process@PLT
+ 3722      00
+ 3723              		.p2align 4,,10
+ 3724 3132 660F1F44 		.p2align 3
+ 3724      0000
+ 3725              	.L423:
+ 3726              		.cfi_restore_state
+ 3727 3138 4C8BB7C0 		movq	192(%rdi), %r14
+ 3727      000000
+ 3728 313f BE400000 		movl	$64, %esi
+ 3728      00
+ 3729 3144 418B4614 		movl	20(%r14), %eax
+ 3730 3148 41034610 		addl	16(%r14), %eax
+ 3731 314c 458B5E38 		movl	56(%r14), %r11d
+ 3732 3150 8D78FF   		leal	-1(%rax), %edi
+ 3733 3153 8945A8   		movl	%eax, -88(%rbp)
+ 3734 3156 418B463C 		movl	60(%r14), %eax
+ 3735 315a 897DC4   		movl	%edi, -60(%rbp)
+ 3736 315d 44895DC8 		movl	%r11d, -56(%rbp)
+ 3737 3161 4401D8   		addl	%r11d, %eax
+ 3738 3164 29F8     		subl	%edi, %eax
+ 3739 3166 4C89F7   		movq	%r14, %rdi
+ 3740 3169 99       		cltd
+ 3741 316a 41F7FB   		idivl	%r11d
+ 3742 316d 4489D8   		movl	%r11d, %eax
+ 3743 3170 4C63E2   		movslq	%edx, %r12
+ 3744 3173 4429E0   		subl	%r12d, %eax
+ 3745 3176 89C1     		movl	%eax, %ecx
+ 3746 3178 898564FF 		movl	%eax, -156(%rbp)
+ 3746      FFFF
+ 3747 317e B8400000 		movl	$64, %eax
+ 3747      00
+ 3748 3183 39C1     		cmpl	%eax, %ecx
+ 3749 3185 0F4EC1   		cmovle	%ecx, %eax
+ 3750 3188 894590   		movl	%eax, -112(%rbp)
+ 3751 318b E870CEFF 		call	gain_ramp
+ 3751      FF
+ 3752 3190 49837E78 		cmpq	$0, 120(%r14)
+ 3752      00
+ 3753 3195 448B5DC8 		movl	-56(%rbp), %r11d
+ 3754 3199 4989C1   		movq	%rax, %r9
+ 3755 319c 0F849E04 		je	.L424
+ 3755      0000
+ 3756 31a2 C74594FF 		movl	$2147483647, -108(%rbp)
+ 3756      FFFF7F
+ 3757 31a9 C5FA100D 		vmovss	.LC50(%rip), %xmm1
+ 3757      00000000 
+ 3758              	.L395:
+ 3759 31b1 4889DF   		movq	%rbx, %rdi
+ 3760 31b4 4531C0   		xorl	%r8d, %r8d
+ 3761 31b7 4C89F3   		movq	%r14, %rbx
+ 3762 31ba 4531D2   		xorl	%r10d, %r10d
+ 3763 31bd 4A8D04A5 		leaq	0(,%r12,4), %rax
+ 3763      00000000 
+ 3764 31c5 4D89CE   		movq	%r9, %r14
+ 3765 31c8 4D89C5   		movq	%r8, %r13
+ 3766 31cb 4989F9   		movq	%rdi, %r9
+ 3767 31ce 48898568 		movq	%rax, -152(%rbp)
+ 3767      FFFFFF
+ 3768 31d5 48634590 		movslq	-112(%rbp), %rax
+ 3769 31d9 C5F05715 		vxorps	.LC2(%rip), %xmm1, %xmm2
+ 3769      00000000 
+ 3770 31e1 C5FA114D 		vmovss	%xmm1, -64(%rbp)
+ 3770      C0
+ 3771 31e6 48C1E002 		salq	$2, %rax
+ 3772 31ea C4E27D18 		vbroadcastss	%xmm2, %ymm2
+ 3772      D2
+ 3773 31ef 48898558 		movq	%rax, -168(%rbp)
+ 3773      FFFFFF
+ 3774 31f6 C5FC2995 		vmovaps	%ymm2, -144(%rbp)
+ 3774      70FFFFFF 
+ 3775 31fe EB45     		jmp	.L409
+ 3776              		.p2align 4,,10
+ 3777              		.p2align 3
+ 3778              	.L426:
+ 3779 3200 8B7D94   		movl	-108(%rbp), %edi
+ 3780 3203 4239BCAB 		cmpl	%edi, 128(%rbx,%r13,4)
+ 3780      80000000 
+ 3781 320b 7C5F     		jl	.L396
+ 3782 320d C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 3783 3211 C60201   		movb	$1, (%rdx)
+ 3784 3214 62D17F48 		vmovdqu8	%zmm0, (%r12)
+ 3784      7F0424
+ 3785 321b 62D17F48 		vmovdqu8	%zmm0, 64(%r12)
+ 3785      7F442401 
+ 3786 3223 62D17F48 		vmovdqu8	%zmm0, 128(%r12)
+ 3786      7F442402 
+ 3787 322b 62D17F48 		vmovdqu8	%zmm0, 192(%r12)
+ 3787      7F442403 
+ 3788              	.L397:
+ 3789 3233 4501DA   		addl	%r11d, %r10d
+ 3790 3236 4D85ED   		testq	%r13, %r13
+ 3791 3239 0F85A200 		jne	.L425
+ 3791      0000
+ 3792              	.L414:
+ 3793 323f 41BD0100 		movl	$1, %r13d
+ 3793      0000
+ 3794              	.L409:
+ 3795 3245 498B8188 		movq	136(%r9), %rax
+ 3795      000000
+ 3796 324c 498B9190 		movq	144(%r9), %rdx
+ 3796      000000
+ 3797 3253 4B8B74E9 		movq	8(%r9,%r13,8), %rsi
+ 3797      08
+ 3798 3258 4F8B64E9 		movq	72(%r9,%r13,8), %r12
+ 3798      48
+ 3799 325d 4C01E8   		addq	%r13, %rax
+ 3800 3260 4C01EA   		addq	%r13, %rdx
+ 3801 3263 488B4B28 		movq	40(%rbx), %rcx
+ 3802 3267 803800   		cmpb	$0, (%rax)
+ 3803 326a 7594     		jne	.L426
+ 3804              	.L396:
+ 3805 326c C60200   		movb	$0, (%rdx)
+ 3806 326f 803800   		cmpb	$0, (%rax)
+ 3807 3272 0F85C800 		jne	.L398
+ 3807      0000
+ 3808 3278 42C784AB 		movl	$0, 128(%rbx,%r13,4)
+ 3808      80000000 
+ 3808      00000000 
+ 3809              	.L399:
+ 3810 3284 8B55C4   		movl	-60(%rbp), %edx
+ 3811 3287 85D2     		testl	%edx, %edx
+ 3812 3289 0F85D800 		jne	.L400
+ 3812      0000
+ 3813              	.L427:
+ 3814 328f C4E27D18 		vbroadcastss	-64(%rbp), %ymm3
+ 3814      5DC0
+ 3815 3295 4D85F6   		testq	%r14, %r14
+ 3816 3298 0F84BA02 		je	.L401
+ 3816      0000
+ 3817 329e C5FC2895 		vmovaps	-144(%rbp), %ymm2
+ 3817      70FFFFFF 
+ 3818 32a6 31C0     		xorl	%eax, %eax
+ 3819 32a8 0F1F8400 		.p2align 4,,10
+ 3819      00000000 
+ 3820              		.p2align 3
+ 3821              	.L402:
+ 3822 32b0 C4C17C10 		vmovups	(%r14,%rax), %ymm5
+ 3822      2C06
+ 3823 32b6 C5D45904 		vmulps	(%rsi,%rax), %ymm5, %ymm0
+ 3823      06
+ 3824 32bb C5FC5DC3 		vminps	%ymm3, %ymm0, %ymm0
+ 3825 32bf C5FC5FC2 		vmaxps	%ymm2, %ymm0, %ymm0
+ 3826 32c3 C4C17C29 		vmovaps	%ymm0, (%r12,%rax)
+ 3826      0404
+ 3827 32c9 4883C020 		addq	$32, %rax
+ 3828 32cd 483D0001 		cmpq	$256, %rax
+ 3828      0000
+ 3829 32d3 75DB     		jne	.L402
+ 3830 32d5 4501DA   		addl	%r11d, %r10d
+ 3831 32d8 4D85ED   		testq	%r13, %r13
+ 3832 32db 0F845EFF 		je	.L414
+ 3832      FFFF
+ 3833              	.L425:
+ 3834 32e1 8B45C4   		movl	-60(%rbp), %eax
+ 3835 32e4 4989DE   		movq	%rbx, %r14
+ 3836 32e7 4C89CB   		movq	%r9, %rbx
+ 3837 32ea 85C0     		testl	%eax, %eax
+ 3838 32ec 740F     		je	.L410
+ 3839 32ee 418B463C 		movl	60(%r14), %eax
+ 3840 32f2 83C040   		addl	$64, %eax
+ 3841 32f5 99       		cltd
+ 3842 32f6 41F7FB   		idivl	%r11d
+ 3843 32f9 4189563C 		movl	%edx, 60(%r14)
+ 3844              	.L410:
+ 3845 32fd 498B7678 		movq	120(%r14), %rsi
+ 3846 3301 4885F6   		testq	%rsi, %rsi
+ 3847 3304 0F841603 		je	.L421
+ 3847      0000
+ 3848 330a C4C17A10 		vmovss	64(%r14), %xmm0
+ 3848      4640
+ 3849 3310 C5F877   		vzeroupper
+ 3850 3313 4889DF   		movq	%rbx, %rdi
+ 3851 3316 4881C488 		addq	$136, %rsp
+ 3851      000000
+ 3852 331d 5B       		popq	%rbx
+ 3853 331e 415C     		popq	%r12
+ 3854 3320 B9400000 		movl	$64, %ecx
+ 3854      00
+ 3855 3325 BA020000 		movl	$2, %edx
+ 3855      00
+ 3856 332a 415D     		popq	%r13
+ 3857              		.cfi_remember_state
+ 3858              		.cfi_def_cfa 13, 0
+ 3859 332c 415E     		popq	%r14
+ 3860 332e 415F     		popq	%r15
+ 3861 3330 5D       		popq	%rbp
+ 3862 3331 498D65F0 		leaq	-16(%r13), %rsp
+ 3863              		.cfi_def_cfa 7, 16
+ 3864 3335 415D     		popq	%r13
+ 3865              		.cfi_def_cfa_offset 8
+ 3866 3337 E994DFFF 		jmp	limit
+ 3866      FF
+ 3867 333c 0F1F4000 		.p2align 4,,10
+ 3868              		.p2align 3
+ 3869              	.L398:
+ 3870              		.cfi_restore_state
+ 3871 3340 428B84AB 		movl	128(%rbx,%r13,4), %eax
+ 3871      80000000 
+ 3872 3348 4139C3   		cmpl	%eax, %r11d
+ 3873 334b 0F8E33FF 		jle	.L399
+ 3873      FFFF
+ 3874 3351 8B55C4   		movl	-60(%rbp), %edx
+ 3875 3354 83C040   		addl	$64, %eax
+ 3876 3357 428984AB 		movl	%eax, 128(%rbx,%r13,4)
+ 3876      80000000 
+ 3877 335f 85D2     		testl	%edx, %edx
+ 3878 3361 0F8428FF 		je	.L427
+ 3878      FFFF
+ 3879              	.L400:
+ 3880 3367 4963C2   		movslq	%r10d, %rax
+ 3881 336a 4589DF   		movl	%r11d, %r15d
+ 3882 336d BA400000 		movl	$64, %edx
+ 3882      00
+ 3883 3372 4C894D98 		movq	%r9, -104(%rbp)
+ 3884 3376 488D0C81 		leaq	(%rcx,%rax,4), %rcx
+ 3885 337a 4863433C 		movslq	60(%rbx), %rax
+ 3886 337e 448955A0 		movl	%r10d, -96(%rbp)
+ 3887 3382 44895DAC 		movl	%r11d, -84(%rbp)
+ 3888 3386 4129C7   		subl	%eax, %r15d
+ 3889 3389 48894DC8 		movq	%rcx, -56(%rbp)
+ 3890 338d 488D3C81 		leaq	(%rcx,%rax,4), %rdi
+ 3891 3391 4139D7   		cmpl	%edx, %r15d
+ 3892 3394 488975B8 		movq	%rsi, -72(%rbp)
+ 3893 3398 440F4FFA 		cmovg	%edx, %r15d
+ 3894 339c 4963D7   		movslq	%r15d, %rdx
+ 3895 339f 4C8D0495 		leaq	0(,%rdx,4), %r8
+ 3895      00000000 
+ 3896 33a7 4C8945B0 		movq	%r8, -80(%rbp)
+ 3897 33ab 4C89C2   		movq	%r8, %rdx
+ 3898 33ae C5F877   		vzeroupper
+ 3899 33b1 E8000000 		call	memcpy@PLT
+ 3899      00
+ 3900 33b6 488B75B8 		movq	-72(%rbp), %rsi
+ 3901 33ba 4C8B45B0 		movq	-80(%rbp), %r8
+ 3902 33be B8400000 		movl	$64, %eax
+ 3902      00
+ 3903 33c3 488B7DC8 		movq	-56(%rbp), %rdi
+ 3904 33c7 4429F8   		subl	%r15d, %eax
+ 3905 33ca 4C01C6   		addq	%r8, %rsi
+ 3906 33cd 4898     		cltq
+ 3907 33cf 488D1485 		leaq	0(,%rax,4), %rdx
+ 3907      00000000 
+ 3908 33d7 E8000000 		call	memcpy@PLT
+ 3908      00
+ 3909 33dc 488B45C8 		movq	-56(%rbp), %rax
+ 3910 33e0 488BBD68 		movq	-152(%rbp), %rdi
+ 3910      FFFFFF
+ 3911 33e7 B9400000 		movl	$64, %ecx
+ 3911      00
+ 3912 33ec 837B1401 		cmpl	$1, 20(%rbx)
+ 3913 33f0 448B5DAC 		movl	-84(%rbp), %r11d
+ 3914 33f4 448B55A0 		movl	-96(%rbp), %r10d
+ 3915 33f8 4C8B4D98 		movq	-104(%rbp), %r9
+ 3916 33fc 488D3438 		leaq	(%rax,%rdi), %rsi
+ 3917 3400 0F84E200 		je	.L428
+ 3917      0000
+ 3918 3406 8B45A8   		movl	-88(%rbp), %eax
+ 3919 3409 488B7B30 		movq	48(%rbx), %rdi
+ 3920 340d 488D4B18 		leaq	24(%rbx), %rcx
+ 3921 3411 4C894D98 		movq	%r9, -104(%rbp)
+ 3922 3415 448955A0 		movl	%r10d, -96(%rbp)
+ 3923 3419 448D783F 		leal	63(%rax), %r15d
+ 3924 341d 8B8564FF 		movl	-156(%rbp), %eax
+ 3924      FFFF
+ 3925 3423 442B7B10 		subl	16(%rbx), %r15d
+ 3926 3427 44895DAC 		movl	%r11d, -84(%rbp)
+ 3927 342b 48894DB0 		movq	%rcx, -80(%rbp)
+ 3928 342f 4439F8   		cmpl	%r15d, %eax
+ 3929 3432 410F4FC7 		cmovg	%r15d, %eax
+ 3930 3436 4129C7   		subl	%eax, %r15d
+ 3931 3439 4863D0   		movslq	%eax, %rdx
+ 3932 343c 4D63FF   		movslq	%r15d, %r15
+ 3933 343f 48C1E202 		salq	$2, %rdx
+ 3934 3443 4A8D04BD 		leaq	0(,%r15,4), %rax
+ 3934      00000000 
+ 3935 344b 4C8D3C17 		leaq	(%rdi,%rdx), %r15
+ 3936 344f 488945B8 		movq	%rax, -72(%rbp)
+ 3937 3453 4D85F6   		testq	%r14, %r14
+ 3938 3456 0F843C01 		je	.L407
+ 3938      0000
+ 3939 345c E8000000 		call	memcpy@PLT
+ 3939      00
+ 3940 3461 488B55B8 		movq	-72(%rbp), %rdx
+ 3941 3465 488B75C8 		movq	-56(%rbp), %rsi
+ 3942 3469 4C89FF   		movq	%r15, %rdi
+ 3943 346c E8000000 		call	memcpy@PLT
+ 3943      00
+ 3944 3471 488B7330 		movq	48(%rbx), %rsi
+ 3945 3475 488B4DB0 		movq	-80(%rbp), %rcx
+ 3946 3479 4C89E7   		movq	%r12, %rdi
+ 3947 347c C5FA100D 		vmovss	.LC50(%rip), %xmm1
+ 3947      00000000 
+ 3948 3484 BA400000 		movl	$64, %edx
+ 3948      00
+ 3949 3489 C5FA1005 		vmovss	.LC22(%rip), %xmm0
+ 3949      00000000 
+ 3950 3491 E85ACDFF 		call	lagrange_gain_and_clip_block
+ 3950      FF
+ 3951 3496 448B5DAC 		movl	-84(%rbp), %r11d
+ 3952 349a 448B55A0 		movl	-96(%rbp), %r10d
+ 3953 349e 31C0     		xorl	%eax, %eax
+ 3954 34a0 C4E27D18 		vbroadcastss	-64(%rbp), %ymm3
+ 3954      5DC0
+ 3955 34a6 4C8B4D98 		movq	-104(%rbp), %r9
+ 3956 34aa C5FC2895 		vmovaps	-144(%rbp), %ymm2
+ 3956      70FFFFFF 
+ 3957              		.p2align 4,,10
+ 3958 34b2 660F1F44 		.p2align 3
+ 3958      0000
+ 3959              	.L408:
+ 3960 34b8 C4C17C10 		vmovups	(%r14,%rax), %ymm6
+ 3960      3406
+ 3961 34be C4C14C59 		vmulps	(%r12,%rax), %ymm6, %ymm0
+ 3961      0404
+ 3962 34c4 C5FC5DC3 		vminps	%ymm3, %ymm0, %ymm0
+ 3963 34c8 C5FC5FC2 		vmaxps	%ymm2, %ymm0, %ymm0
+ 3964 34cc C4C17C29 		vmovaps	%ymm0, (%r12,%rax)
+ 3964      0404
+ 3965 34d2 4883C020 		addq	$32, %rax
+ 3966 34d6 483D0001 		cmpq	$256, %rax
+ 3966      0000
+ 3967 34dc 75DA     		jne	.L408
+ 3968 34de E950FDFF 		jmp	.L397
+ 3968      FF
+ 3969              		.p2align 4,,10
+ 3970 34e3 0F1F4400 		.p2align 3
+ 3970      00
+ 3971              	.L428:
+ 3972 34e8 8B4590   		movl	-112(%rbp), %eax
+ 3973 34eb 488BBD58 		movq	-168(%rbp), %rdi
+ 3973      FFFFFF
+ 3974 34f2 4C894DA0 		movq	%r9, -96(%rbp)
+ 3975 34f6 448955AC 		movl	%r10d, -84(%rbp)
+ 3976 34fa 29C1     		subl	%eax, %ecx
+ 3977 34fc 44895DB0 		movl	%r11d, -80(%rbp)
+ 3978 3500 4D8D3C3C 		leaq	(%r12,%rdi), %r15
+ 3979 3504 894DB8   		movl	%ecx, -72(%rbp)
+ 3980 3507 4D85F6   		testq	%r14, %r14
+ 3981 350a 0F84D000 		je	.L406
+ 3981      0000
+ 3982 3510 C5FA1045 		vmovss	-64(%rbp), %xmm0
+ 3982      C0
+ 3983 3515 89C2     		movl	%eax, %edx
+ 3984 3517 4C89F1   		movq	%r14, %rcx
+ 3985 351a 4C89E7   		movq	%r12, %rdi
+ 3986 351d E88EDCFF 		call	ramp_and_clip_block
+ 3986      FF
+ 3987 3522 488BBD58 		movq	-168(%rbp), %rdi
+ 3987      FFFFFF
+ 3988 3529 C5FA1045 		vmovss	-64(%rbp), %xmm0
+ 3988      C0
+ 3989 352e 8B55B8   		movl	-72(%rbp), %edx
+ 3990 3531 488B75C8 		movq	-56(%rbp), %rsi
+ 3991 3535 498D0C3E 		leaq	(%r14,%rdi), %rcx
+ 3992 3539 4C89FF   		movq	%r15, %rdi
+ 3993 353c E86FDCFF 		call	ramp_and_clip_block
+ 3993      FF
+ 3994 3541 448B5DB0 		movl	-80(%rbp), %r11d
+ 3995 3545 448B55AC 		movl	-84(%rbp), %r10d
+ 3996 3549 4C8B4DA0 		movq	-96(%rbp), %r9
+ 3997 354d E9E1FCFF 		jmp	.L397
+ 3997      FF
+ 3998              		.p2align 4,,10
+ 3999 3552 660F1F44 		.p2align 3
+ 3999      0000
+ 4000              	.L401:
+ 4001 3558 C4E27D18 		vbroadcastss	(%rbx), %ymm4
+ 4001      23
+ 4002 355d 31C0     		xorl	%eax, %eax
+ 4003 355f C5FC2895 		vmovaps	-144(%rbp), %ymm2
+ 4003      70FFFFFF 
+ 4004 3567 660F1F84 		.p2align 4,,10
+ 4004      00000000 
+ 4004      00
+ 4005              		.p2align 3
+ 4006              	.L403:
+ 4007 3570 C5DC5904 		vmulps	(%rsi,%rax), %ymm4, %ymm0
+ 4007      06
+ 4008 3575 C5FC5DC3 		vminps	%ymm3, %ymm0, %ymm0
+ 4009 3579 C5FC5FC2 		vmaxps	%ymm2, %ymm0, %ymm0
+ 4010 357d C4C17C29 		vmovaps	%ymm0, (%r12,%rax)
+ 4010      0404
+ 4011 3583 4883C020 		addq	$32, %rax
+ 4012 3587 483D0001 		cmpq	$256, %rax
+ 4012      0000
+ 4013 358d 75E1     		jne	.L403
+ 4014 358f E99FFCFF 		jmp	.L397
+ 4014      FF
+ 4015              		.p2align 4,,10
+ 4016 3594 0F1F4000 		.p2align 3
+ 4017              	.L407:
+ 4018 3598 E8000000 		call	memcpy@PLT
+ 4018      00
+ 4019 359d 488B55B8 		movq	-72(%rbp), %rdx
+ 4020 35a1 488B75C8 		movq	-56(%rbp), %rsi
+ 4021 35a5 4C89FF   		movq	%r15, %rdi
+ 4022 35a8 E8000000 		call	memcpy@PLT
+ 4022      00
+ 4023 35ad 488B7330 		movq	48(%rbx), %rsi
+ 4024 35b1 488B4DB0 		movq	-80(%rbp), %rcx
+ 4025 35b5 4C89E7   		movq	%r12, %rdi
+ 4026 35b8 C5FA1003 		vmovss	(%rbx), %xmm0
+ 4027 35bc C5FA104D 		vmovss	-64(%rbp), %xmm1
+ 4027      C0
+ 4028 35c1 BA400000 		movl	$64, %edx
+ 4028      00
+ 4029 35c6 E825CCFF 		call	lagrange_gain_and_clip_block
+ 4029      FF
+ 4030 35cb 4C8B4D98 		movq	-104(%rbp), %r9
+ 4031 35cf 448B55A0 		movl	-96(%rbp), %r10d
+ 4032 35d3 448B5DAC 		movl	-84(%rbp), %r11d
+ 4033 35d7 E957FCFF 		jmp	.L397
+ 4033      FF
+ 4034 35dc 0F1F4000 		.p2align 4,,10
+ 4035              		.p2align 3
+ 4036              	.L406:
+ 4037 35e0 C5FA1003 		vmovss	(%rbx), %xmm0
+ 4038 35e4 C5FA104D 		vmovss	-64(%rbp), %xmm1
+ 4038      C0
+ 4039 35e9 4C89E7   		movq	%r12, %rdi
+ 4040 35ec 8B5590   		movl	-112(%rbp), %edx
+ 4041 35ef E8ACDAFF 		call	gain_and_clip_block
+ 4041      FF
+ 4042 35f4 8B55B8   		movl	-72(%rbp), %edx
+ 4043 35f7 488B75C8 		movq	-56(%rbp), %rsi
+ 4044 35fb 4C89FF   		movq	%r15, %rdi
+ 4045 35fe C5FA1003 		vmovss	(%rbx), %xmm0
+ 4046 3602 C5FA104D 		vmovss	-64(%rbp), %xmm1
+ 4046      C0
+ 4047 3607 E894DAFF 		call	gain_and_clip_block
+ 4047      FF
+ 4048 360c 448B5DB0 		movl	-80(%rbp), %r11d
+ 4049 3610 448B55AC 		movl	-84(%rbp), %r10d
+ 4050 3614 4C8B4DA0 		movq	-96(%rbp), %r9
+ 4051 3618 E916FCFF 		jmp	.L397
+ 4051      FF
+ 4052 361d 0F1F00   		.p2align 4,,10
+ 4053              		.p2align 3
+ 4054              	.L421:
+ 4055 3620 C5F877   		vzeroupper
+ 4056 3623 4881C488 		addq	$136, %rsp
+ 4056      000000
+ 4057 362a 5B       		popq	%rbx
+ 4058 362b 415C     		popq	%r12
+ 4059 362d 415D     		popq	%r13
+ 4060              		.cfi_remember_state
+ 4061              		.cfi_def_cfa 13, 0
+ 4062 362f 415E     		popq	%r14
+ 4063 3631 415F     		popq	%r15
+ 4064 3633 5D       		popq	%rbp
+ 4065 3634 498D65F0 		leaq	-16(%r13), %rsp
+ 4066              		.cfi_def_cfa 7, 16
+ 4067 3638 415D     		popq	%r13
+ 4068              		.cfi_def_cfa_offset 8
+ 4069 363a C3       		ret
+ 4070 363b 0F1F4400 		.p2align 4,,10
+ 4070      00
+ 4071              		.p2align 3
+ 4072              	.L424:
+ 4073              		.cfi_restore_state
+ 4074 3640 8B4DC4   		movl	-60(%rbp), %ecx
+ 4075 3643 31C0     		xorl	%eax, %eax
+ 4076 3645 C4C17A10 		vmovss	64(%r14), %xmm1
+ 4076      4E40
+ 4077 364b 85C9     		testl	%ecx, %ecx
+ 4078 364d 410F45C3 		cmovne	%r11d, %eax
+ 4079 3651 894594   		movl	%eax, -108(%rbp)
+ 4080 3654 E958FBFF 		jmp	.L395
+ 4080      FF
+ 4081              		.cfi_endproc
+ 4082              	.LFE6409:
+ 4084 3659 0F1F8000 		.p2align 4
+ 4084      000000
+ 4086              	gain_process_2_128:
+ 4087              	.LFB6410:
+ 4088              		.cfi_startproc
+ 4089 3660 4155     		pushq	%r13
+ 4090              		.cfi_def_cfa_offset 16
+ 4091              		.cfi_offset 13, -16
+ 4092 3662 4C8D6C24 		leaq	16(%rsp), %r13
+ 4092      10
+ 4093              		.cfi_def_cfa 13, 0
+ 4094 3667 4883E4E0 		andq	$-32, %rsp
+ 4095 366b 41FF75F8 		pushq	-8(%r13)
+ 4096 366f 55       		pushq	%rbp
+ 4097 3670 4889E5   		movq	%rsp, %rbp
+ 4098              		.cfi_escape 0x10,0x6,0x2,0x76,0
+ 4099 3673 4157     		pushq	%r15
+ 4100 3675 4156     		pushq	%r14
+ 4101 3677 4155     		pushq	%r13
+ 4102              		.cfi_escape 0xf,0x3,0x76,0x68,0x6
+ 4103              		.cfi_escape 0x10,0xf,0x2,0x76,0x78
+ 4104              		.cfi_escape 0x10,0xe,0x2,0x76,0x70
+ 4105 3679 4154     		pushq	%r12
+ 4106 367b 53       		pushq	%rbx
+ 4107              		.cfi_escape 0x10,0xc,0x2,0x76,0x60
+ 4108              		.cfi_escape 0x10,0x3,0x2,0x76,0x58
+ 4109 367c 4889FB   		movq	%rdi, %rbx
+ 4110 367f 4881EC88 		subq	$136, %rsp
+ 4110      000000
+ 4111 3686 81BFA400 		cmpl	$128, 164(%rdi)
+ 4111      00008000 
+ 4111      0000
+ 4112 3690 7514     		jne	.L430
+ 4113 3692 488B4708 		movq	8(%rdi), %rax
+ 4114 3696 480B4748 		orq	72(%rdi), %rax
+ 4115 369a 480B4710 		orq	16(%rdi), %rax
+ 4116 369e 480B4750 		orq	80(%rdi), %rax
+ 4117 36a2 A81F     		testb	$31, %al
+ 4118 36a4 7422     		je	.L459
+ 4119              	.L430:
+ 4120 36a6 4881C488 		addq	$136, %rsp
+ 4120      000000
+ 4121 36ad 4889DF   		movq	%rbx, %rdi
+ 4122 36b0 5B       		popq	%rbx
+ 4123 36b1 415C     		popq	%r12
+ 4124 36b3 415D     		popq	%r13
+ 4125              		.cfi_remember_state
+ 4126              		.cfi_def_cfa 13, 0
+ 4127 36b5 415E     		popq	%r14
+ 4128 36b7 415F     		popq	%r15
+ 4129 36b9 5D       		popq	%rbp
+ 4130 36ba 498D65F0 		leaq	-16(%r13), %rsp
+ 4131              		.cfi_def_cfa 7, 16
+ 4132 36be 415D     		popq	%r13
+ 4133              		.cfi_def_cfa_offset 8
+ 4134 36c0 E9000000 		jmp	gain_process@PLT
+ 4134      00
+ 4135              		.p2align 4,,10
+ 4136 36c5 0F1F00   		.p2align 3
+ 4137              	.L459:
+ 4138              		.cfi_restore_state
+ 4139 36c8 4C8BB7C0 		movq	192(%rdi), %r14
+ 4139      000000
+ 4140 36cf BE800000 		movl	$128, %esi
+ 4140      00
+ 4141 36d4 418B4614 		movl	20(%r14), %eax
+ 4142 36d8 41034610 		addl	16(%r14), %eax
+ 4143 36dc 458B5E38 		movl	56(%r14), %r11d
+ 4144 36e0 8D78FF   		leal	-1(%rax), %edi
+ 4145 36e3 8945A8   		movl	%eax, -88(%rbp)
+ 4146 36e6 418B463C 		movl	60(%r14), %eax
+ 4147 36ea 897DC4   		movl	%edi, -60(%rbp)
+ 4148 36ed 44895DC8 		movl	%r11d, -56(%rbp)
+ 4149 36f1 4401D8   		addl	%r11d, %eax
+ 4150 36f4 29F8     		subl	%edi, %eax
+ 4151 36f6 4C89F7   		movq	%r14, %rdi
+ 4152 36f9 99       		cltd
+ 4153 36fa 41F7FB   		idivl	%r11d
+ 4154 36fd 4489D8   		movl	%r11d, %eax
+ 4155 3700 4C63E2   		movslq	%edx, %r12
+ 4156 3703 4429E0   		subl	%r12d, %eax
+ 4157 3706 89C1     		movl	%eax, %ecx
+ 4158 3708 898564FF 		movl	%eax, -156(%rbp)
+ 4158      FFFF
+ 4159 370e B8800000 		movl	$128, %eax
+ 4159      00
+ 4160 3713 39C1     		cmpl	%eax, %ecx
+ 4161 3715 0F4EC1   		cmovle	%ecx, %eax
+ 4162 3718 894590   		movl	%eax, -112(%rbp)
+ 4163 371b E8E0C8FF 		call	gain_ramp
+ 4163      FF
+ 4164 3720 49837E78 		cmpq	$0, 120(%r14)
+ 4164      00
+ 4165 3725 448B5DC8 		movl	-56(%rbp), %r11d
+ 4166 3729 4989C1   		movq	%rax, %r9
+ 4167 372c 0F847E04 		je	.L460
+ 4167      0000
+ 4168 3732 C74594FF 		movl	$2147483647, -108(%rbp)
+ 4168      FFFF7F
+ 4169 3739 C5FA100D 		vmovss	.LC50(%rip), %xmm1
+ 4169      00000000 
+ 4170              	.L431:
+ 4171 3741 4889DF   		movq	%rbx, %rdi
+ 4172 3744 4531C0   		xorl	%r8d, %r8d
+ 4173 3747 4C89F3   		movq	%r14, %rbx
+ 4174 374a 4531D2   		xorl	%r10d, %r10d
+ 4175 374d 4A8D04A5 		leaq	0(,%r12,4), %rax
+ 4175      00000000 
+ 4176 3755 4D89CE   		movq	%r9, %r14
+ 4177 3758 4D89C5   		movq	%r8, %r13
+ 4178 375b 4989F9   		movq	%rdi, %r9
+ 4179 375e 48898568 		movq	%rax, -152(%rbp)
+ 4179      FFFFFF
+ 4180 3765 48634590 		movslq	-112(%rbp), %rax
+ 4181 3769 C5F05715 		vxorps	.LC2(%rip), %xmm1, %xmm2
+ 4181      00000000 
+ 4182 3771 C5FA114D 		vmovss	%xmm1, -64(%rbp)
+ 4182      C0
+ 4183 3776 48C1E002 		salq	$2, %rax
+ 4184 377a C4E27D18 		vbroadcastss	%xmm2, %ymm2
+ 4184      D2
+ 4185 377f 48898558 		movq	%rax, -168(%rbp)
+ 4185      FFFFFF
+ 4186 3786 C5FC2995 		vmovaps	%ymm2, -144(%rbp)
+ 4186      70FFFFFF 
+ 4187 378e EB2F     		jmp	.L445
+ 4188              		.p2align 4,,10
+ 4189              		.p2align 3
+ 4190              	.L462:
+ 4191 3790 8B7D94   		movl	-108(%rbp), %edi
+ 4192 3793 4239BCAB 		cmpl	%edi, 128(%rbx,%r13,4)
+ 4192      80000000 
+ 4193 379b 7C49     		jl	.L432
+ 4194 379d B9400000 		movl	$64, %ecx
+ 4194      00
+ 4195 37a2 31C0     		xorl	%eax, %eax
+ 4196 37a4 4C89E7   		movq	%r12, %rdi
+ 4197 37a7 C60201   		movb	$1, (%rdx)
+ 4198 37aa F348AB   		rep stosq
+ 4199              	.L433:
+ 4200 37ad 4501DA   		addl	%r11d, %r10d
+ 4201 37b0 4D85ED   		testq	%r13, %r13
+ 4202 37b3 0F85A000 		jne	.L461
+ 4202      0000
+ 4203              	.L450:
+ 4204 37b9 41BD0100 		movl	$1, %r13d
+ 4204      0000
+ 4205              	.L445:
+ 4206 37bf 498B8188 		movq	136(%r9), %rax
+ 4206      000000
+ 4207 37c6 498B9190 		movq	144(%r9), %rdx
+ 4207      000000
+ 4208 37cd 4B8B74E9 		movq	8(%r9,%r13,8), %rsi
+ 4208      08
+ 4209 37d2 4F8B64E9 		movq	72(%r9,%r13,8), %r12
+ 4209      48
+ 4210 37d7 4C01E8   		addq	%r13, %rax
+ 4211 37da 4C01EA   		addq	%r13, %rdx
+ 4212 37dd 488B4B28 		movq	40(%rbx), %rcx
+ 4213 37e1 803800   		cmpb	$0, (%rax)
+ 4214 37e4 75AA     		jne	.L462
+ 4215              	.L432:
+ 4216 37e6 C60200   		movb	$0, (%rdx)
+ 4217 37e9 803800   		cmpb	$0, (%rax)
+ 4218 37ec 0F85C600 		jne	.L434
+ 4218      0000
+ 4219 37f2 42C784AB 		movl	$0, 128(%rbx,%r13,4)
+ 4219      80000000 
+ 4219      00000000 
+ 4220              	.L435:
+ 4221 37fe 8B55C4   		movl	-60(%rbp), %edx
+ 4222 3801 85D2     		testl	%edx, %edx
+ 4223 3803 0F85D600 		jne	.L436
+ 4223      0000
+ 4224              	.L463:
+ 4225 3809 C4E27D18 		vbroadcastss	-64(%rbp), %ymm3
+ 4225      5DC0
+ 4226 380f 4D85F6   		testq	%r14, %r14
+ 4227 3812 0F84B802 		je	.L437
+ 4227      0000
+ 4228 3818 C5FC2895 		vmovaps	-144(%rbp), %ymm2
+ 4228      70FFFFFF 
+ 4229 3820 31C0     		xorl	%eax, %eax
+ 4230              		.p2align 4,,10
+ 4231 3822 660F1F44 		.p2align 3
+ 4231      0000
+ 4232              	.L438:
+ 4233 3828 C4C17C10 		vmovups	(%r14,%rax), %ymm5
+ 4233      2C06
+ 4234 382e C5D45904 		vmulps	(%rsi,%rax), %ymm5, %ymm0
+ 4234      06
+ 4235 3833 C5FC5DC3 		vminps	%ymm3, %ymm0, %ymm0
+ 4236 3837 C5FC5FC2 		vmaxps	%ymm2, %ymm0, %ymm0
+ 4237 383b C4C17C29 		vmovaps	%ymm0, (%r12,%rax)
+ 4237      0404
+ 4238 3841 4883C020 		addq	$32, %rax
+ 4239 3845 483D0002 		cmpq	$512, %rax
+ 4239      0000
+ 4240 384b 75DB     		jne	.L438
+ 4241 384d 4501DA   		addl	%r11d, %r10d
+ 4242 3850 4D85ED   		testq	%r13, %r13
+ 4243 3853 0F8460FF 		je	.L450
+ 4243      FFFF
+ 4244              	.L461:
+ 4245 3859 8B45C4   		movl	-60(%rbp), %eax
+ 4246 385c 4989DE   		movq	%rbx, %r14
+ 4247 385f 4C89CB   		movq	%r9, %rbx
+ 4248 3862 85C0     		testl	%eax, %eax
+ 4249 3864 740F     		je	.L446
+ 4250 3866 418B463C 		movl	60(%r14), %eax
+ 4251 386a 83E880   		subl	$-128, %eax
+ 4252 386d 99       		cltd
+ 4253 386e 41F7FB   		idivl	%r11d
+ 4254 3871 4189563C 		movl	%edx, 60(%r14)
+ 4255              	.L446:
+ 4256 3875 498B7678 		movq	120(%r14), %rsi
+ 4257 3879 4885F6   		testq	%rsi, %rsi
+ 4258 387c 0F840E03 		je	.L457
+ 4258      0000
+ 4259 3882 C4C17A10 		vmovss	64(%r14), %xmm0
+ 4259      4640
+ 4260 3888 C5F877   		vzeroupper
+ 4261 388b 4889DF   		movq	%rbx, %rdi
+ 4262 388e 4881C488 		addq	$136, %rsp
+ 4262      000000
+ 4263 3895 5B       		popq	%rbx
+ 4264 3896 415C     		popq	%r12
+ 4265 3898 B9800000 		movl	$128, %ecx
+ 4265      00
+ 4266 389d BA020000 		movl	$2, %edx
+ 4266      00
+ 4267 38a2 415D     		popq	%r13
+ 4268              		.cfi_remember_state
+ 4269              		.cfi_def_cfa 13, 0
+ 4270 38a4 415E     		popq	%r14
+ 4271 38a6 415F     		popq	%r15
+ 4272 38a8 5D       		popq	%rbp
+ 4273 38a9 498D65F0 		leaq	-16(%r13), %rsp
+ 4274              		.cfi_def_cfa 7, 16
+ 4275 38ad 415D     		popq	%r13
+ 4276              		.cfi_def_cfa_offset 8
+ 4277 38af E91CDAFF 		jmp	limit
+ 4277      FF
+ 4278              		.p2align 4,,10
+ 4279 38b4 0F1F4000 		.p2align 3
+ 4280              	.L434:
+ 4281              		.cfi_restore_state
+ 4282 38b8 428B84AB 		movl	128(%rbx,%r13,4), %eax
+ 4282      80000000 
+ 4283 38c0 4139C3   		cmpl	%eax, %r11d
+ 4284 38c3 0F8E35FF 		jle	.L435
+ 4284      FFFF
+ 4285 38c9 8B55C4   		movl	-60(%rbp), %edx
+ 4286 38cc 83E880   		subl	$-128, %eax
+ 4287 38cf 428984AB 		movl	%eax, 128(%rbx,%r13,4)
+ 4287      80000000 
+ 4288 38d7 85D2     		testl	%edx, %edx
+ 4289 38d9 0F842AFF 		je	.L463
+ 4289      FFFF
+ 4290              	.L436:
+ 4291 38df 4963C2   		movslq	%r10d, %rax
+ 4292 38e2 4589DF   		movl	%r11d, %r15d
+ 4293 38e5 BA800000 		movl	$128, %edx
+ 4293      00
+ 4294 38ea 4C894D98 		movq	%r9, -104(%rbp)
+ 4295 38ee 488D0C81 		leaq	(%rcx,%rax,4), %rcx
+ 4296 38f2 4863433C 		movslq	60(%rbx), %rax
+ 4297 38f6 448955A0 		movl	%r10d, -96(%rbp)
+ 4298 38fa 44895DAC 		movl	%r11d, -84(%rbp)
+ 4299 38fe 4129C7   		subl	%eax, %r15d
+ 4300 3901 48894DC8 		movq	%rcx, -56(%rbp)
+ 4301 3905 488D3C81 		leaq	(%rcx,%rax,4), %rdi
+ 4302 3909 4139D7   		cmpl	%edx, %r15d
+ 4303 390c 488975B8 		movq	%rsi, -72(%rbp)
+ 4304 3910 440F4FFA 		cmovg	%edx, %r15d
+ 4305 3914 4963D7   		movslq	%r15d, %rdx
+ 4306 3917 4C8D0495 		leaq	0(,%rdx,4), %r8
+ 4306      00000000 
+ 4307 391f 4C8945B0 		movq	%r8, -80(%rbp)
+ 4308 3923 4C89C2   		movq	%r8, %rdx
+ 4309 3926 C5F877   		vzeroupper
+ 4310 3929 E8000000 		call	memcpy@PLT
+ 4310      00
+ 4311 392e 488B75B8 		movq	-72(%rbp), %rsi
+ 4312 3932 4C8B45B0 		movq	-80(%rbp), %r8
+ 4313 3936 B8800000 		movl	$128, %eax
+ 4313      00
+ 4314 393b 488B7DC8 		movq	-56(%rbp), %rdi
+ 4315 393f 4429F8   		subl	%r15d, %eax
+ 4316 3942 4C01C6   		addq	%r8, %rsi
+ 4317 3945 4898     		cltq
+ 4318 3947 488D1485 		leaq	0(,%rax,4), %rdx
+ 4318      00000000 
+ 4319 394f E8000000 		call	memcpy@PLT
+ 4319      00
+ 4320 3954 488B45C8 		movq	-56(%rbp), %rax
+ 4321 3958 488BBD68 		movq	-152(%rbp), %rdi
+ 4321      FFFFFF
+ 4322 395f B9800000 		movl	$128, %ecx
+ 4322      00
+ 4323 3964 837B1401 		cmpl	$1, 20(%rbx)
+ 4324 3968 448B5DAC 		movl	-84(%rbp), %r11d
+ 4325 396c 448B55A0 		movl	-96(%rbp), %r10d
+ 4326 3970 4C8B4D98 		movq	-104(%rbp), %r9
+ 4327 3974 488D3438 		leaq	(%rax,%rdi), %rsi
+ 4328 3978 0F84E200 		je	.L464
+ 4328      0000
+ 4329 397e 8B45A8   		movl	-88(%rbp), %eax
+ 4330 3981 488B7B30 		movq	48(%rbx), %rdi
+ 4331 3985 488D4B18 		leaq	24(%rbx), %rcx
+ 4332 3989 4C894D98 		movq	%r9, -104(%rbp)
+ 4333 398d 448955A0 		movl	%r10d, -96(%rbp)
+ 4334 3991 448D787F 		leal	127(%rax), %r15d
+ 4335 3995 8B8564FF 		movl	-156(%rbp), %eax
+ 4335      FFFF
+ 4336 399b 442B7B10 		subl	16(%rbx), %r15d
+ 4337 399f 44895DAC 		movl	%r11d, -84(%rbp)
+ 4338 39a3 48894DB0 		movq	%rcx, -80(%rbp)
+ 4339 39a7 4439F8   		cmpl	%r15d, %eax
+ 4340 39aa 410F4FC7 		cmovg	%r15d, %eax
+ 4341 39ae 4129C7   		subl	%eax, %r15d
+ 4342 39b1 4863D0   		movslq	%eax, %rdx
+ 4343 39b4 4D63FF   		movslq	%r15d, %r15
+ 4344 39b7 48C1E202 		salq	$2, %rdx
+ 4345 39bb 4A8D04BD 		leaq	0(,%r15,4), %rax
+ 4345      00000000 
+ 4346 39c3 4C8D3C17 		leaq	(%rdi,%rdx), %r15
+ 4347 39c7 488945B8 		movq	%rax, -72(%rbp)
+ 4348 39cb 4D85F6   		testq	%r14, %r14
+ 4349 39ce 0F843401 		je	.L443
+ 4349      0000
+ 4350 39d4 E8000000 		call	memcpy@PLT
+ 4350      00
+ 4351 39d9 488B55B8 		movq	-72(%rbp), %rdx
+ 4352 39dd 488B75C8 		movq	-56(%rbp), %rsi
+ 4353 39e1 4C89FF   		movq	%r15, %rdi
+ 4354 39e4 E8000000 		call	memcpy@PLT
+ 4354      00
+ 4355 39e9 488B7330 		movq	48(%rbx), %rsi
+ 4356 39ed 488B4DB0 		movq	-80(%rbp), %rcx
+ 4357 39f1 4C89E7   		movq	%r12, %rdi
+ 4358 39f4 C5FA100D 		vmovss	.LC50(%rip), %xmm1
+ 4358      00000000 
+ 4359 39fc BA800000 		movl	$128, %edx
+ 4359      00
+ 4360 3a01 C5FA1005 		vmovss	.LC22(%rip), %xmm0
+ 4360      00000000 
+ 4361 3a09 E8E2C7FF 		call	lagrange_gain_and_clip_block
+ 4361      FF
+ 4362 3a0e 448B5DAC 		movl	-84(%rbp), %r11d
+ 4363 3a12 448B55A0 		movl	-96(%rbp), %r10d
+ 4364 3a16 31C0     		xorl	%eax, %eax
+ 4365 3a18 C4E27D18 		vbroadcastss	-64(%rbp), %ymm3
+ 4365      5DC0
+ 4366 3a1e 4C8B4D98 		movq	-104(%rbp), %r9
+ 4367 3a22 C5FC2895 		vmovaps	-144(%rbp), %ymm2
+ 4367      70FFFFFF 
+ 4368 3a2a 660F1F44 		.p2align 4,,10
+ 4368      0000
+ 4369              		.p2align 3
+ 4370              	.L444:
+ 4371 3a30 C4C17C10 		vmovups	(%r14,%rax), %ymm6
+ 4371      3406
+ 4372 3a36 C4C14C59 		vmulps	(%r12,%rax), %ymm6, %ymm0
+ 4372      0404
+ 4373 3a3c C5FC5DC3 		vminps	%ymm3, %ymm0, %ymm0
+ 4374 3a40 C5FC5FC2 		vmaxps	%ymm2, %ymm0, %ymm0
+ 4375 3a44 C4C17C29 		vmovaps	%ymm0, (%r12,%rax)
+ 4375      0404
+ 4376 3a4a 4883C020 		addq	$32, %rax
+ 4377 3a4e 483D0002 		cmpq	$512, %rax
+ 4377      0000
+ 4378 3a54 75DA     		jne	.L444
+ 4379 3a56 E952FDFF 		jmp	.L433
+ 4379      FF
+ 4380 3a5b 0F1F4400 		.p2align 4,,10
+ 4380      00
+ 4381              		.p2align 3
+ 4382              	.L464:
+ 4383 3a60 8B4590   		movl	-112(%rbp), %eax
+ 4384 3a63 488BBD58 		movq	-168(%rbp), %rdi
+ 4384      FFFFFF
+ 4385 3a6a 4C894DA0 		movq	%r9, -96(%rbp)
+ 4386 3a6e 448955AC 		movl	%r10d, -84(%rbp)
+ 4387 3a72 29C1     		subl	%eax, %ecx
+ 4388 3a74 44895DB0 		movl	%r11d, -80(%rbp)
+ 4389 3a78 4D8D3C3C 		leaq	(%r12,%rdi), %r15
+ 4390 3a7c 894DB8   		movl	%ecx, -72(%rbp)
+ 4391 3a7f 4D85F6   		testq	%r14, %r14
+ 4392 3a82 0F84C800 		je	.L442
+ 4392      0000
+ 4393 3a88 C5FA1045 		vmovss	-64(%rbp), %xmm0
+ 4393      C0
+ 4394 3a8d 89C2     		movl	%eax, %edx
+ 4395 3a8f 4C89F1   		movq	%r14, %rcx
+ 4396 3a92 4C89E7   		movq	%r12, %rdi
+ 4397 3a95 E816D7FF 		call	ramp_and_clip_block
+ 4397      FF
+ 4398 3a9a 488BBD58 		movq	-168(%rbp), %rdi
+ 4398      FFFFFF
+ 4399 3aa1 C5FA1045 		vmovss	-64(%rbp), %xmm0
+ 4399      C0
+ 4400 3aa6 8B55B8   		movl	-72(%rbp), %edx
+ 4401 3aa9 488B75C8 		movq	-56(%rbp), %rsi
+ 4402 3aad 498D0C3E 		leaq	(%r14,%rdi), %rcx
+ 4403 3ab1 4C89FF   		movq	%r15, %rdi
+ 4404 3ab4 E8F7D6FF 		call	ramp_and_clip_block
+ 4404      FF
+ 4405 3ab9 448B5DB0 		movl	-80(%rbp), %r11d
+ 4406 3abd 448B55AC 		movl	-84(%rbp), %r10d
+ 4407 3ac1 4C8B4DA0 		movq	-96(%rbp), %r9
+ 4408 3ac5 E9E3FCFF 		jmp	.L433
+ 4408      FF
+ 4409 3aca 660F1F44 		.p2align 4,,10
+ 4409      0000
+ 4410              		.p2align 3
+ 4411              	.L437:
+ 4412 3ad0 C4E27D18 		vbroadcastss	(%rbx), %ymm4
+ 4412      23
+ 4413 3ad5 31C0     		xorl	%eax, %eax
+ 4414 3ad7 C5FC2895 		vmovaps	-144(%rbp), %ymm2
+ 4414      70FFFFFF 
+ 4415 3adf 90       		.p2align 4,,10
+ 4416              		.p2align 3
+ 4417              	.L439:
+ 4418 3ae0 C5DC5904 		vmulps	(%rsi,%rax), %ymm4, %ymm0
+ 4418      06
+ 4419 3ae5 C5FC5DC3 		vminps	%ymm3, %ymm0, %ymm0
+ 4420 3ae9 C5FC5FC2 		vmaxps	%ymm2, %ymm0, %ymm0
+ 4421 3aed C4C17C29 		vmovaps	%ymm0, (%r12,%rax)
+ 4421      0404
+ 4422 3af3 4883C020 		addq	$32, %rax
+ 4423 3af7 483D0002 		cmpq	$512, %rax
+ 4423      0000
+ 4424 3afd 75E1     		jne	.L439
+ 4425 3aff E9A9FCFF 		jmp	.L433
+ 4425      FF
+ 4426              		.p2align 4,,10
+ 4427 3b04 0F1F4000 		.p2align 3
+ 4428              	.L443:
+ 4429 3b08 E8000000 		call	memcpy@PLT
+ 4429      00
+ 4430 3b0d 488B55B8 		movq	-72(%rbp), %rdx
+ 4431 3b11 488B75C8 		movq	-56(%rbp), %rsi
+ 4432 3b15 4C89FF   		movq	%r15, %rdi
+ 4433 3b18 E8000000 		call	memcpy@PLT
+ 4433      00
+ 4434 3b1d 488B7330 		movq	48(%rbx), %rsi
+ 4435 3b21 488B4DB0 		movq	-80(%rbp), %rcx
+ 4436 3b25 4C89E7   		movq	%r12, %rdi
+ 4437 3b28 C5FA1003 		vmovss	(%rbx), %xmm0
+ 4438 3b2c C5FA104D 		vmovss	-64(%rbp), %xmm1
+ 4438      C0
+ 4439 3b31 BA800000 		movl	$128, %edx
+ 4439      00
+ 4440 3b36 E8B5C6FF 		call	lagrange_gain_and_clip_block
+ 4440      FF
+ 4441 3b3b 4C8B4D98 		movq	-104(%rbp), %r9
+ 4442 3b3f 448B55A0 		movl	-96(%rbp), %r10d
+ 4443 3b43 448B5DAC 		movl	-84(%rbp), %r11d
+ 4444 3b47 E961FCFF 		jmp	.L433
+ 4444      FF
+ 4445 3b4c 0F1F4000 		.p2align 4,,10
+ 4446              		.p2align 3
+ 4447              	.L442:
+ 4448 3b50 C5FA1003 		vmovss	(%rbx), %xmm0
+ 4449 3b54 C5FA104D 		vmovss	-64(%rbp), %xmm1
+ 4449      C0
+ 4450 3b59 4C89E7   		movq	%r12, %rdi
+ 4451 3b5c 8B5590   		movl	-112(%rbp), %edx
+ 4452 3b5f E83CD5FF 		call	gain_and_clip_block
+ 4452      FF
+ 4453 3b64 8B55B8   		movl	-72(%rbp), %edx
+ 4454 3b67 488B75C8 		movq	-56(%rbp), %rsi
+ 4455 3b6b 4C89FF   		movq	%r15, %rdi
+ 4456 3b6e C5FA1003 		vmovss	(%rbx), %xmm0
+ 4457 3b72 C5FA104D 		vmovss	-64(%rbp), %xmm1
+ 4457      C0
+ 4458 3b77 E824D5FF 		call	gain_and_clip_block
+ 4458      FF
+ 4459 3b7c 448B5DB0 		movl	-80(%rbp), %r11d
+ 4460 3b80 448B55AC 		movl	-84(%rbp), %r10d
+ 4461 3b84 4C8B4DA0 		movq	-96(%rbp), %r9
+ 4462 3b88 E920FCFF 		jmp	.L433
+ 4462      FF
+ 4463 3b8d 0F1F00   		.p2align 4,,10
+ 4464              		.p2align 3
+ 4465              	.L457:
+ 4466 3b90 C5F877   		vzeroupper
+ 4467 3b93 4881C488 		addq	$136, %rsp
+ 4467      000000
+ 4468 3b9a 5B       		popq	%rbx
+ 4469 3b9b 415C     		popq	%r12
+ 4470 3b9d 415D     		popq	%r13
+ 4471              		.cfi_remember_state
+ 4472              		.cfi_def_cfa 13, 0
+ 4473 3b9f 415E     		popq	%r14
+ 4474 3ba1 415F     		popq	%r15
+ 4475 3ba3 5D       		popq	%rbp
+ 4476 3ba4 498D65F0 		leaq	-16(%r13), %rsp
+ 4477              		.cfi_def_cfa 7, 16
+ 4478 3ba8 415D     		popq	%r13
+ 4479              		.cfi_def_cfa_offset 8
+ 4480 3baa C3       		ret
+ 4481 3bab 0F1F4400 		.p2align 4,,10
+ 4481      00
+ 4482              		.p2align 3
+ 4483              	.L460:
+ 4484              		.cfi_restore_state
+ 4485 3bb0 8B4DC4   		movl	-60(%rbp), %ecx
+ 4486 3bb3 31C0     		xorl	%eax, %eax
+ 4487 3bb5 C4C17A10 		vmovss	64(%r14), %xmm1
+ 4487      4E40
+ 4488 3bbb 85C9     		testl	%ecx, %ecx
+ 4489 3bbd 410F45C3 		cmovne	%r11d, %eax
+ 4490 3bc1 894594   		movl	%eax, -108(%rbp)
+ 4491 3bc4 E978FBFF 		jmp	.L431
+ 4491      FF
+ 4492              		.cfi_endproc
+ 4493              	.LFE6410:
+ 4495 3bc9 0F1F8000 		.p2align 4
+ 4495      000000
+ 4497              	gain_process_8_128:
+ 4498              	.LFB6413:
+ 4499              		.cfi_startproc
+ 4500 3bd0 4155     		pushq	%r13
+ 4501              		.cfi_def_cfa_offset 16
+ 4502              		.cfi_offset 13, -16
+ 4503 3bd2 4C8D6C24 		leaq	16(%rsp), %r13
+ 4503      10
+ 4504              		.cfi_def_cfa 13, 0
+ 4505 3bd7 4883E4C0 		andq	$-64, %rsp
+ 4506 3bdb 41FF75F8 		pushq	-8(%r13)
+ 4507 3bdf 55       		pushq	%rbp
+ 4508 3be0 4889E5   		movq	%rsp, %rbp
+ 4509              		.cfi_escape 0x10,0x6,0x2,0x76,0
+ 4510 3be3 4157     		pushq	%r15
+ 4511 3be5 4156     		pushq	%r14
+ 4512 3be7 4155     		pushq	%r13
+ 4513              		.cfi_escape 0xf,0x3,0x76,0x68,0x6
+ 4514              		.cfi_escape 0x10,0xf,0x2,0x76,0x78
+ 4515              		.cfi_escape 0x10,0xe,0x2,0x76,0x70
+ 4516 3be9 4154     		pushq	%r12
+ 4517              		.cfi_escape 0x10,0xc,0x2,0x76,0x60
+ 4518 3beb 4989FC   		movq	%rdi, %r12
+ 4519 3bee 53       		pushq	%rbx
+ 4520 3bef 4881EC88 		subq	$136, %rsp
+ 4520      000000
+ 4521              		.cfi_escape 0x10,0x3,0x2,0x76,0x58
+ 4522 3bf6 81BFA400 		cmpl	$128, 164(%rdi)
+ 4522      00008000 
+ 4522      0000
+ 4523 3c00 7547     		jne	.L466
+ 4524 3c02 62F1FE48 		vmovdqu64	8(%rdi), %zmm5
+ 4524      6FAF0800 
+ 4524      0000
+ 4525 3c0c 62F1D548 		vporq	72(%rdi), %zmm5, %zmm0
+ 4525      EB874800 
+ 4525      0000
+ 4526 3c16 C5FD6FC8 		vmovdqa	%ymm0, %ymm1
+ 4527 3c1a 62F3FD48 		vextracti64x4	$0x1, %zmm0, %ymm0
+ 4527      3BC001
+ 4528 3c21 C5F5EBC8 		vpor	%ymm0, %ymm1, %ymm1
+ 4529 3c25 C5F96FC1 		vmovdqa	%xmm1, %xmm0
+ 4530 3c29 62F3FD28 		vextracti64x2	$0x1, %ymm1, %xmm1
+ 4530      39C901
+ 4531 3c30 C5F9EBC1 		vpor	%xmm1, %xmm0, %xmm0
+ 4532 3c34 C5F173D8 		vpsrldq	$8, %xmm0, %xmm1
+ 4532      08
+ 4533 3c39 C5F9EBC1 		vpor	%xmm1, %xmm0, %xmm0
+ 4534 3c3d C4E1F97E 		vmovq	%xmm0, %rax
+ 4534      C0
+ 4535 3c42 A81F     		testb	$31, %al
+ 4536 3c44 742A     		je	.L496
+ 4537 3c46 C5F877   		vzeroupper
+ 4538              	.L466:
+ 4539 3c49 4881C488 		addq	$136, %rsp
+ 4539      000000
+ 4540 3c50 4C89E7   		movq	%r12, %rdi
+ 4541 3c53 5B       		popq	%rbx
+ 4542 3c54 415C     		popq	%r12
+ 4543 3c56 415D     		popq	%r13
+ 4544              		.cfi_remember_state
+ 4545              		.cfi_def_cfa 13, 0
+ 4546 3c58 415E     		popq	%r14
+ 4547 3c5a 415F     		popq	%r15
+ 4548 3c5c 5D       		popq	%rbp
+ 4549 3c5d 498D65F0 		leaq	-16(%r13), %rsp
+ 4550              		.cfi_def_cfa 7, 16
+ 4551 3c61 415D     		popq	%r13
+ 4552              		.cfi_def_cfa_offset 8
+ 4553 3c63 E9000000 		jmp	gain_process@PLT
+ 4553      00
+ 4554 3c68 0F1F8400 		.p2align 4,,10
+ 4554      00000000 
+ 4555              		.p2align 3
+ 4556              	.L496:
+ 4557              		.cfi_restore_state
+ 4558 3c70 4C8BB7C0 		movq	192(%rdi), %r14
+ 4558      000000
+ 4559 3c77 BE800000 		movl	$128, %esi
+ 4559      00
+ 4560 3c7c 418B4614 		movl	20(%r14), %eax
+ 4561 3c80 41034610 		addl	16(%r14), %eax
+ 4562 3c84 458B5E38 		movl	56(%r14), %r11d
+ 4563 3c88 8D78FF   		leal	-1(%rax), %edi
+ 4564 3c8b 8945A8   		movl	%eax, -88(%rbp)
+ 4565 3c8e 418B463C 		movl	60(%r14), %eax
+ 4566 3c92 897DC4   		movl	%edi, -60(%rbp)
+ 4567 3c95 44895DC8 		movl	%r11d, -56(%rbp)
+ 4568 3c99 4401D8   		addl	%r11d, %eax
+ 4569 3c9c 29F8     		subl	%edi, %eax
+ 4570 3c9e 4C89F7   		movq	%r14, %rdi
+ 4571 3ca1 99       		cltd
+ 4572 3ca2 41F7FB   		idivl	%r11d
+ 4573 3ca5 4489D8   		movl	%r11d, %eax
+ 4574 3ca8 4863DA   		movslq	%edx, %rbx
+ 4575 3cab 29D8     		subl	%ebx, %eax
+ 4576 3cad 89C1     		movl	%eax, %ecx
+ 4577 3caf 898564FF 		movl	%eax, -156(%rbp)
+ 4577      FFFF
+ 4578 3cb5 B8800000 		movl	$128, %eax
+ 4578      00
+ 4579 3cba 39C1     		cmpl	%eax, %ecx
+ 4580 3cbc 0F4EC1   		cmovle	%ecx, %eax
+ 4581 3cbf 894590   		movl	%eax, -112(%rbp)
+ 4582 3cc2 C5F877   		vzeroupper
+ 4583 3cc5 E836C3FF 		call	gain_ramp
+ 4583      FF
+ 4584 3cca 49837E78 		cmpq	$0, 120(%r14)
+ 4584      00
+ 4585 3ccf 448B5DC8 		movl	-56(%rbp), %r11d
+ 4586 3cd3 4989C1   		movq	%rax, %r9
+ 4587 3cd6 0F849C04 		je	.L497
+ 4587      0000
+ 4588 3cdc C74594FF 		movl	$2147483647, -108(%rbp)
+ 4588      FFFF7F
+ 4589 3ce3 C5FA100D 		vmovss	.LC50(%rip), %xmm1
+ 4589      00000000 
+ 4590              	.L467:
+ 4591 3ceb 488D049D 		leaq	0(,%rbx,4), %rax
+ 4591      00000000 
+ 4592 3cf3 4C89E7   		movq	%r12, %rdi
+ 4593 3cf6 31DB     		xorl	%ebx, %ebx
+ 4594 3cf8 4D89F4   		movq	%r14, %r12
+ 4595 3cfb 48898568 		movq	%rax, -152(%rbp)
+ 4595      FFFFFF
+ 4596 3d02 48634590 		movslq	-112(%rbp), %rax
+ 4597 3d06 4D89CE   		movq	%r9, %r14
+ 4598 3d09 4531D2   		xorl	%r10d, %r10d
+ 4599 3d0c C5F05715 		vxorps	.LC2(%rip), %xmm1, %xmm2
+ 4599      00000000 
+ 4600 3d14 C5FA114D 		vmovss	%xmm1, -64(%rbp)
+ 4600      C0
+ 4601 3d19 4989F9   		movq	%rdi, %r9
+ 4602 3d1c 48C1E002 		salq	$2, %rax
+ 4603 3d20 C4E27D18 		vbroadcastss	%xmm2, %ymm2
+ 4603      D2
+ 4604 3d25 48898558 		movq	%rax, -168(%rbp)
+ 4604      FFFFFF
+ 4605 3d2c C5FC2995 		vmovaps	%ymm2, -144(%rbp)
+ 4605      70FFFFFF 
+ 4606 3d34 EB38     		jmp	.L481
+ 4607 3d36 662E0F1F 		.p2align 4,,10
+ 4607      84000000 
+ 4607      0000
+ 4608              		.p2align 3
+ 4609              	.L499:
+ 4610 3d40 8B7D94   		movl	-108(%rbp), %edi
+ 4611 3d43 4139BC9C 		cmpl	%edi, 128(%r12,%rbx,4)
+ 4611      80000000 
+ 4612 3d4b 7C49     		jl	.L468
+ 4613 3d4d B9400000 		movl	$64, %ecx
+ 4613      00
+ 4614 3d52 31C0     		xorl	%eax, %eax
+ 4615 3d54 4C89EF   		movq	%r13, %rdi
+ 4616 3d57 C60201   		movb	$1, (%rdx)
+ 4617 3d5a F348AB   		rep stosq
+ 4618              	.L469:
+ 4619 3d5d 4883C301 		addq	$1, %rbx
+ 4620 3d61 4501DA   		addl	%r11d, %r10d
+ 4621 3d64 4883FB08 		cmpq	$8, %rbx
+ 4622 3d68 0F84A100 		je	.L498
+ 4622      0000
+ 4623              	.L481:
+ 4624 3d6e 498B8188 		movq	136(%r9), %rax
+ 4624      000000
+ 4625 3d75 498B9190 		movq	144(%r9), %rdx
+ 4625      000000
+ 4626 3d7c 498B74D9 		movq	8(%r9,%rbx,8), %rsi
+ 4626      08
+ 4627 3d81 4D8B6CD9 		movq	72(%r9,%rbx,8), %r13
+ 4627      48
+ 4628 3d86 4801D8   		addq	%rbx, %rax
+ 4629 3d89 4801DA   		addq	%rbx, %rdx
+ 4630 3d8c 498B4C24 		movq	40(%r12), %rcx
+ 4630      28
+ 4631 3d91 803800   		cmpb	$0, (%rax)
+ 4632 3d94 75AA     		jne	.L499
+ 4633              	.L468:
+ 4634 3d96 C60200   		movb	$0, (%rdx)
+ 4635 3d99 803800   		cmpb	$0, (%rax)
+ 4636 3d9c 0F85CE00 		jne	.L470
+ 4636      0000
+ 4637 3da2 41C7849C 		movl	$0, 128(%r12,%rbx,4)
+ 4637      80000000 
+ 4637      00000000 
+ 4638              	.L471:
+ 4639 3dae 8B55C4   		movl	-60(%rbp), %edx
+ 4640 3db1 85D2     		testl	%edx, %edx
+ 4641 3db3 0F85DE00 		jne	.L472
+ 4641      0000
+ 4642              	.L500:
+ 4643 3db9 C4E27D18 		vbroadcastss	-64(%rbp), %ymm3
+ 4643      5DC0
+ 4644 3dbf 4D85F6   		testq	%r14, %r14
+ 4645 3dc2 0F84C802 		je	.L473
+ 4645      0000
+ 4646 3dc8 C5FC2895 		vmovaps	-144(%rbp), %ymm2
+ 4646      70FFFFFF 
+ 4647 3dd0 31C0     		xorl	%eax, %eax
+ 4648              		.p2align 4,,10
+ 4649 3dd2 660F1F44 		.p2align 3
+ 4649      0000
+ 4650              	.L474:
+ 4651 3dd8 C4C17C10 		vmovups	(%r14,%rax), %ymm6
+ 4651      3406
+ 4652 3dde C5CC5904 		vmulps	(%rsi,%rax), %ymm6, %ymm0
+ 4652      06
+ 4653 3de3 C5FC5DC3 		vminps	%ymm3, %ymm0, %ymm0
+ 4654 3de7 C5FC5FC2 		vmaxps	%ymm2, %ymm0, %ymm0
+ 4655 3deb C4C17C29 		vmovaps	%ymm0, 0(%r13,%rax)
+ 4655      440500
+ 4656 3df2 4883C020 		addq	$32, %rax
+ 4657 3df6 483D0002 		cmpq	$512, %rax
+ 4657      0000
+ 4658 3dfc 75DA     		jne	.L474
+ 4659 3dfe 4883C301 		addq	$1, %rbx
+ 4660 3e02 4501DA   		addl	%r11d, %r10d
+ 4661 3e05 4883FB08 		cmpq	$8, %rbx
+ 4662 3e09 0F855FFF 		jne	.L481
+ 4662      FFFF
+ 4663              	.L498:
+ 4664 3e0f 8B45C4   		movl	-60(%rbp), %eax
+ 4665 3e12 4D89E6   		movq	%r12, %r14
+ 4666 3e15 4D89CC   		movq	%r9, %r12
+ 4667 3e18 85C0     		testl	%eax, %eax
+ 4668 3e1a 740F     		je	.L482
+ 4669 3e1c 418B463C 		movl	60(%r14), %eax
+ 4670 3e20 83E880   		subl	$-128, %eax
+ 4671 3e23 99       		cltd
+ 4672 3e24 41F7FB   		idivl	%r11d
+ 4673 3e27 4189563C 		movl	%edx, 60(%r14)
+ 4674              	.L482:
+ 4675 3e2b 498B7678 		movq	120(%r14), %rsi
+ 4676 3e2f 4885F6   		testq	%rsi, %rsi
+ 4677 3e32 0F842003 		je	.L494
+ 4677      0000
+ 4678 3e38 C4C17A10 		vmovss	64(%r14), %xmm0
+ 4678      4640
+ 4679 3e3e C5F877   		vzeroupper
+ 4680 3e41 4C89E7   		movq	%r12, %rdi
+ 4681 3e44 4881C488 		addq	$136, %rsp
+ 4681      000000
+ 4682 3e4b 5B       		popq	%rbx
+ 4683 3e4c 415C     		popq	%r12
+ 4684 3e4e B9800000 		movl	$128, %ecx
+ 4684      00
+ 4685 3e53 BA080000 		movl	$8, %edx
+ 4685      00
+ 4686 3e58 415D     		popq	%r13
+ 4687              		.cfi_remember_state
+ 4688              		.cfi_def_cfa 13, 0
+ 4689 3e5a 415E     		popq	%r14
+ 4690 3e5c 415F     		popq	%r15
+ 4691 3e5e 5D       		popq	%rbp
+ 4692 3e5f 498D65F0 		leaq	-16(%r13), %rsp
+ 4693              		.cfi_def_cfa 7, 16
+ 4694 3e63 415D     		popq	%r13
+ 4695              		.cfi_def_cfa_offset 8
+ 4696 3e65 E966D4FF 		jmp	limit
+ 4696      FF
+ 4697 3e6a 660F1F44 		.p2align 4,,10
+ 4697      0000
+ 4698              		.p2align 3
+ 4699              	.L470:
+ 4700              		.cfi_restore_state
+ 4701 3e70 418B849C 		movl	128(%r12,%rbx,4), %eax
+ 4701      80000000 
+ 4702 3e78 4139C3   		cmpl	%eax, %r11d
+ 4703 3e7b 0F8E2DFF 		jle	.L471
+ 4703      FFFF
+ 4704 3e81 8B55C4   		movl	-60(%rbp), %edx
+ 4705 3e84 83E880   		subl	$-128, %eax
+ 4706 3e87 4189849C 		movl	%eax, 128(%r12,%rbx,4)
+ 4706      80000000 
+ 4707 3e8f 85D2     		testl	%edx, %edx
+ 4708 3e91 0F8422FF 		je	.L500
+ 4708      FFFF
+ 4709              	.L472:
+ 4710 3e97 4963C2   		movslq	%r10d, %rax
+ 4711 3e9a 4589DF   		movl	%r11d, %r15d
+ 4712 3e9d BA800000 		movl	$128, %edx
+ 4712      00
+ 4713 3ea2 4C894D98 		movq	%r9, -104(%rbp)
+ 4714 3ea6 488D0C81 		leaq	(%rcx,%rax,4), %rcx
+ 4715 3eaa 49634424 		movslq	60(%r12), %rax
+ 4715      3C
+ 4716 3eaf 448955A0 		movl	%r10d, -96(%rbp)
+ 4717 3eb3 44895DAC 		movl	%r11d, -84(%rbp)
+ 4718 3eb7 4129C7   		subl	%eax, %r15d
+ 4719 3eba 48894DC8 		movq	%rcx, -56(%rbp)
+ 4720 3ebe 488D3C81 		leaq	(%rcx,%rax,4), %rdi
+ 4721 3ec2 4139D7   		cmpl	%edx, %r15d
+ 4722 3ec5 488975B8 		movq	%rsi, -72(%rbp)
+ 4723 3ec9 440F4FFA 		cmovg	%edx, %r15d
+ 4724 3ecd 4963D7   		movslq	%r15d, %rdx
+ 4725 3ed0 4C8D0495 		leaq	0(,%rdx,4), %r8
+ 4725      00000000 
+ 4726 3ed8 4C8945B0 		movq	%r8, -80(%rbp)
+ 4727 3edc 4C89C2   		movq	%r8, %rdx
+ 4728 3edf C5F877   		vzeroupper
+ 4729 3ee2 E8000000 		call	memcpy@PLT
+ 4729      00
+ 4730 3ee7 488B75B8 		movq	-72(%rbp), %rsi
+ 4731 3eeb 4C8B45B0 		movq	-80(%rbp), %r8
+ 4732 3eef B8800000 		movl	$128, %eax
+ 4732      00
+ 4733 3ef4 488B7DC8 		movq	-56(%rbp), %rdi
+ 4734 3ef8 4429F8   		subl	%r15d, %eax
+ 4735 3efb 4C01C6   		addq	%r8, %rsi
+ 4736 3efe 4898     		cltq
+ 4737 3f00 488D1485 		leaq	0(,%rax,4), %rdx
+ 4737      00000000 
+ 4738 3f08 E8000000 		call	memcpy@PLT
+ 4738      00
+ 4739 3f0d 488B45C8 		movq	-56(%rbp), %rax
+ 4740 3f11 488BBD68 		movq	-152(%rbp), %rdi
+ 4740      FFFFFF
+ 4741 3f18 B9800000 		movl	$128, %ecx
+ 4741      00
+ 4742 3f1d 41837C24 		cmpl	$1, 20(%r12)
+ 4742      1401
+ 4743 3f23 448B5DAC 		movl	-84(%rbp), %r11d
+ 4744 3f27 448B55A0 		movl	-96(%rbp), %r10d
+ 4745 3f2b 4C8B4D98 		movq	-104(%rbp), %r9
+ 4746 3f2f 488D3438 		leaq	(%rax,%rdi), %rsi
+ 4747 3f33 0F84E700 		je	.L501
+ 4747      0000
+ 4748 3f39 8B45A8   		movl	-88(%rbp), %eax
+ 4749 3f3c 498B7C24 		movq	48(%r12), %rdi
+ 4749      30
+ 4750 3f41 498D4C24 		leaq	24(%r12), %rcx
+ 4750      18
+ 4751 3f46 4C894D98 		movq	%r9, -104(%rbp)
+ 4752 3f4a 448955A0 		movl	%r10d, -96(%rbp)
+ 4753 3f4e 448D787F 		leal	127(%rax), %r15d
+ 4754 3f52 8B8564FF 		movl	-156(%rbp), %eax
+ 4754      FFFF
+ 4755 3f58 452B7C24 		subl	16(%r12), %r15d
+ 4755      10
+ 4756 3f5d 44895DAC 		movl	%r11d, -84(%rbp)
+ 4757 3f61 48894DB0 		movq	%rcx, -80(%rbp)
+ 4758 3f65 4439F8   		cmpl	%r15d, %eax
+ 4759 3f68 410F4FC7 		cmovg	%r15d, %eax
+ 4760 3f6c 4129C7   		subl	%eax, %r15d
+ 4761 3f6f 4863D0   		movslq	%eax, %rdx
+ 4762 3f72 4D63FF   		movslq	%r15d, %r15
+ 4763 3f75 48C1E202 		salq	$2, %rdx
+ 4764 3f79 4A8D04BD 		leaq	0(,%r15,4), %rax
+ 4764      00000000 
+ 4765 3f81 4C8D3C17 		leaq	(%rdi,%rdx), %r15
+ 4766 3f85 488945B8 		movq	%rax, -72(%rbp)
+ 4767 3f89 4D85F6   		testq	%r14, %r14
+ 4768 3f8c 0F843601 		je	.L479
+ 4768      0000
+ 4769 3f92 E8000000 		call	memcpy@PLT
+ 4769      00
+ 4770 3f97 488B55B8 		movq	-72(%rbp), %rdx
+ 4771 3f9b 488B75C8 		movq	-56(%rbp), %rsi
+ 4772 3f9f 4C89FF   		movq	%r15, %rdi
+ 4773 3fa2 E8000000 		call	memcpy@PLT
+ 4773      00
+ 4774 3fa7 498B7424 		movq	48(%r12), %rsi
+ 4774      30
+ 4775 3fac 488B4DB0 		movq	-80(%rbp), %rcx
+ 4776 3fb0 4C89EF   		movq	%r13, %rdi
+ 4777 3fb3 C5FA100D 		vmovss	.LC50(%rip), %xmm1
+ 4777      00000000 
+ 4778 3fbb BA800000 		movl	$128, %edx
+ 4778      00
+ 4779 3fc0 C5FA1005 		vmovss	.LC22(%rip), %xmm0
+ 4779      00000000 
+ 4780 3fc8 E823C2FF 		call	lagrange_gain_and_clip_block
+ 4780      FF
+ 4781 3fcd 448B5DAC 		movl	-84(%rbp), %r11d
+ 4782 3fd1 448B55A0 		movl	-96(%rbp), %r10d
+ 4783 3fd5 31C0     		xorl	%eax, %eax
+ 4784 3fd7 C4E27D18 		vbroadcastss	-64(%rbp), %ymm3
+ 4784      5DC0
+ 4785 3fdd 4C8B4D98 		movq	-104(%rbp), %r9
+ 4786 3fe1 C5FC2895 		vmovaps	-144(%rbp), %ymm2
+ 4786      70FFFFFF 
+ 4787 3fe9 0F1F8000 		.p2align 4,,10
+ 4787      000000
+ 4788              		.p2align 3
+ 4789              	.L480:
+ 4790 3ff0 C4C17C10 		vmovups	(%r14,%rax), %ymm7
+ 4790      3C06
+ 4791 3ff6 C4C14459 		vmulps	0(%r13,%rax), %ymm7, %ymm0
+ 4791      440500
+ 4792 3ffd C5FC5DC3 		vminps	%ymm3, %ymm0, %ymm0
+ 4793 4001 C5FC5FC2 		vmaxps	%ymm2, %ymm0, %ymm0
+ 4794 4005 C4C17C29 		vmovaps	%ymm0, 0(%r13,%rax)
+ 4794      440500
+ 4795 400c 4883C020 		addq	$32, %rax
+ 4796 4010 483D0002 		cmpq	$512, %rax
+ 4796      0000
+ 4797 4016 75D8     		jne	.L480
+ 4798 4018 E940FDFF 		jmp	.L469
+ 4798      FF
+ 4799 401d 0F1F00   		.p2align 4,,10
+ 4800              		.p2align 3
+ 4801              	.L501:
+ 4802 4020 8B4590   		movl	-112(%rbp), %eax
+ 4803 4023 488BBD58 		movq	-168(%rbp), %rdi
+ 4803      FFFFFF
+ 4804 402a 4C894DA0 		movq	%r9, -96(%rbp)
+ 4805 402e 448955AC 		movl	%r10d, -84(%rbp)
+ 4806 4032 29C1     		subl	%eax, %ecx
+ 4807 4034 44895DB0 		movl	%r11d, -80(%rbp)
+ 4808 4038 4D8D7C3D 		leaq	0(%r13,%rdi), %r15
+ 4808      00
+ 4809 403d 894DB8   		movl	%ecx, -72(%rbp)
+ 4810 4040 4D85F6   		testq	%r14, %r14
+ 4811 4043 0F84C700 		je	.L478
+ 4811      0000
+ 4812 4049 C5FA1045 		vmovss	-64(%rbp), %xmm0
+ 4812      C0
+ 4813 404e 89C2     		movl	%eax, %edx
+ 4814 4050 4C89F1   		movq	%r14, %rcx
+ 4815 4053 4C89EF   		movq	%r13, %rdi
+ 4816 4056 E855D1FF 		call	ramp_and_clip_block
+ 4816      FF
+ 4817 405b 488BBD58 		movq	-168(%rbp), %rdi
+ 4817      FFFFFF
+ 4818 4062 C5FA1045 		vmovss	-64(%rbp), %xmm0
+ 4818      C0
+ 4819 4067 8B55B8   		movl	-72(%rbp), %edx
+ 4820 406a 488B75C8 		movq	-56(%rbp), %rsi
+ 4821 406e 498D0C3E 		leaq	(%r14,%rdi), %rcx
+ 4822 4072 4C89FF   		movq	%r15, %rdi
+ 4823 4075 E836D1FF 		call	ramp_and_clip_block
+ 4823      FF
+ 4824 407a 448B5DB0 		movl	-80(%rbp), %r11d
+ 4825 407e 448B55AC 		movl	-84(%rbp), %r10d
+ 4826 4082 4C8B4DA0 		movq	-96(%rbp), %r9
+ 4827 4086 E9D2FCFF 		jmp	.L469
+ 4827      FF
+ 4828 408b 0F1F4400 		.p2align 4,,10
+ 4828      00
+ 4829              		.p2align 3
+ 4830              	.L473:
+ 4831 4090 C4C27D18 		vbroadcastss	(%r12), %ymm4
+ 4831      2424
+ 4832 4096 31C0     		xorl	%eax, %eax
+ 4833 4098 C5FC2895 		vmovaps	-144(%rbp), %ymm2
+ 4833      70FFFFFF 
+ 4834              		.p2align 4,,10
+ 4835              		.p2align 3
+ 4836              	.L475:
+ 4837 40a0 C5DC5904 		vmulps	(%rsi,%rax), %ymm4, %ymm0
+ 4837      06
+ 4838 40a5 C5FC5DC3 		vminps	%ymm3, %ymm0, %ymm0
+ 4839 40a9 C5FC5FC2 		vmaxps	%ymm2, %ymm0, %ymm0
+ 4840 40ad C4C17C29 		vmovaps	%ymm0, 0(%r13,%rax)
+ 4840      440500
+ 4841 40b4 4883C020 		addq	$32, %rax
+ 4842 40b8 483D0002 		cmpq	$512, %rax
+ 4842      0000
+ 4843 40be 75E0     		jne	.L475
+ 4844 40c0 E998FCFF 		jmp	.L469
+ 4844      FF
+ 4845              		.p2align 4,,10
+ 4846 40c5 0F1F00   		.p2align 3
+ 4847              	.L479:
+ 4848 40c8 E8000000 		call	memcpy@PLT
+ 4848      00
+ 4849 40cd 488B55B8 		movq	-72(%rbp), %rdx
+ 4850 40d1 488B75C8 		movq	-56(%rbp), %rsi
+ 4851 40d5 4C89FF   		movq	%r15, %rdi
+ 4852 40d8 E8000000 		call	memcpy@PLT
+ 4852      00
+ 4853 40dd C4C17A10 		vmovss	(%r12), %xmm0
+ 4853      0424
+ 4854 40e3 488B4DB0 		movq	-80(%rbp), %rcx
+ 4855 40e7 4C89EF   		movq	%r13, %rdi
+ 4856 40ea 498B7424 		movq	48(%r12), %rsi
+ 4856      30
+ 4857 40ef C5FA104D 		vmovss	-64(%rbp), %xmm1
+ 4857      C0
+ 4858 40f4 BA800000 		movl	$128, %edx
+ 4858      00
+ 4859 40f9 E8F2C0FF 		call	lagrange_gain_and_clip_block
+ 4859      FF
+ 4860 40fe 4C8B4D98 		movq	-104(%rbp), %r9
+ 4861 4102 448B55A0 		movl	-96(%rbp), %r10d
+ 4862 4106 448B5DAC 		movl	-84(%rbp), %r11d
+ 4863 410a E94EFCFF 		jmp	.L469
+ 4863      FF
+ 4864 410f 90       		.p2align 4,,10
+ 4865              		.p2align 3
+ 4866              	.L478:
+ 4867 4110 C4C17A10 		vmovss	(%r12), %xmm0
+ 4867      0424
+ 4868 4116 C5FA104D 		vmovss	-64(%rbp), %xmm1
+ 4868      C0
+ 4869 411b 4C89EF   		movq	%r13, %rdi
+ 4870 411e 8B5590   		movl	-112(%rbp), %edx
+ 4871 4121 E87ACFFF 		call	gain_and_clip_block
+ 4871      FF
+ 4872 4126 8B55B8   		movl	-72(%rbp), %edx
+ 4873 4129 488B75C8 		movq	-56(%rbp), %rsi
+ 4874 412d 4C89FF   		movq	%r15, %rdi
+ 4875 4130 C4C17A10 		vmovss	(%r12), %xmm0
+ 4875      0424
+ 4876 4136 C5FA104D 		vmovss	-64(%rbp), %xmm1
+ 4876      C0
+ 4877 413b E860CFFF 		call	gain_and_clip_block
+ 4877      FF
+ 4878 4140 448B5DB0 		movl	-80(%rbp), %r11d
+ 4879 4144 448B55AC 		movl	-84(%rbp), %r10d
+ 4880 4148 4C8B4DA0 		movq	-96(%rbp), %r9
+ 4881 414c E90CFCFF 		jmp	.L469
+ 4881      FF
+ 4882              		.p2align 4,,10
+ 4883 4151 0F1F8000 		.p2align 3
+ 4883      000000
+ 4884              	.L494:
+ 4885 4158 C5F877   		vzeroupper
+ 4886 415b 4881C488 		addq	$136, %rsp
+ 4886      000000
+ 4887 4162 5B       		popq	%rbx
+ 4888 4163 415C     		popq	%r12
+ 4889 4165 415D     		popq	%r13
+ 4890              		.cfi_remember_state
+ 4891              		.cfi_def_cfa 13, 0
+ 4892 4167 415E     		popq	%r14
+ 4893 4169 415F     		popq	%r15
+ 4894 416b 5D       		popq	%rbp
+ 4895 416c 498D65F0 		leaq	-16(%r13), %rsp
+ 4896              		.cfi_def_cfa 7, 16
+ 4897 4170 415D     		popq	%r13
+ 4898              		.cfi_def_cfa_offset 8
+ 4899 4172 C3       		ret
+ 4900              		.p2align 4,,10
+ 4901 4173 0F1F4400 		.p2align 3
+ 4901      00
+ 4902              	.L497:
+ 4903              		.cfi_restore_state
+ 4904 4178 8B4DC4   		movl	-60(%rbp), %ecx
+ 4905 417b 31C0     		xorl	%eax, %eax
+ 4906 417d C4C17A10 		vmovss	64(%r14), %xmm1
+ 4906      4E40
+ 4907 4183 85C9     		testl	%ecx, %ecx
+ 4908 4185 410F45C3 		cmovne	%r11d, %eax
+ 4909 4189 894594   		movl	%eax, -108(%rbp)
+ 4910 418c E95AFBFF 		jmp	.L467
+ 4910      FF
+ 4911              		.cfi_endproc
+ 4912              	.LFE6413:
+ 4914              		.section	.rodata.str1.1
+ 4915              	.LC52:
+ 4916 0078 6400     		.string	"d"
+ 4917              	.LC53:
+ 4918 007a 7400     		.string	"t"
+ 4919              	.LC54:
+ 4920 007c 7200     		.string	"r"
+ 4921              	.LC55:
+ 4922 007e 6500     		.string	"e"
+ 4923              	.LC56:
+ 4924 0080 6C00     		.string	"l"
+ 4925              	.LC57:
+ 4926 0082 726C00   		.string	"rl"
+ 4927              	.LC60:
+ 4928 0085 25733A20 		.string	"%s: gain=%f\n"
+ 4928      6761696E 
+ 4928      3D25660A 
+ 4928      00
+ 4929              	.LC61:
+ 4930 0092 25733A20 		.string	"%s: delay_seconds=%f\n"
+ 4930      64656C61 
+ 4930      795F7365 
+ 4930      636F6E64 
+ 4930      733D2566 
+ 4931              	.LC62:
+ 4932 00a8 25733A20 		.string	"%s: ramp_seconds=%f\n"
+ 4932      72616D70 
+ 4932      5F736563 
+ 4932      6F6E6473 
+ 4932      3D25660A 
+ 4933              	.LC64:
+ 4934 00bd 25733A20 		.string	"%s: %s=%f\n"
+ 4934      25733D25 
+ 4934      660A00
+ 4935              		.section	.rodata.str1.8
+ 4936 02a4 00000000 		.align 8
+ 4937              	.LC65:
+ 4938 02a8 25733A20 		.string	"%s: The limiter needs a lookahead and release above 0\n"
+ 4938      54686520 
+ 4938      6C696D69 
+ 4938      74657220 
+ 4938      6E656564 
+ 4939              		.text
+ 4940 4191 66662E0F 		.p2align 4
+ 4940      1F840000 
+ 4940      0000000F 
+ 4940      1F4000
+ 4941              		.globl	create_gain
+ 4943              	create_gain:
+ 4944              	.LFB6423:
+ 4945              		.cfi_startproc
+ 4946 41a0 4C8D5424 		leaq	8(%rsp), %r10
+ 4946      08
+ 4947              		.cfi_def_cfa 10, 0
+ 4948 41a5 4883E4C0 		andq	$-64, %rsp
+ 4949 41a9 488D0500 		leaq	.LC57(%rip), %rax
+ 4949      000000
+ 4950 41b0 41FF72F8 		pushq	-8(%r10)
+ 4951 41b4 488D0D00 		leaq	.LC39(%rip), %rcx
+ 4951      000000
+ 4952 41bb 55       		pushq	%rbp
+ 4953 41bc 4889E5   		movq	%rsp, %rbp
+ 4954              		.cfi_escape 0x10,0x6,0x2,0x76,0
+ 4955 41bf 4157     		pushq	%r15
+ 4956 41c1 4156     		pushq	%r14
+ 4957              		.cfi_escape 0x10,0xf,0x2,0x76,0x78
+ 4958              		.cfi_escape 0x10,0xe,0x2,0x76,0x70
+ 4959 41c3 4C8D3500 		leaq	__func__.0(%rip), %r14
+ 4959      000000
+ 4960 41ca 4C8DBD48 		leaq	-184(%rbp), %r15
+ 4960      FFFFFF
+ 4961 41d1 4155     		pushq	%r13
+ 4962              		.cfi_escape 0x10,0xd,0x2,0x76,0x68
+ 4963 41d3 4C8D2D00 		leaq	.L507(%rip), %r13
+ 4963      000000
+ 4964 41da 4154     		pushq	%r12
+ 4965              		.cfi_escape 0x10,0xc,0x2,0x76,0x60
+ 4966 41dc 4989F4   		movq	%rsi, %r12
+ 4967 41df 4152     		pushq	%r10
+ 4968              		.cfi_escape 0xf,0x3,0x76,0x58,0x6
+ 4969 41e1 53       		pushq	%rbx
+ 4970              		.cfi_escape 0x10,0x3,0x2,0x76,0x50
+ 4971 41e2 488D1D00 		leaq	.LC56(%rip), %rbx
+ 4971      000000
+ 4972 41e9 4881EC00 		subq	$256, %rsp
+ 4972      010000
+ 4973 41f0 4889BD30 		movq	%rdi, -208(%rbp)
+ 4973      FFFFFF
+ 4974 41f7 C5FA7E2D 		vmovq	destroy_gain@GOTPCREL(%rip), %xmm5
+ 4974      00000000 
+ 4975 41ff BFA00000 		movl	$160, %edi
+ 4975      00
+ 4976 4204 C4E3D122 		vpinsrq	$1, clone_gain@GOTPCREL(%rip), %xmm5, %xmm0
+ 4976      05000000 
+ 4976      0001
+ 4977 420e 48C74590 		movq	$0, -112(%rbp)
+ 4977      00000000 
+ 4978 4216 C5FA7E35 		vmovq	gain_process@GOTPCREL(%rip), %xmm6
+ 4978      00000000 
+ 4979 421e C4E3C922 		vpinsrq	$1, gain_init@GOTPCREL(%rip), %xmm6, %xmm1
+ 4979      0D000000 
+ 4979      0001
+ 4980 4228 C5FA7E25 		vmovq	gain_preroll@GOTPCREL(%rip), %xmm4
+ 4980      00000000 
+ 4981 4230 C4E3D922 		vpinsrq	$1, gain_codegen@GOTPCREL(%rip), %xmm4, %xmm3
+ 4981      1D000000 
+ 4981      0001
+ 4982 423a C4E37538 		vinserti128	$0x1, %xmm0, %ymm1, %ymm7
+ 4982      F801
+ 4983 4240 C4E1F96E 		vmovq	%rbx, %xmm0
+ 4983      C3
+ 4984 4245 488D1D00 		leaq	.LC54(%rip), %rbx
+ 4984      000000
+ 4985 424c C4E3F922 		vpinsrq	$1, %rax, %xmm0, %xmm0
+ 4985      C001
+ 4986 4252 C4E1F96E 		vmovq	%rbx, %xmm1
+ 4986      CB
+ 4987 4257 488D0500 		leaq	.LC55(%rip), %rax
+ 4987      000000
+ 4988 425e C5F97F9D 		vmovdqa	%xmm3, -224(%rbp)
+ 4988      20FFFFFF 
+ 4989 4266 488D1D00 		leaq	.LC52(%rip), %rbx
+ 4989      000000
+ 4990 426d C4E3F122 		vpinsrq	$1, %rax, %xmm1, %xmm1
+ 4990      C801
+ 4991 4273 488D0500 		leaq	.LC53(%rip), %rax
+ 4991      000000
+ 4992 427a C5FD7FBD 		vmovdqa	%ymm7, -272(%rbp)
+ 4992      F0FEFFFF 
+ 4993 4282 C4E1F96E 		vmovq	%rbx, %xmm2
+ 4993      D3
+ 4994 4287 C4E37538 		vinserti128	$0x1, %xmm0, %ymm1, %ymm1
+ 4994      C801
+ 4995 428d C4E1F96E 		vmovq	%rcx, %xmm0
+ 4995      C1
+ 4996 4292 C4E3E922 		vpinsrq	$1, %rax, %xmm2, %xmm2
+ 4996      D001
+ 4997 4298 488D0500 		leaq	.LC40(%rip), %rax
+ 4997      000000
+ 4998 429f C4E3F922 		vpinsrq	$1, %rax, %xmm0, %xmm0
+ 4998      C001
+ 4999 42a5 C4E37D38 		vinserti128	$0x1, %xmm2, %ymm0, %ymm0
+ 4999      C201
+ 5000 42ab 62F3FD48 		vinserti64x4	$0x1, %ymm1, %zmm0, %zmm0
+ 5000      3AC101
+ 5001 42b2 62F1FD48 		vmovdqa64	%zmm0, -176(%rbp)
+ 5001      7F8550FF 
+ 5001      FFFF
+ 5002 42bc C5F877   		vzeroupper
+ 5003 42bf E8000000 		call	malloc@PLT
+ 5003      00
+ 5004 42c4 4C89F2   		movq	%r14, %rdx
+ 5005 42c7 C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 5006 42cb 4889C3   		movq	%rax, %rbx
+ 5007 42ce 488B8530 		movq	-208(%rbp), %rax
+ 5007      FFFFFF
+ 5008 42d5 488D3500 		leaq	.LC41(%rip), %rsi
+ 5008      000000
+ 5009 42dc BF010000 		movl	$1, %edi
+ 5009      00
+ 5010 42e1 C6435000 		movb	$0, 80(%rbx)
+ 5011 42e5 488998C0 		movq	%rbx, 192(%rax)
+ 5011      000000
+ 5012 42ec 488B0500 		movq	.LC58(%rip), %rax
+ 5012      000000
+ 5013 42f3 48C74308 		movq	$0x000000000, 8(%rbx)
+ 5013      00000000 
+ 5014 42fb 498B0C24 		movq	(%r12), %rcx
+ 5015 42ff 48894348 		movq	%rax, 72(%rbx)
+ 5016 4303 488B0500 		movq	.LC59(%rip), %rax
+ 5016      000000
+ 5017 430a C7030000 		movl	$0x3f800000, (%rbx)
+ 5017      803F
+ 5018 4310 48894310 		movq	%rax, 16(%rbx)
+ 5019 4314 48B80000 		movabsq	$4575657221408423936, %rax
+ 5019      00000000 
+ 5019      803F
+ 5020 431e 4889433C 		movq	%rax, 60(%rbx)
+ 5021 4322 31C0     		xorl	%eax, %eax
+ 5022 4324 C5FA7F43 		vmovdqu	%xmm0, 40(%rbx)
+ 5022      28
+ 5023 4329 C5FA7F43 		vmovdqu	%xmm0, 112(%rbx)
+ 5023      70
+ 5024 432e E8000000 		call	debugprint@PLT
+ 5024      00
+ 5025 4333 498B0424 		movq	(%r12), %rax
+ 5026 4337 488D8D50 		leaq	-176(%rbp), %rcx
+ 5026      FFFFFF
+ 5027 433e 48898D38 		movq	%rcx, -200(%rbp)
+ 5027      FFFFFF
+ 5028 4345 803800   		cmpb	$0, (%rax)
+ 5029 4348 0F84CF00 		je	.L526
+ 5029      0000
+ 5030 434e 6690     		.p2align 4,,10
+ 5031              		.p2align 3
+ 5032              	.L503:
+ 5033 4350 488BB538 		movq	-200(%rbp), %rsi
+ 5033      FFFFFF
+ 5034 4357 4C89FA   		movq	%r15, %rdx
+ 5035 435a 4C89E7   		movq	%r12, %rdi
+ 5036 435d E8000000 		call	getsubopt@PLT
+ 5036      00
+ 5037 4362 89C2     		movl	%eax, %edx
+ 5038 4364 83F807   		cmpl	$7, %eax
+ 5039 4367 0F87C002 		ja	.L505
+ 5039      0000
+ 5040 436d 89C0     		movl	%eax, %eax
+ 5041 436f 49634485 		movslq	0(%r13,%rax,4), %rax
+ 5041      00
+ 5042 4374 4C01E8   		addq	%r13, %rax
+ 5043 4377 FFE0     		jmp	*%rax
+ 5044              		.section	.rodata
+ 5045              		.align 4
+ 5046              		.align 4
+ 5047              	.L507:
+ 5048 0014 00000000 		.long	.L513-.L507
+ 5049 0018 00000000 		.long	.L512-.L507
+ 5050 001c 00000000 		.long	.L511-.L507
+ 5051 0020 00000000 		.long	.L510-.L507
+ 5052 0024 00000000 		.long	.L509-.L507
+ 5053 0028 00000000 		.long	.L508-.L507
+ 5054 002c 00000000 		.long	.L506-.L507
+ 5055 0030 00000000 		.long	.L506-.L507
+ 5056              		.text
+ 5057 4379 0F1F8000 		.p2align 4,,10
+ 5057      000000
+ 5058              		.p2align 3
+ 5059              	.L506:
+ 5060 4380 488B8D48 		movq	-184(%rbp), %rcx
+ 5060      FFFFFF
+ 5061 4387 4885C9   		testq	%rcx, %rcx
+ 5062 438a 0F84D003 		je	.L544
+ 5062      0000
+ 5063 4390 488B4378 		movq	120(%rbx), %rax
+ 5064 4394 4885C0   		testq	%rax, %rax
+ 5065 4397 0F847B03 		je	.L545
+ 5065      0000
+ 5066              	.L522:
+ 5067 439d 899514FF 		movl	%edx, -236(%rbp)
+ 5067      FFFF
+ 5068 43a3 31F6     		xorl	%esi, %esi
+ 5069 43a5 4889CF   		movq	%rcx, %rdi
+ 5070 43a8 48898518 		movq	%rax, -232(%rbp)
+ 5070      FFFFFF
+ 5071 43af 83FA06   		cmpl	$6, %edx
+ 5072 43b2 0F84E002 		je	.L546
+ 5072      0000
+ 5073 43b8 E8000000 		call	strtod@PLT
+ 5073      00
+ 5074 43bd 488B8518 		movq	-232(%rbp), %rax
+ 5074      FFFFFF
+ 5075 43c4 8B9514FF 		movl	-236(%rbp), %edx
+ 5075      FFFF
+ 5076 43ca C5FB1140 		vmovsd	%xmm0, 8(%rax)
+ 5076      08
+ 5077              	.L525:
+ 5078 43cf 488BBD48 		movq	-184(%rbp), %rdi
+ 5078      FFFFFF
+ 5079 43d6 31F6     		xorl	%esi, %esi
+ 5080 43d8 899518FF 		movl	%edx, -232(%rbp)
+ 5080      FFFF
+ 5081 43de E8000000 		call	strtod@PLT
+ 5081      00
+ 5082 43e3 BF010000 		movl	$1, %edi
+ 5082      00
+ 5083 43e8 B8010000 		movl	$1, %eax
+ 5083      00
+ 5084 43ed 48639518 		movslq	-232(%rbp), %rdx
+ 5084      FFFFFF
+ 5085 43f4 488D3500 		leaq	.LC64(%rip), %rsi
+ 5085      000000
+ 5086 43fb 488B8CD5 		movq	-176(%rbp,%rdx,8), %rcx
+ 5086      50FFFFFF 
+ 5087 4403 4C89F2   		movq	%r14, %rdx
+ 5088 4406 E8000000 		call	debugprint@PLT
+ 5088      00
+ 5089 440b 0F1F4400 		.p2align 4,,10
+ 5089      00
+ 5090              		.p2align 3
+ 5091              	.L516:
+ 5092 4410 498B0424 		movq	(%r12), %rax
+ 5093 4414 803800   		cmpb	$0, (%rax)
+ 5094 4417 0F8533FF 		jne	.L503
+ 5094      FFFF
+ 5095              	.L526:
+ 5096 441d 31D2     		xorl	%edx, %edx
+ 5097              	.L504:
+ 5098 441f 488B4378 		movq	120(%rbx), %rax
+ 5099 4423 4885C0   		testq	%rax, %rax
+ 5100 4426 7421     		je	.L527
+ 5101 4428 C5FB1008 		vmovsd	(%rax), %xmm1
+ 5102 442c C5F957C0 		vxorpd	%xmm0, %xmm0, %xmm0
+ 5103 4430 C5F92FC8 		vcomisd	%xmm0, %xmm1
+ 5104 4434 0F861E02 		jbe	.L528
+ 5104      0000
+ 5105 443a C5FB1048 		vmovsd	8(%rax), %xmm1
+ 5105      08
+ 5106 443f C5F92FC8 		vcomisd	%xmm0, %xmm1
+ 5107 4443 0F860F02 		jbe	.L528
+ 5107      0000
+ 5108              	.L527:
+ 5109 4449 8B03     		movl	(%rbx), %eax
+ 5110 444b 894344   		movl	%eax, 68(%rbx)
+ 5111 444e 488D0500 		leaq	gain_process_kernels(%rip), %rax
+ 5111      000000
+ 5112 4455 C7435800 		movl	$0, 88(%rbx)
+ 5112      000000
+ 5113 445c 488B8D30 		movq	-208(%rbp), %rcx
+ 5113      FFFFFF
+ 5114 4463 C5FA1003 		vmovss	(%rbx), %xmm0
+ 5115 4467 C5FD6F9D 		vmovdqa	-272(%rbp), %ymm3
+ 5115      F0FEFFFF 
+ 5116 446f C5F96FA5 		vmovdqa	-224(%rbp), %xmm4
+ 5116      20FFFFFF 
+ 5117 4477 488981C8 		movq	%rax, 200(%rcx)
+ 5117      000000
+ 5118 447e 488B0500 		movq	control_gain@GOTPCREL(%rip), %rax
+ 5118      000000
+ 5119 4485 C5FA1143 		vmovss	%xmm0, 92(%rbx)
+ 5119      5C
+ 5120 448a 48898100 		movq	%rax, 256(%rcx)
+ 5120      010000
+ 5121 4491 89D0     		movl	%edx, %eax
+ 5122 4493 C5FE7F99 		vmovdqu	%ymm3, 208(%rcx)
+ 5122      D0000000 
+ 5123 449b C5FA7FA1 		vmovdqu	%xmm4, 240(%rcx)
+ 5123      F0000000 
+ 5124 44a3 C5F877   		vzeroupper
+ 5125 44a6 4881C400 		addq	$256, %rsp
+ 5125      010000
+ 5126 44ad 5B       		popq	%rbx
+ 5127 44ae 415A     		popq	%r10
+ 5128              		.cfi_remember_state
+ 5129              		.cfi_def_cfa 10, 0
+ 5130 44b0 415C     		popq	%r12
+ 5131 44b2 415D     		popq	%r13
+ 5132 44b4 415E     		popq	%r14
+ 5133 44b6 415F     		popq	%r15
+ 5134 44b8 5D       		popq	%rbp
+ 5135 44b9 498D62F8 		leaq	-8(%r10), %rsp
+ 5136              		.cfi_def_cfa 7, 8
+ 5137 44bd C3       		ret
+ 5138 44be 6690     		.p2align 4,,10
+ 5139              		.p2align 3
+ 5140              	.L508:
+ 5141              		.cfi_restore_state
+ 5142 44c0 C6435001 		movb	$1, 80(%rbx)
+ 5143 44c4 E947FFFF 		jmp	.L516
+ 5143      FF
+ 5144 44c9 0F1F8000 		.p2align 4,,10
+ 5144      000000
+ 5145              		.p2align 3
+ 5146              	.L509:
+ 5147 44d0 488BBD48 		movq	-184(%rbp), %rdi
+ 5147      FFFFFF
+ 5148 44d7 4885FF   		testq	%rdi, %rdi
+ 5149 44da 0F84D801 		je	.L547
+ 5149      0000
+ 5150 44e0 31F6     		xorl	%esi, %esi
+ 5151 44e2 E8000000 		call	strtod@PLT
+ 5151      00
+ 5152 44e7 488BBD48 		movq	-184(%rbp), %rdi
+ 5152      FFFFFF
+ 5153 44ee 31F6     		xorl	%esi, %esi
+ 5154 44f0 C5FB1143 		vmovsd	%xmm0, 72(%rbx)
+ 5154      48
+ 5155 44f5 E8000000 		call	strtod@PLT
+ 5155      00
+ 5156 44fa 4C89F2   		movq	%r14, %rdx
+ 5157 44fd BF010000 		movl	$1, %edi
+ 5157      00
+ 5158 4502 488D3500 		leaq	.LC62(%rip), %rsi
+ 5158      000000
+ 5159 4509 B8010000 		movl	$1, %eax
+ 5159      00
+ 5160 450e E8000000 		call	debugprint@PLT
+ 5160      00
+ 5161 4513 E9F8FEFF 		jmp	.L516
+ 5161      FF
+ 5162 4518 0F1F8400 		.p2align 4,,10
+ 5162      00000000 
+ 5163              		.p2align 3
+ 5164              	.L510:
+ 5165 4520 488BBD48 		movq	-184(%rbp), %rdi
+ 5165      FFFFFF
+ 5166 4527 4885FF   		testq	%rdi, %rdi
+ 5167 452a 0F84A801 		je	.L548
+ 5167      0000
+ 5168 4530 31F6     		xorl	%esi, %esi
+ 5169 4532 E8000000 		call	strtod@PLT
+ 5169      00
+ 5170 4537 C5FB5E0D 		vdivsd	.LC43(%rip), %xmm0, %xmm1
+ 5170      00000000 
+ 5171 453f C5FA1005 		vmovss	.LC44(%rip), %xmm0
+ 5171      00000000 
+ 5172 4547 C5F35AC9 		vcvtsd2ss	%xmm1, %xmm1, %xmm1
+ 5173 454b E8000000 		call	powf@PLT
+ 5173      00
+ 5174 4550 C5FA1143 		vmovss	%xmm0, 64(%rbx)
+ 5174      40
+ 5175              	.L542:
+ 5176 4555 488BBD48 		movq	-184(%rbp), %rdi
+ 5176      FFFFFF
+ 5177 455c 31F6     		xorl	%esi, %esi
+ 5178 455e E8000000 		call	strtod@PLT
+ 5178      00
+ 5179 4563 4C89F2   		movq	%r14, %rdx
+ 5180 4566 BF010000 		movl	$1, %edi
+ 5180      00
+ 5181 456b 488D3500 		leaq	.LC60(%rip), %rsi
+ 5181      000000
+ 5182 4572 B8010000 		movl	$1, %eax
+ 5182      00
+ 5183 4577 E8000000 		call	debugprint@PLT
+ 5183      00
+ 5184 457c E98FFEFF 		jmp	.L516
+ 5184      FF
+ 5185              		.p2align 4,,10
+ 5186 4581 0F1F8000 		.p2align 3
+ 5186      000000
+ 5187              	.L511:
+ 5188 4588 488BBD48 		movq	-184(%rbp), %rdi
+ 5188      FFFFFF
+ 5189 458f 4885FF   		testq	%rdi, %rdi
+ 5190 4592 0F846001 		je	.L549
+ 5190      0000
+ 5191 4598 31F6     		xorl	%esi, %esi
+ 5192 459a E8000000 		call	strtod@PLT
+ 5192      00
+ 5193 459f 488BBD48 		movq	-184(%rbp), %rdi
+ 5193      FFFFFF
+ 5194 45a6 31F6     		xorl	%esi, %esi
+ 5195 45a8 C5FB1143 		vmovsd	%xmm0, 8(%rbx)
+ 5195      08
+ 5196 45ad E8000000 		call	strtod@PLT
+ 5196      00
+ 5197 45b2 4C89F2   		movq	%r14, %rdx
+ 5198 45b5 BF010000 		movl	$1, %edi
+ 5198      00
+ 5199 45ba 488D3500 		leaq	.LC61(%rip), %rsi
+ 5199      000000
+ 5200 45c1 B8010000 		movl	$1, %eax
+ 5200      00
+ 5201 45c6 E8000000 		call	debugprint@PLT
+ 5201      00
+ 5202 45cb E940FEFF 		jmp	.L516
+ 5202      FF
+ 5203              		.p2align 4,,10
+ 5204              		.p2align 3
+ 5205              	.L512:
+ 5206 45d0 488BBD48 		movq	-184(%rbp), %rdi
+ 5206      FFFFFF
+ 5207 45d7 4885FF   		testq	%rdi, %rdi
+ 5208 45da 0F849800 		je	.L517
+ 5208      0000
+ 5209 45e0 31F6     		xorl	%esi, %esi
+ 5210 45e2 E8000000 		call	strtod@PLT
+ 5210      00
+ 5211 45e7 C5FB5AC0 		vcvtsd2ss	%xmm0, %xmm0, %xmm0
+ 5212 45eb C5FA1103 		vmovss	%xmm0, (%rbx)
+ 5213 45ef E961FFFF 		jmp	.L542
+ 5213      FF
+ 5214              		.p2align 4,,10
+ 5215 45f4 0F1F4000 		.p2align 3
+ 5216              	.L513:
+ 5217 45f8 488BBD48 		movq	-184(%rbp), %rdi
+ 5217      FFFFFF
+ 5218 45ff 4885FF   		testq	%rdi, %rdi
+ 5219 4602 7474     		je	.L517
+ 5220 4604 31F6     		xorl	%esi, %esi
+ 5221 4606 E8000000 		call	strtod@PLT
+ 5221      00
+ 5222 460b C5FB5E0D 		vdivsd	.LC43(%rip), %xmm0, %xmm1
+ 5222      00000000 
+ 5223 4613 C5FA1005 		vmovss	.LC44(%rip), %xmm0
+ 5223      00000000 
+ 5224 461b C5F35AC9 		vcvtsd2ss	%xmm1, %xmm1, %xmm1
+ 5225 461f E8000000 		call	powf@PLT
+ 5225      00
+ 5226 4624 C5FA1103 		vmovss	%xmm0, (%rbx)
+ 5227 4628 E928FFFF 		jmp	.L542
+ 5227      FF
+ 5228              	.L505:
+ 5229 462d 488B8D48 		movq	-184(%rbp), %rcx
+ 5229      FFFFFF
+ 5230 4634 4C89F2   		movq	%r14, %rdx
+ 5231 4637 31FF     		xorl	%edi, %edi
+ 5232 4639 31C0     		xorl	%eax, %eax
+ 5233 463b 488D3500 		leaq	.LC45(%rip), %rsi
+ 5233      000000
+ 5234 4642 E8000000 		call	debugprint@PLT
+ 5234      00
+ 5235              	.L515:
+ 5236 4647 BA010000 		movl	$1, %edx
+ 5236      00
+ 5237 464c E9CEFDFF 		jmp	.L504
+ 5237      FF
+ 5238              		.p2align 4,,10
+ 5239 4651 0F1F8000 		.p2align 3
+ 5239      000000
+ 5240              	.L528:
+ 5241 4658 4C89F2   		movq	%r14, %rdx
+ 5242 465b 488D3500 		leaq	.LC65(%rip), %rsi
+ 5242      000000
+ 5243 4662 31FF     		xorl	%edi, %edi
+ 5244 4664 31C0     		xorl	%eax, %eax
+ 5245 4666 E8000000 		call	debugprint@PLT
+ 5245      00
+ 5246 466b BA010000 		movl	$1, %edx
+ 5246      00
+ 5247 4670 E9D4FDFF 		jmp	.L527
+ 5247      FF
+ 5248              		.p2align 4,,10
+ 5249 4675 0F1F00   		.p2align 3
+ 5250              	.L517:
+ 5251 4678 488B8D50 		movq	-176(%rbp), %rcx
+ 5251      FFFFFF
+ 5252              	.L543:
+ 5253 467f 4C89F2   		movq	%r14, %rdx
+ 5254 4682 488D3500 		leaq	.LC42(%rip), %rsi
+ 5254      000000
+ 5255 4689 31FF     		xorl	%edi, %edi
+ 5256 468b 31C0     		xorl	%eax, %eax
+ 5257 468d E8000000 		call	debugprint@PLT
+ 5257      00
+ 5258 4692 EBB3     		jmp	.L515
+ 5259              		.p2align 4,,10
+ 5260 4694 0F1F4000 		.p2align 3
+ 5261              	.L546:
+ 5262 4698 E8000000 		call	strtod@PLT
+ 5262      00
+ 5263 469d 488B8518 		movq	-232(%rbp), %rax
+ 5263      FFFFFF
+ 5264 46a4 8B9514FF 		movl	-236(%rbp), %edx
+ 5264      FFFF
+ 5265 46aa C5FB1100 		vmovsd	%xmm0, (%rax)
+ 5266 46ae E91CFDFF 		jmp	.L525
+ 5266      FF
+ 5267              		.p2align 4,,10
+ 5268 46b3 0F1F4400 		.p2align 3
+ 5268      00
+ 5269              	.L547:
+ 5270 46b8 488B8D70 		movq	-144(%rbp), %rcx
+ 5270      FFFFFF
+ 5271 46bf 4C89F2   		movq	%r14, %rdx
+ 5272 46c2 488D3500 		leaq	.LC42(%rip), %rsi
+ 5272      000000
+ 5273 46c9 31C0     		xorl	%eax, %eax
+ 5274 46cb E8000000 		call	debugprint@PLT
+ 5274      00
+ 5275 46d0 E972FFFF 		jmp	.L515
+ 5275      FF
+ 5276              		.p2align 4,,10
+ 5277 46d5 0F1F00   		.p2align 3
+ 5278              	.L548:
+ 5279 46d8 488B8D68 		movq	-152(%rbp), %rcx
+ 5279      FFFFFF
+ 5280 46df 4C89F2   		movq	%r14, %rdx
+ 5281 46e2 488D3500 		leaq	.LC42(%rip), %rsi
+ 5281      000000
+ 5282 46e9 31C0     		xorl	%eax, %eax
+ 5283 46eb E8000000 		call	debugprint@PLT
+ 5283      00
+ 5284 46f0 E952FFFF 		jmp	.L515
+ 5284      FF
+ 5285              		.p2align 4,,10
+ 5286 46f5 0F1F00   		.p2align 3
+ 5287              	.L549:
+ 5288 46f8 488B8D60 		movq	-160(%rbp), %rcx
+ 5288      FFFFFF
+ 5289 46ff 4C89F2   		movq	%r14, %rdx
+ 5290 4702 488D3500 		leaq	.LC42(%rip), %rsi
+ 5290      000000
+ 5291 4709 31C0     		xorl	%eax, %eax
+ 5292 470b E8000000 		call	debugprint@PLT
+ 5292      00
+ 5293 4710 E932FFFF 		jmp	.L515
+ 5293      FF
+ 5294              		.p2align 4,,10
+ 5295 4715 0F1F00   		.p2align 3
+ 5296              	.L545:
+ 5297 4718 BE400100 		movl	$320, %esi
+ 5297      00
+ 5298 471d BF010000 		movl	$1, %edi
+ 5298      00
+ 5299 4722 899514FF 		movl	%edx, -236(%rbp)
+ 5299      FFFF
+ 5300 4728 48898D18 		movq	%rcx, -232(%rbp)
+ 5300      FFFFFF
+ 5301 472f E8000000 		call	calloc@PLT
+ 5301      00
+ 5302 4734 488B8D18 		movq	-232(%rbp), %rcx
+ 5302      FFFFFF
+ 5303 473b 8B9514FF 		movl	-236(%rbp), %edx
+ 5303      FFFF
+ 5304 4741 4885C0   		testq	%rax, %rax
+ 5305 4744 48894378 		movq	%rax, 120(%rbx)
+ 5306 4748 7426     		je	.L550
+ 5307              	.L523:
+ 5308 474a 488B3500 		movq	.LC63(%rip), %rsi
+ 5308      000000
+ 5309 4751 48897008 		movq	%rsi, 8(%rax)
+ 5310 4755 E943FCFF 		jmp	.L522
+ 5310      FF
+ 5311 475a 660F1F44 		.p2align 4,,10
+ 5311      0000
+ 5312              		.p2align 3
+ 5313              	.L544:
+ 5314 4760 4863D2   		movslq	%edx, %rdx
+ 5315 4763 488B8CD5 		movq	-176(%rbp,%rdx,8), %rcx
+ 5315      50FFFFFF 
+ 5316 476b E90FFFFF 		jmp	.L543
+ 5316      FF
+ 5317              	.L550:
+ 5318 4770 488D3D00 		leaq	.LC21(%rip), %rdi
+ 5318      000000
+ 5319 4777 899518FF 		movl	%edx, -232(%rbp)
+ 5319      FFFF
+ 5320 477d E8000000 		call	endprogram@PLT
+ 5320      00
+ 5321 4782 488B4378 		movq	120(%rbx), %rax
+ 5322 4786 488B8D48 		movq	-184(%rbp), %rcx
+ 5322      FFFFFF
+ 5323 478d 8B9518FF 		movl	-232(%rbp), %edx
+ 5323      FFFF
+ 5324 4793 EBB5     		jmp	.L523
+ 5325              		.cfi_endproc
+ 5326              	.LFE6423:
+ 5328              		.section	.rodata.str1.1
+ 5329              	.LC67:
+ 5330 00c8 20204761 		.string	"  Gain options\n"
+ 5330      696E206F 
+ 5330      7074696F 
+ 5330      6E730A00 
+ 5331              	.LC68:
+ 5332 00d8 20202020 		.string	"    Name: gain\n"
+ 5332      4E616D65 
+ 5332      3A206761 
+ 5332      696E0A00 
+ 5333              	.LC69:
+ 5334 00e8 20202020 		.string	"        g = gain value (dB)\n"
+ 5334      20202020 
+ 5334      67203D20 
+ 5334      6761696E 
+ 5334      2076616C 
+ 5335              		.section	.rodata.str1.8
+ 5336 02df 00       		.align 8
+ 5337              	.LC70:
+ 5338 02e0 20202020 		.string	"        gl = gain value (linear)\n"
+ 5338      20202020 
+ 5338      676C203D 
+ 5338      20676169 
+ 5338      6E207661 
+ 5339 0302 00000000 		.align 8
+ 5339      0000
+ 5340              	.LC71:
+ 5341 0308 20202020 		.string	"        d = delay value (seconds), fractional samples are interpolated\n"
+ 5341      20202020 
+ 5341      64203D20 
+ 5341      64656C61 
+ 5341      79207661 
+ 5342              		.align 8
+ 5343              	.LC72:
+ 5344 0350 20202020 		.string	"        t = clip threshold (dBFS)\n"
+ 5344      20202020 
+ 5344      74203D20 
+ 5344      636C6970 
+ 5344      20746872 
+ 5345 0373 00000000 		.align 8
+ 5345      00
+ 5346              	.LC73:
+ 5347 0378 20202020 		.string	"        r = ramp time for runtime gain changes (seconds, default %g)\n"
+ 5347      20202020 
+ 5347      72203D20 
+ 5347      72616D70 
+ 5347      2074696D 
+ 5348 03be 0000     		.align 8
+ 5349              	.LC74:
+ 5350 03c0 20202020 		.string	"        e = ramp with a constant factor per sample, i.e. linearly in dB\n"
+ 5350      20202020 
+ 5350      65203D20 
+ 5350      72616D70 
+ 5350      20776974 
+ 5351 0409 00000000 		.align 8
+ 5351      000000
+ 5352              	.LC75:
+ 5353 0410 20202020 		.string	"        l = lookahead (seconds), limits true peaks to t instead of clipping\n"
+ 5353      20202020 
+ 5353      6C203D20 
+ 5353      6C6F6F6B 
+ 5353      61686561 
+ 5354 045d 000000   		.align 8
+ 5355              	.LC76:
+ 5356 0460 20202020 		.string	"        rl = limiter release time (seconds, default %g)\n"
+ 5356      20202020 
+ 5356      726C203D 
+ 5356      206C696D 
+ 5356      69746572 
+ 5357              		.section	.rodata.str1.1
+ 5358              	.LC77:
+ 5359 0105 20202020 		.string	"    Runtime options: g, gl\n"
+ 5359      52756E74 
+ 5359      696D6520 
+ 5359      6F707469 
+ 5359      6F6E733A 
+ 5360              		.section	.rodata.str1.8
+ 5361 0499 00000000 		.align 8
+ 5361      000000
+ 5362              	.LC78:
+ 5363 04a0 20202020 		.string	"    Example: -p gain,g=-3,d=0.002,t=-6\n"
+ 5363      4578616D 
+ 5363      706C653A 
+ 5363      202D7020 
+ 5363      6761696E 
+ 5364              		.align 8
+ 5365              	.LC79:
+ 5366 04c8 20202020 		.string	"    Note: Gain is applied before clipping. The limiter adds the lookahead plus %d samples
+ 5366      4E6F7465 
+ 5366      3A204761 
+ 5366      696E2069 
+ 5366      73206170 
+ 5367              		.text
+ 5368 4795 66662E0F 		.p2align 4
+ 5368      1F840000 
+ 5368      000000
+ 5369              		.globl	help_gain
+ 5371              	help_gain:
+ 5372              	.LFB6424:
+ 5373              		.cfi_startproc
+ 5374 47a0 4883EC08 		subq	$8, %rsp
+ 5375              		.cfi_def_cfa_offset 16
+ 5376 47a4 31FF     		xorl	%edi, %edi
+ 5377 47a6 488D3500 		leaq	.LC67(%rip), %rsi
+ 5377      000000
+ 5378 47ad 31C0     		xorl	%eax, %eax
+ 5379 47af E8000000 		call	debugprint@PLT
+ 5379      00
+ 5380 47b4 31FF     		xorl	%edi, %edi
+ 5381 47b6 31C0     		xorl	%eax, %eax
+ 5382 47b8 488D3500 		leaq	.LC68(%rip), %rsi
+ 5382      000000
+ 5383 47bf E8000000 		call	debugprint@PLT
+ 5383      00
+ 5384 47c4 31FF     		xorl	%edi, %edi
+ 5385 47c6 31C0     		xorl	%eax, %eax
+ 5386 47c8 488D3500 		leaq	.LC69(%rip), %rsi
+ 5386      000000
+ 5387 47cf E8000000 		call	debugprint@PLT
+ 5387      00
+ 5388 47d4 31FF     		xorl	%edi, %edi
+ 5389 47d6 31C0     		xorl	%eax, %eax
+ 5390 47d8 488D3500 		leaq	.LC70(%rip), %rsi
+ 5390      000000
+ 5391 47df E8000000 		call	debugprint@PLT
+ 5391      00
+ 5392 47e4 31FF     		xorl	%edi, %edi
+ 5393 47e6 31C0     		xorl	%eax, %eax
+ 5394 47e8 488D3500 		leaq	.LC71(%rip), %rsi
+ 5394      000000
+ 5395 47ef E8000000 		call	debugprint@PLT
+ 5395      00
+ 5396 47f4 31FF     		xorl	%edi, %edi
+ 5397 47f6 31C0     		xorl	%eax, %eax
+ 5398 47f8 488D3500 		leaq	.LC72(%rip), %rsi
+ 5398      000000
+ 5399 47ff E8000000 		call	debugprint@PLT
+ 5399      00
+ 5400 4804 31FF     		xorl	%edi, %edi
+ 5401 4806 B8010000 		movl	$1, %eax
+ 5401      00
+ 5402 480b C5FB1005 		vmovsd	.LC58(%rip), %xmm0
+ 5402      00000000 
+ 5403 4813 488D3500 		leaq	.LC73(%rip), %rsi
+ 5403      000000
+ 5404 481a E8000000 		call	debugprint@PLT
+ 5404      00
+ 5405 481f 31FF     		xorl	%edi, %edi
+ 5406 4821 31C0     		xorl	%eax, %eax
+ 5407 4823 488D3500 		leaq	.LC74(%rip), %rsi
+ 5407      000000
+ 5408 482a E8000000 		call	debugprint@PLT
+ 5408      00
+ 5409 482f 31FF     		xorl	%edi, %edi
+ 5410 4831 31C0     		xorl	%eax, %eax
+ 5411 4833 488D3500 		leaq	.LC75(%rip), %rsi
+ 5411      000000
+ 5412 483a E8000000 		call	debugprint@PLT
+ 5412      00
+ 5413 483f 31FF     		xorl	%edi, %edi
+ 5414 4841 B8010000 		movl	$1, %eax
+ 5414      00
+ 5415 4846 C5FB1005 		vmovsd	.LC63(%rip), %xmm0
+ 5415      00000000 
+ 5416 484e 488D3500 		leaq	.LC76(%rip), %rsi
+ 5416      000000
+ 5417 4855 E8000000 		call	debugprint@PLT
+ 5417      00
+ 5418 485a 31C0     		xorl	%eax, %eax
+ 5419 485c 488D3500 		leaq	.LC77(%rip), %rsi
+ 5419      000000
+ 5420 4863 31FF     		xorl	%edi, %edi
+ 5421 4865 E8000000 		call	debugprint@PLT
+ 5421      00
+ 5422 486a 31FF     		xorl	%edi, %edi
+ 5423 486c 488D3500 		leaq	.LC78(%rip), %rsi
+ 5423      000000
+ 5424 4873 31C0     		xorl	%eax, %eax
+ 5425 4875 E8000000 		call	debugprint@PLT
+ 5425      00
+ 5426 487a BA080000 		movl	$8, %edx
+ 5426      00
+ 5427 487f 31FF     		xorl	%edi, %edi
+ 5428 4881 31C0     		xorl	%eax, %eax
+ 5429 4883 488D3500 		leaq	.LC79(%rip), %rsi
+ 5429      000000
+ 5430 488a 4883C408 		addq	$8, %rsp
+ 5431              		.cfi_def_cfa_offset 8
+ 5432 488e E9000000 		jmp	debugprint@PLT
+ 5432      00
+ 5433              		.cfi_endproc
+ 5434              	.LFE6424:
+ 5436              		.section	.rodata
+ 5437 0034 00000000 		.align 8
+ 5440              	__func__.0:
+ 5441 0038 63726561 		.string	"create_gain"
+ 5441      74655F67 
+ 5441      61696E00 
+ 5442 0044 00000000 		.align 8
+ 5445              	__func__.1:
+ 5446 0048 636F6E74 		.string	"control_gain"
+ 5446      726F6C5F 
+ 5446      6761696E 
+ 5446      00
+ 5447 0055 000000   		.align 8
+ 5450              	__func__.2:
+ 5451 0058 6761696E 		.string	"gain_codegen"
+ 5451      5F636F64 
+ 5451      6567656E 
+ 5451      00
+ 5452 0065 000000   		.align 8
+ 5455              	__func__.3:
+ 5456 0068 6C696D69 		.string	"limiter_init"
+ 5456      7465725F 
+ 5456      696E6974 
+ 5456      00
+ 5457 0075 000000   		.align 8
+ 5460              	__func__.4:
+ 5461 0078 6761696E 		.string	"gain_init"
+ 5461      5F696E69 
+ 5461      7400
+ 5462              		.section	.data.rel.ro,"aw"
+ 5463              		.align 32
+ 5466              	gain_process_kernels:
+ 5467 0000 02000000 		.long	2
+ 5468 0004 40000000 		.long	64
+ 5469 0008 00000000 		.quad	gain_process_2_64
+ 5469      00000000 
+ 5470 0010 02000000 		.long	2
+ 5471 0014 80000000 		.long	128
+ 5472 0018 00000000 		.quad	gain_process_2_128
+ 5472      00000000 
+ 5473 0020 02000000 		.long	2
+ 5474 0024 00010000 		.long	256
+ 5475 0028 00000000 		.quad	gain_process_2_256
+ 5475      00000000 
+ 5476 0030 08000000 		.long	8
+ 5477 0034 40000000 		.long	64
+ 5478 0038 00000000 		.quad	gain_process_8_64
+ 5478      00000000 
+ 5479 0040 08000000 		.long	8
+ 5480 0044 80000000 		.long	128
+ 5481 0048 00000000 		.quad	gain_process_8_128
+ 5481      00000000 
+ 5482 0050 08000000 		.long	8
+ 5483 0054 00010000 		.long	256
+ 5484 0058 00000000 		.quad	gain_process_8_256
+ 5484      00000000 
+ 5485 0060 00000000 		.long	0
+ 5486 0064 00000000 		.long	0
+ 5487 0068 00000000 		.quad	gain_process
+ 5487      00000000 
+ 5488              		.section	.rodata.cst8,"aM",@progbits,8
+ 5489              		.align 8
+ 5490              	.LC1:
+ 5491 0000 00000000 		.long	0
+ 5492 0004 0000F03F 		.long	1072693248
+ 5493              		.section	.rodata.cst16,"aM",@progbits,16
+ 5494              		.align 16
+ 5495              	.LC2:
+ 5496 0000 00000080 		.long	-2147483648
+ 5497 0004 00000000 		.long	0
+ 5498 0008 00000000 		.long	0
+ 5499 000c 00000000 		.long	0
+ 5500              		.section	.rodata.cst8
+ 5501              		.align 8
+ 5502              	.LC3:
+ 5503 0008 DA2DC656 		.long	1455828442
+ 5504 000c 419FEEBF 		.long	-1074880703
+ 5505              		.align 8
+ 5506              	.LC4:
+ 5507 0010 CD3B7F66 		.long	1719614413
+ 5508 0014 9EA0E63F 		.long	1072079006
+ 5509              		.align 8
+ 5510              	.LC5:
+ 5511 0018 00000000 		.long	0
+ 5512 001c 0000E03F 		.long	1071644672
+ 5513              		.section	.rodata.cst16
+ 5514              		.align 16
+ 5515              	.LC6:
+ 5516 0010 FFFFFFFF 		.long	-1
+ 5517 0014 FFFFFF7F 		.long	2147483647
+ 5518 0018 00000000 		.long	0
+ 5519 001c 00000000 		.long	0
+ 5520              		.section	.rodata.cst8
+ 5521              		.align 8
+ 5522              	.LC7:
+ 5523 0020 8DEDB5A0 		.long	-1598689907
+ 5524 0024 F7C6B03E 		.long	1051772663
+ 5525              		.align 8
+ 5526              	.LC8:
+ 5527 0028 00000000 		.long	0
+ 5528 002c 00000040 		.long	1073741824
+ 5529              		.align 8
+ 5530              	.LC9:
+ 5531 0030 00000000 		.long	0
+ 5532 0034 00000840 		.long	1074266112
+ 5533              		.section	.rodata.cst16
+ 5534              		.align 16
+ 5535              	.LC10:
+ 5536 0020 00000000 		.long	0
+ 5537 0024 00000080 		.long	-2147483648
+ 5538 0028 00000000 		.long	0
+ 5539 002c 00000000 		.long	0
+ 5540              		.section	.rodata.cst8
+ 5541              		.align 8
+ 5542              	.LC11:
+ 5543 0038 00000000 		.long	0
+ 5544 003c 00001840 		.long	1075314688
+ 5545              		.align 8
+ 5546              	.LC15:
+ 5547 0040 00000000 		.long	0
+ 5548 0044 0000F0BF 		.long	-1074790400
+ 5549              		.align 8
+ 5550              	.LC16:
+ 5551 0048 182D4454 		.long	1413754136
+ 5552 004c FB210940 		.long	1074340347
+ 5553              		.align 8
+ 5554              	.LC17:
+ 5555 0050 00000000 		.long	0
+ 5556 0054 0000C03F 		.long	1069547520
+ 5557              		.align 8
+ 5558              	.LC18:
+ 5559 0058 00000000 		.long	0
+ 5560 005c 0000D03F 		.long	1070596096
+ 5561              		.align 8
+ 5562              	.LC19:
+ 5563 0060 00000000 		.long	0
+ 5564 0064 00001CC0 		.long	-1071906816
+ 5565              		.section	.rodata.cst4,"aM",@progbits,4
+ 5566              		.align 4
+ 5567              	.LC22:
+ 5568 0000 0000803F 		.long	1065353216
+ 5569              		.section	.rodata.cst16
+ 5570              		.align 16
+ 5571              	.LC24:
+ 5572 0030 01000000 		.long	1
+ 5573 0034 00000000 		.long	0
+ 5574 0038 00000000 		.long	0
+ 5575 003c 00000000 		.long	0
+ 5576              		.section	.rodata.cst8
+ 5577              		.align 8
+ 5578              	.LC38:
+ 5579 0068 00000000 		.long	0
+ 5580 006c 00004E40 		.long	1078853632
+ 5581              		.align 8
+ 5582              	.LC43:
+ 5583 0070 00000000 		.long	0
+ 5584 0074 00003440 		.long	1077149696
+ 5585              		.section	.rodata.cst4
+ 5586              		.align 4
+ 5587              	.LC44:
+ 5588 0004 00002041 		.long	1092616192
+ 5589              		.set	.LC47,.LC2
+ 5590              		.section	.rodata.cst16
+ 5591              		.align 16
+ 5592              	.LC48:
+ 5593 0040 FFFFFF7F 		.long	2147483647
+ 5594 0044 00000000 		.long	0
+ 5595 0048 00000000 		.long	0
+ 5596 004c 00000000 		.long	0
+ 5597              		.section	.rodata.cst4
+ 5598              		.align 4
+ 5599              	.LC50:
+ 5600 0008 0000807F 		.long	2139095040
+ 5601              		.section	.rodata.cst8
+ 5602              		.align 8
+ 5603              	.LC58:
+ 5604 0078 7B14AE47 		.long	1202590843
+ 5605 007c E17A943F 		.long	1066695393
+ 5606              		.align 8
+ 5607              	.LC59:
+ 5608 0080 00000000 		.long	0
+ 5609 0084 01000000 		.long	1
+ 5610              		.align 8
+ 5611              	.LC63:
+ 5612 0088 9A999999 		.long	-1717986918
+ 5613 008c 9999A93F 		.long	1068079513
+ 5614              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 5615              		.section	.note.GNU-stack,"",@progbits
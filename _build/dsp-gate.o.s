@@ -0,0 +1,3808 @@
+   1              		.file	"dsp-gate.c"
+   2              		.text
+   3              		.p2align 4
+   4              		.globl	gate_init
+   6              	gate_init:
+   7              	.LFB6405:
+   8              		.cfi_startproc
+   9 0000 4C8D5424 		leaq	8(%rsp), %r10
+   9      08
+  10              		.cfi_def_cfa 10, 0
+  11 0005 4883E4E0 		andq	$-32, %rsp
+  12 0009 C5F857C0 		vxorps	%xmm0, %xmm0, %xmm0
+  13 000d 41FF72F8 		pushq	-8(%r10)
+  14 0011 55       		pushq	%rbp
+  15 0012 4889E5   		movq	%rsp, %rbp
+  16              		.cfi_escape 0x10,0x6,0x2,0x76,0
+  17 0015 4152     		pushq	%r10
+  18              		.cfi_escape 0xf,0x3,0x76,0x78,0x6
+  19 0017 53       		pushq	%rbx
+  20 0018 4883EC20 		subq	$32, %rsp
+  21              		.cfi_escape 0x10,0x3,0x2,0x76,0x70
+  22 001c 488B9FC0 		movq	192(%rdi), %rbx
+  22      000000
+  23 0023 62F17F08 		vcvtusi2sdl	152(%rdi), %xmm0, %xmm0
+  23      7B4726
+  24 002a C5FB594B 		vmulsd	16(%rbx), %xmm0, %xmm1
+  24      10
+  25 002f C5FB5953 		vmulsd	24(%rbx), %xmm0, %xmm2
+  25      18
+  26 0034 C5FB5943 		vmulsd	8(%rbx), %xmm0, %xmm0
+  26      08
+  27 0039 C5FB114D 		vmovsd	%xmm1, -32(%rbp)
+  27      E0
+  28 003e C5FB1155 		vmovsd	%xmm2, -24(%rbp)
+  28      E8
+  29 0043 E8000000 		call	lrint@PLT
+  29      00
+  30 0048 C5FB104D 		vmovsd	-32(%rbp), %xmm1
+  30      E0
+  31 004d C5FB1005 		vmovsd	.LC1(%rip), %xmm0
+  31      00000000 
+  32 0055 894320   		movl	%eax, 32(%rbx)
+  33 0058 C5FB1055 		vmovsd	-24(%rbp), %xmm2
+  33      E8
+  34 005d C5F92FC8 		vcomisd	%xmm0, %xmm1
+  35 0061 724D     		jb	.L10
+  36 0063 C5FB5EC9 		vdivsd	%xmm1, %xmm0, %xmm1
+  37 0067 C5F92FD0 		vcomisd	%xmm0, %xmm2
+  38 006b C5F35AC9 		vcvtsd2ss	%xmm1, %xmm1, %xmm1
+  39 006f C5FA114B 		vmovss	%xmm1, 36(%rbx)
+  39      24
+  40 0074 724D     		jb	.L11
+  41              	.L14:
+  42 0076 C5FB5EC2 		vdivsd	%xmm2, %xmm0, %xmm0
+  43 007a C5FB5AC0 		vcvtsd2ss	%xmm0, %xmm0, %xmm0
+  44              	.L4:
+  45 007e C5FA1143 		vmovss	%xmm0, 40(%rbx)
+  45      28
+  46 0083 C4E27D18 		vbroadcastss	.LC0(%rip), %ymm0
+  46      05000000 
+  46      00
+  47 008c C5FC1143 		vmovups	%ymm0, 44(%rbx)
+  47      2C
+  48 0091 62F27D28 		vpbroadcastd	%eax, %ymm0
+  48      7CC0
+  49 0097 C5FE7F43 		vmovdqu	%ymm0, 76(%rbx)
+  49      4C
+  50 009c C5F877   		vzeroupper
+  51 009f 4883C420 		addq	$32, %rsp
+  52 00a3 5B       		popq	%rbx
+  53 00a4 415A     		popq	%r10
+  54              		.cfi_remember_state
+  55              		.cfi_def_cfa 10, 0
+  56 00a6 5D       		popq	%rbp
+  57 00a7 498D62F8 		leaq	-8(%r10), %rsp
+  58              		.cfi_def_cfa 7, 8
+  59 00ab C3       		ret
+  60 00ac 0F1F4000 		.p2align 4,,10
+  61              		.p2align 3
+  62              	.L10:
+  63              		.cfi_restore_state
+  64 00b0 C5FA100D 		vmovss	.LC0(%rip), %xmm1
+  64      00000000 
+  65 00b8 C5F92FD0 		vcomisd	%xmm0, %xmm2
+  66 00bc C5FA114B 		vmovss	%xmm1, 36(%rbx)
+  66      24
+  67 00c1 73B3     		jnb	.L14
+  68              	.L11:
+  69 00c3 C5FA1005 		vmovss	.LC0(%rip), %xmm0
+  69      00000000 
+  70 00cb EBB1     		jmp	.L4
+  71              		.cfi_endproc
+  72              	.LFE6405:
+  74              		.section	.rodata.str1.8,"aMS",@progbits,1
+  75              		.align 8
+  76              	.LC3:
+  77 0000 73746174 		.string	"static float s%d_gain[NCHANNELS];\n"
+  77      69632066 
+  77      6C6F6174 
+  77      20732564 
+  77      5F676169 
+  78 0023 00000000 		.align 8
+  78      00
+  79              	.LC4:
+  80 0028 73746174 		.string	"static unsigned int s%d_holdleft[NCHANNELS];\n"
+  80      69632075 
+  80      6E736967 
+  80      6E656420 
+  80      696E7420 
+  81 0056 0000     		.align 8
+  82              	.LC5:
+  83 0058 20202020 		.string	"        float s%d_g = s%d_gain[c];\n"
+  83      20202020 
+  83      666C6F61 
+  83      74207325 
+  83      645F6720 
+  84 007c 00000000 		.align 8
+  85              	.LC6:
+  86 0080 20202020 		.string	"        unsigned int s%d_h = s%d_holdleft[c];\n"
+  86      20202020 
+  86      756E7369 
+  86      676E6564 
+  86      20696E74 
+  87 00af 00       		.align 8
+  88              	.LC7:
+  89 00b0 20202020 		.string	"            if (fabsf(x) > %af) {\n"
+  89      20202020 
+  89      20202020 
+  89      69662028 
+  89      66616273 
+  90              		.section	.rodata.str1.1,"aMS",@progbits,1
+  91              	.LC8:
+  92 0000 20202020 		.string	"                s%d_h = %uu;\n"
+  92      20202020 
+  92      20202020 
+  92      20202020 
+  92      7325645F 
+  93              		.section	.rodata.str1.8
+  94 00d3 00000000 		.align 8
+  94      00
+  95              	.LC9:
+  96 00d8 20202020 		.string	"                s%d_g = fminf(s%d_g + %af, 1.0f);\n"
+  96      20202020 
+  96      20202020 
+  96      20202020 
+  96      7325645F 
+  97 010b 00000000 		.align 8
+  97      00
+  98              	.LC10:
+  99 0110 20202020 		.string	"            } else if (s%d_h) {\n"
+  99      20202020 
+  99      20202020 
+  99      7D20656C 
+  99      73652069 
+ 100              		.section	.rodata.str1.1
+ 101              	.LC11:
+ 102 001e 20202020 		.string	"                s%d_h--;\n"
+ 102      20202020 
+ 102      20202020 
+ 102      20202020 
+ 102      7325645F 
+ 103              	.LC12:
+ 104 0038 20202020 		.string	"            } else {\n"
+ 104      20202020 
+ 104      20202020 
+ 104      7D20656C 
+ 104      7365207B 
+ 105              		.section	.rodata.str1.8
+ 106 0131 00000000 		.align 8
+ 106      000000
+ 107              	.LC13:
+ 108 0138 20202020 		.string	"                s%d_g = fmaxf(s%d_g - %af, 0.0f);\n"
+ 108      20202020 
+ 108      20202020 
+ 108      20202020 
+ 108      7325645F 
+ 109              		.section	.rodata.str1.1
+ 110              	.LC14:
+ 111 004e 20202020 		.string	"            }\n"
+ 111      20202020 
+ 111      20202020 
+ 111      7D0A00
+ 112              	.LC15:
+ 113 005d 20202020 		.string	"            x = s%d_g * x;\n"
+ 113      20202020 
+ 113      20202020 
+ 113      78203D20 
+ 113      7325645F 
+ 114              	.LC16:
+ 115 0079 20202020 		.string	"        s%d_gain[c] = s%d_g;\n"
+ 115      20202020 
+ 115      7325645F 
+ 115      6761696E 
+ 115      5B635D20 
+ 116              		.section	.rodata.str1.8
+ 117 016b 00000000 		.align 8
+ 117      00
+ 118              	.LC17:
+ 119 0170 20202020 		.string	"        s%d_holdleft[c] = s%d_h;\n"
+ 119      20202020 
+ 119      7325645F 
+ 119      686F6C64 
+ 119      6C656674 
+ 120 0192 00000000 		.align 8
+ 120      0000
+ 121              	.LC18:
+ 122 0198 20202020 		.string	"    for (int c = 0; c < NCHANNELS; c++) {\n"
+ 122      666F7220 
+ 122      28696E74 
+ 122      2063203D 
+ 122      20303B20 
+ 123              		.section	.rodata.str1.1
+ 124              	.LC19:
+ 125 0097 20202020 		.string	"        s%d_gain[c] = 1.0f;\n"
+ 125      20202020 
+ 125      7325645F 
+ 125      6761696E 
+ 125      5B635D20 
+ 126              		.section	.rodata.str1.8
+ 127 01c3 00000000 		.align 8
+ 127      00
+ 128              	.LC20:
+ 129 01c8 20202020 		.string	"        s%d_holdleft[c] = %uu;\n"
+ 129      20202020 
+ 129      7325645F 
+ 129      686F6C64 
+ 129      6C656674 
+ 130              		.section	.rodata.str1.1
+ 131              	.LC21:
+ 132 00b4 20202020 		.string	"    }\n"
+ 132      7D0A00
+ 133              		.text
+ 134 00cd 0F1F00   		.p2align 4
+ 135              		.globl	gate_codegen
+ 137              	gate_codegen:
+ 138              	.LFB6406:
+ 139              		.cfi_startproc
+ 140 00d0 4155     		pushq	%r13
+ 141              		.cfi_def_cfa_offset 16
+ 142              		.cfi_offset 13, -16
+ 143 00d2 4154     		pushq	%r12
+ 144              		.cfi_def_cfa_offset 24
+ 145              		.cfi_offset 12, -24
+ 146 00d4 55       		pushq	%rbp
+ 147              		.cfi_def_cfa_offset 32
+ 148              		.cfi_offset 6, -32
+ 149 00d5 53       		pushq	%rbx
+ 150              		.cfi_def_cfa_offset 40
+ 151              		.cfi_offset 3, -40
+ 152 00d6 4883EC08 		subq	$8, %rsp
+ 153              		.cfi_def_cfa_offset 48
+ 154 00da 4C8BA7C0 		movq	192(%rdi), %r12
+ 154      000000
+ 155 00e1 83FA04   		cmpl	$4, %edx
+ 156 00e4 7777     		ja	.L16
+ 157 00e6 89CB     		movl	%ecx, %ebx
+ 158 00e8 89D2     		movl	%edx, %edx
+ 159 00ea 488D0D00 		leaq	.L18(%rip), %rcx
+ 159      000000
+ 160 00f1 4889F5   		movq	%rsi, %rbp
+ 161 00f4 48630491 		movslq	(%rcx,%rdx,4), %rax
+ 162 00f8 4801C8   		addq	%rcx, %rax
+ 163 00fb FFE0     		jmp	*%rax
+ 164              		.section	.rodata
+ 165              		.align 4
+ 166              		.align 4
+ 167              	.L18:
+ 168 0000 00000000 		.long	.L22-.L18
+ 169 0004 00000000 		.long	.L21-.L18
+ 170 0008 00000000 		.long	.L20-.L18
+ 171 000c 00000000 		.long	.L19-.L18
+ 172 0010 00000000 		.long	.L17-.L18
+ 173              		.text
+ 174 00fd 0F1F00   		.p2align 4,,10
+ 175              		.p2align 3
+ 176              	.L17:
+ 177 0100 4889F1   		movq	%rsi, %rcx
+ 178 0103 BA2A0000 		movl	$42, %edx
+ 178      00
+ 179 0108 BE010000 		movl	$1, %esi
+ 179      00
+ 180 010d 488D3D00 		leaq	.LC18(%rip), %rdi
+ 180      000000
+ 181 0114 E8000000 		call	fwrite@PLT
+ 181      00
+ 182 0119 89DA     		movl	%ebx, %edx
+ 183 011b 488D3500 		leaq	.LC19(%rip), %rsi
+ 183      000000
+ 184 0122 31C0     		xorl	%eax, %eax
+ 185 0124 4889EF   		movq	%rbp, %rdi
+ 186 0127 E8000000 		call	fprintf@PLT
+ 186      00
+ 187 012c 418B4C24 		movl	32(%r12), %ecx
+ 187      20
+ 188 0131 89DA     		movl	%ebx, %edx
+ 189 0133 4889EF   		movq	%rbp, %rdi
+ 190 0136 488D3500 		leaq	.LC20(%rip), %rsi
+ 190      000000
+ 191 013d 31C0     		xorl	%eax, %eax
+ 192 013f E8000000 		call	fprintf@PLT
+ 192      00
+ 193 0144 4889E9   		movq	%rbp, %rcx
+ 194 0147 BA060000 		movl	$6, %edx
+ 194      00
+ 195 014c BE010000 		movl	$1, %esi
+ 195      00
+ 196 0151 488D3D00 		leaq	.LC21(%rip), %rdi
+ 196      000000
+ 197 0158 E8000000 		call	fwrite@PLT
+ 197      00
+ 198              	.L16:
+ 199 015d 4883C408 		addq	$8, %rsp
+ 200              		.cfi_remember_state
+ 201              		.cfi_def_cfa_offset 40
+ 202 0161 31C0     		xorl	%eax, %eax
+ 203 0163 5B       		popq	%rbx
+ 204              		.cfi_def_cfa_offset 32
+ 205 0164 5D       		popq	%rbp
+ 206              		.cfi_def_cfa_offset 24
+ 207 0165 415C     		popq	%r12
+ 208              		.cfi_def_cfa_offset 16
+ 209 0167 415D     		popq	%r13
+ 210              		.cfi_def_cfa_offset 8
+ 211 0169 C3       		ret
+ 212 016a 660F1F44 		.p2align 4,,10
+ 212      0000
+ 213              		.p2align 3
+ 214              	.L19:
+ 215              		.cfi_restore_state
+ 216 0170 89D9     		movl	%ebx, %ecx
+ 217 0172 89DA     		movl	%ebx, %edx
+ 218 0174 4889EF   		movq	%rbp, %rdi
+ 219 0177 31C0     		xorl	%eax, %eax
+ 220 0179 488D3500 		leaq	.LC16(%rip), %rsi
+ 220      000000
+ 221 0180 E8000000 		call	fprintf@PLT
+ 221      00
+ 222 0185 89D9     		movl	%ebx, %ecx
+ 223 0187 89DA     		movl	%ebx, %edx
+ 224 0189 4889EF   		movq	%rbp, %rdi
+ 225 018c 488D3500 		leaq	.LC17(%rip), %rsi
+ 225      000000
+ 226 0193 31C0     		xorl	%eax, %eax
+ 227 0195 E8000000 		call	fprintf@PLT
+ 227      00
+ 228 019a 4883C408 		addq	$8, %rsp
+ 229              		.cfi_remember_state
+ 230              		.cfi_def_cfa_offset 40
+ 231 019e 31C0     		xorl	%eax, %eax
+ 232 01a0 5B       		popq	%rbx
+ 233              		.cfi_def_cfa_offset 32
+ 234 01a1 5D       		popq	%rbp
+ 235              		.cfi_def_cfa_offset 24
+ 236 01a2 415C     		popq	%r12
+ 237              		.cfi_def_cfa_offset 16
+ 238 01a4 415D     		popq	%r13
+ 239              		.cfi_def_cfa_offset 8
+ 240 01a6 C3       		ret
+ 241 01a7 660F1F84 		.p2align 4,,10
+ 241      00000000 
+ 241      00
+ 242              		.p2align 3
+ 243              	.L22:
+ 244              		.cfi_restore_state
+ 245 01b0 89DA     		movl	%ebx, %edx
+ 246 01b2 4889EF   		movq	%rbp, %rdi
+ 247 01b5 488D3500 		leaq	.LC3(%rip), %rsi
+ 247      000000
+ 248 01bc 31C0     		xorl	%eax, %eax
+ 249 01be E8000000 		call	fprintf@PLT
+ 249      00
+ 250 01c3 89DA     		movl	%ebx, %edx
+ 251 01c5 4889EF   		movq	%rbp, %rdi
+ 252 01c8 31C0     		xorl	%eax, %eax
+ 253 01ca 488D3500 		leaq	.LC4(%rip), %rsi
+ 253      000000
+ 254 01d1 E8000000 		call	fprintf@PLT
+ 254      00
+ 255 01d6 4883C408 		addq	$8, %rsp
+ 256              		.cfi_remember_state
+ 257              		.cfi_def_cfa_offset 40
+ 258 01da 31C0     		xorl	%eax, %eax
+ 259 01dc 5B       		popq	%rbx
+ 260              		.cfi_def_cfa_offset 32
+ 261 01dd 5D       		popq	%rbp
+ 262              		.cfi_def_cfa_offset 24
+ 263 01de 415C     		popq	%r12
+ 264              		.cfi_def_cfa_offset 16
+ 265 01e0 415D     		popq	%r13
+ 266              		.cfi_def_cfa_offset 8
+ 267 01e2 C3       		ret
+ 268              		.p2align 4,,10
+ 269 01e3 0F1F4400 		.p2align 3
+ 269      00
+ 270              	.L21:
+ 271              		.cfi_restore_state
+ 272 01e8 89D9     		movl	%ebx, %ecx
+ 273 01ea 89DA     		movl	%ebx, %edx
+ 274 01ec 4889EF   		movq	%rbp, %rdi
+ 275 01ef 31C0     		xorl	%eax, %eax
+ 276 01f1 488D3500 		leaq	.LC5(%rip), %rsi
+ 276      000000
+ 277 01f8 E8000000 		call	fprintf@PLT
+ 277      00
+ 278 01fd 89D9     		movl	%ebx, %ecx
+ 279 01ff 89DA     		movl	%ebx, %edx
+ 280 0201 4889EF   		movq	%rbp, %rdi
+ 281 0204 488D3500 		leaq	.LC6(%rip), %rsi
+ 281      000000
+ 282 020b 31C0     		xorl	%eax, %eax
+ 283 020d E8000000 		call	fprintf@PLT
+ 283      00
+ 284 0212 4883C408 		addq	$8, %rsp
+ 285              		.cfi_remember_state
+ 286              		.cfi_def_cfa_offset 40
+ 287 0216 31C0     		xorl	%eax, %eax
+ 288 0218 5B       		popq	%rbx
+ 289              		.cfi_def_cfa_offset 32
+ 290 0219 5D       		popq	%rbp
+ 291              		.cfi_def_cfa_offset 24
+ 292 021a 415C     		popq	%r12
+ 293              		.cfi_def_cfa_offset 16
+ 294 021c 415D     		popq	%r13
+ 295              		.cfi_def_cfa_offset 8
+ 296 021e C3       		ret
+ 297 021f 90       		.p2align 4,,10
+ 298              		.p2align 3
+ 299              	.L20:
+ 300              		.cfi_restore_state
+ 301 0220 C5F157C9 		vxorpd	%xmm1, %xmm1, %xmm1
+ 302 0224 4889EF   		movq	%rbp, %rdi
+ 303 0227 488D3500 		leaq	.LC7(%rip), %rsi
+ 303      000000
+ 304 022e B8010000 		movl	$1, %eax
+ 304      00
+ 305 0233 C4C1725A 		vcvtss2sd	(%r12), %xmm1, %xmm0
+ 305      0424
+ 306 0239 E8000000 		call	fprintf@PLT
+ 306      00
+ 307 023e 89DA     		movl	%ebx, %edx
+ 308 0240 418B4C24 		movl	32(%r12), %ecx
+ 308      20
+ 309 0245 4889EF   		movq	%rbp, %rdi
+ 310 0248 4C8D2D00 		leaq	.LC9(%rip), %r13
+ 310      000000
+ 311 024f 488D3500 		leaq	.LC8(%rip), %rsi
+ 311      000000
+ 312 0256 31C0     		xorl	%eax, %eax
+ 313 0258 E8000000 		call	fprintf@PLT
+ 313      00
+ 314 025d C5F157C9 		vxorpd	%xmm1, %xmm1, %xmm1
+ 315 0261 89D9     		movl	%ebx, %ecx
+ 316 0263 89DA     		movl	%ebx, %edx
+ 317 0265 4C89EE   		movq	%r13, %rsi
+ 318 0268 4889EF   		movq	%rbp, %rdi
+ 319 026b B8010000 		movl	$1, %eax
+ 319      00
+ 320 0270 C4C1725A 		vcvtss2sd	36(%r12), %xmm1, %xmm0
+ 320      442424
+ 321 0277 E8000000 		call	fprintf@PLT
+ 321      00
+ 322 027c 89DA     		movl	%ebx, %edx
+ 323 027e 4889EF   		movq	%rbp, %rdi
+ 324 0281 31C0     		xorl	%eax, %eax
+ 325 0283 488D3500 		leaq	.LC10(%rip), %rsi
+ 325      000000
+ 326 028a E8000000 		call	fprintf@PLT
+ 326      00
+ 327 028f 89DA     		movl	%ebx, %edx
+ 328 0291 4889EF   		movq	%rbp, %rdi
+ 329 0294 31C0     		xorl	%eax, %eax
+ 330 0296 488D3500 		leaq	.LC11(%rip), %rsi
+ 330      000000
+ 331 029d E8000000 		call	fprintf@PLT
+ 331      00
+ 332 02a2 C5F157C9 		vxorpd	%xmm1, %xmm1, %xmm1
+ 333 02a6 89D9     		movl	%ebx, %ecx
+ 334 02a8 89DA     		movl	%ebx, %edx
+ 335 02aa 4C89EE   		movq	%r13, %rsi
+ 336 02ad 4889EF   		movq	%rbp, %rdi
+ 337 02b0 B8010000 		movl	$1, %eax
+ 337      00
+ 338 02b5 C4C1725A 		vcvtss2sd	36(%r12), %xmm1, %xmm0
+ 338      442424
+ 339 02bc E8000000 		call	fprintf@PLT
+ 339      00
+ 340 02c1 4889E9   		movq	%rbp, %rcx
+ 341 02c4 BA150000 		movl	$21, %edx
+ 341      00
+ 342 02c9 BE010000 		movl	$1, %esi
+ 342      00
+ 343 02ce 488D3D00 		leaq	.LC12(%rip), %rdi
+ 343      000000
+ 344 02d5 E8000000 		call	fwrite@PLT
+ 344      00
+ 345 02da C5F157C9 		vxorpd	%xmm1, %xmm1, %xmm1
+ 346 02de 89D9     		movl	%ebx, %ecx
+ 347 02e0 89DA     		movl	%ebx, %edx
+ 348 02e2 4889EF   		movq	%rbp, %rdi
+ 349 02e5 488D3500 		leaq	.LC13(%rip), %rsi
+ 349      000000
+ 350 02ec B8010000 		movl	$1, %eax
+ 350      00
+ 351 02f1 C4C1725A 		vcvtss2sd	40(%r12), %xmm1, %xmm0
+ 351      442428
+ 352 02f8 E8000000 		call	fprintf@PLT
+ 352      00
+ 353 02fd 4889E9   		movq	%rbp, %rcx
+ 354 0300 BA0E0000 		movl	$14, %edx
+ 354      00
+ 355 0305 BE010000 		movl	$1, %esi
+ 355      00
+ 356 030a 488D3D00 		leaq	.LC14(%rip), %rdi
+ 356      000000
+ 357 0311 E8000000 		call	fwrite@PLT
+ 357      00
+ 358 0316 89DA     		movl	%ebx, %edx
+ 359 0318 4889EF   		movq	%rbp, %rdi
+ 360 031b 31C0     		xorl	%eax, %eax
+ 361 031d 488D3500 		leaq	.LC15(%rip), %rsi
+ 361      000000
+ 362 0324 E8000000 		call	fprintf@PLT
+ 362      00
+ 363 0329 4883C408 		addq	$8, %rsp
+ 364              		.cfi_def_cfa_offset 40
+ 365 032d 31C0     		xorl	%eax, %eax
+ 366 032f 5B       		popq	%rbx
+ 367              		.cfi_def_cfa_offset 32
+ 368 0330 5D       		popq	%rbp
+ 369              		.cfi_def_cfa_offset 24
+ 370 0331 415C     		popq	%r12
+ 371              		.cfi_def_cfa_offset 16
+ 372 0333 415D     		popq	%r13
+ 373              		.cfi_def_cfa_offset 8
+ 374 0335 C3       		ret
+ 375              		.cfi_endproc
+ 376              	.LFE6406:
+ 378 0336 662E0F1F 		.p2align 4
+ 378      84000000 
+ 378      0000
+ 379              		.globl	destroy_gate
+ 381              	destroy_gate:
+ 382              	.LFB6407:
+ 383              		.cfi_startproc
+ 384 0340 488BBFC0 		movq	192(%rdi), %rdi
+ 384      000000
+ 385 0347 E9000000 		jmp	free@PLT
+ 385      00
+ 386              		.cfi_endproc
+ 387              	.LFE6407:
+ 389 034c 0F1F4000 		.p2align 4
+ 390              		.globl	gate_preroll
+ 392              	gate_preroll:
+ 393              	.LFB6408:
+ 394              		.cfi_startproc
+ 395 0350 488B87C0 		movq	192(%rdi), %rax
+ 395      000000
+ 396 0357 C5F057C9 		vxorps	%xmm1, %xmm1, %xmm1
+ 397 035b 62F17708 		vcvtusi2sdl	152(%rdi), %xmm1, %xmm1
+ 397      7B4F26
+ 398 0362 C5FB1040 		vmovsd	8(%rax), %xmm0
+ 398      08
+ 399 0367 C5FB5840 		vaddsd	16(%rax), %xmm0, %xmm0
+ 399      10
+ 400 036c C5FB5840 		vaddsd	24(%rax), %xmm0, %xmm0
+ 400      18
+ 401 0371 C5FB59C1 		vmulsd	%xmm1, %xmm0, %xmm0
+ 402 0375 62F3FD08 		vrndscalesd	$10, %xmm0, %xmm0, %xmm0
+ 402      0BC00A
+ 403 037c C5FB5805 		vaddsd	.LC1(%rip), %xmm0, %xmm0
+ 403      00000000 
+ 404 0384 62F17F08 		vcvttsd2usi	%xmm0, %eax
+ 404      78C0
+ 405 038a C3       		ret
+ 406              		.cfi_endproc
+ 407              	.LFE6408:
+ 409 038b 0F1F4400 		.p2align 4
+ 409      00
+ 410              		.globl	clone_gate
+ 412              	clone_gate:
+ 413              	.LFB6409:
+ 414              		.cfi_startproc
+ 415 0390 55       		pushq	%rbp
+ 416              		.cfi_def_cfa_offset 16
+ 417              		.cfi_offset 6, -16
+ 418 0391 4889E5   		movq	%rsp, %rbp
+ 419              		.cfi_def_cfa_register 6
+ 420 0394 4154     		pushq	%r12
+ 421              		.cfi_offset 12, -24
+ 422 0396 4989F4   		movq	%rsi, %r12
+ 423 0399 53       		pushq	%rbx
+ 424              		.cfi_offset 3, -32
+ 425 039a 4889FB   		movq	%rdi, %rbx
+ 426 039d BF700000 		movl	$112, %edi
+ 426      00
+ 427 03a2 E8000000 		call	malloc@PLT
+ 427      00
+ 428 03a7 4885C0   		testq	%rax, %rax
+ 429 03aa 7439     		je	.L28
+ 430 03ac 498B9424 		movq	192(%r12), %rdx
+ 430      C0000000 
+ 431 03b4 62F1FE48 		vmovdqu64	(%rdx), %zmm0
+ 431      6F02
+ 432 03ba 62F1FE48 		vmovdqu64	%zmm0, (%rax)
+ 432      7F00
+ 433 03c0 62F1FE48 		vmovdqu64	48(%rdx), %zmm1
+ 433      6F8A3000 
+ 433      0000
+ 434 03ca 488983C0 		movq	%rax, 192(%rbx)
+ 434      000000
+ 435 03d1 62F1FE48 		vmovdqu64	%zmm1, 48(%rax)
+ 435      7F883000 
+ 435      0000
+ 436 03db 31C0     		xorl	%eax, %eax
+ 437 03dd C5F877   		vzeroupper
+ 438              	.L26:
+ 439 03e0 5B       		popq	%rbx
+ 440 03e1 415C     		popq	%r12
+ 441 03e3 5D       		popq	%rbp
+ 442              		.cfi_remember_state
+ 443              		.cfi_def_cfa 7, 8
+ 444 03e4 C3       		ret
+ 445              	.L28:
+ 446              		.cfi_restore_state
+ 447 03e5 B8010000 		movl	$1, %eax
+ 447      00
+ 448 03ea EBF4     		jmp	.L26
+ 449              		.cfi_endproc
+ 450              	.LFE6409:
+ 452 03ec 0F1F4000 		.p2align 4
+ 453              		.globl	gate_process
+ 455              	gate_process:
+ 456              	.LFB6398:
+ 457              		.cfi_startproc
+ 458 03f0 4C8D5424 		leaq	8(%rsp), %r10
+ 458      08
+ 459              		.cfi_def_cfa 10, 0
+ 460 03f5 4883E4E0 		andq	$-32, %rsp
+ 461 03f9 4989F8   		movq	%rdi, %r8
+ 462 03fc 41FF72F8 		pushq	-8(%r10)
+ 463 0400 55       		pushq	%rbp
+ 464 0401 4889E5   		movq	%rsp, %rbp
+ 465              		.cfi_escape 0x10,0x6,0x2,0x76,0
+ 466 0404 4157     		pushq	%r15
+ 467 0406 4156     		pushq	%r14
+ 468 0408 4155     		pushq	%r13
+ 469 040a 4154     		pushq	%r12
+ 470 040c 4152     		pushq	%r10
+ 471              		.cfi_escape 0xf,0x3,0x76,0x58,0x6
+ 472              		.cfi_escape 0x10,0xf,0x2,0x76,0x78
+ 473              		.cfi_escape 0x10,0xe,0x2,0x76,0x70
+ 474              		.cfi_escape 0x10,0xd,0x2,0x76,0x68
+ 475              		.cfi_escape 0x10,0xc,0x2,0x76,0x60
+ 476 040e 53       		pushq	%rbx
+ 477 040f 4883EC60 		subq	$96, %rsp
+ 478              		.cfi_escape 0x10,0x3,0x2,0x76,0x50
+ 479 0413 8BBFA400 		movl	164(%rdi), %edi
+ 479      0000
+ 480 0419 418B909C 		movl	156(%r8), %edx
+ 480      000000
+ 481 0420 498B98C0 		movq	192(%r8), %rbx
+ 481      000000
+ 482 0427 897DAC   		movl	%edi, -84(%rbp)
+ 483 042a 85D2     		testl	%edx, %edx
+ 484 042c 0F8E0204 		jle	.L80
+ 484      0000
+ 485 0432 4863C7   		movslq	%edi, %rax
+ 486 0435 4C63E2   		movslq	%edx, %r12
+ 487 0438 48C745B8 		movq	$0, -72(%rbp)
+ 487      00000000 
+ 488 0440 48C1E002 		salq	$2, %rax
+ 489 0444 4C896588 		movq	%r12, -120(%rbp)
+ 490 0448 48898570 		movq	%rax, -144(%rbp)
+ 490      FFFFFF
+ 491 044f 8D47F8   		leal	-8(%rdi), %eax
+ 492 0452 C1E803   		shrl	$3, %eax
+ 493 0455 83C001   		addl	$1, %eax
+ 494 0458 894580   		movl	%eax, -128(%rbp)
+ 495 045b C1E003   		sall	$3, %eax
+ 496 045e 29C7     		subl	%eax, %edi
+ 497 0460 8945A8   		movl	%eax, -88(%rbp)
+ 498 0463 4898     		cltq
+ 499 0465 897D84   		movl	%edi, -124(%rbp)
+ 500 0468 48898578 		movq	%rax, -136(%rbp)
+ 500      FFFFFF
+ 501 046f 90       		.p2align 4,,10
+ 502              		.p2align 3
+ 503              	.L65:
+ 504 0470 488B75B8 		movq	-72(%rbp), %rsi
+ 505 0474 498B8088 		movq	136(%r8), %rax
+ 505      000000
+ 506 047b 803C3000 		cmpb	$0, (%rax,%rsi)
+ 507 047f 4D8B54F0 		movq	8(%r8,%rsi,8), %r10
+ 507      08
+ 508 0484 498B7CF0 		movq	72(%r8,%rsi,8), %rdi
+ 508      48
+ 509 0489 C5FA1044 		vmovss	44(%rbx,%rsi,4), %xmm0
+ 509      B32C
+ 510 048f 741C     		je	.L35
+ 511 0491 C5F057C9 		vxorps	%xmm1, %xmm1, %xmm1
+ 512 0495 C5F82EC1 		vucomiss	%xmm1, %xmm0
+ 513 0499 7A12     		jp	.L35
+ 514 049b 7510     		jne	.L35
+ 515 049d 488B45B8 		movq	-72(%rbp), %rax
+ 516 04a1 8B44834C 		movl	76(%rbx,%rax,4), %eax
+ 517 04a5 85C0     		testl	%eax, %eax
+ 518 04a7 0F84D503 		je	.L82
+ 518      0000
+ 519              	.L35:
+ 520 04ad 837DAC07 		cmpl	$7, -84(%rbp)
+ 521 04b1 0F8EF803 		jle	.L83
+ 521      0000
+ 522 04b7 8B4580   		movl	-128(%rbp), %eax
+ 523 04ba 4C8955A0 		movq	%r10, -96(%rbp)
+ 524 04be 4D89D6   		movq	%r10, %r14
+ 525 04c1 B9010000 		movl	$1, %ecx
+ 525      00
+ 526 04c6 48897D98 		movq	%rdi, -104(%rbp)
+ 527 04ca 4989FF   		movq	%rdi, %r15
+ 528 04cd 4989DC   		movq	%rbx, %r12
+ 529 04d0 48C1E005 		salq	$5, %rax
+ 530 04d4 4C894590 		movq	%r8, -112(%rbp)
+ 531 04d8 4801F8   		addq	%rdi, %rax
+ 532 04db 488945B0 		movq	%rax, -80(%rbp)
+ 533 04df 488B45B8 		movq	-72(%rbp), %rax
+ 534              		.p2align 4,,10
+ 535 04e3 0F1F4400 		.p2align 3
+ 535      00
+ 536              	.L56:
+ 537 04e8 C4C17A10 		vmovss	(%r12), %xmm1
+ 537      0C24
+ 538 04ee C4E27D18 		vbroadcastss	.LC24(%rip), %ymm4
+ 538      25000000 
+ 538      00
+ 539 04f7 C4C15C55 		vandnps	(%r14), %ymm4, %ymm2
+ 539      16
+ 540 04fc C4E27D18 		vbroadcastss	%xmm1, %ymm3
+ 540      D9
+ 541 0501 C5ECC2D3 		vcmpps	$30, %ymm3, %ymm2, %ymm2
+ 541      1E
+ 542 0506 C57C50CA 		vmovmskps	%ymm2, %r9d
+ 543 050a 4585C9   		testl	%r9d, %r9d
+ 544 050d 0F85DD01 		jne	.L38
+ 544      0000
+ 545 0513 C5F82E05 		vucomiss	.LC0(%rip), %xmm0
+ 545      00000000 
+ 546 051b 458B6C84 		movl	76(%r12,%rax,4), %r13d
+ 546      4C
+ 547 0520 0F8A2202 		jp	.L41
+ 547      0000
+ 548 0526 0F851C02 		jne	.L41
+ 548      0000
+ 549 052c 4183FD07 		cmpl	$7, %r13d
+ 550 0530 0F871A03 		ja	.L84
+ 550      0000
+ 551              	.L46:
+ 552 0536 488945C0 		movq	%rax, -64(%rbp)
+ 553 053a 31DB     		xorl	%ebx, %ebx
+ 554 053c C5F877   		vzeroupper
+ 555 053f EB3F     		jmp	.L55
+ 556              		.p2align 4,,10
+ 557 0541 0F1F8000 		.p2align 3
+ 557      000000
+ 558              	.L85:
+ 559 0548 C4C17A58 		vaddss	36(%r12), %xmm0, %xmm0
+ 559      442424
+ 560 054f 458B6C24 		movl	32(%r12), %r13d
+ 560      20
+ 561 0554 C5FA100D 		vmovss	.LC0(%rip), %xmm1
+ 561      00000000 
+ 562 055c E8000000 		call	fminf@PLT
+ 562      00
+ 563 0561 C5FA1055 		vmovss	-56(%rbp), %xmm2
+ 563      C8
+ 564              	.L52:
+ 565 0566 C5EA59D0 		vmulss	%xmm0, %xmm2, %xmm2
+ 566 056a C4C17A11 		vmovss	%xmm2, (%r15,%rbx)
+ 566      141F
+ 567 0570 4883C304 		addq	$4, %rbx
+ 568 0574 4883FB20 		cmpq	$32, %rbx
+ 569 0578 7466     		je	.L54
+ 570 057a C4C17A10 		vmovss	(%r12), %xmm1
+ 570      0C24
+ 571              	.L55:
+ 572 0580 C4C17A10 		vmovss	(%r14,%rbx), %xmm2
+ 572      141E
+ 573 0586 C5E8541D 		vandps	.LC25(%rip), %xmm2, %xmm3
+ 573      00000000 
+ 574 058e C5F82FD9 		vcomiss	%xmm1, %xmm3
+ 575 0592 C5FA1155 		vmovss	%xmm2, -56(%rbp)
+ 575      C8
+ 576 0597 77AF     		ja	.L85
+ 577 0599 4585ED   		testl	%r13d, %r13d
+ 578 059c 7422     		je	.L53
+ 579 059e C4C17A58 		vaddss	36(%r12), %xmm0, %xmm0
+ 579      442424
+ 580 05a5 4183ED01 		subl	$1, %r13d
+ 581 05a9 C5FA100D 		vmovss	.LC0(%rip), %xmm1
+ 581      00000000 
+ 582 05b1 E8000000 		call	fminf@PLT
+ 582      00
+ 583 05b6 C5FA1055 		vmovss	-56(%rbp), %xmm2
+ 583      C8
+ 584 05bb EBA9     		jmp	.L52
+ 585 05bd 0F1F00   		.p2align 4,,10
+ 586              		.p2align 3
+ 587              	.L53:
+ 588 05c0 C4C17A5C 		vsubss	40(%r12), %xmm0, %xmm0
+ 588      442428
+ 589 05c7 C5F057C9 		vxorps	%xmm1, %xmm1, %xmm1
+ 590 05cb E8000000 		call	fmaxf@PLT
+ 590      00
+ 591 05d0 C5FA1055 		vmovss	-56(%rbp), %xmm2
+ 591      C8
+ 592 05d5 EB8F     		jmp	.L52
+ 593 05d7 660F1F84 		.p2align 4,,10
+ 593      00000000 
+ 593      00
+ 594              		.p2align 3
+ 595              	.L54:
+ 596 05e0 488B45C0 		movq	-64(%rbp), %rax
+ 597 05e4 31C9     		xorl	%ecx, %ecx
+ 598 05e6 45896C84 		movl	%r13d, 76(%r12,%rax,4)
+ 598      4C
+ 599 05eb C4C17A11 		vmovss	%xmm0, 44(%r12,%rax,4)
+ 599      44842C
+ 600              	.L48:
+ 601 05f2 4983C620 		addq	$32, %r14
+ 602 05f6 4983C720 		addq	$32, %r15
+ 603 05fa 4C397DB0 		cmpq	%r15, -80(%rbp)
+ 604 05fe 0F85E4FE 		jne	.L56
+ 604      FFFF
+ 605 0604 4C8B55A0 		movq	-96(%rbp), %r10
+ 606 0608 488B7D98 		movq	-104(%rbp), %rdi
+ 607 060c 4C89E3   		movq	%r12, %rbx
+ 608 060f 4C8B4590 		movq	-112(%rbp), %r8
+ 609 0613 488B8578 		movq	-136(%rbp), %rax
+ 609      FFFFFF
+ 610 061a 4C634D84 		movslq	-124(%rbp), %r9
+ 611 061e 448B5DA8 		movl	-88(%rbp), %r11d
+ 612              	.L34:
+ 613 0622 488B55B8 		movq	-72(%rbp), %rdx
+ 614 0626 448B7C93 		movl	76(%rbx,%rdx,4), %r15d
+ 614      4C
+ 615 062b 4585C9   		testl	%r9d, %r9d
+ 616 062e 0F8E8F01 		jle	.L57
+ 616      0000
+ 617 0634 48897DC0 		movq	%rdi, -64(%rbp)
+ 618 0638 488D1485 		leaq	0(,%rax,4), %rdx
+ 618      00000000 
+ 619 0640 4901C1   		addq	%rax, %r9
+ 620 0643 4989DD   		movq	%rbx, %r13
+ 621 0646 884DB0   		movb	%cl, -80(%rbp)
+ 622 0649 4D8D3412 		leaq	(%r10,%rdx), %r14
+ 623 064d 4C8D2417 		leaq	(%rdi,%rdx), %r12
+ 624 0651 44895DA0 		movl	%r11d, -96(%rbp)
+ 625 0655 4B8D048A 		leaq	(%r10,%r9,4), %rax
+ 626 0659 4C89F3   		movq	%r14, %rbx
+ 627 065c 4D89E6   		movq	%r12, %r14
+ 628 065f 4C894598 		movq	%r8, -104(%rbp)
+ 629 0663 4989C4   		movq	%rax, %r12
+ 630 0666 C5F877   		vzeroupper
+ 631 0669 EB3C     		jmp	.L62
+ 632 066b 0F1F4400 		.p2align 4,,10
+ 632      00
+ 633              		.p2align 3
+ 634              	.L87:
+ 635 0670 C4C17A58 		vaddss	36(%r13), %xmm0, %xmm0
+ 635      4524
+ 636 0676 458B7D20 		movl	32(%r13), %r15d
+ 637 067a C5FA100D 		vmovss	.LC0(%rip), %xmm1
+ 637      00000000 
+ 638 0682 E8000000 		call	fminf@PLT
+ 638      00
+ 639 0687 C5FA1055 		vmovss	-56(%rbp), %xmm2
+ 639      C8
+ 640              	.L60:
+ 641 068c C5FA59D2 		vmulss	%xmm2, %xmm0, %xmm2
+ 642 0690 4883C304 		addq	$4, %rbx
+ 643 0694 4983C604 		addq	$4, %r14
+ 644 0698 C4C17A11 		vmovss	%xmm2, -4(%r14)
+ 644      56FC
+ 645 069e 4939DC   		cmpq	%rbx, %r12
+ 646 06a1 0F840901 		je	.L86
+ 646      0000
+ 647              	.L62:
+ 648 06a7 C5FA1013 		vmovss	(%rbx), %xmm2
+ 649 06ab C5E8540D 		vandps	.LC25(%rip), %xmm2, %xmm1
+ 649      00000000 
+ 650 06b3 C4C1782F 		vcomiss	0(%r13), %xmm1
+ 650      4D00
+ 651 06b9 C5FA1155 		vmovss	%xmm2, -56(%rbp)
+ 651      C8
+ 652 06be 77B0     		ja	.L87
+ 653 06c0 4585FF   		testl	%r15d, %r15d
+ 654 06c3 0F84B700 		je	.L61
+ 654      0000
+ 655 06c9 C4C17A58 		vaddss	36(%r13), %xmm0, %xmm0
+ 655      4524
+ 656 06cf 4183EF01 		subl	$1, %r15d
+ 657 06d3 C5FA100D 		vmovss	.LC0(%rip), %xmm1
+ 657      00000000 
+ 658 06db E8000000 		call	fminf@PLT
+ 658      00
+ 659 06e0 C5FA1055 		vmovss	-56(%rbp), %xmm2
+ 659      C8
+ 660 06e5 EBA5     		jmp	.L60
+ 661 06e7 660F1F84 		.p2align 4,,10
+ 661      00000000 
+ 661      00
+ 662              		.p2align 3
+ 663              	.L38:
+ 664 06f0 C5F82E05 		vucomiss	.LC0(%rip), %xmm0
+ 664      00000000 
+ 665 06f8 0F8AA200 		jp	.L42
+ 665      0000
+ 666 06fe 0F859C00 		jne	.L42
+ 666      0000
+ 667 0704 4181F9FF 		cmpl	$255, %r9d
+ 667      000000
+ 668 070b 0F854F01 		jne	.L44
+ 668      0000
+ 669 0711 418B4C24 		movl	32(%r12), %ecx
+ 669      20
+ 670              	.L45:
+ 671 0716 F3450FBD 		lzcntl	%r9d, %r9d
+ 671      C9
+ 672 071b 4183E918 		subl	$24, %r9d
+ 673 071f 4429C9   		subl	%r9d, %ecx
+ 674 0722 89CA     		movl	%ecx, %edx
+ 675              	.L47:
+ 676 0724 41895484 		movl	%edx, 76(%r12,%rax,4)
+ 676      4C
+ 677 0729 C4C17E6F 		vmovdqu	(%r14), %ymm5
+ 677      2E
+ 678 072e 31C9     		xorl	%ecx, %ecx
+ 679 0730 C4C17E7F 		vmovdqu	%ymm5, (%r15)
+ 679      2F
+ 680 0735 C4C17A10 		vmovss	44(%r12,%rax,4), %xmm0
+ 680      44842C
+ 681 073c E9B1FEFF 		jmp	.L48
+ 681      FF
+ 682              		.p2align 4,,10
+ 683 0741 0F1F8000 		.p2align 3
+ 683      000000
+ 684              	.L41:
+ 685 0748 C5E857D2 		vxorps	%xmm2, %xmm2, %xmm2
+ 686 074c C5F82EC2 		vucomiss	%xmm2, %xmm0
+ 687 0750 0F8AE0FD 		jp	.L46
+ 687      FFFF
+ 688 0756 0F85DAFD 		jne	.L46
+ 688      FFFF
+ 689 075c 4585ED   		testl	%r13d, %r13d
+ 690 075f 0F85D1FD 		jne	.L46
+ 690      FFFF
+ 691 0765 C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 692 0769 62D17F28 		vmovdqu8	%ymm0, (%r15)
+ 692      7F07
+ 693 076f C4C17A10 		vmovss	44(%r12,%rax,4), %xmm0
+ 693      44842C
+ 694 0776 E977FEFF 		jmp	.L48
+ 694      FF
+ 695 077b 0F1F4400 		.p2align 4,,10
+ 695      00
+ 696              		.p2align 3
+ 697              	.L61:
+ 698 0780 C4C17A5C 		vsubss	40(%r13), %xmm0, %xmm0
+ 698      4528
+ 699 0786 C5F057C9 		vxorps	%xmm1, %xmm1, %xmm1
+ 700 078a E8000000 		call	fmaxf@PLT
+ 700      00
+ 701 078f C5FA1055 		vmovss	-56(%rbp), %xmm2
+ 701      C8
+ 702 0794 E9F3FEFF 		jmp	.L60
+ 702      FF
+ 703 0799 0F1F8000 		.p2align 4,,10
+ 703      000000
+ 704              		.p2align 3
+ 705              	.L42:
+ 706 07a0 458B6C84 		movl	76(%r12,%rax,4), %r13d
+ 706      4C
+ 707 07a5 E98CFDFF 		jmp	.L46
+ 707      FF
+ 708 07aa 660F1F44 		.p2align 4,,10
+ 708      0000
+ 709              		.p2align 3
+ 710              	.L86:
+ 711 07b0 488B7DC0 		movq	-64(%rbp), %rdi
+ 712 07b4 0FB64DB0 		movzbl	-80(%rbp), %ecx
+ 713 07b8 4C89EB   		movq	%r13, %rbx
+ 714 07bb 448B5DA0 		movl	-96(%rbp), %r11d
+ 715 07bf 4C8B4598 		movq	-104(%rbp), %r8
+ 716              	.L57:
+ 717 07c3 488B45B8 		movq	-72(%rbp), %rax
+ 718 07c7 448B55AC 		movl	-84(%rbp), %r10d
+ 719 07cb 44897C83 		movl	%r15d, 76(%rbx,%rax,4)
+ 719      4C
+ 720 07d0 C5FA1144 		vmovss	%xmm0, 44(%rbx,%rax,4)
+ 720      832C
+ 721 07d6 4539DA   		cmpl	%r11d, %r10d
+ 722 07d9 7E32     		jle	.L63
+ 723 07db 4489D2   		movl	%r10d, %edx
+ 724 07de 4963F3   		movslq	%r11d, %rsi
+ 725 07e1 C5F857C0 		vxorps	%xmm0, %xmm0, %xmm0
+ 726 07e5 4429DA   		subl	%r11d, %edx
+ 727 07e8 488D04B7 		leaq	(%rdi,%rsi,4), %rax
+ 728 07ec 4801F2   		addq	%rsi, %rdx
+ 729 07ef 31F6     		xorl	%esi, %esi
+ 730 07f1 488D3C97 		leaq	(%rdi,%rdx,4), %rdi
+ 731              		.p2align 4,,10
+ 732 07f5 0F1F00   		.p2align 3
+ 733              	.L64:
+ 734 07f8 C5F82E00 		vucomiss	(%rax), %xmm0
+ 735 07fc 0F9BC2   		setnp	%dl
+ 736 07ff 0F45D6   		cmovne	%esi, %edx
+ 737 0802 4883C004 		addq	$4, %rax
+ 738 0806 21D1     		andl	%edx, %ecx
+ 739 0808 4839F8   		cmpq	%rdi, %rax
+ 740 080b 75EB     		jne	.L64
+ 741              	.L63:
+ 742 080d 498B8090 		movq	144(%r8), %rax
+ 742      000000
+ 743 0814 488B7DB8 		movq	-72(%rbp), %rdi
+ 744 0818 880C38   		movb	%cl, (%rax,%rdi)
+ 745              	.L37:
+ 746 081b 488345B8 		addq	$1, -72(%rbp)
+ 746      01
+ 747 0820 488B7D88 		movq	-120(%rbp), %rdi
+ 748 0824 488B45B8 		movq	-72(%rbp), %rax
+ 749 0828 4839F8   		cmpq	%rdi, %rax
+ 750 082b 0F853FFC 		jne	.L65
+ 750      FFFF
+ 751 0831 C5F877   		vzeroupper
+ 752              	.L80:
+ 753 0834 4883C460 		addq	$96, %rsp
+ 754 0838 5B       		popq	%rbx
+ 755 0839 415A     		popq	%r10
+ 756              		.cfi_remember_state
+ 757              		.cfi_def_cfa 10, 0
+ 758 083b 415C     		popq	%r12
+ 759 083d 415D     		popq	%r13
+ 760 083f 415E     		popq	%r14
+ 761 0841 415F     		popq	%r15
+ 762 0843 5D       		popq	%rbp
+ 763 0844 498D62F8 		leaq	-8(%r10), %rsp
+ 764              		.cfi_def_cfa 7, 8
+ 765 0848 C3       		ret
+ 766 0849 0F1F8000 		.p2align 4,,10
+ 766      000000
+ 767              		.p2align 3
+ 768              	.L84:
+ 769              		.cfi_restore_state
+ 770 0850 418D55F8 		leal	-8(%r13), %edx
+ 771 0854 E9CBFEFF 		jmp	.L47
+ 771      FF
+ 772 0859 0F1F8000 		.p2align 4,,10
+ 772      000000
+ 773              		.p2align 3
+ 774              	.L44:
+ 775 0860 458B6C84 		movl	76(%r12,%rax,4), %r13d
+ 775      4C
+ 776 0865 4183FD07 		cmpl	$7, %r13d
+ 777 0869 0F86C7FC 		jbe	.L46
+ 777      FFFF
+ 778 086f 418B4C24 		movl	32(%r12), %ecx
+ 778      20
+ 779 0874 83F907   		cmpl	$7, %ecx
+ 780 0877 0F86B9FC 		jbe	.L46
+ 780      FFFF
+ 781 087d E994FEFF 		jmp	.L45
+ 781      FF
+ 782              	.L82:
+ 783 0882 4C8945C8 		movq	%r8, -56(%rbp)
+ 784 0886 488B9570 		movq	-144(%rbp), %rdx
+ 784      FFFFFF
+ 785 088d 31F6     		xorl	%esi, %esi
+ 786 088f C5F877   		vzeroupper
+ 787 0892 E8000000 		call	memset@PLT
+ 787      00
+ 788 0897 4C8B45C8 		movq	-56(%rbp), %r8
+ 789 089b 488B7DB8 		movq	-72(%rbp), %rdi
+ 790 089f 498B8090 		movq	144(%r8), %rax
+ 790      000000
+ 791 08a6 C6043801 		movb	$1, (%rax,%rdi)
+ 792 08aa E96CFFFF 		jmp	.L37
+ 792      FF
+ 793              	.L83:
+ 794 08af 4C634DAC 		movslq	-84(%rbp), %r9
+ 795 08b3 31C0     		xorl	%eax, %eax
+ 796 08b5 B9010000 		movl	$1, %ecx
+ 796      00
+ 797 08ba 4531DB   		xorl	%r11d, %r11d
+ 798 08bd E960FDFF 		jmp	.L34
+ 798      FF
+ 799              		.cfi_endproc
+ 800              	.LFE6398:
+ 802 08c2 66662E0F 		.p2align 4
+ 802      1F840000 
+ 802      0000000F 
+ 802      1F00
+ 804              	gate_process_8_64:
+ 805              	.LFB6402:
+ 806              		.cfi_startproc
+ 807 08d0 4155     		pushq	%r13
+ 808              		.cfi_def_cfa_offset 16
+ 809              		.cfi_offset 13, -16
+ 810 08d2 4C8D6C24 		leaq	16(%rsp), %r13
+ 810      10
+ 811              		.cfi_def_cfa 13, 0
+ 812 08d7 4883E4C0 		andq	$-64, %rsp
+ 813 08db 41FF75F8 		pushq	-8(%r13)
+ 814 08df 55       		pushq	%rbp
+ 815 08e0 4889E5   		movq	%rsp, %rbp
+ 816              		.cfi_escape 0x10,0x6,0x2,0x76,0
+ 817 08e3 4157     		pushq	%r15
+ 818 08e5 4156     		pushq	%r14
+ 819 08e7 4155     		pushq	%r13
+ 820              		.cfi_escape 0xf,0x3,0x76,0x68,0x6
+ 821              		.cfi_escape 0x10,0xf,0x2,0x76,0x78
+ 822              		.cfi_escape 0x10,0xe,0x2,0x76,0x70
+ 823 08e9 4154     		pushq	%r12
+ 824 08eb 53       		pushq	%rbx
+ 825 08ec 4881EC88 		subq	$136, %rsp
+ 825      000000
+ 826              		.cfi_escape 0x10,0xc,0x2,0x76,0x60
+ 827              		.cfi_escape 0x10,0x3,0x2,0x76,0x58
+ 828 08f3 83BFA400 		cmpl	$64, 164(%rdi)
+ 828      000040
+ 829 08fa 4889BD70 		movq	%rdi, -144(%rbp)
+ 829      FFFFFF
+ 830 0901 0F859801 		jne	.L89
+ 830      0000
+ 831 0907 62F1FE48 		vmovdqu64	8(%rdi), %zmm5
+ 831      6FAF0800 
+ 831      0000
+ 832 0911 62F1D548 		vporq	72(%rdi), %zmm5, %zmm0
+ 832      EB874800 
+ 832      0000
+ 833 091b 62F3FD48 		vextracti64x4	$0x1, %zmm0, %ymm1
+ 833      3BC101
+ 834 0922 62F1FD48 		vmovdqa64	%zmm5, -112(%rbp)
+ 834      7FAD90FF 
+ 834      FFFF
+ 835 092c C5F5EBC8 		vpor	%ymm0, %ymm1, %ymm1
+ 836 0930 62F3FD28 		vextracti64x2	$0x1, %ymm1, %xmm0
+ 836      39C801
+ 837 0937 C5F9EBC1 		vpor	%xmm1, %xmm0, %xmm0
+ 838 093b C5F173D8 		vpsrldq	$8, %xmm0, %xmm1
+ 838      08
+ 839 0940 C5F9EBC1 		vpor	%xmm1, %xmm0, %xmm0
+ 840 0944 C4E1F97E 		vmovq	%xmm0, %rax
+ 840      C0
+ 841 0949 A81F     		testb	$31, %al
+ 842 094b 0F854B01 		jne	.L126
+ 842      0000
+ 843 0951 4C8BBFC0 		movq	192(%rdi), %r15
+ 843      000000
+ 844 0958 48C78578 		movq	$0, -136(%rbp)
+ 844      FFFFFF00 
+ 844      000000
+ 845 0963 498D474C 		leaq	76(%r15), %rax
+ 846 0967 48894588 		movq	%rax, -120(%rbp)
+ 847 096b 0F1F4400 		.p2align 4,,10
+ 847      00
+ 848              		.p2align 3
+ 849              	.L115:
+ 850 0970 488B8570 		movq	-144(%rbp), %rax
+ 850      FFFFFF
+ 851 0977 488B9578 		movq	-136(%rbp), %rdx
+ 851      FFFFFF
+ 852 097e 488B7D88 		movq	-120(%rbp), %rdi
+ 853 0982 4C8B6CD0 		movq	8(%rax,%rdx,8), %r13
+ 853      08
+ 854 0987 4C8B64D0 		movq	72(%rax,%rdx,8), %r12
+ 854      48
+ 855 098c 488B8088 		movq	136(%rax), %rax
+ 855      000000
+ 856 0993 C5FA1047 		vmovss	-32(%rdi), %xmm0
+ 856      E0
+ 857 0998 803C1000 		cmpb	$0, (%rax,%rdx)
+ 858 099c 741A     		je	.L92
+ 859 099e C5D057ED 		vxorps	%xmm5, %xmm5, %xmm5
+ 860 09a2 C5F82EC5 		vucomiss	%xmm5, %xmm0
+ 861 09a6 7A10     		jp	.L92
+ 862 09a8 750E     		jne	.L92
+ 863 09aa 488B4588 		movq	-120(%rbp), %rax
+ 864 09ae 8B00     		movl	(%rax), %eax
+ 865 09b0 85C0     		testl	%eax, %eax
+ 866 09b2 0F847902 		je	.L129
+ 866      0000
+ 867              	.L92:
+ 868 09b8 498D8424 		leaq	256(%r12), %rax
+ 868      00010000 
+ 869 09c0 B9010000 		movl	$1, %ecx
+ 869      00
+ 870 09c5 48894580 		movq	%rax, -128(%rbp)
+ 871 09c9 0F1F8000 		.p2align 4,,10
+ 871      000000
+ 872              		.p2align 3
+ 873              	.L91:
+ 874 09d0 C4E27D18 		vbroadcastss	.LC24(%rip), %ymm4
+ 874      25000000 
+ 874      00
+ 875 09d9 C4C17A10 		vmovss	(%r15), %xmm1
+ 875      0F
+ 876 09de C4C15C55 		vandnps	0(%r13), %ymm4, %ymm2
+ 876      5500
+ 877 09e4 C4E27D18 		vbroadcastss	%xmm1, %ymm3
+ 877      D9
+ 878 09e9 C5ECC2D3 		vcmpps	$30, %ymm3, %ymm2, %ymm2
+ 878      1E
+ 879 09ee C5FC50C2 		vmovmskps	%ymm2, %eax
+ 880 09f2 85C0     		testl	%eax, %eax
+ 881 09f4 0F851E01 		jne	.L95
+ 881      0000
+ 882 09fa C5F82E05 		vucomiss	.LC0(%rip), %xmm0
+ 882      00000000 
+ 883 0a02 488B4588 		movq	-120(%rbp), %rax
+ 884 0a06 8B18     		movl	(%rax), %ebx
+ 885 0a08 0F8A5201 		jp	.L98
+ 885      0000
+ 886 0a0e 0F854C01 		jne	.L98
+ 886      0000
+ 887 0a14 83FB07   		cmpl	$7, %ebx
+ 888 0a17 0F87EB01 		ja	.L130
+ 888      0000
+ 889              	.L103:
+ 890 0a1d 4531F6   		xorl	%r14d, %r14d
+ 891 0a20 C5F877   		vzeroupper
+ 892 0a23 EB3C     		jmp	.L113
+ 893              		.p2align 4,,10
+ 894 0a25 0F1F00   		.p2align 3
+ 895              	.L131:
+ 896 0a28 C4C17A58 		vaddss	36(%r15), %xmm0, %xmm0
+ 896      4724
+ 897 0a2e 418B5F20 		movl	32(%r15), %ebx
+ 898 0a32 C5FA100D 		vmovss	.LC0(%rip), %xmm1
+ 898      00000000 
+ 899 0a3a E8000000 		call	fminf@PLT
+ 899      00
+ 900 0a3f C5FA1055 		vmovss	-112(%rbp), %xmm2
+ 900      90
+ 901              	.L110:
+ 902 0a44 C5EA59D0 		vmulss	%xmm0, %xmm2, %xmm2
+ 903 0a48 C4817A11 		vmovss	%xmm2, (%r12,%r14)
+ 903      1434
+ 904 0a4e 4983C604 		addq	$4, %r14
+ 905 0a52 4983FE20 		cmpq	$32, %r14
+ 906 0a56 0F848C00 		je	.L112
+ 906      0000
+ 907 0a5c C4C17A10 		vmovss	(%r15), %xmm1
+ 907      0F
+ 908              	.L113:
+ 909 0a61 C4817A10 		vmovss	0(%r13,%r14), %xmm2
+ 909      543500
+ 910 0a68 C5E8541D 		vandps	.LC25(%rip), %xmm2, %xmm3
+ 910      00000000 
+ 911 0a70 C5F82FD9 		vcomiss	%xmm1, %xmm3
+ 912 0a74 C5FA1155 		vmovss	%xmm2, -112(%rbp)
+ 912      90
+ 913 0a79 77AD     		ja	.L131
+ 914 0a7b 85DB     		testl	%ebx, %ebx
+ 915 0a7d 7449     		je	.L111
+ 916 0a7f C4C17A58 		vaddss	36(%r15), %xmm0, %xmm0
+ 916      4724
+ 917 0a85 83EB01   		subl	$1, %ebx
+ 918 0a88 C5FA100D 		vmovss	.LC0(%rip), %xmm1
+ 918      00000000 
+ 919 0a90 E8000000 		call	fminf@PLT
+ 919      00
+ 920 0a95 C5FA1055 		vmovss	-112(%rbp), %xmm2
+ 920      90
+ 921 0a9a EBA8     		jmp	.L110
+ 922              	.L126:
+ 923 0a9c C5F877   		vzeroupper
+ 924              	.L89:
+ 925 0a9f 488BBD70 		movq	-144(%rbp), %rdi
+ 925      FFFFFF
+ 926 0aa6 4881C488 		addq	$136, %rsp
+ 926      000000
+ 927 0aad 5B       		popq	%rbx
+ 928 0aae 415C     		popq	%r12
+ 929 0ab0 415D     		popq	%r13
+ 930              		.cfi_remember_state
+ 931              		.cfi_def_cfa 13, 0
+ 932 0ab2 415E     		popq	%r14
+ 933 0ab4 415F     		popq	%r15
+ 934 0ab6 5D       		popq	%rbp
+ 935 0ab7 498D65F0 		leaq	-16(%r13), %rsp
+ 936              		.cfi_def_cfa 7, 16
+ 937 0abb 415D     		popq	%r13
+ 938              		.cfi_def_cfa_offset 8
+ 939 0abd E9000000 		jmp	gate_process@PLT
+ 939      00
+ 940              		.p2align 4,,10
+ 941 0ac2 660F1F44 		.p2align 3
+ 941      0000
+ 942              	.L111:
+ 943              		.cfi_restore_state
+ 944 0ac8 C4C17A5C 		vsubss	40(%r15), %xmm0, %xmm0
+ 944      4728
+ 945 0ace C5F057C9 		vxorps	%xmm1, %xmm1, %xmm1
+ 946 0ad2 E8000000 		call	fmaxf@PLT
+ 946      00
+ 947 0ad7 C5FA1055 		vmovss	-112(%rbp), %xmm2
+ 947      90
+ 948 0adc E963FFFF 		jmp	.L110
+ 948      FF
+ 949              		.p2align 4,,10
+ 950 0ae1 0F1F8000 		.p2align 3
+ 950      000000
+ 951              	.L112:
+ 952 0ae8 488B4588 		movq	-120(%rbp), %rax
+ 953 0aec 8918     		movl	%ebx, (%rax)
+ 954 0aee C5FA1140 		vmovss	%xmm0, -32(%rax)
+ 954      E0
+ 955              	.L105:
+ 956 0af3 31C9     		xorl	%ecx, %ecx
+ 957 0af5 4983C520 		addq	$32, %r13
+ 958 0af9 4983C420 		addq	$32, %r12
+ 959 0afd 4C396580 		cmpq	%r12, -128(%rbp)
+ 960 0b01 0F849900 		je	.L114
+ 960      0000
+ 961              	.L132:
+ 962 0b07 488B4588 		movq	-120(%rbp), %rax
+ 963 0b0b C5FA1040 		vmovss	-32(%rax), %xmm0
+ 963      E0
+ 964 0b10 E9BBFEFF 		jmp	.L91
+ 964      FF
+ 965              		.p2align 4,,10
+ 966 0b15 0F1F00   		.p2align 3
+ 967              	.L95:
+ 968 0b18 C5F82E05 		vucomiss	.LC0(%rip), %xmm0
+ 968      00000000 
+ 969 0b20 0F8AD200 		jp	.L99
+ 969      0000
+ 970 0b26 0F85CC00 		jne	.L99
+ 970      0000
+ 971 0b2c 3DFF0000 		cmpl	$255, %eax
+ 971      00
+ 972 0b31 0F85D900 		jne	.L101
+ 972      0000
+ 973 0b37 418B4F20 		movl	32(%r15), %ecx
+ 974              	.L102:
+ 975 0b3b F30FBDC0 		lzcntl	%eax, %eax
+ 976 0b3f 83E818   		subl	$24, %eax
+ 977 0b42 29C1     		subl	%eax, %ecx
+ 978              	.L104:
+ 979 0b44 488B4588 		movq	-120(%rbp), %rax
+ 980 0b48 8908     		movl	%ecx, (%rax)
+ 981 0b4a C4C17D6F 		vmovdqa	0(%r13), %ymm6
+ 981      7500
+ 982 0b50 C4C17D7F 		vmovdqa	%ymm6, (%r12)
+ 982      3424
+ 983 0b56 EB9B     		jmp	.L105
+ 984 0b58 0F1F8400 		.p2align 4,,10
+ 984      00000000 
+ 985              		.p2align 3
+ 986              	.L98:
+ 987 0b60 C5C057FF 		vxorps	%xmm7, %xmm7, %xmm7
+ 988 0b64 C5F82EC7 		vucomiss	%xmm7, %xmm0
+ 989 0b68 0F8AAFFE 		jp	.L103
+ 989      FFFF
+ 990 0b6e 0F85A9FE 		jne	.L103
+ 990      FFFF
+ 991 0b74 85DB     		testl	%ebx, %ebx
+ 992 0b76 0F85A1FE 		jne	.L103
+ 992      FFFF
+ 993 0b7c C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 994 0b80 4983C520 		addq	$32, %r13
+ 995 0b84 4983C420 		addq	$32, %r12
+ 996 0b88 C4C17D7F 		vmovdqa	%ymm0, -32(%r12)
+ 996      4424E0
+ 997 0b8f 4C396580 		cmpq	%r12, -128(%rbp)
+ 998 0b93 0F856EFF 		jne	.L132
+ 998      FFFF
+ 999 0b99 0F1F8000 		.p2align 4,,10
+ 999      000000
+ 1000              		.p2align 3
+ 1001              	.L114:
+ 1002 0ba0 488B8570 		movq	-144(%rbp), %rax
+ 1002      FFFFFF
+ 1003 0ba7 488BB578 		movq	-136(%rbp), %rsi
+ 1003      FFFFFF
+ 1004 0bae 488B8090 		movq	144(%rax), %rax
+ 1004      000000
+ 1005 0bb5 880C30   		movb	%cl, (%rax,%rsi)
+ 1006              	.L94:
+ 1007 0bb8 48838578 		addq	$1, -136(%rbp)
+ 1007      FFFFFF01 
+ 1008 0bc0 488B8578 		movq	-136(%rbp), %rax
+ 1008      FFFFFF
+ 1009 0bc7 48834588 		addq	$4, -120(%rbp)
+ 1009      04
+ 1010 0bcc 4883F808 		cmpq	$8, %rax
+ 1011 0bd0 0F859AFD 		jne	.L115
+ 1011      FFFF
+ 1012 0bd6 C5F877   		vzeroupper
+ 1013 0bd9 4881C488 		addq	$136, %rsp
+ 1013      000000
+ 1014 0be0 5B       		popq	%rbx
+ 1015 0be1 415C     		popq	%r12
+ 1016 0be3 415D     		popq	%r13
+ 1017              		.cfi_remember_state
+ 1018              		.cfi_def_cfa 13, 0
+ 1019 0be5 415E     		popq	%r14
+ 1020 0be7 415F     		popq	%r15
+ 1021 0be9 5D       		popq	%rbp
+ 1022 0bea 498D65F0 		leaq	-16(%r13), %rsp
+ 1023              		.cfi_def_cfa 7, 16
+ 1024 0bee 415D     		popq	%r13
+ 1025              		.cfi_def_cfa_offset 8
+ 1026 0bf0 C3       		ret
+ 1027              		.p2align 4,,10
+ 1028 0bf1 0F1F8000 		.p2align 3
+ 1028      000000
+ 1029              	.L99:
+ 1030              		.cfi_restore_state
+ 1031 0bf8 488B4588 		movq	-120(%rbp), %rax
+ 1032 0bfc 8B18     		movl	(%rax), %ebx
+ 1033 0bfe E91AFEFF 		jmp	.L103
+ 1033      FF
+ 1034              		.p2align 4,,10
+ 1035 0c03 0F1F4400 		.p2align 3
+ 1035      00
+ 1036              	.L130:
+ 1037 0c08 8D4BF8   		leal	-8(%rbx), %ecx
+ 1038 0c0b E934FFFF 		jmp	.L104
+ 1038      FF
+ 1039              		.p2align 4,,10
+ 1040              		.p2align 3
+ 1041              	.L101:
+ 1042 0c10 488B7588 		movq	-120(%rbp), %rsi
+ 1043 0c14 8B1E     		movl	(%rsi), %ebx
+ 1044 0c16 83FB07   		cmpl	$7, %ebx
+ 1045 0c19 0F86FEFD 		jbe	.L103
+ 1045      FFFF
+ 1046 0c1f 418B4F20 		movl	32(%r15), %ecx
+ 1047 0c23 83F907   		cmpl	$7, %ecx
+ 1048 0c26 0F86F1FD 		jbe	.L103
+ 1048      FFFF
+ 1049 0c2c E90AFFFF 		jmp	.L102
+ 1049      FF
+ 1050              	.L129:
+ 1051 0c31 488B8570 		movq	-144(%rbp), %rax
+ 1051      FFFFFF
+ 1052 0c38 C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 1053 0c3c 488BB578 		movq	-136(%rbp), %rsi
+ 1053      FFFFFF
+ 1054 0c43 62D17F48 		vmovdqu8	%zmm0, (%r12)
+ 1054      7F0424
+ 1055 0c4a 62D17F48 		vmovdqu8	%zmm0, 64(%r12)
+ 1055      7F442401 
+ 1056 0c52 62D17F48 		vmovdqu8	%zmm0, 128(%r12)
+ 1056      7F442402 
+ 1057 0c5a 62D17F48 		vmovdqu8	%zmm0, 192(%r12)
+ 1057      7F442403 
+ 1058 0c62 488B8090 		movq	144(%rax), %rax
+ 1058      000000
+ 1059 0c69 C6043001 		movb	$1, (%rax,%rsi)
+ 1060 0c6d E946FFFF 		jmp	.L94
+ 1060      FF
+ 1061              		.cfi_endproc
+ 1062              	.LFE6402:
+ 1064 0c72 66662E0F 		.p2align 4
+ 1064      1F840000 
+ 1064      0000000F 
+ 1064      1F00
+ 1066              	gate_process_2_128:
+ 1067              	.LFB6400:
+ 1068              		.cfi_startproc
+ 1069 0c80 4155     		pushq	%r13
+ 1070              		.cfi_def_cfa_offset 16
+ 1071              		.cfi_offset 13, -16
+ 1072 0c82 4C8D6C24 		leaq	16(%rsp), %r13
+ 1072      10
+ 1073              		.cfi_def_cfa 13, 0
+ 1074 0c87 4883E4E0 		andq	$-32, %rsp
+ 1075 0c8b 41FF75F8 		pushq	-8(%r13)
+ 1076 0c8f 55       		pushq	%rbp
+ 1077 0c90 4889E5   		movq	%rsp, %rbp
+ 1078              		.cfi_escape 0x10,0x6,0x2,0x76,0
+ 1079 0c93 4157     		pushq	%r15
+ 1080 0c95 4156     		pushq	%r14
+ 1081 0c97 4155     		pushq	%r13
+ 1082              		.cfi_escape 0xf,0x3,0x76,0x68,0x6
+ 1083              		.cfi_escape 0x10,0xf,0x2,0x76,0x78
+ 1084              		.cfi_escape 0x10,0xe,0x2,0x76,0x70
+ 1085 0c99 4154     		pushq	%r12
+ 1086 0c9b 53       		pushq	%rbx
+ 1087 0c9c 4883EC48 		subq	$72, %rsp
+ 1088              		.cfi_escape 0x10,0xc,0x2,0x76,0x60
+ 1089              		.cfi_escape 0x10,0x3,0x2,0x76,0x58
+ 1090 0ca0 48897DA8 		movq	%rdi, -88(%rbp)
+ 1091 0ca4 81BFA400 		cmpl	$128, 164(%rdi)
+ 1091      00008000 
+ 1091      0000
+ 1092 0cae 0F855801 		jne	.L134
+ 1092      0000
+ 1093 0cb4 488B4748 		movq	72(%rdi), %rax
+ 1094 0cb8 480B4708 		orq	8(%rdi), %rax
+ 1095 0cbc 480B4710 		orq	16(%rdi), %rax
+ 1096 0cc0 480B4750 		orq	80(%rdi), %rax
+ 1097 0cc4 A81F     		testb	$31, %al
+ 1098 0cc6 0F854001 		jne	.L134
+ 1098      0000
+ 1099 0ccc 4C8BBFC0 		movq	192(%rdi), %r15
+ 1099      000000
+ 1100 0cd3 48C745B0 		movq	$0, -80(%rbp)
+ 1100      00000000 
+ 1101 0cdb 498D474C 		leaq	76(%r15), %rax
+ 1102 0cdf 488945C0 		movq	%rax, -64(%rbp)
+ 1103              		.p2align 4,,10
+ 1104 0ce3 0F1F4400 		.p2align 3
+ 1104      00
+ 1105              	.L160:
+ 1106 0ce8 488B45A8 		movq	-88(%rbp), %rax
+ 1107 0cec 488B55B0 		movq	-80(%rbp), %rdx
+ 1108 0cf0 488B75C0 		movq	-64(%rbp), %rsi
+ 1109 0cf4 4C8B6CD0 		movq	8(%rax,%rdx,8), %r13
+ 1109      08
+ 1110 0cf9 4C8B64D0 		movq	72(%rax,%rdx,8), %r12
+ 1110      48
+ 1111 0cfe 488B8088 		movq	136(%rax), %rax
+ 1111      000000
+ 1112 0d05 C5FA1046 		vmovss	-32(%rsi), %xmm0
+ 1112      E0
+ 1113 0d0a 803C1000 		cmpb	$0, (%rax,%rdx)
+ 1114 0d0e 741A     		je	.L137
+ 1115 0d10 C5C057FF 		vxorps	%xmm7, %xmm7, %xmm7
+ 1116 0d14 C5F82EC7 		vucomiss	%xmm7, %xmm0
+ 1117 0d18 7A10     		jp	.L137
+ 1118 0d1a 750E     		jne	.L137
+ 1119 0d1c 488B45C0 		movq	-64(%rbp), %rax
+ 1120 0d20 8B00     		movl	(%rax), %eax
+ 1121 0d22 85C0     		testl	%eax, %eax
+ 1122 0d24 0F844702 		je	.L173
+ 1122      0000
+ 1123              	.L137:
+ 1124 0d2a 498D8424 		leaq	512(%r12), %rax
+ 1124      00020000 
+ 1125 0d32 B9010000 		movl	$1, %ecx
+ 1125      00
+ 1126 0d37 488945B8 		movq	%rax, -72(%rbp)
+ 1127 0d3b 0F1F4400 		.p2align 4,,10
+ 1127      00
+ 1128              		.p2align 3
+ 1129              	.L136:
+ 1130 0d40 C4E27D18 		vbroadcastss	.LC24(%rip), %ymm4
+ 1130      25000000 
+ 1130      00
+ 1131 0d49 C4C17A10 		vmovss	(%r15), %xmm1
+ 1131      0F
+ 1132 0d4e C4C15C55 		vandnps	0(%r13), %ymm4, %ymm2
+ 1132      5500
+ 1133 0d54 C4E27D18 		vbroadcastss	%xmm1, %ymm3
+ 1133      D9
+ 1134 0d59 C5ECC2D3 		vcmpps	$30, %ymm3, %ymm2, %ymm2
+ 1134      1E
+ 1135 0d5e C5FC50C2 		vmovmskps	%ymm2, %eax
+ 1136 0d62 85C0     		testl	%eax, %eax
+ 1137 0d64 0F851601 		jne	.L140
+ 1137      0000
+ 1138 0d6a C5F82E05 		vucomiss	.LC0(%rip), %xmm0
+ 1138      00000000 
+ 1139 0d72 488B45C0 		movq	-64(%rbp), %rax
+ 1140 0d76 8B18     		movl	(%rax), %ebx
+ 1141 0d78 0F8A4201 		jp	.L143
+ 1141      0000
+ 1142 0d7e 0F853C01 		jne	.L143
+ 1142      0000
+ 1143 0d84 83FB07   		cmpl	$7, %ebx
+ 1144 0d87 0F87B301 		ja	.L174
+ 1144      0000
+ 1145              	.L148:
+ 1146 0d8d 4531F6   		xorl	%r14d, %r14d
+ 1147 0d90 C5F877   		vzeroupper
+ 1148 0d93 EB3C     		jmp	.L158
+ 1149              		.p2align 4,,10
+ 1150 0d95 0F1F00   		.p2align 3
+ 1151              	.L175:
+ 1152 0d98 C4C17A58 		vaddss	36(%r15), %xmm0, %xmm0
+ 1152      4724
+ 1153 0d9e 418B5F20 		movl	32(%r15), %ebx
+ 1154 0da2 C5FA100D 		vmovss	.LC0(%rip), %xmm1
+ 1154      00000000 
+ 1155 0daa E8000000 		call	fminf@PLT
+ 1155      00
+ 1156 0daf C5FA1055 		vmovss	-52(%rbp), %xmm2
+ 1156      CC
+ 1157              	.L155:
+ 1158 0db4 C5EA59D0 		vmulss	%xmm0, %xmm2, %xmm2
+ 1159 0db8 C4817A11 		vmovss	%xmm2, (%r12,%r14)
+ 1159      1434
+ 1160 0dbe 4983C604 		addq	$4, %r14
+ 1161 0dc2 4983FE20 		cmpq	$32, %r14
+ 1162 0dc6 0F848400 		je	.L157
+ 1162      0000
+ 1163 0dcc C4C17A10 		vmovss	(%r15), %xmm1
+ 1163      0F
+ 1164              	.L158:
+ 1165 0dd1 C4817A10 		vmovss	0(%r13,%r14), %xmm2
+ 1165      543500
+ 1166 0dd8 C5E8541D 		vandps	.LC25(%rip), %xmm2, %xmm3
+ 1166      00000000 
+ 1167 0de0 C5F82FD9 		vcomiss	%xmm1, %xmm3
+ 1168 0de4 C5FA1155 		vmovss	%xmm2, -52(%rbp)
+ 1168      CC
+ 1169 0de9 77AD     		ja	.L175
+ 1170 0deb 85DB     		testl	%ebx, %ebx
+ 1171 0ded 7441     		je	.L156
+ 1172 0def C4C17A58 		vaddss	36(%r15), %xmm0, %xmm0
+ 1172      4724
+ 1173 0df5 83EB01   		subl	$1, %ebx
+ 1174 0df8 C5FA100D 		vmovss	.LC0(%rip), %xmm1
+ 1174      00000000 
+ 1175 0e00 E8000000 		call	fminf@PLT
+ 1175      00
+ 1176 0e05 C5FA1055 		vmovss	-52(%rbp), %xmm2
+ 1176      CC
+ 1177 0e0a EBA8     		jmp	.L155
+ 1178              	.L134:
+ 1179 0e0c 488B7DA8 		movq	-88(%rbp), %rdi
+ 1180 0e10 4883C448 		addq	$72, %rsp
+ 1181 0e14 5B       		popq	%rbx
+ 1182 0e15 415C     		popq	%r12
+ 1183 0e17 415D     		popq	%r13
+ 1184              		.cfi_remember_state
+ 1185              		.cfi_def_cfa 13, 0
+ 1186 0e19 415E     		popq	%r14
+ 1187 0e1b 415F     		popq	%r15
+ 1188 0e1d 5D       		popq	%rbp
+ 1189 0e1e 498D65F0 		leaq	-16(%r13), %rsp
+ 1190              		.cfi_def_cfa 7, 16
+ 1191 0e22 415D     		popq	%r13
+ 1192              		.cfi_def_cfa_offset 8
+ 1193 0e24 E9000000 		jmp	gate_process@PLT
+ 1193      00
+ 1194 0e29 0F1F8000 		.p2align 4,,10
+ 1194      000000
+ 1195              		.p2align 3
+ 1196              	.L156:
+ 1197              		.cfi_restore_state
+ 1198 0e30 C4C17A5C 		vsubss	40(%r15), %xmm0, %xmm0
+ 1198      4728
+ 1199 0e36 C5F057C9 		vxorps	%xmm1, %xmm1, %xmm1
+ 1200 0e3a E8000000 		call	fmaxf@PLT
+ 1200      00
+ 1201 0e3f C5FA1055 		vmovss	-52(%rbp), %xmm2
+ 1201      CC
+ 1202 0e44 E96BFFFF 		jmp	.L155
+ 1202      FF
+ 1203 0e49 0F1F8000 		.p2align 4,,10
+ 1203      000000
+ 1204              		.p2align 3
+ 1205              	.L157:
+ 1206 0e50 488B45C0 		movq	-64(%rbp), %rax
+ 1207 0e54 8918     		movl	%ebx, (%rax)
+ 1208 0e56 C5FA1140 		vmovss	%xmm0, -32(%rax)
+ 1208      E0
+ 1209              	.L150:
+ 1210 0e5b 31C9     		xorl	%ecx, %ecx
+ 1211 0e5d 4983C520 		addq	$32, %r13
+ 1212 0e61 4983C420 		addq	$32, %r12
+ 1213 0e65 4C3965B8 		cmpq	%r12, -72(%rbp)
+ 1214 0e69 0F849100 		je	.L159
+ 1214      0000
+ 1215              	.L176:
+ 1216 0e6f 488B45C0 		movq	-64(%rbp), %rax
+ 1217 0e73 C5FA1040 		vmovss	-32(%rax), %xmm0
+ 1217      E0
+ 1218 0e78 E9C3FEFF 		jmp	.L136
+ 1218      FF
+ 1219 0e7d 0F1F00   		.p2align 4,,10
+ 1220              		.p2align 3
+ 1221              	.L140:
+ 1222 0e80 C5F82E05 		vucomiss	.LC0(%rip), %xmm0
+ 1222      00000000 
+ 1223 0e88 0F8AA200 		jp	.L144
+ 1223      0000
+ 1224 0e8e 0F859C00 		jne	.L144
+ 1224      0000
+ 1225 0e94 3DFF0000 		cmpl	$255, %eax
+ 1225      00
+ 1226 0e99 0F85B100 		jne	.L146
+ 1226      0000
+ 1227 0e9f 418B4F20 		movl	32(%r15), %ecx
+ 1228              	.L147:
+ 1229 0ea3 F30FBDC0 		lzcntl	%eax, %eax
+ 1230 0ea7 83E818   		subl	$24, %eax
+ 1231 0eaa 29C1     		subl	%eax, %ecx
+ 1232              	.L149:
+ 1233 0eac 488B45C0 		movq	-64(%rbp), %rax
+ 1234 0eb0 8908     		movl	%ecx, (%rax)
+ 1235 0eb2 C4C17D6F 		vmovdqa	0(%r13), %ymm5
+ 1235      6D00
+ 1236 0eb8 C4C17D7F 		vmovdqa	%ymm5, (%r12)
+ 1236      2C24
+ 1237 0ebe EB9B     		jmp	.L150
+ 1238              		.p2align 4,,10
+ 1239              		.p2align 3
+ 1240              	.L143:
+ 1241 0ec0 C5C857F6 		vxorps	%xmm6, %xmm6, %xmm6
+ 1242 0ec4 C5F82EC6 		vucomiss	%xmm6, %xmm0
+ 1243 0ec8 0F8ABFFE 		jp	.L148
+ 1243      FFFF
+ 1244 0ece 0F85B9FE 		jne	.L148
+ 1244      FFFF
+ 1245 0ed4 85DB     		testl	%ebx, %ebx
+ 1246 0ed6 0F85B1FE 		jne	.L148
+ 1246      FFFF
+ 1247 0edc C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 1248 0ee0 4983C520 		addq	$32, %r13
+ 1249 0ee4 4983C420 		addq	$32, %r12
+ 1250 0ee8 C4C17D7F 		vmovdqa	%ymm0, -32(%r12)
+ 1250      4424E0
+ 1251 0eef 4C3965B8 		cmpq	%r12, -72(%rbp)
+ 1252 0ef3 0F8576FF 		jne	.L176
+ 1252      FFFF
+ 1253 0ef9 0F1F8000 		.p2align 4,,10
+ 1253      000000
+ 1254              		.p2align 3
+ 1255              	.L159:
+ 1256 0f00 488B45A8 		movq	-88(%rbp), %rax
+ 1257 0f04 488B7DB0 		movq	-80(%rbp), %rdi
+ 1258 0f08 488345C0 		addq	$4, -64(%rbp)
+ 1258      04
+ 1259 0f0d 48837DB0 		cmpq	$0, -80(%rbp)
+ 1259      00
+ 1260 0f12 488B8090 		movq	144(%rax), %rax
+ 1260      000000
+ 1261 0f19 880C38   		movb	%cl, (%rax,%rdi)
+ 1262 0f1c 757F     		jne	.L177
+ 1263              	.L164:
+ 1264 0f1e 48C745B0 		movq	$1, -80(%rbp)
+ 1264      01000000 
+ 1265 0f26 E9BDFDFF 		jmp	.L160
+ 1265      FF
+ 1266 0f2b 0F1F4400 		.p2align 4,,10
+ 1266      00
+ 1267              		.p2align 3
+ 1268              	.L144:
+ 1269 0f30 488B45C0 		movq	-64(%rbp), %rax
+ 1270 0f34 8B18     		movl	(%rax), %ebx
+ 1271 0f36 E952FEFF 		jmp	.L148
+ 1271      FF
+ 1272 0f3b 0F1F4400 		.p2align 4,,10
+ 1272      00
+ 1273              		.p2align 3
+ 1274              	.L174:
+ 1275 0f40 8D4BF8   		leal	-8(%rbx), %ecx
+ 1276 0f43 E964FFFF 		jmp	.L149
+ 1276      FF
+ 1277 0f48 0F1F8400 		.p2align 4,,10
+ 1277      00000000 
+ 1278              		.p2align 3
+ 1279              	.L146:
+ 1280 0f50 488B7DC0 		movq	-64(%rbp), %rdi
+ 1281 0f54 8B1F     		movl	(%rdi), %ebx
+ 1282 0f56 83FB07   		cmpl	$7, %ebx
+ 1283 0f59 0F862EFE 		jbe	.L148
+ 1283      FFFF
+ 1284 0f5f 418B4F20 		movl	32(%r15), %ecx
+ 1285 0f63 83F907   		cmpl	$7, %ecx
+ 1286 0f66 0F8621FE 		jbe	.L148
+ 1286      FFFF
+ 1287 0f6c E932FFFF 		jmp	.L147
+ 1287      FF
+ 1288              	.L173:
+ 1289 0f71 31C0     		xorl	%eax, %eax
+ 1290 0f73 B9400000 		movl	$64, %ecx
+ 1290      00
+ 1291 0f78 4C89E7   		movq	%r12, %rdi
+ 1292 0f7b 488345C0 		addq	$4, -64(%rbp)
+ 1292      04
+ 1293 0f80 F348AB   		rep stosq
+ 1294 0f83 488B45A8 		movq	-88(%rbp), %rax
+ 1295 0f87 488B7DB0 		movq	-80(%rbp), %rdi
+ 1296 0f8b 48837DB0 		cmpq	$0, -80(%rbp)
+ 1296      00
+ 1297 0f90 488B8090 		movq	144(%rax), %rax
+ 1297      000000
+ 1298 0f97 C6043801 		movb	$1, (%rax,%rdi)
+ 1299 0f9b 7481     		je	.L164
+ 1300              	.L177:
+ 1301 0f9d C5F877   		vzeroupper
+ 1302 0fa0 4883C448 		addq	$72, %rsp
+ 1303 0fa4 5B       		popq	%rbx
+ 1304 0fa5 415C     		popq	%r12
+ 1305 0fa7 415D     		popq	%r13
+ 1306              		.cfi_def_cfa 13, 0
+ 1307 0fa9 415E     		popq	%r14
+ 1308 0fab 415F     		popq	%r15
+ 1309 0fad 5D       		popq	%rbp
+ 1310 0fae 498D65F0 		leaq	-16(%r13), %rsp
+ 1311              		.cfi_def_cfa 7, 16
+ 1312 0fb2 415D     		popq	%r13
+ 1313              		.cfi_def_cfa_offset 8
+ 1314 0fb4 C3       		ret
+ 1315              		.cfi_endproc
+ 1316              	.LFE6400:
+ 1318 0fb5 66662E0F 		.p2align 4
+ 1318      1F840000 
+ 1318      000000
+ 1320              	gate_process_2_64:
+ 1321              	.LFB6399:
+ 1322              		.cfi_startproc
+ 1323 0fc0 4155     		pushq	%r13
+ 1324              		.cfi_def_cfa_offset 16
+ 1325              		.cfi_offset 13, -16
+ 1326 0fc2 4C8D6C24 		leaq	16(%rsp), %r13
+ 1326      10
+ 1327              		.cfi_def_cfa 13, 0
+ 1328 0fc7 4883E4E0 		andq	$-32, %rsp
+ 1329 0fcb 41FF75F8 		pushq	-8(%r13)
+ 1330 0fcf 55       		pushq	%rbp
+ 1331 0fd0 4889E5   		movq	%rsp, %rbp
+ 1332              		.cfi_escape 0x10,0x6,0x2,0x76,0
+ 1333 0fd3 4157     		pushq	%r15
+ 1334 0fd5 4156     		pushq	%r14
+ 1335 0fd7 4155     		pushq	%r13
+ 1336              		.cfi_escape 0xf,0x3,0x76,0x68,0x6
+ 1337              		.cfi_escape 0x10,0xf,0x2,0x76,0x78
+ 1338              		.cfi_escape 0x10,0xe,0x2,0x76,0x70
+ 1339 0fd9 4154     		pushq	%r12
+ 1340 0fdb 53       		pushq	%rbx
+ 1341 0fdc 4883EC48 		subq	$72, %rsp
+ 1342              		.cfi_escape 0x10,0xc,0x2,0x76,0x60
+ 1343              		.cfi_escape 0x10,0x3,0x2,0x76,0x58
+ 1344 0fe0 83BFA400 		cmpl	$64, 164(%rdi)
+ 1344      000040
+ 1345 0fe7 48897DA8 		movq	%rdi, -88(%rbp)
+ 1346 0feb 0F855301 		jne	.L179
+ 1346      0000
+ 1347 0ff1 488B4748 		movq	72(%rdi), %rax
+ 1348 0ff5 480B4708 		orq	8(%rdi), %rax
+ 1349 0ff9 480B4710 		orq	16(%rdi), %rax
+ 1350 0ffd 480B4750 		orq	80(%rdi), %rax
+ 1351 1001 A81F     		testb	$31, %al
+ 1352 1003 0F853B01 		jne	.L179
+ 1352      0000
+ 1353 1009 4C8BBFC0 		movq	192(%rdi), %r15
+ 1353      000000
+ 1354 1010 48C745B0 		movq	$0, -80(%rbp)
+ 1354      00000000 
+ 1355 1018 498D474C 		leaq	76(%r15), %rax
+ 1356 101c 488945C0 		movq	%rax, -64(%rbp)
+ 1357              		.p2align 4,,10
+ 1358              		.p2align 3
+ 1359              	.L205:
+ 1360 1020 488B45A8 		movq	-88(%rbp), %rax
+ 1361 1024 488B55B0 		movq	-80(%rbp), %rdx
+ 1362 1028 488B75C0 		movq	-64(%rbp), %rsi
+ 1363 102c 4C8B6CD0 		movq	8(%rax,%rdx,8), %r13
+ 1363      08
+ 1364 1031 4C8B64D0 		movq	72(%rax,%rdx,8), %r12
+ 1364      48
+ 1365 1036 488B8088 		movq	136(%rax), %rax
+ 1365      000000
+ 1366 103d C5FA1046 		vmovss	-32(%rsi), %xmm0
+ 1366      E0
+ 1367 1042 803C1000 		cmpb	$0, (%rax,%rdx)
+ 1368 1046 741A     		je	.L182
+ 1369 1048 C5C057FF 		vxorps	%xmm7, %xmm7, %xmm7
+ 1370 104c C5F82EC7 		vucomiss	%xmm7, %xmm0
+ 1371 1050 7A10     		jp	.L182
+ 1372 1052 750E     		jne	.L182
+ 1373 1054 488B45C0 		movq	-64(%rbp), %rax
+ 1374 1058 8B00     		movl	(%rax), %eax
+ 1375 105a 85C0     		testl	%eax, %eax
+ 1376 105c 0F844F02 		je	.L218
+ 1376      0000
+ 1377              	.L182:
+ 1378 1062 498D8424 		leaq	256(%r12), %rax
+ 1378      00010000 
+ 1379 106a B9010000 		movl	$1, %ecx
+ 1379      00
+ 1380 106f 488945B8 		movq	%rax, -72(%rbp)
+ 1381              		.p2align 4,,10
+ 1382 1073 0F1F4400 		.p2align 3
+ 1382      00
+ 1383              	.L181:
+ 1384 1078 C4E27D18 		vbroadcastss	.LC24(%rip), %ymm4
+ 1384      25000000 
+ 1384      00
+ 1385 1081 C4C17A10 		vmovss	(%r15), %xmm1
+ 1385      0F
+ 1386 1086 C4C15C55 		vandnps	0(%r13), %ymm4, %ymm2
+ 1386      5500
+ 1387 108c C4E27D18 		vbroadcastss	%xmm1, %ymm3
+ 1387      D9
+ 1388 1091 C5ECC2D3 		vcmpps	$30, %ymm3, %ymm2, %ymm2
+ 1388      1E
+ 1389 1096 C5FC50C2 		vmovmskps	%ymm2, %eax
+ 1390 109a 85C0     		testl	%eax, %eax
+ 1391 109c 0F851601 		jne	.L185
+ 1391      0000
+ 1392 10a2 C5F82E05 		vucomiss	.LC0(%rip), %xmm0
+ 1392      00000000 
+ 1393 10aa 488B45C0 		movq	-64(%rbp), %rax
+ 1394 10ae 8B18     		movl	(%rax), %ebx
+ 1395 10b0 0F8A4A01 		jp	.L188
+ 1395      0000
+ 1396 10b6 0F854401 		jne	.L188
+ 1396      0000
+ 1397 10bc 83FB07   		cmpl	$7, %ebx
+ 1398 10bf 0F87BB01 		ja	.L219
+ 1398      0000
+ 1399              	.L193:
+ 1400 10c5 4531F6   		xorl	%r14d, %r14d
+ 1401 10c8 C5F877   		vzeroupper
+ 1402 10cb EB3C     		jmp	.L203
+ 1403 10cd 0F1F00   		.p2align 4,,10
+ 1404              		.p2align 3
+ 1405              	.L220:
+ 1406 10d0 C4C17A58 		vaddss	36(%r15), %xmm0, %xmm0
+ 1406      4724
+ 1407 10d6 418B5F20 		movl	32(%r15), %ebx
+ 1408 10da C5FA100D 		vmovss	.LC0(%rip), %xmm1
+ 1408      00000000 
+ 1409 10e2 E8000000 		call	fminf@PLT
+ 1409      00
+ 1410 10e7 C5FA1055 		vmovss	-52(%rbp), %xmm2
+ 1410      CC
+ 1411              	.L200:
+ 1412 10ec C5EA59D0 		vmulss	%xmm0, %xmm2, %xmm2
+ 1413 10f0 C4817A11 		vmovss	%xmm2, (%r12,%r14)
+ 1413      1434
+ 1414 10f6 4983C604 		addq	$4, %r14
+ 1415 10fa 4983FE20 		cmpq	$32, %r14
+ 1416 10fe 0F848400 		je	.L202
+ 1416      0000
+ 1417 1104 C4C17A10 		vmovss	(%r15), %xmm1
+ 1417      0F
+ 1418              	.L203:
+ 1419 1109 C4817A10 		vmovss	0(%r13,%r14), %xmm2
+ 1419      543500
+ 1420 1110 C5E8541D 		vandps	.LC25(%rip), %xmm2, %xmm3
+ 1420      00000000 
+ 1421 1118 C5F82FD9 		vcomiss	%xmm1, %xmm3
+ 1422 111c C5FA1155 		vmovss	%xmm2, -52(%rbp)
+ 1422      CC
+ 1423 1121 77AD     		ja	.L220
+ 1424 1123 85DB     		testl	%ebx, %ebx
+ 1425 1125 7441     		je	.L201
+ 1426 1127 C4C17A58 		vaddss	36(%r15), %xmm0, %xmm0
+ 1426      4724
+ 1427 112d 83EB01   		subl	$1, %ebx
+ 1428 1130 C5FA100D 		vmovss	.LC0(%rip), %xmm1
+ 1428      00000000 
+ 1429 1138 E8000000 		call	fminf@PLT
+ 1429      00
+ 1430 113d C5FA1055 		vmovss	-52(%rbp), %xmm2
+ 1430      CC
+ 1431 1142 EBA8     		jmp	.L200
+ 1432              	.L179:
+ 1433 1144 488B7DA8 		movq	-88(%rbp), %rdi
+ 1434 1148 4883C448 		addq	$72, %rsp
+ 1435 114c 5B       		popq	%rbx
+ 1436 114d 415C     		popq	%r12
+ 1437 114f 415D     		popq	%r13
+ 1438              		.cfi_remember_state
+ 1439              		.cfi_def_cfa 13, 0
+ 1440 1151 415E     		popq	%r14
+ 1441 1153 415F     		popq	%r15
+ 1442 1155 5D       		popq	%rbp
+ 1443 1156 498D65F0 		leaq	-16(%r13), %rsp
+ 1444              		.cfi_def_cfa 7, 16
+ 1445 115a 415D     		popq	%r13
+ 1446              		.cfi_def_cfa_offset 8
+ 1447 115c E9000000 		jmp	gate_process@PLT
+ 1447      00
+ 1448              		.p2align 4,,10
+ 1449 1161 0F1F8000 		.p2align 3
+ 1449      000000
+ 1450              	.L201:
+ 1451              		.cfi_restore_state
+ 1452 1168 C4C17A5C 		vsubss	40(%r15), %xmm0, %xmm0
+ 1452      4728
+ 1453 116e C5F057C9 		vxorps	%xmm1, %xmm1, %xmm1
+ 1454 1172 E8000000 		call	fmaxf@PLT
+ 1454      00
+ 1455 1177 C5FA1055 		vmovss	-52(%rbp), %xmm2
+ 1455      CC
+ 1456 117c E96BFFFF 		jmp	.L200
+ 1456      FF
+ 1457              		.p2align 4,,10
+ 1458 1181 0F1F8000 		.p2align 3
+ 1458      000000
+ 1459              	.L202:
+ 1460 1188 488B45C0 		movq	-64(%rbp), %rax
+ 1461 118c 8918     		movl	%ebx, (%rax)
+ 1462 118e C5FA1140 		vmovss	%xmm0, -32(%rax)
+ 1462      E0
+ 1463              	.L195:
+ 1464 1193 31C9     		xorl	%ecx, %ecx
+ 1465 1195 4983C520 		addq	$32, %r13
+ 1466 1199 4983C420 		addq	$32, %r12
+ 1467 119d 4C3965B8 		cmpq	%r12, -72(%rbp)
+ 1468 11a1 0F849900 		je	.L204
+ 1468      0000
+ 1469              	.L221:
+ 1470 11a7 488B45C0 		movq	-64(%rbp), %rax
+ 1471 11ab C5FA1040 		vmovss	-32(%rax), %xmm0
+ 1471      E0
+ 1472 11b0 E9C3FEFF 		jmp	.L181
+ 1472      FF
+ 1473              		.p2align 4,,10
+ 1474 11b5 0F1F00   		.p2align 3
+ 1475              	.L185:
+ 1476 11b8 C5F82E05 		vucomiss	.LC0(%rip), %xmm0
+ 1476      00000000 
+ 1477 11c0 0F8AAA00 		jp	.L189
+ 1477      0000
+ 1478 11c6 0F85A400 		jne	.L189
+ 1478      0000
+ 1479 11cc 3DFF0000 		cmpl	$255, %eax
+ 1479      00
+ 1480 11d1 0F85B900 		jne	.L191
+ 1480      0000
+ 1481 11d7 418B4F20 		movl	32(%r15), %ecx
+ 1482              	.L192:
+ 1483 11db F30FBDC0 		lzcntl	%eax, %eax
+ 1484 11df 83E818   		subl	$24, %eax
+ 1485 11e2 29C1     		subl	%eax, %ecx
+ 1486              	.L194:
+ 1487 11e4 488B45C0 		movq	-64(%rbp), %rax
+ 1488 11e8 8908     		movl	%ecx, (%rax)
+ 1489 11ea C4C17D6F 		vmovdqa	0(%r13), %ymm5
+ 1489      6D00
+ 1490 11f0 C4C17D7F 		vmovdqa	%ymm5, (%r12)
+ 1490      2C24
+ 1491 11f6 EB9B     		jmp	.L195
+ 1492 11f8 0F1F8400 		.p2align 4,,10
+ 1492      00000000 
+ 1493              		.p2align 3
+ 1494              	.L188:
+ 1495 1200 C5C857F6 		vxorps	%xmm6, %xmm6, %xmm6
+ 1496 1204 C5F82EC6 		vucomiss	%xmm6, %xmm0
+ 1497 1208 0F8AB7FE 		jp	.L193
+ 1497      FFFF
+ 1498 120e 0F85B1FE 		jne	.L193
+ 1498      FFFF
+ 1499 1214 85DB     		testl	%ebx, %ebx
+ 1500 1216 0F85A9FE 		jne	.L193
+ 1500      FFFF
+ 1501 121c C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 1502 1220 4983C520 		addq	$32, %r13
+ 1503 1224 4983C420 		addq	$32, %r12
+ 1504 1228 C4C17D7F 		vmovdqa	%ymm0, -32(%r12)
+ 1504      4424E0
+ 1505 122f 4C3965B8 		cmpq	%r12, -72(%rbp)
+ 1506 1233 0F856EFF 		jne	.L221
+ 1506      FFFF
+ 1507 1239 0F1F8000 		.p2align 4,,10
+ 1507      000000
+ 1508              		.p2align 3
+ 1509              	.L204:
+ 1510 1240 488B45A8 		movq	-88(%rbp), %rax
+ 1511 1244 488B75B0 		movq	-80(%rbp), %rsi
+ 1512 1248 488345C0 		addq	$4, -64(%rbp)
+ 1512      04
+ 1513 124d 48837DB0 		cmpq	$0, -80(%rbp)
+ 1513      00
+ 1514 1252 488B8090 		movq	144(%rax), %rax
+ 1514      000000
+ 1515 1259 880C30   		movb	%cl, (%rax,%rsi)
+ 1516 125c 0F859500 		jne	.L222
+ 1516      0000
+ 1517              	.L209:
+ 1518 1262 48C745B0 		movq	$1, -80(%rbp)
+ 1518      01000000 
+ 1519 126a E9B1FDFF 		jmp	.L205
+ 1519      FF
+ 1520 126f 90       		.p2align 4,,10
+ 1521              		.p2align 3
+ 1522              	.L189:
+ 1523 1270 488B45C0 		movq	-64(%rbp), %rax
+ 1524 1274 8B18     		movl	(%rax), %ebx
+ 1525 1276 E94AFEFF 		jmp	.L193
+ 1525      FF
+ 1526 127b 0F1F4400 		.p2align 4,,10
+ 1526      00
+ 1527              		.p2align 3
+ 1528              	.L219:
+ 1529 1280 8D4BF8   		leal	-8(%rbx), %ecx
+ 1530 1283 E95CFFFF 		jmp	.L194
+ 1530      FF
+ 1531 1288 0F1F8400 		.p2align 4,,10
+ 1531      00000000 
+ 1532              		.p2align 3
+ 1533              	.L191:
+ 1534 1290 488B75C0 		movq	-64(%rbp), %rsi
+ 1535 1294 8B1E     		movl	(%rsi), %ebx
+ 1536 1296 83FB07   		cmpl	$7, %ebx
+ 1537 1299 0F8626FE 		jbe	.L193
+ 1537      FFFF
+ 1538 129f 418B4F20 		movl	32(%r15), %ecx
+ 1539 12a3 83F907   		cmpl	$7, %ecx
+ 1540 12a6 0F8619FE 		jbe	.L193
+ 1540      FFFF
+ 1541 12ac E92AFFFF 		jmp	.L192
+ 1541      FF
+ 1542              	.L218:
+ 1543 12b1 488B45A8 		movq	-88(%rbp), %rax
+ 1544 12b5 C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 1545 12b9 488B75B0 		movq	-80(%rbp), %rsi
+ 1546 12bd 62D17F48 		vmovdqu8	%zmm0, (%r12)
+ 1546      7F0424
+ 1547 12c4 62D17F48 		vmovdqu8	%zmm0, 64(%r12)
+ 1547      7F442401 
+ 1548 12cc 62D17F48 		vmovdqu8	%zmm0, 128(%r12)
+ 1548      7F442402 
+ 1549 12d4 62D17F48 		vmovdqu8	%zmm0, 192(%r12)
+ 1549      7F442403 
+ 1550 12dc 488B8090 		movq	144(%rax), %rax
+ 1550      000000
+ 1551 12e3 488345C0 		addq	$4, -64(%rbp)
+ 1551      04
+ 1552 12e8 48837DB0 		cmpq	$0, -80(%rbp)
+ 1552      00
+ 1553 12ed C6043001 		movb	$1, (%rax,%rsi)
+ 1554 12f1 0F846BFF 		je	.L209
+ 1554      FFFF
+ 1555              	.L222:
+ 1556 12f7 C5F877   		vzeroupper
+ 1557 12fa 4883C448 		addq	$72, %rsp
+ 1558 12fe 5B       		popq	%rbx
+ 1559 12ff 415C     		popq	%r12
+ 1560 1301 415D     		popq	%r13
+ 1561              		.cfi_def_cfa 13, 0
+ 1562 1303 415E     		popq	%r14
+ 1563 1305 415F     		popq	%r15
+ 1564 1307 5D       		popq	%rbp
+ 1565 1308 498D65F0 		leaq	-16(%r13), %rsp
+ 1566              		.cfi_def_cfa 7, 16
+ 1567 130c 415D     		popq	%r13
+ 1568              		.cfi_def_cfa_offset 8
+ 1569 130e C3       		ret
+ 1570              		.cfi_endproc
+ 1571              	.LFE6399:
+ 1573 130f 90       		.p2align 4
+ 1575              	gate_process_2_256:
+ 1576              	.LFB6401:
+ 1577              		.cfi_startproc
+ 1578 1310 4155     		pushq	%r13
+ 1579              		.cfi_def_cfa_offset 16
+ 1580              		.cfi_offset 13, -16
+ 1581 1312 4C8D6C24 		leaq	16(%rsp), %r13
+ 1581      10
+ 1582              		.cfi_def_cfa 13, 0
+ 1583 1317 4883E4E0 		andq	$-32, %rsp
+ 1584 131b 41FF75F8 		pushq	-8(%r13)
+ 1585 131f 55       		pushq	%rbp
+ 1586 1320 4889E5   		movq	%rsp, %rbp
+ 1587              		.cfi_escape 0x10,0x6,0x2,0x76,0
+ 1588 1323 4157     		pushq	%r15
+ 1589 1325 4156     		pushq	%r14
+ 1590 1327 4155     		pushq	%r13
+ 1591              		.cfi_escape 0xf,0x3,0x76,0x68,0x6
+ 1592              		.cfi_escape 0x10,0xf,0x2,0x76,0x78
+ 1593              		.cfi_escape 0x10,0xe,0x2,0x76,0x70
+ 1594 1329 4154     		pushq	%r12
+ 1595 132b 53       		pushq	%rbx
+ 1596 132c 4883EC48 		subq	$72, %rsp
+ 1597              		.cfi_escape 0x10,0xc,0x2,0x76,0x60
+ 1598              		.cfi_escape 0x10,0x3,0x2,0x76,0x58
+ 1599 1330 48897DA8 		movq	%rdi, -88(%rbp)
+ 1600 1334 81BFA400 		cmpl	$256, 164(%rdi)
+ 1600      00000001 
+ 1600      0000
+ 1601 133e 0F855801 		jne	.L224
+ 1601      0000
+ 1602 1344 488B4748 		movq	72(%rdi), %rax
+ 1603 1348 480B4708 		orq	8(%rdi), %rax
+ 1604 134c 480B4710 		orq	16(%rdi), %rax
+ 1605 1350 480B4750 		orq	80(%rdi), %rax
+ 1606 1354 A81F     		testb	$31, %al
+ 1607 1356 0F854001 		jne	.L224
+ 1607      0000
+ 1608 135c 4C8BBFC0 		movq	192(%rdi), %r15
+ 1608      000000
+ 1609 1363 48C745B0 		movq	$0, -80(%rbp)
+ 1609      00000000 
+ 1610 136b 498D474C 		leaq	76(%r15), %rax
+ 1611 136f 488945C0 		movq	%rax, -64(%rbp)
+ 1612              		.p2align 4,,10
+ 1613 1373 0F1F4400 		.p2align 3
+ 1613      00
+ 1614              	.L250:
+ 1615 1378 488B45A8 		movq	-88(%rbp), %rax
+ 1616 137c 488B55B0 		movq	-80(%rbp), %rdx
+ 1617 1380 488B75C0 		movq	-64(%rbp), %rsi
+ 1618 1384 4C8B6CD0 		movq	8(%rax,%rdx,8), %r13
+ 1618      08
+ 1619 1389 4C8B64D0 		movq	72(%rax,%rdx,8), %r12
+ 1619      48
+ 1620 138e 488B8088 		movq	136(%rax), %rax
+ 1620      000000
+ 1621 1395 C5FA1046 		vmovss	-32(%rsi), %xmm0
+ 1621      E0
+ 1622 139a 803C1000 		cmpb	$0, (%rax,%rdx)
+ 1623 139e 741A     		je	.L227
+ 1624 13a0 C5C057FF 		vxorps	%xmm7, %xmm7, %xmm7
+ 1625 13a4 C5F82EC7 		vucomiss	%xmm7, %xmm0
+ 1626 13a8 7A10     		jp	.L227
+ 1627 13aa 750E     		jne	.L227
+ 1628 13ac 488B45C0 		movq	-64(%rbp), %rax
+ 1629 13b0 8B00     		movl	(%rax), %eax
+ 1630 13b2 85C0     		testl	%eax, %eax
+ 1631 13b4 0F844702 		je	.L263
+ 1631      0000
+ 1632              	.L227:
+ 1633 13ba 498D8424 		leaq	1024(%r12), %rax
+ 1633      00040000 
+ 1634 13c2 B9010000 		movl	$1, %ecx
+ 1634      00
+ 1635 13c7 488945B8 		movq	%rax, -72(%rbp)
+ 1636 13cb 0F1F4400 		.p2align 4,,10
+ 1636      00
+ 1637              		.p2align 3
+ 1638              	.L226:
+ 1639 13d0 C4E27D18 		vbroadcastss	.LC24(%rip), %ymm4
+ 1639      25000000 
+ 1639      00
+ 1640 13d9 C4C17A10 		vmovss	(%r15), %xmm1
+ 1640      0F
+ 1641 13de C4C15C55 		vandnps	0(%r13), %ymm4, %ymm2
+ 1641      5500
+ 1642 13e4 C4E27D18 		vbroadcastss	%xmm1, %ymm3
+ 1642      D9
+ 1643 13e9 C5ECC2D3 		vcmpps	$30, %ymm3, %ymm2, %ymm2
+ 1643      1E
+ 1644 13ee C5FC50C2 		vmovmskps	%ymm2, %eax
+ 1645 13f2 85C0     		testl	%eax, %eax
+ 1646 13f4 0F851601 		jne	.L230
+ 1646      0000
+ 1647 13fa C5F82E05 		vucomiss	.LC0(%rip), %xmm0
+ 1647      00000000 
+ 1648 1402 488B45C0 		movq	-64(%rbp), %rax
+ 1649 1406 8B18     		movl	(%rax), %ebx
+ 1650 1408 0F8A4201 		jp	.L233
+ 1650      0000
+ 1651 140e 0F853C01 		jne	.L233
+ 1651      0000
+ 1652 1414 83FB07   		cmpl	$7, %ebx
+ 1653 1417 0F87B301 		ja	.L264
+ 1653      0000
+ 1654              	.L238:
+ 1655 141d 4531F6   		xorl	%r14d, %r14d
+ 1656 1420 C5F877   		vzeroupper
+ 1657 1423 EB3C     		jmp	.L248
+ 1658              		.p2align 4,,10
+ 1659 1425 0F1F00   		.p2align 3
+ 1660              	.L265:
+ 1661 1428 C4C17A58 		vaddss	36(%r15), %xmm0, %xmm0
+ 1661      4724
+ 1662 142e 418B5F20 		movl	32(%r15), %ebx
+ 1663 1432 C5FA100D 		vmovss	.LC0(%rip), %xmm1
+ 1663      00000000 
+ 1664 143a E8000000 		call	fminf@PLT
+ 1664      00
+ 1665 143f C5FA1055 		vmovss	-52(%rbp), %xmm2
+ 1665      CC
+ 1666              	.L245:
+ 1667 1444 C5EA59D0 		vmulss	%xmm0, %xmm2, %xmm2
+ 1668 1448 C4817A11 		vmovss	%xmm2, (%r12,%r14)
+ 1668      1434
+ 1669 144e 4983C604 		addq	$4, %r14
+ 1670 1452 4983FE20 		cmpq	$32, %r14
+ 1671 1456 0F848400 		je	.L247
+ 1671      0000
+ 1672 145c C4C17A10 		vmovss	(%r15), %xmm1
+ 1672      0F
+ 1673              	.L248:
+ 1674 1461 C4817A10 		vmovss	0(%r13,%r14), %xmm2
+ 1674      543500
+ 1675 1468 C5E8541D 		vandps	.LC25(%rip), %xmm2, %xmm3
+ 1675      00000000 
+ 1676 1470 C5F82FD9 		vcomiss	%xmm1, %xmm3
+ 1677 1474 C5FA1155 		vmovss	%xmm2, -52(%rbp)
+ 1677      CC
+ 1678 1479 77AD     		ja	.L265
+ 1679 147b 85DB     		testl	%ebx, %ebx
+ 1680 147d 7441     		je	.L246
+ 1681 147f C4C17A58 		vaddss	36(%r15), %xmm0, %xmm0
+ 1681      4724
+ 1682 1485 83EB01   		subl	$1, %ebx
+ 1683 1488 C5FA100D 		vmovss	.LC0(%rip), %xmm1
+ 1683      00000000 
+ 1684 1490 E8000000 		call	fminf@PLT
+ 1684      00
+ 1685 1495 C5FA1055 		vmovss	-52(%rbp), %xmm2
+ 1685      CC
+ 1686 149a EBA8     		jmp	.L245
+ 1687              	.L224:
+ 1688 149c 488B7DA8 		movq	-88(%rbp), %rdi
+ 1689 14a0 4883C448 		addq	$72, %rsp
+ 1690 14a4 5B       		popq	%rbx
+ 1691 14a5 415C     		popq	%r12
+ 1692 14a7 415D     		popq	%r13
+ 1693              		.cfi_remember_state
+ 1694              		.cfi_def_cfa 13, 0
+ 1695 14a9 415E     		popq	%r14
+ 1696 14ab 415F     		popq	%r15
+ 1697 14ad 5D       		popq	%rbp
+ 1698 14ae 498D65F0 		leaq	-16(%r13), %rsp
+ 1699              		.cfi_def_cfa 7, 16
+ 1700 14b2 415D     		popq	%r13
+ 1701              		.cfi_def_cfa_offset 8
+ 1702 14b4 E9000000 		jmp	gate_process@PLT
+ 1702      00
+ 1703 14b9 0F1F8000 		.p2align 4,,10
+ 1703      000000
+ 1704              		.p2align 3
+ 1705              	.L246:
+ 1706              		.cfi_restore_state
+ 1707 14c0 C4C17A5C 		vsubss	40(%r15), %xmm0, %xmm0
+ 1707      4728
+ 1708 14c6 C5F057C9 		vxorps	%xmm1, %xmm1, %xmm1
+ 1709 14ca E8000000 		call	fmaxf@PLT
+ 1709      00
+ 1710 14cf C5FA1055 		vmovss	-52(%rbp), %xmm2
+ 1710      CC
+ 1711 14d4 E96BFFFF 		jmp	.L245
+ 1711      FF
+ 1712 14d9 0F1F8000 		.p2align 4,,10
+ 1712      000000
+ 1713              		.p2align 3
+ 1714              	.L247:
+ 1715 14e0 488B45C0 		movq	-64(%rbp), %rax
+ 1716 14e4 8918     		movl	%ebx, (%rax)
+ 1717 14e6 C5FA1140 		vmovss	%xmm0, -32(%rax)
+ 1717      E0
+ 1718              	.L240:
+ 1719 14eb 31C9     		xorl	%ecx, %ecx
+ 1720 14ed 4983C520 		addq	$32, %r13
+ 1721 14f1 4983C420 		addq	$32, %r12
+ 1722 14f5 4C3965B8 		cmpq	%r12, -72(%rbp)
+ 1723 14f9 0F849100 		je	.L249
+ 1723      0000
+ 1724              	.L266:
+ 1725 14ff 488B45C0 		movq	-64(%rbp), %rax
+ 1726 1503 C5FA1040 		vmovss	-32(%rax), %xmm0
+ 1726      E0
+ 1727 1508 E9C3FEFF 		jmp	.L226
+ 1727      FF
+ 1728 150d 0F1F00   		.p2align 4,,10
+ 1729              		.p2align 3
+ 1730              	.L230:
+ 1731 1510 C5F82E05 		vucomiss	.LC0(%rip), %xmm0
+ 1731      00000000 
+ 1732 1518 0F8AA200 		jp	.L234
+ 1732      0000
+ 1733 151e 0F859C00 		jne	.L234
+ 1733      0000
+ 1734 1524 3DFF0000 		cmpl	$255, %eax
+ 1734      00
+ 1735 1529 0F85B100 		jne	.L236
+ 1735      0000
+ 1736 152f 418B4F20 		movl	32(%r15), %ecx
+ 1737              	.L237:
+ 1738 1533 F30FBDC0 		lzcntl	%eax, %eax
+ 1739 1537 83E818   		subl	$24, %eax
+ 1740 153a 29C1     		subl	%eax, %ecx
+ 1741              	.L239:
+ 1742 153c 488B45C0 		movq	-64(%rbp), %rax
+ 1743 1540 8908     		movl	%ecx, (%rax)
+ 1744 1542 C4C17D6F 		vmovdqa	0(%r13), %ymm5
+ 1744      6D00
+ 1745 1548 C4C17D7F 		vmovdqa	%ymm5, (%r12)
+ 1745      2C24
+ 1746 154e EB9B     		jmp	.L240
+ 1747              		.p2align 4,,10
+ 1748              		.p2align 3
+ 1749              	.L233:
+ 1750 1550 C5C857F6 		vxorps	%xmm6, %xmm6, %xmm6
+ 1751 1554 C5F82EC6 		vucomiss	%xmm6, %xmm0
+ 1752 1558 0F8ABFFE 		jp	.L238
+ 1752      FFFF
+ 1753 155e 0F85B9FE 		jne	.L238
+ 1753      FFFF
+ 1754 1564 85DB     		testl	%ebx, %ebx
+ 1755 1566 0F85B1FE 		jne	.L238
+ 1755      FFFF
+ 1756 156c C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 1757 1570 4983C520 		addq	$32, %r13
+ 1758 1574 4983C420 		addq	$32, %r12
+ 1759 1578 C4C17D7F 		vmovdqa	%ymm0, -32(%r12)
+ 1759      4424E0
+ 1760 157f 4C3965B8 		cmpq	%r12, -72(%rbp)
+ 1761 1583 0F8576FF 		jne	.L266
+ 1761      FFFF
+ 1762 1589 0F1F8000 		.p2align 4,,10
+ 1762      000000
+ 1763              		.p2align 3
+ 1764              	.L249:
+ 1765 1590 488B45A8 		movq	-88(%rbp), %rax
+ 1766 1594 488B7DB0 		movq	-80(%rbp), %rdi
+ 1767 1598 488345C0 		addq	$4, -64(%rbp)
+ 1767      04
+ 1768 159d 48837DB0 		cmpq	$0, -80(%rbp)
+ 1768      00
+ 1769 15a2 488B8090 		movq	144(%rax), %rax
+ 1769      000000
+ 1770 15a9 880C38   		movb	%cl, (%rax,%rdi)
+ 1771 15ac 757F     		jne	.L267
+ 1772              	.L254:
+ 1773 15ae 48C745B0 		movq	$1, -80(%rbp)
+ 1773      01000000 
+ 1774 15b6 E9BDFDFF 		jmp	.L250
+ 1774      FF
+ 1775 15bb 0F1F4400 		.p2align 4,,10
+ 1775      00
+ 1776              		.p2align 3
+ 1777              	.L234:
+ 1778 15c0 488B45C0 		movq	-64(%rbp), %rax
+ 1779 15c4 8B18     		movl	(%rax), %ebx
+ 1780 15c6 E952FEFF 		jmp	.L238
+ 1780      FF
+ 1781 15cb 0F1F4400 		.p2align 4,,10
+ 1781      00
+ 1782              		.p2align 3
+ 1783              	.L264:
+ 1784 15d0 8D4BF8   		leal	-8(%rbx), %ecx
+ 1785 15d3 E964FFFF 		jmp	.L239
+ 1785      FF
+ 1786 15d8 0F1F8400 		.p2align 4,,10
+ 1786      00000000 
+ 1787              		.p2align 3
+ 1788              	.L236:
+ 1789 15e0 488B7DC0 		movq	-64(%rbp), %rdi
+ 1790 15e4 8B1F     		movl	(%rdi), %ebx
+ 1791 15e6 83FB07   		cmpl	$7, %ebx
+ 1792 15e9 0F862EFE 		jbe	.L238
+ 1792      FFFF
+ 1793 15ef 418B4F20 		movl	32(%r15), %ecx
+ 1794 15f3 83F907   		cmpl	$7, %ecx
+ 1795 15f6 0F8621FE 		jbe	.L238
+ 1795      FFFF
+ 1796 15fc E932FFFF 		jmp	.L237
+ 1796      FF
+ 1797              	.L263:
+ 1798 1601 31C0     		xorl	%eax, %eax
+ 1799 1603 B9800000 		movl	$128, %ecx
+ 1799      00
+ 1800 1608 4C89E7   		movq	%r12, %rdi
+ 1801 160b 488345C0 		addq	$4, -64(%rbp)
+ 1801      04
+ 1802 1610 F348AB   		rep stosq
+ 1803 1613 488B45A8 		movq	-88(%rbp), %rax
+ 1804 1617 488B7DB0 		movq	-80(%rbp), %rdi
+ 1805 161b 48837DB0 		cmpq	$0, -80(%rbp)
+ 1805      00
+ 1806 1620 488B8090 		movq	144(%rax), %rax
+ 1806      000000
+ 1807 1627 C6043801 		movb	$1, (%rax,%rdi)
+ 1808 162b 7481     		je	.L254
+ 1809              	.L267:
+ 1810 162d C5F877   		vzeroupper
+ 1811 1630 4883C448 		addq	$72, %rsp
+ 1812 1634 5B       		popq	%rbx
+ 1813 1635 415C     		popq	%r12
+ 1814 1637 415D     		popq	%r13
+ 1815              		.cfi_def_cfa 13, 0
+ 1816 1639 415E     		popq	%r14
+ 1817 163b 415F     		popq	%r15
+ 1818 163d 5D       		popq	%rbp
+ 1819 163e 498D65F0 		leaq	-16(%r13), %rsp
+ 1820              		.cfi_def_cfa 7, 16
+ 1821 1642 415D     		popq	%r13
+ 1822              		.cfi_def_cfa_offset 8
+ 1823 1644 C3       		ret
+ 1824              		.cfi_endproc
+ 1825              	.LFE6401:
+ 1827 1645 66662E0F 		.p2align 4
+ 1827      1F840000 
+ 1827      000000
+ 1829              	gate_process_8_128:
+ 1830              	.LFB6403:
+ 1831              		.cfi_startproc
+ 1832 1650 4155     		pushq	%r13
+ 1833              		.cfi_def_cfa_offset 16
+ 1834              		.cfi_offset 13, -16
+ 1835 1652 4C8D6C24 		leaq	16(%rsp), %r13
+ 1835      10
+ 1836              		.cfi_def_cfa 13, 0
+ 1837 1657 4883E4C0 		andq	$-64, %rsp
+ 1838 165b 41FF75F8 		pushq	-8(%r13)
+ 1839 165f 55       		pushq	%rbp
+ 1840 1660 4889E5   		movq	%rsp, %rbp
+ 1841              		.cfi_escape 0x10,0x6,0x2,0x76,0
+ 1842 1663 4157     		pushq	%r15
+ 1843 1665 4156     		pushq	%r14
+ 1844 1667 4155     		pushq	%r13
+ 1845              		.cfi_escape 0xf,0x3,0x76,0x68,0x6
+ 1846              		.cfi_escape 0x10,0xf,0x2,0x76,0x78
+ 1847              		.cfi_escape 0x10,0xe,0x2,0x76,0x70
+ 1848 1669 4154     		pushq	%r12
+ 1849 166b 53       		pushq	%rbx
+ 1850 166c 4881EC88 		subq	$136, %rsp
+ 1850      000000
+ 1851              		.cfi_escape 0x10,0xc,0x2,0x76,0x60
+ 1852              		.cfi_escape 0x10,0x3,0x2,0x76,0x58
+ 1853 1673 4889BD70 		movq	%rdi, -144(%rbp)
+ 1853      FFFFFF
+ 1854 167a 81BFA400 		cmpl	$128, 164(%rdi)
+ 1854      00008000 
+ 1854      0000
+ 1855 1684 0F859501 		jne	.L269
+ 1855      0000
+ 1856 168a 62F1FE48 		vmovdqu64	8(%rdi), %zmm5
+ 1856      6FAF0800 
+ 1856      0000
+ 1857 1694 62F1D548 		vporq	72(%rdi), %zmm5, %zmm0
+ 1857      EB874800 
+ 1857      0000
+ 1858 169e 62F3FD48 		vextracti64x4	$0x1, %zmm0, %ymm1
+ 1858      3BC101
+ 1859 16a5 62F1FD48 		vmovdqa64	%zmm5, -112(%rbp)
+ 1859      7FAD90FF 
+ 1859      FFFF
+ 1860 16af C5F5EBC8 		vpor	%ymm0, %ymm1, %ymm1
+ 1861 16b3 62F3FD28 		vextracti64x2	$0x1, %ymm1, %xmm0
+ 1861      39C801
+ 1862 16ba C5F9EBC1 		vpor	%xmm1, %xmm0, %xmm0
+ 1863 16be C5F173D8 		vpsrldq	$8, %xmm0, %xmm1
+ 1863      08
+ 1864 16c3 C5F9EBC1 		vpor	%xmm1, %xmm0, %xmm0
+ 1865 16c7 C4E1F97E 		vmovq	%xmm0, %rax
+ 1865      C0
+ 1866 16cc A81F     		testb	$31, %al
+ 1867 16ce 0F854801 		jne	.L306
+ 1867      0000
+ 1868 16d4 4C8BBFC0 		movq	192(%rdi), %r15
+ 1868      000000
+ 1869 16db 48C78578 		movq	$0, -136(%rbp)
+ 1869      FFFFFF00 
+ 1869      000000
+ 1870 16e6 498D474C 		leaq	76(%r15), %rax
+ 1871 16ea 48894588 		movq	%rax, -120(%rbp)
+ 1872 16ee 6690     		.p2align 4,,10
+ 1873              		.p2align 3
+ 1874              	.L295:
+ 1875 16f0 488B8570 		movq	-144(%rbp), %rax
+ 1875      FFFFFF
+ 1876 16f7 488B9578 		movq	-136(%rbp), %rdx
+ 1876      FFFFFF
+ 1877 16fe 488B7D88 		movq	-120(%rbp), %rdi
+ 1878 1702 4C8B6CD0 		movq	8(%rax,%rdx,8), %r13
+ 1878      08
+ 1879 1707 4C8B64D0 		movq	72(%rax,%rdx,8), %r12
+ 1879      48
+ 1880 170c 488B8088 		movq	136(%rax), %rax
+ 1880      000000
+ 1881 1713 C5FA1047 		vmovss	-32(%rdi), %xmm0
+ 1881      E0
+ 1882 1718 803C1000 		cmpb	$0, (%rax,%rdx)
+ 1883 171c 741A     		je	.L272
+ 1884 171e C5D057ED 		vxorps	%xmm5, %xmm5, %xmm5
+ 1885 1722 C5F82EC5 		vucomiss	%xmm5, %xmm0
+ 1886 1726 7A10     		jp	.L272
+ 1887 1728 750E     		jne	.L272
+ 1888 172a 488B4588 		movq	-120(%rbp), %rax
+ 1889 172e 8B00     		movl	(%rax), %eax
+ 1890 1730 85C0     		testl	%eax, %eax
+ 1891 1732 0F847902 		je	.L309
+ 1891      0000
+ 1892              	.L272:
+ 1893 1738 498D8424 		leaq	512(%r12), %rax
+ 1893      00020000 
+ 1894 1740 B9010000 		movl	$1, %ecx
+ 1894      00
+ 1895 1745 48894580 		movq	%rax, -128(%rbp)
+ 1896 1749 0F1F8000 		.p2align 4,,10
+ 1896      000000
+ 1897              		.p2align 3
+ 1898              	.L271:
+ 1899 1750 C4E27D18 		vbroadcastss	.LC24(%rip), %ymm4
+ 1899      25000000 
+ 1899      00
+ 1900 1759 C4C17A10 		vmovss	(%r15), %xmm1
+ 1900      0F
+ 1901 175e C4C15C55 		vandnps	0(%r13), %ymm4, %ymm2
+ 1901      5500
+ 1902 1764 C4E27D18 		vbroadcastss	%xmm1, %ymm3
+ 1902      D9
+ 1903 1769 C5ECC2D3 		vcmpps	$30, %ymm3, %ymm2, %ymm2
+ 1903      1E
+ 1904 176e C5FC50C2 		vmovmskps	%ymm2, %eax
+ 1905 1772 85C0     		testl	%eax, %eax
+ 1906 1774 0F851E01 		jne	.L275
+ 1906      0000
+ 1907 177a C5F82E05 		vucomiss	.LC0(%rip), %xmm0
+ 1907      00000000 
+ 1908 1782 488B4588 		movq	-120(%rbp), %rax
+ 1909 1786 8B18     		movl	(%rax), %ebx
+ 1910 1788 0F8A5201 		jp	.L278
+ 1910      0000
+ 1911 178e 0F854C01 		jne	.L278
+ 1911      0000
+ 1912 1794 83FB07   		cmpl	$7, %ebx
+ 1913 1797 0F87EB01 		ja	.L310
+ 1913      0000
+ 1914              	.L283:
+ 1915 179d 4531F6   		xorl	%r14d, %r14d
+ 1916 17a0 C5F877   		vzeroupper
+ 1917 17a3 EB3C     		jmp	.L293
+ 1918              		.p2align 4,,10
+ 1919 17a5 0F1F00   		.p2align 3
+ 1920              	.L311:
+ 1921 17a8 C4C17A58 		vaddss	36(%r15), %xmm0, %xmm0
+ 1921      4724
+ 1922 17ae 418B5F20 		movl	32(%r15), %ebx
+ 1923 17b2 C5FA100D 		vmovss	.LC0(%rip), %xmm1
+ 1923      00000000 
+ 1924 17ba E8000000 		call	fminf@PLT
+ 1924      00
+ 1925 17bf C5FA1055 		vmovss	-112(%rbp), %xmm2
+ 1925      90
+ 1926              	.L290:
+ 1927 17c4 C5EA59D0 		vmulss	%xmm0, %xmm2, %xmm2
+ 1928 17c8 C4817A11 		vmovss	%xmm2, (%r12,%r14)
+ 1928      1434
+ 1929 17ce 4983C604 		addq	$4, %r14
+ 1930 17d2 4983FE20 		cmpq	$32, %r14
+ 1931 17d6 0F848C00 		je	.L292
+ 1931      0000
+ 1932 17dc C4C17A10 		vmovss	(%r15), %xmm1
+ 1932      0F
+ 1933              	.L293:
+ 1934 17e1 C4817A10 		vmovss	0(%r13,%r14), %xmm2
+ 1934      543500
+ 1935 17e8 C5E8541D 		vandps	.LC25(%rip), %xmm2, %xmm3
+ 1935      00000000 
+ 1936 17f0 C5F82FD9 		vcomiss	%xmm1, %xmm3
+ 1937 17f4 C5FA1155 		vmovss	%xmm2, -112(%rbp)
+ 1937      90
+ 1938 17f9 77AD     		ja	.L311
+ 1939 17fb 85DB     		testl	%ebx, %ebx
+ 1940 17fd 7449     		je	.L291
+ 1941 17ff C4C17A58 		vaddss	36(%r15), %xmm0, %xmm0
+ 1941      4724
+ 1942 1805 83EB01   		subl	$1, %ebx
+ 1943 1808 C5FA100D 		vmovss	.LC0(%rip), %xmm1
+ 1943      00000000 
+ 1944 1810 E8000000 		call	fminf@PLT
+ 1944      00
+ 1945 1815 C5FA1055 		vmovss	-112(%rbp), %xmm2
+ 1945      90
+ 1946 181a EBA8     		jmp	.L290
+ 1947              	.L306:
+ 1948 181c C5F877   		vzeroupper
+ 1949              	.L269:
+ 1950 181f 488BBD70 		movq	-144(%rbp), %rdi
+ 1950      FFFFFF
+ 1951 1826 4881C488 		addq	$136, %rsp
+ 1951      000000
+ 1952 182d 5B       		popq	%rbx
+ 1953 182e 415C     		popq	%r12
+ 1954 1830 415D     		popq	%r13
+ 1955              		.cfi_remember_state
+ 1956              		.cfi_def_cfa 13, 0
+ 1957 1832 415E     		popq	%r14
+ 1958 1834 415F     		popq	%r15
+ 1959 1836 5D       		popq	%rbp
+ 1960 1837 498D65F0 		leaq	-16(%r13), %rsp
+ 1961              		.cfi_def_cfa 7, 16
+ 1962 183b 415D     		popq	%r13
+ 1963              		.cfi_def_cfa_offset 8
+ 1964 183d E9000000 		jmp	gate_process@PLT
+ 1964      00
+ 1965              		.p2align 4,,10
+ 1966 1842 660F1F44 		.p2align 3
+ 1966      0000
+ 1967              	.L291:
+ 1968              		.cfi_restore_state
+ 1969 1848 C4C17A5C 		vsubss	40(%r15), %xmm0, %xmm0
+ 1969      4728
+ 1970 184e C5F057C9 		vxorps	%xmm1, %xmm1, %xmm1
+ 1971 1852 E8000000 		call	fmaxf@PLT
+ 1971      00
+ 1972 1857 C5FA1055 		vmovss	-112(%rbp), %xmm2
+ 1972      90
+ 1973 185c E963FFFF 		jmp	.L290
+ 1973      FF
+ 1974              		.p2align 4,,10
+ 1975 1861 0F1F8000 		.p2align 3
+ 1975      000000
+ 1976              	.L292:
+ 1977 1868 488B4588 		movq	-120(%rbp), %rax
+ 1978 186c 8918     		movl	%ebx, (%rax)
+ 1979 186e C5FA1140 		vmovss	%xmm0, -32(%rax)
+ 1979      E0
+ 1980              	.L285:
+ 1981 1873 31C9     		xorl	%ecx, %ecx
+ 1982 1875 4983C520 		addq	$32, %r13
+ 1983 1879 4983C420 		addq	$32, %r12
+ 1984 187d 4C396580 		cmpq	%r12, -128(%rbp)
+ 1985 1881 0F849900 		je	.L294
+ 1985      0000
+ 1986              	.L312:
+ 1987 1887 488B4588 		movq	-120(%rbp), %rax
+ 1988 188b C5FA1040 		vmovss	-32(%rax), %xmm0
+ 1988      E0
+ 1989 1890 E9BBFEFF 		jmp	.L271
+ 1989      FF
+ 1990              		.p2align 4,,10
+ 1991 1895 0F1F00   		.p2align 3
+ 1992              	.L275:
+ 1993 1898 C5F82E05 		vucomiss	.LC0(%rip), %xmm0
+ 1993      00000000 
+ 1994 18a0 0F8AD200 		jp	.L279
+ 1994      0000
+ 1995 18a6 0F85CC00 		jne	.L279
+ 1995      0000
+ 1996 18ac 3DFF0000 		cmpl	$255, %eax
+ 1996      00
+ 1997 18b1 0F85D900 		jne	.L281
+ 1997      0000
+ 1998 18b7 418B4F20 		movl	32(%r15), %ecx
+ 1999              	.L282:
+ 2000 18bb F30FBDC0 		lzcntl	%eax, %eax
+ 2001 18bf 83E818   		subl	$24, %eax
+ 2002 18c2 29C1     		subl	%eax, %ecx
+ 2003              	.L284:
+ 2004 18c4 488B4588 		movq	-120(%rbp), %rax
+ 2005 18c8 8908     		movl	%ecx, (%rax)
+ 2006 18ca C4C17D6F 		vmovdqa	0(%r13), %ymm6
+ 2006      7500
+ 2007 18d0 C4C17D7F 		vmovdqa	%ymm6, (%r12)
+ 2007      3424
+ 2008 18d6 EB9B     		jmp	.L285
+ 2009 18d8 0F1F8400 		.p2align 4,,10
+ 2009      00000000 
+ 2010              		.p2align 3
+ 2011              	.L278:
+ 2012 18e0 C5C057FF 		vxorps	%xmm7, %xmm7, %xmm7
+ 2013 18e4 C5F82EC7 		vucomiss	%xmm7, %xmm0
+ 2014 18e8 0F8AAFFE 		jp	.L283
+ 2014      FFFF
+ 2015 18ee 0F85A9FE 		jne	.L283
+ 2015      FFFF
+ 2016 18f4 85DB     		testl	%ebx, %ebx
+ 2017 18f6 0F85A1FE 		jne	.L283
+ 2017      FFFF
+ 2018 18fc C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 2019 1900 4983C520 		addq	$32, %r13
+ 2020 1904 4983C420 		addq	$32, %r12
+ 2021 1908 C4C17D7F 		vmovdqa	%ymm0, -32(%r12)
+ 2021      4424E0
+ 2022 190f 4C396580 		cmpq	%r12, -128(%rbp)
+ 2023 1913 0F856EFF 		jne	.L312
+ 2023      FFFF
+ 2024 1919 0F1F8000 		.p2align 4,,10
+ 2024      000000
+ 2025              		.p2align 3
+ 2026              	.L294:
+ 2027 1920 488B8570 		movq	-144(%rbp), %rax
+ 2027      FFFFFF
+ 2028 1927 488BB578 		movq	-136(%rbp), %rsi
+ 2028      FFFFFF
+ 2029 192e 488B8090 		movq	144(%rax), %rax
+ 2029      000000
+ 2030 1935 880C30   		movb	%cl, (%rax,%rsi)
+ 2031              	.L274:
+ 2032 1938 48838578 		addq	$1, -136(%rbp)
+ 2032      FFFFFF01 
+ 2033 1940 488B8578 		movq	-136(%rbp), %rax
+ 2033      FFFFFF
+ 2034 1947 48834588 		addq	$4, -120(%rbp)
+ 2034      04
+ 2035 194c 4883F808 		cmpq	$8, %rax
+ 2036 1950 0F859AFD 		jne	.L295
+ 2036      FFFF
+ 2037 1956 C5F877   		vzeroupper
+ 2038 1959 4881C488 		addq	$136, %rsp
+ 2038      000000
+ 2039 1960 5B       		popq	%rbx
+ 2040 1961 415C     		popq	%r12
+ 2041 1963 415D     		popq	%r13
+ 2042              		.cfi_remember_state
+ 2043              		.cfi_def_cfa 13, 0
+ 2044 1965 415E     		popq	%r14
+ 2045 1967 415F     		popq	%r15
+ 2046 1969 5D       		popq	%rbp
+ 2047 196a 498D65F0 		leaq	-16(%r13), %rsp
+ 2048              		.cfi_def_cfa 7, 16
+ 2049 196e 415D     		popq	%r13
+ 2050              		.cfi_def_cfa_offset 8
+ 2051 1970 C3       		ret
+ 2052              		.p2align 4,,10
+ 2053 1971 0F1F8000 		.p2align 3
+ 2053      000000
+ 2054              	.L279:
+ 2055              		.cfi_restore_state
+ 2056 1978 488B4588 		movq	-120(%rbp), %rax
+ 2057 197c 8B18     		movl	(%rax), %ebx
+ 2058 197e E91AFEFF 		jmp	.L283
+ 2058      FF
+ 2059              		.p2align 4,,10
+ 2060 1983 0F1F4400 		.p2align 3
+ 2060      00
+ 2061              	.L310:
+ 2062 1988 8D4BF8   		leal	-8(%rbx), %ecx
+ 2063 198b E934FFFF 		jmp	.L284
+ 2063      FF
+ 2064              		.p2align 4,,10
+ 2065              		.p2align 3
+ 2066              	.L281:
+ 2067 1990 488B7588 		movq	-120(%rbp), %rsi
+ 2068 1994 8B1E     		movl	(%rsi), %ebx
+ 2069 1996 83FB07   		cmpl	$7, %ebx
+ 2070 1999 0F86FEFD 		jbe	.L283
+ 2070      FFFF
+ 2071 199f 418B4F20 		movl	32(%r15), %ecx
+ 2072 19a3 83F907   		cmpl	$7, %ecx
+ 2073 19a6 0F86F1FD 		jbe	.L283
+ 2073      FFFF
+ 2074 19ac E90AFFFF 		jmp	.L282
+ 2074      FF
+ 2075              	.L309:
+ 2076 19b1 31C0     		xorl	%eax, %eax
+ 2077 19b3 B9400000 		movl	$64, %ecx
+ 2077      00
+ 2078 19b8 4C89E7   		movq	%r12, %rdi
+ 2079 19bb 488BB578 		movq	-136(%rbp), %rsi
+ 2079      FFFFFF
+ 2080 19c2 F348AB   		rep stosq
+ 2081 19c5 488B8570 		movq	-144(%rbp), %rax
+ 2081      FFFFFF
+ 2082 19cc 488B8090 		movq	144(%rax), %rax
+ 2082      000000
+ 2083 19d3 C6043001 		movb	$1, (%rax,%rsi)
+ 2084 19d7 E95CFFFF 		jmp	.L274
+ 2084      FF
+ 2085              		.cfi_endproc
+ 2086              	.LFE6403:
+ 2088 19dc 0F1F4000 		.p2align 4
+ 2090              	gate_process_8_256:
+ 2091              	.LFB6404:
+ 2092              		.cfi_startproc
+ 2093 19e0 4155     		pushq	%r13
+ 2094              		.cfi_def_cfa_offset 16
+ 2095              		.cfi_offset 13, -16
+ 2096 19e2 4C8D6C24 		leaq	16(%rsp), %r13
+ 2096      10
+ 2097              		.cfi_def_cfa 13, 0
+ 2098 19e7 4883E4C0 		andq	$-64, %rsp
+ 2099 19eb 41FF75F8 		pushq	-8(%r13)
+ 2100 19ef 55       		pushq	%rbp
+ 2101 19f0 4889E5   		movq	%rsp, %rbp
+ 2102              		.cfi_escape 0x10,0x6,0x2,0x76,0
+ 2103 19f3 4157     		pushq	%r15
+ 2104 19f5 4156     		pushq	%r14
+ 2105 19f7 4155     		pushq	%r13
+ 2106              		.cfi_escape 0xf,0x3,0x76,0x68,0x6
+ 2107              		.cfi_escape 0x10,0xf,0x2,0x76,0x78
+ 2108              		.cfi_escape 0x10,0xe,0x2,0x76,0x70
+ 2109 19f9 4154     		pushq	%r12
+ 2110 19fb 53       		pushq	%rbx
+ 2111 19fc 4881EC88 		subq	$136, %rsp
+ 2111      000000
+ 2112              		.cfi_escape 0x10,0xc,0x2,0x76,0x60
+ 2113              		.cfi_escape 0x10,0x3,0x2,0x76,0x58
+ 2114 1a03 4889BD70 		movq	%rdi, -144(%rbp)
+ 2114      FFFFFF
+ 2115 1a0a 81BFA400 		cmpl	$256, 164(%rdi)
+ 2115      00000001 
+ 2115      0000
+ 2116 1a14 0F859501 		jne	.L314
+ 2116      0000
+ 2117 1a1a 62F1FE48 		vmovdqu64	8(%rdi), %zmm5
+ 2117      6FAF0800 
+ 2117      0000
+ 2118 1a24 62F1D548 		vporq	72(%rdi), %zmm5, %zmm0
+ 2118      EB874800 
+ 2118      0000
+ 2119 1a2e 62F3FD48 		vextracti64x4	$0x1, %zmm0, %ymm1
+ 2119      3BC101
+ 2120 1a35 62F1FD48 		vmovdqa64	%zmm5, -112(%rbp)
+ 2120      7FAD90FF 
+ 2120      FFFF
+ 2121 1a3f C5F5EBC8 		vpor	%ymm0, %ymm1, %ymm1
+ 2122 1a43 62F3FD28 		vextracti64x2	$0x1, %ymm1, %xmm0
+ 2122      39C801
+ 2123 1a4a C5F9EBC1 		vpor	%xmm1, %xmm0, %xmm0
+ 2124 1a4e C5F173D8 		vpsrldq	$8, %xmm0, %xmm1
+ 2124      08
+ 2125 1a53 C5F9EBC1 		vpor	%xmm1, %xmm0, %xmm0
+ 2126 1a57 C4E1F97E 		vmovq	%xmm0, %rax
+ 2126      C0
+ 2127 1a5c A81F     		testb	$31, %al
+ 2128 1a5e 0F854801 		jne	.L351
+ 2128      0000
+ 2129 1a64 4C8BBFC0 		movq	192(%rdi), %r15
+ 2129      000000
+ 2130 1a6b 48C78578 		movq	$0, -136(%rbp)
+ 2130      FFFFFF00 
+ 2130      000000
+ 2131 1a76 498D474C 		leaq	76(%r15), %rax
+ 2132 1a7a 48894588 		movq	%rax, -120(%rbp)
+ 2133 1a7e 6690     		.p2align 4,,10
+ 2134              		.p2align 3
+ 2135              	.L340:
+ 2136 1a80 488B8570 		movq	-144(%rbp), %rax
+ 2136      FFFFFF
+ 2137 1a87 488B9578 		movq	-136(%rbp), %rdx
+ 2137      FFFFFF
+ 2138 1a8e 488B7D88 		movq	-120(%rbp), %rdi
+ 2139 1a92 4C8B6CD0 		movq	8(%rax,%rdx,8), %r13
+ 2139      08
+ 2140 1a97 4C8B64D0 		movq	72(%rax,%rdx,8), %r12
+ 2140      48
+ 2141 1a9c 488B8088 		movq	136(%rax), %rax
+ 2141      000000
+ 2142 1aa3 C5FA1047 		vmovss	-32(%rdi), %xmm0
+ 2142      E0
+ 2143 1aa8 803C1000 		cmpb	$0, (%rax,%rdx)
+ 2144 1aac 741A     		je	.L317
+ 2145 1aae C5D057ED 		vxorps	%xmm5, %xmm5, %xmm5
+ 2146 1ab2 C5F82EC5 		vucomiss	%xmm5, %xmm0
+ 2147 1ab6 7A10     		jp	.L317
+ 2148 1ab8 750E     		jne	.L317
+ 2149 1aba 488B4588 		movq	-120(%rbp), %rax
+ 2150 1abe 8B00     		movl	(%rax), %eax
+ 2151 1ac0 85C0     		testl	%eax, %eax
+ 2152 1ac2 0F847902 		je	.L354
+ 2152      0000
+ 2153              	.L317:
+ 2154 1ac8 498D8424 		leaq	1024(%r12), %rax
+ 2154      00040000 
+ 2155 1ad0 B9010000 		movl	$1, %ecx
+ 2155      00
+ 2156 1ad5 48894580 		movq	%rax, -128(%rbp)
+ 2157 1ad9 0F1F8000 		.p2align 4,,10
+ 2157      000000
+ 2158              		.p2align 3
+ 2159              	.L316:
+ 2160 1ae0 C4E27D18 		vbroadcastss	.LC24(%rip), %ymm4
+ 2160      25000000 
+ 2160      00
+ 2161 1ae9 C4C17A10 		vmovss	(%r15), %xmm1
+ 2161      0F
+ 2162 1aee C4C15C55 		vandnps	0(%r13), %ymm4, %ymm2
+ 2162      5500
+ 2163 1af4 C4E27D18 		vbroadcastss	%xmm1, %ymm3
+ 2163      D9
+ 2164 1af9 C5ECC2D3 		vcmpps	$30, %ymm3, %ymm2, %ymm2
+ 2164      1E
+ 2165 1afe C5FC50C2 		vmovmskps	%ymm2, %eax
+ 2166 1b02 85C0     		testl	%eax, %eax
+ 2167 1b04 0F851E01 		jne	.L320
+ 2167      0000
+ 2168 1b0a C5F82E05 		vucomiss	.LC0(%rip), %xmm0
+ 2168      00000000 
+ 2169 1b12 488B4588 		movq	-120(%rbp), %rax
+ 2170 1b16 8B18     		movl	(%rax), %ebx
+ 2171 1b18 0F8A5201 		jp	.L323
+ 2171      0000
+ 2172 1b1e 0F854C01 		jne	.L323
+ 2172      0000
+ 2173 1b24 83FB07   		cmpl	$7, %ebx
+ 2174 1b27 0F87EB01 		ja	.L355
+ 2174      0000
+ 2175              	.L328:
+ 2176 1b2d 4531F6   		xorl	%r14d, %r14d
+ 2177 1b30 C5F877   		vzeroupper
+ 2178 1b33 EB3C     		jmp	.L338
+ 2179              		.p2align 4,,10
+ 2180 1b35 0F1F00   		.p2align 3
+ 2181              	.L356:
+ 2182 1b38 C4C17A58 		vaddss	36(%r15), %xmm0, %xmm0
+ 2182      4724
+ 2183 1b3e 418B5F20 		movl	32(%r15), %ebx
+ 2184 1b42 C5FA100D 		vmovss	.LC0(%rip), %xmm1
+ 2184      00000000 
+ 2185 1b4a E8000000 		call	fminf@PLT
+ 2185      00
+ 2186 1b4f C5FA1055 		vmovss	-112(%rbp), %xmm2
+ 2186      90
+ 2187              	.L335:
+ 2188 1b54 C5EA59D0 		vmulss	%xmm0, %xmm2, %xmm2
+ 2189 1b58 C4817A11 		vmovss	%xmm2, (%r12,%r14)
+ 2189      1434
+ 2190 1b5e 4983C604 		addq	$4, %r14
+ 2191 1b62 4983FE20 		cmpq	$32, %r14
+ 2192 1b66 0F848C00 		je	.L337
+ 2192      0000
+ 2193 1b6c C4C17A10 		vmovss	(%r15), %xmm1
+ 2193      0F
+ 2194              	.L338:
+ 2195 1b71 C4817A10 		vmovss	0(%r13,%r14), %xmm2
+ 2195      543500
+ 2196 1b78 C5E8541D 		vandps	.LC25(%rip), %xmm2, %xmm3
+ 2196      00000000 
+ 2197 1b80 C5F82FD9 		vcomiss	%xmm1, %xmm3
+ 2198 1b84 C5FA1155 		vmovss	%xmm2, -112(%rbp)
+ 2198      90
+ 2199 1b89 77AD     		ja	.L356
+ 2200 1b8b 85DB     		testl	%ebx, %ebx
+ 2201 1b8d 7449     		je	.L336
+ 2202 1b8f C4C17A58 		vaddss	36(%r15), %xmm0, %xmm0
+ 2202      4724
+ 2203 1b95 83EB01   		subl	$1, %ebx
+ 2204 1b98 C5FA100D 		vmovss	.LC0(%rip), %xmm1
+ 2204      00000000 
+ 2205 1ba0 E8000000 		call	fminf@PLT
+ 2205      00
+ 2206 1ba5 C5FA1055 		vmovss	-112(%rbp), %xmm2
+ 2206      90
+ 2207 1baa EBA8     		jmp	.L335
+ 2208              	.L351:
+ 2209 1bac C5F877   		vzeroupper
+ 2210              	.L314:
+ 2211 1baf 488BBD70 		movq	-144(%rbp), %rdi
+ 2211      FFFFFF
+ 2212 1bb6 4881C488 		addq	$136, %rsp
+ 2212      000000
+ 2213 1bbd 5B       		popq	%rbx
+ 2214 1bbe 415C     		popq	%r12
+ 2215 1bc0 415D     		popq	%r13
+ 2216              		.cfi_remember_state
+ 2217              		.cfi_def_cfa 13, 0
+ 2218 1bc2 415E     		popq	%r14
+ 2219 1bc4 415F     		popq	%r15
+ 2220 1bc6 5D       		popq	%rbp
+ 2221 1bc7 498D65F0 		leaq	-16(%r13), %rsp
+ 2222              		.cfi_def_cfa 7, 16
+ 2223 1bcb 415D     		popq	%r13
+ 2224              		.cfi_def_cfa_offset 8
+ 2225 1bcd E9000000 		jmp	gate_process@PLT
+ 2225      00
+ 2226              		.p2align 4,,10
+ 2227 1bd2 660F1F44 		.p2align 3
+ 2227      0000
+ 2228              	.L336:
+ 2229              		.cfi_restore_state
+ 2230 1bd8 C4C17A5C 		vsubss	40(%r15), %xmm0, %xmm0
+ 2230      4728
+ 2231 1bde C5F057C9 		vxorps	%xmm1, %xmm1, %xmm1
+ 2232 1be2 E8000000 		call	fmaxf@PLT
+ 2232      00
+ 2233 1be7 C5FA1055 		vmovss	-112(%rbp), %xmm2
+ 2233      90
+ 2234 1bec E963FFFF 		jmp	.L335
+ 2234      FF
+ 2235              		.p2align 4,,10
+ 2236 1bf1 0F1F8000 		.p2align 3
+ 2236      000000
+ 2237              	.L337:
+ 2238 1bf8 488B4588 		movq	-120(%rbp), %rax
+ 2239 1bfc 8918     		movl	%ebx, (%rax)
+ 2240 1bfe C5FA1140 		vmovss	%xmm0, -32(%rax)
+ 2240      E0
+ 2241              	.L330:
+ 2242 1c03 31C9     		xorl	%ecx, %ecx
+ 2243 1c05 4983C520 		addq	$32, %r13
+ 2244 1c09 4983C420 		addq	$32, %r12
+ 2245 1c0d 4C396580 		cmpq	%r12, -128(%rbp)
+ 2246 1c11 0F849900 		je	.L339
+ 2246      0000
+ 2247              	.L357:
+ 2248 1c17 488B4588 		movq	-120(%rbp), %rax
+ 2249 1c1b C5FA1040 		vmovss	-32(%rax), %xmm0
+ 2249      E0
+ 2250 1c20 E9BBFEFF 		jmp	.L316
+ 2250      FF
+ 2251              		.p2align 4,,10
+ 2252 1c25 0F1F00   		.p2align 3
+ 2253              	.L320:
+ 2254 1c28 C5F82E05 		vucomiss	.LC0(%rip), %xmm0
+ 2254      00000000 
+ 2255 1c30 0F8AD200 		jp	.L324
+ 2255      0000
+ 2256 1c36 0F85CC00 		jne	.L324
+ 2256      0000
+ 2257 1c3c 3DFF0000 		cmpl	$255, %eax
+ 2257      00
+ 2258 1c41 0F85D900 		jne	.L326
+ 2258      0000
+ 2259 1c47 418B4F20 		movl	32(%r15), %ecx
+ 2260              	.L327:
+ 2261 1c4b F30FBDC0 		lzcntl	%eax, %eax
+ 2262 1c4f 83E818   		subl	$24, %eax
+ 2263 1c52 29C1     		subl	%eax, %ecx
+ 2264              	.L329:
+ 2265 1c54 488B4588 		movq	-120(%rbp), %rax
+ 2266 1c58 8908     		movl	%ecx, (%rax)
+ 2267 1c5a C4C17D6F 		vmovdqa	0(%r13), %ymm6
+ 2267      7500
+ 2268 1c60 C4C17D7F 		vmovdqa	%ymm6, (%r12)
+ 2268      3424
+ 2269 1c66 EB9B     		jmp	.L330
+ 2270 1c68 0F1F8400 		.p2align 4,,10
+ 2270      00000000 
+ 2271              		.p2align 3
+ 2272              	.L323:
+ 2273 1c70 C5C057FF 		vxorps	%xmm7, %xmm7, %xmm7
+ 2274 1c74 C5F82EC7 		vucomiss	%xmm7, %xmm0
+ 2275 1c78 0F8AAFFE 		jp	.L328
+ 2275      FFFF
+ 2276 1c7e 0F85A9FE 		jne	.L328
+ 2276      FFFF
+ 2277 1c84 85DB     		testl	%ebx, %ebx
+ 2278 1c86 0F85A1FE 		jne	.L328
+ 2278      FFFF
+ 2279 1c8c C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 2280 1c90 4983C520 		addq	$32, %r13
+ 2281 1c94 4983C420 		addq	$32, %r12
+ 2282 1c98 C4C17D7F 		vmovdqa	%ymm0, -32(%r12)
+ 2282      4424E0
+ 2283 1c9f 4C396580 		cmpq	%r12, -128(%rbp)
+ 2284 1ca3 0F856EFF 		jne	.L357
+ 2284      FFFF
+ 2285 1ca9 0F1F8000 		.p2align 4,,10
+ 2285      000000
+ 2286              		.p2align 3
+ 2287              	.L339:
+ 2288 1cb0 488B8570 		movq	-144(%rbp), %rax
+ 2288      FFFFFF
+ 2289 1cb7 488BB578 		movq	-136(%rbp), %rsi
+ 2289      FFFFFF
+ 2290 1cbe 488B8090 		movq	144(%rax), %rax
+ 2290      000000
+ 2291 1cc5 880C30   		movb	%cl, (%rax,%rsi)
+ 2292              	.L319:
+ 2293 1cc8 48838578 		addq	$1, -136(%rbp)
+ 2293      FFFFFF01 
+ 2294 1cd0 488B8578 		movq	-136(%rbp), %rax
+ 2294      FFFFFF
+ 2295 1cd7 48834588 		addq	$4, -120(%rbp)
+ 2295      04
+ 2296 1cdc 4883F808 		cmpq	$8, %rax
+ 2297 1ce0 0F859AFD 		jne	.L340
+ 2297      FFFF
+ 2298 1ce6 C5F877   		vzeroupper
+ 2299 1ce9 4881C488 		addq	$136, %rsp
+ 2299      000000
+ 2300 1cf0 5B       		popq	%rbx
+ 2301 1cf1 415C     		popq	%r12
+ 2302 1cf3 415D     		popq	%r13
+ 2303              		.cfi_remember_state
+ 2304              		.cfi_def_cfa 13, 0
+ 2305 1cf5 415E     		popq	%r14
+ 2306 1cf7 415F     		popq	%r15
+ 2307 1cf9 5D       		popq	%rbp
+ 2308 1cfa 498D65F0 		leaq	-16(%r13), %rsp
+ 2309              		.cfi_def_cfa 7, 16
+ 2310 1cfe 415D     		popq	%r13
+ 2311              		.cfi_def_cfa_offset 8
+ 2312 1d00 C3       		ret
+ 2313              		.p2align 4,,10
+ 2314 1d01 0F1F8000 		.p2align 3
+ 2314      000000
+ 2315              	.L324:
+ 2316              		.cfi_restore_state
+ 2317 1d08 488B4588 		movq	-120(%rbp), %rax
+ 2318 1d0c 8B18     		movl	(%rax), %ebx
+ 2319 1d0e E91AFEFF 		jmp	.L328
+ 2319      FF
+ 2320              		.p2align 4,,10
+ 2321 1d13 0F1F4400 		.p2align 3
+ 2321      00
+ 2322              	.L355:
+ 2323 1d18 8D4BF8   		leal	-8(%rbx), %ecx
+ 2324 1d1b E934FFFF 		jmp	.L329
+ 2324      FF
+ 2325              		.p2align 4,,10
+ 2326              		.p2align 3
+ 2327              	.L326:
+ 2328 1d20 488B7588 		movq	-120(%rbp), %rsi
+ 2329 1d24 8B1E     		movl	(%rsi), %ebx
+ 2330 1d26 83FB07   		cmpl	$7, %ebx
+ 2331 1d29 0F86FEFD 		jbe	.L328
+ 2331      FFFF
+ 2332 1d2f 418B4F20 		movl	32(%r15), %ecx
+ 2333 1d33 83F907   		cmpl	$7, %ecx
+ 2334 1d36 0F86F1FD 		jbe	.L328
+ 2334      FFFF
+ 2335 1d3c E90AFFFF 		jmp	.L327
+ 2335      FF
+ 2336              	.L354:
+ 2337 1d41 31C0     		xorl	%eax, %eax
+ 2338 1d43 B9800000 		movl	$128, %ecx
+ 2338      00
+ 2339 1d48 4C89E7   		movq	%r12, %rdi
+ 2340 1d4b 488BB578 		movq	-136(%rbp), %rsi
+ 2340      FFFFFF
+ 2341 1d52 F348AB   		rep stosq
+ 2342 1d55 488B8570 		movq	-144(%rbp), %rax
+ 2342      FFFFFF
+ 2343 1d5c 488B8090 		movq	144(%rax), %rax
+ 2343      000000
+ 2344 1d63 C6043001 		movb	$1, (%rax,%rsi)
+ 2345 1d67 E95CFFFF 		jmp	.L319
+ 2345      FF
+ 2346              		.cfi_endproc
+ 2347              	.LFE6404:
+ 2349              		.section	.rodata.str1.1
+ 2350              	.LC28:
+ 2351 00bb 7400     		.string	"t"
+ 2352              	.LC29:
+ 2353 00bd 6800     		.string	"h"
+ 2354              	.LC30:
+ 2355 00bf 6100     		.string	"a"
+ 2356              	.LC31:
+ 2357 00c1 7200     		.string	"r"
+ 2358              	.LC34:
+ 2359 00c3 25733A20 		.string	"%s: subopts: %s\n"
+ 2359      7375626F 
+ 2359      7074733A 
+ 2359      2025730A 
+ 2359      00
+ 2360              		.section	.rodata.str1.8
+ 2361              		.align 8
+ 2362              	.LC35:
+ 2363 01e8 4D697373 		.string	"Missing value for suboption '%s'\n"
+ 2363      696E6720 
+ 2363      76616C75 
+ 2363      6520666F 
+ 2363      72207375 
+ 2364              		.section	.rodata.str1.1
+ 2365              	.LC38:
+ 2366 00d4 25733A20 		.string	"%s: threshold=%f\n"
+ 2366      74687265 
+ 2366      73686F6C 
+ 2366      643D2566 
+ 2366      0A00
+ 2367              	.LC39:
+ 2368 00e6 25733A20 		.string	"%s: holdtime=%f\n"
+ 2368      686F6C64 
+ 2368      74696D65 
+ 2368      3D25660A 
+ 2368      00
+ 2369              	.LC40:
+ 2370 00f7 25733A20 		.string	"%s: attack=%f\n"
+ 2370      61747461 
+ 2370      636B3D25 
+ 2370      660A00
+ 2371              	.LC41:
+ 2372 0106 25733A20 		.string	"%s: release=%f\n"
+ 2372      72656C65 
+ 2372      6173653D 
+ 2372      25660A00 
+ 2373              		.section	.rodata.str1.8
+ 2374 020a 00000000 		.align 8
+ 2374      0000
+ 2375              	.LC42:
+ 2376 0210 25733A20 		.string	"%s: No match found for token: /%s/\n"
+ 2376      4E6F206D 
+ 2376      61746368 
+ 2376      20666F75 
+ 2376      6E642066 
+ 2377 0234 00000000 		.align 8
+ 2378              	.LC43:
+ 2379 0238 25733A20 		.string	"%s: Missing value for threshold.\n"
+ 2379      4D697373 
+ 2379      696E6720 
+ 2379      76616C75 
+ 2379      6520666F 
+ 2380 025a 00000000 		.align 8
+ 2380      0000
+ 2381              	.LC45:
+ 2382 0260 25733A20 		.string	"%s: Negative hold, attack or release time.\n"
+ 2382      4E656761 
+ 2382      74697665 
+ 2382      20686F6C 
+ 2382      642C2061 
+ 2383              		.text
+ 2384 1d6c 0F1F4000 		.p2align 4
+ 2385              		.globl	create_gate
+ 2387              	create_gate:
+ 2388              	.LFB6410:
+ 2389              		.cfi_startproc
+ 2390 1d70 4C8D5424 		leaq	8(%rsp), %r10
+ 2390      08
+ 2391              		.cfi_def_cfa 10, 0
+ 2392 1d75 4883E4E0 		andq	$-32, %rsp
+ 2393 1d79 488D0D00 		leaq	.LC30(%rip), %rcx
+ 2393      000000
+ 2394 1d80 41FF72F8 		pushq	-8(%r10)
+ 2395 1d84 488D0500 		leaq	.LC31(%rip), %rax
+ 2395      000000
+ 2396 1d8b 55       		pushq	%rbp
+ 2397 1d8c 4889E5   		movq	%rsp, %rbp
+ 2398              		.cfi_escape 0x10,0x6,0x2,0x76,0
+ 2399 1d8f 4157     		pushq	%r15
+ 2400 1d91 4156     		pushq	%r14
+ 2401 1d93 4155     		pushq	%r13
+ 2402              		.cfi_escape 0x10,0xf,0x2,0x76,0x78
+ 2403              		.cfi_escape 0x10,0xe,0x2,0x76,0x70
+ 2404              		.cfi_escape 0x10,0xd,0x2,0x76,0x68
+ 2405 1d95 4C8D2D00 		leaq	__func__.0(%rip), %r13
+ 2405      000000
+ 2406 1d9c 4154     		pushq	%r12
+ 2407 1d9e 4152     		pushq	%r10
+ 2408              		.cfi_escape 0xf,0x3,0x76,0x58,0x6
+ 2409              		.cfi_escape 0x10,0xc,0x2,0x76,0x60
+ 2410 1da0 53       		pushq	%rbx
+ 2411              		.cfi_escape 0x10,0x3,0x2,0x76,0x50
+ 2412 1da1 4889F3   		movq	%rsi, %rbx
+ 2413 1da4 4881ECA0 		subq	$160, %rsp
+ 2413      000000
+ 2414 1dab 4889BD78 		movq	%rdi, -136(%rbp)
+ 2414      FFFFFF
+ 2415 1db2 C5FA7E25 		vmovq	destroy_gate@GOTPCREL(%rip), %xmm4
+ 2415      00000000 
+ 2416 1dba BF700000 		movl	$112, %edi
+ 2416      00
+ 2417 1dbf C4E3D922 		vpinsrq	$1, clone_gate@GOTPCREL(%rip), %xmm4, %xmm0
+ 2417      05000000 
+ 2417      0001
+ 2418 1dc9 48C745B0 		movq	$0, -80(%rbp)
+ 2418      00000000 
+ 2419 1dd1 C5FA7E2D 		vmovq	gate_process@GOTPCREL(%rip), %xmm5
+ 2419      00000000 
+ 2420 1dd9 C4E3D122 		vpinsrq	$1, gate_init@GOTPCREL(%rip), %xmm5, %xmm1
+ 2420      0D000000 
+ 2420      0001
+ 2421 1de3 C5FA7E1D 		vmovq	gate_preroll@GOTPCREL(%rip), %xmm3
+ 2421      00000000 
+ 2422 1deb C4E3E122 		vpinsrq	$1, gate_codegen@GOTPCREL(%rip), %xmm3, %xmm2
+ 2422      15000000 
+ 2422      0001
+ 2423 1df5 C4E37538 		vinserti128	$0x1, %xmm0, %ymm1, %ymm6
+ 2423      F001
+ 2424 1dfb C4E1F96E 		vmovq	%rcx, %xmm1
+ 2424      C9
+ 2425 1e00 488D0D00 		leaq	.LC28(%rip), %rcx
+ 2425      000000
+ 2426 1e07 C4E3F122 		vpinsrq	$1, %rax, %xmm1, %xmm1
+ 2426      C801
+ 2427 1e0d C4E1F96E 		vmovq	%rcx, %xmm0
+ 2427      C1
+ 2428 1e12 488D0500 		leaq	.LC29(%rip), %rax
+ 2428      000000
+ 2429 1e19 C5F97F95 		vmovdqa	%xmm2, -192(%rbp)
+ 2429      40FFFFFF 
+ 2430 1e21 C5FD7FB5 		vmovdqa	%ymm6, -176(%rbp)
+ 2430      50FFFFFF 
+ 2431 1e29 C4E3F922 		vpinsrq	$1, %rax, %xmm0, %xmm0
+ 2431      C001
+ 2432 1e2f C4E37D38 		vinserti128	$0x1, %xmm1, %ymm0, %ymm0
+ 2432      C101
+ 2433 1e35 C5FD7F45 		vmovdqa	%ymm0, -112(%rbp)
+ 2433      90
+ 2434 1e3a C5F877   		vzeroupper
+ 2435 1e3d E8000000 		call	malloc@PLT
+ 2435      00
+ 2436 1e42 4C89EA   		movq	%r13, %rdx
+ 2437 1e45 C5F92805 		vmovapd	.LC32(%rip), %xmm0
+ 2437      00000000 
+ 2438 1e4d 4989C4   		movq	%rax, %r12
+ 2439 1e50 488B8578 		movq	-136(%rbp), %rax
+ 2439      FFFFFF
+ 2440 1e57 488D3500 		leaq	.LC34(%rip), %rsi
+ 2440      000000
+ 2441 1e5e BF010000 		movl	$1, %edi
+ 2441      00
+ 2442 1e63 41C70424 		movl	$0x00000000, (%r12)
+ 2442      00000000 
+ 2443 1e6b 4C89A0C0 		movq	%r12, 192(%rax)
+ 2443      000000
+ 2444 1e72 488B0500 		movq	.LC33(%rip), %rax
+ 2444      000000
+ 2445 1e79 488B0B   		movq	(%rbx), %rcx
+ 2446 1e7c C4C17911 		vmovupd	%xmm0, 8(%r12)
+ 2446      442408
+ 2447 1e83 49894424 		movq	%rax, 24(%r12)
+ 2447      18
+ 2448 1e88 31C0     		xorl	%eax, %eax
+ 2449 1e8a E8000000 		call	debugprint@PLT
+ 2449      00
+ 2450 1e8f 488B03   		movq	(%rbx), %rax
+ 2451 1e92 803800   		cmpb	$0, (%rax)
+ 2452 1e95 746F     		je	.L359
+ 2453 1e97 4C8D7D88 		leaq	-120(%rbp), %r15
+ 2454 1e9b 4C8D7590 		leaq	-112(%rbp), %r14
+ 2455 1e9f 90       		.p2align 4,,10
+ 2456              		.p2align 3
+ 2457              	.L373:
+ 2458 1ea0 4C89FA   		movq	%r15, %rdx
+ 2459 1ea3 4C89F6   		movq	%r14, %rsi
+ 2460 1ea6 4889DF   		movq	%rbx, %rdi
+ 2461 1ea9 E8000000 		call	getsubopt@PLT
+ 2461      00
+ 2462 1eae 83F802   		cmpl	$2, %eax
+ 2463 1eb1 0F849900 		je	.L360
+ 2463      0000
+ 2464 1eb7 7F57     		jg	.L361
+ 2465 1eb9 85C0     		testl	%eax, %eax
+ 2466 1ebb 0F848701 		je	.L362
+ 2466      0000
+ 2467 1ec1 83F801   		cmpl	$1, %eax
+ 2468 1ec4 0F85C600 		jne	.L364
+ 2468      0000
+ 2469 1eca 488B7D88 		movq	-120(%rbp), %rdi
+ 2470 1ece 4885FF   		testq	%rdi, %rdi
+ 2471 1ed1 0F844902 		je	.L382
+ 2471      0000
+ 2472 1ed7 31F6     		xorl	%esi, %esi
+ 2473 1ed9 E8000000 		call	strtod@PLT
+ 2473      00
+ 2474 1ede 4C89EA   		movq	%r13, %rdx
+ 2475 1ee1 BF010000 		movl	$1, %edi
+ 2475      00
+ 2476 1ee6 488D3500 		leaq	.LC39(%rip), %rsi
+ 2476      000000
+ 2477 1eed C4C17B11 		vmovsd	%xmm0, 8(%r12)
+ 2477      442408
+ 2478 1ef4 B8010000 		movl	$1, %eax
+ 2478      00
+ 2479 1ef9 E8000000 		call	debugprint@PLT
+ 2479      00
+ 2480              	.L368:
+ 2481 1efe 488B03   		movq	(%rbx), %rax
+ 2482 1f01 803800   		cmpb	$0, (%rax)
+ 2483 1f04 759A     		jne	.L373
+ 2484              	.L359:
+ 2485 1f06 31C0     		xorl	%eax, %eax
+ 2486 1f08 E99F0000 		jmp	.L372
+ 2486      00
+ 2487 1f0d 0F1F00   		.p2align 4,,10
+ 2488              		.p2align 3
+ 2489              	.L361:
+ 2490 1f10 83F803   		cmpl	$3, %eax
+ 2491 1f13 757B     		jne	.L364
+ 2492 1f15 488B7D88 		movq	-120(%rbp), %rdi
+ 2493 1f19 4885FF   		testq	%rdi, %rdi
+ 2494 1f1c 0F84DE01 		je	.L383
+ 2494      0000
+ 2495 1f22 31F6     		xorl	%esi, %esi
+ 2496 1f24 E8000000 		call	strtod@PLT
+ 2496      00
+ 2497 1f29 4C89EA   		movq	%r13, %rdx
+ 2498 1f2c BF010000 		movl	$1, %edi
+ 2498      00
+ 2499 1f31 488D3500 		leaq	.LC41(%rip), %rsi
+ 2499      000000
+ 2500 1f38 C4C17B11 		vmovsd	%xmm0, 24(%r12)
+ 2500      442418
+ 2501 1f3f B8010000 		movl	$1, %eax
+ 2501      00
+ 2502 1f44 E8000000 		call	debugprint@PLT
+ 2502      00
+ 2503 1f49 EBB3     		jmp	.L368
+ 2504 1f4b 0F1F4400 		.p2align 4,,10
+ 2504      00
+ 2505              		.p2align 3
+ 2506              	.L360:
+ 2507 1f50 488B7D88 		movq	-120(%rbp), %rdi
+ 2508 1f54 4885FF   		testq	%rdi, %rdi
+ 2509 1f57 0F848301 		je	.L384
+ 2509      0000
+ 2510 1f5d 31F6     		xorl	%esi, %esi
+ 2511 1f5f E8000000 		call	strtod@PLT
+ 2511      00
+ 2512 1f64 4C89EA   		movq	%r13, %rdx
+ 2513 1f67 BF010000 		movl	$1, %edi
+ 2513      00
+ 2514 1f6c 488D3500 		leaq	.LC40(%rip), %rsi
+ 2514      000000
+ 2515 1f73 C4C17B11 		vmovsd	%xmm0, 16(%r12)
+ 2515      442410
+ 2516 1f7a B8010000 		movl	$1, %eax
+ 2516      00
+ 2517 1f7f E8000000 		call	debugprint@PLT
+ 2517      00
+ 2518 1f84 E975FFFF 		jmp	.L368
+ 2518      FF
+ 2519 1f89 0F1F8000 		.p2align 4,,10
+ 2519      000000
+ 2520              		.p2align 3
+ 2521              	.L364:
+ 2522 1f90 488B4D88 		movq	-120(%rbp), %rcx
+ 2523 1f94 4C89EA   		movq	%r13, %rdx
+ 2524 1f97 488D3500 		leaq	.LC42(%rip), %rsi
+ 2524      000000
+ 2525 1f9e 31FF     		xorl	%edi, %edi
+ 2526 1fa0 31C0     		xorl	%eax, %eax
+ 2527 1fa2 E8000000 		call	debugprint@PLT
+ 2527      00
+ 2528              	.L367:
+ 2529 1fa7 B8010000 		movl	$1, %eax
+ 2529      00
+ 2530              	.L372:
+ 2531 1fac C5F857C0 		vxorps	%xmm0, %xmm0, %xmm0
+ 2532 1fb0 C4C1782E 		vucomiss	(%r12), %xmm0
+ 2532      0424
+ 2533 1fb6 7A06     		jp	.L374
+ 2534 1fb8 0F84E200 		je	.L385
+ 2534      0000
+ 2535              	.L374:
+ 2536 1fbe C5F957C0 		vxorpd	%xmm0, %xmm0, %xmm0
+ 2537 1fc2 C4C1792F 		vcomisd	8(%r12), %xmm0
+ 2537      442408
+ 2538 1fc9 7712     		ja	.L376
+ 2539 1fcb C4C1792F 		vcomisd	16(%r12), %xmm0
+ 2539      442410
+ 2540 1fd2 7709     		ja	.L376
+ 2541 1fd4 C4C1792F 		vcomisd	24(%r12), %xmm0
+ 2541      442418
+ 2542 1fdb 7618     		jbe	.L377
+ 2543              	.L376:
+ 2544 1fdd 31C0     		xorl	%eax, %eax
+ 2545 1fdf 4C89EA   		movq	%r13, %rdx
+ 2546 1fe2 488D3500 		leaq	.LC45(%rip), %rsi
+ 2546      000000
+ 2547 1fe9 31FF     		xorl	%edi, %edi
+ 2548 1feb E8000000 		call	debugprint@PLT
+ 2548      00
+ 2549 1ff0 B8010000 		movl	$1, %eax
+ 2549      00
+ 2550              	.L377:
+ 2551 1ff5 488B8D78 		movq	-136(%rbp), %rcx
+ 2551      FFFFFF
+ 2552 1ffc 488D1D00 		leaq	gate_process_kernels(%rip), %rbx
+ 2552      000000
+ 2553 2003 C5FD6FBD 		vmovdqa	-176(%rbp), %ymm7
+ 2553      50FFFFFF 
+ 2554 200b C5F96F95 		vmovdqa	-192(%rbp), %xmm2
+ 2554      40FFFFFF 
+ 2555 2013 488999C8 		movq	%rbx, 200(%rcx)
+ 2555      000000
+ 2556 201a C5FE7FB9 		vmovdqu	%ymm7, 208(%rcx)
+ 2556      D0000000 
+ 2557 2022 C5FA7F91 		vmovdqu	%xmm2, 240(%rcx)
+ 2557      F0000000 
+ 2558 202a C5F877   		vzeroupper
+ 2559 202d 4881C4A0 		addq	$160, %rsp
+ 2559      000000
+ 2560 2034 5B       		popq	%rbx
+ 2561 2035 415A     		popq	%r10
+ 2562              		.cfi_remember_state
+ 2563              		.cfi_def_cfa 10, 0
+ 2564 2037 415C     		popq	%r12
+ 2565 2039 415D     		popq	%r13
+ 2566 203b 415E     		popq	%r14
+ 2567 203d 415F     		popq	%r15
+ 2568 203f 5D       		popq	%rbp
+ 2569 2040 498D62F8 		leaq	-8(%r10), %rsp
+ 2570              		.cfi_def_cfa 7, 8
+ 2571 2044 C3       		ret
+ 2572              		.p2align 4,,10
+ 2573 2045 0F1F00   		.p2align 3
+ 2574              	.L362:
+ 2575              		.cfi_restore_state
+ 2576 2048 488B7D88 		movq	-120(%rbp), %rdi
+ 2577 204c 4885FF   		testq	%rdi, %rdi
+ 2578 204f 746F     		je	.L386
+ 2579 2051 31F6     		xorl	%esi, %esi
+ 2580 2053 E8000000 		call	strtod@PLT
+ 2580      00
+ 2581 2058 C5FB5E0D 		vdivsd	.LC36(%rip), %xmm0, %xmm1
+ 2581      00000000 
+ 2582 2060 C5FA1005 		vmovss	.LC37(%rip), %xmm0
+ 2582      00000000 
+ 2583 2068 C5F35AC9 		vcvtsd2ss	%xmm1, %xmm1, %xmm1
+ 2584 206c E8000000 		call	powf@PLT
+ 2584      00
+ 2585 2071 488B7D88 		movq	-120(%rbp), %rdi
+ 2586 2075 31F6     		xorl	%esi, %esi
+ 2587 2077 C4C17A11 		vmovss	%xmm0, (%r12)
+ 2587      0424
+ 2588 207d E8000000 		call	strtod@PLT
+ 2588      00
+ 2589 2082 4C89EA   		movq	%r13, %rdx
+ 2590 2085 BF010000 		movl	$1, %edi
+ 2590      00
+ 2591 208a 488D3500 		leaq	.LC38(%rip), %rsi
+ 2591      000000
+ 2592 2091 B8010000 		movl	$1, %eax
+ 2592      00
+ 2593 2096 E8000000 		call	debugprint@PLT
+ 2593      00
+ 2594 209b E95EFEFF 		jmp	.L368
+ 2594      FF
+ 2595              		.p2align 4,,10
+ 2596              		.p2align 3
+ 2597              	.L385:
+ 2598 20a0 31C0     		xorl	%eax, %eax
+ 2599 20a2 4C89EA   		movq	%r13, %rdx
+ 2600 20a5 488D3500 		leaq	.LC43(%rip), %rsi
+ 2600      000000
+ 2601 20ac 31FF     		xorl	%edi, %edi
+ 2602 20ae E8000000 		call	debugprint@PLT
+ 2602      00
+ 2603 20b3 B8010000 		movl	$1, %eax
+ 2603      00
+ 2604 20b8 E901FFFF 		jmp	.L374
+ 2604      FF
+ 2605 20bd 0F1F00   		.p2align 4,,10
+ 2606              		.p2align 3
+ 2607              	.L386:
+ 2608 20c0 488B5590 		movq	-112(%rbp), %rdx
+ 2609 20c4 488D3500 		leaq	.LC35(%rip), %rsi
+ 2609      000000
+ 2610 20cb 31C0     		xorl	%eax, %eax
+ 2611 20cd E8000000 		call	debugprint@PLT
+ 2611      00
+ 2612 20d2 E9D0FEFF 		jmp	.L367
+ 2612      FF
+ 2613 20d7 660F1F84 		.p2align 4,,10
+ 2613      00000000 
+ 2613      00
+ 2614              		.p2align 3
+ 2615              	.L384:
+ 2616 20e0 488B55A0 		movq	-96(%rbp), %rdx
+ 2617 20e4 488D3500 		leaq	.LC35(%rip), %rsi
+ 2617      000000
+ 2618 20eb 31C0     		xorl	%eax, %eax
+ 2619 20ed E8000000 		call	debugprint@PLT
+ 2619      00
+ 2620 20f2 E9B0FEFF 		jmp	.L367
+ 2620      FF
+ 2621 20f7 660F1F84 		.p2align 4,,10
+ 2621      00000000 
+ 2621      00
+ 2622              		.p2align 3
+ 2623              	.L383:
+ 2624 2100 488B55A8 		movq	-88(%rbp), %rdx
+ 2625 2104 488D3500 		leaq	.LC35(%rip), %rsi
+ 2625      000000
+ 2626 210b 31C0     		xorl	%eax, %eax
+ 2627 210d E8000000 		call	debugprint@PLT
+ 2627      00
+ 2628 2112 E990FEFF 		jmp	.L367
+ 2628      FF
+ 2629 2117 660F1F84 		.p2align 4,,10
+ 2629      00000000 
+ 2629      00
+ 2630              		.p2align 3
+ 2631              	.L382:
+ 2632 2120 488B5598 		movq	-104(%rbp), %rdx
+ 2633 2124 488D3500 		leaq	.LC35(%rip), %rsi
+ 2633      000000
+ 2634 212b 31C0     		xorl	%eax, %eax
+ 2635 212d E8000000 		call	debugprint@PLT
+ 2635      00
+ 2636 2132 E970FEFF 		jmp	.L367
+ 2636      FF
+ 2637              		.cfi_endproc
+ 2638              	.LFE6410:
+ 2640              		.section	.rodata.str1.1
+ 2641              	.LC46:
+ 2642 0116 20204761 		.string	"  Gate options\n"
+ 2642      7465206F 
+ 2642      7074696F 
+ 2642      6E730A00 
+ 2643              		.section	.rodata.str1.8
+ 2644 028c 00000000 		.align 8
+ 2645              	.LC47:
+ 2646 0290 20202020 		.string	"    Name: gate\n    t=threshold (dBFS)\n    h=holdtime (sec)\n"
+ 2646      4E616D65 
+ 2646      3A206761 
+ 2646      74650A20 
+ 2646      20202074 
+ 2647 02cc 00000000 		.align 8
+ 2648              	.LC49:
+ 2649 02d0 20202020 		.string	"    a=attack, opening ramp (sec, default %g)\n"
+ 2649      613D6174 
+ 2649      7461636B 
+ 2649      2C206F70 
+ 2649      656E696E 
+ 2650 02fe 0000     		.align 8
+ 2651              	.LC50:
+ 2652 0300 20202020 		.string	"    r=release, closing ramp (sec, default %g)\n"
+ 2652      723D7265 
+ 2652      6C656173 
+ 2652      652C2063 
+ 2652      6C6F7369 
+ 2653 032f 00       		.align 8
+ 2654              	.LC51:
+ 2655 0330 20202020 		.string	"    Example: -p gate,t=-80,h=0.5,a=0.002,r=0.05\n"
+ 2655      4578616D 
+ 2655      706C653A 
+ 2655      202D7020 
+ 2655      67617465 
+ 2656              		.text
+ 2657 2137 660F1F84 		.p2align 4
+ 2657      00000000 
+ 2657      00
+ 2658              		.globl	help_gate
+ 2660              	help_gate:
+ 2661              	.LFB6411:
+ 2662              		.cfi_startproc
+ 2663 2140 4883EC08 		subq	$8, %rsp
+ 2664              		.cfi_def_cfa_offset 16
+ 2665 2144 488D3500 		leaq	.LC46(%rip), %rsi
+ 2665      000000
+ 2666 214b 31FF     		xorl	%edi, %edi
+ 2667 214d 31C0     		xorl	%eax, %eax
+ 2668 214f E8000000 		call	debugprint@PLT
+ 2668      00
+ 2669 2154 488D3500 		leaq	.LC47(%rip), %rsi
+ 2669      000000
+ 2670 215b 31FF     		xorl	%edi, %edi
+ 2671 215d 31C0     		xorl	%eax, %eax
+ 2672 215f E8000000 		call	debugprint@PLT
+ 2672      00
+ 2673 2164 488D3500 		leaq	.LC49(%rip), %rsi
+ 2673      000000
+ 2674 216b 31FF     		xorl	%edi, %edi
+ 2675 216d C5FB1005 		vmovsd	.LC48(%rip), %xmm0
+ 2675      00000000 
+ 2676 2175 B8010000 		movl	$1, %eax
+ 2676      00
+ 2677 217a E8000000 		call	debugprint@PLT
+ 2677      00
+ 2678 217f 488D3500 		leaq	.LC50(%rip), %rsi
+ 2678      000000
+ 2679 2186 31FF     		xorl	%edi, %edi
+ 2680 2188 C5FB1005 		vmovsd	.LC33(%rip), %xmm0
+ 2680      00000000 
+ 2681 2190 B8010000 		movl	$1, %eax
+ 2681      00
+ 2682 2195 E8000000 		call	debugprint@PLT
+ 2682      00
+ 2683 219a 488D3500 		leaq	.LC51(%rip), %rsi
+ 2683      000000
+ 2684 21a1 31FF     		xorl	%edi, %edi
+ 2685 21a3 31C0     		xorl	%eax, %eax
+ 2686 21a5 4883C408 		addq	$8, %rsp
+ 2687              		.cfi_def_cfa_offset 8
+ 2688 21a9 E9000000 		jmp	debugprint@PLT
+ 2688      00
+ 2689              		.cfi_endproc
+ 2690              	.LFE6411:
+ 2692              		.section	.rodata
+ 2693 0014 00000000 		.align 8
+ 2696              	__func__.0:
+ 2697 0018 63726561 		.string	"create_gate"
+ 2697      74655F67 
+ 2697      61746500 
+ 2698              		.section	.data.rel.ro,"aw"
+ 2699              		.align 32
+ 2702              	gate_process_kernels:
+ 2703 0000 02000000 		.long	2
+ 2704 0004 40000000 		.long	64
+ 2705 0008 00000000 		.quad	gate_process_2_64
+ 2705      00000000 
+ 2706 0010 02000000 		.long	2
+ 2707 0014 80000000 		.long	128
+ 2708 0018 00000000 		.quad	gate_process_2_128
+ 2708      00000000 
+ 2709 0020 02000000 		.long	2
+ 2710 0024 00010000 		.long	256
+ 2711 0028 00000000 		.quad	gate_process_2_256
+ 2711      00000000 
+ 2712 0030 08000000 		.long	8
+ 2713 0034 40000000 		.long	64
+ 2714 0038 00000000 		.quad	gate_process_8_64
+ 2714      00000000 
+ 2715 0040 08000000 		.long	8
+ 2716 0044 80000000 		.long	128
+ 2717 0048 00000000 		.quad	gate_process_8_128
+ 2717      00000000 
+ 2718 0050 08000000 		.long	8
+ 2719 0054 00010000 		.long	256
+ 2720 0058 00000000 		.quad	gate_process_8_256
+ 2720      00000000 
+ 2721 0060 00000000 		.long	0
+ 2722 0064 00000000 		.long	0
+ 2723 0068 00000000 		.quad	gate_process
+ 2723      00000000 
+ 2724              		.section	.rodata.cst4,"aM",@progbits,4
+ 2725              		.align 4
+ 2726              	.LC0:
+ 2727 0000 0000803F 		.long	1065353216
+ 2728              		.section	.rodata.cst8,"aM",@progbits,8
+ 2729              		.align 8
+ 2730              	.LC1:
+ 2731 0000 00000000 		.long	0
+ 2732 0004 0000F03F 		.long	1072693248
+ 2733              		.section	.rodata.cst4
+ 2734              		.align 4
+ 2735              	.LC24:
+ 2736 0004 00000080 		.long	-2147483648
+ 2737              		.section	.rodata.cst16,"aM",@progbits,16
+ 2738              		.align 16
+ 2739              	.LC25:
+ 2740 0000 FFFFFF7F 		.long	2147483647
+ 2741 0004 00000000 		.long	0
+ 2742 0008 00000000 		.long	0
+ 2743 000c 00000000 		.long	0
+ 2744              		.align 16
+ 2745              	.LC32:
+ 2746 0010 00000000 		.long	0
+ 2747 0014 00000000 		.long	0
+ 2748 0018 FCA9F1D2 		.long	-755914244
+ 2749 001c 4D62503F 		.long	1062232653
+ 2750              		.section	.rodata.cst8
+ 2751              		.align 8
+ 2752              	.LC33:
+ 2753 0008 7B14AE47 		.long	1202590843
+ 2754 000c E17A843F 		.long	1065646817
+ 2755              		.align 8
+ 2756              	.LC36:
+ 2757 0010 00000000 		.long	0
+ 2758 0014 00003440 		.long	1077149696
+ 2759              		.section	.rodata.cst4
+ 2760              		.align 4
+ 2761              	.LC37:
+ 2762 0008 00002041 		.long	1092616192
+ 2763              		.set	.LC48,.LC32+8
+ 2764              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 2765              		.section	.note.GNU-stack,"",@progbits
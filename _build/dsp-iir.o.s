@@ -0,0 +1,4518 @@
+   1              		.file	"dsp-iir.c"
+   2              		.text
+   3              		.p2align 4
+   4              		.globl	iir_process
+   6              	iir_process:
+   7              	.LFB18:
+   8              		.cfi_startproc
+   9 0000 55       		pushq	%rbp
+  10              		.cfi_def_cfa_offset 16
+  11              		.cfi_offset 6, -16
+  12 0001 4889E5   		movq	%rsp, %rbp
+  13              		.cfi_def_cfa_register 6
+  14 0004 4157     		pushq	%r15
+  15 0006 4156     		pushq	%r14
+  16 0008 4155     		pushq	%r13
+  17 000a 4154     		pushq	%r12
+  18 000c 53       		pushq	%rbx
+  19              		.cfi_offset 15, -24
+  20              		.cfi_offset 14, -32
+  21              		.cfi_offset 13, -40
+  22              		.cfi_offset 12, -48
+  23              		.cfi_offset 3, -56
+  24 000d 4889FB   		movq	%rdi, %rbx
+  25 0010 4883E4E0 		andq	$-32, %rsp
+  26 0014 4881EC40 		subq	$320, %rsp
+  26      010000
+  27 001b 448B879C 		movl	156(%rdi), %r8d
+  27      000000
+  28 0022 448BAFA4 		movl	164(%rdi), %r13d
+  28      000000
+  29 0029 488BBFC0 		movq	192(%rdi), %rdi
+  29      000000
+  30 0030 4585C0   		testl	%r8d, %r8d
+  31 0033 0F8EEF01 		jle	.L39
+  31      0000
+  32 0039 4C8B9B88 		movq	136(%rbx), %r11
+  32      000000
+  33 0040 4963F0   		movslq	%r8d, %rsi
+  34 0043 31C9     		xorl	%ecx, %ecx
+  35 0045 4531E4   		xorl	%r12d, %r12d
+  36 0048 488B9390 		movq	144(%rbx), %rdx
+  36      000000
+  37 004f 4531F6   		xorl	%r14d, %r14d
+  38 0052 C5D957E4 		vxorpd	%xmm4, %xmm4, %xmm4
+  39 0056 C5FA7E15 		vmovq	.LC0(%rip), %xmm2
+  39      00000000 
+  40 005e C5FB101D 		vmovsd	.LC1(%rip), %xmm3
+  40      00000000 
+  41 0066 41B90100 		movl	$1, %r9d
+  41      0000
+  42 006c EB05     		jmp	.L6
+  43 006e 6690     		.p2align 4,,10
+  44              		.p2align 3
+  45              	.L27:
+  46 0070 4989C4   		movq	%rax, %r12
+  47              	.L6:
+  48 0073 43803C23 		cmpb	$0, (%r11,%r12)
+  48      00
+  49 0078 4489E0   		movl	%r12d, %eax
+  50 007b 743D     		je	.L4
+  51 007d 448D5101 		leal	1(%rcx), %r10d
+  52 0081 4D63D2   		movslq	%r10d, %r10
+  53 0084 C4A17B10 		vmovsd	96(%rdi,%r10,8), %xmm0
+  53      44D760
+  54 008b 4C63D1   		movslq	%ecx, %r10
+  55 008e 4983C208 		addq	$8, %r10
+  56 0092 C4A17B10 		vmovsd	32(%rdi,%r10,8), %xmm1
+  56      4CD720
+  57 0099 C5F954C2 		vandpd	%xmm2, %xmm0, %xmm0
+  58 009d C5F154CA 		vandpd	%xmm2, %xmm1, %xmm1
+  59 00a1 C5FB58C1 		vaddsd	%xmm1, %xmm0, %xmm0
+  60 00a5 C5F92FD8 		vcomisd	%xmm0, %xmm3
+  61 00a9 760F     		jbe	.L4
+  62 00ab C4A17929 		vmovapd	%xmm4, 32(%rdi,%r10,8)
+  62      64D720
+  63 00b2 C44219F7 		shlx	%r12d, %r9d, %r10d
+  63      D1
+  64 00b7 4509D6   		orl	%r10d, %r14d
+  65              	.L4:
+  66 00ba C4C27BF7 		shrx	%eax, %r14d, %eax
+  66      C6
+  67 00bf 42880422 		movb	%al, (%rdx,%r12)
+  68 00c3 498D4424 		leaq	1(%r12), %rax
+  68      01
+  69 00c8 83C102   		addl	$2, %ecx
+  70 00cb 42802422 		andb	$1, (%rdx,%r12)
+  70      01
+  71 00d0 4839C6   		cmpq	%rax, %rsi
+  72 00d3 759B     		jne	.L27
+  73 00d5 B8010000 		movl	$1, %eax
+  73      00
+  74 00da C4E239F7 		shlx	%r8d, %eax, %eax
+  74      C0
+  75 00df 83E801   		subl	$1, %eax
+  76 00e2 4439F0   		cmpl	%r14d, %eax
+  77 00e5 0F84F703 		je	.L42
+  77      0000
+  78 00eb C5FB106F 		vmovsd	64(%rdi), %xmm5
+  78      40
+  79 00f0 C5FB1077 		vmovsd	72(%rdi), %xmm6
+  79      48
+  80 00f5 C5FB107F 		vmovsd	80(%rdi), %xmm7
+  80      50
+  81 00fa C57B1047 		vmovsd	48(%rdi), %xmm8
+  81      30
+  82 00ff C57B104F 		vmovsd	56(%rdi), %xmm9
+  82      38
+  83 0104 4183F802 		cmpl	$2, %r8d
+  84 0108 0F840203 		je	.L10
+  84      0000
+  85 010e C5E057DB 		vxorps	%xmm3, %xmm3, %xmm3
+  86 0112 4183F808 		cmpl	$8, %r8d
+  87 0116 0F842401 		je	.L11
+  87      0000
+  88 011c 31C9     		xorl	%ecx, %ecx
+  89 011e 4963D5   		movslq	%r13d, %rdx
+  90 0121 4C8D7F60 		leaq	96(%rdi), %r15
+  91 0125 48C1E202 		salq	$2, %rdx
+  92 0129 410FA3CE 		btl	%ecx, %r14d
+  93 012d 488B74CB 		movq	8(%rbx,%rcx,8), %rsi
+  93      08
+  94 0132 488B7CCB 		movq	72(%rbx,%rcx,8), %rdi
+  94      48
+  95 0137 0F828300 		jc	.L43
+  95      0000
+  96 013d 0F1F00   		.p2align 4,,10
+  97              		.p2align 3
+  98              	.L22:
+  99 0140 C4C17B10 		vmovsd	(%r15), %xmm2
+  99      17
+ 100 0145 C4C17B10 		vmovsd	8(%r15), %xmm4
+ 100      6708
+ 101 014b 4585ED   		testl	%r13d, %r13d
+ 102 014e 7E45     		jle	.L24
+ 103 0150 31C0     		xorl	%eax, %eax
+ 104              		.p2align 4,,10
+ 105 0152 660F1F44 		.p2align 3
+ 105      0000
+ 106              	.L25:
+ 107 0158 C5E25A0C 		vcvtss2sd	(%rsi,%rax), %xmm3, %xmm1
+ 107      06
+ 108 015d C5F359C5 		vmulsd	%xmm5, %xmm1, %xmm0
+ 109 0161 C5FB58C2 		vaddsd	%xmm2, %xmm0, %xmm0
+ 110 0165 C5F359D6 		vmulsd	%xmm6, %xmm1, %xmm2
+ 111 0169 C5F359CF 		vmulsd	%xmm7, %xmm1, %xmm1
+ 112 016d C5EB58D4 		vaddsd	%xmm4, %xmm2, %xmm2
+ 113 0171 C4C17B59 		vmulsd	%xmm8, %xmm0, %xmm4
+ 113      E0
+ 114 0176 C5EB5CD4 		vsubsd	%xmm4, %xmm2, %xmm2
+ 115 017a C4C17B59 		vmulsd	%xmm9, %xmm0, %xmm4
+ 115      E1
+ 116 017f C5FB5AC0 		vcvtsd2ss	%xmm0, %xmm0, %xmm0
+ 117 0183 C5FA1104 		vmovss	%xmm0, (%rdi,%rax)
+ 117      07
+ 118 0188 4883C004 		addq	$4, %rax
+ 119 018c C5F35CE4 		vsubsd	%xmm4, %xmm1, %xmm4
+ 120 0190 4839C2   		cmpq	%rax, %rdx
+ 121 0193 75C3     		jne	.L25
+ 122              	.L24:
+ 123 0195 C4C17B11 		vmovsd	%xmm2, (%r15)
+ 123      17
+ 124 019a 488D4101 		leaq	1(%rcx), %rax
+ 125 019e 4983C710 		addq	$16, %r15
+ 126 01a2 C4C17B11 		vmovsd	%xmm4, -8(%r15)
+ 126      67F8
+ 127 01a8 4939CC   		cmpq	%rcx, %r12
+ 128 01ab 747B     		je	.L39
+ 129              	.L29:
+ 130 01ad 4889C1   		movq	%rax, %rcx
+ 131 01b0 410FA3CE 		btl	%ecx, %r14d
+ 132 01b4 488B74CB 		movq	8(%rbx,%rcx,8), %rsi
+ 132      08
+ 133 01b9 488B7CCB 		movq	72(%rbx,%rcx,8), %rdi
+ 133      48
+ 134 01be 7380     		jnc	.L22
+ 135              	.L43:
+ 136 01c0 31F6     		xorl	%esi, %esi
+ 137 01c2 48894C24 		movq	%rcx, 48(%rsp)
+ 137      30
+ 138 01c7 4983C710 		addq	$16, %r15
+ 139 01cb 48895424 		movq	%rdx, 56(%rsp)
+ 139      38
+ 140 01d0 C57B114C 		vmovsd	%xmm9, 8(%rsp)
+ 140      2408
+ 141 01d6 C57B1144 		vmovsd	%xmm8, 16(%rsp)
+ 141      2410
+ 142 01dc C5FB117C 		vmovsd	%xmm7, 24(%rsp)
+ 142      2418
+ 143 01e2 C5FB1174 		vmovsd	%xmm6, 32(%rsp)
+ 143      2420
+ 144 01e8 C5FB116C 		vmovsd	%xmm5, 40(%rsp)
+ 144      2428
+ 145 01ee E8000000 		call	memset@PLT
+ 145      00
+ 146 01f3 488B4C24 		movq	48(%rsp), %rcx
+ 146      30
+ 147 01f8 488B5424 		movq	56(%rsp), %rdx
+ 147      38
+ 148 01fd C5E057DB 		vxorps	%xmm3, %xmm3, %xmm3
+ 149 0201 C5FB106C 		vmovsd	40(%rsp), %xmm5
+ 149      2428
+ 150 0207 C5FB1074 		vmovsd	32(%rsp), %xmm6
+ 150      2420
+ 151 020d C5FB107C 		vmovsd	24(%rsp), %xmm7
+ 151      2418
+ 152 0213 C57B1044 		vmovsd	16(%rsp), %xmm8
+ 152      2410
+ 153 0219 488D4101 		leaq	1(%rcx), %rax
+ 154 021d C57B104C 		vmovsd	8(%rsp), %xmm9
+ 154      2408
+ 155 0223 4939CC   		cmpq	%rcx, %r12
+ 156 0226 7585     		jne	.L29
+ 157              	.L39:
+ 158 0228 488D65D8 		leaq	-40(%rbp), %rsp
+ 159 022c 5B       		popq	%rbx
+ 160 022d 415C     		popq	%r12
+ 161 022f 415D     		popq	%r13
+ 162 0231 415E     		popq	%r14
+ 163 0233 415F     		popq	%r15
+ 164 0235 5D       		popq	%rbp
+ 165              		.cfi_remember_state
+ 166              		.cfi_def_cfa 7, 8
+ 167 0236 C3       		ret
+ 168 0237 660F1F84 		.p2align 4,,10
+ 168      00000000 
+ 168      00
+ 169              		.p2align 3
+ 170              	.L11:
+ 171              		.cfi_restore_state
+ 172 0240 C5F957C0 		vxorpd	%xmm0, %xmm0, %xmm0
+ 173 0244 4883C760 		addq	$96, %rdi
+ 174 0248 31C0     		xorl	%eax, %eax
+ 175 024a C5D358E0 		vaddsd	%xmm0, %xmm5, %xmm4
+ 176 024e C5CB58E8 		vaddsd	%xmm0, %xmm6, %xmm5
+ 177 0252 4889FA   		movq	%rdi, %rdx
+ 178 0255 C5C358F0 		vaddsd	%xmm0, %xmm7, %xmm6
+ 179 0259 C5BB58F8 		vaddsd	%xmm0, %xmm8, %xmm7
+ 180 025d C5B358C0 		vaddsd	%xmm0, %xmm9, %xmm0
+ 181 0261 C4E27D19 		vbroadcastsd	%xmm4, %ymm4
+ 181      E4
+ 182 0266 C4E27D19 		vbroadcastsd	%xmm5, %ymm5
+ 182      ED
+ 183 026b C4E27D19 		vbroadcastsd	%xmm6, %ymm6
+ 183      F6
+ 184 0270 C4E27D19 		vbroadcastsd	%xmm7, %ymm7
+ 184      FF
+ 185 0275 C4627D19 		vbroadcastsd	%xmm0, %ymm9
+ 185      C8
+ 186 027a 660F1F44 		.p2align 4,,10
+ 186      0000
+ 187              		.p2align 3
+ 188              	.L15:
+ 189 0280 89C1     		movl	%eax, %ecx
+ 190 0282 89C6     		movl	%eax, %esi
+ 191 0284 C5FB1002 		vmovsd	(%rdx), %xmm0
+ 192 0288 83C001   		addl	$1, %eax
+ 193 028b C1F902   		sarl	$2, %ecx
+ 194 028e 83E603   		andl	$3, %esi
+ 195 0291 4883C210 		addq	$16, %rdx
+ 196 0295 4863C9   		movslq	%ecx, %rcx
+ 197 0298 488D0C8E 		leaq	(%rsi,%rcx,4), %rcx
+ 198 029c C5FB1184 		vmovsd	%xmm0, 192(%rsp,%rcx,8)
+ 198      CCC00000 
+ 198      00
+ 199 02a5 C5FB1042 		vmovsd	-8(%rdx), %xmm0
+ 199      F8
+ 200 02aa C5FB1184 		vmovsd	%xmm0, 256(%rsp,%rcx,8)
+ 200      CC000100 
+ 200      00
+ 201 02b3 83F808   		cmpl	$8, %eax
+ 202 02b6 75C8     		jne	.L15
+ 203 02b8 4585ED   		testl	%r13d, %r13d
+ 204 02bb 0F8EFC00 		jle	.L16
+ 204      0000
+ 205 02c1 4D63C5   		movslq	%r13d, %r8
+ 206 02c4 31C9     		xorl	%ecx, %ecx
+ 207 02c6 4C8D6C24 		leaq	64(%rsp), %r13
+ 207      40
+ 208 02cb 49C1E002 		salq	$2, %r8
+ 209 02cf 4C8D9C24 		leaq	192(%rsp), %r11
+ 209      C0000000 
+ 210 02d7 4C8DA424 		leaq	128(%rsp), %r12
+ 210      80000000 
+ 211 02df 4C8D9424 		leaq	256(%rsp), %r10
+ 211      00010000 
+ 212 02e7 660F1F84 		.p2align 4,,10
+ 212      00000000 
+ 212      00
+ 213              		.p2align 3
+ 214              	.L17:
+ 215 02f0 31C0     		xorl	%eax, %eax
+ 216              		.p2align 4,,10
+ 217 02f2 660F1F44 		.p2align 3
+ 217      0000
+ 218              	.L18:
+ 219 02f8 89C2     		movl	%eax, %edx
+ 220 02fa 4889C6   		movq	%rax, %rsi
+ 221 02fd C1FA02   		sarl	$2, %edx
+ 222 0300 83E603   		andl	$3, %esi
+ 223 0303 4863D2   		movslq	%edx, %rdx
+ 224 0306 488D1496 		leaq	(%rsi,%rdx,4), %rdx
+ 225 030a 488B74C3 		movq	8(%rbx,%rax,8), %rsi
+ 225      08
+ 226 030f 4883C001 		addq	$1, %rax
+ 227 0313 C5E25A04 		vcvtss2sd	(%rsi,%rcx), %xmm3, %xmm0
+ 227      0E
+ 228 0318 C5FB1144 		vmovsd	%xmm0, 64(%rsp,%rdx,8)
+ 228      D440
+ 229 031e 4883F808 		cmpq	$8, %rax
+ 230 0322 75D4     		jne	.L18
+ 231 0324 31C0     		xorl	%eax, %eax
+ 232              	.L19:
+ 233 0326 C4C17D28 		vmovapd	0(%r13,%rax), %ymm0
+ 233      440500
+ 234 032d C5DD59C8 		vmulpd	%ymm0, %ymm4, %ymm1
+ 235 0331 C4C17558 		vaddpd	(%r11,%rax), %ymm1, %ymm1
+ 235      0C03
+ 236 0337 C5D559D0 		vmulpd	%ymm0, %ymm5, %ymm2
+ 237 033b C5CD59C0 		vmulpd	%ymm0, %ymm6, %ymm0
+ 238 033f C4C16D58 		vaddpd	(%r10,%rax), %ymm2, %ymm2
+ 238      1402
+ 239 0345 C54559C1 		vmulpd	%ymm1, %ymm7, %ymm8
+ 240 0349 C4C17D29 		vmovapd	%ymm1, (%r12,%rax)
+ 240      0C04
+ 241 034f C5B559C9 		vmulpd	%ymm1, %ymm9, %ymm1
+ 242 0353 C4C16D5C 		vsubpd	%ymm8, %ymm2, %ymm2
+ 242      D0
+ 243 0358 C5FD5CC1 		vsubpd	%ymm1, %ymm0, %ymm0
+ 244 035c C4C17D29 		vmovapd	%ymm2, (%r11,%rax)
+ 244      1403
+ 245 0362 C4C17D29 		vmovapd	%ymm0, (%r10,%rax)
+ 245      0402
+ 246 0368 4883F820 		cmpq	$32, %rax
+ 247 036c 740A     		je	.L44
+ 248 036e B8200000 		movl	$32, %eax
+ 248      00
+ 249 0373 EBB1     		jmp	.L19
+ 250              		.p2align 4,,10
+ 251 0375 0F1F00   		.p2align 3
+ 252              	.L44:
+ 253 0378 31C0     		xorl	%eax, %eax
+ 254 037a 660F1F44 		.p2align 4,,10
+ 254      0000
+ 255              		.p2align 3
+ 256              	.L20:
+ 257 0380 89C2     		movl	%eax, %edx
+ 258 0382 4989C1   		movq	%rax, %r9
+ 259 0385 488B74C3 		movq	72(%rbx,%rax,8), %rsi
+ 259      48
+ 260 038a 4883C001 		addq	$1, %rax
+ 261 038e C1FA02   		sarl	$2, %edx
+ 262 0391 4183E103 		andl	$3, %r9d
+ 263 0395 4863D2   		movslq	%edx, %rdx
+ 264 0398 498D1491 		leaq	(%r9,%rdx,4), %rdx
+ 265 039c C5E35A84 		vcvtsd2ss	128(%rsp,%rdx,8), %xmm3, %xmm0
+ 265      D4800000 
+ 265      00
+ 266 03a5 C5FA1104 		vmovss	%xmm0, (%rsi,%rcx)
+ 266      0E
+ 267 03aa 4883F808 		cmpq	$8, %rax
+ 268 03ae 75D0     		jne	.L20
+ 269 03b0 4883C104 		addq	$4, %rcx
+ 270 03b4 4939C8   		cmpq	%rcx, %r8
+ 271 03b7 0F8533FF 		jne	.L17
+ 271      FFFF
+ 272              	.L16:
+ 273 03bd 31C0     		xorl	%eax, %eax
+ 274 03bf 90       		.p2align 4,,10
+ 275              		.p2align 3
+ 276              	.L21:
+ 277 03c0 89C2     		movl	%eax, %edx
+ 278 03c2 89C1     		movl	%eax, %ecx
+ 279 03c4 83C001   		addl	$1, %eax
+ 280 03c7 4883C710 		addq	$16, %rdi
+ 281 03cb C1FA02   		sarl	$2, %edx
+ 282 03ce 83E103   		andl	$3, %ecx
+ 283 03d1 4863D2   		movslq	%edx, %rdx
+ 284 03d4 488D1491 		leaq	(%rcx,%rdx,4), %rdx
+ 285 03d8 C5FB1084 		vmovsd	192(%rsp,%rdx,8), %xmm0
+ 285      D4C00000 
+ 285      00
+ 286 03e1 C5F91684 		vmovhpd	256(%rsp,%rdx,8), %xmm0, %xmm0
+ 286      D4000100 
+ 286      00
+ 287 03ea C5F92947 		vmovapd	%xmm0, -16(%rdi)
+ 287      F0
+ 288 03ef 83F808   		cmpl	$8, %eax
+ 289 03f2 75CC     		jne	.L21
+ 290 03f4 C5F877   		vzeroupper
+ 291 03f7 488D65D8 		leaq	-40(%rbp), %rsp
+ 292 03fb 5B       		popq	%rbx
+ 293 03fc 415C     		popq	%r12
+ 294 03fe 415D     		popq	%r13
+ 295 0400 415E     		popq	%r14
+ 296 0402 415F     		popq	%r15
+ 297 0404 5D       		popq	%rbp
+ 298              		.cfi_remember_state
+ 299              		.cfi_def_cfa 7, 8
+ 300 0405 C3       		ret
+ 301 0406 662E0F1F 		.p2align 4,,10
+ 301      84000000 
+ 301      0000
+ 302              		.p2align 3
+ 303              	.L10:
+ 304              		.cfi_restore_state
+ 305 0410 488B4B08 		movq	8(%rbx), %rcx
+ 306 0414 488B7310 		movq	16(%rbx), %rsi
+ 307 0418 C4413914 		vunpcklpd	%xmm8, %xmm8, %xmm8
+ 307      C0
+ 308 041d C4C13114 		vunpcklpd	%xmm9, %xmm9, %xmm4
+ 308      E1
+ 309 0422 4C8B4348 		movq	72(%rbx), %r8
+ 310 0426 4C8B4B50 		movq	80(%rbx), %r9
+ 311 042a C5D114ED 		vunpcklpd	%xmm5, %xmm5, %xmm5
+ 312 042e C5C914F6 		vunpcklpd	%xmm6, %xmm6, %xmm6
+ 313 0432 C5F9285F 		vmovapd	96(%rdi), %xmm3
+ 313      60
+ 314 0437 C5FD1047 		vmovupd	96(%rdi), %ymm0
+ 314      60
+ 315 043c C5C114FF 		vunpcklpd	%xmm7, %xmm7, %xmm7
+ 316 0440 C5E11657 		vmovhpd	112(%rdi), %xmm3, %xmm2
+ 316      70
+ 317 0445 C5F9285F 		vmovapd	112(%rdi), %xmm3
+ 317      70
+ 318 044a C5E1125F 		vmovlpd	104(%rdi), %xmm3, %xmm3
+ 318      68
+ 319 044f 4585ED   		testl	%r13d, %r13d
+ 320 0452 7E77     		jle	.L13
+ 321 0454 4963D5   		movslq	%r13d, %rdx
+ 322 0457 31C0     		xorl	%eax, %eax
+ 323 0459 48C1E202 		salq	$2, %rdx
+ 324 045d 0F1F00   		.p2align 4,,10
+ 325              		.p2align 3
+ 326              	.L14:
+ 327 0460 C5FA100C 		vmovss	(%rcx,%rax), %xmm1
+ 327      01
+ 328 0465 C4E37121 		vinsertps	$0x10, (%rsi,%rax), %xmm1, %xmm1
+ 328      0C0610
+ 329 046c C5F85AC9 		vcvtps2pd	%xmm1, %xmm1
+ 330 0470 C5D159C1 		vmulpd	%xmm1, %xmm5, %xmm0
+ 331 0474 C5F958C2 		vaddpd	%xmm2, %xmm0, %xmm0
+ 332 0478 C5C959D1 		vmulpd	%xmm1, %xmm6, %xmm2
+ 333 047c C5C159C9 		vmulpd	%xmm1, %xmm7, %xmm1
+ 334 0480 C5E958D3 		vaddpd	%xmm3, %xmm2, %xmm2
+ 335 0484 C5B959D8 		vmulpd	%xmm0, %xmm8, %xmm3
+ 336 0488 C5E95CD3 		vsubpd	%xmm3, %xmm2, %xmm2
+ 337 048c C5D959D8 		vmulpd	%xmm0, %xmm4, %xmm3
+ 338 0490 C5F15CDB 		vsubpd	%xmm3, %xmm1, %xmm3
+ 339 0494 C5FB5AC8 		vcvtsd2ss	%xmm0, %xmm0, %xmm1
+ 340 0498 C5F915C0 		vunpckhpd	%xmm0, %xmm0, %xmm0
+ 341 049c C4C17A11 		vmovss	%xmm1, (%r8,%rax)
+ 341      0C00
+ 342 04a2 C5FB5AC0 		vcvtsd2ss	%xmm0, %xmm0, %xmm0
+ 343 04a6 C4C17A11 		vmovss	%xmm0, (%r9,%rax)
+ 343      0401
+ 344 04ac 4883C004 		addq	$4, %rax
+ 345 04b0 4839D0   		cmpq	%rdx, %rax
+ 346 04b3 75AB     		jne	.L14
+ 347 04b5 C5E310C3 		vmovsd	%xmm3, %xmm3, %xmm0
+ 348 04b9 C5E915CA 		vunpckhpd	%xmm2, %xmm2, %xmm1
+ 349 04bd C5E310D9 		vmovsd	%xmm1, %xmm3, %xmm3
+ 350 04c1 C5E914D0 		vunpcklpd	%xmm0, %xmm2, %xmm2
+ 351 04c5 C4E36D18 		vinsertf128	$0x1, %xmm3, %ymm2, %ymm0
+ 351      C301
+ 352              	.L13:
+ 353 04cb C5FD1147 		vmovupd	%ymm0, 96(%rdi)
+ 353      60
+ 354 04d0 C5F877   		vzeroupper
+ 355 04d3 488D65D8 		leaq	-40(%rbp), %rsp
+ 356 04d7 5B       		popq	%rbx
+ 357 04d8 415C     		popq	%r12
+ 358 04da 415D     		popq	%r13
+ 359 04dc 415E     		popq	%r14
+ 360 04de 415F     		popq	%r15
+ 361 04e0 5D       		popq	%rbp
+ 362              		.cfi_remember_state
+ 363              		.cfi_def_cfa 7, 8
+ 364 04e1 C3       		ret
+ 365              	.L42:
+ 366              		.cfi_restore_state
+ 367 04e2 4D63E5   		movslq	%r13d, %r12
+ 368 04e5 4C8D2CF3 		leaq	(%rbx,%rsi,8), %r13
+ 369 04e9 49C1E402 		salq	$2, %r12
+ 370 04ed 0F1F00   		.p2align 4,,10
+ 371              		.p2align 3
+ 372              	.L8:
+ 373 04f0 488B7B48 		movq	72(%rbx), %rdi
+ 374 04f4 4C89E2   		movq	%r12, %rdx
+ 375 04f7 31F6     		xorl	%esi, %esi
+ 376 04f9 4883C308 		addq	$8, %rbx
+ 377 04fd E8000000 		call	memset@PLT
+ 377      00
+ 378 0502 4C39EB   		cmpq	%r13, %rbx
+ 379 0505 75E9     		jne	.L8
+ 380 0507 488D65D8 		leaq	-40(%rbp), %rsp
+ 381 050b 5B       		popq	%rbx
+ 382 050c 415C     		popq	%r12
+ 383 050e 415D     		popq	%r13
+ 384 0510 415E     		popq	%r14
+ 385 0512 415F     		popq	%r15
+ 386 0514 5D       		popq	%rbp
+ 387              		.cfi_def_cfa 7, 8
+ 388 0515 C3       		ret
+ 389              		.cfi_endproc
+ 390              	.LFE18:
+ 392              		.section	.rodata.str1.8,"aMS",@progbits,1
+ 393              		.align 8
+ 394              	.LC4:
+ 395 0000 73746174 		.string	"static double s%d_s[NCHANNELS][2];\n"
+ 395      69632064 
+ 395      6F75626C 
+ 395      65207325 
+ 395      645F735B 
+ 396 0024 00000000 		.align 8
+ 397              	.LC5:
+ 398 0028 20202020 		.string	"        double s%d_s1 = s%d_s[c][0], s%d_s2 = s%d_s[c][1];\n"
+ 398      20202020 
+ 398      646F7562 
+ 398      6C652073 
+ 398      25645F73 
+ 399              		.section	.rodata.str1.1,"aMS",@progbits,1
+ 400              	.LC6:
+ 401 0000 20202020 		.string	"            {\n"
+ 401      20202020 
+ 401      20202020 
+ 401      7B0A00
+ 402              		.section	.rodata.str1.8
+ 403 0064 00000000 		.align 8
+ 404              	.LC7:
+ 405 0068 20202020 		.string	"                double xd = x, y = s%d_s1 + %a * xd;\n"
+ 405      20202020 
+ 405      20202020 
+ 405      20202020 
+ 405      646F7562 
+ 406 009e 0000     		.align 8
+ 407              	.LC8:
+ 408 00a0 20202020 		.string	"                s%d_s1 = s%d_s2 + %a * xd - %a * y;\n"
+ 408      20202020 
+ 408      20202020 
+ 408      20202020 
+ 408      7325645F 
+ 409 00d5 000000   		.align 8
+ 410              	.LC9:
+ 411 00d8 20202020 		.string	"                s%d_s2 = %a * xd - %a * y;\n"
+ 411      20202020 
+ 411      20202020 
+ 411      20202020 
+ 411      7325645F 
+ 412 0104 00000000 		.align 8
+ 413              	.LC10:
+ 414 0108 20202020 		.string	"                x = (float)y;\n"
+ 414      20202020 
+ 414      20202020 
+ 414      20202020 
+ 414      78203D20 
+ 415              		.section	.rodata.str1.1
+ 416              	.LC11:
+ 417 000f 20202020 		.string	"            }\n"
+ 417      20202020 
+ 417      20202020 
+ 417      7D0A00
+ 418              		.section	.rodata.str1.8
+ 419 0127 00       		.align 8
+ 420              	.LC12:
+ 421 0128 20202020 		.string	"        if (fabs(s%d_s1) + fabs(s%d_s2) < %a) s%d_s1 = s%d_s2 = 0;\n"
+ 421      20202020 
+ 421      69662028 
+ 421      66616273 
+ 421      28732564 
+ 422 016c 00000000 		.align 8
+ 423              	.LC13:
+ 424 0170 20202020 		.string	"        s%d_s[c][0] = s%d_s1;\n"
+ 424      20202020 
+ 424      7325645F 
+ 424      735B635D 
+ 424      5B305D20 
+ 425 018f 00       		.align 8
+ 426              	.LC14:
+ 427 0190 20202020 		.string	"        s%d_s[c][1] = s%d_s2;\n"
+ 427      20202020 
+ 427      7325645F 
+ 427      735B635D 
+ 427      5B315D20 
+ 428 01af 00       		.align 8
+ 429              	.LC15:
+ 430 01b0 20202020 		.string	"    memset(s%d_s, 0, sizeof(s%d_s));\n"
+ 430      6D656D73 
+ 430      65742873 
+ 430      25645F73 
+ 430      2C20302C 
+ 431              		.text
+ 432 0516 662E0F1F 		.p2align 4
+ 432      84000000 
+ 432      0000
+ 433              		.globl	iir_codegen
+ 435              	iir_codegen:
+ 436              	.LFB25:
+ 437              		.cfi_startproc
+ 438 0520 4154     		pushq	%r12
+ 439              		.cfi_def_cfa_offset 16
+ 440              		.cfi_offset 12, -16
+ 441 0522 55       		pushq	%rbp
+ 442              		.cfi_def_cfa_offset 24
+ 443              		.cfi_offset 6, -24
+ 444 0523 53       		pushq	%rbx
+ 445              		.cfi_def_cfa_offset 32
+ 446              		.cfi_offset 3, -32
+ 447 0524 4C8BA7C0 		movq	192(%rdi), %r12
+ 447      000000
+ 448 052b 83FA04   		cmpl	$4, %edx
+ 449 052e 7735     		ja	.L46
+ 450 0530 89CB     		movl	%ecx, %ebx
+ 451 0532 89D2     		movl	%edx, %edx
+ 452 0534 488D0D00 		leaq	.L48(%rip), %rcx
+ 452      000000
+ 453 053b 4889F5   		movq	%rsi, %rbp
+ 454 053e 48630491 		movslq	(%rcx,%rdx,4), %rax
+ 455 0542 4801C8   		addq	%rcx, %rax
+ 456 0545 FFE0     		jmp	*%rax
+ 457              		.section	.rodata
+ 458              		.align 4
+ 459              		.align 4
+ 460              	.L48:
+ 461 0000 00000000 		.long	.L52-.L48
+ 462 0004 00000000 		.long	.L51-.L48
+ 463 0008 00000000 		.long	.L50-.L48
+ 464 000c 00000000 		.long	.L49-.L48
+ 465 0010 00000000 		.long	.L47-.L48
+ 466              		.text
+ 467 0547 660F1F84 		.p2align 4,,10
+ 467      00000000 
+ 467      00
+ 468              		.p2align 3
+ 469              	.L47:
+ 470 0550 89D9     		movl	%ebx, %ecx
+ 471 0552 89DA     		movl	%ebx, %edx
+ 472 0554 488D3500 		leaq	.LC15(%rip), %rsi
+ 472      000000
+ 473 055b 4889EF   		movq	%rbp, %rdi
+ 474 055e 31C0     		xorl	%eax, %eax
+ 475 0560 E8000000 		call	fprintf@PLT
+ 475      00
+ 476              	.L46:
+ 477 0565 5B       		popq	%rbx
+ 478              		.cfi_remember_state
+ 479              		.cfi_def_cfa_offset 24
+ 480 0566 31C0     		xorl	%eax, %eax
+ 481 0568 5D       		popq	%rbp
+ 482              		.cfi_def_cfa_offset 16
+ 483 0569 415C     		popq	%r12
+ 484              		.cfi_def_cfa_offset 8
+ 485 056b C3       		ret
+ 486 056c 0F1F4000 		.p2align 4,,10
+ 487              		.p2align 3
+ 488              	.L49:
+ 489              		.cfi_restore_state
+ 490 0570 4189D9   		movl	%ebx, %r9d
+ 491 0573 4189D8   		movl	%ebx, %r8d
+ 492 0576 89D9     		movl	%ebx, %ecx
+ 493 0578 89DA     		movl	%ebx, %edx
+ 494 057a 4889EF   		movq	%rbp, %rdi
+ 495 057d 488D3500 		leaq	.LC12(%rip), %rsi
+ 495      000000
+ 496 0584 B8010000 		movl	$1, %eax
+ 496      00
+ 497 0589 C5FB1005 		vmovsd	.LC1(%rip), %xmm0
+ 497      00000000 
+ 498 0591 E8000000 		call	fprintf@PLT
+ 498      00
+ 499 0596 89D9     		movl	%ebx, %ecx
+ 500 0598 89DA     		movl	%ebx, %edx
+ 501 059a 4889EF   		movq	%rbp, %rdi
+ 502 059d 488D3500 		leaq	.LC13(%rip), %rsi
+ 502      000000
+ 503 05a4 31C0     		xorl	%eax, %eax
+ 504 05a6 E8000000 		call	fprintf@PLT
+ 504      00
+ 505 05ab 89D9     		movl	%ebx, %ecx
+ 506 05ad 89DA     		movl	%ebx, %edx
+ 507 05af 4889EF   		movq	%rbp, %rdi
+ 508 05b2 488D3500 		leaq	.LC14(%rip), %rsi
+ 508      000000
+ 509 05b9 31C0     		xorl	%eax, %eax
+ 510 05bb E8000000 		call	fprintf@PLT
+ 510      00
+ 511 05c0 5B       		popq	%rbx
+ 512              		.cfi_remember_state
+ 513              		.cfi_def_cfa_offset 24
+ 514 05c1 31C0     		xorl	%eax, %eax
+ 515 05c3 5D       		popq	%rbp
+ 516              		.cfi_def_cfa_offset 16
+ 517 05c4 415C     		popq	%r12
+ 518              		.cfi_def_cfa_offset 8
+ 519 05c6 C3       		ret
+ 520 05c7 660F1F84 		.p2align 4,,10
+ 520      00000000 
+ 520      00
+ 521              		.p2align 3
+ 522              	.L52:
+ 523              		.cfi_restore_state
+ 524 05d0 89DA     		movl	%ebx, %edx
+ 525 05d2 4889EF   		movq	%rbp, %rdi
+ 526 05d5 488D3500 		leaq	.LC4(%rip), %rsi
+ 526      000000
+ 527 05dc 31C0     		xorl	%eax, %eax
+ 528 05de E8000000 		call	fprintf@PLT
+ 528      00
+ 529 05e3 5B       		popq	%rbx
+ 530              		.cfi_remember_state
+ 531              		.cfi_def_cfa_offset 24
+ 532 05e4 31C0     		xorl	%eax, %eax
+ 533 05e6 5D       		popq	%rbp
+ 534              		.cfi_def_cfa_offset 16
+ 535 05e7 415C     		popq	%r12
+ 536              		.cfi_def_cfa_offset 8
+ 537 05e9 C3       		ret
+ 538 05ea 660F1F44 		.p2align 4,,10
+ 538      0000
+ 539              		.p2align 3
+ 540              	.L51:
+ 541              		.cfi_restore_state
+ 542 05f0 4189D9   		movl	%ebx, %r9d
+ 543 05f3 4189D8   		movl	%ebx, %r8d
+ 544 05f6 89D9     		movl	%ebx, %ecx
+ 545 05f8 89DA     		movl	%ebx, %edx
+ 546 05fa 4889EF   		movq	%rbp, %rdi
+ 547 05fd 488D3500 		leaq	.LC5(%rip), %rsi
+ 547      000000
+ 548 0604 31C0     		xorl	%eax, %eax
+ 549 0606 E8000000 		call	fprintf@PLT
+ 549      00
+ 550 060b 5B       		popq	%rbx
+ 551              		.cfi_remember_state
+ 552              		.cfi_def_cfa_offset 24
+ 553 060c 31C0     		xorl	%eax, %eax
+ 554 060e 5D       		popq	%rbp
+ 555              		.cfi_def_cfa_offset 16
+ 556 060f 415C     		popq	%r12
+ 557              		.cfi_def_cfa_offset 8
+ 558 0611 C3       		ret
+ 559              		.p2align 4,,10
+ 560 0612 660F1F44 		.p2align 3
+ 560      0000
+ 561              	.L50:
+ 562              		.cfi_restore_state
+ 563 0618 4889F1   		movq	%rsi, %rcx
+ 564 061b BA0E0000 		movl	$14, %edx
+ 564      00
+ 565 0620 BE010000 		movl	$1, %esi
+ 565      00
+ 566 0625 488D3D00 		leaq	.LC6(%rip), %rdi
+ 566      000000
+ 567 062c E8000000 		call	fwrite@PLT
+ 567      00
+ 568 0631 89DA     		movl	%ebx, %edx
+ 569 0633 4889EF   		movq	%rbp, %rdi
+ 570 0636 B8010000 		movl	$1, %eax
+ 570      00
+ 571 063b C4C17B10 		vmovsd	64(%r12), %xmm0
+ 571      442440
+ 572 0642 488D3500 		leaq	.LC7(%rip), %rsi
+ 572      000000
+ 573 0649 E8000000 		call	fprintf@PLT
+ 573      00
+ 574 064e 89D9     		movl	%ebx, %ecx
+ 575 0650 89DA     		movl	%ebx, %edx
+ 576 0652 4889EF   		movq	%rbp, %rdi
+ 577 0655 C4C17B10 		vmovsd	72(%r12), %xmm0
+ 577      442448
+ 578 065c C4C17B10 		vmovsd	48(%r12), %xmm1
+ 578      4C2430
+ 579 0663 B8020000 		movl	$2, %eax
+ 579      00
+ 580 0668 488D3500 		leaq	.LC8(%rip), %rsi
+ 580      000000
+ 581 066f E8000000 		call	fprintf@PLT
+ 581      00
+ 582 0674 89DA     		movl	%ebx, %edx
+ 583 0676 4889EF   		movq	%rbp, %rdi
+ 584 0679 B8020000 		movl	$2, %eax
+ 584      00
+ 585 067e C4C17B10 		vmovsd	80(%r12), %xmm0
+ 585      442450
+ 586 0685 C4C17B10 		vmovsd	56(%r12), %xmm1
+ 586      4C2438
+ 587 068c 488D3500 		leaq	.LC9(%rip), %rsi
+ 587      000000
+ 588 0693 E8000000 		call	fprintf@PLT
+ 588      00
+ 589 0698 4889E9   		movq	%rbp, %rcx
+ 590 069b BA1E0000 		movl	$30, %edx
+ 590      00
+ 591 06a0 BE010000 		movl	$1, %esi
+ 591      00
+ 592 06a5 488D3D00 		leaq	.LC10(%rip), %rdi
+ 592      000000
+ 593 06ac E8000000 		call	fwrite@PLT
+ 593      00
+ 594 06b1 4889E9   		movq	%rbp, %rcx
+ 595 06b4 BA0E0000 		movl	$14, %edx
+ 595      00
+ 596 06b9 BE010000 		movl	$1, %esi
+ 596      00
+ 597 06be 488D3D00 		leaq	.LC11(%rip), %rdi
+ 597      000000
+ 598 06c5 E8000000 		call	fwrite@PLT
+ 598      00
+ 599 06ca 5B       		popq	%rbx
+ 600              		.cfi_def_cfa_offset 24
+ 601 06cb 31C0     		xorl	%eax, %eax
+ 602 06cd 5D       		popq	%rbp
+ 603              		.cfi_def_cfa_offset 16
+ 604 06ce 415C     		popq	%r12
+ 605              		.cfi_def_cfa_offset 8
+ 606 06d0 C3       		ret
+ 607              		.cfi_endproc
+ 608              	.LFE25:
+ 610 06d1 66662E0F 		.p2align 4
+ 610      1F840000 
+ 610      0000000F 
+ 610      1F4000
+ 611              		.globl	destroy_iir
+ 613              	destroy_iir:
+ 614              	.LFB26:
+ 615              		.cfi_startproc
+ 616 06e0 488BBFC0 		movq	192(%rdi), %rdi
+ 616      000000
+ 617 06e7 E9000000 		jmp	free@PLT
+ 617      00
+ 618              		.cfi_endproc
+ 619              	.LFE26:
+ 621 06ec 0F1F4000 		.p2align 4
+ 622              		.globl	clone_iir
+ 624              	clone_iir:
+ 625              	.LFB29:
+ 626              		.cfi_startproc
+ 627 06f0 55       		pushq	%rbp
+ 628              		.cfi_def_cfa_offset 16
+ 629              		.cfi_offset 6, -16
+ 630 06f1 4889E5   		movq	%rsp, %rbp
+ 631              		.cfi_def_cfa_register 6
+ 632 06f4 4154     		pushq	%r12
+ 633              		.cfi_offset 12, -24
+ 634 06f6 4989F4   		movq	%rsi, %r12
+ 635 06f9 53       		pushq	%rbx
+ 636              		.cfi_offset 3, -32
+ 637 06fa 4889FB   		movq	%rdi, %rbx
+ 638 06fd BFE00000 		movl	$224, %edi
+ 638      00
+ 639 0702 E8000000 		call	malloc@PLT
+ 639      00
+ 640 0707 4885C0   		testq	%rax, %rax
+ 641 070a 7451     		je	.L57
+ 642 070c 498B9424 		movq	192(%r12), %rdx
+ 642      C0000000 
+ 643 0714 62F1FE48 		vmovdqu64	(%rdx), %zmm0
+ 643      6F02
+ 644 071a 62F1FE48 		vmovdqu64	%zmm0, (%rax)
+ 644      7F00
+ 645 0720 62F1FE48 		vmovdqu64	64(%rdx), %zmm1
+ 645      6F4A01
+ 646 0727 62F1FE48 		vmovdqu64	%zmm1, 64(%rax)
+ 646      7F4801
+ 647 072e 62F1FE48 		vmovdqu64	128(%rdx), %zmm2
+ 647      6F5202
+ 648 0735 62F1FE48 		vmovdqu64	%zmm2, 128(%rax)
+ 648      7F5002
+ 649 073c C5FE6F9A 		vmovdqu	192(%rdx), %ymm3
+ 649      C0000000 
+ 650 0744 488983C0 		movq	%rax, 192(%rbx)
+ 650      000000
+ 651 074b C5FE7F98 		vmovdqu	%ymm3, 192(%rax)
+ 651      C0000000 
+ 652 0753 31C0     		xorl	%eax, %eax
+ 653 0755 C5F877   		vzeroupper
+ 654              	.L55:
+ 655 0758 5B       		popq	%rbx
+ 656 0759 415C     		popq	%r12
+ 657 075b 5D       		popq	%rbp
+ 658              		.cfi_remember_state
+ 659              		.cfi_def_cfa 7, 8
+ 660 075c C3       		ret
+ 661              	.L57:
+ 662              		.cfi_restore_state
+ 663 075d B8010000 		movl	$1, %eax
+ 663      00
+ 664 0762 EBF4     		jmp	.L55
+ 665              		.cfi_endproc
+ 666              	.LFE29:
+ 668 0764 66662E0F 		.p2align 4
+ 668      1F840000 
+ 668      00000090 
+ 670              	iir_process_8_256:
+ 671              	.LFB24:
+ 672              		.cfi_startproc
+ 673 0770 81BFA400 		cmpl	$256, 164(%rdi)
+ 673      00000001 
+ 673      0000
+ 674 077a 7547     		jne	.L60
+ 675 077c 62F1FE48 		vmovdqu64	72(%rdi), %zmm6
+ 675      6FB74800 
+ 675      0000
+ 676 0786 62F1CD48 		vporq	8(%rdi), %zmm6, %zmm0
+ 676      EB870800 
+ 676      0000
+ 677 0790 C5FD6FC8 		vmovdqa	%ymm0, %ymm1
+ 678 0794 62F3FD48 		vextracti64x4	$0x1, %zmm0, %ymm0
+ 678      3BC001
+ 679 079b C5F5EBC8 		vpor	%ymm0, %ymm1, %ymm1
+ 680 079f C5F96FC1 		vmovdqa	%xmm1, %xmm0
+ 681 07a3 62F3FD28 		vextracti64x2	$0x1, %ymm1, %xmm1
+ 681      39C901
+ 682 07aa C5F9EBC1 		vpor	%xmm1, %xmm0, %xmm0
+ 683 07ae C5F173D8 		vpsrldq	$8, %xmm0, %xmm1
+ 683      08
+ 684 07b3 C5F9EBC1 		vpor	%xmm1, %xmm0, %xmm0
+ 685 07b7 C4E1F97E 		vmovq	%xmm0, %rax
+ 685      C0
+ 686 07bc A81F     		testb	$31, %al
+ 687 07be 7410     		je	.L87
+ 688 07c0 C5F877   		vzeroupper
+ 689              	.L60:
+ 690 07c3 E9000000 		jmp	iir_process@PLT
+ 690      00
+ 691 07c8 0F1F8400 		.p2align 4,,10
+ 691      00000000 
+ 692              		.p2align 3
+ 693              	.L87:
+ 694 07d0 55       		pushq	%rbp
+ 695              		.cfi_def_cfa_offset 16
+ 696              		.cfi_offset 6, -16
+ 697 07d1 31C0     		xorl	%eax, %eax
+ 698 07d3 4531C9   		xorl	%r9d, %r9d
+ 699 07d6 C5D957E4 		vxorpd	%xmm4, %xmm4, %xmm4
+ 700 07da 4889E5   		movq	%rsp, %rbp
+ 701              		.cfi_def_cfa_register 6
+ 702 07dd 4154     		pushq	%r12
+ 703              		.cfi_offset 12, -24
+ 704 07df 41BC0100 		movl	$1, %r12d
+ 704      0000
+ 705 07e5 53       		pushq	%rbx
+ 706 07e6 4883E4C0 		andq	$-64, %rsp
+ 707 07ea 4881EC88 		subq	$136, %rsp
+ 707      000000
+ 708              		.cfi_offset 3, -32
+ 709 07f1 4C8B9FC0 		movq	192(%rdi), %r11
+ 709      000000
+ 710 07f8 4C8B9788 		movq	136(%rdi), %r10
+ 710      000000
+ 711 07ff 488BB790 		movq	144(%rdi), %rsi
+ 711      000000
+ 712 0806 C5FA7E15 		vmovq	.LC0(%rip), %xmm2
+ 712      00000000 
+ 713 080e C5FB101D 		vmovsd	.LC1(%rip), %xmm3
+ 713      00000000 
+ 714 0816 4D8D4360 		leaq	96(%r11), %r8
+ 715 081a 4C89C1   		movq	%r8, %rcx
+ 716 081d 0F1F00   		.p2align 4,,10
+ 717              		.p2align 3
+ 718              	.L63:
+ 719 0820 41803C02 		cmpb	$0, (%r10,%rax)
+ 719      00
+ 720 0825 89C2     		movl	%eax, %edx
+ 721 0827 7427     		je	.L61
+ 722 0829 C5FB1041 		vmovsd	8(%rcx), %xmm0
+ 722      08
+ 723 082e C5FB1009 		vmovsd	(%rcx), %xmm1
+ 724 0832 C5F954C2 		vandpd	%xmm2, %xmm0, %xmm0
+ 725 0836 C5F154CA 		vandpd	%xmm2, %xmm1, %xmm1
+ 726 083a C5FB58C1 		vaddsd	%xmm1, %xmm0, %xmm0
+ 727 083e C5F92FD8 		vcomisd	%xmm0, %xmm3
+ 728 0842 760C     		jbe	.L61
+ 729 0844 C4C279F7 		shlx	%eax, %r12d, %ebx
+ 729      DC
+ 730 0849 C5F92921 		vmovapd	%xmm4, (%rcx)
+ 731 084d 4109D9   		orl	%ebx, %r9d
+ 732              	.L61:
+ 733 0850 C4C26BF7 		shrx	%edx, %r9d, %edx
+ 733      D1
+ 734 0855 881406   		movb	%dl, (%rsi,%rax)
+ 735 0858 4883C110 		addq	$16, %rcx
+ 736 085c 80240601 		andb	$1, (%rsi,%rax)
+ 737 0860 4883C001 		addq	$1, %rax
+ 738 0864 4883F808 		cmpq	$8, %rax
+ 739 0868 75B6     		jne	.L63
+ 740 086a 4181F9FF 		cmpl	$255, %r9d
+ 740      000000
+ 741 0871 0F84A401 		je	.L88
+ 741      0000
+ 742 0877 C5D157ED 		vxorpd	%xmm5, %xmm5, %xmm5
+ 743 087b C4C15358 		vaddsd	64(%r11), %xmm5, %xmm6
+ 743      7340
+ 744 0881 4C89C2   		movq	%r8, %rdx
+ 745 0884 31C0     		xorl	%eax, %eax
+ 746 0886 C4C15358 		vaddsd	72(%r11), %xmm5, %xmm7
+ 746      7B48
+ 747 088c C4415358 		vaddsd	80(%r11), %xmm5, %xmm8
+ 747      4350
+ 748 0892 C4415358 		vaddsd	48(%r11), %xmm5, %xmm9
+ 748      4B30
+ 749 0898 C4C15358 		vaddsd	56(%r11), %xmm5, %xmm5
+ 749      6B38
+ 750 089e C4E27D19 		vbroadcastsd	%xmm6, %ymm6
+ 750      F6
+ 751 08a3 C4E27D19 		vbroadcastsd	%xmm7, %ymm7
+ 751      FF
+ 752 08a8 C4427D19 		vbroadcastsd	%xmm8, %ymm8
+ 752      C0
+ 753 08ad C4427D19 		vbroadcastsd	%xmm9, %ymm9
+ 753      C9
+ 754 08b2 C4E27D19 		vbroadcastsd	%xmm5, %ymm5
+ 754      ED
+ 755 08b7 660F1F84 		.p2align 4,,10
+ 755      00000000 
+ 755      00
+ 756              		.p2align 3
+ 757              	.L67:
+ 758 08c0 89C1     		movl	%eax, %ecx
+ 759 08c2 89C6     		movl	%eax, %esi
+ 760 08c4 C5FB1002 		vmovsd	(%rdx), %xmm0
+ 761 08c8 83C001   		addl	$1, %eax
+ 762 08cb C1F902   		sarl	$2, %ecx
+ 763 08ce 83E603   		andl	$3, %esi
+ 764 08d1 4883C210 		addq	$16, %rdx
+ 765 08d5 4863C9   		movslq	%ecx, %rcx
+ 766 08d8 488D0C8E 		leaq	(%rsi,%rcx,4), %rcx
+ 767 08dc C5FB1144 		vmovsd	%xmm0, 8(%rsp,%rcx,8)
+ 767      CC08
+ 768 08e2 C5FB1042 		vmovsd	-8(%rdx), %xmm0
+ 768      F8
+ 769 08e7 C5FB1144 		vmovsd	%xmm0, 72(%rsp,%rcx,8)
+ 769      CC48
+ 770 08ed 83F808   		cmpl	$8, %eax
+ 771 08f0 75CE     		jne	.L67
+ 772 08f2 C5F057C9 		vxorps	%xmm1, %xmm1, %xmm1
+ 773 08f6 31C9     		xorl	%ecx, %ecx
+ 774 08f8 4C8D6424 		leaq	-120(%rsp), %r12
+ 774      88
+ 775 08fd 4C8D5C24 		leaq	8(%rsp), %r11
+ 775      08
+ 776 0902 488D5C24 		leaq	-56(%rsp), %rbx
+ 776      C8
+ 777 0907 4C8D5424 		leaq	72(%rsp), %r10
+ 777      48
+ 778 090c 0F1F4000 		.p2align 4,,10
+ 779              		.p2align 3
+ 780              	.L68:
+ 781 0910 31C0     		xorl	%eax, %eax
+ 782              		.p2align 4,,10
+ 783 0912 660F1F44 		.p2align 3
+ 783      0000
+ 784              	.L69:
+ 785 0918 89C2     		movl	%eax, %edx
+ 786 091a 4889C6   		movq	%rax, %rsi
+ 787 091d C1FA02   		sarl	$2, %edx
+ 788 0920 83E603   		andl	$3, %esi
+ 789 0923 4863D2   		movslq	%edx, %rdx
+ 790 0926 488D1496 		leaq	(%rsi,%rdx,4), %rdx
+ 791 092a 488B74C7 		movq	8(%rdi,%rax,8), %rsi
+ 791      08
+ 792 092f 4883C001 		addq	$1, %rax
+ 793 0933 C5F25A04 		vcvtss2sd	(%rsi,%rcx), %xmm1, %xmm0
+ 793      0E
+ 794 0938 C5FB1144 		vmovsd	%xmm0, -120(%rsp,%rdx,8)
+ 794      D488
+ 795 093e 4883F808 		cmpq	$8, %rax
+ 796 0942 75D4     		jne	.L69
+ 797 0944 31C0     		xorl	%eax, %eax
+ 798              	.L70:
+ 799 0946 C4C17D28 		vmovapd	(%r12,%rax), %ymm0
+ 799      0404
+ 800 094c C5CD59D0 		vmulpd	%ymm0, %ymm6, %ymm2
+ 801 0950 C4C16D58 		vaddpd	(%r11,%rax), %ymm2, %ymm2
+ 801      1403
+ 802 0956 C5C559D8 		vmulpd	%ymm0, %ymm7, %ymm3
+ 803 095a C5BD59C0 		vmulpd	%ymm0, %ymm8, %ymm0
+ 804 095e C4C16558 		vaddpd	(%r10,%rax), %ymm3, %ymm3
+ 804      1C02
+ 805 0964 C5B559E2 		vmulpd	%ymm2, %ymm9, %ymm4
+ 806 0968 C5FD2914 		vmovapd	%ymm2, (%rbx,%rax)
+ 806      03
+ 807 096d C5D559D2 		vmulpd	%ymm2, %ymm5, %ymm2
+ 808 0971 C5E55CDC 		vsubpd	%ymm4, %ymm3, %ymm3
+ 809 0975 C5FD5CC2 		vsubpd	%ymm2, %ymm0, %ymm0
+ 810 0979 C4C17D29 		vmovapd	%ymm3, (%r11,%rax)
+ 810      1C03
+ 811 097f C4C17D29 		vmovapd	%ymm0, (%r10,%rax)
+ 811      0402
+ 812 0985 4883F820 		cmpq	$32, %rax
+ 813 0989 740D     		je	.L89
+ 814 098b B8200000 		movl	$32, %eax
+ 814      00
+ 815 0990 EBB4     		jmp	.L70
+ 816              		.p2align 4,,10
+ 817 0992 660F1F44 		.p2align 3
+ 817      0000
+ 818              	.L89:
+ 819 0998 31C0     		xorl	%eax, %eax
+ 820 099a 660F1F44 		.p2align 4,,10
+ 820      0000
+ 821              		.p2align 3
+ 822              	.L71:
+ 823 09a0 89C2     		movl	%eax, %edx
+ 824 09a2 4989C1   		movq	%rax, %r9
+ 825 09a5 488B74C7 		movq	72(%rdi,%rax,8), %rsi
+ 825      48
+ 826 09aa 4883C001 		addq	$1, %rax
+ 827 09ae C1FA02   		sarl	$2, %edx
+ 828 09b1 4183E103 		andl	$3, %r9d
+ 829 09b5 4863D2   		movslq	%edx, %rdx
+ 830 09b8 498D1491 		leaq	(%r9,%rdx,4), %rdx
+ 831 09bc C5F35A44 		vcvtsd2ss	-56(%rsp,%rdx,8), %xmm1, %xmm0
+ 831      D4C8
+ 832 09c2 C5FA1104 		vmovss	%xmm0, (%rsi,%rcx)
+ 832      0E
+ 833 09c7 4883F808 		cmpq	$8, %rax
+ 834 09cb 75D3     		jne	.L71
+ 835 09cd 4883C104 		addq	$4, %rcx
+ 836 09d1 4881F900 		cmpq	$1024, %rcx
+ 836      040000
+ 837 09d8 0F8532FF 		jne	.L68
+ 837      FFFF
+ 838 09de 31C0     		xorl	%eax, %eax
+ 839              		.p2align 4,,10
+ 840              		.p2align 3
+ 841              	.L72:
+ 842 09e0 89C2     		movl	%eax, %edx
+ 843 09e2 89C1     		movl	%eax, %ecx
+ 844 09e4 83C001   		addl	$1, %eax
+ 845 09e7 4983C010 		addq	$16, %r8
+ 846 09eb C1FA02   		sarl	$2, %edx
+ 847 09ee 83E103   		andl	$3, %ecx
+ 848 09f1 4863D2   		movslq	%edx, %rdx
+ 849 09f4 488D1491 		leaq	(%rcx,%rdx,4), %rdx
+ 850 09f8 C5FB1044 		vmovsd	8(%rsp,%rdx,8), %xmm0
+ 850      D408
+ 851 09fe C5F91644 		vmovhpd	72(%rsp,%rdx,8), %xmm0, %xmm0
+ 851      D448
+ 852 0a04 C4C17929 		vmovapd	%xmm0, -16(%r8)
+ 852      40F0
+ 853 0a0a 83F808   		cmpl	$8, %eax
+ 854 0a0d 75D1     		jne	.L72
+ 855              	.L83:
+ 856 0a0f C5F877   		vzeroupper
+ 857 0a12 488D65F0 		leaq	-16(%rbp), %rsp
+ 858 0a16 5B       		popq	%rbx
+ 859 0a17 415C     		popq	%r12
+ 860 0a19 5D       		popq	%rbp
+ 861              		.cfi_remember_state
+ 862              		.cfi_def_cfa 7, 8
+ 863 0a1a C3       		ret
+ 864              	.L88:
+ 865              		.cfi_restore_state
+ 866 0a1b 488D7748 		leaq	72(%rdi), %rsi
+ 867 0a1f 4C8D8788 		leaq	136(%rdi), %r8
+ 867      000000
+ 868 0a26 31C0     		xorl	%eax, %eax
+ 869 0a28 0F1F8400 		.p2align 4,,10
+ 869      00000000 
+ 870              		.p2align 3
+ 871              	.L65:
+ 872 0a30 488B16   		movq	(%rsi), %rdx
+ 873 0a33 4883C608 		addq	$8, %rsi
+ 874 0a37 488D7A08 		leaq	8(%rdx), %rdi
+ 875 0a3b 48C70200 		movq	$0, (%rdx)
+ 875      000000
+ 876 0a42 48C782F8 		movq	$0, 1016(%rdx)
+ 876      03000000 
+ 876      000000
+ 877 0a4d 4883E7F8 		andq	$-8, %rdi
+ 878 0a51 4829FA   		subq	%rdi, %rdx
+ 879 0a54 8D8A0004 		leal	1024(%rdx), %ecx
+ 879      0000
+ 880 0a5a C1E903   		shrl	$3, %ecx
+ 881 0a5d F348AB   		rep stosq
+ 882 0a60 4C39C6   		cmpq	%r8, %rsi
+ 883 0a63 75CB     		jne	.L65
+ 884 0a65 EBA8     		jmp	.L83
+ 885              		.cfi_endproc
+ 886              	.LFE24:
+ 888 0a67 660F1F84 		.p2align 4
+ 888      00000000 
+ 888      00
+ 890              	iir_process_8_64:
+ 891              	.LFB22:
+ 892              		.cfi_startproc
+ 893 0a70 83BFA400 		cmpl	$64, 164(%rdi)
+ 893      000040
+ 894 0a77 7547     		jne	.L91
+ 895 0a79 62F1FE48 		vmovdqu64	72(%rdi), %zmm6
+ 895      6FB74800 
+ 895      0000
+ 896 0a83 62F1CD48 		vporq	8(%rdi), %zmm6, %zmm0
+ 896      EB870800 
+ 896      0000
+ 897 0a8d C5FD6FC8 		vmovdqa	%ymm0, %ymm1
+ 898 0a91 62F3FD48 		vextracti64x4	$0x1, %zmm0, %ymm0
+ 898      3BC001
+ 899 0a98 C5F5EBC8 		vpor	%ymm0, %ymm1, %ymm1
+ 900 0a9c C5F96FC1 		vmovdqa	%xmm1, %xmm0
+ 901 0aa0 62F3FD28 		vextracti64x2	$0x1, %ymm1, %xmm1
+ 901      39C901
+ 902 0aa7 C5F9EBC1 		vpor	%xmm1, %xmm0, %xmm0
+ 903 0aab C5F173D8 		vpsrldq	$8, %xmm0, %xmm1
+ 903      08
+ 904 0ab0 C5F9EBC1 		vpor	%xmm1, %xmm0, %xmm0
+ 905 0ab4 C4E1F97E 		vmovq	%xmm0, %rax
+ 905      C0
+ 906 0ab9 A81F     		testb	$31, %al
+ 907 0abb 740B     		je	.L118
+ 908 0abd C5F877   		vzeroupper
+ 909              	.L91:
+ 910 0ac0 E9000000 		jmp	iir_process@PLT
+ 910      00
+ 911              		.p2align 4,,10
+ 912 0ac5 0F1F00   		.p2align 3
+ 913              	.L118:
+ 914 0ac8 55       		pushq	%rbp
+ 915              		.cfi_def_cfa_offset 16
+ 916              		.cfi_offset 6, -16
+ 917 0ac9 31C0     		xorl	%eax, %eax
+ 918 0acb 4531C9   		xorl	%r9d, %r9d
+ 919 0ace C5D957E4 		vxorpd	%xmm4, %xmm4, %xmm4
+ 920 0ad2 4889E5   		movq	%rsp, %rbp
+ 921              		.cfi_def_cfa_register 6
+ 922 0ad5 4154     		pushq	%r12
+ 923              		.cfi_offset 12, -24
+ 924 0ad7 41BC0100 		movl	$1, %r12d
+ 924      0000
+ 925 0add 53       		pushq	%rbx
+ 926 0ade 4883E4C0 		andq	$-64, %rsp
+ 927 0ae2 4881EC88 		subq	$136, %rsp
+ 927      000000
+ 928              		.cfi_offset 3, -32
+ 929 0ae9 4C8B9FC0 		movq	192(%rdi), %r11
+ 929      000000
+ 930 0af0 4C8B9788 		movq	136(%rdi), %r10
+ 930      000000
+ 931 0af7 488BB790 		movq	144(%rdi), %rsi
+ 931      000000
+ 932 0afe C5FA7E15 		vmovq	.LC0(%rip), %xmm2
+ 932      00000000 
+ 933 0b06 C5FB101D 		vmovsd	.LC1(%rip), %xmm3
+ 933      00000000 
+ 934 0b0e 4D8D4360 		leaq	96(%r11), %r8
+ 935 0b12 4C89C1   		movq	%r8, %rcx
+ 936              		.p2align 4,,10
+ 937 0b15 0F1F00   		.p2align 3
+ 938              	.L94:
+ 939 0b18 41803C02 		cmpb	$0, (%r10,%rax)
+ 939      00
+ 940 0b1d 89C2     		movl	%eax, %edx
+ 941 0b1f 7427     		je	.L92
+ 942 0b21 C5FB1041 		vmovsd	8(%rcx), %xmm0
+ 942      08
+ 943 0b26 C5FB1009 		vmovsd	(%rcx), %xmm1
+ 944 0b2a C5F954C2 		vandpd	%xmm2, %xmm0, %xmm0
+ 945 0b2e C5F154CA 		vandpd	%xmm2, %xmm1, %xmm1
+ 946 0b32 C5FB58C1 		vaddsd	%xmm1, %xmm0, %xmm0
+ 947 0b36 C5F92FD8 		vcomisd	%xmm0, %xmm3
+ 948 0b3a 760C     		jbe	.L92
+ 949 0b3c C4C279F7 		shlx	%eax, %r12d, %ebx
+ 949      DC
+ 950 0b41 C5F92921 		vmovapd	%xmm4, (%rcx)
+ 951 0b45 4109D9   		orl	%ebx, %r9d
+ 952              	.L92:
+ 953 0b48 C4C26BF7 		shrx	%edx, %r9d, %edx
+ 953      D1
+ 954 0b4d 881406   		movb	%dl, (%rsi,%rax)
+ 955 0b50 4883C110 		addq	$16, %rcx
+ 956 0b54 80240601 		andb	$1, (%rsi,%rax)
+ 957 0b58 4883C001 		addq	$1, %rax
+ 958 0b5c 4883F808 		cmpq	$8, %rax
+ 959 0b60 75B6     		jne	.L94
+ 960 0b62 4181F9FF 		cmpl	$255, %r9d
+ 960      000000
+ 961 0b69 0F849C01 		je	.L119
+ 961      0000
+ 962 0b6f C5D157ED 		vxorpd	%xmm5, %xmm5, %xmm5
+ 963 0b73 C4C15358 		vaddsd	64(%r11), %xmm5, %xmm6
+ 963      7340
+ 964 0b79 4C89C2   		movq	%r8, %rdx
+ 965 0b7c 31C0     		xorl	%eax, %eax
+ 966 0b7e C4C15358 		vaddsd	72(%r11), %xmm5, %xmm7
+ 966      7B48
+ 967 0b84 C4415358 		vaddsd	80(%r11), %xmm5, %xmm8
+ 967      4350
+ 968 0b8a C4415358 		vaddsd	48(%r11), %xmm5, %xmm9
+ 968      4B30
+ 969 0b90 C4C15358 		vaddsd	56(%r11), %xmm5, %xmm5
+ 969      6B38
+ 970 0b96 C4E27D19 		vbroadcastsd	%xmm6, %ymm6
+ 970      F6
+ 971 0b9b C4E27D19 		vbroadcastsd	%xmm7, %ymm7
+ 971      FF
+ 972 0ba0 C4427D19 		vbroadcastsd	%xmm8, %ymm8
+ 972      C0
+ 973 0ba5 C4427D19 		vbroadcastsd	%xmm9, %ymm9
+ 973      C9
+ 974 0baa C4E27D19 		vbroadcastsd	%xmm5, %ymm5
+ 974      ED
+ 975 0baf 90       		.p2align 4,,10
+ 976              		.p2align 3
+ 977              	.L98:
+ 978 0bb0 89C1     		movl	%eax, %ecx
+ 979 0bb2 89C6     		movl	%eax, %esi
+ 980 0bb4 C5FB1002 		vmovsd	(%rdx), %xmm0
+ 981 0bb8 83C001   		addl	$1, %eax
+ 982 0bbb C1F902   		sarl	$2, %ecx
+ 983 0bbe 83E603   		andl	$3, %esi
+ 984 0bc1 4883C210 		addq	$16, %rdx
+ 985 0bc5 4863C9   		movslq	%ecx, %rcx
+ 986 0bc8 488D0C8E 		leaq	(%rsi,%rcx,4), %rcx
+ 987 0bcc C5FB1144 		vmovsd	%xmm0, 8(%rsp,%rcx,8)
+ 987      CC08
+ 988 0bd2 C5FB1042 		vmovsd	-8(%rdx), %xmm0
+ 988      F8
+ 989 0bd7 C5FB1144 		vmovsd	%xmm0, 72(%rsp,%rcx,8)
+ 989      CC48
+ 990 0bdd 83F808   		cmpl	$8, %eax
+ 991 0be0 75CE     		jne	.L98
+ 992 0be2 C5F057C9 		vxorps	%xmm1, %xmm1, %xmm1
+ 993 0be6 31C9     		xorl	%ecx, %ecx
+ 994 0be8 4C8D6424 		leaq	-120(%rsp), %r12
+ 994      88
+ 995 0bed 4C8D5C24 		leaq	8(%rsp), %r11
+ 995      08
+ 996 0bf2 488D5C24 		leaq	-56(%rsp), %rbx
+ 996      C8
+ 997 0bf7 4C8D5424 		leaq	72(%rsp), %r10
+ 997      48
+ 998 0bfc 0F1F4000 		.p2align 4,,10
+ 999              		.p2align 3
+ 1000              	.L99:
+ 1001 0c00 31C0     		xorl	%eax, %eax
+ 1002              		.p2align 4,,10
+ 1003 0c02 660F1F44 		.p2align 3
+ 1003      0000
+ 1004              	.L100:
+ 1005 0c08 89C2     		movl	%eax, %edx
+ 1006 0c0a 4889C6   		movq	%rax, %rsi
+ 1007 0c0d C1FA02   		sarl	$2, %edx
+ 1008 0c10 83E603   		andl	$3, %esi
+ 1009 0c13 4863D2   		movslq	%edx, %rdx
+ 1010 0c16 488D1496 		leaq	(%rsi,%rdx,4), %rdx
+ 1011 0c1a 488B74C7 		movq	8(%rdi,%rax,8), %rsi
+ 1011      08
+ 1012 0c1f 4883C001 		addq	$1, %rax
+ 1013 0c23 C5F25A04 		vcvtss2sd	(%rsi,%rcx), %xmm1, %xmm0
+ 1013      0E
+ 1014 0c28 C5FB1144 		vmovsd	%xmm0, -120(%rsp,%rdx,8)
+ 1014      D488
+ 1015 0c2e 4883F808 		cmpq	$8, %rax
+ 1016 0c32 75D4     		jne	.L100
+ 1017 0c34 31C0     		xorl	%eax, %eax
+ 1018              	.L101:
+ 1019 0c36 C4C17D28 		vmovapd	(%r12,%rax), %ymm0
+ 1019      0404
+ 1020 0c3c C5CD59D0 		vmulpd	%ymm0, %ymm6, %ymm2
+ 1021 0c40 C4C16D58 		vaddpd	(%r11,%rax), %ymm2, %ymm2
+ 1021      1403
+ 1022 0c46 C5C559D8 		vmulpd	%ymm0, %ymm7, %ymm3
+ 1023 0c4a C5BD59C0 		vmulpd	%ymm0, %ymm8, %ymm0
+ 1024 0c4e C4C16558 		vaddpd	(%r10,%rax), %ymm3, %ymm3
+ 1024      1C02
+ 1025 0c54 C5B559E2 		vmulpd	%ymm2, %ymm9, %ymm4
+ 1026 0c58 C5FD2914 		vmovapd	%ymm2, (%rbx,%rax)
+ 1026      03
+ 1027 0c5d C5D559D2 		vmulpd	%ymm2, %ymm5, %ymm2
+ 1028 0c61 C5E55CDC 		vsubpd	%ymm4, %ymm3, %ymm3
+ 1029 0c65 C5FD5CC2 		vsubpd	%ymm2, %ymm0, %ymm0
+ 1030 0c69 C4C17D29 		vmovapd	%ymm3, (%r11,%rax)
+ 1030      1C03
+ 1031 0c6f C4C17D29 		vmovapd	%ymm0, (%r10,%rax)
+ 1031      0402
+ 1032 0c75 4883F820 		cmpq	$32, %rax
+ 1033 0c79 740D     		je	.L120
+ 1034 0c7b B8200000 		movl	$32, %eax
+ 1034      00
+ 1035 0c80 EBB4     		jmp	.L101
+ 1036              		.p2align 4,,10
+ 1037 0c82 660F1F44 		.p2align 3
+ 1037      0000
+ 1038              	.L120:
+ 1039 0c88 31C0     		xorl	%eax, %eax
+ 1040 0c8a 660F1F44 		.p2align 4,,10
+ 1040      0000
+ 1041              		.p2align 3
+ 1042              	.L102:
+ 1043 0c90 89C2     		movl	%eax, %edx
+ 1044 0c92 4989C1   		movq	%rax, %r9
+ 1045 0c95 488B74C7 		movq	72(%rdi,%rax,8), %rsi
+ 1045      48
+ 1046 0c9a 4883C001 		addq	$1, %rax
+ 1047 0c9e C1FA02   		sarl	$2, %edx
+ 1048 0ca1 4183E103 		andl	$3, %r9d
+ 1049 0ca5 4863D2   		movslq	%edx, %rdx
+ 1050 0ca8 498D1491 		leaq	(%r9,%rdx,4), %rdx
+ 1051 0cac C5F35A44 		vcvtsd2ss	-56(%rsp,%rdx,8), %xmm1, %xmm0
+ 1051      D4C8
+ 1052 0cb2 C5FA1104 		vmovss	%xmm0, (%rsi,%rcx)
+ 1052      0E
+ 1053 0cb7 4883F808 		cmpq	$8, %rax
+ 1054 0cbb 75D3     		jne	.L102
+ 1055 0cbd 4883C104 		addq	$4, %rcx
+ 1056 0cc1 4881F900 		cmpq	$256, %rcx
+ 1056      010000
+ 1057 0cc8 0F8532FF 		jne	.L99
+ 1057      FFFF
+ 1058 0cce 31C0     		xorl	%eax, %eax
+ 1059              		.p2align 4,,10
+ 1060              		.p2align 3
+ 1061              	.L103:
+ 1062 0cd0 89C2     		movl	%eax, %edx
+ 1063 0cd2 89C1     		movl	%eax, %ecx
+ 1064 0cd4 83C001   		addl	$1, %eax
+ 1065 0cd7 4983C010 		addq	$16, %r8
+ 1066 0cdb C1FA02   		sarl	$2, %edx
+ 1067 0cde 83E103   		andl	$3, %ecx
+ 1068 0ce1 4863D2   		movslq	%edx, %rdx
+ 1069 0ce4 488D1491 		leaq	(%rcx,%rdx,4), %rdx
+ 1070 0ce8 C5FB1044 		vmovsd	8(%rsp,%rdx,8), %xmm0
+ 1070      D408
+ 1071 0cee C5F91644 		vmovhpd	72(%rsp,%rdx,8), %xmm0, %xmm0
+ 1071      D448
+ 1072 0cf4 C4C17929 		vmovapd	%xmm0, -16(%r8)
+ 1072      40F0
+ 1073 0cfa 83F808   		cmpl	$8, %eax
+ 1074 0cfd 75D1     		jne	.L103
+ 1075              	.L114:
+ 1076 0cff C5F877   		vzeroupper
+ 1077 0d02 488D65F0 		leaq	-16(%rbp), %rsp
+ 1078 0d06 5B       		popq	%rbx
+ 1079 0d07 415C     		popq	%r12
+ 1080 0d09 5D       		popq	%rbp
+ 1081              		.cfi_remember_state
+ 1082              		.cfi_def_cfa 7, 8
+ 1083 0d0a C3       		ret
+ 1084              	.L119:
+ 1085              		.cfi_restore_state
+ 1086 0d0b 488D5748 		leaq	72(%rdi), %rdx
+ 1087 0d0f C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 1088 0d13 4881C788 		addq	$136, %rdi
+ 1088      000000
+ 1089 0d1a 660F1F44 		.p2align 4,,10
+ 1089      0000
+ 1090              		.p2align 3
+ 1091              	.L96:
+ 1092 0d20 488B02   		movq	(%rdx), %rax
+ 1093 0d23 4883C208 		addq	$8, %rdx
+ 1094 0d27 62F17F48 		vmovdqu8	%zmm0, (%rax)
+ 1094      7F00
+ 1095 0d2d 62F17F48 		vmovdqu8	%zmm0, 64(%rax)
+ 1095      7F4001
+ 1096 0d34 62F17F48 		vmovdqu8	%zmm0, 128(%rax)
+ 1096      7F4002
+ 1097 0d3b 62F17F48 		vmovdqu8	%zmm0, 192(%rax)
+ 1097      7F4003
+ 1098 0d42 4839FA   		cmpq	%rdi, %rdx
+ 1099 0d45 75D9     		jne	.L96
+ 1100 0d47 EBB6     		jmp	.L114
+ 1101              		.cfi_endproc
+ 1102              	.LFE22:
+ 1104 0d49 0F1F8000 		.p2align 4
+ 1104      000000
+ 1106              	iir_process_8_128:
+ 1107              	.LFB23:
+ 1108              		.cfi_startproc
+ 1109 0d50 81BFA400 		cmpl	$128, 164(%rdi)
+ 1109      00008000 
+ 1109      0000
+ 1110 0d5a 7547     		jne	.L122
+ 1111 0d5c 62F1FE48 		vmovdqu64	72(%rdi), %zmm6
+ 1111      6FB74800 
+ 1111      0000
+ 1112 0d66 62F1CD48 		vporq	8(%rdi), %zmm6, %zmm0
+ 1112      EB870800 
+ 1112      0000
+ 1113 0d70 C5FD6FC8 		vmovdqa	%ymm0, %ymm1
+ 1114 0d74 62F3FD48 		vextracti64x4	$0x1, %zmm0, %ymm0
+ 1114      3BC001
+ 1115 0d7b C5F5EBC8 		vpor	%ymm0, %ymm1, %ymm1
+ 1116 0d7f C5F96FC1 		vmovdqa	%xmm1, %xmm0
+ 1117 0d83 62F3FD28 		vextracti64x2	$0x1, %ymm1, %xmm1
+ 1117      39C901
+ 1118 0d8a C5F9EBC1 		vpor	%xmm1, %xmm0, %xmm0
+ 1119 0d8e C5F173D8 		vpsrldq	$8, %xmm0, %xmm1
+ 1119      08
+ 1120 0d93 C5F9EBC1 		vpor	%xmm1, %xmm0, %xmm0
+ 1121 0d97 C4E1F97E 		vmovq	%xmm0, %rax
+ 1121      C0
+ 1122 0d9c A81F     		testb	$31, %al
+ 1123 0d9e 7410     		je	.L149
+ 1124 0da0 C5F877   		vzeroupper
+ 1125              	.L122:
+ 1126 0da3 E9000000 		jmp	iir_process@PLT
+ 1126      00
+ 1127 0da8 0F1F8400 		.p2align 4,,10
+ 1127      00000000 
+ 1128              		.p2align 3
+ 1129              	.L149:
+ 1130 0db0 55       		pushq	%rbp
+ 1131              		.cfi_def_cfa_offset 16
+ 1132              		.cfi_offset 6, -16
+ 1133 0db1 31C0     		xorl	%eax, %eax
+ 1134 0db3 4531C9   		xorl	%r9d, %r9d
+ 1135 0db6 C5D957E4 		vxorpd	%xmm4, %xmm4, %xmm4
+ 1136 0dba 4889E5   		movq	%rsp, %rbp
+ 1137              		.cfi_def_cfa_register 6
+ 1138 0dbd 4154     		pushq	%r12
+ 1139              		.cfi_offset 12, -24
+ 1140 0dbf 41BC0100 		movl	$1, %r12d
+ 1140      0000
+ 1141 0dc5 53       		pushq	%rbx
+ 1142 0dc6 4883E4C0 		andq	$-64, %rsp
+ 1143 0dca 4881EC88 		subq	$136, %rsp
+ 1143      000000
+ 1144              		.cfi_offset 3, -32
+ 1145 0dd1 4C8B9FC0 		movq	192(%rdi), %r11
+ 1145      000000
+ 1146 0dd8 4C8B9788 		movq	136(%rdi), %r10
+ 1146      000000
+ 1147 0ddf 488BB790 		movq	144(%rdi), %rsi
+ 1147      000000
+ 1148 0de6 C5FA7E15 		vmovq	.LC0(%rip), %xmm2
+ 1148      00000000 
+ 1149 0dee C5FB101D 		vmovsd	.LC1(%rip), %xmm3
+ 1149      00000000 
+ 1150 0df6 4D8D4360 		leaq	96(%r11), %r8
+ 1151 0dfa 4C89C1   		movq	%r8, %rcx
+ 1152 0dfd 0F1F00   		.p2align 4,,10
+ 1153              		.p2align 3
+ 1154              	.L125:
+ 1155 0e00 41803C02 		cmpb	$0, (%r10,%rax)
+ 1155      00
+ 1156 0e05 89C2     		movl	%eax, %edx
+ 1157 0e07 7427     		je	.L123
+ 1158 0e09 C5FB1041 		vmovsd	8(%rcx), %xmm0
+ 1158      08
+ 1159 0e0e C5FB1009 		vmovsd	(%rcx), %xmm1
+ 1160 0e12 C5F954C2 		vandpd	%xmm2, %xmm0, %xmm0
+ 1161 0e16 C5F154CA 		vandpd	%xmm2, %xmm1, %xmm1
+ 1162 0e1a C5FB58C1 		vaddsd	%xmm1, %xmm0, %xmm0
+ 1163 0e1e C5F92FD8 		vcomisd	%xmm0, %xmm3
+ 1164 0e22 760C     		jbe	.L123
+ 1165 0e24 C4C279F7 		shlx	%eax, %r12d, %ebx
+ 1165      DC
+ 1166 0e29 C5F92921 		vmovapd	%xmm4, (%rcx)
+ 1167 0e2d 4109D9   		orl	%ebx, %r9d
+ 1168              	.L123:
+ 1169 0e30 C4C26BF7 		shrx	%edx, %r9d, %edx
+ 1169      D1
+ 1170 0e35 881406   		movb	%dl, (%rsi,%rax)
+ 1171 0e38 4883C110 		addq	$16, %rcx
+ 1172 0e3c 80240601 		andb	$1, (%rsi,%rax)
+ 1173 0e40 4883C001 		addq	$1, %rax
+ 1174 0e44 4883F808 		cmpq	$8, %rax
+ 1175 0e48 75B6     		jne	.L125
+ 1176 0e4a 4181F9FF 		cmpl	$255, %r9d
+ 1176      000000
+ 1177 0e51 0F84A401 		je	.L150
+ 1177      0000
+ 1178 0e57 C5D157ED 		vxorpd	%xmm5, %xmm5, %xmm5
+ 1179 0e5b C4C15358 		vaddsd	64(%r11), %xmm5, %xmm6
+ 1179      7340
+ 1180 0e61 4C89C2   		movq	%r8, %rdx
+ 1181 0e64 31C0     		xorl	%eax, %eax
+ 1182 0e66 C4C15358 		vaddsd	72(%r11), %xmm5, %xmm7
+ 1182      7B48
+ 1183 0e6c C4415358 		vaddsd	80(%r11), %xmm5, %xmm8
+ 1183      4350
+ 1184 0e72 C4415358 		vaddsd	48(%r11), %xmm5, %xmm9
+ 1184      4B30
+ 1185 0e78 C4C15358 		vaddsd	56(%r11), %xmm5, %xmm5
+ 1185      6B38
+ 1186 0e7e C4E27D19 		vbroadcastsd	%xmm6, %ymm6
+ 1186      F6
+ 1187 0e83 C4E27D19 		vbroadcastsd	%xmm7, %ymm7
+ 1187      FF
+ 1188 0e88 C4427D19 		vbroadcastsd	%xmm8, %ymm8
+ 1188      C0
+ 1189 0e8d C4427D19 		vbroadcastsd	%xmm9, %ymm9
+ 1189      C9
+ 1190 0e92 C4E27D19 		vbroadcastsd	%xmm5, %ymm5
+ 1190      ED
+ 1191 0e97 660F1F84 		.p2align 4,,10
+ 1191      00000000 
+ 1191      00
+ 1192              		.p2align 3
+ 1193              	.L129:
+ 1194 0ea0 89C1     		movl	%eax, %ecx
+ 1195 0ea2 89C6     		movl	%eax, %esi
+ 1196 0ea4 C5FB1002 		vmovsd	(%rdx), %xmm0
+ 1197 0ea8 83C001   		addl	$1, %eax
+ 1198 0eab C1F902   		sarl	$2, %ecx
+ 1199 0eae 83E603   		andl	$3, %esi
+ 1200 0eb1 4883C210 		addq	$16, %rdx
+ 1201 0eb5 4863C9   		movslq	%ecx, %rcx
+ 1202 0eb8 488D0C8E 		leaq	(%rsi,%rcx,4), %rcx
+ 1203 0ebc C5FB1144 		vmovsd	%xmm0, 8(%rsp,%rcx,8)
+ 1203      CC08
+ 1204 0ec2 C5FB1042 		vmovsd	-8(%rdx), %xmm0
+ 1204      F8
+ 1205 0ec7 C5FB1144 		vmovsd	%xmm0, 72(%rsp,%rcx,8)
+ 1205      CC48
+ 1206 0ecd 83F808   		cmpl	$8, %eax
+ 1207 0ed0 75CE     		jne	.L129
+ 1208 0ed2 C5F057C9 		vxorps	%xmm1, %xmm1, %xmm1
+ 1209 0ed6 31C9     		xorl	%ecx, %ecx
+ 1210 0ed8 4C8D6424 		leaq	-120(%rsp), %r12
+ 1210      88
+ 1211 0edd 4C8D5C24 		leaq	8(%rsp), %r11
+ 1211      08
+ 1212 0ee2 488D5C24 		leaq	-56(%rsp), %rbx
+ 1212      C8
+ 1213 0ee7 4C8D5424 		leaq	72(%rsp), %r10
+ 1213      48
+ 1214 0eec 0F1F4000 		.p2align 4,,10
+ 1215              		.p2align 3
+ 1216              	.L130:
+ 1217 0ef0 31C0     		xorl	%eax, %eax
+ 1218              		.p2align 4,,10
+ 1219 0ef2 660F1F44 		.p2align 3
+ 1219      0000
+ 1220              	.L131:
+ 1221 0ef8 89C2     		movl	%eax, %edx
+ 1222 0efa 4889C6   		movq	%rax, %rsi
+ 1223 0efd C1FA02   		sarl	$2, %edx
+ 1224 0f00 83E603   		andl	$3, %esi
+ 1225 0f03 4863D2   		movslq	%edx, %rdx
+ 1226 0f06 488D1496 		leaq	(%rsi,%rdx,4), %rdx
+ 1227 0f0a 488B74C7 		movq	8(%rdi,%rax,8), %rsi
+ 1227      08
+ 1228 0f0f 4883C001 		addq	$1, %rax
+ 1229 0f13 C5F25A04 		vcvtss2sd	(%rsi,%rcx), %xmm1, %xmm0
+ 1229      0E
+ 1230 0f18 C5FB1144 		vmovsd	%xmm0, -120(%rsp,%rdx,8)
+ 1230      D488
+ 1231 0f1e 4883F808 		cmpq	$8, %rax
+ 1232 0f22 75D4     		jne	.L131
+ 1233 0f24 31C0     		xorl	%eax, %eax
+ 1234              	.L132:
+ 1235 0f26 C4C17D28 		vmovapd	(%r12,%rax), %ymm0
+ 1235      0404
+ 1236 0f2c C5CD59D0 		vmulpd	%ymm0, %ymm6, %ymm2
+ 1237 0f30 C4C16D58 		vaddpd	(%r11,%rax), %ymm2, %ymm2
+ 1237      1403
+ 1238 0f36 C5C559D8 		vmulpd	%ymm0, %ymm7, %ymm3
+ 1239 0f3a C5BD59C0 		vmulpd	%ymm0, %ymm8, %ymm0
+ 1240 0f3e C4C16558 		vaddpd	(%r10,%rax), %ymm3, %ymm3
+ 1240      1C02
+ 1241 0f44 C5B559E2 		vmulpd	%ymm2, %ymm9, %ymm4
+ 1242 0f48 C5FD2914 		vmovapd	%ymm2, (%rbx,%rax)
+ 1242      03
+ 1243 0f4d C5D559D2 		vmulpd	%ymm2, %ymm5, %ymm2
+ 1244 0f51 C5E55CDC 		vsubpd	%ymm4, %ymm3, %ymm3
+ 1245 0f55 C5FD5CC2 		vsubpd	%ymm2, %ymm0, %ymm0
+ 1246 0f59 C4C17D29 		vmovapd	%ymm3, (%r11,%rax)
+ 1246      1C03
+ 1247 0f5f C4C17D29 		vmovapd	%ymm0, (%r10,%rax)
+ 1247      0402
+ 1248 0f65 4883F820 		cmpq	$32, %rax
+ 1249 0f69 740D     		je	.L151
+ 1250 0f6b B8200000 		movl	$32, %eax
+ 1250      00
+ 1251 0f70 EBB4     		jmp	.L132
+ 1252              		.p2align 4,,10
+ 1253 0f72 660F1F44 		.p2align 3
+ 1253      0000
+ 1254              	.L151:
+ 1255 0f78 31C0     		xorl	%eax, %eax
+ 1256 0f7a 660F1F44 		.p2align 4,,10
+ 1256      0000
+ 1257              		.p2align 3
+ 1258              	.L133:
+ 1259 0f80 89C2     		movl	%eax, %edx
+ 1260 0f82 4989C1   		movq	%rax, %r9
+ 1261 0f85 488B74C7 		movq	72(%rdi,%rax,8), %rsi
+ 1261      48
+ 1262 0f8a 4883C001 		addq	$1, %rax
+ 1263 0f8e C1FA02   		sarl	$2, %edx
+ 1264 0f91 4183E103 		andl	$3, %r9d
+ 1265 0f95 4863D2   		movslq	%edx, %rdx
+ 1266 0f98 498D1491 		leaq	(%r9,%rdx,4), %rdx
+ 1267 0f9c C5F35A44 		vcvtsd2ss	-56(%rsp,%rdx,8), %xmm1, %xmm0
+ 1267      D4C8
+ 1268 0fa2 C5FA1104 		vmovss	%xmm0, (%rsi,%rcx)
+ 1268      0E
+ 1269 0fa7 4883F808 		cmpq	$8, %rax
+ 1270 0fab 75D3     		jne	.L133
+ 1271 0fad 4883C104 		addq	$4, %rcx
+ 1272 0fb1 4881F900 		cmpq	$512, %rcx
+ 1272      020000
+ 1273 0fb8 0F8532FF 		jne	.L130
+ 1273      FFFF
+ 1274 0fbe 31C0     		xorl	%eax, %eax
+ 1275              		.p2align 4,,10
+ 1276              		.p2align 3
+ 1277              	.L134:
+ 1278 0fc0 89C2     		movl	%eax, %edx
+ 1279 0fc2 89C1     		movl	%eax, %ecx
+ 1280 0fc4 83C001   		addl	$1, %eax
+ 1281 0fc7 4983C010 		addq	$16, %r8
+ 1282 0fcb C1FA02   		sarl	$2, %edx
+ 1283 0fce 83E103   		andl	$3, %ecx
+ 1284 0fd1 4863D2   		movslq	%edx, %rdx
+ 1285 0fd4 488D1491 		leaq	(%rcx,%rdx,4), %rdx
+ 1286 0fd8 C5FB1044 		vmovsd	8(%rsp,%rdx,8), %xmm0
+ 1286      D408
+ 1287 0fde C5F91644 		vmovhpd	72(%rsp,%rdx,8), %xmm0, %xmm0
+ 1287      D448
+ 1288 0fe4 C4C17929 		vmovapd	%xmm0, -16(%r8)
+ 1288      40F0
+ 1289 0fea 83F808   		cmpl	$8, %eax
+ 1290 0fed 75D1     		jne	.L134
+ 1291              	.L145:
+ 1292 0fef C5F877   		vzeroupper
+ 1293 0ff2 488D65F0 		leaq	-16(%rbp), %rsp
+ 1294 0ff6 5B       		popq	%rbx
+ 1295 0ff7 415C     		popq	%r12
+ 1296 0ff9 5D       		popq	%rbp
+ 1297              		.cfi_remember_state
+ 1298              		.cfi_def_cfa 7, 8
+ 1299 0ffa C3       		ret
+ 1300              	.L150:
+ 1301              		.cfi_restore_state
+ 1302 0ffb 488D7748 		leaq	72(%rdi), %rsi
+ 1303 0fff 4C8D8788 		leaq	136(%rdi), %r8
+ 1303      000000
+ 1304 1006 31C0     		xorl	%eax, %eax
+ 1305 1008 0F1F8400 		.p2align 4,,10
+ 1305      00000000 
+ 1306              		.p2align 3
+ 1307              	.L127:
+ 1308 1010 488B16   		movq	(%rsi), %rdx
+ 1309 1013 4883C608 		addq	$8, %rsi
+ 1310 1017 488D7A08 		leaq	8(%rdx), %rdi
+ 1311 101b 48C70200 		movq	$0, (%rdx)
+ 1311      000000
+ 1312 1022 48C782F8 		movq	$0, 504(%rdx)
+ 1312      01000000 
+ 1312      000000
+ 1313 102d 4883E7F8 		andq	$-8, %rdi
+ 1314 1031 4829FA   		subq	%rdi, %rdx
+ 1315 1034 8D8A0002 		leal	512(%rdx), %ecx
+ 1315      0000
+ 1316 103a C1E903   		shrl	$3, %ecx
+ 1317 103d F348AB   		rep stosq
+ 1318 1040 4C39C6   		cmpq	%r8, %rsi
+ 1319 1043 75CB     		jne	.L127
+ 1320 1045 EBA8     		jmp	.L145
+ 1321              		.cfi_endproc
+ 1322              	.LFE23:
+ 1324 1047 660F1F84 		.p2align 4
+ 1324      00000000 
+ 1324      00
+ 1326              	iir_process_2_64:
+ 1327              	.LFB19:
+ 1328              		.cfi_startproc
+ 1329 1050 83BFA400 		cmpl	$64, 164(%rdi)
+ 1329      000040
+ 1330 1057 7521     		jne	.L153
+ 1331 1059 488B4F08 		movq	8(%rdi), %rcx
+ 1332 105d 488B5748 		movq	72(%rdi), %rdx
+ 1333 1061 488B7710 		movq	16(%rdi), %rsi
+ 1334 1065 4C8B4750 		movq	80(%rdi), %r8
+ 1335 1069 4889C8   		movq	%rcx, %rax
+ 1336 106c 4809D0   		orq	%rdx, %rax
+ 1337 106f 4809F0   		orq	%rsi, %rax
+ 1338 1072 4C09C0   		orq	%r8, %rax
+ 1339 1075 83E01F   		andl	$31, %eax
+ 1340 1078 7406     		je	.L174
+ 1341              	.L153:
+ 1342 107a E9000000 		jmp	iir_process@PLT
+ 1342      00
+ 1343 107f 90       		.p2align 4,,10
+ 1344              		.p2align 3
+ 1345              	.L174:
+ 1346 1080 4C8B9F88 		movq	136(%rdi), %r11
+ 1346      000000
+ 1347 1087 4C8B8FC0 		movq	192(%rdi), %r9
+ 1347      000000
+ 1348 108e 55       		pushq	%rbp
+ 1349              		.cfi_def_cfa_offset 16
+ 1350              		.cfi_offset 6, -16
+ 1351 108f 4889E5   		movq	%rsp, %rbp
+ 1352              		.cfi_def_cfa_register 6
+ 1353 1092 4154     		pushq	%r12
+ 1354              		.cfi_offset 12, -24
+ 1355 1094 4531E4   		xorl	%r12d, %r12d
+ 1356 1097 53       		pushq	%rbx
+ 1357              		.cfi_offset 3, -32
+ 1358 1098 450FB613 		movzbl	(%r11), %r10d
+ 1359 109c 4584D2   		testb	%r10b, %r10b
+ 1360 109f 7442     		je	.L154
+ 1361 10a1 C4C17B10 		vmovsd	96(%r9), %xmm0
+ 1361      4160
+ 1362 10a7 C4C17B10 		vmovsd	104(%r9), %xmm1
+ 1362      4968
+ 1363 10ad C5FA7E15 		vmovq	.LC0(%rip), %xmm2
+ 1363      00000000 
+ 1364 10b5 C5F154CA 		vandpd	%xmm2, %xmm1, %xmm1
+ 1365 10b9 C5F954C2 		vandpd	%xmm2, %xmm0, %xmm0
+ 1366 10bd C5FB58C1 		vaddsd	%xmm1, %xmm0, %xmm0
+ 1367 10c1 C5FB100D 		vmovsd	.LC1(%rip), %xmm1
+ 1367      00000000 
+ 1368 10c9 C5F92FC8 		vcomisd	%xmm0, %xmm1
+ 1369 10cd 0F866901 		jbe	.L169
+ 1369      0000
+ 1370 10d3 C5F957C0 		vxorpd	%xmm0, %xmm0, %xmm0
+ 1371 10d7 41BC0100 		movl	$1, %r12d
+ 1371      0000
+ 1372 10dd C4C17929 		vmovapd	%xmm0, 96(%r9)
+ 1372      4160
+ 1373              	.L154:
+ 1374 10e3 488B9F90 		movq	144(%rdi), %rbx
+ 1374      000000
+ 1375 10ea C4C17B10 		vmovsd	112(%r9), %xmm2
+ 1375      5170
+ 1376 10f0 C4C17B10 		vmovsd	120(%r9), %xmm3
+ 1376      5978
+ 1377 10f6 448813   		movb	%r10b, (%rbx)
+ 1378 10f9 41807B01 		cmpb	$0, 1(%r11)
+ 1378      00
+ 1379 10fe 0F85BC00 		jne	.L156
+ 1379      0000
+ 1380              	.L158:
+ 1381 1104 C6430100 		movb	$0, 1(%rbx)
+ 1382              	.L157:
+ 1383 1108 C4C17B10 		vmovsd	96(%r9), %xmm0
+ 1383      4160
+ 1384 110e C4437905 		vpermilpd	$0, 48(%r9), %xmm8
+ 1384      413000
+ 1385 1115 C4C37905 		vpermilpd	$3, 48(%r9), %xmm5
+ 1385      693003
+ 1386 111c C4C37905 		vpermilpd	$0, 64(%r9), %xmm7
+ 1386      794000
+ 1387 1123 C5F914D2 		vunpcklpd	%xmm2, %xmm0, %xmm2
+ 1388 1127 C4C17B10 		vmovsd	104(%r9), %xmm0
+ 1388      4168
+ 1389 112d C4C37905 		vpermilpd	$3, 64(%r9), %xmm4
+ 1389      614003
+ 1390 1134 C4C37905 		vpermilpd	$0, 80(%r9), %xmm6
+ 1390      715000
+ 1391 113b C5F914DB 		vunpcklpd	%xmm3, %xmm0, %xmm3
+ 1392 113f 90       		.p2align 4,,10
+ 1393              		.p2align 3
+ 1394              	.L161:
+ 1395 1140 C5FA100C 		vmovss	(%rcx,%rax), %xmm1
+ 1395      01
+ 1396 1145 C4E37121 		vinsertps	$0x10, (%rsi,%rax), %xmm1, %xmm1
+ 1396      0C0610
+ 1397 114c C5F85AC9 		vcvtps2pd	%xmm1, %xmm1
+ 1398 1150 C5C159C1 		vmulpd	%xmm1, %xmm7, %xmm0
+ 1399 1154 C5F958C2 		vaddpd	%xmm2, %xmm0, %xmm0
+ 1400 1158 C5F159D4 		vmulpd	%xmm4, %xmm1, %xmm2
+ 1401 115c C5C959C9 		vmulpd	%xmm1, %xmm6, %xmm1
+ 1402 1160 C5E958D3 		vaddpd	%xmm3, %xmm2, %xmm2
+ 1403 1164 C4C17959 		vmulpd	%xmm8, %xmm0, %xmm3
+ 1403      D8
+ 1404 1169 C5E95CD3 		vsubpd	%xmm3, %xmm2, %xmm2
+ 1405 116d C5F959DD 		vmulpd	%xmm5, %xmm0, %xmm3
+ 1406 1171 C5F15CDB 		vsubpd	%xmm3, %xmm1, %xmm3
+ 1407 1175 C5FB5AC8 		vcvtsd2ss	%xmm0, %xmm0, %xmm1
+ 1408 1179 C5F915C0 		vunpckhpd	%xmm0, %xmm0, %xmm0
+ 1409 117d C5FA110C 		vmovss	%xmm1, (%rdx,%rax)
+ 1409      02
+ 1410 1182 C5FB5AC0 		vcvtsd2ss	%xmm0, %xmm0, %xmm0
+ 1411 1186 C4C17A11 		vmovss	%xmm0, (%r8,%rax)
+ 1411      0400
+ 1412 118c 4883C004 		addq	$4, %rax
+ 1413 1190 483D0001 		cmpq	$256, %rax
+ 1413      0000
+ 1414 1196 75A8     		jne	.L161
+ 1415 1198 C5E310C3 		vmovsd	%xmm3, %xmm3, %xmm0
+ 1416 119c C5E915CA 		vunpckhpd	%xmm2, %xmm2, %xmm1
+ 1417 11a0 C5E310D9 		vmovsd	%xmm1, %xmm3, %xmm3
+ 1418 11a4 C5E914D0 		vunpcklpd	%xmm0, %xmm2, %xmm2
+ 1419 11a8 C4E36D18 		vinsertf128	$0x1, %xmm3, %ymm2, %ymm2
+ 1419      D301
+ 1420 11ae C4C17D11 		vmovupd	%ymm2, 96(%r9)
+ 1420      5160
+ 1421              	.L170:
+ 1422 11b4 C5F877   		vzeroupper
+ 1423 11b7 5B       		popq	%rbx
+ 1424 11b8 415C     		popq	%r12
+ 1425 11ba 5D       		popq	%rbp
+ 1426              		.cfi_remember_state
+ 1427              		.cfi_def_cfa 7, 8
+ 1428 11bb C3       		ret
+ 1429 11bc 0F1F4000 		.p2align 4,,10
+ 1430              		.p2align 3
+ 1431              	.L156:
+ 1432              		.cfi_restore_state
+ 1433 11c0 C5FA7E05 		vmovq	.LC0(%rip), %xmm0
+ 1433      00000000 
+ 1434 11c8 C5E954C8 		vandpd	%xmm0, %xmm2, %xmm1
+ 1435 11cc C5E154C0 		vandpd	%xmm0, %xmm3, %xmm0
+ 1436 11d0 C5F358C0 		vaddsd	%xmm0, %xmm1, %xmm0
+ 1437 11d4 C5FB100D 		vmovsd	.LC1(%rip), %xmm1
+ 1437      00000000 
+ 1438 11dc C5F92FC8 		vcomisd	%xmm0, %xmm1
+ 1439 11e0 0F861EFF 		jbe	.L158
+ 1439      FFFF
+ 1440 11e6 C5F957C0 		vxorpd	%xmm0, %xmm0, %xmm0
+ 1441 11ea C4C17929 		vmovapd	%xmm0, 112(%r9)
+ 1441      4170
+ 1442 11f0 C6430101 		movb	$1, 1(%rbx)
+ 1443 11f4 4585E4   		testl	%r12d, %r12d
+ 1444 11f7 744B     		je	.L164
+ 1445 11f9 C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 1446 11fd 62F17F48 		vmovdqu8	%zmm0, (%rdx)
+ 1446      7F02
+ 1447 1203 62F17F48 		vmovdqu8	%zmm0, 64(%rdx)
+ 1447      7F4201
+ 1448 120a 62F17F48 		vmovdqu8	%zmm0, 128(%rdx)
+ 1448      7F4202
+ 1449 1211 62F17F48 		vmovdqu8	%zmm0, 192(%rdx)
+ 1449      7F4203
+ 1450 1218 488B4750 		movq	80(%rdi), %rax
+ 1451 121c 62F17F48 		vmovdqu8	%zmm0, (%rax)
+ 1451      7F00
+ 1452 1222 62F17F48 		vmovdqu8	%zmm0, 64(%rax)
+ 1452      7F4001
+ 1453 1229 62F17F48 		vmovdqu8	%zmm0, 128(%rax)
+ 1453      7F4002
+ 1454 1230 62F17F48 		vmovdqu8	%zmm0, 192(%rax)
+ 1454      7F4003
+ 1455 1237 E978FFFF 		jmp	.L170
+ 1455      FF
+ 1456              	.L169:
+ 1457 123c 4531D2   		xorl	%r10d, %r10d
+ 1458 123f E99FFEFF 		jmp	.L154
+ 1458      FF
+ 1459              	.L164:
+ 1460 1244 C5E157DB 		vxorpd	%xmm3, %xmm3, %xmm3
+ 1461 1248 C5E310D3 		vmovsd	%xmm3, %xmm3, %xmm2
+ 1462 124c E9B7FEFF 		jmp	.L157
+ 1462      FF
+ 1463              		.cfi_endproc
+ 1464              	.LFE19:
+ 1466 1251 66662E0F 		.p2align 4
+ 1466      1F840000 
+ 1466      0000000F 
+ 1466      1F4000
+ 1468              	iir_process_2_128:
+ 1469              	.LFB20:
+ 1470              		.cfi_startproc
+ 1471 1260 81BFA400 		cmpl	$128, 164(%rdi)
+ 1471      00008000 
+ 1471      0000
+ 1472 126a 4889FA   		movq	%rdi, %rdx
+ 1473 126d 7521     		jne	.L176
+ 1474 126f 488B7708 		movq	8(%rdi), %rsi
+ 1475 1273 488B4F48 		movq	72(%rdi), %rcx
+ 1476 1277 488B7F10 		movq	16(%rdi), %rdi
+ 1477 127b 4C8B4250 		movq	80(%rdx), %r8
+ 1478 127f 4889F0   		movq	%rsi, %rax
+ 1479 1282 4809C8   		orq	%rcx, %rax
+ 1480 1285 4809F8   		orq	%rdi, %rax
+ 1481 1288 4C09C0   		orq	%r8, %rax
+ 1482 128b 83E01F   		andl	$31, %eax
+ 1483 128e 7410     		je	.L197
+ 1484              	.L176:
+ 1485 1290 4889D7   		movq	%rdx, %rdi
+ 1486 1293 E9000000 		jmp	iir_process@PLT
+ 1486      00
+ 1487 1298 0F1F8400 		.p2align 4,,10
+ 1487      00000000 
+ 1488              		.p2align 3
+ 1489              	.L197:
+ 1490 12a0 55       		pushq	%rbp
+ 1491              		.cfi_def_cfa_offset 16
+ 1492              		.cfi_offset 6, -16
+ 1493 12a1 4889E5   		movq	%rsp, %rbp
+ 1494              		.cfi_def_cfa_register 6
+ 1495 12a4 4154     		pushq	%r12
+ 1496              		.cfi_offset 12, -24
+ 1497 12a6 4531E4   		xorl	%r12d, %r12d
+ 1498 12a9 53       		pushq	%rbx
+ 1499              		.cfi_offset 3, -32
+ 1500 12aa 4C8B9A88 		movq	136(%rdx), %r11
+ 1500      000000
+ 1501 12b1 4C8B8AC0 		movq	192(%rdx), %r9
+ 1501      000000
+ 1502 12b8 450FB613 		movzbl	(%r11), %r10d
+ 1503 12bc 4584D2   		testb	%r10b, %r10b
+ 1504 12bf 7442     		je	.L177
+ 1505 12c1 C4C17B10 		vmovsd	96(%r9), %xmm0
+ 1505      4160
+ 1506 12c7 C4C17B10 		vmovsd	104(%r9), %xmm1
+ 1506      4968
+ 1507 12cd C5FA7E15 		vmovq	.LC0(%rip), %xmm2
+ 1507      00000000 
+ 1508 12d5 C5F154CA 		vandpd	%xmm2, %xmm1, %xmm1
+ 1509 12d9 C5F954C2 		vandpd	%xmm2, %xmm0, %xmm0
+ 1510 12dd C5FB58C1 		vaddsd	%xmm1, %xmm0, %xmm0
+ 1511 12e1 C5FB100D 		vmovsd	.LC1(%rip), %xmm1
+ 1511      00000000 
+ 1512 12e9 C5F92FC8 		vcomisd	%xmm0, %xmm1
+ 1513 12ed 0F868301 		jbe	.L192
+ 1513      0000
+ 1514 12f3 C5F957C0 		vxorpd	%xmm0, %xmm0, %xmm0
+ 1515 12f7 41BC0100 		movl	$1, %r12d
+ 1515      0000
+ 1516 12fd C4C17929 		vmovapd	%xmm0, 96(%r9)
+ 1516      4160
+ 1517              	.L177:
+ 1518 1303 488B9A90 		movq	144(%rdx), %rbx
+ 1518      000000
+ 1519 130a C4C17B10 		vmovsd	112(%r9), %xmm2
+ 1519      5170
+ 1520 1310 C4C17B10 		vmovsd	120(%r9), %xmm3
+ 1520      5978
+ 1521 1316 448813   		movb	%r10b, (%rbx)
+ 1522 1319 41807B01 		cmpb	$0, 1(%r11)
+ 1522      00
+ 1523 131e 0F85BC00 		jne	.L179
+ 1523      0000
+ 1524              	.L181:
+ 1525 1324 C6430100 		movb	$0, 1(%rbx)
+ 1526              	.L180:
+ 1527 1328 C4C17B10 		vmovsd	96(%r9), %xmm0
+ 1527      4160
+ 1528 132e C4437905 		vpermilpd	$0, 48(%r9), %xmm8
+ 1528      413000
+ 1529 1335 C4C37905 		vpermilpd	$3, 48(%r9), %xmm5
+ 1529      693003
+ 1530 133c C4C37905 		vpermilpd	$0, 64(%r9), %xmm7
+ 1530      794000
+ 1531 1343 C5F914D2 		vunpcklpd	%xmm2, %xmm0, %xmm2
+ 1532 1347 C4C17B10 		vmovsd	104(%r9), %xmm0
+ 1532      4168
+ 1533 134d C4C37905 		vpermilpd	$3, 64(%r9), %xmm4
+ 1533      614003
+ 1534 1354 C4C37905 		vpermilpd	$0, 80(%r9), %xmm6
+ 1534      715000
+ 1535 135b C5F914DB 		vunpcklpd	%xmm3, %xmm0, %xmm3
+ 1536 135f 90       		.p2align 4,,10
+ 1537              		.p2align 3
+ 1538              	.L184:
+ 1539 1360 C5FA100C 		vmovss	(%rsi,%rax), %xmm1
+ 1539      06
+ 1540 1365 C4E37121 		vinsertps	$0x10, (%rdi,%rax), %xmm1, %xmm1
+ 1540      0C0710
+ 1541 136c C5F85AC9 		vcvtps2pd	%xmm1, %xmm1
+ 1542 1370 C5C159C1 		vmulpd	%xmm1, %xmm7, %xmm0
+ 1543 1374 C5F958C2 		vaddpd	%xmm2, %xmm0, %xmm0
+ 1544 1378 C5F159D4 		vmulpd	%xmm4, %xmm1, %xmm2
+ 1545 137c C5C959C9 		vmulpd	%xmm1, %xmm6, %xmm1
+ 1546 1380 C5E958D3 		vaddpd	%xmm3, %xmm2, %xmm2
+ 1547 1384 C4C17959 		vmulpd	%xmm8, %xmm0, %xmm3
+ 1547      D8
+ 1548 1389 C5E95CD3 		vsubpd	%xmm3, %xmm2, %xmm2
+ 1549 138d C5F959DD 		vmulpd	%xmm5, %xmm0, %xmm3
+ 1550 1391 C5F15CDB 		vsubpd	%xmm3, %xmm1, %xmm3
+ 1551 1395 C5FB5AC8 		vcvtsd2ss	%xmm0, %xmm0, %xmm1
+ 1552 1399 C5F915C0 		vunpckhpd	%xmm0, %xmm0, %xmm0
+ 1553 139d C5FA110C 		vmovss	%xmm1, (%rcx,%rax)
+ 1553      01
+ 1554 13a2 C5FB5AC0 		vcvtsd2ss	%xmm0, %xmm0, %xmm0
+ 1555 13a6 C4C17A11 		vmovss	%xmm0, (%r8,%rax)
+ 1555      0400
+ 1556 13ac 4883C004 		addq	$4, %rax
+ 1557 13b0 483D0002 		cmpq	$512, %rax
+ 1557      0000
+ 1558 13b6 75A8     		jne	.L184
+ 1559 13b8 C5E310C3 		vmovsd	%xmm3, %xmm3, %xmm0
+ 1560 13bc C5E915CA 		vunpckhpd	%xmm2, %xmm2, %xmm1
+ 1561 13c0 C5E310D9 		vmovsd	%xmm1, %xmm3, %xmm3
+ 1562 13c4 C5E914D0 		vunpcklpd	%xmm0, %xmm2, %xmm2
+ 1563 13c8 C4E36D18 		vinsertf128	$0x1, %xmm3, %ymm2, %ymm2
+ 1563      D301
+ 1564 13ce C4C17D11 		vmovupd	%ymm2, 96(%r9)
+ 1564      5160
+ 1565 13d4 C5F877   		vzeroupper
+ 1566              	.L193:
+ 1567 13d7 5B       		popq	%rbx
+ 1568 13d8 415C     		popq	%r12
+ 1569 13da 5D       		popq	%rbp
+ 1570              		.cfi_remember_state
+ 1571              		.cfi_def_cfa 7, 8
+ 1572 13db C3       		ret
+ 1573 13dc 0F1F4000 		.p2align 4,,10
+ 1574              		.p2align 3
+ 1575              	.L179:
+ 1576              		.cfi_restore_state
+ 1577 13e0 C5FA7E05 		vmovq	.LC0(%rip), %xmm0
+ 1577      00000000 
+ 1578 13e8 C5E954C8 		vandpd	%xmm0, %xmm2, %xmm1
+ 1579 13ec C5E154C0 		vandpd	%xmm0, %xmm3, %xmm0
+ 1580 13f0 C5F358C0 		vaddsd	%xmm0, %xmm1, %xmm0
+ 1581 13f4 C5FB100D 		vmovsd	.LC1(%rip), %xmm1
+ 1581      00000000 
+ 1582 13fc C5F92FC8 		vcomisd	%xmm0, %xmm1
+ 1583 1400 0F861EFF 		jbe	.L181
+ 1583      FFFF
+ 1584 1406 C5F957C0 		vxorpd	%xmm0, %xmm0, %xmm0
+ 1585 140a C4C17929 		vmovapd	%xmm0, 112(%r9)
+ 1585      4170
+ 1586 1410 C6430101 		movb	$1, 1(%rbx)
+ 1587 1414 4585E4   		testl	%r12d, %r12d
+ 1588 1417 7465     		je	.L187
+ 1589 1419 488D7908 		leaq	8(%rcx), %rdi
+ 1590 141d 48C70100 		movq	$0, (%rcx)
+ 1590      000000
+ 1591 1424 31C0     		xorl	%eax, %eax
+ 1592 1426 48C781F8 		movq	$0, 504(%rcx)
+ 1592      01000000 
+ 1592      000000
+ 1593 1431 4883E7F8 		andq	$-8, %rdi
+ 1594 1435 4829F9   		subq	%rdi, %rcx
+ 1595 1438 81C10002 		addl	$512, %ecx
+ 1595      0000
+ 1596 143e C1E903   		shrl	$3, %ecx
+ 1597 1441 F348AB   		rep stosq
+ 1598 1444 488B5250 		movq	80(%rdx), %rdx
+ 1599 1448 488D7A08 		leaq	8(%rdx), %rdi
+ 1600 144c 48C70200 		movq	$0, (%rdx)
+ 1600      000000
+ 1601 1453 48C782F8 		movq	$0, 504(%rdx)
+ 1601      01000000 
+ 1601      000000
+ 1602 145e 4883E7F8 		andq	$-8, %rdi
+ 1603 1462 4829FA   		subq	%rdi, %rdx
+ 1604 1465 8D8A0002 		leal	512(%rdx), %ecx
+ 1604      0000
+ 1605 146b C1E903   		shrl	$3, %ecx
+ 1606 146e F348AB   		rep stosq
+ 1607 1471 E961FFFF 		jmp	.L193
+ 1607      FF
+ 1608              	.L192:
+ 1609 1476 4531D2   		xorl	%r10d, %r10d
+ 1610 1479 E985FEFF 		jmp	.L177
+ 1610      FF
+ 1611              	.L187:
+ 1612 147e C5E157DB 		vxorpd	%xmm3, %xmm3, %xmm3
+ 1613 1482 C5E310D3 		vmovsd	%xmm3, %xmm3, %xmm2
+ 1614 1486 E99DFEFF 		jmp	.L180
+ 1614      FF
+ 1615              		.cfi_endproc
+ 1616              	.LFE20:
+ 1618 148b 0F1F4400 		.p2align 4
+ 1618      00
+ 1620              	iir_process_2_256:
+ 1621              	.LFB21:
+ 1622              		.cfi_startproc
+ 1623 1490 81BFA400 		cmpl	$256, 164(%rdi)
+ 1623      00000001 
+ 1623      0000
+ 1624 149a 4889FA   		movq	%rdi, %rdx
+ 1625 149d 7521     		jne	.L199
+ 1626 149f 488B7708 		movq	8(%rdi), %rsi
+ 1627 14a3 488B4F48 		movq	72(%rdi), %rcx
+ 1628 14a7 488B7F10 		movq	16(%rdi), %rdi
+ 1629 14ab 4C8B4250 		movq	80(%rdx), %r8
+ 1630 14af 4889F0   		movq	%rsi, %rax
+ 1631 14b2 4809C8   		orq	%rcx, %rax
+ 1632 14b5 4809F8   		orq	%rdi, %rax
+ 1633 14b8 4C09C0   		orq	%r8, %rax
+ 1634 14bb 83E01F   		andl	$31, %eax
+ 1635 14be 7410     		je	.L220
+ 1636              	.L199:
+ 1637 14c0 4889D7   		movq	%rdx, %rdi
+ 1638 14c3 E9000000 		jmp	iir_process@PLT
+ 1638      00
+ 1639 14c8 0F1F8400 		.p2align 4,,10
+ 1639      00000000 
+ 1640              		.p2align 3
+ 1641              	.L220:
+ 1642 14d0 55       		pushq	%rbp
+ 1643              		.cfi_def_cfa_offset 16
+ 1644              		.cfi_offset 6, -16
+ 1645 14d1 4889E5   		movq	%rsp, %rbp
+ 1646              		.cfi_def_cfa_register 6
+ 1647 14d4 4154     		pushq	%r12
+ 1648              		.cfi_offset 12, -24
+ 1649 14d6 4531E4   		xorl	%r12d, %r12d
+ 1650 14d9 53       		pushq	%rbx
+ 1651              		.cfi_offset 3, -32
+ 1652 14da 4C8B9A88 		movq	136(%rdx), %r11
+ 1652      000000
+ 1653 14e1 4C8B8AC0 		movq	192(%rdx), %r9
+ 1653      000000
+ 1654 14e8 450FB613 		movzbl	(%r11), %r10d
+ 1655 14ec 4584D2   		testb	%r10b, %r10b
+ 1656 14ef 7442     		je	.L200
+ 1657 14f1 C4C17B10 		vmovsd	96(%r9), %xmm0
+ 1657      4160
+ 1658 14f7 C4C17B10 		vmovsd	104(%r9), %xmm1
+ 1658      4968
+ 1659 14fd C5FA7E15 		vmovq	.LC0(%rip), %xmm2
+ 1659      00000000 
+ 1660 1505 C5F154CA 		vandpd	%xmm2, %xmm1, %xmm1
+ 1661 1509 C5F954C2 		vandpd	%xmm2, %xmm0, %xmm0
+ 1662 150d C5FB58C1 		vaddsd	%xmm1, %xmm0, %xmm0
+ 1663 1511 C5FB100D 		vmovsd	.LC1(%rip), %xmm1
+ 1663      00000000 
+ 1664 1519 C5F92FC8 		vcomisd	%xmm0, %xmm1
+ 1665 151d 0F868301 		jbe	.L215
+ 1665      0000
+ 1666 1523 C5F957C0 		vxorpd	%xmm0, %xmm0, %xmm0
+ 1667 1527 41BC0100 		movl	$1, %r12d
+ 1667      0000
+ 1668 152d C4C17929 		vmovapd	%xmm0, 96(%r9)
+ 1668      4160
+ 1669              	.L200:
+ 1670 1533 488B9A90 		movq	144(%rdx), %rbx
+ 1670      000000
+ 1671 153a C4C17B10 		vmovsd	112(%r9), %xmm2
+ 1671      5170
+ 1672 1540 C4C17B10 		vmovsd	120(%r9), %xmm3
+ 1672      5978
+ 1673 1546 448813   		movb	%r10b, (%rbx)
+ 1674 1549 41807B01 		cmpb	$0, 1(%r11)
+ 1674      00
+ 1675 154e 0F85BC00 		jne	.L202
+ 1675      0000
+ 1676              	.L204:
+ 1677 1554 C6430100 		movb	$0, 1(%rbx)
+ 1678              	.L203:
+ 1679 1558 C4C17B10 		vmovsd	96(%r9), %xmm0
+ 1679      4160
+ 1680 155e C4437905 		vpermilpd	$0, 48(%r9), %xmm8
+ 1680      413000
+ 1681 1565 C4C37905 		vpermilpd	$3, 48(%r9), %xmm5
+ 1681      693003
+ 1682 156c C4C37905 		vpermilpd	$0, 64(%r9), %xmm7
+ 1682      794000
+ 1683 1573 C5F914D2 		vunpcklpd	%xmm2, %xmm0, %xmm2
+ 1684 1577 C4C17B10 		vmovsd	104(%r9), %xmm0
+ 1684      4168
+ 1685 157d C4C37905 		vpermilpd	$3, 64(%r9), %xmm4
+ 1685      614003
+ 1686 1584 C4C37905 		vpermilpd	$0, 80(%r9), %xmm6
+ 1686      715000
+ 1687 158b C5F914DB 		vunpcklpd	%xmm3, %xmm0, %xmm3
+ 1688 158f 90       		.p2align 4,,10
+ 1689              		.p2align 3
+ 1690              	.L207:
+ 1691 1590 C5FA100C 		vmovss	(%rsi,%rax), %xmm1
+ 1691      06
+ 1692 1595 C4E37121 		vinsertps	$0x10, (%rdi,%rax), %xmm1, %xmm1
+ 1692      0C0710
+ 1693 159c C5F85AC9 		vcvtps2pd	%xmm1, %xmm1
+ 1694 15a0 C5C159C1 		vmulpd	%xmm1, %xmm7, %xmm0
+ 1695 15a4 C5F958C2 		vaddpd	%xmm2, %xmm0, %xmm0
+ 1696 15a8 C5F159D4 		vmulpd	%xmm4, %xmm1, %xmm2
+ 1697 15ac C5C959C9 		vmulpd	%xmm1, %xmm6, %xmm1
+ 1698 15b0 C5E958D3 		vaddpd	%xmm3, %xmm2, %xmm2
+ 1699 15b4 C4C17959 		vmulpd	%xmm8, %xmm0, %xmm3
+ 1699      D8
+ 1700 15b9 C5E95CD3 		vsubpd	%xmm3, %xmm2, %xmm2
+ 1701 15bd C5F959DD 		vmulpd	%xmm5, %xmm0, %xmm3
+ 1702 15c1 C5F15CDB 		vsubpd	%xmm3, %xmm1, %xmm3
+ 1703 15c5 C5FB5AC8 		vcvtsd2ss	%xmm0, %xmm0, %xmm1
+ 1704 15c9 C5F915C0 		vunpckhpd	%xmm0, %xmm0, %xmm0
+ 1705 15cd C5FA110C 		vmovss	%xmm1, (%rcx,%rax)
+ 1705      01
+ 1706 15d2 C5FB5AC0 		vcvtsd2ss	%xmm0, %xmm0, %xmm0
+ 1707 15d6 C4C17A11 		vmovss	%xmm0, (%r8,%rax)
+ 1707      0400
+ 1708 15dc 4883C004 		addq	$4, %rax
+ 1709 15e0 483D0004 		cmpq	$1024, %rax
+ 1709      0000
+ 1710 15e6 75A8     		jne	.L207
+ 1711 15e8 C5E310C3 		vmovsd	%xmm3, %xmm3, %xmm0
+ 1712 15ec C5E915CA 		vunpckhpd	%xmm2, %xmm2, %xmm1
+ 1713 15f0 C5E310D9 		vmovsd	%xmm1, %xmm3, %xmm3
+ 1714 15f4 C5E914D0 		vunpcklpd	%xmm0, %xmm2, %xmm2
+ 1715 15f8 C4E36D18 		vinsertf128	$0x1, %xmm3, %ymm2, %ymm2
+ 1715      D301
+ 1716 15fe C4C17D11 		vmovupd	%ymm2, 96(%r9)
+ 1716      5160
+ 1717 1604 C5F877   		vzeroupper
+ 1718              	.L216:
+ 1719 1607 5B       		popq	%rbx
+ 1720 1608 415C     		popq	%r12
+ 1721 160a 5D       		popq	%rbp
+ 1722              		.cfi_remember_state
+ 1723              		.cfi_def_cfa 7, 8
+ 1724 160b C3       		ret
+ 1725 160c 0F1F4000 		.p2align 4,,10
+ 1726              		.p2align 3
+ 1727              	.L202:
+ 1728              		.cfi_restore_state
+ 1729 1610 C5FA7E05 		vmovq	.LC0(%rip), %xmm0
+ 1729      00000000 
+ 1730 1618 C5E954C8 		vandpd	%xmm0, %xmm2, %xmm1
+ 1731 161c C5E154C0 		vandpd	%xmm0, %xmm3, %xmm0
+ 1732 1620 C5F358C0 		vaddsd	%xmm0, %xmm1, %xmm0
+ 1733 1624 C5FB100D 		vmovsd	.LC1(%rip), %xmm1
+ 1733      00000000 
+ 1734 162c C5F92FC8 		vcomisd	%xmm0, %xmm1
+ 1735 1630 0F861EFF 		jbe	.L204
+ 1735      FFFF
+ 1736 1636 C5F957C0 		vxorpd	%xmm0, %xmm0, %xmm0
+ 1737 163a C4C17929 		vmovapd	%xmm0, 112(%r9)
+ 1737      4170
+ 1738 1640 C6430101 		movb	$1, 1(%rbx)
+ 1739 1644 4585E4   		testl	%r12d, %r12d
+ 1740 1647 7465     		je	.L210
+ 1741 1649 488D7908 		leaq	8(%rcx), %rdi
+ 1742 164d 48C70100 		movq	$0, (%rcx)
+ 1742      000000
+ 1743 1654 31C0     		xorl	%eax, %eax
+ 1744 1656 48C781F8 		movq	$0, 1016(%rcx)
+ 1744      03000000 
+ 1744      000000
+ 1745 1661 4883E7F8 		andq	$-8, %rdi
+ 1746 1665 4829F9   		subq	%rdi, %rcx
+ 1747 1668 81C10004 		addl	$1024, %ecx
+ 1747      0000
+ 1748 166e C1E903   		shrl	$3, %ecx
+ 1749 1671 F348AB   		rep stosq
+ 1750 1674 488B5250 		movq	80(%rdx), %rdx
+ 1751 1678 488D7A08 		leaq	8(%rdx), %rdi
+ 1752 167c 48C70200 		movq	$0, (%rdx)
+ 1752      000000
+ 1753 1683 48C782F8 		movq	$0, 1016(%rdx)
+ 1753      03000000 
+ 1753      000000
+ 1754 168e 4883E7F8 		andq	$-8, %rdi
+ 1755 1692 4829FA   		subq	%rdi, %rdx
+ 1756 1695 8D8A0004 		leal	1024(%rdx), %ecx
+ 1756      0000
+ 1757 169b C1E903   		shrl	$3, %ecx
+ 1758 169e F348AB   		rep stosq
+ 1759 16a1 E961FFFF 		jmp	.L216
+ 1759      FF
+ 1760              	.L215:
+ 1761 16a6 4531D2   		xorl	%r10d, %r10d
+ 1762 16a9 E985FEFF 		jmp	.L200
+ 1762      FF
+ 1763              	.L210:
+ 1764 16ae C5E157DB 		vxorpd	%xmm3, %xmm3, %xmm3
+ 1765 16b2 C5E310D3 		vmovsd	%xmm3, %xmm3, %xmm2
+ 1766 16b6 E99DFEFF 		jmp	.L203
+ 1766      FF
+ 1767              		.cfi_endproc
+ 1768              	.LFE21:
+ 1770              		.section	.rodata.str1.1
+ 1771              	.LC20:
+ 1772 001e 25732069 		.string	"%s iir type is %d\n"
+ 1772      69722074 
+ 1772      79706520 
+ 1772      69732025 
+ 1772      640A00
+ 1773              		.section	.rodata.str1.8
+ 1774 01d6 0000     		.align 8
+ 1775              	.LC21:
+ 1776 01d8 25732066 		.string	"%s fs=%d, w0=%.3f, alpha=%.3f, cosw0=%.3f\n"
+ 1776      733D2564 
+ 1776      2C207730 
+ 1776      3D252E33 
+ 1776      662C2061 
+ 1777 0203 00000000 		.align 8
+ 1777      00
+ 1778              	.LC31:
+ 1779 0208 25732063 		.string	"%s coeffs: b0=%.4g, b1=%.4g, b2=%.4g, a1=%.4g, a2=%.4g\n"
+ 1779      6F656666 
+ 1779      733A2062 
+ 1779      303D252E 
+ 1779      34672C20 
+ 1780              		.text
+ 1781 16bb 0F1F4400 		.p2align 4
+ 1781      00
+ 1782              		.globl	calc_coeffs
+ 1784              	calc_coeffs:
+ 1785              	.LFB14:
+ 1786              		.cfi_startproc
+ 1787 16c0 4C8D5424 		leaq	8(%rsp), %r10
+ 1787      08
+ 1788              		.cfi_def_cfa 10, 0
+ 1789 16c5 4883E4E0 		andq	$-32, %rsp
+ 1790 16c9 41FF72F8 		pushq	-8(%r10)
+ 1791 16cd 55       		pushq	%rbp
+ 1792 16ce 4889E5   		movq	%rsp, %rbp
+ 1793              		.cfi_escape 0x10,0x6,0x2,0x76,0
+ 1794 16d1 4155     		pushq	%r13
+ 1795              		.cfi_escape 0x10,0xd,0x2,0x76,0x78
+ 1796 16d3 4189F5   		movl	%esi, %r13d
+ 1797 16d6 4154     		pushq	%r12
+ 1798              		.cfi_escape 0x10,0xc,0x2,0x76,0x70
+ 1799 16d8 4989FC   		movq	%rdi, %r12
+ 1800 16db 4152     		pushq	%r10
+ 1801              		.cfi_escape 0xf,0x3,0x76,0x68,0x6
+ 1802 16dd 53       		pushq	%rbx
+ 1803 16de 4881EC90 		subq	$144, %rsp
+ 1803      000000
+ 1804              		.cfi_escape 0x10,0x3,0x2,0x76,0x60
+ 1805 16e5 C5FB104F 		vmovsd	40(%rdi), %xmm1
+ 1805      28
+ 1806 16ea C5FB1005 		vmovsd	.LC18(%rip), %xmm0
+ 1806      00000000 
+ 1807 16f2 C5F35E0D 		vdivsd	.LC17(%rip), %xmm1, %xmm1
+ 1807      00000000 
+ 1808 16fa E8000000 		call	pow@PLT
+ 1808      00
+ 1809 16ff C5FB10E0 		vmovsd	%xmm0, %xmm0, %xmm4
+ 1810 1703 C5F957C0 		vxorpd	%xmm0, %xmm0, %xmm0
+ 1811 1707 C5F92EC4 		vucomisd	%xmm4, %xmm0
+ 1812 170b 0F87F403 		ja	.L245
+ 1812      0000
+ 1813 1711 C5DB51FC 		vsqrtsd	%xmm4, %xmm4, %xmm7
+ 1814              	.L224:
+ 1815 1715 C5F857C0 		vxorps	%xmm0, %xmm0, %xmm0
+ 1816 1719 C5FB117D 		vmovsd	%xmm7, -104(%rbp)
+ 1816      98
+ 1817 171e 488D7DC8 		leaq	-56(%rbp), %rdi
+ 1818 1722 C5FB103D 		vmovsd	.LC19(%rip), %xmm7
+ 1818      00000000 
+ 1819 172a C4C17B2A 		vcvtsi2sdl	%r13d, %xmm0, %xmm0
+ 1819      C5
+ 1820 172f 488D75C0 		leaq	-64(%rbp), %rsi
+ 1821 1733 C5FB1165 		vmovsd	%xmm4, -96(%rbp)
+ 1821      A0
+ 1822 1738 488D1D00 		leaq	__func__.2(%rip), %rbx
+ 1822      000000
+ 1823 173f C5FB10E8 		vmovsd	%xmm0, %xmm0, %xmm5
+ 1824 1743 C5FB1145 		vmovsd	%xmm0, -112(%rbp)
+ 1824      90
+ 1825 1748 C4C14359 		vmulsd	8(%r12), %xmm7, %xmm0
+ 1825      442408
+ 1826 174f C5FB5EF5 		vdivsd	%xmm5, %xmm0, %xmm6
+ 1827 1753 C5CB10C6 		vmovsd	%xmm6, %xmm6, %xmm0
+ 1828 1757 C5FB1175 		vmovsd	%xmm6, -88(%rbp)
+ 1828      A8
+ 1829 175c E8000000 		call	sincos@PLT
+ 1829      00
+ 1830 1761 418B0C24 		movl	(%r12), %ecx
+ 1831 1765 31C0     		xorl	%eax, %eax
+ 1832 1767 4889DA   		movq	%rbx, %rdx
+ 1833 176a C4C17B10 		vmovsd	24(%r12), %xmm0
+ 1833      442418
+ 1834 1771 C5FB104D 		vmovsd	-56(%rbp), %xmm1
+ 1834      C8
+ 1835 1776 488D3500 		leaq	.LC20(%rip), %rsi
+ 1835      000000
+ 1836 177d BF010000 		movl	$1, %edi
+ 1836      00
+ 1837 1782 C5FB107D 		vmovsd	-64(%rbp), %xmm7
+ 1837      C0
+ 1838 1787 C5FB58C0 		vaddsd	%xmm0, %xmm0, %xmm0
+ 1839 178b C5FB117D 		vmovsd	%xmm7, -80(%rbp)
+ 1839      B0
+ 1840 1790 C5F35EE0 		vdivsd	%xmm0, %xmm1, %xmm4
+ 1841 1794 C5FB1165 		vmovsd	%xmm4, -72(%rbp)
+ 1841      B8
+ 1842 1799 E8000000 		call	debugprint@PLT
+ 1842      00
+ 1843 179e 4489E9   		movl	%r13d, %ecx
+ 1844 17a1 4889DA   		movq	%rbx, %rdx
+ 1845 17a4 BF010000 		movl	$1, %edi
+ 1845      00
+ 1846 17a9 C5FB1055 		vmovsd	-80(%rbp), %xmm2
+ 1846      B0
+ 1847 17ae C5FB104D 		vmovsd	-72(%rbp), %xmm1
+ 1847      B8
+ 1848 17b3 488D3500 		leaq	.LC21(%rip), %rsi
+ 1848      000000
+ 1849 17ba B8030000 		movl	$3, %eax
+ 1849      00
+ 1850 17bf C5FB1045 		vmovsd	-88(%rbp), %xmm0
+ 1850      A8
+ 1851 17c4 E8000000 		call	debugprint@PLT
+ 1851      00
+ 1852 17c9 41833C24 		cmpl	$11, (%r12)
+ 1852      0B
+ 1853 17ce 7720     		ja	.L241
+ 1854 17d0 418B0424 		movl	(%r12), %eax
+ 1855 17d4 488D1500 		leaq	.L227(%rip), %rdx
+ 1855      000000
+ 1856 17db C5FB1065 		vmovsd	-96(%rbp), %xmm4
+ 1856      A0
+ 1857 17e0 C5FB107D 		vmovsd	-104(%rbp), %xmm7
+ 1857      98
+ 1858 17e5 48630482 		movslq	(%rdx,%rax,4), %rax
+ 1859 17e9 4801D0   		addq	%rdx, %rax
+ 1860 17ec FFE0     		jmp	*%rax
+ 1861              		.section	.rodata
+ 1862              		.align 4
+ 1863              		.align 4
+ 1864              	.L227:
+ 1865 0014 00000000 		.long	.L241-.L227
+ 1866 0018 00000000 		.long	.L233-.L227
+ 1867 001c 00000000 		.long	.L232-.L227
+ 1868 0020 00000000 		.long	.L231-.L227
+ 1869 0024 00000000 		.long	.L230-.L227
+ 1870 0028 00000000 		.long	.L241-.L227
+ 1871 002c 00000000 		.long	.L241-.L227
+ 1872 0030 00000000 		.long	.L241-.L227
+ 1873 0034 00000000 		.long	.L241-.L227
+ 1874 0038 00000000 		.long	.L229-.L227
+ 1875 003c 00000000 		.long	.L228-.L227
+ 1876 0040 00000000 		.long	.L226-.L227
+ 1877              		.text
+ 1878 17ee 6690     		.p2align 4,,10
+ 1879              		.p2align 3
+ 1880              	.L241:
+ 1881 17f0 B8010000 		movl	$1, %eax
+ 1881      00
+ 1882              	.L221:
+ 1883 17f5 4881C490 		addq	$144, %rsp
+ 1883      000000
+ 1884 17fc 5B       		popq	%rbx
+ 1885 17fd 415A     		popq	%r10
+ 1886              		.cfi_remember_state
+ 1887              		.cfi_def_cfa 10, 0
+ 1888 17ff 415C     		popq	%r12
+ 1889 1801 415D     		popq	%r13
+ 1890 1803 5D       		popq	%rbp
+ 1891 1804 498D62F8 		leaq	-8(%r10), %rsp
+ 1892              		.cfi_def_cfa 7, 8
+ 1893 1808 C3       		ret
+ 1894 1809 0F1F8000 		.p2align 4,,10
+ 1894      000000
+ 1895              		.p2align 3
+ 1896              	.L226:
+ 1897              		.cfi_restore_state
+ 1898 1810 C5FB1055 		vmovsd	-72(%rbp), %xmm2
+ 1898      B8
+ 1899 1815 C5FB107D 		vmovsd	-80(%rbp), %xmm7
+ 1899      B0
+ 1900 181a C57B1005 		vmovsd	.LC22(%rip), %xmm8
+ 1900      00000000 
+ 1901 1822 C5C3590D 		vmulsd	.LC24(%rip), %xmm7, %xmm1
+ 1901      00000000 
+ 1902 182a C5BB5CDA 		vsubsd	%xmm2, %xmm8, %xmm3
+ 1903 182e C53B58C2 		vaddsd	%xmm2, %xmm8, %xmm8
+ 1904 1832 C5E359EC 		vmulsd	%xmm4, %xmm3, %xmm5
+ 1905 1836 C5F359F4 		vmulsd	%xmm4, %xmm1, %xmm6
+ 1906 183a C5BB59D4 		vmulsd	%xmm4, %xmm8, %xmm2
+ 1907 183e 6690     		.p2align 4,,10
+ 1908              		.p2align 3
+ 1909              	.L234:
+ 1910 1840 C5D114EE 		vunpcklpd	%xmm6, %xmm5, %xmm5
+ 1911 1844 C5F114CB 		vunpcklpd	%xmm3, %xmm1, %xmm1
+ 1912 1848 B8050000 		movl	$5, %eax
+ 1912      00
+ 1913 184d 4889DA   		movq	%rbx, %rdx
+ 1914 1850 C4C16B5E 		vdivsd	%xmm8, %xmm2, %xmm2
+ 1914      D0
+ 1915 1855 C4C27D19 		vbroadcastsd	%xmm8, %ymm0
+ 1915      C0
+ 1916 185a C4E37518 		vinsertf128	$0x1, %xmm5, %ymm1, %ymm1
+ 1916      CD01
+ 1917 1860 BF010000 		movl	$1, %edi
+ 1917      00
+ 1918 1865 488D3500 		leaq	.LC31(%rip), %rsi
+ 1918      000000
+ 1919 186c C5F55EC8 		vdivpd	%ymm0, %ymm1, %ymm1
+ 1920 1870 C4C17B11 		vmovsd	%xmm2, 80(%r12)
+ 1920      542450
+ 1921 1877 62F3FD28 		vextractf64x2	$1, %ymm1, %xmm0
+ 1921      19C801
+ 1922 187e C5F928D9 		vmovapd	%xmm1, %xmm3
+ 1923 1882 C5F115E1 		vunpckhpd	%xmm1, %xmm1, %xmm4
+ 1924 1886 C4C17D11 		vmovupd	%ymm1, 48(%r12)
+ 1924      4C2430
+ 1925 188d 62F3F528 		valignq	$3, %ymm1, %ymm1, %ymm1
+ 1925      03C903
+ 1926 1894 C5F877   		vzeroupper
+ 1927 1897 E8000000 		call	debugprint@PLT
+ 1927      00
+ 1928 189c 31C0     		xorl	%eax, %eax
+ 1929 189e E952FFFF 		jmp	.L221
+ 1929      FF
+ 1930              		.p2align 4,,10
+ 1931 18a3 0F1F4400 		.p2align 3
+ 1931      00
+ 1932              	.L233:
+ 1933 18a8 C5FB101D 		vmovsd	.LC22(%rip), %xmm3
+ 1933      00000000 
+ 1934 18b0 C5FB1055 		vmovsd	-80(%rbp), %xmm2
+ 1934      B0
+ 1935 18b5 C5E35CF2 		vsubsd	%xmm2, %xmm3, %xmm6
+ 1936 18b9 C5CB592D 		vmulsd	.LC23(%rip), %xmm6, %xmm5
+ 1936      00000000 
+ 1937 18c1 C5D359EC 		vmulsd	%xmm4, %xmm5, %xmm5
+ 1938              	.L249:
+ 1939 18c5 C5FB107D 		vmovsd	-72(%rbp), %xmm7
+ 1939      B8
+ 1940 18ca C5EB590D 		vmulsd	.LC24(%rip), %xmm2, %xmm1
+ 1940      00000000 
+ 1941 18d2 C5D310D5 		vmovsd	%xmm5, %xmm5, %xmm2
+ 1942 18d6 C5CB59F4 		vmulsd	%xmm4, %xmm6, %xmm6
+ 1943 18da C56358C7 		vaddsd	%xmm7, %xmm3, %xmm8
+ 1944 18de C5E35CDF 		vsubsd	%xmm7, %xmm3, %xmm3
+ 1945 18e2 E959FFFF 		jmp	.L234
+ 1945      FF
+ 1946 18e7 660F1F84 		.p2align 4,,10
+ 1946      00000000 
+ 1946      00
+ 1947              		.p2align 3
+ 1948              	.L232:
+ 1949 18f0 C5FB101D 		vmovsd	.LC22(%rip), %xmm3
+ 1949      00000000 
+ 1950 18f8 C5FB1055 		vmovsd	-80(%rbp), %xmm2
+ 1950      B0
+ 1951 18fd C5E358F2 		vaddsd	%xmm2, %xmm3, %xmm6
+ 1952 1901 C5CB592D 		vmulsd	.LC23(%rip), %xmm6, %xmm5
+ 1952      00000000 
+ 1953 1909 C5C95735 		vxorpd	.LC25(%rip), %xmm6, %xmm6
+ 1953      00000000 
+ 1954 1911 C5D359EC 		vmulsd	%xmm4, %xmm5, %xmm5
+ 1955 1915 EBAE     		jmp	.L249
+ 1956 1917 660F1F84 		.p2align 4,,10
+ 1956      00000000 
+ 1956      00
+ 1957              		.p2align 3
+ 1958              	.L231:
+ 1959 1920 C57B1015 		vmovsd	.LC22(%rip), %xmm10
+ 1959      00000000 
+ 1960 1928 C5FB1075 		vmovsd	-80(%rbp), %xmm6
+ 1960      B0
+ 1961 192d C5F957C0 		vxorpd	%xmm0, %xmm0, %xmm0
+ 1962 1931 C5F92EC7 		vucomisd	%xmm7, %xmm0
+ 1963 1935 C4C14358 		vaddsd	%xmm10, %xmm7, %xmm3
+ 1963      DA
+ 1964 193a C441435C 		vsubsd	%xmm10, %xmm7, %xmm10
+ 1964      D2
+ 1965 193f C5AB59E6 		vmulsd	%xmm6, %xmm10, %xmm4
+ 1966 1943 C5E35CD4 		vsubsd	%xmm4, %xmm3, %xmm2
+ 1967 1947 0F871703 		ja	.L246
+ 1967      0000
+ 1968 194d C5E359CE 		vmulsd	%xmm6, %xmm3, %xmm1
+ 1969 1951 C54351CF 		vsqrtsd	%xmm7, %xmm7, %xmm9
+ 1970 1955 C5C358F7 		vaddsd	%xmm7, %xmm7, %xmm6
+ 1971 1959 C5E358DC 		vaddsd	%xmm4, %xmm3, %xmm3
+ 1972 195d C4413358 		vaddsd	%xmm9, %xmm9, %xmm9
+ 1972      C9
+ 1973 1962 C533594D 		vmulsd	-72(%rbp), %xmm9, %xmm9
+ 1973      B8
+ 1974 1967 C5AB5CC1 		vsubsd	%xmm1, %xmm10, %xmm0
+ 1975 196b C5AB58C9 		vaddsd	%xmm1, %xmm10, %xmm1
+ 1976 196f C5F3590D 		vmulsd	.LC24(%rip), %xmm1, %xmm1
+ 1976      00000000 
+ 1977 1977 C4C16B58 		vaddsd	%xmm9, %xmm2, %xmm5
+ 1977      E9
+ 1978 197c C4C16B5C 		vsubsd	%xmm9, %xmm2, %xmm2
+ 1978      D1
+ 1979 1981 C5CB59F0 		vmulsd	%xmm0, %xmm6, %xmm6
+ 1980 1985 C4416358 		vaddsd	%xmm9, %xmm3, %xmm8
+ 1980      C1
+ 1981 198a C5D359EF 		vmulsd	%xmm7, %xmm5, %xmm5
+ 1982 198e C5EB59D7 		vmulsd	%xmm7, %xmm2, %xmm2
+ 1983              	.L240:
+ 1984 1992 C4C1635C 		vsubsd	%xmm9, %xmm3, %xmm3
+ 1984      D9
+ 1985 1997 E9A4FEFF 		jmp	.L234
+ 1985      FF
+ 1986 199c 0F1F4000 		.p2align 4,,10
+ 1987              		.p2align 3
+ 1988              	.L230:
+ 1989 19a0 C5FB1005 		vmovsd	.LC22(%rip), %xmm0
+ 1989      00000000 
+ 1990 19a8 C5FB1075 		vmovsd	-80(%rbp), %xmm6
+ 1990      B0
+ 1991 19ad C5435CD0 		vsubsd	%xmm0, %xmm7, %xmm10
+ 1992 19b1 C5C358D8 		vaddsd	%xmm0, %xmm7, %xmm3
+ 1993 19b5 C5F957C0 		vxorpd	%xmm0, %xmm0, %xmm0
+ 1994 19b9 C5F92EC7 		vucomisd	%xmm7, %xmm0
+ 1995 19bd C5AB59E6 		vmulsd	%xmm6, %xmm10, %xmm4
+ 1996 19c1 C5E358D4 		vaddsd	%xmm4, %xmm3, %xmm2
+ 1997 19c5 0F875601 		ja	.L247
+ 1997      0000
+ 1998 19cb C5E359CE 		vmulsd	%xmm6, %xmm3, %xmm1
+ 1999 19cf C54351CF 		vsqrtsd	%xmm7, %xmm7, %xmm9
+ 2000 19d3 C5E35CDC 		vsubsd	%xmm4, %xmm3, %xmm3
+ 2001 19d7 C5C35935 		vmulsd	.LC24(%rip), %xmm7, %xmm6
+ 2001      00000000 
+ 2002 19df C4413358 		vaddsd	%xmm9, %xmm9, %xmm9
+ 2002      C9
+ 2003 19e4 C533594D 		vmulsd	-72(%rbp), %xmm9, %xmm9
+ 2003      B8
+ 2004 19e9 C5AB58C1 		vaddsd	%xmm1, %xmm10, %xmm0
+ 2005 19ed C5AB5CC9 		vsubsd	%xmm1, %xmm10, %xmm1
+ 2006 19f1 C4C16B58 		vaddsd	%xmm9, %xmm2, %xmm5
+ 2006      E9
+ 2007 19f6 C4C16B5C 		vsubsd	%xmm9, %xmm2, %xmm2
+ 2007      D1
+ 2008 19fb C5CB59F0 		vmulsd	%xmm0, %xmm6, %xmm6
+ 2009 19ff C4416358 		vaddsd	%xmm9, %xmm3, %xmm8
+ 2009      C1
+ 2010 1a04 C5F358C9 		vaddsd	%xmm1, %xmm1, %xmm1
+ 2011 1a08 C5D359EF 		vmulsd	%xmm7, %xmm5, %xmm5
+ 2012 1a0c C5EB59D7 		vmulsd	%xmm7, %xmm2, %xmm2
+ 2013 1a10 EB80     		jmp	.L240
+ 2014              		.p2align 4,,10
+ 2015 1a12 660F1F44 		.p2align 3
+ 2015      0000
+ 2016              	.L229:
+ 2017 1a18 C5FB1065 		vmovsd	-72(%rbp), %xmm4
+ 2017      B8
+ 2018 1a1d C5FB1075 		vmovsd	-80(%rbp), %xmm6
+ 2018      B0
+ 2019 1a22 C5CB5935 		vmulsd	.LC24(%rip), %xmm6, %xmm6
+ 2019      00000000 
+ 2020 1a2a C5FB101D 		vmovsd	.LC22(%rip), %xmm3
+ 2020      00000000 
+ 2021 1a32 C5C359D4 		vmulsd	%xmm4, %xmm7, %xmm2
+ 2022 1a36 C5DB5EFF 		vdivsd	%xmm7, %xmm4, %xmm7
+ 2023 1a3a C5CB10CE 		vmovsd	%xmm6, %xmm6, %xmm1
+ 2024 1a3e C5EB58EB 		vaddsd	%xmm3, %xmm2, %xmm5
+ 2025 1a42 C5E35CD2 		vsubsd	%xmm2, %xmm3, %xmm2
+ 2026 1a46 C54358C3 		vaddsd	%xmm3, %xmm7, %xmm8
+ 2027 1a4a C5E35CDF 		vsubsd	%xmm7, %xmm3, %xmm3
+ 2028 1a4e E9EDFDFF 		jmp	.L234
+ 2028      FF
+ 2029              		.p2align 4,,10
+ 2030 1a53 0F1F4400 		.p2align 3
+ 2030      00
+ 2031              	.L228:
+ 2032 1a58 C57B105D 		vmovsd	-88(%rbp), %xmm11
+ 2032      A8
+ 2033 1a5d C5FB103D 		vmovsd	.LC27(%rip), %xmm7
+ 2033      00000000 
+ 2034 1a65 C57B100D 		vmovsd	.LC26(%rip), %xmm9
+ 2034      00000000 
+ 2035 1a6d C5FB101D 		vmovsd	.LC19(%rip), %xmm3
+ 2035      00000000 
+ 2036 1a75 C5FB1005 		vmovsd	.LC29(%rip), %xmm0
+ 2036      00000000 
+ 2037 1a7d C4C14359 		vmulsd	%xmm11, %xmm7, %xmm4
+ 2037      E3
+ 2038 1a82 C57B1015 		vmovsd	.LC30(%rip), %xmm10
+ 2038      00000000 
+ 2039 1a8a C4C16359 		vmulsd	16(%r12), %xmm3, %xmm1
+ 2039      4C2410
+ 2040 1a91 C5FB101D 		vmovsd	.LC28(%rip), %xmm3
+ 2040      00000000 
+ 2041 1a99 C4C13359 		vmulsd	%xmm11, %xmm9, %xmm2
+ 2041      D3
+ 2042 1a9e C5F35E4D 		vdivsd	-112(%rbp), %xmm1, %xmm1
+ 2042      90
+ 2043 1aa3 C4C16B5E 		vdivsd	24(%r12), %xmm2, %xmm2
+ 2043      542418
+ 2044 1aaa C5EB58EB 		vaddsd	%xmm3, %xmm2, %xmm5
+ 2045 1aae C5E35CD2 		vsubsd	%xmm2, %xmm3, %xmm2
+ 2046 1ab2 C4C17B59 		vmulsd	%xmm11, %xmm0, %xmm6
+ 2046      F3
+ 2047 1ab7 C5F359C0 		vmulsd	%xmm0, %xmm1, %xmm0
+ 2048 1abb C4C15B59 		vmulsd	%xmm11, %xmm4, %xmm4
+ 2048      E3
+ 2049 1ac0 C4417359 		vmulsd	%xmm9, %xmm1, %xmm9
+ 2049      C9
+ 2050 1ac5 C441335E 		vdivsd	32(%r12), %xmm9, %xmm9
+ 2050      4C2420
+ 2051 1acc C53358C3 		vaddsd	%xmm3, %xmm9, %xmm8
+ 2052 1ad0 C4C1635C 		vsubsd	%xmm9, %xmm3, %xmm3
+ 2052      D9
+ 2053 1ad5 C4C14B59 		vmulsd	%xmm11, %xmm6, %xmm6
+ 2053      F3
+ 2054 1ada C5D358EC 		vaddsd	%xmm4, %xmm5, %xmm5
+ 2055 1ade C5EB58D4 		vaddsd	%xmm4, %xmm2, %xmm2
+ 2056 1ae2 C5F359E7 		vmulsd	%xmm7, %xmm1, %xmm4
+ 2057 1ae6 C4C14B5C 		vsubsd	%xmm10, %xmm6, %xmm6
+ 2057      F2
+ 2058 1aeb C5DB59E1 		vmulsd	%xmm1, %xmm4, %xmm4
+ 2059 1aef C5FB59C9 		vmulsd	%xmm1, %xmm0, %xmm1
+ 2060 1af3 C53B58C4 		vaddsd	%xmm4, %xmm8, %xmm8
+ 2061 1af7 C5E358DC 		vaddsd	%xmm4, %xmm3, %xmm3
+ 2062 1afb C4C1735C 		vsubsd	%xmm10, %xmm1, %xmm1
+ 2062      CA
+ 2063 1b00 E93BFDFF 		jmp	.L234
+ 2063      FF
+ 2064              	.L245:
+ 2065 1b05 C5DB10C4 		vmovsd	%xmm4, %xmm4, %xmm0
+ 2066 1b09 C5FB1165 		vmovsd	%xmm4, -72(%rbp)
+ 2066      B8
+ 2067 1b0e E8000000 		call	sqrt@PLT
+ 2067      00
+ 2068 1b13 C5FB1065 		vmovsd	-72(%rbp), %xmm4
+ 2068      B8
+ 2069 1b18 C5FB10F8 		vmovsd	%xmm0, %xmm0, %xmm7
+ 2070 1b1c E9F4FBFF 		jmp	.L224
+ 2070      FF
+ 2071              	.L247:
+ 2072 1b21 C5C310C7 		vmovsd	%xmm7, %xmm7, %xmm0
+ 2073 1b25 C5FB1155 		vmovsd	%xmm2, -96(%rbp)
+ 2073      A0
+ 2074 1b2a C5FB11A5 		vmovsd	%xmm4, -152(%rbp)
+ 2074      68FFFFFF 
+ 2075 1b32 C57B1155 		vmovsd	%xmm10, -112(%rbp)
+ 2075      90
+ 2076 1b37 C5FB115D 		vmovsd	%xmm3, -104(%rbp)
+ 2076      98
+ 2077 1b3c C5FB117D 		vmovsd	%xmm7, -88(%rbp)
+ 2077      A8
+ 2078 1b41 E8000000 		call	sqrt@PLT
+ 2078      00
+ 2079 1b46 C5FB105D 		vmovsd	-104(%rbp), %xmm3
+ 2079      98
+ 2080 1b4b C5E3594D 		vmulsd	-80(%rbp), %xmm3, %xmm1
+ 2080      B0
+ 2081 1b50 C5FB58C0 		vaddsd	%xmm0, %xmm0, %xmm0
+ 2082 1b54 C5FB596D 		vmulsd	-72(%rbp), %xmm0, %xmm5
+ 2082      B8
+ 2083 1b59 C5FB107D 		vmovsd	-88(%rbp), %xmm7
+ 2083      A8
+ 2084 1b5e C57B1055 		vmovsd	-112(%rbp), %xmm10
+ 2084      90
+ 2085 1b63 C5C35935 		vmulsd	.LC24(%rip), %xmm7, %xmm6
+ 2085      00000000 
+ 2086 1b6b C5FB115D 		vmovsd	%xmm3, -88(%rbp)
+ 2086      A8
+ 2087 1b70 C5FB1055 		vmovsd	-96(%rbp), %xmm2
+ 2087      A0
+ 2088 1b75 C5FB117D 		vmovsd	%xmm7, -80(%rbp)
+ 2088      B0
+ 2089 1b7a C57B1155 		vmovsd	%xmm10, -128(%rbp)
+ 2089      80
+ 2090 1b7f C5FB118D 		vmovsd	%xmm1, -136(%rbp)
+ 2090      78FFFFFF 
+ 2091 1b87 C5AB58C1 		vaddsd	%xmm1, %xmm10, %xmm0
+ 2092 1b8b C5D358EA 		vaddsd	%xmm2, %xmm5, %xmm5
+ 2093 1b8f C5CB59F0 		vmulsd	%xmm0, %xmm6, %xmm6
+ 2094 1b93 C5C310C7 		vmovsd	%xmm7, %xmm7, %xmm0
+ 2095 1b97 C5D359EF 		vmulsd	%xmm7, %xmm5, %xmm5
+ 2096 1b9b C5FB1175 		vmovsd	%xmm6, -120(%rbp)
+ 2096      88
+ 2097 1ba0 C5FB11AD 		vmovsd	%xmm5, -144(%rbp)
+ 2097      70FFFFFF 
+ 2098 1ba8 E8000000 		call	sqrt@PLT
+ 2098      00
+ 2099 1bad C5FB1055 		vmovsd	-96(%rbp), %xmm2
+ 2099      A0
+ 2100 1bb2 C5FB107D 		vmovsd	-80(%rbp), %xmm7
+ 2100      B0
+ 2101 1bb7 C5FB58C0 		vaddsd	%xmm0, %xmm0, %xmm0
+ 2102 1bbb C5FB5945 		vmulsd	-72(%rbp), %xmm0, %xmm0
+ 2102      B8
+ 2103 1bc0 C5FB105D 		vmovsd	-88(%rbp), %xmm3
+ 2103      A8
+ 2104 1bc5 C5FB10A5 		vmovsd	-152(%rbp), %xmm4
+ 2104      68FFFFFF 
+ 2105 1bcd C5FB117D 		vmovsd	%xmm7, -104(%rbp)
+ 2105      98
+ 2106 1bd2 C5E35CDC 		vsubsd	%xmm4, %xmm3, %xmm3
+ 2107 1bd6 C5EB5CD0 		vsubsd	%xmm0, %xmm2, %xmm2
+ 2108 1bda C5C310C7 		vmovsd	%xmm7, %xmm7, %xmm0
+ 2109 1bde C5FB115D 		vmovsd	%xmm3, -80(%rbp)
+ 2109      B0
+ 2110 1be3 C5EB59D7 		vmulsd	%xmm7, %xmm2, %xmm2
+ 2111 1be7 C5FB1155 		vmovsd	%xmm2, -112(%rbp)
+ 2111      90
+ 2112 1bec E8000000 		call	sqrt@PLT
+ 2112      00
+ 2113 1bf1 C57B1055 		vmovsd	-128(%rbp), %xmm10
+ 2113      80
+ 2114 1bf6 C5FB108D 		vmovsd	-136(%rbp), %xmm1
+ 2114      78FFFFFF 
+ 2115 1bfe C5FB58C0 		vaddsd	%xmm0, %xmm0, %xmm0
+ 2116 1c02 C57B5945 		vmulsd	-72(%rbp), %xmm0, %xmm8
+ 2116      B8
+ 2117 1c07 C5FB105D 		vmovsd	-80(%rbp), %xmm3
+ 2117      B0
+ 2118 1c0c C5AB5CC9 		vsubsd	%xmm1, %xmm10, %xmm1
+ 2119 1c10 C5FB115D 		vmovsd	%xmm3, -96(%rbp)
+ 2119      A0
+ 2120 1c15 C5F358C9 		vaddsd	%xmm1, %xmm1, %xmm1
+ 2121 1c19 C53B58C3 		vaddsd	%xmm3, %xmm8, %xmm8
+ 2122 1c1d C57B1145 		vmovsd	%xmm8, -88(%rbp)
+ 2122      A8
+ 2123              	.L250:
+ 2124 1c22 C5FB107D 		vmovsd	-104(%rbp), %xmm7
+ 2124      98
+ 2125 1c27 C5FB114D 		vmovsd	%xmm1, -80(%rbp)
+ 2125      B0
+ 2126 1c2c C5C310C7 		vmovsd	%xmm7, %xmm7, %xmm0
+ 2127 1c30 E8000000 		call	sqrt@PLT
+ 2127      00
+ 2128 1c35 C5FB1075 		vmovsd	-120(%rbp), %xmm6
+ 2128      88
+ 2129 1c3a C5FB10AD 		vmovsd	-144(%rbp), %xmm5
+ 2129      70FFFFFF 
+ 2130 1c42 C5FB58C0 		vaddsd	%xmm0, %xmm0, %xmm0
+ 2131 1c46 C5FB1055 		vmovsd	-112(%rbp), %xmm2
+ 2131      90
+ 2132 1c4b C57B594D 		vmulsd	-72(%rbp), %xmm0, %xmm9
+ 2132      B8
+ 2133 1c50 C5FB105D 		vmovsd	-96(%rbp), %xmm3
+ 2133      A0
+ 2134 1c55 C57B1045 		vmovsd	-88(%rbp), %xmm8
+ 2134      A8
+ 2135 1c5a C5FB104D 		vmovsd	-80(%rbp), %xmm1
+ 2135      B0
+ 2136 1c5f E92EFDFF 		jmp	.L240
+ 2136      FF
+ 2137              	.L246:
+ 2138 1c64 C5C310C7 		vmovsd	%xmm7, %xmm7, %xmm0
+ 2139 1c68 C5FB1155 		vmovsd	%xmm2, -96(%rbp)
+ 2139      A0
+ 2140 1c6d C5FB11A5 		vmovsd	%xmm4, -152(%rbp)
+ 2140      68FFFFFF 
+ 2141 1c75 C57B1155 		vmovsd	%xmm10, -112(%rbp)
+ 2141      90
+ 2142 1c7a C5FB115D 		vmovsd	%xmm3, -104(%rbp)
+ 2142      98
+ 2143 1c7f C5FB117D 		vmovsd	%xmm7, -88(%rbp)
+ 2143      A8
+ 2144 1c84 E8000000 		call	sqrt@PLT
+ 2144      00
+ 2145 1c89 C5FB105D 		vmovsd	-104(%rbp), %xmm3
+ 2145      98
+ 2146 1c8e C5E3594D 		vmulsd	-80(%rbp), %xmm3, %xmm1
+ 2146      B0
+ 2147 1c93 C5FB58C0 		vaddsd	%xmm0, %xmm0, %xmm0
+ 2148 1c97 C5FB596D 		vmulsd	-72(%rbp), %xmm0, %xmm5
+ 2148      B8
+ 2149 1c9c C5FB107D 		vmovsd	-88(%rbp), %xmm7
+ 2149      A8
+ 2150 1ca1 C57B1055 		vmovsd	-112(%rbp), %xmm10
+ 2150      90
+ 2151 1ca6 C5FB1055 		vmovsd	-96(%rbp), %xmm2
+ 2151      A0
+ 2152 1cab C5FB115D 		vmovsd	%xmm3, -88(%rbp)
+ 2152      A8
+ 2153 1cb0 C5C358F7 		vaddsd	%xmm7, %xmm7, %xmm6
+ 2154 1cb4 C5FB117D 		vmovsd	%xmm7, -80(%rbp)
+ 2154      B0
+ 2155 1cb9 C57B1155 		vmovsd	%xmm10, -128(%rbp)
+ 2155      80
+ 2156 1cbe C5FB118D 		vmovsd	%xmm1, -136(%rbp)
+ 2156      78FFFFFF 
+ 2157 1cc6 C5AB5CC1 		vsubsd	%xmm1, %xmm10, %xmm0
+ 2158 1cca C5D358EA 		vaddsd	%xmm2, %xmm5, %xmm5
+ 2159 1cce C5CB59F0 		vmulsd	%xmm0, %xmm6, %xmm6
+ 2160 1cd2 C5C310C7 		vmovsd	%xmm7, %xmm7, %xmm0
+ 2161 1cd6 C5D359EF 		vmulsd	%xmm7, %xmm5, %xmm5
+ 2162 1cda C5FB1175 		vmovsd	%xmm6, -120(%rbp)
+ 2162      88
+ 2163 1cdf C5FB11AD 		vmovsd	%xmm5, -144(%rbp)
+ 2163      70FFFFFF 
+ 2164 1ce7 E8000000 		call	sqrt@PLT
+ 2164      00
+ 2165 1cec C5FB1055 		vmovsd	-96(%rbp), %xmm2
+ 2165      A0
+ 2166 1cf1 C5FB107D 		vmovsd	-80(%rbp), %xmm7
+ 2166      B0
+ 2167 1cf6 C5FB58C0 		vaddsd	%xmm0, %xmm0, %xmm0
+ 2168 1cfa C5FB5945 		vmulsd	-72(%rbp), %xmm0, %xmm0
+ 2168      B8
+ 2169 1cff C5FB105D 		vmovsd	-88(%rbp), %xmm3
+ 2169      A8
+ 2170 1d04 C5FB10A5 		vmovsd	-152(%rbp), %xmm4
+ 2170      68FFFFFF 
+ 2171 1d0c C5FB117D 		vmovsd	%xmm7, -104(%rbp)
+ 2171      98
+ 2172 1d11 C5E358DC 		vaddsd	%xmm4, %xmm3, %xmm3
+ 2173 1d15 C5EB5CD0 		vsubsd	%xmm0, %xmm2, %xmm2
+ 2174 1d19 C5C310C7 		vmovsd	%xmm7, %xmm7, %xmm0
+ 2175 1d1d C5FB115D 		vmovsd	%xmm3, -80(%rbp)
+ 2175      B0
+ 2176 1d22 C5EB59D7 		vmulsd	%xmm7, %xmm2, %xmm2
+ 2177 1d26 C5FB1155 		vmovsd	%xmm2, -112(%rbp)
+ 2177      90
+ 2178 1d2b E8000000 		call	sqrt@PLT
+ 2178      00
+ 2179 1d30 C5FB105D 		vmovsd	-80(%rbp), %xmm3
+ 2179      B0
+ 2180 1d35 C57B1055 		vmovsd	-128(%rbp), %xmm10
+ 2180      80
+ 2181 1d3a C5FB108D 		vmovsd	-136(%rbp), %xmm1
+ 2181      78FFFFFF 
+ 2182 1d42 C5FB58C0 		vaddsd	%xmm0, %xmm0, %xmm0
+ 2183 1d46 C57B5945 		vmulsd	-72(%rbp), %xmm0, %xmm8
+ 2183      B8
+ 2184 1d4b C5FB115D 		vmovsd	%xmm3, -96(%rbp)
+ 2184      A0
+ 2185 1d50 C5AB58C9 		vaddsd	%xmm1, %xmm10, %xmm1
+ 2186 1d54 C5F3590D 		vmulsd	.LC24(%rip), %xmm1, %xmm1
+ 2186      00000000 
+ 2187 1d5c C53B58C3 		vaddsd	%xmm3, %xmm8, %xmm8
+ 2188 1d60 C57B1145 		vmovsd	%xmm8, -88(%rbp)
+ 2188      A8
+ 2189 1d65 E9B8FEFF 		jmp	.L250
+ 2189      FF
+ 2190              		.cfi_endproc
+ 2191              	.LFE14:
+ 2193 1d6a 660F1F44 		.p2align 4
+ 2193      0000
+ 2194              		.globl	init_iir
+ 2196              	init_iir:
+ 2197              	.LFB15:
+ 2198              		.cfi_startproc
+ 2199 1d70 55       		pushq	%rbp
+ 2200              		.cfi_def_cfa_offset 16
+ 2201              		.cfi_offset 6, -16
+ 2202 1d71 4889E5   		movq	%rsp, %rbp
+ 2203              		.cfi_def_cfa_register 6
+ 2204 1d74 53       		pushq	%rbx
+ 2205 1d75 4883EC08 		subq	$8, %rsp
+ 2206              		.cfi_offset 3, -24
+ 2207 1d79 488B9FC0 		movq	192(%rdi), %rbx
+ 2207      000000
+ 2208 1d80 8B03     		movl	(%rbx), %eax
+ 2209 1d82 85C0     		testl	%eax, %eax
+ 2210 1d84 752A     		jne	.L254
+ 2211              	.L252:
+ 2212 1d86 C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 2213 1d8a 62F17F48 		vmovdqu8	%zmm0, 96(%rbx)
+ 2213      7F836000 
+ 2213      0000
+ 2214 1d94 62F17F48 		vmovdqu8	%zmm0, 160(%rbx)
+ 2214      7F83A000 
+ 2214      0000
+ 2215 1d9e C5F877   		vzeroupper
+ 2216 1da1 488B5DF8 		movq	-8(%rbp), %rbx
+ 2217 1da5 C9       		leave
+ 2218              		.cfi_remember_state
+ 2219              		.cfi_def_cfa 7, 8
+ 2220 1da6 C3       		ret
+ 2221 1da7 660F1F84 		.p2align 4,,10
+ 2221      00000000 
+ 2221      00
+ 2222              		.p2align 3
+ 2223              	.L254:
+ 2224              		.cfi_restore_state
+ 2225 1db0 8BB79800 		movl	152(%rdi), %esi
+ 2225      0000
+ 2226 1db6 4889DF   		movq	%rbx, %rdi
+ 2227 1db9 E8000000 		call	calc_coeffs@PLT
+ 2227      00
+ 2228 1dbe EBC6     		jmp	.L252
+ 2229              		.cfi_endproc
+ 2230              	.LFE15:
+ 2232              		.section	.rodata.str1.1
+ 2233              	.LC34:
+ 2234 0031 25733A20 		.string	"%s: %u samples\n"
+ 2234      25752073 
+ 2234      616D706C 
+ 2234      65730A00 
+ 2235              		.text
+ 2236              		.p2align 4
+ 2237              		.globl	iir_decay
+ 2239              	iir_decay:
+ 2240              	.LFB27:
+ 2241              		.cfi_startproc
+ 2242 1dc0 4157     		pushq	%r15
+ 2243              		.cfi_def_cfa_offset 16
+ 2244              		.cfi_offset 15, -16
+ 2245 1dc2 4156     		pushq	%r14
+ 2246              		.cfi_def_cfa_offset 24
+ 2247              		.cfi_offset 14, -24
+ 2248 1dc4 4155     		pushq	%r13
+ 2249              		.cfi_def_cfa_offset 32
+ 2250              		.cfi_offset 13, -32
+ 2251 1dc6 4154     		pushq	%r12
+ 2252              		.cfi_def_cfa_offset 40
+ 2253              		.cfi_offset 12, -40
+ 2254 1dc8 4189F4   		movl	%esi, %r12d
+ 2255 1dcb 55       		pushq	%rbp
+ 2256              		.cfi_def_cfa_offset 48
+ 2257              		.cfi_offset 6, -48
+ 2258 1dcc 53       		pushq	%rbx
+ 2259              		.cfi_def_cfa_offset 56
+ 2260              		.cfi_offset 3, -56
+ 2261 1dcd 4883EC48 		subq	$72, %rsp
+ 2262              		.cfi_def_cfa_offset 128
+ 2263 1dd1 C5FB103F 		vmovsd	(%rdi), %xmm7
+ 2264 1dd5 C5FB104F 		vmovsd	8(%rdi), %xmm1
+ 2264      08
+ 2265 1dda C5FB1144 		vmovsd	%xmm0, 24(%rsp)
+ 2265      2418
+ 2266 1de0 C5FA7E05 		vmovq	.LC32(%rip), %xmm0
+ 2266      00000000 
+ 2267 1de8 C5FB117C 		vmovsd	%xmm7, 8(%rsp)
+ 2267      2408
+ 2268 1dee C5F92944 		vmovapd	%xmm0, 32(%rsp)
+ 2268      2420
+ 2269 1df4 C5F92805 		vmovapd	.LC33(%rip), %xmm0
+ 2269      00000000 
+ 2270 1dfc C5F92944 		vmovapd	%xmm0, 48(%rsp)
+ 2270      2430
+ 2271 1e02 85F6     		testl	%esi, %esi
+ 2272 1e04 0F849D00 		je	.L256
+ 2272      0000
+ 2273 1e0a 31ED     		xorl	%ebp, %ebp
+ 2274 1e0c 4C8D6C24 		leaq	32(%rsp), %r13
+ 2274      20
+ 2275 1e11 488D5C24 		leaq	48(%rsp), %rbx
+ 2275      30
+ 2276 1e16 C5FA7E25 		vmovq	.LC0(%rip), %xmm4
+ 2276      00000000 
+ 2277 1e1e C5F1573D 		vxorpd	.LC25(%rip), %xmm1, %xmm7
+ 2277      00000000 
+ 2278 1e26 C5FB117C 		vmovsd	%xmm7, 16(%rsp)
+ 2278      2410
+ 2279 1e2c 0F1F4000 		.p2align 4,,10
+ 2280              		.p2align 3
+ 2281              	.L257:
+ 2282 1e30 4D89EE   		movq	%r13, %r14
+ 2283 1e33 4989DF   		movq	%rbx, %r15
+ 2284 1e36 C5F157C9 		vxorpd	%xmm1, %xmm1, %xmm1
+ 2285              	.L258:
+ 2286 1e3a C4C17B10 		vmovsd	(%r14), %xmm2
+ 2286      16
+ 2287 1e3f C5EB5944 		vmulsd	8(%rsp), %xmm2, %xmm0
+ 2287      2408
+ 2288 1e45 4983C608 		addq	$8, %r14
+ 2289 1e49 4983C708 		addq	$8, %r15
+ 2290 1e4d C4C17B10 		vmovsd	-8(%r15), %xmm3
+ 2290      5FF8
+ 2291 1e53 C5E35CD8 		vsubsd	%xmm0, %xmm3, %xmm3
+ 2292 1e57 C5EB5944 		vmulsd	16(%rsp), %xmm2, %xmm0
+ 2292      2410
+ 2293 1e5d C5E954D4 		vandpd	%xmm4, %xmm2, %xmm2
+ 2294 1e61 C4C17B11 		vmovsd	%xmm3, -8(%r14)
+ 2294      5EF8
+ 2295 1e67 C5E154DC 		vandpd	%xmm4, %xmm3, %xmm3
+ 2296 1e6b C5EB58D3 		vaddsd	%xmm3, %xmm2, %xmm2
+ 2297 1e6f C4C17B11 		vmovsd	%xmm0, -8(%r15)
+ 2297      47F8
+ 2298 1e75 C5F954C4 		vandpd	%xmm4, %xmm0, %xmm0
+ 2299 1e79 C5EB58C0 		vaddsd	%xmm0, %xmm2, %xmm0
+ 2300 1e7d E8000000 		call	fmax@PLT
+ 2300      00
+ 2301 1e82 4939DE   		cmpq	%rbx, %r14
+ 2302 1e85 C5FA7E25 		vmovq	.LC0(%rip), %xmm4
+ 2302      00000000 
+ 2303 1e8d C5FB10C8 		vmovsd	%xmm0, %xmm0, %xmm1
+ 2304 1e91 75A7     		jne	.L258
+ 2305 1e93 C5FB107C 		vmovsd	24(%rsp), %xmm7
+ 2305      2418
+ 2306 1e99 C5F92FF8 		vcomisd	%xmm0, %xmm7
+ 2307 1e9d 7741     		ja	.L259
+ 2308 1e9f 83C501   		addl	$1, %ebp
+ 2309 1ea2 4139EC   		cmpl	%ebp, %r12d
+ 2310 1ea5 7589     		jne	.L257
+ 2311              	.L256:
+ 2312 1ea7 4489E1   		movl	%r12d, %ecx
+ 2313 1eaa 31C0     		xorl	%eax, %eax
+ 2314 1eac 488D1500 		leaq	__func__.1(%rip), %rdx
+ 2314      000000
+ 2315 1eb3 BF020000 		movl	$2, %edi
+ 2315      00
+ 2316 1eb8 488D3500 		leaq	.LC34(%rip), %rsi
+ 2316      000000
+ 2317 1ebf E8000000 		call	debugprint@PLT
+ 2317      00
+ 2318 1ec4 4883C448 		addq	$72, %rsp
+ 2319              		.cfi_remember_state
+ 2320              		.cfi_def_cfa_offset 56
+ 2321 1ec8 4489E0   		movl	%r12d, %eax
+ 2322 1ecb 5B       		popq	%rbx
+ 2323              		.cfi_def_cfa_offset 48
+ 2324 1ecc 5D       		popq	%rbp
+ 2325              		.cfi_def_cfa_offset 40
+ 2326 1ecd 415C     		popq	%r12
+ 2327              		.cfi_def_cfa_offset 32
+ 2328 1ecf 415D     		popq	%r13
+ 2329              		.cfi_def_cfa_offset 24
+ 2330 1ed1 415E     		popq	%r14
+ 2331              		.cfi_def_cfa_offset 16
+ 2332 1ed3 415F     		popq	%r15
+ 2333              		.cfi_def_cfa_offset 8
+ 2334 1ed5 C3       		ret
+ 2335 1ed6 662E0F1F 		.p2align 4,,10
+ 2335      84000000 
+ 2335      0000
+ 2336              		.p2align 3
+ 2337              	.L259:
+ 2338              		.cfi_restore_state
+ 2339 1ee0 4189EC   		movl	%ebp, %r12d
+ 2340 1ee3 EBC2     		jmp	.L256
+ 2341              		.cfi_endproc
+ 2342              	.LFE27:
+ 2344 1ee5 66662E0F 		.p2align 4
+ 2344      1F840000 
+ 2344      000000
+ 2345              		.globl	iir_preroll
+ 2347              	iir_preroll:
+ 2348              	.LFB28:
+ 2349              		.cfi_startproc
+ 2350 1ef0 6BB79800 		imull	$60, 152(%rdi), %esi
+ 2350      00003C
+ 2351 1ef7 488BBFC0 		movq	192(%rdi), %rdi
+ 2351      000000
+ 2352 1efe 4883C730 		addq	$48, %rdi
+ 2353 1f02 E9000000 		jmp	iir_decay@PLT
+ 2353      00
+ 2354              		.cfi_endproc
+ 2355              	.LFE28:
+ 2357              		.section	.rodata.str1.1
+ 2358              	.LC35:
+ 2359 0041 64697265 		.string	"direct"
+ 2359      637400
+ 2360              	.LC36:
+ 2361 0048 6C703200 		.string	"lp2"
+ 2362              	.LC37:
+ 2363 004c 68703200 		.string	"hp2"
+ 2364              	.LC38:
+ 2365 0050 6C733200 		.string	"ls2"
+ 2366              	.LC39:
+ 2367 0054 68733200 		.string	"hs2"
+ 2368              	.LC40:
+ 2369 0058 6C703100 		.string	"lp1"
+ 2370              	.LC41:
+ 2371 005c 68703100 		.string	"hp1"
+ 2372              	.LC42:
+ 2373 0060 6C733100 		.string	"ls1"
+ 2374              	.LC43:
+ 2375 0064 68733100 		.string	"hs1"
+ 2376              	.LC44:
+ 2377 0068 70657100 		.string	"peq"
+ 2378              	.LC45:
+ 2379 006c 6C777400 		.string	"lwt"
+ 2380              	.LC46:
+ 2381 0070 61703200 		.string	"ap2"
+ 2382              	.LC47:
+ 2383 0074 61703100 		.string	"ap1"
+ 2384              	.LC48:
+ 2385 0078 6600     		.string	"f"
+ 2386              	.LC49:
+ 2387 007a 7100     		.string	"q"
+ 2388              	.LC50:
+ 2389 007c 6700     		.string	"g"
+ 2390              	.LC51:
+ 2391 007e 663100   		.string	"f1"
+ 2392              	.LC52:
+ 2393 0081 713100   		.string	"q1"
+ 2394              	.LC53:
+ 2395 0084 613100   		.string	"a1"
+ 2396              	.LC54:
+ 2397 0087 613200   		.string	"a2"
+ 2398              	.LC55:
+ 2399 008a 623000   		.string	"b0"
+ 2400              	.LC56:
+ 2401 008d 623100   		.string	"b1"
+ 2402              	.LC57:
+ 2403 0090 623200   		.string	"b2"
+ 2404              	.LC60:
+ 2405 0093 25732073 		.string	"%s subopts: %s\n"
+ 2405      75626F70 
+ 2405      74733A20 
+ 2405      25730A00 
+ 2406              	.LC61:
+ 2407 00a3 25732063 		.string	"%s checking subopts: %s\n"
+ 2407      6865636B 
+ 2407      696E6720 
+ 2407      7375626F 
+ 2407      7074733A 
+ 2408              		.section	.rodata.str1.8
+ 2409              		.align 8
+ 2410              	.LC62:
+ 2411 0240 25733A20 		.string	"%s: No match found for token '%s'\n"
+ 2411      4E6F206D 
+ 2411      61746368 
+ 2411      20666F75 
+ 2411      6E642066 
+ 2412 0263 00000000 		.align 8
+ 2412      00
+ 2413              	.LC63:
+ 2414 0268 4D697373 		.string	"Missing value for suboption '%s'\n"
+ 2414      696E6720 
+ 2414      76616C75 
+ 2414      6520666F 
+ 2414      72207375 
+ 2415 028a 00000000 		.align 8
+ 2415      0000
+ 2416              	.LC64:
+ 2417 0290 49676E6F 		.string	"Ignoring value for suboption '%s'\n"
+ 2417      72696E67 
+ 2417      2076616C 
+ 2417      75652066 
+ 2417      6F722073 
+ 2418 02b3 00000000 		.align 8
+ 2418      00
+ 2419              	.LC65:
+ 2420 02b8 25732069 		.string	"%s iir type %s is not yet implemented\n"
+ 2420      69722074 
+ 2420      79706520 
+ 2420      25732069 
+ 2420      73206E6F 
+ 2421              		.section	.rodata.str1.1
+ 2422              	.LC66:
+ 2423 00bc 25732069 		.string	"%s iir type is %s\n"
+ 2423      69722074 
+ 2423      79706520 
+ 2423      69732025 
+ 2423      730A00
+ 2424              		.section	.rodata.str1.8
+ 2425 02df 00       		.align 8
+ 2426              	.LC67:
+ 2427 02e0 25733A20 		.string	"%s: Missing parameters for iir type '%s'\n"
+ 2427      4D697373 
+ 2427      696E6720 
+ 2427      70617261 
+ 2427      6D657465 
+ 2428              		.text
+ 2429 1f07 660F1F84 		.p2align 4
+ 2429      00000000 
+ 2429      00
+ 2430              		.globl	create_iir
+ 2432              	create_iir:
+ 2433              	.LFB30:
+ 2434              		.cfi_startproc
+ 2435 1f10 55       		pushq	%rbp
+ 2436              		.cfi_def_cfa_offset 16
+ 2437              		.cfi_offset 6, -16
+ 2438 1f11 488D0500 		leaq	.LC42(%rip), %rax
+ 2438      000000
+ 2439 1f18 488D1500 		leaq	.LC35(%rip), %rdx
+ 2439      000000
+ 2440 1f1f 4889E5   		movq	%rsp, %rbp
+ 2441              		.cfi_def_cfa_register 6
+ 2442 1f22 4157     		pushq	%r15
+ 2443 1f24 4156     		pushq	%r14
+ 2444 1f26 4155     		pushq	%r13
+ 2445 1f28 4154     		pushq	%r12
+ 2446 1f2a 53       		pushq	%rbx
+ 2447              		.cfi_offset 15, -24
+ 2448              		.cfi_offset 14, -32
+ 2449              		.cfi_offset 13, -40
+ 2450              		.cfi_offset 12, -48
+ 2451              		.cfi_offset 3, -56
+ 2452 1f2b 4889F3   		movq	%rsi, %rbx
+ 2453 1f2e 488D3500 		leaq	.LC47(%rip), %rsi
+ 2453      000000
+ 2454 1f35 4883E4C0 		andq	$-64, %rsp
+ 2455 1f39 4881ECC0 		subq	$448, %rsp
+ 2455      010000
+ 2456 1f40 C5FA7E1D 		vmovq	clone_iir@GOTPCREL(%rip), %xmm3
+ 2456      00000000 
+ 2457 1f48 C5FA7E25 		vmovq	init_iir@GOTPCREL(%rip), %xmm4
+ 2457      00000000 
+ 2458 1f50 C4E3E122 		vpinsrq	$1, iir_preroll@GOTPCREL(%rip), %xmm3, %xmm0
+ 2458      05000000 
+ 2458      0001
+ 2459 1f5a C4E3D922 		vpinsrq	$1, destroy_iir@GOTPCREL(%rip), %xmm4, %xmm1
+ 2459      0D000000 
+ 2459      0001
+ 2460 1f64 48897C24 		movq	%rdi, 88(%rsp)
+ 2460      58
+ 2461 1f69 488D3D00 		leaq	.LC41(%rip), %rdi
+ 2461      000000
+ 2462 1f70 48C78424 		movq	$0, 440(%rsp)
+ 2462      B8010000 
+ 2462      00000000 
+ 2463 1f7c C4E37538 		vinserti128	$0x1, %xmm0, %ymm1, %ymm5
+ 2463      E801
+ 2464 1f82 C4E1F96E 		vmovq	%rdi, %xmm0
+ 2464      C7
+ 2465 1f87 488D3D00 		leaq	.LC39(%rip), %rdi
+ 2465      000000
+ 2466 1f8e C4E3F922 		vpinsrq	$1, %rax, %xmm0, %xmm0
+ 2466      C001
+ 2467 1f94 C4E1F96E 		vmovq	%rdi, %xmm1
+ 2467      CF
+ 2468 1f99 488D0500 		leaq	.LC40(%rip), %rax
+ 2468      000000
+ 2469 1fa0 C5FD7F6C 		vmovdqa	%ymm5, 32(%rsp)
+ 2469      2420
+ 2470 1fa6 488D3D00 		leaq	.LC37(%rip), %rdi
+ 2470      000000
+ 2471 1fad C4E3F122 		vpinsrq	$1, %rax, %xmm1, %xmm1
+ 2471      C801
+ 2472 1fb3 488D0500 		leaq	.LC38(%rip), %rax
+ 2472      000000
+ 2473 1fba C4E1F96E 		vmovq	%rdi, %xmm2
+ 2473      D7
+ 2474 1fbf C4E37538 		vinserti128	$0x1, %xmm0, %ymm1, %ymm1
+ 2474      C801
+ 2475 1fc5 C4E1F96E 		vmovq	%rdx, %xmm0
+ 2475      C2
+ 2476 1fca C4E3E922 		vpinsrq	$1, %rax, %xmm2, %xmm2
+ 2476      D001
+ 2477 1fd0 488D0500 		leaq	.LC36(%rip), %rax
+ 2477      000000
+ 2478 1fd7 488D3D00 		leaq	.LC49(%rip), %rdi
+ 2478      000000
+ 2479 1fde C4E3F922 		vpinsrq	$1, %rax, %xmm0, %xmm0
+ 2479      C001
+ 2480 1fe4 488D0500 		leaq	.LC50(%rip), %rax
+ 2480      000000
+ 2481 1feb 488D1500 		leaq	.LC45(%rip), %rdx
+ 2481      000000
+ 2482 1ff2 C4E37D38 		vinserti128	$0x1, %xmm2, %ymm0, %ymm0
+ 2482      C201
+ 2483 1ff8 C4E1F96E 		vmovq	%rdx, %xmm2
+ 2483      D2
+ 2484 1ffd 488D1500 		leaq	.LC51(%rip), %rdx
+ 2484      000000
+ 2485 2004 62F3FD48 		vinserti64x4	$0x1, %ymm1, %zmm0, %zmm0
+ 2485      3AC101
+ 2486 200b C4E1F96E 		vmovq	%rsi, %xmm1
+ 2486      CE
+ 2487 2010 488D3500 		leaq	.LC53(%rip), %rsi
+ 2487      000000
+ 2488 2017 62F1FD48 		vmovdqa64	%zmm0, 256(%rsp)
+ 2488      7F442404 
+ 2489 201f C4E1F96E 		vmovq	%rdi, %xmm0
+ 2489      C7
+ 2490 2024 488D3D00 		leaq	.LC43(%rip), %rdi
+ 2490      000000
+ 2491 202b C4E3F922 		vpinsrq	$1, %rax, %xmm0, %xmm0
+ 2491      C001
+ 2492 2031 488D0500 		leaq	.LC48(%rip), %rax
+ 2492      000000
+ 2493 2038 C4E3F122 		vpinsrq	$1, %rax, %xmm1, %xmm1
+ 2493      C801
+ 2494 203e 488D0500 		leaq	.LC46(%rip), %rax
+ 2494      000000
+ 2495 2045 C4E3E922 		vpinsrq	$1, %rax, %xmm2, %xmm2
+ 2495      D001
+ 2496 204b C4E37538 		vinserti128	$0x1, %xmm0, %ymm1, %ymm1
+ 2496      C801
+ 2497 2051 488D0500 		leaq	.LC44(%rip), %rax
+ 2497      000000
+ 2498 2058 C4E1F96E 		vmovq	%rdi, %xmm0
+ 2498      C7
+ 2499 205d 488D3D00 		leaq	.LC55(%rip), %rdi
+ 2499      000000
+ 2500 2064 C4E3F922 		vpinsrq	$1, %rax, %xmm0, %xmm0
+ 2500      C001
+ 2501 206a 488D0500 		leaq	.LC54(%rip), %rax
+ 2501      000000
+ 2502 2071 C4E37D38 		vinserti128	$0x1, %xmm2, %ymm0, %ymm0
+ 2502      C201
+ 2503 2077 62F3FD48 		vinserti64x4	$0x1, %ymm1, %zmm0, %zmm0
+ 2503      3AC101
+ 2504 207e C4E1F96E 		vmovq	%rsi, %xmm1
+ 2504      CE
+ 2505 2083 C4E3F122 		vpinsrq	$1, %rax, %xmm1, %xmm1
+ 2505      C801
+ 2506 2089 62F1FD48 		vmovdqa64	%zmm0, 320(%rsp)
+ 2506      7F442405 
+ 2507 2091 488D0500 		leaq	.LC52(%rip), %rax
+ 2507      000000
+ 2508 2098 C4E1F96E 		vmovq	%rdx, %xmm0
+ 2508      C2
+ 2509 209d C4E3F922 		vpinsrq	$1, %rax, %xmm0, %xmm0
+ 2509      C001
+ 2510 20a3 488D0500 		leaq	.LC56(%rip), %rax
+ 2510      000000
+ 2511 20aa C4E37D38 		vinserti128	$0x1, %xmm1, %ymm0, %ymm0
+ 2511      C101
+ 2512 20b0 C5FD7F84 		vmovdqa	%ymm0, 384(%rsp)
+ 2512      24800100 
+ 2512      00
+ 2513 20b9 C4E1F96E 		vmovq	%rdi, %xmm0
+ 2513      C7
+ 2514 20be BFE00000 		movl	$224, %edi
+ 2514      00
+ 2515 20c3 C4E3F922 		vpinsrq	$1, %rax, %xmm0, %xmm0
+ 2515      C001
+ 2516 20c9 488D0500 		leaq	.LC57(%rip), %rax
+ 2516      000000
+ 2517 20d0 C5F97F84 		vmovdqa	%xmm0, 416(%rsp)
+ 2517      24A00100 
+ 2517      00
+ 2518 20d9 62F1FD48 		vmovdqa64	.LC58(%rip), %zmm0
+ 2518      6F050000 
+ 2518      0000
+ 2519 20e3 48898424 		movq	%rax, 432(%rsp)
+ 2519      B0010000 
+ 2520 20eb 62F1FD48 		vmovdqa64	%zmm0, 128(%rsp)
+ 2520      7F442402 
+ 2521 20f3 62F1FD48 		vmovdqa64	.LC59(%rip), %zmm0
+ 2521      6F050000 
+ 2521      0000
+ 2522 20fd 62F1FD48 		vmovdqa64	%zmm0, 192(%rsp)
+ 2522      7F442403 
+ 2523 2105 C5F877   		vzeroupper
+ 2524 2108 E8000000 		call	malloc@PLT
+ 2524      00
+ 2525 210d 488B7C24 		movq	88(%rsp), %rdi
+ 2525      58
+ 2526 2112 4531FF   		xorl	%r15d, %r15d
+ 2527 2115 4889C6   		movq	%rax, %rsi
+ 2528 2118 48894424 		movq	%rax, 96(%rsp)
+ 2528      60
+ 2529 211d 488D1500 		leaq	__func__.0(%rip), %rdx
+ 2529      000000
+ 2530 2124 488987C0 		movq	%rax, 192(%rdi)
+ 2530      000000
+ 2531 212b 488B0500 		movq	iir_process@GOTPCREL(%rip), %rax
+ 2531      000000
+ 2532 2132 48C74628 		movq	$0x000000000, 40(%rsi)
+ 2532      00000000 
+ 2533 213a 488B0B   		movq	(%rbx), %rcx
+ 2534 213d 488D3500 		leaq	.LC60(%rip), %rsi
+ 2534      000000
+ 2535 2144 488987D0 		movq	%rax, 208(%rdi)
+ 2535      000000
+ 2536 214b 488D0500 		leaq	iir_process_kernels(%rip), %rax
+ 2536      000000
+ 2537 2152 488987C8 		movq	%rax, 200(%rdi)
+ 2537      000000
+ 2538 2159 31C0     		xorl	%eax, %eax
+ 2539 215b BF010000 		movl	$1, %edi
+ 2539      00
+ 2540 2160 E8000000 		call	debugprint@PLT
+ 2540      00
+ 2541 2165 488B0B   		movq	(%rbx), %rcx
+ 2542 2168 803900   		cmpb	$0, (%rcx)
+ 2543 216b 0F846F03 		je	.L292
+ 2543      0000
+ 2544 2171 488D4424 		leaq	120(%rsp), %rax
+ 2544      78
+ 2545 2176 4C8DAC24 		leaq	256(%rsp), %r13
+ 2545      00010000 
+ 2546 217e 48894424 		movq	%rax, 104(%rsp)
+ 2546      68
+ 2547 2183 4C8D2500 		leaq	.L274(%rip), %r12
+ 2547      000000
+ 2548 218a 660F1F44 		.p2align 4,,10
+ 2548      0000
+ 2549              		.p2align 3
+ 2550              	.L288:
+ 2551 2190 488D1500 		leaq	__func__.0(%rip), %rdx
+ 2551      000000
+ 2552 2197 488D3500 		leaq	.LC61(%rip), %rsi
+ 2552      000000
+ 2553 219e BF010000 		movl	$1, %edi
+ 2553      00
+ 2554 21a3 31C0     		xorl	%eax, %eax
+ 2555 21a5 E8000000 		call	debugprint@PLT
+ 2555      00
+ 2556 21aa 488B5424 		movq	104(%rsp), %rdx
+ 2556      68
+ 2557 21af 4C89EE   		movq	%r13, %rsi
+ 2558 21b2 4889DF   		movq	%rbx, %rdi
+ 2559 21b5 E8000000 		call	getsubopt@PLT
+ 2559      00
+ 2560 21ba 4C63F0   		movslq	%eax, %r14
+ 2561 21bd 4585F6   		testl	%r14d, %r14d
+ 2562 21c0 0F889A02 		js	.L272
+ 2562      0000
+ 2563 21c6 488B4424 		movq	120(%rsp), %rax
+ 2563      78
+ 2564 21cb 4183FE0C 		cmpl	$12, %r14d
+ 2565 21cf 0F8E5B02 		jle	.L270
+ 2565      0000
+ 2566 21d5 4885C0   		testq	%rax, %rax
+ 2567 21d8 0F84AA02 		je	.L300
+ 2567      0000
+ 2568              	.L271:
+ 2569 21de 4183FE16 		cmpl	$22, %r14d
+ 2570 21e2 0F877802 		ja	.L272
+ 2570      0000
+ 2571 21e8 4489F0   		movl	%r14d, %eax
+ 2572 21eb 49630484 		movslq	(%r12,%rax,4), %rax
+ 2573 21ef 4C01E0   		addq	%r12, %rax
+ 2574 21f2 FFE0     		jmp	*%rax
+ 2575              		.section	.rodata
+ 2576              		.align 4
+ 2577              		.align 4
+ 2578              	.L274:
+ 2579 0044 00000000 		.long	.L285-.L274
+ 2580 0048 00000000 		.long	.L285-.L274
+ 2581 004c 00000000 		.long	.L285-.L274
+ 2582 0050 00000000 		.long	.L285-.L274
+ 2583 0054 00000000 		.long	.L285-.L274
+ 2584 0058 00000000 		.long	.L284-.L274
+ 2585 005c 00000000 		.long	.L284-.L274
+ 2586 0060 00000000 		.long	.L284-.L274
+ 2587 0064 00000000 		.long	.L284-.L274
+ 2588 0068 00000000 		.long	.L285-.L274
+ 2589 006c 00000000 		.long	.L285-.L274
+ 2590 0070 00000000 		.long	.L285-.L274
+ 2591 0074 00000000 		.long	.L284-.L274
+ 2592 0078 00000000 		.long	.L283-.L274
+ 2593 007c 00000000 		.long	.L282-.L274
+ 2594 0080 00000000 		.long	.L281-.L274
+ 2595 0084 00000000 		.long	.L280-.L274
+ 2596 0088 00000000 		.long	.L279-.L274
+ 2597 008c 00000000 		.long	.L278-.L274
+ 2598 0090 00000000 		.long	.L277-.L274
+ 2599 0094 00000000 		.long	.L276-.L274
+ 2600 0098 00000000 		.long	.L275-.L274
+ 2601 009c 00000000 		.long	.L273-.L274
+ 2602              		.text
+ 2603              		.p2align 4,,10
+ 2604 21f4 0F1F4000 		.p2align 3
+ 2605              	.L285:
+ 2606 21f8 488B4424 		movq	96(%rsp), %rax
+ 2606      60
+ 2607 21fd 488D1500 		leaq	__func__.0(%rip), %rdx
+ 2607      000000
+ 2608 2204 BF010000 		movl	$1, %edi
+ 2608      00
+ 2609 2209 488D3500 		leaq	.LC66(%rip), %rsi
+ 2609      000000
+ 2610 2210 448930   		movl	%r14d, (%rax)
+ 2611 2213 4963C6   		movslq	%r14d, %rax
+ 2612 2216 488B8CC4 		movq	256(%rsp,%rax,8), %rcx
+ 2612      00010000 
+ 2613 221e 31C0     		xorl	%eax, %eax
+ 2614 2220 E8000000 		call	debugprint@PLT
+ 2614      00
+ 2615              		.p2align 4,,10
+ 2616 2225 0F1F00   		.p2align 3
+ 2617              	.L286:
+ 2618 2228 B8010000 		movl	$1, %eax
+ 2618      00
+ 2619 222d C4E209F7 		shlx	%r14d, %eax, %eax
+ 2619      C0
+ 2620 2232 4898     		cltq
+ 2621 2234 4909C7   		orq	%rax, %r15
+ 2622              	.L269:
+ 2623 2237 488B0B   		movq	(%rbx), %rcx
+ 2624 223a 803900   		cmpb	$0, (%rcx)
+ 2625 223d 0F854DFF 		jne	.L288
+ 2625      FFFF
+ 2626 2243 31F6     		xorl	%esi, %esi
+ 2627 2245 EB47     		jmp	.L267
+ 2628 2247 660F1F84 		.p2align 4,,10
+ 2628      00000000 
+ 2628      00
+ 2629              		.p2align 3
+ 2630              	.L284:
+ 2631 2250 488B4424 		movq	96(%rsp), %rax
+ 2631      60
+ 2632 2255 488D3500 		leaq	.LC65(%rip), %rsi
+ 2632      000000
+ 2633 225c 488D1500 		leaq	__func__.0(%rip), %rdx
+ 2633      000000
+ 2634 2263 31FF     		xorl	%edi, %edi
+ 2635 2265 448930   		movl	%r14d, (%rax)
+ 2636 2268 4963C6   		movslq	%r14d, %rax
+ 2637 226b 488B8CC4 		movq	256(%rsp,%rax,8), %rcx
+ 2637      00010000 
+ 2638 2273 31C0     		xorl	%eax, %eax
+ 2639 2275 E8000000 		call	debugprint@PLT
+ 2639      00
+ 2640 227a B8010000 		movl	$1, %eax
+ 2640      00
+ 2641 227f BE010000 		movl	$1, %esi
+ 2641      00
+ 2642 2284 C4E209F7 		shlx	%r14d, %eax, %eax
+ 2642      C0
+ 2643 2289 4898     		cltq
+ 2644 228b 4909C7   		orq	%rax, %r15
+ 2645              	.L267:
+ 2646 228e 488D8424 		leaq	128(%rsp), %rax
+ 2646      80000000 
+ 2647 2296 31D2     		xorl	%edx, %edx
+ 2648 2298 B9010000 		movl	$1, %ecx
+ 2648      00
+ 2649 229d 0F1F00   		.p2align 4,,10
+ 2650              		.p2align 3
+ 2651              	.L290:
+ 2652 22a0 4C3938   		cmpq	%r15, (%rax)
+ 2653 22a3 0F44D1   		cmove	%ecx, %edx
+ 2654 22a6 4883C008 		addq	$8, %rax
+ 2655 22aa 4939C5   		cmpq	%rax, %r13
+ 2656 22ad 75F1     		jne	.L290
+ 2657 22af 84D2     		testb	%dl, %dl
+ 2658 22b1 0F84F901 		je	.L301
+ 2658      0000
+ 2659              	.L291:
+ 2660 22b7 488B5C24 		movq	88(%rsp), %rbx
+ 2660      58
+ 2661 22bc 488B0500 		movq	iir_codegen@GOTPCREL(%rip), %rax
+ 2661      000000
+ 2662 22c3 C5FD6F74 		vmovdqa	32(%rsp), %ymm6
+ 2662      2420
+ 2663 22c9 488983F8 		movq	%rax, 248(%rbx)
+ 2663      000000
+ 2664 22d0 89F0     		movl	%esi, %eax
+ 2665 22d2 C5FE7FB3 		vmovdqu	%ymm6, 216(%rbx)
+ 2665      D8000000 
+ 2666 22da C5F877   		vzeroupper
+ 2667 22dd 488D65D8 		leaq	-40(%rbp), %rsp
+ 2668 22e1 5B       		popq	%rbx
+ 2669 22e2 415C     		popq	%r12
+ 2670 22e4 415D     		popq	%r13
+ 2671 22e6 415E     		popq	%r14
+ 2672 22e8 415F     		popq	%r15
+ 2673 22ea 5D       		popq	%rbp
+ 2674              		.cfi_remember_state
+ 2675              		.cfi_def_cfa 7, 8
+ 2676 22eb C3       		ret
+ 2677 22ec 0F1F4000 		.p2align 4,,10
+ 2678              		.p2align 3
+ 2679              	.L275:
+ 2680              		.cfi_restore_state
+ 2681 22f0 488B7C24 		movq	120(%rsp), %rdi
+ 2681      78
+ 2682 22f5 31F6     		xorl	%esi, %esi
+ 2683 22f7 E8000000 		call	strtod@PLT
+ 2683      00
+ 2684 22fc 488B4424 		movq	96(%rsp), %rax
+ 2684      60
+ 2685 2301 C5FB1140 		vmovsd	%xmm0, 72(%rax)
+ 2685      48
+ 2686 2306 E91DFFFF 		jmp	.L286
+ 2686      FF
+ 2687 230b 0F1F4400 		.p2align 4,,10
+ 2687      00
+ 2688              		.p2align 3
+ 2689              	.L276:
+ 2690 2310 488B7C24 		movq	120(%rsp), %rdi
+ 2690      78
+ 2691 2315 31F6     		xorl	%esi, %esi
+ 2692 2317 E8000000 		call	strtod@PLT
+ 2692      00
+ 2693 231c 488B4424 		movq	96(%rsp), %rax
+ 2693      60
+ 2694 2321 C5FB1140 		vmovsd	%xmm0, 64(%rax)
+ 2694      40
+ 2695 2326 E9FDFEFF 		jmp	.L286
+ 2695      FF
+ 2696 232b 0F1F4400 		.p2align 4,,10
+ 2696      00
+ 2697              		.p2align 3
+ 2698              	.L273:
+ 2699 2330 488B7C24 		movq	120(%rsp), %rdi
+ 2699      78
+ 2700 2335 31F6     		xorl	%esi, %esi
+ 2701 2337 E8000000 		call	strtod@PLT
+ 2701      00
+ 2702 233c 488B4424 		movq	96(%rsp), %rax
+ 2702      60
+ 2703 2341 C5FB1140 		vmovsd	%xmm0, 80(%rax)
+ 2703      50
+ 2704 2346 E9DDFEFF 		jmp	.L286
+ 2704      FF
+ 2705 234b 0F1F4400 		.p2align 4,,10
+ 2705      00
+ 2706              		.p2align 3
+ 2707              	.L283:
+ 2708 2350 488B7C24 		movq	120(%rsp), %rdi
+ 2708      78
+ 2709 2355 31F6     		xorl	%esi, %esi
+ 2710 2357 E8000000 		call	strtod@PLT
+ 2710      00
+ 2711 235c 488B4424 		movq	96(%rsp), %rax
+ 2711      60
+ 2712 2361 C5FB1140 		vmovsd	%xmm0, 8(%rax)
+ 2712      08
+ 2713 2366 E9BDFEFF 		jmp	.L286
+ 2713      FF
+ 2714 236b 0F1F4400 		.p2align 4,,10
+ 2714      00
+ 2715              		.p2align 3
+ 2716              	.L281:
+ 2717 2370 488B7C24 		movq	120(%rsp), %rdi
+ 2717      78
+ 2718 2375 31F6     		xorl	%esi, %esi
+ 2719 2377 E8000000 		call	strtod@PLT
+ 2719      00
+ 2720 237c 488B4424 		movq	96(%rsp), %rax
+ 2720      60
+ 2721 2381 C5FB1140 		vmovsd	%xmm0, 40(%rax)
+ 2721      28
+ 2722 2386 E99DFEFF 		jmp	.L286
+ 2722      FF
+ 2723 238b 0F1F4400 		.p2align 4,,10
+ 2723      00
+ 2724              		.p2align 3
+ 2725              	.L282:
+ 2726 2390 488B7C24 		movq	120(%rsp), %rdi
+ 2726      78
+ 2727 2395 31F6     		xorl	%esi, %esi
+ 2728 2397 E8000000 		call	strtod@PLT
+ 2728      00
+ 2729 239c 488B4424 		movq	96(%rsp), %rax
+ 2729      60
+ 2730 23a1 C5FB1140 		vmovsd	%xmm0, 24(%rax)
+ 2730      18
+ 2731 23a6 E97DFEFF 		jmp	.L286
+ 2731      FF
+ 2732 23ab 0F1F4400 		.p2align 4,,10
+ 2732      00
+ 2733              		.p2align 3
+ 2734              	.L277:
+ 2735 23b0 488B7C24 		movq	120(%rsp), %rdi
+ 2735      78
+ 2736 23b5 31F6     		xorl	%esi, %esi
+ 2737 23b7 E8000000 		call	strtod@PLT
+ 2737      00
+ 2738 23bc 488B4424 		movq	96(%rsp), %rax
+ 2738      60
+ 2739 23c1 C5FB1140 		vmovsd	%xmm0, 56(%rax)
+ 2739      38
+ 2740 23c6 E95DFEFF 		jmp	.L286
+ 2740      FF
+ 2741 23cb 0F1F4400 		.p2align 4,,10
+ 2741      00
+ 2742              		.p2align 3
+ 2743              	.L278:
+ 2744 23d0 488B7C24 		movq	120(%rsp), %rdi
+ 2744      78
+ 2745 23d5 31F6     		xorl	%esi, %esi
+ 2746 23d7 E8000000 		call	strtod@PLT
+ 2746      00
+ 2747 23dc 488B4424 		movq	96(%rsp), %rax
+ 2747      60
+ 2748 23e1 C5FB1140 		vmovsd	%xmm0, 48(%rax)
+ 2748      30
+ 2749 23e6 E93DFEFF 		jmp	.L286
+ 2749      FF
+ 2750 23eb 0F1F4400 		.p2align 4,,10
+ 2750      00
+ 2751              		.p2align 3
+ 2752              	.L279:
+ 2753 23f0 488B7C24 		movq	120(%rsp), %rdi
+ 2753      78
+ 2754 23f5 31F6     		xorl	%esi, %esi
+ 2755 23f7 E8000000 		call	strtod@PLT
+ 2755      00
+ 2756 23fc 488B4424 		movq	96(%rsp), %rax
+ 2756      60
+ 2757 2401 C5FB1140 		vmovsd	%xmm0, 32(%rax)
+ 2757      20
+ 2758 2406 E91DFEFF 		jmp	.L286
+ 2758      FF
+ 2759 240b 0F1F4400 		.p2align 4,,10
+ 2759      00
+ 2760              		.p2align 3
+ 2761              	.L280:
+ 2762 2410 488B7C24 		movq	120(%rsp), %rdi
+ 2762      78
+ 2763 2415 31F6     		xorl	%esi, %esi
+ 2764 2417 E8000000 		call	strtod@PLT
+ 2764      00
+ 2765 241c 488B4424 		movq	96(%rsp), %rax
+ 2765      60
+ 2766 2421 C5FB1140 		vmovsd	%xmm0, 16(%rax)
+ 2766      10
+ 2767 2426 E9FDFDFF 		jmp	.L286
+ 2767      FF
+ 2768 242b 0F1F4400 		.p2align 4,,10
+ 2768      00
+ 2769              		.p2align 3
+ 2770              	.L270:
+ 2771 2430 4885C0   		testq	%rax, %rax
+ 2772 2433 0F84A5FD 		je	.L271
+ 2772      FFFF
+ 2773 2439 4963C6   		movslq	%r14d, %rax
+ 2774 243c 488D3500 		leaq	.LC64(%rip), %rsi
+ 2774      000000
+ 2775 2443 31FF     		xorl	%edi, %edi
+ 2776 2445 488B94C4 		movq	256(%rsp,%rax,8), %rdx
+ 2776      00010000 
+ 2777 244d 31C0     		xorl	%eax, %eax
+ 2778 244f E8000000 		call	debugprint@PLT
+ 2778      00
+ 2779 2454 E985FDFF 		jmp	.L271
+ 2779      FF
+ 2780 2459 0F1F8000 		.p2align 4,,10
+ 2780      000000
+ 2781              		.p2align 3
+ 2782              	.L272:
+ 2783 2460 488B4C24 		movq	120(%rsp), %rcx
+ 2783      78
+ 2784 2465 488D1500 		leaq	__func__.0(%rip), %rdx
+ 2784      000000
+ 2785 246c 31FF     		xorl	%edi, %edi
+ 2786 246e 31C0     		xorl	%eax, %eax
+ 2787 2470 488D3500 		leaq	.LC62(%rip), %rsi
+ 2787      000000
+ 2788 2477 E8000000 		call	debugprint@PLT
+ 2788      00
+ 2789 247c E9B6FDFF 		jmp	.L269
+ 2789      FF
+ 2790              		.p2align 4,,10
+ 2791 2481 0F1F8000 		.p2align 3
+ 2791      000000
+ 2792              	.L300:
+ 2793 2488 4A8B94F4 		movq	256(%rsp,%r14,8), %rdx
+ 2793      00010000 
+ 2794 2490 488D3500 		leaq	.LC63(%rip), %rsi
+ 2794      000000
+ 2795 2497 31FF     		xorl	%edi, %edi
+ 2796 2499 E8000000 		call	debugprint@PLT
+ 2796      00
+ 2797 249e BE010000 		movl	$1, %esi
+ 2797      00
+ 2798 24a3 E9E6FDFF 		jmp	.L267
+ 2798      FF
+ 2799 24a8 0F1F8400 		.p2align 4,,10
+ 2799      00000000 
+ 2800              		.p2align 3
+ 2801              	.L301:
+ 2802 24b0 488B4424 		movq	96(%rsp), %rax
+ 2802      60
+ 2803 24b5 488D3500 		leaq	.LC67(%rip), %rsi
+ 2803      000000
+ 2804 24bc 488D1500 		leaq	__func__.0(%rip), %rdx
+ 2804      000000
+ 2805 24c3 31FF     		xorl	%edi, %edi
+ 2806 24c5 8B00     		movl	(%rax), %eax
+ 2807 24c7 488B8CC4 		movq	256(%rsp,%rax,8), %rcx
+ 2807      00010000 
+ 2808 24cf 31C0     		xorl	%eax, %eax
+ 2809 24d1 E8000000 		call	debugprint@PLT
+ 2809      00
+ 2810 24d6 BE010000 		movl	$1, %esi
+ 2810      00
+ 2811 24db E9D7FDFF 		jmp	.L291
+ 2811      FF
+ 2812              	.L292:
+ 2813 24e0 31F6     		xorl	%esi, %esi
+ 2814 24e2 4C8DAC24 		leaq	256(%rsp), %r13
+ 2814      00010000 
+ 2815 24ea E99FFDFF 		jmp	.L267
+ 2815      FF
+ 2816              		.cfi_endproc
+ 2817              	.LFE30:
+ 2819              		.section	.rodata.str1.1
+ 2820              	.LC68:
+ 2821 00cf 20204949 		.string	"  IIR options\n"
+ 2821      52206F70 
+ 2821      74696F6E 
+ 2821      730A00
+ 2822              	.LC69:
+ 2823 00de 20202020 		.string	"    Name: iir\n"
+ 2823      4E616D65 
+ 2823      3A206969 
+ 2823      720A00
+ 2824              	.LC70:
+ 2825 00ed 20202020 		.string	"    type: direct\n"
+ 2825      74797065 
+ 2825      3A206469 
+ 2825      72656374 
+ 2825      0A00
+ 2826              		.section	.rodata.str1.8
+ 2827 030a 00000000 		.align 8
+ 2827      0000
+ 2828              	.LC71:
+ 2829 0310 20202020 		.string	"        a1=,a2=,b0=,b1=,b2=coefficient\n"
+ 2829      20202020 
+ 2829      61313D2C 
+ 2829      61323D2C 
+ 2829      62303D2C 
+ 2830              		.align 8
+ 2831              	.LC72:
+ 2832 0338 20202020 		.string	"    Example: -p iir,direct,a1=1,a2=0,b0=1,b1=2,b2=1\n"
+ 2832      4578616D 
+ 2832      706C653A 
+ 2832      202D7020 
+ 2832      6969722C 
+ 2833 036d 000000   		.align 8
+ 2834              	.LC73:
+ 2835 0370 20202020 		.string	"    type: lp2 Second order lowpass\n"
+ 2835      74797065 
+ 2835      3A206C70 
+ 2835      32205365 
+ 2835      636F6E64 
+ 2836              		.section	.rodata.str1.1
+ 2837              	.LC74:
+ 2838 00ff 20202020 		.string	"        f = cutoff frequency\n"
+ 2838      20202020 
+ 2838      66203D20 
+ 2838      6375746F 
+ 2838      66662066 
+ 2839              	.LC75:
+ 2840 011d 20202020 		.string	"        q = quality factor\n"
+ 2840      20202020 
+ 2840      71203D20 
+ 2840      7175616C 
+ 2840      69747920 
+ 2841              	.LC76:
+ 2842 0139 20202020 		.string	"        g = gain (dB)\n"
+ 2842      20202020 
+ 2842      67203D20 
+ 2842      6761696E 
+ 2842      20286442 
+ 2843              		.section	.rodata.str1.8
+ 2844 0394 00000000 		.align 8
+ 2845              	.LC77:
+ 2846 0398 20202020 		.string	"    Example: -p iir,lp2,f=1000,q=0.707,g=0\n"
+ 2846      4578616D 
+ 2846      706C653A 
+ 2846      202D7020 
+ 2846      6969722C 
+ 2847 03c4 00000000 		.align 8
+ 2848              	.LC78:
+ 2849 03c8 20202020 		.string	"    type: hp2 Second order highpass\n"
+ 2849      74797065 
+ 2849      3A206870 
+ 2849      32205365 
+ 2849      636F6E64 
+ 2850 03ed 000000   		.align 8
+ 2851              	.LC79:
+ 2852 03f0 20202020 		.string	"    Example: -p iir,hp2,f=1000,q=0.707,g=0\n"
+ 2852      4578616D 
+ 2852      706C653A 
+ 2852      202D7020 
+ 2852      6969722C 
+ 2853 041c 00000000 		.align 8
+ 2854              	.LC80:
+ 2855 0420 20202020 		.string	"    type: ls2 Second order lowshelf\n"
+ 2855      74797065 
+ 2855      3A206C73 
+ 2855      32205365 
+ 2855      636F6E64 
+ 2856 0445 000000   		.align 8
+ 2857              	.LC81:
+ 2858 0448 20202020 		.string	"    Example: -p iir,ls2,f=1000,q=0.707,g=-3\n"
+ 2858      4578616D 
+ 2858      706C653A 
+ 2858      202D7020 
+ 2858      6969722C 
+ 2859 0475 000000   		.align 8
+ 2860              	.LC82:
+ 2861 0478 20202020 		.string	"    type: hs2 Second order highshelf\n"
+ 2861      74797065 
+ 2861      3A206873 
+ 2861      32205365 
+ 2861      636F6E64 
+ 2862 049e 0000     		.align 8
+ 2863              	.LC83:
+ 2864 04a0 20202020 		.string	"    Example: -p iir,hs2,f=1000,q=0.707,g=-3\n"
+ 2864      4578616D 
+ 2864      706C653A 
+ 2864      202D7020 
+ 2864      6969722C 
+ 2865 04cd 000000   		.align 8
+ 2866              	.LC84:
+ 2867 04d0 20202020 		.string	"    type: ap2 Second order allpass\n"
+ 2867      74797065 
+ 2867      3A206170 
+ 2867      32205365 
+ 2867      636F6E64 
+ 2868 04f4 00000000 		.align 8
+ 2869              	.LC85:
+ 2870 04f8 20202020 		.string	"    Example: -p iir,ap2,f=1000,q=0.707,g=0\n"
+ 2870      4578616D 
+ 2870      706C653A 
+ 2870      202D7020 
+ 2870      6969722C 
+ 2871 0524 00000000 		.align 8
+ 2872              	.LC86:
+ 2873 0528 20202020 		.string	"    type: peq Peaking equalizer\n"
+ 2873      74797065 
+ 2873      3A207065 
+ 2873      71205065 
+ 2873      616B696E 
+ 2874              		.section	.rodata.str1.1
+ 2875              	.LC87:
+ 2876 0150 20202020 		.string	"        f = center frequency\n"
+ 2876      20202020 
+ 2876      66203D20 
+ 2876      63656E74 
+ 2876      65722066 
+ 2877              		.section	.rodata.str1.8
+ 2878 0549 00000000 		.align 8
+ 2878      000000
+ 2879              	.LC88:
+ 2880 0550 20202020 		.string	"    Example: -p iir,peq,f=1000,q=2.2,g=4\n"
+ 2880      4578616D 
+ 2880      706C653A 
+ 2880      202D7020 
+ 2880      6969722C 
+ 2881 057a 00000000 		.align 8
+ 2881      0000
+ 2882              	.LC89:
+ 2883 0580 20202020 		.string	"    type: lwt Linkwitz transform\n"
+ 2883      74797065 
+ 2883      3A206C77 
+ 2883      74204C69 
+ 2883      6E6B7769 
+ 2884 05a2 00000000 		.align 8
+ 2884      0000
+ 2885              	.LC90:
+ 2886 05a8 20202020 		.string	"        f = current cutoff frequency\n"
+ 2886      20202020 
+ 2886      66203D20 
+ 2886      63757272 
+ 2886      656E7420 
+ 2887 05ce 0000     		.align 8
+ 2888              	.LC91:
+ 2889 05d0 20202020 		.string	"        q = current quality factor\n"
+ 2889      20202020 
+ 2889      71203D20 
+ 2889      63757272 
+ 2889      656E7420 
+ 2890 05f4 00000000 		.align 8
+ 2891              	.LC92:
+ 2892 05f8 20202020 		.string	"        f1 = target cutoff frequency\n"
+ 2892      20202020 
+ 2892      6631203D 
+ 2892      20746172 
+ 2892      67657420 
+ 2893 061e 0000     		.align 8
+ 2894              	.LC93:
+ 2895 0620 20202020 		.string	"        q1 = target quality factor\n"
+ 2895      20202020 
+ 2895      7131203D 
+ 2895      20746172 
+ 2895      67657420 
+ 2896 0644 00000000 		.align 8
+ 2897              	.LC94:
+ 2898 0648 20202020 		.string	"    Example: -p iir,lwt,f=100,q=1,f1=40,q1=0.707\n"
+ 2898      4578616D 
+ 2898      706C653A 
+ 2898      202D7020 
+ 2898      6969722C 
+ 2899              		.text
+ 2900 24ef 90       		.p2align 4
+ 2901              		.globl	help_iir
+ 2903              	help_iir:
+ 2904              	.LFB31:
+ 2905              		.cfi_startproc
+ 2906 24f0 4154     		pushq	%r12
+ 2907              		.cfi_def_cfa_offset 16
+ 2908              		.cfi_offset 12, -16
+ 2909 24f2 31FF     		xorl	%edi, %edi
+ 2910 24f4 31C0     		xorl	%eax, %eax
+ 2911 24f6 488D3500 		leaq	.LC68(%rip), %rsi
+ 2911      000000
+ 2912 24fd 55       		pushq	%rbp
+ 2913              		.cfi_def_cfa_offset 24
+ 2914              		.cfi_offset 6, -24
+ 2915 24fe 4C8D2500 		leaq	.LC74(%rip), %r12
+ 2915      000000
+ 2916 2505 488D2D00 		leaq	.LC75(%rip), %rbp
+ 2916      000000
+ 2917 250c 53       		pushq	%rbx
+ 2918              		.cfi_def_cfa_offset 32
+ 2919              		.cfi_offset 3, -32
+ 2920 250d 488D1D00 		leaq	.LC76(%rip), %rbx
+ 2920      000000
+ 2921 2514 E8000000 		call	debugprint@PLT
+ 2921      00
+ 2922 2519 31FF     		xorl	%edi, %edi
+ 2923 251b 31C0     		xorl	%eax, %eax
+ 2924 251d 488D3500 		leaq	.LC69(%rip), %rsi
+ 2924      000000
+ 2925 2524 E8000000 		call	debugprint@PLT
+ 2925      00
+ 2926 2529 31FF     		xorl	%edi, %edi
+ 2927 252b 31C0     		xorl	%eax, %eax
+ 2928 252d 488D3500 		leaq	.LC70(%rip), %rsi
+ 2928      000000
+ 2929 2534 E8000000 		call	debugprint@PLT
+ 2929      00
+ 2930 2539 31FF     		xorl	%edi, %edi
+ 2931 253b 31C0     		xorl	%eax, %eax
+ 2932 253d 488D3500 		leaq	.LC71(%rip), %rsi
+ 2932      000000
+ 2933 2544 E8000000 		call	debugprint@PLT
+ 2933      00
+ 2934 2549 31FF     		xorl	%edi, %edi
+ 2935 254b 31C0     		xorl	%eax, %eax
+ 2936 254d 488D3500 		leaq	.LC72(%rip), %rsi
+ 2936      000000
+ 2937 2554 E8000000 		call	debugprint@PLT
+ 2937      00
+ 2938 2559 31FF     		xorl	%edi, %edi
+ 2939 255b 31C0     		xorl	%eax, %eax
+ 2940 255d 488D3500 		leaq	.LC73(%rip), %rsi
+ 2940      000000
+ 2941 2564 E8000000 		call	debugprint@PLT
+ 2941      00
+ 2942 2569 4C89E6   		movq	%r12, %rsi
+ 2943 256c 31FF     		xorl	%edi, %edi
+ 2944 256e 31C0     		xorl	%eax, %eax
+ 2945 2570 E8000000 		call	debugprint@PLT
+ 2945      00
+ 2946 2575 4889EE   		movq	%rbp, %rsi
+ 2947 2578 31FF     		xorl	%edi, %edi
+ 2948 257a 31C0     		xorl	%eax, %eax
+ 2949 257c E8000000 		call	debugprint@PLT
+ 2949      00
+ 2950 2581 4889DE   		movq	%rbx, %rsi
+ 2951 2584 31FF     		xorl	%edi, %edi
+ 2952 2586 31C0     		xorl	%eax, %eax
+ 2953 2588 E8000000 		call	debugprint@PLT
+ 2953      00
+ 2954 258d 31FF     		xorl	%edi, %edi
+ 2955 258f 31C0     		xorl	%eax, %eax
+ 2956 2591 488D3500 		leaq	.LC77(%rip), %rsi
+ 2956      000000
+ 2957 2598 E8000000 		call	debugprint@PLT
+ 2957      00
+ 2958 259d 488D3500 		leaq	.LC78(%rip), %rsi
+ 2958      000000
+ 2959 25a4 31FF     		xorl	%edi, %edi
+ 2960 25a6 31C0     		xorl	%eax, %eax
+ 2961 25a8 E8000000 		call	debugprint@PLT
+ 2961      00
+ 2962 25ad 4C89E6   		movq	%r12, %rsi
+ 2963 25b0 31FF     		xorl	%edi, %edi
+ 2964 25b2 31C0     		xorl	%eax, %eax
+ 2965 25b4 E8000000 		call	debugprint@PLT
+ 2965      00
+ 2966 25b9 4889EE   		movq	%rbp, %rsi
+ 2967 25bc 31FF     		xorl	%edi, %edi
+ 2968 25be 31C0     		xorl	%eax, %eax
+ 2969 25c0 E8000000 		call	debugprint@PLT
+ 2969      00
+ 2970 25c5 4889DE   		movq	%rbx, %rsi
+ 2971 25c8 31FF     		xorl	%edi, %edi
+ 2972 25ca 31C0     		xorl	%eax, %eax
+ 2973 25cc E8000000 		call	debugprint@PLT
+ 2973      00
+ 2974 25d1 31FF     		xorl	%edi, %edi
+ 2975 25d3 31C0     		xorl	%eax, %eax
+ 2976 25d5 488D3500 		leaq	.LC79(%rip), %rsi
+ 2976      000000
+ 2977 25dc E8000000 		call	debugprint@PLT
+ 2977      00
+ 2978 25e1 31FF     		xorl	%edi, %edi
+ 2979 25e3 31C0     		xorl	%eax, %eax
+ 2980 25e5 488D3500 		leaq	.LC80(%rip), %rsi
+ 2980      000000
+ 2981 25ec E8000000 		call	debugprint@PLT
+ 2981      00
+ 2982 25f1 4C89E6   		movq	%r12, %rsi
+ 2983 25f4 31FF     		xorl	%edi, %edi
+ 2984 25f6 31C0     		xorl	%eax, %eax
+ 2985 25f8 E8000000 		call	debugprint@PLT
+ 2985      00
+ 2986 25fd 4889EE   		movq	%rbp, %rsi
+ 2987 2600 31FF     		xorl	%edi, %edi
+ 2988 2602 31C0     		xorl	%eax, %eax
+ 2989 2604 E8000000 		call	debugprint@PLT
+ 2989      00
+ 2990 2609 4889DE   		movq	%rbx, %rsi
+ 2991 260c 31FF     		xorl	%edi, %edi
+ 2992 260e 31C0     		xorl	%eax, %eax
+ 2993 2610 E8000000 		call	debugprint@PLT
+ 2993      00
+ 2994 2615 31FF     		xorl	%edi, %edi
+ 2995 2617 31C0     		xorl	%eax, %eax
+ 2996 2619 488D3500 		leaq	.LC81(%rip), %rsi
+ 2996      000000
+ 2997 2620 E8000000 		call	debugprint@PLT
+ 2997      00
+ 2998 2625 31FF     		xorl	%edi, %edi
+ 2999 2627 488D3500 		leaq	.LC82(%rip), %rsi
+ 2999      000000
+ 3000 262e 31C0     		xorl	%eax, %eax
+ 3001 2630 E8000000 		call	debugprint@PLT
+ 3001      00
+ 3002 2635 4C89E6   		movq	%r12, %rsi
+ 3003 2638 31FF     		xorl	%edi, %edi
+ 3004 263a 31C0     		xorl	%eax, %eax
+ 3005 263c E8000000 		call	debugprint@PLT
+ 3005      00
+ 3006 2641 4889EE   		movq	%rbp, %rsi
+ 3007 2644 31FF     		xorl	%edi, %edi
+ 3008 2646 31C0     		xorl	%eax, %eax
+ 3009 2648 E8000000 		call	debugprint@PLT
+ 3009      00
+ 3010 264d 4889DE   		movq	%rbx, %rsi
+ 3011 2650 31FF     		xorl	%edi, %edi
+ 3012 2652 31C0     		xorl	%eax, %eax
+ 3013 2654 E8000000 		call	debugprint@PLT
+ 3013      00
+ 3014 2659 31FF     		xorl	%edi, %edi
+ 3015 265b 31C0     		xorl	%eax, %eax
+ 3016 265d 488D3500 		leaq	.LC83(%rip), %rsi
+ 3016      000000
+ 3017 2664 E8000000 		call	debugprint@PLT
+ 3017      00
+ 3018 2669 31FF     		xorl	%edi, %edi
+ 3019 266b 31C0     		xorl	%eax, %eax
+ 3020 266d 488D3500 		leaq	.LC84(%rip), %rsi
+ 3020      000000
+ 3021 2674 E8000000 		call	debugprint@PLT
+ 3021      00
+ 3022 2679 4C89E6   		movq	%r12, %rsi
+ 3023 267c 31FF     		xorl	%edi, %edi
+ 3024 267e 31C0     		xorl	%eax, %eax
+ 3025 2680 E8000000 		call	debugprint@PLT
+ 3025      00
+ 3026 2685 4889EE   		movq	%rbp, %rsi
+ 3027 2688 31FF     		xorl	%edi, %edi
+ 3028 268a 31C0     		xorl	%eax, %eax
+ 3029 268c E8000000 		call	debugprint@PLT
+ 3029      00
+ 3030 2691 4889DE   		movq	%rbx, %rsi
+ 3031 2694 31FF     		xorl	%edi, %edi
+ 3032 2696 31C0     		xorl	%eax, %eax
+ 3033 2698 E8000000 		call	debugprint@PLT
+ 3033      00
+ 3034 269d 31FF     		xorl	%edi, %edi
+ 3035 269f 31C0     		xorl	%eax, %eax
+ 3036 26a1 488D3500 		leaq	.LC85(%rip), %rsi
+ 3036      000000
+ 3037 26a8 E8000000 		call	debugprint@PLT
+ 3037      00
+ 3038 26ad 31FF     		xorl	%edi, %edi
+ 3039 26af 31C0     		xorl	%eax, %eax
+ 3040 26b1 488D3500 		leaq	.LC86(%rip), %rsi
+ 3040      000000
+ 3041 26b8 E8000000 		call	debugprint@PLT
+ 3041      00
+ 3042 26bd 31C0     		xorl	%eax, %eax
+ 3043 26bf 488D3500 		leaq	.LC87(%rip), %rsi
+ 3043      000000
+ 3044 26c6 31FF     		xorl	%edi, %edi
+ 3045 26c8 E8000000 		call	debugprint@PLT
+ 3045      00
+ 3046 26cd 31FF     		xorl	%edi, %edi
+ 3047 26cf 4889EE   		movq	%rbp, %rsi
+ 3048 26d2 31C0     		xorl	%eax, %eax
+ 3049 26d4 E8000000 		call	debugprint@PLT
+ 3049      00
+ 3050 26d9 4889DE   		movq	%rbx, %rsi
+ 3051 26dc 31FF     		xorl	%edi, %edi
+ 3052 26de 31C0     		xorl	%eax, %eax
+ 3053 26e0 E8000000 		call	debugprint@PLT
+ 3053      00
+ 3054 26e5 488D3500 		leaq	.LC88(%rip), %rsi
+ 3054      000000
+ 3055 26ec 31FF     		xorl	%edi, %edi
+ 3056 26ee 31C0     		xorl	%eax, %eax
+ 3057 26f0 E8000000 		call	debugprint@PLT
+ 3057      00
+ 3058 26f5 488D3500 		leaq	.LC89(%rip), %rsi
+ 3058      000000
+ 3059 26fc 31FF     		xorl	%edi, %edi
+ 3060 26fe 31C0     		xorl	%eax, %eax
+ 3061 2700 E8000000 		call	debugprint@PLT
+ 3061      00
+ 3062 2705 488D3500 		leaq	.LC90(%rip), %rsi
+ 3062      000000
+ 3063 270c 31FF     		xorl	%edi, %edi
+ 3064 270e 31C0     		xorl	%eax, %eax
+ 3065 2710 E8000000 		call	debugprint@PLT
+ 3065      00
+ 3066 2715 488D3500 		leaq	.LC91(%rip), %rsi
+ 3066      000000
+ 3067 271c 31FF     		xorl	%edi, %edi
+ 3068 271e 31C0     		xorl	%eax, %eax
+ 3069 2720 E8000000 		call	debugprint@PLT
+ 3069      00
+ 3070 2725 488D3500 		leaq	.LC92(%rip), %rsi
+ 3070      000000
+ 3071 272c 31FF     		xorl	%edi, %edi
+ 3072 272e 31C0     		xorl	%eax, %eax
+ 3073 2730 E8000000 		call	debugprint@PLT
+ 3073      00
+ 3074 2735 488D3500 		leaq	.LC93(%rip), %rsi
+ 3074      000000
+ 3075 273c 31FF     		xorl	%edi, %edi
+ 3076 273e 31C0     		xorl	%eax, %eax
+ 3077 2740 E8000000 		call	debugprint@PLT
+ 3077      00
+ 3078 2745 5B       		popq	%rbx
+ 3079              		.cfi_def_cfa_offset 24
+ 3080 2746 488D3500 		leaq	.LC94(%rip), %rsi
+ 3080      000000
+ 3081 274d 5D       		popq	%rbp
+ 3082              		.cfi_def_cfa_offset 16
+ 3083 274e 31FF     		xorl	%edi, %edi
+ 3084 2750 31C0     		xorl	%eax, %eax
+ 3085 2752 415C     		popq	%r12
+ 3086              		.cfi_def_cfa_offset 8
+ 3087 2754 E9000000 		jmp	debugprint@PLT
+ 3087      00
+ 3088              		.cfi_endproc
+ 3089              	.LFE31:
+ 3091              		.section	.rodata
+ 3092              		.align 8
+ 3095              	__func__.0:
+ 3096 00a0 63726561 		.string	"create_iir"
+ 3096      74655F69 
+ 3096      697200
+ 3097 00ab 00000000 		.align 8
+ 3097      00
+ 3100              	__func__.1:
+ 3101 00b0 6969725F 		.string	"iir_decay"
+ 3101      64656361 
+ 3101      7900
+ 3102 00ba 00000000 		.align 8
+ 3102      0000
+ 3105              	__func__.2:
+ 3106 00c0 63616C63 		.string	"calc_coeffs"
+ 3106      5F636F65 
+ 3106      66667300 
+ 3107              		.section	.data.rel.ro,"aw"
+ 3108              		.align 32
+ 3111              	iir_process_kernels:
+ 3112 0000 02000000 		.long	2
+ 3113 0004 40000000 		.long	64
+ 3114 0008 00000000 		.quad	iir_process_2_64
+ 3114      00000000 
+ 3115 0010 02000000 		.long	2
+ 3116 0014 80000000 		.long	128
+ 3117 0018 00000000 		.quad	iir_process_2_128
+ 3117      00000000 
+ 3118 0020 02000000 		.long	2
+ 3119 0024 00010000 		.long	256
+ 3120 0028 00000000 		.quad	iir_process_2_256
+ 3120      00000000 
+ 3121 0030 08000000 		.long	8
+ 3122 0034 40000000 		.long	64
+ 3123 0038 00000000 		.quad	iir_process_8_64
+ 3123      00000000 
+ 3124 0040 08000000 		.long	8
+ 3125 0044 80000000 		.long	128
+ 3126 0048 00000000 		.quad	iir_process_8_128
+ 3126      00000000 
+ 3127 0050 08000000 		.long	8
+ 3128 0054 00010000 		.long	256
+ 3129 0058 00000000 		.quad	iir_process_8_256
+ 3129      00000000 
+ 3130 0060 00000000 		.long	0
+ 3131 0064 00000000 		.long	0
+ 3132 0068 00000000 		.quad	iir_process
+ 3132      00000000 
+ 3133              		.section	.rodata.cst16,"aM",@progbits,16
+ 3134              		.align 16
+ 3135              	.LC0:
+ 3136 0000 FFFFFFFF 		.long	-1
+ 3137 0004 FFFFFF7F 		.long	2147483647
+ 3138 0008 00000000 		.long	0
+ 3139 000c 00000000 		.long	0
+ 3140              		.section	.rodata.cst8,"aM",@progbits,8
+ 3141              		.align 8
+ 3142              	.LC1:
+ 3143 0000 BBBDD7D9 		.long	-640172613
+ 3144 0004 DF7CDB3D 		.long	1037794527
+ 3145              		.align 8
+ 3146              	.LC17:
+ 3147 0008 00000000 		.long	0
+ 3148 000c 00003440 		.long	1077149696
+ 3149              		.align 8
+ 3150              	.LC18:
+ 3151 0010 00000000 		.long	0
+ 3152 0014 00002440 		.long	1076101120
+ 3153              		.align 8
+ 3154              	.LC19:
+ 3155 0018 182D4454 		.long	1413754136
+ 3156 001c FB211940 		.long	1075388923
+ 3157              		.set	.LC22,.LC32
+ 3158              		.align 8
+ 3159              	.LC23:
+ 3160 0020 00000000 		.long	0
+ 3161 0024 0000E03F 		.long	1071644672
+ 3162              		.align 8
+ 3163              	.LC24:
+ 3164 0028 00000000 		.long	0
+ 3165 002c 000000C0 		.long	-1073741824
+ 3166              		.section	.rodata.cst16
+ 3167              		.align 16
+ 3168              	.LC25:
+ 3169 0010 00000000 		.long	0
+ 3170 0014 00000080 		.long	-2147483648
+ 3171 0018 00000000 		.long	0
+ 3172 001c 00000000 		.long	0
+ 3173              		.section	.rodata.cst8
+ 3174              		.align 8
+ 3175              	.LC26:
+ 3176 0030 6F26E4F3 		.long	-203151761
+ 3177 0034 7F07EA3F 		.long	1072301951
+ 3178              		.align 8
+ 3179              	.LC27:
+ 3180 0038 BC72874A 		.long	1250390716
+ 3181 003c B4C5DA3F 		.long	1071302068
+ 3182              		.align 8
+ 3183              	.LC28:
+ 3184 0040 51235EED 		.long	-312597679
+ 3185 0044 924EF93F 		.long	1073303186
+ 3186              		.align 8
+ 3187              	.LC29:
+ 3188 0048 BC72874A 		.long	1250390716
+ 3189 004c B4C5EA3F 		.long	1072350644
+ 3190              		.align 8
+ 3191              	.LC30:
+ 3192 0050 51235EED 		.long	-312597679
+ 3193 0054 924E0940 		.long	1074351762
+ 3194              		.section	.rodata.cst16
+ 3195              		.align 16
+ 3196              	.LC32:
+ 3197 0020 00000000 		.long	0
+ 3198 0024 0000F03F 		.long	1072693248
+ 3199 0028 00000000 		.long	0
+ 3200 002c 00000000 		.long	0
+ 3201              		.align 16
+ 3202              	.LC33:
+ 3203 0030 00000000 		.long	0
+ 3204 0034 00000000 		.long	0
+ 3205 0038 00000000 		.long	0
+ 3206 003c 0000F03F 		.long	1072693248
+ 3207              		.section	.rodata
+ 3208 00cc 00000000 		.align 64
+ 3208      00000000 
+ 3208      00000000 
+ 3208      00000000 
+ 3208      00000000 
+ 3209              	.LC58:
+ 3210 0100 01007C00 		.quad	8126465
+ 3210      00000000 
+ 3211 0108 02E00000 		.quad	57346
+ 3211      00000000 
+ 3212 0110 02600000 		.quad	24578
+ 3212      00000000 
+ 3213 0118 04E00000 		.quad	57348
+ 3213      00000000 
+ 3214 0120 04600000 		.quad	24580
+ 3214      00000000 
+ 3215 0128 20200000 		.quad	8224
+ 3215      00000000 
+ 3216 0130 40200000 		.quad	8256
+ 3216      00000000 
+ 3217 0138 08E00000 		.quad	57352
+ 3217      00000000 
+ 3218              		.align 64
+ 3219              	.LC59:
+ 3220 0140 10E00000 		.quad	57360
+ 3220      00000000 
+ 3221 0148 80A00000 		.quad	41088
+ 3221      00000000 
+ 3222 0150 00A10000 		.quad	41216
+ 3222      00000000 
+ 3223 0158 00E20000 		.quad	57856
+ 3223      00000000 
+ 3224 0160 00E40300 		.quad	254976
+ 3224      00000000 
+ 3225 0168 00640300 		.quad	222208
+ 3225      00000000 
+ 3226 0170 00E80000 		.quad	59392
+ 3226      00000000 
+ 3227 0178 00680000 		.quad	26624
+ 3227      00000000 
+ 3228              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 3229              		.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1291 @@
+   1              		.file	"dsp-mix.c"
+   2              		.text
+   3              		.p2align 4
+   4              		.globl	mix_preroll
+   6              	mix_preroll:
+   7              	.LFB6400:
+   8              		.cfi_startproc
+   9 0000 31C0     		xorl	%eax, %eax
+  10 0002 C3       		ret
+  11              		.cfi_endproc
+  12              	.LFE6400:
+  14 0003 66662E0F 		.p2align 4
+  14      1F840000 
+  14      00000066 
+  14      90
+  15              		.globl	mix_process
+  17              	mix_process:
+  18              	.LFB6397:
+  19              		.cfi_startproc
+  20 0010 55       		pushq	%rbp
+  21              		.cfi_def_cfa_offset 16
+  22              		.cfi_offset 6, -16
+  23 0011 4889E5   		movq	%rsp, %rbp
+  24              		.cfi_def_cfa_register 6
+  25 0014 4157     		pushq	%r15
+  26 0016 4156     		pushq	%r14
+  27 0018 4155     		pushq	%r13
+  28 001a 4154     		pushq	%r12
+  29 001c 53       		pushq	%rbx
+  30 001d 4883E4E0 		andq	$-32, %rsp
+  31 0021 4883EC20 		subq	$32, %rsp
+  32              		.cfi_offset 15, -24
+  33              		.cfi_offset 14, -32
+  34              		.cfi_offset 13, -40
+  35              		.cfi_offset 12, -48
+  36              		.cfi_offset 3, -56
+  37 0025 488B87C0 		movq	192(%rdi), %rax
+  37      000000
+  38 002c 8B5004   		movl	4(%rax), %edx
+  39 002f 48894424 		movq	%rax, 24(%rsp)
+  39      18
+  40 0034 85D2     		testl	%edx, %edx
+  41 0036 0F8ED200 		jle	.L42
+  41      0000
+  42 003c 4989FF   		movq	%rdi, %r15
+  43 003f 488D5F08 		leaq	8(%rdi), %rbx
+  44 0043 4531ED   		xorl	%r13d, %r13d
+  45 0046 4C8DB028 		leaq	296(%rax), %r14
+  45      010000
+  46 004d 4C8DA030 		leaq	304(%rax), %r12
+  46      010000
+  47              		.p2align 4,,10
+  48 0054 0F1F4000 		.p2align 3
+  49              	.L26:
+  50 0058 488B4424 		movq	24(%rsp), %rax
+  50      18
+  51 005d 4D8B8F90 		movq	144(%r15), %r9
+  51      000000
+  52 0064 4F8B5CEF 		movq	72(%r15,%r13,8), %r11
+  52      48
+  53 0069 428BBCA8 		movl	264(%rax,%r13,4), %edi
+  53      08010000 
+  54 0071 4D01E9   		addq	%r13, %r9
+  55 0074 85FF     		testl	%edi, %edi
+  56 0076 0F8EA100 		jle	.L5
+  56      0000
+  57 007c 498BB788 		movq	136(%r15), %rsi
+  57      000000
+  58 0083 4C89F2   		movq	%r14, %rdx
+  59 0086 31C0     		xorl	%eax, %eax
+  60 0088 EB15     		jmp	.L6
+  61 008a 660F1F44 		.p2align 4,,10
+  61      0000
+  62              		.p2align 3
+  63              	.L10:
+  64 0090 83C001   		addl	$1, %eax
+  65 0093 4883C208 		addq	$8, %rdx
+  66 0097 39F8     		cmpl	%edi, %eax
+  67 0099 0F840102 		je	.L9
+  67      0000
+  68              	.L6:
+  69 009f 48630A   		movslq	(%rdx), %rcx
+  70 00a2 803C0E00 		cmpb	$0, (%rsi,%rcx)
+  71 00a6 75E8     		jne	.L10
+  72 00a8 39F8     		cmpl	%edi, %eax
+  73 00aa 496397A4 		movslq	164(%r15), %rdx
+  73      000000
+  74 00b1 410F9401 		sete	(%r9)
+  75 00b5 0F84F001 		je	.L11
+  75      0000
+  76 00bb 83FF01   		cmpl	$1, %edi
+  77 00be 7570     		jne	.L7
+  78 00c0 C4C17A10 		vmovss	4(%r14), %xmm1
+  78      4E04
+  79 00c6 496306   		movslq	(%r14), %rax
+  80 00c9 C5F82E0D 		vucomiss	.LC0(%rip), %xmm1
+  80      00000000 
+  81 00d1 488B34C3 		movq	(%rbx,%rax,8), %rsi
+  82 00d5 0F8A5701 		jp	.L12
+  82      0000
+  83 00db 0F855101 		jne	.L12
+  83      0000
+  84 00e1 48C1E202 		salq	$2, %rdx
+  85 00e5 4C89DF   		movq	%r11, %rdi
+  86 00e8 C5F877   		vzeroupper
+  87 00eb E8000000 		call	memcpy@PLT
+  87      00
+  88              	.L8:
+  89 00f0 488B4424 		movq	24(%rsp), %rax
+  89      18
+  90 00f5 4983C501 		addq	$1, %r13
+  91 00f9 4983C640 		addq	$64, %r14
+  92 00fd 4983C440 		addq	$64, %r12
+  93 0101 44396804 		cmpl	%r13d, 4(%rax)
+  94 0105 0F8F4DFF 		jg	.L26
+  94      FFFF
+  95 010b C5F877   		vzeroupper
+  96              	.L42:
+  97 010e 488D65D8 		leaq	-40(%rbp), %rsp
+  98 0112 5B       		popq	%rbx
+  99 0113 415C     		popq	%r12
+ 100 0115 415D     		popq	%r13
+ 101 0117 415E     		popq	%r14
+ 102 0119 415F     		popq	%r15
+ 103 011b 5D       		popq	%rbp
+ 104              		.cfi_remember_state
+ 105              		.cfi_def_cfa 7, 8
+ 106 011c C3       		ret
+ 107              	.L5:
+ 108              		.cfi_restore_state
+ 109 011d 410F9401 		sete	(%r9)
+ 110 0121 0F84A501 		je	.L41
+ 110      0000
+ 111 0127 418B97A4 		movl	164(%r15), %edx
+ 111      000000
+ 112 012e 6690     		.p2align 4,,10
+ 113              		.p2align 3
+ 114              	.L7:
+ 115 0130 83FA07   		cmpl	$7, %edx
+ 116 0133 0F8E8801 		jle	.L29
+ 116      0000
+ 117 0139 496306   		movslq	(%r14), %rax
+ 118 013c 448D52F8 		leal	-8(%rdx), %r10d
+ 119 0140 31C9     		xorl	%ecx, %ecx
+ 120 0142 C4C27D18 		vbroadcastss	4(%r14), %ymm2
+ 120      5604
+ 121 0148 41C1EA03 		shrl	$3, %r10d
+ 122 014c 89542414 		movl	%edx, 20(%rsp)
+ 123 0150 458D4A01 		leal	1(%r10), %r9d
+ 124 0154 4C8B04C3 		movq	(%rbx,%rax,8), %r8
+ 125 0158 8D47FE   		leal	-2(%rdi), %eax
+ 126 015b 498D74C6 		leaq	16(%r14,%rax,8), %rsi
+ 126      10
+ 127 0160 4D89CA   		movq	%r9, %r10
+ 128 0163 49C1E105 		salq	$5, %r9
+ 129 0167 4C89CA   		movq	%r9, %rdx
+ 130 016a 4989F1   		movq	%rsi, %r9
+ 131 016d 4889CE   		movq	%rcx, %rsi
+ 132              		.p2align 4,,10
+ 133              		.p2align 3
+ 134              	.L22:
+ 135 0170 C4C16C59 		vmulps	(%r8,%rsi), %ymm2, %ymm1
+ 135      0C30
+ 136 0176 83FF01   		cmpl	$1, %edi
+ 137 0179 7E24     		jle	.L20
+ 138 017b 4C89E0   		movq	%r12, %rax
+ 139 017e 6690     		.p2align 4,,10
+ 140              		.p2align 3
+ 141              	.L21:
+ 142 0180 486308   		movslq	(%rax), %rcx
+ 143 0183 C4E27D18 		vbroadcastss	4(%rax), %ymm0
+ 143      4004
+ 144 0189 4883C008 		addq	$8, %rax
+ 145 018d 488B0CCB 		movq	(%rbx,%rcx,8), %rcx
+ 146 0191 C5FC5904 		vmulps	(%rcx,%rsi), %ymm0, %ymm0
+ 146      31
+ 147 0196 C5F458C8 		vaddps	%ymm0, %ymm1, %ymm1
+ 148 019a 4939C1   		cmpq	%rax, %r9
+ 149 019d 75E1     		jne	.L21
+ 150              	.L20:
+ 151 019f C4C17C11 		vmovups	%ymm1, (%r11,%rsi)
+ 151      0C33
+ 152 01a5 4883C620 		addq	$32, %rsi
+ 153 01a9 4839F2   		cmpq	%rsi, %rdx
+ 154 01ac 75C2     		jne	.L22
+ 155 01ae 8B542414 		movl	20(%rsp), %edx
+ 156 01b2 428D04D5 		leal	0(,%r10,8), %eax
+ 156      00000000 
+ 157              	.L19:
+ 158 01ba 39C2     		cmpl	%eax, %edx
+ 159 01bc 0F8E2EFF 		jle	.L8
+ 159      FFFF
+ 160 01c2 4863F0   		movslq	%eax, %rsi
+ 161 01c5 49630E   		movslq	(%r14), %rcx
+ 162 01c8 29C2     		subl	%eax, %edx
+ 163 01ca C4C17A10 		vmovss	4(%r14), %xmm2
+ 163      5604
+ 164 01d0 4C8D0C32 		leaq	(%rdx,%rsi), %r9
+ 165 01d4 8D47FE   		leal	-2(%rdi), %eax
+ 166 01d7 4C8B14CB 		movq	(%rbx,%rcx,8), %r10
+ 167 01db 49C1E102 		salq	$2, %r9
+ 168 01df 488D0CB5 		leaq	0(,%rsi,4), %rcx
+ 168      00000000 
+ 169 01e7 498D74C6 		leaq	16(%r14,%rax,8), %rsi
+ 169      10
+ 170 01ec 0F1F4000 		.p2align 4,,10
+ 171              		.p2align 3
+ 172              	.L25:
+ 173 01f0 C4C16A59 		vmulss	(%r10,%rcx), %xmm2, %xmm1
+ 173      0C0A
+ 174 01f6 83FF01   		cmpl	$1, %edi
+ 175 01f9 7E23     		jle	.L23
+ 176 01fb 4C89E0   		movq	%r12, %rax
+ 177 01fe 6690     		.p2align 4,,10
+ 178              		.p2align 3
+ 179              	.L24:
+ 180 0200 486310   		movslq	(%rax), %rdx
+ 181 0203 4883C008 		addq	$8, %rax
+ 182 0207 488B14D3 		movq	(%rbx,%rdx,8), %rdx
+ 183 020b C5FA1004 		vmovss	(%rdx,%rcx), %xmm0
+ 183      0A
+ 184 0210 C5FA5940 		vmulss	-4(%rax), %xmm0, %xmm0
+ 184      FC
+ 185 0215 C5F258C8 		vaddss	%xmm0, %xmm1, %xmm1
+ 186 0219 4839F0   		cmpq	%rsi, %rax
+ 187 021c 75E2     		jne	.L24
+ 188              	.L23:
+ 189 021e C4C17A11 		vmovss	%xmm1, (%r11,%rcx)
+ 189      0C0B
+ 190 0224 4883C104 		addq	$4, %rcx
+ 191 0228 4939C9   		cmpq	%rcx, %r9
+ 192 022b 75C3     		jne	.L25
+ 193 022d E9BEFEFF 		jmp	.L8
+ 193      FF
+ 194              	.L12:
+ 195 0232 C4E27D18 		vbroadcastss	%xmm1, %ymm2
+ 195      D1
+ 196 0237 83FA07   		cmpl	$7, %edx
+ 197 023a 0F8E8800 		jle	.L28
+ 197      0000
+ 198 0240 8D4AF8   		leal	-8(%rdx), %ecx
+ 199 0243 31C0     		xorl	%eax, %eax
+ 200 0245 C1E903   		shrl	$3, %ecx
+ 201 0248 83C101   		addl	$1, %ecx
+ 202 024b 4889CF   		movq	%rcx, %rdi
+ 203 024e 48C1E105 		salq	$5, %rcx
+ 204              		.p2align 4,,10
+ 205 0252 660F1F44 		.p2align 3
+ 205      0000
+ 206              	.L15:
+ 207 0258 C5EC5904 		vmulps	(%rsi,%rax), %ymm2, %ymm0
+ 207      06
+ 208 025d C4C17C11 		vmovups	%ymm0, (%r11,%rax)
+ 208      0403
+ 209 0263 4883C020 		addq	$32, %rax
+ 210 0267 4839C1   		cmpq	%rax, %rcx
+ 211 026a 75EC     		jne	.L15
+ 212 026c 8D0CFD00 		leal	0(,%rdi,8), %ecx
+ 212      000000
+ 213              	.L14:
+ 214 0273 4863C1   		movslq	%ecx, %rax
+ 215 0276 39D1     		cmpl	%edx, %ecx
+ 216 0278 0F8D72FE 		jge	.L8
+ 216      FFFF
+ 217 027e 6690     		.p2align 4,,10
+ 218              		.p2align 3
+ 219              	.L17:
+ 220 0280 C5F25904 		vmulss	(%rsi,%rax,4), %xmm1, %xmm0
+ 220      86
+ 221 0285 C4C17A11 		vmovss	%xmm0, (%r11,%rax,4)
+ 221      0483
+ 222 028b 4883C001 		addq	$1, %rax
+ 223 028f 39C2     		cmpl	%eax, %edx
+ 224 0291 7FED     		jg	.L17
+ 225 0293 E958FEFF 		jmp	.L8
+ 225      FF
+ 226 0298 0F1F8400 		.p2align 4,,10
+ 226      00000000 
+ 227              		.p2align 3
+ 228              	.L9:
+ 229 02a0 41C60101 		movb	$1, (%r9)
+ 230 02a4 496397A4 		movslq	164(%r15), %rdx
+ 230      000000
+ 231              	.L11:
+ 232 02ab 48C1E202 		salq	$2, %rdx
+ 233 02af 31F6     		xorl	%esi, %esi
+ 234 02b1 4C89DF   		movq	%r11, %rdi
+ 235 02b4 C5F877   		vzeroupper
+ 236 02b7 E8000000 		call	memset@PLT
+ 236      00
+ 237 02bc E92FFEFF 		jmp	.L8
+ 237      FF
+ 238              	.L29:
+ 239 02c1 31C0     		xorl	%eax, %eax
+ 240 02c3 E9F2FEFF 		jmp	.L19
+ 240      FF
+ 241              	.L28:
+ 242 02c8 31C9     		xorl	%ecx, %ecx
+ 243 02ca EBA7     		jmp	.L14
+ 244              	.L41:
+ 245 02cc 496397A4 		movslq	164(%r15), %rdx
+ 245      000000
+ 246 02d3 EBD6     		jmp	.L11
+ 247              		.cfi_endproc
+ 248              	.LFE6397:
+ 250              		.section	.rodata.str1.8,"aMS",@progbits,1
+ 251              		.align 8
+ 252              	.LC1:
+ 253 0000 25733A20 		.string	"%s: The matrix has %d inputs, the chain has %d channels here\n"
+ 253      54686520 
+ 253      6D617472 
+ 253      69782068 
+ 253      61732025 
+ 254              		.section	.rodata.str1.1,"aMS",@progbits,1
+ 255              	.LC2:
+ 256 0000 436F756C 		.string	"Could not initialise mix\n"
+ 256      64206E6F 
+ 256      7420696E 
+ 256      69746961 
+ 256      6C697365 
+ 257              		.text
+ 258 02d5 66662E0F 		.p2align 4
+ 258      1F840000 
+ 258      000000
+ 259              		.globl	mix_init
+ 261              	mix_init:
+ 262              	.LFB6398:
+ 263              		.cfi_startproc
+ 264 02e0 55       		pushq	%rbp
+ 265              		.cfi_def_cfa_offset 16
+ 266              		.cfi_offset 6, -16
+ 267 02e1 53       		pushq	%rbx
+ 268              		.cfi_def_cfa_offset 24
+ 269              		.cfi_offset 3, -24
+ 270 02e2 4889FB   		movq	%rdi, %rbx
+ 271 02e5 4883EC08 		subq	$8, %rsp
+ 272              		.cfi_def_cfa_offset 32
+ 273 02e9 488BAFC0 		movq	192(%rdi), %rbp
+ 273      000000
+ 274 02f0 448B879C 		movl	156(%rdi), %r8d
+ 274      000000
+ 275 02f7 8B4D00   		movl	0(%rbp), %ecx
+ 276 02fa 4139C8   		cmpl	%ecx, %r8d
+ 277 02fd 7423     		je	.L45
+ 278 02ff 31FF     		xorl	%edi, %edi
+ 279 0301 488D1500 		leaq	__func__.3(%rip), %rdx
+ 279      000000
+ 280 0308 488D3500 		leaq	.LC1(%rip), %rsi
+ 280      000000
+ 281 030f 31C0     		xorl	%eax, %eax
+ 282 0311 E8000000 		call	debugprint@PLT
+ 282      00
+ 283 0316 488D3D00 		leaq	.LC2(%rip), %rdi
+ 283      000000
+ 284 031d E8000000 		call	endprogram@PLT
+ 284      00
+ 285              	.L45:
+ 286 0322 8B4504   		movl	4(%rbp), %eax
+ 287 0325 8983A000 		movl	%eax, 160(%rbx)
+ 287      0000
+ 288 032b 4883C408 		addq	$8, %rsp
+ 289              		.cfi_def_cfa_offset 24
+ 290 032f 5B       		popq	%rbx
+ 291              		.cfi_def_cfa_offset 16
+ 292 0330 5D       		popq	%rbp
+ 293              		.cfi_def_cfa_offset 8
+ 294 0331 C3       		ret
+ 295              		.cfi_endproc
+ 296              	.LFE6398:
+ 298 0332 66662E0F 		.p2align 4
+ 298      1F840000 
+ 298      0000000F 
+ 298      1F00
+ 299              		.globl	destroy_mix
+ 301              	destroy_mix:
+ 302              	.LFB6399:
+ 303              		.cfi_startproc
+ 304 0340 488BBFC0 		movq	192(%rdi), %rdi
+ 304      000000
+ 305 0347 E9000000 		jmp	free@PLT
+ 305      00
+ 306              		.cfi_endproc
+ 307              	.LFE6399:
+ 309 034c 0F1F4000 		.p2align 4
+ 310              		.globl	clone_mix
+ 312              	clone_mix:
+ 313              	.LFB6401:
+ 314              		.cfi_startproc
+ 315 0350 55       		pushq	%rbp
+ 316              		.cfi_def_cfa_offset 16
+ 317              		.cfi_offset 6, -16
+ 318 0351 4889E5   		movq	%rsp, %rbp
+ 319              		.cfi_def_cfa_register 6
+ 320 0354 4154     		pushq	%r12
+ 321              		.cfi_offset 12, -24
+ 322 0356 4989F4   		movq	%rsi, %r12
+ 323 0359 53       		pushq	%rbx
+ 324              		.cfi_offset 3, -32
+ 325 035a 4889FB   		movq	%rdi, %rbx
+ 326 035d BF280300 		movl	$808, %edi
+ 326      00
+ 327 0362 E8000000 		call	malloc@PLT
+ 327      00
+ 328 0367 4885C0   		testq	%rax, %rax
+ 329 036a 0F84D300 		je	.L50
+ 329      0000
+ 330 0370 498B9424 		movq	192(%r12), %rdx
+ 330      C0000000 
+ 331 0378 62F1FE48 		vmovdqu64	(%rdx), %zmm0
+ 331      6F02
+ 332 037e 62F1FE48 		vmovdqu64	%zmm0, (%rax)
+ 332      7F00
+ 333 0384 62F1FE48 		vmovdqu64	64(%rdx), %zmm1
+ 333      6F4A01
+ 334 038b 62F1FE48 		vmovdqu64	%zmm1, 64(%rax)
+ 334      7F4801
+ 335 0392 62F1FE48 		vmovdqu64	128(%rdx), %zmm2
+ 335      6F5202
+ 336 0399 62F1FE48 		vmovdqu64	%zmm2, 128(%rax)
+ 336      7F5002
+ 337 03a0 62F1FE48 		vmovdqu64	192(%rdx), %zmm3
+ 337      6F5A03
+ 338 03a7 62F1FE48 		vmovdqu64	%zmm3, 192(%rax)
+ 338      7F5803
+ 339 03ae 62F1FE48 		vmovdqu64	256(%rdx), %zmm4
+ 339      6F6204
+ 340 03b5 62F1FE48 		vmovdqu64	%zmm4, 256(%rax)
+ 340      7F6004
+ 341 03bc 62F1FE48 		vmovdqu64	320(%rdx), %zmm5
+ 341      6F6A05
+ 342 03c3 62F1FE48 		vmovdqu64	%zmm5, 320(%rax)
+ 342      7F6805
+ 343 03ca 62F1FE48 		vmovdqu64	384(%rdx), %zmm6
+ 343      6F7206
+ 344 03d1 62F1FE48 		vmovdqu64	%zmm6, 384(%rax)
+ 344      7F7006
+ 345 03d8 62F1FE48 		vmovdqu64	448(%rdx), %zmm7
+ 345      6F7A07
+ 346 03df 62F1FE48 		vmovdqu64	%zmm7, 448(%rax)
+ 346      7F7807
+ 347 03e6 62F1FE48 		vmovdqu64	512(%rdx), %zmm0
+ 347      6F4208
+ 348 03ed 62F1FE48 		vmovdqu64	%zmm0, 512(%rax)
+ 348      7F4008
+ 349 03f4 62F1FE48 		vmovdqu64	576(%rdx), %zmm1
+ 349      6F4A09
+ 350 03fb 62F1FE48 		vmovdqu64	%zmm1, 576(%rax)
+ 350      7F4809
+ 351 0402 62F1FE48 		vmovdqu64	640(%rdx), %zmm2
+ 351      6F520A
+ 352 0409 62F1FE48 		vmovdqu64	%zmm2, 640(%rax)
+ 352      7F500A
+ 353 0410 62F1FE48 		vmovdqu64	704(%rdx), %zmm3
+ 353      6F5A0B
+ 354 0417 62F1FE48 		vmovdqu64	%zmm3, 704(%rax)
+ 354      7F580B
+ 355 041e 62F1FE48 		vmovdqu64	744(%rdx), %zmm4
+ 355      6FA2E802 
+ 355      0000
+ 356 0428 488983C0 		movq	%rax, 192(%rbx)
+ 356      000000
+ 357 042f 62F1FE48 		vmovdqu64	%zmm4, 744(%rax)
+ 357      7FA0E802 
+ 357      0000
+ 358 0439 31C0     		xorl	%eax, %eax
+ 359 043b C5F877   		vzeroupper
+ 360              	.L48:
+ 361 043e 5B       		popq	%rbx
+ 362 043f 415C     		popq	%r12
+ 363 0441 5D       		popq	%rbp
+ 364              		.cfi_remember_state
+ 365              		.cfi_def_cfa 7, 8
+ 366 0442 C3       		ret
+ 367              	.L50:
+ 368              		.cfi_restore_state
+ 369 0443 B8010000 		movl	$1, %eax
+ 369      00
+ 370 0448 EBF4     		jmp	.L48
+ 371              		.cfi_endproc
+ 372              	.LFE6401:
+ 374              		.section	.rodata.str1.1
+ 375              	.LC3:
+ 376 001a 25733A20 		.string	"%s: More than %d outputs\n"
+ 376      4D6F7265 
+ 376      20746861 
+ 376      6E202564 
+ 376      206F7574 
+ 377              	.LC4:
+ 378 0034 20090D0A 		.string	" \t\r\n"
+ 378      00
+ 379              	.LC5:
+ 380 0039 25733A20 		.string	"%s: More than %d inputs\n"
+ 380      4D6F7265 
+ 380      20746861 
+ 380      6E202564 
+ 380      20696E70 
+ 381              	.LC6:
+ 382 0052 25733A20 		.string	"%s: Not a gain: %s\n"
+ 382      4E6F7420 
+ 382      61206761 
+ 382      696E3A20 
+ 382      25730A00 
+ 383              		.section	.rodata.str1.8
+ 384 003e 0000     		.align 8
+ 385              	.LC7:
+ 386 0040 25733A20 		.string	"%s: Row %d has %d gains, expected %d\n"
+ 386      526F7720 
+ 386      25642068 
+ 386      61732025 
+ 386      64206761 
+ 387              		.text
+ 388 044a 660F1F44 		.p2align 4
+ 388      0000
+ 390              	mix_add_row:
+ 391              	.LFB6402:
+ 392              		.cfi_startproc
+ 393 0450 4157     		pushq	%r15
+ 394              		.cfi_def_cfa_offset 16
+ 395              		.cfi_offset 15, -16
+ 396 0452 4156     		pushq	%r14
+ 397              		.cfi_def_cfa_offset 24
+ 398              		.cfi_offset 14, -24
+ 399 0454 4155     		pushq	%r13
+ 400              		.cfi_def_cfa_offset 32
+ 401              		.cfi_offset 13, -32
+ 402 0456 4154     		pushq	%r12
+ 403              		.cfi_def_cfa_offset 40
+ 404              		.cfi_offset 12, -40
+ 405 0458 55       		pushq	%rbp
+ 406              		.cfi_def_cfa_offset 48
+ 407              		.cfi_offset 6, -48
+ 408 0459 53       		pushq	%rbx
+ 409              		.cfi_def_cfa_offset 56
+ 410              		.cfi_offset 3, -56
+ 411 045a 4883EC28 		subq	$40, %rsp
+ 412              		.cfi_def_cfa_offset 96
+ 413 045e 837F0408 		cmpl	$8, 4(%rdi)
+ 414 0462 48895424 		movq	%rdx, 8(%rsp)
+ 414      08
+ 415 0467 0F840301 		je	.L74
+ 415      0000
+ 416 046d 4889FD   		movq	%rdi, %rbp
+ 417 0470 4989F5   		movq	%rsi, %r13
+ 418 0473 4C8D3500 		leaq	.LC4(%rip), %r14
+ 418      000000
+ 419 047a 31DB     		xorl	%ebx, %ebx
+ 420 047c 4C8D7C24 		leaq	24(%rsp), %r15
+ 420      18
+ 421 0481 EB48     		jmp	.L53
+ 422              		.p2align 4,,10
+ 423 0483 0F1F4400 		.p2align 3
+ 423      00
+ 424              	.L56:
+ 425 0488 4C89FE   		movq	%r15, %rsi
+ 426 048b 4C89EF   		movq	%r13, %rdi
+ 427 048e 448D6301 		leal	1(%rbx), %r12d
+ 428 0492 E8000000 		call	strtod@PLT
+ 428      00
+ 429 0497 48635504 		movslq	4(%rbp), %rdx
+ 430 049b C5FB5AC0 		vcvtsd2ss	%xmm0, %xmm0, %xmm0
+ 431 049f 488D14D3 		leaq	(%rbx,%rdx,8), %rdx
+ 432 04a3 488B5C24 		movq	24(%rsp), %rbx
+ 432      18
+ 433 04a8 C5FA1144 		vmovss	%xmm0, 8(%rbp,%rdx,4)
+ 433      9508
+ 434 04ae 4C39EB   		cmpq	%r13, %rbx
+ 435 04b1 0F849900 		je	.L75
+ 435      0000
+ 436 04b7 488B7424 		movq	8(%rsp), %rsi
+ 436      08
+ 437 04bc 4889DF   		movq	%rbx, %rdi
+ 438 04bf E8000000 		call	strspn@PLT
+ 438      00
+ 439 04c4 4C8D2C03 		leaq	(%rbx,%rax), %r13
+ 440 04c8 4963DC   		movslq	%r12d, %rbx
+ 441              	.L53:
+ 442 04cb 4C89EF   		movq	%r13, %rdi
+ 443 04ce 4C89F6   		movq	%r14, %rsi
+ 444 04d1 E8000000 		call	strspn@PLT
+ 444      00
+ 445 04d6 4901C5   		addq	%rax, %r13
+ 446 04d9 41807D00 		cmpb	$0, 0(%r13)
+ 446      00
+ 447 04de 7438     		je	.L55
+ 448 04e0 83FB08   		cmpl	$8, %ebx
+ 449 04e3 75A3     		jne	.L56
+ 450 04e5 B9080000 		movl	$8, %ecx
+ 450      00
+ 451 04ea 488D1500 		leaq	__func__.1(%rip), %rdx
+ 451      000000
+ 452 04f1 31FF     		xorl	%edi, %edi
+ 453 04f3 31C0     		xorl	%eax, %eax
+ 454 04f5 488D3500 		leaq	.LC5(%rip), %rsi
+ 454      000000
+ 455 04fc E8000000 		call	debugprint@PLT
+ 455      00
+ 456              	.L54:
+ 457 0501 4883C428 		addq	$40, %rsp
+ 458              		.cfi_remember_state
+ 459              		.cfi_def_cfa_offset 56
+ 460 0505 B8010000 		movl	$1, %eax
+ 460      00
+ 461 050a 5B       		popq	%rbx
+ 462              		.cfi_def_cfa_offset 48
+ 463 050b 5D       		popq	%rbp
+ 464              		.cfi_def_cfa_offset 40
+ 465 050c 415C     		popq	%r12
+ 466              		.cfi_def_cfa_offset 32
+ 467 050e 415D     		popq	%r13
+ 468              		.cfi_def_cfa_offset 24
+ 469 0510 415E     		popq	%r14
+ 470              		.cfi_def_cfa_offset 16
+ 471 0512 415F     		popq	%r15
+ 472              		.cfi_def_cfa_offset 8
+ 473 0514 C3       		ret
+ 474              		.p2align 4,,10
+ 475 0515 0F1F00   		.p2align 3
+ 476              	.L55:
+ 477              		.cfi_restore_state
+ 478 0518 85DB     		testl	%ebx, %ebx
+ 479 051a 741A     		je	.L59
+ 480 051c 8B4504   		movl	4(%rbp), %eax
+ 481 051f 448B4D00 		movl	0(%rbp), %r9d
+ 482 0523 8D4801   		leal	1(%rax), %ecx
+ 483 0526 4585C9   		testl	%r9d, %r9d
+ 484 0529 7405     		je	.L60
+ 485 052b 4139D9   		cmpl	%ebx, %r9d
+ 486 052e 7561     		jne	.L76
+ 487              	.L60:
+ 488 0530 895D00   		movl	%ebx, 0(%rbp)
+ 489 0533 894D04   		movl	%ecx, 4(%rbp)
+ 490              	.L59:
+ 491 0536 4883C428 		addq	$40, %rsp
+ 492              		.cfi_remember_state
+ 493              		.cfi_def_cfa_offset 56
+ 494 053a 31C0     		xorl	%eax, %eax
+ 495 053c 5B       		popq	%rbx
+ 496              		.cfi_def_cfa_offset 48
+ 497 053d 5D       		popq	%rbp
+ 498              		.cfi_def_cfa_offset 40
+ 499 053e 415C     		popq	%r12
+ 500              		.cfi_def_cfa_offset 32
+ 501 0540 415D     		popq	%r13
+ 502              		.cfi_def_cfa_offset 24
+ 503 0542 415E     		popq	%r14
+ 504              		.cfi_def_cfa_offset 16
+ 505 0544 415F     		popq	%r15
+ 506              		.cfi_def_cfa_offset 8
+ 507 0546 C3       		ret
+ 508 0547 660F1F84 		.p2align 4,,10
+ 508      00000000 
+ 508      00
+ 509              		.p2align 3
+ 510              	.L75:
+ 511              		.cfi_restore_state
+ 512 0550 4889D9   		movq	%rbx, %rcx
+ 513 0553 488D1500 		leaq	__func__.1(%rip), %rdx
+ 513      000000
+ 514 055a 31FF     		xorl	%edi, %edi
+ 515 055c 31C0     		xorl	%eax, %eax
+ 516 055e 488D3500 		leaq	.LC6(%rip), %rsi
+ 516      000000
+ 517 0565 E8000000 		call	debugprint@PLT
+ 517      00
+ 518 056a EB95     		jmp	.L54
+ 519 056c 0F1F4000 		.p2align 4,,10
+ 520              		.p2align 3
+ 521              	.L74:
+ 522 0570 B9080000 		movl	$8, %ecx
+ 522      00
+ 523 0575 488D1500 		leaq	__func__.1(%rip), %rdx
+ 523      000000
+ 524 057c 31FF     		xorl	%edi, %edi
+ 525 057e 31C0     		xorl	%eax, %eax
+ 526 0580 488D3500 		leaq	.LC3(%rip), %rsi
+ 526      000000
+ 527 0587 E8000000 		call	debugprint@PLT
+ 527      00
+ 528 058c E970FFFF 		jmp	.L54
+ 528      FF
+ 529              	.L76:
+ 530 0591 4189D8   		movl	%ebx, %r8d
+ 531 0594 488D1500 		leaq	__func__.1(%rip), %rdx
+ 531      000000
+ 532 059b 31FF     		xorl	%edi, %edi
+ 533 059d 31C0     		xorl	%eax, %eax
+ 534 059f 488D3500 		leaq	.LC7(%rip), %rsi
+ 534      000000
+ 535 05a6 E8000000 		call	debugprint@PLT
+ 535      00
+ 536 05ab E951FFFF 		jmp	.L54
+ 536      FF
+ 537              		.cfi_endproc
+ 538              	.LFE6402:
+ 540              		.section	.rodata.str1.1
+ 541              	.LC8:
+ 542 0066 7200     		.string	"r"
+ 543              	.LC9:
+ 544 0068 25733A20 		.string	"%s: Unable to open file: %s\n"
+ 544      556E6162 
+ 544      6C652074 
+ 544      6F206F70 
+ 544      656E2066 
+ 545              	.LC10:
+ 546 0085 00       		.string	""
+ 547              		.text
+ 548              		.p2align 4
+ 550              	mix_read_matrix:
+ 551              	.LFB6403:
+ 552              		.cfi_startproc
+ 553 05b0 4156     		pushq	%r14
+ 554              		.cfi_def_cfa_offset 16
+ 555              		.cfi_offset 14, -16
+ 556 05b2 4155     		pushq	%r13
+ 557              		.cfi_def_cfa_offset 24
+ 558              		.cfi_offset 13, -24
+ 559 05b4 4989FD   		movq	%rdi, %r13
+ 560 05b7 4154     		pushq	%r12
+ 561              		.cfi_def_cfa_offset 32
+ 562              		.cfi_offset 12, -32
+ 563 05b9 55       		pushq	%rbp
+ 564              		.cfi_def_cfa_offset 40
+ 565              		.cfi_offset 6, -40
+ 566 05ba 53       		pushq	%rbx
+ 567              		.cfi_def_cfa_offset 48
+ 568              		.cfi_offset 3, -48
+ 569 05bb 4889F3   		movq	%rsi, %rbx
+ 570 05be 488D3500 		leaq	.LC8(%rip), %rsi
+ 570      000000
+ 571 05c5 4889DF   		movq	%rbx, %rdi
+ 572 05c8 4881EC00 		subq	$1024, %rsp
+ 572      040000
+ 573              		.cfi_def_cfa_offset 1072
+ 574 05cf E8000000 		call	fopen@PLT
+ 574      00
+ 575 05d4 4885C0   		testq	%rax, %rax
+ 576 05d7 745C     		je	.L83
+ 577 05d9 4989C4   		movq	%rax, %r12
+ 578 05dc 4889E5   		movq	%rsp, %rbp
+ 579 05df 4C8D3500 		leaq	.LC10(%rip), %r14
+ 579      000000
+ 580 05e6 EB1C     		jmp	.L78
+ 581 05e8 0F1F8400 		.p2align 4,,10
+ 581      00000000 
+ 582              		.p2align 3
+ 583              	.L81:
+ 584 05f0 4C89F2   		movq	%r14, %rdx
+ 585 05f3 4889EE   		movq	%rbp, %rsi
+ 586 05f6 4C89EF   		movq	%r13, %rdi
+ 587 05f9 E852FEFF 		call	mix_add_row
+ 587      FF
+ 588 05fe 89C3     		movl	%eax, %ebx
+ 589 0600 85C0     		testl	%eax, %eax
+ 590 0602 7517     		jne	.L80
+ 591              	.L78:
+ 592 0604 4C89E2   		movq	%r12, %rdx
+ 593 0607 BE000400 		movl	$1024, %esi
+ 593      00
+ 594 060c 4889EF   		movq	%rbp, %rdi
+ 595 060f E8000000 		call	fgets@PLT
+ 595      00
+ 596 0614 4885C0   		testq	%rax, %rax
+ 597 0617 75D7     		jne	.L81
+ 598 0619 31DB     		xorl	%ebx, %ebx
+ 599              	.L80:
+ 600 061b 4C89E7   		movq	%r12, %rdi
+ 601 061e E8000000 		call	fclose@PLT
+ 601      00
+ 602              	.L77:
+ 603 0623 4881C400 		addq	$1024, %rsp
+ 603      040000
+ 604              		.cfi_remember_state
+ 605              		.cfi_def_cfa_offset 48
+ 606 062a 89D8     		movl	%ebx, %eax
+ 607 062c 5B       		popq	%rbx
+ 608              		.cfi_def_cfa_offset 40
+ 609 062d 5D       		popq	%rbp
+ 610              		.cfi_def_cfa_offset 32
+ 611 062e 415C     		popq	%r12
+ 612              		.cfi_def_cfa_offset 24
+ 613 0630 415D     		popq	%r13
+ 614              		.cfi_def_cfa_offset 16
+ 615 0632 415E     		popq	%r14
+ 616              		.cfi_def_cfa_offset 8
+ 617 0634 C3       		ret
+ 618              	.L83:
+ 619              		.cfi_restore_state
+ 620 0635 4889D9   		movq	%rbx, %rcx
+ 621 0638 488D1500 		leaq	__func__.0(%rip), %rdx
+ 621      000000
+ 622 063f 31FF     		xorl	%edi, %edi
+ 623 0641 31C0     		xorl	%eax, %eax
+ 624 0643 488D3500 		leaq	.LC9(%rip), %rsi
+ 624      000000
+ 625 064a BB010000 		movl	$1, %ebx
+ 625      00
+ 626 064f E8000000 		call	debugprint@PLT
+ 626      00
+ 627 0654 EBCD     		jmp	.L77
+ 628              		.cfi_endproc
+ 629              	.LFE6403:
+ 631              		.section	.rodata.str1.1
+ 632              	.LC11:
+ 633 0086 6D00     		.string	"m"
+ 634              	.LC12:
+ 635 0088 6600     		.string	"f"
+ 636              	.LC13:
+ 637 008a 25732073 		.string	"%s subopts: %s\n"
+ 637      75626F70 
+ 637      74733A20 
+ 637      25730A00 
+ 638              		.section	.rodata.str1.8
+ 639 0066 0000     		.align 8
+ 640              	.LC14:
+ 641 0068 25733A20 		.string	"%s: Missing value for suboption '%s'\n"
+ 641      4D697373 
+ 641      696E6720 
+ 641      76616C75 
+ 641      6520666F 
+ 642              		.section	.rodata.str1.1
+ 643              	.LC15:
+ 644 009a 2F00     		.string	"/"
+ 645              	.LC16:
+ 646 009c 3A00     		.string	":"
+ 647              		.section	.rodata.str1.8
+ 648 008e 0000     		.align 8
+ 649              	.LC17:
+ 650 0090 25733A20 		.string	"%s: No match found for token: /%s/\n"
+ 650      4E6F206D 
+ 650      61746368 
+ 650      20666F75 
+ 650      6E642066 
+ 651              		.section	.rodata.str1.1
+ 652              	.LC18:
+ 653 009e 25733A20 		.string	"%s: No matrix given\n"
+ 653      4E6F206D 
+ 653      61747269 
+ 653      78206769 
+ 653      76656E0A 
+ 654              	.LC20:
+ 655 00b3 25733A20 		.string	"%s: output %d sums %d inputs\n"
+ 655      6F757470 
+ 655      75742025 
+ 655      64207375 
+ 655      6D732025 
+ 656              		.text
+ 657 0656 662E0F1F 		.p2align 4
+ 657      84000000 
+ 657      0000
+ 658              		.globl	create_mix
+ 660              	create_mix:
+ 661              	.LFB6404:
+ 662              		.cfi_startproc
+ 663 0660 55       		pushq	%rbp
+ 664              		.cfi_def_cfa_offset 16
+ 665              		.cfi_offset 6, -16
+ 666 0661 488D0D00 		leaq	.LC11(%rip), %rcx
+ 666      000000
+ 667 0668 488D0500 		leaq	.LC12(%rip), %rax
+ 667      000000
+ 668 066f 4889E5   		movq	%rsp, %rbp
+ 669              		.cfi_def_cfa_register 6
+ 670 0672 4157     		pushq	%r15
+ 671              		.cfi_offset 15, -24
+ 672 0674 4989F7   		movq	%rsi, %r15
+ 673 0677 BE280300 		movl	$808, %esi
+ 673      00
+ 674 067c 4156     		pushq	%r14
+ 675 067e 4155     		pushq	%r13
+ 676              		.cfi_offset 14, -32
+ 677              		.cfi_offset 13, -40
+ 678 0680 4C8D2D00 		leaq	.LC16(%rip), %r13
+ 678      000000
+ 679 0687 4154     		pushq	%r12
+ 680              		.cfi_offset 12, -48
+ 681 0689 4C8D2500 		leaq	.LC15(%rip), %r12
+ 681      000000
+ 682 0690 53       		pushq	%rbx
+ 683 0691 4883E4E0 		andq	$-32, %rsp
+ 684 0695 4883C480 		addq	$-128, %rsp
+ 685              		.cfi_offset 3, -56
+ 686 0699 C5FA7E15 		vmovq	destroy_mix@GOTPCREL(%rip), %xmm2
+ 686      00000000 
+ 687 06a1 C5FA7E1D 		vmovq	mix_process@GOTPCREL(%rip), %xmm3
+ 687      00000000 
+ 688 06a9 C4E3E922 		vpinsrq	$1, clone_mix@GOTPCREL(%rip), %xmm2, %xmm0
+ 688      05000000 
+ 688      0001
+ 689 06b3 48897C24 		movq	%rdi, 56(%rsp)
+ 689      38
+ 690 06b8 BF010000 		movl	$1, %edi
+ 690      00
+ 691 06bd C4E3E122 		vpinsrq	$1, mix_init@GOTPCREL(%rip), %xmm3, %xmm1
+ 691      0D000000 
+ 691      0001
+ 692 06c7 48C74424 		movq	$0, 112(%rsp)
+ 692      70000000 
+ 692      00
+ 693 06d0 C4E37538 		vinserti128	$0x1, %xmm0, %ymm1, %ymm4
+ 693      E001
+ 694 06d6 C4E1F96E 		vmovq	%rcx, %xmm0
+ 694      C1
+ 695 06db C4E3F922 		vpinsrq	$1, %rax, %xmm0, %xmm0
+ 695      C001
+ 696 06e1 C5FD7F24 		vmovdqa	%ymm4, (%rsp)
+ 696      24
+ 697 06e6 C5F97F44 		vmovdqa	%xmm0, 96(%rsp)
+ 697      2460
+ 698 06ec C5F877   		vzeroupper
+ 699 06ef E8000000 		call	calloc@PLT
+ 699      00
+ 700 06f4 488D1500 		leaq	__func__.2(%rip), %rdx
+ 700      000000
+ 701 06fb 488D3500 		leaq	.LC13(%rip), %rsi
+ 701      000000
+ 702 0702 4889C3   		movq	%rax, %rbx
+ 703 0705 488B4424 		movq	56(%rsp), %rax
+ 703      38
+ 704 070a BF010000 		movl	$1, %edi
+ 704      00
+ 705 070f 488998C0 		movq	%rbx, 192(%rax)
+ 705      000000
+ 706 0716 498B0F   		movq	(%r15), %rcx
+ 707 0719 31C0     		xorl	%eax, %eax
+ 708 071b E8000000 		call	debugprint@PLT
+ 708      00
+ 709 0720 498B07   		movq	(%r15), %rax
+ 710 0723 488D4C24 		leaq	88(%rsp), %rcx
+ 710      58
+ 711 0728 48894C24 		movq	%rcx, 72(%rsp)
+ 711      48
+ 712 072d 488D4C24 		leaq	96(%rsp), %rcx
+ 712      60
+ 713 0732 803800   		cmpb	$0, (%rax)
+ 714 0735 48894C24 		movq	%rcx, 64(%rsp)
+ 714      40
+ 715 073a 0F842A02 		je	.L130
+ 715      0000
+ 716              		.p2align 4,,10
+ 717              		.p2align 3
+ 718              	.L86:
+ 719 0740 488B5424 		movq	72(%rsp), %rdx
+ 719      48
+ 720 0745 488B7424 		movq	64(%rsp), %rsi
+ 720      40
+ 721 074a 4C89FF   		movq	%r15, %rdi
+ 722 074d E8000000 		call	getsubopt@PLT
+ 722      00
+ 723 0752 4189C6   		movl	%eax, %r14d
+ 724 0755 85C0     		testl	%eax, %eax
+ 725 0757 0F847301 		je	.L89
+ 725      0000
+ 726 075d 83F801   		cmpl	$1, %eax
+ 727 0760 0F840201 		je	.L90
+ 727      0000
+ 728 0766 488B4C24 		movq	88(%rsp), %rcx
+ 728      58
+ 729 076b 488D1500 		leaq	__func__.2(%rip), %rdx
+ 729      000000
+ 730 0772 31FF     		xorl	%edi, %edi
+ 731 0774 31C0     		xorl	%eax, %eax
+ 732 0776 488D3500 		leaq	.LC17(%rip), %rsi
+ 732      000000
+ 733 077d E8000000 		call	debugprint@PLT
+ 733      00
+ 734              	.L129:
+ 735 0782 8B4304   		movl	4(%rbx), %eax
+ 736 0785 41BE0100 		movl	$1, %r14d
+ 736      0000
+ 737              	.L88:
+ 738 078b 85C0     		testl	%eax, %eax
+ 739 078d 0F8E9A00 		jle	.L100
+ 739      0000
+ 740 0793 4C8DA308 		leaq	264(%rbx), %r12
+ 740      010000
+ 741 079a 4989DD   		movq	%rbx, %r13
+ 742 079d 4531FF   		xorl	%r15d, %r15d
+ 743 07a0 C5F057C9 		vxorps	%xmm1, %xmm1, %xmm1
+ 744              		.p2align 4,,10
+ 745 07a4 0F1F4000 		.p2align 3
+ 746              	.L101:
+ 747 07a8 48630B   		movslq	(%rbx), %rcx
+ 748 07ab 4963F7   		movslq	%r15d, %rsi
+ 749 07ae 31C0     		xorl	%eax, %eax
+ 750 07b0 48C1E603 		salq	$3, %rsi
+ 751 07b4 85C9     		testl	%ecx, %ecx
+ 752 07b6 7E3A     		jle	.L106
+ 753 07b8 0F1F8400 		.p2align 4,,10
+ 753      00000000 
+ 754              		.p2align 3
+ 755              	.L104:
+ 756 07c0 C4C17A10 		vmovss	8(%r13,%rax,4), %xmm0
+ 756      448508
+ 757 07c7 C5F82EC1 		vucomiss	%xmm1, %xmm0
+ 758 07cb 7A02     		jp	.L109
+ 759 07cd 741A     		je	.L102
+ 760              	.L109:
+ 761 07cf 49631424 		movslq	(%r12), %rdx
+ 762 07d3 8D7A01   		leal	1(%rdx), %edi
+ 763 07d6 488D5432 		leaq	32(%rdx,%rsi), %rdx
+ 763      20
+ 764 07db 41893C24 		movl	%edi, (%r12)
+ 765 07df 8944D328 		movl	%eax, 40(%rbx,%rdx,8)
+ 766 07e3 C5FA1144 		vmovss	%xmm0, 44(%rbx,%rdx,8)
+ 766      D32C
+ 767              	.L102:
+ 768 07e9 4883C001 		addq	$1, %rax
+ 769 07ed 4839C1   		cmpq	%rax, %rcx
+ 770 07f0 75CE     		jne	.L104
+ 771              	.L106:
+ 772 07f2 458B0424 		movl	(%r12), %r8d
+ 773 07f6 4489F9   		movl	%r15d, %ecx
+ 774 07f9 31C0     		xorl	%eax, %eax
+ 775 07fb 488D1500 		leaq	__func__.2(%rip), %rdx
+ 775      000000
+ 776 0802 488D3500 		leaq	.LC20(%rip), %rsi
+ 776      000000
+ 777 0809 4183C701 		addl	$1, %r15d
+ 778 080d 4983C404 		addq	$4, %r12
+ 779 0811 4983C520 		addq	$32, %r13
+ 780 0815 BF010000 		movl	$1, %edi
+ 780      00
+ 781 081a E8000000 		call	debugprint@PLT
+ 781      00
+ 782 081f 44397B04 		cmpl	%r15d, 4(%rbx)
+ 783 0823 C5F057C9 		vxorps	%xmm1, %xmm1, %xmm1
+ 784 0827 0F8F7BFF 		jg	.L101
+ 784      FFFF
+ 785              	.L100:
+ 786 082d 488B4C24 		movq	56(%rsp), %rcx
+ 786      38
+ 787 0832 488B0500 		movq	mix_preroll@GOTPCREL(%rip), %rax
+ 787      000000
+ 788 0839 C5FD6F2C 		vmovdqa	(%rsp), %ymm5
+ 788      24
+ 789 083e 488981F0 		movq	%rax, 240(%rcx)
+ 789      000000
+ 790 0845 4489F0   		movl	%r14d, %eax
+ 791 0848 C5FE7FA9 		vmovdqu	%ymm5, 208(%rcx)
+ 791      D0000000 
+ 792 0850 C5F877   		vzeroupper
+ 793 0853 488D65D8 		leaq	-40(%rbp), %rsp
+ 794 0857 5B       		popq	%rbx
+ 795 0858 415C     		popq	%r12
+ 796 085a 415D     		popq	%r13
+ 797 085c 415E     		popq	%r14
+ 798 085e 415F     		popq	%r15
+ 799 0860 5D       		popq	%rbp
+ 800              		.cfi_remember_state
+ 801              		.cfi_def_cfa 7, 8
+ 802 0861 C3       		ret
+ 803              		.p2align 4,,10
+ 804 0862 660F1F44 		.p2align 3
+ 804      0000
+ 805              	.L90:
+ 806              		.cfi_restore_state
+ 807 0868 488B7424 		movq	88(%rsp), %rsi
+ 807      58
+ 808 086d 4885F6   		testq	%rsi, %rsi
+ 809 0870 0F84C900 		je	.L131
+ 809      0000
+ 810 0876 4889DF   		movq	%rbx, %rdi
+ 811 0879 E832FDFF 		call	mix_read_matrix
+ 811      FF
+ 812 087e 85C0     		testl	%eax, %eax
+ 813 0880 4189C6   		movl	%eax, %r14d
+ 814 0883 0F94C2   		sete	%dl
+ 815              	.L94:
+ 816 0886 498B07   		movq	(%r15), %rax
+ 817 0889 803800   		cmpb	$0, (%rax)
+ 818 088c 7408     		je	.L108
+ 819 088e 84D2     		testb	%dl, %dl
+ 820 0890 0F85AAFE 		jne	.L86
+ 820      FFFF
+ 821              	.L108:
+ 822 0896 8B5304   		movl	4(%rbx), %edx
+ 823 0899 89D0     		movl	%edx, %eax
+ 824 089b 4585F6   		testl	%r14d, %r14d
+ 825 089e 0F85E7FE 		jne	.L88
+ 825      FFFF
+ 826              	.L99:
+ 827 08a4 89D0     		movl	%edx, %eax
+ 828 08a6 4531F6   		xorl	%r14d, %r14d
+ 829 08a9 85D2     		testl	%edx, %edx
+ 830 08ab 0F85DAFE 		jne	.L88
+ 830      FFFF
+ 831 08b1 488D1500 		leaq	__func__.2(%rip), %rdx
+ 831      000000
+ 832 08b8 488D3500 		leaq	.LC18(%rip), %rsi
+ 832      000000
+ 833 08bf 31FF     		xorl	%edi, %edi
+ 834 08c1 31C0     		xorl	%eax, %eax
+ 835 08c3 E8000000 		call	debugprint@PLT
+ 835      00
+ 836 08c8 E9B5FEFF 		jmp	.L129
+ 836      FF
+ 837 08cd 0F1F00   		.p2align 4,,10
+ 838              		.p2align 3
+ 839              	.L89:
+ 840 08d0 488B7C24 		movq	88(%rsp), %rdi
+ 840      58
+ 841 08d5 4885FF   		testq	%rdi, %rdi
+ 842 08d8 7446     		je	.L132
+ 843 08da 4C89E6   		movq	%r12, %rsi
+ 844 08dd E8000000 		call	strtok@PLT
+ 844      00
+ 845 08e2 4889C6   		movq	%rax, %rsi
+ 846 08e5 4885C0   		testq	%rax, %rax
+ 847 08e8 750A     		jne	.L95
+ 848 08ea EB74     		jmp	.L107
+ 849 08ec 0F1F4000 		.p2align 4,,10
+ 850              		.p2align 3
+ 851              	.L133:
+ 852 08f0 84D2     		testb	%dl, %dl
+ 853 08f2 7492     		je	.L94
+ 854              	.L95:
+ 855 08f4 4C89EA   		movq	%r13, %rdx
+ 856 08f7 4889DF   		movq	%rbx, %rdi
+ 857 08fa E851FBFF 		call	mix_add_row
+ 857      FF
+ 858 08ff 4C89E6   		movq	%r12, %rsi
+ 859 0902 31FF     		xorl	%edi, %edi
+ 860 0904 4189C6   		movl	%eax, %r14d
+ 861 0907 E8000000 		call	strtok@PLT
+ 861      00
+ 862 090c 4585F6   		testl	%r14d, %r14d
+ 863 090f 4889C6   		movq	%rax, %rsi
+ 864 0912 0F94C2   		sete	%dl
+ 865 0915 4885C0   		testq	%rax, %rax
+ 866 0918 75D6     		jne	.L133
+ 867 091a E967FFFF 		jmp	.L94
+ 867      FF
+ 868 091f 90       		.p2align 4,,10
+ 869              		.p2align 3
+ 870              	.L132:
+ 871 0920 488B4C24 		movq	96(%rsp), %rcx
+ 871      60
+ 872 0925 488D1500 		leaq	__func__.2(%rip), %rdx
+ 872      000000
+ 873 092c 488D3500 		leaq	.LC14(%rip), %rsi
+ 873      000000
+ 874 0933 31C0     		xorl	%eax, %eax
+ 875 0935 E8000000 		call	debugprint@PLT
+ 875      00
+ 876 093a E943FEFF 		jmp	.L129
+ 876      FF
+ 877              	.L131:
+ 878 093f 488B4C24 		movq	104(%rsp), %rcx
+ 878      68
+ 879 0944 488D1500 		leaq	__func__.2(%rip), %rdx
+ 879      000000
+ 880 094b 31FF     		xorl	%edi, %edi
+ 881 094d 31C0     		xorl	%eax, %eax
+ 882 094f 488D3500 		leaq	.LC14(%rip), %rsi
+ 882      000000
+ 883 0956 E8000000 		call	debugprint@PLT
+ 883      00
+ 884 095b E922FEFF 		jmp	.L129
+ 884      FF
+ 885              	.L107:
+ 886 0960 BA010000 		movl	$1, %edx
+ 886      00
+ 887 0965 E91CFFFF 		jmp	.L94
+ 887      FF
+ 888              	.L130:
+ 889 096a 8B5304   		movl	4(%rbx), %edx
+ 890 096d E932FFFF 		jmp	.L99
+ 890      FF
+ 891              		.cfi_endproc
+ 892              	.LFE6404:
+ 894              		.section	.rodata.str1.1
+ 895              	.LC21:
+ 896 00d1 20204D69 		.string	"  Mix options\n"
+ 896      78206F70 
+ 896      74696F6E 
+ 896      730A00
+ 897              	.LC22:
+ 898 00e0 20202020 		.string	"    Name: mix\n"
+ 898      4E616D65 
+ 898      3A206D69 
+ 898      780A00
+ 899              		.section	.rodata.str1.8
+ 900 00b4 00000000 		.align 8
+ 901              	.LC23:
+ 902 00b8 20202020 		.string	"        m = gain matrix (linear), one row per output separated by '/', gains per input by
+ 902      20202020 
+ 902      6D203D20 
+ 902      6761696E 
+ 902      206D6174 
+ 903 0117 00       		.align 8
+ 904              	.LC24:
+ 905 0118 20202020 		.string	"        f = file with the gain matrix, one row per output, gains separated by whitespace\
+ 905      20202020 
+ 905      66203D20 
+ 905      66696C65 
+ 905      20776974 
+ 906 0172 00000000 		.align 8
+ 906      0000
+ 907              	.LC25:
+ 908 0178 20202020 		.string	"    Example: -p mix,m=0.5:0.5/0.5:-0.5\n"
+ 908      4578616D 
+ 908      706C653A 
+ 908      202D7020 
+ 908      6D69782C 
+ 909              		.align 8
+ 910              	.LC26:
+ 911 01a0 20202020 		.string	"    Note: The chain continues with as many channels as the matrix has rows\n"
+ 911      4E6F7465 
+ 911      3A205468 
+ 911      65206368 
+ 911      61696E20 
+ 912              		.text
+ 913 0972 66662E0F 		.p2align 4
+ 913      1F840000 
+ 913      0000000F 
+ 913      1F00
+ 914              		.globl	help_mix
+ 916              	help_mix:
+ 917              	.LFB6405:
+ 918              		.cfi_startproc
+ 919 0980 4883EC08 		subq	$8, %rsp
+ 920              		.cfi_def_cfa_offset 16
+ 921 0984 488D3500 		leaq	.LC21(%rip), %rsi
+ 921      000000
+ 922 098b 31FF     		xorl	%edi, %edi
+ 923 098d 31C0     		xorl	%eax, %eax
+ 924 098f E8000000 		call	debugprint@PLT
+ 924      00
+ 925 0994 488D3500 		leaq	.LC22(%rip), %rsi
+ 925      000000
+ 926 099b 31FF     		xorl	%edi, %edi
+ 927 099d 31C0     		xorl	%eax, %eax
+ 928 099f E8000000 		call	debugprint@PLT
+ 928      00
+ 929 09a4 488D3500 		leaq	.LC23(%rip), %rsi
+ 929      000000
+ 930 09ab 31FF     		xorl	%edi, %edi
+ 931 09ad 31C0     		xorl	%eax, %eax
+ 932 09af E8000000 		call	debugprint@PLT
+ 932      00
+ 933 09b4 488D3500 		leaq	.LC24(%rip), %rsi
+ 933      000000
+ 934 09bb 31FF     		xorl	%edi, %edi
+ 935 09bd 31C0     		xorl	%eax, %eax
+ 936 09bf E8000000 		call	debugprint@PLT
+ 936      00
+ 937 09c4 488D3500 		leaq	.LC25(%rip), %rsi
+ 937      000000
+ 938 09cb 31FF     		xorl	%edi, %edi
+ 939 09cd 31C0     		xorl	%eax, %eax
+ 940 09cf E8000000 		call	debugprint@PLT
+ 940      00
+ 941 09d4 488D3500 		leaq	.LC26(%rip), %rsi
+ 941      000000
+ 942 09db 31FF     		xorl	%edi, %edi
+ 943 09dd 31C0     		xorl	%eax, %eax
+ 944 09df 4883C408 		addq	$8, %rsp
+ 945              		.cfi_def_cfa_offset 8
+ 946 09e3 E9000000 		jmp	debugprint@PLT
+ 946      00
+ 947              		.cfi_endproc
+ 948              	.LFE6405:
+ 950              		.section	.rodata
+ 951              		.align 16
+ 954              	__func__.0:
+ 955 0000 6D69785F 		.string	"mix_read_matrix"
+ 955      72656164 
+ 955      5F6D6174 
+ 955      72697800 
+ 956              		.align 8
+ 959              	__func__.1:
+ 960 0010 6D69785F 		.string	"mix_add_row"
+ 960      6164645F 
+ 960      726F7700 
+ 961 001c 00000000 		.align 8
+ 964              	__func__.2:
+ 965 0020 63726561 		.string	"create_mix"
+ 965      74655F6D 
+ 965      697800
+ 966 002b 00000000 		.align 8
+ 966      00
+ 969              	__func__.3:
+ 970 0030 6D69785F 		.string	"mix_init"
+ 970      696E6974 
+ 970      00
+ 971              		.section	.rodata.cst4,"aM",@progbits,4
+ 972              		.align 4
+ 973              	.LC0:
+ 974 0000 0000803F 		.long	1065353216
+ 975              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 976              		.section	.note.GNU-stack,"",@progbits
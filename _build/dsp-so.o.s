@@ -0,0 +1,572 @@
+   1              		.file	"dsp-so.c"
+   2              		.text
+   3              		.p2align 4
+   4              		.globl	so_process
+   6              	so_process:
+   7              	.LFB14:
+   8              		.cfi_startproc
+   9 0000 53       		pushq	%rbx
+  10              		.cfi_def_cfa_offset 16
+  11              		.cfi_offset 3, -16
+  12 0001 4889FB   		movq	%rdi, %rbx
+  13 0004 8B97A400 		movl	164(%rdi), %edx
+  13      0000
+  14 000a 488D7748 		leaq	72(%rdi), %rsi
+  15 000e 488B83C0 		movq	192(%rbx), %rax
+  15      000000
+  16 0015 4883C708 		addq	$8, %rdi
+  17 0019 FF5020   		call	*32(%rax)
+  18 001c 8B93A000 		movl	160(%rbx), %edx
+  18      0000
+  19 0022 85D2     		testl	%edx, %edx
+  20 0024 7E12     		jle	.L3
+  21 0026 488BBB90 		movq	144(%rbx), %rdi
+  21      000000
+  22 002d 31F6     		xorl	%esi, %esi
+  23 002f 5B       		popq	%rbx
+  24              		.cfi_remember_state
+  25              		.cfi_def_cfa_offset 8
+  26 0030 E9000000 		jmp	memset@PLT
+  26      00
+  27              		.p2align 4,,10
+  28 0035 0F1F00   		.p2align 3
+  29              	.L3:
+  30              		.cfi_restore_state
+  31 0038 5B       		popq	%rbx
+  32              		.cfi_def_cfa_offset 8
+  33 0039 C3       		ret
+  34              		.cfi_endproc
+  35              	.LFE14:
+  37              		.section	.rodata.str1.8,"aMS",@progbits,1
+  38              		.align 8
+  39              	.LC0:
+  40 0000 25733A20 		.string	"%s: %s was generated for fs=%u, channels=%d\n"
+  40      25732077 
+  40      61732067 
+  40      656E6572 
+  40      61746564 
+  41 002d 000000   		.align 8
+  42              	.LC1:
+  43 0030 436F6D70 		.string	"Compiled chain does not match stream\n"
+  43      696C6564 
+  43      20636861 
+  43      696E2064 
+  43      6F657320 
+  44              		.text
+  45 003a 660F1F44 		.p2align 4
+  45      0000
+  46              		.globl	so_init
+  48              	so_init:
+  49              	.LFB15:
+  50              		.cfi_startproc
+  51 0040 53       		pushq	%rbx
+  52              		.cfi_def_cfa_offset 16
+  53              		.cfi_offset 3, -16
+  54 0041 488B9FC0 		movq	192(%rdi), %rbx
+  54      000000
+  55 0048 488B4310 		movq	16(%rbx), %rax
+  56 004c 448B08   		movl	(%rax), %r9d
+  57 004f 488B4318 		movq	24(%rbx), %rax
+  58 0053 448B00   		movl	(%rax), %r8d
+  59 0056 443B8F9C 		cmpl	156(%rdi), %r9d
+  59      000000
+  60 005d 7509     		jne	.L7
+  61 005f 44398798 		cmpl	%r8d, 152(%rdi)
+  61      000000
+  62 0066 7426     		je	.L8
+  63              	.L7:
+  64 0068 488B0B   		movq	(%rbx), %rcx
+  65 006b 31FF     		xorl	%edi, %edi
+  66 006d 488D1500 		leaq	__func__.1(%rip), %rdx
+  66      000000
+  67 0074 31C0     		xorl	%eax, %eax
+  68 0076 488D3500 		leaq	.LC0(%rip), %rsi
+  68      000000
+  69 007d E8000000 		call	debugprint@PLT
+  69      00
+  70 0082 488D3D00 		leaq	.LC1(%rip), %rdi
+  70      000000
+  71 0089 E8000000 		call	endprogram@PLT
+  71      00
+  72              	.L8:
+  73 008e 488B4328 		movq	40(%rbx), %rax
+  74 0092 5B       		popq	%rbx
+  75              		.cfi_def_cfa_offset 8
+  76 0093 FFE0     		jmp	*%rax
+  77              		.cfi_endproc
+  78              	.LFE15:
+  80 0095 66662E0F 		.p2align 4
+  80      1F840000 
+  80      000000
+  81              		.globl	destroy_so
+  83              	destroy_so:
+  84              	.LFB16:
+  85              		.cfi_startproc
+  86 00a0 53       		pushq	%rbx
+  87              		.cfi_def_cfa_offset 16
+  88              		.cfi_offset 3, -16
+  89 00a1 488B9FC0 		movq	192(%rdi), %rbx
+  89      000000
+  90 00a8 488B7B08 		movq	8(%rbx), %rdi
+  91 00ac 4885FF   		testq	%rdi, %rdi
+  92 00af 7405     		je	.L11
+  93 00b1 E8000000 		call	dlclose@PLT
+  93      00
+  94              	.L11:
+  95 00b6 488B3B   		movq	(%rbx), %rdi
+  96 00b9 E8000000 		call	free@PLT
+  96      00
+  97 00be 4889DF   		movq	%rbx, %rdi
+  98 00c1 5B       		popq	%rbx
+  99              		.cfi_def_cfa_offset 8
+ 100 00c2 E9000000 		jmp	free@PLT
+ 100      00
+ 101              		.cfi_endproc
+ 102              	.LFE16:
+ 104              		.section	.rodata.str1.1,"aMS",@progbits,1
+ 105              	.LC2:
+ 106 0000 00       		.string	""
+ 107              	.LC3:
+ 108 0001 2E2F00   		.string	"./"
+ 109              	.LC4:
+ 110 0004 6600     		.string	"f"
+ 111              	.LC5:
+ 112 0006 25732073 		.string	"%s subopts: %s\n"
+ 112      75626F70 
+ 112      74733A20 
+ 112      25730A00 
+ 113              		.section	.rodata.str1.8
+ 114 0056 0000     		.align 8
+ 115              	.LC6:
+ 116 0058 25733A20 		.string	"%s: Missing value for suboption '%s'\n"
+ 116      4D697373 
+ 116      696E6720 
+ 116      76616C75 
+ 116      6520666F 
+ 117              		.section	.rodata.str1.1
+ 118              	.LC7:
+ 119 0016 25732573 		.string	"%s%s"
+ 119      00
+ 120              	.LC8:
+ 121 001b 25733A20 		.string	"%s: filename=%s\n"
+ 121      66696C65 
+ 121      6E616D65 
+ 121      3D25730A 
+ 121      00
+ 122              		.section	.rodata.str1.8
+ 123 007e 0000     		.align 8
+ 124              	.LC9:
+ 125 0080 25733A20 		.string	"%s: No match found for token: /%s/\n"
+ 125      4E6F206D 
+ 125      61746368 
+ 125      20666F75 
+ 125      6E642066 
+ 126              		.section	.rodata.str1.1
+ 127              	.LC10:
+ 128 002c 25733A20 		.string	"%s: %s\n"
+ 128      25730A00 
+ 129              	.LC11:
+ 130 0034 71647370 		.string	"qdsp_chain_nchannels"
+ 130      5F636861 
+ 130      696E5F6E 
+ 130      6368616E 
+ 130      6E656C73 
+ 131              	.LC12:
+ 132 0049 71647370 		.string	"qdsp_chain_fs"
+ 132      5F636861 
+ 132      696E5F66 
+ 132      7300
+ 133              	.LC13:
+ 134 0057 71647370 		.string	"qdsp_chain_process"
+ 134      5F636861 
+ 134      696E5F70 
+ 134      726F6365 
+ 134      737300
+ 135              	.LC14:
+ 136 006a 71647370 		.string	"qdsp_chain_reset"
+ 136      5F636861 
+ 136      696E5F72 
+ 136      65736574 
+ 136      00
+ 137              		.section	.rodata.str1.8
+ 138 00a4 00000000 		.align 8
+ 139              	.LC15:
+ 140 00a8 25733A20 		.string	"%s: %s is not a generated qdsp chain\n"
+ 140      25732069 
+ 140      73206E6F 
+ 140      74206120 
+ 140      67656E65 
+ 141              		.text
+ 142 00c7 660F1F84 		.p2align 4
+ 142      00000000 
+ 142      00
+ 143              		.globl	create_so
+ 145              	create_so:
+ 146              	.LFB17:
+ 147              		.cfi_startproc
+ 148 00d0 4157     		pushq	%r15
+ 149              		.cfi_def_cfa_offset 16
+ 150              		.cfi_offset 15, -16
+ 151 00d2 488D0500 		leaq	.LC4(%rip), %rax
+ 151      000000
+ 152 00d9 4156     		pushq	%r14
+ 153              		.cfi_def_cfa_offset 24
+ 154              		.cfi_offset 14, -24
+ 155 00db 4155     		pushq	%r13
+ 156              		.cfi_def_cfa_offset 32
+ 157              		.cfi_offset 13, -32
+ 158 00dd 4C8D2D00 		leaq	__func__.0(%rip), %r13
+ 158      000000
+ 159 00e4 4154     		pushq	%r12
+ 160              		.cfi_def_cfa_offset 40
+ 161              		.cfi_offset 12, -40
+ 162 00e6 4989F4   		movq	%rsi, %r12
+ 163 00e9 55       		pushq	%rbp
+ 164              		.cfi_def_cfa_offset 48
+ 165              		.cfi_offset 6, -48
+ 166 00ea 53       		pushq	%rbx
+ 167              		.cfi_def_cfa_offset 56
+ 168              		.cfi_offset 3, -56
+ 169 00eb 4883EC48 		subq	$72, %rsp
+ 170              		.cfi_def_cfa_offset 128
+ 171 00ef C5FA7E15 		vmovq	so_process@GOTPCREL(%rip), %xmm2
+ 171      00000000 
+ 172 00f7 C4E3E922 		vpinsrq	$1, so_init@GOTPCREL(%rip), %xmm2, %xmm1
+ 172      0D000000 
+ 172      0001
+ 173 0101 48897C24 		movq	%rdi, 8(%rsp)
+ 173      08
+ 174 0106 BF300000 		movl	$48, %edi
+ 174      00
+ 175 010b C5F97F4C 		vmovdqa	%xmm1, 16(%rsp)
+ 175      2410
+ 176 0111 48894424 		movq	%rax, 48(%rsp)
+ 176      30
+ 177 0116 48C74424 		movq	$0, 56(%rsp)
+ 177      38000000 
+ 177      00
+ 178 011f E8000000 		call	malloc@PLT
+ 178      00
+ 179 0124 C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 180 0128 4C89EA   		movq	%r13, %rdx
+ 181 012b 488D3500 		leaq	.LC5(%rip), %rsi
+ 181      000000
+ 182 0132 4889C3   		movq	%rax, %rbx
+ 183 0135 488B4424 		movq	8(%rsp), %rax
+ 183      08
+ 184 013a BF010000 		movl	$1, %edi
+ 184      00
+ 185 013f C5FA7F03 		vmovdqu	%xmm0, (%rbx)
+ 186 0143 488998C0 		movq	%rbx, 192(%rax)
+ 186      000000
+ 187 014a 498B0C24 		movq	(%r12), %rcx
+ 188 014e 31C0     		xorl	%eax, %eax
+ 189 0150 E8000000 		call	debugprint@PLT
+ 189      00
+ 190 0155 498B0424 		movq	(%r12), %rax
+ 191 0159 803800   		cmpb	$0, (%rax)
+ 192 015c 0F84B100 		je	.L17
+ 192      0000
+ 193 0162 488D4424 		leaq	48(%rsp), %rax
+ 193      30
+ 194 0167 4C8D7C24 		leaq	40(%rsp), %r15
+ 194      28
+ 195 016c 48890424 		movq	%rax, (%rsp)
+ 196              		.p2align 4,,10
+ 197              		.p2align 3
+ 198              	.L22:
+ 199 0170 488B3424 		movq	(%rsp), %rsi
+ 200 0174 4C89FA   		movq	%r15, %rdx
+ 201 0177 4C89E7   		movq	%r12, %rdi
+ 202 017a E8000000 		call	getsubopt@PLT
+ 202      00
+ 203 017f 85C0     		testl	%eax, %eax
+ 204 0181 0F855901 		jne	.L18
+ 204      0000
+ 205 0187 48837C24 		cmpq	$0, 40(%rsp)
+ 205      2800
+ 206 018d 0F848D01 		je	.L34
+ 206      0000
+ 207 0193 488B3B   		movq	(%rbx), %rdi
+ 208 0196 E8000000 		call	free@PLT
+ 208      00
+ 209 019b 488B6C24 		movq	40(%rsp), %rbp
+ 209      28
+ 210 01a0 4889EF   		movq	%rbp, %rdi
+ 211 01a3 E8000000 		call	strlen@PLT
+ 211      00
+ 212 01a8 488D7803 		leaq	3(%rax), %rdi
+ 213 01ac E8000000 		call	malloc@PLT
+ 213      00
+ 214 01b1 BE2F0000 		movl	$47, %esi
+ 214      00
+ 215 01b6 4889EF   		movq	%rbp, %rdi
+ 216 01b9 488903   		movq	%rax, (%rbx)
+ 217 01bc 4989C6   		movq	%rax, %r14
+ 218 01bf E8000000 		call	strchr@PLT
+ 218      00
+ 219 01c4 488D1500 		leaq	.LC2(%rip), %rdx
+ 219      000000
+ 220 01cb 4889E9   		movq	%rbp, %rcx
+ 221 01ce 4C89F7   		movq	%r14, %rdi
+ 222 01d1 4885C0   		testq	%rax, %rax
+ 223 01d4 488D0500 		leaq	.LC3(%rip), %rax
+ 223      000000
+ 224 01db 488D3500 		leaq	.LC7(%rip), %rsi
+ 224      000000
+ 225 01e2 480F44D0 		cmove	%rax, %rdx
+ 226 01e6 31C0     		xorl	%eax, %eax
+ 227 01e8 E8000000 		call	sprintf@PLT
+ 227      00
+ 228 01ed 488B0B   		movq	(%rbx), %rcx
+ 229 01f0 31C0     		xorl	%eax, %eax
+ 230 01f2 4C89EA   		movq	%r13, %rdx
+ 231 01f5 488D3500 		leaq	.LC8(%rip), %rsi
+ 231      000000
+ 232 01fc BF010000 		movl	$1, %edi
+ 232      00
+ 233 0201 E8000000 		call	debugprint@PLT
+ 233      00
+ 234 0206 498B0424 		movq	(%r12), %rax
+ 235 020a 803800   		cmpb	$0, (%rax)
+ 236 020d 0F855DFF 		jne	.L22
+ 236      FFFF
+ 237              	.L17:
+ 238 0213 488B4C24 		movq	8(%rsp), %rcx
+ 238      08
+ 239 0218 C5F96F5C 		vmovdqa	16(%rsp), %xmm3
+ 239      2410
+ 240 021e 488B0500 		movq	destroy_so@GOTPCREL(%rip), %rax
+ 240      000000
+ 241 0225 488B3B   		movq	(%rbx), %rdi
+ 242 0228 C5FA7F99 		vmovdqu	%xmm3, 208(%rcx)
+ 242      D0000000 
+ 243 0230 488981E0 		movq	%rax, 224(%rcx)
+ 243      000000
+ 244 0237 4885FF   		testq	%rdi, %rdi
+ 245 023a 0F84D900 		je	.L23
+ 245      0000
+ 246 0240 BE020000 		movl	$2, %esi
+ 246      00
+ 247 0245 E8000000 		call	dlopen@PLT
+ 247      00
+ 248 024a 48894308 		movq	%rax, 8(%rbx)
+ 249 024e 4889C7   		movq	%rax, %rdi
+ 250 0251 4885C0   		testq	%rax, %rax
+ 251 0254 0F840601 		je	.L35
+ 251      0000
+ 252 025a 488D3500 		leaq	.LC11(%rip), %rsi
+ 252      000000
+ 253 0261 E8000000 		call	dlsym@PLT
+ 253      00
+ 254 0266 488B7B08 		movq	8(%rbx), %rdi
+ 255 026a 488D3500 		leaq	.LC12(%rip), %rsi
+ 255      000000
+ 256 0271 48894310 		movq	%rax, 16(%rbx)
+ 257 0275 E8000000 		call	dlsym@PLT
+ 257      00
+ 258 027a 488B7B08 		movq	8(%rbx), %rdi
+ 259 027e 488D3500 		leaq	.LC13(%rip), %rsi
+ 259      000000
+ 260 0285 48894318 		movq	%rax, 24(%rbx)
+ 261 0289 E8000000 		call	dlsym@PLT
+ 261      00
+ 262 028e 488B7B08 		movq	8(%rbx), %rdi
+ 263 0292 488D3500 		leaq	.LC14(%rip), %rsi
+ 263      000000
+ 264 0299 48894320 		movq	%rax, 32(%rbx)
+ 265 029d E8000000 		call	dlsym@PLT
+ 265      00
+ 266 02a2 48837B10 		cmpq	$0, 16(%rbx)
+ 266      00
+ 267 02a7 48894328 		movq	%rax, 40(%rbx)
+ 268 02ab 0F848F00 		je	.L26
+ 268      0000
+ 269 02b1 48837B18 		cmpq	$0, 24(%rbx)
+ 269      00
+ 270 02b6 0F848400 		je	.L26
+ 270      0000
+ 271 02bc 48837B20 		cmpq	$0, 32(%rbx)
+ 271      00
+ 272 02c1 747D     		je	.L26
+ 273 02c3 31D2     		xorl	%edx, %edx
+ 274 02c5 4885C0   		testq	%rax, %rax
+ 275 02c8 7476     		je	.L26
+ 276              	.L16:
+ 277 02ca 4883C448 		addq	$72, %rsp
+ 278              		.cfi_remember_state
+ 279              		.cfi_def_cfa_offset 56
+ 280 02ce 89D0     		movl	%edx, %eax
+ 281 02d0 5B       		popq	%rbx
+ 282              		.cfi_def_cfa_offset 48
+ 283 02d1 5D       		popq	%rbp
+ 284              		.cfi_def_cfa_offset 40
+ 285 02d2 415C     		popq	%r12
+ 286              		.cfi_def_cfa_offset 32
+ 287 02d4 415D     		popq	%r13
+ 288              		.cfi_def_cfa_offset 24
+ 289 02d6 415E     		popq	%r14
+ 290              		.cfi_def_cfa_offset 16
+ 291 02d8 415F     		popq	%r15
+ 292              		.cfi_def_cfa_offset 8
+ 293 02da C3       		ret
+ 294 02db 0F1F4400 		.p2align 4,,10
+ 294      00
+ 295              		.p2align 3
+ 296              	.L18:
+ 297              		.cfi_restore_state
+ 298 02e0 488B4C24 		movq	40(%rsp), %rcx
+ 298      28
+ 299 02e5 4C89EA   		movq	%r13, %rdx
+ 300 02e8 31FF     		xorl	%edi, %edi
+ 301 02ea 31C0     		xorl	%eax, %eax
+ 302 02ec 488D3500 		leaq	.LC9(%rip), %rsi
+ 302      000000
+ 303 02f3 E8000000 		call	debugprint@PLT
+ 303      00
+ 304              	.L20:
+ 305 02f8 488B5C24 		movq	8(%rsp), %rbx
+ 305      08
+ 306 02fd 488B0500 		movq	destroy_so@GOTPCREL(%rip), %rax
+ 306      000000
+ 307 0304 C5F96F64 		vmovdqa	16(%rsp), %xmm4
+ 307      2410
+ 308 030a 488983E0 		movq	%rax, 224(%rbx)
+ 308      000000
+ 309 0311 C5FA7FA3 		vmovdqu	%xmm4, 208(%rbx)
+ 309      D0000000 
+ 310              	.L23:
+ 311 0319 BA010000 		movl	$1, %edx
+ 311      00
+ 312 031e EBAA     		jmp	.L16
+ 313              		.p2align 4,,10
+ 314              		.p2align 3
+ 315              	.L34:
+ 316 0320 488B4C24 		movq	48(%rsp), %rcx
+ 316      30
+ 317 0325 4C89EA   		movq	%r13, %rdx
+ 318 0328 488D3500 		leaq	.LC6(%rip), %rsi
+ 318      000000
+ 319 032f 31FF     		xorl	%edi, %edi
+ 320 0331 E8000000 		call	debugprint@PLT
+ 320      00
+ 321 0336 EBC0     		jmp	.L20
+ 322 0338 0F1F8400 		.p2align 4,,10
+ 322      00000000 
+ 323              		.p2align 3
+ 324              	.L26:
+ 325 0340 488B0B   		movq	(%rbx), %rcx
+ 326 0343 4C89EA   		movq	%r13, %rdx
+ 327 0346 488D3500 		leaq	.LC15(%rip), %rsi
+ 327      000000
+ 328 034d 31FF     		xorl	%edi, %edi
+ 329 034f 31C0     		xorl	%eax, %eax
+ 330 0351 E8000000 		call	debugprint@PLT
+ 330      00
+ 331 0356 BA010000 		movl	$1, %edx
+ 331      00
+ 332 035b E96AFFFF 		jmp	.L16
+ 332      FF
+ 333              	.L35:
+ 334 0360 E8000000 		call	dlerror@PLT
+ 334      00
+ 335 0365 4C89EA   		movq	%r13, %rdx
+ 336 0368 488D3500 		leaq	.LC10(%rip), %rsi
+ 336      000000
+ 337 036f 31FF     		xorl	%edi, %edi
+ 338 0371 4889C1   		movq	%rax, %rcx
+ 339 0374 31C0     		xorl	%eax, %eax
+ 340 0376 E8000000 		call	debugprint@PLT
+ 340      00
+ 341 037b EB9C     		jmp	.L23
+ 342              		.cfi_endproc
+ 343              	.LFE17:
+ 345              		.section	.rodata.str1.1
+ 346              	.LC16:
+ 347 007b 2020436F 		.string	"  Compiled chain options\n"
+ 347      6D70696C 
+ 347      65642063 
+ 347      6861696E 
+ 347      206F7074 
+ 348              	.LC17:
+ 349 0095 20202020 		.string	"    Name: so\n"
+ 349      4E616D65 
+ 349      3A20736F 
+ 349      0A00
+ 350              		.section	.rodata.str1.8
+ 351 00ce 0000     		.align 8
+ 352              	.LC18:
+ 353 00d0 20202020 		.string	"        f = shared object built from a chain generated with -g\n"
+ 353      20202020 
+ 353      66203D20 
+ 353      73686172 
+ 353      6564206F 
+ 354              		.align 8
+ 355              	.LC19:
+ 356 0110 20202020 		.string	"    Example: -p so,f=chain.so\n"
+ 356      4578616D 
+ 356      706C653A 
+ 356      202D7020 
+ 356      736F2C66 
+ 357 012f 00       		.align 8
+ 358              	.LC20:
+ 359 0130 20202020 		.string	"    Note: Build with 'make chain.so', fs and channels must match the generated chain\n"
+ 359      4E6F7465 
+ 359      3A204275 
+ 359      696C6420 
+ 359      77697468 
+ 360              		.text
+ 361 037d 0F1F00   		.p2align 4
+ 362              		.globl	help_so
+ 364              	help_so:
+ 365              	.LFB18:
+ 366              		.cfi_startproc
+ 367 0380 4883EC08 		subq	$8, %rsp
+ 368              		.cfi_def_cfa_offset 16
+ 369 0384 488D3500 		leaq	.LC16(%rip), %rsi
+ 369      000000
+ 370 038b 31FF     		xorl	%edi, %edi
+ 371 038d 31C0     		xorl	%eax, %eax
+ 372 038f E8000000 		call	debugprint@PLT
+ 372      00
+ 373 0394 488D3500 		leaq	.LC17(%rip), %rsi
+ 373      000000
+ 374 039b 31FF     		xorl	%edi, %edi
+ 375 039d 31C0     		xorl	%eax, %eax
+ 376 039f E8000000 		call	debugprint@PLT
+ 376      00
+ 377 03a4 488D3500 		leaq	.LC18(%rip), %rsi
+ 377      000000
+ 378 03ab 31FF     		xorl	%edi, %edi
+ 379 03ad 31C0     		xorl	%eax, %eax
+ 380 03af E8000000 		call	debugprint@PLT
+ 380      00
+ 381 03b4 488D3500 		leaq	.LC19(%rip), %rsi
+ 381      000000
+ 382 03bb 31FF     		xorl	%edi, %edi
+ 383 03bd 31C0     		xorl	%eax, %eax
+ 384 03bf E8000000 		call	debugprint@PLT
+ 384      00
+ 385 03c4 488D3500 		leaq	.LC20(%rip), %rsi
+ 385      000000
+ 386 03cb 31FF     		xorl	%edi, %edi
+ 387 03cd 31C0     		xorl	%eax, %eax
+ 388 03cf 4883C408 		addq	$8, %rsp
+ 389              		.cfi_def_cfa_offset 8
+ 390 03d3 E9000000 		jmp	debugprint@PLT
+ 390      00
+ 391              		.cfi_endproc
+ 392              	.LFE18:
+ 394              		.section	.rodata
+ 395              		.align 8
+ 398              	__func__.0:
+ 399 0000 63726561 		.string	"create_so"
+ 399      74655F73 
+ 399      6F00
+ 400 000a 00000000 		.align 8
+ 400      0000
+ 403              	__func__.1:
+ 404 0010 736F5F69 		.string	"so_init"
+ 404      6E697400 
+ 405              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 406              		.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2904 @@
+   1              		.file	"dsp-xover.c"
+   2              		.text
+   3              		.p2align 4
+   4              		.globl	xover_process
+   6              	xover_process:
+   7              	.LFB17:
+   8              		.cfi_startproc
+   9 0000 55       		pushq	%rbp
+  10              		.cfi_def_cfa_offset 16
+  11              		.cfi_offset 6, -16
+  12 0001 C5D857E4 		vxorps	%xmm4, %xmm4, %xmm4
+  13 0005 4889E5   		movq	%rsp, %rbp
+  14              		.cfi_def_cfa_register 6
+  15 0008 4157     		pushq	%r15
+  16 000a 4156     		pushq	%r14
+  17 000c 4155     		pushq	%r13
+  18 000e 4154     		pushq	%r12
+  19              		.cfi_offset 15, -24
+  20              		.cfi_offset 14, -32
+  21              		.cfi_offset 13, -40
+  22              		.cfi_offset 12, -48
+  23 0010 4989FC   		movq	%rdi, %r12
+  24 0013 53       		pushq	%rbx
+  25 0014 4883E4C0 		andq	$-64, %rsp
+  26 0018 4881EC80 		subq	$5248, %rsp
+  26      140000
+  27              		.cfi_offset 3, -56
+  28 001f 488B87C0 		movq	192(%rdi), %rax
+  28      000000
+  29 0026 8B9F9C00 		movl	156(%rdi), %ebx
+  29      0000
+  30 002c 48898424 		movq	%rax, 128(%rsp)
+  30      80000000 
+  31 0034 85DB     		testl	%ebx, %ebx
+  32 0036 0F8EF10B 		jle	.L2
+  32      0000
+  33 003c 4C8B8F88 		movq	136(%rdi), %r9
+  33      000000
+  34 0043 4863CB   		movslq	%ebx, %rcx
+  35 0046 4889C7   		movq	%rax, %rdi
+  36 0049 31F6     		xorl	%esi, %esi
+  37 004b C5FA7E1D 		vmovq	.LC1(%rip), %xmm3
+  37      00000000 
+  38 0053 488D9040 		leaq	4928(%rax), %rdx
+  38      130000
+  39 005a 4531C0   		xorl	%r8d, %r8d
+  40 005d C5FB103D 		vmovsd	.LC2(%rip), %xmm7
+  40      00000000 
+  41              	.L6:
+  42 0065 41803C31 		cmpb	$0, (%r9,%rsi)
+  42      00
+  43 006a 0F850807 		jne	.L161
+  43      0000
+  44              	.L3:
+  45 0070 4883C601 		addq	$1, %rsi
+  46 0074 4883C708 		addq	$8, %rdi
+  47 0078 4883C208 		addq	$8, %rdx
+  48 007c 4839F1   		cmpq	%rsi, %rcx
+  49 007f 75E4     		jne	.L6
+  50 0081 488B8424 		movq	128(%rsp), %rax
+  50      80000000 
+  51 0089 8BB0A823 		movl	9128(%rax), %esi
+  51      0000
+  52 008f B8010000 		movl	$1, %eax
+  52      00
+  53 0094 C4E261F7 		shlx	%ebx, %eax, %eax
+  53      C0
+  54 0099 83E801   		subl	$1, %eax
+  55 009c 85F6     		testl	%esi, %esi
+  56 009e 0F88F013 		js	.L10
+  56      0000
+  57              	.L8:
+  58 00a4 448D5E01 		leal	1(%rsi), %r11d
+  59 00a8 4531D2   		xorl	%r10d, %r10d
+  60 00ab 4531C9   		xorl	%r9d, %r9d
+  61              	.L11:
+  62 00ae 85DB     		testl	%ebx, %ebx
+  63 00b0 0F8E2507 		jle	.L138
+  63      0000
+  64 00b6 4D8BB424 		movq	144(%r12), %r14
+  64      90000000 
+  65 00be 4863CB   		movslq	%ebx, %rcx
+  66              		.p2align 4,,10
+  67 00c1 0F1F8000 		.p2align 3
+  67      000000
+  68              	.L13:
+  69 00c8 4963FA   		movslq	%r10d, %rdi
+  70 00cb 31D2     		xorl	%edx, %edx
+  71 00cd 4C01F7   		addq	%r14, %rdi
+  72              		.p2align 4,,10
+  73              		.p2align 3
+  74              	.L12:
+  75 00d0 C4426BF7 		shrx	%edx, %r8d, %r13d
+  75      E8
+  76 00d5 44882C17 		movb	%r13b, (%rdi,%rdx)
+  77 00d9 80241701 		andb	$1, (%rdi,%rdx)
+  78 00dd 4883C201 		addq	$1, %rdx
+  79 00e1 4839D1   		cmpq	%rdx, %rcx
+  80 00e4 75EA     		jne	.L12
+  81 00e6 4183C101 		addl	$1, %r9d
+  82 00ea 4101DA   		addl	%ebx, %r10d
+  83 00ed 4539CB   		cmpl	%r9d, %r11d
+  84 00f0 75D6     		jne	.L13
+  85              	.L14:
+  86 00f2 4439C0   		cmpl	%r8d, %eax
+  87 00f5 0F844D0B 		je	.L9
+  87      0000
+  88 00fb 418B9424 		movl	164(%r12), %edx
+  88      A4000000 
+  89 0103 83FE02   		cmpl	$2, %esi
+  90 0106 0F847F0B 		je	.L100
+  90      0000
+  91 010c 83FE03   		cmpl	$3, %esi
+  92 010f 0F84DB06 		je	.L22
+  92      0000
+  93 0115 83FE01   		cmpl	$1, %esi
+  94 0118 0F846C0E 		je	.L162
+  94      0000
+  95 011e 85F6     		testl	%esi, %esi
+  96 0120 0F847F13 		je	.L70
+  96      0000
+  97 0126 4189F0   		movl	%esi, %r8d
+  98 0129 8D46FE   		leal	-2(%rsi), %eax
+  99 012c 89742464 		movl	%esi, 100(%rsp)
+ 100 0130 41BE8000 		movl	$128, %r14d
+ 100      0000
+ 101 0136 4C8BAC24 		movq	128(%rsp), %r13
+ 101      80000000 
+ 102 013e 4D89C7   		movq	%r8, %r15
+ 103 0141 89542460 		movl	%edx, 96(%rsp)
+ 104 0145 4C8D8C24 		leaq	2176(%rsp), %r9
+ 104      80080000 
+ 105 014d 49C1E707 		salq	$7, %r15
+ 106 0151 4C894424 		movq	%r8, 72(%rsp)
+ 106      48
+ 107 0156 4C89CF   		movq	%r9, %rdi
+ 108 0159 62D1FE48 		vmovdqu64	0(%r13), %zmm7
+ 108      6F7D00
+ 109 0160 4D8D9D40 		leaq	1856(%r13), %r11
+ 109      070000
+ 110 0167 4C897C24 		movq	%r15, 104(%rsp)
+ 110      68
+ 111 016c 4C8DBC24 		leaq	1216(%rsp), %r15
+ 111      C0040000 
+ 112 0174 4C894C24 		movq	%r9, 64(%rsp)
+ 112      40
+ 113 0179 62F1FD48 		vmovdqa64	%zmm7, 320(%rsp)
+ 113      7F7C2405 
+ 114 0181 62D1FE48 		vmovdqu64	64(%r13), %zmm7
+ 114      6F7D01
+ 115 0188 4C895C24 		movq	%r11, 56(%rsp)
+ 115      38
+ 116 018d 62F1FD48 		vmovdqa64	%zmm7, 384(%rsp)
+ 116      7F7C2406 
+ 117 0195 62D1FE48 		vmovdqu64	896(%r13), %zmm7
+ 117      6F7D0E
+ 118 019c 89442458 		movl	%eax, 88(%rsp)
+ 119 01a0 62F1FD48 		vmovdqa64	%zmm7, 1216(%rsp)
+ 119      7F7C2413 
+ 120 01a8 62D1FE48 		vmovdqu64	960(%r13), %zmm7
+ 120      6F7D0F
+ 121 01af 895C245C 		movl	%ebx, 92(%rsp)
+ 122 01b3 4C89EB   		movq	%r13, %rbx
+ 123 01b6 4189C5   		movl	%eax, %r13d
+ 124 01b9 62F1FD48 		vmovdqa64	%zmm7, 192(%rsp)
+ 124      7F7C2403 
+ 125 01c1 4C89BC24 		movq	%r15, 192(%rsp)
+ 125      C0000000 
+ 126 01c9 4C8DBC24 		leaq	320(%rsp), %r15
+ 126      40010000 
+ 127 01d1 4C897C24 		movq	%r15, 120(%rsp)
+ 127      78
+ 128 01d6 4C8DBC24 		leaq	384(%rsp), %r15
+ 128      80010000 
+ 129 01de 4C897C24 		movq	%r15, 112(%rsp)
+ 129      70
+ 130 01e3 4C8DBC24 		leaq	1280(%rsp), %r15
+ 130      00050000 
+ 131 01eb 4C896424 		movq	%r12, 80(%rsp)
+ 131      50
+ 132 01f0 4D89DC   		movq	%r11, %r12
+ 133 01f3 62F1FD48 		vmovdqa64	%zmm7, 1280(%rsp)
+ 133      7F7C2414 
+ 134              	.L71:
+ 135 01fb 4489EA   		movl	%r13d, %edx
+ 136 01fe 4C89E6   		movq	%r12, %rsi
+ 137 0201 4883C201 		addq	$1, %rdx
+ 138 0205 48C1E206 		salq	$6, %rdx
+ 139 0209 C5F877   		vzeroupper
+ 140 020c E8000000 		call	memcpy@PLT
+ 140      00
+ 141 0211 4183ED01 		subl	$1, %r13d
+ 142 0215 62B1FE48 		vmovdqu64	(%rbx,%r14), %zmm7
+ 142      6F3C33
+ 143 021c 4889C7   		movq	%rax, %rdi
+ 144 021f 488B4424 		movq	120(%rsp), %rax
+ 144      78
+ 145 0224 4981C400 		addq	$512, %r12
+ 145      020000
+ 146 022b C5D857E4 		vxorps	%xmm4, %xmm4, %xmm4
+ 147 022f 4881C700 		addq	$512, %rdi
+ 147      020000
+ 148 0236 62B1FE48 		vmovdqu64	%zmm7, (%rax,%r14)
+ 148      7F3C30
+ 149 023d 62B1FE48 		vmovdqu64	64(%rbx,%r14), %zmm7
+ 149      6F7C3301 
+ 150 0245 488B4424 		movq	112(%rsp), %rax
+ 150      70
+ 151 024a 62B1FE48 		vmovdqu64	%zmm7, (%rax,%r14)
+ 151      7F3C30
+ 152 0251 488B8424 		movq	192(%rsp), %rax
+ 152      C0000000 
+ 153 0259 62B1FE48 		vmovdqu64	896(%rbx,%r14), %zmm7
+ 153      6F7C330E 
+ 154 0261 62B1FE48 		vmovdqu64	%zmm7, (%rax,%r14)
+ 154      7F3C30
+ 155 0268 62B1FE48 		vmovdqu64	960(%rbx,%r14), %zmm7
+ 155      6F7C330F 
+ 156 0270 6291FE48 		vmovdqu64	%zmm7, (%r15,%r14)
+ 156      7F3C37
+ 157 0277 4983EE80 		subq	$-128, %r14
+ 158 027b 4C397424 		cmpq	%r14, 104(%rsp)
+ 158      68
+ 159 0280 0F8575FF 		jne	.L71
+ 159      FFFF
+ 160 0286 8B542460 		movl	96(%rsp), %edx
+ 161 028a 8B742464 		movl	100(%rsp), %esi
+ 162 028e 8B5C245C 		movl	92(%rsp), %ebx
+ 163 0292 4C8B6424 		movq	80(%rsp), %r12
+ 163      50
+ 164 0297 4C8B4424 		movq	72(%rsp), %r8
+ 164      48
+ 165 029c 4C8B4C24 		movq	64(%rsp), %r9
+ 165      40
+ 166 02a1 4C8B5C24 		movq	56(%rsp), %r11
+ 166      38
+ 167 02a6 8B442458 		movl	88(%rsp), %eax
+ 168 02aa 85D2     		testl	%edx, %edx
+ 169 02ac 0F8EBF03 		jle	.L75
+ 169      0000
+ 170              	.L73:
+ 171 02b2 89F0     		movl	%esi, %eax
+ 172 02b4 89542470 		movl	%edx, 112(%rsp)
+ 173 02b8 4531D2   		xorl	%r10d, %r10d
+ 174 02bb 488D8C24 		leaq	2112(%rsp), %rcx
+ 174      40080000 
+ 175 02c3 0FAFC3   		imull	%ebx, %eax
+ 176 02c6 4C8DAC24 		leaq	320(%rsp), %r13
+ 176      40010000 
+ 177 02ce C461F96E 		vmovq	%rcx, %xmm8
+ 177      C1
+ 178 02d3 4C8B8C24 		movq	128(%rsp), %r9
+ 178      80000000 
+ 179 02db 8D4EFF   		leal	-1(%rsi), %ecx
+ 180 02de 4C8DBC24 		leaq	288(%rsp), %r15
+ 180      20010000 
+ 181 02e6 4C896C24 		movq	%r13, 104(%rsp)
+ 181      68
+ 182 02eb C4413157 		vxorpd	%xmm9, %xmm9, %xmm9
+ 182      C9
+ 183 02f0 C5F96EF9 		vmovd	%ecx, %xmm7
+ 184 02f4 488D8C24 		leaq	2176(%rsp), %rcx
+ 184      80080000 
+ 185 02fc 4898     		cltq
+ 186 02fe C4E1F96E 		vmovq	%rcx, %xmm6
+ 186      F1
+ 187 0303 498D04C4 		leaq	(%r12,%rax,8), %rax
+ 188 0307 C4E1F96E 		vmovq	%rax, %xmm0
+ 188      C0
+ 189 030c 31C0     		xorl	%eax, %eax
+ 190 030e 89C1     		movl	%eax, %ecx
+ 191 0310 4C89F8   		movq	%r15, %rax
+ 192 0313 C5F96FE8 		vmovdqa	%xmm0, %xmm5
+ 193 0317 4D89E7   		movq	%r12, %r15
+ 194 031a 4989C4   		movq	%rax, %r12
+ 195 031d 0F1F00   		.p2align 4,,10
+ 196              		.p2align 3
+ 197              	.L80:
+ 198 0320 C57D298C 		vmovapd	%ymm9, 256(%rsp)
+ 198      24000100 
+ 198      00
+ 199 0329 85DB     		testl	%ebx, %ebx
+ 200 032b 0F8E5211 		jle	.L76
+ 200      0000
+ 201 0331 4863FB   		movslq	%ebx, %rdi
+ 202 0334 31C0     		xorl	%eax, %eax
+ 203 0336 488D9424 		leaq	256(%rsp), %rdx
+ 203      00010000 
+ 204              	.L77:
+ 205 033e 4D8B44C7 		movq	8(%r15,%rax,8), %r8
+ 205      08
+ 206 0343 C4815A5A 		vcvtss2sd	(%r8,%r10), %xmm4, %xmm1
+ 206      0C10
+ 207 0349 C5FB110C 		vmovsd	%xmm1, (%rdx,%rax,8)
+ 207      C2
+ 208 034e 4883C001 		addq	$1, %rax
+ 209 0352 4839C7   		cmpq	%rax, %rdi
+ 210 0355 75E7     		jne	.L77
+ 211 0357 85F6     		testl	%esi, %esi
+ 212 0359 0F8E8502 		jle	.L82
+ 212      0000
+ 213 035f C5FD2894 		vmovapd	256(%rsp), %ymm2
+ 213      24000100 
+ 213      00
+ 214              	.L79:
+ 215 0368 31D2     		xorl	%edx, %edx
+ 216 036a 31C0     		xorl	%eax, %eax
+ 217 036c 4C8B6C24 		movq	104(%rsp), %r13
+ 217      68
+ 218 0371 894C2478 		movl	%ecx, 120(%rsp)
+ 219 0375 4C898C24 		movq	%r9, 192(%rsp)
+ 219      C0000000 
+ 220 037d 4D89C8   		movq	%r9, %r8
+ 221 0380 89D1     		movl	%edx, %ecx
+ 222 0382 4D89F9   		movq	%r15, %r9
+ 223 0385 4C8D9C24 		leaq	1216(%rsp), %r11
+ 223      C0040000 
+ 224 038d 4531F6   		xorl	%r14d, %r14d
+ 225 0390 4889C2   		movq	%rax, %rdx
+ 226 0393 4D89E7   		movq	%r12, %r15
+ 227 0396 662E0F1F 		.p2align 4,,10
+ 227      84000000 
+ 227      0000
+ 228              		.p2align 3
+ 229              	.L86:
+ 230 03a0 C4C16D59 		vmulpd	4928(%r8), %ymm2, %ymm0
+ 230      80401300 
+ 230      00
+ 231 03a9 4183C601 		addl	$1, %r14d
+ 232 03ad C4C17D58 		vaddpd	0(%r13), %ymm0, %ymm0
+ 232      4500
+ 233 03b3 C4C17D59 		vmulpd	5024(%r8), %ymm0, %ymm3
+ 233      98A01300 
+ 233      00
+ 234 03bc C4C16D59 		vmulpd	4960(%r8), %ymm2, %ymm1
+ 234      88601300 
+ 234      00
+ 235 03c5 C4C17558 		vaddpd	32(%r13), %ymm1, %ymm1
+ 235      4D20
+ 236 03cb C5F55CCB 		vsubpd	%ymm3, %ymm1, %ymm1
+ 237 03cf C4C17D59 		vmulpd	5056(%r8), %ymm0, %ymm3
+ 237      98C01300 
+ 237      00
+ 238 03d8 C4C17D29 		vmovapd	%ymm1, 0(%r13)
+ 238      4D00
+ 239 03de C4C16D59 		vmulpd	4992(%r8), %ymm2, %ymm1
+ 239      88801300 
+ 239      00
+ 240 03e7 C5F55CCB 		vsubpd	%ymm3, %ymm1, %ymm1
+ 241 03eb C4C17D59 		vmulpd	4960(%r8), %ymm0, %ymm3
+ 241      98601300 
+ 241      00
+ 242 03f4 C4C16558 		vaddpd	96(%r13), %ymm3, %ymm3
+ 242      5D60
+ 243 03fa C4C17D29 		vmovapd	%ymm1, 32(%r13)
+ 243      4D20
+ 244 0400 C4C17D59 		vmulpd	4928(%r8), %ymm0, %ymm1
+ 244      88401300 
+ 244      00
+ 245 0409 C4C17558 		vaddpd	64(%r13), %ymm1, %ymm1
+ 245      4D40
+ 246 040f C4417559 		vmulpd	5024(%r8), %ymm1, %ymm10
+ 246      90A01300 
+ 246      00
+ 247 0418 C4C17D59 		vmulpd	4992(%r8), %ymm0, %ymm0
+ 247      80801300 
+ 247      00
+ 248 0421 C5FD298C 		vmovapd	%ymm1, 288(%rsp)
+ 248      24200100 
+ 248      00
+ 249 042a C4C1655C 		vsubpd	%ymm10, %ymm3, %ymm3
+ 249      DA
+ 250 042f C4C17D29 		vmovapd	%ymm3, 64(%r13)
+ 250      5D40
+ 251 0435 C4C17559 		vmulpd	5056(%r8), %ymm1, %ymm3
+ 251      98C01300 
+ 251      00
+ 252 043e C5FD5CC3 		vsubpd	%ymm3, %ymm0, %ymm0
+ 253 0442 C4C16D59 		vmulpd	6080(%r8), %ymm2, %ymm3
+ 253      98C01700 
+ 253      00
+ 254 044b C4C16558 		vaddpd	32(%r11), %ymm3, %ymm3
+ 254      5B20
+ 255 0451 C4C17D29 		vmovapd	%ymm0, 96(%r13)
+ 255      4560
+ 256 0457 C4C16D59 		vmulpd	6048(%r8), %ymm2, %ymm0
+ 256      80A01700 
+ 256      00
+ 257 0460 C4C16D59 		vmulpd	6112(%r8), %ymm2, %ymm2
+ 257      90E01700 
+ 257      00
+ 258 0469 C4C17D58 		vaddpd	(%r11), %ymm0, %ymm0
+ 258      03
+ 259 046e C4417D59 		vmulpd	6144(%r8), %ymm0, %ymm10
+ 259      90001800 
+ 259      00
+ 260 0477 C4C1655C 		vsubpd	%ymm10, %ymm3, %ymm3
+ 260      DA
+ 261 047c C4C17D29 		vmovapd	%ymm3, (%r11)
+ 261      1B
+ 262 0481 C4C17D59 		vmulpd	6176(%r8), %ymm0, %ymm3
+ 262      98201800 
+ 262      00
+ 263 048a C5ED5CD3 		vsubpd	%ymm3, %ymm2, %ymm2
+ 264 048e C4C17D59 		vmulpd	6080(%r8), %ymm0, %ymm3
+ 264      98C01700 
+ 264      00
+ 265 0497 C4C16558 		vaddpd	96(%r11), %ymm3, %ymm3
+ 265      5B60
+ 266 049d C4C17D29 		vmovapd	%ymm2, 32(%r11)
+ 266      5320
+ 267 04a3 C4C17D59 		vmulpd	6048(%r8), %ymm0, %ymm2
+ 267      90A01700 
+ 267      00
+ 268 04ac C4C16D58 		vaddpd	64(%r11), %ymm2, %ymm2
+ 268      5340
+ 269 04b2 C4416D59 		vmulpd	6144(%r8), %ymm2, %ymm10
+ 269      90001800 
+ 269      00
+ 270 04bb C4C17D59 		vmulpd	6112(%r8), %ymm0, %ymm0
+ 270      80E01700 
+ 270      00
+ 271 04c4 C4C1655C 		vsubpd	%ymm10, %ymm3, %ymm3
+ 271      DA
+ 272 04c9 C4C17D29 		vmovapd	%ymm3, 64(%r11)
+ 272      5B40
+ 273 04cf C4C16D59 		vmulpd	6176(%r8), %ymm2, %ymm3
+ 273      98201800 
+ 273      00
+ 274 04d8 C5FD5CC3 		vsubpd	%ymm3, %ymm0, %ymm0
+ 275 04dc C4C17D29 		vmovapd	%ymm0, 96(%r11)
+ 275      4360
+ 276 04e2 4139F6   		cmpl	%esi, %r14d
+ 277 04e5 0F8D950E 		jge	.L83
+ 277      0000
+ 278 04eb C4C1797E 		vmovd	%xmm7, %r12d
+ 278      FC
+ 279 04f0 4889D7   		movq	%rdx, %rdi
+ 280 04f3 C461F97E 		vmovq	%xmm8, %rax
+ 280      C0
+ 281 04f8 4529F4   		subl	%r14d, %r12d
+ 282 04fb 48C1E706 		salq	$6, %rdi
+ 283 04ff 4901D4   		addq	%rdx, %r12
+ 284 0502 4801C7   		addq	%rax, %rdi
+ 285 0505 C4E1F97E 		vmovq	%xmm6, %rax
+ 285      F0
+ 286 050a 49C1E406 		salq	$6, %r12
+ 287 050e 4901C4   		addq	%rax, %r12
+ 288 0511 4C89C0   		movq	%r8, %rax
+ 289              		.p2align 4,,10
+ 290 0514 0F1F4000 		.p2align 3
+ 291              	.L84:
+ 292 0518 C5FD28C1 		vmovapd	%ymm1, %ymm0
+ 293 051c 4883C740 		addq	$64, %rdi
+ 294 0520 4805A000 		addq	$160, %rax
+ 294      0000
+ 295 0526 C5FD5998 		vmulpd	7200(%rax), %ymm0, %ymm3
+ 295      201C0000 
+ 296 052e C5F55988 		vmulpd	7168(%rax), %ymm1, %ymm1
+ 296      001C0000 
+ 297 0536 C565587F 		vaddpd	32(%rdi), %ymm3, %ymm15
+ 297      20
+ 298 053b C5FD5980 		vmulpd	7232(%rax), %ymm0, %ymm0
+ 298      401C0000 
+ 299 0543 C5F5580F 		vaddpd	(%rdi), %ymm1, %ymm1
+ 300 0547 C5F55998 		vmulpd	7264(%rax), %ymm1, %ymm3
+ 300      601C0000 
+ 301 054f C5855CDB 		vsubpd	%ymm3, %ymm15, %ymm3
+ 302 0553 C5FD291F 		vmovapd	%ymm3, (%rdi)
+ 303 0557 C5F55998 		vmulpd	7296(%rax), %ymm1, %ymm3
+ 303      801C0000 
+ 304 055f C5FD5CC3 		vsubpd	%ymm3, %ymm0, %ymm0
+ 305 0563 C5FD2947 		vmovapd	%ymm0, 32(%rdi)
+ 305      20
+ 306 0568 4C39E7   		cmpq	%r12, %rdi
+ 307 056b 75AB     		jne	.L84
+ 308 056d C5FD298C 		vmovapd	%ymm1, 288(%rsp)
+ 308      24200100 
+ 308      00
+ 309 0576 85DB     		testl	%ebx, %ebx
+ 310 0578 7E22     		jle	.L89
+ 311              	.L85:
+ 312 057a 4863C1   		movslq	%ecx, %rax
+ 313 057d 31FF     		xorl	%edi, %edi
+ 314 057f 4D8D24C1 		leaq	(%r9,%rax,8), %r12
+ 315              	.L88:
+ 316 0583 498B44FC 		movq	72(%r12,%rdi,8), %rax
+ 316      48
+ 317 0588 C4C15B5A 		vcvtsd2ss	(%r15,%rdi,8), %xmm4, %xmm0
+ 317      04FF
+ 318 058e 4883C701 		addq	$1, %rdi
+ 319 0592 C4A17A11 		vmovss	%xmm0, (%rax,%r10)
+ 319      0410
+ 320 0598 39FB     		cmpl	%edi, %ebx
+ 321 059a 7FE7     		jg	.L88
+ 322              	.L89:
+ 323 059c 4983ED80 		subq	$-128, %r13
+ 324 05a0 4983EB80 		subq	$-128, %r11
+ 325 05a4 01D9     		addl	%ebx, %ecx
+ 326 05a6 4883C208 		addq	$8, %rdx
+ 327 05aa 4981C0A0 		addq	$160, %r8
+ 327      000000
+ 328 05b1 4139F6   		cmpl	%esi, %r14d
+ 329 05b4 0F8CE6FD 		jl	.L86
+ 329      FFFF
+ 330 05ba 4D89FC   		movq	%r15, %r12
+ 331 05bd 8B4C2478 		movl	120(%rsp), %ecx
+ 332 05c1 4D89CF   		movq	%r9, %r15
+ 333 05c4 C5FD2994 		vmovapd	%ymm2, 256(%rsp)
+ 333      24000100 
+ 333      00
+ 334 05cd 4C8B8C24 		movq	192(%rsp), %r9
+ 334      C0000000 
+ 335 05d5 85DB     		testl	%ebx, %ebx
+ 336 05d7 7E30     		jle	.L90
+ 337 05d9 4863FB   		movslq	%ebx, %rdi
+ 338 05dc 488D9424 		leaq	256(%rsp), %rdx
+ 338      00010000 
+ 339              	.L82:
+ 340 05e4 31C0     		xorl	%eax, %eax
+ 341 05e6 C4C1F97E 		vmovq	%xmm5, %r11
+ 341      EB
+ 342              	.L91:
+ 343 05eb 4D8B44C3 		movq	72(%r11,%rax,8), %r8
+ 343      48
+ 344 05f0 C5DB5A0C 		vcvtsd2ss	(%rdx,%rax,8), %xmm4, %xmm1
+ 344      C2
+ 345 05f5 4883C001 		addq	$1, %rax
+ 346 05f9 C4817A11 		vmovss	%xmm1, (%r8,%r10)
+ 346      0C10
+ 347 05ff 4839C7   		cmpq	%rax, %rdi
+ 348 0602 75E7     		jne	.L91
+ 349 0604 C4C1F96E 		vmovq	%r11, %xmm5
+ 349      EB
+ 350              	.L90:
+ 351 0609 83C101   		addl	$1, %ecx
+ 352 060c 4983C204 		addq	$4, %r10
+ 353 0610 394C2470 		cmpl	%ecx, 112(%rsp)
+ 354 0614 0F8F06FD 		jg	.L80
+ 354      FFFF
+ 355 061a 85F6     		testl	%esi, %esi
+ 356 061c 0F8E3D01 		jle	.L155
+ 356      0000
+ 357 0622 488D8424 		leaq	1216(%rsp), %rax
+ 357      C0040000 
+ 358 062a 488D9C24 		leaq	384(%rsp), %rbx
+ 358      80010000 
+ 359 0632 4189F0   		movl	%esi, %r8d
+ 360 0635 48898424 		movq	%rax, 192(%rsp)
+ 360      C0000000 
+ 361 063d 488D8424 		leaq	320(%rsp), %rax
+ 361      40010000 
+ 362 0645 4C8D8C24 		leaq	2176(%rsp), %r9
+ 362      80080000 
+ 363 064d 48894424 		movq	%rax, 120(%rsp)
+ 363      78
+ 364 0652 488B8424 		movq	128(%rsp), %rax
+ 364      80000000 
+ 365 065a 4C8DBC24 		leaq	1280(%rsp), %r15
+ 365      00050000 
+ 366 0662 48895C24 		movq	%rbx, 112(%rsp)
+ 366      70
+ 367 0667 4C8D9840 		leaq	1856(%rax), %r11
+ 367      070000
+ 368 066e 8D46FE   		leal	-2(%rsi), %eax
+ 369              	.L75:
+ 370 0671 49C1E007 		salq	$7, %r8
+ 371 0675 41BE8000 		movl	$128, %r14d
+ 371      0000
+ 372 067b 89C3     		movl	%eax, %ebx
+ 373 067d 4D89CC   		movq	%r9, %r12
+ 374 0680 488BB424 		movq	128(%rsp), %rsi
+ 374      80000000 
+ 375 0688 4C894424 		movq	%r8, 104(%rsp)
+ 375      68
+ 376 068d 62F1FD48 		vmovdqa64	320(%rsp), %zmm7
+ 376      6F7C2405 
+ 377 0695 4989F5   		movq	%rsi, %r13
+ 378 0698 62F1FE48 		vmovdqu64	%zmm7, (%rsi)
+ 378      7F3E
+ 379 069e 62F1FD48 		vmovdqa64	384(%rsp), %zmm7
+ 379      6F7C2406 
+ 380 06a6 62F1FE48 		vmovdqu64	%zmm7, 64(%rsi)
+ 380      7F7E01
+ 381 06ad 62F1FD48 		vmovdqa64	1216(%rsp), %zmm7
+ 381      6F7C2413 
+ 382 06b5 62F1FE48 		vmovdqu64	%zmm7, 896(%rsi)
+ 382      7F7E0E
+ 383 06bc 62F1FD48 		vmovdqa64	1280(%rsp), %zmm7
+ 383      6F7C2414 
+ 384 06c4 62F1FE48 		vmovdqu64	%zmm7, 960(%rsi)
+ 384      7F7E0F
+ 385              	.L92:
+ 386 06cb 89DA     		movl	%ebx, %edx
+ 387 06cd 4C89E6   		movq	%r12, %rsi
+ 388 06d0 4C89DF   		movq	%r11, %rdi
+ 389 06d3 4883C201 		addq	$1, %rdx
+ 390 06d7 48C1E206 		salq	$6, %rdx
+ 391 06db C5F877   		vzeroupper
+ 392 06de E8000000 		call	memcpy@PLT
+ 392      00
+ 393 06e3 83EB01   		subl	$1, %ebx
+ 394 06e6 4981C400 		addq	$512, %r12
+ 394      020000
+ 395 06ed 4989C3   		movq	%rax, %r11
+ 396 06f0 488B4424 		movq	120(%rsp), %rax
+ 396      78
+ 397 06f5 4981C300 		addq	$512, %r11
+ 397      020000
+ 398 06fc 62B1FE48 		vmovdqu64	(%rax,%r14), %zmm7
+ 398      6F3C30
+ 399 0703 488B4424 		movq	112(%rsp), %rax
+ 399      70
+ 400 0708 6291FE48 		vmovdqu64	%zmm7, 0(%r13,%r14)
+ 400      7F7C3500 
+ 401 0710 62B1FE48 		vmovdqu64	(%rax,%r14), %zmm7
+ 401      6F3C30
+ 402 0717 488B8424 		movq	192(%rsp), %rax
+ 402      C0000000 
+ 403 071f 6291FE48 		vmovdqu64	%zmm7, 64(%r13,%r14)
+ 403      7F7C3501 
+ 404 0727 62B1FE48 		vmovdqu64	(%rax,%r14), %zmm7
+ 404      6F3C30
+ 405 072e 488B4424 		movq	104(%rsp), %rax
+ 405      68
+ 406 0733 6291FE48 		vmovdqu64	%zmm7, 896(%r13,%r14)
+ 406      7F7C350E 
+ 407 073b 62F1FD48 		vmovdqa64	%zmm7, 128(%rsp)
+ 407      7F7C2402 
+ 408 0743 6291FE48 		vmovdqu64	(%r15,%r14), %zmm7
+ 408      6F3C37
+ 409 074a 6291FE48 		vmovdqu64	%zmm7, 960(%r13,%r14)
+ 409      7F7C350F 
+ 410 0752 4983EE80 		subq	$-128, %r14
+ 411 0756 4939C6   		cmpq	%rax, %r14
+ 412 0759 0F856CFF 		jne	.L92
+ 412      FFFF
+ 413              	.L155:
+ 414 075f C5F877   		vzeroupper
+ 415              	.L156:
+ 416 0762 488D65D8 		leaq	-40(%rbp), %rsp
+ 417 0766 5B       		popq	%rbx
+ 418 0767 415C     		popq	%r12
+ 419 0769 415D     		popq	%r13
+ 420 076b 415E     		popq	%r14
+ 421 076d 415F     		popq	%r15
+ 422 076f 5D       		popq	%rbp
+ 423              		.cfi_remember_state
+ 424              		.cfi_def_cfa 7, 8
+ 425 0770 C3       		ret
+ 426              		.p2align 4,,10
+ 427 0771 0F1F8000 		.p2align 3
+ 427      000000
+ 428              	.L161:
+ 429              		.cfi_restore_state
+ 430 0778 4889F8   		movq	%rdi, %rax
+ 431 077b C5E957D2 		vxorpd	%xmm2, %xmm2, %xmm2
+ 432 077f 90       		.p2align 4,,10
+ 433              		.p2align 3
+ 434              	.L4:
+ 435 0780 C5FB1000 		vmovsd	(%rax), %xmm0
+ 436 0784 C5FB1048 		vmovsd	32(%rax), %xmm1
+ 436      20
+ 437 0789 4883C040 		addq	$64, %rax
+ 438 078d C5F954C3 		vandpd	%xmm3, %xmm0, %xmm0
+ 439 0791 C5F154CB 		vandpd	%xmm3, %xmm1, %xmm1
+ 440 0795 C5FB58C1 		vaddsd	%xmm1, %xmm0, %xmm0
+ 441 0799 C5EB58D0 		vaddsd	%xmm0, %xmm2, %xmm2
+ 442 079d 4839C2   		cmpq	%rax, %rdx
+ 443 07a0 75DE     		jne	.L4
+ 444 07a2 C5F92FD7 		vcomisd	%xmm7, %xmm2
+ 445 07a6 0F83C4F8 		jnb	.L3
+ 445      FFFF
+ 446 07ac 4889F8   		movq	%rdi, %rax
+ 447 07af 90       		.p2align 4,,10
+ 448              		.p2align 3
+ 449              	.L5:
+ 450 07b0 48C74020 		movq	$0x000000000, 32(%rax)
+ 450      00000000 
+ 451 07b8 4883C040 		addq	$64, %rax
+ 452 07bc 48C740C0 		movq	$0x000000000, -64(%rax)
+ 452      00000000 
+ 453 07c4 4839C2   		cmpq	%rax, %rdx
+ 454 07c7 75E7     		jne	.L5
+ 455 07c9 B8010000 		movl	$1, %eax
+ 455      00
+ 456 07ce C4E249F7 		shlx	%esi, %eax, %eax
+ 456      C0
+ 457 07d3 4109C0   		orl	%eax, %r8d
+ 458 07d6 E995F8FF 		jmp	.L3
+ 458      FF
+ 459              	.L138:
+ 460 07db 4183C101 		addl	$1, %r9d
+ 461 07df 4101DA   		addl	%ebx, %r10d
+ 462 07e2 4539D9   		cmpl	%r11d, %r9d
+ 463 07e5 0F85C3F8 		jne	.L11
+ 463      FFFF
+ 464 07eb E902F9FF 		jmp	.L14
+ 464      FF
+ 465              	.L22:
+ 466 07f0 488B8424 		movq	128(%rsp), %rax
+ 466      80000000 
+ 467 07f8 62F1FE48 		vmovdqu64	(%rax), %zmm7
+ 467      6F38
+ 468 07fe 488DB040 		leaq	1856(%rax), %rsi
+ 468      070000
+ 469 0805 62F1FD48 		vmovdqa64	%zmm7, 320(%rsp)
+ 469      7F7C2405 
+ 470 080d 62F1FE48 		vmovdqu64	64(%rax), %zmm7
+ 470      6F7801
+ 471 0814 62F1FD48 		vmovdqa64	%zmm7, 384(%rsp)
+ 471      7F7C2406 
+ 472 081c 62F1FE48 		vmovdqu64	896(%rax), %zmm7
+ 472      6F780E
+ 473 0823 62F1FD48 		vmovdqa64	%zmm7, 1216(%rsp)
+ 473      7F7C2413 
+ 474 082b 62F1FE48 		vmovdqu64	960(%rax), %zmm7
+ 474      6F780F
+ 475 0832 62F1FD48 		vmovdqa64	%zmm7, 1280(%rsp)
+ 475      7F7C2414 
+ 476 083a 62F1FE48 		vmovdqu64	1856(%rax), %zmm7
+ 476      6F781D
+ 477 0841 62F1FD48 		vmovdqa64	%zmm7, 2176(%rsp)
+ 477      7F7C2422 
+ 478 0849 62F1FE48 		vmovdqu64	64(%rsi), %zmm7
+ 478      6F7E01
+ 479 0850 62F1FD48 		vmovdqa64	%zmm7, 2240(%rsp)
+ 479      7F7C2423 
+ 480 0858 62F1FE48 		vmovdqu64	128(%rax), %zmm7
+ 480      6F7802
+ 481 085f 62F1FD48 		vmovdqa64	%zmm7, 448(%rsp)
+ 481      7F7C2407 
+ 482 0867 62F1FE48 		vmovdqu64	192(%rax), %zmm7
+ 482      6F7803
+ 483 086e 62F1FD48 		vmovdqa64	%zmm7, 512(%rsp)
+ 483      7F7C2408 
+ 484 0876 62F1FE48 		vmovdqu64	1024(%rax), %zmm7
+ 484      6F7810
+ 485 087d 62F1FD48 		vmovdqa64	%zmm7, 1344(%rsp)
+ 485      7F7C2415 
+ 486 0885 62F1FE48 		vmovdqu64	1088(%rax), %zmm7
+ 486      6F7811
+ 487 088c 62F1FD48 		vmovdqa64	%zmm7, 1408(%rsp)
+ 487      7F7C2416 
+ 488 0894 62F1FE48 		vmovdqu64	2368(%rax), %zmm7
+ 488      6F7825
+ 489 089b 62F1FD48 		vmovdqa64	%zmm7, 2688(%rsp)
+ 489      7F7C242A 
+ 490 08a3 62F1FE48 		vmovdqu64	256(%rax), %zmm7
+ 490      6F7804
+ 491 08aa 62F1FD48 		vmovdqa64	%zmm7, 576(%rsp)
+ 491      7F7C2409 
+ 492 08b2 62F1FE48 		vmovdqu64	320(%rax), %zmm7
+ 492      6F7805
+ 493 08b9 62F1FD48 		vmovdqa64	%zmm7, 640(%rsp)
+ 493      7F7C240A 
+ 494 08c1 62F1FE48 		vmovdqu64	1152(%rax), %zmm7
+ 494      6F7812
+ 495 08c8 62F1FD48 		vmovdqa64	%zmm7, 1472(%rsp)
+ 495      7F7C2417 
+ 496 08d0 62F1FE48 		vmovdqu64	1216(%rax), %zmm7
+ 496      6F7813
+ 497 08d7 62F1FD48 		vmovdqa64	%zmm7, 192(%rsp)
+ 497      7F7C2403 
+ 498 08df 62F1FD48 		vmovdqa64	%zmm7, 1536(%rsp)
+ 498      7F7C2418 
+ 499 08e7 85D2     		testl	%edx, %edx
+ 500 08e9 0F8E0809 		jle	.L60
+ 500      0000
+ 501 08ef 4863C2   		movslq	%edx, %rax
+ 502 08f2 C5F957C0 		vxorpd	%xmm0, %xmm0, %xmm0
+ 503 08f6 4531C9   		xorl	%r9d, %r9d
+ 504 08f9 488D1485 		leaq	0(,%rax,4), %rdx
+ 504      00000000 
+ 505 0901 8D045B   		leal	(%rbx,%rbx,2), %eax
+ 506 0904 C5FD2984 		vmovapd	%ymm0, 256(%rsp)
+ 506      24000100 
+ 506      00
+ 507 090d 4898     		cltq
+ 508 090f 498D04C4 		leaq	(%r12,%rax,8), %rax
+ 509 0913 85DB     		testl	%ebx, %ebx
+ 510 0915 0F8EB80B 		jle	.L102
+ 510      0000
+ 511 091b 488DBC24 		leaq	1216(%rsp), %rdi
+ 511      C0040000 
+ 512 0923 4863CB   		movslq	%ebx, %rcx
+ 513 0926 4C8D9424 		leaq	256(%rsp), %r10
+ 513      00010000 
+ 514 092e 4889BC24 		movq	%rdi, 192(%rsp)
+ 514      C0000000 
+ 515 0936 488DBC24 		leaq	2112(%rsp), %rdi
+ 515      40080000 
+ 516 093e 48897C24 		movq	%rdi, 112(%rsp)
+ 516      70
+ 517 0943 488DBC24 		leaq	320(%rsp), %rdi
+ 517      40010000 
+ 518 094b 48897C24 		movq	%rdi, 120(%rsp)
+ 518      78
+ 519              	.L67:
+ 520 0950 31FF     		xorl	%edi, %edi
+ 521              	.L52:
+ 522 0952 4D8B44FC 		movq	8(%r12,%rdi,8), %r8
+ 522      08
+ 523 0957 C4815A5A 		vcvtss2sd	(%r8,%r9), %xmm4, %xmm0
+ 523      0408
+ 524 095d C4C17B11 		vmovsd	%xmm0, (%r10,%rdi,8)
+ 524      04FA
+ 525 0963 4883C701 		addq	$1, %rdi
+ 526 0967 4839F9   		cmpq	%rdi, %rcx
+ 527 096a 75E6     		jne	.L52
+ 528 096c C5FD2894 		vmovapd	256(%rsp), %ymm2
+ 528      24000100 
+ 528      00
+ 529              	.L51:
+ 530 0975 48895424 		movq	%rdx, 104(%rsp)
+ 530      68
+ 531 097a 4989F2   		movq	%rsi, %r10
+ 532 097d 4C8DBC24 		leaq	288(%rsp), %r15
+ 532      20010000 
+ 533 0985 C461F96E 		vmovq	%rax, %xmm11
+ 533      D8
+ 534 098a 4C89FE   		movq	%r15, %rsi
+ 535              	.L53:
+ 536 098d 4C8B6C24 		movq	120(%rsp), %r13
+ 536      78
+ 537 0992 4C8B9C24 		movq	192(%rsp), %r11
+ 537      C0000000 
+ 538 099a 4531FF   		xorl	%r15d, %r15d
+ 539 099d 488B5424 		movq	112(%rsp), %rdx
+ 539      70
+ 540 09a2 4C8B8424 		movq	128(%rsp), %r8
+ 540      80000000 
+ 541 09aa 4489F8   		movl	%r15d, %eax
+ 542 09ad 4D89EE   		movq	%r13, %r14
+ 543 09b0 4D89DD   		movq	%r11, %r13
+ 544 09b3 4889D7   		movq	%rdx, %rdi
+ 545 09b6 662E0F1F 		.p2align 4,,10
+ 545      84000000 
+ 545      0000
+ 546              		.p2align 3
+ 547              	.L64:
+ 548 09c0 C4C16D59 		vmulpd	4928(%r8), %ymm2, %ymm0
+ 548      80401300 
+ 548      00
+ 549 09c9 4183C701 		addl	$1, %r15d
+ 550 09cd C4C16D59 		vmulpd	4960(%r8), %ymm2, %ymm1
+ 550      88601300 
+ 550      00
+ 551 09d6 C4C17D58 		vaddpd	(%r14), %ymm0, %ymm0
+ 551      06
+ 552 09db C4C17D59 		vmulpd	5024(%r8), %ymm0, %ymm3
+ 552      98A01300 
+ 552      00
+ 553 09e4 C4C17558 		vaddpd	32(%r14), %ymm1, %ymm1
+ 553      4E20
+ 554 09ea C5F55CCB 		vsubpd	%ymm3, %ymm1, %ymm1
+ 555 09ee C4C17D59 		vmulpd	5056(%r8), %ymm0, %ymm3
+ 555      98C01300 
+ 555      00
+ 556 09f7 C4C17D29 		vmovapd	%ymm1, (%r14)
+ 556      0E
+ 557 09fc C4C16D59 		vmulpd	4992(%r8), %ymm2, %ymm1
+ 557      88801300 
+ 557      00
+ 558 0a05 C5F55CCB 		vsubpd	%ymm3, %ymm1, %ymm1
+ 559 0a09 C4C17D59 		vmulpd	4960(%r8), %ymm0, %ymm3
+ 559      98601300 
+ 559      00
+ 560 0a12 C4C16558 		vaddpd	96(%r14), %ymm3, %ymm3
+ 560      5E60
+ 561 0a18 C4C17D29 		vmovapd	%ymm1, 32(%r14)
+ 561      4E20
+ 562 0a1e C4C17D59 		vmulpd	4928(%r8), %ymm0, %ymm1
+ 562      88401300 
+ 562      00
+ 563 0a27 C4C17558 		vaddpd	64(%r14), %ymm1, %ymm1
+ 563      4E40
+ 564 0a2d C4C17559 		vmulpd	5024(%r8), %ymm1, %ymm6
+ 564      B0A01300 
+ 564      00
+ 565 0a36 C4C17D59 		vmulpd	4992(%r8), %ymm0, %ymm0
+ 565      80801300 
+ 565      00
+ 566 0a3f C5FD298C 		vmovapd	%ymm1, 288(%rsp)
+ 566      24200100 
+ 566      00
+ 567 0a48 C5E55CDE 		vsubpd	%ymm6, %ymm3, %ymm3
+ 568 0a4c C4C17D29 		vmovapd	%ymm3, 64(%r14)
+ 568      5E40
+ 569 0a52 C4C17559 		vmulpd	5056(%r8), %ymm1, %ymm3
+ 569      98C01300 
+ 569      00
+ 570 0a5b C5FD5CC3 		vsubpd	%ymm3, %ymm0, %ymm0
+ 571 0a5f C4C16D59 		vmulpd	6080(%r8), %ymm2, %ymm3
+ 571      98C01700 
+ 571      00
+ 572 0a68 C4C16558 		vaddpd	32(%r13), %ymm3, %ymm3
+ 572      5D20
+ 573 0a6e C4C17D29 		vmovapd	%ymm0, 96(%r14)
+ 573      4660
+ 574 0a74 C4C16D59 		vmulpd	6048(%r8), %ymm2, %ymm0
+ 574      80A01700 
+ 574      00
+ 575 0a7d C4C17D58 		vaddpd	0(%r13), %ymm0, %ymm0
+ 575      4500
+ 576 0a83 C4C17D59 		vmulpd	6144(%r8), %ymm0, %ymm6
+ 576      B0001800 
+ 576      00
+ 577 0a8c C4C16D59 		vmulpd	6112(%r8), %ymm2, %ymm2
+ 577      90E01700 
+ 577      00
+ 578 0a95 C5E55CDE 		vsubpd	%ymm6, %ymm3, %ymm3
+ 579 0a99 C4C17D29 		vmovapd	%ymm3, 0(%r13)
+ 579      5D00
+ 580 0a9f C4C17D59 		vmulpd	6176(%r8), %ymm0, %ymm3
+ 580      98201800 
+ 580      00
+ 581 0aa8 C5ED5CD3 		vsubpd	%ymm3, %ymm2, %ymm2
+ 582 0aac C4C17D59 		vmulpd	6080(%r8), %ymm0, %ymm3
+ 582      98C01700 
+ 582      00
+ 583 0ab5 C4C16558 		vaddpd	96(%r13), %ymm3, %ymm3
+ 583      5D60
+ 584 0abb C4C17D29 		vmovapd	%ymm2, 32(%r13)
+ 584      5520
+ 585 0ac1 C4C17D59 		vmulpd	6048(%r8), %ymm0, %ymm2
+ 585      90A01700 
+ 585      00
+ 586 0aca C4C16D58 		vaddpd	64(%r13), %ymm2, %ymm2
+ 586      5540
+ 587 0ad0 C4C16D59 		vmulpd	6144(%r8), %ymm2, %ymm6
+ 587      B0001800 
+ 587      00
+ 588 0ad9 C4C17D59 		vmulpd	6112(%r8), %ymm0, %ymm0
+ 588      80E01700 
+ 588      00
+ 589 0ae2 C5E55CDE 		vsubpd	%ymm6, %ymm3, %ymm3
+ 590 0ae6 C4C17D29 		vmovapd	%ymm3, 64(%r13)
+ 590      5D40
+ 591 0aec C4C16D59 		vmulpd	6176(%r8), %ymm2, %ymm3
+ 591      98201800 
+ 591      00
+ 592 0af5 C5FD5CC3 		vsubpd	%ymm3, %ymm0, %ymm0
+ 593 0af9 C4C17D29 		vmovapd	%ymm0, 96(%r13)
+ 593      4560
+ 594 0aff 4183FF03 		cmpl	$3, %r15d
+ 595 0b03 0F849708 		je	.L54
+ 595      0000
+ 596 0b09 4C89C1   		movq	%r8, %rcx
+ 597 0b0c 4889FA   		movq	%rdi, %rdx
+ 598 0b0f 4589FB   		movl	%r15d, %r11d
+ 599 0b12 EB0A     		jmp	.L55
+ 600              		.p2align 4,,10
+ 601 0b14 0F1F4000 		.p2align 3
+ 602              	.L103:
+ 603 0b18 41BB0200 		movl	$2, %r11d
+ 603      0000
+ 604              	.L55:
+ 605 0b1e C5FD28C1 		vmovapd	%ymm1, %ymm0
+ 606 0b22 4883C240 		addq	$64, %rdx
+ 607 0b26 4881C1A0 		addq	$160, %rcx
+ 607      000000
+ 608 0b2d C5F55989 		vmulpd	7168(%rcx), %ymm1, %ymm1
+ 608      001C0000 
+ 609 0b35 C5FD59B9 		vmulpd	7200(%rcx), %ymm0, %ymm7
+ 609      201C0000 
+ 610 0b3d C5F5580A 		vaddpd	(%rdx), %ymm1, %ymm1
+ 611 0b41 C5F55999 		vmulpd	7264(%rcx), %ymm1, %ymm3
+ 611      601C0000 
+ 612 0b49 C5C55872 		vaddpd	32(%rdx), %ymm7, %ymm6
+ 612      20
+ 613 0b4e C5FD5981 		vmulpd	7232(%rcx), %ymm0, %ymm0
+ 613      401C0000 
+ 614 0b56 C5CD5CFB 		vsubpd	%ymm3, %ymm6, %ymm7
+ 615 0b5a C5F559B1 		vmulpd	7296(%rcx), %ymm1, %ymm6
+ 615      801C0000 
+ 616 0b62 C5FD293A 		vmovapd	%ymm7, (%rdx)
+ 617 0b66 C5FD5CC6 		vsubpd	%ymm6, %ymm0, %ymm0
+ 618 0b6a C5FD2942 		vmovapd	%ymm0, 32(%rdx)
+ 618      20
+ 619 0b6f 4183FB01 		cmpl	$1, %r11d
+ 620 0b73 74A3     		je	.L103
+ 621 0b75 85DB     		testl	%ebx, %ebx
+ 622 0b77 0F8EE307 		jle	.L61
+ 622      0000
+ 623 0b7d C5FD298C 		vmovapd	%ymm1, 288(%rsp)
+ 623      24200100 
+ 623      00
+ 624              	.L62:
+ 625 0b86 4863D0   		movslq	%eax, %rdx
+ 626 0b89 31C9     		xorl	%ecx, %ecx
+ 627 0b8b 4D8D1CD4 		leaq	(%r12,%rdx,8), %r11
+ 628              	.L58:
+ 629 0b8f 498B54CB 		movq	72(%r11,%rcx,8), %rdx
+ 629      48
+ 630 0b94 C5DB5A04 		vcvtsd2ss	(%rsi,%rcx,8), %xmm4, %xmm0
+ 630      CE
+ 631 0b99 4883C101 		addq	$1, %rcx
+ 632 0b9d C4A17A11 		vmovss	%xmm0, (%rdx,%r9)
+ 632      040A
+ 633 0ba3 39CB     		cmpl	%ecx, %ebx
+ 634 0ba5 7FE8     		jg	.L58
+ 635 0ba7 4983EE80 		subq	$-128, %r14
+ 636 0bab 4981C0A0 		addq	$160, %r8
+ 636      000000
+ 637 0bb2 4983ED80 		subq	$-128, %r13
+ 638 0bb6 01D8     		addl	%ebx, %eax
+ 639 0bb8 4881C700 		addq	$512, %rdi
+ 639      020000
+ 640 0bbf 4183FF03 		cmpl	$3, %r15d
+ 641 0bc3 0F85F7FD 		jne	.L64
+ 641      FFFF
+ 642 0bc9 85DB     		testl	%ebx, %ebx
+ 643 0bcb 0F8ED707 		jle	.L159
+ 643      0000
+ 644 0bd1 488B5424 		movq	104(%rsp), %rdx
+ 644      68
+ 645 0bd6 4C89D6   		movq	%r10, %rsi
+ 646 0bd9 C461F97E 		vmovq	%xmm11, %rax
+ 646      D8
+ 647 0bde 31FF     		xorl	%edi, %edi
+ 648 0be0 C5FD2994 		vmovapd	%ymm2, 256(%rsp)
+ 648      24000100 
+ 648      00
+ 649 0be9 4863CB   		movslq	%ebx, %rcx
+ 650 0bec 4C8D9424 		leaq	256(%rsp), %r10
+ 650      00010000 
+ 651              	.L68:
+ 652 0bf4 4C8B44F8 		movq	72(%rax,%rdi,8), %r8
+ 652      48
+ 653 0bf9 C4C15B5A 		vcvtsd2ss	(%r10,%rdi,8), %xmm4, %xmm0
+ 653      04FA
+ 654 0bff 4883C701 		addq	$1, %rdi
+ 655 0c03 C4817A11 		vmovss	%xmm0, (%r8,%r9)
+ 655      0408
+ 656 0c09 4839F9   		cmpq	%rdi, %rcx
+ 657 0c0c 75E6     		jne	.L68
+ 658 0c0e 4983C104 		addq	$4, %r9
+ 659 0c12 4C39CA   		cmpq	%r9, %rdx
+ 660 0c15 0F84DC05 		je	.L60
+ 660      0000
+ 661 0c1b C5F957C0 		vxorpd	%xmm0, %xmm0, %xmm0
+ 662 0c1f C5FD2984 		vmovapd	%ymm0, 256(%rsp)
+ 662      24000100 
+ 662      00
+ 663 0c28 E923FDFF 		jmp	.L67
+ 663      FF
+ 664              	.L2:
+ 665 0c2d 488B8424 		movq	128(%rsp), %rax
+ 665      80000000 
+ 666 0c35 4531C0   		xorl	%r8d, %r8d
+ 667 0c38 8BB0A823 		movl	9128(%rax), %esi
+ 667      0000
+ 668 0c3e 31C0     		xorl	%eax, %eax
+ 669 0c40 85F6     		testl	%esi, %esi
+ 670 0c42 0F895CF4 		jns	.L8
+ 670      FFFF
+ 671              	.L9:
+ 672 0c48 418B8424 		movl	160(%r12), %eax
+ 672      A0000000 
+ 673 0c50 31DB     		xorl	%ebx, %ebx
+ 674 0c52 85C0     		testl	%eax, %eax
+ 675 0c54 0F8E08FB 		jle	.L156
+ 675      FFFF
+ 676 0c5a 660F1F44 		.p2align 4,,10
+ 676      0000
+ 677              		.p2align 3
+ 678              	.L17:
+ 679 0c60 49639424 		movslq	164(%r12), %rdx
+ 679      A4000000 
+ 680 0c68 498B7CDC 		movq	72(%r12,%rbx,8), %rdi
+ 680      48
+ 681 0c6d 31F6     		xorl	%esi, %esi
+ 682 0c6f 4883C301 		addq	$1, %rbx
+ 683 0c73 48C1E202 		salq	$2, %rdx
+ 684 0c77 E8000000 		call	memset@PLT
+ 684      00
+ 685 0c7c 41399C24 		cmpl	%ebx, 160(%r12)
+ 685      A0000000 
+ 686 0c84 7FDA     		jg	.L17
+ 687 0c86 E9D7FAFF 		jmp	.L156
+ 687      FF
+ 688              	.L100:
+ 689 0c8b 488BBC24 		movq	128(%rsp), %rdi
+ 689      80000000 
+ 690 0c93 4531DB   		xorl	%r11d, %r11d
+ 691 0c96 EB16     		jmp	.L21
+ 692              	.L32:
+ 693 0c98 C5FD28B7 		vmovapd	1856(%rdi), %ymm6
+ 693      40070000 
+ 694 0ca0 41BB0100 		movl	$1, %r11d
+ 694      0000
+ 695 0ca6 C5FD28AF 		vmovapd	1888(%rdi), %ymm5
+ 695      60070000 
+ 696              	.L21:
+ 697 0cae 4963CB   		movslq	%r11d, %rcx
+ 698 0cb1 4889C8   		movq	%rcx, %rax
+ 699 0cb4 48C1E007 		salq	$7, %rax
+ 700 0cb8 488D3407 		leaq	(%rdi,%rax), %rsi
+ 701 0cbc 62F1FE48 		vmovdqu64	(%rsi), %zmm7
+ 701      6F3E
+ 702 0cc2 62F1FD48 		vmovdqa64	%zmm7, 1216(%rsp,%rax)
+ 702      7F7C0413 
+ 703 0cca 62F1FE48 		vmovdqu64	64(%rsi), %zmm7
+ 703      6F7E01
+ 704 0cd1 62F1FD48 		vmovdqa64	%zmm7, 1280(%rsp,%rax)
+ 704      7F7C0414 
+ 705 0cd9 62F1FE48 		vmovdqu64	896(%rax,%rdi), %zmm7
+ 705      6F7C380E 
+ 706 0ce1 62F1FD48 		vmovdqa64	%zmm7, 2112(%rsp,%rax)
+ 706      7F7C0421 
+ 707 0ce9 62F1FE48 		vmovdqu64	960(%rsi), %zmm7
+ 707      6F7E0F
+ 708 0cf0 62F1FD48 		vmovdqa64	%zmm7, 2176(%rsp,%rax)
+ 708      7F7C0422 
+ 709 0cf8 4585DB   		testl	%r11d, %r11d
+ 710 0cfb 749B     		je	.L32
+ 711 0cfd 85D2     		testl	%edx, %edx
+ 712 0cff 0F8E0D07 		jle	.L31
+ 712      0000
+ 713 0d05 4863C2   		movslq	%edx, %rax
+ 714 0d08 4531C0   		xorl	%r8d, %r8d
+ 715 0d0b C4413957 		vxorpd	%xmm8, %xmm8, %xmm8
+ 715      C0
+ 716 0d10 4C63CB   		movslq	%ebx, %r9
+ 717 0d13 488BB424 		movq	128(%rsp), %rsi
+ 717      80000000 
+ 718 0d1b 4C8D3C85 		leaq	0(,%rax,4), %r15
+ 718      00000000 
+ 719 0d23 8D041B   		leal	(%rbx,%rbx), %eax
+ 720 0d26 4898     		cltq
+ 721 0d28 488D8C24 		leaq	1216(%rsp), %rcx
+ 721      C0040000 
+ 722 0d30 488DBC24 		leaq	320(%rsp), %rdi
+ 722      40010000 
+ 723 0d38 498D14C4 		leaq	(%r12,%rax,8), %rdx
+ 724 0d3c 48898C24 		movq	%rcx, 192(%rsp)
+ 724      C0000000 
+ 725 0d44 488D8640 		leaq	4928(%rsi), %rax
+ 725      130000
+ 726 0d4b 4989FE   		movq	%rdi, %r14
+ 727 0d4e 488D8C24 		leaq	2112(%rsp), %rcx
+ 727      40080000 
+ 728 0d56 48894424 		movq	%rax, 104(%rsp)
+ 728      68
+ 729 0d5b 4989D5   		movq	%rdx, %r13
+ 730 0d5e 4889F0   		movq	%rsi, %rax
+ 731 0d61 48894C24 		movq	%rcx, 112(%rsp)
+ 731      70
+ 732 0d66 4489DA   		movl	%r11d, %edx
+ 733 0d69 4C89F9   		movq	%r15, %rcx
+ 734              	.L44:
+ 735 0d6c C57D2984 		vmovapd	%ymm8, 288(%rsp)
+ 735      24200100 
+ 735      00
+ 736 0d75 85DB     		testl	%ebx, %ebx
+ 737 0d77 0F8E3B07 		jle	.L101
+ 737      0000
+ 738 0d7d 31F6     		xorl	%esi, %esi
+ 739 0d7f 4C8D9424 		leaq	288(%rsp), %r10
+ 739      20010000 
+ 740              	.L35:
+ 741 0d87 498B7CF4 		movq	8(%r12,%rsi,8), %rdi
+ 741      08
+ 742 0d8c C4A15A5A 		vcvtss2sd	(%rdi,%r8), %xmm4, %xmm0
+ 742      0407
+ 743 0d92 C4C17B11 		vmovsd	%xmm0, (%r10,%rsi,8)
+ 743      04F2
+ 744 0d98 4883C601 		addq	$1, %rsi
+ 745 0d9c 4939F1   		cmpq	%rsi, %r9
+ 746 0d9f 75E6     		jne	.L35
+ 747 0da1 48894C24 		movq	%rcx, 120(%rsp)
+ 747      78
+ 748 0da6 C4C1F96E 		vmovq	%r12, %xmm7
+ 748      FC
+ 749 0dab 4189D4   		movl	%edx, %r12d
+ 750 0dae C5FD288C 		vmovapd	288(%rsp), %ymm1
+ 750      24200100 
+ 750      00
+ 751 0db7 C441F96E 		vmovq	%r13, %xmm14
+ 751      F5
+ 752              	.L42:
+ 753 0dbc 488B7C24 		movq	104(%rsp), %rdi
+ 753      68
+ 754 0dc1 4C8B5424 		movq	112(%rsp), %r10
+ 754      70
+ 755 0dc6 31D2     		xorl	%edx, %edx
+ 756 0dc8 4531FF   		xorl	%r15d, %r15d
+ 757 0dcb 4C8B9C24 		movq	192(%rsp), %r11
+ 757      C0000000 
+ 758 0dd3 C441796F 		vmovdqa	%xmm14, %xmm10
+ 758      D6
+ 759 0dd8 0F1F8400 		.p2align 4,,10
+ 759      00000000 
+ 760              		.p2align 3
+ 761              	.L39:
+ 762 0de0 C5F55917 		vmulpd	(%rdi), %ymm1, %ymm2
+ 763 0de4 418D7701 		leal	1(%r15), %esi
+ 764 0de8 C4C16D58 		vaddpd	(%r11), %ymm2, %ymm2
+ 764      13
+ 765 0ded C5ED595F 		vmulpd	96(%rdi), %ymm2, %ymm3
+ 765      60
+ 766 0df2 C5F55947 		vmulpd	32(%rdi), %ymm1, %ymm0
+ 766      20
+ 767 0df7 C4C17D58 		vaddpd	32(%r11), %ymm0, %ymm0
+ 767      4320
+ 768 0dfd C5FD5CC3 		vsubpd	%ymm3, %ymm0, %ymm0
+ 769 0e01 C5ED599F 		vmulpd	128(%rdi), %ymm2, %ymm3
+ 769      80000000 
+ 770 0e09 C4C17D29 		vmovapd	%ymm0, (%r11)
+ 770      03
+ 771 0e0e C5F55947 		vmulpd	64(%rdi), %ymm1, %ymm0
+ 771      40
+ 772 0e13 C5FD5CC3 		vsubpd	%ymm3, %ymm0, %ymm0
+ 773 0e17 C5ED595F 		vmulpd	32(%rdi), %ymm2, %ymm3
+ 773      20
+ 774 0e1c C4C16558 		vaddpd	96(%r11), %ymm3, %ymm3
+ 774      5B60
+ 775 0e22 C4C17D29 		vmovapd	%ymm0, 32(%r11)
+ 775      4320
+ 776 0e28 C5ED5907 		vmulpd	(%rdi), %ymm2, %ymm0
+ 777 0e2c C4C17D58 		vaddpd	64(%r11), %ymm0, %ymm0
+ 777      4340
+ 778 0e32 C57D594F 		vmulpd	96(%rdi), %ymm0, %ymm9
+ 778      60
+ 779 0e37 C5ED5957 		vmulpd	64(%rdi), %ymm2, %ymm2
+ 779      40
+ 780 0e3c C5FD2984 		vmovapd	%ymm0, 320(%rsp)
+ 780      24400100 
+ 780      00
+ 781 0e45 C4C1655C 		vsubpd	%ymm9, %ymm3, %ymm3
+ 781      D9
+ 782 0e4a C4C17D29 		vmovapd	%ymm3, 64(%r11)
+ 782      5B40
+ 783 0e50 C5FD599F 		vmulpd	128(%rdi), %ymm0, %ymm3
+ 783      80000000 
+ 784 0e58 C5ED5CD3 		vsubpd	%ymm3, %ymm2, %ymm2
+ 785 0e5c C5F5599F 		vmulpd	1152(%rdi), %ymm1, %ymm3
+ 785      80040000 
+ 786 0e64 C4C16558 		vaddpd	32(%r10), %ymm3, %ymm3
+ 786      5A20
+ 787 0e6a C4C17D29 		vmovapd	%ymm2, 96(%r11)
+ 787      5360
+ 788 0e70 C5F55997 		vmulpd	1120(%rdi), %ymm1, %ymm2
+ 788      60040000 
+ 789 0e78 C5F5598F 		vmulpd	1184(%rdi), %ymm1, %ymm1
+ 789      A0040000 
+ 790 0e80 C4C16D58 		vaddpd	(%r10), %ymm2, %ymm2
+ 790      12
+ 791 0e85 C56D598F 		vmulpd	1216(%rdi), %ymm2, %ymm9
+ 791      C0040000 
+ 792 0e8d C4C1655C 		vsubpd	%ymm9, %ymm3, %ymm3
+ 792      D9
+ 793 0e92 C4C17D29 		vmovapd	%ymm3, (%r10)
+ 793      1A
+ 794 0e97 C5ED599F 		vmulpd	1248(%rdi), %ymm2, %ymm3
+ 794      E0040000 
+ 795 0e9f C5F55CCB 		vsubpd	%ymm3, %ymm1, %ymm1
+ 796 0ea3 C5ED599F 		vmulpd	1152(%rdi), %ymm2, %ymm3
+ 796      80040000 
+ 797 0eab C4C16558 		vaddpd	96(%r10), %ymm3, %ymm3
+ 797      5A60
+ 798 0eb1 C4C17D29 		vmovapd	%ymm1, 32(%r10)
+ 798      4A20
+ 799 0eb7 C5ED598F 		vmulpd	1120(%rdi), %ymm2, %ymm1
+ 799      60040000 
+ 800 0ebf C4C17558 		vaddpd	64(%r10), %ymm1, %ymm1
+ 800      4A40
+ 801 0ec5 C575598F 		vmulpd	1216(%rdi), %ymm1, %ymm9
+ 801      C0040000 
+ 802 0ecd C5ED5997 		vmulpd	1184(%rdi), %ymm2, %ymm2
+ 802      A0040000 
+ 803 0ed5 C4C1655C 		vsubpd	%ymm9, %ymm3, %ymm3
+ 803      D9
+ 804 0eda C4C17D29 		vmovapd	%ymm3, 64(%r10)
+ 804      5A40
+ 805 0ee0 C5F5599F 		vmulpd	1248(%rdi), %ymm1, %ymm3
+ 805      E0040000 
+ 806 0ee8 C5ED5CD3 		vsubpd	%ymm3, %ymm2, %ymm2
+ 807 0eec C4C17D29 		vmovapd	%ymm2, 96(%r10)
+ 807      5260
+ 808 0ef2 4585FF   		testl	%r15d, %r15d
+ 809 0ef5 7541     		jne	.L36
+ 810 0ef7 C5FD5990 		vmulpd	7328(%rax), %ymm0, %ymm2
+ 810      A01C0000 
+ 811 0eff C5FD5998 		vmulpd	7360(%rax), %ymm0, %ymm3
+ 811      C01C0000 
+ 812 0f07 C5FD5980 		vmulpd	7392(%rax), %ymm0, %ymm0
+ 812      E01C0000 
+ 813 0f0f C5ED58D6 		vaddpd	%ymm6, %ymm2, %ymm2
+ 814 0f13 C5ED59B0 		vmulpd	7424(%rax), %ymm2, %ymm6
+ 814      001D0000 
+ 815 0f1b C5E558ED 		vaddpd	%ymm5, %ymm3, %ymm5
+ 816 0f1f C5FD2994 		vmovapd	%ymm2, 320(%rsp)
+ 816      24400100 
+ 816      00
+ 817 0f28 C5D55CF6 		vsubpd	%ymm6, %ymm5, %ymm6
+ 818 0f2c C5ED59A8 		vmulpd	7456(%rax), %ymm2, %ymm5
+ 818      201D0000 
+ 819 0f34 C5FD5CED 		vsubpd	%ymm5, %ymm0, %ymm5
+ 820              	.L36:
+ 821 0f38 85DB     		testl	%ebx, %ebx
+ 822 0f3a 0F8EB803 		jle	.L163
+ 822      0000
+ 823 0f40 4863CA   		movslq	%edx, %rcx
+ 824 0f43 C4C1F97E 		vmovq	%xmm7, %r15
+ 824      FF
+ 825 0f48 4D8D2CCF 		leaq	(%r15,%rcx,8), %r13
+ 826 0f4c 31C9     		xorl	%ecx, %ecx
+ 827              	.L40:
+ 828 0f4e 4D8B7CCD 		movq	72(%r13,%rcx,8), %r15
+ 828      48
+ 829 0f53 C4C15B5A 		vcvtsd2ss	(%r14,%rcx,8), %xmm4, %xmm0
+ 829      04CE
+ 830 0f59 4883C101 		addq	$1, %rcx
+ 831 0f5d C4817A11 		vmovss	%xmm0, (%r15,%r8)
+ 831      0407
+ 832 0f63 4939C9   		cmpq	%rcx, %r9
+ 833 0f66 75E6     		jne	.L40
+ 834 0f68 4983EB80 		subq	$-128, %r11
+ 835 0f6c 4881C7A0 		addq	$160, %rdi
+ 835      000000
+ 836 0f73 4983EA80 		subq	$-128, %r10
+ 837 0f77 01DA     		addl	%ebx, %edx
+ 838 0f79 83FE02   		cmpl	$2, %esi
+ 839 0f7c 0F843E04 		je	.L164
+ 839      0000
+ 840              	.L96:
+ 841 0f82 4589E7   		movl	%r12d, %r15d
+ 842 0f85 E956FEFF 		jmp	.L39
+ 842      FF
+ 843              	.L162:
+ 844 0f8a 488B8424 		movq	128(%rsp), %rax
+ 844      80000000 
+ 845 0f92 C5FD2830 		vmovapd	(%rax), %ymm6
+ 846 0f96 C57D2870 		vmovapd	32(%rax), %ymm14
+ 846      20
+ 847 0f9b C5FD2868 		vmovapd	64(%rax), %ymm5
+ 847      40
+ 848 0fa0 C57D2848 		vmovapd	96(%rax), %ymm9
+ 848      60
+ 849 0fa5 C5FD2898 		vmovapd	896(%rax), %ymm3
+ 849      80030000 
+ 850 0fad C57D2898 		vmovapd	928(%rax), %ymm11
+ 850      A0030000 
+ 851 0fb5 6261FD28 		vmovapd	960(%rax), %ymm25
+ 851      28481E
+ 852 0fbc C5FD28B8 		vmovapd	992(%rax), %ymm7
+ 852      E0030000 
+ 853 0fc4 85D2     		testl	%edx, %edx
+ 854 0fc6 0F8EDC01 		jle	.L24
+ 854      0000
+ 855 0fcc 4863FA   		movslq	%edx, %rdi
+ 856 0fcf 31C9     		xorl	%ecx, %ecx
+ 857 0fd1 C4410157 		vxorpd	%xmm15, %xmm15, %xmm15
+ 857      FF
+ 858 0fd6 4863F3   		movslq	%ebx, %rsi
+ 859 0fd9 C57D28A8 		vmovapd	4928(%rax), %ymm13
+ 859      40130000 
+ 860 0fe1 48C1E702 		salq	$2, %rdi
+ 861 0fe5 62E1FD28 		vmovapd	4960(%rax), %ymm23
+ 861      28B86013 
+ 861      0000
+ 862 0fef 4C8D8C24 		leaq	1216(%rsp), %r9
+ 862      C0040000 
+ 863 0ff7 62E1FD28 		vmovapd	5024(%rax), %ymm22
+ 863      28B0A013 
+ 863      0000
+ 864 1001 62E1FD28 		vmovapd	4992(%rax), %ymm21
+ 864      28A88013 
+ 864      0000
+ 865 100b 4C8D8424 		leaq	2112(%rsp), %r8
+ 865      40080000 
+ 866 1013 62E1FD28 		vmovapd	5056(%rax), %ymm20
+ 866      28A0C013 
+ 866      0000
+ 867 101d C57D28A0 		vmovapd	6048(%rax), %ymm12
+ 867      A0170000 
+ 868 1025 62E1FD28 		vmovapd	6080(%rax), %ymm19
+ 868      2898C017 
+ 868      0000
+ 869 102f 62E1FD28 		vmovapd	6144(%rax), %ymm18
+ 869      28900018 
+ 869      0000
+ 870 1039 62E1FD28 		vmovapd	6112(%rax), %ymm17
+ 870      2888E017 
+ 870      0000
+ 871 1043 62E1FD28 		vmovapd	6176(%rax), %ymm16
+ 871      28802018 
+ 871      0000
+ 872 104d 0F1F00   		.p2align 4,,10
+ 873              		.p2align 3
+ 874              	.L29:
+ 875 1050 C57D29BC 		vmovapd	%ymm15, 1216(%rsp)
+ 875      24C00400 
+ 875      00
+ 876 1059 85DB     		testl	%ebx, %ebx
+ 877 105b 0F8ECF02 		jle	.L25
+ 877      0000
+ 878 1061 31C0     		xorl	%eax, %eax
+ 879              		.p2align 4,,10
+ 880 1063 0F1F4400 		.p2align 3
+ 880      00
+ 881              	.L26:
+ 882 1068 498B54C4 		movq	8(%r12,%rax,8), %rdx
+ 882      08
+ 883 106d C5DA5A04 		vcvtss2sd	(%rdx,%rcx), %xmm4, %xmm0
+ 883      0A
+ 884 1072 C4C17B11 		vmovsd	%xmm0, (%r9,%rax,8)
+ 884      04C1
+ 885 1078 4883C001 		addq	$1, %rax
+ 886 107c 4839C6   		cmpq	%rax, %rsi
+ 887 107f 75E7     		jne	.L26
+ 888 1081 6261FD28 		vmovapd	1216(%rsp), %ymm24
+ 888      28442426 
+ 889 1089 31C0     		xorl	%eax, %eax
+ 890 108b 62119528 		vmulpd	%ymm24, %ymm13, %ymm8
+ 890      59C0
+ 891 1091 62919D28 		vmulpd	%ymm24, %ymm12, %ymm1
+ 891      59C8
+ 892 1097 C53D58C6 		vaddpd	%ymm6, %ymm8, %ymm8
+ 893 109b C5F558CB 		vaddpd	%ymm3, %ymm1, %ymm1
+ 894 109f C4411559 		vmulpd	%ymm8, %ymm13, %ymm10
+ 894      D0
+ 895 10a4 C59D59D1 		vmulpd	%ymm1, %ymm12, %ymm2
+ 896 10a8 C52D58D5 		vaddpd	%ymm5, %ymm10, %ymm10
+ 897 10ac 6291ED28 		vaddpd	%ymm25, %ymm2, %ymm2
+ 897      58D1
+ 898 10b2 C57D2994 		vmovapd	%ymm10, 2112(%rsp)
+ 898      24400800 
+ 898      00
+ 899 10bb C5FD2994 		vmovapd	%ymm2, 1216(%rsp)
+ 899      24C00400 
+ 899      00
+ 900              	.L27:
+ 901 10c4 498B54C4 		movq	72(%r12,%rax,8), %rdx
+ 901      48
+ 902 10c9 C4C15B5A 		vcvtsd2ss	(%r8,%rax,8), %xmm4, %xmm0
+ 902      04C0
+ 903 10cf C5FA1104 		vmovss	%xmm0, (%rdx,%rcx)
+ 903      0A
+ 904 10d4 4889C2   		movq	%rax, %rdx
+ 905 10d7 488D4001 		leaq	1(%rax), %rax
+ 906 10db 4839C6   		cmpq	%rax, %rsi
+ 907 10de 75E4     		jne	.L27
+ 908 10e0 31C0     		xorl	%eax, %eax
+ 909 10e2 4D8D14F4 		leaq	(%r12,%rsi,8), %r10
+ 910              	.L28:
+ 911 10e6 4D8B5CC2 		movq	72(%r10,%rax,8), %r11
+ 911      48
+ 912 10eb C4C15B5A 		vcvtsd2ss	(%r9,%rax,8), %xmm4, %xmm0
+ 912      04C1
+ 913 10f1 C4C17A11 		vmovss	%xmm0, (%r11,%rcx)
+ 913      040B
+ 914 10f7 4989C3   		movq	%rax, %r11
+ 915 10fa 4883C001 		addq	$1, %rax
+ 916 10fe 4C39DA   		cmpq	%r11, %rdx
+ 917 1101 75E3     		jne	.L28
+ 918              	.L94:
+ 919 1103 6291C520 		vmulpd	%ymm24, %ymm23, %ymm6
+ 919      59F0
+ 920 1109 4883C104 		addq	$4, %rcx
+ 921 110d 62D1CD20 		vmulpd	%ymm8, %ymm22, %ymm0
+ 921      59C0
+ 922 1113 62D1C520 		vmulpd	%ymm8, %ymm23, %ymm5
+ 922      59E8
+ 923 1119 6291E520 		vmulpd	%ymm24, %ymm19, %ymm3
+ 923      59D8
+ 924 111f 6261E520 		vmulpd	%ymm1, %ymm19, %ymm25
+ 924      59C9
+ 925 1125 C4C14D58 		vaddpd	%ymm14, %ymm6, %ymm6
+ 925      F6
+ 926 112a 6211D520 		vmulpd	%ymm24, %ymm21, %ymm14
+ 926      59F0
+ 927 1130 C4C15558 		vaddpd	%ymm9, %ymm5, %ymm5
+ 927      E9
+ 928 1135 C5CD5CF0 		vsubpd	%ymm0, %ymm6, %ymm6
+ 929 1139 62D1DD20 		vmulpd	%ymm8, %ymm20, %ymm0
+ 929      59C0
+ 930 113f C4C16558 		vaddpd	%ymm11, %ymm3, %ymm3
+ 930      DB
+ 931 1144 6211F520 		vmulpd	%ymm24, %ymm17, %ymm11
+ 931      59D8
+ 932 114a 6261B520 		vaddpd	%ymm7, %ymm25, %ymm25
+ 932      58CF
+ 933 1150 6251D520 		vmulpd	%ymm8, %ymm21, %ymm8
+ 933      59C0
+ 934 1156 C50D5CF0 		vsubpd	%ymm0, %ymm14, %ymm14
+ 935 115a 62D1CD20 		vmulpd	%ymm10, %ymm22, %ymm0
+ 935      59C2
+ 936 1160 6251DD20 		vmulpd	%ymm10, %ymm20, %ymm10
+ 936      59D2
+ 937 1166 C5D55CE8 		vsubpd	%ymm0, %ymm5, %ymm5
+ 938 116a 62F1ED20 		vmulpd	%ymm1, %ymm18, %ymm0
+ 938      59C1
+ 939 1170 C4413D5C 		vsubpd	%ymm10, %ymm8, %ymm9
+ 939      CA
+ 940 1175 C5E55CD8 		vsubpd	%ymm0, %ymm3, %ymm3
+ 941 1179 62F1FD20 		vmulpd	%ymm1, %ymm16, %ymm0
+ 941      59C1
+ 942 117f 62F1F520 		vmulpd	%ymm1, %ymm17, %ymm1
+ 942      59C9
+ 943 1185 C5255CD8 		vsubpd	%ymm0, %ymm11, %ymm11
+ 944 1189 62F1ED20 		vmulpd	%ymm2, %ymm18, %ymm0
+ 944      59C2
+ 945 118f 62F1FD20 		vmulpd	%ymm2, %ymm16, %ymm2
+ 945      59D2
+ 946 1195 6261B520 		vsubpd	%ymm0, %ymm25, %ymm25
+ 946      5CC8
+ 947 119b C5F55CFA 		vsubpd	%ymm2, %ymm1, %ymm7
+ 948 119f 4839CF   		cmpq	%rcx, %rdi
+ 949 11a2 0F85A8FE 		jne	.L29
+ 949      FFFF
+ 950              	.L24:
+ 951 11a8 488B8424 		movq	128(%rsp), %rax
+ 951      80000000 
+ 952 11b0 C5FD2930 		vmovapd	%ymm6, (%rax)
+ 953 11b4 C57D2970 		vmovapd	%ymm14, 32(%rax)
+ 953      20
+ 954 11b9 C5FD2968 		vmovapd	%ymm5, 64(%rax)
+ 954      40
+ 955 11be C57D2948 		vmovapd	%ymm9, 96(%rax)
+ 955      60
+ 956 11c3 C5FD2998 		vmovapd	%ymm3, 896(%rax)
+ 956      80030000 
+ 957 11cb C57D2998 		vmovapd	%ymm11, 928(%rax)
+ 957      A0030000 
+ 958 11d3 6261FD28 		vmovapd	%ymm25, 960(%rax)
+ 958      29481E
+ 959 11da C5FD29B8 		vmovapd	%ymm7, 992(%rax)
+ 959      E0030000 
+ 960 11e2 C5F877   		vzeroupper
+ 961 11e5 488D65D8 		leaq	-40(%rbp), %rsp
+ 962 11e9 5B       		popq	%rbx
+ 963 11ea 415C     		popq	%r12
+ 964 11ec 415D     		popq	%r13
+ 965 11ee 415E     		popq	%r14
+ 966 11f0 415F     		popq	%r15
+ 967 11f2 5D       		popq	%rbp
+ 968              		.cfi_remember_state
+ 969              		.cfi_def_cfa 7, 8
+ 970 11f3 C3       		ret
+ 971              	.L165:
+ 972              		.cfi_restore_state
+ 973 11f4 4C89D6   		movq	%r10, %rsi
+ 974              	.L60:
+ 975 11f7 488B8424 		movq	128(%rsp), %rax
+ 975      80000000 
+ 976 11ff 62F1FD48 		vmovdqa64	320(%rsp), %zmm7
+ 976      6F7C2405 
+ 977 1207 62F1FE48 		vmovdqu64	%zmm7, (%rax)
+ 977      7F38
+ 978 120d 62F1FD48 		vmovdqa64	384(%rsp), %zmm7
+ 978      6F7C2406 
+ 979 1215 62F1FE48 		vmovdqu64	%zmm7, 64(%rax)
+ 979      7F7801
+ 980 121c 62F1FD48 		vmovdqa64	1216(%rsp), %zmm7
+ 980      6F7C2413 
+ 981 1224 62F1FE48 		vmovdqu64	%zmm7, 896(%rax)
+ 981      7F780E
+ 982 122b 62F1FD48 		vmovdqa64	1280(%rsp), %zmm7
+ 982      6F7C2414 
+ 983 1233 62F1FE48 		vmovdqu64	%zmm7, 960(%rax)
+ 983      7F780F
+ 984 123a 62F1FD48 		vmovdqa64	2176(%rsp), %zmm7
+ 984      6F7C2422 
+ 985 1242 62F1FE48 		vmovdqu64	%zmm7, 1856(%rax)
+ 985      7F781D
+ 986 1249 62F1FD48 		vmovdqa64	2240(%rsp), %zmm7
+ 986      6F7C2423 
+ 987 1251 62F1FE48 		vmovdqu64	%zmm7, 64(%rsi)
+ 987      7F7E01
+ 988 1258 62F1FD48 		vmovdqa64	448(%rsp), %zmm7
+ 988      6F7C2407 
+ 989 1260 62F1FE48 		vmovdqu64	%zmm7, 128(%rax)
+ 989      7F7802
+ 990 1267 62F1FD48 		vmovdqa64	512(%rsp), %zmm7
+ 990      6F7C2408 
+ 991 126f 62F1FE48 		vmovdqu64	%zmm7, 192(%rax)
+ 991      7F7803
+ 992 1276 62F1FD48 		vmovdqa64	1344(%rsp), %zmm7
+ 992      6F7C2415 
+ 993 127e 62F1FE48 		vmovdqu64	%zmm7, 1024(%rax)
+ 993      7F7810
+ 994 1285 62F1FD48 		vmovdqa64	1408(%rsp), %zmm7
+ 994      6F7C2416 
+ 995 128d 62F1FE48 		vmovdqu64	%zmm7, 1088(%rax)
+ 995      7F7811
+ 996 1294 62F1FD48 		vmovdqa64	2688(%rsp), %zmm7
+ 996      6F7C242A 
+ 997 129c 62F1FE48 		vmovdqu64	%zmm7, 2368(%rax)
+ 997      7F7825
+ 998 12a3 62F1FD48 		vmovdqa64	576(%rsp), %zmm7
+ 998      6F7C2409 
+ 999 12ab 62F1FE48 		vmovdqu64	%zmm7, 256(%rax)
+ 999      7F7804
+ 1000 12b2 62F1FD48 		vmovdqa64	640(%rsp), %zmm7
+ 1000      6F7C240A 
+ 1001 12ba 62F1FE48 		vmovdqu64	%zmm7, 320(%rax)
+ 1001      7F7805
+ 1002 12c1 62F1FD48 		vmovdqa64	1472(%rsp), %zmm7
+ 1002      6F7C2417 
+ 1003 12c9 62F1FE48 		vmovdqu64	%zmm7, 1152(%rax)
+ 1003      7F7812
+ 1004 12d0 62F1FD48 		vmovdqa64	1536(%rsp), %zmm7
+ 1004      6F7C2418 
+ 1005 12d8 62F1FE48 		vmovdqu64	%zmm7, 1216(%rax)
+ 1005      7F7813
+ 1006 12df C5F877   		vzeroupper
+ 1007 12e2 488D65D8 		leaq	-40(%rbp), %rsp
+ 1008 12e6 5B       		popq	%rbx
+ 1009 12e7 415C     		popq	%r12
+ 1010 12e9 415D     		popq	%r13
+ 1011 12eb 415E     		popq	%r14
+ 1012 12ed 415F     		popq	%r15
+ 1013 12ef 5D       		popq	%rbp
+ 1014              		.cfi_remember_state
+ 1015              		.cfi_def_cfa 7, 8
+ 1016 12f0 C3       		ret
+ 1017              		.p2align 4,,10
+ 1018 12f1 0F1F8000 		.p2align 3
+ 1018      000000
+ 1019              	.L163:
+ 1020              		.cfi_restore_state
+ 1021 12f8 4983EB80 		subq	$-128, %r11
+ 1022 12fc 4881C7A0 		addq	$160, %rdi
+ 1022      000000
+ 1023 1303 4983EA80 		subq	$-128, %r10
+ 1024 1307 01DA     		addl	%ebx, %edx
+ 1025 1309 83FE02   		cmpl	$2, %esi
+ 1026 130c 0F8570FC 		jne	.L96
+ 1026      FFFF
+ 1027 1312 4983C004 		addq	$4, %r8
+ 1028 1316 C5F157C9 		vxorpd	%xmm1, %xmm1, %xmm1
+ 1029 131a 4C394424 		cmpq	%r8, 120(%rsp)
+ 1029      78
+ 1030 131f 0F8597FA 		jne	.L42
+ 1030      FFFF
+ 1031 1325 4589E3   		movl	%r12d, %r11d
+ 1032 1328 E9E50000 		jmp	.L31
+ 1032      00
+ 1033 132d 0F1F00   		.p2align 4,,10
+ 1034              		.p2align 3
+ 1035              	.L25:
+ 1036 1330 C4411559 		vmulpd	%ymm15, %ymm13, %ymm8
+ 1036      C7
+ 1037 1335 6201BD00 		vxorpd	%xmm24, %xmm24, %xmm24
+ 1037      57C0
+ 1038 133b C4C11D59 		vmulpd	%ymm15, %ymm12, %ymm1
+ 1038      CF
+ 1039 1340 C53D58C6 		vaddpd	%ymm6, %ymm8, %ymm8
+ 1040 1344 C5F558CB 		vaddpd	%ymm3, %ymm1, %ymm1
+ 1041 1348 C4411559 		vmulpd	%ymm8, %ymm13, %ymm10
+ 1041      D0
+ 1042 134d C59D59D1 		vmulpd	%ymm1, %ymm12, %ymm2
+ 1043 1351 C52D58D5 		vaddpd	%ymm5, %ymm10, %ymm10
+ 1044 1355 6291ED28 		vaddpd	%ymm25, %ymm2, %ymm2
+ 1044      58D1
+ 1045 135b E9A3FDFF 		jmp	.L94
+ 1045      FF
+ 1046              		.p2align 4,,10
+ 1047              		.p2align 3
+ 1048              	.L61:
+ 1049 1360 4983EE80 		subq	$-128, %r14
+ 1050 1364 4981C0A0 		addq	$160, %r8
+ 1050      000000
+ 1051 136b 4983ED80 		subq	$-128, %r13
+ 1052 136f 01D8     		addl	%ebx, %eax
+ 1053 1371 4881C700 		addq	$512, %rdi
+ 1053      020000
+ 1054 1378 E943F6FF 		jmp	.L64
+ 1054      FF
+ 1055 137d 0F1F00   		.p2align 4,,10
+ 1056              		.p2align 3
+ 1057              	.L83:
+ 1058 1380 85DB     		testl	%ebx, %ebx
+ 1059 1382 0F8FF2F1 		jg	.L85
+ 1059      FFFF
+ 1060 1388 4D89FC   		movq	%r15, %r12
+ 1061 138b 8B4C2478 		movl	120(%rsp), %ecx
+ 1062 138f 4D89CF   		movq	%r9, %r15
+ 1063 1392 4C8B8C24 		movq	192(%rsp), %r9
+ 1063      C0000000 
+ 1064 139a E96AF2FF 		jmp	.L90
+ 1064      FF
+ 1065 139f 90       		.p2align 4,,10
+ 1066              		.p2align 3
+ 1067              	.L54:
+ 1068 13a0 85DB     		testl	%ebx, %ebx
+ 1069 13a2 0F8FDEF7 		jg	.L62
+ 1069      FFFF
+ 1070              	.L159:
+ 1071 13a8 4983C104 		addq	$4, %r9
+ 1072 13ac 4C394C24 		cmpq	%r9, 104(%rsp)
+ 1072      68
+ 1073 13b1 0F843DFE 		je	.L165
+ 1073      FFFF
+ 1074 13b7 C5E957D2 		vxorpd	%xmm2, %xmm2, %xmm2
+ 1075 13bb E9CDF5FF 		jmp	.L53
+ 1075      FF
+ 1076              	.L164:
+ 1077 13c0 488B4C24 		movq	120(%rsp), %rcx
+ 1077      78
+ 1078 13c5 4489E2   		movl	%r12d, %edx
+ 1079 13c8 C441F97E 		vmovq	%xmm10, %r13
+ 1079      D5
+ 1080 13cd 31F6     		xorl	%esi, %esi
+ 1081 13cf C4C1F97E 		vmovq	%xmm7, %r12
+ 1081      FC
+ 1082 13d4 4C8D9424 		leaq	288(%rsp), %r10
+ 1082      20010000 
+ 1083 13dc C5FD298C 		vmovapd	%ymm1, 288(%rsp)
+ 1083      24200100 
+ 1083      00
+ 1084              		.p2align 4,,10
+ 1085 13e5 0F1F00   		.p2align 3
+ 1086              	.L45:
+ 1087 13e8 498B7CF5 		movq	72(%r13,%rsi,8), %rdi
+ 1087      48
+ 1088 13ed C4C15B5A 		vcvtsd2ss	(%r10,%rsi,8), %xmm4, %xmm0
+ 1088      04F2
+ 1089 13f3 4883C601 		addq	$1, %rsi
+ 1090 13f7 C4A17A11 		vmovss	%xmm0, (%rdi,%r8)
+ 1090      0407
+ 1091 13fd 4939F1   		cmpq	%rsi, %r9
+ 1092 1400 75E6     		jne	.L45
+ 1093 1402 4983C004 		addq	$4, %r8
+ 1094 1406 4C39C1   		cmpq	%r8, %rcx
+ 1095 1409 0F855DF9 		jne	.L44
+ 1095      FFFF
+ 1096 140f 4189D3   		movl	%edx, %r11d
+ 1097              	.L31:
+ 1098 1412 488BB424 		movq	128(%rsp), %rsi
+ 1098      80000000 
+ 1099 141a 31C9     		xorl	%ecx, %ecx
+ 1100 141c EB13     		jmp	.L47
+ 1101              	.L48:
+ 1102 141e C5FD29B6 		vmovapd	%ymm6, 1856(%rsi)
+ 1102      40070000 
+ 1103 1426 4489D9   		movl	%r11d, %ecx
+ 1104 1429 C5FD29AE 		vmovapd	%ymm5, 1888(%rsi)
+ 1104      60070000 
+ 1105              	.L47:
+ 1106 1431 4863C1   		movslq	%ecx, %rax
+ 1107 1434 48C1E007 		salq	$7, %rax
+ 1108 1438 62F1FD48 		vmovdqa64	1216(%rsp,%rax), %zmm7
+ 1108      6F7C0413 
+ 1109 1440 488D1406 		leaq	(%rsi,%rax), %rdx
+ 1110 1444 62F1FE48 		vmovdqu64	%zmm7, (%rdx)
+ 1110      7F3A
+ 1111 144a 62F1FD48 		vmovdqa64	1280(%rsp,%rax), %zmm7
+ 1111      6F7C0414 
+ 1112 1452 62F1FE48 		vmovdqu64	%zmm7, 64(%rdx)
+ 1112      7F7A01
+ 1113 1459 62F1FD48 		vmovdqa64	2112(%rsp,%rax), %zmm7
+ 1113      6F7C0421 
+ 1114 1461 62F1FE48 		vmovdqu64	%zmm7, 896(%rdx)
+ 1114      7F7A0E
+ 1115 1468 62F1FD48 		vmovdqa64	2176(%rsp,%rax), %zmm7
+ 1115      6F7C0422 
+ 1116 1470 62F1FE48 		vmovdqu64	%zmm7, 960(%rdx)
+ 1116      7F7A0F
+ 1117 1477 85C9     		testl	%ecx, %ecx
+ 1118 1479 74A3     		je	.L48
+ 1119 147b C5F877   		vzeroupper
+ 1120 147e E9DFF2FF 		jmp	.L156
+ 1120      FF
+ 1121              	.L76:
+ 1122 1483 C5E957D2 		vxorpd	%xmm2, %xmm2, %xmm2
+ 1123 1487 85F6     		testl	%esi, %esi
+ 1124 1489 0F8FD9EE 		jg	.L79
+ 1124      FFFF
+ 1125 148f E975F1FF 		jmp	.L90
+ 1125      FF
+ 1126              	.L10:
+ 1127 1494 4139C0   		cmpl	%eax, %r8d
+ 1128 1497 0F84ABF7 		je	.L9
+ 1128      FFFF
+ 1129 149d 418B9424 		movl	164(%r12), %edx
+ 1129      A4000000 
+ 1130              	.L70:
+ 1131 14a5 85D2     		testl	%edx, %edx
+ 1132 14a7 0F8F05EE 		jg	.L73
+ 1132      FFFF
+ 1133 14ad E9B0F2FF 		jmp	.L156
+ 1133      FF
+ 1134              		.p2align 4,,10
+ 1135 14b2 660F1F44 		.p2align 3
+ 1135      0000
+ 1136              	.L101:
+ 1137 14b8 C4C1F96E 		vmovq	%r12, %xmm7
+ 1137      FC
+ 1138 14bd 48894C24 		movq	%rcx, 120(%rsp)
+ 1138      78
+ 1139 14c2 C5F157C9 		vxorpd	%xmm1, %xmm1, %xmm1
+ 1140 14c6 4189D4   		movl	%edx, %r12d
+ 1141 14c9 C441F96E 		vmovq	%r13, %xmm14
+ 1141      F5
+ 1142 14ce E9E9F8FF 		jmp	.L42
+ 1142      FF
+ 1143              	.L102:
+ 1144 14d3 488D8C24 		leaq	1216(%rsp), %rcx
+ 1144      C0040000 
+ 1145 14db C5E957D2 		vxorpd	%xmm2, %xmm2, %xmm2
+ 1146 14df 48898C24 		movq	%rcx, 192(%rsp)
+ 1146      C0000000 
+ 1147 14e7 488D8C24 		leaq	2112(%rsp), %rcx
+ 1147      40080000 
+ 1148 14ef 48894C24 		movq	%rcx, 112(%rsp)
+ 1148      70
+ 1149 14f4 488D8C24 		leaq	320(%rsp), %rcx
+ 1149      40010000 
+ 1150 14fc 48894C24 		movq	%rcx, 120(%rsp)
+ 1150      78
+ 1151 1501 E96FF4FF 		jmp	.L51
+ 1151      FF
+ 1152              		.cfi_endproc
+ 1153              	.LFE17:
+ 1155 1506 662E0F1F 		.p2align 4
+ 1155      84000000 
+ 1155      0000
+ 1156              		.globl	destroy_xover
+ 1158              	destroy_xover:
+ 1159              	.LFB20:
+ 1160              		.cfi_startproc
+ 1161 1510 488BBFC0 		movq	192(%rdi), %rdi
+ 1161      000000
+ 1162 1517 E9000000 		jmp	free@PLT
+ 1162      00
+ 1163              		.cfi_endproc
+ 1164              	.LFE20:
+ 1166 151c 0F1F4000 		.p2align 4
+ 1167              		.globl	xover_preroll
+ 1169              	xover_preroll:
+ 1170              	.LFB21:
+ 1171              		.cfi_startproc
+ 1172 1520 4157     		pushq	%r15
+ 1173              		.cfi_def_cfa_offset 16
+ 1174              		.cfi_offset 15, -16
+ 1175 1522 4156     		pushq	%r14
+ 1176              		.cfi_def_cfa_offset 24
+ 1177              		.cfi_offset 14, -24
+ 1178 1524 4155     		pushq	%r13
+ 1179              		.cfi_def_cfa_offset 32
+ 1180              		.cfi_offset 13, -32
+ 1181 1526 4154     		pushq	%r12
+ 1182              		.cfi_def_cfa_offset 40
+ 1183              		.cfi_offset 12, -40
+ 1184 1528 55       		pushq	%rbp
+ 1185              		.cfi_def_cfa_offset 48
+ 1186              		.cfi_offset 6, -48
+ 1187 1529 53       		pushq	%rbx
+ 1188              		.cfi_def_cfa_offset 56
+ 1189              		.cfi_offset 3, -56
+ 1190 152a 4883EC18 		subq	$24, %rsp
+ 1191              		.cfi_def_cfa_offset 80
+ 1192 152e 4C8BB7C0 		movq	192(%rdi), %r14
+ 1192      000000
+ 1193 1535 6B879800 		imull	$60, 152(%rdi), %eax
+ 1193      00003C
+ 1194 153c C5FB1104 		vmovsd	%xmm0, (%rsp)
+ 1194      24
+ 1195 1541 418B96A8 		movl	9128(%r14), %edx
+ 1195      230000
+ 1196 1548 48894424 		movq	%rax, 8(%rsp)
+ 1196      08
+ 1197 154d 85D2     		testl	%edx, %edx
+ 1198 154f 0F8E8B00 		jle	.L170
+ 1198      0000
+ 1199 1555 4989C4   		movq	%rax, %r12
+ 1200 1558 498D9E60 		leaq	8288(%r14), %rbx
+ 1200      200000
+ 1201 155f 4531FF   		xorl	%r15d, %r15d
+ 1202 1562 4531ED   		xorl	%r13d, %r13d
+ 1203              		.p2align 4,,10
+ 1204 1565 0F1F00   		.p2align 3
+ 1205              	.L169:
+ 1206 1568 C5FB1004 		vmovsd	(%rsp), %xmm0
+ 1206      24
+ 1207 156d 4889DF   		movq	%rbx, %rdi
+ 1208 1570 4489E6   		movl	%r12d, %esi
+ 1209 1573 E8000000 		call	iir_decay@PLT
+ 1209      00
+ 1210 1578 C5FB1004 		vmovsd	(%rsp), %xmm0
+ 1210      24
+ 1211 157d 488D7B28 		leaq	40(%rbx), %rdi
+ 1212 1581 4489E6   		movl	%r12d, %esi
+ 1213 1584 89C5     		movl	%eax, %ebp
+ 1214 1586 E8000000 		call	iir_decay@PLT
+ 1214      00
+ 1215 158b 01ED     		addl	%ebp, %ebp
+ 1216 158d 488D7B50 		leaq	80(%rbx), %rdi
+ 1217 1591 4489E6   		movl	%r12d, %esi
+ 1218 1594 C5FB1004 		vmovsd	(%rsp), %xmm0
+ 1218      24
+ 1219 1599 01C0     		addl	%eax, %eax
+ 1220 159b 89ED     		movl	%ebp, %ebp
+ 1221 159d 4883C378 		addq	$120, %rbx
+ 1222 15a1 89C0     		movl	%eax, %eax
+ 1223 15a3 4801C5   		addq	%rax, %rbp
+ 1224 15a6 E8000000 		call	iir_decay@PLT
+ 1224      00
+ 1225 15ab 410FAFC7 		imull	%r15d, %eax
+ 1226 15af 4183C701 		addl	$1, %r15d
+ 1227 15b3 4801E8   		addq	%rbp, %rax
+ 1228 15b6 4901C5   		addq	%rax, %r13
+ 1229 15b9 4539BEA8 		cmpl	%r15d, 9128(%r14)
+ 1229      230000
+ 1230 15c0 7FA6     		jg	.L169
+ 1231 15c2 488B4424 		movq	8(%rsp), %rax
+ 1231      08
+ 1232 15c7 4939C5   		cmpq	%rax, %r13
+ 1233 15ca 490F46C5 		cmovbe	%r13, %rax
+ 1234 15ce 4883C418 		addq	$24, %rsp
+ 1235              		.cfi_remember_state
+ 1236              		.cfi_def_cfa_offset 56
+ 1237 15d2 5B       		popq	%rbx
+ 1238              		.cfi_def_cfa_offset 48
+ 1239 15d3 5D       		popq	%rbp
+ 1240              		.cfi_def_cfa_offset 40
+ 1241 15d4 415C     		popq	%r12
+ 1242              		.cfi_def_cfa_offset 32
+ 1243 15d6 415D     		popq	%r13
+ 1244              		.cfi_def_cfa_offset 24
+ 1245 15d8 415E     		popq	%r14
+ 1246              		.cfi_def_cfa_offset 16
+ 1247 15da 415F     		popq	%r15
+ 1248              		.cfi_def_cfa_offset 8
+ 1249 15dc C3       		ret
+ 1250 15dd 0F1F00   		.p2align 4,,10
+ 1251              		.p2align 3
+ 1252              	.L170:
+ 1253              		.cfi_restore_state
+ 1254 15e0 4883C418 		addq	$24, %rsp
+ 1255              		.cfi_def_cfa_offset 56
+ 1256 15e4 31C0     		xorl	%eax, %eax
+ 1257 15e6 5B       		popq	%rbx
+ 1258              		.cfi_def_cfa_offset 48
+ 1259 15e7 5D       		popq	%rbp
+ 1260              		.cfi_def_cfa_offset 40
+ 1261 15e8 415C     		popq	%r12
+ 1262              		.cfi_def_cfa_offset 32
+ 1263 15ea 415D     		popq	%r13
+ 1264              		.cfi_def_cfa_offset 24
+ 1265 15ec 415E     		popq	%r14
+ 1266              		.cfi_def_cfa_offset 16
+ 1267 15ee 415F     		popq	%r15
+ 1268              		.cfi_def_cfa_offset 8
+ 1269 15f0 C3       		ret
+ 1270              		.cfi_endproc
+ 1271              	.LFE21:
+ 1273 15f1 66662E0F 		.p2align 4
+ 1273      1F840000 
+ 1273      0000000F 
+ 1273      1F4000
+ 1274              		.globl	clone_xover
+ 1276              	clone_xover:
+ 1277              	.LFB22:
+ 1278              		.cfi_startproc
+ 1279 1600 55       		pushq	%rbp
+ 1280              		.cfi_def_cfa_offset 16
+ 1281              		.cfi_offset 6, -16
+ 1282 1601 4889F5   		movq	%rsi, %rbp
+ 1283 1604 53       		pushq	%rbx
+ 1284              		.cfi_def_cfa_offset 24
+ 1285              		.cfi_offset 3, -24
+ 1286 1605 4889FB   		movq	%rdi, %rbx
+ 1287 1608 BF002400 		movl	$9216, %edi
+ 1287      00
+ 1288 160d 4883EC08 		subq	$8, %rsp
+ 1289              		.cfi_def_cfa_offset 32
+ 1290 1611 E8000000 		call	valloc@PLT
+ 1290      00
+ 1291 1616 4885C0   		testq	%rax, %rax
+ 1292 1619 7424     		je	.L175
+ 1293 161b 488BB5C0 		movq	192(%rbp), %rsi
+ 1293      000000
+ 1294 1622 BA002400 		movl	$9216, %edx
+ 1294      00
+ 1295 1627 4889C7   		movq	%rax, %rdi
+ 1296 162a E8000000 		call	memcpy@PLT
+ 1296      00
+ 1297 162f 488983C0 		movq	%rax, 192(%rbx)
+ 1297      000000
+ 1298 1636 31C0     		xorl	%eax, %eax
+ 1299              	.L173:
+ 1300 1638 4883C408 		addq	$8, %rsp
+ 1301              		.cfi_remember_state
+ 1302              		.cfi_def_cfa_offset 24
+ 1303 163c 5B       		popq	%rbx
+ 1304              		.cfi_def_cfa_offset 16
+ 1305 163d 5D       		popq	%rbp
+ 1306              		.cfi_def_cfa_offset 8
+ 1307 163e C3       		ret
+ 1308              	.L175:
+ 1309              		.cfi_restore_state
+ 1310 163f B8010000 		movl	$1, %eax
+ 1310      00
+ 1311 1644 EBF2     		jmp	.L173
+ 1312              		.cfi_endproc
+ 1313              	.LFE22:
+ 1315              		.section	.rodata.str1.8,"aMS",@progbits,1
+ 1316              		.align 8
+ 1317              	.LC5:
+ 1318 0000 25733A20 		.string	"%s: %d bands of %d channels are more than %d channels\n"
+ 1318      25642062 
+ 1318      616E6473 
+ 1318      206F6620 
+ 1318      25642063 
+ 1319              		.section	.rodata.str1.1,"aMS",@progbits,1
+ 1320              	.LC6:
+ 1321 0000 436F756C 		.string	"Could not initialise xover\n"
+ 1321      64206E6F 
+ 1321      7420696E 
+ 1321      69746961 
+ 1321      6C697365 
+ 1322              		.section	.rodata.str1.8
+ 1323 0037 00       		.align 8
+ 1324              	.LC8:
+ 1325 0038 25733A20 		.string	"%s: %g Hz is above the Nyquist frequency\n"
+ 1325      25672048 
+ 1325      7A206973 
+ 1325      2061626F 
+ 1325      76652074 
+ 1326              		.text
+ 1327 1646 662E0F1F 		.p2align 4
+ 1327      84000000 
+ 1327      0000
+ 1328              		.globl	xover_init
+ 1330              	xover_init:
+ 1331              	.LFB19:
+ 1332              		.cfi_startproc
+ 1333 1650 4C8D5424 		leaq	8(%rsp), %r10
+ 1333      08
+ 1334              		.cfi_def_cfa 10, 0
+ 1335 1655 4883E4E0 		andq	$-32, %rsp
+ 1336 1659 41FF72F8 		pushq	-8(%r10)
+ 1337 165d 55       		pushq	%rbp
+ 1338 165e 4889E5   		movq	%rsp, %rbp
+ 1339              		.cfi_escape 0x10,0x6,0x2,0x76,0
+ 1340 1661 4157     		pushq	%r15
+ 1341 1663 4156     		pushq	%r14
+ 1342 1665 4155     		pushq	%r13
+ 1343 1667 4154     		pushq	%r12
+ 1344 1669 4152     		pushq	%r10
+ 1345              		.cfi_escape 0xf,0x3,0x76,0x58,0x6
+ 1346              		.cfi_escape 0x10,0xf,0x2,0x76,0x78
+ 1347              		.cfi_escape 0x10,0xe,0x2,0x76,0x70
+ 1348              		.cfi_escape 0x10,0xd,0x2,0x76,0x68
+ 1349              		.cfi_escape 0x10,0xc,0x2,0x76,0x60
+ 1350 166b 53       		pushq	%rbx
+ 1351 166c 4881EC20 		subq	$288, %rsp
+ 1351      010000
+ 1352              		.cfi_escape 0x10,0x3,0x2,0x76,0x50
+ 1353 1673 488B0500 		movq	.LC4(%rip), %rax
+ 1353      000000
+ 1354 167a 4C8BBFC0 		movq	192(%rdi), %r15
+ 1354      000000
+ 1355 1681 4889BDD8 		movq	%rdi, -296(%rbp)
+ 1355      FEFFFF
+ 1356 1688 448B879C 		movl	156(%rdi), %r8d
+ 1356      000000
+ 1357 168f C785E8FE 		movl	$11, -280(%rbp)
+ 1357      FFFF0B00 
+ 1357      0000
+ 1358 1699 488985E0 		movq	%rax, -288(%rbp)
+ 1358      FEFFFF
+ 1359 16a0 418B87A8 		movl	9128(%r15), %eax
+ 1359      230000
+ 1360 16a7 8D4801   		leal	1(%rax), %ecx
+ 1361 16aa 4489C0   		movl	%r8d, %eax
+ 1362 16ad 0FAFC1   		imull	%ecx, %eax
+ 1363 16b0 8987A000 		movl	%eax, 160(%rdi)
+ 1363      0000
+ 1364 16b6 83F808   		cmpl	$8, %eax
+ 1365 16b9 0F8FB903 		jg	.L192
+ 1365      0000
+ 1366              	.L178:
+ 1367 16bf 418B87A8 		movl	9128(%r15), %eax
+ 1367      230000
+ 1368 16c6 C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 1369 16ca 62F17F48 		vmovdqu8	%zmm0, -272(%rbp)
+ 1369      7F85F0FE 
+ 1369      FFFF
+ 1370 16d4 62F17F48 		vmovdqu8	%zmm0, -208(%rbp)
+ 1370      7F8530FF 
+ 1370      FFFF
+ 1371 16de 62F17F48 		vmovdqu8	%zmm0, -144(%rbp)
+ 1371      7F8570FF 
+ 1371      FFFF
+ 1372 16e8 C5FD7F45 		vmovdqa	%ymm0, -80(%rbp)
+ 1372      B0
+ 1373 16ed 85C0     		testl	%eax, %eax
+ 1374 16ef 0F8E6C02 		jle	.L185
+ 1374      0000
+ 1375 16f5 488D85E0 		leaq	-288(%rbp), %rax
+ 1375      FEFFFF
+ 1376 16fc 4D8DA740 		leaq	4928(%r15), %r12
+ 1376      130000
+ 1377 1703 4531F6   		xorl	%r14d, %r14d
+ 1378 1706 4C89FB   		movq	%r15, %rbx
+ 1379 1709 488985B8 		movq	%rax, -328(%rbp)
+ 1379      FEFFFF
+ 1380 1710 488D85EC 		leaq	-276(%rbp), %rax
+ 1380      FEFFFF
+ 1381 1717 4C89E1   		movq	%r12, %rcx
+ 1382 171a 488985B0 		movq	%rax, -336(%rbp)
+ 1382      FEFFFF
+ 1383 1721 488D85F0 		leaq	-272(%rbp), %rax
+ 1383      FEFFFF
+ 1384 1728 488985D0 		movq	%rax, -304(%rbp)
+ 1384      FEFFFF
+ 1385 172f 90       		.p2align 4,,10
+ 1386              		.p2align 3
+ 1387              	.L184:
+ 1388 1730 488B85D8 		movq	-296(%rbp), %rax
+ 1388      FEFFFF
+ 1389 1737 C5D957E4 		vxorpd	%xmm4, %xmm4, %xmm4
+ 1390 173b C4817B10 		vmovsd	9136(%r15,%r14,8), %xmm0
+ 1390      84F7B023 
+ 1390      0000
+ 1391 1745 8BB09800 		movl	152(%rax), %esi
+ 1391      0000
+ 1392 174b 62F15F08 		vcvtusi2sdl	%esi, %xmm4, %xmm2
+ 1392      7BD6
+ 1393 1751 C5EB5915 		vmulsd	.LC7(%rip), %xmm2, %xmm2
+ 1393      00000000 
+ 1394 1759 C5F92FC2 		vcomisd	%xmm2, %xmm0
+ 1395 175d 0F83BD02 		jnb	.L193
+ 1395      0000
+ 1396 1763 C5F877   		vzeroupper
+ 1397              	.L180:
+ 1398 1766 4C8BADB8 		movq	-328(%rbp), %r13
+ 1398      FEFFFF
+ 1399 176d 4989DC   		movq	%rbx, %r12
+ 1400 1770 48898DC0 		movq	%rcx, -320(%rbp)
+ 1400      FEFFFF
+ 1401 1777 48899DC8 		movq	%rbx, -312(%rbp)
+ 1401      FEFFFF
+ 1402 177e 4C89EB   		movq	%r13, %rbx
+ 1403 1781 4D89E5   		movq	%r12, %r13
+ 1404 1784 4C8BA5B0 		movq	-336(%rbp), %r12
+ 1404      FEFFFF
+ 1405              	.L183:
+ 1406 178b 8B03     		movl	(%rbx), %eax
+ 1407 178d 488BBDD0 		movq	-304(%rbp), %rdi
+ 1407      FEFFFF
+ 1408 1794 4883C304 		addq	$4, %rbx
+ 1409 1798 4983C528 		addq	$40, %r13
+ 1410 179c C5FB1185 		vmovsd	%xmm0, -264(%rbp)
+ 1410      F8FEFFFF 
+ 1411 17a4 8985F0FE 		movl	%eax, -272(%rbp)
+ 1411      FFFF
+ 1412 17aa 488B0500 		movq	.LC9(%rip), %rax
+ 1412      000000
+ 1413 17b1 48898508 		movq	%rax, -248(%rbp)
+ 1413      FFFFFF
+ 1414 17b8 E8000000 		call	calc_coeffs@PLT
+ 1414      00
+ 1415 17bd C5FE6F9D 		vmovdqu	-224(%rbp), %ymm3
+ 1415      20FFFFFF 
+ 1416 17c5 C5F157C9 		vxorpd	%xmm1, %xmm1, %xmm1
+ 1417 17c9 C4C17E7F 		vmovdqu	%ymm3, 8248(%r13)
+ 1417      9D382000 
+ 1417      00
+ 1418 17d2 488B8540 		movq	-192(%rbp), %rax
+ 1418      FFFFFF
+ 1419 17d9 49898558 		movq	%rax, 8280(%r13)
+ 1419      200000
+ 1420 17e0 4C39E3   		cmpq	%r12, %rbx
+ 1421 17e3 7423     		je	.L182
+ 1422 17e5 488B85D8 		movq	-296(%rbp), %rax
+ 1422      FEFFFF
+ 1423 17ec C4817B10 		vmovsd	9136(%r15,%r14,8), %xmm0
+ 1423      84F7B023 
+ 1423      0000
+ 1424 17f6 8BB09800 		movl	152(%rax), %esi
+ 1424      0000
+ 1425 17fc C5F877   		vzeroupper
+ 1426 17ff EB8A     		jmp	.L183
+ 1427              		.p2align 4,,10
+ 1428 1801 0F1F8000 		.p2align 3
+ 1428      000000
+ 1429              	.L182:
+ 1430 1808 488B9DC8 		movq	-312(%rbp), %rbx
+ 1430      FEFFFF
+ 1431 180f 488B8DC0 		movq	-320(%rbp), %rcx
+ 1431      FEFFFF
+ 1432 1816 4983C601 		addq	$1, %r14
+ 1433 181a C5F35883 		vaddsd	8304(%rbx), %xmm1, %xmm0
+ 1433      70200000 
+ 1434 1822 4881C1A0 		addq	$160, %rcx
+ 1434      000000
+ 1435 1829 4883C378 		addq	$120, %rbx
+ 1436 182d C4E27D19 		vbroadcastsd	%xmm0, %ymm0
+ 1436      C0
+ 1437 1832 C5FD2981 		vmovapd	%ymm0, -160(%rcx)
+ 1437      60FFFFFF 
+ 1438 183a C5F35883 		vaddsd	8192(%rbx), %xmm1, %xmm0
+ 1438      00200000 
+ 1439 1842 C4E27D19 		vbroadcastsd	%xmm0, %ymm0
+ 1439      C0
+ 1440 1847 C5FD2941 		vmovapd	%ymm0, -128(%rcx)
+ 1440      80
+ 1441 184c C5F35883 		vaddsd	8200(%rbx), %xmm1, %xmm0
+ 1441      08200000 
+ 1442 1854 C4E27D19 		vbroadcastsd	%xmm0, %ymm0
+ 1442      C0
+ 1443 1859 C5FD2941 		vmovapd	%ymm0, -96(%rcx)
+ 1443      A0
+ 1444 185e C5F35883 		vaddsd	8168(%rbx), %xmm1, %xmm0
+ 1444      E81F0000 
+ 1445 1866 C4E27D19 		vbroadcastsd	%xmm0, %ymm0
+ 1445      C0
+ 1446 186b C5FD2941 		vmovapd	%ymm0, -64(%rcx)
+ 1446      C0
+ 1447 1870 C5F35883 		vaddsd	8176(%rbx), %xmm1, %xmm0
+ 1447      F01F0000 
+ 1448 1878 C4E27D19 		vbroadcastsd	%xmm0, %ymm0
+ 1448      C0
+ 1449 187d C5FD2941 		vmovapd	%ymm0, -32(%rcx)
+ 1449      E0
+ 1450 1882 C5F35883 		vaddsd	8224(%rbx), %xmm1, %xmm0
+ 1450      20200000 
+ 1451 188a C4E27D19 		vbroadcastsd	%xmm0, %ymm0
+ 1451      C0
+ 1452 188f C5FD2981 		vmovapd	%ymm0, 960(%rcx)
+ 1452      C0030000 
+ 1453 1897 C5F35883 		vaddsd	8232(%rbx), %xmm1, %xmm0
+ 1453      28200000 
+ 1454 189f C4E27D19 		vbroadcastsd	%xmm0, %ymm0
+ 1454      C0
+ 1455 18a4 C5FD2981 		vmovapd	%ymm0, 992(%rcx)
+ 1455      E0030000 
+ 1456 18ac C5F35883 		vaddsd	8240(%rbx), %xmm1, %xmm0
+ 1456      30200000 
+ 1457 18b4 C4E27D19 		vbroadcastsd	%xmm0, %ymm0
+ 1457      C0
+ 1458 18b9 C5FD2981 		vmovapd	%ymm0, 1024(%rcx)
+ 1458      00040000 
+ 1459 18c1 C5F35883 		vaddsd	8208(%rbx), %xmm1, %xmm0
+ 1459      10200000 
+ 1460 18c9 C4E27D19 		vbroadcastsd	%xmm0, %ymm0
+ 1460      C0
+ 1461 18ce C5FD2981 		vmovapd	%ymm0, 1056(%rcx)
+ 1461      20040000 
+ 1462 18d6 C5F35883 		vaddsd	8216(%rbx), %xmm1, %xmm0
+ 1462      18200000 
+ 1463 18de C4E27D19 		vbroadcastsd	%xmm0, %ymm0
+ 1463      C0
+ 1464 18e3 C5FD2981 		vmovapd	%ymm0, 1088(%rcx)
+ 1464      40040000 
+ 1465 18eb C5F35883 		vaddsd	8264(%rbx), %xmm1, %xmm0
+ 1465      48200000 
+ 1466 18f3 C4E27D19 		vbroadcastsd	%xmm0, %ymm0
+ 1466      C0
+ 1467 18f8 C5FD2981 		vmovapd	%ymm0, 2080(%rcx)
+ 1467      20080000 
+ 1468 1900 C5F35883 		vaddsd	8272(%rbx), %xmm1, %xmm0
+ 1468      50200000 
+ 1469 1908 C4E27D19 		vbroadcastsd	%xmm0, %ymm0
+ 1469      C0
+ 1470 190d C5FD2981 		vmovapd	%ymm0, 2112(%rcx)
+ 1470      40080000 
+ 1471 1915 C5F35883 		vaddsd	8280(%rbx), %xmm1, %xmm0
+ 1471      58200000 
+ 1472 191d C4E27D19 		vbroadcastsd	%xmm0, %ymm0
+ 1472      C0
+ 1473 1922 C5FD2981 		vmovapd	%ymm0, 2144(%rcx)
+ 1473      60080000 
+ 1474 192a C5F35883 		vaddsd	8248(%rbx), %xmm1, %xmm0
+ 1474      38200000 
+ 1475 1932 C4E27D19 		vbroadcastsd	%xmm0, %ymm0
+ 1475      C0
+ 1476 1937 C5FD2981 		vmovapd	%ymm0, 2176(%rcx)
+ 1476      80080000 
+ 1477 193f C5F35883 		vaddsd	8256(%rbx), %xmm1, %xmm0
+ 1477      40200000 
+ 1478 1947 C4E27D19 		vbroadcastsd	%xmm0, %ymm0
+ 1478      C0
+ 1479 194c C5FD2981 		vmovapd	%ymm0, 2208(%rcx)
+ 1479      A0080000 
+ 1480 1954 4539B7A8 		cmpl	%r14d, 9128(%r15)
+ 1480      230000
+ 1481 195b 0F8FCFFD 		jg	.L184
+ 1481      FFFF
+ 1482              	.L185:
+ 1483 1961 498D7F08 		leaq	8(%r15), %rdi
+ 1484 1965 4C89F9   		movq	%r15, %rcx
+ 1485 1968 31C0     		xorl	%eax, %eax
+ 1486 196a 49C70700 		movq	$0, (%r15)
+ 1486      000000
+ 1487 1971 4883E7F8 		andq	$-8, %rdi
+ 1488 1975 498DB788 		leaq	904(%r15), %rsi
+ 1488      030000
+ 1489 197c 4589FA   		movl	%r15d, %r10d
+ 1490 197f 49C78778 		movq	$0, 888(%r15)
+ 1490      03000000 
+ 1490      000000
+ 1491 198a 4829F9   		subq	%rdi, %rcx
+ 1492 198d 498D9708 		leaq	1800(%r15), %rdx
+ 1492      070000
+ 1493 1994 81C18003 		addl	$896, %ecx
+ 1493      0000
+ 1494 199a 4883E2F8 		andq	$-8, %rdx
+ 1495 199e C1E903   		shrl	$3, %ecx
+ 1496 19a1 4129D2   		subl	%edx, %r10d
+ 1497 19a4 F348AB   		rep stosq
+ 1498 19a7 4889F7   		movq	%rsi, %rdi
+ 1499 19aa 4489F9   		movl	%r15d, %ecx
+ 1500 19ad 49C78780 		movq	$0, 896(%r15)
+ 1500      03000000 
+ 1500      000000
+ 1501 19b8 49C787F8 		movq	$0, 1784(%r15)
+ 1501      06000000 
+ 1501      000000
+ 1502 19c3 4883E7F8 		andq	$-8, %rdi
+ 1503 19c7 29F9     		subl	%edi, %ecx
+ 1504 19c9 81C10007 		addl	$1792, %ecx
+ 1504      0000
+ 1505 19cf C1E903   		shrl	$3, %ecx
+ 1506 19d2 F348AB   		rep stosq
+ 1507 19d5 418D8A40 		leal	4928(%r10), %ecx
+ 1507      130000
+ 1508 19dc 4889D7   		movq	%rdx, %rdi
+ 1509 19df 49C78700 		movq	$0, 1792(%r15)
+ 1509      07000000 
+ 1509      000000
+ 1510 19ea 49C78738 		movq	$0, 4920(%r15)
+ 1510      13000000 
+ 1510      000000
+ 1511 19f5 C1E903   		shrl	$3, %ecx
+ 1512 19f8 F348AB   		rep stosq
+ 1513 19fb C5F877   		vzeroupper
+ 1514 19fe 4881C420 		addq	$288, %rsp
+ 1514      010000
+ 1515 1a05 5B       		popq	%rbx
+ 1516 1a06 415A     		popq	%r10
+ 1517              		.cfi_remember_state
+ 1518              		.cfi_def_cfa 10, 0
+ 1519 1a08 415C     		popq	%r12
+ 1520 1a0a 415D     		popq	%r13
+ 1521 1a0c 415E     		popq	%r14
+ 1522 1a0e 415F     		popq	%r15
+ 1523 1a10 5D       		popq	%rbp
+ 1524 1a11 498D62F8 		leaq	-8(%r10), %rsp
+ 1525              		.cfi_def_cfa 7, 8
+ 1526 1a15 C3       		ret
+ 1527 1a16 662E0F1F 		.p2align 4,,10
+ 1527      84000000 
+ 1527      0000
+ 1528              		.p2align 3
+ 1529              	.L193:
+ 1530              		.cfi_restore_state
+ 1531 1a20 48898DC8 		movq	%rcx, -312(%rbp)
+ 1531      FEFFFF
+ 1532 1a27 488D3500 		leaq	.LC8(%rip), %rsi
+ 1532      000000
+ 1533 1a2e 31FF     		xorl	%edi, %edi
+ 1534 1a30 B8010000 		movl	$1, %eax
+ 1534      00
+ 1535 1a35 488D1500 		leaq	__func__.1(%rip), %rdx
+ 1535      000000
+ 1536 1a3c C5F877   		vzeroupper
+ 1537 1a3f E8000000 		call	debugprint@PLT
+ 1537      00
+ 1538 1a44 488D3D00 		leaq	.LC6(%rip), %rdi
+ 1538      000000
+ 1539 1a4b E8000000 		call	endprogram@PLT
+ 1539      00
+ 1540 1a50 488B85D8 		movq	-296(%rbp), %rax
+ 1540      FEFFFF
+ 1541 1a57 C4817B10 		vmovsd	9136(%r15,%r14,8), %xmm0
+ 1541      84F7B023 
+ 1541      0000
+ 1542 1a61 488B8DC8 		movq	-312(%rbp), %rcx
+ 1542      FEFFFF
+ 1543 1a68 8BB09800 		movl	152(%rax), %esi
+ 1543      0000
+ 1544 1a6e E9F3FCFF 		jmp	.L180
+ 1544      FF
+ 1545              		.p2align 4,,10
+ 1546 1a73 0F1F4400 		.p2align 3
+ 1546      00
+ 1547              	.L192:
+ 1548 1a78 31FF     		xorl	%edi, %edi
+ 1549 1a7a 41B90800 		movl	$8, %r9d
+ 1549      0000
+ 1550 1a80 488D1500 		leaq	__func__.1(%rip), %rdx
+ 1550      000000
+ 1551 1a87 31C0     		xorl	%eax, %eax
+ 1552 1a89 488D3500 		leaq	.LC5(%rip), %rsi
+ 1552      000000
+ 1553 1a90 E8000000 		call	debugprint@PLT
+ 1553      00
+ 1554 1a95 488D3D00 		leaq	.LC6(%rip), %rdi
+ 1554      000000
+ 1555 1a9c E8000000 		call	endprogram@PLT
+ 1555      00
+ 1556 1aa1 E919FCFF 		jmp	.L178
+ 1556      FF
+ 1557              		.cfi_endproc
+ 1558              	.LFE19:
+ 1560              		.section	.rodata.str1.1
+ 1561              	.LC12:
+ 1562 001c 6600     		.string	"f"
+ 1563              		.section	.rodata.str1.8
+ 1564 0062 00000000 		.align 8
+ 1564      0000
+ 1565              	.LC13:
+ 1566 0068 436F756C 		.string	"Could not allocate memory for xover.\n"
+ 1566      64206E6F 
+ 1566      7420616C 
+ 1566      6C6F6361 
+ 1566      7465206D 
+ 1567              		.section	.rodata.str1.1
+ 1568              	.LC14:
+ 1569 001e 25732073 		.string	"%s subopts: %s\n"
+ 1569      75626F70 
+ 1569      74733A20 
+ 1569      25730A00 
+ 1570              		.section	.rodata.str1.8
+ 1571 008e 0000     		.align 8
+ 1572              	.LC15:
+ 1573 0090 25733A20 		.string	"%s: Missing value for suboption '%s'\n"
+ 1573      4D697373 
+ 1573      696E6720 
+ 1573      76616C75 
+ 1573      6520666F 
+ 1574 00b6 0000     		.align 8
+ 1575              	.LC16:
+ 1576 00b8 25733A20 		.string	"%s: More than %d crossover frequencies\n"
+ 1576      4D6F7265 
+ 1576      20746861 
+ 1576      6E202564 
+ 1576      2063726F 
+ 1577              		.align 8
+ 1578              	.LC17:
+ 1579 00e0 25733A20 		.string	"%s: Frequencies must be positive and rising: %s\n"
+ 1579      46726571 
+ 1579      75656E63 
+ 1579      69657320 
+ 1579      6D757374 
+ 1580 0111 00000000 		.align 8
+ 1580      000000
+ 1581              	.LC18:
+ 1582 0118 25733A20 		.string	"%s: No match found for token: /%s/\n"
+ 1582      4E6F206D 
+ 1582      61746368 
+ 1582      20666F75 
+ 1582      6E642066 
+ 1583 013c 00000000 		.align 8
+ 1584              	.LC19:
+ 1585 0140 25733A20 		.string	"%s: No crossover frequency given\n"
+ 1585      4E6F2063 
+ 1585      726F7373 
+ 1585      6F766572 
+ 1585      20667265 
+ 1586              		.section	.rodata.str1.1
+ 1587              	.LC20:
+ 1588 002e 25733A20 		.string	"%s: %d bands\n"
+ 1588      25642062 
+ 1588      616E6473 
+ 1588      0A00
+ 1589              		.text
+ 1590 1aa6 662E0F1F 		.p2align 4
+ 1590      84000000 
+ 1590      0000
+ 1591              		.globl	create_xover
+ 1593              	create_xover:
+ 1594              	.LFB23:
+ 1595              		.cfi_startproc
+ 1596 1ab0 55       		pushq	%rbp
+ 1597              		.cfi_def_cfa_offset 16
+ 1598              		.cfi_offset 6, -16
+ 1599 1ab1 488D0500 		leaq	.LC12(%rip), %rax
+ 1599      000000
+ 1600 1ab8 4889E5   		movq	%rsp, %rbp
+ 1601              		.cfi_def_cfa_register 6
+ 1602 1abb 4157     		pushq	%r15
+ 1603 1abd 4156     		pushq	%r14
+ 1604 1abf 4155     		pushq	%r13
+ 1605 1ac1 4154     		pushq	%r12
+ 1606              		.cfi_offset 15, -24
+ 1607              		.cfi_offset 14, -32
+ 1608              		.cfi_offset 13, -40
+ 1609              		.cfi_offset 12, -48
+ 1610 1ac3 4989F4   		movq	%rsi, %r12
+ 1611 1ac6 53       		pushq	%rbx
+ 1612 1ac7 4883E4E0 		andq	$-32, %rsp
+ 1613 1acb 4883EC60 		subq	$96, %rsp
+ 1614              		.cfi_offset 3, -56
+ 1615 1acf C5FA7E15 		vmovq	destroy_xover@GOTPCREL(%rip), %xmm2
+ 1615      00000000 
+ 1616 1ad7 C5FA7E1D 		vmovq	xover_process@GOTPCREL(%rip), %xmm3
+ 1616      00000000 
+ 1617 1adf C4E3E922 		vpinsrq	$1, clone_xover@GOTPCREL(%rip), %xmm2, %xmm0
+ 1617      05000000 
+ 1617      0001
+ 1618 1ae9 48897C24 		movq	%rdi, 40(%rsp)
+ 1618      28
+ 1619 1aee BF002400 		movl	$9216, %edi
+ 1619      00
+ 1620 1af3 C4E3E122 		vpinsrq	$1, xover_init@GOTPCREL(%rip), %xmm3, %xmm1
+ 1620      0D000000 
+ 1620      0001
+ 1621 1afd 48894424 		movq	%rax, 80(%rsp)
+ 1621      50
+ 1622 1b02 48C74424 		movq	$0, 88(%rsp)
+ 1622      58000000 
+ 1622      00
+ 1623 1b0b C4E37538 		vinserti128	$0x1, %xmm0, %ymm1, %ymm4
+ 1623      E001
+ 1624 1b11 C5FD7F24 		vmovdqa	%ymm4, (%rsp)
+ 1624      24
+ 1625 1b16 C5F877   		vzeroupper
+ 1626 1b19 E8000000 		call	valloc@PLT
+ 1626      00
+ 1627 1b1e 4989C6   		movq	%rax, %r14
+ 1628 1b21 4885C0   		testq	%rax, %rax
+ 1629 1b24 0F846802 		je	.L225
+ 1629      0000
+ 1630              	.L195:
+ 1631 1b2a 31F6     		xorl	%esi, %esi
+ 1632 1b2c BA002400 		movl	$9216, %edx
+ 1632      00
+ 1633 1b31 488D5C24 		leaq	64(%rsp), %rbx
+ 1633      40
+ 1634 1b36 4C89F7   		movq	%r14, %rdi
+ 1635 1b39 E8000000 		call	memset@PLT
+ 1635      00
+ 1636 1b3e 488B4424 		movq	40(%rsp), %rax
+ 1636      28
+ 1637 1b43 BF010000 		movl	$1, %edi
+ 1637      00
+ 1638 1b48 4C8D2D00 		leaq	__func__.0(%rip), %r13
+ 1638      000000
+ 1639 1b4f 4C89EA   		movq	%r13, %rdx
+ 1640 1b52 488D3500 		leaq	.LC14(%rip), %rsi
+ 1640      000000
+ 1641 1b59 4C89B0C0 		movq	%r14, 192(%rax)
+ 1641      000000
+ 1642 1b60 498B0C24 		movq	(%r12), %rcx
+ 1643 1b64 31C0     		xorl	%eax, %eax
+ 1644 1b66 E8000000 		call	debugprint@PLT
+ 1644      00
+ 1645 1b6b 498B0424 		movq	(%r12), %rax
+ 1646 1b6f 48895C24 		movq	%rbx, 56(%rsp)
+ 1646      38
+ 1647 1b74 488D5C24 		leaq	80(%rsp), %rbx
+ 1647      50
+ 1648 1b79 48895C24 		movq	%rbx, 48(%rsp)
+ 1648      30
+ 1649 1b7e 488D5C24 		leaq	72(%rsp), %rbx
+ 1649      48
+ 1650 1b83 803800   		cmpb	$0, (%rax)
+ 1651 1b86 0F84D101 		je	.L210
+ 1651      0000
+ 1652              	.L196:
+ 1653 1b8c 488B5424 		movq	56(%rsp), %rdx
+ 1653      38
+ 1654 1b91 488B7424 		movq	48(%rsp), %rsi
+ 1654      30
+ 1655 1b96 4C89E7   		movq	%r12, %rdi
+ 1656 1b99 E8000000 		call	getsubopt@PLT
+ 1656      00
+ 1657 1b9e 4189C7   		movl	%eax, %r15d
+ 1658 1ba1 85C0     		testl	%eax, %eax
+ 1659 1ba3 0F854701 		jne	.L199
+ 1659      0000
+ 1660 1ba9 488B7C24 		movq	64(%rsp), %rdi
+ 1660      40
+ 1661 1bae 4885FF   		testq	%rdi, %rdi
+ 1662 1bb1 0F847901 		je	.L226
+ 1662      0000
+ 1663 1bb7 41C786A8 		movl	$0, 9128(%r14)
+ 1663      23000000 
+ 1663      000000
+ 1664 1bc2 803F00   		cmpb	$0, (%rdi)
+ 1665 1bc5 0F848501 		je	.L203
+ 1665      0000
+ 1666 1bcb 0F1F4400 		.p2align 4,,10
+ 1666      00
+ 1667              		.p2align 3
+ 1668              	.L202:
+ 1669 1bd0 4889DE   		movq	%rbx, %rsi
+ 1670 1bd3 4D63FF   		movslq	%r15d, %r15
+ 1671 1bd6 E8000000 		call	strtod@PLT
+ 1671      00
+ 1672 1bdb 488B7C24 		movq	72(%rsp), %rdi
+ 1672      48
+ 1673 1be0 488B4C24 		movq	64(%rsp), %rcx
+ 1673      40
+ 1674 1be5 C4817B11 		vmovsd	%xmm0, 9136(%r14,%r15,8)
+ 1674      84FEB023 
+ 1674      0000
+ 1675 1bef 4839CF   		cmpq	%rcx, %rdi
+ 1676 1bf2 0F841801 		je	.L204
+ 1676      0000
+ 1677 1bf8 0FB607   		movzbl	(%rdi), %eax
+ 1678 1bfb 84C0     		testb	%al, %al
+ 1679 1bfd 7408     		je	.L211
+ 1680 1bff 3C3A     		cmpb	$58, %al
+ 1681 1c01 0F850901 		jne	.L204
+ 1681      0000
+ 1682              	.L211:
+ 1683 1c07 496396A8 		movslq	9128(%r14), %rdx
+ 1683      230000
+ 1684 1c0e C5D157ED 		vxorpd	%xmm5, %xmm5, %xmm5
+ 1685 1c12 C4C17B10 		vmovsd	9136(%r14,%rdx,8), %xmm0
+ 1685      84D6B023 
+ 1685      0000
+ 1686 1c1c 4889D0   		movq	%rdx, %rax
+ 1687 1c1f C5F92FE8 		vcomisd	%xmm0, %xmm5
+ 1688 1c23 0F83E700 		jnb	.L204
+ 1688      0000
+ 1689 1c29 85D2     		testl	%edx, %edx
+ 1690 1c2b 741A     		je	.L206
+ 1691 1c2d 8D52FF   		leal	-1(%rdx), %edx
+ 1692 1c30 4863D2   		movslq	%edx, %rdx
+ 1693 1c33 C4C17B10 		vmovsd	9136(%r14,%rdx,8), %xmm1
+ 1693      8CD6B023 
+ 1693      0000
+ 1694 1c3d C5F92FC8 		vcomisd	%xmm0, %xmm1
+ 1695 1c41 0F83C900 		jnb	.L204
+ 1695      0000
+ 1696              	.L206:
+ 1697 1c47 448D7801 		leal	1(%rax), %r15d
+ 1698 1c4b 4589BEA8 		movl	%r15d, 9128(%r14)
+ 1698      230000
+ 1699 1c52 803F01   		cmpb	$1, (%rdi)
+ 1700 1c55 4883DFFF 		sbbq	$-1, %rdi
+ 1701 1c59 48897C24 		movq	%rdi, 64(%rsp)
+ 1701      40
+ 1702 1c5e 803F00   		cmpb	$0, (%rdi)
+ 1703 1c61 0F84E900 		je	.L203
+ 1703      0000
+ 1704 1c67 4183FF07 		cmpl	$7, %r15d
+ 1705 1c6b 0F855FFF 		jne	.L202
+ 1705      FFFF
+ 1706 1c71 B9070000 		movl	$7, %ecx
+ 1706      00
+ 1707 1c76 4C89EA   		movq	%r13, %rdx
+ 1708 1c79 31FF     		xorl	%edi, %edi
+ 1709 1c7b 31C0     		xorl	%eax, %eax
+ 1710 1c7d 488D3500 		leaq	.LC16(%rip), %rsi
+ 1710      000000
+ 1711 1c84 E8000000 		call	debugprint@PLT
+ 1711      00
+ 1712 1c89 0F1F8000 		.p2align 4,,10
+ 1712      000000
+ 1713              		.p2align 3
+ 1714              	.L201:
+ 1715 1c90 418B8EA8 		movl	9128(%r14), %ecx
+ 1715      230000
+ 1716 1c97 BB010000 		movl	$1, %ebx
+ 1716      00
+ 1717              	.L198:
+ 1718 1c9c 31C0     		xorl	%eax, %eax
+ 1719 1c9e 83C101   		addl	$1, %ecx
+ 1720 1ca1 4C89EA   		movq	%r13, %rdx
+ 1721 1ca4 BF010000 		movl	$1, %edi
+ 1721      00
+ 1722 1ca9 488D3500 		leaq	.LC20(%rip), %rsi
+ 1722      000000
+ 1723 1cb0 E8000000 		call	debugprint@PLT
+ 1723      00
+ 1724 1cb5 488B7424 		movq	40(%rsp), %rsi
+ 1724      28
+ 1725 1cba 488B0500 		movq	xover_preroll@GOTPCREL(%rip), %rax
+ 1725      000000
+ 1726 1cc1 C5FD6F34 		vmovdqa	(%rsp), %ymm6
+ 1726      24
+ 1727 1cc6 488986F0 		movq	%rax, 240(%rsi)
+ 1727      000000
+ 1728 1ccd 89D8     		movl	%ebx, %eax
+ 1729 1ccf C5FE7FB6 		vmovdqu	%ymm6, 208(%rsi)
+ 1729      D0000000 
+ 1730 1cd7 C5F877   		vzeroupper
+ 1731 1cda 488D65D8 		leaq	-40(%rbp), %rsp
+ 1732 1cde 5B       		popq	%rbx
+ 1733 1cdf 415C     		popq	%r12
+ 1734 1ce1 415D     		popq	%r13
+ 1735 1ce3 415E     		popq	%r14
+ 1736 1ce5 415F     		popq	%r15
+ 1737 1ce7 5D       		popq	%rbp
+ 1738              		.cfi_remember_state
+ 1739              		.cfi_def_cfa 7, 8
+ 1740 1ce8 C3       		ret
+ 1741 1ce9 0F1F8000 		.p2align 4,,10
+ 1741      000000
+ 1742              		.p2align 3
+ 1743              	.L199:
+ 1744              		.cfi_restore_state
+ 1745 1cf0 488B4C24 		movq	64(%rsp), %rcx
+ 1745      40
+ 1746 1cf5 4C89EA   		movq	%r13, %rdx
+ 1747 1cf8 31FF     		xorl	%edi, %edi
+ 1748 1cfa 31C0     		xorl	%eax, %eax
+ 1749 1cfc 488D3500 		leaq	.LC18(%rip), %rsi
+ 1749      000000
+ 1750 1d03 E8000000 		call	debugprint@PLT
+ 1750      00
+ 1751 1d08 EB86     		jmp	.L201
+ 1752 1d0a 660F1F44 		.p2align 4,,10
+ 1752      0000
+ 1753              		.p2align 3
+ 1754              	.L204:
+ 1755 1d10 4C89EA   		movq	%r13, %rdx
+ 1756 1d13 488D3500 		leaq	.LC17(%rip), %rsi
+ 1756      000000
+ 1757 1d1a 31FF     		xorl	%edi, %edi
+ 1758 1d1c 31C0     		xorl	%eax, %eax
+ 1759 1d1e E8000000 		call	debugprint@PLT
+ 1759      00
+ 1760 1d23 E968FFFF 		jmp	.L201
+ 1760      FF
+ 1761 1d28 0F1F8400 		.p2align 4,,10
+ 1761      00000000 
+ 1762              		.p2align 3
+ 1763              	.L226:
+ 1764 1d30 488B4C24 		movq	80(%rsp), %rcx
+ 1764      50
+ 1765 1d35 4C89EA   		movq	%r13, %rdx
+ 1766 1d38 488D3500 		leaq	.LC15(%rip), %rsi
+ 1766      000000
+ 1767 1d3f 31C0     		xorl	%eax, %eax
+ 1768 1d41 E8000000 		call	debugprint@PLT
+ 1768      00
+ 1769 1d46 E945FFFF 		jmp	.L201
+ 1769      FF
+ 1770 1d4b 0F1F4400 		.p2align 4,,10
+ 1770      00
+ 1771              		.p2align 3
+ 1772              	.L203:
+ 1773 1d50 498B0424 		movq	(%r12), %rax
+ 1774 1d54 803800   		cmpb	$0, (%rax)
+ 1775 1d57 0F852FFE 		jne	.L196
+ 1775      FFFF
+ 1776              	.L210:
+ 1777 1d5d 418B8EA8 		movl	9128(%r14), %ecx
+ 1777      230000
+ 1778 1d64 31DB     		xorl	%ebx, %ebx
+ 1779 1d66 85C9     		testl	%ecx, %ecx
+ 1780 1d68 0F852EFF 		jne	.L198
+ 1780      FFFF
+ 1781 1d6e 4C89EA   		movq	%r13, %rdx
+ 1782 1d71 488D3500 		leaq	.LC19(%rip), %rsi
+ 1782      000000
+ 1783 1d78 31FF     		xorl	%edi, %edi
+ 1784 1d7a 31C0     		xorl	%eax, %eax
+ 1785 1d7c E8000000 		call	debugprint@PLT
+ 1785      00
+ 1786 1d81 BB010000 		movl	$1, %ebx
+ 1786      00
+ 1787 1d86 418B8EA8 		movl	9128(%r14), %ecx
+ 1787      230000
+ 1788 1d8d E90AFFFF 		jmp	.L198
+ 1788      FF
+ 1789              	.L225:
+ 1790 1d92 488D3D00 		leaq	.LC13(%rip), %rdi
+ 1790      000000
+ 1791 1d99 E8000000 		call	endprogram@PLT
+ 1791      00
+ 1792 1d9e E987FDFF 		jmp	.L195
+ 1792      FF
+ 1793              		.cfi_endproc
+ 1794              	.LFE23:
+ 1796              		.section	.rodata.str1.1
+ 1797              	.LC21:
+ 1798 003c 20204372 		.string	"  Crossover options\n"
+ 1798      6F73736F 
+ 1798      76657220 
+ 1798      6F707469 
+ 1798      6F6E730A 
+ 1799              	.LC22:
+ 1800 0051 20202020 		.string	"    Name: xover\n"
+ 1800      4E616D65 
+ 1800      3A20786F 
+ 1800      7665720A 
+ 1800      00
+ 1801              		.section	.rodata.str1.8
+ 1802 0162 00000000 		.align 8
+ 1802      0000
+ 1803              	.LC23:
+ 1804 0168 20202020 		.string	"        f = crossover frequencies (Hz), rising, separated by ':'\n"
+ 1804      20202020 
+ 1804      66203D20 
+ 1804      63726F73 
+ 1804      736F7665 
+ 1805 01aa 00000000 		.align 8
+ 1805      0000
+ 1806              	.LC24:
+ 1807 01b0 20202020 		.string	"    Example: -p xover,f=300:3000\n"
+ 1807      4578616D 
+ 1807      706C653A 
+ 1807      202D7020 
+ 1807      786F7665 
+ 1808 01d2 00000000 		.align 8
+ 1808      0000
+ 1809              	.LC25:
+ 1810 01d8 20202020 		.string	"    Note: 4th order Linkwitz-Riley. The chain continues with one group of the input chann
+ 1810      4E6F7465 
+ 1810      3A203474 
+ 1810      68206F72 
+ 1810      64657220 
+ 1811              		.align 8
+ 1812              	.LC26:
+ 1813 0240 20202020 		.string	"          lowest band first, at most %d channels in all\n"
+ 1813      20202020 
+ 1813      20206C6F 
+ 1813      77657374 
+ 1813      2062616E 
+ 1814              		.text
+ 1815 1da3 66662E0F 		.p2align 4
+ 1815      1F840000 
+ 1815      00000066 
+ 1815      90
+ 1816              		.globl	help_xover
+ 1818              	help_xover:
+ 1819              	.LFB24:
+ 1820              		.cfi_startproc
+ 1821 1db0 4883EC08 		subq	$8, %rsp
+ 1822              		.cfi_def_cfa_offset 16
+ 1823 1db4 488D3500 		leaq	.LC21(%rip), %rsi
+ 1823      000000
+ 1824 1dbb 31FF     		xorl	%edi, %edi
+ 1825 1dbd 31C0     		xorl	%eax, %eax
+ 1826 1dbf E8000000 		call	debugprint@PLT
+ 1826      00
+ 1827 1dc4 488D3500 		leaq	.LC22(%rip), %rsi
+ 1827      000000
+ 1828 1dcb 31FF     		xorl	%edi, %edi
+ 1829 1dcd 31C0     		xorl	%eax, %eax
+ 1830 1dcf E8000000 		call	debugprint@PLT
+ 1830      00
+ 1831 1dd4 488D3500 		leaq	.LC23(%rip), %rsi
+ 1831      000000
+ 1832 1ddb 31FF     		xorl	%edi, %edi
+ 1833 1ddd 31C0     		xorl	%eax, %eax
+ 1834 1ddf E8000000 		call	debugprint@PLT
+ 1834      00
+ 1835 1de4 488D3500 		leaq	.LC24(%rip), %rsi
+ 1835      000000
+ 1836 1deb 31FF     		xorl	%edi, %edi
+ 1837 1ded 31C0     		xorl	%eax, %eax
+ 1838 1def E8000000 		call	debugprint@PLT
+ 1838      00
+ 1839 1df4 488D3500 		leaq	.LC25(%rip), %rsi
+ 1839      000000
+ 1840 1dfb 31FF     		xorl	%edi, %edi
+ 1841 1dfd 31C0     		xorl	%eax, %eax
+ 1842 1dff E8000000 		call	debugprint@PLT
+ 1842      00
+ 1843 1e04 BA080000 		movl	$8, %edx
+ 1843      00
+ 1844 1e09 31FF     		xorl	%edi, %edi
+ 1845 1e0b 31C0     		xorl	%eax, %eax
+ 1846 1e0d 488D3500 		leaq	.LC26(%rip), %rsi
+ 1846      000000
+ 1847 1e14 4883C408 		addq	$8, %rsp
+ 1848              		.cfi_def_cfa_offset 8
+ 1849 1e18 E9000000 		jmp	debugprint@PLT
+ 1849      00
+ 1850              		.cfi_endproc
+ 1851              	.LFE24:
+ 1853              		.section	.rodata
+ 1854              		.align 8
+ 1857              	__func__.0:
+ 1858 0000 63726561 		.string	"create_xover"
+ 1858      74655F78 
+ 1858      6F766572 
+ 1858      00
+ 1859 000d 000000   		.align 8
+ 1862              	__func__.1:
+ 1863 0010 786F7665 		.string	"xover_init"
+ 1863      725F696E 
+ 1863      697400
+ 1864              		.section	.rodata.cst16,"aM",@progbits,16
+ 1865              		.align 16
+ 1866              	.LC1:
+ 1867 0000 FFFFFFFF 		.long	-1
+ 1868 0004 FFFFFF7F 		.long	2147483647
+ 1869 0008 00000000 		.long	0
+ 1870 000c 00000000 		.long	0
+ 1871              		.section	.rodata.cst8,"aM",@progbits,8
+ 1872              		.align 8
+ 1873              	.LC2:
+ 1874 0000 BBBDD7D9 		.long	-640172613
+ 1875 0004 DF7CDB3D 		.long	1037794527
+ 1876              		.align 8
+ 1877              	.LC4:
+ 1878 0008 01000000 		.long	1
+ 1879 000c 02000000 		.long	2
+ 1880              		.align 8
+ 1881              	.LC7:
+ 1882 0010 00000000 		.long	0
+ 1883 0014 0000E03F 		.long	1071644672
+ 1884              		.align 8
+ 1885              	.LC9:
+ 1886 0018 CD3B7F66 		.long	1719614413
+ 1887 001c 9EA0E63F 		.long	1072079006
+ 1888              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 1889              		.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1164 @@
+   1              		.file	"dsp.c"
+   2              		.text
+   3              		.p2align 4
+   4              		.globl	get_dspfuncs
+   6              	get_dspfuncs:
+   7              	.LFB14:
+   8              		.cfi_startproc
+   9 0000 488B0500 		movq	dspfuncs@GOTPCREL(%rip), %rax
+   9      000000
+  10 0007 C3       		ret
+  11              		.cfi_endproc
+  12              	.LFE14:
+  14 0008 0F1F8400 		.p2align 4
+  14      00000000 
+  15              		.globl	outchannels_dsp
+  17              	outchannels_dsp:
+  18              	.LFB18:
+  19              		.cfi_startproc
+  20              		.p2align 4,,10
+  21              		.p2align 3
+  22              	.L4:
+  23 0010 4889F8   		movq	%rdi, %rax
+  24 0013 488B3F   		movq	(%rdi), %rdi
+  25 0016 4885FF   		testq	%rdi, %rdi
+  26 0019 75F5     		jne	.L4
+  27 001b 8B80A000 		movl	160(%rax), %eax
+  27      0000
+  28 0021 C3       		ret
+  29              		.cfi_endproc
+  30              	.LFE18:
+  32 0022 66662E0F 		.p2align 4
+  32      1F840000 
+  32      0000000F 
+  32      1F00
+  33              		.globl	maxchannels_dsp
+  35              	maxchannels_dsp:
+  36              	.LFB19:
+  37              		.cfi_startproc
+  38 0030 C5F96E87 		vmovd	156(%rdi), %xmm0
+  38      9C000000 
+  39 0038 0F1F8400 		.p2align 4,,10
+  39      00000000 
+  40              		.p2align 3
+  41              	.L7:
+  42 0040 C5F96E8F 		vmovd	160(%rdi), %xmm1
+  42      A0000000 
+  43 0048 488B3F   		movq	(%rdi), %rdi
+  44 004b C4E2793D 		vpmaxsd	%xmm1, %xmm0, %xmm0
+  44      C1
+  45 0050 C5F97EC0 		vmovd	%xmm0, %eax
+  46 0054 4885FF   		testq	%rdi, %rdi
+  47 0057 75E7     		jne	.L7
+  48 0059 C3       		ret
+  49              		.cfi_endproc
+  50              	.LFE19:
+  52 005a 660F1F44 		.p2align 4
+  52      0000
+  53              		.globl	destroy_dsp
+  55              	destroy_dsp:
+  56              	.LFB23:
+  57              		.cfi_startproc
+  58 0060 4154     		pushq	%r12
+  59              		.cfi_def_cfa_offset 16
+  60              		.cfi_offset 12, -16
+  61 0062 4531E4   		xorl	%r12d, %r12d
+  62 0065 55       		pushq	%rbp
+  63              		.cfi_def_cfa_offset 24
+  64              		.cfi_offset 6, -24
+  65 0066 53       		pushq	%rbx
+  66              		.cfi_def_cfa_offset 32
+  67              		.cfi_offset 3, -32
+  68 0067 4885FF   		testq	%rdi, %rdi
+  69 006a 743D     		je	.L10
+  70 006c 4C8BA7B8 		movq	184(%rdi), %r12
+  70      000000
+  71 0073 4889FD   		movq	%rdi, %rbp
+  72 0076 662E0F1F 		.p2align 4,,10
+  72      84000000 
+  72      0000
+  73              		.p2align 3
+  74              	.L11:
+  75 0080 4889EB   		movq	%rbp, %rbx
+  76 0083 488B6D00 		movq	0(%rbp), %rbp
+  77 0087 4889DF   		movq	%rbx, %rdi
+  78 008a FF93E000 		call	*224(%rbx)
+  78      0000
+  79 0090 488BBBB0 		movq	176(%rbx), %rdi
+  79      000000
+  80 0097 E8000000 		call	free@PLT
+  80      00
+  81 009c 4889DF   		movq	%rbx, %rdi
+  82 009f E8000000 		call	free@PLT
+  82      00
+  83 00a4 4885ED   		testq	%rbp, %rbp
+  84 00a7 75D7     		jne	.L11
+  85              	.L10:
+  86 00a9 5B       		popq	%rbx
+  87              		.cfi_def_cfa_offset 24
+  88 00aa 4C89E7   		movq	%r12, %rdi
+  89 00ad 5D       		popq	%rbp
+  90              		.cfi_def_cfa_offset 16
+  91 00ae 415C     		popq	%r12
+  92              		.cfi_def_cfa_offset 8
+  93 00b0 E9000000 		jmp	free@PLT
+  93      00
+  94              		.cfi_endproc
+  95              	.LFE23:
+  97 00b5 66662E0F 		.p2align 4
+  97      1F840000 
+  97      000000
+  98              		.globl	debugprint
+ 100              	debugprint:
+ 101              	.LFB25:
+ 102              		.cfi_startproc
+ 103 00c0 55       		pushq	%rbp
+ 104              		.cfi_def_cfa_offset 16
+ 105              		.cfi_offset 6, -16
+ 106 00c1 4889F5   		movq	%rsi, %rbp
+ 107 00c4 53       		pushq	%rbx
+ 108              		.cfi_def_cfa_offset 24
+ 109              		.cfi_offset 3, -24
+ 110 00c5 89FB     		movl	%edi, %ebx
+ 111 00c7 4881ECD8 		subq	$216, %rsp
+ 111      000000
+ 112              		.cfi_def_cfa_offset 240
+ 113 00ce 48895424 		movq	%rdx, 48(%rsp)
+ 113      30
+ 114 00d3 48894C24 		movq	%rcx, 56(%rsp)
+ 114      38
+ 115 00d8 4C894424 		movq	%r8, 64(%rsp)
+ 115      40
+ 116 00dd 4C894C24 		movq	%r9, 72(%rsp)
+ 116      48
+ 117 00e2 84C0     		testb	%al, %al
+ 118 00e4 743F     		je	.L20
+ 119 00e6 C5F82944 		vmovaps	%xmm0, 80(%rsp)
+ 119      2450
+ 120 00ec C5F8294C 		vmovaps	%xmm1, 96(%rsp)
+ 120      2460
+ 121 00f2 C5F82954 		vmovaps	%xmm2, 112(%rsp)
+ 121      2470
+ 122 00f8 C5F8299C 		vmovaps	%xmm3, 128(%rsp)
+ 122      24800000 
+ 122      00
+ 123 0101 C5F829A4 		vmovaps	%xmm4, 144(%rsp)
+ 123      24900000 
+ 123      00
+ 124 010a C5F829AC 		vmovaps	%xmm5, 160(%rsp)
+ 124      24A00000 
+ 124      00
+ 125 0113 C5F829B4 		vmovaps	%xmm6, 176(%rsp)
+ 125      24B00000 
+ 125      00
+ 126 011c C5F829BC 		vmovaps	%xmm7, 192(%rsp)
+ 126      24C00000 
+ 126      00
+ 127              	.L20:
+ 128 0125 E8000000 		call	get_debuglevel@PLT
+ 128      00
+ 129 012a 39D8     		cmpl	%ebx, %eax
+ 130 012c 7D12     		jge	.L23
+ 131 012e 4881C4D8 		addq	$216, %rsp
+ 131      000000
+ 132              		.cfi_remember_state
+ 133              		.cfi_def_cfa_offset 24
+ 134 0135 5B       		popq	%rbx
+ 135              		.cfi_def_cfa_offset 16
+ 136 0136 5D       		popq	%rbp
+ 137              		.cfi_def_cfa_offset 8
+ 138 0137 C3       		ret
+ 139 0138 0F1F8400 		.p2align 4,,10
+ 139      00000000 
+ 140              		.p2align 3
+ 141              	.L23:
+ 142              		.cfi_restore_state
+ 143 0140 488D8424 		leaq	240(%rsp), %rax
+ 143      F0000000 
+ 144 0148 488D5424 		leaq	8(%rsp), %rdx
+ 144      08
+ 145 014d 4889EE   		movq	%rbp, %rsi
+ 146 0150 C7442408 		movl	$16, 8(%rsp)
+ 146      10000000 
+ 147 0158 48894424 		movq	%rax, 16(%rsp)
+ 147      10
+ 148 015d 488D4424 		leaq	32(%rsp), %rax
+ 148      20
+ 149 0162 48894424 		movq	%rax, 24(%rsp)
+ 149      18
+ 150 0167 488B0500 		movq	stderr@GOTPCREL(%rip), %rax
+ 150      000000
+ 151 016e C744240C 		movl	$48, 12(%rsp)
+ 151      30000000 
+ 152 0176 488B38   		movq	(%rax), %rdi
+ 153 0179 E8000000 		call	vfprintf@PLT
+ 153      00
+ 154 017e 4881C4D8 		addq	$216, %rsp
+ 154      000000
+ 155              		.cfi_def_cfa_offset 24
+ 156 0185 5B       		popq	%rbx
+ 157              		.cfi_def_cfa_offset 16
+ 158 0186 5D       		popq	%rbp
+ 159              		.cfi_def_cfa_offset 8
+ 160 0187 C3       		ret
+ 161              		.cfi_endproc
+ 162              	.LFE25:
+ 164              		.section	.rodata.str1.1,"aMS",@progbits,1
+ 165              	.LC0:
+ 166 0000 25733A20 		.string	"%s: %s has no preroll\n"
+ 166      25732068 
+ 166      6173206E 
+ 166      6F207072 
+ 166      65726F6C 
+ 167              		.text
+ 168 0188 0F1F8400 		.p2align 4
+ 168      00000000 
+ 169              		.globl	preroll_dsp
+ 171              	preroll_dsp:
+ 172              	.LFB21:
+ 173              		.cfi_startproc
+ 174 0190 4156     		pushq	%r14
+ 175              		.cfi_def_cfa_offset 16
+ 176              		.cfi_offset 14, -16
+ 177 0192 55       		pushq	%rbp
+ 178              		.cfi_def_cfa_offset 24
+ 179              		.cfi_offset 6, -24
+ 180 0193 53       		pushq	%rbx
+ 181              		.cfi_def_cfa_offset 32
+ 182              		.cfi_offset 3, -32
+ 183 0194 4885FF   		testq	%rdi, %rdi
+ 184 0197 745D     		je	.L28
+ 185 0199 4889FB   		movq	%rdi, %rbx
+ 186 019c C4C1F97E 		vmovq	%xmm0, %r14
+ 186      C6
+ 187 01a1 31ED     		xorl	%ebp, %ebp
+ 188 01a3 EB1A     		jmp	.L27
+ 189              		.p2align 4,,10
+ 190 01a5 0F1F00   		.p2align 3
+ 191              	.L26:
+ 192 01a8 4889DF   		movq	%rbx, %rdi
+ 193 01ab C4C1F96E 		vmovq	%r14, %xmm0
+ 193      C6
+ 194 01b0 FFD0     		call	*%rax
+ 195 01b2 488B1B   		movq	(%rbx), %rbx
+ 196 01b5 89C0     		movl	%eax, %eax
+ 197 01b7 4801C5   		addq	%rax, %rbp
+ 198 01ba 4885DB   		testq	%rbx, %rbx
+ 199 01bd 742F     		je	.L24
+ 200              	.L27:
+ 201 01bf 488B83F0 		movq	240(%rbx), %rax
+ 201      000000
+ 202 01c6 4885C0   		testq	%rax, %rax
+ 203 01c9 75DD     		jne	.L26
+ 204 01cb 488B8BB0 		movq	176(%rbx), %rcx
+ 204      000000
+ 205 01d2 488D1500 		leaq	__func__.1(%rip), %rdx
+ 205      000000
+ 206 01d9 488D3500 		leaq	.LC0(%rip), %rsi
+ 206      000000
+ 207 01e0 31FF     		xorl	%edi, %edi
+ 208 01e2 48C7C5FF 		movq	$-1, %rbp
+ 208      FFFFFF
+ 209 01e9 E8000000 		call	debugprint@PLT
+ 209      00
+ 210              	.L24:
+ 211 01ee 4889E8   		movq	%rbp, %rax
+ 212 01f1 5B       		popq	%rbx
+ 213              		.cfi_remember_state
+ 214              		.cfi_def_cfa_offset 24
+ 215 01f2 5D       		popq	%rbp
+ 216              		.cfi_def_cfa_offset 16
+ 217 01f3 415E     		popq	%r14
+ 218              		.cfi_def_cfa_offset 8
+ 219 01f5 C3       		ret
+ 220              	.L28:
+ 221              		.cfi_restore_state
+ 222 01f6 31ED     		xorl	%ebp, %ebp
+ 223 01f8 EBF4     		jmp	.L24
+ 224              		.cfi_endproc
+ 225              	.LFE21:
+ 227              		.section	.rodata.str1.1
+ 228              	.LC1:
+ 229 0017 25733A20 		.string	"%s: No stage %d\n"
+ 229      4E6F2073 
+ 229      74616765 
+ 229      2025640A 
+ 229      00
+ 230              		.section	.rodata.str1.8,"aMS",@progbits,1
+ 231              		.align 8
+ 232              	.LC2:
+ 233 0000 25733A20 		.string	"%s: %s has no runtime options\n"
+ 233      25732068 
+ 233      6173206E 
+ 233      6F207275 
+ 233      6E74696D 
+ 234              		.text
+ 235 01fa 660F1F44 		.p2align 4
+ 235      0000
+ 236              		.globl	control_dsp
+ 238              	control_dsp:
+ 239              	.LFB22:
+ 240              		.cfi_startproc
+ 241 0200 89F1     		movl	%esi, %ecx
+ 242 0202 4883EC08 		subq	$8, %rsp
+ 243              		.cfi_def_cfa_offset 16
+ 244 0206 4889D6   		movq	%rdx, %rsi
+ 245 0209 85C9     		testl	%ecx, %ecx
+ 246 020b 7E1A     		jle	.L32
+ 247 020d 4885FF   		testq	%rdi, %rdi
+ 248 0210 7436     		je	.L40
+ 249 0212 31C0     		xorl	%eax, %eax
+ 250              		.p2align 4,,10
+ 251 0214 0F1F4000 		.p2align 3
+ 252              	.L33:
+ 253 0218 488B3F   		movq	(%rdi), %rdi
+ 254 021b 83C001   		addl	$1, %eax
+ 255 021e 4885FF   		testq	%rdi, %rdi
+ 256 0221 7425     		je	.L40
+ 257 0223 39C1     		cmpl	%eax, %ecx
+ 258 0225 7FF1     		jg	.L33
+ 259              	.L32:
+ 260 0227 4885FF   		testq	%rdi, %rdi
+ 261 022a 741C     		je	.L40
+ 262 022c 85C9     		testl	%ecx, %ecx
+ 263 022e 7818     		js	.L40
+ 264 0230 488B8700 		movq	256(%rdi), %rax
+ 264      010000
+ 265 0237 4885C0   		testq	%rax, %rax
+ 266 023a 742D     		je	.L52
+ 267 023c 4883C408 		addq	$8, %rsp
+ 268              		.cfi_remember_state
+ 269              		.cfi_def_cfa_offset 8
+ 270 0240 FFE0     		jmp	*%rax
+ 271              		.p2align 4,,10
+ 272 0242 660F1F44 		.p2align 3
+ 272      0000
+ 273              	.L40:
+ 274              		.cfi_restore_state
+ 275 0248 488D1500 		leaq	__func__.0(%rip), %rdx
+ 275      000000
+ 276 024f 488D3500 		leaq	.LC1(%rip), %rsi
+ 276      000000
+ 277 0256 31FF     		xorl	%edi, %edi
+ 278 0258 31C0     		xorl	%eax, %eax
+ 279 025a E8000000 		call	debugprint@PLT
+ 279      00
+ 280              	.L39:
+ 281 025f B8010000 		movl	$1, %eax
+ 281      00
+ 282 0264 4883C408 		addq	$8, %rsp
+ 283              		.cfi_remember_state
+ 284              		.cfi_def_cfa_offset 8
+ 285 0268 C3       		ret
+ 286              	.L52:
+ 287              		.cfi_restore_state
+ 288 0269 488B8FB0 		movq	176(%rdi), %rcx
+ 288      000000
+ 289 0270 488D1500 		leaq	__func__.0(%rip), %rdx
+ 289      000000
+ 290 0277 488D3500 		leaq	.LC2(%rip), %rsi
+ 290      000000
+ 291 027e 31FF     		xorl	%edi, %edi
+ 292 0280 E8000000 		call	debugprint@PLT
+ 292      00
+ 293 0285 EBD8     		jmp	.L39
+ 294              		.cfi_endproc
+ 295              	.LFE22:
+ 297              		.section	.rodata.str1.1
+ 298              	.LC3:
+ 299 0028 257300   		.string	"%s"
+ 300              		.text
+ 301 0287 660F1F84 		.p2align 4
+ 301      00000000 
+ 301      00
+ 302              		.globl	endprogram
+ 304              	endprogram:
+ 305              	.LFB24:
+ 306              		.cfi_startproc
+ 307 0290 4889FA   		movq	%rdi, %rdx
+ 308 0293 4883EC08 		subq	$8, %rsp
+ 309              		.cfi_def_cfa_offset 16
+ 310 0297 31FF     		xorl	%edi, %edi
+ 311 0299 31C0     		xorl	%eax, %eax
+ 312 029b 488D3500 		leaq	.LC3(%rip), %rsi
+ 312      000000
+ 313 02a2 E8000000 		call	debugprint@PLT
+ 313      00
+ 314 02a7 BF010000 		movl	$1, %edi
+ 314      00
+ 315 02ac E8000000 		call	exit@PLT
+ 315      00
+ 316              		.cfi_endproc
+ 317              	.LFE24:
+ 319              		.section	.rodata.str1.1
+ 320              	.LC4:
+ 321 002b 63726561 		.string	"create_dsp subopts: %s\n"
+ 321      74655F64 
+ 321      73702073 
+ 321      75626F70 
+ 321      74733A20 
+ 322              		.section	.rodata.str1.8
+ 323 001f 00       		.align 8
+ 324              	.LC5:
+ 325 0020 63726561 		.string	"create_dsp: No match found for token: /%s/\n"
+ 325      74655F64 
+ 325      73703A20 
+ 325      4E6F206D 
+ 325      61746368 
+ 326              		.section	.rodata.str1.1
+ 327              	.LC6:
+ 328 0043 436F756C 		.string	"Could not create dsp\n"
+ 328      64206E6F 
+ 328      74206372 
+ 328      65617465 
+ 328      20647370 
+ 329              		.text
+ 330 02b1 66662E0F 		.p2align 4
+ 330      1F840000 
+ 330      0000000F 
+ 330      1F4000
+ 331              		.globl	create_dsp
+ 333              	create_dsp:
+ 334              	.LFB16:
+ 335              		.cfi_startproc
+ 336 02c0 55       		pushq	%rbp
+ 337              		.cfi_def_cfa_offset 16
+ 338              		.cfi_offset 6, -16
+ 339 02c1 4889F2   		movq	%rsi, %rdx
+ 340 02c4 31C0     		xorl	%eax, %eax
+ 341 02c6 4889E5   		movq	%rsp, %rbp
+ 342              		.cfi_def_cfa_register 6
+ 343 02c9 4156     		pushq	%r14
+ 344 02cb 4155     		pushq	%r13
+ 345 02cd 4154     		pushq	%r12
+ 346              		.cfi_offset 14, -24
+ 347              		.cfi_offset 13, -32
+ 348              		.cfi_offset 12, -40
+ 349 02cf 4989FC   		movq	%rdi, %r12
+ 350 02d2 BF010000 		movl	$1, %edi
+ 350      00
+ 351 02d7 53       		pushq	%rbx
+ 352 02d8 4883EC20 		subq	$32, %rsp
+ 353              		.cfi_offset 3, -48
+ 354 02dc 48897424 		movq	%rsi, 8(%rsp)
+ 354      08
+ 355 02e1 488D3500 		leaq	.LC4(%rip), %rsi
+ 355      000000
+ 356 02e8 E8000000 		call	debugprint@PLT
+ 356      00
+ 357 02ed 488B7C24 		movq	8(%rsp), %rdi
+ 357      08
+ 358 02f2 E8000000 		call	strdup@PLT
+ 358      00
+ 359 02f7 C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 360 02fb 49C78424 		movq	$0, 184(%r12)
+ 360      B8000000 
+ 360      00000000 
+ 361 0307 49898424 		movq	%rax, 176(%r12)
+ 361      B0000000 
+ 362 030f 488B4424 		movq	8(%rsp), %rax
+ 362      08
+ 363 0314 49C78424 		movq	$0, 200(%r12)
+ 363      C8000000 
+ 363      00000000 
+ 364 0320 C4C17E7F 		vmovdqu	%ymm0, 232(%r12)
+ 364      8424E800 
+ 364      0000
+ 365 032a 803800   		cmpb	$0, (%rax)
+ 366 032d 0F84C200 		je	.L56
+ 366      0000
+ 367 0333 4C8B2D00 		movq	token@GOTPCREL(%rip), %r13
+ 367      000000
+ 368 033a 4C8D7424 		leaq	24(%rsp), %r14
+ 368      18
+ 369 033f 488D5C24 		leaq	8(%rsp), %rbx
+ 369      08
+ 370 0344 C5F877   		vzeroupper
+ 371 0347 EB2B     		jmp	.L58
+ 372 0349 0F1F8000 		.p2align 4,,10
+ 372      000000
+ 373              		.p2align 3
+ 374              	.L72:
+ 375 0350 4898     		cltq
+ 376 0352 4889DE   		movq	%rbx, %rsi
+ 377 0355 4C89E7   		movq	%r12, %rdi
+ 378 0358 48C1E004 		salq	$4, %rax
+ 379 035c 48030500 		addq	dspfuncs@GOTPCREL(%rip), %rax
+ 379      000000
+ 380 0363 FF5008   		call	*8(%rax)
+ 381 0366 488B5424 		movq	8(%rsp), %rdx
+ 381      08
+ 382 036b 803A00   		cmpb	$0, (%rdx)
+ 383 036e 7460     		je	.L60
+ 384 0370 85C0     		testl	%eax, %eax
+ 385 0372 755C     		jne	.L60
+ 386              	.L58:
+ 387 0374 4C89F2   		movq	%r14, %rdx
+ 388 0377 4C89EE   		movq	%r13, %rsi
+ 389 037a 4889DF   		movq	%rbx, %rdi
+ 390 037d E8000000 		call	getsubopt@PLT
+ 390      00
+ 391 0382 83F807   		cmpl	$7, %eax
+ 392 0385 76C9     		jbe	.L72
+ 393 0387 488B5424 		movq	24(%rsp), %rdx
+ 393      18
+ 394 038c 488D3500 		leaq	.LC5(%rip), %rsi
+ 394      000000
+ 395 0393 31FF     		xorl	%edi, %edi
+ 396 0395 31C0     		xorl	%eax, %eax
+ 397 0397 E8000000 		call	debugprint@PLT
+ 397      00
+ 398 039c 49C70424 		movq	$0, (%r12)
+ 398      00000000 
+ 399 03a4 41C78424 		movl	$0, 168(%r12)
+ 399      A8000000 
+ 399      00000000 
+ 400              	.L61:
+ 401 03b0 488D3D00 		leaq	.LC6(%rip), %rdi
+ 401      000000
+ 402 03b7 E8000000 		call	endprogram@PLT
+ 402      00
+ 403 03bc 4883C420 		addq	$32, %rsp
+ 404 03c0 5B       		popq	%rbx
+ 405 03c1 415C     		popq	%r12
+ 406 03c3 415D     		popq	%r13
+ 407 03c5 415E     		popq	%r14
+ 408 03c7 5D       		popq	%rbp
+ 409              		.cfi_remember_state
+ 410              		.cfi_def_cfa 7, 8
+ 411 03c8 C3       		ret
+ 412 03c9 0F1F8000 		.p2align 4,,10
+ 412      000000
+ 413              		.p2align 3
+ 414              	.L60:
+ 415              		.cfi_restore_state
+ 416 03d0 41C78424 		movl	$0, 168(%r12)
+ 416      A8000000 
+ 416      00000000 
+ 417 03dc 49C70424 		movq	$0, (%r12)
+ 417      00000000 
+ 418 03e4 85C0     		testl	%eax, %eax
+ 419 03e6 75C8     		jne	.L61
+ 420              	.L70:
+ 421 03e8 4883C420 		addq	$32, %rsp
+ 422 03ec 5B       		popq	%rbx
+ 423 03ed 415C     		popq	%r12
+ 424 03ef 415D     		popq	%r13
+ 425 03f1 415E     		popq	%r14
+ 426 03f3 5D       		popq	%rbp
+ 427              		.cfi_remember_state
+ 428              		.cfi_def_cfa 7, 8
+ 429 03f4 C3       		ret
+ 430              	.L56:
+ 431              		.cfi_restore_state
+ 432 03f5 41C78424 		movl	$0, 168(%r12)
+ 432      A8000000 
+ 432      00000000 
+ 433 0401 49C70424 		movq	$0, (%r12)
+ 433      00000000 
+ 434 0409 C5F877   		vzeroupper
+ 435 040c EBDA     		jmp	.L70
+ 436              		.cfi_endproc
+ 437              	.LFE16:
+ 439              		.section	.rodata.str1.1
+ 440              	.LC7:
+ 441 0059 73706563 		.string	"specialised"
+ 441      69616C69 
+ 441      73656400 
+ 442              	.LC8:
+ 443 0065 67656E65 		.string	"generic"
+ 443      72696300 
+ 444              	.LC9:
+ 445 006d 25733A20 		.string	"%s: dsp=%p, %s kernel\n"
+ 445      6473703D 
+ 445      25702C20 
+ 445      2573206B 
+ 445      65726E65 
+ 446              		.section	.rodata.str1.8
+ 447 004c 00000000 		.align 8
+ 448              	.LC10:
+ 449 0050 496E7661 		.string	"Invalid number of channels in chain\n"
+ 449      6C696420 
+ 449      6E756D62 
+ 449      6572206F 
+ 449      66206368 
+ 450 0075 000000   		.align 8
+ 451              	.LC11:
+ 452 0078 436F756C 		.string	"Could not allocate memory for temporary buffer.\n"
+ 452      64206E6F 
+ 452      7420616C 
+ 452      6C6F6361 
+ 452      7465206D 
+ 453              		.text
+ 454 040e 6690     		.p2align 4
+ 455              		.globl	init_dsp
+ 457              	init_dsp:
+ 458              	.LFB17:
+ 459              		.cfi_startproc
+ 460 0410 4157     		pushq	%r15
+ 461              		.cfi_def_cfa_offset 16
+ 462              		.cfi_offset 15, -16
+ 463 0412 4989FF   		movq	%rdi, %r15
+ 464 0415 4156     		pushq	%r14
+ 465              		.cfi_def_cfa_offset 24
+ 466              		.cfi_offset 14, -24
+ 467 0417 4989FE   		movq	%rdi, %r14
+ 468 041a 4155     		pushq	%r13
+ 469              		.cfi_def_cfa_offset 32
+ 470              		.cfi_offset 13, -32
+ 471 041c 4C8D2D00 		leaq	__func__.3(%rip), %r13
+ 471      000000
+ 472 0423 4154     		pushq	%r12
+ 473              		.cfi_def_cfa_offset 40
+ 474              		.cfi_offset 12, -40
+ 475 0425 4C8D2500 		leaq	.LC9(%rip), %r12
+ 475      000000
+ 476 042c 55       		pushq	%rbp
+ 477              		.cfi_def_cfa_offset 48
+ 478              		.cfi_offset 6, -48
+ 479 042d 53       		pushq	%rbx
+ 480              		.cfi_def_cfa_offset 56
+ 481              		.cfi_offset 3, -56
+ 482 042e 4883EC18 		subq	$24, %rsp
+ 483              		.cfi_def_cfa_offset 80
+ 484 0432 8B87A400 		movl	164(%rdi), %eax
+ 484      0000
+ 485 0438 8B9F9C00 		movl	156(%rdi), %ebx
+ 485      0000
+ 486 043e 8944240C 		movl	%eax, 12(%rsp)
+ 487 0442 89C2     		movl	%eax, %edx
+ 488 0444 89DD     		movl	%ebx, %ebp
+ 489 0446 EB33     		jmp	.L84
+ 490 0448 0F1F8400 		.p2align 4,,10
+ 490      00000000 
+ 491              		.p2align 3
+ 492              	.L74:
+ 493 0450 418B9EA0 		movl	160(%r14), %ebx
+ 493      000000
+ 494 0457 8D53FF   		leal	-1(%rbx), %edx
+ 495 045a 83FA07   		cmpl	$7, %edx
+ 496 045d 0F87C700 		ja	.L115
+ 496      0000
+ 497              	.L82:
+ 498 0463 4D8B36   		movq	(%r14), %r14
+ 499 0466 39DD     		cmpl	%ebx, %ebp
+ 500 0468 0F4CEB   		cmovl	%ebx, %ebp
+ 501 046b 4D85F6   		testq	%r14, %r14
+ 502 046e 0F84D300 		je	.L83
+ 502      0000
+ 503              	.L116:
+ 504 0474 418B97A4 		movl	164(%r15), %edx
+ 504      000000
+ 505              	.L84:
+ 506 047b 418BB798 		movl	152(%r15), %esi
+ 506      000000
+ 507 0482 C5F96ECB 		vmovd	%ebx, %xmm1
+ 508 0486 418996A4 		movl	%edx, 164(%r14)
+ 508      000000
+ 509 048d 4C89F7   		movq	%r14, %rdi
+ 510 0490 C5F970C1 		vpshufd	$0xe0, %xmm1, %xmm0
+ 510      E0
+ 511 0495 4189B698 		movl	%esi, 152(%r14)
+ 511      000000
+ 512 049c C4C179D6 		vmovq	%xmm0, 156(%r14)
+ 512      869C0000 
+ 512      00
+ 513 04a5 41FF96D8 		call	*216(%r14)
+ 513      000000
+ 514 04ac 498B86C8 		movq	200(%r14), %rax
+ 514      000000
+ 515 04b3 4885C0   		testq	%rax, %rax
+ 516 04b6 7498     		je	.L74
+ 517 04b8 8B10     		movl	(%rax), %edx
+ 518 04ba 418BBEA4 		movl	164(%r14), %edi
+ 518      000000
+ 519 04c1 418BB69C 		movl	156(%r14), %esi
+ 519      000000
+ 520 04c8 85D2     		testl	%edx, %edx
+ 521 04ca 751B     		jne	.L78
+ 522 04cc E9A70100 		jmp	.L111
+ 522      00
+ 523              		.p2align 4,,10
+ 524 04d1 0F1F8000 		.p2align 3
+ 524      000000
+ 525              	.L76:
+ 526 04d8 8B5010   		movl	16(%rax), %edx
+ 527 04db 4883C010 		addq	$16, %rax
+ 528 04df 85D2     		testl	%edx, %edx
+ 529 04e1 0F849101 		je	.L111
+ 529      0000
+ 530              	.L78:
+ 531 04e7 39D6     		cmpl	%edx, %esi
+ 532 04e9 75ED     		jne	.L76
+ 533 04eb 3B7804   		cmpl	4(%rax), %edi
+ 534 04ee 75E8     		jne	.L76
+ 535 04f0 488B4008 		movq	8(%rax), %rax
+ 536 04f4 4C8D0500 		leaq	.LC7(%rip), %r8
+ 536      000000
+ 537 04fb 498986D0 		movq	%rax, 208(%r14)
+ 537      000000
+ 538              	.L81:
+ 539 0502 4C89EA   		movq	%r13, %rdx
+ 540 0505 4C89F1   		movq	%r14, %rcx
+ 541 0508 4C89E6   		movq	%r12, %rsi
+ 542 050b BF020000 		movl	$2, %edi
+ 542      00
+ 543 0510 31C0     		xorl	%eax, %eax
+ 544 0512 E8000000 		call	debugprint@PLT
+ 544      00
+ 545 0517 418B9EA0 		movl	160(%r14), %ebx
+ 545      000000
+ 546 051e 8D53FF   		leal	-1(%rbx), %edx
+ 547 0521 83FA07   		cmpl	$7, %edx
+ 548 0524 0F8639FF 		jbe	.L82
+ 548      FFFF
+ 549              	.L115:
+ 550 052a 488D3D00 		leaq	.LC10(%rip), %rdi
+ 550      000000
+ 551 0531 E8000000 		call	endprogram@PLT
+ 551      00
+ 552 0536 4D8B36   		movq	(%r14), %r14
+ 553 0539 39DD     		cmpl	%ebx, %ebp
+ 554 053b 0F4CEB   		cmovl	%ebx, %ebp
+ 555 053e 4D85F6   		testq	%r14, %r14
+ 556 0541 0F852DFF 		jne	.L116
+ 556      FFFF
+ 557              	.L83:
+ 558 0547 498BBFB8 		movq	184(%r15), %rdi
+ 558      000000
+ 559 054e E8000000 		call	free@PLT
+ 559      00
+ 560 0553 8B44240C 		movl	12(%rsp), %eax
+ 561 0557 0FAFE8   		imull	%eax, %ebp
+ 562 055a 8D442D00 		leal	(%rbp,%rbp), %eax
+ 563 055e 4863ED   		movslq	%ebp, %rbp
+ 564 0561 4898     		cltq
+ 565 0563 4C8D2CAD 		leaq	0(,%rbp,4), %r13
+ 565      00000000 
+ 566 056b 488D3C85 		leaq	24(,%rax,4), %rdi
+ 566      18000000 
+ 567 0573 E8000000 		call	valloc@PLT
+ 567      00
+ 568 0578 498987B8 		movq	%rax, 184(%r15)
+ 568      000000
+ 569 057f 4989C4   		movq	%rax, %r12
+ 570 0582 4885C0   		testq	%rax, %rax
+ 571 0585 0F842701 		je	.L85
+ 571      0000
+ 572 058b 4A8D2C28 		leaq	(%rax,%r13), %rbp
+ 573 058f C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 574 0593 4E8D5C2D 		leaq	0(%rbp,%r13), %r11
+ 574      00
+ 575 0598 49C74310 		movq	$0, 16(%r11)
+ 575      00000000 
+ 576 05a0 62D17F08 		vmovdqu8	%xmm0, (%r11)
+ 576      7F03
+ 577              	.L86:
+ 578 05a6 48635424 		movslq	12(%rsp), %rdx
+ 578      0C
+ 579 05ab 4D89FA   		movq	%r15, %r10
+ 580 05ae 31FF     		xorl	%edi, %edi
+ 581 05b0 498D5B08 		leaq	8(%r11), %rbx
+ 582 05b4 4D8D7310 		leaq	16(%r11), %r14
+ 583 05b8 48C1E202 		salq	$2, %rdx
+ 584 05bc 0F1F4000 		.p2align 4,,10
+ 585              		.p2align 3
+ 586              	.L99:
+ 587 05c0 4D39D7   		cmpq	%r10, %r15
+ 588 05c3 0F84D700 		je	.L117
+ 588      0000
+ 589 05c9 4084FF   		testb	%dil, %dil
+ 590 05cc 0F85BE00 		jne	.L90
+ 590      0000
+ 591 05d2 49899A88 		movq	%rbx, 136(%r10)
+ 591      000000
+ 592              	.L91:
+ 593 05d9 4C89D8   		movq	%r11, %rax
+ 594              	.L89:
+ 595 05dc 4D63829C 		movslq	156(%r10), %r8
+ 595      000000
+ 596 05e3 49898290 		movq	%rax, 144(%r10)
+ 596      000000
+ 597 05ea 4585C0   		testl	%r8d, %r8d
+ 598 05ed 7E2D     		jle	.L98
+ 599 05ef 4889EE   		movq	%rbp, %rsi
+ 600 05f2 4C89E1   		movq	%r12, %rcx
+ 601 05f5 4F8D2CC2 		leaq	(%r10,%r8,8), %r13
+ 602 05f9 4C89D0   		movq	%r10, %rax
+ 603 05fc 0F1F4000 		.p2align 4,,10
+ 604              		.p2align 3
+ 605              	.L97:
+ 606 0600 4084FF   		testb	%dil, %dil
+ 607 0603 4989C8   		movq	%rcx, %r8
+ 608 0606 4C0F44C6 		cmove	%rsi, %r8
+ 609 060a 4883C008 		addq	$8, %rax
+ 610 060e 4801D6   		addq	%rdx, %rsi
+ 611 0611 4801D1   		addq	%rdx, %rcx
+ 612 0614 4C8900   		movq	%r8, (%rax)
+ 613 0617 4939C5   		cmpq	%rax, %r13
+ 614 061a 75E4     		jne	.L97
+ 615              	.L98:
+ 616 061c 4D6382A0 		movslq	160(%r10), %r8
+ 616      000000
+ 617 0623 4585C0   		testl	%r8d, %r8d
+ 618 0626 7E2D     		jle	.L94
+ 619 0628 4C89E6   		movq	%r12, %rsi
+ 620 062b 4889E9   		movq	%rbp, %rcx
+ 621 062e 4F8D2CC2 		leaq	(%r10,%r8,8), %r13
+ 622 0632 4C89D0   		movq	%r10, %rax
+ 623              		.p2align 4,,10
+ 624 0635 0F1F00   		.p2align 3
+ 625              	.L103:
+ 626 0638 4084FF   		testb	%dil, %dil
+ 627 063b 4989C8   		movq	%rcx, %r8
+ 628 063e 4C0F44C6 		cmove	%rsi, %r8
+ 629 0642 4883C008 		addq	$8, %rax
+ 630 0646 4801D6   		addq	%rdx, %rsi
+ 631 0649 4801D1   		addq	%rdx, %rcx
+ 632 064c 4C894040 		movq	%r8, 64(%rax)
+ 633 0650 4C39E8   		cmpq	%r13, %rax
+ 634 0653 75E3     		jne	.L103
+ 635              	.L94:
+ 636 0655 4D8B12   		movq	(%r10), %r10
+ 637 0658 83F701   		xorl	$1, %edi
+ 638 065b 4D85D2   		testq	%r10, %r10
+ 639 065e 0F855CFF 		jne	.L99
+ 639      FFFF
+ 640 0664 4883C418 		addq	$24, %rsp
+ 641              		.cfi_remember_state
+ 642              		.cfi_def_cfa_offset 56
+ 643 0668 5B       		popq	%rbx
+ 644              		.cfi_def_cfa_offset 48
+ 645 0669 5D       		popq	%rbp
+ 646              		.cfi_def_cfa_offset 40
+ 647 066a 415C     		popq	%r12
+ 648              		.cfi_def_cfa_offset 32
+ 649 066c 415D     		popq	%r13
+ 650              		.cfi_def_cfa_offset 24
+ 651 066e 415E     		popq	%r14
+ 652              		.cfi_def_cfa_offset 16
+ 653 0670 415F     		popq	%r15
+ 654              		.cfi_def_cfa_offset 8
+ 655 0672 C3       		ret
+ 656              		.p2align 4,,10
+ 657 0673 0F1F4400 		.p2align 3
+ 657      00
+ 658              	.L111:
+ 659              		.cfi_restore_state
+ 660 0678 488B4008 		movq	8(%rax), %rax
+ 661 067c 4C8D0500 		leaq	.LC8(%rip), %r8
+ 661      000000
+ 662 0683 498986D0 		movq	%rax, 208(%r14)
+ 662      000000
+ 663 068a E973FEFF 		jmp	.L81
+ 663      FF
+ 664 068f 90       		.p2align 4,,10
+ 665              		.p2align 3
+ 666              	.L90:
+ 667 0690 4D899A88 		movq	%r11, 136(%r10)
+ 667      000000
+ 668              	.L88:
+ 669 0697 4889D8   		movq	%rbx, %rax
+ 670 069a E93DFFFF 		jmp	.L89
+ 670      FF
+ 671 069f 90       		.p2align 4,,10
+ 672              		.p2align 3
+ 673              	.L117:
+ 674 06a0 4D89B788 		movq	%r14, 136(%r15)
+ 674      000000
+ 675 06a7 4084FF   		testb	%dil, %dil
+ 676 06aa 0F8429FF 		je	.L91
+ 676      FFFF
+ 677 06b0 EBE5     		jmp	.L88
+ 678              	.L85:
+ 679 06b2 488D3D00 		leaq	.LC11(%rip), %rdi
+ 679      000000
+ 680 06b9 4C89ED   		movq	%r13, %rbp
+ 681 06bc E8000000 		call	endprogram@PLT
+ 681      00
+ 682 06c1 4F8D5C2D 		leaq	0(%r13,%r13), %r11
+ 682      00
+ 683 06c6 C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 684 06ca 31C0     		xorl	%eax, %eax
+ 685 06cc 49894310 		movq	%rax, 16(%r11)
+ 686 06d0 62D17F08 		vmovdqu8	%xmm0, (%r11)
+ 686      7F03
+ 687 06d6 E9CBFEFF 		jmp	.L86
+ 687      FF
+ 688              		.cfi_endproc
+ 689              	.LFE17:
+ 691              		.section	.rodata.str1.8
+ 692 00a9 00000000 		.align 8
+ 692      000000
+ 693              	.LC12:
+ 694 00b0 436F756C 		.string	"Could not allocate memory for dsp.\n"
+ 694      64206E6F 
+ 694      7420616C 
+ 694      6C6F6361 
+ 694      7465206D 
+ 695              		.section	.rodata.str1.1
+ 696              	.LC13:
+ 697 0084 25733A20 		.string	"%s: %s can not be cloned\n"
+ 697      25732063 
+ 697      616E206E 
+ 697      6F742062 
+ 697      6520636C 
+ 698              	.LC14:
+ 699 009e 436F756C 		.string	"Could not clone dsp\n"
+ 699      64206E6F 
+ 699      7420636C 
+ 699      6F6E6520 
+ 699      6473700A 
+ 700              		.text
+ 701 06db 0F1F4400 		.p2align 4
+ 701      00
+ 702              		.globl	clone_dsp
+ 704              	clone_dsp:
+ 705              	.LFB20:
+ 706              		.cfi_startproc
+ 707 06e0 55       		pushq	%rbp
+ 708              		.cfi_def_cfa_offset 16
+ 709              		.cfi_offset 6, -16
+ 710 06e1 4889E5   		movq	%rsp, %rbp
+ 711              		.cfi_def_cfa_register 6
+ 712 06e4 4157     		pushq	%r15
+ 713 06e6 4156     		pushq	%r14
+ 714 06e8 4155     		pushq	%r13
+ 715 06ea 4154     		pushq	%r12
+ 716 06ec 53       		pushq	%rbx
+ 717 06ed 4883EC08 		subq	$8, %rsp
+ 718              		.cfi_offset 15, -24
+ 719              		.cfi_offset 14, -32
+ 720              		.cfi_offset 13, -40
+ 721              		.cfi_offset 12, -48
+ 722              		.cfi_offset 3, -56
+ 723 06f1 4885FF   		testq	%rdi, %rdi
+ 724 06f4 0F842E01 		je	.L126
+ 724      0000
+ 725 06fa 4989FD   		movq	%rdi, %r13
+ 726 06fd 4531E4   		xorl	%r12d, %r12d
+ 727 0700 4C8D3500 		leaq	__func__.2(%rip), %r14
+ 727      000000
+ 728 0707 4531FF   		xorl	%r15d, %r15d
+ 729 070a EB14     		jmp	.L125
+ 730 070c 0F1F4000 		.p2align 4,,10
+ 731              		.p2align 3
+ 732              	.L131:
+ 733 0710 4C8923   		movq	%r12, (%rbx)
+ 734 0713 4D8B6D00 		movq	0(%r13), %r13
+ 735 0717 4D85ED   		testq	%r13, %r13
+ 736 071a 0F84F100 		je	.L118
+ 736      0000
+ 737              	.L125:
+ 738 0720 BF080100 		movl	$264, %edi
+ 738      00
+ 739 0725 4C89E3   		movq	%r12, %rbx
+ 740 0728 E8000000 		call	malloc@PLT
+ 740      00
+ 741 072d 4989C4   		movq	%rax, %r12
+ 742 0730 4885C0   		testq	%rax, %rax
+ 743 0733 0F84F400 		je	.L130
+ 743      0000
+ 744              	.L120:
+ 745 0739 62D1FE48 		vmovdqu64	0(%r13), %zmm0
+ 745      6F4500
+ 746 0740 62D1FE48 		vmovdqu64	%zmm0, (%r12)
+ 746      7F0424
+ 747 0747 62D1FE48 		vmovdqu64	64(%r13), %zmm1
+ 747      6F4D01
+ 748 074e 62D1FE48 		vmovdqu64	%zmm1, 64(%r12)
+ 748      7F4C2401 
+ 749 0756 62D1FE48 		vmovdqu64	128(%r13), %zmm2
+ 749      6F5502
+ 750 075d 62D1FE48 		vmovdqu64	%zmm2, 128(%r12)
+ 750      7F542402 
+ 751 0765 62D1FE48 		vmovdqu64	192(%r13), %zmm3
+ 751      6F5D03
+ 752 076c 62D1FE48 		vmovdqu64	%zmm3, 192(%r12)
+ 752      7F5C2403 
+ 753 0774 498B8500 		movq	256(%r13), %rax
+ 753      010000
+ 754 077b 49C70424 		movq	$0, (%r12)
+ 754      00000000 
+ 755 0783 49898424 		movq	%rax, 256(%r12)
+ 755      00010000 
+ 756 078b 498BBDB0 		movq	176(%r13), %rdi
+ 756      000000
+ 757 0792 49C78424 		movq	$0, 184(%r12)
+ 757      B8000000 
+ 757      00000000 
+ 758 079e 41C78424 		movl	$0, 168(%r12)
+ 758      A8000000 
+ 758      00000000 
+ 759 07aa C5F877   		vzeroupper
+ 760 07ad E8000000 		call	strdup@PLT
+ 760      00
+ 761 07b2 49898424 		movq	%rax, 176(%r12)
+ 761      B0000000 
+ 762 07ba 498B85E8 		movq	232(%r13), %rax
+ 762      000000
+ 763 07c1 4885C0   		testq	%rax, %rax
+ 764 07c4 740C     		je	.L123
+ 765 07c6 4C89EE   		movq	%r13, %rsi
+ 766 07c9 4C89E7   		movq	%r12, %rdi
+ 767 07cc FFD0     		call	*%rax
+ 768 07ce 85C0     		testl	%eax, %eax
+ 769 07d0 7426     		je	.L122
+ 770              	.L123:
+ 771 07d2 498B8DB0 		movq	176(%r13), %rcx
+ 771      000000
+ 772 07d9 31FF     		xorl	%edi, %edi
+ 773 07db 4C89F2   		movq	%r14, %rdx
+ 774 07de 31C0     		xorl	%eax, %eax
+ 775 07e0 488D3500 		leaq	.LC13(%rip), %rsi
+ 775      000000
+ 776 07e7 E8000000 		call	debugprint@PLT
+ 776      00
+ 777 07ec 488D3D00 		leaq	.LC14(%rip), %rdi
+ 777      000000
+ 778 07f3 E8000000 		call	endprogram@PLT
+ 778      00
+ 779              	.L122:
+ 780 07f8 4885DB   		testq	%rbx, %rbx
+ 781 07fb 0F850FFF 		jne	.L131
+ 781      FFFF
+ 782 0801 4D8B6D00 		movq	0(%r13), %r13
+ 783 0805 4D89E7   		movq	%r12, %r15
+ 784 0808 4D85ED   		testq	%r13, %r13
+ 785 080b 0F850FFF 		jne	.L125
+ 785      FFFF
+ 786              	.L118:
+ 787 0811 4883C408 		addq	$8, %rsp
+ 788 0815 4C89F8   		movq	%r15, %rax
+ 789 0818 5B       		popq	%rbx
+ 790 0819 415C     		popq	%r12
+ 791 081b 415D     		popq	%r13
+ 792 081d 415E     		popq	%r14
+ 793 081f 415F     		popq	%r15
+ 794 0821 5D       		popq	%rbp
+ 795              		.cfi_remember_state
+ 796              		.cfi_def_cfa 7, 8
+ 797 0822 C3       		ret
+ 798              		.p2align 4,,10
+ 799 0823 0F1F4400 		.p2align 3
+ 799      00
+ 800              	.L126:
+ 801              		.cfi_restore_state
+ 802 0828 4531FF   		xorl	%r15d, %r15d
+ 803 082b EBE4     		jmp	.L118
+ 804              	.L130:
+ 805 082d 488D3D00 		leaq	.LC12(%rip), %rdi
+ 805      000000
+ 806 0834 E8000000 		call	endprogram@PLT
+ 806      00
+ 807 0839 E9FBFEFF 		jmp	.L120
+ 807      FF
+ 808              		.cfi_endproc
+ 809              	.LFE20:
+ 811              		.section	.rodata
+ 812              		.align 8
+ 815              	__func__.0:
+ 816 0000 636F6E74 		.string	"control_dsp"
+ 816      726F6C5F 
+ 816      64737000 
+ 817 000c 00000000 		.align 8
+ 820              	__func__.1:
+ 821 0010 70726572 		.string	"preroll_dsp"
+ 821      6F6C6C5F 
+ 821      64737000 
+ 822 001c 00000000 		.align 8
+ 825              	__func__.2:
+ 826 0020 636C6F6E 		.string	"clone_dsp"
+ 826      655F6473 
+ 826      7000
+ 827 002a 00000000 		.align 8
+ 827      0000
+ 830              	__func__.3:
+ 831 0030 696E6974 		.string	"init_dsp"
+ 831      5F647370 
+ 831      00
+ 832              		.globl	dspfuncs
+ 833              		.section	.data.rel,"aw"
+ 834              		.align 32
+ 837              	dspfuncs:
+ 838 0000 00000000 		.quad	help_gain
+ 838      00000000 
+ 839 0008 00000000 		.quad	create_gain
+ 839      00000000 
+ 840 0010 00000000 		.quad	help_gate
+ 840      00000000 
+ 841 0018 00000000 		.quad	create_gate
+ 841      00000000 
+ 842 0020 00000000 		.quad	help_iir
+ 842      00000000 
+ 843 0028 00000000 		.quad	create_iir
+ 843      00000000 
+ 844 0030 00000000 		.quad	help_fir
+ 844      00000000 
+ 845 0038 00000000 		.quad	create_fir
+ 845      00000000 
+ 846 0040 00000000 		.quad	help_so
+ 846      00000000 
+ 847 0048 00000000 		.quad	create_so
+ 847      00000000 
+ 848 0050 00000000 		.quad	help_mix
+ 848      00000000 
+ 849 0058 00000000 		.quad	create_mix
+ 849      00000000 
+ 850 0060 00000000 		.quad	help_comp
+ 850      00000000 
+ 851 0068 00000000 		.quad	create_comp
+ 851      00000000 
+ 852 0070 00000000 		.quad	help_xover
+ 852      00000000 
+ 853 0078 00000000 		.quad	create_xover
+ 853      00000000 
+ 854 0080 00000000 		.quad	0
+ 854      00000000 
+ 855 0088 00000000 		.quad	0
+ 855      00000000 
+ 856              		.globl	token
+ 857              		.section	.rodata.str1.1
+ 858              	.LC15:
+ 859 00b3 6761696E 		.string	"gain"
+ 859      00
+ 860              	.LC16:
+ 861 00b8 67617465 		.string	"gate"
+ 861      00
+ 862              	.LC17:
+ 863 00bd 69697200 		.string	"iir"
+ 864              	.LC18:
+ 865 00c1 66697200 		.string	"fir"
+ 866              	.LC19:
+ 867 00c5 736F00   		.string	"so"
+ 868              	.LC20:
+ 869 00c8 6D697800 		.string	"mix"
+ 870              	.LC21:
+ 871 00cc 636F6D70 		.string	"comp"
+ 871      00
+ 872              	.LC22:
+ 873 00d1 786F7665 		.string	"xover"
+ 873      7200
+ 874              		.section	.data.rel.ro.local,"aw"
+ 875              		.align 32
+ 878              	token:
+ 879 0000 00000000 		.quad	.LC15
+ 879      00000000 
+ 880 0008 00000000 		.quad	.LC16
+ 880      00000000 
+ 881 0010 00000000 		.quad	.LC17
+ 881      00000000 
+ 882 0018 00000000 		.quad	.LC18
+ 882      00000000 
+ 883 0020 00000000 		.quad	.LC19
+ 883      00000000 
+ 884 0028 00000000 		.quad	.LC20
+ 884      00000000 
+ 885 0030 00000000 		.quad	.LC21
+ 885      00000000 
+ 886 0038 00000000 		.quad	.LC22
+ 886      00000000 
+ 887 0040 00000000 		.quad	0
+ 887      00000000 
+ 888              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 889              		.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,7886 @@
+   1              		.file	"file-qdsp.c"
+   2              		.text
+   3              		.section	.rodata.str1.1,"aMS",@progbits,1
+   4              	.LC0:
+   5 0000 25733A20 		.string	"%s: could not send reply\n"
+   5      636F756C 
+   5      64206E6F 
+   5      74207365 
+   5      6E642072 
+   6              		.text
+   7              		.p2align 4
+   9              	server_reply:
+  10              	.LFB40:
+  11              		.cfi_startproc
+  12 0000 4154     		pushq	%r12
+  13              		.cfi_def_cfa_offset 16
+  14              		.cfi_offset 12, -16
+  15 0002 55       		pushq	%rbp
+  16              		.cfi_def_cfa_offset 24
+  17              		.cfi_offset 6, -24
+  18 0003 89FD     		movl	%edi, %ebp
+  19 0005 53       		pushq	%rbx
+  20              		.cfi_def_cfa_offset 32
+  21              		.cfi_offset 3, -32
+  22 0006 4881ECD0 		subq	$464, %rsp
+  22      010000
+  23              		.cfi_def_cfa_offset 496
+  24 000d 48899424 		movq	%rdx, 304(%rsp)
+  24      30010000 
+  25 0015 48898C24 		movq	%rcx, 312(%rsp)
+  25      38010000 
+  26 001d 4C898424 		movq	%r8, 320(%rsp)
+  26      40010000 
+  27 0025 4C898C24 		movq	%r9, 328(%rsp)
+  27      48010000 
+  28 002d 84C0     		testb	%al, %al
+  29 002f 7448     		je	.L4
+  30 0031 C5F82984 		vmovaps	%xmm0, 336(%rsp)
+  30      24500100 
+  30      00
+  31 003a C5F8298C 		vmovaps	%xmm1, 352(%rsp)
+  31      24600100 
+  31      00
+  32 0043 C5F82994 		vmovaps	%xmm2, 368(%rsp)
+  32      24700100 
+  32      00
+  33 004c C5F8299C 		vmovaps	%xmm3, 384(%rsp)
+  33      24800100 
+  33      00
+  34 0055 C5F829A4 		vmovaps	%xmm4, 400(%rsp)
+  34      24900100 
+  34      00
+  35 005e C5F829AC 		vmovaps	%xmm5, 416(%rsp)
+  35      24A00100 
+  35      00
+  36 0067 C5F829B4 		vmovaps	%xmm6, 432(%rsp)
+  36      24B00100 
+  36      00
+  37 0070 C5F829BC 		vmovaps	%xmm7, 448(%rsp)
+  37      24C00100 
+  37      00
+  38              	.L4:
+  39 0079 488D8424 		leaq	496(%rsp), %rax
+  39      F0010000 
+  40 0081 4C8D6424 		leaq	32(%rsp), %r12
+  40      20
+  41 0086 4889F2   		movq	%rsi, %rdx
+  42 0089 BE000100 		movl	$256, %esi
+  42      00
+  43 008e 48894424 		movq	%rax, 16(%rsp)
+  43      10
+  44 0093 488D4C24 		leaq	8(%rsp), %rcx
+  44      08
+  45 0098 488D8424 		leaq	288(%rsp), %rax
+  45      20010000 
+  46 00a0 4C89E7   		movq	%r12, %rdi
+  47 00a3 C7442408 		movl	$16, 8(%rsp)
+  47      10000000 
+  48 00ab C744240C 		movl	$48, 12(%rsp)
+  48      30000000 
+  49 00b3 48894424 		movq	%rax, 24(%rsp)
+  49      18
+  50 00b8 E8000000 		call	vsnprintf@PLT
+  50      00
+  51 00bd BAFF0000 		movl	$255, %edx
+  51      00
+  52 00c2 4C89E6   		movq	%r12, %rsi
+  53 00c5 89EF     		movl	%ebp, %edi
+  54 00c7 39D0     		cmpl	%edx, %eax
+  55 00c9 B9004000 		movl	$16384, %ecx
+  55      00
+  56 00ce 0F4FC2   		cmovg	%edx, %eax
+  57 00d1 4863D8   		movslq	%eax, %rbx
+  58 00d4 4889DA   		movq	%rbx, %rdx
+  59 00d7 E8000000 		call	send@PLT
+  59      00
+  60 00dc 4839D8   		cmpq	%rbx, %rax
+  61 00df 741A     		je	.L5
+  62 00e1 488D1500 		leaq	__func__.1(%rip), %rdx
+  62      000000
+  63 00e8 488D3500 		leaq	.LC0(%rip), %rsi
+  63      000000
+  64 00ef BF010000 		movl	$1, %edi
+  64      00
+  65 00f4 31C0     		xorl	%eax, %eax
+  66 00f6 E8000000 		call	debugprint@PLT
+  66      00
+  67              	.L5:
+  68 00fb 4881C4D0 		addq	$464, %rsp
+  68      010000
+  69              		.cfi_def_cfa_offset 32
+  70 0102 5B       		popq	%rbx
+  71              		.cfi_def_cfa_offset 24
+  72 0103 5D       		popq	%rbp
+  73              		.cfi_def_cfa_offset 16
+  74 0104 415C     		popq	%r12
+  75              		.cfi_def_cfa_offset 8
+  76 0106 C3       		ret
+  77              		.cfi_endproc
+  78              	.LFE40:
+  80              		.section	.rodata.str1.1
+  81              	.LC1:
+  82 001a 7369675F 		.string	"sig_handler\n"
+  82      68616E64 
+  82      6C65720A 
+  82      00
+  83              	.LC2:
+  84 0027 72656365 		.string	"received SIGINT\n"
+  84      69766564 
+  84      20534947 
+  84      494E540A 
+  84      00
+  85              		.text
+  86 0107 660F1F84 		.p2align 4
+  86      00000000 
+  86      00
+  87              		.globl	sig_handler
+  89              	sig_handler:
+  90              	.LFB20:
+  91              		.cfi_startproc
+  92 0110 83FF0A   		cmpl	$10, %edi
+  93 0113 741B     		je	.L15
+  94 0115 53       		pushq	%rbx
+  95              		.cfi_def_cfa_offset 16
+  96              		.cfi_offset 3, -16
+  97 0116 31C0     		xorl	%eax, %eax
+  98 0118 89FB     		movl	%edi, %ebx
+  99 011a 488D3500 		leaq	.LC1(%rip), %rsi
+  99      000000
+ 100 0121 31FF     		xorl	%edi, %edi
+ 101 0123 E8000000 		call	debugprint@PLT
+ 101      00
+ 102 0128 83FB02   		cmpl	$2, %ebx
+ 103 012b 7413     		je	.L16
+ 104 012d 5B       		popq	%rbx
+ 105              		.cfi_def_cfa_offset 8
+ 106 012e C3       		ret
+ 107 012f 90       		.p2align 4,,10
+ 108              		.p2align 3
+ 109              	.L15:
+ 110              		.cfi_restore 3
+ 111 0130 488B0500 		movq	trace_requested@GOTPCREL(%rip), %rax
+ 111      000000
+ 112 0137 C7000100 		movl	$1, (%rax)
+ 112      0000
+ 113 013d C3       		ret
+ 114 013e 6690     		.p2align 4,,10
+ 115              		.p2align 3
+ 116              	.L16:
+ 117              		.cfi_def_cfa_offset 16
+ 118              		.cfi_offset 3, -16
+ 119 0140 31FF     		xorl	%edi, %edi
+ 120 0142 488D3500 		leaq	.LC2(%rip), %rsi
+ 120      000000
+ 121 0149 31C0     		xorl	%eax, %eax
+ 122 014b E8000000 		call	debugprint@PLT
+ 122      00
+ 123 0150 31FF     		xorl	%edi, %edi
+ 124 0152 E8000000 		call	exit@PLT
+ 124      00
+ 125              		.cfi_endproc
+ 126              	.LFE20:
+ 128              		.section	.rodata.str1.1
+ 129              	.LC3:
+ 130 0038 72656164 		.string	"reader"
+ 130      657200
+ 131              	.LC4:
+ 132 003f 72656164 		.string	"read"
+ 132      00
+ 133              		.text
+ 134 0157 660F1F84 		.p2align 4
+ 134      00000000 
+ 134      00
+ 135              		.globl	reader_thread
+ 137              	reader_thread:
+ 138              	.LFB24:
+ 139              		.cfi_startproc
+ 140 0160 4157     		pushq	%r15
+ 141              		.cfi_def_cfa_offset 16
+ 142              		.cfi_offset 15, -16
+ 143 0162 4C8D3D00 		leaq	.LC4(%rip), %r15
+ 143      000000
+ 144 0169 4156     		pushq	%r14
+ 145              		.cfi_def_cfa_offset 24
+ 146              		.cfi_offset 14, -24
+ 147 016b 4989FE   		movq	%rdi, %r14
+ 148 016e 488D3D00 		leaq	.LC3(%rip), %rdi
+ 148      000000
+ 149 0175 4155     		pushq	%r13
+ 150              		.cfi_def_cfa_offset 32
+ 151              		.cfi_offset 13, -32
+ 152 0177 4531ED   		xorl	%r13d, %r13d
+ 153 017a 4154     		pushq	%r12
+ 154              		.cfi_def_cfa_offset 40
+ 155              		.cfi_offset 12, -40
+ 156 017c 55       		pushq	%rbp
+ 157              		.cfi_def_cfa_offset 48
+ 158              		.cfi_offset 6, -48
+ 159 017d 53       		pushq	%rbx
+ 160              		.cfi_def_cfa_offset 56
+ 161              		.cfi_offset 3, -56
+ 162 017e 498D9EE8 		leaq	232(%r14), %rbx
+ 162      000000
+ 163 0185 4883EC38 		subq	$56, %rsp
+ 164              		.cfi_def_cfa_offset 112
+ 165 0189 E8000000 		call	trace_thread_name@PLT
+ 165      00
+ 166 018e 498D8648 		leaq	328(%r14), %rax
+ 166      010000
+ 167 0195 4C8B2500 		movq	tracebuf@GOTPCREL(%rip), %r12
+ 167      000000
+ 168 019c 48894424 		movq	%rax, 24(%rsp)
+ 168      18
+ 169 01a1 498D8608 		leaq	264(%r14), %rax
+ 169      010000
+ 170 01a8 48894424 		movq	%rax, 16(%rsp)
+ 170      10
+ 171 01ad 0F1F00   		.p2align 4,,10
+ 172              		.p2align 3
+ 173              	.L23:
+ 174 01b0 4489ED   		movl	%r13d, %ebp
+ 175 01b3 4183C501 		addl	$1, %r13d
+ 176 01b7 83E507   		andl	$7, %ebp
+ 177 01ba EB0E     		jmp	.L19
+ 178 01bc 0F1F4000 		.p2align 4,,10
+ 179              		.p2align 3
+ 180              	.L31:
+ 181 01c0 E8000000 		call	__errno_location@PLT
+ 181      00
+ 182 01c5 833804   		cmpl	$4, (%rax)
+ 183 01c8 750C     		jne	.L18
+ 184              	.L19:
+ 185 01ca 4889DF   		movq	%rbx, %rdi
+ 186 01cd E8000000 		call	sem_wait@PLT
+ 186      00
+ 187 01d2 85C0     		testl	%eax, %eax
+ 188 01d4 75EA     		jne	.L31
+ 189              	.L18:
+ 190 01d6 49833C24 		cmpq	$0, (%r12)
+ 190      00
+ 191 01db 7472     		je	.L20
+ 192 01dd 488D7424 		leaq	32(%rsp), %rsi
+ 192      20
+ 193 01e2 BF010000 		movl	$1, %edi
+ 193      00
+ 194 01e7 E8000000 		call	clock_gettime@PLT
+ 194      00
+ 195 01ec 498B0424 		movq	(%r12), %rax
+ 196 01f0 B9010000 		movl	$1, %ecx
+ 196      00
+ 197 01f5 F0480FC1 		lock xaddq	%rcx, 16(%rax)
+ 197      4810
+ 198 01fb 498B0424 		movq	(%r12), %rax
+ 199 01ff 4889CA   		movq	%rcx, %rdx
+ 200 0202 48235008 		andq	8(%rax), %rdx
+ 201 0206 48894C24 		movq	%rcx, 8(%rsp)
+ 201      08
+ 202 020b 48C1E205 		salq	$5, %rdx
+ 203 020f 480310   		addq	(%rax), %rdx
+ 204 0212 48C70200 		movq	$0, (%rdx)
+ 204      000000
+ 205 0219 48694424 		imulq	$1000000000, 32(%rsp), %rax
+ 205      2000CA9A 
+ 205      3B
+ 206 0222 48034424 		addq	40(%rsp), %rax
+ 206      28
+ 207 0227 48894208 		movq	%rax, 8(%rdx)
+ 208 022b 4C897A10 		movq	%r15, 16(%rdx)
+ 209 022f 48891424 		movq	%rdx, (%rsp)
+ 210 0233 E8000000 		call	trace_tid@PLT
+ 210      00
+ 211 0238 488B1424 		movq	(%rsp), %rdx
+ 212 023c 894218   		movl	%eax, 24(%rdx)
+ 213 023f C6421C42 		movb	$66, 28(%rdx)
+ 214 0243 488B4C24 		movq	8(%rsp), %rcx
+ 214      08
+ 215 0248 4883C101 		addq	$1, %rcx
+ 216 024c 48890A   		movq	%rcx, (%rdx)
+ 217              	.L20:
+ 218 024f 488B4424 		movq	24(%rsp), %rax
+ 218      18
+ 219 0254 8B10     		movl	(%rax), %edx
+ 220 0256 31C0     		xorl	%eax, %eax
+ 221 0258 85D2     		testl	%edx, %edx
+ 222 025a 0F84B000 		je	.L32
+ 222      0000
+ 223              	.L21:
+ 224 0260 488D546D 		leaq	0(%rbp,%rbp,2), %rdx
+ 224      00
+ 225 0265 49833C24 		cmpq	$0, (%r12)
+ 225      00
+ 226 026a 498D2CD6 		leaq	(%r14,%rdx,8), %rbp
+ 227 026e 894538   		movl	%eax, 56(%rbp)
+ 228 0271 7472     		je	.L22
+ 229 0273 488D7424 		leaq	32(%rsp), %rsi
+ 229      20
+ 230 0278 BF010000 		movl	$1, %edi
+ 230      00
+ 231 027d E8000000 		call	clock_gettime@PLT
+ 231      00
+ 232 0282 498B0424 		movq	(%r12), %rax
+ 233 0286 B9010000 		movl	$1, %ecx
+ 233      00
+ 234 028b F0480FC1 		lock xaddq	%rcx, 16(%rax)
+ 234      4810
+ 235 0291 498B0424 		movq	(%r12), %rax
+ 236 0295 4889CA   		movq	%rcx, %rdx
+ 237 0298 48235008 		andq	8(%rax), %rdx
+ 238 029c 48894C24 		movq	%rcx, 8(%rsp)
+ 238      08
+ 239 02a1 48C1E205 		salq	$5, %rdx
+ 240 02a5 480310   		addq	(%rax), %rdx
+ 241 02a8 48C70200 		movq	$0, (%rdx)
+ 241      000000
+ 242 02af 48694424 		imulq	$1000000000, 32(%rsp), %rax
+ 242      2000CA9A 
+ 242      3B
+ 243 02b8 48034424 		addq	40(%rsp), %rax
+ 243      28
+ 244 02bd 48894208 		movq	%rax, 8(%rdx)
+ 245 02c1 4C897A10 		movq	%r15, 16(%rdx)
+ 246 02c5 48891424 		movq	%rdx, (%rsp)
+ 247 02c9 E8000000 		call	trace_tid@PLT
+ 247      00
+ 248 02ce 488B1424 		movq	(%rsp), %rdx
+ 249 02d2 894218   		movl	%eax, 24(%rdx)
+ 250 02d5 C6421C45 		movb	$69, 28(%rdx)
+ 251 02d9 488B4C24 		movq	8(%rsp), %rcx
+ 251      08
+ 252 02de 4883C101 		addq	$1, %rcx
+ 253 02e2 48890A   		movq	%rcx, (%rdx)
+ 254              	.L22:
+ 255 02e5 488B7C24 		movq	16(%rsp), %rdi
+ 255      10
+ 256 02ea E8000000 		call	sem_post@PLT
+ 256      00
+ 257 02ef 8B4538   		movl	56(%rbp), %eax
+ 258 02f2 85C0     		testl	%eax, %eax
+ 259 02f4 0F85B6FE 		jne	.L23
+ 259      FFFF
+ 260 02fa 4883C438 		addq	$56, %rsp
+ 261              		.cfi_remember_state
+ 262              		.cfi_def_cfa_offset 56
+ 263 02fe 31C0     		xorl	%eax, %eax
+ 264 0300 5B       		popq	%rbx
+ 265              		.cfi_def_cfa_offset 48
+ 266 0301 5D       		popq	%rbp
+ 267              		.cfi_def_cfa_offset 40
+ 268 0302 415C     		popq	%r12
+ 269              		.cfi_def_cfa_offset 32
+ 270 0304 415D     		popq	%r13
+ 271              		.cfi_def_cfa_offset 24
+ 272 0306 415E     		popq	%r14
+ 273              		.cfi_def_cfa_offset 16
+ 274 0308 415F     		popq	%r15
+ 275              		.cfi_def_cfa_offset 8
+ 276 030a C3       		ret
+ 277 030b 0F1F4400 		.p2align 4,,10
+ 277      00
+ 278              		.p2align 3
+ 279              	.L32:
+ 280              		.cfi_restore_state
+ 281 0310 488D446D 		leaq	0(%rbp,%rbp,2), %rax
+ 281      00
+ 282 0315 418B5610 		movl	16(%r14), %edx
+ 283 0319 498B3E   		movq	(%r14), %rdi
+ 284 031c 498B74C6 		movq	40(%r14,%rax,8), %rsi
+ 284      28
+ 285 0321 E8000000 		call	sf_readf_float@PLT
+ 285      00
+ 286 0326 E935FFFF 		jmp	.L21
+ 286      FF
+ 287              		.cfi_endproc
+ 288              	.LFE24:
+ 290              		.section	.rodata.str1.1
+ 291              	.LC5:
+ 292 0044 77726974 		.string	"writer"
+ 292      657200
+ 293              	.LC6:
+ 294 004b 77726974 		.string	"write"
+ 294      6500
+ 295              	.LC7:
+ 296 0051 4661696C 		.string	"Failed writing output: %s\n"
+ 296      65642077 
+ 296      72697469 
+ 296      6E67206F 
+ 296      75747075 
+ 297              		.text
+ 298 032b 0F1F4400 		.p2align 4
+ 298      00
+ 299              		.globl	writer_thread
+ 301              	writer_thread:
+ 302              	.LFB25:
+ 303              		.cfi_startproc
+ 304 0330 4157     		pushq	%r15
+ 305              		.cfi_def_cfa_offset 16
+ 306              		.cfi_offset 15, -16
+ 307 0332 4C8D3D00 		leaq	.LC6(%rip), %r15
+ 307      000000
+ 308 0339 4156     		pushq	%r14
+ 309              		.cfi_def_cfa_offset 24
+ 310              		.cfi_offset 14, -24
+ 311 033b 4155     		pushq	%r13
+ 312              		.cfi_def_cfa_offset 32
+ 313              		.cfi_offset 13, -32
+ 314 033d 4154     		pushq	%r12
+ 315              		.cfi_def_cfa_offset 40
+ 316              		.cfi_offset 12, -40
+ 317 033f 4989FC   		movq	%rdi, %r12
+ 318 0342 488D3D00 		leaq	.LC5(%rip), %rdi
+ 318      000000
+ 319 0349 55       		pushq	%rbp
+ 320              		.cfi_def_cfa_offset 48
+ 321              		.cfi_offset 6, -48
+ 322 034a 31ED     		xorl	%ebp, %ebp
+ 323 034c 53       		pushq	%rbx
+ 324              		.cfi_def_cfa_offset 56
+ 325              		.cfi_offset 3, -56
+ 326 034d 498D9C24 		leaq	296(%r12), %rbx
+ 326      28010000 
+ 327 0355 4883EC38 		subq	$56, %rsp
+ 328              		.cfi_def_cfa_offset 112
+ 329 0359 E8000000 		call	trace_thread_name@PLT
+ 329      00
+ 330 035e 488D4424 		leaq	32(%rsp), %rax
+ 330      20
+ 331 0363 48894424 		movq	%rax, 8(%rsp)
+ 331      08
+ 332 0368 498D8424 		leaq	232(%r12), %rax
+ 332      E8000000 
+ 333 0370 48890424 		movq	%rax, (%rsp)
+ 334              		.p2align 4,,10
+ 335 0374 0F1F4000 		.p2align 3
+ 336              	.L44:
+ 337 0378 448D6D01 		leal	1(%rbp), %r13d
+ 338 037c 83E507   		andl	$7, %ebp
+ 339 037f EB11     		jmp	.L35
+ 340              		.p2align 4,,10
+ 341 0381 0F1F8000 		.p2align 3
+ 341      000000
+ 342              	.L50:
+ 343 0388 E8000000 		call	__errno_location@PLT
+ 343      00
+ 344 038d 833804   		cmpl	$4, (%rax)
+ 345 0390 750C     		jne	.L34
+ 346              	.L35:
+ 347 0392 4889DF   		movq	%rbx, %rdi
+ 348 0395 E8000000 		call	sem_wait@PLT
+ 348      00
+ 349 039a 85C0     		testl	%eax, %eax
+ 350 039c 75EA     		jne	.L50
+ 351              	.L34:
+ 352 039e 488D446D 		leaq	0(%rbp,%rbp,2), %rax
+ 352      00
+ 353 03a3 4D8D34C4 		leaq	(%r12,%rax,8), %r14
+ 354 03a7 418B4638 		movl	56(%r14), %eax
+ 355 03ab 85C0     		testl	%eax, %eax
+ 356 03ad 0F849D01 		je	.L36
+ 356      0000
+ 357 03b3 418B8424 		movl	328(%r12), %eax
+ 357      48010000 
+ 358 03bb 85C0     		testl	%eax, %eax
+ 359 03bd 0F855D01 		jne	.L38
+ 359      0000
+ 360 03c3 488B2D00 		movq	tracebuf@GOTPCREL(%rip), %rbp
+ 360      000000
+ 361 03ca 48837D00 		cmpq	$0, 0(%rbp)
+ 361      00
+ 362 03cf 7474     		je	.L39
+ 363 03d1 488B7424 		movq	8(%rsp), %rsi
+ 363      08
+ 364 03d6 BF010000 		movl	$1, %edi
+ 364      00
+ 365 03db E8000000 		call	clock_gettime@PLT
+ 365      00
+ 366 03e0 488B4500 		movq	0(%rbp), %rax
+ 367 03e4 B9010000 		movl	$1, %ecx
+ 367      00
+ 368 03e9 F0480FC1 		lock xaddq	%rcx, 16(%rax)
+ 368      4810
+ 369 03ef 488B4500 		movq	0(%rbp), %rax
+ 370 03f3 4889CA   		movq	%rcx, %rdx
+ 371 03f6 48235008 		andq	8(%rax), %rdx
+ 372 03fa 48894C24 		movq	%rcx, 24(%rsp)
+ 372      18
+ 373 03ff 48C1E205 		salq	$5, %rdx
+ 374 0403 480310   		addq	(%rax), %rdx
+ 375 0406 48C70200 		movq	$0, (%rdx)
+ 375      000000
+ 376 040d 48694424 		imulq	$1000000000, 32(%rsp), %rax
+ 376      2000CA9A 
+ 376      3B
+ 377 0416 48034424 		addq	40(%rsp), %rax
+ 377      28
+ 378 041b 48894208 		movq	%rax, 8(%rdx)
+ 379 041f 4C897A10 		movq	%r15, 16(%rdx)
+ 380 0423 48895424 		movq	%rdx, 16(%rsp)
+ 380      10
+ 381 0428 E8000000 		call	trace_tid@PLT
+ 381      00
+ 382 042d 488B5424 		movq	16(%rsp), %rdx
+ 382      10
+ 383 0432 894218   		movl	%eax, 24(%rdx)
+ 384 0435 C6421C42 		movb	$66, 28(%rdx)
+ 385 0439 488B4C24 		movq	24(%rsp), %rcx
+ 385      18
+ 386 043e 4883C101 		addq	$1, %rcx
+ 387 0442 48890A   		movq	%rcx, (%rdx)
+ 388              	.L39:
+ 389 0445 498B7C24 		movq	24(%r12), %rdi
+ 389      18
+ 390 044a 418B4E38 		movl	56(%r14), %ecx
+ 391 044e 498B7630 		movq	48(%r14), %rsi
+ 392 0452 4885FF   		testq	%rdi, %rdi
+ 393 0455 0F84DD00 		je	.L40
+ 393      0000
+ 394 045b 4889F2   		movq	%rsi, %rdx
+ 395 045e 498B7424 		movq	32(%r12), %rsi
+ 395      20
+ 396 0463 E8000000 		call	quantize@PLT
+ 396      00
+ 397 0468 418B5638 		movl	56(%r14), %edx
+ 398 046c 498B7424 		movq	32(%r12), %rsi
+ 398      20
+ 399 0471 498B7C24 		movq	8(%r12), %rdi
+ 399      08
+ 400 0476 E8000000 		call	sf_writef_int@PLT
+ 400      00
+ 401              	.L41:
+ 402 047b 418B5638 		movl	56(%r14), %edx
+ 403 047f 4839C2   		cmpq	%rax, %rdx
+ 404 0482 7429     		je	.L42
+ 405 0484 498B7C24 		movq	8(%r12), %rdi
+ 405      08
+ 406 0489 E8000000 		call	sf_strerror@PLT
+ 406      00
+ 407 048e 488D3500 		leaq	.LC7(%rip), %rsi
+ 407      000000
+ 408 0495 31FF     		xorl	%edi, %edi
+ 409 0497 4889C2   		movq	%rax, %rdx
+ 410 049a 31C0     		xorl	%eax, %eax
+ 411 049c E8000000 		call	debugprint@PLT
+ 411      00
+ 412 04a1 41C78424 		movl	$1, 328(%r12)
+ 412      48010000 
+ 412      01000000 
+ 413              	.L42:
+ 414 04ad 48837D00 		cmpq	$0, 0(%rbp)
+ 414      00
+ 415 04b2 746C     		je	.L38
+ 416 04b4 488B7424 		movq	8(%rsp), %rsi
+ 416      08
+ 417 04b9 BF010000 		movl	$1, %edi
+ 417      00
+ 418 04be E8000000 		call	clock_gettime@PLT
+ 418      00
+ 419 04c3 488B4500 		movq	0(%rbp), %rax
+ 420 04c7 BA010000 		movl	$1, %edx
+ 420      00
+ 421 04cc F0480FC1 		lock xaddq	%rdx, 16(%rax)
+ 421      5010
+ 422 04d2 488B4500 		movq	0(%rbp), %rax
+ 423 04d6 4889D5   		movq	%rdx, %rbp
+ 424 04d9 48236808 		andq	8(%rax), %rbp
+ 425 04dd 48895424 		movq	%rdx, 16(%rsp)
+ 425      10
+ 426 04e2 48C1E505 		salq	$5, %rbp
+ 427 04e6 480328   		addq	(%rax), %rbp
+ 428 04e9 48C74500 		movq	$0, 0(%rbp)
+ 428      00000000 
+ 429 04f1 48694424 		imulq	$1000000000, 32(%rsp), %rax
+ 429      2000CA9A 
+ 429      3B
+ 430 04fa 48034424 		addq	40(%rsp), %rax
+ 430      28
+ 431 04ff 48894508 		movq	%rax, 8(%rbp)
+ 432 0503 4C897D10 		movq	%r15, 16(%rbp)
+ 433 0507 E8000000 		call	trace_tid@PLT
+ 433      00
+ 434 050c 894518   		movl	%eax, 24(%rbp)
+ 435 050f C6451C45 		movb	$69, 28(%rbp)
+ 436 0513 488B5424 		movq	16(%rsp), %rdx
+ 436      10
+ 437 0518 4883C201 		addq	$1, %rdx
+ 438 051c 48895500 		movq	%rdx, 0(%rbp)
+ 439              	.L38:
+ 440 0520 488B3C24 		movq	(%rsp), %rdi
+ 441 0524 4489ED   		movl	%r13d, %ebp
+ 442 0527 E8000000 		call	sem_post@PLT
+ 442      00
+ 443 052c E947FEFF 		jmp	.L44
+ 443      FF
+ 444              		.p2align 4,,10
+ 445 0531 0F1F8000 		.p2align 3
+ 445      000000
+ 446              	.L40:
+ 447 0538 498B7C24 		movq	8(%r12), %rdi
+ 447      08
+ 448 053d 89CA     		movl	%ecx, %edx
+ 449 053f E8000000 		call	sf_writef_float@PLT
+ 449      00
+ 450 0544 E932FFFF 		jmp	.L41
+ 450      FF
+ 451 0549 0F1F8000 		.p2align 4,,10
+ 451      000000
+ 452              		.p2align 3
+ 453              	.L36:
+ 454 0550 4883C438 		addq	$56, %rsp
+ 455              		.cfi_def_cfa_offset 56
+ 456 0554 31C0     		xorl	%eax, %eax
+ 457 0556 5B       		popq	%rbx
+ 458              		.cfi_def_cfa_offset 48
+ 459 0557 5D       		popq	%rbp
+ 460              		.cfi_def_cfa_offset 40
+ 461 0558 415C     		popq	%r12
+ 462              		.cfi_def_cfa_offset 32
+ 463 055a 415D     		popq	%r13
+ 464              		.cfi_def_cfa_offset 24
+ 465 055c 415E     		popq	%r14
+ 466              		.cfi_def_cfa_offset 16
+ 467 055e 415F     		popq	%r15
+ 468              		.cfi_def_cfa_offset 8
+ 469 0560 C3       		ret
+ 470              		.cfi_endproc
+ 471              	.LFE25:
+ 473 0561 66662E0F 		.p2align 4
+ 473      1F840000 
+ 473      0000000F 
+ 473      1F4000
+ 474              		.globl	get_debuglevel
+ 476              	get_debuglevel:
+ 477              	.LFB17:
+ 478              		.cfi_startproc
+ 479 0570 488B0500 		movq	debuglevel@GOTPCREL(%rip), %rax
+ 479      000000
+ 480 0577 8B00     		movl	(%rax), %eax
+ 481 0579 C3       		ret
+ 482              		.cfi_endproc
+ 483              	.LFE17:
+ 485              		.section	.rodata.str1.1
+ 486              	.LC8:
+ 487 006c 70657269 		.string	"period"
+ 487      6F6400
+ 488              		.text
+ 489 057a 660F1F44 		.p2align 4
+ 489      0000
+ 490              		.globl	process
+ 492              	process:
+ 493              	.LFB18:
+ 494              		.cfi_startproc
+ 495 0580 4157     		pushq	%r15
+ 496              		.cfi_def_cfa_offset 16
+ 497              		.cfi_offset 15, -16
+ 498 0582 4156     		pushq	%r14
+ 499              		.cfi_def_cfa_offset 24
+ 500              		.cfi_offset 14, -24
+ 501 0584 4155     		pushq	%r13
+ 502              		.cfi_def_cfa_offset 32
+ 503              		.cfi_offset 13, -32
+ 504 0586 4154     		pushq	%r12
+ 505              		.cfi_def_cfa_offset 40
+ 506              		.cfi_offset 12, -40
+ 507 0588 55       		pushq	%rbp
+ 508              		.cfi_def_cfa_offset 48
+ 509              		.cfi_offset 6, -48
+ 510 0589 53       		pushq	%rbx
+ 511              		.cfi_def_cfa_offset 56
+ 512              		.cfi_offset 3, -56
+ 513 058a 4889F3   		movq	%rsi, %rbx
+ 514 058d 4883EC28 		subq	$40, %rsp
+ 515              		.cfi_def_cfa_offset 96
+ 516 0591 4C8B2500 		movq	tracebuf@GOTPCREL(%rip), %r12
+ 516      000000
+ 517 0598 897C240C 		movl	%edi, 12(%rsp)
+ 518 059c 498B0424 		movq	(%r12), %rax
+ 519 05a0 4885C0   		testq	%rax, %rax
+ 520 05a3 0F844702 		je	.L53
+ 520      0000
+ 521 05a9 488D7424 		leaq	16(%rsp), %rsi
+ 521      10
+ 522 05ae BF010000 		movl	$1, %edi
+ 522      00
+ 523 05b3 41BD0100 		movl	$1, %r13d
+ 523      0000
+ 524 05b9 E8000000 		call	clock_gettime@PLT
+ 524      00
+ 525 05be 498B0424 		movq	(%r12), %rax
+ 526 05c2 F04C0FC1 		lock xaddq	%r13, 16(%rax)
+ 526      6810
+ 527 05c8 498B0424 		movq	(%r12), %rax
+ 528 05cc 488B6808 		movq	8(%rax), %rbp
+ 529 05d0 4C21ED   		andq	%r13, %rbp
+ 530 05d3 4983C501 		addq	$1, %r13
+ 531 05d7 48C1E505 		salq	$5, %rbp
+ 532 05db 480328   		addq	(%rax), %rbp
+ 533 05de 48C74500 		movq	$0, 0(%rbp)
+ 533      00000000 
+ 534 05e6 48694424 		imulq	$1000000000, 16(%rsp), %rax
+ 534      1000CA9A 
+ 534      3B
+ 535 05ef 48034424 		addq	24(%rsp), %rax
+ 535      18
+ 536 05f4 48894508 		movq	%rax, 8(%rbp)
+ 537 05f8 488D0500 		leaq	.LC8(%rip), %rax
+ 537      000000
+ 538 05ff 48894510 		movq	%rax, 16(%rbp)
+ 539 0603 E8000000 		call	trace_tid@PLT
+ 539      00
+ 540 0608 894518   		movl	%eax, 24(%rbp)
+ 541 060b C6451C42 		movb	$66, 28(%rbp)
+ 542 060f 4C896D00 		movq	%r13, 0(%rbp)
+ 543 0613 498B0424 		movq	(%r12), %rax
+ 544 0617 4885DB   		testq	%rbx, %rbx
+ 545 061a 0F844901 		je	.L60
+ 545      0000
+ 546              	.L64:
+ 547 0620 488D4C24 		leaq	16(%rsp), %rcx
+ 547      10
+ 548 0625 4531ED   		xorl	%r13d, %r13d
+ 549 0628 48890C24 		movq	%rcx, (%rsp)
+ 550 062c EB05     		jmp	.L59
+ 551 062e 6690     		.p2align 4,,10
+ 552              		.p2align 3
+ 553              	.L65:
+ 554 0630 4889D3   		movq	%rdx, %rbx
+ 555              	.L59:
+ 556 0633 8B4C240C 		movl	12(%rsp), %ecx
+ 557 0637 8383A800 		addl	$1, 168(%rbx)
+ 557      000001
+ 558 063e 898BA400 		movl	%ecx, 164(%rbx)
+ 558      0000
+ 559 0644 4885C0   		testq	%rax, %rax
+ 560 0647 7469     		je	.L55
+ 561 0649 488B3424 		movq	(%rsp), %rsi
+ 562 064d BF010000 		movl	$1, %edi
+ 562      00
+ 563 0652 4C8BBBB0 		movq	176(%rbx), %r15
+ 563      000000
+ 564 0659 41BE0100 		movl	$1, %r14d
+ 564      0000
+ 565 065f E8000000 		call	clock_gettime@PLT
+ 565      00
+ 566 0664 498B0424 		movq	(%r12), %rax
+ 567 0668 F04C0FC1 		lock xaddq	%r14, 16(%rax)
+ 567      7010
+ 568 066e 498B0424 		movq	(%r12), %rax
+ 569 0672 488B6808 		movq	8(%rax), %rbp
+ 570 0676 4C21F5   		andq	%r14, %rbp
+ 571 0679 48C1E505 		salq	$5, %rbp
+ 572 067d 480328   		addq	(%rax), %rbp
+ 573 0680 48C74500 		movq	$0, 0(%rbp)
+ 573      00000000 
+ 574 0688 48694424 		imulq	$1000000000, 16(%rsp), %rax
+ 574      1000CA9A 
+ 574      3B
+ 575 0691 48034424 		addq	24(%rsp), %rax
+ 575      18
+ 576 0696 48894508 		movq	%rax, 8(%rbp)
+ 577 069a 4C897D10 		movq	%r15, 16(%rbp)
+ 578 069e E8000000 		call	trace_tid@PLT
+ 578      00
+ 579 06a3 498D5601 		leaq	1(%r14), %rdx
+ 580 06a7 894518   		movl	%eax, 24(%rbp)
+ 581 06aa C6451C42 		movb	$66, 28(%rbp)
+ 582 06ae 48895500 		movq	%rdx, 0(%rbp)
+ 583              	.L55:
+ 584 06b2 488B3D00 		movq	profile(%rip), %rdi
+ 584      000000
+ 585 06b9 4885FF   		testq	%rdi, %rdi
+ 586 06bc 7408     		je	.L56
+ 587 06be 4489EE   		movl	%r13d, %esi
+ 588 06c1 E8000000 		call	profile_begin@PLT
+ 588      00
+ 589              	.L56:
+ 590 06c6 4889DF   		movq	%rbx, %rdi
+ 591 06c9 FF93D000 		call	*208(%rbx)
+ 591      0000
+ 592 06cf 488B3D00 		movq	profile(%rip), %rdi
+ 592      000000
+ 593 06d6 4885FF   		testq	%rdi, %rdi
+ 594 06d9 7408     		je	.L57
+ 595 06db 4489EE   		movl	%r13d, %esi
+ 596 06de E8000000 		call	profile_end@PLT
+ 596      00
+ 597              	.L57:
+ 598 06e3 498B0424 		movq	(%r12), %rax
+ 599 06e7 4885C0   		testq	%rax, %rax
+ 600 06ea 746D     		je	.L58
+ 601 06ec 488B3424 		movq	(%rsp), %rsi
+ 602 06f0 BF010000 		movl	$1, %edi
+ 602      00
+ 603 06f5 4C8BBBB0 		movq	176(%rbx), %r15
+ 603      000000
+ 604 06fc 41BE0100 		movl	$1, %r14d
+ 604      0000
+ 605 0702 E8000000 		call	clock_gettime@PLT
+ 605      00
+ 606 0707 498B0424 		movq	(%r12), %rax
+ 607 070b F04C0FC1 		lock xaddq	%r14, 16(%rax)
+ 607      7010
+ 608 0711 498B0424 		movq	(%r12), %rax
+ 609 0715 488B6808 		movq	8(%rax), %rbp
+ 610 0719 4C21F5   		andq	%r14, %rbp
+ 611 071c 48C1E505 		salq	$5, %rbp
+ 612 0720 480328   		addq	(%rax), %rbp
+ 613 0723 48C74500 		movq	$0, 0(%rbp)
+ 613      00000000 
+ 614 072b 48694424 		imulq	$1000000000, 16(%rsp), %rax
+ 614      1000CA9A 
+ 614      3B
+ 615 0734 48034424 		addq	24(%rsp), %rax
+ 615      18
+ 616 0739 48894508 		movq	%rax, 8(%rbp)
+ 617 073d 4C897D10 		movq	%r15, 16(%rbp)
+ 618 0741 E8000000 		call	trace_tid@PLT
+ 618      00
+ 619 0746 498D5601 		leaq	1(%r14), %rdx
+ 620 074a 894518   		movl	%eax, 24(%rbp)
+ 621 074d C6451C45 		movb	$69, 28(%rbp)
+ 622 0751 48895500 		movq	%rdx, 0(%rbp)
+ 623 0755 498B0424 		movq	(%r12), %rax
+ 624              	.L58:
+ 625 0759 488B13   		movq	(%rbx), %rdx
+ 626 075c 4183C501 		addl	$1, %r13d
+ 627 0760 4885D2   		testq	%rdx, %rdx
+ 628 0763 0F85C7FE 		jne	.L65
+ 628      FFFF
+ 629              	.L60:
+ 630 0769 4885C0   		testq	%rax, %rax
+ 631 076c 746A     		je	.L63
+ 632 076e 488D7424 		leaq	16(%rsp), %rsi
+ 632      10
+ 633 0773 BF010000 		movl	$1, %edi
+ 633      00
+ 634 0778 41BD0100 		movl	$1, %r13d
+ 634      0000
+ 635 077e E8000000 		call	clock_gettime@PLT
+ 635      00
+ 636 0783 498B0424 		movq	(%r12), %rax
+ 637 0787 F04C0FC1 		lock xaddq	%r13, 16(%rax)
+ 637      6810
+ 638 078d 498B0424 		movq	(%r12), %rax
+ 639 0791 488B6808 		movq	8(%rax), %rbp
+ 640 0795 4C21ED   		andq	%r13, %rbp
+ 641 0798 4983C501 		addq	$1, %r13
+ 642 079c 48C1E505 		salq	$5, %rbp
+ 643 07a0 480328   		addq	(%rax), %rbp
+ 644 07a3 48C74500 		movq	$0, 0(%rbp)
+ 644      00000000 
+ 645 07ab 48694424 		imulq	$1000000000, 16(%rsp), %rax
+ 645      1000CA9A 
+ 645      3B
+ 646 07b4 48034424 		addq	24(%rsp), %rax
+ 646      18
+ 647 07b9 48894508 		movq	%rax, 8(%rbp)
+ 648 07bd 488D0500 		leaq	.LC8(%rip), %rax
+ 648      000000
+ 649 07c4 48894510 		movq	%rax, 16(%rbp)
+ 650 07c8 E8000000 		call	trace_tid@PLT
+ 650      00
+ 651 07cd 894518   		movl	%eax, 24(%rbp)
+ 652 07d0 C6451C45 		movb	$69, 28(%rbp)
+ 653 07d4 4C896D00 		movq	%r13, 0(%rbp)
+ 654              	.L63:
+ 655 07d8 4889D8   		movq	%rbx, %rax
+ 656              	.L52:
+ 657 07db 4883C428 		addq	$40, %rsp
+ 658              		.cfi_remember_state
+ 659              		.cfi_def_cfa_offset 56
+ 660 07df 5B       		popq	%rbx
+ 661              		.cfi_def_cfa_offset 48
+ 662 07e0 5D       		popq	%rbp
+ 663              		.cfi_def_cfa_offset 40
+ 664 07e1 415C     		popq	%r12
+ 665              		.cfi_def_cfa_offset 32
+ 666 07e3 415D     		popq	%r13
+ 667              		.cfi_def_cfa_offset 24
+ 668 07e5 415E     		popq	%r14
+ 669              		.cfi_def_cfa_offset 16
+ 670 07e7 415F     		popq	%r15
+ 671              		.cfi_def_cfa_offset 8
+ 672 07e9 C3       		ret
+ 673 07ea 660F1F44 		.p2align 4,,10
+ 673      0000
+ 674              		.p2align 3
+ 675              	.L53:
+ 676              		.cfi_restore_state
+ 677 07f0 4885F6   		testq	%rsi, %rsi
+ 678 07f3 0F8527FE 		jne	.L64
+ 678      FFFF
+ 679 07f9 31C0     		xorl	%eax, %eax
+ 680 07fb EBDE     		jmp	.L52
+ 681              		.cfi_endproc
+ 682              	.LFE18:
+ 684              		.section	.rodata.str1.8,"aMS",@progbits,1
+ 685              		.align 8
+ 686              	.LC9:
+ 687 0000 66696C65 		.string	"file-qdsp -i inputfile -o outputfile [general-options] -p dsp-name <dsp-options> [-p ...]
+ 687      2D716473 
+ 687      70202D69 
+ 687      20696E70 
+ 687      75746669 
+ 688 005b 00000000 		.align 8
+ 688      00
+ 689              	.LC10:
+ 690 0060 66696C65 		.string	"file-qdsp -b batchfile [-j workers] [general-options] -p dsp-name <dsp-options> [-p ...]\
+ 690      2D716473 
+ 690      70202D62 
+ 690      20626174 
+ 690      63686669 
+ 691 00ba 00000000 		.align 8
+ 691      0000
+ 692              	.LC11:
+ 693 00c0 66696C65 		.string	"file-qdsp -L socket [-j workers] [general-options] -p dsp-name <dsp-options> [-p ...]\n\n
+ 693      2D716473 
+ 693      70202D4C 
+ 693      20736F63 
+ 693      6B657420 
+ 694              		.section	.rodata.str1.1
+ 695              	.LC12:
+ 696 0073 66393735 		.string	"f975-dirty"
+ 696      2D646972 
+ 696      747900
+ 697              	.LC13:
+ 698 007e 56657273 		.string	"Version: %s\n"
+ 698      696F6E3A 
+ 698      2025730A 
+ 698      00
+ 699              	.LC14:
+ 700 008b 47656E65 		.string	"General options\n"
+ 700      72616C20 
+ 700      6F707469 
+ 700      6F6E730A 
+ 700      00
+ 701              		.section	.rodata.str1.8
+ 702              		.align 8
+ 703              	.LC15:
+ 704 0118 202D6920 		.string	" -i input filename, all types supported by libsndfile, - for stdin\n"
+ 704      696E7075 
+ 704      74206669 
+ 704      6C656E61 
+ 704      6D652C20 
+ 705 015c 00000000 		.align 8
+ 706              	.LC16:
+ 707 0160 202D6F20 		.string	" -o output filename, all types supported by libsndfile, - for stdout\n"
+ 707      6F757470 
+ 707      75742066 
+ 707      696C656E 
+ 707      616D652C 
+ 708 01a6 0000     		.align 8
+ 709              	.LC17:
+ 710 01a8 202D6E20 		.string	" -n framesize the chain runs at in samples, default=1024, must be a power-of-two,\n"
+ 710      6672616D 
+ 710      6573697A 
+ 710      65207468 
+ 710      65206368 
+ 711 01fb 00000000 		.align 8
+ 711      00
+ 712              	.LC18:
+ 713 0200 20202020 		.string	"    auto to fit the chain's buffers in the L1 data cache\n"
+ 713      6175746F 
+ 713      20746F20 
+ 713      66697420 
+ 713      74686520 
+ 714 023a 00000000 		.align 8
+ 714      0000
+ 715              	.LC19:
+ 716 0240 202D6320 		.string	" -c frames read and written at a time, default=65536, rounded up to whole framesizes\n"
+ 716      6672616D 
+ 716      65732072 
+ 716      65616420 
+ 716      616E6420 
+ 717 0296 0000     		.align 8
+ 718              	.LC20:
+ 719 0298 202D6420 		.string	" -d dither for 8 to 32 bit PCM output, none, tpdf or shaped, default=tpdf\n"
+ 719      64697468 
+ 719      65722066 
+ 719      6F722038 
+ 719      20746F20 
+ 720 02e3 00000000 		.align 8
+ 720      00
+ 721              	.LC21:
+ 722 02e8 202D6720 		.string	" -g write the chain as C source to filename, see dsp 'so'\n"
+ 722      77726974 
+ 722      65207468 
+ 722      65206368 
+ 722      61696E20 
+ 723 0323 00000000 		.align 8
+ 723      00
+ 724              	.LC22:
+ 725 0328 202D5420 		.string	" -T write a Chrome/Perfetto trace to filename on exit and on SIGUSR1\n"
+ 725      77726974 
+ 725      65206120 
+ 725      4368726F 
+ 725      6D652F50 
+ 726 036e 0000     		.align 8
+ 727              	.LC23:
+ 728 0370 202D502C 		.string	" -P, --profile print per stage hardware performance counters at exit,\n"
+ 728      202D2D70 
+ 728      726F6669 
+ 728      6C652070 
+ 728      72696E74 
+ 729 03b7 00       		.align 8
+ 730              	.LC24:
+ 731 03b8 20202020 		.string	"    of the processing thread only, without stages' work on OpenMP threads\n"
+ 731      6F662074 
+ 731      68652070 
+ 731      726F6365 
+ 731      7373696E 
+ 732 0403 00000000 		.align 8
+ 732      00
+ 733              	.LC25:
+ 734 0408 202D6220 		.string	" -b batch mode, process the input output filename pairs listed in filename, one pair per 
+ 734      62617463 
+ 734      68206D6F 
+ 734      64652C20 
+ 734      70726F63 
+ 735 0467 00       		.align 8
+ 736              	.LC26:
+ 737 0468 202D4C20 		.string	" -L serve \"file <input> <output>\" requests, or input and output descriptors passed with
+ 737      73657276 
+ 737      65202266 
+ 737      696C6520 
+ 737      3C696E70 
+ 738 04c1 00000000 		.align 8
+ 738      000000
+ 739              	.LC27:
+ 740 04c8 20202020 		.string	"    an \"fd\" request, on a Unix seqpacket socket at filename. \"control <stage> <options
+ 740      616E2022 
+ 740      66642220 
+ 740      72657175 
+ 740      6573742C 
+ 741 0522 00000000 		.align 8
+ 741      0000
+ 742              	.LC28:
+ 743 0528 20202020 		.string	"    changes runtime options of a stage, counted from 0\n"
+ 743      6368616E 
+ 743      67657320 
+ 743      72756E74 
+ 743      696D6520 
+ 744              		.align 8
+ 745              	.LC29:
+ 746 0560 202D6A20 		.string	" -j number of batch, segment or server workers, default is the number of CPUs\n"
+ 746      6E756D62 
+ 746      6572206F 
+ 746      66206261 
+ 746      7463682C 
+ 747 05af 00       		.align 8
+ 748              	.LC30:
+ 749 05b0 202D5320 		.string	" -S process the input in segments of this many seconds in parallel\n"
+ 749      70726F63 
+ 749      65737320 
+ 749      74686520 
+ 749      696E7075 
+ 750 05f4 00000000 		.align 8
+ 751              	.LC31:
+ 752 05f8 202D4520 		.string	" -E largest difference from a serial run allowed at segment seams, default=1e-6\n"
+ 752      6C617267 
+ 752      65737420 
+ 752      64696666 
+ 752      6572656E 
+ 753              		.section	.rodata.str1.1
+ 754              	.LC32:
+ 755 009c 202D7220 		.string	" -r raw file options:\n"
+ 755      72617720 
+ 755      66696C65 
+ 755      206F7074 
+ 755      696F6E73 
+ 756              		.section	.rodata.str1.8
+ 757 0649 00000000 		.align 8
+ 757      000000
+ 758              	.LC33:
+ 759 0650 20202020 		.string	"    c=channels\n    r=samplerate in Hz\n    f=format 1=S8,2=S16,3=S24,4=S32,5=U8,6=F32\n"
+ 759      633D6368 
+ 759      616E6E65 
+ 759      6C730A20 
+ 759      20202072 
+ 760              		.section	.rodata.str1.1
+ 761              	.LC34:
+ 762 00b3 0A445350 		.string	"\nDSP options\n"
+ 762      206F7074 
+ 762      696F6E73 
+ 762      0A00
+ 763              	.LC35:
+ 764 00c1 0A00     		.string	"\n"
+ 765              		.text
+ 766 07fd 0F1F00   		.p2align 4
+ 767              		.globl	print_help
+ 769              	print_help:
+ 770              	.LFB19:
+ 771              		.cfi_startproc
+ 772 0800 55       		pushq	%rbp
+ 773              		.cfi_def_cfa_offset 16
+ 774              		.cfi_offset 6, -16
+ 775 0801 31FF     		xorl	%edi, %edi
+ 776 0803 31C0     		xorl	%eax, %eax
+ 777 0805 488D3500 		leaq	.LC9(%rip), %rsi
+ 777      000000
+ 778 080c 53       		pushq	%rbx
+ 779              		.cfi_def_cfa_offset 24
+ 780              		.cfi_offset 3, -24
+ 781 080d 4883EC08 		subq	$8, %rsp
+ 782              		.cfi_def_cfa_offset 32
+ 783 0811 E8000000 		call	debugprint@PLT
+ 783      00
+ 784 0816 31FF     		xorl	%edi, %edi
+ 785 0818 31C0     		xorl	%eax, %eax
+ 786 081a 488D3500 		leaq	.LC10(%rip), %rsi
+ 786      000000
+ 787 0821 E8000000 		call	debugprint@PLT
+ 787      00
+ 788 0826 31FF     		xorl	%edi, %edi
+ 789 0828 31C0     		xorl	%eax, %eax
+ 790 082a 488D3500 		leaq	.LC11(%rip), %rsi
+ 790      000000
+ 791 0831 E8000000 		call	debugprint@PLT
+ 791      00
+ 792 0836 488D1500 		leaq	.LC12(%rip), %rdx
+ 792      000000
+ 793 083d 31FF     		xorl	%edi, %edi
+ 794 083f 31C0     		xorl	%eax, %eax
+ 795 0841 488D3500 		leaq	.LC13(%rip), %rsi
+ 795      000000
+ 796 0848 E8000000 		call	debugprint@PLT
+ 796      00
+ 797 084d 31FF     		xorl	%edi, %edi
+ 798 084f 31C0     		xorl	%eax, %eax
+ 799 0851 488D3500 		leaq	.LC14(%rip), %rsi
+ 799      000000
+ 800 0858 E8000000 		call	debugprint@PLT
+ 800      00
+ 801 085d 31FF     		xorl	%edi, %edi
+ 802 085f 31C0     		xorl	%eax, %eax
+ 803 0861 488D3500 		leaq	.LC15(%rip), %rsi
+ 803      000000
+ 804 0868 E8000000 		call	debugprint@PLT
+ 804      00
+ 805 086d 31FF     		xorl	%edi, %edi
+ 806 086f 31C0     		xorl	%eax, %eax
+ 807 0871 488D3500 		leaq	.LC16(%rip), %rsi
+ 807      000000
+ 808 0878 E8000000 		call	debugprint@PLT
+ 808      00
+ 809 087d 31FF     		xorl	%edi, %edi
+ 810 087f 31C0     		xorl	%eax, %eax
+ 811 0881 488D3500 		leaq	.LC17(%rip), %rsi
+ 811      000000
+ 812 0888 E8000000 		call	debugprint@PLT
+ 812      00
+ 813 088d 31FF     		xorl	%edi, %edi
+ 814 088f 31C0     		xorl	%eax, %eax
+ 815 0891 488D3500 		leaq	.LC18(%rip), %rsi
+ 815      000000
+ 816 0898 E8000000 		call	debugprint@PLT
+ 816      00
+ 817 089d 31FF     		xorl	%edi, %edi
+ 818 089f 488D3500 		leaq	.LC19(%rip), %rsi
+ 818      000000
+ 819 08a6 31C0     		xorl	%eax, %eax
+ 820 08a8 E8000000 		call	debugprint@PLT
+ 820      00
+ 821 08ad 31FF     		xorl	%edi, %edi
+ 822 08af 488D3500 		leaq	.LC20(%rip), %rsi
+ 822      000000
+ 823 08b6 31C0     		xorl	%eax, %eax
+ 824 08b8 E8000000 		call	debugprint@PLT
+ 824      00
+ 825 08bd 31FF     		xorl	%edi, %edi
+ 826 08bf 31C0     		xorl	%eax, %eax
+ 827 08c1 488D3500 		leaq	.LC21(%rip), %rsi
+ 827      000000
+ 828 08c8 E8000000 		call	debugprint@PLT
+ 828      00
+ 829 08cd 31FF     		xorl	%edi, %edi
+ 830 08cf 31C0     		xorl	%eax, %eax
+ 831 08d1 488D3500 		leaq	.LC22(%rip), %rsi
+ 831      000000
+ 832 08d8 E8000000 		call	debugprint@PLT
+ 832      00
+ 833 08dd 31FF     		xorl	%edi, %edi
+ 834 08df 31C0     		xorl	%eax, %eax
+ 835 08e1 488D3500 		leaq	.LC23(%rip), %rsi
+ 835      000000
+ 836 08e8 E8000000 		call	debugprint@PLT
+ 836      00
+ 837 08ed 31FF     		xorl	%edi, %edi
+ 838 08ef 31C0     		xorl	%eax, %eax
+ 839 08f1 488D3500 		leaq	.LC24(%rip), %rsi
+ 839      000000
+ 840 08f8 E8000000 		call	debugprint@PLT
+ 840      00
+ 841 08fd 31FF     		xorl	%edi, %edi
+ 842 08ff 31C0     		xorl	%eax, %eax
+ 843 0901 488D3500 		leaq	.LC25(%rip), %rsi
+ 843      000000
+ 844 0908 E8000000 		call	debugprint@PLT
+ 844      00
+ 845 090d 31FF     		xorl	%edi, %edi
+ 846 090f 31C0     		xorl	%eax, %eax
+ 847 0911 488D3500 		leaq	.LC26(%rip), %rsi
+ 847      000000
+ 848 0918 E8000000 		call	debugprint@PLT
+ 848      00
+ 849 091d 31FF     		xorl	%edi, %edi
+ 850 091f 31C0     		xorl	%eax, %eax
+ 851 0921 488D3500 		leaq	.LC27(%rip), %rsi
+ 851      000000
+ 852 0928 E8000000 		call	debugprint@PLT
+ 852      00
+ 853 092d 31FF     		xorl	%edi, %edi
+ 854 092f 31C0     		xorl	%eax, %eax
+ 855 0931 488D3500 		leaq	.LC28(%rip), %rsi
+ 855      000000
+ 856 0938 E8000000 		call	debugprint@PLT
+ 856      00
+ 857 093d 31FF     		xorl	%edi, %edi
+ 858 093f 31C0     		xorl	%eax, %eax
+ 859 0941 488D3500 		leaq	.LC29(%rip), %rsi
+ 859      000000
+ 860 0948 E8000000 		call	debugprint@PLT
+ 860      00
+ 861 094d 31C0     		xorl	%eax, %eax
+ 862 094f 488D3500 		leaq	.LC30(%rip), %rsi
+ 862      000000
+ 863 0956 31FF     		xorl	%edi, %edi
+ 864 0958 E8000000 		call	debugprint@PLT
+ 864      00
+ 865 095d 31FF     		xorl	%edi, %edi
+ 866 095f 488D3500 		leaq	.LC31(%rip), %rsi
+ 866      000000
+ 867 0966 31C0     		xorl	%eax, %eax
+ 868 0968 E8000000 		call	debugprint@PLT
+ 868      00
+ 869 096d 488D3500 		leaq	.LC32(%rip), %rsi
+ 869      000000
+ 870 0974 31FF     		xorl	%edi, %edi
+ 871 0976 31C0     		xorl	%eax, %eax
+ 872 0978 E8000000 		call	debugprint@PLT
+ 872      00
+ 873 097d 488D3500 		leaq	.LC33(%rip), %rsi
+ 873      000000
+ 874 0984 31FF     		xorl	%edi, %edi
+ 875 0986 31C0     		xorl	%eax, %eax
+ 876 0988 E8000000 		call	debugprint@PLT
+ 876      00
+ 877 098d 488D3500 		leaq	.LC34(%rip), %rsi
+ 877      000000
+ 878 0994 31FF     		xorl	%edi, %edi
+ 879 0996 31C0     		xorl	%eax, %eax
+ 880 0998 E8000000 		call	debugprint@PLT
+ 880      00
+ 881 099d E8000000 		call	get_dspfuncs@PLT
+ 881      00
+ 882 09a2 488B10   		movq	(%rax), %rdx
+ 883 09a5 4885D2   		testq	%rdx, %rdx
+ 884 09a8 7429     		je	.L80
+ 885 09aa 488D5810 		leaq	16(%rax), %rbx
+ 886 09ae 488D2D00 		leaq	.LC35(%rip), %rbp
+ 886      000000
+ 887              		.p2align 4,,10
+ 888 09b5 0F1F00   		.p2align 3
+ 889              	.L81:
+ 890 09b8 FFD2     		call	*%rdx
+ 891 09ba 4883C310 		addq	$16, %rbx
+ 892 09be 4889EE   		movq	%rbp, %rsi
+ 893 09c1 31FF     		xorl	%edi, %edi
+ 894 09c3 31C0     		xorl	%eax, %eax
+ 895 09c5 E8000000 		call	debugprint@PLT
+ 895      00
+ 896 09ca 488B53F0 		movq	-16(%rbx), %rdx
+ 897 09ce 4885D2   		testq	%rdx, %rdx
+ 898 09d1 75E5     		jne	.L81
+ 899              	.L80:
+ 900 09d3 31FF     		xorl	%edi, %edi
+ 901 09d5 E8000000 		call	exit@PLT
+ 901      00
+ 902              		.cfi_endproc
+ 903              	.LFE19:
+ 905 09da 660F1F44 		.p2align 4
+ 905      0000
+ 906              		.globl	timespecsub
+ 908              	timespecsub:
+ 909              	.LFB21:
+ 910              		.cfi_startproc
+ 911 09e0 4889D0   		movq	%rdx, %rax
+ 912 09e3 4889CA   		movq	%rcx, %rdx
+ 913 09e6 4829F8   		subq	%rdi, %rax
+ 914 09e9 4829F2   		subq	%rsi, %rdx
+ 915 09ec 7802     		js	.L89
+ 916 09ee C3       		ret
+ 917 09ef 90       		.p2align 4,,10
+ 918              		.p2align 3
+ 919              	.L89:
+ 920 09f0 488D9100 		leaq	1000000000(%rcx), %rdx
+ 920      CA9A3B
+ 921 09f7 4883E801 		subq	$1, %rax
+ 922 09fb 4829F2   		subq	%rsi, %rdx
+ 923 09fe C3       		ret
+ 924              		.cfi_endproc
+ 925              	.LFE21:
+ 927 09ff 90       		.p2align 4
+ 928              		.globl	timespecadd
+ 930              	timespecadd:
+ 931              	.LFB22:
+ 932              		.cfi_startproc
+ 933 0a00 4889D0   		movq	%rdx, %rax
+ 934 0a03 488D140E 		leaq	(%rsi,%rcx), %rdx
+ 935 0a07 4801F8   		addq	%rdi, %rax
+ 936 0a0a 4881FAFF 		cmpq	$999999999, %rdx
+ 936      C99A3B
+ 937 0a11 7E0B     		jle	.L91
+ 938 0a13 4883C001 		addq	$1, %rax
+ 939 0a17 4881EA00 		subq	$1000000000, %rdx
+ 939      CA9A3B
+ 940              	.L91:
+ 941 0a1e C3       		ret
+ 942              		.cfi_endproc
+ 943              	.LFE22:
+ 945              		.section	.rodata.str1.1
+ 946              	.LC36:
+ 947 00c3 7700     		.string	"w"
+ 948              		.section	.rodata.str1.8
+ 949 06a6 0000     		.align 8
+ 950              	.LC37:
+ 951 06a8 436F756C 		.string	"Could not open file %s for writing.\n"
+ 951      64206E6F 
+ 951      74206F70 
+ 951      656E2066 
+ 951      696C6520 
+ 952              		.section	.rodata.str1.1
+ 953              	.LC38:
+ 954 00c5 00       		.string	""
+ 955              		.section	.rodata.str1.8
+ 956 06cd 000000   		.align 8
+ 957              	.LC39:
+ 958 06d0 436F756C 		.string	"Could not generate code for chain\n"
+ 958      64206E6F 
+ 958      74206765 
+ 958      6E657261 
+ 958      74652063 
+ 959              		.section	.rodata.str1.1
+ 960              	.LC40:
+ 961 00c6 57726F74 		.string	"Wrote chain source to %s\n"
+ 961      65206368 
+ 961      61696E20 
+ 961      736F7572 
+ 961      63652074 
+ 962              		.text
+ 963 0a1f 90       		.p2align 4
+ 964              		.globl	write_codegen
+ 966              	write_codegen:
+ 967              	.LFB26:
+ 968              		.cfi_startproc
+ 969 0a20 4154     		pushq	%r12
+ 970              		.cfi_def_cfa_offset 16
+ 971              		.cfi_offset 12, -16
+ 972 0a22 4989FC   		movq	%rdi, %r12
+ 973 0a25 55       		pushq	%rbp
+ 974              		.cfi_def_cfa_offset 24
+ 975              		.cfi_offset 6, -24
+ 976 0a26 4889F5   		movq	%rsi, %rbp
+ 977 0a29 488D3500 		leaq	.LC36(%rip), %rsi
+ 977      000000
+ 978 0a30 53       		pushq	%rbx
+ 979              		.cfi_def_cfa_offset 32
+ 980              		.cfi_offset 3, -32
+ 981 0a31 4889EF   		movq	%rbp, %rdi
+ 982 0a34 E8000000 		call	fopen@PLT
+ 982      00
+ 983 0a39 4889C3   		movq	%rax, %rbx
+ 984 0a3c 4885C0   		testq	%rax, %rax
+ 985 0a3f 743D     		je	.L99
+ 986              	.L93:
+ 987 0a41 4889DE   		movq	%rbx, %rsi
+ 988 0a44 4C89E7   		movq	%r12, %rdi
+ 989 0a47 E8000000 		call	codegen_dsp@PLT
+ 989      00
+ 990 0a4c 85C0     		testl	%eax, %eax
+ 991 0a4e 7520     		jne	.L100
+ 992              	.L94:
+ 993 0a50 4889DF   		movq	%rbx, %rdi
+ 994 0a53 E8000000 		call	fclose@PLT
+ 994      00
+ 995 0a58 5B       		popq	%rbx
+ 996              		.cfi_remember_state
+ 997              		.cfi_def_cfa_offset 24
+ 998 0a59 4889EA   		movq	%rbp, %rdx
+ 999 0a5c 488D3500 		leaq	.LC40(%rip), %rsi
+ 999      000000
+ 1000 0a63 5D       		popq	%rbp
+ 1001              		.cfi_def_cfa_offset 16
+ 1002 0a64 31FF     		xorl	%edi, %edi
+ 1003 0a66 31C0     		xorl	%eax, %eax
+ 1004 0a68 415C     		popq	%r12
+ 1005              		.cfi_def_cfa_offset 8
+ 1006 0a6a E9000000 		jmp	debugprint@PLT
+ 1006      00
+ 1007 0a6f 90       		.p2align 4,,10
+ 1008              		.p2align 3
+ 1009              	.L100:
+ 1010              		.cfi_restore_state
+ 1011 0a70 488D3D00 		leaq	.LC39(%rip), %rdi
+ 1011      000000
+ 1012 0a77 E8000000 		call	endprogram@PLT
+ 1012      00
+ 1013 0a7c EBD2     		jmp	.L94
+ 1014              	.L99:
+ 1015 0a7e 31FF     		xorl	%edi, %edi
+ 1016 0a80 4889EA   		movq	%rbp, %rdx
+ 1017 0a83 488D3500 		leaq	.LC37(%rip), %rsi
+ 1017      000000
+ 1018 0a8a 31C0     		xorl	%eax, %eax
+ 1019 0a8c E8000000 		call	debugprint@PLT
+ 1019      00
+ 1020 0a91 488D3D00 		leaq	.LC38(%rip), %rdi
+ 1020      000000
+ 1021 0a98 E8000000 		call	endprogram@PLT
+ 1021      00
+ 1022 0a9d EBA2     		jmp	.L93
+ 1023              		.cfi_endproc
+ 1024              	.LFE26:
+ 1026              		.section	.rodata.str1.1
+ 1027              	.LC41:
+ 1028 00e0 6300     		.string	"c"
+ 1029              	.LC42:
+ 1030 00e2 7200     		.string	"r"
+ 1031              	.LC43:
+ 1032 00e4 6600     		.string	"f"
+ 1033              		.section	.rodata.str1.8
+ 1034 06f3 00000000 		.align 8
+ 1034      00
+ 1035              	.LC44:
+ 1036 06f8 4D697373 		.string	"Missing value for suboption '%s'\n"
+ 1036      696E6720 
+ 1036      76616C75 
+ 1036      6520666F 
+ 1036      72207375 
+ 1037              		.section	.rodata.str1.1
+ 1038              	.LC45:
+ 1039 00e6 7261775F 		.string	"raw_fs=%d\n"
+ 1039      66733D25 
+ 1039      640A00
+ 1040              	.LC46:
+ 1041 00f1 7261775F 		.string	"raw_ch=%d\n"
+ 1041      63683D25 
+ 1041      640A00
+ 1042              	.LC47:
+ 1043 00fc 7261775F 		.string	"raw_format=%d\n"
+ 1043      666F726D 
+ 1043      61743D25 
+ 1043      640A00
+ 1044              		.section	.rodata.str1.8
+ 1045 071a 00000000 		.align 8
+ 1045      0000
+ 1046              	.LC48:
+ 1047 0720 25733A20 		.string	"%s: No match found for token: /%s/\n"
+ 1047      4E6F206D 
+ 1047      61746368 
+ 1047      20666F75 
+ 1047      6E642066 
+ 1048 0744 00000000 		.align 8
+ 1049              	.LC49:
+ 1050 0748 25733A20 		.string	"%s: Not enough suboptions for -r\n"
+ 1050      4E6F7420 
+ 1050      656E6F75 
+ 1050      67682073 
+ 1050      75626F70 
+ 1051              		.text
+ 1052 0a9f 90       		.p2align 4
+ 1053              		.globl	get_rawfileopts
+ 1055              	get_rawfileopts:
+ 1056              	.LFB27:
+ 1057              		.cfi_startproc
+ 1058 0aa0 4157     		pushq	%r15
+ 1059              		.cfi_def_cfa_offset 16
+ 1060              		.cfi_offset 15, -16
+ 1061 0aa2 488D0D00 		leaq	.LC41(%rip), %rcx
+ 1061      000000
+ 1062 0aa9 488D1500 		leaq	.LC42(%rip), %rdx
+ 1062      000000
+ 1063 0ab0 4156     		pushq	%r14
+ 1064              		.cfi_def_cfa_offset 24
+ 1065              		.cfi_offset 14, -24
+ 1066 0ab2 C4E1F96E 		vmovq	%rcx, %xmm0
+ 1066      C1
+ 1067 0ab7 488D0D00 		leaq	.LC43(%rip), %rcx
+ 1067      000000
+ 1068 0abe 4155     		pushq	%r13
+ 1069              		.cfi_def_cfa_offset 32
+ 1070              		.cfi_offset 13, -32
+ 1071 0ac0 C4E3F922 		vpinsrq	$1, %rdx, %xmm0, %xmm0
+ 1071      C201
+ 1072 0ac6 4154     		pushq	%r12
+ 1073              		.cfi_def_cfa_offset 40
+ 1074              		.cfi_offset 12, -40
+ 1075 0ac8 55       		pushq	%rbp
+ 1076              		.cfi_def_cfa_offset 48
+ 1077              		.cfi_offset 6, -48
+ 1078 0ac9 4889FD   		movq	%rdi, %rbp
+ 1079 0acc 53       		pushq	%rbx
+ 1080              		.cfi_def_cfa_offset 56
+ 1081              		.cfi_offset 3, -56
+ 1082 0acd 4883EC48 		subq	$72, %rsp
+ 1083              		.cfi_def_cfa_offset 128
+ 1084 0ad1 48897424 		movq	%rsi, 8(%rsp)
+ 1084      08
+ 1085 0ad6 48894C24 		movq	%rcx, 48(%rsp)
+ 1085      30
+ 1086 0adb 48C74424 		movq	$0, 56(%rsp)
+ 1086      38000000 
+ 1086      00
+ 1087 0ae4 C5F97F44 		vmovdqa	%xmm0, 32(%rsp)
+ 1087      2420
+ 1088 0aea 803E00   		cmpb	$0, (%rsi)
+ 1089 0aed 0F84FE00 		je	.L102
+ 1089      0000
+ 1090 0af3 31DB     		xorl	%ebx, %ebx
+ 1091 0af5 4C8D7424 		leaq	24(%rsp), %r14
+ 1091      18
+ 1092 0afa 4C8D6C24 		leaq	32(%rsp), %r13
+ 1092      20
+ 1093 0aff 4C8D6424 		leaq	8(%rsp), %r12
+ 1093      08
+ 1094              		.p2align 4,,10
+ 1095 0b04 0F1F4000 		.p2align 3
+ 1096              	.L112:
+ 1097 0b08 4C89F2   		movq	%r14, %rdx
+ 1098 0b0b 4C89EE   		movq	%r13, %rsi
+ 1099 0b0e 4C89E7   		movq	%r12, %rdi
+ 1100 0b11 E8000000 		call	getsubopt@PLT
+ 1100      00
+ 1101 0b16 4189C7   		movl	%eax, %r15d
+ 1102 0b19 83F801   		cmpl	$1, %eax
+ 1103 0b1c 746A     		je	.L103
+ 1104 0b1e 83F802   		cmpl	$2, %eax
+ 1105 0b21 0F843901 		je	.L104
+ 1105      0000
+ 1106 0b27 85C0     		testl	%eax, %eax
+ 1107 0b29 0F84E100 		je	.L117
+ 1107      0000
+ 1108 0b2f 488B4C24 		movq	24(%rsp), %rcx
+ 1108      18
+ 1109 0b34 31C0     		xorl	%eax, %eax
+ 1110 0b36 488D1500 		leaq	__func__.4(%rip), %rdx
+ 1110      000000
+ 1111 0b3d 31FF     		xorl	%edi, %edi
+ 1112 0b3f 488D3500 		leaq	.LC48(%rip), %rsi
+ 1112      000000
+ 1113 0b46 E8000000 		call	debugprint@PLT
+ 1113      00
+ 1114 0b4b B8010000 		movl	$1, %eax
+ 1114      00
+ 1115 0b50 C4E201F7 		shlx	%r15d, %eax, %eax
+ 1115      C0
+ 1116 0b55 41BF0100 		movl	$1, %r15d
+ 1116      0000
+ 1117 0b5b 09C3     		orl	%eax, %ebx
+ 1118              	.L108:
+ 1119 0b5d 83FB07   		cmpl	$7, %ebx
+ 1120 0b60 0F858B00 		jne	.L102
+ 1120      0000
+ 1121              	.L119:
+ 1122 0b66 4489F8   		movl	%r15d, %eax
+ 1123 0b69 83F001   		xorl	$1, %eax
+ 1124 0b6c 83E001   		andl	$1, %eax
+ 1125              	.L113:
+ 1126 0b6f 814D1000 		orl	$262144, 16(%rbp)
+ 1126      000400
+ 1127 0b76 4883C448 		addq	$72, %rsp
+ 1128              		.cfi_remember_state
+ 1129              		.cfi_def_cfa_offset 56
+ 1130 0b7a 5B       		popq	%rbx
+ 1131              		.cfi_def_cfa_offset 48
+ 1132 0b7b 5D       		popq	%rbp
+ 1133              		.cfi_def_cfa_offset 40
+ 1134 0b7c 415C     		popq	%r12
+ 1135              		.cfi_def_cfa_offset 32
+ 1136 0b7e 415D     		popq	%r13
+ 1137              		.cfi_def_cfa_offset 24
+ 1138 0b80 415E     		popq	%r14
+ 1139              		.cfi_def_cfa_offset 16
+ 1140 0b82 415F     		popq	%r15
+ 1141              		.cfi_def_cfa_offset 8
+ 1142 0b84 C3       		ret
+ 1143              		.p2align 4,,10
+ 1144 0b85 0F1F00   		.p2align 3
+ 1145              	.L103:
+ 1146              		.cfi_restore_state
+ 1147 0b88 488B7C24 		movq	24(%rsp), %rdi
+ 1147      18
+ 1148 0b8d 4885FF   		testq	%rdi, %rdi
+ 1149 0b90 0F841201 		je	.L118
+ 1149      0000
+ 1150 0b96 BA0A0000 		movl	$10, %edx
+ 1150      00
+ 1151 0b9b 31F6     		xorl	%esi, %esi
+ 1152 0b9d E8000000 		call	strtol@PLT
+ 1152      00
+ 1153 0ba2 488B7C24 		movq	24(%rsp), %rdi
+ 1153      18
+ 1154 0ba7 BA0A0000 		movl	$10, %edx
+ 1154      00
+ 1155 0bac 31F6     		xorl	%esi, %esi
+ 1156 0bae 894508   		movl	%eax, 8(%rbp)
+ 1157 0bb1 E8000000 		call	strtol@PLT
+ 1157      00
+ 1158 0bb6 488D3500 		leaq	.LC45(%rip), %rsi
+ 1158      000000
+ 1159 0bbd BF010000 		movl	$1, %edi
+ 1159      00
+ 1160 0bc2 89C2     		movl	%eax, %edx
+ 1161 0bc4 31C0     		xorl	%eax, %eax
+ 1162 0bc6 E8000000 		call	debugprint@PLT
+ 1162      00
+ 1163              	.L109:
+ 1164 0bcb B8010000 		movl	$1, %eax
+ 1164      00
+ 1165 0bd0 C4E201F7 		shlx	%r15d, %eax, %eax
+ 1165      C0
+ 1166 0bd5 09C3     		orl	%eax, %ebx
+ 1167 0bd7 488B4424 		movq	8(%rsp), %rax
+ 1167      08
+ 1168 0bdc 803800   		cmpb	$0, (%rax)
+ 1169 0bdf 0F8523FF 		jne	.L112
+ 1169      FFFF
+ 1170 0be5 4531FF   		xorl	%r15d, %r15d
+ 1171 0be8 83FB07   		cmpl	$7, %ebx
+ 1172 0beb 0F8475FF 		je	.L119
+ 1172      FFFF
+ 1173              	.L102:
+ 1174 0bf1 31C0     		xorl	%eax, %eax
+ 1175 0bf3 488D1500 		leaq	__func__.4(%rip), %rdx
+ 1175      000000
+ 1176 0bfa 488D3500 		leaq	.LC49(%rip), %rsi
+ 1176      000000
+ 1177 0c01 31FF     		xorl	%edi, %edi
+ 1178 0c03 E8000000 		call	debugprint@PLT
+ 1178      00
+ 1179 0c08 31C0     		xorl	%eax, %eax
+ 1180 0c0a E960FFFF 		jmp	.L113
+ 1180      FF
+ 1181 0c0f 90       		.p2align 4,,10
+ 1182              		.p2align 3
+ 1183              	.L117:
+ 1184 0c10 488B7C24 		movq	24(%rsp), %rdi
+ 1184      18
+ 1185 0c15 4885FF   		testq	%rdi, %rdi
+ 1186 0c18 0F84C200 		je	.L120
+ 1186      0000
+ 1187 0c1e 31F6     		xorl	%esi, %esi
+ 1188 0c20 BA0A0000 		movl	$10, %edx
+ 1188      00
+ 1189 0c25 E8000000 		call	strtol@PLT
+ 1189      00
+ 1190 0c2a 488B7C24 		movq	24(%rsp), %rdi
+ 1190      18
+ 1191 0c2f 31F6     		xorl	%esi, %esi
+ 1192 0c31 BA0A0000 		movl	$10, %edx
+ 1192      00
+ 1193 0c36 89450C   		movl	%eax, 12(%rbp)
+ 1194 0c39 E8000000 		call	strtol@PLT
+ 1194      00
+ 1195 0c3e 488D3500 		leaq	.LC46(%rip), %rsi
+ 1195      000000
+ 1196 0c45 BF010000 		movl	$1, %edi
+ 1196      00
+ 1197 0c4a 89C2     		movl	%eax, %edx
+ 1198 0c4c 31C0     		xorl	%eax, %eax
+ 1199 0c4e E8000000 		call	debugprint@PLT
+ 1199      00
+ 1200 0c53 E973FFFF 		jmp	.L109
+ 1200      FF
+ 1201 0c58 0F1F8400 		.p2align 4,,10
+ 1201      00000000 
+ 1202              		.p2align 3
+ 1203              	.L104:
+ 1204 0c60 488B7C24 		movq	24(%rsp), %rdi
+ 1204      18
+ 1205 0c65 4885FF   		testq	%rdi, %rdi
+ 1206 0c68 7456     		je	.L121
+ 1207 0c6a 31F6     		xorl	%esi, %esi
+ 1208 0c6c BA0A0000 		movl	$10, %edx
+ 1208      00
+ 1209 0c71 E8000000 		call	strtol@PLT
+ 1209      00
+ 1210 0c76 488B7C24 		movq	24(%rsp), %rdi
+ 1210      18
+ 1211 0c7b 31F6     		xorl	%esi, %esi
+ 1212 0c7d BA0A0000 		movl	$10, %edx
+ 1212      00
+ 1213 0c82 894510   		movl	%eax, 16(%rbp)
+ 1214 0c85 E8000000 		call	strtol@PLT
+ 1214      00
+ 1215 0c8a 488D3500 		leaq	.LC47(%rip), %rsi
+ 1215      000000
+ 1216 0c91 BF010000 		movl	$1, %edi
+ 1216      00
+ 1217 0c96 89C2     		movl	%eax, %edx
+ 1218 0c98 31C0     		xorl	%eax, %eax
+ 1219 0c9a E8000000 		call	debugprint@PLT
+ 1219      00
+ 1220 0c9f E927FFFF 		jmp	.L109
+ 1220      FF
+ 1221              		.p2align 4,,10
+ 1222 0ca4 0F1F4000 		.p2align 3
+ 1223              	.L118:
+ 1224 0ca8 488B5424 		movq	40(%rsp), %rdx
+ 1224      28
+ 1225 0cad 488D3500 		leaq	.LC44(%rip), %rsi
+ 1225      000000
+ 1226 0cb4 31C0     		xorl	%eax, %eax
+ 1227 0cb6 E8000000 		call	debugprint@PLT
+ 1227      00
+ 1228 0cbb E99DFEFF 		jmp	.L108
+ 1228      FF
+ 1229              		.p2align 4,,10
+ 1230              		.p2align 3
+ 1231              	.L121:
+ 1232 0cc0 488B5424 		movq	48(%rsp), %rdx
+ 1232      30
+ 1233 0cc5 488D3500 		leaq	.LC44(%rip), %rsi
+ 1233      000000
+ 1234 0ccc 31C0     		xorl	%eax, %eax
+ 1235 0cce 41BF0100 		movl	$1, %r15d
+ 1235      0000
+ 1236 0cd4 E8000000 		call	debugprint@PLT
+ 1236      00
+ 1237 0cd9 E97FFEFF 		jmp	.L108
+ 1237      FF
+ 1238 0cde 6690     		.p2align 4,,10
+ 1239              		.p2align 3
+ 1240              	.L120:
+ 1241 0ce0 488B5424 		movq	32(%rsp), %rdx
+ 1241      20
+ 1242 0ce5 488D3500 		leaq	.LC44(%rip), %rsi
+ 1242      000000
+ 1243 0cec 31C0     		xorl	%eax, %eax
+ 1244 0cee 41BF0100 		movl	$1, %r15d
+ 1244      0000
+ 1245 0cf4 E8000000 		call	debugprint@PLT
+ 1245      00
+ 1246 0cf9 E95FFEFF 		jmp	.L108
+ 1246      FF
+ 1247              		.cfi_endproc
+ 1248              	.LFE27:
+ 1250              		.section	.rodata.str1.1
+ 1251              	.LC50:
+ 1252 010b 696E6275 		.string	"inbufs=%p\n"
+ 1252      66733D25 
+ 1252      700A00
+ 1253              	.LC51:
+ 1254 0116 46452065 		.string	"FE exception raised: 0x%02X\n"
+ 1254      78636570 
+ 1254      74696F6E 
+ 1254      20726169 
+ 1254      7365643A 
+ 1255              	.LC52:
+ 1256 0133 6F757462 		.string	"outbufs=%p\n"
+ 1256      7566733D 
+ 1256      25700A00 
+ 1257              		.text
+ 1258 0cfe 6690     		.p2align 4
+ 1259              		.globl	process_block
+ 1261              	process_block:
+ 1262              	.LFB28:
+ 1263              		.cfi_startproc
+ 1264 0d00 4157     		pushq	%r15
+ 1265              		.cfi_def_cfa_offset 16
+ 1266              		.cfi_offset 15, -16
+ 1267 0d02 4156     		pushq	%r14
+ 1268              		.cfi_def_cfa_offset 24
+ 1269              		.cfi_offset 14, -24
+ 1270 0d04 4155     		pushq	%r13
+ 1271              		.cfi_def_cfa_offset 32
+ 1272              		.cfi_offset 13, -32
+ 1273 0d06 4154     		pushq	%r12
+ 1274              		.cfi_def_cfa_offset 40
+ 1275              		.cfi_offset 12, -40
+ 1276 0d08 55       		pushq	%rbp
+ 1277              		.cfi_def_cfa_offset 48
+ 1278              		.cfi_offset 6, -48
+ 1279 0d09 53       		pushq	%rbx
+ 1280              		.cfi_def_cfa_offset 56
+ 1281              		.cfi_offset 3, -56
+ 1282 0d0a 4883EC68 		subq	$104, %rsp
+ 1283              		.cfi_def_cfa_offset 160
+ 1284 0d0e 8BAC24A0 		movl	160(%rsp), %ebp
+ 1284      000000
+ 1285 0d15 4C8BBC24 		movq	168(%rsp), %r15
+ 1285      A8000000 
+ 1286 0d1d 4585C9   		testl	%r9d, %r9d
+ 1287 0d20 0F848A01 		je	.L128
+ 1287      0000
+ 1288 0d26 89E8     		movl	%ebp, %eax
+ 1289 0d28 C7442408 		movl	$0, 8(%rsp)
+ 1289      00000000 
+ 1290 0d30 4989FC   		movq	%rdi, %r12
+ 1291 0d33 4531F6   		xorl	%r14d, %r14d
+ 1292 0d36 0FAFC1   		imull	%ecx, %eax
+ 1293 0d39 48897424 		movq	%rsi, 32(%rsp)
+ 1293      20
+ 1294 0d3e 4531ED   		xorl	%r13d, %r13d
+ 1295 0d41 48895424 		movq	%rdx, 40(%rsp)
+ 1295      28
+ 1296 0d46 894C2434 		movl	%ecx, 52(%rsp)
+ 1297 0d4a 89442430 		movl	%eax, 48(%rsp)
+ 1298 0d4e 89E8     		movl	%ebp, %eax
+ 1299 0d50 410FAFC0 		imull	%r8d, %eax
+ 1300 0d54 44894424 		movl	%r8d, 56(%rsp)
+ 1300      38
+ 1301 0d59 44894C24 		movl	%r9d, 60(%rsp)
+ 1301      3C
+ 1302 0d5e 8944240C 		movl	%eax, 12(%rsp)
+ 1303 0d62 488D4424 		leaq	64(%rsp), %rax
+ 1303      40
+ 1304 0d67 48894424 		movq	%rax, 24(%rsp)
+ 1304      18
+ 1305 0d6c 488D4424 		leaq	80(%rsp), %rax
+ 1305      50
+ 1306 0d71 48894424 		movq	%rax, 16(%rsp)
+ 1306      10
+ 1307 0d76 EB5C     		jmp	.L127
+ 1308 0d78 0F1F8400 		.p2align 4,,10
+ 1308      00000000 
+ 1309              		.p2align 3
+ 1310              	.L126:
+ 1311 0d80 488B5348 		movq	72(%rbx), %rdx
+ 1312 0d84 488D3500 		leaq	.LC52(%rip), %rsi
+ 1312      000000
+ 1313 0d8b BF030000 		movl	$3, %edi
+ 1313      00
+ 1314 0d90 31C0     		xorl	%eax, %eax
+ 1315 0d92 E8000000 		call	debugprint@PLT
+ 1315      00
+ 1316 0d97 4489F0   		movl	%r14d, %eax
+ 1317 0d9a 488B7348 		movq	72(%rbx), %rsi
+ 1318 0d9e 8B542438 		movl	56(%rsp), %edx
+ 1319 0da2 488B4C24 		movq	32(%rsp), %rcx
+ 1319      20
+ 1320 0da7 488D3C81 		leaq	(%rcx,%rax,4), %rdi
+ 1321 0dab 89E9     		movl	%ebp, %ecx
+ 1322 0dad E8000000 		call	interleave@PLT
+ 1322      00
+ 1323 0db2 8B5C2430 		movl	48(%rsp), %ebx
+ 1324 0db6 016C2408 		addl	%ebp, 8(%rsp)
+ 1325 0dba 8B4C240C 		movl	12(%rsp), %ecx
+ 1326 0dbe 8B442408 		movl	8(%rsp), %eax
+ 1327 0dc2 4101DD   		addl	%ebx, %r13d
+ 1328 0dc5 8B5C243C 		movl	60(%rsp), %ebx
+ 1329 0dc9 4101CE   		addl	%ecx, %r14d
+ 1330 0dcc 39D8     		cmpl	%ebx, %eax
+ 1331 0dce 0F83DC00 		jnb	.L128
+ 1331      0000
+ 1332              	.L127:
+ 1333 0dd4 498B5424 		movq	8(%r12), %rdx
+ 1333      08
+ 1334 0dd9 31C0     		xorl	%eax, %eax
+ 1335 0ddb BF030000 		movl	$3, %edi
+ 1335      00
+ 1336 0de0 488D3500 		leaq	.LC50(%rip), %rsi
+ 1336      000000
+ 1337 0de7 E8000000 		call	debugprint@PLT
+ 1337      00
+ 1338 0dec 488B4C24 		movq	40(%rsp), %rcx
+ 1338      28
+ 1339 0df1 8B542434 		movl	52(%rsp), %edx
+ 1340 0df5 4489E8   		movl	%r13d, %eax
+ 1341 0df8 498B7C24 		movq	8(%r12), %rdi
+ 1341      08
+ 1342 0dfd 488D3481 		leaq	(%rcx,%rax,4), %rsi
+ 1343 0e01 89E9     		movl	%ebp, %ecx
+ 1344 0e03 E8000000 		call	deinterleave@PLT
+ 1344      00
+ 1345 0e08 BF3D0000 		movl	$61, %edi
+ 1345      00
+ 1346 0e0d E8000000 		call	feclearexcept@PLT
+ 1346      00
+ 1347 0e12 488B7424 		movq	24(%rsp), %rsi
+ 1347      18
+ 1348 0e17 BF030000 		movl	$3, %edi
+ 1348      00
+ 1349 0e1c E8000000 		call	clock_gettime@PLT
+ 1349      00
+ 1350 0e21 4C89E6   		movq	%r12, %rsi
+ 1351 0e24 89EF     		movl	%ebp, %edi
+ 1352 0e26 E8000000 		call	process@PLT
+ 1352      00
+ 1353 0e2b 488B7424 		movq	16(%rsp), %rsi
+ 1353      10
+ 1354 0e30 BF030000 		movl	$3, %edi
+ 1354      00
+ 1355 0e35 4889C3   		movq	%rax, %rbx
+ 1356 0e38 E8000000 		call	clock_gettime@PLT
+ 1356      00
+ 1357 0e3d 488B4C24 		movq	88(%rsp), %rcx
+ 1357      58
+ 1358 0e42 488B7C24 		movq	64(%rsp), %rdi
+ 1358      40
+ 1359 0e47 488B7424 		movq	72(%rsp), %rsi
+ 1359      48
+ 1360 0e4c 488B5424 		movq	80(%rsp), %rdx
+ 1360      50
+ 1361 0e51 E8000000 		call	timespecsub@PLT
+ 1361      00
+ 1362 0e56 498B4F08 		movq	8(%r15), %rcx
+ 1363 0e5a 4889D7   		movq	%rdx, %rdi
+ 1364 0e5d 4889C2   		movq	%rax, %rdx
+ 1365 0e60 48895424 		movq	%rdx, 64(%rsp)
+ 1365      40
+ 1366 0e65 4889F8   		movq	%rdi, %rax
+ 1367 0e68 4889D7   		movq	%rdx, %rdi
+ 1368 0e6b 498B17   		movq	(%r15), %rdx
+ 1369 0e6e 4889C6   		movq	%rax, %rsi
+ 1370 0e71 48894424 		movq	%rax, 72(%rsp)
+ 1370      48
+ 1371 0e76 E8000000 		call	timespecadd@PLT
+ 1371      00
+ 1372 0e7b BF3D0000 		movl	$61, %edi
+ 1372      00
+ 1373 0e80 498907   		movq	%rax, (%r15)
+ 1374 0e83 49895708 		movq	%rdx, 8(%r15)
+ 1375 0e87 E8000000 		call	fetestexcept@PLT
+ 1375      00
+ 1376 0e8c 85C0     		testl	%eax, %eax
+ 1377 0e8e 0F84ECFE 		je	.L126
+ 1377      FFFF
+ 1378 0e94 89C2     		movl	%eax, %edx
+ 1379 0e96 488D3500 		leaq	.LC51(%rip), %rsi
+ 1379      000000
+ 1380 0e9d BF030000 		movl	$3, %edi
+ 1380      00
+ 1381 0ea2 31C0     		xorl	%eax, %eax
+ 1382 0ea4 E8000000 		call	debugprint@PLT
+ 1382      00
+ 1383 0ea9 E9D2FEFF 		jmp	.L126
+ 1383      FF
+ 1384 0eae 6690     		.p2align 4,,10
+ 1385              		.p2align 3
+ 1386              	.L128:
+ 1387 0eb0 488B0500 		movq	trace_requested@GOTPCREL(%rip), %rax
+ 1387      000000
+ 1388 0eb7 8B10     		movl	(%rax), %edx
+ 1389 0eb9 85D2     		testl	%edx, %edx
+ 1390 0ebb 7513     		jne	.L135
+ 1391 0ebd 4883C468 		addq	$104, %rsp
+ 1392              		.cfi_remember_state
+ 1393              		.cfi_def_cfa_offset 56
+ 1394 0ec1 5B       		popq	%rbx
+ 1395              		.cfi_def_cfa_offset 48
+ 1396 0ec2 5D       		popq	%rbp
+ 1397              		.cfi_def_cfa_offset 40
+ 1398 0ec3 415C     		popq	%r12
+ 1399              		.cfi_def_cfa_offset 32
+ 1400 0ec5 415D     		popq	%r13
+ 1401              		.cfi_def_cfa_offset 24
+ 1402 0ec7 415E     		popq	%r14
+ 1403              		.cfi_def_cfa_offset 16
+ 1404 0ec9 415F     		popq	%r15
+ 1405              		.cfi_def_cfa_offset 8
+ 1406 0ecb C3       		ret
+ 1407 0ecc 0F1F4000 		.p2align 4,,10
+ 1408              		.p2align 3
+ 1409              	.L135:
+ 1410              		.cfi_restore_state
+ 1411 0ed0 488B3D00 		movq	trace_filename(%rip), %rdi
+ 1411      000000
+ 1412 0ed7 C7000000 		movl	$0, (%rax)
+ 1412      0000
+ 1413 0edd E8000000 		call	trace_write@PLT
+ 1413      00
+ 1414 0ee2 4883C468 		addq	$104, %rsp
+ 1415              		.cfi_def_cfa_offset 56
+ 1416 0ee6 5B       		popq	%rbx
+ 1417              		.cfi_def_cfa_offset 48
+ 1418 0ee7 5D       		popq	%rbp
+ 1419              		.cfi_def_cfa_offset 40
+ 1420 0ee8 415C     		popq	%r12
+ 1421              		.cfi_def_cfa_offset 32
+ 1422 0eea 415D     		popq	%r13
+ 1423              		.cfi_def_cfa_offset 24
+ 1424 0eec 415E     		popq	%r14
+ 1425              		.cfi_def_cfa_offset 16
+ 1426 0eee 415F     		popq	%r15
+ 1427              		.cfi_def_cfa_offset 8
+ 1428 0ef0 C3       		ret
+ 1429              		.cfi_endproc
+ 1430              	.LFE28:
+ 1432              		.section	.rodata.str1.1
+ 1433              	.LC53:
+ 1434 013f 7365676D 		.string	"segment worker"
+ 1434      656E7420 
+ 1434      776F726B 
+ 1434      657200
+ 1435              		.section	.rodata.str1.8
+ 1436 076a 00000000 		.align 8
+ 1436      0000
+ 1437              	.LC54:
+ 1438 0770 436F756C 		.string	"Could not reopen input for segment\n"
+ 1438      64206E6F 
+ 1438      74207265 
+ 1438      6F70656E 
+ 1438      20696E70 
+ 1439 0794 00000000 		.align 8
+ 1440              	.LC55:
+ 1441 0798 436F756C 		.string	"Could not allocate memory for segment.\n"
+ 1441      64206E6F 
+ 1441      7420616C 
+ 1441      6C6F6361 
+ 1441      7465206D 
+ 1442              		.section	.rodata.str1.1
+ 1443              	.LC56:
+ 1444 014e 436F756C 		.string	"Could not seek in input\n"
+ 1444      64206E6F 
+ 1444      74207365 
+ 1444      656B2069 
+ 1444      6E20696E 
+ 1445              		.text
+ 1446 0ef1 66662E0F 		.p2align 4
+ 1446      1F840000 
+ 1446      0000000F 
+ 1446      1F4000
+ 1447              		.globl	segment_worker
+ 1449              	segment_worker:
+ 1450              	.LFB38:
+ 1451              		.cfi_startproc
+ 1452 0f00 55       		pushq	%rbp
+ 1453              		.cfi_def_cfa_offset 16
+ 1454              		.cfi_offset 6, -16
+ 1455 0f01 C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 1456 0f05 4889E5   		movq	%rsp, %rbp
+ 1457              		.cfi_def_cfa_register 6
+ 1458 0f08 4157     		pushq	%r15
+ 1459 0f0a 4156     		pushq	%r14
+ 1460 0f0c 4155     		pushq	%r13
+ 1461 0f0e 4154     		pushq	%r12
+ 1462 0f10 4152     		pushq	%r10
+ 1463 0f12 53       		pushq	%rbx
+ 1464 0f13 4881ECA0 		subq	$160, %rsp
+ 1464      000000
+ 1465              		.cfi_offset 15, -24
+ 1466              		.cfi_offset 14, -32
+ 1467              		.cfi_offset 13, -40
+ 1468              		.cfi_offset 12, -48
+ 1469              		.cfi_offset 10, -56
+ 1470              		.cfi_offset 3, -64
+ 1471 0f1a 4C8B37   		movq	(%rdi), %r14
+ 1472 0f1d 4889BD40 		movq	%rdi, -192(%rbp)
+ 1472      FFFFFF
+ 1473 0f24 488D3D00 		leaq	.LC53(%rip), %rdi
+ 1473      000000
+ 1474 0f2b C5F97F45 		vmovdqa	%xmm0, -112(%rbp)
+ 1474      90
+ 1475 0f30 418B4614 		movl	20(%r14), %eax
+ 1476 0f34 89458C   		movl	%eax, -116(%rbp)
+ 1477 0f37 E8000000 		call	trace_thread_name@PLT
+ 1477      00
+ 1478 0f3c C4C17E6F 		vmovdqu	8(%r14), %ymm4
+ 1478      6608
+ 1479 0f42 488D55B0 		leaq	-80(%rbp), %rdx
+ 1480 0f46 BE100000 		movl	$16, %esi
+ 1480      00
+ 1481 0f4b C5FE7F65 		vmovdqu	%ymm4, -80(%rbp)
+ 1481      B0
+ 1482 0f50 498B3E   		movq	(%r14), %rdi
+ 1483 0f53 C5F877   		vzeroupper
+ 1484 0f56 E8000000 		call	sf_open@PLT
+ 1484      00
+ 1485 0f5b 48894580 		movq	%rax, -128(%rbp)
+ 1486 0f5f 4885C0   		testq	%rax, %rax
+ 1487 0f62 0F845403 		je	.L160
+ 1487      0000
+ 1488              	.L137:
+ 1489 0f68 498D464C 		leaq	76(%r14), %rax
+ 1490 0f6c 4D8D6E50 		leaq	80(%r14), %r13
+ 1491 0f70 48898548 		movq	%rax, -184(%rbp)
+ 1491      FFFFFF
+ 1492 0f77 488D45A0 		leaq	-96(%rbp), %rax
+ 1493 0f7b 48898560 		movq	%rax, -160(%rbp)
+ 1493      FFFFFF
+ 1494 0f82 488D4590 		leaq	-112(%rbp), %rax
+ 1495 0f86 48898538 		movq	%rax, -200(%rbp)
+ 1495      FFFFFF
+ 1496 0f8d EB0B     		jmp	.L139
+ 1497 0f8f 90       		.p2align 4,,10
+ 1498              		.p2align 3
+ 1499              	.L161:
+ 1500 0f90 E8000000 		call	__errno_location@PLT
+ 1500      00
+ 1501 0f95 833804   		cmpl	$4, (%rax)
+ 1502 0f98 750C     		jne	.L138
+ 1503              	.L139:
+ 1504 0f9a 4C89EF   		movq	%r13, %rdi
+ 1505 0f9d E8000000 		call	sem_wait@PLT
+ 1505      00
+ 1506 0fa2 85C0     		testl	%eax, %eax
+ 1507 0fa4 75EA     		jne	.L161
+ 1508              	.L138:
+ 1509 0fa6 488B8548 		movq	-184(%rbp), %rax
+ 1509      FFFFFF
+ 1510 0fad 41BC0100 		movl	$1, %r12d
+ 1510      0000
+ 1511 0fb3 F0440FC1 		lock xaddl	%r12d, (%rax)
+ 1511      20
+ 1512 0fb8 45396648 		cmpl	%r12d, 72(%r14)
+ 1513 0fbc 0F8ED602 		jle	.L158
+ 1513      0000
+ 1514 0fc2 498B4670 		movq	112(%r14), %rax
+ 1515 0fc6 4D63E4   		movslq	%r12d, %r12
+ 1516 0fc9 C4C17A7E 		vmovq	48(%r14), %xmm1
+ 1516      4E30
+ 1517 0fcf 4B8D14E4 		leaq	(%r12,%r12,8), %rdx
+ 1518 0fd3 C4C17A7E 		vmovq	8(%r14), %xmm0
+ 1518      4608
+ 1519 0fd9 C4C17A7E 		vmovq	56(%r14), %xmm2
+ 1519      5638
+ 1520 0fdf 488D1CD0 		leaq	(%rax,%rdx,8), %rbx
+ 1521 0fe3 C4E1F97E 		vmovq	%xmm1, %rax
+ 1521      C8
+ 1522 0fe8 418B562C 		movl	44(%r14), %edx
+ 1523 0fec 8B4D8C   		movl	-116(%rbp), %ecx
+ 1524 0fef 4C0FAFE0 		imulq	%rax, %r12
+ 1525 0ff3 4889D0   		movq	%rdx, %rax
+ 1526 0ff6 48898D70 		movq	%rcx, -144(%rbp)
+ 1526      FFFFFF
+ 1527 0ffd 83E801   		subl	$1, %eax
+ 1528 1000 C4C1F96E 		vmovq	%r12, %xmm3
+ 1528      DC
+ 1529 1005 C5F9FBC3 		vpsubq	%xmm3, %xmm0, %xmm0
+ 1530 1009 62F2E508 		vpminsq	%xmm2, %xmm3, %xmm2
+ 1530      39D2
+ 1531 100f C4C17A7E 		vmovq	64(%r14), %xmm3
+ 1531      5E40
+ 1532 1015 62F2F508 		vpminsq	%xmm0, %xmm1, %xmm1
+ 1532      39C8
+ 1533 101b C5F9D653 		vmovq	%xmm2, 16(%rbx)
+ 1533      10
+ 1534 1020 C5F9FBC1 		vpsubq	%xmm1, %xmm0, %xmm0
+ 1535 1024 C5E9D4D1 		vpaddq	%xmm1, %xmm2, %xmm2
+ 1536 1028 C5F9D64B 		vmovq	%xmm1, 24(%rbx)
+ 1536      18
+ 1537 102d 62F2FD08 		vpminsq	%xmm3, %xmm0, %xmm0
+ 1537      39C3
+ 1538 1033 C5E9D4D0 		vpaddq	%xmm0, %xmm2, %xmm2
+ 1539 1037 C5F9D643 		vmovq	%xmm0, 32(%rbx)
+ 1539      20
+ 1540 103c C5F9D695 		vmovq	%xmm2, -152(%rbp)
+ 1540      68FFFFFF 
+ 1541 1044 C4E1F97E 		vmovq	%xmm2, %rsi
+ 1541      D6
+ 1542 1049 488D5416 		leaq	-1(%rsi,%rdx), %rdx
+ 1542      FF
+ 1543 104e C4E2F8F2 		andn	%rdx, %rax, %rax
+ 1543      C2
+ 1544 1053 48898578 		movq	%rax, -136(%rbp)
+ 1544      FFFFFF
+ 1545 105a 480FAFC1 		imulq	%rcx, %rax
+ 1546 105e 4889C7   		movq	%rax, %rdi
+ 1547 1061 48C1E702 		salq	$2, %rdi
+ 1548 1065 E8000000 		call	malloc@PLT
+ 1548      00
+ 1549 106a 418B5628 		movl	40(%r14), %edx
+ 1550 106e 488903   		movq	%rax, (%rbx)
+ 1551 1071 4989C7   		movq	%rax, %r15
+ 1552 1074 39558C   		cmpl	%edx, -116(%rbp)
+ 1553 1077 0F82E301 		jb	.L162
+ 1553      0000
+ 1554              	.L141:
+ 1555 107d 48894308 		movq	%rax, 8(%rbx)
+ 1556 1081 4885C0   		testq	%rax, %rax
+ 1557 1084 0F844302 		je	.L149
+ 1557      0000
+ 1558 108a 4D85FF   		testq	%r15, %r15
+ 1559 108d 0F843A02 		je	.L149
+ 1559      0000
+ 1560              	.L142:
+ 1561 1093 4C8B3D00 		movq	tracebuf@GOTPCREL(%rip), %r15
+ 1561      000000
+ 1562 109a 49833F00 		cmpq	$0, (%r15)
+ 1563 109e 0F848100 		je	.L144
+ 1563      0000
+ 1564 10a4 488BB560 		movq	-160(%rbp), %rsi
+ 1564      FFFFFF
+ 1565 10ab BF010000 		movl	$1, %edi
+ 1565      00
+ 1566 10b0 E8000000 		call	clock_gettime@PLT
+ 1566      00
+ 1567 10b5 498B07   		movq	(%r15), %rax
+ 1568 10b8 B9010000 		movl	$1, %ecx
+ 1568      00
+ 1569 10bd F0480FC1 		lock xaddq	%rcx, 16(%rax)
+ 1569      4810
+ 1570 10c3 498B07   		movq	(%r15), %rax
+ 1571 10c6 4889CA   		movq	%rcx, %rdx
+ 1572 10c9 48235008 		andq	8(%rax), %rdx
+ 1573 10cd 48898D50 		movq	%rcx, -176(%rbp)
+ 1573      FFFFFF
+ 1574 10d4 48C1E205 		salq	$5, %rdx
+ 1575 10d8 480310   		addq	(%rax), %rdx
+ 1576 10db 48C70200 		movq	$0, (%rdx)
+ 1576      000000
+ 1577 10e2 486945A0 		imulq	$1000000000, -96(%rbp), %rax
+ 1577      00CA9A3B 
+ 1578 10ea 480345A8 		addq	-88(%rbp), %rax
+ 1579 10ee 48894208 		movq	%rax, 8(%rdx)
+ 1580 10f2 488D0500 		leaq	.LC4(%rip), %rax
+ 1580      000000
+ 1581 10f9 48894210 		movq	%rax, 16(%rdx)
+ 1582 10fd 48899558 		movq	%rdx, -168(%rbp)
+ 1582      FFFFFF
+ 1583 1104 E8000000 		call	trace_tid@PLT
+ 1583      00
+ 1584 1109 488B9558 		movq	-168(%rbp), %rdx
+ 1584      FFFFFF
+ 1585 1110 894218   		movl	%eax, 24(%rdx)
+ 1586 1113 C6421C42 		movb	$66, 28(%rdx)
+ 1587 1117 488B8D50 		movq	-176(%rbp), %rcx
+ 1587      FFFFFF
+ 1588 111e 4883C101 		addq	$1, %rcx
+ 1589 1122 48890A   		movq	%rcx, (%rdx)
+ 1590              	.L144:
+ 1591 1125 488B7D80 		movq	-128(%rbp), %rdi
+ 1592 1129 4C89E6   		movq	%r12, %rsi
+ 1593 112c 31D2     		xorl	%edx, %edx
+ 1594 112e 482B7310 		subq	16(%rbx), %rsi
+ 1595 1132 E8000000 		call	sf_seek@PLT
+ 1595      00
+ 1596 1137 4885C0   		testq	%rax, %rax
+ 1597 113a 0F884001 		js	.L163
+ 1597      0000
+ 1598              	.L145:
+ 1599 1140 488B33   		movq	(%rbx), %rsi
+ 1600 1143 488B9568 		movq	-152(%rbp), %rdx
+ 1600      FFFFFF
+ 1601 114a 488B7D80 		movq	-128(%rbp), %rdi
+ 1602 114e E8000000 		call	sf_readf_float@PLT
+ 1602      00
+ 1603 1153 49833F00 		cmpq	$0, (%r15)
+ 1604 1157 4889C1   		movq	%rax, %rcx
+ 1605 115a 0F848900 		je	.L146
+ 1605      0000
+ 1606 1160 488BB560 		movq	-160(%rbp), %rsi
+ 1606      FFFFFF
+ 1607 1167 BF010000 		movl	$1, %edi
+ 1607      00
+ 1608 116c 48898558 		movq	%rax, -168(%rbp)
+ 1608      FFFFFF
+ 1609 1173 E8000000 		call	clock_gettime@PLT
+ 1609      00
+ 1610 1178 498B07   		movq	(%r15), %rax
+ 1611 117b BA010000 		movl	$1, %edx
+ 1611      00
+ 1612 1180 F0480FC1 		lock xaddq	%rdx, 16(%rax)
+ 1612      5010
+ 1613 1186 498B07   		movq	(%r15), %rax
+ 1614 1189 4989D4   		movq	%rdx, %r12
+ 1615 118c 4C236008 		andq	8(%rax), %r12
+ 1616 1190 48899568 		movq	%rdx, -152(%rbp)
+ 1616      FFFFFF
+ 1617 1197 49C1E405 		salq	$5, %r12
+ 1618 119b 4C0320   		addq	(%rax), %r12
+ 1619 119e 49C70424 		movq	$0, (%r12)
+ 1619      00000000 
+ 1620 11a6 486945A0 		imulq	$1000000000, -96(%rbp), %rax
+ 1620      00CA9A3B 
+ 1621 11ae 480345A8 		addq	-88(%rbp), %rax
+ 1622 11b2 49894424 		movq	%rax, 8(%r12)
+ 1622      08
+ 1623 11b7 488D0500 		leaq	.LC4(%rip), %rax
+ 1623      000000
+ 1624 11be 49894424 		movq	%rax, 16(%r12)
+ 1624      10
+ 1625 11c3 E8000000 		call	trace_tid@PLT
+ 1625      00
+ 1626 11c8 41894424 		movl	%eax, 24(%r12)
+ 1626      18
+ 1627 11cd 41C64424 		movb	$69, 28(%r12)
+ 1627      1C45
+ 1628 11d3 488B9568 		movq	-152(%rbp), %rdx
+ 1628      FFFFFF
+ 1629 11da 4883C201 		addq	$1, %rdx
+ 1630 11de 49891424 		movq	%rdx, (%r12)
+ 1631 11e2 488B8D58 		movq	-168(%rbp), %rcx
+ 1631      FFFFFF
+ 1632              	.L146:
+ 1633 11e9 4C8BBD78 		movq	-136(%rbp), %r15
+ 1633      FFFFFF
+ 1634 11f0 488B8570 		movq	-144(%rbp), %rax
+ 1634      FFFFFF
+ 1635 11f7 31F6     		xorl	%esi, %esi
+ 1636 11f9 4C89FA   		movq	%r15, %rdx
+ 1637 11fc 4829CA   		subq	%rcx, %rdx
+ 1638 11ff 480FAFC8 		imulq	%rax, %rcx
+ 1639 1203 480FAFD0 		imulq	%rax, %rdx
+ 1640 1207 488B03   		movq	(%rbx), %rax
+ 1641 120a 488D3C88 		leaq	(%rax,%rcx,4), %rdi
+ 1642 120e 48C1E202 		salq	$2, %rdx
+ 1643 1212 E8000000 		call	memset@PLT
+ 1643      00
+ 1644 1217 4C8BA540 		movq	-192(%rbp), %r12
+ 1644      FFFFFF
+ 1645 121e 498B7C24 		movq	8(%r12), %rdi
+ 1645      08
+ 1646 1223 E8000000 		call	init_dsp@PLT
+ 1646      00
+ 1647 1228 418B462C 		movl	44(%r14), %eax
+ 1648 122c 488B13   		movq	(%rbx), %rdx
+ 1649 122f 4589F9   		movl	%r15d, %r9d
+ 1650 1232 458B4628 		movl	40(%r14), %r8d
+ 1651 1236 488B7308 		movq	8(%rbx), %rsi
+ 1652 123a 498B7C24 		movq	8(%r12), %rdi
+ 1652      08
+ 1653 123f 8B4D8C   		movl	-116(%rbp), %ecx
+ 1654 1242 FFB538FF 		pushq	-200(%rbp)
+ 1654      FFFF
+ 1655 1248 50       		pushq	%rax
+ 1656 1249 E8000000 		call	process_block@PLT
+ 1656      00
+ 1657 124e 488D7B28 		leaq	40(%rbx), %rdi
+ 1658 1252 E8000000 		call	sem_post@PLT
+ 1658      00
+ 1659 1257 58       		popq	%rax
+ 1660 1258 5A       		popq	%rdx
+ 1661 1259 E93CFDFF 		jmp	.L139
+ 1661      FF
+ 1662 125e 6690     		.p2align 4,,10
+ 1663              		.p2align 3
+ 1664              	.L162:
+ 1665 1260 488B8578 		movq	-136(%rbp), %rax
+ 1665      FFFFFF
+ 1666 1267 89D7     		movl	%edx, %edi
+ 1667 1269 480FAFF8 		imulq	%rax, %rdi
+ 1668 126d 48C1E702 		salq	$2, %rdi
+ 1669 1271 E8000000 		call	malloc@PLT
+ 1669      00
+ 1670 1276 E902FEFF 		jmp	.L141
+ 1670      FF
+ 1671 127b 0F1F4400 		.p2align 4,,10
+ 1671      00
+ 1672              		.p2align 3
+ 1673              	.L163:
+ 1674 1280 488D3D00 		leaq	.LC56(%rip), %rdi
+ 1674      000000
+ 1675 1287 E8000000 		call	endprogram@PLT
+ 1675      00
+ 1676 128c E9AFFEFF 		jmp	.L145
+ 1676      FF
+ 1677              		.p2align 4,,10
+ 1678 1291 0F1F8000 		.p2align 3
+ 1678      000000
+ 1679              	.L158:
+ 1680 1298 4C89EF   		movq	%r13, %rdi
+ 1681 129b E8000000 		call	sem_post@PLT
+ 1681      00
+ 1682 12a0 488B7D80 		movq	-128(%rbp), %rdi
+ 1683 12a4 E8000000 		call	sf_close@PLT
+ 1683      00
+ 1684 12a9 488D65D0 		leaq	-48(%rbp), %rsp
+ 1685 12ad 31C0     		xorl	%eax, %eax
+ 1686 12af 5B       		popq	%rbx
+ 1687 12b0 415A     		popq	%r10
+ 1688 12b2 415C     		popq	%r12
+ 1689 12b4 415D     		popq	%r13
+ 1690 12b6 415E     		popq	%r14
+ 1691 12b8 415F     		popq	%r15
+ 1692 12ba 5D       		popq	%rbp
+ 1693              		.cfi_remember_state
+ 1694              		.cfi_def_cfa 7, 8
+ 1695 12bb C3       		ret
+ 1696              	.L160:
+ 1697              		.cfi_restore_state
+ 1698 12bc 488D3D00 		leaq	.LC54(%rip), %rdi
+ 1698      000000
+ 1699 12c3 E8000000 		call	endprogram@PLT
+ 1699      00
+ 1700 12c8 E99BFCFF 		jmp	.L137
+ 1700      FF
+ 1701              	.L149:
+ 1702 12cd 488D3D00 		leaq	.LC55(%rip), %rdi
+ 1702      000000
+ 1703 12d4 E8000000 		call	endprogram@PLT
+ 1703      00
+ 1704 12d9 E9B5FDFF 		jmp	.L142
+ 1704      FF
+ 1705              		.cfi_endproc
+ 1706              	.LFE38:
+ 1708              		.section	.rodata.str1.8
+ 1709              		.align 8
+ 1710              	.LC57:
+ 1711 07c0 436F756C 		.string	"Could not allocate memory for file buffers.\n"
+ 1711      64206E6F 
+ 1711      7420616C 
+ 1711      6C6F6361 
+ 1711      7465206D 
+ 1712 07ed 000000   		.align 8
+ 1713              	.LC58:
+ 1714 07f0 436F756C 		.string	"Could not create pipeline semaphores\n"
+ 1714      64206E6F 
+ 1714      74206372 
+ 1714      65617465 
+ 1714      20706970 
+ 1715 0816 0000     		.align 8
+ 1716              	.LC59:
+ 1717 0818 436F756C 		.string	"Could not create file I/O threads\n"
+ 1717      64206E6F 
+ 1717      74206372 
+ 1717      65617465 
+ 1717      2066696C 
+ 1718              		.text
+ 1719 12de 6690     		.p2align 4
+ 1720              		.globl	run_pipeline
+ 1722              	run_pipeline:
+ 1723              	.LFB29:
+ 1724              		.cfi_startproc
+ 1725 12e0 4157     		pushq	%r15
+ 1726              		.cfi_def_cfa_offset 16
+ 1727              		.cfi_offset 15, -16
+ 1728 12e2 4156     		pushq	%r14
+ 1729              		.cfi_def_cfa_offset 24
+ 1730              		.cfi_offset 14, -24
+ 1731 12e4 4155     		pushq	%r13
+ 1732              		.cfi_def_cfa_offset 32
+ 1733              		.cfi_offset 13, -32
+ 1734 12e6 4589CD   		movl	%r9d, %r13d
+ 1735 12e9 4154     		pushq	%r12
+ 1736              		.cfi_def_cfa_offset 40
+ 1737              		.cfi_offset 12, -40
+ 1738 12eb 4589C4   		movl	%r8d, %r12d
+ 1739 12ee 55       		pushq	%rbp
+ 1740              		.cfi_def_cfa_offset 48
+ 1741              		.cfi_offset 6, -48
+ 1742 12ef 53       		pushq	%rbx
+ 1743              		.cfi_def_cfa_offset 56
+ 1744              		.cfi_offset 3, -56
+ 1745 12f0 4881EC98 		subq	$408, %rsp
+ 1745      010000
+ 1746              		.cfi_def_cfa_offset 464
+ 1747 12f7 8B9C24D0 		movl	464(%rsp), %ebx
+ 1747      010000
+ 1748 12fe 48897C24 		movq	%rdi, 8(%rsp)
+ 1748      08
+ 1749 1303 48897424 		movq	%rsi, 64(%rsp)
+ 1749      40
+ 1750 1308 89DD     		movl	%ebx, %ebp
+ 1751 130a 48895424 		movq	%rdx, 72(%rsp)
+ 1751      48
+ 1752 130f 410FAFE9 		imull	%r9d, %ebp
+ 1753 1313 895C2450 		movl	%ebx, 80(%rsp)
+ 1754 1317 48894C24 		movq	%rcx, 88(%rsp)
+ 1754      58
+ 1755 131c 48C74424 		movq	$0, 96(%rsp)
+ 1755      60000000 
+ 1755      00
+ 1756 1325 488D04AD 		leaq	0(,%rbp,4), %rax
+ 1756      00000000 
+ 1757 132d 48890424 		movq	%rax, (%rsp)
+ 1758 1331 4885C9   		testq	%rcx, %rcx
+ 1759 1334 7416     		je	.L166
+ 1760 1336 4889C7   		movq	%rax, %rdi
+ 1761 1339 E8000000 		call	malloc@PLT
+ 1761      00
+ 1762 133e 48894424 		movq	%rax, 96(%rsp)
+ 1762      60
+ 1763 1343 4885C0   		testq	%rax, %rax
+ 1764 1346 0F84E202 		je	.L198
+ 1764      0000
+ 1765              	.L166:
+ 1766 134c 410FAFDC 		imull	%r12d, %ebx
+ 1767 1350 4C8D7C24 		leaq	104(%rsp), %r15
+ 1767      68
+ 1768 1355 C7842488 		movl	$0, 392(%rsp)
+ 1768      01000000 
+ 1768      000000
+ 1769 1360 4C897C24 		movq	%r15, 16(%rsp)
+ 1769      10
+ 1770 1365 4C8DB424 		leaq	296(%rsp), %r14
+ 1770      28010000 
+ 1771 136d 4C89FD   		movq	%r15, %rbp
+ 1772 1370 48C1E302 		salq	$2, %rbx
+ 1773 1374 EB29     		jmp	.L171
+ 1774 1376 662E0F1F 		.p2align 4,,10
+ 1774      84000000 
+ 1774      0000
+ 1775              		.p2align 3
+ 1776              	.L168:
+ 1777 1380 48894508 		movq	%rax, 8(%rbp)
+ 1778 1384 4885C0   		testq	%rax, %rax
+ 1779 1387 0F849002 		je	.L186
+ 1779      0000
+ 1780 138d 4D85FF   		testq	%r15, %r15
+ 1781 1390 0F848702 		je	.L186
+ 1781      0000
+ 1782              	.L169:
+ 1783 1396 4883C518 		addq	$24, %rbp
+ 1784 139a 4C39F5   		cmpq	%r14, %rbp
+ 1785 139d 7421     		je	.L199
+ 1786              	.L171:
+ 1787 139f 4889DF   		movq	%rbx, %rdi
+ 1788 13a2 E8000000 		call	malloc@PLT
+ 1788      00
+ 1789 13a7 48894500 		movq	%rax, 0(%rbp)
+ 1790 13ab 4989C7   		movq	%rax, %r15
+ 1791 13ae 4539EC   		cmpl	%r13d, %r12d
+ 1792 13b1 73CD     		jnb	.L168
+ 1793 13b3 488B3C24 		movq	(%rsp), %rdi
+ 1794 13b7 E8000000 		call	malloc@PLT
+ 1794      00
+ 1795 13bc EBC2     		jmp	.L168
+ 1796 13be 6690     		.p2align 4,,10
+ 1797              		.p2align 3
+ 1798              	.L199:
+ 1799 13c0 BA080000 		movl	$8, %edx
+ 1799      00
+ 1800 13c5 31F6     		xorl	%esi, %esi
+ 1801 13c7 4C89F7   		movq	%r14, %rdi
+ 1802 13ca 4C8B7C24 		movq	16(%rsp), %r15
+ 1802      10
+ 1803 13cf E8000000 		call	sem_init@PLT
+ 1803      00
+ 1804 13d4 488DAC24 		leaq	328(%rsp), %rbp
+ 1804      48010000 
+ 1805 13dc 85C0     		testl	%eax, %eax
+ 1806 13de 0F84FF01 		je	.L172
+ 1806      0000
+ 1807 13e4 488D8424 		leaq	360(%rsp), %rax
+ 1807      68010000 
+ 1808 13ec 48890424 		movq	%rax, (%rsp)
+ 1809              	.L174:
+ 1810 13f0 488D3D00 		leaq	.LC58(%rip), %rdi
+ 1810      000000
+ 1811 13f7 E8000000 		call	endprogram@PLT
+ 1811      00
+ 1812              	.L173:
+ 1813 13fc 488D5C24 		leaq	64(%rsp), %rbx
+ 1813      40
+ 1814 1401 488B1500 		movq	reader_thread@GOTPCREL(%rip), %rdx
+ 1814      000000
+ 1815 1408 31F6     		xorl	%esi, %esi
+ 1816 140a 488D7C24 		leaq	48(%rsp), %rdi
+ 1816      30
+ 1817 140f 4889D9   		movq	%rbx, %rcx
+ 1818 1412 E8000000 		call	pthread_create@PLT
+ 1818      00
+ 1819 1417 85C0     		testl	%eax, %eax
+ 1820 1419 0F85E400 		jne	.L177
+ 1820      0000
+ 1821 141f 488B1500 		movq	writer_thread@GOTPCREL(%rip), %rdx
+ 1821      000000
+ 1822 1426 31F6     		xorl	%esi, %esi
+ 1823 1428 488D7C24 		leaq	56(%rsp), %rdi
+ 1823      38
+ 1824 142d 4889D9   		movq	%rbx, %rcx
+ 1825 1430 E8000000 		call	pthread_create@PLT
+ 1825      00
+ 1826 1435 85C0     		testl	%eax, %eax
+ 1827 1437 0F85C600 		jne	.L177
+ 1827      0000
+ 1828              	.L176:
+ 1829 143d 8B8424D8 		movl	472(%rsp), %eax
+ 1829      010000
+ 1830 1444 44896C24 		movl	%r13d, 24(%rsp)
+ 1830      18
+ 1831 1449 31F6     		xorl	%esi, %esi
+ 1832 144b 31DB     		xorl	%ebx, %ebx
+ 1833 144d 4C897C24 		movq	%r15, 32(%rsp)
+ 1833      20
+ 1834 1452 448BBC24 		movl	472(%rsp), %r15d
+ 1834      D8010000 
+ 1835 145a 83E801   		subl	$1, %eax
+ 1836 145d 4C897424 		movq	%r14, 40(%rsp)
+ 1836      28
+ 1837 1462 4189F6   		movl	%esi, %r14d
+ 1838 1465 89442410 		movl	%eax, 16(%rsp)
+ 1839 1469 0F1F8000 		.p2align 4,,10
+ 1839      000000
+ 1840              		.p2align 3
+ 1841              	.L183:
+ 1842 1470 448D6B01 		leal	1(%rbx), %r13d
+ 1843 1474 83E307   		andl	$7, %ebx
+ 1844 1477 EB11     		jmp	.L179
+ 1845 1479 0F1F8000 		.p2align 4,,10
+ 1845      000000
+ 1846              		.p2align 3
+ 1847              	.L200:
+ 1848 1480 E8000000 		call	__errno_location@PLT
+ 1848      00
+ 1849 1485 833804   		cmpl	$4, (%rax)
+ 1850 1488 750C     		jne	.L178
+ 1851              	.L179:
+ 1852 148a 4889EF   		movq	%rbp, %rdi
+ 1853 148d E8000000 		call	sem_wait@PLT
+ 1853      00
+ 1854 1492 85C0     		testl	%eax, %eax
+ 1855 1494 75EA     		jne	.L200
+ 1856              	.L178:
+ 1857 1496 488D0C5B 		leaq	(%rbx,%rbx,2), %rcx
+ 1858 149a 48C1E103 		salq	$3, %rcx
+ 1859 149e 8B440C78 		movl	120(%rsp,%rcx), %eax
+ 1860 14a2 85C0     		testl	%eax, %eax
+ 1861 14a4 0F84A600 		je	.L201
+ 1861      0000
+ 1862 14aa 8B742410 		movl	16(%rsp), %esi
+ 1863 14ae 4489FA   		movl	%r15d, %edx
+ 1864 14b1 F7DA     		negl	%edx
+ 1865 14b3 448D0C06 		leal	(%rsi,%rax), %r9d
+ 1866 14b7 4121D1   		andl	%edx, %r9d
+ 1867 14ba 4439C8   		cmpl	%r9d, %eax
+ 1868 14bd 7259     		jb	.L202
+ 1869              	.L182:
+ 1870 14bf 488D045B 		leaq	(%rbx,%rbx,2), %rax
+ 1871 14c3 4489E1   		movl	%r12d, %ecx
+ 1872 14c6 4501CE   		addl	%r9d, %r14d
+ 1873 14c9 4489EB   		movl	%r13d, %ebx
+ 1874 14cc 48C1E003 		salq	$3, %rax
+ 1875 14d0 488B5404 		movq	104(%rsp,%rax), %rdx
+ 1875      68
+ 1876 14d5 488B7404 		movq	112(%rsp,%rax), %rsi
+ 1876      70
+ 1877 14da FFB424E0 		pushq	480(%rsp)
+ 1877      010000
+ 1878              		.cfi_def_cfa_offset 472
+ 1879 14e1 4157     		pushq	%r15
+ 1880              		.cfi_def_cfa_offset 480
+ 1881 14e3 448B4424 		movl	40(%rsp), %r8d
+ 1881      28
+ 1882 14e8 488B7C24 		movq	24(%rsp), %rdi
+ 1882      18
+ 1883 14ed E8000000 		call	process_block@PLT
+ 1883      00
+ 1884 14f2 488B7C24 		movq	16(%rsp), %rdi
+ 1884      10
+ 1885 14f7 E8000000 		call	sem_post@PLT
+ 1885      00
+ 1886 14fc 58       		popq	%rax
+ 1887              		.cfi_def_cfa_offset 472
+ 1888 14fd 5A       		popq	%rdx
+ 1889              		.cfi_def_cfa_offset 464
+ 1890 14fe E96DFFFF 		jmp	.L183
+ 1890      FF
+ 1891              	.L177:
+ 1892 1503 488D3D00 		leaq	.LC59(%rip), %rdi
+ 1892      000000
+ 1893 150a E8000000 		call	endprogram@PLT
+ 1893      00
+ 1894 150f E929FFFF 		jmp	.L176
+ 1894      FF
+ 1895              		.p2align 4,,10
+ 1896 1514 0F1F4000 		.p2align 3
+ 1897              	.L202:
+ 1898 1518 4489CA   		movl	%r9d, %edx
+ 1899 151b 488B4C0C 		movq	104(%rsp,%rcx), %rcx
+ 1899      68
+ 1900 1520 31F6     		xorl	%esi, %esi
+ 1901 1522 44894C24 		movl	%r9d, 28(%rsp)
+ 1901      1C
+ 1902 1527 29C2     		subl	%eax, %edx
+ 1903 1529 410FAFC4 		imull	%r12d, %eax
+ 1904 152d 410FAFD4 		imull	%r12d, %edx
+ 1905 1531 488D3C81 		leaq	(%rcx,%rax,4), %rdi
+ 1906 1535 48C1E202 		salq	$2, %rdx
+ 1907 1539 E8000000 		call	memset@PLT
+ 1907      00
+ 1908 153e 448B4C24 		movl	28(%rsp), %r9d
+ 1908      1C
+ 1909 1543 E977FFFF 		jmp	.L182
+ 1909      FF
+ 1910 1548 0F1F8400 		.p2align 4,,10
+ 1910      00000000 
+ 1911              		.p2align 3
+ 1912              	.L201:
+ 1913 1550 488B3C24 		movq	(%rsp), %rdi
+ 1914 1554 4C8B7C24 		movq	32(%rsp), %r15
+ 1914      20
+ 1915 1559 4489F3   		movl	%r14d, %ebx
+ 1916 155c 4C8B7424 		movq	40(%rsp), %r14
+ 1916      28
+ 1917 1561 E8000000 		call	sem_post@PLT
+ 1917      00
+ 1918 1566 488B7C24 		movq	48(%rsp), %rdi
+ 1918      30
+ 1919 156b 31F6     		xorl	%esi, %esi
+ 1920 156d E8000000 		call	pthread_join@PLT
+ 1920      00
+ 1921 1572 488B7C24 		movq	56(%rsp), %rdi
+ 1921      38
+ 1922 1577 31F6     		xorl	%esi, %esi
+ 1923 1579 E8000000 		call	pthread_join@PLT
+ 1923      00
+ 1924 157e 4C89F7   		movq	%r14, %rdi
+ 1925 1581 E8000000 		call	sem_destroy@PLT
+ 1925      00
+ 1926 1586 4889EF   		movq	%rbp, %rdi
+ 1927 1589 E8000000 		call	sem_destroy@PLT
+ 1927      00
+ 1928 158e 488B3C24 		movq	(%rsp), %rdi
+ 1929 1592 E8000000 		call	sem_destroy@PLT
+ 1929      00
+ 1930 1597 660F1F84 		.p2align 4,,10
+ 1930      00000000 
+ 1930      00
+ 1931              		.p2align 3
+ 1932              	.L181:
+ 1933 15a0 498B4708 		movq	8(%r15), %rax
+ 1934 15a4 498B3F   		movq	(%r15), %rdi
+ 1935 15a7 4839F8   		cmpq	%rdi, %rax
+ 1936 15aa 740B     		je	.L184
+ 1937 15ac 4889C7   		movq	%rax, %rdi
+ 1938 15af E8000000 		call	free@PLT
+ 1938      00
+ 1939 15b4 498B3F   		movq	(%r15), %rdi
+ 1940              	.L184:
+ 1941 15b7 E8000000 		call	free@PLT
+ 1941      00
+ 1942 15bc 4983C718 		addq	$24, %r15
+ 1943 15c0 4D39F7   		cmpq	%r14, %r15
+ 1944 15c3 75DB     		jne	.L181
+ 1945 15c5 488B7C24 		movq	96(%rsp), %rdi
+ 1945      60
+ 1946 15ca E8000000 		call	free@PLT
+ 1946      00
+ 1947 15cf 4881C498 		addq	$408, %rsp
+ 1947      010000
+ 1948              		.cfi_remember_state
+ 1949              		.cfi_def_cfa_offset 56
+ 1950 15d6 89D8     		movl	%ebx, %eax
+ 1951 15d8 5B       		popq	%rbx
+ 1952              		.cfi_def_cfa_offset 48
+ 1953 15d9 5D       		popq	%rbp
+ 1954              		.cfi_def_cfa_offset 40
+ 1955 15da 415C     		popq	%r12
+ 1956              		.cfi_def_cfa_offset 32
+ 1957 15dc 415D     		popq	%r13
+ 1958              		.cfi_def_cfa_offset 24
+ 1959 15de 415E     		popq	%r14
+ 1960              		.cfi_def_cfa_offset 16
+ 1961 15e0 415F     		popq	%r15
+ 1962              		.cfi_def_cfa_offset 8
+ 1963 15e2 C3       		ret
+ 1964              	.L172:
+ 1965              		.cfi_restore_state
+ 1966 15e3 31F6     		xorl	%esi, %esi
+ 1967 15e5 31D2     		xorl	%edx, %edx
+ 1968 15e7 4889EF   		movq	%rbp, %rdi
+ 1969 15ea E8000000 		call	sem_init@PLT
+ 1969      00
+ 1970 15ef 488DB424 		leaq	360(%rsp), %rsi
+ 1970      68010000 
+ 1971 15f7 48893424 		movq	%rsi, (%rsp)
+ 1972 15fb 85C0     		testl	%eax, %eax
+ 1973 15fd 0F85EDFD 		jne	.L174
+ 1973      FFFF
+ 1974 1603 488B3C24 		movq	(%rsp), %rdi
+ 1975 1607 31D2     		xorl	%edx, %edx
+ 1976 1609 31F6     		xorl	%esi, %esi
+ 1977 160b E8000000 		call	sem_init@PLT
+ 1977      00
+ 1978 1610 85C0     		testl	%eax, %eax
+ 1979 1612 0F85D8FD 		jne	.L174
+ 1979      FFFF
+ 1980 1618 E9DFFDFF 		jmp	.L173
+ 1980      FF
+ 1981              	.L186:
+ 1982 161d 488D3D00 		leaq	.LC57(%rip), %rdi
+ 1982      000000
+ 1983 1624 E8000000 		call	endprogram@PLT
+ 1983      00
+ 1984 1629 E968FDFF 		jmp	.L169
+ 1984      FF
+ 1985              	.L198:
+ 1986 162e 488D3D00 		leaq	.LC57(%rip), %rdi
+ 1986      000000
+ 1987 1635 E8000000 		call	endprogram@PLT
+ 1987      00
+ 1988 163a E90DFDFF 		jmp	.L166
+ 1988      FF
+ 1989              		.cfi_endproc
+ 1990              	.LFE29:
+ 1992 163f 90       		.p2align 4
+ 1993              		.globl	run_mapped
+ 1995              	run_mapped:
+ 1996              	.LFB30:
+ 1997              		.cfi_startproc
+ 1998 1640 4157     		pushq	%r15
+ 1999              		.cfi_def_cfa_offset 16
+ 2000              		.cfi_offset 15, -16
+ 2001 1642 4156     		pushq	%r14
+ 2002              		.cfi_def_cfa_offset 24
+ 2003              		.cfi_offset 14, -24
+ 2004 1644 4155     		pushq	%r13
+ 2005              		.cfi_def_cfa_offset 32
+ 2006              		.cfi_offset 13, -32
+ 2007 1646 4154     		pushq	%r12
+ 2008              		.cfi_def_cfa_offset 40
+ 2009              		.cfi_offset 12, -40
+ 2010 1648 4589CC   		movl	%r9d, %r12d
+ 2011 164b 55       		pushq	%rbp
+ 2012              		.cfi_def_cfa_offset 48
+ 2013              		.cfi_offset 6, -48
+ 2014 164c 53       		pushq	%rbx
+ 2015              		.cfi_def_cfa_offset 56
+ 2016              		.cfi_offset 3, -56
+ 2017 164d 4883EC78 		subq	$120, %rsp
+ 2018              		.cfi_def_cfa_offset 176
+ 2019 1651 4139C8   		cmpl	%ecx, %r8d
+ 2020 1654 48897C24 		movq	%rdi, 64(%rsp)
+ 2020      40
+ 2021 1659 89CF     		movl	%ecx, %edi
+ 2022 165b 410F43F8 		cmovnb	%r8d, %edi
+ 2023 165f 894C2418 		movl	%ecx, 24(%rsp)
+ 2024 1663 48897424 		movq	%rsi, 8(%rsp)
+ 2024      08
+ 2025 1668 410FAFF9 		imull	%r9d, %edi
+ 2026 166c 48895424 		movq	%rdx, 56(%rsp)
+ 2026      38
+ 2027 1671 44894424 		movl	%r8d, 16(%rsp)
+ 2027      10
+ 2028 1676 48C1E702 		salq	$2, %rdi
+ 2029 167a E8000000 		call	malloc@PLT
+ 2029      00
+ 2030 167f 448B5424 		movl	16(%rsp), %r10d
+ 2030      10
+ 2031 1684 8B4C2418 		movl	24(%rsp), %ecx
+ 2032 1688 4885C0   		testq	%rax, %rax
+ 2033 168b 48894424 		movq	%rax, 104(%rsp)
+ 2033      68
+ 2034 1690 0F84AF01 		je	.L212
+ 2034      0000
+ 2035              	.L204:
+ 2036 1696 488B4424 		movq	8(%rsp), %rax
+ 2036      08
+ 2037 169b 488B5820 		movq	32(%rax), %rbx
+ 2038 169f 4885DB   		testq	%rbx, %rbx
+ 2039 16a2 0F8E7801 		jle	.L209
+ 2039      0000
+ 2040 16a8 4189C9   		movl	%ecx, %r9d
+ 2041 16ab 4589E7   		movl	%r12d, %r15d
+ 2042 16ae 4489D7   		movl	%r10d, %edi
+ 2043 16b1 4531ED   		xorl	%r13d, %r13d
+ 2044 16b4 4C89C8   		movq	%r9, %rax
+ 2045 16b7 44895424 		movl	%r10d, 92(%rsp)
+ 2045      5C
+ 2046 16bc 4531F6   		xorl	%r14d, %r14d
+ 2047 16bf 4D89EA   		movq	%r13, %r10
+ 2048 16c2 490FAFC7 		imulq	%r15, %rax
+ 2049 16c6 4589E5   		movl	%r12d, %r13d
+ 2050 16c9 48897C24 		movq	%rdi, 96(%rsp)
+ 2050      60
+ 2051 16ce 31ED     		xorl	%ebp, %ebp
+ 2052 16d0 C7442434 		movl	$0, 52(%rsp)
+ 2052      00000000 
+ 2053 16d8 4C8B6424 		movq	104(%rsp), %r12
+ 2053      68
+ 2054 16dd 4C894C24 		movq	%r9, 16(%rsp)
+ 2054      10
+ 2055 16e2 48C1E002 		salq	$2, %rax
+ 2056 16e6 894C2458 		movl	%ecx, 88(%rsp)
+ 2057 16ea 48894424 		movq	%rax, 80(%rsp)
+ 2057      50
+ 2058 16ef 4889F8   		movq	%rdi, %rax
+ 2059 16f2 490FAFC7 		imulq	%r15, %rax
+ 2060 16f6 48C1E002 		salq	$2, %rax
+ 2061 16fa 48894424 		movq	%rax, 72(%rsp)
+ 2061      48
+ 2062 16ff E9B90000 		jmp	.L208
+ 2062      00
+ 2063              		.p2align 4,,10
+ 2064 1704 0F1F4000 		.p2align 3
+ 2065              	.L206:
+ 2066 1708 488B4C24 		movq	16(%rsp), %rcx
+ 2066      10
+ 2067 170d 4C89E7   		movq	%r12, %rdi
+ 2068 1710 4C895424 		movq	%r10, 40(%rsp)
+ 2068      28
+ 2069 1715 4C895C24 		movq	%r11, 32(%rsp)
+ 2069      20
+ 2070 171a 480FAFCB 		imulq	%rbx, %rcx
+ 2071 171e 48C1E102 		salq	$2, %rcx
+ 2072 1722 4889CA   		movq	%rcx, %rdx
+ 2073 1725 48894C24 		movq	%rcx, 24(%rsp)
+ 2073      18
+ 2074 172a E8000000 		call	memcpy@PLT
+ 2074      00
+ 2075 172f 488B4C24 		movq	16(%rsp), %rcx
+ 2075      10
+ 2076 1734 4C89FA   		movq	%r15, %rdx
+ 2077 1737 31F6     		xorl	%esi, %esi
+ 2078 1739 4829DA   		subq	%rbx, %rdx
+ 2079 173c 480FAFD1 		imulq	%rcx, %rdx
+ 2080 1740 488B4C24 		movq	24(%rsp), %rcx
+ 2080      18
+ 2081 1745 498D3C0C 		leaq	(%r12,%rcx), %rdi
+ 2082 1749 48C1E202 		salq	$2, %rdx
+ 2083 174d E8000000 		call	memset@PLT
+ 2083      00
+ 2084 1752 4589E9   		movl	%r13d, %r9d
+ 2085 1755 4C89E2   		movq	%r12, %rdx
+ 2086 1758 4C89E6   		movq	%r12, %rsi
+ 2087 175b FFB424B0 		pushq	176(%rsp)
+ 2087      000000
+ 2088              		.cfi_def_cfa_offset 184
+ 2089 1762 4155     		pushq	%r13
+ 2090              		.cfi_def_cfa_offset 192
+ 2091 1764 448B4424 		movl	108(%rsp), %r8d
+ 2091      6C
+ 2092 1769 8B4C2468 		movl	104(%rsp), %ecx
+ 2093 176d 488B7C24 		movq	80(%rsp), %rdi
+ 2093      50
+ 2094 1772 E8000000 		call	process_block@PLT
+ 2094      00
+ 2095 1777 488B4424 		movq	112(%rsp), %rax
+ 2095      70
+ 2096 177c 488B7C24 		movq	48(%rsp), %rdi
+ 2096      30
+ 2097 1781 4C89E6   		movq	%r12, %rsi
+ 2098 1784 480FAFD8 		imulq	%rax, %rbx
+ 2099 1788 488D149D 		leaq	0(,%rbx,4), %rdx
+ 2099      00000000 
+ 2100 1790 E8000000 		call	memcpy@PLT
+ 2100      00
+ 2101 1795 58       		popq	%rax
+ 2102              		.cfi_def_cfa_offset 184
+ 2103 1796 5A       		popq	%rdx
+ 2104              		.cfi_def_cfa_offset 176
+ 2105 1797 4C8B5424 		movq	40(%rsp), %r10
+ 2105      28
+ 2106              	.L207:
+ 2107 179c 488B4424 		movq	8(%rsp), %rax
+ 2107      08
+ 2108 17a1 4C01FD   		addq	%r15, %rbp
+ 2109 17a4 488B5820 		movq	32(%rax), %rbx
+ 2110 17a8 488B4424 		movq	80(%rsp), %rax
+ 2110      50
+ 2111 17ad 4901C2   		addq	%rax, %r10
+ 2112 17b0 488B4424 		movq	72(%rsp), %rax
+ 2112      48
+ 2113 17b5 4901C6   		addq	%rax, %r14
+ 2114 17b8 4839EB   		cmpq	%rbp, %rbx
+ 2115 17bb 7E6B     		jle	.L205
+ 2116              	.L208:
+ 2117 17bd 488B4424 		movq	8(%rsp), %rax
+ 2117      08
+ 2118 17c2 4829EB   		subq	%rbp, %rbx
+ 2119 17c5 44016C24 		addl	%r13d, 52(%rsp)
+ 2119      34
+ 2120 17ca 488B7018 		movq	24(%rax), %rsi
+ 2121 17ce 488B4424 		movq	56(%rsp), %rax
+ 2121      38
+ 2122 17d3 4C8B5818 		movq	24(%rax), %r11
+ 2123 17d7 4C01D6   		addq	%r10, %rsi
+ 2124 17da 4D01F3   		addq	%r14, %r11
+ 2125 17dd 4C39FB   		cmpq	%r15, %rbx
+ 2126 17e0 0F8C22FF 		jl	.L206
+ 2126      FFFF
+ 2127 17e6 4C895424 		movq	%r10, 24(%rsp)
+ 2127      18
+ 2128 17eb 4889F2   		movq	%rsi, %rdx
+ 2129 17ee 4589E9   		movl	%r13d, %r9d
+ 2130 17f1 4C89DE   		movq	%r11, %rsi
+ 2131 17f4 FFB424B0 		pushq	176(%rsp)
+ 2131      000000
+ 2132              		.cfi_def_cfa_offset 184
+ 2133 17fb 4155     		pushq	%r13
+ 2134              		.cfi_def_cfa_offset 192
+ 2135 17fd 448B4424 		movl	108(%rsp), %r8d
+ 2135      6C
+ 2136 1802 8B4C2468 		movl	104(%rsp), %ecx
+ 2137 1806 488B7C24 		movq	80(%rsp), %rdi
+ 2137      50
+ 2138 180b E8000000 		call	process_block@PLT
+ 2138      00
+ 2139 1810 59       		popq	%rcx
+ 2140              		.cfi_def_cfa_offset 184
+ 2141 1811 5E       		popq	%rsi
+ 2142              		.cfi_def_cfa_offset 176
+ 2143 1812 4C8B5424 		movq	24(%rsp), %r10
+ 2143      18
+ 2144 1817 EB83     		jmp	.L207
+ 2145 1819 0F1F8000 		.p2align 4,,10
+ 2145      000000
+ 2146              		.p2align 3
+ 2147              	.L209:
+ 2148 1820 C7442434 		movl	$0, 52(%rsp)
+ 2148      00000000 
+ 2149              	.L205:
+ 2150 1828 488B7C24 		movq	104(%rsp), %rdi
+ 2150      68
+ 2151 182d E8000000 		call	free@PLT
+ 2151      00
+ 2152 1832 8B442434 		movl	52(%rsp), %eax
+ 2153 1836 4883C478 		addq	$120, %rsp
+ 2154              		.cfi_remember_state
+ 2155              		.cfi_def_cfa_offset 56
+ 2156 183a 5B       		popq	%rbx
+ 2157              		.cfi_def_cfa_offset 48
+ 2158 183b 5D       		popq	%rbp
+ 2159              		.cfi_def_cfa_offset 40
+ 2160 183c 415C     		popq	%r12
+ 2161              		.cfi_def_cfa_offset 32
+ 2162 183e 415D     		popq	%r13
+ 2163              		.cfi_def_cfa_offset 24
+ 2164 1840 415E     		popq	%r14
+ 2165              		.cfi_def_cfa_offset 16
+ 2166 1842 415F     		popq	%r15
+ 2167              		.cfi_def_cfa_offset 8
+ 2168 1844 C3       		ret
+ 2169              	.L212:
+ 2170              		.cfi_restore_state
+ 2171 1845 488D3D00 		leaq	.LC57(%rip), %rdi
+ 2171      000000
+ 2172 184c 44895424 		movl	%r10d, 24(%rsp)
+ 2172      18
+ 2173 1851 894C2410 		movl	%ecx, 16(%rsp)
+ 2174 1855 E8000000 		call	endprogram@PLT
+ 2174      00
+ 2175 185a 448B5424 		movl	24(%rsp), %r10d
+ 2175      18
+ 2176 185f 8B4C2410 		movl	16(%rsp), %ecx
+ 2177 1863 E92EFEFF 		jmp	.L204
+ 2177      FF
+ 2178              		.cfi_endproc
+ 2179              	.LFE30:
+ 2181 1868 0F1F8400 		.p2align 4
+ 2181      00000000 
+ 2182              		.globl	auto_framesize
+ 2184              	auto_framesize:
+ 2185              	.LFB31:
+ 2186              		.cfi_startproc
+ 2187 1870 55       		pushq	%rbp
+ 2188              		.cfi_def_cfa_offset 16
+ 2189              		.cfi_offset 6, -16
+ 2190 1871 53       		pushq	%rbx
+ 2191              		.cfi_def_cfa_offset 24
+ 2192              		.cfi_offset 3, -24
+ 2193 1872 4889FB   		movq	%rdi, %rbx
+ 2194 1875 4883EC08 		subq	$8, %rsp
+ 2195              		.cfi_def_cfa_offset 32
+ 2196 1879 E8000000 		call	maxchannels_dsp@PLT
+ 2196      00
+ 2197 187e 8B939C00 		movl	156(%rbx), %edx
+ 2197      0000
+ 2198 1884 4889DF   		movq	%rbx, %rdi
+ 2199 1887 8D2C42   		leal	(%rdx,%rax,2), %ebp
+ 2200 188a E8000000 		call	outchannels_dsp@PLT
+ 2200      00
+ 2201 188f BFBC0000 		movl	$188, %edi
+ 2201      00
+ 2202 1894 8D5C0500 		leal	0(%rbp,%rax), %ebx
+ 2203 1898 E8000000 		call	sysconf@PLT
+ 2203      00
+ 2204 189d 4863DB   		movslq	%ebx, %rbx
+ 2205 18a0 4889C6   		movq	%rax, %rsi
+ 2206 18a3 48D1EE   		shrq	%rsi
+ 2207 18a6 4885C0   		testq	%rax, %rax
+ 2208 18a9 7E45     		jle	.L224
+ 2209              	.L215:
+ 2210 18ab 4889D8   		movq	%rbx, %rax
+ 2211 18ae B9060000 		movl	$6, %ecx
+ 2211      00
+ 2212 18b3 BA400000 		movl	$64, %edx
+ 2212      00
+ 2213 18b8 48C1E009 		salq	$9, %rax
+ 2214 18bc 4839C6   		cmpq	%rax, %rsi
+ 2215 18bf 7316     		jnb	.L218
+ 2216 18c1 EB1B     		jmp	.L213
+ 2217              		.p2align 4,,10
+ 2218 18c3 0F1F4400 		.p2align 3
+ 2218      00
+ 2219              	.L216:
+ 2220 18c8 89D0     		movl	%edx, %eax
+ 2221 18ca 480FAFC3 		imulq	%rbx, %rax
+ 2222 18ce 48C1E003 		salq	$3, %rax
+ 2223 18d2 4839C6   		cmpq	%rax, %rsi
+ 2224 18d5 7207     		jb	.L213
+ 2225              	.L218:
+ 2226 18d7 01D2     		addl	%edx, %edx
+ 2227 18d9 83E901   		subl	$1, %ecx
+ 2228 18dc 75EA     		jne	.L216
+ 2229              	.L213:
+ 2230 18de 4883C408 		addq	$8, %rsp
+ 2231              		.cfi_remember_state
+ 2232              		.cfi_def_cfa_offset 24
+ 2233 18e2 89D0     		movl	%edx, %eax
+ 2234 18e4 5B       		popq	%rbx
+ 2235              		.cfi_def_cfa_offset 16
+ 2236 18e5 5D       		popq	%rbp
+ 2237              		.cfi_def_cfa_offset 8
+ 2238 18e6 C3       		ret
+ 2239 18e7 660F1F84 		.p2align 4,,10
+ 2239      00000000 
+ 2239      00
+ 2240              		.p2align 3
+ 2241              	.L224:
+ 2242              		.cfi_restore_state
+ 2243 18f0 BFBF0000 		movl	$191, %edi
+ 2243      00
+ 2244 18f5 E8000000 		call	sysconf@PLT
+ 2244      00
+ 2245 18fa 4889C6   		movq	%rax, %rsi
+ 2246 18fd 48C1FE04 		sarq	$4, %rsi
+ 2247 1901 48D1EE   		shrq	%rsi
+ 2248 1904 4885C0   		testq	%rax, %rax
+ 2249 1907 B8004000 		movl	$16384, %eax
+ 2249      00
+ 2250 190c 480F4EF0 		cmovle	%rax, %rsi
+ 2251 1910 EB99     		jmp	.L215
+ 2252              		.cfi_endproc
+ 2253              	.LFE31:
+ 2255              		.section	.rodata.str1.8
+ 2256 083b 00000000 		.align 8
+ 2256      00
+ 2257              	.LC60:
+ 2258 0840 436F756C 		.string	"Could not open file %s for reading.\n"
+ 2258      64206E6F 
+ 2258      74206F70 
+ 2258      656E2066 
+ 2258      696C6520 
+ 2259              		.section	.rodata.str1.1
+ 2260              	.LC61:
+ 2261 0167 696E7075 		.string	"input file samplerate: %d\n"
+ 2261      74206669 
+ 2261      6C652073 
+ 2261      616D706C 
+ 2261      65726174 
+ 2262              	.LC62:
+ 2263 0182 696E7075 		.string	"input file channels: %d\n"
+ 2263      74206669 
+ 2263      6C652063 
+ 2263      68616E6E 
+ 2263      656C733A 
+ 2264              		.section	.rodata.str1.8
+ 2265 0865 000000   		.align 8
+ 2266              	.LC63:
+ 2267 0868 496E7661 		.string	"Invalid number of channels in %s\n"
+ 2267      6C696420 
+ 2267      6E756D62 
+ 2267      6572206F 
+ 2267      66206368 
+ 2268 088a 00000000 		.align 8
+ 2268      0000
+ 2269              	.LC64:
+ 2270 0890 25733A20 		.string	"%s: tile %u frames, chunk %u frames\n"
+ 2270      74696C65 
+ 2270      20257520 
+ 2270      6672616D 
+ 2270      65732C20 
+ 2271              		.section	.rodata.str1.1
+ 2272              	.LC65:
+ 2273 019b 6C696273 		.string	"libsndfile"
+ 2273      6E646669 
+ 2273      6C6500
+ 2274              	.LC66:
+ 2275 01a6 25733A20 		.string	"%s: %s\n"
+ 2275      25730A00 
+ 2276              	.LC67:
+ 2277 01ae 6D656D6F 		.string	"memory mapped"
+ 2277      7279206D 
+ 2277      61707065 
+ 2277      6400
+ 2278              		.section	.rodata.str1.8
+ 2279 08b5 000000   		.align 8
+ 2280              	.LC68:
+ 2281 08b8 446F6E65 		.string	"Done! Processed %d samples in %lld.%.9ld sec, res=%ld nsec, wall clock %lld.%.9ld sec\n"
+ 2281      21205072 
+ 2281      6F636573 
+ 2281      73656420 
+ 2281      25642073 
+ 2282              		.section	.rodata.str1.1
+ 2283              	.LC69:
+ 2284 01bc 4661696C 		.string	"Failed closing %s: %s\n"
+ 2284      65642063 
+ 2284      6C6F7369 
+ 2284      6E672025 
+ 2284      733A2025 
+ 2285              		.text
+ 2286 1912 66662E0F 		.p2align 4
+ 2286      1F840000 
+ 2286      0000000F 
+ 2286      1F00
+ 2287              		.globl	process_file
+ 2289              	process_file:
+ 2290              	.LFB33:
+ 2291              		.cfi_startproc
+ 2292 1920 55       		pushq	%rbp
+ 2293              		.cfi_def_cfa_offset 16
+ 2294              		.cfi_offset 6, -16
+ 2295 1921 4889E5   		movq	%rsp, %rbp
+ 2296              		.cfi_def_cfa_register 6
+ 2297 1924 4157     		pushq	%r15
+ 2298 1926 4156     		pushq	%r14
+ 2299              		.cfi_offset 15, -24
+ 2300              		.cfi_offset 14, -32
+ 2301 1928 4189D6   		movl	%edx, %r14d
+ 2302 192b 4155     		pushq	%r13
+ 2303 192d 4154     		pushq	%r12
+ 2304              		.cfi_offset 13, -40
+ 2305              		.cfi_offset 12, -48
+ 2306 192f 4189CC   		movl	%ecx, %r12d
+ 2307 1932 4152     		pushq	%r10
+ 2308              		.cfi_offset 10, -56
+ 2309 1934 4C8D5510 		leaq	16(%rbp), %r10
+ 2310 1938 53       		pushq	%rbx
+ 2311              		.cfi_offset 3, -64
+ 2312 1939 4889FB   		movq	%rdi, %rbx
+ 2313 193c 4C89C7   		movq	%r8, %rdi
+ 2314 193f 4881ECB0 		subq	$432, %rsp
+ 2314      010000
+ 2315 1946 498B02   		movq	(%r10), %rax
+ 2316 1949 C5FE6F0E 		vmovdqu	(%rsi), %ymm1
+ 2317 194d 4C898568 		movq	%r8, -408(%rbp)
+ 2317      FEFFFF
+ 2318 1954 4C898D40 		movq	%r9, -448(%rbp)
+ 2318      FEFFFF
+ 2319 195b BE100000 		movl	$16, %esi
+ 2319      00
+ 2320 1960 458B6A08 		movl	8(%r10), %r13d
+ 2321 1964 48898538 		movq	%rax, -456(%rbp)
+ 2321      FEFFFF
+ 2322 196b 498B4210 		movq	16(%r10), %rax
+ 2323 196f C5FE7F8D 		vmovdqu	%ymm1, -336(%rbp)
+ 2323      B0FEFFFF 
+ 2324 1977 48898548 		movq	%rax, -440(%rbp)
+ 2324      FEFFFF
+ 2325 197e 488D85B0 		leaq	-336(%rbp), %rax
+ 2325      FEFFFF
+ 2326 1985 48898550 		movq	%rax, -432(%rbp)
+ 2326      FEFFFF
+ 2327 198c 4889C2   		movq	%rax, %rdx
+ 2328 198f C5F877   		vzeroupper
+ 2329 1992 E8000000 		call	sf_open@PLT
+ 2329      00
+ 2330 1997 4885C0   		testq	%rax, %rax
+ 2331 199a 0F844003 		je	.L270
+ 2331      0000
+ 2332 19a0 8B95B8FE 		movl	-328(%rbp), %edx
+ 2332      FFFF
+ 2333 19a6 488D3500 		leaq	.LC61(%rip), %rsi
+ 2333      000000
+ 2334 19ad 4489EF   		movl	%r13d, %edi
+ 2335 19b0 4989C7   		movq	%rax, %r15
+ 2336 19b3 31C0     		xorl	%eax, %eax
+ 2337 19b5 E8000000 		call	debugprint@PLT
+ 2337      00
+ 2338 19ba 8B95BCFE 		movl	-324(%rbp), %edx
+ 2338      FFFF
+ 2339 19c0 31C0     		xorl	%eax, %eax
+ 2340 19c2 4489EF   		movl	%r13d, %edi
+ 2341 19c5 488D3500 		leaq	.LC62(%rip), %rsi
+ 2341      000000
+ 2342 19cc E8000000 		call	debugprint@PLT
+ 2342      00
+ 2343 19d1 8B85BCFE 		movl	-324(%rbp), %eax
+ 2343      FFFF
+ 2344 19d7 898564FE 		movl	%eax, -412(%rbp)
+ 2344      FFFF
+ 2345 19dd 83E801   		subl	$1, %eax
+ 2346 19e0 83F807   		cmpl	$7, %eax
+ 2347 19e3 0F87BF02 		ja	.L271
+ 2347      0000
+ 2348 19e9 488B85B8 		movq	-328(%rbp), %rax
+ 2348      FEFFFF
+ 2349 19f0 48898398 		movq	%rax, 152(%rbx)
+ 2349      000000
+ 2350 19f7 4585F6   		testl	%r14d, %r14d
+ 2351 19fa 0F846002 		je	.L272
+ 2351      0000
+ 2352 1a00 4489B3A4 		movl	%r14d, 164(%rbx)
+ 2352      000000
+ 2353 1a07 4889DF   		movq	%rbx, %rdi
+ 2354 1a0a E8000000 		call	init_dsp@PLT
+ 2354      00
+ 2355 1a0f 448BB3A4 		movl	164(%rbx), %r14d
+ 2355      000000
+ 2356              	.L232:
+ 2357 1a16 4889DF   		movq	%rbx, %rdi
+ 2358 1a19 E8000000 		call	outchannels_dsp@PLT
+ 2358      00
+ 2359 1a1e 89855CFE 		movl	%eax, -420(%rbp)
+ 2359      FFFF
+ 2360 1a24 488B85B0 		movq	-336(%rbp), %rax
+ 2360      FEFFFF
+ 2361 1a2b 4885C0   		testq	%rax, %rax
+ 2362 1a2e 7E0A     		jle	.L233
+ 2363 1a30 4489E2   		movl	%r12d, %edx
+ 2364 1a33 4839D0   		cmpq	%rdx, %rax
+ 2365 1a36 440F4CE0 		cmovl	%eax, %r12d
+ 2366              	.L233:
+ 2367 1a3a 4489B560 		movl	%r14d, -416(%rbp)
+ 2367      FEFFFF
+ 2368 1a41 4539E6   		cmpl	%r12d, %r14d
+ 2369 1a44 7312     		jnb	.L234
+ 2370 1a46 4489F0   		movl	%r14d, %eax
+ 2371 1a49 438D5426 		leal	-1(%r14,%r12), %edx
+ 2371      FF
+ 2372 1a4e F7D8     		negl	%eax
+ 2373 1a50 21C2     		andl	%eax, %edx
+ 2374 1a52 899560FE 		movl	%edx, -416(%rbp)
+ 2374      FFFF
+ 2375              	.L234:
+ 2376 1a58 448B8560 		movl	-416(%rbp), %r8d
+ 2376      FEFFFF
+ 2377 1a5f 458D6501 		leal	1(%r13), %r12d
+ 2378 1a63 31C0     		xorl	%eax, %eax
+ 2379 1a65 4489F1   		movl	%r14d, %ecx
+ 2380 1a68 488D1500 		leaq	__func__.3(%rip), %rdx
+ 2380      000000
+ 2381 1a6f 488D3500 		leaq	.LC64(%rip), %rsi
+ 2381      000000
+ 2382 1a76 4489E7   		movl	%r12d, %edi
+ 2383 1a79 E8000000 		call	debugprint@PLT
+ 2383      00
+ 2384 1a7e C5FE6F95 		vmovdqu	-336(%rbp), %ymm2
+ 2384      B0FEFFFF 
+ 2385 1a86 8B855CFE 		movl	-420(%rbp), %eax
+ 2385      FFFF
+ 2386 1a8c 488B9550 		movq	-432(%rbp), %rdx
+ 2386      FEFFFF
+ 2387 1a93 488BB568 		movq	-408(%rbp), %rsi
+ 2387      FEFFFF
+ 2388 1a9a C5FE7F95 		vmovdqu	%ymm2, -304(%rbp)
+ 2388      D0FEFFFF 
+ 2389 1aa2 8985DCFE 		movl	%eax, -292(%rbp)
+ 2389      FFFF
+ 2390 1aa8 488D85F0 		leaq	-272(%rbp), %rax
+ 2390      FEFFFF
+ 2391 1aaf 48898530 		movq	%rax, -464(%rbp)
+ 2391      FEFFFF
+ 2392 1ab6 4889C7   		movq	%rax, %rdi
+ 2393 1ab9 C5F877   		vzeroupper
+ 2394 1abc E8000000 		call	mapfile_open_input@PLT
+ 2394      00
+ 2395 1ac1 84C0     		testb	%al, %al
+ 2396 1ac3 0F853702 		jne	.L235
+ 2396      0000
+ 2397 1ac9 488D0D00 		leaq	.LC65(%rip), %rcx
+ 2397      000000
+ 2398 1ad0 488D1500 		leaq	__func__.3(%rip), %rdx
+ 2398      000000
+ 2399 1ad7 4489E7   		movl	%r12d, %edi
+ 2400 1ada 488D3500 		leaq	.LC66(%rip), %rsi
+ 2400      000000
+ 2401 1ae1 E8000000 		call	debugprint@PLT
+ 2401      00
+ 2402 1ae6 4C8D85D0 		leaq	-304(%rbp), %r8
+ 2402      FEFFFF
+ 2403              	.L236:
+ 2404 1aed 488BBD40 		movq	-448(%rbp), %rdi
+ 2404      FEFFFF
+ 2405 1af4 4C89C2   		movq	%r8, %rdx
+ 2406 1af7 BE200000 		movl	$32, %esi
+ 2406      00
+ 2407 1afc E8000000 		call	sf_open@PLT
+ 2407      00
+ 2408 1b01 488B9540 		movq	-448(%rbp), %rdx
+ 2408      FEFFFF
+ 2409 1b08 488D3500 		leaq	.LC37(%rip), %rsi
+ 2409      000000
+ 2410 1b0f 4989C4   		movq	%rax, %r12
+ 2411 1b12 4885C0   		testq	%rax, %rax
+ 2412 1b15 0F849B01 		je	.L266
+ 2412      0000
+ 2413 1b1b 8BBDE0FE 		movl	-288(%rbp), %edi
+ 2413      FFFF
+ 2414 1b21 E8000000 		call	quantize_bits@PLT
+ 2414      00
+ 2415 1b26 85C0     		testl	%eax, %eax
+ 2416 1b28 0F85F203 		jne	.L273
+ 2416      0000
+ 2417 1b2e 4883BD38 		cmpq	$0, -456(%rbp)
+ 2417      FEFFFF00 
+ 2418 1b36 740F     		je	.L269
+ 2419 1b38 488BB538 		movq	-456(%rbp), %rsi
+ 2419      FEFFFF
+ 2420 1b3f 4889DF   		movq	%rbx, %rdi
+ 2421 1b42 E8000000 		call	write_codegen@PLT
+ 2421      00
+ 2422              	.L269:
+ 2423 1b47 C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 2424 1b4b 488DB590 		leaq	-368(%rbp), %rsi
+ 2424      FEFFFF
+ 2425 1b52 BF010000 		movl	$1, %edi
+ 2425      00
+ 2426 1b57 C5F97F85 		vmovdqa	%xmm0, -400(%rbp)
+ 2426      70FEFFFF 
+ 2427 1b5f E8000000 		call	clock_gettime@PLT
+ 2427      00
+ 2428 1b64 31C9     		xorl	%ecx, %ecx
+ 2429              	.L253:
+ 2430 1b66 4883EC08 		subq	$8, %rsp
+ 2431 1b6a 4C89E2   		movq	%r12, %rdx
+ 2432 1b6d 4889DF   		movq	%rbx, %rdi
+ 2433 1b70 4C89FE   		movq	%r15, %rsi
+ 2434 1b73 488D8570 		leaq	-400(%rbp), %rax
+ 2434      FEFFFF
+ 2435 1b7a 448B8D5C 		movl	-420(%rbp), %r9d
+ 2435      FEFFFF
+ 2436 1b81 448B8564 		movl	-412(%rbp), %r8d
+ 2436      FEFFFF
+ 2437 1b88 50       		pushq	%rax
+ 2438 1b89 8B8560FE 		movl	-416(%rbp), %eax
+ 2438      FFFF
+ 2439 1b8f 4156     		pushq	%r14
+ 2440 1b91 50       		pushq	%rax
+ 2441 1b92 E8000000 		call	run_pipeline@PLT
+ 2441      00
+ 2442 1b97 4883C420 		addq	$32, %rsp
+ 2443 1b9b BF010000 		movl	$1, %edi
+ 2443      00
+ 2444 1ba0 488DB5A0 		leaq	-352(%rbp), %rsi
+ 2444      FEFFFF
+ 2445 1ba7 89C3     		movl	%eax, %ebx
+ 2446 1ba9 E8000000 		call	clock_gettime@PLT
+ 2446      00
+ 2447 1bae 488B8DA8 		movq	-344(%rbp), %rcx
+ 2447      FEFFFF
+ 2448 1bb5 488BBD90 		movq	-368(%rbp), %rdi
+ 2448      FEFFFF
+ 2449 1bbc 488BB598 		movq	-360(%rbp), %rsi
+ 2449      FEFFFF
+ 2450 1bc3 488B95A0 		movq	-352(%rbp), %rdx
+ 2450      FEFFFF
+ 2451 1bca E8000000 		call	timespecsub@PLT
+ 2451      00
+ 2452 1bcf 488DB580 		leaq	-384(%rbp), %rsi
+ 2452      FEFFFF
+ 2453 1bd6 BF030000 		movl	$3, %edi
+ 2453      00
+ 2454 1bdb 48899598 		movq	%rdx, -360(%rbp)
+ 2454      FEFFFF
+ 2455 1be2 48898590 		movq	%rax, -368(%rbp)
+ 2455      FEFFFF
+ 2456 1be9 E8000000 		call	clock_getres@PLT
+ 2456      00
+ 2457 1bee FFB598FE 		pushq	-360(%rbp)
+ 2457      FFFF
+ 2458 1bf4 89DA     		movl	%ebx, %edx
+ 2459 1bf6 4489EF   		movl	%r13d, %edi
+ 2460 1bf9 FFB590FE 		pushq	-368(%rbp)
+ 2460      FFFF
+ 2461 1bff 488D3500 		leaq	.LC68(%rip), %rsi
+ 2461      000000
+ 2462 1c06 31C0     		xorl	%eax, %eax
+ 2463 1c08 488B8D70 		movq	-400(%rbp), %rcx
+ 2463      FEFFFF
+ 2464 1c0f 4C8B8D88 		movq	-376(%rbp), %r9
+ 2464      FEFFFF
+ 2465 1c16 4C8B8578 		movq	-392(%rbp), %r8
+ 2465      FEFFFF
+ 2466 1c1d E8000000 		call	debugprint@PLT
+ 2466      00
+ 2467 1c22 4C89FF   		movq	%r15, %rdi
+ 2468 1c25 E8000000 		call	sf_close@PLT
+ 2468      00
+ 2469 1c2a 5A       		popq	%rdx
+ 2470 1c2b 59       		popq	%rcx
+ 2471 1c2c 85C0     		testl	%eax, %eax
+ 2472 1c2e 0F854A02 		jne	.L244
+ 2472      0000
+ 2473              	.L246:
+ 2474 1c34 4C89E7   		movq	%r12, %rdi
+ 2475 1c37 E8000000 		call	sf_close@PLT
+ 2475      00
+ 2476 1c3c 85C0     		testl	%eax, %eax
+ 2477 1c3e 0F856C02 		jne	.L274
+ 2477      0000
+ 2478              	.L247:
+ 2479 1c44 48638564 		movslq	-412(%rbp), %rax
+ 2479      FEFFFF
+ 2480 1c4b 480FAFD8 		imulq	%rax, %rbx
+ 2481 1c4f 488B8548 		movq	-440(%rbp), %rax
+ 2481      FEFFFF
+ 2482 1c56 488918   		movq	%rbx, (%rax)
+ 2483 1c59 B8010000 		movl	$1, %eax
+ 2483      00
+ 2484 1c5e EB69     		jmp	.L225
+ 2485              		.p2align 4,,10
+ 2486              		.p2align 3
+ 2487              	.L272:
+ 2488 1c60 C783A400 		movl	$64, 164(%rbx)
+ 2488      00004000 
+ 2488      0000
+ 2489 1c6a 4889DF   		movq	%rbx, %rdi
+ 2490 1c6d E8000000 		call	init_dsp@PLT
+ 2490      00
+ 2491 1c72 4889DF   		movq	%rbx, %rdi
+ 2492 1c75 E8000000 		call	auto_framesize@PLT
+ 2492      00
+ 2493 1c7a 448BB3A4 		movl	164(%rbx), %r14d
+ 2493      000000
+ 2494 1c81 4439F0   		cmpl	%r14d, %eax
+ 2495 1c84 0F848CFD 		je	.L232
+ 2495      FFFF
+ 2496 1c8a 8983A400 		movl	%eax, 164(%rbx)
+ 2496      0000
+ 2497 1c90 4889DF   		movq	%rbx, %rdi
+ 2498 1c93 E8000000 		call	init_dsp@PLT
+ 2498      00
+ 2499 1c98 448BB3A4 		movl	164(%rbx), %r14d
+ 2499      000000
+ 2500 1c9f E972FDFF 		jmp	.L232
+ 2500      FF
+ 2501              		.p2align 4,,10
+ 2502 1ca4 0F1F4000 		.p2align 3
+ 2503              	.L271:
+ 2504 1ca8 488B9568 		movq	-408(%rbp), %rdx
+ 2504      FEFFFF
+ 2505 1caf 488D3500 		leaq	.LC63(%rip), %rsi
+ 2505      000000
+ 2506              	.L266:
+ 2507 1cb6 31FF     		xorl	%edi, %edi
+ 2508 1cb8 31C0     		xorl	%eax, %eax
+ 2509 1cba E8000000 		call	debugprint@PLT
+ 2509      00
+ 2510 1cbf 4C89FF   		movq	%r15, %rdi
+ 2511 1cc2 E8000000 		call	sf_close@PLT
+ 2511      00
+ 2512              	.L227:
+ 2513 1cc7 31C0     		xorl	%eax, %eax
+ 2514              	.L225:
+ 2515 1cc9 488D65D0 		leaq	-48(%rbp), %rsp
+ 2516 1ccd 5B       		popq	%rbx
+ 2517 1cce 415A     		popq	%r10
+ 2518 1cd0 415C     		popq	%r12
+ 2519 1cd2 415D     		popq	%r13
+ 2520 1cd4 415E     		popq	%r14
+ 2521 1cd6 415F     		popq	%r15
+ 2522 1cd8 5D       		popq	%rbp
+ 2523              		.cfi_remember_state
+ 2524              		.cfi_def_cfa 7, 8
+ 2525 1cd9 C3       		ret
+ 2526 1cda 660F1F44 		.p2align 4,,10
+ 2526      0000
+ 2527              		.p2align 3
+ 2528              	.L270:
+ 2529              		.cfi_restore_state
+ 2530 1ce0 488B9568 		movq	-408(%rbp), %rdx
+ 2530      FEFFFF
+ 2531 1ce7 488D3500 		leaq	.LC60(%rip), %rsi
+ 2531      000000
+ 2532 1cee 31FF     		xorl	%edi, %edi
+ 2533 1cf0 31C0     		xorl	%eax, %eax
+ 2534 1cf2 E8000000 		call	debugprint@PLT
+ 2534      00
+ 2535 1cf7 EBCE     		jmp	.L227
+ 2536 1cf9 0F1F8000 		.p2align 4,,10
+ 2536      000000
+ 2537              		.p2align 3
+ 2538              	.L235:
+ 2539 1d00 4C8D85D0 		leaq	-304(%rbp), %r8
+ 2539      FEFFFF
+ 2540 1d07 488B8DB0 		movq	-336(%rbp), %rcx
+ 2540      FEFFFF
+ 2541 1d0e 488BB540 		movq	-448(%rbp), %rsi
+ 2541      FEFFFF
+ 2542 1d15 488DBD20 		leaq	-224(%rbp), %rdi
+ 2542      FFFFFF
+ 2543 1d1c 4C89C2   		movq	%r8, %rdx
+ 2544 1d1f 4C898528 		movq	%r8, -472(%rbp)
+ 2544      FEFFFF
+ 2545 1d26 4889BD50 		movq	%rdi, -432(%rbp)
+ 2545      FEFFFF
+ 2546 1d2d E8000000 		call	mapfile_create_output@PLT
+ 2546      00
+ 2547 1d32 4C8B8528 		movq	-472(%rbp), %r8
+ 2547      FEFFFF
+ 2548 1d39 84C0     		testb	%al, %al
+ 2549 1d3b 0F849F01 		je	.L275
+ 2549      0000
+ 2550 1d41 31C0     		xorl	%eax, %eax
+ 2551 1d43 488D0D00 		leaq	.LC67(%rip), %rcx
+ 2551      000000
+ 2552 1d4a 4489E7   		movl	%r12d, %edi
+ 2553 1d4d 488D1500 		leaq	__func__.3(%rip), %rdx
+ 2553      000000
+ 2554 1d54 488D3500 		leaq	.LC66(%rip), %rsi
+ 2554      000000
+ 2555 1d5b E8000000 		call	debugprint@PLT
+ 2555      00
+ 2556 1d60 4883BD38 		cmpq	$0, -456(%rbp)
+ 2556      FEFFFF00 
+ 2557 1d68 740F     		je	.L267
+ 2558 1d6a 488BB538 		movq	-456(%rbp), %rsi
+ 2558      FEFFFF
+ 2559 1d71 4889DF   		movq	%rbx, %rdi
+ 2560 1d74 E8000000 		call	write_codegen@PLT
+ 2560      00
+ 2561              	.L267:
+ 2562 1d79 C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 2563 1d7d 488DB590 		leaq	-368(%rbp), %rsi
+ 2563      FEFFFF
+ 2564 1d84 BF010000 		movl	$1, %edi
+ 2564      00
+ 2565 1d89 C5F97F85 		vmovdqa	%xmm0, -400(%rbp)
+ 2565      70FEFFFF 
+ 2566 1d91 E8000000 		call	clock_gettime@PLT
+ 2566      00
+ 2567 1d96 4883EC08 		subq	$8, %rsp
+ 2568 1d9a 4589F1   		movl	%r14d, %r9d
+ 2569 1d9d 488D8570 		leaq	-400(%rbp), %rax
+ 2569      FEFFFF
+ 2570 1da4 50       		pushq	%rax
+ 2571 1da5 8B8D64FE 		movl	-412(%rbp), %ecx
+ 2571      FFFF
+ 2572 1dab 4889DF   		movq	%rbx, %rdi
+ 2573 1dae 448B855C 		movl	-420(%rbp), %r8d
+ 2573      FEFFFF
+ 2574 1db5 488B9550 		movq	-432(%rbp), %rdx
+ 2574      FEFFFF
+ 2575 1dbc 488BB530 		movq	-464(%rbp), %rsi
+ 2575      FEFFFF
+ 2576 1dc3 E8000000 		call	run_mapped@PLT
+ 2576      00
+ 2577 1dc8 488DB5A0 		leaq	-352(%rbp), %rsi
+ 2577      FEFFFF
+ 2578 1dcf BF010000 		movl	$1, %edi
+ 2578      00
+ 2579 1dd4 89C3     		movl	%eax, %ebx
+ 2580 1dd6 E8000000 		call	clock_gettime@PLT
+ 2580      00
+ 2581 1ddb 488B8DA8 		movq	-344(%rbp), %rcx
+ 2581      FEFFFF
+ 2582 1de2 488BBD90 		movq	-368(%rbp), %rdi
+ 2582      FEFFFF
+ 2583 1de9 488BB598 		movq	-360(%rbp), %rsi
+ 2583      FEFFFF
+ 2584 1df0 488B95A0 		movq	-352(%rbp), %rdx
+ 2584      FEFFFF
+ 2585 1df7 E8000000 		call	timespecsub@PLT
+ 2585      00
+ 2586 1dfc 488DB580 		leaq	-384(%rbp), %rsi
+ 2586      FEFFFF
+ 2587 1e03 BF030000 		movl	$3, %edi
+ 2587      00
+ 2588 1e08 48899598 		movq	%rdx, -360(%rbp)
+ 2588      FEFFFF
+ 2589 1e0f 48898590 		movq	%rax, -368(%rbp)
+ 2589      FEFFFF
+ 2590 1e16 E8000000 		call	clock_getres@PLT
+ 2590      00
+ 2591 1e1b FFB598FE 		pushq	-360(%rbp)
+ 2591      FFFF
+ 2592 1e21 31C0     		xorl	%eax, %eax
+ 2593 1e23 89DA     		movl	%ebx, %edx
+ 2594 1e25 FFB590FE 		pushq	-368(%rbp)
+ 2594      FFFF
+ 2595 1e2b 488D3500 		leaq	.LC68(%rip), %rsi
+ 2595      000000
+ 2596 1e32 4489EF   		movl	%r13d, %edi
+ 2597 1e35 4C8B8D88 		movq	-376(%rbp), %r9
+ 2597      FEFFFF
+ 2598 1e3c 4C8B8578 		movq	-392(%rbp), %r8
+ 2598      FEFFFF
+ 2599 1e43 488B8D70 		movq	-400(%rbp), %rcx
+ 2599      FEFFFF
+ 2600 1e4a E8000000 		call	debugprint@PLT
+ 2600      00
+ 2601 1e4f 488BBD30 		movq	-464(%rbp), %rdi
+ 2601      FEFFFF
+ 2602 1e56 4883C420 		addq	$32, %rsp
+ 2603 1e5a E8000000 		call	mapfile_close@PLT
+ 2603      00
+ 2604 1e5f 488BBD50 		movq	-432(%rbp), %rdi
+ 2604      FEFFFF
+ 2605 1e66 E8000000 		call	mapfile_close@PLT
+ 2605      00
+ 2606 1e6b 4C89FF   		movq	%r15, %rdi
+ 2607 1e6e E8000000 		call	sf_close@PLT
+ 2607      00
+ 2608 1e73 85C0     		testl	%eax, %eax
+ 2609 1e75 0F84C9FD 		je	.L247
+ 2609      FFFF
+ 2610 1e7b 4531E4   		xorl	%r12d, %r12d
+ 2611              	.L244:
+ 2612 1e7e 4C89FF   		movq	%r15, %rdi
+ 2613 1e81 E8000000 		call	sf_strerror@PLT
+ 2613      00
+ 2614 1e86 488B9568 		movq	-408(%rbp), %rdx
+ 2614      FEFFFF
+ 2615 1e8d 31FF     		xorl	%edi, %edi
+ 2616 1e8f 488D3500 		leaq	.LC69(%rip), %rsi
+ 2616      000000
+ 2617 1e96 4889C1   		movq	%rax, %rcx
+ 2618 1e99 31C0     		xorl	%eax, %eax
+ 2619 1e9b E8000000 		call	debugprint@PLT
+ 2619      00
+ 2620 1ea0 4D85E4   		testq	%r12, %r12
+ 2621 1ea3 0F858BFD 		jne	.L246
+ 2621      FFFF
+ 2622 1ea9 E996FDFF 		jmp	.L247
+ 2622      FF
+ 2623 1eae 6690     		.p2align 4,,10
+ 2624              		.p2align 3
+ 2625              	.L274:
+ 2626 1eb0 4C89E7   		movq	%r12, %rdi
+ 2627 1eb3 E8000000 		call	sf_strerror@PLT
+ 2627      00
+ 2628 1eb8 488B9540 		movq	-448(%rbp), %rdx
+ 2628      FEFFFF
+ 2629 1ebf 488D3500 		leaq	.LC69(%rip), %rsi
+ 2629      000000
+ 2630 1ec6 31FF     		xorl	%edi, %edi
+ 2631 1ec8 4889C1   		movq	%rax, %rcx
+ 2632 1ecb 31C0     		xorl	%eax, %eax
+ 2633 1ecd E8000000 		call	debugprint@PLT
+ 2633      00
+ 2634 1ed2 E96DFDFF 		jmp	.L247
+ 2634      FF
+ 2635 1ed7 660F1F84 		.p2align 4,,10
+ 2635      00000000 
+ 2635      00
+ 2636              		.p2align 3
+ 2637              	.L275:
+ 2638 1ee0 488BBD30 		movq	-464(%rbp), %rdi
+ 2638      FEFFFF
+ 2639 1ee7 4C898550 		movq	%r8, -432(%rbp)
+ 2639      FEFFFF
+ 2640 1eee E8000000 		call	mapfile_close@PLT
+ 2640      00
+ 2641 1ef3 488D0D00 		leaq	.LC65(%rip), %rcx
+ 2641      000000
+ 2642 1efa 4489E7   		movl	%r12d, %edi
+ 2643 1efd 31C0     		xorl	%eax, %eax
+ 2644 1eff 488D1500 		leaq	__func__.3(%rip), %rdx
+ 2644      000000
+ 2645 1f06 488D3500 		leaq	.LC66(%rip), %rsi
+ 2645      000000
+ 2646 1f0d E8000000 		call	debugprint@PLT
+ 2646      00
+ 2647 1f12 4C8B8550 		movq	-432(%rbp), %r8
+ 2647      FEFFFF
+ 2648 1f19 E9CFFBFF 		jmp	.L236
+ 2648      FF
+ 2649 1f1e 6690     		.p2align 4,,10
+ 2650              		.p2align 3
+ 2651              	.L273:
+ 2652 1f20 488D8D50 		leaq	-176(%rbp), %rcx
+ 2652      FFFFFF
+ 2653 1f27 8B350000 		movl	dither(%rip), %esi
+ 2653      0000
+ 2654 1f2d 89C2     		movl	%eax, %edx
+ 2655 1f2f 48898D50 		movq	%rcx, -432(%rbp)
+ 2655      FEFFFF
+ 2656 1f36 4889CF   		movq	%rcx, %rdi
+ 2657 1f39 8B8D5CFE 		movl	-420(%rbp), %ecx
+ 2657      FFFF
+ 2658 1f3f E8000000 		call	quantize_init@PLT
+ 2658      00
+ 2659 1f44 4883BD38 		cmpq	$0, -456(%rbp)
+ 2659      FEFFFF00 
+ 2660 1f4c 740F     		je	.L268
+ 2661 1f4e 488BB538 		movq	-456(%rbp), %rsi
+ 2661      FEFFFF
+ 2662 1f55 4889DF   		movq	%rbx, %rdi
+ 2663 1f58 E8000000 		call	write_codegen@PLT
+ 2663      00
+ 2664              	.L268:
+ 2665 1f5d C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 2666 1f61 488DB590 		leaq	-368(%rbp), %rsi
+ 2666      FEFFFF
+ 2667 1f68 BF010000 		movl	$1, %edi
+ 2667      00
+ 2668 1f6d C5F97F85 		vmovdqa	%xmm0, -400(%rbp)
+ 2668      70FEFFFF 
+ 2669 1f75 E8000000 		call	clock_gettime@PLT
+ 2669      00
+ 2670 1f7a 488B8D50 		movq	-432(%rbp), %rcx
+ 2670      FEFFFF
+ 2671 1f81 E9E0FBFF 		jmp	.L253
+ 2671      FF
+ 2672              		.cfi_endproc
+ 2673              	.LFE33:
+ 2675              		.section	.rodata.str1.1
+ 2676              	.LC70:
+ 2677 01d3 62617463 		.string	"batch worker"
+ 2677      6820776F 
+ 2677      726B6572 
+ 2677      00
+ 2678              	.LC71:
+ 2679 01e0 50726F63 		.string	"Processing %s -> %s\n"
+ 2679      65737369 
+ 2679      6E672025 
+ 2679      73202D3E 
+ 2679      2025730A 
+ 2680              		.text
+ 2681 1f86 662E0F1F 		.p2align 4
+ 2681      84000000 
+ 2681      0000
+ 2682              		.globl	batch_worker
+ 2684              	batch_worker:
+ 2685              	.LFB34:
+ 2686              		.cfi_startproc
+ 2687 1f90 4156     		pushq	%r14
+ 2688              		.cfi_def_cfa_offset 16
+ 2689              		.cfi_offset 14, -16
+ 2690 1f92 4C8D3500 		leaq	.LC71(%rip), %r14
+ 2690      000000
+ 2691 1f99 4155     		pushq	%r13
+ 2692              		.cfi_def_cfa_offset 24
+ 2693              		.cfi_offset 13, -24
+ 2694 1f9b 4989FD   		movq	%rdi, %r13
+ 2695 1f9e 4154     		pushq	%r12
+ 2696              		.cfi_def_cfa_offset 32
+ 2697              		.cfi_offset 12, -32
+ 2698 1fa0 55       		pushq	%rbp
+ 2699              		.cfi_def_cfa_offset 40
+ 2700              		.cfi_offset 6, -40
+ 2701 1fa1 53       		pushq	%rbx
+ 2702              		.cfi_def_cfa_offset 48
+ 2703              		.cfi_offset 3, -48
+ 2704 1fa2 4883EC10 		subq	$16, %rsp
+ 2705              		.cfi_def_cfa_offset 64
+ 2706 1fa6 488B1F   		movq	(%rdi), %rbx
+ 2707 1fa9 488D3D00 		leaq	.LC70(%rip), %rdi
+ 2707      000000
+ 2708 1fb0 E8000000 		call	trace_thread_name@PLT
+ 2708      00
+ 2709 1fb5 4C8D6314 		leaq	20(%rbx), %r12
+ 2710 1fb9 0F1F8000 		.p2align 4,,10
+ 2710      000000
+ 2711              		.p2align 3
+ 2712              	.L277:
+ 2713 1fc0 BD010000 		movl	$1, %ebp
+ 2713      00
+ 2714 1fc5 F0410FC1 		lock xaddl	%ebp, (%r12)
+ 2714      2C24
+ 2715 1fcb 396B10   		cmpl	%ebp, 16(%rbx)
+ 2716 1fce 7E70     		jle	.L282
+ 2717 1fd0 488B4308 		movq	8(%rbx), %rax
+ 2718 1fd4 4863ED   		movslq	%ebp, %rbp
+ 2719 1fd7 4C89F6   		movq	%r14, %rsi
+ 2720 1fda BF010000 		movl	$1, %edi
+ 2720      00
+ 2721 1fdf 488B0CE8 		movq	(%rax,%rbp,8), %rcx
+ 2722 1fe3 488B03   		movq	(%rbx), %rax
+ 2723 1fe6 488B14E8 		movq	(%rax,%rbp,8), %rdx
+ 2724 1fea 31C0     		xorl	%eax, %eax
+ 2725 1fec E8000000 		call	debugprint@PLT
+ 2725      00
+ 2726 1ff1 488B4308 		movq	8(%rbx), %rax
+ 2727 1ff5 4883EC08 		subq	$8, %rsp
+ 2728              		.cfi_def_cfa_offset 72
+ 2729 1ff9 8B4B34   		movl	52(%rbx), %ecx
+ 2730 1ffc 8B5330   		movl	48(%rbx), %edx
+ 2731 1fff 488B7328 		movq	40(%rbx), %rsi
+ 2732 2003 4C8B0CE8 		movq	(%rax,%rbp,8), %r9
+ 2733 2007 488B03   		movq	(%rbx), %rax
+ 2734 200a 498B7D08 		movq	8(%r13), %rdi
+ 2735 200e 4C8B04E8 		movq	(%rax,%rbp,8), %r8
+ 2736 2012 488D4424 		leaq	16(%rsp), %rax
+ 2736      10
+ 2737 2017 50       		pushq	%rax
+ 2738              		.cfi_def_cfa_offset 80
+ 2739 2018 6A01     		pushq	$1
+ 2740              		.cfi_def_cfa_offset 88
+ 2741 201a 6A00     		pushq	$0
+ 2742              		.cfi_def_cfa_offset 96
+ 2743 201c E8000000 		call	process_file@PLT
+ 2743      00
+ 2744 2021 4883C420 		addq	$32, %rsp
+ 2745              		.cfi_def_cfa_offset 64
+ 2746 2025 84C0     		testb	%al, %al
+ 2747 2027 740F     		je	.L278
+ 2748 2029 488B4424 		movq	8(%rsp), %rax
+ 2748      08
+ 2749 202e F0480143 		lock addq	%rax, 32(%rbx)
+ 2749      20
+ 2750 2033 EB8B     		jmp	.L277
+ 2751              		.p2align 4,,10
+ 2752 2035 0F1F00   		.p2align 3
+ 2753              	.L278:
+ 2754 2038 F0834318 		lock addl	$1, 24(%rbx)
+ 2754      01
+ 2755 203d EB81     		jmp	.L277
+ 2756 203f 90       		.p2align 4,,10
+ 2757              		.p2align 3
+ 2758              	.L282:
+ 2759 2040 4883C410 		addq	$16, %rsp
+ 2760              		.cfi_def_cfa_offset 48
+ 2761 2044 31C0     		xorl	%eax, %eax
+ 2762 2046 5B       		popq	%rbx
+ 2763              		.cfi_def_cfa_offset 40
+ 2764 2047 5D       		popq	%rbp
+ 2765              		.cfi_def_cfa_offset 32
+ 2766 2048 415C     		popq	%r12
+ 2767              		.cfi_def_cfa_offset 24
+ 2768 204a 415D     		popq	%r13
+ 2769              		.cfi_def_cfa_offset 16
+ 2770 204c 415E     		popq	%r14
+ 2771              		.cfi_def_cfa_offset 8
+ 2772 204e C3       		ret
+ 2773              		.cfi_endproc
+ 2774              	.LFE34:
+ 2776              		.section	.rodata.str1.1
+ 2777              	.LC72:
+ 2778 01f5 73657276 		.string	"server worker"
+ 2778      65722077 
+ 2778      6F726B65 
+ 2778      7200
+ 2779              	.LC73:
+ 2780 0203 25733A20 		.string	"%s: accept failed: %s\n"
+ 2780      61636365 
+ 2780      70742066 
+ 2780      61696C65 
+ 2780      643A2025 
+ 2781              	.LC74:
+ 2782 021a 6572726F 		.string	"error request too long\n"
+ 2782      72207265 
+ 2782      71756573 
+ 2782      7420746F 
+ 2782      6F206C6F 
+ 2783              	.LC75:
+ 2784 0232 20090D0A 		.string	" \t\r\n"
+ 2784      00
+ 2785              	.LC76:
+ 2786 0237 66696C65 		.string	"file"
+ 2786      00
+ 2787              		.section	.rodata.str1.8
+ 2788 090f 00       		.align 8
+ 2789              	.LC77:
+ 2790 0910 6572726F 		.string	"error expected file <input> <output>\n"
+ 2790      72206578 
+ 2790      70656374 
+ 2790      65642066 
+ 2790      696C6520 
+ 2791 0936 0000     		.align 8
+ 2792              	.LC78:
+ 2793 0938 6572726F 		.string	"error expected an input and an output descriptor\n"
+ 2793      72206578 
+ 2793      70656374 
+ 2793      65642061 
+ 2793      6E20696E 
+ 2794              		.section	.rodata.str1.1
+ 2795              	.LC79:
+ 2796 023c 2F70726F 		.string	"/proc/self/fd/%d"
+ 2796      632F7365 
+ 2796      6C662F66 
+ 2796      642F2564 
+ 2796      00
+ 2797              	.LC80:
+ 2798 024d 636F6E74 		.string	"control"
+ 2798      726F6C00 
+ 2799              	.LC81:
+ 2800 0255 6F6B0A00 		.string	"ok\n"
+ 2801              		.section	.rodata.str1.8
+ 2802 096a 00000000 		.align 8
+ 2802      0000
+ 2803              	.LC82:
+ 2804 0970 6572726F 		.string	"error expected control <stage> <options>\n"
+ 2804      72206578 
+ 2804      70656374 
+ 2804      65642063 
+ 2804      6F6E7472 
+ 2805 099a 00000000 		.align 8
+ 2805      0000
+ 2806              	.LC83:
+ 2807 09a0 6572726F 		.string	"error could not change stage %ld\n"
+ 2807      7220636F 
+ 2807      756C6420 
+ 2807      6E6F7420 
+ 2807      6368616E 
+ 2808              		.section	.rodata.str1.1
+ 2809              	.LC84:
+ 2810 0259 6572726F 		.string	"error unknown request\n"
+ 2810      7220756E 
+ 2810      6B6E6F77 
+ 2810      6E207265 
+ 2810      71756573 
+ 2811              	.LC85:
+ 2812 0270 6572726F 		.string	"error could not process %s\n"
+ 2812      7220636F 
+ 2812      756C6420 
+ 2812      6E6F7420 
+ 2812      70726F63 
+ 2813              	.LC86:
+ 2814 028c 6F6B2025 		.string	"ok %llu %ld\n"
+ 2814      6C6C7520 
+ 2814      256C640A 
+ 2814      00
+ 2815              		.text
+ 2816 204f 90       		.p2align 4
+ 2817              		.globl	server_worker
+ 2819              	server_worker:
+ 2820              	.LFB43:
+ 2821              		.cfi_startproc
+ 2822 2050 55       		pushq	%rbp
+ 2823              		.cfi_def_cfa_offset 16
+ 2824              		.cfi_offset 6, -16
+ 2825 2051 4889E5   		movq	%rsp, %rbp
+ 2826              		.cfi_def_cfa_register 6
+ 2827 2054 4157     		pushq	%r15
+ 2828 2056 4156     		pushq	%r14
+ 2829              		.cfi_offset 15, -24
+ 2830              		.cfi_offset 14, -32
+ 2831 2058 49BE0100 		movabsq	$4294967297, %r14
+ 2831      00000100 
+ 2831      0000
+ 2832 2062 4155     		pushq	%r13
+ 2833              		.cfi_offset 13, -40
+ 2834 2064 4C8DAD90 		leaq	-8304(%rbp), %r13
+ 2834      DFFFFF
+ 2835 206b 4154     		pushq	%r12
+ 2836              		.cfi_offset 12, -48
+ 2837 206d 4989FC   		movq	%rdi, %r12
+ 2838 2070 488D3D00 		leaq	.LC72(%rip), %rdi
+ 2838      000000
+ 2839 2077 4152     		pushq	%r10
+ 2840 2079 4D89E7   		movq	%r12, %r15
+ 2841 207c 53       		pushq	%rbx
+ 2842              		.cfi_offset 10, -56
+ 2843              		.cfi_offset 3, -64
+ 2844 207d 4C89EB   		movq	%r13, %rbx
+ 2845 2080 4881EC10 		subq	$8464, %rsp
+ 2845      210000
+ 2846 2087 E8000000 		call	trace_thread_name@PLT
+ 2846      00
+ 2847 208c 488D85D0 		leaq	-8240(%rbp), %rax
+ 2847      DFFFFF
+ 2848 2093 488985F8 		movq	%rax, -8456(%rbp)
+ 2848      DEFFFF
+ 2849              	.L284:
+ 2850 209a 498B07   		movq	(%r15), %rax
+ 2851 209d 31D2     		xorl	%edx, %edx
+ 2852 209f 31F6     		xorl	%esi, %esi
+ 2853 20a1 8B38     		movl	(%rax), %edi
+ 2854 20a3 E8000000 		call	accept@PLT
+ 2854      00
+ 2855 20a8 4189C4   		movl	%eax, %r12d
+ 2856 20ab 85C0     		testl	%eax, %eax
+ 2857 20ad 7951     		jns	.L285
+ 2858 20af 498B07   		movq	(%r15), %rax
+ 2859 20b2 8B4004   		movl	4(%rax), %eax
+ 2860 20b5 85C0     		testl	%eax, %eax
+ 2861 20b7 7530     		jne	.L286
+ 2862 20b9 E8000000 		call	__errno_location@PLT
+ 2862      00
+ 2863 20be 8B38     		movl	(%rax), %edi
+ 2864 20c0 83FF04   		cmpl	$4, %edi
+ 2865 20c3 74D5     		je	.L284
+ 2866 20c5 83FF67   		cmpl	$103, %edi
+ 2867 20c8 74D0     		je	.L284
+ 2868 20ca E8000000 		call	strerror@PLT
+ 2868      00
+ 2869 20cf 488D1500 		leaq	__func__.2(%rip), %rdx
+ 2869      000000
+ 2870 20d6 488D3500 		leaq	.LC73(%rip), %rsi
+ 2870      000000
+ 2871 20dd 31FF     		xorl	%edi, %edi
+ 2872 20df 4889C1   		movq	%rax, %rcx
+ 2873 20e2 31C0     		xorl	%eax, %eax
+ 2874 20e4 E8000000 		call	debugprint@PLT
+ 2874      00
+ 2875              	.L286:
+ 2876 20e9 488D65D0 		leaq	-48(%rbp), %rsp
+ 2877 20ed 31C0     		xorl	%eax, %eax
+ 2878 20ef 5B       		popq	%rbx
+ 2879 20f0 415A     		popq	%r10
+ 2880 20f2 415C     		popq	%r12
+ 2881 20f4 415D     		popq	%r13
+ 2882 20f6 415E     		popq	%r14
+ 2883 20f8 415F     		popq	%r15
+ 2884 20fa 5D       		popq	%rbp
+ 2885              		.cfi_remember_state
+ 2886              		.cfi_def_cfa 7, 8
+ 2887 20fb C3       		ret
+ 2888 20fc 0F1F4000 		.p2align 4,,10
+ 2889              		.p2align 3
+ 2890              	.L285:
+ 2891              		.cfi_restore_state
+ 2892 2100 498D4710 		leaq	16(%r15), %rax
+ 2893 2104 4489E7   		movl	%r12d, %edi
+ 2894 2107 488985D8 		movq	%rax, -8488(%rbp)
+ 2894      DEFFFF
+ 2895 210e 8738     		xchgl	(%rax), %edi
+ 2896              		.p2align 4,,10
+ 2897              		.p2align 3
+ 2898              	.L288:
+ 2899 2110 498B07   		movq	(%r15), %rax
+ 2900 2113 8B4004   		movl	4(%rax), %eax
+ 2901 2116 85C0     		testl	%eax, %eax
+ 2902 2118 0F858200 		jne	.L318
+ 2902      0000
+ 2903 211e 488B85F8 		movq	-8456(%rbp), %rax
+ 2903      DEFFFF
+ 2904 2125 31D2     		xorl	%edx, %edx
+ 2905 2127 4889DE   		movq	%rbx, %rsi
+ 2906 212a 4489E7   		movl	%r12d, %edi
+ 2907 212d C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 2908 2131 48C78528 		movq	$4095, -8408(%rbp)
+ 2908      DFFFFFFF 
+ 2908      0F0000
+ 2909 213c 48898520 		movq	%rax, -8416(%rbp)
+ 2909      DFFFFF
+ 2910 2143 488D8520 		leaq	-8416(%rbp), %rax
+ 2910      DFFFFF
+ 2911 214a 62F17F28 		vmovdqu8	%ymm0, (%rbx)
+ 2911      7F03
+ 2912 2150 488985A0 		movq	%rax, -8288(%rbp)
+ 2912      DFFFFF
+ 2913 2157 488D8550 		leaq	-8368(%rbp), %rax
+ 2913      DFFFFF
+ 2914 215e 62F17F28 		vmovdqu8	%ymm0, 24(%rbx)
+ 2914      7F831800 
+ 2914      0000
+ 2915 2168 488985B0 		movq	%rax, -8272(%rbp)
+ 2915      DFFFFF
+ 2916 216f 48C785A8 		movq	$1, -8280(%rbp)
+ 2916      DFFFFF01 
+ 2916      000000
+ 2917 217a 48C785B8 		movq	$24, -8264(%rbp)
+ 2917      DFFFFF18 
+ 2917      000000
+ 2918 2185 C5F877   		vzeroupper
+ 2919 2188 E8000000 		call	recvmsg@PLT
+ 2919      00
+ 2920 218d 4885C0   		testq	%rax, %rax
+ 2921 2190 792E     		jns	.L289
+ 2922 2192 E8000000 		call	__errno_location@PLT
+ 2922      00
+ 2923 2197 833804   		cmpl	$4, (%rax)
+ 2924 219a 0F8470FF 		je	.L288
+ 2924      FFFF
+ 2925              	.L318:
+ 2926 21a0 B8FFFFFF 		movl	$-1, %eax
+ 2926      FF
+ 2927 21a5 488BBDD8 		movq	-8488(%rbp), %rdi
+ 2927      DEFFFF
+ 2928 21ac 8707     		xchgl	(%rdi), %eax
+ 2929 21ae 4489E7   		movl	%r12d, %edi
+ 2930 21b1 E8000000 		call	close@PLT
+ 2930      00
+ 2931 21b6 E9DFFEFF 		jmp	.L284
+ 2931      FF
+ 2932 21bb 0F1F4400 		.p2align 4,,10
+ 2932      00
+ 2933              		.p2align 3
+ 2934              	.L289:
+ 2935 21c0 74DE     		je	.L318
+ 2936 21c2 488BBDB8 		movq	-8264(%rbp), %rdi
+ 2936      DFFFFF
+ 2937 21c9 C68405D0 		movb	$0, -8240(%rbp,%rax)
+ 2937      DFFFFF00 
+ 2938 21d1 4883FF0F 		cmpq	$15, %rdi
+ 2939 21d5 0F86BD00 		jbe	.L292
+ 2939      0000
+ 2940 21db 488B8DB0 		movq	-8272(%rbp), %rcx
+ 2940      DFFFFF
+ 2941 21e2 4885C9   		testq	%rcx, %rcx
+ 2942 21e5 0F84AD00 		je	.L292
+ 2942      0000
+ 2943 21eb 488B01   		movq	(%rcx), %rax
+ 2944 21ee 4531ED   		xorl	%r13d, %r13d
+ 2945 21f1 4801CF   		addq	%rcx, %rdi
+ 2946 21f4 4C397108 		cmpq	%r14, 8(%rcx)
+ 2947 21f8 744C     		je	.L364
+ 2948 21fa 660F1F44 		.p2align 4,,10
+ 2948      0000
+ 2949              		.p2align 3
+ 2950              	.L293:
+ 2951 2200 4889C2   		movq	%rax, %rdx
+ 2952 2203 48F7DA   		negq	%rdx
+ 2953 2206 83E207   		andl	$7, %edx
+ 2954 2209 4883C210 		addq	$16, %rdx
+ 2955 220d 4883F80F 		cmpq	$15, %rax
+ 2956 2211 0F866901 		jbe	.L295
+ 2956      0000
+ 2957 2217 4889FE   		movq	%rdi, %rsi
+ 2958 221a 4829CE   		subq	%rcx, %rsi
+ 2959 221d 4839D6   		cmpq	%rdx, %rsi
+ 2960 2220 0F825A01 		jb	.L295
+ 2960      0000
+ 2961 2226 4829D6   		subq	%rdx, %rsi
+ 2962 2229 4839C6   		cmpq	%rax, %rsi
+ 2963 222c 0F824E01 		jb	.L295
+ 2963      0000
+ 2964 2232 4883C007 		addq	$7, %rax
+ 2965 2236 4883E0F8 		andq	$-8, %rax
+ 2966 223a 4801C1   		addq	%rax, %rcx
+ 2967 223d 488B01   		movq	(%rcx), %rax
+ 2968 2240 4C397108 		cmpq	%r14, 8(%rcx)
+ 2969 2244 75BA     		jne	.L293
+ 2970              	.L364:
+ 2971 2246 488D50F0 		leaq	-16(%rax), %rdx
+ 2972 224a 48C1EA02 		shrq	$2, %rdx
+ 2973 224e 4183FD01 		cmpl	$1, %r13d
+ 2974 2252 7FAC     		jg	.L293
+ 2975 2254 85D2     		testl	%edx, %edx
+ 2976 2256 7EA8     		jle	.L293
+ 2977 2258 448B4110 		movl	16(%rcx), %r8d
+ 2978 225c 418D7501 		leal	1(%r13), %esi
+ 2979 2260 49C1E502 		salq	$2, %r13
+ 2980 2264 4689842D 		movl	%r8d, -8424(%rbp,%r13)
+ 2980      18DFFFFF 
+ 2981 226c 83FE01   		cmpl	$1, %esi
+ 2982 226f 0F8FCB02 		jg	.L320
+ 2982      0000
+ 2983 2275 83FA01   		cmpl	$1, %edx
+ 2984 2278 0F8EC202 		jle	.L320
+ 2984      0000
+ 2985 227e 8B5114   		movl	20(%rcx), %edx
+ 2986 2281 4289942D 		movl	%edx, -8420(%rbp,%r13)
+ 2986      1CDFFFFF 
+ 2987 2289 41BD0200 		movl	$2, %r13d
+ 2987      0000
+ 2988 228f E96CFFFF 		jmp	.L293
+ 2988      FF
+ 2989              		.p2align 4,,10
+ 2990 2294 0F1F4000 		.p2align 3
+ 2991              	.L292:
+ 2992 2298 448BADC0 		movl	-8256(%rbp), %r13d
+ 2992      DFFFFF
+ 2993 229f 4183E528 		andl	$40, %r13d
+ 2994 22a3 741B     		je	.L297
+ 2995 22a5 488D3500 		leaq	.LC74(%rip), %rsi
+ 2995      000000
+ 2996 22ac 4489E7   		movl	%r12d, %edi
+ 2997 22af 31C0     		xorl	%eax, %eax
+ 2998 22b1 E84ADDFF 		call	server_reply
+ 2998      FF
+ 2999 22b6 E955FEFF 		jmp	.L288
+ 2999      FF
+ 3000 22bb 0F1F4400 		.p2align 4,,10
+ 3000      00
+ 3001              		.p2align 3
+ 3002              	.L297:
+ 3003 22c0 498B07   		movq	(%r15), %rax
+ 3004 22c3 488BBDF8 		movq	-8456(%rbp), %rdi
+ 3004      DEFFFF
+ 3005 22ca 488D3500 		leaq	.LC75(%rip), %rsi
+ 3005      000000
+ 3006 22d1 488985E0 		movq	%rax, -8480(%rbp)
+ 3006      DEFFFF
+ 3007 22d8 488D8510 		leaq	-8432(%rbp), %rax
+ 3007      DFFFFF
+ 3008 22df 4889C2   		movq	%rax, %rdx
+ 3009 22e2 488985E8 		movq	%rax, -8472(%rbp)
+ 3009      DEFFFF
+ 3010 22e9 E8000000 		call	strtok_r@PLT
+ 3010      00
+ 3011 22ee 4889C7   		movq	%rax, %rdi
+ 3012 22f1 4885C0   		testq	%rax, %rax
+ 3013 22f4 0F84BA00 		je	.L300
+ 3013      0000
+ 3014 22fa 488D3500 		leaq	.LC76(%rip), %rsi
+ 3014      000000
+ 3015 2301 488985F0 		movq	%rax, -8464(%rbp)
+ 3015      DEFFFF
+ 3016 2308 E8000000 		call	strcmp@PLT
+ 3016      00
+ 3017 230d 488BBDF0 		movq	-8464(%rbp), %rdi
+ 3017      DEFFFF
+ 3018 2314 85C0     		testl	%eax, %eax
+ 3019 2316 0F84B400 		je	.L365
+ 3019      0000
+ 3020 231c 803F66   		cmpb	$102, (%rdi)
+ 3021 231f 757F     		jne	.L306
+ 3022 2321 807F0164 		cmpb	$100, 1(%rdi)
+ 3023 2325 7579     		jne	.L306
+ 3024 2327 807F0200 		cmpb	$0, 2(%rdi)
+ 3025 232b 7573     		jne	.L306
+ 3026 232d 4183FD02 		cmpl	$2, %r13d
+ 3027 2331 0F841102 		je	.L307
+ 3027      0000
+ 3028 2337 488D3500 		leaq	.LC78(%rip), %rsi
+ 3028      000000
+ 3029 233e 4489E7   		movl	%r12d, %edi
+ 3030 2341 31C0     		xorl	%eax, %eax
+ 3031 2343 E8B8DCFF 		call	server_reply
+ 3031      FF
+ 3032 2348 0F1F8400 		.p2align 4,,10
+ 3032      00000000 
+ 3033              		.p2align 3
+ 3034              	.L299:
+ 3035 2350 4585ED   		testl	%r13d, %r13d
+ 3036 2353 0F84B7FD 		je	.L288
+ 3036      FFFF
+ 3037 2359 8BBD18DF 		movl	-8424(%rbp), %edi
+ 3037      FFFF
+ 3038 235f E8000000 		call	close@PLT
+ 3038      00
+ 3039 2364 4183FD01 		cmpl	$1, %r13d
+ 3040 2368 0F84A2FD 		je	.L288
+ 3040      FFFF
+ 3041 236e 8BBD1CDF 		movl	-8420(%rbp), %edi
+ 3041      FFFF
+ 3042 2374 E8000000 		call	close@PLT
+ 3042      00
+ 3043 2379 E992FDFF 		jmp	.L288
+ 3043      FF
+ 3044 237e 6690     		.p2align 4,,10
+ 3045              		.p2align 3
+ 3046              	.L295:
+ 3047 2380 F685C0DF 		testb	$40, -8256(%rbp)
+ 3047      FFFF28
+ 3048 2387 0F8433FF 		je	.L297
+ 3048      FFFF
+ 3049 238d 488D3500 		leaq	.LC74(%rip), %rsi
+ 3049      000000
+ 3050 2394 4489E7   		movl	%r12d, %edi
+ 3051 2397 31C0     		xorl	%eax, %eax
+ 3052 2399 E862DCFF 		call	server_reply
+ 3052      FF
+ 3053 239e EBB0     		jmp	.L299
+ 3054              		.p2align 4,,10
+ 3055              		.p2align 3
+ 3056              	.L306:
+ 3057 23a0 488D3500 		leaq	.LC80(%rip), %rsi
+ 3057      000000
+ 3058 23a7 E8000000 		call	strcmp@PLT
+ 3058      00
+ 3059 23ac 85C0     		testl	%eax, %eax
+ 3060 23ae 0F842802 		je	.L366
+ 3060      0000
+ 3061              	.L300:
+ 3062 23b4 488D3500 		leaq	.LC84(%rip), %rsi
+ 3062      000000
+ 3063 23bb 4489E7   		movl	%r12d, %edi
+ 3064 23be 31C0     		xorl	%eax, %eax
+ 3065 23c0 E83BDCFF 		call	server_reply
+ 3065      FF
+ 3066 23c5 EB89     		jmp	.L299
+ 3067 23c7 660F1F84 		.p2align 4,,10
+ 3067      00000000 
+ 3067      00
+ 3068              		.p2align 3
+ 3069              	.L365:
+ 3070 23d0 488B95E8 		movq	-8472(%rbp), %rdx
+ 3070      DEFFFF
+ 3071 23d7 31FF     		xorl	%edi, %edi
+ 3072 23d9 488D3500 		leaq	.LC75(%rip), %rsi
+ 3072      000000
+ 3073 23e0 E8000000 		call	strtok_r@PLT
+ 3073      00
+ 3074 23e5 488B95E8 		movq	-8472(%rbp), %rdx
+ 3074      DEFFFF
+ 3075 23ec 31FF     		xorl	%edi, %edi
+ 3076 23ee 488D3500 		leaq	.LC75(%rip), %rsi
+ 3076      000000
+ 3077 23f5 488985F0 		movq	%rax, -8464(%rbp)
+ 3077      DEFFFF
+ 3078 23fc E8000000 		call	strtok_r@PLT
+ 3078      00
+ 3079 2401 4C8B85F0 		movq	-8464(%rbp), %r8
+ 3079      DEFFFF
+ 3080 2408 4989C1   		movq	%rax, %r9
+ 3081 240b 4D85C0   		testq	%r8, %r8
+ 3082 240e 0F94C0   		sete	%al
+ 3083 2411 4D85C9   		testq	%r9, %r9
+ 3084 2414 0F94C2   		sete	%dl
+ 3085 2417 08D0     		orb	%dl, %al
+ 3086 2419 0F859001 		jne	.L321
+ 3086      0000
+ 3087 241f 4585ED   		testl	%r13d, %r13d
+ 3088 2422 0F858701 		jne	.L321
+ 3088      0000
+ 3089              	.L302:
+ 3090 2428 4C89C9   		movq	%r9, %rcx
+ 3091 242b 4C89C2   		movq	%r8, %rdx
+ 3092 242e 31C0     		xorl	%eax, %eax
+ 3093 2430 BF010000 		movl	$1, %edi
+ 3093      00
+ 3094 2435 488D3500 		leaq	.LC71(%rip), %rsi
+ 3094      000000
+ 3095 243c 4C898DE8 		movq	%r9, -8472(%rbp)
+ 3095      DEFFFF
+ 3096 2443 4C8985F0 		movq	%r8, -8464(%rbp)
+ 3096      DEFFFF
+ 3097 244a E8000000 		call	debugprint@PLT
+ 3097      00
+ 3098 244f 488DB530 		leaq	-8400(%rbp), %rsi
+ 3098      DFFFFF
+ 3099 2456 BF010000 		movl	$1, %edi
+ 3099      00
+ 3100 245b E8000000 		call	clock_gettime@PLT
+ 3100      00
+ 3101 2460 488B85E0 		movq	-8480(%rbp), %rax
+ 3101      DEFFFF
+ 3102 2467 4883EC08 		subq	$8, %rsp
+ 3103 246b 498B7F08 		movq	8(%r15), %rdi
+ 3104 246f 4C8B85F0 		movq	-8464(%rbp), %r8
+ 3104      DEFFFF
+ 3105 2476 4C8B8DE8 		movq	-8472(%rbp), %r9
+ 3105      DEFFFF
+ 3106 247d 8B4814   		movl	20(%rax), %ecx
+ 3107 2480 8B5010   		movl	16(%rax), %edx
+ 3108 2483 488B7008 		movq	8(%rax), %rsi
+ 3109 2487 488D8508 		leaq	-8440(%rbp), %rax
+ 3109      DFFFFF
+ 3110 248e 50       		pushq	%rax
+ 3111 248f 6A01     		pushq	$1
+ 3112 2491 6A00     		pushq	$0
+ 3113 2493 E8000000 		call	process_file@PLT
+ 3113      00
+ 3114 2498 4883C420 		addq	$32, %rsp
+ 3115 249c 4C8B85F0 		movq	-8464(%rbp), %r8
+ 3115      DEFFFF
+ 3116 24a3 84C0     		testb	%al, %al
+ 3117 24a5 0F841A01 		je	.L367
+ 3117      0000
+ 3118 24ab 488DB540 		leaq	-8384(%rbp), %rsi
+ 3118      DFFFFF
+ 3119 24b2 BF010000 		movl	$1, %edi
+ 3119      00
+ 3120 24b7 E8000000 		call	clock_gettime@PLT
+ 3120      00
+ 3121 24bc 488B8D48 		movq	-8376(%rbp), %rcx
+ 3121      DFFFFF
+ 3122 24c3 488BBD30 		movq	-8400(%rbp), %rdi
+ 3122      DFFFFF
+ 3123 24ca 488BB538 		movq	-8392(%rbp), %rsi
+ 3123      DFFFFF
+ 3124 24d1 488B9540 		movq	-8384(%rbp), %rdx
+ 3124      DFFFFF
+ 3125 24d8 E8000000 		call	timespecsub@PLT
+ 3125      00
+ 3126 24dd 4889D7   		movq	%rdx, %rdi
+ 3127 24e0 4889C2   		movq	%rax, %rdx
+ 3128 24e3 4869CA40 		imulq	$1000000, %rdx, %rcx
+ 3128      420F00
+ 3129 24ea 4889F8   		movq	%rdi, %rax
+ 3130 24ed 48899530 		movq	%rdx, -8400(%rbp)
+ 3130      DFFFFF
+ 3131 24f4 4889FE   		movq	%rdi, %rsi
+ 3132 24f7 48BACFF7 		movabsq	$2361183241434822607, %rdx
+ 3132      53E3A59B 
+ 3132      C420
+ 3133 2501 48C1FE3F 		sarq	$63, %rsi
+ 3134 2505 4889BD38 		movq	%rdi, -8392(%rbp)
+ 3134      DFFFFF
+ 3135 250c 4489E7   		movl	%r12d, %edi
+ 3136 250f 48F7EA   		imulq	%rdx
+ 3137 2512 31C0     		xorl	%eax, %eax
+ 3138 2514 48C1FA07 		sarq	$7, %rdx
+ 3139 2518 4829F2   		subq	%rsi, %rdx
+ 3140 251b 488D3500 		leaq	.LC86(%rip), %rsi
+ 3140      000000
+ 3141 2522 4801D1   		addq	%rdx, %rcx
+ 3142 2525 488B9508 		movq	-8440(%rbp), %rdx
+ 3142      DFFFFF
+ 3143 252c E8CFDAFF 		call	server_reply
+ 3143      FF
+ 3144 2531 E91AFEFF 		jmp	.L299
+ 3144      FF
+ 3145 2536 662E0F1F 		.p2align 4,,10
+ 3145      84000000 
+ 3145      0000
+ 3146              		.p2align 3
+ 3147              	.L320:
+ 3148 2540 4C63EE   		movslq	%esi, %r13
+ 3149 2543 E9B8FCFF 		jmp	.L293
+ 3149      FF
+ 3150              	.L307:
+ 3151 2548 4C8D8570 		leaq	-8336(%rbp), %r8
+ 3151      DFFFFF
+ 3152 254f 8B8D18DF 		movl	-8424(%rbp), %ecx
+ 3152      FFFF
+ 3153 2555 488D1500 		leaq	.LC79(%rip), %rdx
+ 3153      000000
+ 3154 255c 31C0     		xorl	%eax, %eax
+ 3155 255e 4C89C7   		movq	%r8, %rdi
+ 3156 2561 BE200000 		movl	$32, %esi
+ 3156      00
+ 3157 2566 4C8985E8 		movq	%r8, -8472(%rbp)
+ 3157      DEFFFF
+ 3158 256d E8000000 		call	snprintf@PLT
+ 3158      00
+ 3159 2572 4C8D8DD0 		leaq	-4144(%rbp), %r9
+ 3159      EFFFFF
+ 3160 2579 8B8D1CDF 		movl	-8420(%rbp), %ecx
+ 3160      FFFF
+ 3161 257f 31C0     		xorl	%eax, %eax
+ 3162 2581 4C89CF   		movq	%r9, %rdi
+ 3163 2584 488D1500 		leaq	.LC79(%rip), %rdx
+ 3163      000000
+ 3164 258b BE200000 		movl	$32, %esi
+ 3164      00
+ 3165 2590 4C898DF0 		movq	%r9, -8464(%rbp)
+ 3165      DEFFFF
+ 3166 2597 E8000000 		call	snprintf@PLT
+ 3166      00
+ 3167 259c 4C8B8DF0 		movq	-8464(%rbp), %r9
+ 3167      DEFFFF
+ 3168 25a3 4C8B85E8 		movq	-8472(%rbp), %r8
+ 3168      DEFFFF
+ 3169 25aa E979FEFF 		jmp	.L302
+ 3169      FF
+ 3170              	.L321:
+ 3171 25af 488D3500 		leaq	.LC77(%rip), %rsi
+ 3171      000000
+ 3172 25b6 4489E7   		movl	%r12d, %edi
+ 3173 25b9 31C0     		xorl	%eax, %eax
+ 3174 25bb E840DAFF 		call	server_reply
+ 3174      FF
+ 3175 25c0 E98BFDFF 		jmp	.L299
+ 3175      FF
+ 3176              	.L367:
+ 3177 25c5 4C89C2   		movq	%r8, %rdx
+ 3178 25c8 488D3500 		leaq	.LC85(%rip), %rsi
+ 3178      000000
+ 3179 25cf 4489E7   		movl	%r12d, %edi
+ 3180 25d2 E829DAFF 		call	server_reply
+ 3180      FF
+ 3181 25d7 E974FDFF 		jmp	.L299
+ 3181      FF
+ 3182              	.L366:
+ 3183 25dc 488B95E8 		movq	-8472(%rbp), %rdx
+ 3183      DEFFFF
+ 3184 25e3 488D3500 		leaq	.LC75(%rip), %rsi
+ 3184      000000
+ 3185 25ea 31FF     		xorl	%edi, %edi
+ 3186 25ec E8000000 		call	strtok_r@PLT
+ 3186      00
+ 3187 25f1 488B95E8 		movq	-8472(%rbp), %rdx
+ 3187      DEFFFF
+ 3188 25f8 488D3500 		leaq	.LC75(%rip), %rsi
+ 3188      000000
+ 3189 25ff 31FF     		xorl	%edi, %edi
+ 3190 2601 488985D0 		movq	%rax, -8496(%rbp)
+ 3190      DEFFFF
+ 3191 2608 E8000000 		call	strtok_r@PLT
+ 3191      00
+ 3192 260d 488B8DD0 		movq	-8496(%rbp), %rcx
+ 3192      DEFFFF
+ 3193 2614 488985F0 		movq	%rax, -8464(%rbp)
+ 3193      DEFFFF
+ 3194 261b 4885C9   		testq	%rcx, %rcx
+ 3195 261e 0F84FC00 		je	.L308
+ 3195      0000
+ 3196 2624 BA0A0000 		movl	$10, %edx
+ 3196      00
+ 3197 2629 488DB570 		leaq	-8336(%rbp), %rsi
+ 3197      DFFFFF
+ 3198 2630 4889CF   		movq	%rcx, %rdi
+ 3199 2633 E8000000 		call	strtol@PLT
+ 3199      00
+ 3200 2638 4889C2   		movq	%rax, %rdx
+ 3201 263b 488B8570 		movq	-8336(%rbp), %rax
+ 3201      DFFFFF
+ 3202 2642 803800   		cmpb	$0, (%rax)
+ 3203 2645 0F85D500 		jne	.L308
+ 3203      0000
+ 3204 264b 4883BDF0 		cmpq	$0, -8464(%rbp)
+ 3204      DEFFFF00 
+ 3205 2653 0F84C700 		je	.L308
+ 3205      0000
+ 3206 2659 488B85E0 		movq	-8480(%rbp), %rax
+ 3206      DEFFFF
+ 3207 2660 31FF     		xorl	%edi, %edi
+ 3208 2662 4C8D8DD0 		leaq	-4144(%rbp), %r9
+ 3208      EFFFFF
+ 3209 2669 8B4020   		movl	32(%rax), %eax
+ 3210 266c 85C0     		testl	%eax, %eax
+ 3211 266e 0F8EDE00 		jle	.L313
+ 3211      0000
+ 3212 2674 4489ADE8 		movl	%r13d, -8472(%rbp)
+ 3212      DEFFFF
+ 3213 267b 4C8BADE0 		movq	-8480(%rbp), %r13
+ 3213      DEFFFF
+ 3214 2682 4489A5D0 		movl	%r12d, -8496(%rbp)
+ 3214      DEFFFF
+ 3215 2689 4D89CC   		movq	%r9, %r12
+ 3216 268c 4C89BDE0 		movq	%r15, -8480(%rbp)
+ 3216      DEFFFF
+ 3217 2693 4189D7   		movl	%edx, %r15d
+ 3218 2696 48899DC8 		movq	%rbx, -8504(%rbp)
+ 3218      DEFFFF
+ 3219 269d 4889FB   		movq	%rdi, %rbx
+ 3220 26a0 488995C0 		movq	%rdx, -8512(%rbp)
+ 3220      DEFFFF
+ 3221 26a7 EB11     		jmp	.L312
+ 3222 26a9 0F1F8000 		.p2align 4,,10
+ 3222      000000
+ 3223              		.p2align 3
+ 3224              	.L311:
+ 3225 26b0 4883C301 		addq	$1, %rbx
+ 3226 26b4 41395D20 		cmpl	%ebx, 32(%r13)
+ 3227 26b8 7E7C     		jle	.L368
+ 3228              	.L312:
+ 3229 26ba 488BB5F0 		movq	-8464(%rbp), %rsi
+ 3229      DEFFFF
+ 3230 26c1 4C89E7   		movq	%r12, %rdi
+ 3231 26c4 E8000000 		call	strcpy@PLT
+ 3231      00
+ 3232 26c9 4889D8   		movq	%rbx, %rax
+ 3233 26cc 4C89E2   		movq	%r12, %rdx
+ 3234 26cf 4489FE   		movl	%r15d, %esi
+ 3235 26d2 48C1E005 		salq	$5, %rax
+ 3236 26d6 49034518 		addq	24(%r13), %rax
+ 3237 26da 488B7808 		movq	8(%rax), %rdi
+ 3238 26de E8000000 		call	control_dsp@PLT
+ 3238      00
+ 3239 26e3 85C0     		testl	%eax, %eax
+ 3240 26e5 74C9     		je	.L311
+ 3241 26e7 448BA5D0 		movl	-8496(%rbp), %r12d
+ 3241      DEFFFF
+ 3242 26ee 488B95C0 		movq	-8512(%rbp), %rdx
+ 3242      DEFFFF
+ 3243 26f5 488D3500 		leaq	.LC83(%rip), %rsi
+ 3243      000000
+ 3244 26fc 31C0     		xorl	%eax, %eax
+ 3245 26fe 448BADE8 		movl	-8472(%rbp), %r13d
+ 3245      DEFFFF
+ 3246 2705 4C8BBDE0 		movq	-8480(%rbp), %r15
+ 3246      DEFFFF
+ 3247 270c 4489E7   		movl	%r12d, %edi
+ 3248 270f 488B9DC8 		movq	-8504(%rbp), %rbx
+ 3248      DEFFFF
+ 3249 2716 E8E5D8FF 		call	server_reply
+ 3249      FF
+ 3250 271b E930FCFF 		jmp	.L299
+ 3250      FF
+ 3251              	.L308:
+ 3252 2720 488D3500 		leaq	.LC82(%rip), %rsi
+ 3252      000000
+ 3253 2727 4489E7   		movl	%r12d, %edi
+ 3254 272a 31C0     		xorl	%eax, %eax
+ 3255 272c E8CFD8FF 		call	server_reply
+ 3255      FF
+ 3256 2731 E91AFCFF 		jmp	.L299
+ 3256      FF
+ 3257              	.L368:
+ 3258 2736 448BADE8 		movl	-8472(%rbp), %r13d
+ 3258      DEFFFF
+ 3259 273d 448BA5D0 		movl	-8496(%rbp), %r12d
+ 3259      DEFFFF
+ 3260 2744 4C8BBDE0 		movq	-8480(%rbp), %r15
+ 3260      DEFFFF
+ 3261 274b 488B9DC8 		movq	-8504(%rbp), %rbx
+ 3261      DEFFFF
+ 3262              	.L313:
+ 3263 2752 488D3500 		leaq	.LC81(%rip), %rsi
+ 3263      000000
+ 3264 2759 4489E7   		movl	%r12d, %edi
+ 3265 275c 31C0     		xorl	%eax, %eax
+ 3266 275e E89DD8FF 		call	server_reply
+ 3266      FF
+ 3267 2763 E9E8FBFF 		jmp	.L299
+ 3267      FF
+ 3268              		.cfi_endproc
+ 3269              	.LFE43:
+ 3271              		.section	.rodata.str1.8
+ 3272 09c2 00000000 		.align 8
+ 3272      0000
+ 3273              	.LC87:
+ 3274 09c8 25733A20 		.string	"%s: Expected input and output filename: %s\n"
+ 3274      45787065 
+ 3274      63746564 
+ 3274      20696E70 
+ 3274      75742061 
+ 3275              		.section	.rodata.str1.1
+ 3276              	.LC88:
+ 3277 0299 57726F6E 		.string	"Wrong format of batch file\n"
+ 3277      6720666F 
+ 3277      726D6174 
+ 3277      206F6620 
+ 3277      62617463 
+ 3278              		.section	.rodata.str1.8
+ 3279 09f4 00000000 		.align 8
+ 3280              	.LC89:
+ 3281 09f8 436F756C 		.string	"Could not allocate memory for batch.\n"
+ 3281      64206E6F 
+ 3281      7420616C 
+ 3281      6C6F6361 
+ 3281      7465206D 
+ 3282              		.text
+ 3283 2768 0F1F8400 		.p2align 4
+ 3283      00000000 
+ 3284              		.globl	read_batchfile
+ 3286              	read_batchfile:
+ 3287              	.LFB35:
+ 3288              		.cfi_startproc
+ 3289 2770 4157     		pushq	%r15
+ 3290              		.cfi_def_cfa_offset 16
+ 3291              		.cfi_offset 15, -16
+ 3292 2772 4156     		pushq	%r14
+ 3293              		.cfi_def_cfa_offset 24
+ 3294              		.cfi_offset 14, -24
+ 3295 2774 4155     		pushq	%r13
+ 3296              		.cfi_def_cfa_offset 32
+ 3297              		.cfi_offset 13, -32
+ 3298 2776 4154     		pushq	%r12
+ 3299              		.cfi_def_cfa_offset 40
+ 3300              		.cfi_offset 12, -40
+ 3301 2778 55       		pushq	%rbp
+ 3302              		.cfi_def_cfa_offset 48
+ 3303              		.cfi_offset 6, -48
+ 3304 2779 4889FD   		movq	%rdi, %rbp
+ 3305 277c 53       		pushq	%rbx
+ 3306              		.cfi_def_cfa_offset 56
+ 3307              		.cfi_offset 3, -56
+ 3308 277d 4881EC28 		subq	$4136, %rsp
+ 3308      100000
+ 3309              		.cfi_def_cfa_offset 4192
+ 3310 2784 48897424 		movq	%rsi, 24(%rsp)
+ 3310      18
+ 3311 2789 488B7C24 		movq	24(%rsp), %rdi
+ 3311      18
+ 3312 278e 488D3500 		leaq	.LC42(%rip), %rsi
+ 3312      000000
+ 3313 2795 E8000000 		call	fopen@PLT
+ 3313      00
+ 3314 279a 48894424 		movq	%rax, 8(%rsp)
+ 3314      08
+ 3315 279f 4885C0   		testq	%rax, %rax
+ 3316 27a2 0F847A01 		je	.L386
+ 3316      0000
+ 3317              	.L370:
+ 3318 27a8 C7451000 		movl	$0, 16(%rbp)
+ 3318      000000
+ 3319 27af C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 3320 27b3 4531FF   		xorl	%r15d, %r15d
+ 3321 27b6 4C8D7424 		leaq	32(%rsp), %r14
+ 3321      20
+ 3322 27bb C5FA7F45 		vmovdqu	%xmm0, 0(%rbp)
+ 3322      00
+ 3323 27c0 4C8D2D00 		leaq	.LC75(%rip), %r13
+ 3323      000000
+ 3324 27c7 660F1F84 		.p2align 4,,10
+ 3324      00000000 
+ 3324      00
+ 3325              		.p2align 3
+ 3326              	.L371:
+ 3327 27d0 488B5424 		movq	8(%rsp), %rdx
+ 3327      08
+ 3328 27d5 BE001000 		movl	$4096, %esi
+ 3328      00
+ 3329 27da 4C89F7   		movq	%r14, %rdi
+ 3330 27dd E8000000 		call	fgets@PLT
+ 3330      00
+ 3331 27e2 4885C0   		testq	%rax, %rax
+ 3332 27e5 0F84F500 		je	.L387
+ 3332      0000
+ 3333 27eb 4C89EE   		movq	%r13, %rsi
+ 3334 27ee 4C89F7   		movq	%r14, %rdi
+ 3335 27f1 E8000000 		call	strtok@PLT
+ 3335      00
+ 3336 27f6 4C89EE   		movq	%r13, %rsi
+ 3337 27f9 31FF     		xorl	%edi, %edi
+ 3338 27fb 4889C3   		movq	%rax, %rbx
+ 3339 27fe E8000000 		call	strtok@PLT
+ 3339      00
+ 3340 2803 4989C4   		movq	%rax, %r12
+ 3341 2806 4885DB   		testq	%rbx, %rbx
+ 3342 2809 74C5     		je	.L371
+ 3343 280b 803B23   		cmpb	$35, (%rbx)
+ 3344 280e 74C0     		je	.L371
+ 3345 2810 4885C0   		testq	%rax, %rax
+ 3346 2813 740F     		je	.L375
+ 3347 2815 31FF     		xorl	%edi, %edi
+ 3348 2817 4C89EE   		movq	%r13, %rsi
+ 3349 281a E8000000 		call	strtok@PLT
+ 3349      00
+ 3350 281f 4885C0   		testq	%rax, %rax
+ 3351 2822 7424     		je	.L374
+ 3352              	.L375:
+ 3353 2824 488B5424 		movq	24(%rsp), %rdx
+ 3353      18
+ 3354 2829 31FF     		xorl	%edi, %edi
+ 3355 282b 4889D9   		movq	%rbx, %rcx
+ 3356 282e 31C0     		xorl	%eax, %eax
+ 3357 2830 488D3500 		leaq	.LC87(%rip), %rsi
+ 3357      000000
+ 3358 2837 E8000000 		call	debugprint@PLT
+ 3358      00
+ 3359 283c 488D3D00 		leaq	.LC88(%rip), %rdi
+ 3359      000000
+ 3360 2843 E8000000 		call	endprogram@PLT
+ 3360      00
+ 3361              	.L374:
+ 3362 2848 48634510 		movslq	16(%rbp), %rax
+ 3363 284c 488B7D00 		movq	0(%rbp), %rdi
+ 3364 2850 4439F8   		cmpl	%r15d, %eax
+ 3365 2853 743B     		je	.L388
+ 3366              	.L376:
+ 3367 2855 488D14C7 		leaq	(%rdi,%rax,8), %rdx
+ 3368 2859 4889DF   		movq	%rbx, %rdi
+ 3369 285c 48895424 		movq	%rdx, 16(%rsp)
+ 3369      10
+ 3370 2861 E8000000 		call	strdup@PLT
+ 3370      00
+ 3371 2866 488B5424 		movq	16(%rsp), %rdx
+ 3371      10
+ 3372 286b 4C89E7   		movq	%r12, %rdi
+ 3373 286e 488902   		movq	%rax, (%rdx)
+ 3374 2871 48635510 		movslq	16(%rbp), %rdx
+ 3375 2875 488B4508 		movq	8(%rbp), %rax
+ 3376 2879 488D1CD0 		leaq	(%rax,%rdx,8), %rbx
+ 3377 287d E8000000 		call	strdup@PLT
+ 3377      00
+ 3378 2882 488903   		movq	%rax, (%rbx)
+ 3379 2885 83451001 		addl	$1, 16(%rbp)
+ 3380 2889 E942FFFF 		jmp	.L371
+ 3380      FF
+ 3381 288e 6690     		.p2align 4,,10
+ 3382              		.p2align 3
+ 3383              	.L388:
+ 3384 2890 4585FF   		testl	%r15d, %r15d
+ 3385 2893 746B     		je	.L380
+ 3386 2895 4501FF   		addl	%r15d, %r15d
+ 3387 2898 4963F7   		movslq	%r15d, %rsi
+ 3388 289b 48C1E603 		salq	$3, %rsi
+ 3389              	.L377:
+ 3390 289f 48897424 		movq	%rsi, 16(%rsp)
+ 3390      10
+ 3391 28a4 E8000000 		call	realloc@PLT
+ 3391      00
+ 3392 28a9 488B7D08 		movq	8(%rbp), %rdi
+ 3393 28ad 488B7424 		movq	16(%rsp), %rsi
+ 3393      10
+ 3394 28b2 48894500 		movq	%rax, 0(%rbp)
+ 3395 28b6 E8000000 		call	realloc@PLT
+ 3395      00
+ 3396 28bb 488B7D00 		movq	0(%rbp), %rdi
+ 3397 28bf 48894508 		movq	%rax, 8(%rbp)
+ 3398 28c3 4885FF   		testq	%rdi, %rdi
+ 3399 28c6 7448     		je	.L378
+ 3400 28c8 4885C0   		testq	%rax, %rax
+ 3401 28cb 7443     		je	.L378
+ 3402              	.L385:
+ 3403 28cd 48634510 		movslq	16(%rbp), %rax
+ 3404 28d1 E97FFFFF 		jmp	.L376
+ 3404      FF
+ 3405 28d6 662E0F1F 		.p2align 4,,10
+ 3405      84000000 
+ 3405      0000
+ 3406              		.p2align 3
+ 3407              	.L387:
+ 3408 28e0 488B7C24 		movq	8(%rsp), %rdi
+ 3408      08
+ 3409 28e5 E8000000 		call	fclose@PLT
+ 3409      00
+ 3410 28ea 4881C428 		addq	$4136, %rsp
+ 3410      100000
+ 3411              		.cfi_remember_state
+ 3412              		.cfi_def_cfa_offset 56
+ 3413 28f1 5B       		popq	%rbx
+ 3414              		.cfi_def_cfa_offset 48
+ 3415 28f2 5D       		popq	%rbp
+ 3416              		.cfi_def_cfa_offset 40
+ 3417 28f3 415C     		popq	%r12
+ 3418              		.cfi_def_cfa_offset 32
+ 3419 28f5 415D     		popq	%r13
+ 3420              		.cfi_def_cfa_offset 24
+ 3421 28f7 415E     		popq	%r14
+ 3422              		.cfi_def_cfa_offset 16
+ 3423 28f9 415F     		popq	%r15
+ 3424              		.cfi_def_cfa_offset 8
+ 3425 28fb C3       		ret
+ 3426 28fc 0F1F4000 		.p2align 4,,10
+ 3427              		.p2align 3
+ 3428              	.L380:
+ 3429              		.cfi_restore_state
+ 3430 2900 BE000200 		movl	$512, %esi
+ 3430      00
+ 3431 2905 41BF4000 		movl	$64, %r15d
+ 3431      0000
+ 3432 290b EB92     		jmp	.L377
+ 3433 290d 0F1F00   		.p2align 4,,10
+ 3434              		.p2align 3
+ 3435              	.L378:
+ 3436 2910 488D3D00 		leaq	.LC89(%rip), %rdi
+ 3436      000000
+ 3437 2917 E8000000 		call	endprogram@PLT
+ 3437      00
+ 3438 291c 488B7D00 		movq	0(%rbp), %rdi
+ 3439 2920 EBAB     		jmp	.L385
+ 3440              	.L386:
+ 3441 2922 488B5424 		movq	24(%rsp), %rdx
+ 3441      18
+ 3442 2927 31FF     		xorl	%edi, %edi
+ 3443 2929 488D3500 		leaq	.LC60(%rip), %rsi
+ 3443      000000
+ 3444 2930 E8000000 		call	debugprint@PLT
+ 3444      00
+ 3445 2935 488D3D00 		leaq	.LC38(%rip), %rdi
+ 3445      000000
+ 3446 293c E8000000 		call	endprogram@PLT
+ 3446      00
+ 3447 2941 E962FEFF 		jmp	.L370
+ 3447      FF
+ 3448              		.cfi_endproc
+ 3449              	.LFE35:
+ 3451              		.section	.rodata.str1.8
+ 3452 0a1e 0000     		.align 8
+ 3453              	.LC90:
+ 3454 0a20 50726F63 		.string	"Processing %d files on %d workers\n"
+ 3454      65737369 
+ 3454      6E672025 
+ 3454      64206669 
+ 3454      6C657320 
+ 3455 0a43 00000000 		.align 8
+ 3455      00
+ 3456              	.LC91:
+ 3457 0a48 436F756C 		.string	"Could not allocate memory for workers.\n"
+ 3457      64206E6F 
+ 3457      7420616C 
+ 3457      6C6F6361 
+ 3457      7465206D 
+ 3458              		.align 8
+ 3459              	.LC92:
+ 3460 0a70 436F756C 		.string	"Could not create batch worker\n"
+ 3460      64206E6F 
+ 3460      74206372 
+ 3460      65617465 
+ 3460      20626174 
+ 3461 0a8f 00       		.align 8
+ 3462              	.LC93:
+ 3463 0a90 446F6E65 		.string	"Done! Processed %d files, %llu samples in %lld.%.9ld sec wall clock, %d failed\n"
+ 3463      21205072 
+ 3463      6F636573 
+ 3463      73656420 
+ 3463      25642066 
+ 3464              		.text
+ 3465 2946 662E0F1F 		.p2align 4
+ 3465      84000000 
+ 3465      0000
+ 3466              		.globl	run_batch
+ 3468              	run_batch:
+ 3469              	.LFB36:
+ 3470              		.cfi_startproc
+ 3471 2950 4157     		pushq	%r15
+ 3472              		.cfi_def_cfa_offset 16
+ 3473              		.cfi_offset 15, -16
+ 3474 2952 4989F7   		movq	%rsi, %r15
+ 3475 2955 4C89C6   		movq	%r8, %rsi
+ 3476 2958 4156     		pushq	%r14
+ 3477              		.cfi_def_cfa_offset 24
+ 3478              		.cfi_offset 14, -24
+ 3479 295a 4189D6   		movl	%edx, %r14d
+ 3480 295d 4155     		pushq	%r13
+ 3481              		.cfi_def_cfa_offset 32
+ 3482              		.cfi_offset 13, -32
+ 3483 295f 4589CD   		movl	%r9d, %r13d
+ 3484 2962 4154     		pushq	%r12
+ 3485              		.cfi_def_cfa_offset 40
+ 3486              		.cfi_offset 12, -40
+ 3487 2964 55       		pushq	%rbp
+ 3488              		.cfi_def_cfa_offset 48
+ 3489              		.cfi_offset 6, -48
+ 3490 2965 4889FD   		movq	%rdi, %rbp
+ 3491 2968 53       		pushq	%rbx
+ 3492              		.cfi_def_cfa_offset 56
+ 3493              		.cfi_offset 3, -56
+ 3494 2969 89CB     		movl	%ecx, %ebx
+ 3495 296b 4883EC78 		subq	$120, %rsp
+ 3496              		.cfi_def_cfa_offset 176
+ 3497 296f 4C8D6424 		leaq	48(%rsp), %r12
+ 3497      30
+ 3498 2974 4C89E7   		movq	%r12, %rdi
+ 3499 2977 E8000000 		call	read_batchfile@PLT
+ 3499      00
+ 3500 297c 48635424 		movslq	64(%rsp), %rdx
+ 3500      40
+ 3501 2981 4C897C24 		movq	%r15, 88(%rsp)
+ 3501      58
+ 3502 2986 48C74424 		movq	$0, 68(%rsp)
+ 3502      44000000 
+ 3502      00
+ 3503 298f 48C74424 		movq	$0, 80(%rsp)
+ 3503      50000000 
+ 3503      00
+ 3504 2998 44897424 		movl	%r14d, 96(%rsp)
+ 3504      60
+ 3505 299d 895C2464 		movl	%ebx, 100(%rsp)
+ 3506 29a1 4439EA   		cmpl	%r13d, %edx
+ 3507 29a4 0F8D9E01 		jge	.L390
+ 3507      0000
+ 3508 29aa 85D2     		testl	%edx, %edx
+ 3509 29ac BB010000 		movl	$1, %ebx
+ 3509      00
+ 3510 29b1 488D3500 		leaq	.LC90(%rip), %rsi
+ 3510      000000
+ 3511 29b8 480F4FDA 		cmovg	%rdx, %rbx
+ 3512 29bc 31FF     		xorl	%edi, %edi
+ 3513 29be 31C0     		xorl	%eax, %eax
+ 3514 29c0 89D9     		movl	%ebx, %ecx
+ 3515 29c2 488D1C5B 		leaq	(%rbx,%rbx,2), %rbx
+ 3516 29c6 E8000000 		call	debugprint@PLT
+ 3516      00
+ 3517 29cb 488D04DD 		leaq	0(,%rbx,8), %rax
+ 3517      00000000 
+ 3518 29d3 4889C7   		movq	%rax, %rdi
+ 3519 29d6 48894424 		movq	%rax, 8(%rsp)
+ 3519      08
+ 3520 29db E8000000 		call	malloc@PLT
+ 3520      00
+ 3521 29e0 4989C7   		movq	%rax, %r15
+ 3522 29e3 4885C0   		testq	%rax, %rax
+ 3523 29e6 0F84B001 		je	.L408
+ 3523      0000
+ 3524 29ec 488D7424 		leaq	16(%rsp), %rsi
+ 3524      10
+ 3525 29f1 BF010000 		movl	$1, %edi
+ 3525      00
+ 3526 29f6 E8000000 		call	clock_gettime@PLT
+ 3526      00
+ 3527              	.L392:
+ 3528 29fb 488B4424 		movq	8(%rsp), %rax
+ 3528      08
+ 3529 2a00 4C8B2D00 		movq	batch_worker@GOTPCREL(%rip), %r13
+ 3529      000000
+ 3530 2a07 4C89FB   		movq	%r15, %rbx
+ 3531 2a0a 4E8D3438 		leaq	(%rax,%r15), %r14
+ 3532 2a0e EB09     		jmp	.L396
+ 3533              		.p2align 4,,10
+ 3534              		.p2align 3
+ 3535              	.L395:
+ 3536 2a10 4883C318 		addq	$24, %rbx
+ 3537 2a14 4C39F3   		cmpq	%r14, %rbx
+ 3538 2a17 7439     		je	.L409
+ 3539              	.L396:
+ 3540 2a19 4C8923   		movq	%r12, (%rbx)
+ 3541 2a1c 4889EF   		movq	%rbp, %rdi
+ 3542 2a1f E8000000 		call	clone_dsp@PLT
+ 3542      00
+ 3543 2a24 31F6     		xorl	%esi, %esi
+ 3544 2a26 488D7B10 		leaq	16(%rbx), %rdi
+ 3545 2a2a 4889D9   		movq	%rbx, %rcx
+ 3546 2a2d 48894308 		movq	%rax, 8(%rbx)
+ 3547 2a31 4C89EA   		movq	%r13, %rdx
+ 3548 2a34 E8000000 		call	pthread_create@PLT
+ 3548      00
+ 3549 2a39 85C0     		testl	%eax, %eax
+ 3550 2a3b 74D3     		je	.L395
+ 3551 2a3d 488D3D00 		leaq	.LC92(%rip), %rdi
+ 3551      000000
+ 3552 2a44 4883C318 		addq	$24, %rbx
+ 3553 2a48 E8000000 		call	endprogram@PLT
+ 3553      00
+ 3554 2a4d 4C39F3   		cmpq	%r14, %rbx
+ 3555 2a50 75C7     		jne	.L396
+ 3556              	.L409:
+ 3557 2a52 488B5C24 		movq	8(%rsp), %rbx
+ 3557      08
+ 3558 2a57 498D6F08 		leaq	8(%r15), %rbp
+ 3559 2a5b 4801EB   		addq	%rbp, %rbx
+ 3560 2a5e 6690     		.p2align 4,,10
+ 3561              		.p2align 3
+ 3562              	.L397:
+ 3563 2a60 488B7D08 		movq	8(%rbp), %rdi
+ 3564 2a64 31F6     		xorl	%esi, %esi
+ 3565 2a66 4883C518 		addq	$24, %rbp
+ 3566 2a6a E8000000 		call	pthread_join@PLT
+ 3566      00
+ 3567 2a6f 488B7DE8 		movq	-24(%rbp), %rdi
+ 3568 2a73 E8000000 		call	destroy_dsp@PLT
+ 3568      00
+ 3569 2a78 4839EB   		cmpq	%rbp, %rbx
+ 3570 2a7b 75E3     		jne	.L397
+ 3571              	.L394:
+ 3572 2a7d 488D7424 		leaq	32(%rsp), %rsi
+ 3572      20
+ 3573 2a82 BF010000 		movl	$1, %edi
+ 3573      00
+ 3574 2a87 E8000000 		call	clock_gettime@PLT
+ 3574      00
+ 3575 2a8c 488B7C24 		movq	16(%rsp), %rdi
+ 3575      10
+ 3576 2a91 488B7424 		movq	24(%rsp), %rsi
+ 3576      18
+ 3577 2a96 488B5424 		movq	32(%rsp), %rdx
+ 3577      20
+ 3578 2a9b 488B4C24 		movq	40(%rsp), %rcx
+ 3578      28
+ 3579 2aa0 E8000000 		call	timespecsub@PLT
+ 3579      00
+ 3580 2aa5 4883EC08 		subq	$8, %rsp
+ 3581              		.cfi_def_cfa_offset 184
+ 3582 2aa9 488D3500 		leaq	.LC93(%rip), %rsi
+ 3582      000000
+ 3583 2ab0 31FF     		xorl	%edi, %edi
+ 3584 2ab2 48894424 		movq	%rax, 24(%rsp)
+ 3584      18
+ 3585 2ab7 8B442450 		movl	80(%rsp), %eax
+ 3586 2abb 48895424 		movq	%rdx, 32(%rsp)
+ 3586      20
+ 3587 2ac0 8B542448 		movl	72(%rsp), %edx
+ 3588 2ac4 50       		pushq	%rax
+ 3589              		.cfi_def_cfa_offset 192
+ 3590 2ac5 488B4C24 		movq	96(%rsp), %rcx
+ 3590      60
+ 3591 2aca 4C8B4C24 		movq	40(%rsp), %r9
+ 3591      28
+ 3592 2acf 4C8B4424 		movq	32(%rsp), %r8
+ 3592      20
+ 3593 2ad4 29C2     		subl	%eax, %edx
+ 3594 2ad6 31C0     		xorl	%eax, %eax
+ 3595 2ad8 E8000000 		call	debugprint@PLT
+ 3595      00
+ 3596 2add 58       		popq	%rax
+ 3597              		.cfi_def_cfa_offset 184
+ 3598 2ade 5A       		popq	%rdx
+ 3599              		.cfi_def_cfa_offset 176
+ 3600 2adf 8B4C2440 		movl	64(%rsp), %ecx
+ 3601 2ae3 85C9     		testl	%ecx, %ecx
+ 3602 2ae5 7E2F     		jle	.L398
+ 3603 2ae7 31DB     		xorl	%ebx, %ebx
+ 3604 2ae9 0F1F8000 		.p2align 4,,10
+ 3604      000000
+ 3605              		.p2align 3
+ 3606              	.L399:
+ 3607 2af0 488B4424 		movq	48(%rsp), %rax
+ 3607      30
+ 3608 2af5 488B3CD8 		movq	(%rax,%rbx,8), %rdi
+ 3609 2af9 E8000000 		call	free@PLT
+ 3609      00
+ 3610 2afe 488B4424 		movq	56(%rsp), %rax
+ 3610      38
+ 3611 2b03 488B3CD8 		movq	(%rax,%rbx,8), %rdi
+ 3612 2b07 4883C301 		addq	$1, %rbx
+ 3613 2b0b E8000000 		call	free@PLT
+ 3613      00
+ 3614 2b10 395C2440 		cmpl	%ebx, 64(%rsp)
+ 3615 2b14 7FDA     		jg	.L399
+ 3616              	.L398:
+ 3617 2b16 488B7C24 		movq	48(%rsp), %rdi
+ 3617      30
+ 3618 2b1b E8000000 		call	free@PLT
+ 3618      00
+ 3619 2b20 488B7C24 		movq	56(%rsp), %rdi
+ 3619      38
+ 3620 2b25 E8000000 		call	free@PLT
+ 3620      00
+ 3621 2b2a 4C89FF   		movq	%r15, %rdi
+ 3622 2b2d E8000000 		call	free@PLT
+ 3622      00
+ 3623 2b32 8B442448 		movl	72(%rsp), %eax
+ 3624 2b36 4883C478 		addq	$120, %rsp
+ 3625              		.cfi_remember_state
+ 3626              		.cfi_def_cfa_offset 56
+ 3627 2b3a 5B       		popq	%rbx
+ 3628              		.cfi_def_cfa_offset 48
+ 3629 2b3b 5D       		popq	%rbp
+ 3630              		.cfi_def_cfa_offset 40
+ 3631 2b3c 415C     		popq	%r12
+ 3632              		.cfi_def_cfa_offset 32
+ 3633 2b3e 415D     		popq	%r13
+ 3634              		.cfi_def_cfa_offset 24
+ 3635 2b40 415E     		popq	%r14
+ 3636              		.cfi_def_cfa_offset 16
+ 3637 2b42 415F     		popq	%r15
+ 3638              		.cfi_def_cfa_offset 8
+ 3639 2b44 C3       		ret
+ 3640              		.p2align 4,,10
+ 3641 2b45 0F1F00   		.p2align 3
+ 3642              	.L390:
+ 3643              		.cfi_restore_state
+ 3644 2b48 4489E9   		movl	%r13d, %ecx
+ 3645 2b4b 488D3500 		leaq	.LC90(%rip), %rsi
+ 3645      000000
+ 3646 2b52 31FF     		xorl	%edi, %edi
+ 3647 2b54 31C0     		xorl	%eax, %eax
+ 3648 2b56 E8000000 		call	debugprint@PLT
+ 3648      00
+ 3649 2b5b 4963C5   		movslq	%r13d, %rax
+ 3650 2b5e 488D1C40 		leaq	(%rax,%rax,2), %rbx
+ 3651 2b62 488D04DD 		leaq	0(,%rbx,8), %rax
+ 3651      00000000 
+ 3652 2b6a 4889C7   		movq	%rax, %rdi
+ 3653 2b6d 48894424 		movq	%rax, 8(%rsp)
+ 3653      08
+ 3654 2b72 E8000000 		call	malloc@PLT
+ 3654      00
+ 3655 2b77 4989C7   		movq	%rax, %r15
+ 3656 2b7a 4885C0   		testq	%rax, %rax
+ 3657 2b7d 743D     		je	.L410
+ 3658              	.L393:
+ 3659 2b7f 488D7424 		leaq	16(%rsp), %rsi
+ 3659      10
+ 3660 2b84 BF010000 		movl	$1, %edi
+ 3660      00
+ 3661 2b89 E8000000 		call	clock_gettime@PLT
+ 3661      00
+ 3662 2b8e 4585ED   		testl	%r13d, %r13d
+ 3663 2b91 0F8F64FE 		jg	.L392
+ 3663      FFFF
+ 3664 2b97 E9E1FEFF 		jmp	.L394
+ 3664      FF
+ 3665              	.L408:
+ 3666 2b9c 488D3D00 		leaq	.LC91(%rip), %rdi
+ 3666      000000
+ 3667 2ba3 E8000000 		call	endprogram@PLT
+ 3667      00
+ 3668 2ba8 488D7424 		leaq	16(%rsp), %rsi
+ 3668      10
+ 3669 2bad BF010000 		movl	$1, %edi
+ 3669      00
+ 3670 2bb2 E8000000 		call	clock_gettime@PLT
+ 3670      00
+ 3671 2bb7 E93FFEFF 		jmp	.L392
+ 3671      FF
+ 3672              	.L410:
+ 3673 2bbc 488D3D00 		leaq	.LC91(%rip), %rdi
+ 3673      000000
+ 3674 2bc3 E8000000 		call	endprogram@PLT
+ 3674      00
+ 3675 2bc8 EBB5     		jmp	.L393
+ 3676              		.cfi_endproc
+ 3677              	.LFE36:
+ 3679              		.section	.rodata.str1.8
+ 3680              		.align 8
+ 3681              	.LC96:
+ 3682 0ae0 5365676D 		.string	"Segmented processing needs a seekable input\n"
+ 3682      656E7465 
+ 3682      64207072 
+ 3682      6F636573 
+ 3682      73696E67 
+ 3683 0b0d 000000   		.align 8
+ 3684              	.LC97:
+ 3685 0b10 496E7661 		.string	"Invalid number of channels specified\n"
+ 3685      6C696420 
+ 3685      6E756D62 
+ 3685      6572206F 
+ 3685      66206368 
+ 3686 0b36 0000     		.align 8
+ 3687              	.LC98:
+ 3688 0b38 43686169 		.string	"Chain can not be processed in segments\n"
+ 3688      6E206361 
+ 3688      6E206E6F 
+ 3688      74206265 
+ 3688      2070726F 
+ 3689              		.align 8
+ 3690              	.LC99:
+ 3691 0b60 436F756C 		.string	"Could not allocate memory for segments.\n"
+ 3691      64206E6F 
+ 3691      7420616C 
+ 3691      6C6F6361 
+ 3691      7465206D 
+ 3692 0b89 00000000 		.align 8
+ 3692      000000
+ 3693              	.LC100:
+ 3694 0b90 50726F63 		.string	"Processing %d segments of %lld frames with %lld frames preroll on %d workers\n"
+ 3694      65737369 
+ 3694      6E672025 
+ 3694      64207365 
+ 3694      676D656E 
+ 3695 0bde 0000     		.align 8
+ 3696              	.LC101:
+ 3697 0be0 436F756C 		.string	"Could not create segment worker\n"
+ 3697      64206E6F 
+ 3697      74206372 
+ 3697      65617465 
+ 3697      20736567 
+ 3698              		.section	.rodata.str1.1
+ 3699              	.LC103:
+ 3700 02b5 7365616D 		.string	"seam %d: max difference %g\n"
+ 3700      2025643A 
+ 3700      206D6178 
+ 3700      20646966 
+ 3700      66657265 
+ 3701              	.LC104:
+ 3702 02d1 4661696C 		.string	"Failed writing output\n"
+ 3702      65642077 
+ 3702      72697469 
+ 3702      6E67206F 
+ 3702      75747075 
+ 3703              		.section	.rodata.str1.8
+ 3704 0c01 00000000 		.align 8
+ 3704      000000
+ 3705              	.LC105:
+ 3706 0c08 446F6E65 		.string	"Done! Processed %lld samples in %lld.%.9ld sec wall clock, largest seam difference %g\n"
+ 3706      21205072 
+ 3706      6F636573 
+ 3706      73656420 
+ 3706      256C6C64 
+ 3707              		.text
+ 3708 2bca 660F1F44 		.p2align 4
+ 3708      0000
+ 3709              		.globl	run_segmented
+ 3711              	run_segmented:
+ 3712              	.LFB39:
+ 3713              		.cfi_startproc
+ 3714 2bd0 55       		pushq	%rbp
+ 3715              		.cfi_def_cfa_offset 16
+ 3716              		.cfi_offset 6, -16
+ 3717 2bd1 4889E5   		movq	%rsp, %rbp
+ 3718              		.cfi_def_cfa_register 6
+ 3719 2bd4 4157     		pushq	%r15
+ 3720 2bd6 4156     		pushq	%r14
+ 3721              		.cfi_offset 15, -24
+ 3722              		.cfi_offset 14, -32
+ 3723 2bd8 C4C1F97E 		vmovq	%xmm1, %r14
+ 3723      CE
+ 3724 2bdd 4155     		pushq	%r13
+ 3725              		.cfi_offset 13, -40
+ 3726 2bdf 4989CD   		movq	%rcx, %r13
+ 3727 2be2 4154     		pushq	%r12
+ 3728              		.cfi_offset 12, -48
+ 3729 2be4 4989FC   		movq	%rdi, %r12
+ 3730 2be7 4889CF   		movq	%rcx, %rdi
+ 3731 2bea 4152     		pushq	%r10
+ 3732 2bec 53       		pushq	%rbx
+ 3733              		.cfi_offset 10, -56
+ 3734              		.cfi_offset 3, -64
+ 3735 2bed 89D3     		movl	%edx, %ebx
+ 3736 2bef 488D95D8 		leaq	-296(%rbp), %rdx
+ 3736      FEFFFF
+ 3737 2bf6 4881ECA0 		subq	$416, %rsp
+ 3737      010000
+ 3738 2bfd 4C898538 		movq	%r8, -456(%rbp)
+ 3738      FEFFFF
+ 3739 2c04 C5FE6F26 		vmovdqu	(%rsi), %ymm4
+ 3740 2c08 BE100000 		movl	$16, %esi
+ 3740      00
+ 3741 2c0d 44898D58 		movl	%r9d, -424(%rbp)
+ 3741      FEFFFF
+ 3742 2c14 C5FB1185 		vmovsd	%xmm0, -376(%rbp)
+ 3742      88FEFFFF 
+ 3743 2c1c C5FE7FA5 		vmovdqu	%ymm4, -296(%rbp)
+ 3743      D8FEFFFF 
+ 3744 2c24 C5F877   		vzeroupper
+ 3745 2c27 E8000000 		call	sf_open@PLT
+ 3745      00
+ 3746 2c2c 4885C0   		testq	%rax, %rax
+ 3747 2c2f 0F84D608 		je	.L484
+ 3747      0000
+ 3748 2c35 448B95F0 		movl	-272(%rbp), %r10d
+ 3748      FEFFFF
+ 3749 2c3c 4989C7   		movq	%rax, %r15
+ 3750 2c3f 4585D2   		testl	%r10d, %r10d
+ 3751 2c42 0F84F407 		je	.L485
+ 3751      0000
+ 3752              	.L414:
+ 3753 2c48 4C89FF   		movq	%r15, %rdi
+ 3754 2c4b E8000000 		call	sf_close@PLT
+ 3754      00
+ 3755 2c50 448BBDE4 		movl	-284(%rbp), %r15d
+ 3755      FEFFFF
+ 3756 2c57 418D47FF 		leal	-1(%r15), %eax
+ 3757 2c5b 83F807   		cmpl	$7, %eax
+ 3758 2c5e 0F87C707 		ja	.L486
+ 3758      0000
+ 3759              	.L415:
+ 3760 2c64 8B85E0FE 		movl	-288(%rbp), %eax
+ 3760      FFFF
+ 3761 2c6a 4589BC24 		movl	%r15d, 156(%r12)
+ 3761      9C000000 
+ 3762 2c72 41898424 		movl	%eax, 152(%r12)
+ 3762      98000000 
+ 3763 2c7a 85DB     		testl	%ebx, %ebx
+ 3764 2c7c 0F842406 		je	.L487
+ 3764      0000
+ 3765 2c82 41899C24 		movl	%ebx, 164(%r12)
+ 3765      A4000000 
+ 3766 2c8a 4C89E7   		movq	%r12, %rdi
+ 3767 2c8d E8000000 		call	init_dsp@PLT
+ 3767      00
+ 3768 2c92 458BBC24 		movl	164(%r12), %r15d
+ 3768      A4000000 
+ 3769              	.L418:
+ 3770 2c9a 4C89E7   		movq	%r12, %rdi
+ 3771 2c9d E8000000 		call	outchannels_dsp@PLT
+ 3771      00
+ 3772 2ca2 C5FE6FAD 		vmovdqu	-296(%rbp), %ymm5
+ 3772      D8FEFFFF 
+ 3773 2caa BE200000 		movl	$32, %esi
+ 3773      00
+ 3774 2caf 488BBD38 		movq	-456(%rbp), %rdi
+ 3774      FEFFFF
+ 3775 2cb6 8985F8FE 		movl	%eax, -264(%rbp)
+ 3775      FFFF
+ 3776 2cbc 488D95B0 		leaq	-336(%rbp), %rdx
+ 3776      FEFFFF
+ 3777 2cc3 89C3     		movl	%eax, %ebx
+ 3778 2cc5 C5FE7FAD 		vmovdqu	%ymm5, -336(%rbp)
+ 3778      B0FEFFFF 
+ 3779 2ccd 8985BCFE 		movl	%eax, -324(%rbp)
+ 3779      FFFF
+ 3780 2cd3 C5F877   		vzeroupper
+ 3781 2cd6 E8000000 		call	sf_open@PLT
+ 3781      00
+ 3782 2cdb 48898570 		movq	%rax, -400(%rbp)
+ 3782      FEFFFF
+ 3783 2ce2 4885C0   		testq	%rax, %rax
+ 3784 2ce5 0F84F607 		je	.L488
+ 3784      0000
+ 3785 2ceb C4C1F96E 		vmovq	%r14, %xmm0
+ 3785      C6
+ 3786 2cf0 4C89E7   		movq	%r12, %rdi
+ 3787 2cf3 E8000000 		call	preroll_dsp@PLT
+ 3787      00
+ 3788 2cf8 4989C6   		movq	%rax, %r14
+ 3789 2cfb 4885C0   		testq	%rax, %rax
+ 3790 2cfe 0F88CC07 		js	.L489
+ 3790      0000
+ 3791              	.L420:
+ 3792 2d04 C5C957F6 		vxorpd	%xmm6, %xmm6, %xmm6
+ 3793 2d08 4489F9   		movl	%r15d, %ecx
+ 3794 2d0b 418D57FF 		leal	-1(%r15), %edx
+ 3795 2d0f 4C89ADD0 		movq	%r13, -304(%rbp)
+ 3795      FEFFFF
+ 3796 2d16 48F7D2   		notq	%rdx
+ 3797 2d19 4A8D4431 		leaq	-1(%rcx,%r14), %rax
+ 3797      FF
+ 3798 2d1e 4489BDFC 		movl	%r15d, -260(%rbp)
+ 3798      FEFFFF
+ 3799 2d25 C5CB2A85 		vcvtsi2sdl	-288(%rbp), %xmm6, %xmm0
+ 3799      E0FEFFFF 
+ 3800 2d2d 4821D0   		andq	%rdx, %rax
+ 3801 2d30 C5FB5985 		vmulsd	-376(%rbp), %xmm0, %xmm0
+ 3801      88FEFFFF 
+ 3802 2d38 48898508 		movq	%rax, -248(%rbp)
+ 3802      FFFFFF
+ 3803 2d3f B8000400 		movl	$1024, %eax
+ 3803      00
+ 3804 2d44 4139C7   		cmpl	%eax, %r15d
+ 3805 2d47 490F43C7 		cmovnb	%r15, %rax
+ 3806 2d4b 48898510 		movq	%rax, -240(%rbp)
+ 3806      FFFFFF
+ 3807 2d52 C4E1FB2C 		vcvttsd2siq	%xmm0, %rsi
+ 3807      F0
+ 3808 2d57 488D4C31 		leaq	-1(%rcx,%rsi), %rcx
+ 3808      FF
+ 3809 2d5c 4821D1   		andq	%rdx, %rcx
+ 3810 2d5f 4839C1   		cmpq	%rax, %rcx
+ 3811 2d62 480F4CC8 		cmovl	%rax, %rcx
+ 3812 2d66 488B85D8 		movq	-296(%rbp), %rax
+ 3812      FEFFFF
+ 3813 2d6d 48898D00 		movq	%rcx, -256(%rbp)
+ 3813      FFFFFF
+ 3814 2d74 4885C0   		testq	%rax, %rax
+ 3815 2d77 0F849906 		je	.L456
+ 3815      0000
+ 3816 2d7d 488D4408 		leaq	-1(%rax,%rcx), %rax
+ 3816      FF
+ 3817 2d82 4899     		cqto
+ 3818 2d84 48F7F9   		idivq	%rcx
+ 3819 2d87 4863F8   		movslq	%eax, %rdi
+ 3820 2d8a 85C0     		testl	%eax, %eax
+ 3821 2d8c 89C2     		movl	%eax, %edx
+ 3822 2d8e B8010000 		movl	$1, %eax
+ 3822      00
+ 3823 2d93 480F44F8 		cmove	%rax, %rdi
+ 3824              	.L421:
+ 3825 2d97 BE480000 		movl	$72, %esi
+ 3825      00
+ 3826 2d9c 899518FF 		movl	%edx, -232(%rbp)
+ 3826      FFFF
+ 3827 2da2 C7851CFF 		movl	$0, -228(%rbp)
+ 3827      FFFF0000 
+ 3827      0000
+ 3828 2dac E8000000 		call	calloc@PLT
+ 3828      00
+ 3829 2db1 48898540 		movq	%rax, -192(%rbp)
+ 3829      FFFFFF
+ 3830 2db8 4885C0   		testq	%rax, %rax
+ 3831 2dbb 0F84A907 		je	.L490
+ 3831      0000
+ 3832              	.L422:
+ 3833 2dc1 448B8D18 		movl	-232(%rbp), %r9d
+ 3833      FFFFFF
+ 3834 2dc8 4531F6   		xorl	%r14d, %r14d
+ 3835 2dcb 4531ED   		xorl	%r13d, %r13d
+ 3836 2dce 4585C9   		testl	%r9d, %r9d
+ 3837 2dd1 7E2D     		jle	.L426
+ 3838              		.p2align 4,,10
+ 3839 2dd3 0F1F4400 		.p2align 3
+ 3839      00
+ 3840              	.L423:
+ 3841 2dd8 488BBD40 		movq	-192(%rbp), %rdi
+ 3841      FFFFFF
+ 3842 2ddf 31D2     		xorl	%edx, %edx
+ 3843 2de1 31F6     		xorl	%esi, %esi
+ 3844 2de3 4183C501 		addl	$1, %r13d
+ 3845 2de7 4C01F7   		addq	%r14, %rdi
+ 3846 2dea 4983C648 		addq	$72, %r14
+ 3847 2dee 4883C728 		addq	$40, %rdi
+ 3848 2df2 E8000000 		call	sem_init@PLT
+ 3848      00
+ 3849 2df7 4439AD18 		cmpl	%r13d, -232(%rbp)
+ 3849      FFFFFF
+ 3850 2dfe 7FD8     		jg	.L423
+ 3851              	.L426:
+ 3852 2e00 8B8558FE 		movl	-424(%rbp), %eax
+ 3852      FFFF
+ 3853 2e06 31F6     		xorl	%esi, %esi
+ 3854 2e08 8D5001   		leal	1(%rax), %edx
+ 3855 2e0b 488D8520 		leaq	-224(%rbp), %rax
+ 3855      FFFFFF
+ 3856 2e12 4889C7   		movq	%rax, %rdi
+ 3857 2e15 48898548 		movq	%rax, -440(%rbp)
+ 3857      FEFFFF
+ 3858 2e1c E8000000 		call	sem_init@PLT
+ 3858      00
+ 3859 2e21 8BBDC0FE 		movl	-320(%rbp), %edi
+ 3859      FFFF
+ 3860 2e27 E8000000 		call	quantize_bits@PLT
+ 3860      00
+ 3861 2e2c 89855CFE 		movl	%eax, -420(%rbp)
+ 3861      FFFF
+ 3862 2e32 85C0     		testl	%eax, %eax
+ 3863 2e34 0F853E06 		jne	.L491
+ 3863      0000
+ 3864 2e3a 48C78550 		movq	$0, -432(%rbp)
+ 3864      FEFFFF00 
+ 3864      000000
+ 3865 2e45 4C8BAD00 		movq	-256(%rbp), %r13
+ 3865      FFFFFF
+ 3866              	.L427:
+ 3867 2e4c 448BB558 		movl	-424(%rbp), %r14d
+ 3867      FEFFFF
+ 3868 2e53 4C89E9   		movq	%r13, %rcx
+ 3869 2e56 31FF     		xorl	%edi, %edi
+ 3870 2e58 31C0     		xorl	%eax, %eax
+ 3871 2e5a 4C8B8508 		movq	-248(%rbp), %r8
+ 3871      FFFFFF
+ 3872 2e61 8B9518FF 		movl	-232(%rbp), %edx
+ 3872      FFFF
+ 3873 2e67 488D3500 		leaq	.LC100(%rip), %rsi
+ 3873      000000
+ 3874 2e6e 4589F1   		movl	%r14d, %r9d
+ 3875 2e71 E8000000 		call	debugprint@PLT
+ 3875      00
+ 3876 2e76 4963C6   		movslq	%r14d, %rax
+ 3877 2e79 488D0440 		leaq	(%rax,%rax,2), %rax
+ 3878 2e7d 48C1E003 		salq	$3, %rax
+ 3879 2e81 4889C7   		movq	%rax, %rdi
+ 3880 2e84 48898530 		movq	%rax, -464(%rbp)
+ 3880      FEFFFF
+ 3881 2e8b E8000000 		call	malloc@PLT
+ 3881      00
+ 3882 2e90 48898540 		movq	%rax, -448(%rbp)
+ 3882      FEFFFF
+ 3883 2e97 4885C0   		testq	%rax, %rax
+ 3884 2e9a 0F84DB06 		je	.L492
+ 3884      0000
+ 3885              	.L428:
+ 3886 2ea0 488DB590 		leaq	-368(%rbp), %rsi
+ 3886      FEFFFF
+ 3887 2ea7 BF010000 		movl	$1, %edi
+ 3887      00
+ 3888 2eac E8000000 		call	clock_gettime@PLT
+ 3888      00
+ 3889 2eb1 448B8558 		movl	-424(%rbp), %r8d
+ 3889      FEFFFF
+ 3890 2eb8 4585C0   		testl	%r8d, %r8d
+ 3891 2ebb 0F8E5F06 		jle	.L493
+ 3891      0000
+ 3892 2ec1 488B8540 		movq	-448(%rbp), %rax
+ 3892      FEFFFF
+ 3893 2ec8 488B8D30 		movq	-464(%rbp), %rcx
+ 3893      FEFFFF
+ 3894 2ecf 4C8DB5D0 		leaq	-304(%rbp), %r14
+ 3894      FEFFFF
+ 3895 2ed6 4989C5   		movq	%rax, %r13
+ 3896 2ed9 4C8D3C08 		leaq	(%rax,%rcx), %r15
+ 3897 2edd EB0A     		jmp	.L434
+ 3898 2edf 90       		.p2align 4,,10
+ 3899              		.p2align 3
+ 3900              	.L433:
+ 3901 2ee0 4983C518 		addq	$24, %r13
+ 3902 2ee4 4D39EF   		cmpq	%r13, %r15
+ 3903 2ee7 743E     		je	.L494
+ 3904              	.L434:
+ 3905 2ee9 4D897500 		movq	%r14, 0(%r13)
+ 3906 2eed 4C89E7   		movq	%r12, %rdi
+ 3907 2ef0 E8000000 		call	clone_dsp@PLT
+ 3907      00
+ 3908 2ef5 31F6     		xorl	%esi, %esi
+ 3909 2ef7 498D7D10 		leaq	16(%r13), %rdi
+ 3910 2efb 4C89E9   		movq	%r13, %rcx
+ 3911 2efe 49894508 		movq	%rax, 8(%r13)
+ 3912 2f02 488B1500 		movq	segment_worker@GOTPCREL(%rip), %rdx
+ 3912      000000
+ 3913 2f09 E8000000 		call	pthread_create@PLT
+ 3913      00
+ 3914 2f0e 85C0     		testl	%eax, %eax
+ 3915 2f10 74CE     		je	.L433
+ 3916 2f12 488D3D00 		leaq	.LC101(%rip), %rdi
+ 3916      000000
+ 3917 2f19 4983C518 		addq	$24, %r13
+ 3918 2f1d E8000000 		call	endprogram@PLT
+ 3918      00
+ 3919 2f22 4D39EF   		cmpq	%r13, %r15
+ 3920 2f25 75C2     		jne	.L434
+ 3921              	.L494:
+ 3922 2f27 8BB518FF 		movl	-232(%rbp), %esi
+ 3922      FFFF
+ 3923 2f2d 85F6     		testl	%esi, %esi
+ 3924 2f2f 0F8E1706 		jle	.L495
+ 3924      0000
+ 3925              	.L430:
+ 3926 2f35 89D8     		movl	%ebx, %eax
+ 3927 2f37 4C8B3500 		movq	tracebuf@GOTPCREL(%rip), %r14
+ 3927      000000
+ 3928 2f3e 4531FF   		xorl	%r15d, %r15d
+ 3929 2f41 48C78588 		movq	$0, -376(%rbp)
+ 3929      FEFFFF00 
+ 3929      000000
+ 3930 2f4c 48898578 		movq	%rax, -392(%rbp)
+ 3930      FEFFFF
+ 3931 2f53 488D85A0 		leaq	-352(%rbp), %rax
+ 3931      FEFFFF
+ 3932 2f5a 48C78560 		movq	$0x000000000, -416(%rbp)
+ 3932      FEFFFF00 
+ 3932      000000
+ 3933 2f65 48898580 		movq	%rax, -384(%rbp)
+ 3933      FEFFFF
+ 3934 2f6c 0F1F4000 		.p2align 4,,10
+ 3935              		.p2align 3
+ 3936              	.L448:
+ 3937 2f70 488B8588 		movq	-376(%rbp), %rax
+ 3937      FEFFFF
+ 3938 2f77 488B9540 		movq	-192(%rbp), %rdx
+ 3938      FFFFFF
+ 3939 2f7e 4D89FD   		movq	%r15, %r13
+ 3940 2f81 488D04C0 		leaq	(%rax,%rax,8), %rax
+ 3941 2f85 4C8D3CC2 		leaq	(%rdx,%rax,8), %r15
+ 3942 2f89 498D5F28 		leaq	40(%r15), %rbx
+ 3943 2f8d EB0B     		jmp	.L437
+ 3944 2f8f 90       		.p2align 4,,10
+ 3945              		.p2align 3
+ 3946              	.L496:
+ 3947 2f90 E8000000 		call	__errno_location@PLT
+ 3947      00
+ 3948 2f95 833804   		cmpl	$4, (%rax)
+ 3949 2f98 750C     		jne	.L436
+ 3950              	.L437:
+ 3951 2f9a 4889DF   		movq	%rbx, %rdi
+ 3952 2f9d E8000000 		call	sem_wait@PLT
+ 3952      00
+ 3953 2fa2 85C0     		testl	%eax, %eax
+ 3954 2fa4 75EA     		jne	.L496
+ 3955              	.L436:
+ 3956 2fa6 4D85ED   		testq	%r13, %r13
+ 3957 2fa9 0F856103 		jne	.L497
+ 3957      0000
+ 3958              	.L438:
+ 3959 2faf 49833E00 		cmpq	$0, (%r14)
+ 3960 2fb3 7479     		je	.L442
+ 3961 2fb5 488BB580 		movq	-384(%rbp), %rsi
+ 3961      FEFFFF
+ 3962 2fbc BF010000 		movl	$1, %edi
+ 3962      00
+ 3963 2fc1 E8000000 		call	clock_gettime@PLT
+ 3963      00
+ 3964 2fc6 498B06   		movq	(%r14), %rax
+ 3965 2fc9 BA010000 		movl	$1, %edx
+ 3965      00
+ 3966 2fce F0480FC1 		lock xaddq	%rdx, 16(%rax)
+ 3966      5010
+ 3967 2fd4 498B06   		movq	(%r14), %rax
+ 3968 2fd7 4889D3   		movq	%rdx, %rbx
+ 3969 2fda 48235808 		andq	8(%rax), %rbx
+ 3970 2fde 48899568 		movq	%rdx, -408(%rbp)
+ 3970      FEFFFF
+ 3971 2fe5 48C1E305 		salq	$5, %rbx
+ 3972 2fe9 480318   		addq	(%rax), %rbx
+ 3973 2fec 48C70300 		movq	$0, (%rbx)
+ 3973      000000
+ 3974 2ff3 486985A0 		imulq	$1000000000, -352(%rbp), %rax
+ 3974      FEFFFF00 
+ 3974      CA9A3B
+ 3975 2ffe 480385A8 		addq	-344(%rbp), %rax
+ 3975      FEFFFF
+ 3976 3005 48894308 		movq	%rax, 8(%rbx)
+ 3977 3009 488D0500 		leaq	.LC6(%rip), %rax
+ 3977      000000
+ 3978 3010 48894310 		movq	%rax, 16(%rbx)
+ 3979 3014 E8000000 		call	trace_tid@PLT
+ 3979      00
+ 3980 3019 894318   		movl	%eax, 24(%rbx)
+ 3981 301c C6431C42 		movb	$66, 28(%rbx)
+ 3982 3020 488B9568 		movq	-408(%rbp), %rdx
+ 3982      FEFFFF
+ 3983 3027 4883C201 		addq	$1, %rdx
+ 3984 302b 488913   		movq	%rdx, (%rbx)
+ 3985              	.L442:
+ 3986 302e 488B9578 		movq	-392(%rbp), %rdx
+ 3986      FEFFFF
+ 3987 3035 490FAF57 		imulq	16(%r15), %rdx
+ 3987      10
+ 3988 303a 498B4708 		movq	8(%r15), %rax
+ 3989 303e 8B8D5CFE 		movl	-420(%rbp), %ecx
+ 3989      FFFF
+ 3990 3044 498B5F18 		movq	24(%r15), %rbx
+ 3991 3048 488D3490 		leaq	(%rax,%rdx,4), %rsi
+ 3992 304c 85C9     		testl	%ecx, %ecx
+ 3993 304e 0F849C02 		je	.L443
+ 3993      0000
+ 3994 3054 4889F2   		movq	%rsi, %rdx
+ 3995 3057 488BB550 		movq	-432(%rbp), %rsi
+ 3995      FEFFFF
+ 3996 305e 488DBD50 		leaq	-176(%rbp), %rdi
+ 3996      FFFFFF
+ 3997 3065 89D9     		movl	%ebx, %ecx
+ 3998 3067 E8000000 		call	quantize@PLT
+ 3998      00
+ 3999 306c 498B5F18 		movq	24(%r15), %rbx
+ 4000 3070 488BB550 		movq	-432(%rbp), %rsi
+ 4000      FEFFFF
+ 4001 3077 488BBD70 		movq	-400(%rbp), %rdi
+ 4001      FEFFFF
+ 4002 307e 4889DA   		movq	%rbx, %rdx
+ 4003 3081 E8000000 		call	sf_writef_int@PLT
+ 4003      00
+ 4004 3086 4839C3   		cmpq	%rax, %rbx
+ 4005 3089 740C     		je	.L445
+ 4006              	.L444:
+ 4007 308b 488D3D00 		leaq	.LC104(%rip), %rdi
+ 4007      000000
+ 4008 3092 E8000000 		call	endprogram@PLT
+ 4008      00
+ 4009              	.L445:
+ 4010 3097 49833E00 		cmpq	$0, (%r14)
+ 4011 309b 7479     		je	.L447
+ 4012 309d 488BB580 		movq	-384(%rbp), %rsi
+ 4012      FEFFFF
+ 4013 30a4 BF010000 		movl	$1, %edi
+ 4013      00
+ 4014 30a9 E8000000 		call	clock_gettime@PLT
+ 4014      00
+ 4015 30ae 498B06   		movq	(%r14), %rax
+ 4016 30b1 BA010000 		movl	$1, %edx
+ 4016      00
+ 4017 30b6 F0480FC1 		lock xaddq	%rdx, 16(%rax)
+ 4017      5010
+ 4018 30bc 498B06   		movq	(%r14), %rax
+ 4019 30bf 4889D3   		movq	%rdx, %rbx
+ 4020 30c2 48235808 		andq	8(%rax), %rbx
+ 4021 30c6 48899568 		movq	%rdx, -408(%rbp)
+ 4021      FEFFFF
+ 4022 30cd 48C1E305 		salq	$5, %rbx
+ 4023 30d1 480318   		addq	(%rax), %rbx
+ 4024 30d4 48C70300 		movq	$0, (%rbx)
+ 4024      000000
+ 4025 30db 486985A0 		imulq	$1000000000, -352(%rbp), %rax
+ 4025      FEFFFF00 
+ 4025      CA9A3B
+ 4026 30e6 480385A8 		addq	-344(%rbp), %rax
+ 4026      FEFFFF
+ 4027 30ed 48894308 		movq	%rax, 8(%rbx)
+ 4028 30f1 488D0500 		leaq	.LC6(%rip), %rax
+ 4028      000000
+ 4029 30f8 48894310 		movq	%rax, 16(%rbx)
+ 4030 30fc E8000000 		call	trace_tid@PLT
+ 4030      00
+ 4031 3101 894318   		movl	%eax, 24(%rbx)
+ 4032 3104 C6431C45 		movb	$69, 28(%rbx)
+ 4033 3108 488B9568 		movq	-408(%rbp), %rdx
+ 4033      FEFFFF
+ 4034 310f 4883C201 		addq	$1, %rdx
+ 4035 3113 488913   		movq	%rdx, (%rbx)
+ 4036              	.L447:
+ 4037 3116 48838588 		addq	$1, -376(%rbp)
+ 4037      FEFFFF01 
+ 4038 311e 488B8588 		movq	-376(%rbp), %rax
+ 4038      FEFFFF
+ 4039 3125 398518FF 		cmpl	%eax, -232(%rbp)
+ 4039      FFFF
+ 4040 312b 0F8F3FFE 		jg	.L448
+ 4040      FFFF
+ 4041 3131 498B4708 		movq	8(%r15), %rax
+ 4042 3135 498B3F   		movq	(%r15), %rdi
+ 4043 3138 4839F8   		cmpq	%rdi, %rax
+ 4044 313b 740B     		je	.L449
+ 4045 313d 4889C7   		movq	%rax, %rdi
+ 4046 3140 E8000000 		call	free@PLT
+ 4046      00
+ 4047 3145 498B3F   		movq	(%r15), %rdi
+ 4048              	.L449:
+ 4049 3148 E8000000 		call	free@PLT
+ 4049      00
+ 4050 314d 488BBD48 		movq	-440(%rbp), %rdi
+ 4050      FEFFFF
+ 4051 3154 E8000000 		call	sem_post@PLT
+ 4051      00
+ 4052 3159 8B9558FE 		movl	-424(%rbp), %edx
+ 4052      FFFF
+ 4053 315f 85D2     		testl	%edx, %edx
+ 4054 3161 7E3C     		jle	.L431
+ 4055              	.L432:
+ 4056 3163 488B8540 		movq	-448(%rbp), %rax
+ 4056      FEFFFF
+ 4057 316a 488B8D30 		movq	-464(%rbp), %rcx
+ 4057      FEFFFF
+ 4058 3171 4C8D6008 		leaq	8(%rax), %r12
+ 4059 3175 488D5C08 		leaq	8(%rax,%rcx), %rbx
+ 4059      08
+ 4060 317a 660F1F44 		.p2align 4,,10
+ 4060      0000
+ 4061              		.p2align 3
+ 4062              	.L452:
+ 4063 3180 498B7C24 		movq	8(%r12), %rdi
+ 4063      08
+ 4064 3185 31F6     		xorl	%esi, %esi
+ 4065 3187 4983C418 		addq	$24, %r12
+ 4066 318b E8000000 		call	pthread_join@PLT
+ 4066      00
+ 4067 3190 498B7C24 		movq	-24(%r12), %rdi
+ 4067      E8
+ 4068 3195 E8000000 		call	destroy_dsp@PLT
+ 4068      00
+ 4069 319a 4939DC   		cmpq	%rbx, %r12
+ 4070 319d 75E1     		jne	.L452
+ 4071              	.L431:
+ 4072 319f 488BB580 		movq	-384(%rbp), %rsi
+ 4072      FEFFFF
+ 4073 31a6 BF010000 		movl	$1, %edi
+ 4073      00
+ 4074 31ab E8000000 		call	clock_gettime@PLT
+ 4074      00
+ 4075 31b0 488B8DA8 		movq	-344(%rbp), %rcx
+ 4075      FEFFFF
+ 4076 31b7 488BBD90 		movq	-368(%rbp), %rdi
+ 4076      FEFFFF
+ 4077 31be 488BB598 		movq	-360(%rbp), %rsi
+ 4077      FEFFFF
+ 4078 31c5 488B95A0 		movq	-352(%rbp), %rdx
+ 4078      FEFFFF
+ 4079 31cc E8000000 		call	timespecsub@PLT
+ 4079      00
+ 4080 31d1 31FF     		xorl	%edi, %edi
+ 4081 31d3 488D3500 		leaq	.LC105(%rip), %rsi
+ 4081      000000
+ 4082 31da C5FB1085 		vmovsd	-416(%rbp), %xmm0
+ 4082      60FEFFFF 
+ 4083 31e2 48898590 		movq	%rax, -368(%rbp)
+ 4083      FEFFFF
+ 4084 31e9 488B8D90 		movq	-368(%rbp), %rcx
+ 4084      FEFFFF
+ 4085 31f0 B8010000 		movl	$1, %eax
+ 4085      00
+ 4086 31f5 48899598 		movq	%rdx, -360(%rbp)
+ 4086      FEFFFF
+ 4087 31fc 488B95D8 		movq	-296(%rbp), %rdx
+ 4087      FEFFFF
+ 4088 3203 4C8B8598 		movq	-360(%rbp), %r8
+ 4088      FEFFFF
+ 4089 320a E8000000 		call	debugprint@PLT
+ 4089      00
+ 4090 320f 488BBD70 		movq	-400(%rbp), %rdi
+ 4090      FEFFFF
+ 4091 3216 E8000000 		call	sf_close@PLT
+ 4091      00
+ 4092 321b 85C0     		testl	%eax, %eax
+ 4093 321d 0F852A02 		jne	.L498
+ 4093      0000
+ 4094              	.L451:
+ 4095 3223 8B8518FF 		movl	-232(%rbp), %eax
+ 4095      FFFF
+ 4096 3229 4531E4   		xorl	%r12d, %r12d
+ 4097 322c 31DB     		xorl	%ebx, %ebx
+ 4098 322e 85C0     		testl	%eax, %eax
+ 4099 3230 7E28     		jle	.L455
+ 4100              		.p2align 4,,10
+ 4101 3232 660F1F44 		.p2align 3
+ 4101      0000
+ 4102              	.L453:
+ 4103 3238 488BBD40 		movq	-192(%rbp), %rdi
+ 4103      FFFFFF
+ 4104 323f 83C301   		addl	$1, %ebx
+ 4105 3242 4C01E7   		addq	%r12, %rdi
+ 4106 3245 4983C448 		addq	$72, %r12
+ 4107 3249 4883C728 		addq	$40, %rdi
+ 4108 324d E8000000 		call	sem_destroy@PLT
+ 4108      00
+ 4109 3252 399D18FF 		cmpl	%ebx, -232(%rbp)
+ 4109      FFFF
+ 4110 3258 7FDE     		jg	.L453
+ 4111              	.L455:
+ 4112 325a 488BBD48 		movq	-440(%rbp), %rdi
+ 4112      FEFFFF
+ 4113 3261 E8000000 		call	sem_destroy@PLT
+ 4113      00
+ 4114 3266 488BBD40 		movq	-192(%rbp), %rdi
+ 4114      FFFFFF
+ 4115 326d E8000000 		call	free@PLT
+ 4115      00
+ 4116 3272 488BBD50 		movq	-432(%rbp), %rdi
+ 4116      FEFFFF
+ 4117 3279 E8000000 		call	free@PLT
+ 4117      00
+ 4118 327e 488BBD40 		movq	-448(%rbp), %rdi
+ 4118      FEFFFF
+ 4119 3285 E8000000 		call	free@PLT
+ 4119      00
+ 4120              	.L411:
+ 4121 328a C5FB1085 		vmovsd	-416(%rbp), %xmm0
+ 4121      60FEFFFF 
+ 4122 3292 4881C4A0 		addq	$416, %rsp
+ 4122      010000
+ 4123 3299 5B       		popq	%rbx
+ 4124 329a 415A     		popq	%r10
+ 4125 329c 415C     		popq	%r12
+ 4126 329e 415D     		popq	%r13
+ 4127 32a0 415E     		popq	%r14
+ 4128 32a2 415F     		popq	%r15
+ 4129 32a4 5D       		popq	%rbp
+ 4130              		.cfi_remember_state
+ 4131              		.cfi_def_cfa 7, 8
+ 4132 32a5 C3       		ret
+ 4133              	.L487:
+ 4134              		.cfi_restore_state
+ 4135 32a6 41C78424 		movl	$64, 164(%r12)
+ 4135      A4000000 
+ 4135      40000000 
+ 4136 32b2 4C89E7   		movq	%r12, %rdi
+ 4137 32b5 E8000000 		call	init_dsp@PLT
+ 4137      00
+ 4138 32ba 4C89E7   		movq	%r12, %rdi
+ 4139 32bd E8000000 		call	auto_framesize@PLT
+ 4139      00
+ 4140 32c2 458BBC24 		movl	164(%r12), %r15d
+ 4140      A4000000 
+ 4141 32ca 4439F8   		cmpl	%r15d, %eax
+ 4142 32cd 0F84C7F9 		je	.L418
+ 4142      FFFF
+ 4143 32d3 41898424 		movl	%eax, 164(%r12)
+ 4143      A4000000 
+ 4144 32db 4C89E7   		movq	%r12, %rdi
+ 4145 32de E8000000 		call	init_dsp@PLT
+ 4145      00
+ 4146 32e3 458BBC24 		movl	164(%r12), %r15d
+ 4146      A4000000 
+ 4147 32eb E9AAF9FF 		jmp	.L418
+ 4147      FF
+ 4148              		.p2align 4,,10
+ 4149              		.p2align 3
+ 4150              	.L443:
+ 4151 32f0 488BBD70 		movq	-400(%rbp), %rdi
+ 4151      FEFFFF
+ 4152 32f7 4889DA   		movq	%rbx, %rdx
+ 4153 32fa E8000000 		call	sf_writef_float@PLT
+ 4153      00
+ 4154 32ff 4839D8   		cmpq	%rbx, %rax
+ 4155 3302 0F848FFD 		je	.L445
+ 4155      FFFF
+ 4156 3308 E97EFDFF 		jmp	.L444
+ 4156      FF
+ 4157 330d 0F1F00   		.p2align 4,,10
+ 4158              		.p2align 3
+ 4159              	.L497:
+ 4160 3310 488B8578 		movq	-392(%rbp), %rax
+ 4160      FEFFFF
+ 4161 3317 4D8B4F10 		movq	16(%r15), %r9
+ 4162 331b 498B7518 		movq	24(%r13), %rsi
+ 4163 331f 49037510 		addq	16(%r13), %rsi
+ 4164 3323 480FAFF0 		imulq	%rax, %rsi
+ 4165 3327 4D8B4508 		movq	8(%r13), %r8
+ 4166 332b 498B5708 		movq	8(%r15), %rdx
+ 4167 332f 4C0FAFC8 		imulq	%rax, %r9
+ 4168 3333 490FAF45 		imulq	32(%r13), %rax
+ 4168      20
+ 4169 3338 4889C7   		movq	%rax, %rdi
+ 4170 333b 4885C0   		testq	%rax, %rax
+ 4171 333e 0F8EDE00 		jle	.L459
+ 4171      0000
+ 4172 3344 4801F7   		addq	%rsi, %rdi
+ 4173 3347 4A8D1C8A 		leaq	(%rdx,%r9,4), %rbx
+ 4174 334b 4D8D24B0 		leaq	(%r8,%rsi,4), %r12
+ 4175 334f 4C89AD68 		movq	%r13, -408(%rbp)
+ 4175      FEFFFF
+ 4176 3356 498D04B8 		leaq	(%r8,%rdi,4), %rax
+ 4177 335a 4989DD   		movq	%rbx, %r13
+ 4178 335d C5F957C0 		vxorpd	%xmm0, %xmm0, %xmm0
+ 4179 3361 4889C3   		movq	%rax, %rbx
+ 4180              		.p2align 4,,10
+ 4181 3364 0F1F4000 		.p2align 3
+ 4182              	.L440:
+ 4183 3368 C5E157DB 		vxorpd	%xmm3, %xmm3, %xmm3
+ 4184 336c 4983C404 		addq	$4, %r12
+ 4185 3370 4983C504 		addq	$4, %r13
+ 4186 3374 C4C1625A 		vcvtss2sd	-4(%r13), %xmm3, %xmm1
+ 4186      4DFC
+ 4187 337a C4C1625A 		vcvtss2sd	-4(%r12), %xmm3, %xmm2
+ 4187      5424FC
+ 4188 3381 C5EB5CD1 		vsubsd	%xmm1, %xmm2, %xmm2
+ 4189 3385 C5E95415 		vandpd	.LC102(%rip), %xmm2, %xmm2
+ 4189      00000000 
+ 4190 338d C5FB10C8 		vmovsd	%xmm0, %xmm0, %xmm1
+ 4191 3391 C5EB10C2 		vmovsd	%xmm2, %xmm2, %xmm0
+ 4192 3395 E8000000 		call	fmax@PLT
+ 4192      00
+ 4193 339a 4C39E3   		cmpq	%r12, %rbx
+ 4194 339d 75C9     		jne	.L440
+ 4195 339f 4C8BAD68 		movq	-408(%rbp), %r13
+ 4195      FEFFFF
+ 4196              	.L439:
+ 4197 33a6 8B9588FE 		movl	-376(%rbp), %edx
+ 4197      FFFF
+ 4198 33ac BF010000 		movl	$1, %edi
+ 4198      00
+ 4199 33b1 B8010000 		movl	$1, %eax
+ 4199      00
+ 4200 33b6 488D3500 		leaq	.LC103(%rip), %rsi
+ 4200      000000
+ 4201 33bd C5FB1185 		vmovsd	%xmm0, -408(%rbp)
+ 4201      68FEFFFF 
+ 4202 33c5 E8000000 		call	debugprint@PLT
+ 4202      00
+ 4203 33ca C5FB108D 		vmovsd	-416(%rbp), %xmm1
+ 4203      60FEFFFF 
+ 4204 33d2 C5FB1085 		vmovsd	-408(%rbp), %xmm0
+ 4204      68FEFFFF 
+ 4205 33da E8000000 		call	fmax@PLT
+ 4205      00
+ 4206 33df 498B4508 		movq	8(%r13), %rax
+ 4207 33e3 498B7D00 		movq	0(%r13), %rdi
+ 4208 33e7 C5FB1185 		vmovsd	%xmm0, -416(%rbp)
+ 4208      60FEFFFF 
+ 4209 33ef 4839F8   		cmpq	%rdi, %rax
+ 4210 33f2 740C     		je	.L441
+ 4211 33f4 4889C7   		movq	%rax, %rdi
+ 4212 33f7 E8000000 		call	free@PLT
+ 4212      00
+ 4213 33fc 498B7D00 		movq	0(%r13), %rdi
+ 4214              	.L441:
+ 4215 3400 E8000000 		call	free@PLT
+ 4215      00
+ 4216 3405 488BBD48 		movq	-440(%rbp), %rdi
+ 4216      FEFFFF
+ 4217 340c E8000000 		call	sem_post@PLT
+ 4217      00
+ 4218 3411 E999FBFF 		jmp	.L438
+ 4218      FF
+ 4219              	.L456:
+ 4220 3416 31D2     		xorl	%edx, %edx
+ 4221 3418 BF010000 		movl	$1, %edi
+ 4221      00
+ 4222 341d E975F9FF 		jmp	.L421
+ 4222      FF
+ 4223              	.L459:
+ 4224 3422 C5F957C0 		vxorpd	%xmm0, %xmm0, %xmm0
+ 4225 3426 E97BFFFF 		jmp	.L439
+ 4225      FF
+ 4226              	.L486:
+ 4227 342b 488D3D00 		leaq	.LC97(%rip), %rdi
+ 4227      000000
+ 4228 3432 E8000000 		call	endprogram@PLT
+ 4228      00
+ 4229 3437 E928F8FF 		jmp	.L415
+ 4229      FF
+ 4230              	.L485:
+ 4231 343c 488D3D00 		leaq	.LC96(%rip), %rdi
+ 4231      000000
+ 4232 3443 E8000000 		call	endprogram@PLT
+ 4232      00
+ 4233 3448 E9FBF7FF 		jmp	.L414
+ 4233      FF
+ 4234              	.L498:
+ 4235 344d 488BBD70 		movq	-400(%rbp), %rdi
+ 4235      FEFFFF
+ 4236 3454 E8000000 		call	sf_strerror@PLT
+ 4236      00
+ 4237 3459 488B9538 		movq	-456(%rbp), %rdx
+ 4237      FEFFFF
+ 4238 3460 488D3500 		leaq	.LC69(%rip), %rsi
+ 4238      000000
+ 4239 3467 31FF     		xorl	%edi, %edi
+ 4240 3469 4889C1   		movq	%rax, %rcx
+ 4241 346c 31C0     		xorl	%eax, %eax
+ 4242 346e E8000000 		call	debugprint@PLT
+ 4242      00
+ 4243 3473 E9ABFDFF 		jmp	.L451
+ 4243      FF
+ 4244              	.L491:
+ 4245 3478 8B955CFE 		movl	-420(%rbp), %edx
+ 4245      FFFF
+ 4246 347e 8B350000 		movl	dither(%rip), %esi
+ 4246      0000
+ 4247 3484 488DBD50 		leaq	-176(%rbp), %rdi
+ 4247      FFFFFF
+ 4248 348b 89D9     		movl	%ebx, %ecx
+ 4249 348d E8000000 		call	quantize_init@PLT
+ 4249      00
+ 4250 3492 4C8BAD00 		movq	-256(%rbp), %r13
+ 4250      FFFFFF
+ 4251 3499 89DF     		movl	%ebx, %edi
+ 4252 349b 490FAFFD 		imulq	%r13, %rdi
+ 4253 349f 48C1E702 		salq	$2, %rdi
+ 4254 34a3 E8000000 		call	malloc@PLT
+ 4254      00
+ 4255 34a8 48898550 		movq	%rax, -432(%rbp)
+ 4255      FEFFFF
+ 4256 34af 4885C0   		testq	%rax, %rax
+ 4257 34b2 0F8594F9 		jne	.L427
+ 4257      FFFF
+ 4258 34b8 488D3D00 		leaq	.LC99(%rip), %rdi
+ 4258      000000
+ 4259 34bf E8000000 		call	endprogram@PLT
+ 4259      00
+ 4260 34c4 4C8BAD00 		movq	-256(%rbp), %r13
+ 4260      FFFFFF
+ 4261 34cb E97CF9FF 		jmp	.L427
+ 4261      FF
+ 4262              		.p2align 4,,10
+ 4263              		.p2align 3
+ 4264              	.L489:
+ 4265 34d0 488D3D00 		leaq	.LC98(%rip), %rdi
+ 4265      000000
+ 4266 34d7 E8000000 		call	endprogram@PLT
+ 4266      00
+ 4267 34dc E923F8FF 		jmp	.L420
+ 4267      FF
+ 4268              	.L488:
+ 4269 34e1 488B9538 		movq	-456(%rbp), %rdx
+ 4269      FEFFFF
+ 4270 34e8 488D3500 		leaq	.LC37(%rip), %rsi
+ 4270      000000
+ 4271 34ef 31FF     		xorl	%edi, %edi
+ 4272 34f1 E8000000 		call	debugprint@PLT
+ 4272      00
+ 4273              	.L413:
+ 4274 34f6 C5FB1035 		vmovsd	.LC95(%rip), %xmm6
+ 4274      00000000 
+ 4275 34fe C5FB11B5 		vmovsd	%xmm6, -416(%rbp)
+ 4275      60FEFFFF 
+ 4276 3506 E97FFDFF 		jmp	.L411
+ 4276      FF
+ 4277              	.L484:
+ 4278 350b 4C89EA   		movq	%r13, %rdx
+ 4279 350e 488D3500 		leaq	.LC60(%rip), %rsi
+ 4279      000000
+ 4280 3515 31FF     		xorl	%edi, %edi
+ 4281 3517 31C0     		xorl	%eax, %eax
+ 4282 3519 E8000000 		call	debugprint@PLT
+ 4282      00
+ 4283 351e EBD6     		jmp	.L413
+ 4284              	.L493:
+ 4285 3520 8BBD18FF 		movl	-232(%rbp), %edi
+ 4285      FFFF
+ 4286 3526 85FF     		testl	%edi, %edi
+ 4287 3528 0F8F07FA 		jg	.L430
+ 4287      FFFF
+ 4288 352e 488D85A0 		leaq	-352(%rbp), %rax
+ 4288      FEFFFF
+ 4289 3535 48C78560 		movq	$0x000000000, -416(%rbp)
+ 4289      FEFFFF00 
+ 4289      000000
+ 4290 3540 48898580 		movq	%rax, -384(%rbp)
+ 4290      FEFFFF
+ 4291 3547 E953FCFF 		jmp	.L431
+ 4291      FF
+ 4292              	.L495:
+ 4293 354c 488D85A0 		leaq	-352(%rbp), %rax
+ 4293      FEFFFF
+ 4294 3553 48C78560 		movq	$0x000000000, -416(%rbp)
+ 4294      FEFFFF00 
+ 4294      000000
+ 4295 355e 48898580 		movq	%rax, -384(%rbp)
+ 4295      FEFFFF
+ 4296 3565 E9F9FBFF 		jmp	.L432
+ 4296      FF
+ 4297              	.L490:
+ 4298 356a 488D3D00 		leaq	.LC99(%rip), %rdi
+ 4298      000000
+ 4299 3571 E8000000 		call	endprogram@PLT
+ 4299      00
+ 4300 3576 E946F8FF 		jmp	.L422
+ 4300      FF
+ 4301              	.L492:
+ 4302 357b 488D3D00 		leaq	.LC91(%rip), %rdi
+ 4302      000000
+ 4303 3582 E8000000 		call	endprogram@PLT
+ 4303      00
+ 4304 3587 E914F9FF 		jmp	.L428
+ 4304      FF
+ 4305              		.cfi_endproc
+ 4306              	.LFE39:
+ 4308              		.section	.rodata.str1.1
+ 4309              	.LC106:
+ 4310 02e8 536F636B 		.string	"Socket filename too long: %s\n"
+ 4310      65742066 
+ 4310      696C656E 
+ 4310      616D6520 
+ 4310      746F6F20 
+ 4311              	.LC107:
+ 4312 0306 436F756C 		.string	"Could not create socket: %s\n"
+ 4312      64206E6F 
+ 4312      74206372 
+ 4312      65617465 
+ 4312      20736F63 
+ 4313              	.LC108:
+ 4314 0323 436F756C 		.string	"Could not listen on %s: %s\n"
+ 4314      64206E6F 
+ 4314      74206C69 
+ 4314      7374656E 
+ 4314      206F6E20 
+ 4315              		.section	.rodata.str1.8
+ 4316 0c5f 00       		.align 8
+ 4317              	.LC109:
+ 4318 0c60 436F756C 		.string	"Could not create server worker\n"
+ 4318      64206E6F 
+ 4318      74206372 
+ 4318      65617465 
+ 4318      20736572 
+ 4319              		.align 8
+ 4320              	.LC110:
+ 4321 0c80 4C697374 		.string	"Listening on %s with %d workers\n"
+ 4321      656E696E 
+ 4321      67206F6E 
+ 4321      20257320 
+ 4321      77697468 
+ 4322              		.section	.rodata.str1.1
+ 4323              	.LC111:
+ 4324 033f 52656365 		.string	"Received signal %d, stopping\n"
+ 4324      69766564 
+ 4324      20736967 
+ 4324      6E616C20 
+ 4324      25642C20 
+ 4325              		.text
+ 4326 358c 0F1F4000 		.p2align 4
+ 4327              		.globl	run_server
+ 4329              	run_server:
+ 4330              	.LFB44:
+ 4331              		.cfi_startproc
+ 4332 3590 55       		pushq	%rbp
+ 4333              		.cfi_def_cfa_offset 16
+ 4334              		.cfi_offset 6, -16
+ 4335 3591 C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 4336 3595 4889E5   		movq	%rsp, %rbp
+ 4337              		.cfi_def_cfa_register 6
+ 4338 3598 4157     		pushq	%r15
+ 4339              		.cfi_offset 15, -24
+ 4340 359a 4989F7   		movq	%rsi, %r15
+ 4341 359d 4156     		pushq	%r14
+ 4342              		.cfi_offset 14, -32
+ 4343 359f 4189D6   		movl	%edx, %r14d
+ 4344 35a2 BA010000 		movl	$1, %edx
+ 4344      00
+ 4345 35a7 4155     		pushq	%r13
+ 4346              		.cfi_offset 13, -40
+ 4347 35a9 4189CD   		movl	%ecx, %r13d
+ 4348 35ac 4154     		pushq	%r12
+ 4349              		.cfi_offset 12, -48
+ 4350 35ae 4989FC   		movq	%rdi, %r12
+ 4351 35b1 4C89C7   		movq	%r8, %rdi
+ 4352 35b4 53       		pushq	%rbx
+ 4353              		.cfi_offset 3, -56
+ 4354 35b5 4C89C3   		movq	%r8, %rbx
+ 4355 35b8 4881EC68 		subq	$360, %rsp
+ 4355      010000
+ 4356 35bf 488D4424 		leaq	114(%rsp), %rax
+ 4356      72
+ 4357 35c4 44894C24 		movl	%r9d, 36(%rsp)
+ 4357      24
+ 4358 35c9 48894424 		movq	%rax, 40(%rsp)
+ 4358      28
+ 4359 35ce 66895424 		movw	%dx, 112(%rsp)
+ 4359      70
+ 4360 35d3 62F17F48 		vmovdqu8	%zmm0, 114(%rsp)
+ 4360      7F842472 
+ 4360      000000
+ 4361 35de 62F17F48 		vmovdqu8	%zmm0, 158(%rsp)
+ 4361      7F84249E 
+ 4361      000000
+ 4362 35e9 C5F877   		vzeroupper
+ 4363 35ec E8000000 		call	strlen@PLT
+ 4363      00
+ 4364 35f1 4883F86B 		cmpq	$107, %rax
+ 4365 35f5 0F872D01 		ja	.L532
+ 4365      0000
+ 4366 35fb 4883C001 		addq	$1, %rax
+ 4367 35ff 83F808   		cmpl	$8, %eax
+ 4368 3602 0F82E800 		jb	.L533
+ 4368      0000
+ 4369 3608 488B13   		movq	(%rbx), %rdx
+ 4370 360b 488B7424 		movq	40(%rsp), %rsi
+ 4370      28
+ 4371 3610 488D7C24 		leaq	120(%rsp), %rdi
+ 4371      78
+ 4372 3615 48895424 		movq	%rdx, 114(%rsp)
+ 4372      72
+ 4373 361a 89C2     		movl	%eax, %edx
+ 4374 361c 488B4C13 		movq	-8(%rbx,%rdx), %rcx
+ 4374      F8
+ 4375 3621 48894C16 		movq	%rcx, -8(%rsi,%rdx)
+ 4375      F8
+ 4376 3626 4889F2   		movq	%rsi, %rdx
+ 4377 3629 4889DE   		movq	%rbx, %rsi
+ 4378 362c 4829FA   		subq	%rdi, %rdx
+ 4379 362f 8D0C10   		leal	(%rax,%rdx), %ecx
+ 4380 3632 4829D6   		subq	%rdx, %rsi
+ 4381 3635 89C8     		movl	%ecx, %eax
+ 4382 3637 C1E803   		shrl	$3, %eax
+ 4383 363a 89C1     		movl	%eax, %ecx
+ 4384 363c F348A5   		rep movsq
+ 4385              	.L503:
+ 4386 363f 31D2     		xorl	%edx, %edx
+ 4387 3641 BE050000 		movl	$5, %esi
+ 4387      00
+ 4388 3646 BF010000 		movl	$1, %edi
+ 4388      00
+ 4389 364b C7442444 		movl	$0, 68(%rsp)
+ 4389      00000000 
+ 4390 3653 4C897C24 		movq	%r15, 72(%rsp)
+ 4390      48
+ 4391 3658 44897424 		movl	%r14d, 80(%rsp)
+ 4391      50
+ 4392 365d 44896C24 		movl	%r13d, 84(%rsp)
+ 4392      54
+ 4393 3662 E8000000 		call	socket@PLT
+ 4393      00
+ 4394 3667 89442440 		movl	%eax, 64(%rsp)
+ 4395 366b 85C0     		testl	%eax, %eax
+ 4396 366d 0F88C502 		js	.L534
+ 4396      0000
+ 4397 3673 4889DF   		movq	%rbx, %rdi
+ 4398 3676 E8000000 		call	unlink@PLT
+ 4398      00
+ 4399 367b 8B7C2440 		movl	64(%rsp), %edi
+ 4400 367f 488D7424 		leaq	112(%rsp), %rsi
+ 4400      70
+ 4401 3684 BA6E0000 		movl	$110, %edx
+ 4401      00
+ 4402 3689 E8000000 		call	bind@PLT
+ 4402      00
+ 4403 368e 85C0     		testl	%eax, %eax
+ 4404 3690 7516     		jne	.L509
+ 4405 3692 8B7C2440 		movl	64(%rsp), %edi
+ 4406 3696 BE400000 		movl	$64, %esi
+ 4406      00
+ 4407 369b E8000000 		call	listen@PLT
+ 4407      00
+ 4408 36a0 85C0     		testl	%eax, %eax
+ 4409 36a2 0F849800 		je	.L535
+ 4409      0000
+ 4410              	.L509:
+ 4411 36a8 E8000000 		call	__errno_location@PLT
+ 4411      00
+ 4412 36ad 8B38     		movl	(%rax), %edi
+ 4413 36af E8000000 		call	strerror@PLT
+ 4413      00
+ 4414 36b4 31FF     		xorl	%edi, %edi
+ 4415 36b6 4889DA   		movq	%rbx, %rdx
+ 4416 36b9 488D3500 		leaq	.LC108(%rip), %rsi
+ 4416      000000
+ 4417 36c0 4889C1   		movq	%rax, %rcx
+ 4418 36c3 31C0     		xorl	%eax, %eax
+ 4419 36c5 E8000000 		call	debugprint@PLT
+ 4419      00
+ 4420 36ca 8B7C2440 		movl	64(%rsp), %edi
+ 4421 36ce E8000000 		call	close@PLT
+ 4421      00
+ 4422              	.L501:
+ 4423 36d3 31C0     		xorl	%eax, %eax
+ 4424              	.L499:
+ 4425 36d5 4881C468 		addq	$360, %rsp
+ 4425      010000
+ 4426 36dc 5B       		popq	%rbx
+ 4427 36dd 415C     		popq	%r12
+ 4428 36df 415D     		popq	%r13
+ 4429 36e1 415E     		popq	%r14
+ 4430 36e3 415F     		popq	%r15
+ 4431 36e5 5D       		popq	%rbp
+ 4432              		.cfi_remember_state
+ 4433              		.cfi_def_cfa 7, 8
+ 4434 36e6 C3       		ret
+ 4435 36e7 660F1F84 		.p2align 4,,10
+ 4435      00000000 
+ 4435      00
+ 4436              		.p2align 3
+ 4437              	.L533:
+ 4438              		.cfi_restore_state
+ 4439 36f0 A804     		testb	$4, %al
+ 4440 36f2 0F856802 		jne	.L536
+ 4440      0000
+ 4441 36f8 85C0     		testl	%eax, %eax
+ 4442 36fa 0F843FFF 		je	.L503
+ 4442      FFFF
+ 4443 3700 0FB613   		movzbl	(%rbx), %edx
+ 4444 3703 88542472 		movb	%dl, 114(%rsp)
+ 4445 3707 A802     		testb	$2, %al
+ 4446 3709 0F8430FF 		je	.L503
+ 4446      FFFF
+ 4447 370f 89C0     		movl	%eax, %eax
+ 4448 3711 488B4C24 		movq	40(%rsp), %rcx
+ 4448      28
+ 4449 3716 0FB75403 		movzwl	-2(%rbx,%rax), %edx
+ 4449      FE
+ 4450 371b 66895401 		movw	%dx, -2(%rcx,%rax)
+ 4450      FE
+ 4451 3720 E91AFFFF 		jmp	.L503
+ 4451      FF
+ 4452              		.p2align 4,,10
+ 4453 3725 0F1F00   		.p2align 3
+ 4454              	.L532:
+ 4455 3728 4889DA   		movq	%rbx, %rdx
+ 4456 372b 488D3500 		leaq	.LC106(%rip), %rsi
+ 4456      000000
+ 4457 3732 31FF     		xorl	%edi, %edi
+ 4458 3734 31C0     		xorl	%eax, %eax
+ 4459 3736 E8000000 		call	debugprint@PLT
+ 4459      00
+ 4460 373b EB96     		jmp	.L501
+ 4461 373d 0F1F00   		.p2align 4,,10
+ 4462              		.p2align 3
+ 4463              	.L535:
+ 4464 3740 488D8424 		leaq	224(%rsp), %rax
+ 4464      E0000000 
+ 4465 3748 4989C7   		movq	%rax, %r15
+ 4466 374b 4889C7   		movq	%rax, %rdi
+ 4467 374e 48894424 		movq	%rax, 40(%rsp)
+ 4467      28
+ 4468 3753 E8000000 		call	sigemptyset@PLT
+ 4468      00
+ 4469 3758 BE020000 		movl	$2, %esi
+ 4469      00
+ 4470 375d 4C89FF   		movq	%r15, %rdi
+ 4471 3760 E8000000 		call	sigaddset@PLT
+ 4471      00
+ 4472 3765 488B7C24 		movq	40(%rsp), %rdi
+ 4472      28
+ 4473 376a BE0F0000 		movl	$15, %esi
+ 4473      00
+ 4474 376f E8000000 		call	sigaddset@PLT
+ 4474      00
+ 4475 3774 488B7424 		movq	40(%rsp), %rsi
+ 4475      28
+ 4476 3779 31D2     		xorl	%edx, %edx
+ 4477 377b 31FF     		xorl	%edi, %edi
+ 4478 377d E8000000 		call	pthread_sigmask@PLT
+ 4478      00
+ 4479 3782 48634424 		movslq	36(%rsp), %rax
+ 4479      24
+ 4480 3787 48C1E005 		salq	$5, %rax
+ 4481 378b 4889C7   		movq	%rax, %rdi
+ 4482 378e 48894424 		movq	%rax, 8(%rsp)
+ 4482      08
+ 4483 3793 E8000000 		call	malloc@PLT
+ 4483      00
+ 4484 3798 48894424 		movq	%rax, 16(%rsp)
+ 4484      10
+ 4485 379d 4885C0   		testq	%rax, %rax
+ 4486 37a0 0F84D401 		je	.L537
+ 4486      0000
+ 4487              	.L510:
+ 4488 37a6 4C8B6C24 		movq	16(%rsp), %r13
+ 4488      10
+ 4489 37ab 8B4C2424 		movl	36(%rsp), %ecx
+ 4490 37af 4C896C24 		movq	%r13, 88(%rsp)
+ 4490      58
+ 4491 37b4 894C2460 		movl	%ecx, 96(%rsp)
+ 4492 37b8 85C9     		testl	%ecx, %ecx
+ 4493 37ba 0F8E8300 		jle	.L511
+ 4493      0000
+ 4494 37c0 488D4424 		leaq	64(%rsp), %rax
+ 4494      40
+ 4495 37c5 488B4C24 		movq	8(%rsp), %rcx
+ 4495      08
+ 4496 37ca 4D89EE   		movq	%r13, %r14
+ 4497 37cd 48894424 		movq	%rax, 24(%rsp)
+ 4497      18
+ 4498 37d2 4E8D3C29 		leaq	(%rcx,%r13), %r15
+ 4499 37d6 662E0F1F 		.p2align 4,,10
+ 4499      84000000 
+ 4499      0000
+ 4500              		.p2align 3
+ 4501              	.L512:
+ 4502 37e0 488B4424 		movq	24(%rsp), %rax
+ 4502      18
+ 4503 37e5 4C89E7   		movq	%r12, %rdi
+ 4504 37e8 4983C520 		addq	$32, %r13
+ 4505 37ec 498945E0 		movq	%rax, -32(%r13)
+ 4506 37f0 E8000000 		call	clone_dsp@PLT
+ 4506      00
+ 4507 37f5 41C745F0 		movl	$-1, -16(%r13)
+ 4507      FFFFFFFF 
+ 4508 37fd 498945E8 		movq	%rax, -24(%r13)
+ 4509 3801 4D39FD   		cmpq	%r15, %r13
+ 4510 3804 75DA     		jne	.L512
+ 4511 3806 4C8B2500 		movq	server_worker@GOTPCREL(%rip), %r12
+ 4511      000000
+ 4512 380d EB0A     		jmp	.L514
+ 4513 380f 90       		.p2align 4,,10
+ 4514              		.p2align 3
+ 4515              	.L513:
+ 4516 3810 4983C620 		addq	$32, %r14
+ 4517 3814 4D39FE   		cmpq	%r15, %r14
+ 4518 3817 742A     		je	.L511
+ 4519              	.L514:
+ 4520 3819 31F6     		xorl	%esi, %esi
+ 4521 381b 498D7E18 		leaq	24(%r14), %rdi
+ 4522 381f 4C89F1   		movq	%r14, %rcx
+ 4523 3822 4C89E2   		movq	%r12, %rdx
+ 4524 3825 E8000000 		call	pthread_create@PLT
+ 4524      00
+ 4525 382a 85C0     		testl	%eax, %eax
+ 4526 382c 74E2     		je	.L513
+ 4527 382e 488D3D00 		leaq	.LC109(%rip), %rdi
+ 4527      000000
+ 4528 3835 4983C620 		addq	$32, %r14
+ 4529 3839 E8000000 		call	endprogram@PLT
+ 4529      00
+ 4530 383e 4D39FE   		cmpq	%r15, %r14
+ 4531 3841 75D6     		jne	.L514
+ 4532              	.L511:
+ 4533 3843 8B4C2424 		movl	36(%rsp), %ecx
+ 4534 3847 4889DA   		movq	%rbx, %rdx
+ 4535 384a 488D3500 		leaq	.LC110(%rip), %rsi
+ 4535      000000
+ 4536 3851 31FF     		xorl	%edi, %edi
+ 4537 3853 31C0     		xorl	%eax, %eax
+ 4538 3855 4C8D6424 		leaq	60(%rsp), %r12
+ 4538      3C
+ 4539 385a E8000000 		call	debugprint@PLT
+ 4539      00
+ 4540 385f 90       		.p2align 4,,10
+ 4541              		.p2align 3
+ 4542              	.L515:
+ 4543 3860 488B7C24 		movq	40(%rsp), %rdi
+ 4543      28
+ 4544 3865 4C89E6   		movq	%r12, %rsi
+ 4545 3868 E8000000 		call	sigwait@PLT
+ 4545      00
+ 4546 386d 85C0     		testl	%eax, %eax
+ 4547 386f 75EF     		jne	.L515
+ 4548 3871 8B54243C 		movl	60(%rsp), %edx
+ 4549 3875 488D3500 		leaq	.LC111(%rip), %rsi
+ 4549      000000
+ 4550 387c 31FF     		xorl	%edi, %edi
+ 4551 387e E8000000 		call	debugprint@PLT
+ 4551      00
+ 4552 3883 B8010000 		movl	$1, %eax
+ 4552      00
+ 4553 3888 87442444 		xchgl	68(%rsp), %eax
+ 4554 388c 4889DF   		movq	%rbx, %rdi
+ 4555 388f E8000000 		call	unlink@PLT
+ 4555      00
+ 4556 3894 8B7C2440 		movl	64(%rsp), %edi
+ 4557 3898 BE020000 		movl	$2, %esi
+ 4557      00
+ 4558 389d E8000000 		call	shutdown@PLT
+ 4558      00
+ 4559 38a2 8B442424 		movl	36(%rsp), %eax
+ 4560 38a6 85C0     		testl	%eax, %eax
+ 4561 38a8 7E5B     		jle	.L516
+ 4562 38aa 488B4424 		movq	16(%rsp), %rax
+ 4562      10
+ 4563 38af 488B4C24 		movq	8(%rsp), %rcx
+ 4563      08
+ 4564 38b4 4C8D6010 		leaq	16(%rax), %r12
+ 4565 38b8 4889C3   		movq	%rax, %rbx
+ 4566 38bb 4C8D6C08 		leaq	16(%rax,%rcx), %r13
+ 4566      10
+ 4567              		.p2align 4,,10
+ 4568              		.p2align 3
+ 4569              	.L518:
+ 4570 38c0 418B3C24 		movl	(%r12), %edi
+ 4571 38c4 85FF     		testl	%edi, %edi
+ 4572 38c6 7807     		js	.L517
+ 4573 38c8 31F6     		xorl	%esi, %esi
+ 4574 38ca E8000000 		call	shutdown@PLT
+ 4574      00
+ 4575              	.L517:
+ 4576 38cf 4983C420 		addq	$32, %r12
+ 4577 38d3 4D39EC   		cmpq	%r13, %r12
+ 4578 38d6 75E8     		jne	.L518
+ 4579 38d8 4C8B6424 		movq	8(%rsp), %r12
+ 4579      08
+ 4580 38dd 488B4424 		movq	16(%rsp), %rax
+ 4580      10
+ 4581 38e2 4901C4   		addq	%rax, %r12
+ 4582              		.p2align 4,,10
+ 4583 38e5 0F1F00   		.p2align 3
+ 4584              	.L519:
+ 4585 38e8 488B7B18 		movq	24(%rbx), %rdi
+ 4586 38ec 31F6     		xorl	%esi, %esi
+ 4587 38ee 4883C320 		addq	$32, %rbx
+ 4588 38f2 E8000000 		call	pthread_join@PLT
+ 4588      00
+ 4589 38f7 488B7BE8 		movq	-24(%rbx), %rdi
+ 4590 38fb E8000000 		call	destroy_dsp@PLT
+ 4590      00
+ 4591 3900 4939DC   		cmpq	%rbx, %r12
+ 4592 3903 75E3     		jne	.L519
+ 4593              	.L516:
+ 4594 3905 488B7C24 		movq	16(%rsp), %rdi
+ 4594      10
+ 4595 390a E8000000 		call	free@PLT
+ 4595      00
+ 4596 390f 8B7C2440 		movl	64(%rsp), %edi
+ 4597 3913 E8000000 		call	close@PLT
+ 4597      00
+ 4598 3918 488B7424 		movq	40(%rsp), %rsi
+ 4598      28
+ 4599 391d 31D2     		xorl	%edx, %edx
+ 4600 391f BF010000 		movl	$1, %edi
+ 4600      00
+ 4601 3924 E8000000 		call	pthread_sigmask@PLT
+ 4601      00
+ 4602 3929 B8010000 		movl	$1, %eax
+ 4602      00
+ 4603 392e E9A2FDFF 		jmp	.L499
+ 4603      FF
+ 4604              		.p2align 4,,10
+ 4605 3933 0F1F4400 		.p2align 3
+ 4605      00
+ 4606              	.L534:
+ 4607 3938 E8000000 		call	__errno_location@PLT
+ 4607      00
+ 4608 393d 8B38     		movl	(%rax), %edi
+ 4609 393f E8000000 		call	strerror@PLT
+ 4609      00
+ 4610 3944 488D3500 		leaq	.LC107(%rip), %rsi
+ 4610      000000
+ 4611 394b 31FF     		xorl	%edi, %edi
+ 4612 394d 4889C2   		movq	%rax, %rdx
+ 4613 3950 31C0     		xorl	%eax, %eax
+ 4614 3952 E8000000 		call	debugprint@PLT
+ 4614      00
+ 4615 3957 E977FDFF 		jmp	.L501
+ 4615      FF
+ 4616 395c 0F1F4000 		.p2align 4,,10
+ 4617              		.p2align 3
+ 4618              	.L536:
+ 4619 3960 8B13     		movl	(%rbx), %edx
+ 4620 3962 89C0     		movl	%eax, %eax
+ 4621 3964 488B4C24 		movq	40(%rsp), %rcx
+ 4621      28
+ 4622 3969 89542472 		movl	%edx, 114(%rsp)
+ 4623 396d 8B5403FC 		movl	-4(%rbx,%rax), %edx
+ 4624 3971 895401FC 		movl	%edx, -4(%rcx,%rax)
+ 4625 3975 E9C5FCFF 		jmp	.L503
+ 4625      FF
+ 4626              	.L537:
+ 4627 397a 488D3D00 		leaq	.LC91(%rip), %rdi
+ 4627      000000
+ 4628 3981 E8000000 		call	endprogram@PLT
+ 4628      00
+ 4629 3986 E91BFEFF 		jmp	.L510
+ 4629      FF
+ 4630              		.cfi_endproc
+ 4631              	.LFE44:
+ 4633              		.section	.rodata.str1.1
+ 4634              	.LC113:
+ 4635 035d 70726F66 		.string	"profile"
+ 4635      696C6500 
+ 4636              	.LC114:
+ 4637 0365 0A63616E 		.string	"\ncan't catch SIGINT\n"
+ 4637      27742063 
+ 4637      61746368 
+ 4637      20534947 
+ 4637      494E540A 
+ 4638              	.LC115:
+ 4639 037a 0A63616E 		.string	"\ncan't catch SIGUSR1\n"
+ 4639      27742063 
+ 4639      61746368 
+ 4639      20534947 
+ 4639      55535231 
+ 4640              	.LC116:
+ 4641 0390 57726F6E 		.string	"Wrong options for -r\n"
+ 4641      67206F70 
+ 4641      74696F6E 
+ 4641      7320666F 
+ 4641      72202D72 
+ 4642              	.LC117:
+ 4643 03a6 6175746F 		.string	"auto"
+ 4643      00
+ 4644              		.section	.rodata.str1.8
+ 4645 0ca1 00000000 		.align 8
+ 4645      000000
+ 4646              	.LC118:
+ 4647 0ca8 4672616D 		.string	"Framesize must be a power of two.\n"
+ 4647      6573697A 
+ 4647      65206D75 
+ 4647      73742062 
+ 4647      65206120 
+ 4648 0ccb 00000000 		.align 8
+ 4648      00
+ 4649              	.LC119:
+ 4650 0cd0 436F756C 		.string	"Could not allocate memory for dsp.\n"
+ 4650      64206E6F 
+ 4650      7420616C 
+ 4650      6C6F6361 
+ 4650      7465206D 
+ 4651              		.section	.rodata.str1.1
+ 4652              	.LC120:
+ 4653 03ab 25733A20 		.string	"%s: dsp=%p\n"
+ 4653      6473703D 
+ 4653      25700A00 
+ 4654              	.LC121:
+ 4655 03b7 25733A20 		.string	"%s: dsp->next=%p\n"
+ 4655      6473702D 
+ 4655      3E6E6578 
+ 4655      743D2570 
+ 4655      0A00
+ 4656              	.LC122:
+ 4657 03c9 6E6F6E65 		.string	"none"
+ 4657      00
+ 4658              	.LC123:
+ 4659 03ce 74706466 		.string	"tpdf"
+ 4659      00
+ 4660              	.LC124:
+ 4661 03d3 73686170 		.string	"shaped"
+ 4661      656400
+ 4662              		.section	.rodata.str1.8
+ 4663 0cf4 00000000 		.align 8
+ 4664              	.LC125:
+ 4665 0cf8 44697468 		.string	"Dither must be none, tpdf or shaped\n"
+ 4665      6572206D 
+ 4665      75737420 
+ 4665      6265206E 
+ 4665      6F6E652C 
+ 4666              		.section	.rodata.str1.1
+ 4667              	.LC126:
+ 4668 03da 25733A20 		.string	"%s: verbosity=%d\n"
+ 4668      76657262 
+ 4668      6F736974 
+ 4668      793D2564 
+ 4668      0A00
+ 4669              		.section	.rodata.str1.8
+ 4670 0d1d 000000   		.align 8
+ 4671              	.LC127:
+ 4672 0d20 723A6E3A 		.string	"r:n:c:i:o:p:g:T:b:j:S:E:L:d:Pv::h?"
+ 4672      633A693A 
+ 4672      6F3A703A 
+ 4672      673A543A 
+ 4672      623A6A3A 
+ 4673              		.section	.rodata.str1.1
+ 4674              	.LC128:
+ 4675 03ec 4E6F6E2D 		.string	"Non-option argument %s\n\n"
+ 4675      6F707469 
+ 4675      6F6E2061 
+ 4675      7267756D 
+ 4675      656E7420 
+ 4676              	.LC129:
+ 4677 0405 4E6F2070 		.string	"No processing specified\n"
+ 4677      726F6365 
+ 4677      7373696E 
+ 4677      67207370 
+ 4677      65636966 
+ 4678              	.LC130:
+ 4679 041e 6D61696E 		.string	"main"
+ 4679      00
+ 4680              		.section	.rodata.str1.8
+ 4681 0d43 00000000 		.align 8
+ 4681      00
+ 4682              	.LC131:
+ 4683 0d48 2D4C2063 		.string	"-L can not be combined with -i, -o, -b, -S, -g or -P\n"
+ 4683      616E206E 
+ 4683      6F742062 
+ 4683      6520636F 
+ 4683      6D62696E 
+ 4684              		.section	.rodata.str1.1
+ 4685              	.LC132:
+ 4686 0423 4E656564 		.string	"Need at least one worker\n"
+ 4686      20617420 
+ 4686      6C656173 
+ 4686      74206F6E 
+ 4686      6520776F 
+ 4687              		.section	.rodata.str1.8
+ 4688 0d7e 0000     		.align 8
+ 4689              	.LC133:
+ 4690 0d80 4D757374 		.string	"Must specify input and output file\n"
+ 4690      20737065 
+ 4690      63696679 
+ 4690      20696E70 
+ 4690      75742061 
+ 4691 0da4 00000000 		.align 8
+ 4692              	.LC134:
+ 4693 0da8 2D532063 		.string	"-S can not be combined with -b, -g or -P\n"
+ 4693      616E206E 
+ 4693      6F742062 
+ 4693      6520636F 
+ 4693      6D62696E 
+ 4694 0dd2 00000000 		.align 8
+ 4694      0000
+ 4695              	.LC135:
+ 4696 0dd8 5365616D 		.string	"Seams differ from a serial run by more than %g\n"
+ 4696      73206469 
+ 4696      66666572 
+ 4696      2066726F 
+ 4696      6D206120 
+ 4697              		.align 8
+ 4698              	.LC136:
+ 4699 0e08 2D622063 		.string	"-b can not be combined with -i, -o, -g or -P\n"
+ 4699      616E206E 
+ 4699      6F742062 
+ 4699      6520636F 
+ 4699      6D62696E 
+ 4700              		.section	.rodata.str1.1
+ 4701              	.LC137:
+ 4702 043d 4D757374 		.string	"Must specify input file\n"
+ 4702      20737065 
+ 4702      63696679 
+ 4702      20696E70 
+ 4702      75742066 
+ 4703              	.LC138:
+ 4704 0456 4D757374 		.string	"Must specify output file\n"
+ 4704      20737065 
+ 4704      63696679 
+ 4704      206F7574 
+ 4704      70757420 
+ 4705              		.section	.text.startup,"ax",@progbits
+ 4706              		.p2align 4
+ 4707              		.globl	main
+ 4709              	main:
+ 4710              	.LFB45:
+ 4711              		.cfi_startproc
+ 4712 0000 55       		pushq	%rbp
+ 4713              		.cfi_def_cfa_offset 16
+ 4714              		.cfi_offset 6, -16
+ 4715 0001 4889E5   		movq	%rsp, %rbp
+ 4716              		.cfi_def_cfa_register 6
+ 4717 0004 4157     		pushq	%r15
+ 4718 0006 4156     		pushq	%r14
+ 4719 0008 4155     		pushq	%r13
+ 4720              		.cfi_offset 15, -24
+ 4721              		.cfi_offset 14, -32
+ 4722              		.cfi_offset 13, -40
+ 4723 000a 4C8DAD30 		leaq	-208(%rbp), %r13
+ 4723      FFFFFF
+ 4724 0011 4154     		pushq	%r12
+ 4725              		.cfi_offset 12, -48
+ 4726 0013 4989F4   		movq	%rsi, %r12
+ 4727 0016 4152     		pushq	%r10
+ 4728 0018 53       		pushq	%rbx
+ 4729              		.cfi_offset 10, -56
+ 4730              		.cfi_offset 3, -64
+ 4731 0019 89FB     		movl	%edi, %ebx
+ 4732 001b BF540000 		movl	$84, %edi
+ 4732      00
+ 4733 0020 4881EC70 		subq	$368, %rsp
+ 4733      010000
+ 4734 0027 48C785C8 		movq	$0, -312(%rbp)
+ 4734      FEFFFF00 
+ 4734      000000
+ 4735 0032 E8000000 		call	sysconf@PLT
+ 4735      00
+ 4736 0037 C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 4737 003b C785F8FE 		movl	$0, -264(%rbp)
+ 4737      FFFF0000 
+ 4737      0000
+ 4738 0045 488DBD38 		leaq	-200(%rbp), %rdi
+ 4738      FFFFFF
+ 4739 004c 8985A8FE 		movl	%eax, -344(%rbp)
+ 4739      FFFF
+ 4740 0052 488B0500 		movq	debuglevel@GOTPCREL(%rip), %rax
+ 4740      000000
+ 4741 0059 62F17F08 		vmovdqu8	%xmm0, -72(%rbp)
+ 4741      7F85B8FF 
+ 4741      FFFF
+ 4742 0063 C7000000 		movl	$0, (%rax)
+ 4742      0000
+ 4743 0069 488D0500 		leaq	.LC113(%rip), %rax
+ 4743      000000
+ 4744 0070 488985F0 		movq	%rax, -272(%rbp)
+ 4744      FEFFFF
+ 4745 0077 488B0500 		movq	sig_handler@GOTPCREL(%rip), %rax
+ 4745      000000
+ 4746 007e 48C78500 		movq	$0, -256(%rbp)
+ 4746      FFFFFF00 
+ 4746      000000
+ 4747 0089 48898530 		movq	%rax, -208(%rbp)
+ 4747      FFFFFF
+ 4748 0090 C78508FF 		movl	$80, -248(%rbp)
+ 4748      FFFF5000 
+ 4748      0000
+ 4749 009a 48C78510 		movq	$0, -240(%rbp)
+ 4749      FFFFFF00 
+ 4749      000000
+ 4750 00a5 C78518FF 		movl	$0, -232(%rbp)
+ 4750      FFFF0000 
+ 4750      0000
+ 4751 00af 48C78520 		movq	$0, -224(%rbp)
+ 4751      FFFFFF00 
+ 4751      000000
+ 4752 00ba C78528FF 		movl	$0, -216(%rbp)
+ 4752      FFFF0000 
+ 4752      0000
+ 4753 00c4 C745B800 		movl	$268435456, -72(%rbp)
+ 4753      000010
+ 4754 00cb 62F17F48 		vmovdqu8	%zmm0, -200(%rbp)
+ 4754      7F8538FF 
+ 4754      FFFF
+ 4755 00d5 62F17F48 		vmovdqu8	%zmm0, -136(%rbp)
+ 4755      7F8578FF 
+ 4755      FFFF
+ 4756 00df C5F877   		vzeroupper
+ 4757 00e2 E8000000 		call	sigemptyset@PLT
+ 4757      00
+ 4758 00e7 31D2     		xorl	%edx, %edx
+ 4759 00e9 4C89EE   		movq	%r13, %rsi
+ 4760 00ec BF020000 		movl	$2, %edi
+ 4760      00
+ 4761 00f1 E8000000 		call	sigaction@PLT
+ 4761      00
+ 4762 00f6 85C0     		testl	%eax, %eax
+ 4763 00f8 0F851805 		jne	.L651
+ 4763      0000
+ 4764              	.L539:
+ 4765 00fe 31D2     		xorl	%edx, %edx
+ 4766 0100 4C89EE   		movq	%r13, %rsi
+ 4767 0103 BF0A0000 		movl	$10, %edi
+ 4767      00
+ 4768 0108 E8000000 		call	sigaction@PLT
+ 4768      00
+ 4769 010d 85C0     		testl	%eax, %eax
+ 4770 010f 0F851605 		jne	.L652
+ 4770      0000
+ 4771              	.L540:
+ 4772 0115 83FB01   		cmpl	$1, %ebx
+ 4773 0118 0F84F608 		je	.L653
+ 4773      0000
+ 4774 011e C5FB1015 		vmovsd	.LC112(%rip), %xmm2
+ 4774      00000000 
+ 4775 0126 C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 4776 012a C6857BFE 		movb	$0, -389(%rbp)
+ 4776      FFFF00
+ 4777 0131 4C8DB5F0 		leaq	-272(%rbp), %r14
+ 4777      FEFFFF
+ 4778 0138 48C78570 		movq	$0x000000000, -400(%rbp)
+ 4778      FEFFFF00 
+ 4778      000000
+ 4779 0143 4C8D3D00 		leaq	.LC127(%rip), %r15
+ 4779      000000
+ 4780 014a 4C8D2D00 		leaq	.L545(%rip), %r13
+ 4780      000000
+ 4781 0151 C7857CFE 		movl	$65536, -388(%rbp)
+ 4781      FFFF0000 
+ 4781      0100
+ 4782 015b C785ACFE 		movl	$1024, -340(%rbp)
+ 4782      FFFF0004 
+ 4782      0000
+ 4783 0165 48C785B8 		movq	$0, -328(%rbp)
+ 4783      FEFFFF00 
+ 4783      000000
+ 4784 0170 48C785B0 		movq	$0, -336(%rbp)
+ 4784      FEFFFF00 
+ 4784      000000
+ 4785 017b 48C785A0 		movq	$0, -352(%rbp)
+ 4785      FEFFFF00 
+ 4785      000000
+ 4786 0186 48C78588 		movq	$0, -376(%rbp)
+ 4786      FEFFFF00 
+ 4786      000000
+ 4787 0191 48C78580 		movq	$0, -384(%rbp)
+ 4787      FEFFFF00 
+ 4787      000000
+ 4788 019c 48C78590 		movq	$0, -368(%rbp)
+ 4788      FEFFFF00 
+ 4788      000000
+ 4789 01a7 48C78598 		movq	$0, -360(%rbp)
+ 4789      FEFFFF00 
+ 4789      000000
+ 4790 01b2 62F17F28 		vmovdqu8	%ymm0, -304(%rbp)
+ 4790      7F85D0FE 
+ 4790      FFFF
+ 4791 01bc C5FB1195 		vmovsd	%xmm2, -408(%rbp)
+ 4791      68FEFFFF 
+ 4792 01c4 C5F877   		vzeroupper
+ 4793 01c7 660F1F84 		.p2align 4,,10
+ 4793      00000000 
+ 4793      00
+ 4794              		.p2align 3
+ 4795              	.L542:
+ 4796 01d0 4531C0   		xorl	%r8d, %r8d
+ 4797 01d3 4C89F1   		movq	%r14, %rcx
+ 4798 01d6 4C89FA   		movq	%r15, %rdx
+ 4799 01d9 4C89E6   		movq	%r12, %rsi
+ 4800 01dc 89DF     		movl	%ebx, %edi
+ 4801 01de E8000000 		call	getopt_long@PLT
+ 4801      00
+ 4802 01e3 83F8FF   		cmpl	$-1, %eax
+ 4803 01e6 7412     		je	.L654
+ 4804 01e8 83E83F   		subl	$63, %eax
+ 4805 01eb 83F837   		cmpl	$55, %eax
+ 4806 01ee 77E0     		ja	.L542
+ 4807 01f0 49634485 		movslq	0(%r13,%rax,4), %rax
+ 4807      00
+ 4808 01f5 4C01E8   		addq	%r13, %rax
+ 4809 01f8 FFE0     		jmp	*%rax
+ 4810              		.section	.rodata
+ 4811              		.align 4
+ 4812              		.align 4
+ 4813              	.L545:
+ 4814 0000 00000000 		.long	.L552-.L545
+ 4815 0004 00000000 		.long	.L542-.L545
+ 4816 0008 00000000 		.long	.L542-.L545
+ 4817 000c 00000000 		.long	.L542-.L545
+ 4818 0010 00000000 		.long	.L542-.L545
+ 4819 0014 00000000 		.long	.L542-.L545
+ 4820 0018 00000000 		.long	.L561-.L545
+ 4821 001c 00000000 		.long	.L542-.L545
+ 4822 0020 00000000 		.long	.L542-.L545
+ 4823 0024 00000000 		.long	.L542-.L545
+ 4824 0028 00000000 		.long	.L542-.L545
+ 4825 002c 00000000 		.long	.L542-.L545
+ 4826 0030 00000000 		.long	.L542-.L545
+ 4827 0034 00000000 		.long	.L560-.L545
+ 4828 0038 00000000 		.long	.L542-.L545
+ 4829 003c 00000000 		.long	.L542-.L545
+ 4830 0040 00000000 		.long	.L542-.L545
+ 4831 0044 00000000 		.long	.L610-.L545
+ 4832 0048 00000000 		.long	.L542-.L545
+ 4833 004c 00000000 		.long	.L542-.L545
+ 4834 0050 00000000 		.long	.L558-.L545
+ 4835 0054 00000000 		.long	.L557-.L545
+ 4836 0058 00000000 		.long	.L542-.L545
+ 4837 005c 00000000 		.long	.L542-.L545
+ 4838 0060 00000000 		.long	.L542-.L545
+ 4839 0064 00000000 		.long	.L542-.L545
+ 4840 0068 00000000 		.long	.L542-.L545
+ 4841 006c 00000000 		.long	.L542-.L545
+ 4842 0070 00000000 		.long	.L542-.L545
+ 4843 0074 00000000 		.long	.L542-.L545
+ 4844 0078 00000000 		.long	.L542-.L545
+ 4845 007c 00000000 		.long	.L542-.L545
+ 4846 0080 00000000 		.long	.L542-.L545
+ 4847 0084 00000000 		.long	.L542-.L545
+ 4848 0088 00000000 		.long	.L542-.L545
+ 4849 008c 00000000 		.long	.L556-.L545
+ 4850 0090 00000000 		.long	.L555-.L545
+ 4851 0094 00000000 		.long	.L554-.L545
+ 4852 0098 00000000 		.long	.L542-.L545
+ 4853 009c 00000000 		.long	.L542-.L545
+ 4854 00a0 00000000 		.long	.L553-.L545
+ 4855 00a4 00000000 		.long	.L552-.L545
+ 4856 00a8 00000000 		.long	.L551-.L545
+ 4857 00ac 00000000 		.long	.L550-.L545
+ 4858 00b0 00000000 		.long	.L542-.L545
+ 4859 00b4 00000000 		.long	.L542-.L545
+ 4860 00b8 00000000 		.long	.L542-.L545
+ 4861 00bc 00000000 		.long	.L549-.L545
+ 4862 00c0 00000000 		.long	.L548-.L545
+ 4863 00c4 00000000 		.long	.L547-.L545
+ 4864 00c8 00000000 		.long	.L542-.L545
+ 4865 00cc 00000000 		.long	.L546-.L545
+ 4866 00d0 00000000 		.long	.L542-.L545
+ 4867 00d4 00000000 		.long	.L542-.L545
+ 4868 00d8 00000000 		.long	.L542-.L545
+ 4869 00dc 00000000 		.long	.L544-.L545
+ 4870              		.section	.text.startup
+ 4871              	.L654:
+ 4872 01fa 488B0500 		movq	optind@GOTPCREL(%rip), %rax
+ 4872      000000
+ 4873 0201 8B00     		movl	(%rax), %eax
+ 4874 0203 39D8     		cmpl	%ebx, %eax
+ 4875 0205 7439     		je	.L577
+ 4876 0207 7D30     		jge	.L578
+ 4877 0209 4863D0   		movslq	%eax, %rdx
+ 4878 020c 29C3     		subl	%eax, %ebx
+ 4879 020e 4801D3   		addq	%rdx, %rbx
+ 4880 0211 4D8D2CD4 		leaq	(%r12,%rdx,8), %r13
+ 4881 0215 4D8D24DC 		leaq	(%r12,%rbx,8), %r12
+ 4882 0219 488D1D00 		leaq	.LC128(%rip), %rbx
+ 4882      000000
+ 4883              		.p2align 4,,10
+ 4884              		.p2align 3
+ 4885              	.L579:
+ 4886 0220 498B5500 		movq	0(%r13), %rdx
+ 4887 0224 4889DE   		movq	%rbx, %rsi
+ 4888 0227 31FF     		xorl	%edi, %edi
+ 4889 0229 31C0     		xorl	%eax, %eax
+ 4890 022b 4983C508 		addq	$8, %r13
+ 4891 022f E8000000 		call	debugprint@PLT
+ 4891      00
+ 4892 0234 4D39EC   		cmpq	%r13, %r12
+ 4893 0237 75E7     		jne	.L579
+ 4894              	.L578:
+ 4895 0239 31C0     		xorl	%eax, %eax
+ 4896 023b E8000000 		call	print_help@PLT
+ 4896      00
+ 4897              	.L577:
+ 4898 0240 C4E278F3 		blsr	-340(%rbp), %eax
+ 4898      8DACFEFF 
+ 4898      FF
+ 4899 0249 0F854604 		jne	.L655
+ 4899      0000
+ 4900              	.L580:
+ 4901 024f 4883BDB0 		cmpq	$0, -336(%rbp)
+ 4901      FEFFFF00 
+ 4902 0257 0F844805 		je	.L656
+ 4902      0000
+ 4903              	.L581:
+ 4904 025d 48833D00 		cmpq	$0, trace_filename(%rip)
+ 4904      00000000 
+ 4905 0265 7416     		je	.L582
+ 4906 0267 BF140000 		movl	$20, %edi
+ 4906      00
+ 4907 026c E8000000 		call	trace_create@PLT
+ 4907      00
+ 4908 0271 488D3D00 		leaq	.LC130(%rip), %rdi
+ 4908      000000
+ 4909 0278 E8000000 		call	trace_thread_name@PLT
+ 4909      00
+ 4910              	.L582:
+ 4911 027d 4883BDA0 		cmpq	$0, -352(%rbp)
+ 4911      FEFFFF00 
+ 4912 0285 0F841B04 		je	.L583
+ 4912      0000
+ 4913 028b 488B8D90 		movq	-368(%rbp), %rcx
+ 4913      FEFFFF
+ 4914 0292 488B8598 		movq	-360(%rbp), %rax
+ 4914      FEFFFF
+ 4915 0299 4809C8   		orq	%rcx, %rax
+ 4916 029c 488B8D80 		movq	-384(%rbp), %rcx
+ 4916      FEFFFF
+ 4917 02a3 4809C1   		orq	%rax, %rcx
+ 4918 02a6 4889C8   		movq	%rcx, %rax
+ 4919 02a9 480B8588 		orq	-376(%rbp), %rax
+ 4919      FEFFFF
+ 4920 02b0 0F844A05 		je	.L657
+ 4920      0000
+ 4921              	.L584:
+ 4922 02b6 488D3D00 		leaq	.LC131(%rip), %rdi
+ 4922      000000
+ 4923 02bd E8000000 		call	endprogram@PLT
+ 4923      00
+ 4924              	.L585:
+ 4925 02c2 83BDA8FE 		cmpl	$0, -344(%rbp)
+ 4925      FFFF00
+ 4926 02c9 0F8E2005 		jle	.L658
+ 4926      0000
+ 4927              	.L586:
+ 4928 02cf 448B8DA8 		movl	-344(%rbp), %r9d
+ 4928      FEFFFF
+ 4929 02d6 4C8B85A0 		movq	-352(%rbp), %r8
+ 4929      FEFFFF
+ 4930 02dd 488DB5D0 		leaq	-304(%rbp), %rsi
+ 4930      FEFFFF
+ 4931 02e4 8B8D7CFE 		movl	-388(%rbp), %ecx
+ 4931      FFFF
+ 4932 02ea 8B95ACFE 		movl	-340(%rbp), %edx
+ 4932      FFFF
+ 4933 02f0 488BBDB0 		movq	-336(%rbp), %rdi
+ 4933      FEFFFF
+ 4934 02f7 E8000000 		call	run_server@PLT
+ 4934      00
+ 4935 02fc 84C0     		testb	%al, %al
+ 4936 02fe 0F849004 		je	.L587
+ 4936      0000
+ 4937              	.L589:
+ 4938 0304 31DB     		xorl	%ebx, %ebx
+ 4939              	.L588:
+ 4940 0306 488B3D00 		movq	trace_filename(%rip), %rdi
+ 4940      000000
+ 4941 030d 4885FF   		testq	%rdi, %rdi
+ 4942 0310 7405     		je	.L609
+ 4943 0312 E8000000 		call	trace_write@PLT
+ 4943      00
+ 4944              	.L609:
+ 4945 0317 E8000000 		call	trace_destroy@PLT
+ 4945      00
+ 4946 031c 488BBDB0 		movq	-336(%rbp), %rdi
+ 4946      FEFFFF
+ 4947 0323 E8000000 		call	destroy_dsp@PLT
+ 4947      00
+ 4948 0328 31C0     		xorl	%eax, %eax
+ 4949 032a 85DB     		testl	%ebx, %ebx
+ 4950 032c 0F95C0   		setne	%al
+ 4951 032f 488D65D0 		leaq	-48(%rbp), %rsp
+ 4952 0333 5B       		popq	%rbx
+ 4953 0334 415A     		popq	%r10
+ 4954 0336 415C     		popq	%r12
+ 4955 0338 415D     		popq	%r13
+ 4956 033a 415E     		popq	%r14
+ 4957 033c 415F     		popq	%r15
+ 4958 033e 5D       		popq	%rbp
+ 4959              		.cfi_remember_state
+ 4960              		.cfi_def_cfa 7, 8
+ 4961 033f C3       		ret
+ 4962              	.L552:
+ 4963              		.cfi_restore_state
+ 4964 0340 31C0     		xorl	%eax, %eax
+ 4965 0342 E8000000 		call	print_help@PLT
+ 4965      00
+ 4966 0347 31FF     		xorl	%edi, %edi
+ 4967 0349 E8000000 		call	exit@PLT
+ 4967      00
+ 4968              	.L560:
+ 4969 034e 488B0500 		movq	optarg@GOTPCREL(%rip), %rax
+ 4969      000000
+ 4970 0355 488B00   		movq	(%rax), %rax
+ 4971 0358 488985A0 		movq	%rax, -352(%rbp)
+ 4971      FEFFFF
+ 4972 035f E96CFEFF 		jmp	.L542
+ 4972      FF
+ 4973              	.L561:
+ 4974 0364 488B0500 		movq	optarg@GOTPCREL(%rip), %rax
+ 4974      000000
+ 4975 036b 31F6     		xorl	%esi, %esi
+ 4976 036d 488B38   		movq	(%rax), %rdi
+ 4977 0370 E8000000 		call	strtod@PLT
+ 4977      00
+ 4978 0375 C5FB1185 		vmovsd	%xmm0, -408(%rbp)
+ 4978      68FEFFFF 
+ 4979 037d E94EFEFF 		jmp	.L542
+ 4979      FF
+ 4980              	.L544:
+ 4981 0382 488B0500 		movq	optarg@GOTPCREL(%rip), %rax
+ 4981      000000
+ 4982 0389 488B38   		movq	(%rax), %rdi
+ 4983 038c 4885FF   		testq	%rdi, %rdi
+ 4984 038f 0F84F002 		je	.L573
+ 4984      0000
+ 4985 0395 31F6     		xorl	%esi, %esi
+ 4986 0397 BA0A0000 		movl	$10, %edx
+ 4986      00
+ 4987 039c E8000000 		call	strtol@PLT
+ 4987      00
+ 4988 03a1 31FF     		xorl	%edi, %edi
+ 4989 03a3 488D1500 		leaq	__func__.0(%rip), %rdx
+ 4989      000000
+ 4990 03aa 488D3500 		leaq	.LC126(%rip), %rsi
+ 4990      000000
+ 4991 03b1 48898560 		movq	%rax, -416(%rbp)
+ 4991      FEFFFF
+ 4992 03b8 89C1     		movl	%eax, %ecx
+ 4993 03ba 31C0     		xorl	%eax, %eax
+ 4994 03bc E8000000 		call	debugprint@PLT
+ 4994      00
+ 4995 03c1 4C8B8560 		movq	-416(%rbp), %r8
+ 4995      FEFFFF
+ 4996 03c8 31C0     		xorl	%eax, %eax
+ 4997 03ca 4585C0   		testl	%r8d, %r8d
+ 4998 03cd 440F48C0 		cmovs	%eax, %r8d
+ 4999 03d1 488B0500 		movq	debuglevel@GOTPCREL(%rip), %rax
+ 4999      000000
+ 5000 03d8 448900   		movl	%r8d, (%rax)
+ 5001 03db E9F0FDFF 		jmp	.L542
+ 5001      FF
+ 5002              	.L546:
+ 5003 03e0 488B0500 		movq	optarg@GOTPCREL(%rip), %rax
+ 5003      000000
+ 5004 03e7 488DBDD0 		leaq	-304(%rbp), %rdi
+ 5004      FEFFFF
+ 5005 03ee 488B30   		movq	(%rax), %rsi
+ 5006 03f1 E8000000 		call	get_rawfileopts@PLT
+ 5006      00
+ 5007 03f6 84C0     		testb	%al, %al
+ 5008 03f8 0F85D2FD 		jne	.L542
+ 5008      FFFF
+ 5009 03fe 488D3D00 		leaq	.LC116(%rip), %rdi
+ 5009      000000
+ 5010 0405 E8000000 		call	endprogram@PLT
+ 5010      00
+ 5011 040a E9C1FDFF 		jmp	.L542
+ 5011      FF
+ 5012              	.L550:
+ 5013 040f 488B0500 		movq	optarg@GOTPCREL(%rip), %rax
+ 5013      000000
+ 5014 0416 BA0A0000 		movl	$10, %edx
+ 5014      00
+ 5015 041b 31F6     		xorl	%esi, %esi
+ 5016 041d 488B38   		movq	(%rax), %rdi
+ 5017 0420 E8000000 		call	strtol@PLT
+ 5017      00
+ 5018 0425 8985A8FE 		movl	%eax, -344(%rbp)
+ 5018      FFFF
+ 5019 042b E9A0FDFF 		jmp	.L542
+ 5019      FF
+ 5020              	.L551:
+ 5021 0430 488B0500 		movq	optarg@GOTPCREL(%rip), %rax
+ 5021      000000
+ 5022 0437 488B00   		movq	(%rax), %rax
+ 5023 043a 48898598 		movq	%rax, -360(%rbp)
+ 5023      FEFFFF
+ 5024 0441 E98AFDFF 		jmp	.L542
+ 5024      FF
+ 5025              	.L553:
+ 5026 0446 488B0500 		movq	optarg@GOTPCREL(%rip), %rax
+ 5026      000000
+ 5027 044d 488B00   		movq	(%rax), %rax
+ 5028 0450 48898580 		movq	%rax, -384(%rbp)
+ 5028      FEFFFF
+ 5029 0457 E974FDFF 		jmp	.L542
+ 5029      FF
+ 5030              	.L554:
+ 5031 045c 488B0500 		movq	optarg@GOTPCREL(%rip), %rax
+ 5031      000000
+ 5032 0463 488D3500 		leaq	.LC122(%rip), %rsi
+ 5032      000000
+ 5033 046a 488B00   		movq	(%rax), %rax
+ 5034 046d 4889C7   		movq	%rax, %rdi
+ 5035 0470 48898560 		movq	%rax, -416(%rbp)
+ 5035      FEFFFF
+ 5036 0477 E8000000 		call	strcmp@PLT
+ 5036      00
+ 5037 047c 85C0     		testl	%eax, %eax
+ 5038 047e 0F85BC01 		jne	.L570
+ 5038      0000
+ 5039 0484 31C9     		xorl	%ecx, %ecx
+ 5040 0486 890D0000 		movl	%ecx, dither(%rip)
+ 5040      0000
+ 5041 048c E93FFDFF 		jmp	.L542
+ 5041      FF
+ 5042              	.L555:
+ 5043 0491 488B0500 		movq	optarg@GOTPCREL(%rip), %rax
+ 5043      000000
+ 5044 0498 BA0A0000 		movl	$10, %edx
+ 5044      00
+ 5045 049d 31F6     		xorl	%esi, %esi
+ 5046 049f 488B38   		movq	(%rax), %rdi
+ 5047 04a2 E8000000 		call	strtol@PLT
+ 5047      00
+ 5048 04a7 89857CFE 		movl	%eax, -388(%rbp)
+ 5048      FFFF
+ 5049 04ad E91EFDFF 		jmp	.L542
+ 5049      FF
+ 5050              	.L557:
+ 5051 04b2 488B0500 		movq	optarg@GOTPCREL(%rip), %rax
+ 5051      000000
+ 5052 04b9 488B00   		movq	(%rax), %rax
+ 5053 04bc 48890500 		movq	%rax, trace_filename(%rip)
+ 5053      000000
+ 5054 04c3 E908FDFF 		jmp	.L542
+ 5054      FF
+ 5055              	.L558:
+ 5056 04c8 488B0500 		movq	optarg@GOTPCREL(%rip), %rax
+ 5056      000000
+ 5057 04cf 31F6     		xorl	%esi, %esi
+ 5058 04d1 488B38   		movq	(%rax), %rdi
+ 5059 04d4 E8000000 		call	strtod@PLT
+ 5059      00
+ 5060 04d9 C5FB1185 		vmovsd	%xmm0, -400(%rbp)
+ 5060      70FEFFFF 
+ 5061 04e1 E9EAFCFF 		jmp	.L542
+ 5061      FF
+ 5062              	.L556:
+ 5063 04e6 488B0500 		movq	optarg@GOTPCREL(%rip), %rax
+ 5063      000000
+ 5064 04ed 488B00   		movq	(%rax), %rax
+ 5065 04f0 48898588 		movq	%rax, -376(%rbp)
+ 5065      FEFFFF
+ 5066 04f7 E9D4FCFF 		jmp	.L542
+ 5066      FF
+ 5067              	.L548:
+ 5068 04fc 488B0500 		movq	optarg@GOTPCREL(%rip), %rax
+ 5068      000000
+ 5069 0503 488B00   		movq	(%rax), %rax
+ 5070 0506 48898590 		movq	%rax, -368(%rbp)
+ 5070      FEFFFF
+ 5071 050d E9BEFCFF 		jmp	.L542
+ 5071      FF
+ 5072              	.L549:
+ 5073 0512 488B0500 		movq	optarg@GOTPCREL(%rip), %rax
+ 5073      000000
+ 5074 0519 488D3500 		leaq	.LC117(%rip), %rsi
+ 5074      000000
+ 5075 0520 488B38   		movq	(%rax), %rdi
+ 5076 0523 4889BD60 		movq	%rdi, -416(%rbp)
+ 5076      FEFFFF
+ 5077 052a E8000000 		call	strcmp@PLT
+ 5077      00
+ 5078 052f 31F6     		xorl	%esi, %esi
+ 5079 0531 488BBD60 		movq	-416(%rbp), %rdi
+ 5079      FEFFFF
+ 5080 0538 85C0     		testl	%eax, %eax
+ 5081 053a 89B5ACFE 		movl	%esi, -340(%rbp)
+ 5081      FFFF
+ 5082 0540 0F848AFC 		je	.L542
+ 5082      FFFF
+ 5083 0546 BA0A0000 		movl	$10, %edx
+ 5083      00
+ 5084 054b 31F6     		xorl	%esi, %esi
+ 5085 054d E8000000 		call	strtol@PLT
+ 5085      00
+ 5086 0552 8985ACFE 		movl	%eax, -340(%rbp)
+ 5086      FFFF
+ 5087 0558 85C0     		testl	%eax, %eax
+ 5088 055a 0F8570FC 		jne	.L542
+ 5088      FFFF
+ 5089 0560 488D3D00 		leaq	.LC118(%rip), %rdi
+ 5089      000000
+ 5090 0567 E8000000 		call	endprogram@PLT
+ 5090      00
+ 5091 056c E95FFCFF 		jmp	.L542
+ 5091      FF
+ 5092              	.L547:
+ 5093 0571 4883BDB0 		cmpq	$0, -336(%rbp)
+ 5093      FEFFFF00 
+ 5094 0579 BF080100 		movl	$264, %edi
+ 5094      00
+ 5095 057e 0F844302 		je	.L659
+ 5095      0000
+ 5096 0584 E8000000 		call	malloc@PLT
+ 5096      00
+ 5097 0589 488B8DB8 		movq	-328(%rbp), %rcx
+ 5097      FEFFFF
+ 5098 0590 488901   		movq	%rax, (%rcx)
+ 5099 0593 4885C0   		testq	%rax, %rax
+ 5100 0596 0F846704 		je	.L660
+ 5100      0000
+ 5101              	.L569:
+ 5102 059c 488B85B8 		movq	-328(%rbp), %rax
+ 5102      FEFFFF
+ 5103 05a3 488B00   		movq	(%rax), %rax
+ 5104 05a6 488985B8 		movq	%rax, -328(%rbp)
+ 5104      FEFFFF
+ 5105              	.L567:
+ 5106 05ad 488B8DB8 		movq	-328(%rbp), %rcx
+ 5106      FEFFFF
+ 5107 05b4 488D1500 		leaq	__func__.0(%rip), %rdx
+ 5107      000000
+ 5108 05bb 31C0     		xorl	%eax, %eax
+ 5109 05bd 488D3500 		leaq	.LC120(%rip), %rsi
+ 5109      000000
+ 5110 05c4 BF020000 		movl	$2, %edi
+ 5110      00
+ 5111 05c9 E8000000 		call	debugprint@PLT
+ 5111      00
+ 5112 05ce 488B0500 		movq	optarg@GOTPCREL(%rip), %rax
+ 5112      000000
+ 5113 05d5 488BBDB8 		movq	-328(%rbp), %rdi
+ 5113      FEFFFF
+ 5114 05dc 488B30   		movq	(%rax), %rsi
+ 5115 05df E8000000 		call	create_dsp@PLT
+ 5115      00
+ 5116 05e4 488B8DB8 		movq	-328(%rbp), %rcx
+ 5116      FEFFFF
+ 5117 05eb BF020000 		movl	$2, %edi
+ 5117      00
+ 5118 05f0 31C0     		xorl	%eax, %eax
+ 5119 05f2 488D1500 		leaq	__func__.0(%rip), %rdx
+ 5119      000000
+ 5120 05f9 488D3500 		leaq	.LC121(%rip), %rsi
+ 5120      000000
+ 5121 0600 E8000000 		call	debugprint@PLT
+ 5121      00
+ 5122 0605 E9C6FBFF 		jmp	.L542
+ 5122      FF
+ 5123              	.L610:
+ 5124 060a C6857BFE 		movb	$1, -389(%rbp)
+ 5124      FFFF01
+ 5125 0611 E9BAFBFF 		jmp	.L542
+ 5125      FF
+ 5126              	.L651:
+ 5127 0616 488D3500 		leaq	.LC114(%rip), %rsi
+ 5127      000000
+ 5128 061d 31FF     		xorl	%edi, %edi
+ 5129 061f 31C0     		xorl	%eax, %eax
+ 5130 0621 E8000000 		call	debugprint@PLT
+ 5130      00
+ 5131 0626 E9D3FAFF 		jmp	.L539
+ 5131      FF
+ 5132              	.L652:
+ 5133 062b 488D3500 		leaq	.LC115(%rip), %rsi
+ 5133      000000
+ 5134 0632 31FF     		xorl	%edi, %edi
+ 5135 0634 31C0     		xorl	%eax, %eax
+ 5136 0636 E8000000 		call	debugprint@PLT
+ 5136      00
+ 5137 063b E9D5FAFF 		jmp	.L540
+ 5137      FF
+ 5138              	.L570:
+ 5139 0640 488BBD60 		movq	-416(%rbp), %rdi
+ 5139      FEFFFF
+ 5140 0647 488D3500 		leaq	.LC123(%rip), %rsi
+ 5140      000000
+ 5141 064e E8000000 		call	strcmp@PLT
+ 5141      00
+ 5142 0653 85C0     		testl	%eax, %eax
+ 5143 0655 0F842A01 		je	.L661
+ 5143      0000
+ 5144 065b 488BBD60 		movq	-416(%rbp), %rdi
+ 5144      FEFFFF
+ 5145 0662 488D3500 		leaq	.LC124(%rip), %rsi
+ 5145      000000
+ 5146 0669 E8000000 		call	strcmp@PLT
+ 5146      00
+ 5147 066e 85C0     		testl	%eax, %eax
+ 5148 0670 0F85CC02 		jne	.L572
+ 5148      0000
+ 5149 0676 C7050000 		movl	$2, dither(%rip)
+ 5149      00000200 
+ 5149      0000
+ 5150 0680 E94BFBFF 		jmp	.L542
+ 5150      FF
+ 5151              	.L573:
+ 5152 0685 488B0500 		movq	debuglevel@GOTPCREL(%rip), %rax
+ 5152      000000
+ 5153 068c 31D2     		xorl	%edx, %edx
+ 5154 068e 8910     		movl	%edx, (%rax)
+ 5155 0690 E93BFBFF 		jmp	.L542
+ 5155      FF
+ 5156              	.L655:
+ 5157 0695 488D3D00 		leaq	.LC118(%rip), %rdi
+ 5157      000000
+ 5158 069c E8000000 		call	endprogram@PLT
+ 5158      00
+ 5159 06a1 E9A9FBFF 		jmp	.L580
+ 5159      FF
+ 5160              	.L583:
+ 5161 06a6 C5FB109D 		vmovsd	-400(%rbp), %xmm3
+ 5161      70FEFFFF 
+ 5162 06ae C5F957C0 		vxorpd	%xmm0, %xmm0, %xmm0
+ 5163 06b2 C5F92FD8 		vcomisd	%xmm0, %xmm3
+ 5164 06b6 0F866C01 		jbe	.L649
+ 5164      0000
+ 5165 06bc 4883BD98 		cmpq	$0, -360(%rbp)
+ 5165      FEFFFF00 
+ 5166 06c4 0F848902 		je	.L613
+ 5166      0000
+ 5167 06ca 4883BD90 		cmpq	$0, -368(%rbp)
+ 5167      FEFFFF00 
+ 5168 06d2 0F847B02 		je	.L613
+ 5168      0000
+ 5169              	.L592:
+ 5170 06d8 488B8580 		movq	-384(%rbp), %rax
+ 5170      FEFFFF
+ 5171 06df 480B8588 		orq	-376(%rbp), %rax
+ 5171      FEFFFF
+ 5172 06e6 0F85CA00 		jne	.L614
+ 5172      0000
+ 5173 06ec 80BD7BFE 		cmpb	$0, -389(%rbp)
+ 5173      FFFF00
+ 5174 06f3 0F85BD00 		jne	.L614
+ 5174      0000
+ 5175              	.L594:
+ 5176 06f9 83BDA8FE 		cmpl	$0, -344(%rbp)
+ 5176      FFFF00
+ 5177 0700 0F8E5E02 		jle	.L662
+ 5177      0000
+ 5178              	.L596:
+ 5179 0706 C5FB108D 		vmovsd	-408(%rbp), %xmm1
+ 5179      68FEFFFF 
+ 5180 070e 448B8DA8 		movl	-344(%rbp), %r9d
+ 5180      FEFFFF
+ 5181 0715 488DB5D0 		leaq	-304(%rbp), %rsi
+ 5181      FEFFFF
+ 5182 071c C5FB1085 		vmovsd	-400(%rbp), %xmm0
+ 5182      70FEFFFF 
+ 5183 0724 4C8B8590 		movq	-368(%rbp), %r8
+ 5183      FEFFFF
+ 5184 072b 488B8D98 		movq	-360(%rbp), %rcx
+ 5184      FEFFFF
+ 5185 0732 8B95ACFE 		movl	-340(%rbp), %edx
+ 5185      FFFF
+ 5186 0738 488BBDB0 		movq	-336(%rbp), %rdi
+ 5186      FEFFFF
+ 5187 073f E8000000 		call	run_segmented@PLT
+ 5187      00
+ 5188 0744 C5F157C9 		vxorpd	%xmm1, %xmm1, %xmm1
+ 5189 0748 C5F92FC8 		vcomisd	%xmm0, %xmm1
+ 5190 074c 0F872302 		ja	.L663
+ 5190      0000
+ 5191              	.L597:
+ 5192 0752 C5F92F85 		vcomisd	-408(%rbp), %xmm0
+ 5192      68FEFFFF 
+ 5193 075a 0F86A4FB 		jbe	.L589
+ 5193      FFFF
+ 5194 0760 488D3500 		leaq	.LC135(%rip), %rsi
+ 5194      000000
+ 5195 0767 31FF     		xorl	%edi, %edi
+ 5196 0769 B8010000 		movl	$1, %eax
+ 5196      00
+ 5197 076e C5FB1085 		vmovsd	-408(%rbp), %xmm0
+ 5197      68FEFFFF 
+ 5198 0776 BB010000 		movl	$1, %ebx
+ 5198      00
+ 5199 077b E8000000 		call	debugprint@PLT
+ 5199      00
+ 5200 0780 E981FBFF 		jmp	.L588
+ 5200      FF
+ 5201              	.L661:
+ 5202 0785 C7050000 		movl	$1, dither(%rip)
+ 5202      00000100 
+ 5202      0000
+ 5203 078f E93CFAFF 		jmp	.L542
+ 5203      FF
+ 5204              	.L587:
+ 5205 0794 488D3D00 		leaq	.LC38(%rip), %rdi
+ 5205      000000
+ 5206 079b E8000000 		call	endprogram@PLT
+ 5206      00
+ 5207 07a0 E95FFBFF 		jmp	.L589
+ 5207      FF
+ 5208              	.L656:
+ 5209 07a5 488D3D00 		leaq	.LC129(%rip), %rdi
+ 5209      000000
+ 5210 07ac E8000000 		call	endprogram@PLT
+ 5210      00
+ 5211 07b1 E9A7FAFF 		jmp	.L581
+ 5211      FF
+ 5212              	.L614:
+ 5213 07b6 488D3D00 		leaq	.LC134(%rip), %rdi
+ 5213      000000
+ 5214 07bd E8000000 		call	endprogram@PLT
+ 5214      00
+ 5215 07c2 E932FFFF 		jmp	.L594
+ 5215      FF
+ 5216              	.L659:
+ 5217 07c7 E8000000 		call	malloc@PLT
+ 5217      00
+ 5218 07cc 488985B0 		movq	%rax, -336(%rbp)
+ 5218      FEFFFF
+ 5219 07d3 4885C0   		testq	%rax, %rax
+ 5220 07d6 0F841602 		je	.L566
+ 5220      0000
+ 5221              	.L568:
+ 5222 07dc 488B85B0 		movq	-336(%rbp), %rax
+ 5222      FEFFFF
+ 5223 07e3 488985B8 		movq	%rax, -328(%rbp)
+ 5223      FEFFFF
+ 5224 07ea E9BEFDFF 		jmp	.L567
+ 5224      FF
+ 5225              	.L658:
+ 5226 07ef 488D3D00 		leaq	.LC132(%rip), %rdi
+ 5226      000000
+ 5227 07f6 E8000000 		call	endprogram@PLT
+ 5227      00
+ 5228 07fb E9CFFAFF 		jmp	.L586
+ 5228      FF
+ 5229              	.L657:
+ 5230 0800 C5FB10AD 		vmovsd	-400(%rbp), %xmm5
+ 5230      70FEFFFF 
+ 5231 0808 C5F957C0 		vxorpd	%xmm0, %xmm0, %xmm0
+ 5232 080c C5F92FE8 		vcomisd	%xmm0, %xmm5
+ 5233 0810 0F87A0FA 		ja	.L584
+ 5233      FFFF
+ 5234 0816 80BD7BFE 		cmpb	$0, -389(%rbp)
+ 5234      FFFF00
+ 5235 081d 0F849FFA 		je	.L585
+ 5235      FFFF
+ 5236 0823 E98EFAFF 		jmp	.L584
+ 5236      FF
+ 5237              	.L649:
+ 5238 0828 4883BD88 		cmpq	$0, -376(%rbp)
+ 5238      FEFFFF00 
+ 5239 0830 7470     		je	.L601
+ 5240 0832 488B8598 		movq	-360(%rbp), %rax
+ 5240      FEFFFF
+ 5241 0839 488B8D90 		movq	-368(%rbp), %rcx
+ 5241      FEFFFF
+ 5242 0840 4809C8   		orq	%rcx, %rax
+ 5243 0843 480B8580 		orq	-384(%rbp), %rax
+ 5243      FEFFFF
+ 5244 084a 7509     		jne	.L602
+ 5245 084c 80BD7BFE 		cmpb	$0, -389(%rbp)
+ 5245      FFFF00
+ 5246 0853 740C     		je	.L603
+ 5247              	.L602:
+ 5248 0855 488D3D00 		leaq	.LC136(%rip), %rdi
+ 5248      000000
+ 5249 085c E8000000 		call	endprogram@PLT
+ 5249      00
+ 5250              	.L603:
+ 5251 0861 83BDA8FE 		cmpl	$0, -344(%rbp)
+ 5251      FFFF00
+ 5252 0868 0F8E2801 		jle	.L664
+ 5252      0000
+ 5253              	.L604:
+ 5254 086e 448B8DA8 		movl	-344(%rbp), %r9d
+ 5254      FEFFFF
+ 5255 0875 4C8B8588 		movq	-376(%rbp), %r8
+ 5255      FEFFFF
+ 5256 087c 488DB5D0 		leaq	-304(%rbp), %rsi
+ 5256      FEFFFF
+ 5257 0883 8B8D7CFE 		movl	-388(%rbp), %ecx
+ 5257      FFFF
+ 5258 0889 8B95ACFE 		movl	-340(%rbp), %edx
+ 5258      FFFF
+ 5259 088f 488BBDB0 		movq	-336(%rbp), %rdi
+ 5259      FEFFFF
+ 5260 0896 E8000000 		call	run_batch@PLT
+ 5260      00
+ 5261 089b 89C3     		movl	%eax, %ebx
+ 5262 089d E964FAFF 		jmp	.L588
+ 5262      FF
+ 5263              	.L601:
+ 5264 08a2 4883BD98 		cmpq	$0, -360(%rbp)
+ 5264      FEFFFF00 
+ 5265 08aa 0F843101 		je	.L665
+ 5265      0000
+ 5266              	.L605:
+ 5267 08b0 4883BD90 		cmpq	$0, -368(%rbp)
+ 5267      FEFFFF00 
+ 5268 08b8 0F841201 		je	.L666
+ 5268      0000
+ 5269              	.L606:
+ 5270 08be 80BD7BFE 		cmpb	$0, -389(%rbp)
+ 5270      FFFF00
+ 5271 08c5 0F85ED00 		jne	.L667
+ 5271      0000
+ 5272              	.L607:
+ 5273 08cb 50       		pushq	%rax
+ 5274 08cc 488D85C8 		leaq	-312(%rbp), %rax
+ 5274      FEFFFF
+ 5275 08d3 4C8B8D90 		movq	-368(%rbp), %r9
+ 5275      FEFFFF
+ 5276 08da 488DB5D0 		leaq	-304(%rbp), %rsi
+ 5276      FEFFFF
+ 5277 08e1 4C8B8598 		movq	-360(%rbp), %r8
+ 5277      FEFFFF
+ 5278 08e8 8B8D7CFE 		movl	-388(%rbp), %ecx
+ 5278      FFFF
+ 5279 08ee 50       		pushq	%rax
+ 5280 08ef 8B95ACFE 		movl	-340(%rbp), %edx
+ 5280      FFFF
+ 5281 08f5 488BBDB0 		movq	-336(%rbp), %rdi
+ 5281      FEFFFF
+ 5282 08fc 6A00     		pushq	$0
+ 5283 08fe FFB580FE 		pushq	-384(%rbp)
+ 5283      FFFF
+ 5284 0904 E8000000 		call	process_file@PLT
+ 5284      00
+ 5285 0909 4883C420 		addq	$32, %rsp
+ 5286 090d 84C0     		testb	%al, %al
+ 5287 090f 0F849200 		je	.L668
+ 5287      0000
+ 5288              	.L608:
+ 5289 0915 488B3D00 		movq	profile(%rip), %rdi
+ 5289      000000
+ 5290 091c 4885FF   		testq	%rdi, %rdi
+ 5291 091f 0F84DFF9 		je	.L589
+ 5291      FFFF
+ 5292 0925 488BB5C8 		movq	-312(%rbp), %rsi
+ 5292      FEFFFF
+ 5293 092c E8000000 		call	profile_report@PLT
+ 5293      00
+ 5294 0931 488B3D00 		movq	profile(%rip), %rdi
+ 5294      000000
+ 5295 0938 E8000000 		call	profile_destroy@PLT
+ 5295      00
+ 5296 093d E9C2F9FF 		jmp	.L589
+ 5296      FF
+ 5297              	.L572:
+ 5298 0942 488D3D00 		leaq	.LC125(%rip), %rdi
+ 5298      000000
+ 5299 0949 E8000000 		call	endprogram@PLT
+ 5299      00
+ 5300 094e E97DF8FF 		jmp	.L542
+ 5300      FF
+ 5301              	.L613:
+ 5302 0953 488D3D00 		leaq	.LC133(%rip), %rdi
+ 5302      000000
+ 5303 095a E8000000 		call	endprogram@PLT
+ 5303      00
+ 5304 095f E974FDFF 		jmp	.L592
+ 5304      FF
+ 5305              	.L662:
+ 5306 0964 488D3D00 		leaq	.LC132(%rip), %rdi
+ 5306      000000
+ 5307 096b E8000000 		call	endprogram@PLT
+ 5307      00
+ 5308 0970 E991FDFF 		jmp	.L596
+ 5308      FF
+ 5309              	.L663:
+ 5310 0975 488D3D00 		leaq	.LC38(%rip), %rdi
+ 5310      000000
+ 5311 097c C5FB1185 		vmovsd	%xmm0, -328(%rbp)
+ 5311      B8FEFFFF 
+ 5312 0984 E8000000 		call	endprogram@PLT
+ 5312      00
+ 5313 0989 C5FB1085 		vmovsd	-328(%rbp), %xmm0
+ 5313      B8FEFFFF 
+ 5314 0991 E9BCFDFF 		jmp	.L597
+ 5314      FF
+ 5315              	.L664:
+ 5316 0996 488D3D00 		leaq	.LC132(%rip), %rdi
+ 5316      000000
+ 5317 099d E8000000 		call	endprogram@PLT
+ 5317      00
+ 5318 09a2 E9C7FEFF 		jmp	.L604
+ 5318      FF
+ 5319              	.L668:
+ 5320 09a7 488D3D00 		leaq	.LC38(%rip), %rdi
+ 5320      000000
+ 5321 09ae E8000000 		call	endprogram@PLT
+ 5321      00
+ 5322 09b3 E95DFFFF 		jmp	.L608
+ 5322      FF
+ 5323              	.L667:
+ 5324 09b8 488BBDB0 		movq	-336(%rbp), %rdi
+ 5324      FEFFFF
+ 5325 09bf E8000000 		call	profile_create@PLT
+ 5325      00
+ 5326 09c4 48890500 		movq	%rax, profile(%rip)
+ 5326      000000
+ 5327 09cb E9FBFEFF 		jmp	.L607
+ 5327      FF
+ 5328              	.L666:
+ 5329 09d0 488D3D00 		leaq	.LC138(%rip), %rdi
+ 5329      000000
+ 5330 09d7 E8000000 		call	endprogram@PLT
+ 5330      00
+ 5331 09dc E9DDFEFF 		jmp	.L606
+ 5331      FF
+ 5332              	.L665:
+ 5333 09e1 488D3D00 		leaq	.LC137(%rip), %rdi
+ 5333      000000
+ 5334 09e8 E8000000 		call	endprogram@PLT
+ 5334      00
+ 5335 09ed E9BEFEFF 		jmp	.L605
+ 5335      FF
+ 5336              	.L566:
+ 5337 09f2 488D3D00 		leaq	.LC119(%rip), %rdi
+ 5337      000000
+ 5338 09f9 E8000000 		call	endprogram@PLT
+ 5338      00
+ 5339 09fe E9D9FDFF 		jmp	.L568
+ 5339      FF
+ 5340              	.L660:
+ 5341 0a03 488D3D00 		leaq	.LC119(%rip), %rdi
+ 5341      000000
+ 5342 0a0a E8000000 		call	endprogram@PLT
+ 5342      00
+ 5343 0a0f E988FBFF 		jmp	.L569
+ 5343      FF
+ 5344              	.L653:
+ 5345 0a14 31C0     		xorl	%eax, %eax
+ 5346 0a16 E8000000 		call	print_help@PLT
+ 5346      00
+ 5347 0a1b BF010000 		movl	$1, %edi
+ 5347      00
+ 5348 0a20 E8000000 		call	exit@PLT
+ 5348      00
+ 5349              		.cfi_endproc
+ 5350              	.LFE45:
+ 5352              		.section	.rodata
+ 5355              	__func__.0:
+ 5356 00e0 6D61696E 		.string	"main"
+ 5356      00
+ 5357 00e5 000000   		.align 8
+ 5360              	__func__.1:
+ 5361 00e8 73657276 		.string	"server_reply"
+ 5361      65725F72 
+ 5361      65706C79 
+ 5361      00
+ 5362 00f5 000000   		.align 8
+ 5365              	__func__.2:
+ 5366 00f8 73657276 		.string	"server_worker"
+ 5366      65725F77 
+ 5366      6F726B65 
+ 5366      7200
+ 5367 0106 0000     		.align 8
+ 5370              	__func__.3:
+ 5371 0108 70726F63 		.string	"process_file"
+ 5371      6573735F 
+ 5371      66696C65 
+ 5371      00
+ 5372 0115 00000000 		.align 16
+ 5372      00000000 
+ 5372      000000
+ 5375              	__func__.4:
+ 5376 0120 6765745F 		.string	"get_rawfileopts"
+ 5376      72617766 
+ 5376      696C656F 
+ 5376      70747300 
+ 5377              		.globl	debuglevel
+ 5378              		.bss
+ 5379              		.align 4
+ 5382              	debuglevel:
+ 5383 0000 00000000 		.zero	4
+ 5384              		.data
+ 5385              		.align 4
+ 5388              	dither:
+ 5389 0000 01000000 		.long	1
+ 5390              		.local	profile
+ 5391              		.comm	profile,8,8
+ 5392              		.local	trace_filename
+ 5393              		.comm	trace_filename,8,8
+ 5394              		.globl	trace_requested
+ 5395              		.bss
+ 5396              		.align 4
+ 5399              	trace_requested:
+ 5400 0004 00000000 		.zero	4
+ 5401              		.section	.rodata.cst8,"aM",@progbits,8
+ 5402              		.align 8
+ 5403              	.LC95:
+ 5404 0000 00000000 		.long	0
+ 5405 0004 0000F0BF 		.long	-1074790400
+ 5406              		.section	.rodata.cst16,"aM",@progbits,16
+ 5407              		.align 16
+ 5408              	.LC102:
+ 5409 0000 FFFFFFFF 		.long	-1
+ 5410 0004 FFFFFF7F 		.long	2147483647
+ 5411 0008 00000000 		.long	0
+ 5412 000c 00000000 		.long	0
+ 5413              		.section	.rodata.cst8
+ 5414              		.align 8
+ 5415              	.LC112:
+ 5416 0008 8DEDB5A0 		.long	-1598689907
+ 5417 000c F7C6B03E 		.long	1051772663
+ 5418              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 5419              		.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1182 @@
+   1              		.file	"interleave.c"
+   2              		.text
+   3              		.p2align 4
+   4              		.globl	deinterleave_generic
+   6              	deinterleave_generic:
+   7              	.LFB6388:
+   8              		.cfi_startproc
+   9 0000 85D2     		testl	%edx, %edx
+  10 0002 7E5C     		jle	.L10
+  11 0004 4C63CA   		movslq	%edx, %r9
+  12 0007 55       		pushq	%rbp
+  13              		.cfi_def_cfa_offset 16
+  14              		.cfi_offset 6, -16
+  15 0008 4531DB   		xorl	%r11d, %r11d
+  16 000b 4531D2   		xorl	%r10d, %r10d
+  17 000e 53       		pushq	%rbx
+  18              		.cfi_def_cfa_offset 24
+  19              		.cfi_offset 3, -24
+  20 000f 49C1E102 		salq	$2, %r9
+  21 0013 89D3     		movl	%edx, %ebx
+  22 0015 4863E9   		movslq	%ecx, %rbp
+  23 0018 0F1F8400 		.p2align 4,,10
+  23      00000000 
+  24              		.p2align 3
+  25              	.L3:
+  26 0020 85C9     		testl	%ecx, %ecx
+  27 0022 7E29     		jle	.L6
+  28 0024 4963D3   		movslq	%r11d, %rdx
+  29 0027 488D0497 		leaq	(%rdi,%rdx,4), %rax
+  30 002b 4801EA   		addq	%rbp, %rdx
+  31 002e 4C8D0497 		leaq	(%rdi,%rdx,4), %r8
+  32 0032 4889F2   		movq	%rsi, %rdx
+  33              		.p2align 4,,10
+  34 0035 0F1F00   		.p2align 3
+  35              	.L4:
+  36 0038 C5FA1002 		vmovss	(%rdx), %xmm0
+  37 003c 4883C004 		addq	$4, %rax
+  38 0040 4C01CA   		addq	%r9, %rdx
+  39 0043 C5FA1140 		vmovss	%xmm0, -4(%rax)
+  39      FC
+  40 0048 4C39C0   		cmpq	%r8, %rax
+  41 004b 75EB     		jne	.L4
+  42              	.L6:
+  43 004d 4183C201 		addl	$1, %r10d
+  44 0051 4883C604 		addq	$4, %rsi
+  45 0055 4101CB   		addl	%ecx, %r11d
+  46 0058 4439D3   		cmpl	%r10d, %ebx
+  47 005b 75C3     		jne	.L3
+  48 005d 5B       		popq	%rbx
+  49              		.cfi_def_cfa_offset 16
+  50 005e 5D       		popq	%rbp
+  51              		.cfi_def_cfa_offset 8
+  52 005f C3       		ret
+  53              	.L10:
+  54              		.cfi_restore 3
+  55              		.cfi_restore 6
+  56 0060 C3       		ret
+  57              		.cfi_endproc
+  58              	.LFE6388:
+  60 0061 66662E0F 		.p2align 4
+  60      1F840000 
+  60      0000000F 
+  60      1F4000
+  61              		.globl	interleave_generic
+  63              	interleave_generic:
+  64              	.LFB6389:
+  65              		.cfi_startproc
+  66 0070 85D2     		testl	%edx, %edx
+  67 0072 7E5B     		jle	.L23
+  68 0074 4C63CA   		movslq	%edx, %r9
+  69 0077 55       		pushq	%rbp
+  70              		.cfi_def_cfa_offset 16
+  71              		.cfi_offset 6, -16
+  72 0078 4531DB   		xorl	%r11d, %r11d
+  73 007b 4531D2   		xorl	%r10d, %r10d
+  74 007e 53       		pushq	%rbx
+  75              		.cfi_def_cfa_offset 24
+  76              		.cfi_offset 3, -24
+  77 007f 49C1E102 		salq	$2, %r9
+  78 0083 89D3     		movl	%edx, %ebx
+  79 0085 4863E9   		movslq	%ecx, %rbp
+  80 0088 0F1F8400 		.p2align 4,,10
+  80      00000000 
+  81              		.p2align 3
+  82              	.L16:
+  83 0090 85C9     		testl	%ecx, %ecx
+  84 0092 7E28     		jle	.L19
+  85 0094 4963D3   		movslq	%r11d, %rdx
+  86 0097 488D0496 		leaq	(%rsi,%rdx,4), %rax
+  87 009b 4801EA   		addq	%rbp, %rdx
+  88 009e 4C8D0496 		leaq	(%rsi,%rdx,4), %r8
+  89 00a2 4889FA   		movq	%rdi, %rdx
+  90              		.p2align 4,,10
+  91 00a5 0F1F00   		.p2align 3
+  92              	.L17:
+  93 00a8 C5FA1000 		vmovss	(%rax), %xmm0
+  94 00ac 4883C004 		addq	$4, %rax
+  95 00b0 C5FA1102 		vmovss	%xmm0, (%rdx)
+  96 00b4 4C01CA   		addq	%r9, %rdx
+  97 00b7 4C39C0   		cmpq	%r8, %rax
+  98 00ba 75EC     		jne	.L17
+  99              	.L19:
+ 100 00bc 4183C201 		addl	$1, %r10d
+ 101 00c0 4883C704 		addq	$4, %rdi
+ 102 00c4 4101CB   		addl	%ecx, %r11d
+ 103 00c7 4439D3   		cmpl	%r10d, %ebx
+ 104 00ca 75C4     		jne	.L16
+ 105 00cc 5B       		popq	%rbx
+ 106              		.cfi_def_cfa_offset 16
+ 107 00cd 5D       		popq	%rbp
+ 108              		.cfi_def_cfa_offset 8
+ 109 00ce C3       		ret
+ 110              	.L23:
+ 111              		.cfi_restore 3
+ 112              		.cfi_restore 6
+ 113 00cf C3       		ret
+ 114              		.cfi_endproc
+ 115              	.LFE6389:
+ 117              		.p2align 4
+ 118              		.globl	deinterleave
+ 120              	deinterleave:
+ 121              	.LFB6400:
+ 122              		.cfi_startproc
+ 123 00d0 4889F0   		movq	%rsi, %rax
+ 124 00d3 4189C9   		movl	%ecx, %r9d
+ 125 00d6 83FA01   		cmpl	$1, %edx
+ 126 00d9 0F846905 		je	.L68
+ 126      0000
+ 127 00df 55       		pushq	%rbp
+ 128              		.cfi_def_cfa_offset 16
+ 129              		.cfi_offset 6, -16
+ 130 00e0 4189D0   		movl	%edx, %r8d
+ 131 00e3 4889E5   		movq	%rsp, %rbp
+ 132              		.cfi_def_cfa_register 6
+ 133 00e6 4157     		pushq	%r15
+ 134 00e8 4156     		pushq	%r14
+ 135 00ea 4155     		pushq	%r13
+ 136 00ec 4154     		pushq	%r12
+ 137 00ee 53       		pushq	%rbx
+ 138 00ef 4883E4E0 		andq	$-32, %rsp
+ 139 00f3 4881ECA8 		subq	$168, %rsp
+ 139      000000
+ 140              		.cfi_offset 15, -24
+ 141              		.cfi_offset 14, -32
+ 142              		.cfi_offset 13, -40
+ 143              		.cfi_offset 12, -48
+ 144              		.cfi_offset 3, -56
+ 145 00fa 83FA06   		cmpl	$6, %edx
+ 146 00fd 0F849503 		je	.L28
+ 146      0000
+ 147 0103 0F8F6B01 		jg	.L29
+ 147      0000
+ 148 0109 83FA02   		cmpl	$2, %edx
+ 149 010c 0F841F03 		je	.L30
+ 149      0000
+ 150 0112 83FA04   		cmpl	$4, %edx
+ 151 0115 0F850603 		jne	.L69
+ 151      0000
+ 152 011b 83F907   		cmpl	$7, %ecx
+ 153 011e 0F8E0503 		jle	.L53
+ 153      0000
+ 154 0124 8D51F8   		leal	-8(%rcx), %edx
+ 155 0127 4C63D9   		movslq	%ecx, %r11
+ 156 012a 4989F2   		movq	%rsi, %r10
+ 157 012d 4989FC   		movq	%rdi, %r12
+ 158 0130 4189D5   		movl	%edx, %r13d
+ 159 0133 49C1E302 		salq	$2, %r11
+ 160 0137 4531F6   		xorl	%r14d, %r14d
+ 161 013a 488D7424 		leaq	-88(%rsp), %rsi
+ 161      A8
+ 162 013f 4183E5F8 		andl	$-8, %r13d
+ 163 0143 488D5C24 		leaq	40(%rsp), %rbx
+ 163      28
+ 164 0148 4183C508 		addl	$8, %r13d
+ 165 014c 0F1F4000 		.p2align 4,,10
+ 166              		.p2align 3
+ 167              	.L40:
+ 168 0150 C4C17C10 		vmovups	32(%r10), %ymm4
+ 168      6220
+ 169 0156 C4C17C10 		vmovups	(%r10), %ymm3
+ 169      1A
+ 170 015b 4889F1   		movq	%rsi, %rcx
+ 171 015e 4D89E7   		movq	%r12, %r15
+ 172 0161 62D35D28 		vshuff32x4	$3, 96(%r10), %ymm4, %ymm2
+ 172      23520303 
+ 173 0169 62D36528 		vshuff32x4	$0, 64(%r10), %ymm3, %ymm0
+ 173      23420200 
+ 174 0171 62D35D28 		vshuff32x4	$0, 96(%r10), %ymm4, %ymm1
+ 174      234A0300 
+ 175 0179 62D36528 		vshuff32x4	$3, 64(%r10), %ymm3, %ymm3
+ 175      235A0203 
+ 176 0181 C5FC14E3 		vunpcklps	%ymm3, %ymm0, %ymm4
+ 177 0185 C5FC15C3 		vunpckhps	%ymm3, %ymm0, %ymm0
+ 178 0189 C5F414DA 		vunpcklps	%ymm2, %ymm1, %ymm3
+ 179 018d C5F415CA 		vunpckhps	%ymm2, %ymm1, %ymm1
+ 180 0191 C5DCC6D3 		vshufps	$68, %ymm3, %ymm4, %ymm2
+ 180      44
+ 181 0196 C5DCC6E3 		vshufps	$238, %ymm3, %ymm4, %ymm4
+ 181      EE
+ 182 019b C5FC2954 		vmovaps	%ymm2, -88(%rsp)
+ 182      24A8
+ 183 01a1 C5FC2964 		vmovaps	%ymm4, -56(%rsp)
+ 183      24C8
+ 184 01a7 C5FCC6D1 		vshufps	$68, %ymm1, %ymm0, %ymm2
+ 184      44
+ 185 01ac C5FCC6C1 		vshufps	$238, %ymm1, %ymm0, %ymm0
+ 185      EE
+ 186 01b1 C5FC2954 		vmovaps	%ymm2, -24(%rsp)
+ 186      24E8
+ 187 01b7 C5FC2944 		vmovaps	%ymm0, 8(%rsp)
+ 187      2408
+ 188              	.L39:
+ 189 01bd C5FC2839 		vmovaps	(%rcx), %ymm7
+ 190 01c1 4883C120 		addq	$32, %rcx
+ 191 01c5 C4C17C11 		vmovups	%ymm7, (%r15)
+ 191      3F
+ 192 01ca 4D01DF   		addq	%r11, %r15
+ 193 01cd 4839CB   		cmpq	%rcx, %rbx
+ 194 01d0 75EB     		jne	.L39
+ 195 01d2 4183C608 		addl	$8, %r14d
+ 196 01d6 4983EA80 		subq	$-128, %r10
+ 197 01da 4983C420 		addq	$32, %r12
+ 198 01de 4539F5   		cmpl	%r14d, %r13d
+ 199 01e1 0F8569FF 		jne	.L40
+ 199      FFFF
+ 200 01e7 C1EA03   		shrl	$3, %edx
+ 201 01ea 448D24D5 		leal	8(,%rdx,8), %r12d
+ 201      08000000 
+ 202 01f2 C5F877   		vzeroupper
+ 203              		.p2align 4,,10
+ 204 01f5 0F1F00   		.p2align 3
+ 205              	.L33:
+ 206 01f8 4489C2   		movl	%r8d, %edx
+ 207 01fb 4589CD   		movl	%r9d, %r13d
+ 208 01fe 4963F0   		movslq	%r8d, %rsi
+ 209 0201 4D63F4   		movslq	%r12d, %r14
+ 210 0204 410FAFD4 		imull	%r12d, %edx
+ 211 0208 4529E5   		subl	%r12d, %r13d
+ 212 020b 48C1E602 		salq	$2, %rsi
+ 213 020f 4531DB   		xorl	%r11d, %r11d
+ 214 0212 4531D2   		xorl	%r10d, %r10d
+ 215 0215 4D01F5   		addq	%r14, %r13
+ 216 0218 4863D2   		movslq	%edx, %rdx
+ 217 021b 488D1C90 		leaq	(%rax,%rdx,4), %rbx
+ 218 021f 90       		.p2align 4,,10
+ 219              		.p2align 3
+ 220              	.L46:
+ 221 0220 4539E1   		cmpl	%r12d, %r9d
+ 222 0223 7E30     		jle	.L49
+ 223 0225 4963D3   		movslq	%r11d, %rdx
+ 224 0228 4A8D0432 		leaq	(%rdx,%r14), %rax
+ 225 022c 4C01EA   		addq	%r13, %rdx
+ 226 022f 488D0C97 		leaq	(%rdi,%rdx,4), %rcx
+ 227 0233 488D0487 		leaq	(%rdi,%rax,4), %rax
+ 228 0237 4889DA   		movq	%rbx, %rdx
+ 229 023a 660F1F44 		.p2align 4,,10
+ 229      0000
+ 230              		.p2align 3
+ 231              	.L47:
+ 232 0240 C5FA1002 		vmovss	(%rdx), %xmm0
+ 233 0244 4883C004 		addq	$4, %rax
+ 234 0248 4801F2   		addq	%rsi, %rdx
+ 235 024b C5FA1140 		vmovss	%xmm0, -4(%rax)
+ 235      FC
+ 236 0250 4839C1   		cmpq	%rax, %rcx
+ 237 0253 75EB     		jne	.L47
+ 238              	.L49:
+ 239 0255 4183C201 		addl	$1, %r10d
+ 240 0259 4883C304 		addq	$4, %rbx
+ 241 025d 4501CB   		addl	%r9d, %r11d
+ 242 0260 4539D0   		cmpl	%r10d, %r8d
+ 243 0263 7FBB     		jg	.L46
+ 244              	.L65:
+ 245 0265 488D65D8 		leaq	-40(%rbp), %rsp
+ 246 0269 5B       		popq	%rbx
+ 247 026a 415C     		popq	%r12
+ 248 026c 415D     		popq	%r13
+ 249 026e 415E     		popq	%r14
+ 250 0270 415F     		popq	%r15
+ 251 0272 5D       		popq	%rbp
+ 252              		.cfi_remember_state
+ 253              		.cfi_def_cfa 7, 8
+ 254 0273 C3       		ret
+ 255              	.L29:
+ 256              		.cfi_restore_state
+ 257 0274 4531E4   		xorl	%r12d, %r12d
+ 258 0277 83FA08   		cmpl	$8, %edx
+ 259 027a 0F8578FF 		jne	.L33
+ 259      FFFF
+ 260 0280 83F907   		cmpl	$7, %ecx
+ 261 0283 0F8E6FFF 		jle	.L33
+ 261      FFFF
+ 262 0289 448D69F8 		leal	-8(%rcx), %r13d
+ 263 028d 4863C9   		movslq	%ecx, %rcx
+ 264 0290 4989F3   		movq	%rsi, %r11
+ 265 0293 4889FB   		movq	%rdi, %rbx
+ 266 0296 4589EC   		movl	%r13d, %r12d
+ 267 0299 48C1E102 		salq	$2, %rcx
+ 268 029d 4531F6   		xorl	%r14d, %r14d
+ 269 02a0 488D7424 		leaq	-88(%rsp), %rsi
+ 269      A8
+ 270 02a5 4183E4F8 		andl	$-8, %r12d
+ 271 02a9 4C8D9424 		leaq	168(%rsp), %r10
+ 271      A8000000 
+ 272 02b1 4183C408 		addl	$8, %r12d
+ 273              		.p2align 4,,10
+ 274 02b5 0F1F00   		.p2align 3
+ 275              	.L34:
+ 276 02b8 62D1FE48 		vmovdqu64	(%r11), %zmm2
+ 276      6F13
+ 277 02be 4889F2   		movq	%rsi, %rdx
+ 278 02c1 4989DF   		movq	%rbx, %r15
+ 279 02c4 62F1FE48 		vmovdqu64	%zmm2, (%rsi)
+ 279      7F16
+ 280 02ca 62D1FE48 		vmovdqu64	64(%r11), %zmm6
+ 280      6F7301
+ 281 02d1 62F1FE48 		vmovdqu64	%zmm6, 64(%rsi)
+ 281      7F7601
+ 282 02d8 62D1FE48 		vmovdqu64	128(%r11), %zmm7
+ 282      6F7B02
+ 283 02df 62F1FE48 		vmovdqu64	%zmm7, 128(%rsi)
+ 283      7F7E02
+ 284 02e6 62D1FE48 		vmovdqu64	192(%r11), %zmm1
+ 284      6F4B03
+ 285 02ed 62F1FE48 		vmovdqu64	%zmm1, 192(%rsi)
+ 285      7F4E03
+ 286 02f4 C5FC2864 		vmovaps	-88(%rsp), %ymm4
+ 286      24A8
+ 287 02fa C5DC1454 		vunpcklps	-56(%rsp), %ymm4, %ymm2
+ 287      24C8
+ 288 0300 C5DC1544 		vunpckhps	-56(%rsp), %ymm4, %ymm0
+ 288      24C8
+ 289 0306 C5FC287C 		vmovaps	-24(%rsp), %ymm7
+ 289      24E8
+ 290 030c C5FC2864 		vmovaps	40(%rsp), %ymm4
+ 290      2428
+ 291 0312 C5C4156C 		vunpckhps	8(%rsp), %ymm7, %ymm5
+ 291      2408
+ 292 0318 C5C41474 		vunpcklps	8(%rsp), %ymm7, %ymm6
+ 292      2408
+ 293 031e C5DC145C 		vunpcklps	72(%rsp), %ymm4, %ymm3
+ 293      2448
+ 294 0324 C5DC154C 		vunpckhps	72(%rsp), %ymm4, %ymm1
+ 294      2448
+ 295 032a C5FC2864 		vmovaps	104(%rsp), %ymm4
+ 295      2468
+ 296 0330 C55C148C 		vunpcklps	136(%rsp), %ymm4, %ymm9
+ 296      24880000 
+ 296      00
+ 297 0339 C5ECC6FE 		vshufps	$68, %ymm6, %ymm2, %ymm7
+ 297      44
+ 298 033e C5DC15A4 		vunpckhps	136(%rsp), %ymm4, %ymm4
+ 298      24880000 
+ 298      00
+ 299 0347 C5ECC6D6 		vshufps	$238, %ymm6, %ymm2, %ymm2
+ 299      EE
+ 300 034c C5FCC6F5 		vshufps	$68, %ymm5, %ymm0, %ymm6
+ 300      44
+ 301 0351 C5FCC6C5 		vshufps	$238, %ymm5, %ymm0, %ymm0
+ 301      EE
+ 302 0356 C44164C6 		vshufps	$68, %ymm9, %ymm3, %ymm8
+ 302      C144
+ 303 035c C5F4C6EC 		vshufps	$68, %ymm4, %ymm1, %ymm5
+ 303      44
+ 304 0361 C5F4C6CC 		vshufps	$238, %ymm4, %ymm1, %ymm1
+ 304      EE
+ 305 0366 62D34528 		vshuff32x4	$0, %ymm8, %ymm7, %ymm4
+ 305      23E000
+ 306 036d C4C164C6 		vshufps	$238, %ymm9, %ymm3, %ymm3
+ 306      D9EE
+ 307 0373 C5FC2964 		vmovaps	%ymm4, -88(%rsp)
+ 307      24A8
+ 308 0379 62F36D28 		vshuff32x4	$0, %ymm3, %ymm2, %ymm4
+ 308      23E300
+ 309 0380 62D34528 		vshuff32x4	$3, %ymm8, %ymm7, %ymm7
+ 309      23F803
+ 310 0387 C5FC2964 		vmovaps	%ymm4, -56(%rsp)
+ 310      24C8
+ 311 038d 62F34D28 		vshuff32x4	$0, %ymm5, %ymm6, %ymm4
+ 311      23E500
+ 312 0394 62F36D28 		vshuff32x4	$3, %ymm3, %ymm2, %ymm2
+ 312      23D303
+ 313 039b 62F34D28 		vshuff32x4	$3, %ymm5, %ymm6, %ymm6
+ 313      23F503
+ 314 03a2 C5FC2964 		vmovaps	%ymm4, -24(%rsp)
+ 314      24E8
+ 315 03a8 62F37D28 		vshuff32x4	$0, %ymm1, %ymm0, %ymm4
+ 315      23E100
+ 316 03af 62F37D28 		vshuff32x4	$3, %ymm1, %ymm0, %ymm0
+ 316      23C103
+ 317 03b6 C5FC2964 		vmovaps	%ymm4, 8(%rsp)
+ 317      2408
+ 318 03bc C5FC297C 		vmovaps	%ymm7, 40(%rsp)
+ 318      2428
+ 319 03c2 C5FC2954 		vmovaps	%ymm2, 72(%rsp)
+ 319      2448
+ 320 03c8 C5FC2974 		vmovaps	%ymm6, 104(%rsp)
+ 320      2468
+ 321 03ce C5FC2984 		vmovaps	%ymm0, 136(%rsp)
+ 321      24880000 
+ 321      00
+ 322 03d7 660F1F84 		.p2align 4,,10
+ 322      00000000 
+ 322      00
+ 323              		.p2align 3
+ 324              	.L44:
+ 325 03e0 C5FC282A 		vmovaps	(%rdx), %ymm5
+ 326 03e4 4883C220 		addq	$32, %rdx
+ 327 03e8 C4C17C11 		vmovups	%ymm5, (%r15)
+ 327      2F
+ 328 03ed 4901CF   		addq	%rcx, %r15
+ 329 03f0 4C39D2   		cmpq	%r10, %rdx
+ 330 03f3 75EB     		jne	.L44
+ 331 03f5 4183C608 		addl	$8, %r14d
+ 332 03f9 4981C300 		addq	$256, %r11
+ 332      010000
+ 333 0400 4883C320 		addq	$32, %rbx
+ 334 0404 4539E6   		cmpl	%r12d, %r14d
+ 335 0407 0F85ABFE 		jne	.L34
+ 335      FFFF
+ 336 040d 41C1ED03 		shrl	$3, %r13d
+ 337 0411 468D24ED 		leal	8(,%r13,8), %r12d
+ 337      08000000 
+ 338 0419 C5F877   		vzeroupper
+ 339 041c E9D7FDFF 		jmp	.L33
+ 339      FF
+ 340              	.L69:
+ 341 0421 85D2     		testl	%edx, %edx
+ 342 0423 0F8E3CFE 		jle	.L65
+ 342      FFFF
+ 343              	.L53:
+ 344 0429 4531E4   		xorl	%r12d, %r12d
+ 345 042c E9C7FDFF 		jmp	.L33
+ 345      FF
+ 346              	.L30:
+ 347 0431 83F907   		cmpl	$7, %ecx
+ 348 0434 7EF3     		jle	.L53
+ 349 0436 448D61F8 		leal	-8(%rcx), %r12d
+ 350 043a 4963D1   		movslq	%r9d, %rdx
+ 351 043d 41C1EC03 		shrl	$3, %r12d
+ 352 0441 488D3497 		leaq	(%rdi,%rdx,4), %rsi
+ 353 0445 31D2     		xorl	%edx, %edx
+ 354 0447 418D4C24 		leal	1(%r12), %ecx
+ 354      01
+ 355 044c 4989CC   		movq	%rcx, %r12
+ 356 044f 48C1E105 		salq	$5, %rcx
+ 357              		.p2align 4,,10
+ 358 0453 0F1F4400 		.p2align 3
+ 358      00
+ 359              	.L37:
+ 360 0458 C5FC101C 		vmovups	(%rax,%rdx,2), %ymm3
+ 360      50
+ 361 045d 62F36528 		vshuff32x4	$0, 32(%rax,%rdx,2), %ymm3, %ymm1
+ 361      234C5001 
+ 361      00
+ 362 0466 62F36528 		vshuff32x4	$3, 32(%rax,%rdx,2), %ymm3, %ymm0
+ 362      23445001 
+ 362      03
+ 363 046f C5F4C6D0 		vshufps	$136, %ymm0, %ymm1, %ymm2
+ 363      88
+ 364 0474 C5F4C6C8 		vshufps	$221, %ymm0, %ymm1, %ymm1
+ 364      DD
+ 365 0479 C5FC1114 		vmovups	%ymm2, (%rdi,%rdx)
+ 365      17
+ 366 047e C5FC110C 		vmovups	%ymm1, (%rsi,%rdx)
+ 366      16
+ 367 0483 4883C220 		addq	$32, %rdx
+ 368 0487 4839D1   		cmpq	%rdx, %rcx
+ 369 048a 75CC     		jne	.L37
+ 370 048c 41C1E403 		sall	$3, %r12d
+ 371 0490 C5F877   		vzeroupper
+ 372 0493 E960FDFF 		jmp	.L33
+ 372      FF
+ 373              	.L28:
+ 374 0498 83F907   		cmpl	$7, %ecx
+ 375 049b 7E8C     		jle	.L53
+ 376 049d 8D49F8   		leal	-8(%rcx), %ecx
+ 377 04a0 4D63D1   		movslq	%r9d, %r10
+ 378 04a3 895424A4 		movl	%edx, -92(%rsp)
+ 379 04a7 4531DB   		xorl	%r11d, %r11d
+ 380 04aa 4189CD   		movl	%ecx, %r13d
+ 381 04ad 49C1E202 		salq	$2, %r10
+ 382 04b1 488D7424 		leaq	-88(%rsp), %rsi
+ 382      A8
+ 383 04b6 4989FC   		movq	%rdi, %r12
+ 384 04b9 4183E5F8 		andl	$-8, %r13d
+ 385 04bd 44894C24 		movl	%r9d, -96(%rsp)
+ 385      A0
+ 386 04c2 4989F8   		movq	%rdi, %r8
+ 387 04c5 4489DB   		movl	%r11d, %ebx
+ 388 04c8 4183C508 		addl	$8, %r13d
+ 389 04cc 89CF     		movl	%ecx, %edi
+ 390 04ce 4989C1   		movq	%rax, %r9
+ 391 04d1 4D89D3   		movq	%r10, %r11
+ 392 04d4 4489E9   		movl	%r13d, %ecx
+ 393 04d7 4C8DB424 		leaq	168(%rsp), %r14
+ 393      A8000000 
+ 394 04df 4C8D7C24 		leaq	104(%rsp), %r15
+ 394      68
+ 395 04e4 4989C5   		movq	%rax, %r13
+ 396 04e7 C5FD6F0D 		vmovdqa	.LC0(%rip), %ymm1
+ 396      00000000 
+ 397 04ef 4889F0   		movq	%rsi, %rax
+ 398              		.p2align 4,,10
+ 399 04f2 660F1F44 		.p2align 3
+ 399      0000
+ 400              	.L35:
+ 401 04f8 4989C2   		movq	%rax, %r10
+ 402 04fb 4889C2   		movq	%rax, %rdx
+ 403 04fe 4C89EE   		movq	%r13, %rsi
+ 404              		.p2align 4,,10
+ 405 0501 0F1F8000 		.p2align 3
+ 405      000000
+ 406              	.L42:
+ 407 0508 C4E2752C 		vmaskmovps	(%rsi), %ymm1, %ymm0
+ 407      06
+ 408 050d 4883C220 		addq	$32, %rdx
+ 409 0511 C5FC2942 		vmovaps	%ymm0, -32(%rdx)
+ 409      E0
+ 410 0516 4883C618 		addq	$24, %rsi
+ 411 051a 4C39F2   		cmpq	%r14, %rdx
+ 412 051d 75E9     		jne	.L42
+ 413 051f C5FC285C 		vmovaps	-88(%rsp), %ymm3
+ 413      24A8
+ 414 0525 C5FC2864 		vmovaps	-24(%rsp), %ymm4
+ 414      24E8
+ 415 052b 4C89E2   		movq	%r12, %rdx
+ 416 052e C5DC147C 		vunpcklps	8(%rsp), %ymm4, %ymm7
+ 416      2408
+ 417 0534 C5E41454 		vunpcklps	-56(%rsp), %ymm3, %ymm2
+ 417      24C8
+ 418 053a C5E41544 		vunpckhps	-56(%rsp), %ymm3, %ymm0
+ 418      24C8
+ 419 0540 C5DC1574 		vunpckhps	8(%rsp), %ymm4, %ymm6
+ 419      2408
+ 420 0546 C5FC286C 		vmovaps	40(%rsp), %ymm5
+ 420      2428
+ 421 054c C5D41464 		vunpcklps	72(%rsp), %ymm5, %ymm4
+ 421      2448
+ 422 0552 C56CC6C7 		vshufps	$68, %ymm7, %ymm2, %ymm8
+ 422      44
+ 423 0557 C5ECC6D7 		vshufps	$238, %ymm7, %ymm2, %ymm2
+ 423      EE
+ 424 055c C5D4155C 		vunpckhps	72(%rsp), %ymm5, %ymm3
+ 424      2448
+ 425 0562 C5FC286C 		vmovaps	104(%rsp), %ymm5
+ 425      2468
+ 426 0568 C5FCC6FE 		vshufps	$68, %ymm6, %ymm0, %ymm7
+ 426      44
+ 427 056d C5FCC6C6 		vshufps	$238, %ymm6, %ymm0, %ymm0
+ 427      EE
+ 428 0572 C554148C 		vunpcklps	136(%rsp), %ymm5, %ymm9
+ 428      24880000 
+ 428      00
+ 429 057b C5D415AC 		vunpckhps	136(%rsp), %ymm5, %ymm5
+ 429      24880000 
+ 429      00
+ 430 0584 C4415CC6 		vshufps	$68, %ymm9, %ymm4, %ymm10
+ 430      D144
+ 431 058a 62533D28 		vshuff32x4	$0, %ymm10, %ymm8, %ymm11
+ 431      23DA00
+ 432 0591 C4C15CC6 		vshufps	$238, %ymm9, %ymm4, %ymm4
+ 432      E1EE
+ 433 0597 62533D28 		vshuff32x4	$3, %ymm10, %ymm8, %ymm8
+ 433      23C203
+ 434 059e C57C295C 		vmovaps	%ymm11, -88(%rsp)
+ 434      24A8
+ 435 05a4 62736D28 		vshuff32x4	$0, %ymm4, %ymm2, %ymm11
+ 435      23DC00
+ 436 05ab C564C6CD 		vshufps	$68, %ymm5, %ymm3, %ymm9
+ 436      44
+ 437 05b0 62F36D28 		vshuff32x4	$3, %ymm4, %ymm2, %ymm2
+ 437      23D403
+ 438 05b7 C57C295C 		vmovaps	%ymm11, -56(%rsp)
+ 438      24C8
+ 439 05bd C5E4C6DD 		vshufps	$238, %ymm5, %ymm3, %ymm3
+ 439      EE
+ 440 05c2 62534528 		vshuff32x4	$0, %ymm9, %ymm7, %ymm11
+ 440      23D900
+ 441 05c9 62F37D28 		vshuff32x4	$0, %ymm3, %ymm0, %ymm0
+ 441      23C300
+ 442 05d0 62D34528 		vshuff32x4	$3, %ymm9, %ymm7, %ymm7
+ 442      23F903
+ 443 05d7 C57C295C 		vmovaps	%ymm11, -24(%rsp)
+ 443      24E8
+ 444 05dd C5FC2944 		vmovaps	%ymm0, 8(%rsp)
+ 444      2408
+ 445 05e3 C57C2944 		vmovaps	%ymm8, 40(%rsp)
+ 445      2428
+ 446 05e9 C5FC2954 		vmovaps	%ymm2, 72(%rsp)
+ 446      2448
+ 447 05ef C5FC297C 		vmovaps	%ymm7, 104(%rsp)
+ 447      2468
+ 448              		.p2align 4,,10
+ 449 05f5 0F1F00   		.p2align 3
+ 450              	.L43:
+ 451 05f8 C4C17C28 		vmovaps	(%r10), %ymm6
+ 451      32
+ 452 05fd 4983C220 		addq	$32, %r10
+ 453 0601 C5FC1132 		vmovups	%ymm6, (%rdx)
+ 454 0605 4C01DA   		addq	%r11, %rdx
+ 455 0608 4D39FA   		cmpq	%r15, %r10
+ 456 060b 75EB     		jne	.L43
+ 457 060d 83C308   		addl	$8, %ebx
+ 458 0610 4983C420 		addq	$32, %r12
+ 459 0614 4981C5C0 		addq	$192, %r13
+ 459      000000
+ 460 061b 39CB     		cmpl	%ecx, %ebx
+ 461 061d 0F85D5FE 		jne	.L35
+ 461      FFFF
+ 462 0623 89F9     		movl	%edi, %ecx
+ 463 0625 4C89C8   		movq	%r9, %rax
+ 464 0628 4C89C7   		movq	%r8, %rdi
+ 465 062b 448B4C24 		movl	-96(%rsp), %r9d
+ 465      A0
+ 466 0630 C1E903   		shrl	$3, %ecx
+ 467 0633 448B4424 		movl	-92(%rsp), %r8d
+ 467      A4
+ 468 0638 448D24CD 		leal	8(,%rcx,8), %r12d
+ 468      08000000 
+ 469 0640 C5F877   		vzeroupper
+ 470 0643 E9B0FBFF 		jmp	.L33
+ 470      FF
+ 471              	.L68:
+ 472              		.cfi_def_cfa 7, 8
+ 473              		.cfi_restore 3
+ 474              		.cfi_restore 6
+ 475              		.cfi_restore 12
+ 476              		.cfi_restore 13
+ 477              		.cfi_restore 14
+ 478              		.cfi_restore 15
+ 479 0648 4863D1   		movslq	%ecx, %rdx
+ 480 064b 48C1E202 		salq	$2, %rdx
+ 481 064f E9000000 		jmp	memcpy@PLT
+ 481      00
+ 482              		.cfi_endproc
+ 483              	.LFE6400:
+ 485 0654 66662E0F 		.p2align 4
+ 485      1F840000 
+ 485      00000090 
+ 486              		.globl	interleave
+ 488              	interleave:
+ 489              	.LFB6401:
+ 490              		.cfi_startproc
+ 491 0660 4889F8   		movq	%rdi, %rax
+ 492 0663 4189C9   		movl	%ecx, %r9d
+ 493 0666 4889F7   		movq	%rsi, %rdi
+ 494 0669 83FA01   		cmpl	$1, %edx
+ 495 066c 0F848205 		je	.L112
+ 495      0000
+ 496 0672 55       		pushq	%rbp
+ 497              		.cfi_def_cfa_offset 16
+ 498              		.cfi_offset 6, -16
+ 499 0673 4189D0   		movl	%edx, %r8d
+ 500 0676 4889E5   		movq	%rsp, %rbp
+ 501              		.cfi_def_cfa_register 6
+ 502 0679 4157     		pushq	%r15
+ 503 067b 4156     		pushq	%r14
+ 504 067d 4155     		pushq	%r13
+ 505 067f 4154     		pushq	%r12
+ 506 0681 53       		pushq	%rbx
+ 507 0682 4883E4E0 		andq	$-32, %rsp
+ 508 0686 4881ECA8 		subq	$168, %rsp
+ 508      000000
+ 509              		.cfi_offset 15, -24
+ 510              		.cfi_offset 14, -32
+ 511              		.cfi_offset 13, -40
+ 512              		.cfi_offset 12, -48
+ 513              		.cfi_offset 3, -56
+ 514 068d 83FA06   		cmpl	$6, %edx
+ 515 0690 0F84A703 		je	.L72
+ 515      0000
+ 516 0696 0F8F7701 		jg	.L73
+ 516      0000
+ 517 069c 83FA02   		cmpl	$2, %edx
+ 518 069f 0F843303 		je	.L74
+ 518      0000
+ 519 06a5 83FA04   		cmpl	$4, %edx
+ 520 06a8 0F851A03 		jne	.L113
+ 520      0000
+ 521 06ae 83F907   		cmpl	$7, %ecx
+ 522 06b1 0F8E1903 		jle	.L97
+ 522      0000
+ 523 06b7 8D51F8   		leal	-8(%rcx), %edx
+ 524 06ba 4C63D9   		movslq	%ecx, %r11
+ 525 06bd 4989C2   		movq	%rax, %r10
+ 526 06c0 4989F4   		movq	%rsi, %r12
+ 527 06c3 4189D5   		movl	%edx, %r13d
+ 528 06c6 49C1E302 		salq	$2, %r11
+ 529 06ca 4531F6   		xorl	%r14d, %r14d
+ 530 06cd 488D4C24 		leaq	-88(%rsp), %rcx
+ 530      A8
+ 531 06d2 4183E5F8 		andl	$-8, %r13d
+ 532 06d6 488D5C24 		leaq	40(%rsp), %rbx
+ 532      28
+ 533 06db 4183C508 		addl	$8, %r13d
+ 534 06df 90       		.p2align 4,,10
+ 535              		.p2align 3
+ 536              	.L84:
+ 537 06e0 4889CE   		movq	%rcx, %rsi
+ 538 06e3 4D89E7   		movq	%r12, %r15
+ 539              	.L83:
+ 540 06e6 C4C17C10 		vmovups	(%r15), %ymm4
+ 540      27
+ 541 06eb 4883C620 		addq	$32, %rsi
+ 542 06ef 4D01DF   		addq	%r11, %r15
+ 543 06f2 C5FC2966 		vmovaps	%ymm4, -32(%rsi)
+ 543      E0
+ 544 06f7 4839DE   		cmpq	%rbx, %rsi
+ 545 06fa 75EA     		jne	.L83
+ 546 06fc C5FC2864 		vmovaps	-88(%rsp), %ymm4
+ 546      24A8
+ 547 0702 4183C608 		addl	$8, %r14d
+ 548 0706 4983EA80 		subq	$-128, %r10
+ 549 070a 4983C420 		addq	$32, %r12
+ 550 070e C5DC1544 		vunpckhps	-56(%rsp), %ymm4, %ymm0
+ 550      24C8
+ 551 0714 C5FC2854 		vmovaps	-24(%rsp), %ymm2
+ 551      24E8
+ 552 071a C5FC284C 		vmovaps	-88(%rsp), %ymm1
+ 552      24A8
+ 553 0720 C5EC145C 		vunpcklps	8(%rsp), %ymm2, %ymm3
+ 553      2408
+ 554 0726 C5F4144C 		vunpcklps	-56(%rsp), %ymm1, %ymm1
+ 554      24C8
+ 555 072c C5EC1554 		vunpckhps	8(%rsp), %ymm2, %ymm2
+ 555      2408
+ 556 0732 C5F4C6E3 		vshufps	$68, %ymm3, %ymm1, %ymm4
+ 556      44
+ 557 0737 C5F4C6CB 		vshufps	$238, %ymm3, %ymm1, %ymm1
+ 557      EE
+ 558 073c C5FCC6DA 		vshufps	$68, %ymm2, %ymm0, %ymm3
+ 558      44
+ 559 0741 C5FCC6C2 		vshufps	$238, %ymm2, %ymm0, %ymm0
+ 559      EE
+ 560 0746 62F35D28 		vshuff32x4	$0, %ymm1, %ymm4, %ymm2
+ 560      23D100
+ 561 074d 62F35D28 		vshuff32x4	$3, %ymm1, %ymm4, %ymm4
+ 561      23E103
+ 562 0754 C4C17C11 		vmovups	%ymm2, -128(%r10)
+ 562      5280
+ 563 075a 62F36528 		vshuff32x4	$0, %ymm0, %ymm3, %ymm2
+ 563      23D000
+ 564 0761 62F36528 		vshuff32x4	$3, %ymm0, %ymm3, %ymm3
+ 564      23D803
+ 565 0768 C4C17C11 		vmovups	%ymm2, -96(%r10)
+ 565      52A0
+ 566 076e C4C17C11 		vmovups	%ymm4, -64(%r10)
+ 566      62C0
+ 567 0774 C4C17C11 		vmovups	%ymm3, -32(%r10)
+ 567      5AE0
+ 568 077a 4539EE   		cmpl	%r13d, %r14d
+ 569 077d 0F855DFF 		jne	.L84
+ 569      FFFF
+ 570 0783 C1EA03   		shrl	$3, %edx
+ 571 0786 448D24D5 		leal	8(,%rdx,8), %r12d
+ 571      08000000 
+ 572 078e C5F877   		vzeroupper
+ 573              		.p2align 4,,10
+ 574 0791 0F1F8000 		.p2align 3
+ 574      000000
+ 575              	.L77:
+ 576 0798 4489C2   		movl	%r8d, %edx
+ 577 079b 4589CD   		movl	%r9d, %r13d
+ 578 079e 4963F0   		movslq	%r8d, %rsi
+ 579 07a1 4D63F4   		movslq	%r12d, %r14
+ 580 07a4 410FAFD4 		imull	%r12d, %edx
+ 581 07a8 4529E5   		subl	%r12d, %r13d
+ 582 07ab 48C1E602 		salq	$2, %rsi
+ 583 07af 4531DB   		xorl	%r11d, %r11d
+ 584 07b2 4531D2   		xorl	%r10d, %r10d
+ 585 07b5 4D01F5   		addq	%r14, %r13
+ 586 07b8 4863D2   		movslq	%edx, %rdx
+ 587 07bb 488D1C90 		leaq	(%rax,%rdx,4), %rbx
+ 588 07bf 90       		.p2align 4,,10
+ 589              		.p2align 3
+ 590              	.L90:
+ 591 07c0 4539E1   		cmpl	%r12d, %r9d
+ 592 07c3 7E2F     		jle	.L93
+ 593 07c5 4963D3   		movslq	%r11d, %rdx
+ 594 07c8 4A8D0432 		leaq	(%rdx,%r14), %rax
+ 595 07cc 4C01EA   		addq	%r13, %rdx
+ 596 07cf 488D0C97 		leaq	(%rdi,%rdx,4), %rcx
+ 597 07d3 488D0487 		leaq	(%rdi,%rax,4), %rax
+ 598 07d7 4889DA   		movq	%rbx, %rdx
+ 599 07da 660F1F44 		.p2align 4,,10
+ 599      0000
+ 600              		.p2align 3
+ 601              	.L91:
+ 602 07e0 C5FA1000 		vmovss	(%rax), %xmm0
+ 603 07e4 4883C004 		addq	$4, %rax
+ 604 07e8 C5FA1102 		vmovss	%xmm0, (%rdx)
+ 605 07ec 4801F2   		addq	%rsi, %rdx
+ 606 07ef 4839C8   		cmpq	%rcx, %rax
+ 607 07f2 75EC     		jne	.L91
+ 608              	.L93:
+ 609 07f4 4183C201 		addl	$1, %r10d
+ 610 07f8 4883C304 		addq	$4, %rbx
+ 611 07fc 4501CB   		addl	%r9d, %r11d
+ 612 07ff 4539D0   		cmpl	%r10d, %r8d
+ 613 0802 7FBC     		jg	.L90
+ 614              	.L109:
+ 615 0804 488D65D8 		leaq	-40(%rbp), %rsp
+ 616 0808 5B       		popq	%rbx
+ 617 0809 415C     		popq	%r12
+ 618 080b 415D     		popq	%r13
+ 619 080d 415E     		popq	%r14
+ 620 080f 415F     		popq	%r15
+ 621 0811 5D       		popq	%rbp
+ 622              		.cfi_remember_state
+ 623              		.cfi_def_cfa 7, 8
+ 624 0812 C3       		ret
+ 625              	.L73:
+ 626              		.cfi_restore_state
+ 627 0813 4531E4   		xorl	%r12d, %r12d
+ 628 0816 83FA08   		cmpl	$8, %edx
+ 629 0819 0F8579FF 		jne	.L77
+ 629      FFFF
+ 630 081f 83F907   		cmpl	$7, %ecx
+ 631 0822 0F8E70FF 		jle	.L77
+ 631      FFFF
+ 632 0828 448D69F8 		leal	-8(%rcx), %r13d
+ 633 082c 4889F3   		movq	%rsi, %rbx
+ 634 082f 4863F1   		movslq	%ecx, %rsi
+ 635 0832 4989C3   		movq	%rax, %r11
+ 636 0835 4589EC   		movl	%r13d, %r12d
+ 637 0838 48C1E602 		salq	$2, %rsi
+ 638 083c 4531F6   		xorl	%r14d, %r14d
+ 639 083f 488D4C24 		leaq	-88(%rsp), %rcx
+ 639      A8
+ 640 0844 4183E4F8 		andl	$-8, %r12d
+ 641 0848 4C8D9424 		leaq	168(%rsp), %r10
+ 641      A8000000 
+ 642 0850 4183C408 		addl	$8, %r12d
+ 643              		.p2align 4,,10
+ 644 0854 0F1F4000 		.p2align 3
+ 645              	.L78:
+ 646 0858 4889CA   		movq	%rcx, %rdx
+ 647 085b 4989DF   		movq	%rbx, %r15
+ 648 085e 6690     		.p2align 4,,10
+ 649              		.p2align 3
+ 650              	.L88:
+ 651 0860 C4C17C10 		vmovups	(%r15), %ymm7
+ 651      3F
+ 652 0865 4883C220 		addq	$32, %rdx
+ 653 0869 4901F7   		addq	%rsi, %r15
+ 654 086c C5FC297A 		vmovaps	%ymm7, -32(%rdx)
+ 654      E0
+ 655 0871 4C39D2   		cmpq	%r10, %rdx
+ 656 0874 75EA     		jne	.L88
+ 657 0876 C5FC285C 		vmovaps	-88(%rsp), %ymm3
+ 657      24A8
+ 658 087c C5FC287C 		vmovaps	-24(%rsp), %ymm7
+ 658      24E8
+ 659 0882 4183C608 		addl	$8, %r14d
+ 660 0886 4981C300 		addq	$256, %r11
+ 660      010000
+ 661 088d C5C4156C 		vunpckhps	8(%rsp), %ymm7, %ymm5
+ 661      2408
+ 662 0893 C5E41454 		vunpcklps	-56(%rsp), %ymm3, %ymm2
+ 662      24C8
+ 663 0899 4883C320 		addq	$32, %rbx
+ 664 089d C5E41544 		vunpckhps	-56(%rsp), %ymm3, %ymm0
+ 664      24C8
+ 665 08a3 C5FC287C 		vmovaps	104(%rsp), %ymm7
+ 665      2468
+ 666 08a9 C5FC2864 		vmovaps	40(%rsp), %ymm4
+ 666      2428
+ 667 08af C5DC154C 		vunpckhps	72(%rsp), %ymm4, %ymm1
+ 667      2448
+ 668 08b5 C5FC2874 		vmovaps	-24(%rsp), %ymm6
+ 668      24E8
+ 669 08bb C5CC1474 		vunpcklps	8(%rsp), %ymm6, %ymm6
+ 669      2408
+ 670 08c1 C5C415A4 		vunpckhps	136(%rsp), %ymm7, %ymm4
+ 670      24880000 
+ 670      00
+ 671 08ca C5FC285C 		vmovaps	40(%rsp), %ymm3
+ 671      2428
+ 672 08d0 C544148C 		vunpcklps	136(%rsp), %ymm7, %ymm9
+ 672      24880000 
+ 672      00
+ 673 08d9 C5E4145C 		vunpcklps	72(%rsp), %ymm3, %ymm3
+ 673      2448
+ 674 08df C5ECC6FE 		vshufps	$68, %ymm6, %ymm2, %ymm7
+ 674      44
+ 675 08e4 C5ECC6D6 		vshufps	$238, %ymm6, %ymm2, %ymm2
+ 675      EE
+ 676 08e9 C5FCC6F5 		vshufps	$68, %ymm5, %ymm0, %ymm6
+ 676      44
+ 677 08ee C5FCC6C5 		vshufps	$238, %ymm5, %ymm0, %ymm0
+ 677      EE
+ 678 08f3 C5F4C6EC 		vshufps	$68, %ymm4, %ymm1, %ymm5
+ 678      44
+ 679 08f8 C5F4C6CC 		vshufps	$238, %ymm4, %ymm1, %ymm1
+ 679      EE
+ 680 08fd C44164C6 		vshufps	$68, %ymm9, %ymm3, %ymm8
+ 680      C144
+ 681 0903 62D34528 		vshuff32x4	$0, %ymm8, %ymm7, %ymm4
+ 681      23E000
+ 682 090a C4C164C6 		vshufps	$238, %ymm9, %ymm3, %ymm3
+ 682      D9EE
+ 683 0910 62D34528 		vshuff32x4	$3, %ymm8, %ymm7, %ymm7
+ 683      23F803
+ 684 0917 C5FC2964 		vmovaps	%ymm4, -88(%rsp)
+ 684      24A8
+ 685 091d 62F36D28 		vshuff32x4	$0, %ymm3, %ymm2, %ymm4
+ 685      23E300
+ 686 0924 62F36D28 		vshuff32x4	$3, %ymm3, %ymm2, %ymm2
+ 686      23D303
+ 687 092b C5FC2964 		vmovaps	%ymm4, -56(%rsp)
+ 687      24C8
+ 688 0931 62F34D28 		vshuff32x4	$0, %ymm5, %ymm6, %ymm4
+ 688      23E500
+ 689 0938 62F34D28 		vshuff32x4	$3, %ymm5, %ymm6, %ymm6
+ 689      23F503
+ 690 093f C5FC2964 		vmovaps	%ymm4, -24(%rsp)
+ 690      24E8
+ 691 0945 62F37D28 		vshuff32x4	$0, %ymm1, %ymm0, %ymm4
+ 691      23E100
+ 692 094c 62F37D28 		vshuff32x4	$3, %ymm1, %ymm0, %ymm0
+ 692      23C103
+ 693 0953 C5FC2964 		vmovaps	%ymm4, 8(%rsp)
+ 693      2408
+ 694 0959 C5FC297C 		vmovaps	%ymm7, 40(%rsp)
+ 694      2428
+ 695 095f C5FC2954 		vmovaps	%ymm2, 72(%rsp)
+ 695      2448
+ 696 0965 C5FC2974 		vmovaps	%ymm6, 104(%rsp)
+ 696      2468
+ 697 096b C5FC2984 		vmovaps	%ymm0, 136(%rsp)
+ 697      24880000 
+ 697      00
+ 698 0974 62F1FE48 		vmovdqu64	(%rcx), %zmm2
+ 698      6F11
+ 699 097a 62D1FE48 		vmovdqu64	%zmm2, -256(%r11)
+ 699      7F53FC
+ 700 0981 62F1FE48 		vmovdqu64	64(%rcx), %zmm2
+ 700      6F5101
+ 701 0988 62D1FE48 		vmovdqu64	%zmm2, -192(%r11)
+ 701      7F53FD
+ 702 098f 62F1FE48 		vmovdqu64	128(%rcx), %zmm5
+ 702      6F6902
+ 703 0996 62D1FE48 		vmovdqu64	%zmm5, -128(%r11)
+ 703      7F6BFE
+ 704 099d 62F1FE48 		vmovdqu64	192(%rcx), %zmm6
+ 704      6F7103
+ 705 09a4 62D1FE48 		vmovdqu64	%zmm6, -64(%r11)
+ 705      7F73FF
+ 706 09ab 4539E6   		cmpl	%r12d, %r14d
+ 707 09ae 0F85A4FE 		jne	.L78
+ 707      FFFF
+ 708 09b4 41C1ED03 		shrl	$3, %r13d
+ 709 09b8 468D24ED 		leal	8(,%r13,8), %r12d
+ 709      08000000 
+ 710 09c0 C5F877   		vzeroupper
+ 711 09c3 E9D0FDFF 		jmp	.L77
+ 711      FF
+ 712              	.L113:
+ 713 09c8 85D2     		testl	%edx, %edx
+ 714 09ca 0F8E34FE 		jle	.L109
+ 714      FFFF
+ 715              	.L97:
+ 716 09d0 4531E4   		xorl	%r12d, %r12d
+ 717 09d3 E9C0FDFF 		jmp	.L77
+ 717      FF
+ 718              	.L74:
+ 719 09d8 83F907   		cmpl	$7, %ecx
+ 720 09db 7EF3     		jle	.L97
+ 721 09dd 448D61F8 		leal	-8(%rcx), %r12d
+ 722 09e1 4963D1   		movslq	%r9d, %rdx
+ 723 09e4 41C1EC03 		shrl	$3, %r12d
+ 724 09e8 488D3496 		leaq	(%rsi,%rdx,4), %rsi
+ 725 09ec 31D2     		xorl	%edx, %edx
+ 726 09ee 418D4C24 		leal	1(%r12), %ecx
+ 726      01
+ 727 09f3 4989CC   		movq	%rcx, %r12
+ 728 09f6 48C1E105 		salq	$5, %rcx
+ 729 09fa 660F1F44 		.p2align 4,,10
+ 729      0000
+ 730              		.p2align 3
+ 731              	.L81:
+ 732 0a00 C5FC101C 		vmovups	(%rdi,%rdx), %ymm3
+ 732      17
+ 733 0a05 C5E4140C 		vunpcklps	(%rsi,%rdx), %ymm3, %ymm1
+ 733      16
+ 734 0a0a C5E41504 		vunpckhps	(%rsi,%rdx), %ymm3, %ymm0
+ 734      16
+ 735 0a0f 62F37528 		vshuff32x4	$0, %ymm0, %ymm1, %ymm2
+ 735      23D000
+ 736 0a16 62F37528 		vshuff32x4	$3, %ymm0, %ymm1, %ymm1
+ 736      23C803
+ 737 0a1d C5FC1114 		vmovups	%ymm2, (%rax,%rdx,2)
+ 737      50
+ 738 0a22 C5FC114C 		vmovups	%ymm1, 32(%rax,%rdx,2)
+ 738      5020
+ 739 0a28 4883C220 		addq	$32, %rdx
+ 740 0a2c 4839D1   		cmpq	%rdx, %rcx
+ 741 0a2f 75CF     		jne	.L81
+ 742 0a31 41C1E403 		sall	$3, %r12d
+ 743 0a35 C5F877   		vzeroupper
+ 744 0a38 E95BFDFF 		jmp	.L77
+ 744      FF
+ 745              	.L72:
+ 746 0a3d 83F907   		cmpl	$7, %ecx
+ 747 0a40 7E8E     		jle	.L97
+ 748 0a42 8D51F8   		leal	-8(%rcx), %edx
+ 749 0a45 C4412057 		vxorps	%xmm11, %xmm11, %xmm11
+ 749      DB
+ 750 0a4a 4989F3   		movq	%rsi, %r11
+ 751 0a4d 4863F1   		movslq	%ecx, %rsi
+ 752 0a50 4189D4   		movl	%edx, %r12d
+ 753 0a53 488D4C24 		leaq	-88(%rsp), %rcx
+ 753      A8
+ 754 0a58 4C8D6C24 		leaq	104(%rsp), %r13
+ 754      68
+ 755 0a5d 4889C3   		movq	%rax, %rbx
+ 756 0a60 4183E4F8 		andl	$-8, %r12d
+ 757 0a64 895424A4 		movl	%edx, -92(%rsp)
+ 758 0a68 48C1E602 		salq	$2, %rsi
+ 759 0a6c 4531D2   		xorl	%r10d, %r10d
+ 760 0a6f 4183C408 		addl	$8, %r12d
+ 761 0a73 44894C24 		movl	%r9d, -96(%rsp)
+ 761      A0
+ 762 0a78 4C89EA   		movq	%r13, %rdx
+ 763 0a7b 4589C1   		movl	%r8d, %r9d
+ 764 0a7e C5FD6F15 		vmovdqa	.LC0(%rip), %ymm2
+ 764      00000000 
+ 765 0a86 4989F8   		movq	%rdi, %r8
+ 766 0a89 4889C7   		movq	%rax, %rdi
+ 767 0a8c C4417C28 		vmovaps	%ymm11, %ymm10
+ 767      D3
+ 768 0a91 4489E0   		movl	%r12d, %eax
+ 769 0a94 4C8DBC24 		leaq	168(%rsp), %r15
+ 769      A8000000 
+ 770 0a9c 4989CC   		movq	%rcx, %r12
+ 771 0a9f 90       		.p2align 4,,10
+ 772              		.p2align 3
+ 773              	.L79:
+ 774 0aa0 4D89E6   		movq	%r12, %r14
+ 775 0aa3 4C89E1   		movq	%r12, %rcx
+ 776 0aa6 4D89DD   		movq	%r11, %r13
+ 777 0aa9 0F1F8000 		.p2align 4,,10
+ 777      000000
+ 778              		.p2align 3
+ 779              	.L86:
+ 780 0ab0 C4C17C10 		vmovups	0(%r13), %ymm6
+ 780      7500
+ 781 0ab6 4883C120 		addq	$32, %rcx
+ 782 0aba 4901F5   		addq	%rsi, %r13
+ 783 0abd C5FC2971 		vmovaps	%ymm6, -32(%rcx)
+ 783      E0
+ 784 0ac2 4839D1   		cmpq	%rdx, %rcx
+ 785 0ac5 75E9     		jne	.L86
+ 786 0ac7 C5FC284C 		vmovaps	-88(%rsp), %ymm1
+ 786      24A8
+ 787 0acd C5FC286C 		vmovaps	40(%rsp), %ymm5
+ 787      2428
+ 788 0ad3 4889D9   		movq	%rbx, %rcx
+ 789 0ad6 C5F4145C 		vunpcklps	-56(%rsp), %ymm1, %ymm3
+ 789      24C8
+ 790 0adc C5F41544 		vunpckhps	-56(%rsp), %ymm1, %ymm0
+ 790      24C8
+ 791 0ae2 C5D4146C 		vunpcklps	72(%rsp), %ymm5, %ymm5
+ 791      2448
+ 792 0ae8 C5FC284C 		vmovaps	-24(%rsp), %ymm1
+ 792      24E8
+ 793 0aee C5F4147C 		vunpcklps	8(%rsp), %ymm1, %ymm7
+ 793      2408
+ 794 0af4 C5F41574 		vunpckhps	8(%rsp), %ymm1, %ymm6
+ 794      2408
+ 795 0afa C44154C6 		vshufps	$68, %ymm11, %ymm5, %ymm9
+ 795      CB44
+ 796 0b00 C5FC284C 		vmovaps	40(%rsp), %ymm1
+ 796      2428
+ 797 0b06 C5F4154C 		vunpckhps	72(%rsp), %ymm1, %ymm1
+ 797      2448
+ 798 0b0c C4C154C6 		vshufps	$238, %ymm11, %ymm5, %ymm5
+ 798      EBEE
+ 799 0b12 C564C6C7 		vshufps	$68, %ymm7, %ymm3, %ymm8
+ 799      44
+ 800 0b17 62533D28 		vshuff32x4	$0, %ymm9, %ymm8, %ymm12
+ 800      23E100
+ 801 0b1e C5E4C6DF 		vshufps	$238, %ymm7, %ymm3, %ymm3
+ 801      EE
+ 802 0b23 C5FCC6FE 		vshufps	$68, %ymm6, %ymm0, %ymm7
+ 802      44
+ 803 0b28 C57C2964 		vmovaps	%ymm12, -88(%rsp)
+ 803      24A8
+ 804 0b2e 62736528 		vshuff32x4	$0, %ymm5, %ymm3, %ymm12
+ 804      23E500
+ 805 0b35 C5FCC6C6 		vshufps	$238, %ymm6, %ymm0, %ymm0
+ 805      EE
+ 806 0b3a C4C174C6 		vshufps	$68, %ymm10, %ymm1, %ymm6
+ 806      F244
+ 807 0b40 C57C2964 		vmovaps	%ymm12, -56(%rsp)
+ 807      24C8
+ 808 0b46 62734528 		vshuff32x4	$0, %ymm6, %ymm7, %ymm12
+ 808      23E600
+ 809 0b4d C4C174C6 		vshufps	$238, %ymm10, %ymm1, %ymm1
+ 809      CAEE
+ 810 0b53 62533D28 		vshuff32x4	$3, %ymm9, %ymm8, %ymm8
+ 810      23C103
+ 811 0b5a C57C2964 		vmovaps	%ymm12, -24(%rsp)
+ 811      24E8
+ 812 0b60 62F36528 		vshuff32x4	$3, %ymm5, %ymm3, %ymm3
+ 812      23DD03
+ 813 0b67 62737D28 		vshuff32x4	$0, %ymm1, %ymm0, %ymm12
+ 813      23E100
+ 814 0b6e 62F34528 		vshuff32x4	$3, %ymm6, %ymm7, %ymm7
+ 814      23FE03
+ 815 0b75 62F37D28 		vshuff32x4	$3, %ymm1, %ymm0, %ymm0
+ 815      23C103
+ 816 0b7c C57C2964 		vmovaps	%ymm12, 8(%rsp)
+ 816      2408
+ 817 0b82 C57C2944 		vmovaps	%ymm8, 40(%rsp)
+ 817      2428
+ 818 0b88 C5FC295C 		vmovaps	%ymm3, 72(%rsp)
+ 818      2448
+ 819 0b8e C5FC297C 		vmovaps	%ymm7, 104(%rsp)
+ 819      2468
+ 820 0b94 C5FC2984 		vmovaps	%ymm0, 136(%rsp)
+ 820      24880000 
+ 820      00
+ 821 0b9d 0F1F00   		.p2align 4,,10
+ 822              		.p2align 3
+ 823              	.L87:
+ 824 0ba0 C4C17C28 		vmovaps	(%r14), %ymm5
+ 824      2E
+ 825 0ba5 4983C620 		addq	$32, %r14
+ 826 0ba9 C4E26D2E 		vmaskmovps	%ymm5, %ymm2, (%rcx)
+ 826      29
+ 827 0bae 4883C118 		addq	$24, %rcx
+ 828 0bb2 4D39FE   		cmpq	%r15, %r14
+ 829 0bb5 75E9     		jne	.L87
+ 830 0bb7 4183C208 		addl	$8, %r10d
+ 831 0bbb 4881C3C0 		addq	$192, %rbx
+ 831      000000
+ 832 0bc2 4983C320 		addq	$32, %r11
+ 833 0bc6 4139C2   		cmpl	%eax, %r10d
+ 834 0bc9 0F85D1FE 		jne	.L79
+ 834      FFFF
+ 835 0bcf 8B5424A4 		movl	-92(%rsp), %edx
+ 836 0bd3 4889F8   		movq	%rdi, %rax
+ 837 0bd6 4C89C7   		movq	%r8, %rdi
+ 838 0bd9 4589C8   		movl	%r9d, %r8d
+ 839 0bdc 448B4C24 		movl	-96(%rsp), %r9d
+ 839      A0
+ 840 0be1 C1EA03   		shrl	$3, %edx
+ 841 0be4 448D24D5 		leal	8(,%rdx,8), %r12d
+ 841      08000000 
+ 842 0bec C5F877   		vzeroupper
+ 843 0bef E9A4FBFF 		jmp	.L77
+ 843      FF
+ 844              	.L112:
+ 845              		.cfi_def_cfa 7, 8
+ 846              		.cfi_restore 3
+ 847              		.cfi_restore 6
+ 848              		.cfi_restore 12
+ 849              		.cfi_restore 13
+ 850              		.cfi_restore 14
+ 851              		.cfi_restore 15
+ 852 0bf4 4863D1   		movslq	%ecx, %rdx
+ 853 0bf7 4889C7   		movq	%rax, %rdi
+ 854 0bfa 48C1E202 		salq	$2, %rdx
+ 855 0bfe E9000000 		jmp	memcpy@PLT
+ 855      00
+ 856              		.cfi_endproc
+ 857              	.LFE6401:
+ 859              		.section	.rodata.cst32,"aM",@progbits,32
+ 860              		.align 32
+ 861              	.LC0:
+ 862 0000 FFFFFFFF 		.long	-1
+ 863 0004 FFFFFFFF 		.long	-1
+ 864 0008 FFFFFFFF 		.long	-1
+ 865 000c FFFFFFFF 		.long	-1
+ 866 0010 FFFFFFFF 		.long	-1
+ 867 0014 FFFFFFFF 		.long	-1
+ 868 0018 00000000 		.long	0
+ 869 001c 00000000 		.long	0
+ 870              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 871              		.section	.note.GNU-stack,"",@progbits
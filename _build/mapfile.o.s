@@ -0,0 +1,602 @@
+   1              		.file	"mapfile.c"
+   2              		.text
+   3              		.p2align 4
+   5              	map_data:
+   6              	.LFB18:
+   7              		.cfi_startproc
+   8 0000 4155     		pushq	%r13
+   9              		.cfi_def_cfa_offset 16
+  10              		.cfi_offset 13, -16
+  11 0002 4531C9   		xorl	%r9d, %r9d
+  12 0005 4989F5   		movq	%rsi, %r13
+  13 0008 4154     		pushq	%r12
+  14              		.cfi_def_cfa_offset 24
+  15              		.cfi_offset 12, -24
+  16 000a 4989D4   		movq	%rdx, %r12
+  17 000d 89CA     		movl	%ecx, %edx
+  18 000f B9010000 		movl	$1, %ecx
+  18      00
+  19 0014 55       		pushq	%rbp
+  20              		.cfi_def_cfa_offset 32
+  21              		.cfi_offset 6, -32
+  22 0015 4C89E6   		movq	%r12, %rsi
+  23 0018 4889FD   		movq	%rdi, %rbp
+  24 001b 53       		pushq	%rbx
+  25              		.cfi_def_cfa_offset 40
+  26              		.cfi_offset 3, -40
+  27 001c 4C89C3   		movq	%r8, %rbx
+  28 001f 4883EC08 		subq	$8, %rsp
+  29              		.cfi_def_cfa_offset 48
+  30 0023 4C896710 		movq	%r12, 16(%rdi)
+  31 0027 448B07   		movl	(%rdi), %r8d
+  32 002a 31FF     		xorl	%edi, %edi
+  33 002c E8000000 		call	mmap@PLT
+  33      00
+  34 0031 48894508 		movq	%rax, 8(%rbp)
+  35 0035 4883F8FF 		cmpq	$-1, %rax
+  36 0039 0F84C100 		je	.L22
+  36      0000
+  37 003f 4889C7   		movq	%rax, %rdi
+  38 0042 418B4510 		movl	16(%r13), %eax
+  39 0046 4889F9   		movq	%rdi, %rcx
+  40 0049 250000FF 		andl	$268369920, %eax
+  40      0F
+  41 004e 3D000004 		cmpl	$262144, %eax
+  41      00
+  42 0053 752B     		jne	.L23
+  43              	.L4:
+  44 0055 48894D18 		movq	%rcx, 24(%rbp)
+  45 0059 4C89E6   		movq	%r12, %rsi
+  46 005c BA020000 		movl	$2, %edx
+  46      00
+  47 0061 E8000000 		call	posix_madvise@PLT
+  47      00
+  48 0066 4883C408 		addq	$8, %rsp
+  49              		.cfi_remember_state
+  50              		.cfi_def_cfa_offset 40
+  51 006a B8010000 		movl	$1, %eax
+  51      00
+  52 006f 5B       		popq	%rbx
+  53              		.cfi_def_cfa_offset 32
+  54 0070 5D       		popq	%rbp
+  55              		.cfi_def_cfa_offset 24
+  56 0071 415C     		popq	%r12
+  57              		.cfi_def_cfa_offset 16
+  58 0073 415D     		popq	%r13
+  59              		.cfi_def_cfa_offset 8
+  60 0075 C3       		ret
+  61 0076 662E0F1F 		.p2align 4,,10
+  61      84000000 
+  61      0000
+  62              		.p2align 3
+  63              	.L23:
+  64              		.cfi_restore_state
+  65 0080 4983FC0B 		cmpq	$11, %r12
+  66 0084 766A     		jbe	.L3
+  67 0086 813F5249 		cmpl	$1179011410, (%rdi)
+  67      4646
+  68 008c 7562     		jne	.L3
+  69 008e 817F0857 		cmpl	$1163280727, 8(%rdi)
+  69      415645
+  70 0095 7559     		jne	.L3
+  71 0097 48C70300 		movq	$0, (%rbx)
+  71      000000
+  72 009e 4983FC13 		cmpq	$19, %r12
+  73 00a2 764C     		jbe	.L3
+  74 00a4 B9140000 		movl	$20, %ecx
+  74      00
+  75 00a9 BA0C0000 		movl	$12, %edx
+  75      00
+  76 00ae EB25     		jmp	.L10
+  77              		.p2align 4,,10
+  78              		.p2align 3
+  79              	.L8:
+  80 00b0 813E6661 		cmpl	$1952670054, (%rsi)
+  80      6374
+  81 00b6 7508     		jne	.L9
+  82 00b8 83F803   		cmpl	$3, %eax
+  83 00bb 7603     		jbe	.L9
+  84 00bd 48890B   		movq	%rcx, (%rbx)
+  85              	.L9:
+  86 00c0 83C001   		addl	$1, %eax
+  87 00c3 83E0FE   		andl	$-2, %eax
+  88 00c6 83C008   		addl	$8, %eax
+  89 00c9 4801C2   		addq	%rax, %rdx
+  90 00cc 488D4A08 		leaq	8(%rdx), %rcx
+  91 00d0 4939CC   		cmpq	%rcx, %r12
+  92 00d3 721B     		jb	.L3
+  93              	.L10:
+  94 00d5 488D3417 		leaq	(%rdi,%rdx), %rsi
+  95 00d9 8B441704 		movl	4(%rdi,%rdx), %eax
+  96 00dd 813E6461 		cmpl	$1635017060, (%rsi)
+  96      7461
+  97 00e3 75CB     		jne	.L8
+  98 00e5 F6C103   		testb	$3, %cl
+  99 00e8 7422     		je	.L24
+ 100 00ea 660F1F44 		.p2align 4,,10
+ 100      0000
+ 101              		.p2align 3
+ 102              	.L3:
+ 103 00f0 31C0     		xorl	%eax, %eax
+ 104              	.L25:
+ 105 00f2 4883C408 		addq	$8, %rsp
+ 106              		.cfi_remember_state
+ 107              		.cfi_def_cfa_offset 40
+ 108 00f6 5B       		popq	%rbx
+ 109              		.cfi_def_cfa_offset 32
+ 110 00f7 5D       		popq	%rbp
+ 111              		.cfi_def_cfa_offset 24
+ 112 00f8 415C     		popq	%r12
+ 113              		.cfi_def_cfa_offset 16
+ 114 00fa 415D     		popq	%r13
+ 115              		.cfi_def_cfa_offset 8
+ 116 00fc C3       		ret
+ 117 00fd 0F1F00   		.p2align 4,,10
+ 118              		.p2align 3
+ 119              	.L22:
+ 120              		.cfi_restore_state
+ 121 0100 48C74508 		movq	$0, 8(%rbp)
+ 121      00000000 
+ 122 0108 31C0     		xorl	%eax, %eax
+ 123 010a EBE6     		jmp	.L25
+ 124              	.L24:
+ 125 010c 4801F9   		addq	%rdi, %rcx
+ 126 010f E941FFFF 		jmp	.L4
+ 126      FF
+ 127              		.cfi_endproc
+ 128              	.LFE18:
+ 130 0114 66662E0F 		.p2align 4
+ 130      1F840000 
+ 130      00000090 
+ 131              		.globl	mapfile_supported
+ 133              	mapfile_supported:
+ 134              	.LFB16:
+ 135              		.cfi_startproc
+ 136 0120 8B5710   		movl	16(%rdi), %edx
+ 137 0123 31C0     		xorl	%eax, %eax
+ 138 0125 6683FA06 		cmpw	$6, %dx
+ 139 0129 7528     		jne	.L26
+ 140 012b 89D1     		movl	%edx, %ecx
+ 141 012d 81E10000 		andl	$268369920, %ecx
+ 141      FF0F
+ 142 0133 81F90000 		cmpl	$65536, %ecx
+ 142      0100
+ 143 0139 0F94C0   		sete	%al
+ 144 013c 81F90000 		cmpl	$1245184, %ecx
+ 144      1300
+ 145 0142 400F94C6 		sete	%sil
+ 146 0146 4008F0   		orb	%sil, %al
+ 147 0149 750D     		jne	.L30
+ 148 014b 81F90000 		cmpl	$262144, %ecx
+ 148      0400
+ 149 0151 7415     		je	.L31
+ 150              	.L26:
+ 151 0153 C3       		ret
+ 152              		.p2align 4,,10
+ 153 0154 0F1F4000 		.p2align 3
+ 154              	.L30:
+ 155 0158 C1EA1D   		shrl	$29, %edx
+ 156 015b 83F201   		xorl	$1, %edx
+ 157 015e 89D0     		movl	%edx, %eax
+ 158 0160 83E001   		andl	$1, %eax
+ 159 0163 C3       		ret
+ 160              		.p2align 4,,10
+ 161 0164 0F1F4000 		.p2align 3
+ 162              	.L31:
+ 163 0168 89D0     		movl	%edx, %eax
+ 164 016a 25000000 		andl	$805306368, %eax
+ 164      30
+ 165 016f 3D000000 		cmpl	$805306368, %eax
+ 165      30
+ 166 0174 0F94C0   		sete	%al
+ 167 0177 C1EA1D   		shrl	$29, %edx
+ 168 017a 83F201   		xorl	$1, %edx
+ 169 017d 83E201   		andl	$1, %edx
+ 170 0180 09D0     		orl	%edx, %eax
+ 171 0182 C3       		ret
+ 172              		.cfi_endproc
+ 173              	.LFE16:
+ 175 0183 66662E0F 		.p2align 4
+ 175      1F840000 
+ 175      00000066 
+ 175      90
+ 176              		.globl	mapfile_close
+ 178              	mapfile_close:
+ 179              	.LFB21:
+ 180              		.cfi_startproc
+ 181 0190 53       		pushq	%rbx
+ 182              		.cfi_def_cfa_offset 16
+ 183              		.cfi_offset 3, -16
+ 184 0191 4889FB   		movq	%rdi, %rbx
+ 185 0194 488B7F08 		movq	8(%rdi), %rdi
+ 186 0198 4885FF   		testq	%rdi, %rdi
+ 187 019b 7409     		je	.L33
+ 188 019d 488B7310 		movq	16(%rbx), %rsi
+ 189 01a1 E8000000 		call	munmap@PLT
+ 189      00
+ 190              	.L33:
+ 191 01a6 8B3B     		movl	(%rbx), %edi
+ 192 01a8 85FF     		testl	%edi, %edi
+ 193 01aa 7805     		js	.L34
+ 194 01ac E8000000 		call	close@PLT
+ 194      00
+ 195              	.L34:
+ 196 01b1 48C74308 		movq	$0, 8(%rbx)
+ 196      00000000 
+ 197 01b9 C703FFFF 		movl	$-1, (%rbx)
+ 197      FFFF
+ 198 01bf 5B       		popq	%rbx
+ 199              		.cfi_def_cfa_offset 8
+ 200 01c0 C3       		ret
+ 201              		.cfi_endproc
+ 202              	.LFE21:
+ 204              		.section	.rodata.str1.1,"aMS",@progbits,1
+ 205              	.LC0:
+ 206 0000 25733A20 		.string	"%s: mapped %s, %lld frames\n"
+ 206      6D617070 
+ 206      65642025 
+ 206      732C2025 
+ 206      6C6C6420 
+ 207              		.text
+ 208 01c1 66662E0F 		.p2align 4
+ 208      1F840000 
+ 208      0000000F 
+ 208      1F4000
+ 209              		.globl	mapfile_open_input
+ 211              	mapfile_open_input:
+ 212              	.LFB19:
+ 213              		.cfi_startproc
+ 214 01d0 55       		pushq	%rbp
+ 215              		.cfi_def_cfa_offset 16
+ 216              		.cfi_offset 6, -16
+ 217 01d1 C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 218 01d5 4889E5   		movq	%rsp, %rbp
+ 219              		.cfi_def_cfa_register 6
+ 220 01d8 4156     		pushq	%r14
+ 221 01da 4155     		pushq	%r13
+ 222              		.cfi_offset 14, -24
+ 223              		.cfi_offset 13, -32
+ 224 01dc 4989F5   		movq	%rsi, %r13
+ 225 01df 4154     		pushq	%r12
+ 226              		.cfi_offset 12, -40
+ 227 01e1 4989D4   		movq	%rdx, %r12
+ 228 01e4 53       		pushq	%rbx
+ 229              		.cfi_offset 3, -48
+ 230 01e5 4889FB   		movq	%rdi, %rbx
+ 231 01e8 4881ECA0 		subq	$160, %rsp
+ 231      000000
+ 232 01ef C7472400 		movl	$0, 36(%rdi)
+ 232      000000
+ 233 01f6 C707FFFF 		movl	$-1, (%rdi)
+ 233      FFFF
+ 234 01fc 62F17F28 		vmovdqu8	%ymm0, 4(%rdi)
+ 234      7F870400 
+ 234      0000
+ 235 0206 4889D7   		movq	%rdx, %rdi
+ 236 0209 C5F877   		vzeroupper
+ 237 020c E8000000 		call	mapfile_supported@PLT
+ 237      00
+ 238 0211 84C0     		testb	%al, %al
+ 239 0213 751B     		jne	.L53
+ 240              	.L40:
+ 241 0215 4531F6   		xorl	%r14d, %r14d
+ 242              	.L39:
+ 243 0218 4881C4A0 		addq	$160, %rsp
+ 243      000000
+ 244 021f 4489F0   		movl	%r14d, %eax
+ 245 0222 5B       		popq	%rbx
+ 246 0223 415C     		popq	%r12
+ 247 0225 415D     		popq	%r13
+ 248 0227 415E     		popq	%r14
+ 249 0229 5D       		popq	%rbp
+ 250              		.cfi_remember_state
+ 251              		.cfi_def_cfa 7, 8
+ 252 022a C3       		ret
+ 253 022b 0F1F4400 		.p2align 4,,10
+ 253      00
+ 254              		.p2align 3
+ 255              	.L53:
+ 256              		.cfi_restore_state
+ 257 0230 31F6     		xorl	%esi, %esi
+ 258 0232 4C89EF   		movq	%r13, %rdi
+ 259 0235 31C0     		xorl	%eax, %eax
+ 260 0237 E8000000 		call	open@PLT
+ 260      00
+ 261 023c 8903     		movl	%eax, (%rbx)
+ 262 023e 85C0     		testl	%eax, %eax
+ 263 0240 782E     		js	.L41
+ 264 0242 488D7424 		leaq	16(%rsp), %rsi
+ 264      10
+ 265 0247 89C7     		movl	%eax, %edi
+ 266 0249 E8000000 		call	fstat@PLT
+ 266      00
+ 267 024e 85C0     		testl	%eax, %eax
+ 268 0250 751E     		jne	.L41
+ 269 0252 8B442428 		movl	40(%rsp), %eax
+ 270 0256 2500F000 		andl	$61440, %eax
+ 270      00
+ 271 025b 3D008000 		cmpl	$32768, %eax
+ 271      00
+ 272 0260 750E     		jne	.L41
+ 273 0262 488B5424 		movq	64(%rsp), %rdx
+ 273      40
+ 274 0267 4885D2   		testq	%rdx, %rdx
+ 275 026a 7514     		jne	.L54
+ 276 026c 0F1F4000 		.p2align 4,,10
+ 277              		.p2align 3
+ 278              	.L41:
+ 279 0270 4889DF   		movq	%rbx, %rdi
+ 280 0273 E8000000 		call	mapfile_close@PLT
+ 280      00
+ 281 0278 EB9B     		jmp	.L40
+ 282 027a 660F1F44 		.p2align 4,,10
+ 282      0000
+ 283              		.p2align 3
+ 284              	.L54:
+ 285 0280 4C8D4424 		leaq	8(%rsp), %r8
+ 285      08
+ 286 0285 B9010000 		movl	$1, %ecx
+ 286      00
+ 287 028a 4C89E6   		movq	%r12, %rsi
+ 288 028d 4889DF   		movq	%rbx, %rdi
+ 289 0290 E86BFDFF 		call	map_data
+ 289      FF
+ 290 0295 4189C6   		movl	%eax, %r14d
+ 291 0298 84C0     		testb	%al, %al
+ 292 029a 74D4     		je	.L41
+ 293 029c 4D8B0424 		movq	(%r12), %r8
+ 294 02a0 49634424 		movslq	12(%r12), %rax
+ 294      0C
+ 295 02a5 488B5318 		movq	24(%rbx), %rdx
+ 296 02a9 490FAFC0 		imulq	%r8, %rax
+ 297 02ad 4C894320 		movq	%r8, 32(%rbx)
+ 298 02b1 488D1482 		leaq	(%rdx,%rax,4), %rdx
+ 299 02b5 488B4310 		movq	16(%rbx), %rax
+ 300 02b9 48034308 		addq	8(%rbx), %rax
+ 301 02bd 4839D0   		cmpq	%rdx, %rax
+ 302 02c0 72AE     		jb	.L41
+ 303 02c2 4C89E9   		movq	%r13, %rcx
+ 304 02c5 488D1500 		leaq	__func__.1(%rip), %rdx
+ 304      000000
+ 305 02cc 488D3500 		leaq	.LC0(%rip), %rsi
+ 305      000000
+ 306 02d3 31C0     		xorl	%eax, %eax
+ 307 02d5 BF010000 		movl	$1, %edi
+ 307      00
+ 308 02da E8000000 		call	debugprint@PLT
+ 308      00
+ 309 02df E934FFFF 		jmp	.L39
+ 309      FF
+ 310              		.cfi_endproc
+ 311              	.LFE19:
+ 313 02e4 66662E0F 		.p2align 4
+ 313      1F840000 
+ 313      00000090 
+ 314              		.globl	mapfile_create_output
+ 316              	mapfile_create_output:
+ 317              	.LFB20:
+ 318              		.cfi_startproc
+ 319 02f0 55       		pushq	%rbp
+ 320              		.cfi_def_cfa_offset 16
+ 321              		.cfi_offset 6, -16
+ 322 02f1 C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+ 323 02f5 4889E5   		movq	%rsp, %rbp
+ 324              		.cfi_def_cfa_register 6
+ 325 02f8 4157     		pushq	%r15
+ 326              		.cfi_offset 15, -24
+ 327 02fa 4989D7   		movq	%rdx, %r15
+ 328 02fd 4156     		pushq	%r14
+ 329              		.cfi_offset 14, -32
+ 330 02ff 4989CE   		movq	%rcx, %r14
+ 331 0302 4155     		pushq	%r13
+ 332 0304 4154     		pushq	%r12
+ 333              		.cfi_offset 13, -40
+ 334              		.cfi_offset 12, -48
+ 335 0306 4989F4   		movq	%rsi, %r12
+ 336 0309 53       		pushq	%rbx
+ 337              		.cfi_offset 3, -56
+ 338 030a 4889FB   		movq	%rdi, %rbx
+ 339 030d 4881ECD8 		subq	$216, %rsp
+ 339      000000
+ 340 0314 4C636A0C 		movslq	12(%rdx), %r13
+ 341 0318 C7472400 		movl	$0, 36(%rdi)
+ 341      000000
+ 342 031f C707FFFF 		movl	$-1, (%rdi)
+ 342      FFFF
+ 343 0325 48C74424 		movq	$0, 24(%rsp)
+ 343      18000000 
+ 343      00
+ 344 032e 62F17F28 		vmovdqu8	%ymm0, 4(%rdi)
+ 344      7F870400 
+ 344      0000
+ 345 0338 4889D7   		movq	%rdx, %rdi
+ 346 033b C5F877   		vzeroupper
+ 347 033e E8000000 		call	mapfile_supported@PLT
+ 347      00
+ 348 0343 84C0     		testb	%al, %al
+ 349 0345 740F     		je	.L57
+ 350 0347 41803C24 		cmpb	$45, (%r12)
+ 350      2D
+ 351 034c 7522     		jne	.L67
+ 352 034e 41807C24 		cmpb	$0, 1(%r12)
+ 352      0100
+ 353 0354 751A     		jne	.L67
+ 354              	.L57:
+ 355 0356 4531D2   		xorl	%r10d, %r10d
+ 356              	.L55:
+ 357 0359 4881C4D8 		addq	$216, %rsp
+ 357      000000
+ 358 0360 4489D0   		movl	%r10d, %eax
+ 359 0363 5B       		popq	%rbx
+ 360 0364 415C     		popq	%r12
+ 361 0366 415D     		popq	%r13
+ 362 0368 415E     		popq	%r14
+ 363 036a 415F     		popq	%r15
+ 364 036c 5D       		popq	%rbp
+ 365              		.cfi_remember_state
+ 366              		.cfi_def_cfa 7, 8
+ 367 036d C3       		ret
+ 368 036e 6690     		.p2align 4,,10
+ 369              		.p2align 3
+ 370              	.L67:
+ 371              		.cfi_restore_state
+ 372 0370 4D0FAFEE 		imulq	%r14, %r13
+ 373 0374 418B4710 		movl	16(%r15), %eax
+ 374 0378 250000FF 		andl	$268369920, %eax
+ 374      0F
+ 375 037d 49C1E502 		salq	$2, %r13
+ 376 0381 3D000004 		cmpl	$262144, %eax
+ 376      00
+ 377 0386 740A     		je	.L66
+ 378 0388 B8FFEFFF 		movl	$4294963199, %eax
+ 378      FF
+ 379 038d 4C39E8   		cmpq	%r13, %rax
+ 380 0390 72C4     		jb	.L57
+ 381              	.L66:
+ 382 0392 C4C17E6F 		vmovdqu	(%r15), %ymm1
+ 382      0F
+ 383 0397 4C89E7   		movq	%r12, %rdi
+ 384 039a 488D5424 		leaq	32(%rsp), %rdx
+ 384      20
+ 385 039f BE200000 		movl	$32, %esi
+ 385      00
+ 386 03a4 C5FE7F4C 		vmovdqu	%ymm1, 32(%rsp)
+ 386      2420
+ 387 03aa C5F877   		vzeroupper
+ 388 03ad E8000000 		call	sf_open@PLT
+ 388      00
+ 389 03b2 4889C7   		movq	%rax, %rdi
+ 390 03b5 4885C0   		testq	%rax, %rax
+ 391 03b8 749C     		je	.L57
+ 392 03ba 31C9     		xorl	%ecx, %ecx
+ 393 03bc 31D2     		xorl	%edx, %edx
+ 394 03be BE501000 		movl	$4176, %esi
+ 394      00
+ 395 03c3 48894424 		movq	%rax, 8(%rsp)
+ 395      08
+ 396 03c8 E8000000 		call	sf_command@PLT
+ 396      00
+ 397 03cd 488B7C24 		movq	8(%rsp), %rdi
+ 397      08
+ 398 03d2 E8000000 		call	sf_close@PLT
+ 398      00
+ 399 03d7 BE020000 		movl	$2, %esi
+ 399      00
+ 400 03dc 4C89E7   		movq	%r12, %rdi
+ 401 03df 31C0     		xorl	%eax, %eax
+ 402 03e1 E8000000 		call	open@PLT
+ 402      00
+ 403 03e6 8903     		movl	%eax, (%rbx)
+ 404 03e8 85C0     		testl	%eax, %eax
+ 405 03ea 7820     		js	.L61
+ 406 03ec 488D7424 		leaq	64(%rsp), %rsi
+ 406      40
+ 407 03f1 89C7     		movl	%eax, %edi
+ 408 03f3 E8000000 		call	fstat@PLT
+ 408      00
+ 409 03f8 85C0     		testl	%eax, %eax
+ 410 03fa 7510     		jne	.L61
+ 411 03fc 8B442458 		movl	88(%rsp), %eax
+ 412 0400 2500F000 		andl	$61440, %eax
+ 412      00
+ 413 0405 3D008000 		cmpl	$32768, %eax
+ 413      00
+ 414 040a 7414     		je	.L84
+ 415              	.L61:
+ 416 040c 4889DF   		movq	%rbx, %rdi
+ 417 040f E8000000 		call	mapfile_close@PLT
+ 417      00
+ 418 0414 E93DFFFF 		jmp	.L57
+ 418      FF
+ 419 0419 0F1F8000 		.p2align 4,,10
+ 419      000000
+ 420              		.p2align 3
+ 421              	.L84:
+ 422 0420 488B4C24 		movq	112(%rsp), %rcx
+ 422      70
+ 423 0425 8B3B     		movl	(%rbx), %edi
+ 424 0427 498D540D 		leaq	0(%r13,%rcx), %rdx
+ 424      00
+ 425 042c 48890C24 		movq	%rcx, (%rsp)
+ 426 0430 4889D6   		movq	%rdx, %rsi
+ 427 0433 48895424 		movq	%rdx, 8(%rsp)
+ 427      08
+ 428 0438 E8000000 		call	ftruncate@PLT
+ 428      00
+ 429 043d 85C0     		testl	%eax, %eax
+ 430 043f 75CB     		jne	.L61
+ 431 0441 488B5424 		movq	8(%rsp), %rdx
+ 431      08
+ 432 0446 4C8D4424 		leaq	24(%rsp), %r8
+ 432      18
+ 433 044b 4C89FE   		movq	%r15, %rsi
+ 434 044e 4889DF   		movq	%rbx, %rdi
+ 435 0451 B9030000 		movl	$3, %ecx
+ 435      00
+ 436 0456 E8A5FBFF 		call	map_data
+ 436      FF
+ 437 045b 4189C2   		movl	%eax, %r10d
+ 438 045e 84C0     		testb	%al, %al
+ 439 0460 74AA     		je	.L61
+ 440 0462 488B5308 		movq	8(%rbx), %rdx
+ 441 0466 488B4318 		movq	24(%rbx), %rax
+ 442 046a 488B0C24 		movq	(%rsp), %rcx
+ 443 046e 4829D0   		subq	%rdx, %rax
+ 444 0471 4839C1   		cmpq	%rax, %rcx
+ 445 0474 7596     		jne	.L61
+ 446 0476 418B4710 		movl	16(%r15), %eax
+ 447 047a 250000FF 		andl	$268369920, %eax
+ 447      0F
+ 448 047f 3D000004 		cmpl	$262144, %eax
+ 448      00
+ 449 0484 741B     		je	.L63
+ 450 0486 428D4429 		leal	-8(%rcx,%r13), %eax
+ 450      F8
+ 451 048b 894204   		movl	%eax, 4(%rdx)
+ 452 048e 488B4424 		movq	24(%rsp), %rax
+ 452      18
+ 453 0493 44896C0A 		movl	%r13d, -4(%rdx,%rcx)
+ 453      FC
+ 454 0498 4885C0   		testq	%rax, %rax
+ 455 049b 7404     		je	.L63
+ 456 049d 44893402 		movl	%r14d, (%rdx,%rax)
+ 457              	.L63:
+ 458 04a1 4C897320 		movq	%r14, 32(%rbx)
+ 459 04a5 4D89F0   		movq	%r14, %r8
+ 460 04a8 4C89E1   		movq	%r12, %rcx
+ 461 04ab BF010000 		movl	$1, %edi
+ 461      00
+ 462 04b0 488D1500 		leaq	__func__.0(%rip), %rdx
+ 462      000000
+ 463 04b7 488D3500 		leaq	.LC0(%rip), %rsi
+ 463      000000
+ 464 04be 31C0     		xorl	%eax, %eax
+ 465 04c0 44885424 		movb	%r10b, 8(%rsp)
+ 465      08
+ 466 04c5 E8000000 		call	debugprint@PLT
+ 466      00
+ 467 04ca 440FB654 		movzbl	8(%rsp), %r10d
+ 467      2408
+ 468 04d0 E984FEFF 		jmp	.L55
+ 468      FF
+ 469              		.cfi_endproc
+ 470              	.LFE20:
+ 472              		.section	.rodata
+ 473              		.align 16
+ 476              	__func__.0:
+ 477 0000 6D617066 		.string	"mapfile_create_output"
+ 477      696C655F 
+ 477      63726561 
+ 477      74655F6F 
+ 477      75747075 
+ 478 0016 00000000 		.align 16
+ 478      00000000 
+ 478      0000
+ 481              	__func__.1:
+ 482 0020 6D617066 		.string	"mapfile_open_input"
+ 482      696C655F 
+ 482      6F70656E 
+ 482      5F696E70 
+ 482      757400
+ 483              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 484              		.section	.note.GNU-stack,"",@progbits
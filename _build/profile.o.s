@@ -0,0 +1,888 @@
+   1              		.file	"profile.c"
+   2              		.text
+   3              		.section	.rodata.str1.8,"aMS",@progbits,1
+   4              		.align 8
+   5              	.LC0:
+   6 0000 436F756C 		.string	"Could not allocate memory for profile.\n"
+   6      64206E6F 
+   6      7420616C 
+   6      6C6F6361 
+   6      7465206D 
+   7              		.align 8
+   8              	.LC1:
+   9 0028 25733A20 		.string	"%s: %s counter not available for %s\n"
+   9      25732063 
+   9      6F756E74 
+   9      6572206E 
+   9      6F742061 
+  10 004d 000000   		.align 8
+  11              	.LC2:
+  12 0050 4E6F2070 		.string	"No performance counters available, check /proc/sys/kernel/perf_event_paranoid\n"
+  12      6572666F 
+  12      726D616E 
+  12      63652063 
+  12      6F756E74 
+  13              		.text
+  14              		.p2align 4
+  15              		.globl	profile_create
+  17              	profile_create:
+  18              	.LFB56:
+  19              		.cfi_startproc
+  20 0000 55       		pushq	%rbp
+  21              		.cfi_def_cfa_offset 16
+  22              		.cfi_offset 6, -16
+  23 0001 4889E5   		movq	%rsp, %rbp
+  24              		.cfi_def_cfa_register 6
+  25 0004 4157     		pushq	%r15
+  26 0006 4156     		pushq	%r14
+  27 0008 4155     		pushq	%r13
+  28 000a 4154     		pushq	%r12
+  29 000c 53       		pushq	%rbx
+  30 000d 4881ECA8 		subq	$168, %rsp
+  30      000000
+  31              		.cfi_offset 15, -24
+  32              		.cfi_offset 14, -32
+  33              		.cfi_offset 13, -40
+  34              		.cfi_offset 12, -48
+  35              		.cfi_offset 3, -56
+  36 0014 4885FF   		testq	%rdi, %rdi
+  37 0017 0F849E01 		je	.L2
+  37      0000
+  38 001d 4889FA   		movq	%rdi, %rdx
+  39 0020 4889F8   		movq	%rdi, %rax
+  40 0023 4531E4   		xorl	%r12d, %r12d
+  41 0026 662E0F1F 		.p2align 4,,10
+  41      84000000 
+  41      0000
+  42              		.p2align 3
+  43              	.L3:
+  44 0030 488B00   		movq	(%rax), %rax
+  45 0033 4183C401 		addl	$1, %r12d
+  46 0037 4885C0   		testq	%rax, %rax
+  47 003a 75F4     		jne	.L3
+  48 003c 4963FC   		movslq	%r12d, %rdi
+  49 003f 48895424 		movq	%rdx, 24(%rsp)
+  49      18
+  50 0044 48C1E705 		salq	$5, %rdi
+  51 0048 4883C708 		addq	$8, %rdi
+  52 004c E8000000 		call	malloc@PLT
+  52      00
+  53 0051 488B5424 		movq	24(%rsp), %rdx
+  53      18
+  54 0056 4885C0   		testq	%rax, %rax
+  55 0059 4889C3   		movq	%rax, %rbx
+  56 005c 0F849A01 		je	.L23
+  56      0000
+  57 0062 448920   		movl	%r12d, (%rax)
+  58              	.L5:
+  59 0065 488D4424 		leaq	32(%rsp), %rax
+  59      20
+  60 006a 4C8D6424 		leaq	48(%rsp), %r12
+  60      30
+  61 006f 48891C24 		movq	%rbx, (%rsp)
+  62 0073 4531ED   		xorl	%r13d, %r13d
+  63 0076 48894424 		movq	%rax, 24(%rsp)
+  63      18
+  64 007b 4C896424 		movq	%r12, 8(%rsp)
+  64      08
+  65              		.p2align 4,,10
+  66              		.p2align 3
+  67              	.L12:
+  68 0080 488B82B0 		movq	176(%rdx), %rax
+  68      000000
+  69 0087 4989DE   		movq	%rbx, %r14
+  70 008a 4989DC   		movq	%rbx, %r12
+  71 008d 48895424 		movq	%rdx, 16(%rsp)
+  71      10
+  72 0092 C74310FF 		movl	$-1, 16(%rbx)
+  72      FFFFFF
+  73 0099 4C8D3D00 		leaq	counters(%rip), %r15
+  73      000000
+  74 00a0 41B8FFFF 		movl	$-1, %r8d
+  74      FFFF
+  75 00a6 48894308 		movq	%rax, 8(%rbx)
+  76 00aa 488B5C24 		movq	8(%rsp), %rbx
+  76      08
+  77 00af EB0C     		jmp	.L11
+  78              		.p2align 4,,10
+  79 00b1 0F1F8000 		.p2align 3
+  79      000000
+  80              	.L25:
+  81 00b8 458B4424 		movl	16(%r12), %r8d
+  81      10
+  82              	.L11:
+  83 00bd 418B4708 		movl	8(%r15), %eax
+  84 00c1 C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+  85 00c5 488B7424 		movq	24(%rsp), %rsi
+  85      18
+  86 00ca 4531C9   		xorl	%r9d, %r9d
+  87 00cd 62F17F48 		vmovdqu8	%zmm0, (%rbx)
+  87      7F03
+  88 00d3 0FB65424 		movzbl	72(%rsp), %edx
+  88      48
+  89 00d8 B9FFFFFF 		movl	$-1, %ecx
+  89      FF
+  90 00dd BF2A0100 		movl	$298, %edi
+  90      00
+  91 00e2 89442420 		movl	%eax, 32(%rsp)
+  92 00e6 498B4710 		movq	16(%r15), %rax
+  93 00ea 83E29E   		andl	$-98, %edx
+  94 00ed C7442424 		movl	$128, 36(%rsp)
+  94      80000000 
+  95 00f5 48894424 		movq	%rax, 40(%rsp)
+  95      28
+  96 00fa 4489C0   		movl	%r8d, %eax
+  97 00fd C1E81F   		shrl	$31, %eax
+  98 0100 62F17F48 		vmovdqu8	%zmm0, 48(%rbx)
+  98      7F833000 
+  98      0000
+  99 010a 48C74424 		movq	$3, 64(%rsp)
+  99      40030000 
+  99      00
+ 100 0113 83C860   		orl	$96, %eax
+ 101 0116 09D0     		orl	%edx, %eax
+ 102 0118 31D2     		xorl	%edx, %edx
+ 103 011a 88442448 		movb	%al, 72(%rsp)
+ 104 011e 31C0     		xorl	%eax, %eax
+ 105 0120 C5F877   		vzeroupper
+ 106 0123 E8000000 		call	syscall@PLT
+ 106      00
+ 107 0128 41894614 		movl	%eax, 20(%r14)
+ 108 012c 85C0     		testl	%eax, %eax
+ 109 012e 7860     		js	.L24
+ 110 0130 418B5424 		movl	16(%r12), %edx
+ 110      10
+ 111 0135 85D2     		testl	%edx, %edx
+ 112 0137 7905     		jns	.L9
+ 113 0139 41894424 		movl	%eax, 16(%r12)
+ 113      10
+ 114              	.L9:
+ 115 013e 4183C501 		addl	$1, %r13d
+ 116              	.L8:
+ 117 0142 4983C718 		addq	$24, %r15
+ 118 0146 488D0500 		leaq	120+counters(%rip), %rax
+ 118      000000
+ 119 014d 4983C604 		addq	$4, %r14
+ 120 0151 4939C7   		cmpq	%rax, %r15
+ 121 0154 0F855EFF 		jne	.L25
+ 121      FFFF
+ 122 015a 488B5424 		movq	16(%rsp), %rdx
+ 122      10
+ 123 015f 4C89E3   		movq	%r12, %rbx
+ 124 0162 4883C320 		addq	$32, %rbx
+ 125 0166 488B12   		movq	(%rdx), %rdx
+ 126 0169 4885D2   		testq	%rdx, %rdx
+ 127 016c 0F850EFF 		jne	.L12
+ 127      FFFF
+ 128 0172 488B1C24 		movq	(%rsp), %rbx
+ 129 0176 4585ED   		testl	%r13d, %r13d
+ 130 0179 7458     		je	.L14
+ 131              	.L1:
+ 132 017b 4881C4A8 		addq	$168, %rsp
+ 132      000000
+ 133 0182 4889D8   		movq	%rbx, %rax
+ 134 0185 5B       		popq	%rbx
+ 135 0186 415C     		popq	%r12
+ 136 0188 415D     		popq	%r13
+ 137 018a 415E     		popq	%r14
+ 138 018c 415F     		popq	%r15
+ 139 018e 5D       		popq	%rbp
+ 140              		.cfi_remember_state
+ 141              		.cfi_def_cfa 7, 8
+ 142 018f C3       		ret
+ 143              		.p2align 4,,10
+ 144              		.p2align 3
+ 145              	.L24:
+ 146              		.cfi_restore_state
+ 147 0190 488B4424 		movq	16(%rsp), %rax
+ 147      10
+ 148 0195 498B0F   		movq	(%r15), %rcx
+ 149 0198 488D1500 		leaq	__func__.0(%rip), %rdx
+ 149      000000
+ 150 019f 488D3500 		leaq	.LC1(%rip), %rsi
+ 150      000000
+ 151 01a6 BF010000 		movl	$1, %edi
+ 151      00
+ 152 01ab 4C8B80B0 		movq	176(%rax), %r8
+ 152      000000
+ 153 01b2 31C0     		xorl	%eax, %eax
+ 154 01b4 E8000000 		call	debugprint@PLT
+ 154      00
+ 155 01b9 EB87     		jmp	.L8
+ 156              	.L2:
+ 157 01bb BF080000 		movl	$8, %edi
+ 157      00
+ 158 01c0 E8000000 		call	malloc@PLT
+ 158      00
+ 159 01c5 4889C3   		movq	%rax, %rbx
+ 160 01c8 4885C0   		testq	%rax, %rax
+ 161 01cb 7418     		je	.L26
+ 162 01cd C7030000 		movl	$0, (%rbx)
+ 162      0000
+ 163              	.L14:
+ 164 01d3 488D3500 		leaq	.LC2(%rip), %rsi
+ 164      000000
+ 165 01da 31FF     		xorl	%edi, %edi
+ 166 01dc 31C0     		xorl	%eax, %eax
+ 167 01de E8000000 		call	debugprint@PLT
+ 167      00
+ 168 01e3 EB96     		jmp	.L1
+ 169              	.L26:
+ 170 01e5 488D3D00 		leaq	.LC0(%rip), %rdi
+ 170      000000
+ 171 01ec E8000000 		call	endprogram@PLT
+ 171      00
+ 172 01f1 31C9     		xorl	%ecx, %ecx
+ 173 01f3 890C2500 		movl	%ecx, 0
+ 173      000000
+ 174 01fa EBD7     		jmp	.L14
+ 175              	.L23:
+ 176 01fc 488D3D00 		leaq	.LC0(%rip), %rdi
+ 176      000000
+ 177 0203 E8000000 		call	endprogram@PLT
+ 177      00
+ 178 0208 44892425 		movl	%r12d, 0
+ 178      00000000 
+ 179 0210 488B5424 		movq	24(%rsp), %rdx
+ 179      18
+ 180 0215 E94BFEFF 		jmp	.L5
+ 180      FF
+ 181              		.cfi_endproc
+ 182              	.LFE56:
+ 184 021a 660F1F44 		.p2align 4
+ 184      0000
+ 185              		.globl	profile_begin
+ 187              	profile_begin:
+ 188              	.LFB57:
+ 189              		.cfi_startproc
+ 190 0220 4863F6   		movslq	%esi, %rsi
+ 191 0223 48C1E605 		salq	$5, %rsi
+ 192 0227 8B7C3E10 		movl	16(%rsi,%rdi), %edi
+ 193 022b 85FF     		testl	%edi, %edi
+ 194 022d 7901     		jns	.L30
+ 195 022f C3       		ret
+ 196              		.p2align 4,,10
+ 197              		.p2align 3
+ 198              	.L30:
+ 199 0230 BA010000 		movl	$1, %edx
+ 199      00
+ 200 0235 BE002400 		movl	$9216, %esi
+ 200      00
+ 201 023a 31C0     		xorl	%eax, %eax
+ 202 023c E9000000 		jmp	ioctl@PLT
+ 202      00
+ 203              		.cfi_endproc
+ 204              	.LFE57:
+ 206 0241 66662E0F 		.p2align 4
+ 206      1F840000 
+ 206      0000000F 
+ 206      1F4000
+ 207              		.globl	profile_end
+ 209              	profile_end:
+ 210              	.LFB58:
+ 211              		.cfi_startproc
+ 212 0250 4863F6   		movslq	%esi, %rsi
+ 213 0253 48C1E605 		salq	$5, %rsi
+ 214 0257 8B7C3E10 		movl	16(%rsi,%rdi), %edi
+ 215 025b 85FF     		testl	%edi, %edi
+ 216 025d 7901     		jns	.L34
+ 217 025f C3       		ret
+ 218              		.p2align 4,,10
+ 219              		.p2align 3
+ 220              	.L34:
+ 221 0260 BA010000 		movl	$1, %edx
+ 221      00
+ 222 0265 BE012400 		movl	$9217, %esi
+ 222      00
+ 223 026a 31C0     		xorl	%eax, %eax
+ 224 026c E9000000 		jmp	ioctl@PLT
+ 224      00
+ 225              		.cfi_endproc
+ 226              	.LFE58:
+ 228              		.section	.rodata.str1.8
+ 229 009f 00       		.align 8
+ 230              	.LC4:
+ 231 00a0 0A506572 		.string	"\nPer stage counters, per sample and channel over %llu samples\n"
+ 231      20737461 
+ 231      67652063 
+ 231      6F756E74 
+ 231      6572732C 
+ 232              		.section	.rodata.str1.1,"aMS",@progbits,1
+ 233              	.LC5:
+ 234 0000 49504300 		.string	"IPC"
+ 235              	.LC6:
+ 236 0004 696E7374 		.string	"instr"
+ 236      7200
+ 237              	.LC7:
+ 238 000a 6379636C 		.string	"cycles"
+ 238      657300
+ 239              	.LC8:
+ 240 0011 73746167 		.string	"stage"
+ 240      6500
+ 241              		.section	.rodata.str1.8
+ 242 00df 00       		.align 8
+ 243              	.LC9:
+ 244 00e0 252D3332 		.string	"%-32s %12s %12s %12s %12s %12s %12s\n"
+ 244      73202531 
+ 244      32732025 
+ 244      31327320 
+ 244      25313273 
+ 245              		.section	.rodata.str1.1
+ 246              	.LC10:
+ 247 0017 6272206D 		.string	"br miss"
+ 247      69737300 
+ 248              	.LC11:
+ 249 001f 4C4C4320 		.string	"LLC miss"
+ 249      6D697373 
+ 249      00
+ 250              	.LC12:
+ 251 0028 4C314420 		.string	"L1D miss"
+ 251      6D697373 
+ 251      00
+ 252              	.LC14:
+ 253 0031 252D3332 		.string	"%-32.32s "
+ 253      2E333273 
+ 253      2000
+ 254              	.LC16:
+ 255 003b 6E2F6100 		.string	"n/a"
+ 256              	.LC17:
+ 257 003f 20253132 		.string	" %12s"
+ 257      7300
+ 258              	.LC18:
+ 259 0045 20253132 		.string	" %12.3f"
+ 259      2E336600 
+ 260              	.LC19:
+ 261 004d 20253132 		.string	" %12.2f"
+ 261      2E326600 
+ 262              	.LC20:
+ 263 0055 20253132 		.string	" %12.5f"
+ 263      2E356600 
+ 264              	.LC21:
+ 265 005d 0A00     		.string	"\n"
+ 266              		.text
+ 267 0271 66662E0F 		.p2align 4
+ 267      1F840000 
+ 267      0000000F 
+ 267      1F4000
+ 268              		.globl	profile_report
+ 270              	profile_report:
+ 271              	.LFB61:
+ 272              		.cfi_startproc
+ 273 0280 4157     		pushq	%r15
+ 274              		.cfi_def_cfa_offset 16
+ 275              		.cfi_offset 15, -16
+ 276 0282 4889F2   		movq	%rsi, %rdx
+ 277 0285 31C0     		xorl	%eax, %eax
+ 278 0287 4156     		pushq	%r14
+ 279              		.cfi_def_cfa_offset 24
+ 280              		.cfi_offset 14, -24
+ 281 0289 4989F6   		movq	%rsi, %r14
+ 282 028c 488D3500 		leaq	.LC4(%rip), %rsi
+ 282      000000
+ 283 0293 4155     		pushq	%r13
+ 284              		.cfi_def_cfa_offset 32
+ 285              		.cfi_offset 13, -32
+ 286 0295 4989FD   		movq	%rdi, %r13
+ 287 0298 31FF     		xorl	%edi, %edi
+ 288 029a 4154     		pushq	%r12
+ 289              		.cfi_def_cfa_offset 40
+ 290              		.cfi_offset 12, -40
+ 291 029c 55       		pushq	%rbp
+ 292              		.cfi_def_cfa_offset 48
+ 293              		.cfi_offset 6, -48
+ 294 029d 53       		pushq	%rbx
+ 295              		.cfi_def_cfa_offset 56
+ 296              		.cfi_offset 3, -56
+ 297 029e 4881EC88 		subq	$136, %rsp
+ 297      000000
+ 298              		.cfi_def_cfa_offset 192
+ 299 02a5 E8000000 		call	debugprint@PLT
+ 299      00
+ 300 02aa 4883EC08 		subq	$8, %rsp
+ 301              		.cfi_def_cfa_offset 200
+ 302 02ae 31FF     		xorl	%edi, %edi
+ 303 02b0 488D0500 		leaq	.LC10(%rip), %rax
+ 303      000000
+ 304 02b7 50       		pushq	%rax
+ 305              		.cfi_def_cfa_offset 208
+ 306 02b8 488D0500 		leaq	.LC11(%rip), %rax
+ 306      000000
+ 307 02bf 4C8D0D00 		leaq	.LC5(%rip), %r9
+ 307      000000
+ 308 02c6 50       		pushq	%rax
+ 309              		.cfi_def_cfa_offset 216
+ 310 02c7 488D0500 		leaq	.LC12(%rip), %rax
+ 310      000000
+ 311 02ce 4C8D0500 		leaq	.LC6(%rip), %r8
+ 311      000000
+ 312 02d5 50       		pushq	%rax
+ 313              		.cfi_def_cfa_offset 224
+ 314 02d6 488D0D00 		leaq	.LC7(%rip), %rcx
+ 314      000000
+ 315 02dd 31C0     		xorl	%eax, %eax
+ 316 02df 488D1500 		leaq	.LC8(%rip), %rdx
+ 316      000000
+ 317 02e6 488D3500 		leaq	.LC9(%rip), %rsi
+ 317      000000
+ 318 02ed E8000000 		call	debugprint@PLT
+ 318      00
+ 319 02f2 418B4500 		movl	0(%r13), %eax
+ 320 02f6 4883C420 		addq	$32, %rsp
+ 321              		.cfi_def_cfa_offset 192
+ 322 02fa 85C0     		testl	%eax, %eax
+ 323 02fc 0F8E2A02 		jle	.L85
+ 323      0000
+ 324 0302 C5F157C9 		vxorpd	%xmm1, %xmm1, %xmm1
+ 325 0306 4C89EB   		movq	%r13, %rbx
+ 326 0309 488D6C24 		leaq	80(%rsp), %rbp
+ 326      50
+ 327 030e 4531E4   		xorl	%r12d, %r12d
+ 328 0311 62D1F708 		vcvtusi2sdq	%r14, %xmm1, %xmm0
+ 328      7BC6
+ 329 0317 4C8D3D00 		leaq	.LC14(%rip), %r15
+ 329      000000
+ 330 031e C5FB1144 		vmovsd	%xmm0, 40(%rsp)
+ 330      2428
+ 331              		.p2align 4,,10
+ 332 0324 0F1F4000 		.p2align 3
+ 333              	.L37:
+ 334 0328 4531F6   		xorl	%r14d, %r14d
+ 335 032b EB5C     		jmp	.L41
+ 336 032d 0F1F00   		.p2align 4,,10
+ 337              		.p2align 3
+ 338              	.L38:
+ 339 0330 488D7424 		leaq	48(%rsp), %rsi
+ 339      30
+ 340 0335 BA180000 		movl	$24, %edx
+ 340      00
+ 341 033a E8000000 		call	read@PLT
+ 341      00
+ 342 033f 4883F818 		cmpq	$24, %rax
+ 343 0343 754D     		jne	.L40
+ 344 0345 488B4424 		movq	64(%rsp), %rax
+ 344      40
+ 345 034a 4885C0   		testq	%rax, %rax
+ 346 034d 7443     		je	.L40
+ 347 034f C5E957D2 		vxorpd	%xmm2, %xmm2, %xmm2
+ 348 0353 62F1EF08 		vcvtusi2sdq	56(%rsp), %xmm2, %xmm1
+ 348      7B4C2407 
+ 349 035b 62F1EF08 		vcvtusi2sdq	48(%rsp), %xmm2, %xmm0
+ 349      7B442406 
+ 350 0363 C5FB59C1 		vmulsd	%xmm1, %xmm0, %xmm0
+ 351 0367 62F1EF08 		vcvtusi2sdq	%rax, %xmm2, %xmm1
+ 351      7BC8
+ 352 036d C5FB5EC1 		vdivsd	%xmm1, %xmm0, %xmm0
+ 353              		.p2align 4,,10
+ 354 0371 0F1F8000 		.p2align 3
+ 354      000000
+ 355              	.L39:
+ 356 0378 C4A17B11 		vmovsd	%xmm0, 0(%rbp,%r14,8)
+ 356      44F500
+ 357 037f 4983C601 		addq	$1, %r14
+ 358 0383 4983FE05 		cmpq	$5, %r14
+ 359 0387 7417     		je	.L87
+ 360              	.L41:
+ 361 0389 428B7CB3 		movl	20(%rbx,%r14,4), %edi
+ 361      14
+ 362 038e 85FF     		testl	%edi, %edi
+ 363 0390 799E     		jns	.L38
+ 364              	.L40:
+ 365 0392 488B0500 		movq	.LC3(%rip), %rax
+ 365      000000
+ 366 0399 C4E1F96E 		vmovq	%rax, %xmm0
+ 366      C0
+ 367 039e EBD8     		jmp	.L39
+ 368              		.p2align 4,,10
+ 369              		.p2align 3
+ 370              	.L87:
+ 371 03a0 C5FB1044 		vmovsd	80(%rsp), %xmm0
+ 371      2450
+ 372 03a6 C5D957E4 		vxorpd	%xmm4, %xmm4, %xmm4
+ 373 03aa C5FB105C 		vmovsd	88(%rsp), %xmm3
+ 373      2458
+ 374 03b0 C5F92FC4 		vcomisd	%xmm4, %xmm0
+ 375 03b4 C5FB115C 		vmovsd	%xmm3, 24(%rsp)
+ 375      2418
+ 376 03ba 0F868001 		jbe	.L78
+ 376      0000
+ 377 03c0 C5F92FDC 		vcomisd	%xmm4, %xmm3
+ 378 03c4 0F827601 		jb	.L78
+ 378      0000
+ 379 03ca C5E35EF8 		vdivsd	%xmm0, %xmm3, %xmm7
+ 380 03ce C5FB117C 		vmovsd	%xmm7, 16(%rsp)
+ 380      2410
+ 381              	.L42:
+ 382 03d4 488B5308 		movq	8(%rbx), %rdx
+ 383 03d8 31FF     		xorl	%edi, %edi
+ 384 03da 31C0     		xorl	%eax, %eax
+ 385 03dc 4C89FE   		movq	%r15, %rsi
+ 386 03df C5FB1144 		vmovsd	%xmm0, 32(%rsp)
+ 386      2420
+ 387 03e5 E8000000 		call	debugprint@PLT
+ 387      00
+ 388 03ea C5FB1044 		vmovsd	32(%rsp), %xmm0
+ 388      2420
+ 389 03f0 C5D957E4 		vxorpd	%xmm4, %xmm4, %xmm4
+ 390 03f4 C5FB1035 		vmovsd	.LC15(%rip), %xmm6
+ 390      00000000 
+ 391 03fc C5CB5E6C 		vdivsd	40(%rsp), %xmm6, %xmm5
+ 391      2428
+ 392 0402 C5FB116C 		vmovsd	%xmm5, 8(%rsp)
+ 392      2408
+ 393 0408 C5F92FE0 		vcomisd	%xmm0, %xmm4
+ 394 040c 0F87A601 		ja	.L88
+ 394      0000
+ 395 0412 C5FB5944 		vmulsd	8(%rsp), %xmm0, %xmm0
+ 395      2408
+ 396 0418 31FF     		xorl	%edi, %edi
+ 397 041a B8010000 		movl	$1, %eax
+ 397      00
+ 398 041f 488D3500 		leaq	.LC18(%rip), %rsi
+ 398      000000
+ 399 0426 E8000000 		call	debugprint@PLT
+ 399      00
+ 400 042b C5D157ED 		vxorpd	%xmm5, %xmm5, %xmm5
+ 401 042f C5F92F6C 		vcomisd	24(%rsp), %xmm5
+ 401      2418
+ 402 0435 0F87A401 		ja	.L89
+ 402      0000
+ 403              	.L80:
+ 404 043b C5FB1074 		vmovsd	8(%rsp), %xmm6
+ 404      2408
+ 405 0441 C5CB5944 		vmulsd	24(%rsp), %xmm6, %xmm0
+ 405      2418
+ 406 0447 31FF     		xorl	%edi, %edi
+ 407 0449 488D3500 		leaq	.LC18(%rip), %rsi
+ 407      000000
+ 408 0450 B8010000 		movl	$1, %eax
+ 408      00
+ 409 0455 E8000000 		call	debugprint@PLT
+ 409      00
+ 410 045a C5C157FF 		vxorpd	%xmm7, %xmm7, %xmm7
+ 411 045e C5F92F7C 		vcomisd	16(%rsp), %xmm7
+ 411      2410
+ 412 0464 0F879C01 		ja	.L90
+ 412      0000
+ 413              	.L81:
+ 414 046a C5FB1044 		vmovsd	16(%rsp), %xmm0
+ 414      2410
+ 415 0470 488D3500 		leaq	.LC19(%rip), %rsi
+ 415      000000
+ 416 0477 31FF     		xorl	%edi, %edi
+ 417 0479 B8010000 		movl	$1, %eax
+ 417      00
+ 418 047e E8000000 		call	debugprint@PLT
+ 418      00
+ 419              	.L53:
+ 420 0483 C5FB1044 		vmovsd	96(%rsp), %xmm0
+ 420      2460
+ 421 0489 C5D157ED 		vxorpd	%xmm5, %xmm5, %xmm5
+ 422 048d C5F92FE8 		vcomisd	%xmm0, %xmm5
+ 423 0491 0F87E100 		ja	.L91
+ 423      0000
+ 424 0497 C5FB5944 		vmulsd	8(%rsp), %xmm0, %xmm0
+ 424      2408
+ 425 049d 488D3500 		leaq	.LC20(%rip), %rsi
+ 425      000000
+ 426 04a4 31FF     		xorl	%edi, %edi
+ 427 04a6 B8010000 		movl	$1, %eax
+ 427      00
+ 428 04ab E8000000 		call	debugprint@PLT
+ 428      00
+ 429              	.L56:
+ 430 04b0 C5FB1044 		vmovsd	104(%rsp), %xmm0
+ 430      2468
+ 431 04b6 C5C957F6 		vxorpd	%xmm6, %xmm6, %xmm6
+ 432 04ba C5F92FF0 		vcomisd	%xmm0, %xmm6
+ 433 04be 0F879400 		ja	.L92
+ 433      0000
+ 434 04c4 C5FB5944 		vmulsd	8(%rsp), %xmm0, %xmm0
+ 434      2408
+ 435 04ca 488D3500 		leaq	.LC20(%rip), %rsi
+ 435      000000
+ 436 04d1 31FF     		xorl	%edi, %edi
+ 437 04d3 B8010000 		movl	$1, %eax
+ 437      00
+ 438 04d8 E8000000 		call	debugprint@PLT
+ 438      00
+ 439              	.L59:
+ 440 04dd C5FB1044 		vmovsd	112(%rsp), %xmm0
+ 440      2470
+ 441 04e3 C5C157FF 		vxorpd	%xmm7, %xmm7, %xmm7
+ 442 04e7 C5F92FF8 		vcomisd	%xmm0, %xmm7
+ 443 04eb 0F87A700 		ja	.L93
+ 443      0000
+ 444 04f1 C5FB5944 		vmulsd	8(%rsp), %xmm0, %xmm0
+ 444      2408
+ 445 04f7 488D3500 		leaq	.LC20(%rip), %rsi
+ 445      000000
+ 446 04fe 31FF     		xorl	%edi, %edi
+ 447 0500 B8010000 		movl	$1, %eax
+ 447      00
+ 448 0505 E8000000 		call	debugprint@PLT
+ 448      00
+ 449              	.L62:
+ 450 050a 488D3500 		leaq	.LC21(%rip), %rsi
+ 450      000000
+ 451 0511 31FF     		xorl	%edi, %edi
+ 452 0513 31C0     		xorl	%eax, %eax
+ 453 0515 4183C401 		addl	$1, %r12d
+ 454 0519 E8000000 		call	debugprint@PLT
+ 454      00
+ 455 051e 4883C320 		addq	$32, %rbx
+ 456 0522 45396500 		cmpl	%r12d, 0(%r13)
+ 457 0526 0F8FFCFD 		jg	.L37
+ 457      FFFF
+ 458              	.L85:
+ 459 052c 4881C488 		addq	$136, %rsp
+ 459      000000
+ 460              		.cfi_remember_state
+ 461              		.cfi_def_cfa_offset 56
+ 462 0533 5B       		popq	%rbx
+ 463              		.cfi_def_cfa_offset 48
+ 464 0534 5D       		popq	%rbp
+ 465              		.cfi_def_cfa_offset 40
+ 466 0535 415C     		popq	%r12
+ 467              		.cfi_def_cfa_offset 32
+ 468 0537 415D     		popq	%r13
+ 469              		.cfi_def_cfa_offset 24
+ 470 0539 415E     		popq	%r14
+ 471              		.cfi_def_cfa_offset 16
+ 472 053b 415F     		popq	%r15
+ 473              		.cfi_def_cfa_offset 8
+ 474 053d C3       		ret
+ 475 053e 6690     		.p2align 4,,10
+ 476              		.p2align 3
+ 477              	.L78:
+ 478              		.cfi_restore_state
+ 479 0540 488B0500 		movq	.LC3(%rip), %rax
+ 479      000000
+ 480 0547 48894424 		movq	%rax, 16(%rsp)
+ 480      10
+ 481 054c E983FEFF 		jmp	.L42
+ 481      FF
+ 482              		.p2align 4,,10
+ 483 0551 0F1F8000 		.p2align 3
+ 483      000000
+ 484              	.L92:
+ 485 0558 488D1500 		leaq	.LC16(%rip), %rdx
+ 485      000000
+ 486 055f 488D3500 		leaq	.LC17(%rip), %rsi
+ 486      000000
+ 487 0566 31FF     		xorl	%edi, %edi
+ 488 0568 31C0     		xorl	%eax, %eax
+ 489 056a E8000000 		call	debugprint@PLT
+ 489      00
+ 490 056f E969FFFF 		jmp	.L59
+ 490      FF
+ 491              		.p2align 4,,10
+ 492 0574 0F1F4000 		.p2align 3
+ 493              	.L91:
+ 494 0578 488D1500 		leaq	.LC16(%rip), %rdx
+ 494      000000
+ 495 057f 488D3500 		leaq	.LC17(%rip), %rsi
+ 495      000000
+ 496 0586 31FF     		xorl	%edi, %edi
+ 497 0588 31C0     		xorl	%eax, %eax
+ 498 058a E8000000 		call	debugprint@PLT
+ 498      00
+ 499 058f E91CFFFF 		jmp	.L56
+ 499      FF
+ 500              		.p2align 4,,10
+ 501 0594 0F1F4000 		.p2align 3
+ 502              	.L93:
+ 503 0598 488D1500 		leaq	.LC16(%rip), %rdx
+ 503      000000
+ 504 059f 488D3500 		leaq	.LC17(%rip), %rsi
+ 504      000000
+ 505 05a6 31FF     		xorl	%edi, %edi
+ 506 05a8 31C0     		xorl	%eax, %eax
+ 507 05aa E8000000 		call	debugprint@PLT
+ 507      00
+ 508 05af E956FFFF 		jmp	.L62
+ 508      FF
+ 509              		.p2align 4,,10
+ 510 05b4 0F1F4000 		.p2align 3
+ 511              	.L88:
+ 512 05b8 31FF     		xorl	%edi, %edi
+ 513 05ba 31C0     		xorl	%eax, %eax
+ 514 05bc 488D1500 		leaq	.LC16(%rip), %rdx
+ 514      000000
+ 515 05c3 488D3500 		leaq	.LC17(%rip), %rsi
+ 515      000000
+ 516 05ca E8000000 		call	debugprint@PLT
+ 516      00
+ 517 05cf C5D157ED 		vxorpd	%xmm5, %xmm5, %xmm5
+ 518 05d3 C5F92F6C 		vcomisd	24(%rsp), %xmm5
+ 518      2418
+ 519 05d9 0F865CFE 		jbe	.L80
+ 519      FFFF
+ 520              	.L89:
+ 521 05df 31FF     		xorl	%edi, %edi
+ 522 05e1 31C0     		xorl	%eax, %eax
+ 523 05e3 488D1500 		leaq	.LC16(%rip), %rdx
+ 523      000000
+ 524 05ea 488D3500 		leaq	.LC17(%rip), %rsi
+ 524      000000
+ 525 05f1 E8000000 		call	debugprint@PLT
+ 525      00
+ 526 05f6 C5C157FF 		vxorpd	%xmm7, %xmm7, %xmm7
+ 527 05fa C5F92F7C 		vcomisd	16(%rsp), %xmm7
+ 527      2410
+ 528 0600 0F8664FE 		jbe	.L81
+ 528      FFFF
+ 529              	.L90:
+ 530 0606 488D1500 		leaq	.LC16(%rip), %rdx
+ 530      000000
+ 531 060d 488D3500 		leaq	.LC17(%rip), %rsi
+ 531      000000
+ 532 0614 31FF     		xorl	%edi, %edi
+ 533 0616 31C0     		xorl	%eax, %eax
+ 534 0618 E8000000 		call	debugprint@PLT
+ 534      00
+ 535 061d E961FEFF 		jmp	.L53
+ 535      FF
+ 536              		.cfi_endproc
+ 537              	.LFE61:
+ 539 0622 66662E0F 		.p2align 4
+ 539      1F840000 
+ 539      0000000F 
+ 539      1F00
+ 540              		.globl	profile_destroy
+ 542              	profile_destroy:
+ 543              	.LFB62:
+ 544              		.cfi_startproc
+ 545 0630 4885FF   		testq	%rdi, %rdi
+ 546 0633 7458     		je	.L101
+ 547 0635 4155     		pushq	%r13
+ 548              		.cfi_def_cfa_offset 16
+ 549              		.cfi_offset 13, -16
+ 550 0637 4989FD   		movq	%rdi, %r13
+ 551 063a 4154     		pushq	%r12
+ 552              		.cfi_def_cfa_offset 24
+ 553              		.cfi_offset 12, -24
+ 554 063c 55       		pushq	%rbp
+ 555              		.cfi_def_cfa_offset 32
+ 556              		.cfi_offset 6, -32
+ 557 063d 53       		pushq	%rbx
+ 558              		.cfi_def_cfa_offset 40
+ 559              		.cfi_offset 3, -40
+ 560 063e 4883EC08 		subq	$8, %rsp
+ 561              		.cfi_def_cfa_offset 48
+ 562 0642 8B07     		movl	(%rdi), %eax
+ 563 0644 85C0     		testl	%eax, %eax
+ 564 0646 7E33     		jle	.L96
+ 565 0648 488D6F14 		leaq	20(%rdi), %rbp
+ 566 064c 4531E4   		xorl	%r12d, %r12d
+ 567 064f 90       		.p2align 4,,10
+ 568              		.p2align 3
+ 569              	.L97:
+ 570 0650 488D5DEC 		leaq	-20(%rbp), %rbx
+ 571              		.p2align 4,,10
+ 572 0654 0F1F4000 		.p2align 3
+ 573              	.L99:
+ 574 0658 8B7B14   		movl	20(%rbx), %edi
+ 575 065b 85FF     		testl	%edi, %edi
+ 576 065d 7805     		js	.L98
+ 577 065f E8000000 		call	close@PLT
+ 577      00
+ 578              	.L98:
+ 579 0664 4883C304 		addq	$4, %rbx
+ 580 0668 4839EB   		cmpq	%rbp, %rbx
+ 581 066b 75EB     		jne	.L99
+ 582 066d 4183C401 		addl	$1, %r12d
+ 583 0671 4883C520 		addq	$32, %rbp
+ 584 0675 45396500 		cmpl	%r12d, 0(%r13)
+ 585 0679 7FD5     		jg	.L97
+ 586              	.L96:
+ 587 067b 4883C408 		addq	$8, %rsp
+ 588              		.cfi_def_cfa_offset 40
+ 589 067f 4C89EF   		movq	%r13, %rdi
+ 590 0682 5B       		popq	%rbx
+ 591              		.cfi_restore 3
+ 592              		.cfi_def_cfa_offset 32
+ 593 0683 5D       		popq	%rbp
+ 594              		.cfi_restore 6
+ 595              		.cfi_def_cfa_offset 24
+ 596 0684 415C     		popq	%r12
+ 597              		.cfi_restore 12
+ 598              		.cfi_def_cfa_offset 16
+ 599 0686 415D     		popq	%r13
+ 600              		.cfi_restore 13
+ 601              		.cfi_def_cfa_offset 8
+ 602 0688 E9000000 		jmp	free@PLT
+ 602      00
+ 603              	.L101:
+ 604 068d C3       		ret
+ 605              		.cfi_endproc
+ 606              	.LFE62:
+ 608              		.section	.rodata
+ 609              		.align 8
+ 612              	__func__.0:
+ 613 0000 70726F66 		.string	"profile_create"
+ 613      696C655F 
+ 613      63726561 
+ 613      746500
+ 614              		.section	.rodata.str1.1
+ 615              	.LC22:
+ 616 005f 696E7374 		.string	"instructions"
+ 616      72756374 
+ 616      696F6E73 
+ 616      00
+ 617              	.LC23:
+ 618 006c 4C314420 		.string	"L1D misses"
+ 618      6D697373 
+ 618      657300
+ 619              	.LC24:
+ 620 0077 4C4C4320 		.string	"LLC misses"
+ 620      6D697373 
+ 620      657300
+ 621              	.LC25:
+ 622 0082 6272616E 		.string	"branch misses"
+ 622      6368206D 
+ 622      69737365 
+ 622      7300
+ 623              		.section	.data.rel.ro.local,"aw"
+ 624              		.align 32
+ 627              	counters:
+ 628 0000 00000000 		.quad	.LC7
+ 628      00000000 
+ 629 0008 00000000 		.long	0
+ 630 000c 00000000 		.zero	4
+ 631 0010 00000000 		.quad	0
+ 631      00000000 
+ 632 0018 00000000 		.quad	.LC22
+ 632      00000000 
+ 633 0020 00000000 		.long	0
+ 634 0024 00000000 		.zero	4
+ 635 0028 01000000 		.quad	1
+ 635      00000000 
+ 636 0030 00000000 		.quad	.LC23
+ 636      00000000 
+ 637 0038 03000000 		.long	3
+ 638 003c 00000000 		.zero	4
+ 639 0040 00000100 		.quad	65536
+ 639      00000000 
+ 640 0048 00000000 		.quad	.LC24
+ 640      00000000 
+ 641 0050 03000000 		.long	3
+ 642 0054 00000000 		.zero	4
+ 643 0058 02000100 		.quad	65538
+ 643      00000000 
+ 644 0060 00000000 		.quad	.LC25
+ 644      00000000 
+ 645 0068 00000000 		.long	0
+ 646 006c 00000000 		.zero	4
+ 647 0070 05000000 		.quad	5
+ 647      00000000 
+ 648              		.section	.rodata.cst8,"aM",@progbits,8
+ 649              		.align 8
+ 650              	.LC3:
+ 651 0000 00000000 		.long	0
+ 652 0004 0000F0BF 		.long	-1074790400
+ 653              		.align 8
+ 654              	.LC15:
+ 655 0008 00000000 		.long	0
+ 656 000c 0000F03F 		.long	1072693248
+ 657              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 658              		.section	.note.GNU-stack,"",@progbits
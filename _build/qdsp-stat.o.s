@@ -0,0 +1,634 @@
+   1              		.file	"qdsp-stat.c"
+   2              		.text
+   3              		.section	.rodata.str1.1,"aMS",@progbits,1
+   4              	.LC0:
+   5 0000 5C256300 		.string	"\\%c"
+   6              	.LC1:
+   7 0004 5C752530 		.string	"\\u%04x"
+   7      347800
+   8              		.text
+   9              		.p2align 4
+  11              	print_json_string:
+  12              	.LFB18:
+  13              		.cfi_startproc
+  14 0000 4155     		pushq	%r13
+  15              		.cfi_def_cfa_offset 16
+  16              		.cfi_offset 13, -16
+  17 0002 4C8D2D00 		leaq	.LC0(%rip), %r13
+  17      000000
+  18 0009 4154     		pushq	%r12
+  19              		.cfi_def_cfa_offset 24
+  20              		.cfi_offset 12, -24
+  21 000b 4C8D2500 		leaq	.LC1(%rip), %r12
+  21      000000
+  22 0012 55       		pushq	%rbp
+  23              		.cfi_def_cfa_offset 32
+  24              		.cfi_offset 6, -32
+  25 0013 53       		pushq	%rbx
+  26              		.cfi_def_cfa_offset 40
+  27              		.cfi_offset 3, -40
+  28 0014 4889FB   		movq	%rdi, %rbx
+  29 0017 BF220000 		movl	$34, %edi
+  29      00
+  30 001c 4883EC08 		subq	$8, %rsp
+  31              		.cfi_def_cfa_offset 48
+  32 0020 488B2D00 		movq	stdout@GOTPCREL(%rip), %rbp
+  32      000000
+  33 0027 488B7500 		movq	0(%rbp), %rsi
+  34 002b E8000000 		call	putc@PLT
+  34      00
+  35 0030 0FB603   		movzbl	(%rbx), %eax
+  36 0033 84C0     		testb	%al, %al
+  37 0035 7521     		jne	.L2
+  38 0037 EB42     		jmp	.L7
+  39 0039 0F1F8000 		.p2align 4,,10
+  39      000000
+  40              		.p2align 3
+  41              	.L14:
+  42 0040 89FE     		movl	%edi, %esi
+  43 0042 31C0     		xorl	%eax, %eax
+  44 0044 4C89E7   		movq	%r12, %rdi
+  45 0047 E8000000 		call	printf@PLT
+  45      00
+  46              	.L5:
+  47 004c 0FB64301 		movzbl	1(%rbx), %eax
+  48 0050 4883C301 		addq	$1, %rbx
+  49 0054 84C0     		testb	%al, %al
+  50 0056 7423     		je	.L7
+  51              	.L2:
+  52 0058 0FBEF8   		movsbl	%al, %edi
+  53 005b 3C22     		cmpb	$34, %al
+  54 005d 7439     		je	.L8
+  55 005f 3C5C     		cmpb	$92, %al
+  56 0061 7435     		je	.L8
+  57 0063 3C1F     		cmpb	$31, %al
+  58 0065 76D9     		jbe	.L14
+  59 0067 488B7500 		movq	0(%rbp), %rsi
+  60 006b 4883C301 		addq	$1, %rbx
+  61 006f E8000000 		call	putc@PLT
+  61      00
+  62 0074 0FB603   		movzbl	(%rbx), %eax
+  63 0077 84C0     		testb	%al, %al
+  64 0079 75DD     		jne	.L2
+  65              	.L7:
+  66 007b 488B7500 		movq	0(%rbp), %rsi
+  67 007f 4883C408 		addq	$8, %rsp
+  68              		.cfi_remember_state
+  69              		.cfi_def_cfa_offset 40
+  70 0083 BF220000 		movl	$34, %edi
+  70      00
+  71 0088 5B       		popq	%rbx
+  72              		.cfi_def_cfa_offset 32
+  73 0089 5D       		popq	%rbp
+  74              		.cfi_def_cfa_offset 24
+  75 008a 415C     		popq	%r12
+  76              		.cfi_def_cfa_offset 16
+  77 008c 415D     		popq	%r13
+  78              		.cfi_def_cfa_offset 8
+  79 008e E9000000 		jmp	putc@PLT
+  79      00
+  80              		.p2align 4,,10
+  81 0093 0F1F4400 		.p2align 3
+  81      00
+  82              	.L8:
+  83              		.cfi_restore_state
+  84 0098 89FE     		movl	%edi, %esi
+  85 009a 31C0     		xorl	%eax, %eax
+  86 009c 4C89EF   		movq	%r13, %rdi
+  87 009f E8000000 		call	printf@PLT
+  87      00
+  88 00a4 EBA6     		jmp	.L5
+  89              		.cfi_endproc
+  90              	.LFE18:
+  92              		.section	.rodata.str1.8,"aMS",@progbits,1
+  93              		.align 8
+  94              	.LC2:
+  95 0000 71647370 		.string	"qdsp-stat [-j] [-w seconds] name\n\n"
+  95      2D737461 
+  95      74205B2D 
+  95      6A5D205B 
+  95      2D772073 
+  96              		.section	.rodata.str1.1
+  97              	.LC3:
+  98 000b 66393735 		.string	"f975-dirty"
+  98      2D646972 
+  98      747900
+  99              	.LC4:
+ 100 0016 56657273 		.string	"Version: %s\n"
+ 100      696F6E3A 
+ 100      2025730A 
+ 100      00
+ 101              		.section	.rodata.str1.8
+ 102 0023 00000000 		.align 8
+ 102      00
+ 103              	.LC5:
+ 104 0028 44756D70 		.string	"Dumps the telemetry published by jack-qdsp -m name\n"
+ 104      73207468 
+ 104      65207465 
+ 104      6C656D65 
+ 104      74727920 
+ 105              		.section	.rodata.str1.1
+ 106              	.LC6:
+ 107 0023 202D6A20 		.string	" -j JSON output\n"
+ 107      4A534F4E 
+ 107      206F7574 
+ 107      7075740A 
+ 107      00
+ 108              	.LC7:
+ 109 0034 202D7720 		.string	" -w repeat every w seconds\n"
+ 109      72657065 
+ 109      61742065 
+ 109      76657279 
+ 109      20772073 
+ 110              		.text
+ 111 00a6 662E0F1F 		.p2align 4
+ 111      84000000 
+ 111      0000
+ 112              		.globl	print_help
+ 114              	print_help:
+ 115              	.LFB17:
+ 116              		.cfi_startproc
+ 117 00b0 53       		pushq	%rbx
+ 118              		.cfi_def_cfa_offset 16
+ 119              		.cfi_offset 3, -16
+ 120 00b1 488B1D00 		movq	stderr@GOTPCREL(%rip), %rbx
+ 120      000000
+ 121 00b8 BA220000 		movl	$34, %edx
+ 121      00
+ 122 00bd BE010000 		movl	$1, %esi
+ 122      00
+ 123 00c2 488D3D00 		leaq	.LC2(%rip), %rdi
+ 123      000000
+ 124 00c9 488B0B   		movq	(%rbx), %rcx
+ 125 00cc E8000000 		call	fwrite@PLT
+ 125      00
+ 126 00d1 488B3B   		movq	(%rbx), %rdi
+ 127 00d4 488D1500 		leaq	.LC3(%rip), %rdx
+ 127      000000
+ 128 00db 31C0     		xorl	%eax, %eax
+ 129 00dd 488D3500 		leaq	.LC4(%rip), %rsi
+ 129      000000
+ 130 00e4 E8000000 		call	fprintf@PLT
+ 130      00
+ 131 00e9 488B0B   		movq	(%rbx), %rcx
+ 132 00ec BA330000 		movl	$51, %edx
+ 132      00
+ 133 00f1 BE010000 		movl	$1, %esi
+ 133      00
+ 134 00f6 488D3D00 		leaq	.LC5(%rip), %rdi
+ 134      000000
+ 135 00fd E8000000 		call	fwrite@PLT
+ 135      00
+ 136 0102 488B0B   		movq	(%rbx), %rcx
+ 137 0105 BA100000 		movl	$16, %edx
+ 137      00
+ 138 010a BE010000 		movl	$1, %esi
+ 138      00
+ 139 010f 488D3D00 		leaq	.LC6(%rip), %rdi
+ 139      000000
+ 140 0116 E8000000 		call	fwrite@PLT
+ 140      00
+ 141 011b 488B0B   		movq	(%rbx), %rcx
+ 142 011e BA1B0000 		movl	$27, %edx
+ 142      00
+ 143 0123 488D3D00 		leaq	.LC7(%rip), %rdi
+ 143      000000
+ 144 012a BE010000 		movl	$1, %esi
+ 144      00
+ 145 012f E8000000 		call	fwrite@PLT
+ 145      00
+ 146 0134 31FF     		xorl	%edi, %edi
+ 147 0136 E8000000 		call	exit@PLT
+ 147      00
+ 148              		.cfi_endproc
+ 149              	.LFE17:
+ 151              		.section	.rodata.str1.1
+ 152              	.LC9:
+ 153 0050 6A773A68 		.string	"jw:h?"
+ 153      3F00
+ 154              	.LC10:
+ 155 0056 436F756C 		.string	"Could not open stats %s\n"
+ 155      64206E6F 
+ 155      74206F70 
+ 155      656E2073 
+ 155      74617473 
+ 156              	.LC12:
+ 157 006f 7B227069 		.string	"{\"pid\":%d,\"client\":"
+ 157      64223A25 
+ 157      642C2263 
+ 157      6C69656E 
+ 157      74223A00 
+ 158              	.LC13:
+ 159 0083 2C226368 		.string	",\"chain\":"
+ 159      61696E22 
+ 159      3A00
+ 160              		.section	.rodata.str1.8
+ 161 005c 00000000 		.align 8
+ 162              	.LC14:
+ 163 0060 2C226368 		.string	",\"chain_hash\":\"%016llx\",\"fs\":%u,\"nframes\":%u,\"nchannels\":%u,\"period_us\":%.3f,
+ 163      61696E5F 
+ 163      68617368 
+ 163      223A2225 
+ 163      3031366C 
+ 164              		.section	.rodata.str1.1
+ 165              	.LC15:
+ 166 008d 636C6965 		.string	"client:          %s (pid %d)\n"
+ 166      6E743A20 
+ 166      20202020 
+ 166      20202020 
+ 166      20257320 
+ 167              	.LC16:
+ 168 00ab 63686169 		.string	"chain:           %s\n"
+ 168      6E3A2020 
+ 168      20202020 
+ 168      20202020 
+ 168      2025730A 
+ 169              	.LC17:
+ 170 00c0 63686169 		.string	"chain hash:      %016llx\n"
+ 170      6E206861 
+ 170      73683A20 
+ 170      20202020 
+ 170      20253031 
+ 171              		.section	.rodata.str1.8
+ 172 011e 0000     		.align 8
+ 173              	.LC18:
+ 174 0120 666F726D 		.string	"format:          %u Hz, %u frames, %u channels\n"
+ 174      61743A20 
+ 174      20202020 
+ 174      20202020 
+ 174      20257520 
+ 175              		.section	.rodata.str1.1
+ 176              	.LC19:
+ 177 00da 70657269 		.string	"periods:         %llu\n"
+ 177      6F64733A 
+ 177      20202020 
+ 177      20202020 
+ 177      20256C6C 
+ 178              	.LC20:
+ 179 00f1 7872756E 		.string	"xruns:           %llu\n"
+ 179      733A2020 
+ 179      20202020 
+ 179      20202020 
+ 179      20256C6C 
+ 180              	.LC21:
+ 181 0108 64656164 		.string	"deadline misses: %llu\n"
+ 181      6C696E65 
+ 181      206D6973 
+ 181      7365733A 
+ 181      20256C6C 
+ 182              	.LC22:
+ 183 011f 64737020 		.string	"dsp load:        %.1f%%\n"
+ 183      6C6F6164 
+ 183      3A202020 
+ 183      20202020 
+ 183      20252E31 
+ 184              		.section	.rodata.str1.8
+ 185              		.align 8
+ 186              	.LC23:
+ 187 0150 70726F63 		.string	"process time:    last %.2f us, mean %.2f us, max %.2f us of %.2f us\n"
+ 187      65737320 
+ 187      74696D65 
+ 187      3A202020 
+ 187      206C6173 
+ 188              		.section	.text.startup,"ax",@progbits
+ 189              		.p2align 4
+ 190              		.globl	main
+ 192              	main:
+ 193              	.LFB20:
+ 194              		.cfi_startproc
+ 195 0000 4157     		pushq	%r15
+ 196              		.cfi_def_cfa_offset 16
+ 197              		.cfi_offset 15, -16
+ 198 0002 4156     		pushq	%r14
+ 199              		.cfi_def_cfa_offset 24
+ 200              		.cfi_offset 14, -24
+ 201 0004 4C8D3500 		leaq	.LC9(%rip), %r14
+ 201      000000
+ 202 000b 4155     		pushq	%r13
+ 203              		.cfi_def_cfa_offset 32
+ 204              		.cfi_offset 13, -32
+ 205 000d 4189FD   		movl	%edi, %r13d
+ 206 0010 4154     		pushq	%r12
+ 207              		.cfi_def_cfa_offset 40
+ 208              		.cfi_offset 12, -40
+ 209 0012 4989F4   		movq	%rsi, %r12
+ 210 0015 55       		pushq	%rbp
+ 211              		.cfi_def_cfa_offset 48
+ 212              		.cfi_offset 6, -48
+ 213 0016 31ED     		xorl	%ebp, %ebp
+ 214 0018 53       		pushq	%rbx
+ 215              		.cfi_def_cfa_offset 56
+ 216              		.cfi_offset 3, -56
+ 217 0019 31DB     		xorl	%ebx, %ebx
+ 218 001b 4881ECB8 		subq	$1208, %rsp
+ 218      040000
+ 219              		.cfi_def_cfa_offset 1264
+ 220              		.p2align 4,,10
+ 221 0022 660F1F44 		.p2align 3
+ 221      0000
+ 222              	.L18:
+ 223 0028 4C89F2   		movq	%r14, %rdx
+ 224 002b 4C89E6   		movq	%r12, %rsi
+ 225 002e 4489EF   		movl	%r13d, %edi
+ 226 0031 E8000000 		call	getopt@PLT
+ 226      00
+ 227 0036 83F8FF   		cmpl	$-1, %eax
+ 228 0039 7455     		je	.L43
+ 229 003b 83F86A   		cmpl	$106, %eax
+ 230 003e 7440     		je	.L31
+ 231 0040 7F16     		jg	.L20
+ 232 0042 83F83F   		cmpl	$63, %eax
+ 233 0045 7405     		je	.L21
+ 234 0047 83F868   		cmpl	$104, %eax
+ 235 004a 75DC     		jne	.L18
+ 236              	.L21:
+ 237 004c 31C0     		xorl	%eax, %eax
+ 238 004e E8000000 		call	print_help@PLT
+ 238      00
+ 239 0053 EBD3     		jmp	.L18
+ 240              		.p2align 4,,10
+ 241 0055 0F1F00   		.p2align 3
+ 242              	.L20:
+ 243 0058 83F877   		cmpl	$119, %eax
+ 244 005b 75CB     		jne	.L18
+ 245 005d 488B0500 		movq	optarg@GOTPCREL(%rip), %rax
+ 245      000000
+ 246 0064 BA0A0000 		movl	$10, %edx
+ 246      00
+ 247 0069 31F6     		xorl	%esi, %esi
+ 248 006b 488B38   		movq	(%rax), %rdi
+ 249 006e E8000000 		call	strtol@PLT
+ 249      00
+ 250 0073 89C3     		movl	%eax, %ebx
+ 251 0075 EBB1     		jmp	.L18
+ 252 0077 660F1F84 		.p2align 4,,10
+ 252      00000000 
+ 252      00
+ 253              		.p2align 3
+ 254              	.L31:
+ 255 0080 BD010000 		movl	$1, %ebp
+ 255      00
+ 256 0085 EBA1     		jmp	.L18
+ 257 0087 660F1F84 		.p2align 4,,10
+ 257      00000000 
+ 257      00
+ 258              		.p2align 3
+ 259              	.L43:
+ 260 0090 4C8B3500 		movq	optind@GOTPCREL(%rip), %r14
+ 260      000000
+ 261 0097 418B06   		movl	(%r14), %eax
+ 262 009a 83C001   		addl	$1, %eax
+ 263 009d 4439E8   		cmpl	%r13d, %eax
+ 264 00a0 7407     		je	.L25
+ 265 00a2 31C0     		xorl	%eax, %eax
+ 266 00a4 E8000000 		call	print_help@PLT
+ 266      00
+ 267              	.L25:
+ 268 00a9 496306   		movslq	(%r14), %rax
+ 269 00ac 498B3CC4 		movq	(%r12,%rax,8), %rdi
+ 270 00b0 E8000000 		call	shmstats_open@PLT
+ 270      00
+ 271 00b5 4885C0   		testq	%rax, %rax
+ 272 00b8 0F845D02 		je	.L41
+ 272      0000
+ 273 00be 4C8DB424 		leaq	176(%rsp), %r14
+ 273      B0000000 
+ 274 00c6 4C8B2500 		movq	stdout@GOTPCREL(%rip), %r12
+ 274      000000
+ 275 00cd 4C8D6C24 		leaq	16(%rsp), %r13
+ 275      10
+ 276 00d2 4C893424 		movq	%r14, (%rsp)
+ 277 00d6 4C8D7C24 		leaq	112(%rsp), %r15
+ 277      70
+ 278 00db 4989C6   		movq	%rax, %r14
+ 279 00de E9D00000 		jmp	.L26
+ 279      00
+ 280              		.p2align 4,,10
+ 281 00e3 0F1F4400 		.p2align 3
+ 281      00
+ 282              	.L44:
+ 283 00e8 89D6     		movl	%edx, %esi
+ 284 00ea 488D3D00 		leaq	.LC12(%rip), %rdi
+ 284      000000
+ 285 00f1 31C0     		xorl	%eax, %eax
+ 286 00f3 E8000000 		call	printf@PLT
+ 286      00
+ 287 00f8 4C89FF   		movq	%r15, %rdi
+ 288 00fb E8000000 		call	print_json_string
+ 288      00
+ 289 0100 488D3D00 		leaq	.LC13(%rip), %rdi
+ 289      000000
+ 290 0107 31C0     		xorl	%eax, %eax
+ 291 0109 E8000000 		call	printf@PLT
+ 291      00
+ 292 010e 488B3C24 		movq	(%rsp), %rdi
+ 293 0112 E8000000 		call	print_json_string
+ 293      00
+ 294 0117 C5C957F6 		vxorpd	%xmm6, %xmm6, %xmm6
+ 295 011b B8050000 		movl	$5, %eax
+ 295      00
+ 296 0120 488D3D00 		leaq	.LC14(%rip), %rdi
+ 296      000000
+ 297 0127 62F14F08 		vcvtusi2sdl	44(%rsp), %xmm6, %xmm0
+ 297      7B44240B 
+ 298 012f 62F1CF08 		vcvtusi2sdq	88(%rsp), %xmm6, %xmm4
+ 298      7B64240B 
+ 299 0137 C5DB5E25 		vdivsd	.LC11(%rip), %xmm4, %xmm4
+ 299      00000000 
+ 300 013f 62F1CF08 		vcvtusi2sdq	80(%rsp), %xmm6, %xmm2
+ 300      7B54240A 
+ 301 0147 C5EB5E15 		vdivsd	.LC11(%rip), %xmm2, %xmm2
+ 301      00000000 
+ 302 014f C5FB10E8 		vmovsd	%xmm0, %xmm0, %xmm5
+ 303 0153 62F1CF08 		vcvtusi2sdq	48(%rsp), %xmm6, %xmm0
+ 303      7B442406 
+ 304 015b FF742448 		pushq	72(%rsp)
+ 305              		.cfi_def_cfa_offset 1272
+ 306 015f C5FB5E05 		vdivsd	.LC11(%rip), %xmm0, %xmm0
+ 306      00000000 
+ 307 0167 FF742448 		pushq	72(%rsp)
+ 308              		.cfi_def_cfa_offset 1280
+ 309 016b C5FB104C 		vmovsd	24(%rsp), %xmm1
+ 309      2418
+ 310 0171 4C8B4C24 		movq	72(%rsp), %r9
+ 310      48
+ 311 0176 448B4424 		movl	56(%rsp), %r8d
+ 311      38
+ 312 017b 8B4C2434 		movl	52(%rsp), %ecx
+ 313 017f 8B542430 		movl	48(%rsp), %edx
+ 314 0183 C5F310D9 		vmovsd	%xmm1, %xmm1, %xmm3
+ 315 0187 C5D35E0D 		vdivsd	.LC11(%rip), %xmm5, %xmm1
+ 315      00000000 
+ 316 018f 488B7424 		movq	120(%rsp), %rsi
+ 316      78
+ 317 0194 E8000000 		call	printf@PLT
+ 317      00
+ 318 0199 498B3C24 		movq	(%r12), %rdi
+ 319 019d 58       		popq	%rax
+ 320              		.cfi_def_cfa_offset 1272
+ 321 019e 5A       		popq	%rdx
+ 322              		.cfi_def_cfa_offset 1264
+ 323 019f E8000000 		call	fflush@PLT
+ 323      00
+ 324 01a4 85DB     		testl	%ebx, %ebx
+ 325 01a6 0F8E5B01 		jle	.L30
+ 325      0000
+ 326              	.L45:
+ 327 01ac 89DF     		movl	%ebx, %edi
+ 328 01ae E8000000 		call	sleep@PLT
+ 328      00
+ 329              	.L26:
+ 330 01b3 4C89EE   		movq	%r13, %rsi
+ 331 01b6 4C89F7   		movq	%r14, %rdi
+ 332 01b9 E8000000 		call	shmstats_snapshot@PLT
+ 332      00
+ 333 01be 488B4424 		movq	56(%rsp), %rax
+ 333      38
+ 334 01c3 C5F157C9 		vxorpd	%xmm1, %xmm1, %xmm1
+ 335 01c7 4885C0   		testq	%rax, %rax
+ 336 01ca 741E     		je	.L27
+ 337 01cc C5D157ED 		vxorpd	%xmm5, %xmm5, %xmm5
+ 338 01d0 62F1D708 		vcvtusi2sdq	%rax, %xmm5, %xmm0
+ 338      7BC0
+ 339 01d6 62F1D708 		vcvtusi2sdq	96(%rsp), %xmm5, %xmm1
+ 339      7B4C240C 
+ 340 01de C5F35E0D 		vdivsd	.LC11(%rip), %xmm1, %xmm1
+ 340      00000000 
+ 341 01e6 C5F35EC8 		vdivsd	%xmm0, %xmm1, %xmm1
+ 342              	.L27:
+ 343 01ea 8B54241C 		movl	28(%rsp), %edx
+ 344 01ee C5FB114C 		vmovsd	%xmm1, 8(%rsp)
+ 344      2408
+ 345 01f4 4084ED   		testb	%bpl, %bpl
+ 346 01f7 0F85EBFE 		jne	.L44
+ 346      FFFF
+ 347 01fd 4C89FE   		movq	%r15, %rsi
+ 348 0200 488D3D00 		leaq	.LC15(%rip), %rdi
+ 348      000000
+ 349 0207 31C0     		xorl	%eax, %eax
+ 350 0209 E8000000 		call	printf@PLT
+ 350      00
+ 351 020e 488B3424 		movq	(%rsp), %rsi
+ 352 0212 488D3D00 		leaq	.LC16(%rip), %rdi
+ 352      000000
+ 353 0219 31C0     		xorl	%eax, %eax
+ 354 021b E8000000 		call	printf@PLT
+ 354      00
+ 355 0220 488B7424 		movq	104(%rsp), %rsi
+ 355      68
+ 356 0225 488D3D00 		leaq	.LC17(%rip), %rdi
+ 356      000000
+ 357 022c 31C0     		xorl	%eax, %eax
+ 358 022e E8000000 		call	printf@PLT
+ 358      00
+ 359 0233 8B4C2428 		movl	40(%rsp), %ecx
+ 360 0237 8B542424 		movl	36(%rsp), %edx
+ 361 023b 31C0     		xorl	%eax, %eax
+ 362 023d 8B742420 		movl	32(%rsp), %esi
+ 363 0241 488D3D00 		leaq	.LC18(%rip), %rdi
+ 363      000000
+ 364 0248 E8000000 		call	printf@PLT
+ 364      00
+ 365 024d 488B7424 		movq	56(%rsp), %rsi
+ 365      38
+ 366 0252 488D3D00 		leaq	.LC19(%rip), %rdi
+ 366      000000
+ 367 0259 31C0     		xorl	%eax, %eax
+ 368 025b E8000000 		call	printf@PLT
+ 368      00
+ 369 0260 488B7424 		movq	64(%rsp), %rsi
+ 369      40
+ 370 0265 488D3D00 		leaq	.LC20(%rip), %rdi
+ 370      000000
+ 371 026c 31C0     		xorl	%eax, %eax
+ 372 026e E8000000 		call	printf@PLT
+ 372      00
+ 373 0273 488B7424 		movq	72(%rsp), %rsi
+ 373      48
+ 374 0278 488D3D00 		leaq	.LC21(%rip), %rdi
+ 374      000000
+ 375 027f 31C0     		xorl	%eax, %eax
+ 376 0281 E8000000 		call	printf@PLT
+ 376      00
+ 377 0286 C5C157FF 		vxorpd	%xmm7, %xmm7, %xmm7
+ 378 028a B8010000 		movl	$1, %eax
+ 378      00
+ 379 028f 488D3D00 		leaq	.LC22(%rip), %rdi
+ 379      000000
+ 380 0296 62F14708 		vcvtusi2sdl	44(%rsp), %xmm7, %xmm0
+ 380      7B44240B 
+ 381 029e C5FB5E05 		vdivsd	.LC11(%rip), %xmm0, %xmm0
+ 381      00000000 
+ 382 02a6 E8000000 		call	printf@PLT
+ 382      00
+ 383 02ab C5C157FF 		vxorpd	%xmm7, %xmm7, %xmm7
+ 384 02af B8040000 		movl	$4, %eax
+ 384      00
+ 385 02b4 C5FB104C 		vmovsd	8(%rsp), %xmm1
+ 385      2408
+ 386 02ba 62F1C708 		vcvtusi2sdq	48(%rsp), %xmm7, %xmm3
+ 386      7B5C2406 
+ 387 02c2 488D3D00 		leaq	.LC23(%rip), %rdi
+ 387      000000
+ 388 02c9 C5E35E1D 		vdivsd	.LC11(%rip), %xmm3, %xmm3
+ 388      00000000 
+ 389 02d1 62F1C708 		vcvtusi2sdq	88(%rsp), %xmm7, %xmm2
+ 389      7B54240B 
+ 390 02d9 C5EB5E15 		vdivsd	.LC11(%rip), %xmm2, %xmm2
+ 390      00000000 
+ 391 02e1 62F1C708 		vcvtusi2sdq	80(%rsp), %xmm7, %xmm0
+ 391      7B44240A 
+ 392 02e9 C5FB5E05 		vdivsd	.LC11(%rip), %xmm0, %xmm0
+ 392      00000000 
+ 393 02f1 E8000000 		call	printf@PLT
+ 393      00
+ 394 02f6 498B3C24 		movq	(%r12), %rdi
+ 395 02fa E8000000 		call	fflush@PLT
+ 395      00
+ 396 02ff 85DB     		testl	%ebx, %ebx
+ 397 0301 0F8FA5FE 		jg	.L45
+ 397      FFFF
+ 398              	.L30:
+ 399 0307 4881C4B8 		addq	$1208, %rsp
+ 399      040000
+ 400              		.cfi_remember_state
+ 401              		.cfi_def_cfa_offset 56
+ 402 030e 31C0     		xorl	%eax, %eax
+ 403 0310 5B       		popq	%rbx
+ 404              		.cfi_def_cfa_offset 48
+ 405 0311 5D       		popq	%rbp
+ 406              		.cfi_def_cfa_offset 40
+ 407 0312 415C     		popq	%r12
+ 408              		.cfi_def_cfa_offset 32
+ 409 0314 415D     		popq	%r13
+ 410              		.cfi_def_cfa_offset 24
+ 411 0316 415E     		popq	%r14
+ 412              		.cfi_def_cfa_offset 16
+ 413 0318 415F     		popq	%r15
+ 414              		.cfi_def_cfa_offset 8
+ 415 031a C3       		ret
+ 416              	.L41:
+ 417              		.cfi_restore_state
+ 418 031b 496306   		movslq	(%r14), %rax
+ 419 031e 488D3500 		leaq	.LC10(%rip), %rsi
+ 419      000000
+ 420 0325 498B14C4 		movq	(%r12,%rax,8), %rdx
+ 421 0329 488B0500 		movq	stderr@GOTPCREL(%rip), %rax
+ 421      000000
+ 422 0330 488B38   		movq	(%rax), %rdi
+ 423 0333 31C0     		xorl	%eax, %eax
+ 424 0335 E8000000 		call	fprintf@PLT
+ 424      00
+ 425 033a BF010000 		movl	$1, %edi
+ 425      00
+ 426 033f E8000000 		call	exit@PLT
+ 426      00
+ 427              		.cfi_endproc
+ 428              	.LFE20:
+ 430              		.section	.rodata.cst8,"aM",@progbits,8
+ 431              		.align 8
+ 432              	.LC11:
+ 433 0000 00000000 		.long	0
+ 434 0004 00408F40 		.long	1083129856
+ 435              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 436              		.section	.note.GNU-stack,"",@progbits
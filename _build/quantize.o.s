@@ -0,0 +1,660 @@
+   1              		.file	"quantize.c"
+   2              		.text
+   3              		.p2align 4
+   4              		.globl	quantize_bits
+   6              	quantize_bits:
+   7              	.LFB6395:
+   8              		.cfi_startproc
+   9 0000 0FB7FF   		movzwl	%di, %edi
+  10 0003 31C0     		xorl	%eax, %eax
+  11 0005 83EF01   		subl	$1, %edi
+  12 0008 83FF04   		cmpl	$4, %edi
+  13 000b 770A     		ja	.L1
+  14 000d 488D0500 		leaq	CSWTCH.26(%rip), %rax
+  14      000000
+  15 0014 8B04B8   		movl	(%rax,%rdi,4), %eax
+  16              	.L1:
+  17 0017 C3       		ret
+  18              		.cfi_endproc
+  19              	.LFE6395:
+  21 0018 0F1F8400 		.p2align 4
+  21      00000000 
+  22              		.globl	quantize_init
+  24              	quantize_init:
+  25              	.LFB6396:
+  26              		.cfi_startproc
+  27 0020 55       		pushq	%rbp
+  28              		.cfi_def_cfa_offset 16
+  29              		.cfi_offset 6, -16
+  30 0021 C5F9EFC0 		vpxor	%xmm0, %xmm0, %xmm0
+  31 0025 4889E5   		movq	%rsp, %rbp
+  32              		.cfi_def_cfa_register 6
+  33 0028 4154     		pushq	%r12
+  34              		.cfi_offset 12, -24
+  35 002a 4189D4   		movl	%edx, %r12d
+  36 002d 4152     		pushq	%r10
+  37 002f 53       		pushq	%rbx
+  38              		.cfi_offset 10, -32
+  39              		.cfi_offset 3, -40
+  40 0030 4889FB   		movq	%rdi, %rbx
+  41 0033 4883EC08 		subq	$8, %rsp
+  42 0037 8937     		movl	%esi, (%rdi)
+  43 0039 895704   		movl	%edx, 4(%rdi)
+  44 003c 894F08   		movl	%ecx, 8(%rdi)
+  45 003f 48C74778 		movq	$0, 120(%rdi)
+  45      00000000 
+  46 0047 62F17F48 		vmovdqu8	%zmm0, 56(%rdi)
+  46      7F873800 
+  46      0000
+  47 0051 8D7AFF   		leal	-1(%rdx), %edi
+  48 0054 C5FA1005 		vmovss	.LC0(%rip), %xmm0
+  48      00000000 
+  49 005c C5F877   		vzeroupper
+  50 005f E8000000 		call	ldexpf@PLT
+  50      00
+  51 0064 C5F8570D 		vxorps	.LC1(%rip), %xmm0, %xmm1
+  51      00000000 
+  52 006c C5F814C9 		vunpcklps	%xmm1, %xmm0, %xmm1
+  53 0070 C5F8134B 		vmovlps	%xmm1, 12(%rbx)
+  53      0C
+  54 0075 4183FC18 		cmpl	$24, %r12d
+  55 0079 7F2D     		jg	.L9
+  56 007b C5FA5C05 		vsubss	.LC0(%rip), %xmm0, %xmm0
+  56      00000000 
+  57              	.L7:
+  58 0083 C5FA1143 		vmovss	%xmm0, 20(%rbx)
+  58      14
+  59 0088 C5FD6F05 		vmovdqa	.LC3(%rip), %ymm0
+  59      00000000 
+  60 0090 C5FE7F43 		vmovdqu	%ymm0, 24(%rbx)
+  60      18
+  61 0095 C5F877   		vzeroupper
+  62 0098 4883C408 		addq	$8, %rsp
+  63 009c 5B       		popq	%rbx
+  64 009d 415A     		popq	%r10
+  65 009f 415C     		popq	%r12
+  66 00a1 5D       		popq	%rbp
+  67              		.cfi_remember_state
+  68              		.cfi_def_cfa 7, 8
+  69 00a2 C3       		ret
+  70              		.p2align 4,,10
+  71 00a3 0F1F4400 		.p2align 3
+  71      00
+  72              	.L9:
+  73              		.cfi_restore_state
+  74 00a8 C5F057C9 		vxorps	%xmm1, %xmm1, %xmm1
+  75 00ac E8000000 		call	nextafterf@PLT
+  75      00
+  76 00b1 EBD0     		jmp	.L7
+  77              		.cfi_endproc
+  78              	.LFE6396:
+  80 00b3 66662E0F 		.p2align 4
+  80      1F840000 
+  80      00000066 
+  80      90
+  81              		.globl	quantize
+  83              	quantize:
+  84              	.LFB6404:
+  85              		.cfi_startproc
+  86 00c0 4C8D5424 		leaq	8(%rsp), %r10
+  86      08
+  87              		.cfi_def_cfa 10, 0
+  88 00c5 4883E4E0 		andq	$-32, %rsp
+  89 00c9 41FF72F8 		pushq	-8(%r10)
+  90 00cd 55       		pushq	%rbp
+  91 00ce 4889E5   		movq	%rsp, %rbp
+  92              		.cfi_escape 0x10,0x6,0x2,0x76,0
+  93 00d1 4157     		pushq	%r15
+  94              		.cfi_escape 0x10,0xf,0x2,0x76,0x78
+  95 00d3 4989FF   		movq	%rdi, %r15
+  96 00d6 4889D7   		movq	%rdx, %rdi
+  97 00d9 4156     		pushq	%r14
+  98 00db 4155     		pushq	%r13
+  99 00dd 4154     		pushq	%r12
+ 100 00df 4152     		pushq	%r10
+ 101              		.cfi_escape 0xf,0x3,0x76,0x58,0x6
+ 102              		.cfi_escape 0x10,0xe,0x2,0x76,0x70
+ 103              		.cfi_escape 0x10,0xd,0x2,0x76,0x68
+ 104              		.cfi_escape 0x10,0xc,0x2,0x76,0x60
+ 105 00e1 53       		pushq	%rbx
+ 106 00e2 4883EC60 		subq	$96, %rsp
+ 107              		.cfi_escape 0x10,0x3,0x2,0x76,0x50
+ 108 00e6 458B4708 		movl	8(%r15), %r8d
+ 109 00ea 458B0F   		movl	(%r15), %r9d
+ 110 00ed 4589C6   		movl	%r8d, %r14d
+ 111 00f0 440FAFF1 		imull	%ecx, %r14d
+ 112 00f4 4183F902 		cmpl	$2, %r9d
+ 113 00f8 0F844201 		je	.L11
+ 113      0000
+ 114 00fe C4C17A10 		vmovss	12(%r15), %xmm6
+ 114      770C
+ 115 0104 C4C17A10 		vmovss	20(%r15), %xmm7
+ 115      7F14
+ 116 010a 4D8B6738 		movq	56(%r15), %r12
+ 117 010e C5FA1175 		vmovss	%xmm6, -56(%rbp)
+ 117      C8
+ 118 0113 C4C17A10 		vmovss	16(%r15), %xmm6
+ 118      7710
+ 119 0119 C5FA117D 		vmovss	%xmm7, -68(%rbp)
+ 119      BC
+ 120 011e C5FA1175 		vmovss	%xmm6, -64(%rbp)
+ 120      C0
+ 121 0123 4585F6   		testl	%r14d, %r14d
+ 122 0126 0F8EA802 		jle	.L36
+ 122      0000
+ 123 012c 4C89E3   		movq	%r12, %rbx
+ 124 012f 4531ED   		xorl	%r13d, %r13d
+ 125 0132 44894DA0 		movl	%r9d, -96(%rbp)
+ 126 0136 48F7DB   		negq	%rbx
+ 127 0139 48897598 		movq	%rsi, -104(%rbp)
+ 128 013d 48C1E302 		salq	$2, %rbx
+ 129 0141 48895590 		movq	%rdx, -112(%rbp)
+ 130 0145 488D041A 		leaq	(%rdx,%rbx), %rax
+ 131 0149 488945A8 		movq	%rax, -88(%rbp)
+ 132 014d 488D041E 		leaq	(%rsi,%rbx), %rax
+ 133 0151 488945B0 		movq	%rax, -80(%rbp)
+ 134 0155 4C89F8   		movq	%r15, %rax
+ 135 0158 4D89E7   		movq	%r12, %r15
+ 136 015b 4589EC   		movl	%r13d, %r12d
+ 137 015e 4989C5   		movq	%rax, %r13
+ 138 0161 EB50     		jmp	.L19
+ 139              		.p2align 4,,10
+ 140 0163 0F1F4400 		.p2align 3
+ 140      00
+ 141              	.L18:
+ 142 0168 4983C701 		addq	$1, %r15
+ 143 016c C5FA104D 		vmovss	-64(%rbp), %xmm1
+ 143      C0
+ 144 0171 418B5D04 		movl	4(%r13), %ebx
+ 145 0175 4D897D38 		movq	%r15, 56(%r13)
+ 146 0179 E8000000 		call	fmaxf@PLT
+ 146      00
+ 147 017e C5FA104D 		vmovss	-68(%rbp), %xmm1
+ 147      BC
+ 148 0183 E8000000 		call	fminf@PLT
+ 148      00
+ 149 0188 E8000000 		call	lrintf@PLT
+ 149      00
+ 150 018d 488B75B0 		movq	-80(%rbp), %rsi
+ 151 0191 BA200000 		movl	$32, %edx
+ 151      00
+ 152 0196 29DA     		subl	%ebx, %edx
+ 153 0198 C4E269F7 		shlx	%edx, %eax, %eax
+ 153      C0
+ 154 019d 428944BE 		movl	%eax, -4(%rsi,%r15,4)
+ 154      FC
+ 155 01a2 418D4424 		leal	1(%r12), %eax
+ 155      01
+ 156 01a7 4139C6   		cmpl	%eax, %r14d
+ 157 01aa 0F848004 		je	.L38
+ 157      0000
+ 158 01b0 4189C4   		movl	%eax, %r12d
+ 159              	.L19:
+ 160 01b3 4C89FF   		movq	%r15, %rdi
+ 161 01b6 83E707   		andl	$7, %edi
+ 162 01b9 0F843102 		je	.L39
+ 162      0000
+ 163 01bf 488B45A8 		movq	-88(%rbp), %rax
+ 164 01c3 837DA001 		cmpl	$1, -96(%rbp)
+ 165 01c7 C5FA106D 		vmovss	-56(%rbp), %xmm5
+ 165      C8
+ 166 01cc C4A15259 		vmulss	(%rax,%r15,4), %xmm5, %xmm0
+ 166      04B8
+ 167 01d2 7594     		jne	.L18
+ 168 01d4 418B44BD 		movl	24(%r13,%rdi,4), %eax
+ 168      18
+ 169 01d9 C5C057FF 		vxorps	%xmm7, %xmm7, %xmm7
+ 170 01dd 89C2     		movl	%eax, %edx
+ 171 01df C1E20D   		sall	$13, %edx
+ 172 01e2 31D0     		xorl	%edx, %eax
+ 173 01e4 89C2     		movl	%eax, %edx
+ 174 01e6 C1EA11   		shrl	$17, %edx
+ 175 01e9 31D0     		xorl	%edx, %eax
+ 176 01eb 89C2     		movl	%eax, %edx
+ 177 01ed C1E205   		sall	$5, %edx
+ 178 01f0 31D0     		xorl	%edx, %eax
+ 179 01f2 89C2     		movl	%eax, %edx
+ 180 01f4 C1E20D   		sall	$13, %edx
+ 181 01f7 31C2     		xorl	%eax, %edx
+ 182 01f9 C1E808   		shrl	$8, %eax
+ 183 01fc 4189D0   		movl	%edx, %r8d
+ 184 01ff C5C22AC8 		vcvtsi2ssl	%eax, %xmm7, %xmm1
+ 185 0203 C5F2590D 		vmulss	.LC5(%rip), %xmm1, %xmm1
+ 185      00000000 
+ 186 020b 41C1E811 		shrl	$17, %r8d
+ 187 020f 4431C2   		xorl	%r8d, %edx
+ 188 0212 4189D0   		movl	%edx, %r8d
+ 189 0215 41C1E005 		sall	$5, %r8d
+ 190 0219 4431C2   		xorl	%r8d, %edx
+ 191 021c 418954BD 		movl	%edx, 24(%r13,%rdi,4)
+ 191      18
+ 192 0221 C1EA08   		shrl	$8, %edx
+ 193 0224 C5C22AD2 		vcvtsi2ssl	%edx, %xmm7, %xmm2
+ 194 0228 C5EA5915 		vmulss	.LC5(%rip), %xmm2, %xmm2
+ 194      00000000 
+ 195 0230 C5F25CCA 		vsubss	%xmm2, %xmm1, %xmm1
+ 196 0234 C5FA58C1 		vaddss	%xmm1, %xmm0, %xmm0
+ 197 0238 E92BFFFF 		jmp	.L18
+ 197      FF
+ 198 023d 0F1F00   		.p2align 4,,10
+ 199              		.p2align 3
+ 200              	.L11:
+ 201 0240 4189CB   		movl	%ecx, %r11d
+ 202 0243 85C9     		testl	%ecx, %ecx
+ 203 0245 0F8E8901 		jle	.L36
+ 203      0000
+ 204 024b 31C0     		xorl	%eax, %eax
+ 205 024d 4531D2   		xorl	%r10d, %r10d
+ 206              	.L14:
+ 207 0250 4585C0   		testl	%r8d, %r8d
+ 208 0253 0F8EFA03 		jle	.L34
+ 208      0000
+ 209 0259 498D4F40 		leaq	64(%r15), %rcx
+ 210 025d 44894598 		movl	%r8d, -104(%rbp)
+ 211 0261 4D89FD   		movq	%r15, %r13
+ 212 0264 48897590 		movq	%rsi, -112(%rbp)
+ 213 0268 48897D88 		movq	%rdi, -120(%rbp)
+ 214 026c 44895DB8 		movl	%r11d, -72(%rbp)
+ 215 0270 48894DA0 		movq	%rcx, -96(%rbp)
+ 216 0274 4963C8   		movslq	%r8d, %rcx
+ 217 0277 48894DA8 		movq	%rcx, -88(%rbp)
+ 218 027b 4489D1   		movl	%r10d, %ecx
+ 219 027e 6690     		.p2align 4,,10
+ 220              		.p2align 3
+ 221              	.L16:
+ 222 0280 4D8B7D38 		movq	56(%r13), %r15
+ 223 0284 488B75A8 		movq	-88(%rbp), %rsi
+ 224 0288 4863D0   		movslq	%eax, %rdx
+ 225 028b 8945BC   		movl	%eax, -68(%rbp)
+ 226 028e 4C8B65A0 		movq	-96(%rbp), %r12
+ 227 0292 894DB0   		movl	%ecx, -80(%rbp)
+ 228 0295 4C01FE   		addq	%r15, %rsi
+ 229 0298 4C29FA   		subq	%r15, %rdx
+ 230 029b 488975C0 		movq	%rsi, -64(%rbp)
+ 231 029f 488B7588 		movq	-120(%rbp), %rsi
+ 232 02a3 488D1C95 		leaq	0(,%rdx,4), %rbx
+ 232      00000000 
+ 233 02ab 4C8D341E 		leaq	(%rsi,%rbx), %r14
+ 234 02af 488B7590 		movq	-112(%rbp), %rsi
+ 235 02b3 4801DE   		addq	%rbx, %rsi
+ 236 02b6 4C89E3   		movq	%r12, %rbx
+ 237 02b9 488975C8 		movq	%rsi, -56(%rbp)
+ 238 02bd 4C89F6   		movq	%r14, %rsi
+ 239 02c0 4D89FE   		movq	%r15, %r14
+ 240 02c3 4989F7   		movq	%rsi, %r15
+ 241 02c6 662E0F1F 		.p2align 4,,10
+ 241      84000000 
+ 241      0000
+ 242              		.p2align 3
+ 243              	.L15:
+ 244 02d0 4C89F7   		movq	%r14, %rdi
+ 245 02d3 C5FA101B 		vmovss	(%rbx), %xmm3
+ 246 02d7 C5D857E4 		vxorps	%xmm4, %xmm4, %xmm4
+ 247 02db C4817A10 		vmovss	(%r15,%r14,4), %xmm1
+ 247      0CB7
+ 248 02e1 83E707   		andl	$7, %edi
+ 249 02e4 4983C601 		addq	$1, %r14
+ 250 02e8 4883C308 		addq	$8, %rbx
+ 251 02ec 418B44BD 		movl	24(%r13,%rdi,4), %eax
+ 251      18
+ 252 02f1 C4C17259 		vmulss	12(%r13), %xmm1, %xmm1
+ 252      4D0C
+ 253 02f7 C5E258C3 		vaddss	%xmm3, %xmm3, %xmm0
+ 254 02fb 89C2     		movl	%eax, %edx
+ 255 02fd C1E20D   		sall	$13, %edx
+ 256 0300 31D0     		xorl	%edx, %eax
+ 257 0302 89C2     		movl	%eax, %edx
+ 258 0304 C5F25CC8 		vsubss	%xmm0, %xmm1, %xmm1
+ 259 0308 C5F2584B 		vaddss	-4(%rbx), %xmm1, %xmm1
+ 259      FC
+ 260 030d C1EA11   		shrl	$17, %edx
+ 261 0310 31D0     		xorl	%edx, %eax
+ 262 0312 89C2     		movl	%eax, %edx
+ 263 0314 C1E205   		sall	$5, %edx
+ 264 0317 31D0     		xorl	%edx, %eax
+ 265 0319 89C2     		movl	%eax, %edx
+ 266 031b C1E20D   		sall	$13, %edx
+ 267 031e 31C2     		xorl	%eax, %edx
+ 268 0320 C1E808   		shrl	$8, %eax
+ 269 0323 4189D0   		movl	%edx, %r8d
+ 270 0326 C5DA2AC0 		vcvtsi2ssl	%eax, %xmm4, %xmm0
+ 271 032a C5FA5905 		vmulss	.LC5(%rip), %xmm0, %xmm0
+ 271      00000000 
+ 272 0332 41C1E811 		shrl	$17, %r8d
+ 273 0336 4431C2   		xorl	%r8d, %edx
+ 274 0339 4189D0   		movl	%edx, %r8d
+ 275 033c 41C1E005 		sall	$5, %r8d
+ 276 0340 4431C2   		xorl	%r8d, %edx
+ 277 0343 418954BD 		movl	%edx, 24(%r13,%rdi,4)
+ 277      18
+ 278 0348 C1EA08   		shrl	$8, %edx
+ 279 034b 458B6504 		movl	4(%r13), %r12d
+ 280 034f C5DA2AD2 		vcvtsi2ssl	%edx, %xmm4, %xmm2
+ 281 0353 C5EA5915 		vmulss	.LC5(%rip), %xmm2, %xmm2
+ 281      00000000 
+ 282 035b 4D897538 		movq	%r14, 56(%r13)
+ 283 035f C5FA5CC2 		vsubss	%xmm2, %xmm0, %xmm0
+ 284 0363 C5FA58C1 		vaddss	%xmm1, %xmm0, %xmm0
+ 285 0367 62F37D08 		vrndscaless	$4, %xmm0, %xmm0, %xmm0
+ 285      0AC004
+ 286 036e C5FA5CC9 		vsubss	%xmm1, %xmm0, %xmm1
+ 287 0372 C5F014DB 		vunpcklps	%xmm3, %xmm1, %xmm3
+ 288 0376 C5F8135B 		vmovlps	%xmm3, -8(%rbx)
+ 288      F8
+ 289 037b C4C17A10 		vmovss	16(%r13), %xmm1
+ 289      4D10
+ 290 0381 E8000000 		call	fmaxf@PLT
+ 290      00
+ 291 0386 C5F828C8 		vmovaps	%xmm0, %xmm1
+ 292 038a C4C17A10 		vmovss	20(%r13), %xmm0
+ 292      4514
+ 293 0390 E8000000 		call	fminf@PLT
+ 293      00
+ 294 0395 E8000000 		call	lrintf@PLT
+ 294      00
+ 295 039a 488B4DC8 		movq	-56(%rbp), %rcx
+ 296 039e BF200000 		movl	$32, %edi
+ 296      00
+ 297 03a3 4429E7   		subl	%r12d, %edi
+ 298 03a6 C4E241F7 		shlx	%edi, %eax, %eax
+ 298      C0
+ 299 03ab 428944B1 		movl	%eax, -4(%rcx,%r14,4)
+ 299      FC
+ 300 03b0 488B45C0 		movq	-64(%rbp), %rax
+ 301 03b4 4939C6   		cmpq	%rax, %r14
+ 302 03b7 0F8513FF 		jne	.L15
+ 302      FFFF
+ 303 03bd 8B45BC   		movl	-68(%rbp), %eax
+ 304 03c0 8B4DB0   		movl	-80(%rbp), %ecx
+ 305 03c3 8B7598   		movl	-104(%rbp), %esi
+ 306 03c6 83C101   		addl	$1, %ecx
+ 307 03c9 01F0     		addl	%esi, %eax
+ 308 03cb 394DB8   		cmpl	%ecx, -72(%rbp)
+ 309 03ce 0F85ACFE 		jne	.L16
+ 309      FFFF
+ 310              	.L36:
+ 311 03d4 4883C460 		addq	$96, %rsp
+ 312 03d8 5B       		popq	%rbx
+ 313 03d9 415A     		popq	%r10
+ 314              		.cfi_remember_state
+ 315              		.cfi_def_cfa 10, 0
+ 316 03db 415C     		popq	%r12
+ 317 03dd 415D     		popq	%r13
+ 318 03df 415E     		popq	%r14
+ 319 03e1 415F     		popq	%r15
+ 320 03e3 5D       		popq	%rbp
+ 321 03e4 498D62F8 		leaq	-8(%r10), %rsp
+ 322              		.cfi_def_cfa 7, 8
+ 323 03e8 C3       		ret
+ 324 03e9 0F1F8000 		.p2align 4,,10
+ 324      000000
+ 325              		.p2align 3
+ 326              	.L39:
+ 327              		.cfi_restore_state
+ 328 03f0 4C89E8   		movq	%r13, %rax
+ 329 03f3 488B7598 		movq	-104(%rbp), %rsi
+ 330 03f7 4589E5   		movl	%r12d, %r13d
+ 331 03fa 488B7D90 		movq	-112(%rbp), %rdi
+ 332 03fe 448B00   		movl	(%rax), %r8d
+ 333 0401 4D89FC   		movq	%r15, %r12
+ 334 0404 418D4D07 		leal	7(%r13), %ecx
+ 335 0408 4989C7   		movq	%rax, %r15
+ 336              	.L20:
+ 337 040b B8200000 		movl	$32, %eax
+ 337      00
+ 338 0410 412B4704 		subl	4(%r15), %eax
+ 339 0414 C4E27D18 		vbroadcastss	-56(%rbp), %ymm3
+ 339      5DC8
+ 340 041a C4E27D18 		vbroadcastss	-64(%rbp), %ymm4
+ 340      65C0
+ 341 0420 C4E27D18 		vbroadcastss	-68(%rbp), %ymm5
+ 341      6DBC
+ 342 0426 C5F96EF8 		vmovd	%eax, %xmm7
+ 343 042a C4C17E6F 		vmovdqu	24(%r15), %ymm1
+ 343      4F18
+ 344 0430 4139CE   		cmpl	%ecx, %r14d
+ 345 0433 0F8E3702 		jle	.L28
+ 345      0000
+ 346 0439 C4627D18 		vbroadcastss	.LC5(%rip), %ymm8
+ 346      05000000 
+ 346      00
+ 347 0442 4963C5   		movslq	%r13d, %rax
+ 348              		.p2align 4,,10
+ 349 0445 0F1F00   		.p2align 3
+ 350              	.L24:
+ 351 0448 C5E45904 		vmulps	(%rdi,%rax,4), %ymm3, %ymm0
+ 351      87
+ 352 044d 4183F801 		cmpl	$1, %r8d
+ 353 0451 755A     		jne	.L23
+ 354 0453 C5ED72F1 		vpslld	$13, %ymm1, %ymm2
+ 354      0D
+ 355 0458 C5F5EFCA 		vpxor	%ymm2, %ymm1, %ymm1
+ 356 045c C5ED72D1 		vpsrld	$17, %ymm1, %ymm2
+ 356      11
+ 357 0461 C5F5EFCA 		vpxor	%ymm2, %ymm1, %ymm1
+ 358 0465 C5ED72F1 		vpslld	$5, %ymm1, %ymm2
+ 358      05
+ 359 046a C5F5EFCA 		vpxor	%ymm2, %ymm1, %ymm1
+ 360 046e C5CD72F1 		vpslld	$13, %ymm1, %ymm6
+ 360      0D
+ 361 0473 C5ED72D1 		vpsrld	$8, %ymm1, %ymm2
+ 361      08
+ 362 0478 C5F5EFCE 		vpxor	%ymm6, %ymm1, %ymm1
+ 363 047c C5FC5BD2 		vcvtdq2ps	%ymm2, %ymm2
+ 364 0480 C4C16C59 		vmulps	%ymm8, %ymm2, %ymm2
+ 364      D0
+ 365 0485 C5CD72D1 		vpsrld	$17, %ymm1, %ymm6
+ 365      11
+ 366 048a C5F5EFCE 		vpxor	%ymm6, %ymm1, %ymm1
+ 367 048e C5CD72F1 		vpslld	$5, %ymm1, %ymm6
+ 367      05
+ 368 0493 C5F5EFCE 		vpxor	%ymm6, %ymm1, %ymm1
+ 369 0497 C5CD72D1 		vpsrld	$8, %ymm1, %ymm6
+ 369      08
+ 370 049c C5FC5BF6 		vcvtdq2ps	%ymm6, %ymm6
+ 371 04a0 C4C14C59 		vmulps	%ymm8, %ymm6, %ymm6
+ 371      F0
+ 372 04a5 C5EC5CD6 		vsubps	%ymm6, %ymm2, %ymm2
+ 373 04a9 C5FC58C2 		vaddps	%ymm2, %ymm0, %ymm0
+ 374              	.L23:
+ 375 04ad C5FC5FC4 		vmaxps	%ymm4, %ymm0, %ymm0
+ 376 04b1 C5FC5DC5 		vminps	%ymm5, %ymm0, %ymm0
+ 377 04b5 C5FD5BC0 		vcvtps2dq	%ymm0, %ymm0
+ 378 04b9 C5FDF2C7 		vpslld	%xmm7, %ymm0, %ymm0
+ 379 04bd C5FE7F04 		vmovdqu	%ymm0, (%rsi,%rax,4)
+ 379      86
+ 380 04c2 4883C008 		addq	$8, %rax
+ 381 04c6 8D5007   		leal	7(%rax), %edx
+ 382 04c9 4139D6   		cmpl	%edx, %r14d
+ 383 04cc 0F8F76FF 		jg	.L24
+ 383      FFFF
+ 384 04d2 418D46F8 		leal	-8(%r14), %eax
+ 385 04d6 418D4D07 		leal	7(%r13), %ecx
+ 386 04da 4429E8   		subl	%r13d, %eax
+ 387 04dd 83E0F8   		andl	$-8, %eax
+ 388 04e0 4139CE   		cmpl	%ecx, %r14d
+ 389 04e3 B9000000 		movl	$0, %ecx
+ 389      00
+ 390 04e8 0F4EC1   		cmovle	%ecx, %eax
+ 391 04eb 418D4C05 		leal	8(%r13,%rax), %ecx
+ 391      08
+ 392 04f0 83C008   		addl	$8, %eax
+ 393 04f3 4898     		cltq
+ 394 04f5 4901C4   		addq	%rax, %r12
+ 395              	.L22:
+ 396 04f8 4D896738 		movq	%r12, 56(%r15)
+ 397 04fc C4C17E7F 		vmovdqu	%ymm1, 24(%r15)
+ 397      4F18
+ 398 0502 4139CE   		cmpl	%ecx, %r14d
+ 399 0505 0F8E5D01 		jle	.L35
+ 399      0000
+ 400 050b 4129CE   		subl	%ecx, %r14d
+ 401 050e 4863C9   		movslq	%ecx, %rcx
+ 402 0511 C4C17A10 		vmovss	12(%r15), %xmm7
+ 402      7F0C
+ 403 0517 458B2F   		movl	(%r15), %r13d
+ 404 051a 4B8D0426 		leaq	(%r14,%r12), %rax
+ 405 051e 4C29E1   		subq	%r12, %rcx
+ 406 0521 C4C17A10 		vmovss	16(%r15), %xmm5
+ 406      6F10
+ 407 0527 488945C0 		movq	%rax, -64(%rbp)
+ 408 052b 488D048D 		leaq	0(,%rcx,4), %rax
+ 408      00000000 
+ 409 0533 488D0C07 		leaq	(%rdi,%rax), %rcx
+ 410 0537 C5FA117D 		vmovss	%xmm7, -68(%rbp)
+ 410      BC
+ 411 053c C4C17A10 		vmovss	20(%r15), %xmm7
+ 411      7F14
+ 412 0542 488D1C06 		leaq	(%rsi,%rax), %rbx
+ 413 0546 48894DC8 		movq	%rcx, -56(%rbp)
+ 414 054a 4C89F8   		movq	%r15, %rax
+ 415 054d 4589EF   		movl	%r13d, %r15d
+ 416 0550 C5FA116D 		vmovss	%xmm5, -80(%rbp)
+ 416      B0
+ 417 0555 4989C5   		movq	%rax, %r13
+ 418 0558 C5FA117D 		vmovss	%xmm7, -88(%rbp)
+ 418      A8
+ 419 055d C5F877   		vzeroupper
+ 420 0560 EB47     		jmp	.L26
+ 421              		.p2align 4,,10
+ 422 0562 660F1F44 		.p2align 3
+ 422      0000
+ 423              	.L25:
+ 424 0568 4983C401 		addq	$1, %r12
+ 425 056c C5FA104D 		vmovss	-80(%rbp), %xmm1
+ 425      B0
+ 426 0571 458B7504 		movl	4(%r13), %r14d
+ 427 0575 4D896538 		movq	%r12, 56(%r13)
+ 428 0579 E8000000 		call	fmaxf@PLT
+ 428      00
+ 429 057e C5FA104D 		vmovss	-88(%rbp), %xmm1
+ 429      A8
+ 430 0583 E8000000 		call	fminf@PLT
+ 430      00
+ 431 0588 E8000000 		call	lrintf@PLT
+ 431      00
+ 432 058d BA200000 		movl	$32, %edx
+ 432      00
+ 433 0592 4429F2   		subl	%r14d, %edx
+ 434 0595 C4E269F7 		shlx	%edx, %eax, %eax
+ 434      C0
+ 435 059a 428944A3 		movl	%eax, -4(%rbx,%r12,4)
+ 435      FC
+ 436 059f 4C3965C0 		cmpq	%r12, -64(%rbp)
+ 437 05a3 0F842BFE 		je	.L36
+ 437      FFFF
+ 438              	.L26:
+ 439 05a9 488B45C8 		movq	-56(%rbp), %rax
+ 440 05ad C5FA107D 		vmovss	-68(%rbp), %xmm7
+ 440      BC
+ 441 05b2 C4A14259 		vmulss	(%rax,%r12,4), %xmm7, %xmm0
+ 441      04A0
+ 442 05b8 4183FF01 		cmpl	$1, %r15d
+ 443 05bc 75AA     		jne	.L25
+ 444 05be 4C89E6   		movq	%r12, %rsi
+ 445 05c1 C5D057ED 		vxorps	%xmm5, %xmm5, %xmm5
+ 446 05c5 83E607   		andl	$7, %esi
+ 447 05c8 418B44B5 		movl	24(%r13,%rsi,4), %eax
+ 447      18
+ 448 05cd 89C2     		movl	%eax, %edx
+ 449 05cf C1E20D   		sall	$13, %edx
+ 450 05d2 31D0     		xorl	%edx, %eax
+ 451 05d4 89C2     		movl	%eax, %edx
+ 452 05d6 C1EA11   		shrl	$17, %edx
+ 453 05d9 31D0     		xorl	%edx, %eax
+ 454 05db 89C2     		movl	%eax, %edx
+ 455 05dd C1E205   		sall	$5, %edx
+ 456 05e0 31D0     		xorl	%edx, %eax
+ 457 05e2 89C2     		movl	%eax, %edx
+ 458 05e4 C1E20D   		sall	$13, %edx
+ 459 05e7 31C2     		xorl	%eax, %edx
+ 460 05e9 C1E808   		shrl	$8, %eax
+ 461 05ec 89D7     		movl	%edx, %edi
+ 462 05ee C5D22AC8 		vcvtsi2ssl	%eax, %xmm5, %xmm1
+ 463 05f2 C5F2590D 		vmulss	.LC5(%rip), %xmm1, %xmm1
+ 463      00000000 
+ 464 05fa C1EF11   		shrl	$17, %edi
+ 465 05fd 31FA     		xorl	%edi, %edx
+ 466 05ff 89D7     		movl	%edx, %edi
+ 467 0601 C1E705   		sall	$5, %edi
+ 468 0604 31FA     		xorl	%edi, %edx
+ 469 0606 418954B5 		movl	%edx, 24(%r13,%rsi,4)
+ 469      18
+ 470 060b C1EA08   		shrl	$8, %edx
+ 471 060e C5D22AD2 		vcvtsi2ssl	%edx, %xmm5, %xmm2
+ 472 0612 C5EA5915 		vmulss	.LC5(%rip), %xmm2, %xmm2
+ 472      00000000 
+ 473 061a C5F25CCA 		vsubss	%xmm2, %xmm1, %xmm1
+ 474 061e C5FA58C1 		vaddss	%xmm1, %xmm0, %xmm0
+ 475 0622 E941FFFF 		jmp	.L25
+ 475      FF
+ 476 0627 660F1F84 		.p2align 4,,10
+ 476      00000000 
+ 476      00
+ 477              		.p2align 3
+ 478              	.L38:
+ 479 0630 4C89E8   		movq	%r13, %rax
+ 480 0633 4589E5   		movl	%r12d, %r13d
+ 481 0636 488B7598 		movq	-104(%rbp), %rsi
+ 482 063a 4D89FC   		movq	%r15, %r12
+ 483 063d 418D4D08 		leal	8(%r13), %ecx
+ 484 0641 488B7D90 		movq	-112(%rbp), %rdi
+ 485 0645 448B00   		movl	(%rax), %r8d
+ 486 0648 4989C7   		movq	%rax, %r15
+ 487 064b 4589F5   		movl	%r14d, %r13d
+ 488 064e E9B8FDFF 		jmp	.L20
+ 488      FF
+ 489              	.L34:
+ 490 0653 4183C201 		addl	$1, %r10d
+ 491 0657 4401C0   		addl	%r8d, %eax
+ 492 065a 4539D3   		cmpl	%r10d, %r11d
+ 493 065d 0F85EDFB 		jne	.L14
+ 493      FFFF
+ 494 0663 E96CFDFF 		jmp	.L36
+ 494      FF
+ 495              	.L35:
+ 496 0668 C5F877   		vzeroupper
+ 497 066b E964FDFF 		jmp	.L36
+ 497      FF
+ 498              	.L28:
+ 499 0670 4489E9   		movl	%r13d, %ecx
+ 500 0673 E980FEFF 		jmp	.L22
+ 500      FF
+ 501              		.cfi_endproc
+ 502              	.LFE6404:
+ 504              		.section	.rodata
+ 505              		.align 16
+ 508              	CSWTCH.26:
+ 509 0000 08000000 		.long	8
+ 510 0004 10000000 		.long	16
+ 511 0008 18000000 		.long	24
+ 512 000c 20000000 		.long	32
+ 513 0010 08000000 		.long	8
+ 514              		.section	.rodata.cst4,"aM",@progbits,4
+ 515              		.align 4
+ 516              	.LC0:
+ 517 0000 0000803F 		.long	1065353216
+ 518              		.section	.rodata.cst16,"aM",@progbits,16
+ 519              		.align 16
+ 520              	.LC1:
+ 521 0000 00000080 		.long	-2147483648
+ 522 0004 00000000 		.long	0
+ 523 0008 00000000 		.long	0
+ 524 000c 00000000 		.long	0
+ 525              		.section	.rodata.cst32,"aM",@progbits,32
+ 526              		.align 32
+ 527              	.LC3:
+ 528 0000 B979379E 		.long	-1640531527
+ 529 0004 72F36E3C 		.long	1013904242
+ 530 0008 2B6DA6DA 		.long	-626627285
+ 531 000c E4E6DD78 		.long	2027808484
+ 532 0010 9D601517 		.long	387276957
+ 533 0014 56DA4CB5 		.long	-1253254570
+ 534 0018 0F548453 		.long	1401181199
+ 535 001c C8CDBBF1 		.long	-239350328
+ 536              		.section	.rodata.cst4
+ 537              		.align 4
+ 538              	.LC5:
+ 539 0004 00008033 		.long	864026624
+ 540              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 541              		.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,404 @@
+   1              		.file	"shmstats.c"
+   2              		.text
+   3              		.p2align 4
+   4              		.globl	shmstats_format
+   6              	shmstats_format:
+   7              	.LFB19:
+   8              		.cfi_startproc
+   9 0000 8B4F08   		movl	8(%rdi), %ecx
+  10 0003 8D4101   		leal	1(%rcx), %eax
+  11 0006 83C102   		addl	$2, %ecx
+  12 0009 894708   		movl	%eax, 8(%rdi)
+  13 000c 4863C2   		movslq	%edx, %rax
+  14 000f 4869C000 		imulq	$1000000000, %rax, %rax
+  14      CA9A3B
+  15 0016 897710   		movl	%esi, 16(%rdi)
+  16 0019 89F6     		movl	%esi, %esi
+  17 001b 895714   		movl	%edx, 20(%rdi)
+  18 001e 31D2     		xorl	%edx, %edx
+  19 0020 48F7F6   		divq	%rsi
+  20 0023 48894720 		movq	%rax, 32(%rdi)
+  21 0027 894F08   		movl	%ecx, 8(%rdi)
+  22 002a C3       		ret
+  23              		.cfi_endproc
+  24              	.LFE19:
+  26              		.section	.rodata.str1.1,"aMS",@progbits,1
+  27              	.LC0:
+  28 0000 2000     		.string	" "
+  29              	.LC1:
+  30 0002 00       		.string	""
+  31              	.LC2:
+  32 0003 25732D70 		.string	"%s-p %s"
+  32      20257300 
+  33              		.text
+  34 002b 0F1F4400 		.p2align 4
+  34      00
+  35              		.globl	shmstats_create
+  37              	shmstats_create:
+  38              	.LFB18:
+  39              		.cfi_startproc
+  40 0030 4157     		pushq	%r15
+  41              		.cfi_def_cfa_offset 16
+  42              		.cfi_offset 15, -16
+  43 0032 4156     		pushq	%r14
+  44              		.cfi_def_cfa_offset 24
+  45              		.cfi_offset 14, -24
+  46 0034 4155     		pushq	%r13
+  47              		.cfi_def_cfa_offset 32
+  48              		.cfi_offset 13, -32
+  49 0036 4989D5   		movq	%rdx, %r13
+  50 0039 BAA40100 		movl	$420, %edx
+  50      00
+  51 003e 4154     		pushq	%r12
+  52              		.cfi_def_cfa_offset 40
+  53              		.cfi_offset 12, -40
+  54 0040 55       		pushq	%rbp
+  55              		.cfi_def_cfa_offset 48
+  56              		.cfi_offset 6, -48
+  57 0041 53       		pushq	%rbx
+  58              		.cfi_def_cfa_offset 56
+  59              		.cfi_offset 3, -56
+  60 0042 4883EC18 		subq	$24, %rsp
+  61              		.cfi_def_cfa_offset 80
+  62 0046 48897424 		movq	%rsi, 8(%rsp)
+  62      08
+  63 004b BE420000 		movl	$66, %esi
+  63      00
+  64 0050 E8000000 		call	shm_open@PLT
+  64      00
+  65 0055 85C0     		testl	%eax, %eax
+  66 0057 0F887B01 		js	.L5
+  66      0000
+  67 005d BEA00400 		movl	$1184, %esi
+  67      00
+  68 0062 89C7     		movl	%eax, %edi
+  69 0064 4189C4   		movl	%eax, %r12d
+  70 0067 E8000000 		call	ftruncate@PLT
+  70      00
+  71 006c 85C0     		testl	%eax, %eax
+  72 006e 0F855C01 		jne	.L27
+  72      0000
+  73 0074 31FF     		xorl	%edi, %edi
+  74 0076 4531C9   		xorl	%r9d, %r9d
+  75 0079 4589E0   		movl	%r12d, %r8d
+  76 007c B9010000 		movl	$1, %ecx
+  76      00
+  77 0081 BA030000 		movl	$3, %edx
+  77      00
+  78 0086 BEA00400 		movl	$1184, %esi
+  78      00
+  79 008b E8000000 		call	mmap@PLT
+  79      00
+  80 0090 4489E7   		movl	%r12d, %edi
+  81 0093 4889C3   		movq	%rax, %rbx
+  82 0096 E8000000 		call	close@PLT
+  82      00
+  83 009b 4883FBFF 		cmpq	$-1, %rbx
+  84 009f 0F843301 		je	.L5
+  84      0000
+  85 00a5 488D7B08 		leaq	8(%rbx), %rdi
+  86 00a9 4889D9   		movq	%rbx, %rcx
+  87 00ac 31C0     		xorl	%eax, %eax
+  88 00ae 48C70300 		movq	$0, (%rbx)
+  88      000000
+  89 00b5 4883E7F8 		andq	$-8, %rdi
+  90 00b9 4C8DBBA0 		leaq	160(%rbx), %r15
+  90      000000
+  91 00c0 31ED     		xorl	%ebp, %ebp
+  92 00c2 48C78398 		movq	$0, 1176(%rbx)
+  92      04000000 
+  92      000000
+  93 00cd 4829F9   		subq	%rdi, %rcx
+  94 00d0 4C8D3500 		leaq	.LC0(%rip), %r14
+  94      000000
+  95 00d7 81C1A004 		addl	$1184, %ecx
+  95      0000
+  96 00dd C1E903   		shrl	$3, %ecx
+  97 00e0 F348AB   		rep stosq
+  98 00e3 C7430401 		movl	$1, 4(%rbx)
+  98      000000
+  99 00ea E8000000 		call	getpid@PLT
+  99      00
+ 100 00ef 4C8B6424 		movq	8(%rsp), %r12
+ 100      08
+ 101 00f4 4C89EE   		movq	%r13, %rsi
+ 102 00f7 488D7B60 		leaq	96(%rbx), %rdi
+ 103 00fb 89430C   		movl	%eax, 12(%rbx)
+ 104 00fe BA3F0000 		movl	$63, %edx
+ 104      00
+ 105 0103 4C8D2D00 		leaq	.LC1(%rip), %r13
+ 105      000000
+ 106 010a 418B8424 		movl	156(%r12), %eax
+ 106      9C000000 
+ 107 0112 894318   		movl	%eax, 24(%rbx)
+ 108 0115 E8000000 		call	strncpy@PLT
+ 108      00
+ 109 011a 660F1F44 		.p2align 4,,10
+ 109      0000
+ 110              		.p2align 3
+ 111              	.L10:
+ 112 0120 4885ED   		testq	%rbp, %rbp
+ 113 0123 4C89E9   		movq	%r13, %rcx
+ 114 0126 498D3C2F 		leaq	(%r15,%rbp), %rdi
+ 115 012a BE000400 		movl	$1024, %esi
+ 115      00
+ 116 012f 490F45CE 		cmovne	%r14, %rcx
+ 117 0133 488D1500 		leaq	.LC2(%rip), %rdx
+ 117      000000
+ 118 013a 4829EE   		subq	%rbp, %rsi
+ 119 013d 31C0     		xorl	%eax, %eax
+ 120 013f 4D8B8424 		movq	176(%r12), %r8
+ 120      B0000000 
+ 121 0147 E8000000 		call	snprintf@PLT
+ 121      00
+ 122 014c 4D8B2424 		movq	(%r12), %r12
+ 123 0150 4898     		cltq
+ 124 0152 4801C5   		addq	%rax, %rbp
+ 125 0155 4D85E4   		testq	%r12, %r12
+ 126 0158 7409     		je	.L16
+ 127 015a 4881FDFF 		cmpq	$1023, %rbp
+ 127      030000
+ 128 0161 76BD     		jbe	.L10
+ 129              	.L16:
+ 130 0163 0FB683A0 		movzbl	160(%rbx), %eax
+ 130      000000
+ 131 016a 48BA2523 		movabsq	$-3750763034362895579, %rdx
+ 131      2284E49C 
+ 131      F2CB
+ 132 0174 84C0     		testb	%al, %al
+ 133 0176 7423     		je	.L12
+ 134 0178 48B9B301 		movabsq	$1099511628211, %rcx
+ 134      00000001 
+ 134      0000
+ 135              		.p2align 4,,10
+ 136 0182 660F1F44 		.p2align 3
+ 136      0000
+ 137              	.L13:
+ 138 0188 4983C701 		addq	$1, %r15
+ 139 018c 4831C2   		xorq	%rax, %rdx
+ 140 018f 410FB607 		movzbl	(%r15), %eax
+ 141 0193 480FAFD1 		imulq	%rcx, %rdx
+ 142 0197 84C0     		testb	%al, %al
+ 143 0199 75ED     		jne	.L13
+ 144              	.L12:
+ 145 019b 488B4424 		movq	8(%rsp), %rax
+ 145      08
+ 146 01a0 48895358 		movq	%rdx, 88(%rbx)
+ 147 01a4 4889DF   		movq	%rbx, %rdi
+ 148 01a7 8B90A400 		movl	164(%rax), %edx
+ 148      0000
+ 149 01ad 8BB09800 		movl	152(%rax), %esi
+ 149      0000
+ 150 01b3 E8000000 		call	shmstats_format@PLT
+ 150      00
+ 151 01b8 C7037073 		movl	$1902408560, (%rbx)
+ 151      6471
+ 152              	.L3:
+ 153 01be 4883C418 		addq	$24, %rsp
+ 154              		.cfi_remember_state
+ 155              		.cfi_def_cfa_offset 56
+ 156 01c2 4889D8   		movq	%rbx, %rax
+ 157 01c5 5B       		popq	%rbx
+ 158              		.cfi_def_cfa_offset 48
+ 159 01c6 5D       		popq	%rbp
+ 160              		.cfi_def_cfa_offset 40
+ 161 01c7 415C     		popq	%r12
+ 162              		.cfi_def_cfa_offset 32
+ 163 01c9 415D     		popq	%r13
+ 164              		.cfi_def_cfa_offset 24
+ 165 01cb 415E     		popq	%r14
+ 166              		.cfi_def_cfa_offset 16
+ 167 01cd 415F     		popq	%r15
+ 168              		.cfi_def_cfa_offset 8
+ 169 01cf C3       		ret
+ 170              		.p2align 4,,10
+ 171              		.p2align 3
+ 172              	.L27:
+ 173              		.cfi_restore_state
+ 174 01d0 4489E7   		movl	%r12d, %edi
+ 175 01d3 E8000000 		call	close@PLT
+ 175      00
+ 176              	.L5:
+ 177 01d8 31DB     		xorl	%ebx, %ebx
+ 178 01da EBE2     		jmp	.L3
+ 179              		.cfi_endproc
+ 180              	.LFE18:
+ 182 01dc 0F1F4000 		.p2align 4
+ 183              		.globl	shmstats_destroy
+ 185              	shmstats_destroy:
+ 186              	.LFB20:
+ 187              		.cfi_startproc
+ 188 01e0 4885FF   		testq	%rdi, %rdi
+ 189 01e3 741B     		je	.L30
+ 190 01e5 53       		pushq	%rbx
+ 191              		.cfi_def_cfa_offset 16
+ 192              		.cfi_offset 3, -16
+ 193 01e6 4889F3   		movq	%rsi, %rbx
+ 194 01e9 BEA00400 		movl	$1184, %esi
+ 194      00
+ 195 01ee E8000000 		call	munmap@PLT
+ 195      00
+ 196 01f3 4889DF   		movq	%rbx, %rdi
+ 197 01f6 5B       		popq	%rbx
+ 198              		.cfi_restore 3
+ 199              		.cfi_def_cfa_offset 8
+ 200 01f7 E9000000 		jmp	shm_unlink@PLT
+ 200      00
+ 201 01fc 0F1F4000 		.p2align 4,,10
+ 202              		.p2align 3
+ 203              	.L30:
+ 204 0200 C3       		ret
+ 205              		.cfi_endproc
+ 206              	.LFE20:
+ 208 0201 66662E0F 		.p2align 4
+ 208      1F840000 
+ 208      0000000F 
+ 208      1F4000
+ 209              		.globl	shmstats_open
+ 211              	shmstats_open:
+ 212              	.LFB21:
+ 213              		.cfi_startproc
+ 214 0210 55       		pushq	%rbp
+ 215              		.cfi_def_cfa_offset 16
+ 216              		.cfi_offset 6, -16
+ 217 0211 31D2     		xorl	%edx, %edx
+ 218 0213 31F6     		xorl	%esi, %esi
+ 219 0215 53       		pushq	%rbx
+ 220              		.cfi_def_cfa_offset 24
+ 221              		.cfi_offset 3, -24
+ 222 0216 4881EC98 		subq	$152, %rsp
+ 222      000000
+ 223              		.cfi_def_cfa_offset 176
+ 224 021d E8000000 		call	shm_open@PLT
+ 224      00
+ 225 0222 85C0     		testl	%eax, %eax
+ 226 0224 7871     		js	.L36
+ 227 0226 4889E6   		movq	%rsp, %rsi
+ 228 0229 89C7     		movl	%eax, %edi
+ 229 022b 89C3     		movl	%eax, %ebx
+ 230 022d E8000000 		call	fstat@PLT
+ 230      00
+ 231 0232 85C0     		testl	%eax, %eax
+ 232 0234 755A     		jne	.L37
+ 233 0236 48817C24 		cmpq	$1183, 48(%rsp)
+ 233      309F0400 
+ 233      00
+ 234 023f 7E4F     		jle	.L37
+ 235 0241 31FF     		xorl	%edi, %edi
+ 236 0243 4531C9   		xorl	%r9d, %r9d
+ 237 0246 4189D8   		movl	%ebx, %r8d
+ 238 0249 B9010000 		movl	$1, %ecx
+ 238      00
+ 239 024e BA010000 		movl	$1, %edx
+ 239      00
+ 240 0253 BEA00400 		movl	$1184, %esi
+ 240      00
+ 241 0258 E8000000 		call	mmap@PLT
+ 241      00
+ 242 025d 89DF     		movl	%ebx, %edi
+ 243 025f 4889C5   		movq	%rax, %rbp
+ 244 0262 E8000000 		call	close@PLT
+ 244      00
+ 245 0267 4883FDFF 		cmpq	$-1, %rbp
+ 246 026b 742A     		je	.L36
+ 247 026d 8B4500   		movl	0(%rbp), %eax
+ 248 0270 3D707364 		cmpl	$1902408560, %eax
+ 248      71
+ 249 0275 7539     		jne	.L41
+ 250 0277 837D0401 		cmpl	$1, 4(%rbp)
+ 251 027b 7533     		jne	.L41
+ 252 027d 4881C498 		addq	$152, %rsp
+ 252      000000
+ 253              		.cfi_remember_state
+ 254              		.cfi_def_cfa_offset 24
+ 255 0284 4889E8   		movq	%rbp, %rax
+ 256 0287 5B       		popq	%rbx
+ 257              		.cfi_def_cfa_offset 16
+ 258 0288 5D       		popq	%rbp
+ 259              		.cfi_def_cfa_offset 8
+ 260 0289 C3       		ret
+ 261 028a 660F1F44 		.p2align 4,,10
+ 261      0000
+ 262              		.p2align 3
+ 263              	.L37:
+ 264              		.cfi_restore_state
+ 265 0290 89DF     		movl	%ebx, %edi
+ 266 0292 E8000000 		call	close@PLT
+ 266      00
+ 267              	.L36:
+ 268 0297 31ED     		xorl	%ebp, %ebp
+ 269              	.L46:
+ 270 0299 4881C498 		addq	$152, %rsp
+ 270      000000
+ 271              		.cfi_remember_state
+ 272              		.cfi_def_cfa_offset 24
+ 273 02a0 4889E8   		movq	%rbp, %rax
+ 274 02a3 5B       		popq	%rbx
+ 275              		.cfi_def_cfa_offset 16
+ 276 02a4 5D       		popq	%rbp
+ 277              		.cfi_def_cfa_offset 8
+ 278 02a5 C3       		ret
+ 279 02a6 662E0F1F 		.p2align 4,,10
+ 279      84000000 
+ 279      0000
+ 280              		.p2align 3
+ 281              	.L41:
+ 282              		.cfi_restore_state
+ 283 02b0 4889EF   		movq	%rbp, %rdi
+ 284 02b3 BEA00400 		movl	$1184, %esi
+ 284      00
+ 285 02b8 31ED     		xorl	%ebp, %ebp
+ 286 02ba E8000000 		call	munmap@PLT
+ 286      00
+ 287 02bf EBD8     		jmp	.L46
+ 288              		.cfi_endproc
+ 289              	.LFE21:
+ 291 02c1 66662E0F 		.p2align 4
+ 291      1F840000 
+ 291      0000000F 
+ 291      1F4000
+ 292              		.globl	shmstats_snapshot
+ 294              	shmstats_snapshot:
+ 295              	.LFB22:
+ 296              		.cfi_startproc
+ 297 02d0 53       		pushq	%rbx
+ 298              		.cfi_def_cfa_offset 16
+ 299              		.cfi_offset 3, -16
+ 300 02d1 4989F8   		movq	%rdi, %r8
+ 301 02d4 4889F2   		movq	%rsi, %rdx
+ 302 02d7 4C8D4F08 		leaq	8(%rdi), %r9
+ 303 02db 488D9EA8 		leaq	1192(%rsi), %rbx
+ 303      040000
+ 304 02e2 4C8D9FA8 		leaq	1192(%rdi), %r11
+ 304      040000
+ 305 02e9 4C8D5608 		leaq	8(%rsi), %r10
+ 306 02ed 0F1F00   		.p2align 4,,10
+ 307              		.p2align 3
+ 308              	.L49:
+ 309 02f0 418B01   		movl	(%r9), %eax
+ 310 02f3 4C89D7   		movq	%r10, %rdi
+ 311 02f6 4C89C6   		movq	%r8, %rsi
+ 312 02f9 4883E7F8 		andq	$-8, %rdi
+ 313 02fd 498B08   		movq	(%r8), %rcx
+ 314 0300 48890A   		movq	%rcx, (%rdx)
+ 315 0303 498B4BF0 		movq	-16(%r11), %rcx
+ 316 0307 48894BF0 		movq	%rcx, -16(%rbx)
+ 317 030b 4889D1   		movq	%rdx, %rcx
+ 318 030e 4829F9   		subq	%rdi, %rcx
+ 319 0311 4829CE   		subq	%rcx, %rsi
+ 320 0314 81C1A004 		addl	$1184, %ecx
+ 320      0000
+ 321 031a C1E903   		shrl	$3, %ecx
+ 322 031d F348A5   		rep movsq
+ 323 0320 418B09   		movl	(%r9), %ecx
+ 324 0323 39C8     		cmpl	%ecx, %eax
+ 325 0325 75C9     		jne	.L49
+ 326 0327 A801     		testb	$1, %al
+ 327 0329 75C5     		jne	.L49
+ 328 032b 5B       		popq	%rbx
+ 329              		.cfi_def_cfa_offset 8
+ 330 032c C3       		ret
+ 331              		.cfi_endproc
+ 332              	.LFE22:
+ 334              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 335              		.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,654 @@
+   1              		.file	"trace.c"
+   2              		.text
+   3              		.p2align 4
+   5              	write_string:
+   6              	.LFB18:
+   7              		.cfi_startproc
+   8 0000 55       		pushq	%rbp
+   9              		.cfi_def_cfa_offset 16
+  10              		.cfi_offset 6, -16
+  11 0001 4889FD   		movq	%rdi, %rbp
+  12 0004 53       		pushq	%rbx
+  13              		.cfi_def_cfa_offset 24
+  14              		.cfi_offset 3, -24
+  15 0005 4889F3   		movq	%rsi, %rbx
+  16 0008 4889FE   		movq	%rdi, %rsi
+  17 000b BF220000 		movl	$34, %edi
+  17      00
+  18 0010 4883EC08 		subq	$8, %rsp
+  19              		.cfi_def_cfa_offset 32
+  20 0014 E8000000 		call	fputc@PLT
+  20      00
+  21 0019 0FB603   		movzbl	(%rbx), %eax
+  22 001c 84C0     		testb	%al, %al
+  23 001e 751E     		jne	.L5
+  24 0020 EB36     		jmp	.L2
+  25              		.p2align 4,,10
+  26 0022 660F1F44 		.p2align 3
+  26      0000
+  27              	.L3:
+  28 0028 0FBE3B   		movsbl	(%rbx), %edi
+  29 002b 4889EE   		movq	%rbp, %rsi
+  30 002e 4883C301 		addq	$1, %rbx
+  31 0032 E8000000 		call	fputc@PLT
+  31      00
+  32 0037 0FB603   		movzbl	(%rbx), %eax
+  33 003a 84C0     		testb	%al, %al
+  34 003c 741A     		je	.L2
+  35              	.L5:
+  36 003e 3C22     		cmpb	$34, %al
+  37 0040 7404     		je	.L6
+  38 0042 3C5C     		cmpb	$92, %al
+  39 0044 75E2     		jne	.L3
+  40              	.L6:
+  41 0046 4889EE   		movq	%rbp, %rsi
+  42 0049 BF5C0000 		movl	$92, %edi
+  42      00
+  43 004e E8000000 		call	fputc@PLT
+  43      00
+  44 0053 EBD3     		jmp	.L3
+  45              		.p2align 4,,10
+  46 0055 0F1F00   		.p2align 3
+  47              	.L2:
+  48 0058 4883C408 		addq	$8, %rsp
+  49              		.cfi_def_cfa_offset 24
+  50 005c 4889EE   		movq	%rbp, %rsi
+  51 005f BF220000 		movl	$34, %edi
+  51      00
+  52 0064 5B       		popq	%rbx
+  53              		.cfi_def_cfa_offset 16
+  54 0065 5D       		popq	%rbp
+  55              		.cfi_def_cfa_offset 8
+  56 0066 E9000000 		jmp	fputc@PLT
+  56      00
+  57              		.cfi_endproc
+  58              	.LFE18:
+  60 006b 0F1F4400 		.p2align 4
+  60      00
+  61              		.globl	trace_tid
+  63              	trace_tid:
+  64              	.LFB15:
+  65              		.cfi_startproc
+  66 0070 4883EC08 		subq	$8, %rsp
+  67              		.cfi_def_cfa_offset 16
+  68 0074 488D3D00 		leaq	tid@tlsld(%rip), %rdi
+  68      000000
+  69 007b E8000000 		call	__tls_get_addr@PLT
+  69      00
+  70 0080 8B900000 		movl	tid@dtpoff(%rax), %edx
+  70      0000
+  71 0086 85D2     		testl	%edx, %edx
+  72 0088 740E     		je	.L19
+  73 008a 89D0     		movl	%edx, %eax
+  74 008c 4883C408 		addq	$8, %rsp
+  75              		.cfi_remember_state
+  76              		.cfi_def_cfa_offset 8
+  77 0090 C3       		ret
+  78              		.p2align 4,,10
+  79 0091 0F1F8000 		.p2align 3
+  79      000000
+  80              	.L19:
+  81              		.cfi_restore_state
+  82 0098 BA010000 		movl	$1, %edx
+  82      00
+  83 009d F00FC115 		lock xaddl	%edx, ntids(%rip)
+  83      00000000 
+  84 00a5 83C201   		addl	$1, %edx
+  85 00a8 89900000 		movl	%edx, tid@dtpoff(%rax)
+  85      0000
+  86 00ae 89D0     		movl	%edx, %eax
+  87 00b0 4883C408 		addq	$8, %rsp
+  88              		.cfi_def_cfa_offset 8
+  89 00b4 C3       		ret
+  90              		.cfi_endproc
+  91              	.LFE15:
+  93              		.section	.rodata.str1.8,"aMS",@progbits,1
+  94              		.align 8
+  95              	.LC0:
+  96 0000 436F756C 		.string	"Could not allocate memory for trace.\n"
+  96      64206E6F 
+  96      7420616C 
+  96      6C6F6361 
+  96      7465206D 
+  97              		.text
+  98 00b5 66662E0F 		.p2align 4
+  98      1F840000 
+  98      000000
+  99              		.globl	trace_create
+ 101              	trace_create:
+ 102              	.LFB16:
+ 103              		.cfi_startproc
+ 104 00c0 4155     		pushq	%r13
+ 105              		.cfi_def_cfa_offset 16
+ 106              		.cfi_offset 13, -16
+ 107 00c2 4189FD   		movl	%edi, %r13d
+ 108 00c5 BF180000 		movl	$24, %edi
+ 108      00
+ 109 00ca 4154     		pushq	%r12
+ 110              		.cfi_def_cfa_offset 24
+ 111              		.cfi_offset 12, -24
+ 112 00cc 55       		pushq	%rbp
+ 113              		.cfi_def_cfa_offset 32
+ 114              		.cfi_offset 6, -32
+ 115 00cd BD010000 		movl	$1, %ebp
+ 115      00
+ 116 00d2 53       		pushq	%rbx
+ 117              		.cfi_def_cfa_offset 40
+ 118              		.cfi_offset 3, -40
+ 119 00d3 C4E291F7 		shlx	%r13, %rbp, %rbp
+ 119      ED
+ 120 00d8 4883EC08 		subq	$8, %rsp
+ 121              		.cfi_def_cfa_offset 48
+ 122 00dc E8000000 		call	malloc@PLT
+ 122      00
+ 123 00e1 4889C3   		movq	%rax, %rbx
+ 124 00e4 4885C0   		testq	%rax, %rax
+ 125 00e7 744D     		je	.L24
+ 126              	.L21:
+ 127 00e9 41BC2000 		movl	$32, %r12d
+ 127      0000
+ 128 00ef C44291F7 		shlx	%r13, %r12, %r12
+ 128      E4
+ 129 00f4 4C89E7   		movq	%r12, %rdi
+ 130 00f7 E8000000 		call	malloc@PLT
+ 130      00
+ 131 00fc 488903   		movq	%rax, (%rbx)
+ 132 00ff 4889C7   		movq	%rax, %rdi
+ 133 0102 4885C0   		testq	%rax, %rax
+ 134 0105 743D     		je	.L25
+ 135              	.L22:
+ 136 0107 4C89E2   		movq	%r12, %rdx
+ 137 010a 4883ED01 		subq	$1, %rbp
+ 138 010e 31F6     		xorl	%esi, %esi
+ 139 0110 E8000000 		call	memset@PLT
+ 139      00
+ 140 0115 48896B08 		movq	%rbp, 8(%rbx)
+ 141 0119 48C74310 		movq	$0, 16(%rbx)
+ 141      00000000 
+ 142 0121 488B0500 		movq	tracebuf@GOTPCREL(%rip), %rax
+ 142      000000
+ 143 0128 488918   		movq	%rbx, (%rax)
+ 144 012b 4883C408 		addq	$8, %rsp
+ 145              		.cfi_remember_state
+ 146              		.cfi_def_cfa_offset 40
+ 147 012f 5B       		popq	%rbx
+ 148              		.cfi_def_cfa_offset 32
+ 149 0130 5D       		popq	%rbp
+ 150              		.cfi_def_cfa_offset 24
+ 151 0131 415C     		popq	%r12
+ 152              		.cfi_def_cfa_offset 16
+ 153 0133 415D     		popq	%r13
+ 154              		.cfi_def_cfa_offset 8
+ 155 0135 C3       		ret
+ 156              	.L24:
+ 157              		.cfi_restore_state
+ 158 0136 488D3D00 		leaq	.LC0(%rip), %rdi
+ 158      000000
+ 159 013d E8000000 		call	endprogram@PLT
+ 159      00
+ 160 0142 EBA5     		jmp	.L21
+ 161              	.L25:
+ 162 0144 488D3D00 		leaq	.LC0(%rip), %rdi
+ 162      000000
+ 163 014b E8000000 		call	endprogram@PLT
+ 163      00
+ 164 0150 488B3B   		movq	(%rbx), %rdi
+ 165 0153 EBB2     		jmp	.L22
+ 166              		.cfi_endproc
+ 167              	.LFE16:
+ 169 0155 66662E0F 		.p2align 4
+ 169      1F840000 
+ 169      000000
+ 170              		.globl	trace_thread_name
+ 172              	trace_thread_name:
+ 173              	.LFB17:
+ 174              		.cfi_startproc
+ 175 0160 53       		pushq	%rbx
+ 176              		.cfi_def_cfa_offset 16
+ 177              		.cfi_offset 3, -16
+ 178 0161 4889FB   		movq	%rdi, %rbx
+ 179 0164 E8000000 		call	trace_tid@PLT
+ 179      00
+ 180 0169 83F83F   		cmpl	$63, %eax
+ 181 016c 7710     		ja	.L28
+ 182 016e 488D1500 		leaq	thread_names(%rip), %rdx
+ 182      000000
+ 183 0175 89C0     		movl	%eax, %eax
+ 184 0177 48833CC2 		cmpq	$0, (%rdx,%rax,8)
+ 184      00
+ 185 017c 7402     		je	.L30
+ 186              	.L28:
+ 187 017e 5B       		popq	%rbx
+ 188              		.cfi_remember_state
+ 189              		.cfi_def_cfa_offset 8
+ 190 017f C3       		ret
+ 191              		.p2align 4,,10
+ 192              		.p2align 3
+ 193              	.L30:
+ 194              		.cfi_restore_state
+ 195 0180 48891CC2 		movq	%rbx, (%rdx,%rax,8)
+ 196 0184 5B       		popq	%rbx
+ 197              		.cfi_def_cfa_offset 8
+ 198 0185 C3       		ret
+ 199              		.cfi_endproc
+ 200              	.LFE17:
+ 202              		.section	.rodata.str1.1,"aMS",@progbits,1
+ 203              	.LC1:
+ 204 0000 2C0A00   		.string	",\n"
+ 205              	.LC2:
+ 206 0003 00       		.string	""
+ 207              	.LC3:
+ 208 0004 7700     		.string	"w"
+ 209              		.section	.rodata.str1.8
+ 210 0026 0000     		.align 8
+ 211              	.LC4:
+ 212 0028 25733A20 		.string	"%s: Could not open %s for writing\n"
+ 212      436F756C 
+ 212      64206E6F 
+ 212      74206F70 
+ 212      656E2025 
+ 213 004b 00000000 		.align 8
+ 213      00
+ 214              	.LC5:
+ 215 0050 7B226469 		.string	"{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n"
+ 215      73706C61 
+ 215      7954696D 
+ 215      65556E69 
+ 215      74223A22 
+ 216 0079 00000000 		.align 8
+ 216      000000
+ 217              	.LC6:
+ 218 0080 25737B22 		.string	"%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":"
+ 218      6E616D65 
+ 218      223A2274 
+ 218      68726561 
+ 218      645F6E61 
+ 219              		.section	.rodata.str1.1
+ 220              	.LC7:
+ 221 0006 7D7D00   		.string	"}}"
+ 222              	.LC8:
+ 223 0009 25737B22 		.string	"%s{\"name\":"
+ 223      6E616D65 
+ 223      223A00
+ 224              		.section	.rodata.str1.8
+ 225 00c2 00000000 		.align 8
+ 225      0000
+ 226              	.LC9:
+ 227 00c8 2C227068 		.string	",\"ph\":\"%c\",\"ts\":%llu.%03llu,\"pid\":1,\"tid\":%u}"
+ 227      223A2225 
+ 227      63222C22 
+ 227      7473223A 
+ 227      256C6C75 
+ 228              		.section	.rodata.str1.1
+ 229              	.LC10:
+ 230 0014 0A5D7D0A 		.string	"\n]}\n"
+ 230      00
+ 231              	.LC11:
+ 232 0019 25733A20 		.string	"%s: Could not write %s\n"
+ 232      436F756C 
+ 232      64206E6F 
+ 232      74207772 
+ 232      69746520 
+ 233              		.section	.rodata.str1.8
+ 234 00f6 0000     		.align 8
+ 235              	.LC12:
+ 236 00f8 57726F74 		.string	"Wrote %llu trace events to %s\n"
+ 236      6520256C 
+ 236      6C752074 
+ 236      72616365 
+ 236      20657665 
+ 237              		.text
+ 238 0186 662E0F1F 		.p2align 4
+ 238      84000000 
+ 238      0000
+ 239              		.globl	trace_write
+ 241              	trace_write:
+ 242              	.LFB19:
+ 243              		.cfi_startproc
+ 244 0190 4157     		pushq	%r15
+ 245              		.cfi_def_cfa_offset 16
+ 246              		.cfi_offset 15, -16
+ 247 0192 4156     		pushq	%r14
+ 248              		.cfi_def_cfa_offset 24
+ 249              		.cfi_offset 14, -24
+ 250 0194 4155     		pushq	%r13
+ 251              		.cfi_def_cfa_offset 32
+ 252              		.cfi_offset 13, -32
+ 253 0196 4154     		pushq	%r12
+ 254              		.cfi_def_cfa_offset 40
+ 255              		.cfi_offset 12, -40
+ 256 0198 55       		pushq	%rbp
+ 257              		.cfi_def_cfa_offset 48
+ 258              		.cfi_offset 6, -48
+ 259 0199 53       		pushq	%rbx
+ 260              		.cfi_def_cfa_offset 56
+ 261              		.cfi_offset 3, -56
+ 262 019a 4883EC28 		subq	$40, %rsp
+ 263              		.cfi_def_cfa_offset 96
+ 264 019e 4C8B2500 		movq	tracebuf@GOTPCREL(%rip), %r12
+ 264      000000
+ 265 01a5 48897C24 		movq	%rdi, 16(%rsp)
+ 265      10
+ 266 01aa 49833C24 		cmpq	$0, (%r12)
+ 266      00
+ 267 01af 0F842B02 		je	.L32
+ 267      0000
+ 268 01b5 488D3500 		leaq	.LC3(%rip), %rsi
+ 268      000000
+ 269 01bc E8000000 		call	fopen@PLT
+ 269      00
+ 270 01c1 4889C3   		movq	%rax, %rbx
+ 271 01c4 4885C0   		testq	%rax, %rax
+ 272 01c7 0F845B02 		je	.L57
+ 272      0000
+ 273 01cd 498B0424 		movq	(%r12), %rax
+ 274 01d1 BE010000 		movl	$1, %esi
+ 274      00
+ 275 01d6 488D3D00 		leaq	.LC5(%rip), %rdi
+ 275      000000
+ 276 01dd 41BD0100 		movl	$1, %r13d
+ 276      0000
+ 277 01e3 488D2D00 		leaq	thread_names(%rip), %rbp
+ 277      000000
+ 278 01ea 4C8D3D00 		leaq	.LC1(%rip), %r15
+ 278      000000
+ 279 01f1 4C8B5010 		movq	16(%rax), %r10
+ 280 01f5 4C8D3500 		leaq	.LC2(%rip), %r14
+ 280      000000
+ 281 01fc 4C891424 		movq	%r10, (%rsp)
+ 282 0200 498B0424 		movq	(%r12), %rax
+ 283 0204 488B5008 		movq	8(%rax), %rdx
+ 284 0208 4C89D0   		movq	%r10, %rax
+ 285 020b 488D4A01 		leaq	1(%rdx), %rcx
+ 286 020f 4829D0   		subq	%rdx, %rax
+ 287 0212 BA000000 		movl	$0, %edx
+ 287      00
+ 288 0217 4883E801 		subq	$1, %rax
+ 289 021b 4C39D1   		cmpq	%r10, %rcx
+ 290 021e 4889D9   		movq	%rbx, %rcx
+ 291 0221 480F42D0 		cmovb	%rax, %rdx
+ 292 0225 48895424 		movq	%rdx, 24(%rsp)
+ 292      18
+ 293 022a BA280000 		movl	$40, %edx
+ 293      00
+ 294 022f E8000000 		call	fwrite@PLT
+ 294      00
+ 295 0234 31D2     		xorl	%edx, %edx
+ 296 0236 EB5F     		jmp	.L36
+ 297 0238 0F1F8400 		.p2align 4,,10
+ 297      00000000 
+ 298              		.p2align 3
+ 299              	.L40:
+ 300 0240 4A837CED 		cmpq	$0, 0(%rbp,%r13,8)
+ 300      0000
+ 301 0246 7445     		je	.L37
+ 302 0248 84D2     		testb	%dl, %dl
+ 303 024a 4C89F2   		movq	%r14, %rdx
+ 304 024d 488D3500 		leaq	.LC6(%rip), %rsi
+ 304      000000
+ 305 0254 4889DF   		movq	%rbx, %rdi
+ 306 0257 490F45D7 		cmovne	%r15, %rdx
+ 307 025b 31C0     		xorl	%eax, %eax
+ 308 025d E8000000 		call	fprintf@PLT
+ 308      00
+ 309 0262 4A8B74ED 		movq	0(%rbp,%r13,8), %rsi
+ 309      00
+ 310 0267 4889DF   		movq	%rbx, %rdi
+ 311 026a E891FDFF 		call	write_string
+ 311      FF
+ 312 026f BA020000 		movl	$2, %edx
+ 312      00
+ 313 0274 4889D9   		movq	%rbx, %rcx
+ 314 0277 BE010000 		movl	$1, %esi
+ 314      00
+ 315 027c 488D3D00 		leaq	.LC7(%rip), %rdi
+ 315      000000
+ 316 0283 E8000000 		call	fwrite@PLT
+ 316      00
+ 317 0288 BA010000 		movl	$1, %edx
+ 317      00
+ 318              	.L37:
+ 319 028d 4983C501 		addq	$1, %r13
+ 320 0291 4983FD40 		cmpq	$64, %r13
+ 321 0295 740C     		je	.L39
+ 322              	.L36:
+ 323 0297 44392D00 		cmpl	%r13d, ntids(%rip)
+ 323      000000
+ 324 029e 4489E9   		movl	%r13d, %ecx
+ 325 02a1 739D     		jnb	.L40
+ 326              	.L39:
+ 327 02a3 4C8B1424 		movq	(%rsp), %r10
+ 328 02a7 488B4424 		movq	24(%rsp), %rax
+ 328      18
+ 329 02ac 4C39D0   		cmpq	%r10, %rax
+ 330 02af 0F83DE00 		jnb	.L41
+ 330      0000
+ 331 02b5 4889C5   		movq	%rax, %rbp
+ 332 02b8 4D89D5   		movq	%r10, %r13
+ 333 02bb EB0C     		jmp	.L46
+ 334 02bd 0F1F00   		.p2align 4,,10
+ 335              		.p2align 3
+ 336              	.L44:
+ 337 02c0 4C39ED   		cmpq	%r13, %rbp
+ 338 02c3 0F83C700 		jnb	.L58
+ 338      0000
+ 339              	.L46:
+ 340 02c9 498B0C24 		movq	(%r12), %rcx
+ 341 02cd 488B4108 		movq	8(%rcx), %rax
+ 342 02d1 4821E8   		andq	%rbp, %rax
+ 343 02d4 4883C501 		addq	$1, %rbp
+ 344 02d8 48C1E005 		salq	$5, %rax
+ 345 02dc 480301   		addq	(%rcx), %rax
+ 346 02df 488B08   		movq	(%rax), %rcx
+ 347 02e2 4839E9   		cmpq	%rbp, %rcx
+ 348 02e5 75D9     		jne	.L44
+ 349 02e7 4C8B7808 		movq	8(%rax), %r15
+ 350 02eb 488B4810 		movq	16(%rax), %rcx
+ 351 02ef 48894C24 		movq	%rcx, 8(%rsp)
+ 351      08
+ 352 02f4 448B4818 		movl	24(%rax), %r9d
+ 353 02f8 44890C24 		movl	%r9d, (%rsp)
+ 354 02fc 440FB670 		movzbl	28(%rax), %r14d
+ 354      1C
+ 355 0301 488B00   		movq	(%rax), %rax
+ 356 0304 4839C5   		cmpq	%rax, %rbp
+ 357 0307 75B7     		jne	.L44
+ 358 0309 84D2     		testb	%dl, %dl
+ 359 030b 488D0500 		leaq	.LC1(%rip), %rax
+ 359      000000
+ 360 0312 488D1500 		leaq	.LC2(%rip), %rdx
+ 360      000000
+ 361 0319 4889DF   		movq	%rbx, %rdi
+ 362 031c 480F45D0 		cmovne	%rax, %rdx
+ 363 0320 488D3500 		leaq	.LC8(%rip), %rsi
+ 363      000000
+ 364 0327 31C0     		xorl	%eax, %eax
+ 365 0329 E8000000 		call	fprintf@PLT
+ 365      00
+ 366 032e 488B7424 		movq	8(%rsp), %rsi
+ 366      08
+ 367 0333 4889DF   		movq	%rbx, %rdi
+ 368 0336 E8C5FCFF 		call	write_string
+ 368      FF
+ 369 033b 4C89F9   		movq	%r15, %rcx
+ 370 033e 448B0C24 		movl	(%rsp), %r9d
+ 371 0342 4D89F8   		movq	%r15, %r8
+ 372 0345 48C1E903 		shrq	$3, %rcx
+ 373 0349 488D3500 		leaq	.LC9(%rip), %rsi
+ 373      000000
+ 374 0350 4889DF   		movq	%rbx, %rdi
+ 375 0353 48B8CFF7 		movabsq	$2361183241434822607, %rax
+ 375      53E3A59B 
+ 375      C420
+ 376 035d 48F7E1   		mulq	%rcx
+ 377 0360 4889D1   		movq	%rdx, %rcx
+ 378 0363 410FBED6 		movsbl	%r14b, %edx
+ 379 0367 48C1E904 		shrq	$4, %rcx
+ 380 036b 4869C1E8 		imulq	$1000, %rcx, %rax
+ 380      030000
+ 381 0372 4929C0   		subq	%rax, %r8
+ 382 0375 31C0     		xorl	%eax, %eax
+ 383 0377 E8000000 		call	fprintf@PLT
+ 383      00
+ 384 037c BA010000 		movl	$1, %edx
+ 384      00
+ 385 0381 4C39ED   		cmpq	%r13, %rbp
+ 386 0384 0F823FFF 		jb	.L46
+ 386      FFFF
+ 387 038a 660F1F44 		.p2align 4,,10
+ 387      0000
+ 388              		.p2align 3
+ 389              	.L58:
+ 390 0390 4D89EA   		movq	%r13, %r10
+ 391              	.L41:
+ 392 0393 4889D9   		movq	%rbx, %rcx
+ 393 0396 BA040000 		movl	$4, %edx
+ 393      00
+ 394 039b BE010000 		movl	$1, %esi
+ 394      00
+ 395 03a0 4C891424 		movq	%r10, (%rsp)
+ 396 03a4 488D3D00 		leaq	.LC10(%rip), %rdi
+ 396      000000
+ 397 03ab E8000000 		call	fwrite@PLT
+ 397      00
+ 398 03b0 4889DF   		movq	%rbx, %rdi
+ 399 03b3 E8000000 		call	fclose@PLT
+ 399      00
+ 400 03b8 4C8B1424 		movq	(%rsp), %r10
+ 401 03bc 85C0     		testl	%eax, %eax
+ 402 03be 7538     		jne	.L59
+ 403 03c0 488B4424 		movq	24(%rsp), %rax
+ 403      18
+ 404 03c5 4C89D2   		movq	%r10, %rdx
+ 405 03c8 488B4C24 		movq	16(%rsp), %rcx
+ 405      10
+ 406 03cd 31FF     		xorl	%edi, %edi
+ 407 03cf 488D3500 		leaq	.LC12(%rip), %rsi
+ 407      000000
+ 408 03d6 4829C2   		subq	%rax, %rdx
+ 409 03d9 31C0     		xorl	%eax, %eax
+ 410 03db E8000000 		call	debugprint@PLT
+ 410      00
+ 411              	.L32:
+ 412 03e0 4883C428 		addq	$40, %rsp
+ 413              		.cfi_remember_state
+ 414              		.cfi_def_cfa_offset 56
+ 415 03e4 31C0     		xorl	%eax, %eax
+ 416 03e6 5B       		popq	%rbx
+ 417              		.cfi_def_cfa_offset 48
+ 418 03e7 5D       		popq	%rbp
+ 419              		.cfi_def_cfa_offset 40
+ 420 03e8 415C     		popq	%r12
+ 421              		.cfi_def_cfa_offset 32
+ 422 03ea 415D     		popq	%r13
+ 423              		.cfi_def_cfa_offset 24
+ 424 03ec 415E     		popq	%r14
+ 425              		.cfi_def_cfa_offset 16
+ 426 03ee 415F     		popq	%r15
+ 427              		.cfi_def_cfa_offset 8
+ 428 03f0 C3       		ret
+ 429              		.p2align 4,,10
+ 430 03f1 0F1F8000 		.p2align 3
+ 430      000000
+ 431              	.L59:
+ 432              		.cfi_restore_state
+ 433 03f8 488B4C24 		movq	16(%rsp), %rcx
+ 433      10
+ 434 03fd 488D1500 		leaq	__func__.0(%rip), %rdx
+ 434      000000
+ 435 0404 31FF     		xorl	%edi, %edi
+ 436 0406 31C0     		xorl	%eax, %eax
+ 437 0408 488D3500 		leaq	.LC11(%rip), %rsi
+ 437      000000
+ 438 040f E8000000 		call	debugprint@PLT
+ 438      00
+ 439              	.L34:
+ 440 0414 4883C428 		addq	$40, %rsp
+ 441              		.cfi_remember_state
+ 442              		.cfi_def_cfa_offset 56
+ 443 0418 B8010000 		movl	$1, %eax
+ 443      00
+ 444 041d 5B       		popq	%rbx
+ 445              		.cfi_def_cfa_offset 48
+ 446 041e 5D       		popq	%rbp
+ 447              		.cfi_def_cfa_offset 40
+ 448 041f 415C     		popq	%r12
+ 449              		.cfi_def_cfa_offset 32
+ 450 0421 415D     		popq	%r13
+ 451              		.cfi_def_cfa_offset 24
+ 452 0423 415E     		popq	%r14
+ 453              		.cfi_def_cfa_offset 16
+ 454 0425 415F     		popq	%r15
+ 455              		.cfi_def_cfa_offset 8
+ 456 0427 C3       		ret
+ 457              	.L57:
+ 458              		.cfi_restore_state
+ 459 0428 488B4C24 		movq	16(%rsp), %rcx
+ 459      10
+ 460 042d 488D1500 		leaq	__func__.0(%rip), %rdx
+ 460      000000
+ 461 0434 31FF     		xorl	%edi, %edi
+ 462 0436 31C0     		xorl	%eax, %eax
+ 463 0438 488D3500 		leaq	.LC4(%rip), %rsi
+ 463      000000
+ 464 043f E8000000 		call	debugprint@PLT
+ 464      00
+ 465 0444 EBCE     		jmp	.L34
+ 466              		.cfi_endproc
+ 467              	.LFE19:
+ 469 0446 662E0F1F 		.p2align 4
+ 469      84000000 
+ 469      0000
+ 470              		.globl	trace_destroy
+ 472              	trace_destroy:
+ 473              	.LFB20:
+ 474              		.cfi_startproc
+ 475 0450 53       		pushq	%rbx
+ 476              		.cfi_def_cfa_offset 16
+ 477              		.cfi_offset 3, -16
+ 478 0451 488B0500 		movq	tracebuf@GOTPCREL(%rip), %rax
+ 478      000000
+ 479 0458 31DB     		xorl	%ebx, %ebx
+ 480 045a 488718   		xchgq	(%rax), %rbx
+ 481 045d 4885DB   		testq	%rbx, %rbx
+ 482 0460 7506     		jne	.L64
+ 483 0462 5B       		popq	%rbx
+ 484              		.cfi_remember_state
+ 485              		.cfi_def_cfa_offset 8
+ 486 0463 C3       		ret
+ 487              		.p2align 4,,10
+ 488 0464 0F1F4000 		.p2align 3
+ 489              	.L64:
+ 490              		.cfi_restore_state
+ 491 0468 488B3B   		movq	(%rbx), %rdi
+ 492 046b E8000000 		call	free@PLT
+ 492      00
+ 493 0470 4889DF   		movq	%rbx, %rdi
+ 494 0473 5B       		popq	%rbx
+ 495              		.cfi_def_cfa_offset 8
+ 496 0474 E9000000 		jmp	free@PLT
+ 496      00
+ 497              		.cfi_endproc
+ 498              	.LFE20:
+ 500              		.section	.rodata
+ 501              		.align 8
+ 504              	__func__.0:
+ 505 0000 74726163 		.string	"trace_write"
+ 505      655F7772 
+ 505      69746500 
+ 506              		.local	thread_names
+ 507              		.comm	thread_names,512,32
+ 508              		.section	.tbss,"awT",@nobits
+ 509              		.align 4
+ 512              	tid:
+ 513 0000 00000000 		.zero	4
+ 514              		.local	ntids
+ 515              		.comm	ntids,4,4
+ 516              		.globl	tracebuf
+ 517              		.bss
+ 518              		.align 8
+ 521              	tracebuf:
+ 522 0000 00000000 		.zero	8
+ 522      00000000 
+ 523              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 524              		.section	.note.GNU-stack,"",@progbits
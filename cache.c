@@ -0,0 +1,144 @@
+#define _XOPEN_SOURCE 500
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "cache.h"
+#include "dsp.h"
+
+#define CACHE_MAGIC "QDSPCAC1"
+#define CACHE_HEADER 64
+
+struct cache_header_t {
+    char magic[8];
+    uint64_t key;
+    uint64_t len;
+};
+
+/* FNV-1a, 64 bit */
+uint64_t cache_hash(uint64_t hash, const void * data, size_t len)
+{
+    const unsigned char * p = data;
+    for (size_t i = 0; i < len; i++) {
+        hash ^= p[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+/* Hashes the contents of filename, ok is cleared if it can not be read */
+uint64_t cache_hash_file(uint64_t hash, const char * filename, bool * ok)
+{
+    unsigned char buf[65536];
+    FILE * fid = fopen(filename, "rb");
+    size_t n;
+
+    if (!fid) {
+        *ok = false;
+        return hash;
+    }
+    while ((n = fread(buf, 1, sizeof(buf), fid)) > 0)
+        hash = cache_hash(hash, buf, n);
+    *ok = !ferror(fid);
+    fclose(fid);
+    return hash;
+}
+
+static const char * cache_dir(void)
+{
+    const char * dir = getenv("QDSP_CACHE_DIR");
+    return dir && *dir ? dir : NULL;
+}
+
+bool cache_enabled(void)
+{
+    return cache_dir() != NULL;
+}
+
+static void cache_filename(char * filename, size_t size, const char * kind, uint64_t key)
+{
+    snprintf(filename, size, "%s/%s-%016llx.bin", cache_dir(), kind, (unsigned long long)key);
+}
+
+bool cache_load(struct cache_entry_t * entry, const char * kind, uint64_t key)
+{
+    char filename[4096];
+    const struct cache_header_t * header;
+    struct stat st;
+    int fd;
+
+    entry->map = NULL;
+    if (!cache_enabled())
+        return false;
+    cache_filename(filename, sizeof(filename), kind, key);
+    if ((fd = open(filename, O_RDONLY)) < 0)
+        return false;
+    if (fstat(fd, &st) || st.st_size < CACHE_HEADER) {
+        close(fd);
+        return false;
+    }
+    entry->maplen = st.st_size;
+    entry->map = mmap(NULL, entry->maplen, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (entry->map == MAP_FAILED) {
+        entry->map = NULL;
+        return false;
+    }
+
+    header = entry->map;
+    if (memcmp(header->magic, CACHE_MAGIC, sizeof(header->magic)) || header->key != key ||
+        header->len != entry->maplen - CACHE_HEADER) {
+        debugprint(0, "%s: Ignoring invalid cache entry %s\n", __func__, filename);
+        cache_release(entry);
+        return false;
+    }
+    entry->data = (const char *)entry->map + CACHE_HEADER;
+    entry->len = header->len;
+    debugprint(1, "%s: %s\n", __func__, filename);
+    return true;
+}
+
+bool cache_store(const char * kind, uint64_t key, const void * data, size_t len)
+{
+    char filename[4096], tmpname[4096 + 32];
+    char header[CACHE_HEADER];
+    struct cache_header_t h;
+    FILE * fid;
+    bool ok;
+
+    if (!cache_enabled())
+        return false;
+    cache_filename(filename, sizeof(filename), kind, key);
+    snprintf(tmpname, sizeof(tmpname), "%s.%ld.tmp", filename, (long)getpid());
+
+    memset(header, 0, sizeof(header));
+    memcpy(h.magic, CACHE_MAGIC, sizeof(h.magic));
+    h.key = key;
+    h.len = len;
+    memcpy(header, &h, sizeof(h));
+
+    if (!(fid = fopen(tmpname, "wb"))) {
+        debugprint(0, "%s: Could not create %s: %s\n", __func__, tmpname, strerror(errno));
+        return false;
+    }
+    ok = fwrite(header, sizeof(header), 1, fid) == 1 && fwrite(data, 1, len, fid) == len;
+    ok = !fclose(fid) && ok;
+    if (ok && rename(tmpname, filename) == 0) {
+        debugprint(1, "%s: %s\n", __func__, filename);
+        return true;
+    }
+    debugprint(0, "%s: Could not write %s\n", __func__, filename);
+    unlink(tmpname);
+    return false;
+}
+
+void cache_release(struct cache_entry_t * entry)
+{
+    if (entry->map)
+        munmap(entry->map, entry->maplen);
+    entry->map = NULL;
+}
@@ -0,0 +1,33 @@
+#ifndef CACHE_H
+#define CACHE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * On-disk cache of data a stage prepares at create time, enabled by
+ * setting QDSP_CACHE_DIR to a directory. Entries are named by kind and a
+ * 64 bit key, which the stage derives with cache_hash() from everything
+ * the data depends on, and hold the data 64 byte aligned after a header.
+ * A hit is memory mapped read only, so several processes share the
+ * pages. Entries are written to a temporary file and renamed into place,
+ * so concurrent writers never expose a partial entry.
+ */
+#define CACHE_HASH_INIT 0xcbf29ce484222325ULL
+
+struct cache_entry_t {
+    void * map;
+    size_t maplen;
+    const void * data;
+    size_t len;
+};
+
+uint64_t cache_hash(uint64_t hash, const void * data, size_t len);
+uint64_t cache_hash_file(uint64_t hash, const char * filename, bool * ok);
+bool cache_enabled(void);
+bool cache_load(struct cache_entry_t * entry, const char * kind, uint64_t key);
+bool cache_store(const char * kind, uint64_t key, const void * data, size_t len);
+void cache_release(struct cache_entry_t * entry);
+
+#endif
@@ -0,0 +1,75 @@
+#define _XOPEN_SOURCE 500
+#include <stdlib.h>
+#include <string.h>
+#include "dsp.h"
+
+/*
+ * Chain to C code generator.
+ *
+ * Writes a self-contained C file for an initialised dsp chain. All
+ * coefficients become constants and all stages are inlined into one
+ * channel/frame loop nest, so the compiler can fuse and vectorise across
+ * stages. The file compiles into a shared object (make chain.so) that the
+ * "so" dsp type loads in place of the interpreted chain.
+ *
+ * Each stage implements dsp->codegen, which is called once per
+ * enum codegen_part with its position in the chain. Stage variables are
+ * prefixed s<stage>_ and the sample being processed is the float x.
+ */
+
+static int emit_part(struct qdsp_t * dsphead, FILE * out, enum codegen_part part)
+{
+    struct qdsp_t * dsp;
+    int stage = 0;
+
+    for (dsp = dsphead; dsp; dsp = dsp->next, stage++) {
+        if (dsp->codegen(dsp, out, part, stage))
+            return 1;
+    }
+    return 0;
+}
+
+int codegen_dsp(struct qdsp_t * dsphead, FILE * out)
+{
+    struct qdsp_t * dsp;
+    int errfnd = 0;
+
+    for (dsp = dsphead; dsp; dsp = dsp->next) {
+        if (!dsp->codegen) {
+            debugprint(0, "%s: '%s' does not support code generation\n", __func__, dsp->name);
+            errfnd = 1;
+        }
+    }
+    if (errfnd)
+        return 1;
+
+    fprintf(out, "/* Generated by qdsp %s for fs=%u, channels=%d\n", VERSION, dsphead->fs, dsphead->nchannels);
+    for (dsp = dsphead; dsp; dsp = dsp->next)
+        fprintf(out, " *   -p %s\n", dsp->name);
+    fprintf(out, " */\n");
+    fprintf(out, "#include <math.h>\n#include <string.h>\n\n");
+    fprintf(out, "#define NCHANNELS %d\n\n", dsphead->nchannels);
+    fprintf(out, "const int qdsp_chain_nchannels = NCHANNELS;\n");
+    fprintf(out, "const unsigned int qdsp_chain_fs = %u;\n\n", dsphead->fs);
+
+    errfnd |= emit_part(dsphead, out, CODEGEN_DECL);
+
+    fprintf(out, "\nvoid qdsp_chain_process(const float * const * inbufs, float * const * outbufs, int nframes)\n{\n");
+    fprintf(out, "    for (int c = 0; c < NCHANNELS; c++) {\n");
+    fprintf(out, "        const float * restrict inbuf = inbufs[c];\n");
+    fprintf(out, "        float * restrict outbuf = outbufs[c];\n");
+    errfnd |= emit_part(dsphead, out, CODEGEN_PRE);
+    fprintf(out, "        for (int n = 0; n < nframes; n++) {\n");
+    fprintf(out, "            float x = inbuf[n];\n");
+    errfnd |= emit_part(dsphead, out, CODEGEN_SAMPLE);
+    fprintf(out, "            outbuf[n] = x;\n");
+    fprintf(out, "        }\n");
+    errfnd |= emit_part(dsphead, out, CODEGEN_POST);
+    fprintf(out, "    }\n}\n\n");
+
+    fprintf(out, "void qdsp_chain_reset(void)\n{\n");
+    errfnd |= emit_part(dsphead, out, CODEGEN_RESET);
+    fprintf(out, "}\n");
+
+    return errfnd || ferror(out);
+}
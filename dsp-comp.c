@@ -0,0 +1,454 @@
+#define _XOPEN_SOURCE 500
+#include <getopt.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include "dsp.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+/*
+ * Feed-forward compressor and expander. The level of each sample and the
+ * static curve are computed in log2 units, where the curve is a few
+ * multiply-adds: a ratio above 1 reduces the overshoot above the threshold
+ * to 1/ratio, a ratio below 1 expands the undershoot below it by 1/ratio,
+ * both with a quadratic knee. The gain reduction is smoothed per sample,
+ * with the attack coefficient while it grows and the release coefficient
+ * while it shrinks, and turned back into a linear gain. log2 and exp2 are
+ * polynomials on the mantissa with the exponent taken from the float bits,
+ * good to 3e-5 and 5e-7, 8 samples at a time. Only the smoothing is a per
+ * sample recursion. Linked channels all get the gain of the loudest one.
+ */
+#define LOG2_DB (20.0 * M_LN2 / M_LN10)    /* dB per log2 unit */
+#define LEVEL_FLOOR 1e-10f                  /* the level of silence, -200 dBFS */
+#define ENV_SNAP 1e-6f                      /* the smoothed gain settles on its target this close */
+#define THRESHOLD_DEFAULT -20.0
+#define RATIO_DEFAULT 4.0
+#define KNEE_DEFAULT 6.0
+#define ATTACK_SECONDS_DEFAULT 0.005
+#define RELEASE_SECONDS_DEFAULT 0.1
+
+/* log2(m) for m in [1, 2) and (2^f - 1) / f for f in [0, 1), Chebyshev fits */
+#define LOG2_C0 -2.78680556f
+#define LOG2_C1 5.04685294f
+#define LOG2_C2 -3.49246604f
+#define LOG2_C3 1.59388455f
+#define LOG2_C4 -0.404862309f
+#define LOG2_C5 0.0434283633f
+#define EXP2_C0 0.693147985f
+#define EXP2_C1 0.240202632f
+#define EXP2_C2 0.0556685923f
+#define EXP2_C3 0.00919098404f
+#define EXP2_C4 0.00178895769f
+
+struct qdsp_comp_state_t {
+    double threshold;           /* dBFS */
+    double ratio;
+    double knee;                /* dB */
+    double attack;              /* seconds */
+    double release;
+    double makeup;              /* dB */
+    bool link;
+    /* the curve in log2 units */
+    float threshold2;
+    float halfknee;
+    float inv2knee;             /* 0 for a hard knee */
+    float slope;                /* gain per log2 unit over the threshold, negative */
+    float sign;                 /* 1 for a compressor, -1 for an expander */
+    float makeup2;
+    float attackcoeff;
+    float releasecoeff;
+    float env[NCHANNELS_MAX];   /* smoothed gain reduction, env[0] for linked channels */
+    float * gains;              /* one period per channel */
+};
+
+static inline float fast_log2(float x)
+{
+    union { float f; uint32_t i; } u = { x };
+    const float e = (float)((int)(u.i >> 23) - 127);
+    float m;
+
+    u.i = (u.i & 0x007fffff) | 0x3f800000;
+    m = u.f;
+    return e + (LOG2_C0 + m * (LOG2_C1 + m * (LOG2_C2 + m * (LOG2_C3 + m * (LOG2_C4 + m * LOG2_C5)))));
+}
+
+static inline float fast_exp2(float y)
+{
+    union { float f; uint32_t i; } u;
+    float i, f;
+
+    y = fminf(fmaxf(y, -126.0f), 127.0f);
+    i = floorf(y);
+    f = y - i;
+    u.i = (uint32_t)((int)i + 127) << 23;
+    return u.f * (1.0f + f * (EXP2_C0 + f * (EXP2_C1 + f * (EXP2_C2 + f * (EXP2_C3 + f * EXP2_C4)))));
+}
+
+/* Gain change in log2 units for a level in log2 units */
+static inline float comp_curve(const struct qdsp_comp_state_t * state, float level)
+{
+    const float over = state->sign * (level - state->threshold2);
+    const float k = fminf(fmaxf(over + state->halfknee, 0.0f), 2.0f * state->halfknee);
+    return state->slope * (k * k * state->inv2knee + fmaxf(over - state->halfknee, 0.0f));
+}
+
+#if defined(__AVX2__)
+static inline __m256 madd_ps(__m256 a, __m256 b, float c)
+{
+#if defined(__FMA__)
+    return _mm256_fmadd_ps(a, b, _mm256_set1_ps(c));
+#else
+    return _mm256_add_ps(_mm256_mul_ps(a, b), _mm256_set1_ps(c));
+#endif
+}
+
+static inline __m256 log2_ps(__m256 x)
+{
+    const __m256i i = _mm256_castps_si256(x);
+    const __m256 e = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(i, 23), _mm256_set1_epi32(127)));
+    const __m256 m = _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(i, _mm256_set1_epi32(0x007fffff)),
+                                                         _mm256_set1_epi32(0x3f800000)));
+    __m256 p = madd_ps(m, _mm256_set1_ps(LOG2_C5), LOG2_C4);
+    p = madd_ps(p, m, LOG2_C3);
+    p = madd_ps(p, m, LOG2_C2);
+    p = madd_ps(p, m, LOG2_C1);
+    p = madd_ps(p, m, LOG2_C0);
+    return _mm256_add_ps(e, p);
+}
+
+static inline __m256 exp2_ps(__m256 y)
+{
+    y = _mm256_min_ps(_mm256_max_ps(y, _mm256_set1_ps(-126.0f)), _mm256_set1_ps(127.0f));
+    const __m256 i = _mm256_floor_ps(y);
+    const __m256 f = _mm256_sub_ps(y, i);
+    const __m256 scale = _mm256_castsi256_ps(_mm256_slli_epi32(
+        _mm256_add_epi32(_mm256_cvtps_epi32(i), _mm256_set1_epi32(127)), 23));
+    __m256 p = madd_ps(f, _mm256_set1_ps(EXP2_C4), EXP2_C3);
+    p = madd_ps(p, f, EXP2_C2);
+    p = madd_ps(p, f, EXP2_C1);
+    p = madd_ps(p, f, EXP2_C0);
+    p = madd_ps(p, f, 1.0f);
+    return _mm256_mul_ps(scale, p);
+}
+#endif
+
+/* gains[n] = curve(log2 |x[n]|), gains may be x */
+static void comp_target_block(const struct qdsp_comp_state_t * state, float * gains, const float * x, int nframes)
+{
+    int n = 0;
+#if defined(__AVX2__)
+    const __m256 absmask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+    const __m256 sign = _mm256_set1_ps(state->sign);
+    const __m256 threshold = _mm256_set1_ps(state->threshold2);
+    const __m256 halfknee = _mm256_set1_ps(state->halfknee);
+    const __m256 knee = _mm256_set1_ps(2.0f * state->halfknee);
+    const __m256 inv2knee = _mm256_set1_ps(state->inv2knee);
+    const __m256 slope = _mm256_set1_ps(state->slope);
+    const __m256 zero = _mm256_setzero_ps();
+    for (; n + 8 <= nframes; n += 8) {
+        const __m256 level = log2_ps(_mm256_max_ps(_mm256_and_ps(_mm256_loadu_ps(x + n), absmask),
+                                                   _mm256_set1_ps(LEVEL_FLOOR)));
+        const __m256 over = _mm256_mul_ps(sign, _mm256_sub_ps(level, threshold));
+        const __m256 k = _mm256_min_ps(_mm256_max_ps(_mm256_add_ps(over, halfknee), zero), knee);
+        const __m256 g = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(k, k), inv2knee),
+                                       _mm256_max_ps(_mm256_sub_ps(over, halfknee), zero));
+        _mm256_storeu_ps(gains + n, _mm256_mul_ps(slope, g));
+    }
+#endif
+    for (; n < nframes; n++)
+        gains[n] = comp_curve(state, fast_log2(fmaxf(fabsf(x[n]), LEVEL_FLOOR)));
+}
+
+/*
+ * Smooths the gain reduction of nch channels, nframes apart in gains, in
+ * place and adds the makeup gain. The recursions of the channels are
+ * interleaved, so their latencies overlap.
+ */
+static void comp_smooth(const struct qdsp_comp_state_t * state, float * gains, int nframes,
+                        float * const * env, int nch)
+{
+    const float attack = state->attackcoeff;
+    const float release = state->releasecoeff;
+    float y[NCHANNELS_MAX];
+    int k;
+
+    for (k = 0; k < nch; k++)
+        y[k] = *env[k];
+    for (int n = 0; n < nframes; n++) {
+        for (k = 0; k < nch; k++) {
+            const float target = gains[k * nframes + n];
+            y[k] = target + (y[k] - target) * (target < y[k] ? attack : release);
+            if (fabsf(y[k] - target) < ENV_SNAP)
+                y[k] = target;
+            gains[k * nframes + n] = y[k] + state->makeup2;
+        }
+    }
+    for (k = 0; k < nch; k++)
+        *env[k] = y[k];
+}
+
+/* The smoothing over a period of silent input */
+static void comp_idle(const struct qdsp_comp_state_t * state, int nframes, float * env)
+{
+    const float target = comp_curve(state, fast_log2(LEVEL_FLOOR));
+    const float coeff = target < *env ? state->attackcoeff : state->releasecoeff;
+    float y = target + (*env - target) * powf(coeff, nframes);
+
+    if (fabsf(y - target) < ENV_SNAP)
+        y = target;
+    *env = y;
+}
+
+static void exp2_block(float * gains, int nframes)
+{
+    int n = 0;
+#if defined(__AVX2__)
+    for (; n + 8 <= nframes; n += 8)
+        _mm256_storeu_ps(gains + n, exp2_ps(_mm256_loadu_ps(gains + n)));
+#endif
+    for (; n < nframes; n++)
+        gains[n] = fast_exp2(gains[n]);
+}
+
+static void mul_block(float * restrict out, const float * restrict in, const float * restrict gains, int nframes)
+{
+    int n = 0;
+#if defined(__AVX__)
+    for (; n + 8 <= nframes; n += 8)
+        _mm256_storeu_ps(out + n, _mm256_mul_ps(_mm256_loadu_ps(in + n), _mm256_loadu_ps(gains + n)));
+#endif
+    for (; n < nframes; n++)
+        out[n] = in[n] * gains[n];
+}
+
+/* peak[n] = max over channels of |in[c][n]| */
+static void peak_block(float * restrict peak, const float * const * in, int nchannels, int nframes)
+{
+    int n = 0, c;
+#if defined(__AVX__)
+    const __m256 absmask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+    for (; n + 8 <= nframes; n += 8) {
+        __m256 m = _mm256_and_ps(_mm256_loadu_ps(in[0] + n), absmask);
+        for (c = 1; c < nchannels; c++)
+            m = _mm256_max_ps(m, _mm256_and_ps(_mm256_loadu_ps(in[c] + n), absmask));
+        _mm256_storeu_ps(peak + n, m);
+    }
+#endif
+    for (; n < nframes; n++) {
+        float m = fabsf(in[0][n]);
+        for (c = 1; c < nchannels; c++)
+            m = fmaxf(m, fabsf(in[c][n]));
+        peak[n] = m;
+    }
+}
+
+static inline __attribute__((always_inline))
+void comp_process_kernel(struct qdsp_t * dsp, const int nchannels, const int nframes, const bool aligned)
+{
+    struct qdsp_comp_state_t * state = (struct qdsp_comp_state_t *)dsp->state;
+    const float * chgains[NCHANNELS_MAX];
+    float * env[NCHANNELS_MAX] = { NULL };
+    int i, nactive = 0;
+
+    /* gains of the channels with signal, or of all linked channels */
+    for (i=0; i<nchannels; i++) {
+        if (dsp->insilent[i]) {
+            if (!state->link)
+                comp_idle(state, nframes, &state->env[i]);
+            continue;
+        }
+        if (state->link) {
+            chgains[i] = state->gains;
+            continue;
+        }
+        chgains[i] = state->gains + nactive * nframes;
+        env[nactive++] = &state->env[i];
+        comp_target_block(state, state->gains + (nactive - 1) * nframes, dsp->inbufs[i], nframes);
+    }
+    if (state->link) {
+        for (i=0; i<nchannels && dsp->insilent[i]; i++)
+            ;
+        if (i == nchannels)
+            comp_idle(state, nframes, &state->env[0]);
+        else {
+            peak_block(state->gains, (const float * const *)dsp->inbufs, nchannels, nframes);
+            comp_target_block(state, state->gains, state->gains, nframes);
+            env[nactive++] = &state->env[0];
+        }
+    }
+    comp_smooth(state, state->gains, nframes, env, nactive);
+    exp2_block(state->gains, nactive * nframes);
+
+    for (i=0; i<nchannels; i++) {
+        const float * restrict inbuf = ASSUME_ALIGNED(dsp->inbufs[i], aligned);
+        float * restrict outbuf = ASSUME_ALIGNED(dsp->outbufs[i], aligned);
+
+        dsp->outsilent[i] = dsp->insilent[i];
+        if (dsp->insilent[i])
+            memset(outbuf, 0, nframes * sizeof(float));
+        else
+            mul_block(outbuf, inbuf, chgains[i], nframes);
+    }
+}
+
+void comp_process(struct qdsp_t * dsp)
+{
+    comp_process_kernel(dsp, dsp->nchannels, dsp->nframes, false);
+}
+
+SPECIALISED_KERNELS(DEFINE_KERNEL, comp_process)
+KERNEL_TABLE(comp_process);
+
+static float comp_coeff(double seconds, unsigned int fs)
+{
+    return seconds * fs >= 1.0 ? exp(-1.0 / (seconds * fs)) : 0.0f;
+}
+
+void comp_init(struct qdsp_t * dsp)
+{
+    struct qdsp_comp_state_t * state = (struct qdsp_comp_state_t *)dsp->state;
+
+    state->sign = state->ratio >= 1.0 ? 1.0f : -1.0f;
+    state->slope = state->sign * (1.0 / state->ratio - 1.0);
+    state->threshold2 = state->threshold / LOG2_DB;
+    state->halfknee = state->knee / LOG2_DB / 2;
+    state->inv2knee = state->halfknee > 0 ? 1.0 / (4.0 * state->halfknee) : 0.0f;
+    state->makeup2 = state->makeup / LOG2_DB;
+    state->attackcoeff = comp_coeff(state->attack, dsp->fs);
+    state->releasecoeff = comp_coeff(state->release, dsp->fs);
+    for (int i=0; i<NCHANNELS_MAX; i++)
+        state->env[i] = 0.0f;
+
+    state->gains = (float*)realloc(state->gains, dsp->nchannels * dsp->nframes * sizeof(float));
+    if (!state->gains) endprogram("Could not allocate memory for compressor gains.\n");
+}
+
+void destroy_comp(struct qdsp_t * dsp)
+{
+    struct qdsp_comp_state_t * state = (struct qdsp_comp_state_t *)dsp->state;
+    free(state->gains);
+    free(state);
+}
+
+/* Samples until the slower of attack and release has settled to within tolerance, at most 60 seconds */
+unsigned int comp_preroll(struct qdsp_t * dsp, double tolerance)
+{
+    struct qdsp_comp_state_t * state = (struct qdsp_comp_state_t *)dsp->state;
+    double coeff = fmax(comp_coeff(state->attack, dsp->fs), comp_coeff(state->release, dsp->fs));
+    double n = coeff > 0 ? ceil(log(tolerance) / log(coeff)) : 0;
+    return n < 60.0 * dsp->fs ? n : 60 * dsp->fs;
+}
+
+int clone_comp(struct qdsp_t * dsp, const struct qdsp_t * src)
+{
+    struct qdsp_comp_state_t * state = malloc(sizeof(struct qdsp_comp_state_t));
+    if (!state) return 1;
+    memcpy(state, src->state, sizeof(struct qdsp_comp_state_t));
+    state->gains = NULL;
+    dsp->state = (void*)state;
+    return 0;
+}
+
+int create_comp(struct qdsp_t * dsp, char ** subopts)
+{
+    enum {
+        THRESHOLD_OPT = 0,
+        RATIO_OPT,
+        KNEE_OPT,
+        ATTACK_OPT,
+        RELEASE_OPT,
+        MAKEUP_OPT,
+        LINK_OPT,
+    };
+    char *const token[] = {
+        [THRESHOLD_OPT] = "t",
+        [RATIO_OPT]     = "ra",
+        [KNEE_OPT]      = "k",
+        [ATTACK_OPT]    = "a",
+        [RELEASE_OPT]   = "r",
+        [MAKEUP_OPT]    = "g",
+        [LINK_OPT]      = "l",
+        NULL
+    };
+    char *value;
+    int errfnd = 0;
+    int curtoken;
+    struct qdsp_comp_state_t * state = calloc(1, sizeof(struct qdsp_comp_state_t));
+    dsp->state = (void*)state;
+    state->threshold = THRESHOLD_DEFAULT;
+    state->ratio = RATIO_DEFAULT;
+    state->knee = KNEE_DEFAULT;
+    state->attack = ATTACK_SECONDS_DEFAULT;
+    state->release = RELEASE_SECONDS_DEFAULT;
+
+    debugprint(1, "%s subopts: %s\n", __func__, *subopts);
+    while (**subopts != '\0' && !errfnd) {
+        curtoken = getsubopt(subopts, token, &value);
+        if (curtoken >= 0 && curtoken != LINK_OPT && value == NULL) {
+            debugprint(0, "%s: Missing value for suboption '%s'\n", __func__, token[curtoken]);
+            errfnd = 1;
+            continue;
+        }
+        switch (curtoken) {
+        case THRESHOLD_OPT:
+            state->threshold = atof(value);
+            break;
+        case RATIO_OPT:
+            state->ratio = atof(value);
+            break;
+        case KNEE_OPT:
+            state->knee = atof(value);
+            break;
+        case ATTACK_OPT:
+            state->attack = atof(value);
+            break;
+        case RELEASE_OPT:
+            state->release = atof(value);
+            break;
+        case MAKEUP_OPT:
+            state->makeup = atof(value);
+            break;
+        case LINK_OPT:
+            state->link = true;
+            break;
+        default:
+            debugprint(0, "%s: No match found for token: /%s/\n", __func__, value);
+            errfnd = 1;
+            break;
+        }
+    }
+    if (!errfnd && (state->ratio <= 0 || state->knee < 0 || state->attack < 0 || state->release < 0)) {
+        debugprint(0, "%s: The ratio must be positive, knee, attack and release not negative\n", __func__);
+        errfnd = 1;
+    }
+    debugprint(1, "%s: threshold=%g, ratio=%g, knee=%g, attack=%g, release=%g, makeup=%g, link=%d\n", __func__,
+               state->threshold, state->ratio, state->knee, state->attack, state->release, state->makeup, state->link);
+
+    dsp->process = comp_process;
+    dsp->kernels = comp_process_kernels;
+    dsp->init = comp_init;
+    dsp->clone = clone_comp;
+    dsp->preroll = comp_preroll;
+    dsp->destroy = destroy_comp;
+
+    return errfnd;
+}
+
+void help_comp(void)
+{
+    debugprint(0, "  Compressor options\n");
+    debugprint(0, "    Name: comp\n");
+    debugprint(0, "        t = threshold (dBFS, default %g)\n", THRESHOLD_DEFAULT);
+    debugprint(0, "        ra = ratio, above 1 compresses above the threshold, below 1 expands below it (default %g)\n", RATIO_DEFAULT);
+    debugprint(0, "        k = knee width (dB, default %g)\n", KNEE_DEFAULT);
+    debugprint(0, "        a = attack time (seconds, default %g)\n", ATTACK_SECONDS_DEFAULT);
+    debugprint(0, "        r = release time (seconds, default %g)\n", RELEASE_SECONDS_DEFAULT);
+    debugprint(0, "        g = makeup gain (dB)\n");
+    debugprint(0, "        l = link all channels, they get the gain of the loudest one\n");
+    debugprint(0, "    Example: -p comp,t=-24,ra=3,k=6,a=0.002,r=0.15,g=6,l\n");
+}
@@ -4,7 +4,10 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <time.h>
 #include "dsp.h"
+#include "trace.h"
+#include "cache.h"
 
 #if defined(_OPENMP)
 #include <omp.h>
@@ -115,26 +118,62 @@ static inline void dotp_2(float * sumy, float * sumz, float * y, float * z, floa
     *sumz = sumb;
 }
 
+/* The coefficient array is padded to a multiple of this many taps for the dot products */
+#if (defined(__AVX__))
+#define FIR_PAD_TAPS 16
+#else
+#define FIR_PAD_TAPS 8
+#endif
+
 struct qdsp_fir_state_t {
     char * coeff_filename;
     float * delayline;
-    float * coeffs;
+    float * coeffs;             /* owned by the chain the stage was cloned from if coeffs_shared */
+    bool coeffs_shared;
+    struct cache_entry_t cached;    /* coeffs are mapped from the cache if cached.map */
     unsigned hlen;
     unsigned offset;
+    unsigned silentframes[NCHANNELS_MAX];   /* zeros in the delay line since the last signal, up to hlen */
 };
 
-void fir_process(struct qdsp_t * dsp)
+/*
+ * A channel with silent input still rings out the tail of the signal
+ * before it. Once hlen zeros have gone into its delay line the output is
+ * silent too, so the channel is skipped and its all zero delay line left
+ * as it is. Returns true if channel c is skipped this period.
+ */
+static inline bool fir_quiet(struct qdsp_t * dsp, struct qdsp_fir_state_t * state, size_t c, int nframes)
+{
+    dsp->outsilent[c] = dsp->insilent[c] && state->silentframes[c] >= state->hlen;
+    if (!dsp->insilent[c])
+        state->silentframes[c] = 0;
+    else if (state->silentframes[c] < state->hlen)
+        state->silentframes[c] += nframes;
+    return dsp->outsilent[c];
+}
+
+static inline __attribute__((always_inline))
+void fir_process_kernel(struct qdsp_t * dsp, const int nchannels, const int nframes, const bool aligned)
 {
     struct qdsp_fir_state_t * state = (struct qdsp_fir_state_t *)dsp->state;
     size_t offset = state->offset;
 
-    if (dsp->nchannels == 2) {
+    if (nchannels == 2) {
+        /* a single quiet channel runs with the other, its output is exactly zero */
+        if (fir_quiet(dsp, state, 0, nframes) & fir_quiet(dsp, state, 1, nframes)) {
+            memset(dsp->outbufs[0], 0, nframes * sizeof(float));
+            memset(dsp->outbufs[1], 0, nframes * sizeof(float));
+            state->offset = (offset + nframes) % state->hlen;
+            return;
+        }
+        const float * restrict inbuf0 = ASSUME_ALIGNED(dsp->inbufs[0], aligned);
+        const float * restrict inbuf1 = ASSUME_ALIGNED(dsp->inbufs[1], aligned);
         float * delayline0 = &state->delayline[0];
         float * delayline1 = &state->delayline[state->hlen];
-        for (int s = 0; s < dsp->nframes; s++) {
+        for (int s = 0; s < nframes; s++) {
             float * coeffs = &state->coeffs[state->hlen - 1 - offset];
-            delayline0[offset] = dsp->inbufs[0][s];
-            delayline1[offset] = dsp->inbufs[1][s];
+            delayline0[offset] = inbuf0[s];
+            delayline1[offset] = inbuf1[s];
             dotp_2(&dsp->outbufs[0][s], &dsp->outbufs[1][s], delayline0, delayline1, coeffs, coeffs, state->hlen);
             if (++offset == state->hlen)
                 offset = 0;
@@ -146,22 +185,47 @@ void fir_process(struct qdsp_t * dsp)
 #if defined(_OPENMP)
     #pragma omp parallel for firstprivate(offset) lastprivate(offset)
 #endif
-    for (size_t c = 0; c < (size_t)dsp->nchannels; c++) {
+    for (size_t c = 0; c < (size_t)nchannels; c++) {
+        const float * restrict inbuf = ASSUME_ALIGNED(dsp->inbufs[c], aligned);
+        float * restrict outbuf = ASSUME_ALIGNED(dsp->outbufs[c], aligned);
+#if defined(_OPENMP)
+        trace_thread_name("fir worker");
+#endif
         offset = state->offset;
+        if (fir_quiet(dsp, state, c, nframes)) {
+            memset(outbuf, 0, nframes * sizeof(float));
+            offset = (offset + nframes) % state->hlen;
+            continue;
+        }
+#if defined(_OPENMP)
+        /* after the skip, which must not leave an event open */
+        trace_begin("fir channel");
+#endif
         float * delayline = &state->delayline[state->hlen * c];
-        for (int s = 0; s < dsp->nframes; s++) {
+        for (int s = 0; s < nframes; s++) {
             float * coeffs = &state->coeffs[state->hlen - 1 - offset];
             float suma, sumb = 0;
-            delayline[offset] = dsp->inbufs[c][s];
+            delayline[offset] = inbuf[s];
             dotp_2(&suma, &sumb, delayline, delayline+state->hlen/2, coeffs, coeffs+state->hlen/2, state->hlen/2);
-            dsp->outbufs[c][s] = suma + sumb;
+            outbuf[s] = suma + sumb;
             if (++offset == state->hlen)
                 offset = 0;
         }
+#if defined(_OPENMP)
+        trace_end("fir channel");
+#endif
     }
     state->offset = offset;
 }
 
+void fir_process(struct qdsp_t * dsp)
+{
+    fir_process_kernel(dsp, dsp->nchannels, dsp->nframes, false);
+}
+
+SPECIALISED_KERNELS(DEFINE_KERNEL, fir_process)
+KERNEL_TABLE(fir_process);
+
 void fir_init(struct qdsp_t * dsp)
 {
     struct qdsp_fir_state_t * state = (struct qdsp_fir_state_t *)dsp->state;
@@ -169,6 +233,7 @@ void fir_init(struct qdsp_t * dsp)
     state->delayline = valloc(dsp->nchannels * state->hlen * sizeof(float));
     memset(state->delayline, 0, dsp->nchannels * state->hlen * sizeof(float));
     state->offset = 0;
+    memset(state->silentframes, 0, sizeof(state->silentframes));
 
 #if defined(_OPENMP)
     if (dsp->nchannels > 1 && state->hlen * dsp->nframes > 10000) {
@@ -180,14 +245,123 @@ void fir_init(struct qdsp_t * dsp)
 #endif
 }
 
+int fir_codegen(struct qdsp_t * dsp, FILE * out, enum codegen_part part, int stage)
+{
+    struct qdsp_fir_state_t * state = (struct qdsp_fir_state_t *)dsp->state;
+    /* coeffs holds the padded response reversed, drop the zero padding */
+    const float * h = &state->coeffs[state->hlen];
+    unsigned len = state->hlen;
+    while (len > 1 && h[state->hlen - len] == 0.0f)
+        len--;
+
+    switch (part) {
+    case CODEGEN_DECL:
+        fprintf(out, "static const float s%d_h[%u] = {\n", stage, len);
+        for (unsigned i = 0; i < len; i++)
+            fprintf(out, "    %af,\n", h[state->hlen - 1 - i]);
+        fprintf(out, "};\n");
+        fprintf(out, "static float s%d_z[NCHANNELS][%u];\n", stage, 2 * len);
+        fprintf(out, "static int s%d_pos;\n", stage);
+        break;
+    case CODEGEN_PRE:
+        fprintf(out, "        int s%d_p = s%d_pos;\n", stage, stage);
+        break;
+    case CODEGEN_SAMPLE:
+        fprintf(out, "            {\n");
+        fprintf(out, "                float * restrict z = &s%d_z[c][s%d_p];\n", stage, stage);
+        fprintf(out, "                float acc = 0.0f;\n");
+        fprintf(out, "                z[0] = z[%u] = x;\n", len);
+        fprintf(out, "                for (int i = 0; i < %u; i++)\n", len);
+        fprintf(out, "                    acc += s%d_h[i] * z[i];\n", stage);
+        fprintf(out, "                x = acc;\n");
+        fprintf(out, "                s%d_p = s%d_p ? s%d_p - 1 : %u;\n", stage, stage, stage, len - 1);
+        fprintf(out, "            }\n");
+        break;
+    case CODEGEN_POST:
+        fprintf(out, "        if (c == NCHANNELS - 1) s%d_pos = s%d_p;\n", stage, stage);
+        break;
+    case CODEGEN_RESET:
+        fprintf(out, "    memset(s%d_z, 0, sizeof(s%d_z));\n", stage, stage);
+        fprintf(out, "    s%d_pos = 0;\n", stage);
+        break;
+    }
+    return 0;
+}
+
 void destroy_fir(struct qdsp_t * dsp)
 {
     struct qdsp_fir_state_t * state = (struct qdsp_fir_state_t *)dsp->state;
-    free(state->coeffs);
+    if (!state->coeffs_shared) {
+        if (state->cached.map)
+            cache_release(&state->cached);
+        else
+            free(state->coeffs);
+    }
     free(state->delayline);
     free(state);
 }
 
+unsigned int fir_preroll(struct qdsp_t * dsp, double tolerance)
+{
+    struct qdsp_fir_state_t * state = (struct qdsp_fir_state_t *)dsp->state;
+    (void)tolerance;
+    return state->hlen - 1;
+}
+
+int clone_fir(struct qdsp_t * dsp, const struct qdsp_t * src)
+{
+    struct qdsp_fir_state_t * state = malloc(sizeof(struct qdsp_fir_state_t));
+    if (!state) return 1;
+    memcpy(state, src->state, sizeof(struct qdsp_fir_state_t));
+    state->delayline = NULL;
+    state->coeffs_shared = true;
+    dsp->state = (void*)state;
+    return 0;
+}
+
+/*
+ * Reads one coefficient per line and returns them reversed, zero padded
+ * to a multiple of FIR_PAD_TAPS and duplicated, so the dot product for
+ * any delay line offset is one contiguous run. hlen is set to the padded
+ * length. NULL if the file can not be read.
+ */
+static float * fir_prepare_coeffs(const char * filename, unsigned * hlen)
+{
+    FILE * fid = fopen(filename, "r");
+    if (!fid) {
+        debugprint(0, "%s: Unable to open file: %s\n", __func__, filename);
+        return NULL;
+    }
+
+    size_t i = 0, size = 256;
+    float * tempcoeffs = malloc(size * sizeof(float)); //initial size of coeffs
+    while (!feof(fid)) {
+        if (fscanf(fid, "%f\n", &tempcoeffs[i]) != 1) {
+            debugprint(0, "%s: Read error in file: %s\n", __func__, filename);
+            fclose(fid);
+            free(tempcoeffs);
+            return NULL;
+        }
+        if (++i == size) {
+            size = i * 2;
+            tempcoeffs = realloc(tempcoeffs, size * sizeof(float)); //realloc if size grows
+        }
+    }
+    fclose(fid);
+    size = i;
+    size_t exphlen = (i & ~(FIR_PAD_TAPS - 1)) + FIR_PAD_TAPS;
+    debugprint(2, "%s: hlen=%zu\n", __func__, size);
+    debugprint(2, "%s: coeff[1]=%e\n", __func__, tempcoeffs[1]);
+    float * coeffs = valloc(exphlen * 2 * sizeof(float)); //realloc to final size * 2
+    memset(coeffs, 0, exphlen * 2 * sizeof(float));
+    for (i = 0; i < size; i++)
+        coeffs[exphlen * 2 - i - 1] = tempcoeffs[i]; //reverse coeffs for second half
+    memcpy(coeffs, &coeffs[exphlen], exphlen * sizeof(float)); //duplicate reversed coeffs
+    free(tempcoeffs);
+    *hlen = exphlen;
+    return coeffs;
+}
+
 int create_fir(struct qdsp_t * dsp, char ** subopts)
 {
     enum {
@@ -199,6 +373,9 @@ int create_fir(struct qdsp_t * dsp, char ** subopts)
     };
     char *value;
     int errfnd = 0;
+    struct timespec start, end;
+    uint64_t key = 0;
+    bool cacheable = false;
     struct qdsp_fir_state_t * state = malloc(sizeof(struct qdsp_fir_state_t));
     dsp->state = (void*)state;
 
@@ -206,6 +383,8 @@ int create_fir(struct qdsp_t * dsp, char ** subopts)
     state->coeff_filename = NULL;
     state->delayline = NULL;
     state->coeffs = NULL;
+    state->coeffs_shared = false;
+    state->cached.map = NULL;
     state->hlen = 0;
 
     debugprint(1, "%s subopts: %s\n", __func__, *subopts);
@@ -227,49 +406,37 @@ int create_fir(struct qdsp_t * dsp, char ** subopts)
         }
     }
     dsp->process = fir_process;
+    dsp->kernels = fir_process_kernels;
     dsp->init = fir_init;
+    dsp->clone = clone_fir;
+    dsp->preroll = fir_preroll;
     dsp->destroy = destroy_fir;
+    dsp->codegen = fir_codegen;
 
     if (errfnd || !state->coeff_filename)
         return 1;
 
-    FILE * fid = fopen(state->coeff_filename, "r");
-    if (!fid) {
-        debugprint(0, "%s: Unable to open file: %s\n", __func__, state->coeff_filename);
-        return 1;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    if (cache_enabled()) {
+        /* the prepared array depends on the file contents and the padding */
+        const unsigned pad = FIR_PAD_TAPS;
+        key = cache_hash_file(CACHE_HASH_INIT, state->coeff_filename, &cacheable);
+        key = cache_hash(key, &pad, sizeof(pad));
     }
-
-    size_t i = 0;
-    state->hlen = 256;
-    float * tempcoeffs = malloc(state->hlen * sizeof(float)); //initial size of coeffs
-    while (!feof(fid)) {
-        if (fscanf(fid, "%f\n", &tempcoeffs[i]) != 1) {
-            debugprint(0, "%s: Read error in file: %s\n", __func__, state->coeff_filename);
-            fclose(fid);
-            errfnd = 1;
-            break;
-        }
-        if (++i == state->hlen) {
-            state->hlen = i * 2;
-            tempcoeffs = realloc(tempcoeffs, state->hlen * sizeof(float)); //realloc if size grows
-        }
+    if (cacheable && cache_load(&state->cached, "fir", key)) {
+        state->coeffs = (float *)state->cached.data;
+        state->hlen = state->cached.len / (2 * sizeof(float));
     }
-    fclose(fid);
-    state->hlen = i;
-#if (defined(__AVX__))
-    size_t exphlen = (i & ~15) + 16;
-#else
-    size_t exphlen = (i & ~7) + 8;
-#endif
-    debugprint(2, "%s: state->hlen=%d\n", __func__, state->hlen);
-    debugprint(2, "%s: state->coeff[1]=%e\n", __func__, tempcoeffs[1]);
-    state->coeffs = valloc(exphlen * 2 * sizeof(float)); //realloc to final size * 2
-    memset(state->coeffs, 0, exphlen * 2 * sizeof(float));
-    for (i = 0; i < state->hlen; i++)
-        state->coeffs[exphlen * 2 - i - 1] = tempcoeffs[i]; //reverse coeffs for second half
-    memcpy(state->coeffs, &state->coeffs[exphlen], exphlen * sizeof(float)); //duplicate reversed coeffs
-    free(tempcoeffs);
-    state->hlen = exphlen;
+    else {
+        if (!(state->coeffs = fir_prepare_coeffs(state->coeff_filename, &state->hlen)))
+            return 1;
+        if (cacheable)
+            cache_store("fir", key, state->coeffs, state->hlen * 2 * sizeof(float));
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    if (cache_enabled())
+        debugprint(0, "fir: %s start, %u taps ready in %.3f ms\n", state->cached.map ? "warm" : "cold", state->hlen,
+                   (end.tv_sec - start.tv_sec) * 1e3 + (end.tv_nsec - start.tv_nsec) * 1e-6);
 
 #if (defined(__AVX__))
     debugprint(0, "fir: Use AVX\n");
@@ -289,4 +456,5 @@ void help_fir(void)
     debugprint(0, "        h = coefficient filename\n");
     debugprint(0, "    Example: -p fir,h=coeffs.txt\n");
     debugprint(0, "    Note: Coefficient file should contain one coefficient per line\n");
+    debugprint(0, "    Note: Prepared coefficients are cached in $QDSP_CACHE_DIR, if set\n");
 }
@@ -4,73 +4,664 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <stdint.h>
+#include <limits.h>
 #include "dsp.h"
 
 
+#if defined(__AVX__)
+#include <immintrin.h>
+#endif
+
+/*
+ * The delay line is a ring per channel, long enough to hold the delay,
+ * the interpolator taps and one period. Each period the input is copied
+ * in and the delayed signal read out with at most two contiguous copies
+ * each, so the per sample work is branch free and runs vectorised.
+ * A delay that is not a whole number of samples is interpolated with a
+ * third order Lagrange interpolator over taps delay_samples to
+ * delay_samples + 3.
+ *
+ * The gain can be changed while running with control_dsp. The new value is
+ * only stored, the processing thread picks it up at the start of a period
+ * and ramps to it over ramp_seconds, linearly or with a constant factor
+ * per sample. Only periods inside a ramp pay for a per sample gain, the
+ * others keep the plain scalar multiply.
+ *
+ * With a lookahead the hard clip is replaced by a true peak limiter. The
+ * peak of each sample interval is estimated at 4x oversampling, the
+ * largest over channels taken, and the gain that keeps it under the
+ * ceiling is held over the lookahead with a sliding minimum on a
+ * monotonic deque. After the release the gain is smoothed by a moving
+ * average over the lookahead, which reaches the needed gain just as the
+ * peak leaves the delay line, so it never overshoots. All channels get
+ * the same gain and the clip stays as a backstop at the ceiling.
+ *
+ * A channel flagged silent is skipped once its delay line holds only
+ * zeros, the ring is not written then as it would only get more zeros.
+ */
+#define LAGRANGE_TAPS 4
+#define RAMP_SECONDS_DEFAULT 0.02
+#define TP_TAPS 16                  /* per phase of the true peak interpolator */
+#define TP_LATENCY (TP_TAPS / 2)    /* the interval of a peak starts this many samples back */
+#define RELEASE_SECONDS_DEFAULT 0.05
+
+struct limiter_t {
+    double lookahead_seconds;
+    double release_seconds;
+    int lookahead;              /* samples */
+    float release;              /* per sample coefficient of the gain recovery */
+    float h[3][TP_TAPS];        /* interpolators for 1/4, 2/4 and 3/4 into the interval */
+    float * tpwindow;           /* per channel, TP_TAPS - 1 samples of history and one period */
+    float * peaks;              /* per sample, largest over channels */
+    float * gains;              /* per sample, applied to all channels */
+    float * ring;               /* delay of lookahead + TP_LATENCY, ringlen per channel */
+    int ringlen;
+    int offset;
+    /* sliding minimum of the needed gain over window samples */
+    float * minval;
+    unsigned int * mintime;
+    int window;
+    int minhead;
+    int mincount;
+    unsigned int time;
+    float env;                  /* gain after release */
+    float * box;                /* last lookahead values of env */
+    int boxpos;
+    double boxsum;
+};
+
 struct qdsp_gain_state_t {
     float gain;
-    float delay_seconds;
-    int delay_samples;
-    float * delayline;
-    int offset;
+    double delay_seconds;
+    int delay_samples;          /* whole samples, the delay of the first tap */
+    int taps;                   /* 1 for a whole sample delay, else LAGRANGE_TAPS */
+    float h[LAGRANGE_TAPS];     /* interpolator coefficients, h[k] for tap delay_samples + k */
+    float * delayline;          /* nchannels rings of ringlen */
+    float * window;             /* contiguous copy of the taps needed for one period */
+    int ringlen;
+    int offset;                 /* where the next period is written */
     float clip_threshold;
+    uint32_t target;            /* float bits of the gain set by control, shared between threads */
+    double ramp_seconds;
+    bool ramp_exp;              /* constant factor per sample instead of constant step */
+    int ramp_len;               /* ramp_seconds in samples */
+    int ramp_left;              /* samples left in the running ramp, 0 if none */
+    float ramp_to;              /* the target of the running ramp */
+    bool ramp_mul;              /* the running ramp uses a factor, which needs the same sign at both ends */
+    double ramp_step;           /* per sample step or factor */
+    float * gains;              /* per sample gain of the period while ramping */
+    struct limiter_t * limiter; /* NULL to clip */
+    int silentframes[NCHANNELS_MAX];    /* zeros written to the delay line since the last signal, up to ringlen */
 };
 
+static inline void gain_set_target(struct qdsp_gain_state_t * state, float gain)
+{
+    uint32_t bits;
+    memcpy(&bits, &gain, sizeof(bits));
+    __atomic_store_n(&state->target, bits, __ATOMIC_RELAXED);
+}
+
+static inline float gain_get_target(struct qdsp_gain_state_t * state)
+{
+    uint32_t bits = __atomic_load_n(&state->target, __ATOMIC_RELAXED);
+    float gain;
+    memcpy(&gain, &bits, sizeof(gain));
+    return gain;
+}
+
 static inline float gain_and_clip_sample(float sample, float gain, float clip_threshold)
 {
     return fmaxf(fminf(gain * sample, clip_threshold), -clip_threshold);
 }
 
-void gain_process(struct qdsp_t * dsp)
+static void gain_and_clip_block(float * restrict out, const float * restrict in, int nframes,
+                                float gain, float clip_threshold)
 {
-    struct qdsp_gain_state_t * state = (struct qdsp_gain_state_t *)dsp->state;
-    int i, k=0, n=0;
-
-    if (state->delay_samples > dsp->nframes) {
-        for (i=0; i<dsp->nchannels; i++) {
-            float * restrict delayline = &state->delayline[state->delay_samples * i];
-            k = state->offset;
-            for (n=0; n<dsp->nframes; n++) {
-                dsp->outbufs[i][n] = gain_and_clip_sample(delayline[k], state->gain, state->clip_threshold);
-                delayline[k] = dsp->inbufs[i][n];
-                if (++k == state->delay_samples) k=0;
+    int n = 0;
+#if defined(__AVX__)
+    const __m256 g = _mm256_set1_ps(gain);
+    const __m256 hi = _mm256_set1_ps(clip_threshold);
+    const __m256 lo = _mm256_set1_ps(-clip_threshold);
+    for (; n + 8 <= nframes; n += 8)
+        _mm256_storeu_ps(out + n, _mm256_max_ps(_mm256_min_ps(_mm256_mul_ps(g, _mm256_loadu_ps(in + n)), hi), lo));
+#endif
+    for (; n < nframes; n++)
+        out[n] = gain_and_clip_sample(in[n], gain, clip_threshold);
+}
+
+/* As gain_and_clip_block with a gain per sample, out may be in */
+static void ramp_and_clip_block(float * out, const float * in, int nframes,
+                                const float * restrict gains, float clip_threshold)
+{
+    int n = 0;
+#if defined(__AVX__)
+    const __m256 hi = _mm256_set1_ps(clip_threshold);
+    const __m256 lo = _mm256_set1_ps(-clip_threshold);
+    for (; n + 8 <= nframes; n += 8) {
+        __m256 y = _mm256_mul_ps(_mm256_loadu_ps(gains + n), _mm256_loadu_ps(in + n));
+        _mm256_storeu_ps(out + n, _mm256_max_ps(_mm256_min_ps(y, hi), lo));
+    }
+#endif
+    for (; n < nframes; n++)
+        out[n] = gain_and_clip_sample(in[n], gains[n], clip_threshold);
+}
+
+/* out[n] is the interpolation over w[n + 3] ... w[n], the oldest tap last */
+static void lagrange_gain_and_clip_block(float * restrict out, const float * restrict w, int nframes,
+                                         const float * h, float gain, float clip_threshold)
+{
+    int n = 0;
+#if defined(__AVX__)
+    const __m256 g = _mm256_set1_ps(gain);
+    const __m256 hi = _mm256_set1_ps(clip_threshold);
+    const __m256 lo = _mm256_set1_ps(-clip_threshold);
+    const __m256 h0 = _mm256_set1_ps(h[0]), h1 = _mm256_set1_ps(h[1]);
+    const __m256 h2 = _mm256_set1_ps(h[2]), h3 = _mm256_set1_ps(h[3]);
+    for (; n + 8 <= nframes; n += 8) {
+        __m256 y = _mm256_mul_ps(h0, _mm256_loadu_ps(w + n + 3));
+        y = _mm256_add_ps(y, _mm256_mul_ps(h1, _mm256_loadu_ps(w + n + 2)));
+        y = _mm256_add_ps(y, _mm256_mul_ps(h2, _mm256_loadu_ps(w + n + 1)));
+        y = _mm256_add_ps(y, _mm256_mul_ps(h3, _mm256_loadu_ps(w + n)));
+        _mm256_storeu_ps(out + n, _mm256_max_ps(_mm256_min_ps(_mm256_mul_ps(g, y), hi), lo));
+    }
+#endif
+    for (; n < nframes; n++) {
+        float y = h[0] * w[n + 3];
+        y += h[1] * w[n + 2];
+        y += h[2] * w[n + 1];
+        y += h[3] * w[n];
+        out[n] = gain_and_clip_sample(y, gain, clip_threshold);
+    }
+}
+
+/* Copies len samples between a linear buffer and the ring from pos, wrapping once at most */
+static inline void ring_write(float * restrict ring, int ringlen, int pos, const float * restrict src, int len)
+{
+    int first = len < ringlen - pos ? len : ringlen - pos;
+    memcpy(ring + pos, src, first * sizeof(float));
+    memcpy(ring, src + first, (len - first) * sizeof(float));
+}
+
+static inline void ring_read(float * restrict dst, const float * restrict ring, int ringlen, int pos, int len)
+{
+    int first = len < ringlen - pos ? len : ringlen - pos;
+    memcpy(dst, ring + pos, first * sizeof(float));
+    memcpy(dst + first, ring, (len - first) * sizeof(float));
+}
+
+/*
+ * Into peaks, the largest magnitude over the sample w[n + 3] and the
+ * interpolated values 1/4, 2/4 and 3/4 of the way to w[n + 4], from taps
+ * w[n] ... w[n + 7]. The first channel sets peaks, the others raise them.
+ */
+static void true_peak_block(float * restrict peaks, const float * restrict w, int nframes,
+                            const float h[3][TP_TAPS], bool first)
+{
+    int n = 0, k, p;
+#if defined(__AVX__)
+    /* two vectors of each phase in flight, so the sums do not wait on each other */
+    const __m256 sign = _mm256_set1_ps(-0.0f);
+    for (; n + 16 <= nframes; n += 16) {
+        __m256 y[2][3], pk[2];
+        for (p = 0; p < 3; p++) {
+            y[0][p] = _mm256_setzero_ps();
+            y[1][p] = _mm256_setzero_ps();
+        }
+        for (k = 0; k < TP_TAPS; k++) {
+            const __m256 x0 = _mm256_loadu_ps(w + n + k);
+            const __m256 x1 = _mm256_loadu_ps(w + n + k + 8);
+            for (p = 0; p < 3; p++) {
+                const __m256 c = _mm256_set1_ps(h[p][k]);
+#if defined(__FMA__)
+                y[0][p] = _mm256_fmadd_ps(c, x0, y[0][p]);
+                y[1][p] = _mm256_fmadd_ps(c, x1, y[1][p]);
+#else
+                y[0][p] = _mm256_add_ps(y[0][p], _mm256_mul_ps(c, x0));
+                y[1][p] = _mm256_add_ps(y[1][p], _mm256_mul_ps(c, x1));
+#endif
             }
-            DEBUG3("i=%p:%.2f, o=%p:%.2f, n=%d\n", dsp->inbufs[i], dsp->inbufs[i][n], dsp->outbufs[i], dsp->outbufs[i][n], n);
         }
-        state->offset = k;
+        for (int v = 0; v < 2; v++) {
+            pk[v] = _mm256_andnot_ps(sign, _mm256_loadu_ps(w + n + 8 * v + TP_LATENCY - 1));
+            for (p = 0; p < 3; p++)
+                pk[v] = _mm256_max_ps(pk[v], _mm256_andnot_ps(sign, y[v][p]));
+            if (!first)
+                pk[v] = _mm256_max_ps(pk[v], _mm256_loadu_ps(peaks + n + 8 * v));
+            _mm256_storeu_ps(peaks + n + 8 * v, pk[v]);
+        }
+    }
+#endif
+    for (; n < nframes; n++) {
+        float pk = fabsf(w[n + TP_LATENCY - 1]);
+        for (p = 0; p < 3; p++) {
+            float y = h[p][0] * w[n];
+            for (k = 1; k < TP_TAPS; k++)
+                y += h[p][k] * w[n + k];
+            pk = fmaxf(pk, fabsf(y));
+        }
+        peaks[n] = first ? pk : fmaxf(pk, peaks[n]);
+    }
+}
+
+/* The gain for each sample of the period from the peaks */
+static void limiter_gains(struct limiter_t * lim, float ceiling, int nframes)
+{
+    const int cap = lim->window;
+    const double scale = 1.0 / lim->lookahead;
+    int n, i;
+
+    for (n = 0; n < nframes; n++) {
+        float need = lim->peaks[n] > ceiling ? ceiling / lim->peaks[n] : 1.0f;
+        unsigned int t = lim->time++;
+        float min;
+
+        /* the front leaves the window, values at the back that are not smaller never become the minimum */
+        if (lim->mincount && t - lim->mintime[lim->minhead] >= (unsigned int)cap) {
+            if (++lim->minhead == cap)
+                lim->minhead = 0;
+            lim->mincount--;
+        }
+        for (;;) {
+            i = lim->minhead + lim->mincount - 1;
+            if (i >= cap)
+                i -= cap;
+            if (!lim->mincount || lim->minval[i] < need)
+                break;
+            lim->mincount--;
+        }
+        if (++i == cap)
+            i = 0;
+        lim->minval[i] = need;
+        lim->mintime[i] = t;
+        lim->mincount++;
+        min = lim->minval[lim->minhead];
+
+        lim->env = min < lim->env ? min : min + (lim->env - min) * lim->release;
+        lim->boxsum += lim->env - lim->box[lim->boxpos];
+        lim->box[lim->boxpos] = lim->env;
+        if (++lim->boxpos == lim->lookahead)
+            lim->boxpos = 0;
+        lim->gains[n] = lim->boxsum * scale;
+    }
+}
+
+/* Limits the gained period in the outbufs to the ceiling, delaying it by the lookahead */
+static void limit(struct qdsp_t * dsp, struct limiter_t * lim, float ceiling, int nchannels, int nframes)
+{
+    const int hist = TP_TAPS - 1;
+    const int ringlen = lim->ringlen;
+    const int start = (lim->offset + ringlen - lim->lookahead - TP_LATENCY) % ringlen;
+    const int first = nframes < ringlen - start ? nframes : ringlen - start;
+    int i;
+
+    for (i=0; i<nchannels; i++) {
+        float * w = &lim->tpwindow[(hist + nframes) * i];
+        memcpy(w + hist, dsp->outbufs[i], nframes * sizeof(float));
+        true_peak_block(lim->peaks, w, nframes, (const float (*)[TP_TAPS])lim->h, i == 0);
+        memmove(w, w + nframes, hist * sizeof(float));
+    }
+    limiter_gains(lim, ceiling, nframes);
+    for (i=0; i<nchannels; i++) {
+        float * ring = &lim->ring[ringlen * i];
+        ring_write(ring, ringlen, lim->offset, dsp->outbufs[i], nframes);
+        ramp_and_clip_block(dsp->outbufs[i], ring + start, first, lim->gains, ceiling);
+        ramp_and_clip_block(dsp->outbufs[i] + first, ring, nframes - first, lim->gains + first, ceiling);
+    }
+    lim->offset = (lim->offset + nframes) % ringlen;
+}
+
+/*
+ * Starts a ramp when the target has changed and fills in the gains of
+ * this period. Returns NULL when the gain is constant over the period.
+ */
+static const float * gain_ramp(struct qdsp_gain_state_t * state, int nframes)
+{
+    float target = gain_get_target(state);
+    double g = state->gain;
+    int n, len;
+
+    if (target != state->ramp_to) {
+        state->ramp_to = target;
+        state->ramp_left = state->ramp_len;
+        state->ramp_mul = state->ramp_exp && g * target > 0;
+        if (state->ramp_mul)
+            state->ramp_step = pow(target / g, 1.0 / state->ramp_len);
+        else
+            state->ramp_step = (target - g) / state->ramp_len;
+    }
+    if (!state->ramp_left)
+        return NULL;
+
+    len = state->ramp_left < nframes ? state->ramp_left : nframes;
+    if (state->ramp_mul) {
+        for (n = 0; n < len; n++)
+            state->gains[n] = g *= state->ramp_step;
     }
     else {
-        for (i=0; i<dsp->nchannels; i++) {
-            float * restrict delayline = &state->delayline[state->delay_samples * i];
-            for (n=0, k=dsp->nframes - state->delay_samples; n<state->delay_samples; n++, k++) {
-                dsp->outbufs[i][n] = gain_and_clip_sample(delayline[n], state->gain, state->clip_threshold);
-                delayline[n] = dsp->inbufs[i][k];
-            }
-            DEBUG3("i=%p:%.2f, o=%p:%.2f, n=%d\t", dsp->inbufs[i], dsp->inbufs[i][n], dsp->outbufs[i], dsp->outbufs[i][n], n);
-            for (k=0; n<dsp->nframes; n++, k++) {
-                dsp->outbufs[i][n] = gain_and_clip_sample(dsp->inbufs[i][k], state->gain, state->clip_threshold);
-            }
-            DEBUG3("k=%d\n", k);
+        for (n = 0; n < len; n++)
+            state->gains[n] = g + state->ramp_step * (n + 1);
+        g += state->ramp_step * len;
+    }
+    state->ramp_left -= len;
+    if (!state->ramp_left)
+        g = state->ramp_to;
+    for (; n < nframes; n++)
+        state->gains[n] = g;
+    state->gain = g;
+    return state->gains;
+}
+
+static inline __attribute__((always_inline))
+void gain_process_kernel(struct qdsp_t * dsp, const int nchannels, const int nframes, const bool aligned)
+{
+    struct qdsp_gain_state_t * state = (struct qdsp_gain_state_t *)dsp->state;
+    const int ringlen = state->ringlen;
+    const int span = state->delay_samples + state->taps - 1;
+    /* the oldest sample the first output of this period needs */
+    const int start = (state->offset + ringlen - span) % ringlen;
+    const int first = nframes < ringlen - start ? nframes : ringlen - start;
+    const float * gains = gain_ramp(state, nframes);
+    /* the limiter does the clipping */
+    const float clip_threshold = state->limiter ? INFINITY : state->clip_threshold;
+    /* zeros in that fill the delay line give zeros out, the limiter links all channels */
+    const int memory = state->limiter ? INT_MAX : span ? ringlen : 0;
+    int i;
+
+    for (i=0; i<nchannels; i++) {
+        const float * restrict inbuf = ASSUME_ALIGNED(dsp->inbufs[i], aligned);
+        float * restrict outbuf = ASSUME_ALIGNED(dsp->outbufs[i], aligned);
+        float * restrict ring = &state->delayline[ringlen * i];
+
+        dsp->outsilent[i] = dsp->insilent[i] && state->silentframes[i] >= memory;
+        if (dsp->outsilent[i]) {
+            memset(outbuf, 0, nframes * sizeof(float));
+            continue;
+        }
+        if (!dsp->insilent[i])
+            state->silentframes[i] = 0;
+        else if (state->silentframes[i] < ringlen)
+            state->silentframes[i] += nframes;
+
+        if (!span) {
+            if (gains)
+                ramp_and_clip_block(outbuf, inbuf, nframes, gains, clip_threshold);
+            else
+                gain_and_clip_block(outbuf, inbuf, nframes, state->gain, clip_threshold);
+            continue;
+        }
+        ring_write(ring, ringlen, state->offset, inbuf, nframes);
+        if (state->taps == 1 && gains) {
+            ramp_and_clip_block(outbuf, ring + start, first, gains, clip_threshold);
+            ramp_and_clip_block(outbuf + first, ring, nframes - first, gains + first, clip_threshold);
+        }
+        else if (state->taps == 1) {
+            gain_and_clip_block(outbuf, ring + start, first, state->gain, clip_threshold);
+            gain_and_clip_block(outbuf + first, ring, nframes - first, state->gain, clip_threshold);
+        }
+        else if (gains) {
+            ring_read(state->window, ring, ringlen, start, nframes + span - state->delay_samples);
+            lagrange_gain_and_clip_block(outbuf, state->window, nframes, state->h, 1.0f, INFINITY);
+            ramp_and_clip_block(outbuf, outbuf, nframes, gains, clip_threshold);
+        }
+        else {
+            ring_read(state->window, ring, ringlen, start, nframes + span - state->delay_samples);
+            lagrange_gain_and_clip_block(outbuf, state->window, nframes, state->h, state->gain, clip_threshold);
+        }
+        DEBUG3("i=%p:%.2f, o=%p:%.2f\n", dsp->inbufs[i], dsp->inbufs[i][0], dsp->outbufs[i], dsp->outbufs[i][0]);
+    }
+    if (span)
+        state->offset = (state->offset + nframes) % ringlen;
+    if (state->limiter)
+        limit(dsp, state->limiter, state->clip_threshold, nchannels, nframes);
+}
+
+void gain_process(struct qdsp_t * dsp)
+{
+    gain_process_kernel(dsp, dsp->nchannels, dsp->nframes, false);
+}
+
+SPECIALISED_KERNELS(DEFINE_KERNEL, gain_process)
+KERNEL_TABLE(gain_process);
+
+static void limiter_init(struct qdsp_t * dsp, struct limiter_t * lim)
+{
+    const int hist = TP_TAPS - 1;
+    int p, k;
+
+    lim->lookahead = lim->lookahead_seconds * dsp->fs + 0.5;
+    if (lim->lookahead < 1)
+        lim->lookahead = 1;
+    lim->release = expf(-1.0f / (lim->release_seconds * dsp->fs));
+    /* Hann windowed sinc, each phase normalised to unity gain at DC */
+    for (p = 0; p < 3; p++) {
+        double sum = 0;
+        for (k = 0; k < TP_TAPS; k++) {
+            double d = k - (TP_LATENCY - 1) - (p + 1) / 4.0;
+            double x = M_PI * d;
+            lim->h[p][k] = sin(x) / x * 0.5 * (1 + cos(M_PI * d / TP_LATENCY));
+            sum += lim->h[p][k];
         }
+        for (k = 0; k < TP_TAPS; k++)
+            lim->h[p][k] /= sum;
     }
+    debugprint(2, "%s: lookahead=%d, latency=%d\n", __func__, lim->lookahead, lim->lookahead + TP_LATENCY);
+
+    /* a peak spans two samples, the later one is held one sample longer */
+    lim->window = lim->lookahead + 2;
+    lim->ringlen = lim->lookahead + TP_LATENCY + dsp->nframes;
+    lim->offset = 0;
+    lim->minhead = 0;
+    lim->mincount = 0;
+    lim->time = 0;
+    lim->env = 1.0f;
+    lim->boxpos = 0;
+    lim->boxsum = lim->lookahead;
+
+    lim->tpwindow = (float*)realloc(lim->tpwindow, (hist + dsp->nframes) * dsp->nchannels * sizeof(float));
+    lim->peaks = (float*)realloc(lim->peaks, dsp->nframes * sizeof(float));
+    lim->gains = (float*)realloc(lim->gains, dsp->nframes * sizeof(float));
+    lim->ring = (float*)realloc(lim->ring, lim->ringlen * dsp->nchannels * sizeof(float));
+    lim->minval = (float*)realloc(lim->minval, lim->window * sizeof(float));
+    lim->mintime = (unsigned int*)realloc(lim->mintime, lim->window * sizeof(unsigned int));
+    lim->box = (float*)realloc(lim->box, lim->lookahead * sizeof(float));
+    if (!lim->tpwindow || !lim->peaks || !lim->gains || !lim->ring || !lim->minval || !lim->mintime || !lim->box)
+        endprogram("Could not allocate memory for limiter.\n");
+    memset(lim->tpwindow, 0, (hist + dsp->nframes) * dsp->nchannels * sizeof(float));
+    memset(lim->ring, 0, lim->ringlen * dsp->nchannels * sizeof(float));
+    for (k = 0; k < lim->lookahead; k++)
+        lim->box[k] = 1.0f;
+}
+
+static void limiter_free(struct limiter_t * lim)
+{
+    free(lim->tpwindow);
+    free(lim->peaks);
+    free(lim->gains);
+    free(lim->ring);
+    free(lim->minval);
+    free(lim->mintime);
+    free(lim->box);
+    free(lim);
 }
 
 void gain_init(struct qdsp_t * dsp)
 {
     struct qdsp_gain_state_t * state = (struct qdsp_gain_state_t *)dsp->state;
-    state->delay_samples = state->delay_seconds * dsp->fs;
-    debugprint(2, "%s: delay_samples=%d\n", __func__, state->delay_samples);
-    state->delayline = (float*)realloc(state->delayline, state->delay_samples * dsp->nchannels * sizeof(float));
-    memset(state->delayline, 0, state->delay_samples * dsp->nchannels * sizeof(float));
+    double delay = state->delay_seconds * dsp->fs;
+    double whole = floor(delay + 0.5);
+
+    if (fabs(delay - whole) < 1e-6) {
+        state->delay_samples = whole;
+        state->taps = 1;
+    }
+    else {
+        /* the interpolator is most accurate between its middle taps */
+        double mu;
+        state->delay_samples = delay >= 2 ? (int)floor(delay) - 1 : 0;
+        state->taps = LAGRANGE_TAPS;
+        mu = delay - state->delay_samples;
+        state->h[0] = -(mu - 1) * (mu - 2) * (mu - 3) / 6;
+        state->h[1] = mu * (mu - 2) * (mu - 3) / 2;
+        state->h[2] = -mu * (mu - 1) * (mu - 3) / 2;
+        state->h[3] = mu * (mu - 1) * (mu - 2) / 6;
+    }
+    debugprint(2, "%s: delay_samples=%d, taps=%d\n", __func__, state->delay_samples, state->taps);
+
+    state->ringlen = state->delay_samples + state->taps - 1 + dsp->nframes;
+    state->offset = 0;
+    memset(state->silentframes, 0, sizeof(state->silentframes));
+    state->delayline = (float*)realloc(state->delayline, state->ringlen * dsp->nchannels * sizeof(float));
+    memset(state->delayline, 0, state->ringlen * dsp->nchannels * sizeof(float));
+    state->window = (float*)realloc(state->window, (dsp->nframes + state->taps - 1) * sizeof(float));
+    if (!state->delayline || !state->window) endprogram("Could not allocate memory for delay line.\n");
+
+    /* a restart does not ramp, it begins at the last target */
+    state->gain = state->ramp_to = gain_get_target(state);
+    state->ramp_left = 0;
+    state->ramp_len = state->ramp_seconds * dsp->fs + 0.5;
+    if (state->ramp_len < 1)
+        state->ramp_len = 1;
+    state->gains = (float*)realloc(state->gains, dsp->nframes * sizeof(float));
+    if (!state->gains) endprogram("Could not allocate memory for gain ramp.\n");
+
+    if (state->limiter)
+        limiter_init(dsp, state->limiter);
+}
+
+int gain_codegen(struct qdsp_t * dsp, FILE * out, enum codegen_part part, int stage)
+{
+    struct qdsp_gain_state_t * state = (struct qdsp_gain_state_t *)dsp->state;
+    /* a ring of the last len inputs, the newest at s<stage>_k */
+    int len = state->delay_samples + state->taps;
+    bool delayed = len > 1;
+
+    if (state->limiter) {
+        debugprint(0, "%s: The limiter does not support code generation\n", __func__);
+        return 1;
+    }
+    switch (part) {
+    case CODEGEN_DECL:
+        if (delayed) {
+            fprintf(out, "static float s%d_delay[NCHANNELS][%d];\n", stage, len);
+            fprintf(out, "static int s%d_offset;\n", stage);
+        }
+        break;
+    case CODEGEN_PRE:
+        if (delayed)
+            fprintf(out, "        int s%d_k = s%d_offset;\n", stage, stage);
+        break;
+    case CODEGEN_SAMPLE:
+        if (delayed) {
+            fprintf(out, "            s%d_delay[c][s%d_k] = x;\n", stage, stage);
+            fprintf(out, "            x = 0.0f");
+            for (int k = 0; k < state->taps; k++)
+                fprintf(out, " + %af * s%d_delay[c][(s%d_k + %d) %% %d]", state->taps == 1 ? 1.0f : state->h[k],
+                        stage, stage, len - state->delay_samples - k, len);
+            fprintf(out, ";\n");
+            fprintf(out, "            if (++s%d_k == %d) s%d_k = 0;\n", stage, len, stage);
+        }
+        fprintf(out, "            x = fmaxf(fminf(%af * x, %af), -%af);\n", state->gain, state->clip_threshold, state->clip_threshold);
+        break;
+    case CODEGEN_POST:
+        if (delayed)
+            fprintf(out, "        if (c == NCHANNELS - 1) s%d_offset = s%d_k;\n", stage, stage);
+        break;
+    case CODEGEN_RESET:
+        if (delayed) {
+            fprintf(out, "    memset(s%d_delay, 0, sizeof(s%d_delay));\n", stage, stage);
+            fprintf(out, "    s%d_offset = 0;\n", stage);
+        }
+        break;
+    }
+    return 0;
 }
 
 void destroy_gain(struct qdsp_t * dsp)
 {
     struct qdsp_gain_state_t * state = (struct qdsp_gain_state_t *)dsp->state;
     free(state->delayline);
+    free(state->window);
+    free(state->gains);
+    if (state->limiter)
+        limiter_free(state->limiter);
     free(dsp->state);
 }
 
+unsigned int gain_preroll(struct qdsp_t * dsp, double tolerance)
+{
+    struct qdsp_gain_state_t * state = (struct qdsp_gain_state_t *)dsp->state;
+    struct limiter_t * lim = state->limiter;
+    unsigned int n = state->delay_samples + state->taps - 1;
+
+    if (lim) {
+        /* the detector, the hold and the average have finite memory, the release has not */
+        double release = log(tolerance) / log(lim->release);
+        n += TP_TAPS + lim->window + 2 * lim->lookahead + TP_LATENCY;
+        n += release < 60.0 * dsp->fs ? (unsigned int)release : 60 * dsp->fs;
+    }
+    return n;
+}
+
+int clone_gain(struct qdsp_t * dsp, const struct qdsp_t * src)
+{
+    struct qdsp_gain_state_t * state = malloc(sizeof(struct qdsp_gain_state_t));
+    if (!state) return 1;
+    memcpy(state, src->state, sizeof(struct qdsp_gain_state_t));
+    state->delayline = NULL;
+    state->window = NULL;
+    state->gains = NULL;
+    if (state->limiter) {
+        struct limiter_t * lim = calloc(1, sizeof(struct limiter_t));
+        if (!lim) return 1;
+        lim->lookahead_seconds = state->limiter->lookahead_seconds;
+        lim->release_seconds = state->limiter->release_seconds;
+        state->limiter = lim;
+    }
+    dsp->state = (void*)state;
+    return 0;
+}
+
+/* Runtime options, a new gain starts a ramp in the processing thread */
+int control_gain(struct qdsp_t * dsp, char * subopts)
+{
+    enum {
+        GAIN_OPT = 0,
+        GAIN_LIN_OPT,
+    };
+    char *const token[] = {
+        [GAIN_OPT]   = "g",
+        [GAIN_LIN_OPT]   = "gl",
+        NULL
+    };
+    struct qdsp_gain_state_t * state = (struct qdsp_gain_state_t *)dsp->state;
+    char *value;
+
+    debugprint(1, "%s subopts: %s\n", __func__, subopts);
+    while (*subopts != '\0') {
+        switch (getsubopt(&subopts, token, &value)) {
+        case GAIN_OPT:
+            if (value == NULL) {
+                debugprint(0, "%s: Missing value for suboption '%s'\n", __func__, token[GAIN_OPT]);
+                return 1;
+            }
+            gain_set_target(state, powf(10.0f, atof(value) / 20.0f));
+            break;
+        case GAIN_LIN_OPT:
+            if (value == NULL) {
+                debugprint(0, "%s: Missing value for suboption '%s'\n", __func__, token[GAIN_LIN_OPT]);
+                return 1;
+            }
+            gain_set_target(state, atof(value));
+            break;
+        default:
+            debugprint(0, "%s: No match found for token: /%s/\n", __func__, value);
+            return 1;
+        }
+    }
+    return 0;
+}
+
 int create_gain(struct qdsp_t * dsp, char ** subopts)
 {
     enum {
@@ -78,29 +669,45 @@ int create_gain(struct qdsp_t * dsp, char ** subopts)
         GAIN_LIN_OPT,
         DELAY_OPT,
         THRESHOLD_OPT,
+        RAMP_OPT,
+        RAMP_EXP_OPT,
+        LOOKAHEAD_OPT,
+        RELEASE_OPT,
     };
     char *const token[] = {
         [GAIN_OPT]   = "g",
         [GAIN_LIN_OPT]   = "gl",
         [DELAY_OPT]  = "d",
         [THRESHOLD_OPT]  = "t",
+        [RAMP_OPT]  = "r",
+        [RAMP_EXP_OPT]  = "e",
+        [LOOKAHEAD_OPT]  = "l",
+        [RELEASE_OPT]  = "rl",
         NULL
     };
     char *value;
     int errfnd = 0;
+    int curtoken;
     struct qdsp_gain_state_t * state = malloc(sizeof(struct qdsp_gain_state_t));
     dsp->state = (void*)state;
 
     // default values
     state->delayline = NULL;
+    state->window = NULL;
+    state->gains = NULL;
+    state->ramp_seconds = RAMP_SECONDS_DEFAULT;
+    state->ramp_exp = false;
+    state->limiter = NULL;
     state->delay_seconds = 0;
+    state->delay_samples = 0;
+    state->taps = 1;
     state->gain = 1.0f;
     state->offset = 0;
     state->clip_threshold = 1.0f;
 
     debugprint(1, "%s subopts: %s\n", __func__, *subopts);
     while (**subopts != '\0' && !errfnd) {
-        switch (getsubopt(subopts, token, &value)) {
+        switch (curtoken = getsubopt(subopts, token, &value)) {
         case GAIN_OPT:
             if (value == NULL) {
                 debugprint(0, "%s: Missing value for suboption '%s'\n", __func__, token[GAIN_OPT]);
@@ -137,15 +744,57 @@ int create_gain(struct qdsp_t * dsp, char ** subopts)
             state->clip_threshold = powf(10.0f, atof(value) / 20.0f);
             debugprint(1, "%s: gain=%f\n", __func__, atof(value));
             break;
+        case RAMP_OPT:
+            if (value == NULL) {
+                debugprint(0, "%s: Missing value for suboption '%s'\n", __func__, token[RAMP_OPT]);
+                errfnd = 1;
+                continue;
+            }
+            state->ramp_seconds = atof(value);
+            debugprint(1, "%s: ramp_seconds=%f\n", __func__, atof(value));
+            break;
+        case RAMP_EXP_OPT:
+            state->ramp_exp = true;
+            break;
+        case LOOKAHEAD_OPT:
+        case RELEASE_OPT:
+            if (value == NULL) {
+                debugprint(0, "%s: Missing value for suboption '%s'\n", __func__, token[curtoken]);
+                errfnd = 1;
+                continue;
+            }
+            if (!state->limiter) {
+                if (!(state->limiter = calloc(1, sizeof(struct limiter_t))))
+                    endprogram("Could not allocate memory for limiter.\n");
+                state->limiter->release_seconds = RELEASE_SECONDS_DEFAULT;
+            }
+            if (curtoken == LOOKAHEAD_OPT)
+                state->limiter->lookahead_seconds = atof(value);
+            else
+                state->limiter->release_seconds = atof(value);
+            debugprint(1, "%s: %s=%f\n", __func__, token[curtoken], atof(value));
+            break;
         default:
             debugprint(0, "%s: No match found for token: /%s/\n", __func__, value);
             errfnd = 1;
             break;
         }
     }
+    if (state->limiter && !(state->limiter->lookahead_seconds > 0 && state->limiter->release_seconds > 0)) {
+        debugprint(0, "%s: The limiter needs a lookahead and release above 0\n", __func__);
+        errfnd = 1;
+    }
+    gain_set_target(state, state->gain);
+    state->ramp_to = state->gain;
+    state->ramp_left = 0;
     dsp->process = gain_process;
+    dsp->kernels = gain_process_kernels;
     dsp->init = gain_init;
+    dsp->clone = clone_gain;
+    dsp->preroll = gain_preroll;
     dsp->destroy = destroy_gain;
+    dsp->codegen = gain_codegen;
+    dsp->control = control_gain;
 
     return errfnd;
 }
@@ -156,8 +805,13 @@ void help_gain(void)
     debugprint(0, "    Name: gain\n");
     debugprint(0, "        g = gain value (dB)\n");
     debugprint(0, "        gl = gain value (linear)\n");
-    debugprint(0, "        d = delay value (seconds)\n");
+    debugprint(0, "        d = delay value (seconds), fractional samples are interpolated\n");
     debugprint(0, "        t = clip threshold (dBFS)\n");
+    debugprint(0, "        r = ramp time for runtime gain changes (seconds, default %g)\n", RAMP_SECONDS_DEFAULT);
+    debugprint(0, "        e = ramp with a constant factor per sample, i.e. linearly in dB\n");
+    debugprint(0, "        l = lookahead (seconds), limits true peaks to t instead of clipping\n");
+    debugprint(0, "        rl = limiter release time (seconds, default %g)\n", RELEASE_SECONDS_DEFAULT);
+    debugprint(0, "    Runtime options: g, gl\n");
     debugprint(0, "    Example: -p gain,g=-3,d=0.002,t=-6\n");
-    debugprint(0, "    Note: Gain is applied before clipping\n");
+    debugprint(0, "    Note: Gain is applied before clipping. The limiter adds the lookahead plus %d samples of latency\n", TP_LATENCY);
 }
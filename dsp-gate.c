@@ -6,91 +6,180 @@
 #include <math.h>
 #include "dsp.h"
 
-enum gate_status {gate_open, gate_closed, gate_release, gate_attack};
+#if defined(__AVX__)
+#include <immintrin.h>
+#endif
 
+#define ATTACK_SECONDS_DEFAULT 0.001
+#define RELEASE_SECONDS_DEFAULT 0.01
+#define SUBBLOCK 8
+
+/*
+ * The gate opens on any sample above the threshold, stays open for the
+ * hold time after the last one and then closes. The gain follows with
+ * linear ramps of the attack and release times, per sample, so the output
+ * does not depend on the period size. Each channel is scanned in
+ * sub-blocks of SUBBLOCK samples: a sub-block of a fully open gate that
+ * stays open is copied, one of a closed gate without a sample above the
+ * threshold is zeroed, and only the sub-blocks around a transition run
+ * the per-sample envelope. Outputs of a closed gate are flagged silent,
+ * so the stages after it can skip them.
+ */
 struct qdsp_gate_state_t {
-    enum gate_status status[NCHANNELS_MAX];
     float threshold;
-    float hold;
-    unsigned int holdcount[NCHANNELS_MAX];
+    double hold;
+    double attack;
+    double release;
+    unsigned int holdlen;
+    float attackstep;
+    float releasestep;
+    float gain[NCHANNELS_MAX];
+    unsigned int holdleft[NCHANNELS_MAX];
 };
 
-void gate_process(struct qdsp_t * dsp)
+/* Bit n is set if sample n of the sub-block is above the threshold */
+static inline unsigned int gate_above(const float * in, float threshold)
+{
+#if defined(__AVX__)
+    const __m256 x = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), _mm256_loadu_ps(in));
+    return _mm256_movemask_ps(_mm256_cmp_ps(x, _mm256_set1_ps(threshold), _CMP_GT_OQ));
+#else
+    unsigned int mask = 0;
+    for (int n=0; n<SUBBLOCK; n++)
+        mask |= (fabsf(in[n]) > threshold) << n;
+    return mask;
+#endif
+}
+
+static inline void gate_envelope(struct qdsp_gate_state_t * state, int i, float * out, const float * in, int len)
+{
+    float gain = state->gain[i];
+    unsigned int holdleft = state->holdleft[i];
+
+    for (int n=0; n<len; n++) {
+        if (fabsf(in[n]) > state->threshold) {
+            holdleft = state->holdlen;
+            gain = fminf(gain + state->attackstep, 1.0f);
+        } else if (holdleft) {
+            holdleft--;
+            gain = fminf(gain + state->attackstep, 1.0f);
+        } else {
+            gain = fmaxf(gain - state->releasestep, 0.0f);
+        }
+        out[n] = gain * in[n];
+    }
+    state->gain[i] = gain;
+    state->holdleft[i] = holdleft;
+}
+
+static inline __attribute__((always_inline))
+void gate_process_kernel(struct qdsp_t * dsp, const int nchannels, const int nframes, const bool aligned)
 {
     struct qdsp_gate_state_t * state = (struct qdsp_gate_state_t *)dsp->state;
-    unsigned int holdthresh = (state->hold * dsp->fs) / dsp->nframes;
     int i,n;
-    float gain, gainstep;
-
-    for (i=0; i<dsp->nchannels; i++) {
-        const float * inbuf = dsp->inbufs[i];
-        float * outbuf = dsp->outbufs[i];
-
-        switch (state->status[i]) {
-            default:
-            case gate_open:
-                for (n=0; n<dsp->nframes; n++) {
-                    if (fabsf(inbuf[n]) > state->threshold) {
-                        state->holdcount[i] = 0;
-                        state->status[i] = gate_open;
-                        break;
-                    }
-                }
-                if (n == dsp->nframes) {
-                    state->holdcount[i]++;
-                    if (state->holdcount[i] >= holdthresh) {
-                        state->status[i] = gate_attack;
-                    }
-                }
-                memcpy(outbuf, inbuf, dsp->nframes*sizeof(float));
-                DEBUG3("%s: open, holdcount=%i, holdthresh=%i\n", __func__, state->holdcount[i], holdthresh);
-                break;
-
-            case gate_closed:
-                for (n=0; n<dsp->nframes; n++) {
-                    if (fabsf(inbuf[n]) > state->threshold) {
-                        state->holdcount[i] = 0;
-                        state->status[i] = gate_release;
-                        break;
-                    }
-                }
-                memcpy(outbuf, dsp->zerobuf, dsp->nframes*sizeof(float));
-                DEBUG3("%s: closed\n", __func__);
-                break;
-
-            case gate_attack:
-                gainstep = 1.0f / (dsp->nframes-1);
-                gain = 1.0f;
-                for (n=0; n<dsp->nframes; n++) {
-                    outbuf[n] = gain * inbuf[n];
-                    gain -= gainstep;
-                }
-                state->status[i] = gate_closed;
-                DEBUG3("%s: attack\n", __func__);
-                break;
-
-            case gate_release:
-                gainstep = 1.0f / (dsp->nframes-1);
-                gain = 0;
-                for (n=0; n<dsp->nframes; n++) {
-                    outbuf[n] = gain * inbuf[n];
-                    gain += gainstep;
-                }
-                state->status[i] = gate_open;
-                DEBUG3("%s: release\n", __func__);
-                break;
+
+    for (i=0; i<nchannels; i++) {
+        const float * restrict inbuf = ASSUME_ALIGNED(dsp->inbufs[i], aligned);
+        float * restrict outbuf = ASSUME_ALIGNED(dsp->outbufs[i], aligned);
+        bool silent = true;
+
+        /* a closed gate stays closed on silence */
+        if (dsp->insilent[i] && state->gain[i] == 0.0f && !state->holdleft[i]) {
+            memset(outbuf, 0, nframes * sizeof(float));
+            dsp->outsilent[i] = true;
+            continue;
         }
+
+        for (n=0; n + SUBBLOCK <= nframes; n += SUBBLOCK) {
+            const unsigned int above = gate_above(inbuf + n, state->threshold);
+            /* samples after the last one above the threshold */
+            const unsigned int below = above ? __builtin_clz(above) - (32 - SUBBLOCK) : SUBBLOCK;
+
+            /* unless all samples are above the threshold the hold must bridge the gaps between them */
+            if (state->gain[i] == 1.0f && (above == (1u << SUBBLOCK) - 1 ||
+                (state->holdleft[i] >= SUBBLOCK && (!above || state->holdlen >= SUBBLOCK)))) {
+                if (above)
+                    state->holdleft[i] = state->holdlen - below;
+                else
+                    state->holdleft[i] -= below;
+                memcpy(outbuf + n, inbuf + n, SUBBLOCK * sizeof(float));
+                silent = false;
+            } else if (state->gain[i] == 0.0f && !above && !state->holdleft[i]) {
+                memset(outbuf + n, 0, SUBBLOCK * sizeof(float));
+            } else {
+                gate_envelope(state, i, outbuf + n, inbuf + n, SUBBLOCK);
+                silent = false;
+            }
+        }
+        gate_envelope(state, i, outbuf + n, inbuf + n, nframes - n);
+        for (; n < nframes; n++)
+            silent &= outbuf[n] == 0.0f;
+        dsp->outsilent[i] = silent;
+        DEBUG3("%s: channel %d, gain=%f, holdleft=%u\n", __func__, i, state->gain[i], state->holdleft[i]);
     }
 }
 
+void gate_process(struct qdsp_t * dsp)
+{
+    gate_process_kernel(dsp, dsp->nchannels, dsp->nframes, false);
+}
+
+SPECIALISED_KERNELS(DEFINE_KERNEL, gate_process)
+KERNEL_TABLE(gate_process);
+
 void gate_init(struct qdsp_t * dsp)
 {
-	struct qdsp_gate_state_t * state = (struct qdsp_gate_state_t *)dsp->state;
+    struct qdsp_gate_state_t * state = (struct qdsp_gate_state_t *)dsp->state;
+    const double attacklen = state->attack * dsp->fs;
+    const double releaselen = state->release * dsp->fs;
 
+    state->holdlen = lrint(state->hold * dsp->fs);
+    state->attackstep = attacklen >= 1.0 ? 1.0 / attacklen : 1.0f;
+    state->releasestep = releaselen >= 1.0 ? 1.0 / releaselen : 1.0f;
     for (int i=0; i<NCHANNELS_MAX; i++) {
-        state->holdcount[i] = 0;
-        state->status[i] = gate_open;
+        state->gain[i] = 1.0f;
+        state->holdleft[i] = state->holdlen;
+    }
+}
+
+/* The per-sample envelope of gate_envelope, the sub-block shortcuts are left to the compiler */
+int gate_codegen(struct qdsp_t * dsp, FILE * out, enum codegen_part part, int stage)
+{
+    struct qdsp_gate_state_t * state = (struct qdsp_gate_state_t *)dsp->state;
+
+    switch (part) {
+    case CODEGEN_DECL:
+        fprintf(out, "static float s%d_gain[NCHANNELS];\n", stage);
+        fprintf(out, "static unsigned int s%d_holdleft[NCHANNELS];\n", stage);
+        break;
+    case CODEGEN_PRE:
+        fprintf(out, "        float s%d_g = s%d_gain[c];\n", stage, stage);
+        fprintf(out, "        unsigned int s%d_h = s%d_holdleft[c];\n", stage, stage);
+        break;
+    case CODEGEN_SAMPLE:
+        fprintf(out, "            if (fabsf(x) > %af) {\n", state->threshold);
+        fprintf(out, "                s%d_h = %uu;\n", stage, state->holdlen);
+        fprintf(out, "                s%d_g = fminf(s%d_g + %af, 1.0f);\n", stage, stage, state->attackstep);
+        fprintf(out, "            } else if (s%d_h) {\n", stage);
+        fprintf(out, "                s%d_h--;\n", stage);
+        fprintf(out, "                s%d_g = fminf(s%d_g + %af, 1.0f);\n", stage, stage, state->attackstep);
+        fprintf(out, "            } else {\n");
+        fprintf(out, "                s%d_g = fmaxf(s%d_g - %af, 0.0f);\n", stage, stage, state->releasestep);
+        fprintf(out, "            }\n");
+        fprintf(out, "            x = s%d_g * x;\n", stage);
+        break;
+    case CODEGEN_POST:
+        fprintf(out, "        s%d_gain[c] = s%d_g;\n", stage, stage);
+        fprintf(out, "        s%d_holdleft[c] = s%d_h;\n", stage, stage);
+        break;
+    case CODEGEN_RESET:
+        fprintf(out, "    for (int c = 0; c < NCHANNELS; c++) {\n");
+        fprintf(out, "        s%d_gain[c] = 1.0f;\n", stage);
+        fprintf(out, "        s%d_holdleft[c] = %uu;\n", stage, state->holdlen);
+        fprintf(out, "    }\n");
+        break;
     }
+    return 0;
 }
 
 void destroy_gate(struct qdsp_t * dsp)
@@ -98,15 +187,36 @@ void destroy_gate(struct qdsp_t * dsp)
     free(dsp->state);
 }
 
+/* After the hold time and a full ramp the gate follows its input again */
+unsigned int gate_preroll(struct qdsp_t * dsp, double tolerance)
+{
+    struct qdsp_gate_state_t * state = (struct qdsp_gate_state_t *)dsp->state;
+    (void)tolerance;
+    return ceil((state->hold + state->attack + state->release) * dsp->fs) + 1;
+}
+
+int clone_gate(struct qdsp_t * dsp, const struct qdsp_t * src)
+{
+    struct qdsp_gate_state_t * state = malloc(sizeof(struct qdsp_gate_state_t));
+    if (!state) return 1;
+    memcpy(state, src->state, sizeof(struct qdsp_gate_state_t));
+    dsp->state = (void*)state;
+    return 0;
+}
+
 int create_gate(struct qdsp_t * dsp, char ** subopts)
 {
     enum {
         THRESHOLD_OPT = 0,
-        HOLDTIME_OPT
+        HOLDTIME_OPT,
+        ATTACK_OPT,
+        RELEASE_OPT
     };
     char *const token[] = {
         [THRESHOLD_OPT]   = "t",
         [HOLDTIME_OPT]   = "h",
+        [ATTACK_OPT]   = "a",
+        [RELEASE_OPT]   = "r",
         NULL
     };
     char *value;
@@ -115,6 +225,8 @@ int create_gate(struct qdsp_t * dsp, char ** subopts)
     dsp->state = (void*)state;
     state->threshold=0;
     state->hold=0;
+    state->attack=ATTACK_SECONDS_DEFAULT;
+    state->release=RELEASE_SECONDS_DEFAULT;
 
     debugprint(1, "%s: subopts: %s\n", __func__, *subopts);
     while (**subopts != '\0' && !errfnd) {
@@ -135,7 +247,25 @@ int create_gate(struct qdsp_t * dsp, char ** subopts)
                 continue;
             }
             state->hold = atof(value);
-            debugprint(1, "%s: holdtime=%d\n", __func__, atoi(value));
+            debugprint(1, "%s: holdtime=%f\n", __func__, state->hold);
+            break;
+        case ATTACK_OPT:
+            if (value == NULL) {
+                debugprint(0, "Missing value for suboption '%s'\n", token[ATTACK_OPT]);
+                errfnd = 1;
+                continue;
+            }
+            state->attack = atof(value);
+            debugprint(1, "%s: attack=%f\n", __func__, state->attack);
+            break;
+        case RELEASE_OPT:
+            if (value == NULL) {
+                debugprint(0, "Missing value for suboption '%s'\n", token[RELEASE_OPT]);
+                errfnd = 1;
+                continue;
+            }
+            state->release = atof(value);
+            debugprint(1, "%s: release=%f\n", __func__, state->release);
             break;
         default:
             debugprint(0, "%s: No match found for token: /%s/\n", __func__, value);
@@ -147,10 +277,18 @@ int create_gate(struct qdsp_t * dsp, char ** subopts)
         debugprint(0, "%s: Missing value for threshold.\n", __func__);
         errfnd = 1;
     }
+    if (state->hold < 0 || state->attack < 0 || state->release < 0) {
+        debugprint(0, "%s: Negative hold, attack or release time.\n", __func__);
+        errfnd = 1;
+    }
 
     dsp->process = gate_process;
+    dsp->kernels = gate_process_kernels;
     dsp->init = gate_init;
+    dsp->clone = clone_gate;
+    dsp->preroll = gate_preroll;
     dsp->destroy = destroy_gate;
+    dsp->codegen = gate_codegen;
 
     return errfnd;
 }
@@ -159,5 +297,7 @@ void help_gate(void)
 {
     debugprint(0, "  Gate options\n");
     debugprint(0, "    Name: gate\n    t=threshold (dBFS)\n    h=holdtime (sec)\n");
-    debugprint(0, "    Example: -p gate,t=-80,h=30\n");
+    debugprint(0, "    a=attack, opening ramp (sec, default %g)\n", ATTACK_SECONDS_DEFAULT);
+    debugprint(0, "    r=release, closing ramp (sec, default %g)\n", RELEASE_SECONDS_DEFAULT);
+    debugprint(0, "    Example: -p gate,t=-80,h=0.5,a=0.002,r=0.05\n");
 }
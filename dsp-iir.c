@@ -6,41 +6,10 @@
 #include <stdbool.h>
 #include <math.h>
 #include "dsp.h"
-
-typedef double iirfp;
-
-enum iir_type {
-    DIRECT_OPT = 0,
-    LP2_OPT,
-    HP2_OPT,
-    LS2_OPT,
-    HS2_OPT,
-    LP1_OPT,
-    HP1_OPT,
-    LS1_OPT,
-    HS1_OPT,
-    PEQ_OPT,
-    LWT_OPT,
-    AP2_OPT,
-    AP1_OPT,
-};
-
-struct coeffs_t {
-    iirfp a1;
-    iirfp a2;
-    iirfp b0;
-    iirfp b1;
-    iirfp b2;
-};
-
-struct qdsp_iir_state_t {
-    enum iir_type type;
-    double f0,f1,q0,q1,gain;
-    struct coeffs_t coeffs __attribute__ ((aligned (16)));
-    iirfp s[2*NCHANNELS_MAX] __attribute__ ((aligned (16)));
-};
+#include "dsp-iir.h"
 
 typedef double v2df __attribute__ ((vector_size (16)));
+typedef double v4df __attribute__ ((vector_size (32)));
 
 int calc_coeffs(struct qdsp_iir_state_t * state, int fs)
 {
@@ -140,19 +109,50 @@ void init_iir(struct qdsp_t * dsp)
     if (state->type != DIRECT_OPT) {
         calc_coeffs(state, dsp->fs);
     }
+    memset(state->s, 0, sizeof(state->s));
 }
 
-void iir_process(struct qdsp_t * dsp)
+/*
+ * Returns a bit mask of the channels with silent input and a state that
+ * has decayed below IIR_SILENCE. Their state is cleared, so they stay
+ * exactly silent and never decay into denormals.
+ */
+static inline unsigned int iir_quiet(struct qdsp_t * dsp, struct qdsp_iir_state_t * state, const int nchannels)
+{
+    unsigned int quiet = 0;
+
+    for (int c=0; c<nchannels; c++) {
+        if (dsp->insilent[c] && fabs(state->s[c*2]) + fabs(state->s[c*2+1]) < IIR_SILENCE) {
+            state->s[c*2] = state->s[c*2+1] = 0;
+            quiet |= 1u << c;
+        }
+        dsp->outsilent[c] = quiet >> c & 1;
+    }
+    return quiet;
+}
+
+static inline __attribute__((always_inline))
+void iir_process_kernel(struct qdsp_t * dsp, const int nchannels, const int nframes, const bool aligned)
 {
     struct qdsp_iir_state_t * state = (struct qdsp_iir_state_t *)dsp->state;
-    int nchannels = dsp->nchannels;
-    int nframes = dsp->nframes;
+    const unsigned int quiet = iir_quiet(dsp, state, nchannels);
     int c,n;
 
+    /* the vector kernels give exact zeros on quiet channels, skip them only when all are */
+    if (quiet == (1u << nchannels) - 1) {
+        for (c=0; c<nchannels; c++)
+            memset(dsp->outbufs[c], 0, nframes * sizeof(float));
+        return;
+    }
+
     switch (nchannels) {
     case 2:
 #if 1
     {
+        const float * restrict inbuf0 = ASSUME_ALIGNED(dsp->inbufs[0], aligned);
+        const float * restrict inbuf1 = ASSUME_ALIGNED(dsp->inbufs[1], aligned);
+        float * restrict outbuf0 = ASSUME_ALIGNED(dsp->outbufs[0], aligned);
+        float * restrict outbuf1 = ASSUME_ALIGNED(dsp->outbufs[1], aligned);
         v2df x,y,s1,s2,b0,b1,b2,a1,a2 __attribute__ ((aligned (16)));
         a1[0] = a1[1] = state->coeffs.a1;
         a2[0] = a2[1] = state->coeffs.a2;
@@ -164,13 +164,13 @@ void iir_process(struct qdsp_t * dsp)
         s1[1] = state->s[2];
         s2[1] = state->s[3];
         for (n=0; n<nframes; n++) {
-            x[0] = (double)dsp->inbufs[0][n];
-            x[1] = (double)dsp->inbufs[1][n];
+            x[0] = (double)inbuf0[n];
+            x[1] = (double)inbuf1[n];
             y  = s1 + b0 * x;
             s1 = s2 + b1 * x - a1 * y;
             s2 =      b2 * x - a2 * y;
-            dsp->outbufs[0][n] = (float)y[0];
-            dsp->outbufs[1][n] = (float)y[1];
+            outbuf0[n] = (float)y[0];
+            outbuf1[n] = (float)y[1];
         }
         state->s[0] = s1[0];
         state->s[1] = s2[0];
@@ -179,6 +179,36 @@ void iir_process(struct qdsp_t * dsp)
         break;
     }
 #endif
+    case 8:
+    {
+        /* two groups of four channels, one vector lane per channel */
+        v4df x[2],y[2],s1[2],s2[2],b0,b1,b2,a1,a2;
+        b0 = (v4df){0} + state->coeffs.b0;
+        b1 = (v4df){0} + state->coeffs.b1;
+        b2 = (v4df){0} + state->coeffs.b2;
+        a1 = (v4df){0} + state->coeffs.a1;
+        a2 = (v4df){0} + state->coeffs.a2;
+        for (c=0; c<8; c++) {
+            s1[c/4][c%4] = state->s[c*2];
+            s2[c/4][c%4] = state->s[c*2+1];
+        }
+        for (n=0; n<nframes; n++) {
+            for (c=0; c<8; c++)
+                x[c/4][c%4] = (double)dsp->inbufs[c][n];
+            for (c=0; c<2; c++) {
+                y[c]  = s1[c] + b0 * x[c];
+                s1[c] = s2[c] + b1 * x[c] - a1 * y[c];
+                s2[c] =         b2 * x[c] - a2 * y[c];
+            }
+            for (c=0; c<8; c++)
+                dsp->outbufs[c][n] = (float)y[c/4][c%4];
+        }
+        for (c=0; c<8; c++) {
+            state->s[c*2] = s1[c/4][c%4];
+            state->s[c*2+1] = s2[c/4][c%4];
+        }
+        break;
+    }
     default:
     {
         const float *inbuf;
@@ -192,6 +222,10 @@ void iir_process(struct qdsp_t * dsp)
         for (c=0; c<nchannels; c++) {
             inbuf = dsp->inbufs[c];
             outbuf = dsp->outbufs[c];
+            if (quiet >> c & 1) {
+                memset(outbuf, 0, nframes * sizeof(float));
+                continue;
+            }
             s1 = state->s[c*2];
             s2 = state->s[c*2+1];
             for (n=0; n<nframes; n++) {
@@ -208,11 +242,91 @@ void iir_process(struct qdsp_t * dsp)
     }
 }
 
+void iir_process(struct qdsp_t * dsp)
+{
+    iir_process_kernel(dsp, dsp->nchannels, dsp->nframes, false);
+}
+
+SPECIALISED_KERNELS(DEFINE_KERNEL, iir_process)
+KERNEL_TABLE(iir_process);
+
+int iir_codegen(struct qdsp_t * dsp, FILE * out, enum codegen_part part, int stage)
+{
+    struct qdsp_iir_state_t * state = (struct qdsp_iir_state_t *)dsp->state;
+
+    switch (part) {
+    case CODEGEN_DECL:
+        fprintf(out, "static double s%d_s[NCHANNELS][2];\n", stage);
+        break;
+    case CODEGEN_PRE:
+        fprintf(out, "        double s%d_s1 = s%d_s[c][0], s%d_s2 = s%d_s[c][1];\n", stage, stage, stage, stage);
+        break;
+    case CODEGEN_SAMPLE:
+        fprintf(out, "            {\n");
+        fprintf(out, "                double xd = x, y = s%d_s1 + %a * xd;\n", stage, state->coeffs.b0);
+        fprintf(out, "                s%d_s1 = s%d_s2 + %a * xd - %a * y;\n", stage, stage, state->coeffs.b1, state->coeffs.a1);
+        fprintf(out, "                s%d_s2 = %a * xd - %a * y;\n", stage, state->coeffs.b2, state->coeffs.a2);
+        fprintf(out, "                x = (float)y;\n");
+        fprintf(out, "            }\n");
+        break;
+    case CODEGEN_POST:
+        /* as iir_quiet, without the silence flags, which do not reach the compiled chain */
+        fprintf(out, "        if (fabs(s%d_s1) + fabs(s%d_s2) < %a) s%d_s1 = s%d_s2 = 0;\n", stage, stage, IIR_SILENCE, stage, stage);
+        fprintf(out, "        s%d_s[c][0] = s%d_s1;\n", stage, stage);
+        fprintf(out, "        s%d_s[c][1] = s%d_s2;\n", stage, stage);
+        break;
+    case CODEGEN_RESET:
+        fprintf(out, "    memset(s%d_s, 0, sizeof(s%d_s));\n", stage, stage);
+        break;
+    }
+    return 0;
+}
+
 void destroy_iir(struct qdsp_t * dsp)
 {
     free(dsp->state);
 }
 
+/* Samples until the zero input response from any unit state is below tolerance, at most max */
+unsigned int iir_decay(const struct coeffs_t * coeffs, double tolerance, unsigned int max)
+{
+    iirfp a1 = coeffs->a1;
+    iirfp a2 = coeffs->a2;
+    iirfp s1[2] = { 1, 0 };
+    iirfp s2[2] = { 0, 1 };
+    unsigned int n;
+
+    for (n = 0; n < max; n++) {
+        iirfp mag = 0;
+        for (int k = 0; k < 2; k++) {
+            iirfp y = s1[k];
+            s1[k] = s2[k] - a1 * y;
+            s2[k] =       - a2 * y;
+            mag = fmax(mag, fabs(y) + fabs(s1[k]) + fabs(s2[k]));
+        }
+        if (mag < tolerance)
+            break;
+    }
+    debugprint(2, "%s: %u samples\n", __func__, n);
+    return n;
+}
+
+/* At most 60 seconds */
+unsigned int iir_preroll(struct qdsp_t * dsp, double tolerance)
+{
+    struct qdsp_iir_state_t * state = (struct qdsp_iir_state_t *)dsp->state;
+    return iir_decay(&state->coeffs, tolerance, 60 * dsp->fs);
+}
+
+int clone_iir(struct qdsp_t * dsp, const struct qdsp_t * src)
+{
+    struct qdsp_iir_state_t * state = malloc(sizeof(struct qdsp_iir_state_t));
+    if (!state) return 1;
+    memcpy(state, src->state, sizeof(struct qdsp_iir_state_t));
+    dsp->state = (void*)state;
+    return 0;
+}
+
 int create_iir(struct qdsp_t * dsp, char ** subopts)
 {
     enum {
@@ -285,6 +399,7 @@ int create_iir(struct qdsp_t * dsp, char ** subopts)
 
     dsp->state = (void*)state;
     dsp->process = iir_process;
+    dsp->kernels = iir_process_kernels;
     state->gain = 0.0;
 
     debugprint(1, "%s subopts: %s\n", __func__, *subopts);
@@ -377,7 +492,10 @@ int create_iir(struct qdsp_t * dsp, char ** subopts)
     }
 
     dsp->init = init_iir;
+    dsp->clone = clone_iir;
+    dsp->preroll = iir_preroll;
     dsp->destroy = destroy_iir;
+    dsp->codegen = iir_codegen;
 
     return errfnd;
 }
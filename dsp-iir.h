@@ -0,0 +1,49 @@
+#ifndef DSP_IIR_H
+#define DSP_IIR_H
+
+#include "dsp.h"
+
+/*
+ * Biquad types and coefficients, shared with the stages that build on
+ * the iir sections, e.g. xover.
+ */
+typedef double iirfp;
+
+/* state magnitude under which silent input gives silence, -200 dBFS */
+#define IIR_SILENCE 1e-10
+
+enum iir_type {
+    DIRECT_OPT = 0,
+    LP2_OPT,
+    HP2_OPT,
+    LS2_OPT,
+    HS2_OPT,
+    LP1_OPT,
+    HP1_OPT,
+    LS1_OPT,
+    HS1_OPT,
+    PEQ_OPT,
+    LWT_OPT,
+    AP2_OPT,
+    AP1_OPT,
+};
+
+struct coeffs_t {
+    iirfp a1;
+    iirfp a2;
+    iirfp b0;
+    iirfp b1;
+    iirfp b2;
+};
+
+struct qdsp_iir_state_t {
+    enum iir_type type;
+    double f0,f1,q0,q1,gain;
+    struct coeffs_t coeffs __attribute__ ((aligned (16)));
+    iirfp s[2*NCHANNELS_MAX] __attribute__ ((aligned (16)));
+};
+
+int calc_coeffs(struct qdsp_iir_state_t * state, int fs);
+unsigned int iir_decay(const struct coeffs_t * coeffs, double tolerance, unsigned int max);
+
+#endif
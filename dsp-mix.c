@@ -0,0 +1,264 @@
+#define _XOPEN_SOURCE 500
+#include <getopt.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "dsp.h"
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#endif
+
+/*
+ * Output channel j is the sum over inputs i of matrix[j][i] * input i.
+ * Each output row keeps only its nonzero terms, so an output is a copy,
+ * a scaled copy, silence or a vectorised sum over the few inputs it uses,
+ * all in one pass over the period. The stage has as many outputs as the
+ * matrix has rows, which init_dsp passes on to the stages after it.
+ */
+struct mix_term_t {
+    int input;
+    float gain;
+};
+
+struct qdsp_mix_state_t {
+    int ninputs;
+    int noutputs;
+    float matrix[NCHANNELS_MAX][NCHANNELS_MAX];
+    int nterms[NCHANNELS_MAX];
+    struct mix_term_t terms[NCHANNELS_MAX][NCHANNELS_MAX];
+};
+
+static void scale_block(float * restrict out, const float * restrict in, int nframes, float gain)
+{
+    int n = 0;
+#if defined(__AVX__)
+    const __m256 g = _mm256_set1_ps(gain);
+    for (; n + 8 <= nframes; n += 8)
+        _mm256_storeu_ps(out + n, _mm256_mul_ps(g, _mm256_loadu_ps(in + n)));
+#endif
+    for (; n < nframes; n++)
+        out[n] = gain * in[n];
+}
+
+static void sum_block(float * restrict out, const float * const * in, const struct mix_term_t * terms,
+                      int nterms, int nframes)
+{
+    int n = 0, t;
+#if defined(__AVX__)
+    for (; n + 8 <= nframes; n += 8) {
+        __m256 y = _mm256_mul_ps(_mm256_set1_ps(terms[0].gain), _mm256_loadu_ps(in[terms[0].input] + n));
+        for (t = 1; t < nterms; t++)
+            y = _mm256_add_ps(y, _mm256_mul_ps(_mm256_set1_ps(terms[t].gain), _mm256_loadu_ps(in[terms[t].input] + n)));
+        _mm256_storeu_ps(out + n, y);
+    }
+#endif
+    for (; n < nframes; n++) {
+        float y = terms[0].gain * in[terms[0].input][n];
+        for (t = 1; t < nterms; t++)
+            y += terms[t].gain * in[terms[t].input][n];
+        out[n] = y;
+    }
+}
+
+void mix_process(struct qdsp_t * dsp)
+{
+    struct qdsp_mix_state_t * state = (struct qdsp_mix_state_t *)dsp->state;
+    const float * const * inbufs = (const float * const *)dsp->inbufs;
+    int j;
+
+    for (j=0; j<state->noutputs; j++) {
+        const struct mix_term_t * terms = state->terms[j];
+        float * outbuf = dsp->outbufs[j];
+        int t;
+
+        /* an output of silent inputs is silent */
+        for (t=0; t<state->nterms[j] && dsp->insilent[terms[t].input]; t++)
+            ;
+        dsp->outsilent[j] = t == state->nterms[j];
+        if (dsp->outsilent[j]) {
+            memset(outbuf, 0, dsp->nframes * sizeof(float));
+            continue;
+        }
+
+        switch (state->nterms[j]) {
+        case 1:
+            if (terms[0].gain == 1.0f)
+                memcpy(outbuf, inbufs[terms[0].input], dsp->nframes * sizeof(float));
+            else
+                scale_block(outbuf, inbufs[terms[0].input], dsp->nframes, terms[0].gain);
+            break;
+        default:
+            sum_block(outbuf, inbufs, terms, state->nterms[j], dsp->nframes);
+            break;
+        }
+    }
+}
+
+void mix_init(struct qdsp_t * dsp)
+{
+    struct qdsp_mix_state_t * state = (struct qdsp_mix_state_t *)dsp->state;
+
+    if (dsp->nchannels != state->ninputs) {
+        debugprint(0, "%s: The matrix has %d inputs, the chain has %d channels here\n", __func__,
+                   state->ninputs, dsp->nchannels);
+        endprogram("Could not initialise mix\n");
+    }
+    dsp->outchannels = state->noutputs;
+}
+
+void destroy_mix(struct qdsp_t * dsp)
+{
+    free(dsp->state);
+}
+
+unsigned int mix_preroll(struct qdsp_t * dsp, double tolerance)
+{
+    (void)dsp;
+    (void)tolerance;
+    return 0;
+}
+
+int clone_mix(struct qdsp_t * dsp, const struct qdsp_t * src)
+{
+    struct qdsp_mix_state_t * state = malloc(sizeof(struct qdsp_mix_state_t));
+    if (!state) return 1;
+    memcpy(state, src->state, sizeof(struct qdsp_mix_state_t));
+    dsp->state = (void*)state;
+    return 0;
+}
+
+/*
+ * Appends a row of gains from str, separated by sep or whitespace, to the
+ * matrix. Returns nonzero on a malformed row or one of another width.
+ */
+static int mix_add_row(struct qdsp_mix_state_t * state, const char * str, const char * sep)
+{
+    int n = 0;
+    char * end;
+
+    if (state->noutputs == NCHANNELS_MAX) {
+        debugprint(0, "%s: More than %d outputs\n", __func__, NCHANNELS_MAX);
+        return 1;
+    }
+    for (;;) {
+        str += strspn(str, " \t\r\n");
+        if (!*str)
+            break;
+        if (n == NCHANNELS_MAX) {
+            debugprint(0, "%s: More than %d inputs\n", __func__, NCHANNELS_MAX);
+            return 1;
+        }
+        state->matrix[state->noutputs][n++] = strtod(str, &end);
+        if (end == str) {
+            debugprint(0, "%s: Not a gain: %s\n", __func__, str);
+            return 1;
+        }
+        str = end + strspn(end, sep);
+    }
+    if (!n)
+        return 0;
+    if (state->ninputs && n != state->ninputs) {
+        debugprint(0, "%s: Row %d has %d gains, expected %d\n", __func__, state->noutputs + 1, n, state->ninputs);
+        return 1;
+    }
+    state->ninputs = n;
+    state->noutputs++;
+    return 0;
+}
+
+static int mix_read_matrix(struct qdsp_mix_state_t * state, const char * filename)
+{
+    char line[1024];
+    FILE * fid = fopen(filename, "r");
+    int err = 0;
+
+    if (!fid) {
+        debugprint(0, "%s: Unable to open file: %s\n", __func__, filename);
+        return 1;
+    }
+    while (!err && fgets(line, sizeof(line), fid))
+        err = mix_add_row(state, line, "");
+    fclose(fid);
+    return err;
+}
+
+int create_mix(struct qdsp_t * dsp, char ** subopts)
+{
+    enum {
+        MATRIX_OPT = 0,
+        FILE_OPT,
+    };
+    char *const token[] = {
+        [MATRIX_OPT]   = "m",
+        [FILE_OPT]   = "f",
+        NULL
+    };
+    char *value;
+    int errfnd = 0;
+    int i, j;
+    struct qdsp_mix_state_t * state = calloc(1, sizeof(struct qdsp_mix_state_t));
+    dsp->state = (void*)state;
+
+    debugprint(1, "%s subopts: %s\n", __func__, *subopts);
+    while (**subopts != '\0' && !errfnd) {
+        switch (getsubopt(subopts, token, &value)) {
+        case MATRIX_OPT:
+            if (value == NULL) {
+                debugprint(0, "%s: Missing value for suboption '%s'\n", __func__, token[MATRIX_OPT]);
+                errfnd = 1;
+                continue;
+            }
+            /* rows, one per output, separated by '/', gains by ':' */
+            for (char * row = strtok(value, "/"); row && !errfnd; row = strtok(NULL, "/"))
+                errfnd = mix_add_row(state, row, ":");
+            break;
+        case FILE_OPT:
+            if (value == NULL) {
+                debugprint(0, "%s: Missing value for suboption '%s'\n", __func__, token[FILE_OPT]);
+                errfnd = 1;
+                continue;
+            }
+            errfnd = mix_read_matrix(state, value);
+            break;
+        default:
+            debugprint(0, "%s: No match found for token: /%s/\n", __func__, value);
+            errfnd = 1;
+            break;
+        }
+    }
+    if (!errfnd && !state->noutputs) {
+        debugprint(0, "%s: No matrix given\n", __func__);
+        errfnd = 1;
+    }
+
+    for (j=0; j<state->noutputs; j++) {
+        for (i=0; i<state->ninputs; i++) {
+            if (state->matrix[j][i] != 0.0f) {
+                struct mix_term_t * term = &state->terms[j][state->nterms[j]++];
+                term->input = i;
+                term->gain = state->matrix[j][i];
+            }
+        }
+        debugprint(1, "%s: output %d sums %d inputs\n", __func__, j, state->nterms[j]);
+    }
+
+    dsp->process = mix_process;
+    dsp->init = mix_init;
+    dsp->clone = clone_mix;
+    dsp->preroll = mix_preroll;
+    dsp->destroy = destroy_mix;
+
+    return errfnd;
+}
+
+void help_mix(void)
+{
+    debugprint(0, "  Mix options\n");
+    debugprint(0, "    Name: mix\n");
+    debugprint(0, "        m = gain matrix (linear), one row per output separated by '/', gains per input by ':'\n");
+    debugprint(0, "        f = file with the gain matrix, one row per output, gains separated by whitespace\n");
+    debugprint(0, "    Example: -p mix,m=0.5:0.5/0.5:-0.5\n");
+    debugprint(0, "    Note: The chain continues with as many channels as the matrix has rows\n");
+}
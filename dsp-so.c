@@ -0,0 +1,117 @@
+#define _XOPEN_SOURCE 500
+#include <getopt.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dlfcn.h>
+#include "dsp.h"
+
+struct qdsp_so_state_t {
+    char * filename;
+    void * handle;
+    const int * nchannels;
+    const unsigned int * fs;
+    void (*chain_process)(const float * const *, float * const *, int);
+    void (*chain_reset)(void);
+};
+
+void so_process(struct qdsp_t * dsp)
+{
+    struct qdsp_so_state_t * state = (struct qdsp_so_state_t *)dsp->state;
+    state->chain_process((const float * const *)dsp->inbufs, (float * const *)dsp->outbufs, dsp->nframes);
+    clear_silent(dsp);
+}
+
+void so_init(struct qdsp_t * dsp)
+{
+    struct qdsp_so_state_t * state = (struct qdsp_so_state_t *)dsp->state;
+
+    /* coefficients and state sizes are compiled in */
+    if (*state->nchannels != dsp->nchannels || *state->fs != dsp->fs) {
+        debugprint(0, "%s: %s was generated for fs=%u, channels=%d\n", __func__, state->filename, *state->fs, *state->nchannels);
+        endprogram("Compiled chain does not match stream\n");
+    }
+    state->chain_reset();
+}
+
+void destroy_so(struct qdsp_t * dsp)
+{
+    struct qdsp_so_state_t * state = (struct qdsp_so_state_t *)dsp->state;
+    if (state->handle)
+        dlclose(state->handle);
+    free(state->filename);
+    free(state);
+}
+
+int create_so(struct qdsp_t * dsp, char ** subopts)
+{
+    enum {
+        FILE_OPT = 0,
+    };
+    char *const token[] = {
+        [FILE_OPT]   = "f",
+        NULL
+    };
+    char *value;
+    int errfnd = 0;
+    struct qdsp_so_state_t * state = malloc(sizeof(struct qdsp_so_state_t));
+    dsp->state = (void*)state;
+
+    // default values
+    state->filename = NULL;
+    state->handle = NULL;
+
+    debugprint(1, "%s subopts: %s\n", __func__, *subopts);
+    while (**subopts != '\0' && !errfnd) {
+        switch (getsubopt(subopts, token, &value)) {
+        case FILE_OPT:
+            if (value == NULL) {
+                debugprint(0, "%s: Missing value for suboption '%s'\n", __func__, token[FILE_OPT]);
+                errfnd = 1;
+                continue;
+            }
+            /* dlopen only searches the library path for names without a slash */
+            free(state->filename);
+            state->filename = malloc(strlen(value) + 3);
+            sprintf(state->filename, "%s%s", strchr(value, '/') ? "" : "./", value);
+            debugprint(1, "%s: filename=%s\n", __func__, state->filename);
+            break;
+        default:
+            debugprint(0, "%s: No match found for token: /%s/\n", __func__, value);
+            errfnd = 1;
+            break;
+        }
+    }
+    dsp->process = so_process;
+    dsp->init = so_init;
+    dsp->destroy = destroy_so;
+
+    if (errfnd || !state->filename)
+        return 1;
+
+    state->handle = dlopen(state->filename, RTLD_NOW | RTLD_LOCAL);
+    if (!state->handle) {
+        debugprint(0, "%s: %s\n", __func__, dlerror());
+        return 1;
+    }
+
+    state->nchannels = dlsym(state->handle, "qdsp_chain_nchannels");
+    state->fs = dlsym(state->handle, "qdsp_chain_fs");
+    *(void **)&state->chain_process = dlsym(state->handle, "qdsp_chain_process");
+    *(void **)&state->chain_reset = dlsym(state->handle, "qdsp_chain_reset");
+    if (!state->nchannels || !state->fs || !state->chain_process || !state->chain_reset) {
+        debugprint(0, "%s: %s is not a generated qdsp chain\n", __func__, state->filename);
+        return 1;
+    }
+
+    return errfnd;
+}
+
+void help_so(void)
+{
+    debugprint(0, "  Compiled chain options\n");
+    debugprint(0, "    Name: so\n");
+    debugprint(0, "        f = shared object built from a chain generated with -g\n");
+    debugprint(0, "    Example: -p so,f=chain.so\n");
+    debugprint(0, "    Note: Build with 'make chain.so', fs and channels must match the generated chain\n");
+}
@@ -0,0 +1,311 @@
+#define _XOPEN_SOURCE 500
+#include <getopt.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "dsp.h"
+#include "dsp-iir.h"
+
+/*
+ * Linkwitz-Riley crossover of 4th order. A split is two second order
+ * Butterworth lowpasses and two highpasses at its frequency, from the lp2
+ * and hp2 formulas of the iir stage. The input is split at the lowest
+ * frequency, the highpassed rest at the next one and so on. A band below
+ * a split also goes through the allpass, with the same poles, that the
+ * split adds to the bands above it, so the bands stay in phase and sum to
+ * an allpass. Band b of input channel c is output channel
+ * b * nchannels + c.
+ *
+ * All sections run in one pass over the period, sample by sample, each
+ * as one vector operation over the input channels. Those are at most
+ * XOVER_LANES, as the outputs are at most NCHANNELS_MAX.
+ */
+#define XOVER_SPLITS_MAX (NCHANNELS_MAX - 1)
+#define XOVER_LANES 4
+
+typedef double v4df __attribute__ ((vector_size (32)));
+
+struct xover_coeffs_t {
+    v4df b0, b1, b2, a1, a2;
+};
+
+struct xover_section_t {
+    v4df s1, s2;
+};
+
+struct qdsp_xover_state_t {
+    struct xover_section_t lp[XOVER_SPLITS_MAX][2];
+    struct xover_section_t hp[XOVER_SPLITS_MAX][2];
+    struct xover_section_t ap[XOVER_SPLITS_MAX][XOVER_SPLITS_MAX];  /* [band][split] */
+    struct xover_coeffs_t lpc[XOVER_SPLITS_MAX];
+    struct xover_coeffs_t hpc[XOVER_SPLITS_MAX];
+    struct xover_coeffs_t apc[XOVER_SPLITS_MAX];
+    struct coeffs_t coeffs[XOVER_SPLITS_MAX][3];    /* lowpass, highpass and allpass of each split */
+    int nsplits;
+    double freq[XOVER_SPLITS_MAX];
+};
+
+static inline __attribute__((always_inline))
+v4df xover_biquad(const struct xover_coeffs_t * c, struct xover_section_t * s, v4df x)
+{
+    const v4df y = s->s1 + c->b0 * x;
+    s->s1 = s->s2 + c->b1 * x - c->a1 * y;
+    s->s2 = c->b2 * x - c->a2 * y;
+    return y;
+}
+
+/* Constant nsplits unrolls the sections, so their state can stay in registers */
+static inline __attribute__((always_inline))
+void xover_kernel(struct qdsp_t * dsp, struct qdsp_xover_state_t * state, const int nsplits)
+{
+    const int nchannels = dsp->nchannels;
+    const int nframes = dsp->nframes;
+    struct xover_section_t lp[XOVER_SPLITS_MAX][2], hp[XOVER_SPLITS_MAX][2];
+    struct xover_section_t ap[XOVER_SPLITS_MAX][XOVER_SPLITS_MAX];
+    int c, k, j, n;
+
+    for (k=0; k<nsplits; k++) {
+        lp[k][0] = state->lp[k][0];
+        lp[k][1] = state->lp[k][1];
+        hp[k][0] = state->hp[k][0];
+        hp[k][1] = state->hp[k][1];
+        for (j=k+1; j<nsplits; j++)
+            ap[k][j] = state->ap[k][j];
+    }
+
+    for (n=0; n<nframes; n++) {
+        v4df rest = { 0 };
+        for (c=0; c<nchannels; c++)
+            rest[c] = dsp->inbufs[c][n];
+        for (k=0; k<nsplits; k++) {
+            v4df low = xover_biquad(&state->lpc[k], &lp[k][0], rest);
+            low = xover_biquad(&state->lpc[k], &lp[k][1], low);
+            rest = xover_biquad(&state->hpc[k], &hp[k][0], rest);
+            rest = xover_biquad(&state->hpc[k], &hp[k][1], rest);
+            for (j=k+1; j<nsplits; j++)
+                low = xover_biquad(&state->apc[j], &ap[k][j], low);
+            for (c=0; c<nchannels; c++)
+                dsp->outbufs[k * nchannels + c][n] = (float)low[c];
+        }
+        for (c=0; c<nchannels; c++)
+            dsp->outbufs[nsplits * nchannels + c][n] = (float)rest[c];
+    }
+
+    for (k=0; k<nsplits; k++) {
+        state->lp[k][0] = lp[k][0];
+        state->lp[k][1] = lp[k][1];
+        state->hp[k][0] = hp[k][0];
+        state->hp[k][1] = hp[k][1];
+        for (j=k+1; j<nsplits; j++)
+            state->ap[k][j] = ap[k][j];
+    }
+}
+
+/*
+ * Returns a bit mask of the input channels with silent input and decayed
+ * sections. Their lanes of the state are cleared, so they stay exactly
+ * silent and never decay into denormals, and their bands are flagged.
+ */
+static unsigned int xover_quiet(struct qdsp_t * dsp, struct qdsp_xover_state_t * state)
+{
+    /* lp, hp and ap are consecutive, unused sections stay zero */
+    struct xover_section_t * s = &state->lp[0][0];
+    const size_t nsections = (sizeof(state->lp) + sizeof(state->hp) + sizeof(state->ap)) / sizeof(*s);
+    unsigned int quiet = 0;
+    int c, b;
+
+    for (c=0; c<dsp->nchannels; c++) {
+        double mag = 0;
+        if (!dsp->insilent[c])
+            continue;
+        for (size_t i=0; i<nsections; i++)
+            mag += fabs(s[i].s1[c]) + fabs(s[i].s2[c]);
+        if (mag >= IIR_SILENCE)
+            continue;
+        for (size_t i=0; i<nsections; i++)
+            s[i].s1[c] = s[i].s2[c] = 0;
+        quiet |= 1u << c;
+    }
+    for (b=0; b<=state->nsplits; b++) {
+        for (c=0; c<dsp->nchannels; c++)
+            dsp->outsilent[b * dsp->nchannels + c] = quiet >> c & 1;
+    }
+    return quiet;
+}
+
+void xover_process(struct qdsp_t * dsp)
+{
+    struct qdsp_xover_state_t * state = (struct qdsp_xover_state_t *)dsp->state;
+
+    /* quiet lanes run along with the others, their zeros stay zeros */
+    if (xover_quiet(dsp, state) == (1u << dsp->nchannels) - 1) {
+        for (int i=0; i<dsp->outchannels; i++)
+            memset(dsp->outbufs[i], 0, dsp->nframes * sizeof(float));
+        return;
+    }
+
+    switch (state->nsplits) {
+    case 1:
+        xover_kernel(dsp, state, 1);
+        break;
+    case 2:
+        xover_kernel(dsp, state, 2);
+        break;
+    case 3:
+        xover_kernel(dsp, state, 3);
+        break;
+    default:
+        xover_kernel(dsp, state, state->nsplits);
+        break;
+    }
+}
+
+static void xover_broadcast(struct xover_coeffs_t * v, const struct coeffs_t * c)
+{
+    v->b0 = (v4df){0} + c->b0;
+    v->b1 = (v4df){0} + c->b1;
+    v->b2 = (v4df){0} + c->b2;
+    v->a1 = (v4df){0} + c->a1;
+    v->a2 = (v4df){0} + c->a2;
+}
+
+void xover_init(struct qdsp_t * dsp)
+{
+    struct qdsp_xover_state_t * state = (struct qdsp_xover_state_t *)dsp->state;
+    const enum iir_type types[3] = { LP2_OPT, HP2_OPT, AP2_OPT };
+    struct qdsp_iir_state_t iir;
+
+    dsp->outchannels = dsp->nchannels * (state->nsplits + 1);
+    if (dsp->outchannels > NCHANNELS_MAX) {
+        debugprint(0, "%s: %d bands of %d channels are more than %d channels\n", __func__,
+                   state->nsplits + 1, dsp->nchannels, NCHANNELS_MAX);
+        endprogram("Could not initialise xover\n");
+    }
+
+    memset(&iir, 0, sizeof(iir));
+    for (int k=0; k<state->nsplits; k++) {
+        if (state->freq[k] >= dsp->fs / 2.0) {
+            debugprint(0, "%s: %g Hz is above the Nyquist frequency\n", __func__, state->freq[k]);
+            endprogram("Could not initialise xover\n");
+        }
+        for (int t=0; t<3; t++) {
+            iir.type = types[t];
+            iir.f0 = state->freq[k];
+            iir.q0 = M_SQRT1_2;
+            calc_coeffs(&iir, dsp->fs);
+            state->coeffs[k][t] = iir.coeffs;
+        }
+        xover_broadcast(&state->lpc[k], &state->coeffs[k][0]);
+        xover_broadcast(&state->hpc[k], &state->coeffs[k][1]);
+        xover_broadcast(&state->apc[k], &state->coeffs[k][2]);
+    }
+    memset(state->lp, 0, sizeof(state->lp));
+    memset(state->hp, 0, sizeof(state->hp));
+    memset(state->ap, 0, sizeof(state->ap));
+}
+
+void destroy_xover(struct qdsp_t * dsp)
+{
+    free(dsp->state);
+}
+
+/* The decay of all sections in turn, an upper bound for the longest chain of them, at most 60 seconds */
+unsigned int xover_preroll(struct qdsp_t * dsp, double tolerance)
+{
+    struct qdsp_xover_state_t * state = (struct qdsp_xover_state_t *)dsp->state;
+    unsigned int max = 60 * dsp->fs;
+    unsigned long n = 0;
+
+    for (int k=0; k<state->nsplits; k++) {
+        n += 2 * iir_decay(&state->coeffs[k][0], tolerance, max);
+        n += 2 * iir_decay(&state->coeffs[k][1], tolerance, max);
+        n += k * iir_decay(&state->coeffs[k][2], tolerance, max);
+    }
+    return n < max ? n : max;
+}
+
+int clone_xover(struct qdsp_t * dsp, const struct qdsp_t * src)
+{
+    struct qdsp_xover_state_t * state = valloc(sizeof(struct qdsp_xover_state_t));
+    if (!state) return 1;
+    memcpy(state, src->state, sizeof(struct qdsp_xover_state_t));
+    dsp->state = (void*)state;
+    return 0;
+}
+
+int create_xover(struct qdsp_t * dsp, char ** subopts)
+{
+    enum {
+        FREQ_OPT = 0,
+    };
+    char *const token[] = {
+        [FREQ_OPT]   = "f",
+        NULL
+    };
+    char *value, *end;
+    int errfnd = 0;
+    /* valloc for the alignment of the vectors */
+    struct qdsp_xover_state_t * state = valloc(sizeof(struct qdsp_xover_state_t));
+    if (!state) endprogram("Could not allocate memory for xover.\n");
+    memset(state, 0, sizeof(struct qdsp_xover_state_t));
+    dsp->state = (void*)state;
+
+    debugprint(1, "%s subopts: %s\n", __func__, *subopts);
+    while (**subopts != '\0' && !errfnd) {
+        switch (getsubopt(subopts, token, &value)) {
+        case FREQ_OPT:
+            if (value == NULL) {
+                debugprint(0, "%s: Missing value for suboption '%s'\n", __func__, token[FREQ_OPT]);
+                errfnd = 1;
+                continue;
+            }
+            /* frequencies separated by ':' */
+            state->nsplits = 0;
+            while (*value && !errfnd) {
+                if (state->nsplits == XOVER_SPLITS_MAX) {
+                    debugprint(0, "%s: More than %d crossover frequencies\n", __func__, XOVER_SPLITS_MAX);
+                    errfnd = 1;
+                    break;
+                }
+                state->freq[state->nsplits] = strtod(value, &end);
+                if (end == value || (*end && *end != ':') || state->freq[state->nsplits] <= 0 ||
+                    (state->nsplits && state->freq[state->nsplits] <= state->freq[state->nsplits - 1])) {
+                    debugprint(0, "%s: Frequencies must be positive and rising: %s\n", __func__, value);
+                    errfnd = 1;
+                    break;
+                }
+                state->nsplits++;
+                value = *end ? end + 1 : end;
+            }
+            break;
+        default:
+            debugprint(0, "%s: No match found for token: /%s/\n", __func__, value);
+            errfnd = 1;
+            break;
+        }
+    }
+    if (!errfnd && !state->nsplits) {
+        debugprint(0, "%s: No crossover frequency given\n", __func__);
+        errfnd = 1;
+    }
+    debugprint(1, "%s: %d bands\n", __func__, state->nsplits + 1);
+
+    dsp->process = xover_process;
+    dsp->init = xover_init;
+    dsp->clone = clone_xover;
+    dsp->preroll = xover_preroll;
+    dsp->destroy = destroy_xover;
+
+    return errfnd;
+}
+
+void help_xover(void)
+{
+    debugprint(0, "  Crossover options\n");
+    debugprint(0, "    Name: xover\n");
+    debugprint(0, "        f = crossover frequencies (Hz), rising, separated by ':'\n");
+    debugprint(0, "    Example: -p xover,f=300:3000\n");
+    debugprint(0, "    Note: 4th order Linkwitz-Riley. The chain continues with one group of the input channels per band,\n");
+    debugprint(0, "          lowest band first, at most %d channels in all\n", NCHANNELS_MAX);
+}
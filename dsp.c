@@ -5,7 +5,6 @@
 #include <stdarg.h>
 #include <stdbool.h>
 #include <string.h>
-#include <float.h>
 #include "dsp.h"
 
 /*****************************************************************/
@@ -15,6 +14,10 @@ enum {
     GATE_OPT,
     IIR_OPT,
     FIR_OPT,
+    SO_OPT,
+    MIX_OPT,
+    COMP_OPT,
+    XOVER_OPT,
     END_OPT
 };
 
@@ -23,6 +26,10 @@ char *const token[] = {
     [GATE_OPT]   = "gate",
     [IIR_OPT]    = "iir",
     [FIR_OPT]    = "fir",
+    [SO_OPT]     = "so",
+    [MIX_OPT]    = "mix",
+    [COMP_OPT]   = "comp",
+    [XOVER_OPT]  = "xover",
     NULL
 };
 
@@ -30,17 +37,29 @@ extern int create_gate(struct qdsp_t * dsp, char ** subopts);
 extern int create_gain(struct qdsp_t * dsp, char ** subopts);
 extern int create_iir(struct qdsp_t * dsp, char ** subopts);
 extern int create_fir(struct qdsp_t * dsp, char ** subopts);
+extern int create_so(struct qdsp_t * dsp, char ** subopts);
+extern int create_mix(struct qdsp_t * dsp, char ** subopts);
+extern int create_comp(struct qdsp_t * dsp, char ** subopts);
+extern int create_xover(struct qdsp_t * dsp, char ** subopts);
 
 extern void help_gain(void);
 extern void help_gate(void);
 extern void help_iir(void);
 extern void help_fir(void);
+extern void help_so(void);
+extern void help_mix(void);
+extern void help_comp(void);
+extern void help_xover(void);
 
 struct dspfuncs_t dspfuncs[] = {
         [GAIN_OPT] = {.helpfunc = help_gain, .createfunc = create_gain },
         [GATE_OPT] = {.helpfunc = help_gate, .createfunc = create_gate },
         [IIR_OPT] = {.helpfunc = help_iir, .createfunc = create_iir },
         [FIR_OPT] = {.helpfunc = help_fir, .createfunc = create_fir },
+        [SO_OPT] = {.helpfunc = help_so, .createfunc = create_so },
+        [MIX_OPT] = {.helpfunc = help_mix, .createfunc = create_mix },
+        [COMP_OPT] = {.helpfunc = help_comp, .createfunc = create_comp },
+        [XOVER_OPT] = {.helpfunc = help_xover, .createfunc = create_xover },
         [END_OPT] = {.helpfunc = NULL, .createfunc = NULL },
 };
 /******************************************************************/
@@ -50,7 +69,16 @@ struct dspfuncs_t * get_dspfuncs(void)
     return dspfuncs;
 }
 
-float * pingbuf;
+/* Returns the matching specialised kernel, or the generic terminating entry */
+static const struct qdsp_kernel_t * select_kernel(const struct qdsp_kernel_t * kernels, int nchannels, int nframes)
+{
+    while (kernels->nchannels) {
+        if (kernels->nchannels == nchannels && kernels->nframes == nframes)
+            break;
+        kernels++;
+    }
+    return kernels;
+}
 
 void create_dsp(struct qdsp_t * dsp, char * subopts)
 {
@@ -60,6 +88,14 @@ void create_dsp(struct qdsp_t * dsp, char * subopts)
 
     debugprint(1, "create_dsp subopts: %s\n", subopts);
 
+    dsp->name = strdup(subopts);
+    dsp->pingbuf = NULL;
+    dsp->kernels = NULL;
+    dsp->clone = NULL;
+    dsp->preroll = NULL;
+    dsp->codegen = NULL;
+    dsp->control = NULL;
+
     while (*subopts != '\0' && !errfnd) {
         curtoken = getsubopt(&subopts, token, &value);
         if (curtoken >= 0 && curtoken < END_OPT) {
@@ -81,53 +117,166 @@ void create_dsp(struct qdsp_t * dsp, char * subopts)
 
 void init_dsp(struct qdsp_t * dsphead)
 {
-    float *zerobuf;
     bool ping = false;
     struct qdsp_t * dsp;
     int i;
-    float * pongbuf;
+    float * pingbuf, * pongbuf;
+    bool * silent;
     int nframes = dsphead->nframes;
     int nchannels = dsphead->nchannels;
+    int maxchannels = nchannels;
+
+    /* setup all static dsp list info, each stage gets the output channels of the one before */
+    for (dsp = dsphead; dsp; dsp = dsp->next) {
+        dsp->fs = dsphead->fs;
+        dsp->nchannels = nchannels;
+        dsp->outchannels = nchannels;
+        dsp->nframes = dsphead->nframes;
+
+        dsp->init(dsp);
+
+        if (dsp->kernels) {
+            const struct qdsp_kernel_t * kernel = select_kernel(dsp->kernels, dsp->nchannels, dsp->nframes);
+            dsp->process = kernel->process;
+            debugprint(2, "%s: dsp=%p, %s kernel\n", __func__, dsp, kernel->nchannels ? "specialised" : "generic");
+        }
+
+        nchannels = dsp->outchannels;
+        if (nchannels < 1 || nchannels > NCHANNELS_MAX) endprogram("Invalid number of channels in chain\n");
+        if (nchannels > maxchannels)
+            maxchannels = nchannels;
+    }
 
     /* allocate tempbuf as one large buffer */
-    free(pingbuf);
-    pingbuf = valloc((2 * nchannels + 1) * nframes * sizeof(float));
+    free(dsphead->pingbuf);
+    pingbuf = dsphead->pingbuf = valloc(2 * maxchannels * nframes * sizeof(float) + 3 * NCHANNELS_MAX * sizeof(bool));
     if (!pingbuf) endprogram("Could not allocate memory for temporary buffer.\n");
     /* Todo: Does realloc return NULL on fail? */
 
-    /* allocate a common zerobuf */
-    pongbuf = pingbuf + nchannels*nframes;
-    zerobuf = pingbuf + 2*nchannels*nframes;
-    for (i=0; i<nframes; i++)
-        zerobuf[i] = FLT_EPSILON;
+    pongbuf = pingbuf + maxchannels*nframes;
 
-    /* setup all static dsp list info */
-    dsp = dsphead;
-    while (dsp) {
-        dsp->fs = dsphead->fs;
-        dsp->nchannels = dsphead->nchannels;
-        dsp->nframes = dsphead->nframes;
-        dsp->zerobuf = zerobuf;
+    /*
+     * silence flags of the ping and pong buffers, the chain input is never flagged.
+     * Stages with state clear it once it has decayed on silent input, so it never
+     * reaches denormals.
+     */
+    silent = (bool *)(pongbuf + maxchannels*nframes);
+    memset(silent, 0, 3 * NCHANNELS_MAX * sizeof(bool));
 
-        for (i=0; i<dsp->nchannels; i++) {
+    for (dsp = dsphead; dsp; dsp = dsp->next) {
+        dsp->insilent = dsp == dsphead ? silent + 2 * NCHANNELS_MAX : ping ? silent : silent + NCHANNELS_MAX;
+        dsp->outsilent = ping ? silent + NCHANNELS_MAX : silent;
+        for (i=0; i<dsp->nchannels; i++)
             dsp->inbufs[i] = ping ? pingbuf + i*nframes : pongbuf + i*nframes;
+        for (i=0; i<dsp->outchannels; i++)
             dsp->outbufs[i] = ping ? pongbuf + i*nframes : pingbuf + i*nframes;
+        ping = !ping;
+    }
+}
+
+/* Channels out of the last stage, valid after init_dsp */
+int outchannels_dsp(const struct qdsp_t * dsphead)
+{
+    const struct qdsp_t * dsp = dsphead;
+    while (dsp->next)
+        dsp = dsp->next;
+    return dsp->outchannels;
+}
+
+/* Channels at the widest point of the chain, which sizes the ping and pong buffers, valid after init_dsp */
+int maxchannels_dsp(const struct qdsp_t * dsphead)
+{
+    int maxchannels = dsphead->nchannels;
+    for (const struct qdsp_t * dsp = dsphead; dsp; dsp = dsp->next) {
+        if (dsp->outchannels > maxchannels)
+            maxchannels = dsp->outchannels;
+    }
+    return maxchannels;
+}
+
+/*
+ * Copies a created chain for use on another thread. Each stage's clone
+ * function gives the copy its own processing state while sharing data that
+ * is immutable after create, so the original must outlive its clones.
+ * The copy needs init_dsp() before use.
+ */
+struct qdsp_t * clone_dsp(const struct qdsp_t * dsphead)
+{
+    const struct qdsp_t * src;
+    struct qdsp_t * head = NULL, * dsp = NULL;
+
+    for (src = dsphead; src; src = src->next) {
+        struct qdsp_t * copy = malloc(sizeof(struct qdsp_t));
+        if (!copy) endprogram("Could not allocate memory for dsp.\n");
+        memcpy(copy, src, sizeof(struct qdsp_t));
+        copy->next = NULL;
+        copy->pingbuf = NULL;
+        copy->sequencecount = 0;
+        copy->name = strdup(src->name);
+        if (!src->clone || src->clone(copy, src)) {
+            debugprint(0, "%s: %s can not be cloned\n", __func__, src->name);
+            endprogram("Could not clone dsp\n");
         }
+        if (dsp) dsp->next = copy; else head = copy;
+        dsp = copy;
+    }
+    return head;
+}
 
-        dsp->init(dsp);
+/*
+ * Frames of preceding input an initialised chain needs to reach the state
+ * of an uninterrupted run, to within tolerance of full scale for stages
+ * with infinite memory. -1 if a stage can not tell.
+ */
+long preroll_dsp(struct qdsp_t * dsphead, double tolerance)
+{
+    struct qdsp_t * dsp;
+    long frames = 0;
+
+    for (dsp = dsphead; dsp; dsp = dsp->next) {
+        if (!dsp->preroll) {
+            debugprint(0, "%s: %s has no preroll\n", __func__, dsp->name);
+            return -1;
+        }
+        frames += dsp->preroll(dsp, tolerance);
+    }
+    return frames;
+}
 
+/*
+ * Changes options of a stage while the chain runs, stages are numbered
+ * from 0 in chain order. Stages take runtime options in their control
+ * function, which may be called from any thread while another one
+ * processes the chain. Returns nonzero if there is no such stage, it has
+ * no runtime options or it rejects subopts.
+ */
+int control_dsp(struct qdsp_t * dsphead, int stage, char * subopts)
+{
+    struct qdsp_t * dsp = dsphead;
+    int i;
+
+    for (i = 0; dsp && i < stage; i++)
         dsp = dsp->next;
-        ping = !ping;
+    if (!dsp || stage < 0) {
+        debugprint(0, "%s: No stage %d\n", __func__, stage);
+        return 1;
+    }
+    if (!dsp->control) {
+        debugprint(0, "%s: %s has no runtime options\n", __func__, dsp->name);
+        return 1;
     }
+    return dsp->control(dsp, subopts);
 }
 
 void destroy_dsp(struct qdsp_t * dsphead)
 {
     struct qdsp_t * dsp;
+    float * pingbuf = dsphead ? dsphead->pingbuf : NULL;
     while (dsphead) {
         dsp = dsphead;
         dsphead = dsp->next;
         dsp->destroy(dsp);
+        free(dsp->name);
         free(dsp);
     }
     free(pingbuf);
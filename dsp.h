@@ -1,22 +1,42 @@
+#ifndef DSP_H
+#define DSP_H
 
 #include <stdio.h>
 #include <stdbool.h>
 
 #define NCHANNELS_MAX 8
 
+/* Sections of the generated source each stage contributes to, see codegen.c */
+enum codegen_part {
+    CODEGEN_DECL = 0,   /* file scope constants and state */
+    CODEGEN_PRE,        /* per channel, before the frame loop */
+    CODEGEN_SAMPLE,     /* per frame, transforms float x in place */
+    CODEGEN_POST,       /* per channel, after the frame loop */
+    CODEGEN_RESET,      /* body of qdsp_chain_reset() */
+};
+
 struct qdsp_t {
     struct qdsp_t *next;
     const float * restrict inbufs[NCHANNELS_MAX];
     float * restrict outbufs[NCHANNELS_MAX];
-    const float * restrict zerobuf;
+    const bool * insilent;      /* per input channel, the stage before wrote a period of zeros */
+    bool * outsilent;           /* per output channel, set by process each period */
     unsigned int fs;
     int nchannels;
+    int outchannels;            /* nchannels unless the stage's init changes it */
     int nframes;
     unsigned int sequencecount;
+    char *name;
+    float *pingbuf;             /* ping, pong and zero buffers, owned by the chain head */
     void *state;
+    const struct qdsp_kernel_t * kernels;
     void (*process)(struct qdsp_t *);
     void (*init)(struct qdsp_t *);
     void (*destroy)(struct qdsp_t *);
+    int (*clone)(struct qdsp_t *, const struct qdsp_t *);
+    unsigned int (*preroll)(struct qdsp_t *, double);
+    int (*codegen)(struct qdsp_t *, FILE *, enum codegen_part, int);
+    int (*control)(struct qdsp_t *, char *);
 };
 
 struct dspfuncs_t {
@@ -24,9 +44,73 @@ struct dspfuncs_t {
         int (*createfunc)(struct qdsp_t *, char **);
 };
 
+/*
+ * Compile-time specialised kernels.
+ * A dsp type writes its process function as an always-inlined
+ * <name>_kernel(dsp, nchannels, nframes, aligned) and instantiates it with
+ * SPECIALISED_KERNELS(DEFINE_KERNEL, <name>) and KERNEL_TABLE(<name>).
+ * init_dsp then binds the variant matching the current channel count and
+ * period size, or the generic <name> function for any other combination.
+ */
+struct qdsp_kernel_t {
+    int nchannels;
+    int nframes;
+    void (*process)(struct qdsp_t *);
+};
+
+#define SPECIALISED_KERNELS(X, name) \
+    X(name, 2, 64) X(name, 2, 128) X(name, 2, 256) \
+    X(name, 8, 64) X(name, 8, 128) X(name, 8, 256)
+
+#define KERNEL_ALIGN 32
+#define ASSUME_ALIGNED(ptr, aligned) \
+    ((aligned) ? (__typeof__(ptr))__builtin_assume_aligned((ptr), KERNEL_ALIGN) : (ptr))
+
+/*
+ * Stages flag outputs that are all zeros so the stages after them can skip
+ * the work, or run only until their memory of earlier input has decayed.
+ * A stage that does not track silence clears the flags of all its outputs.
+ */
+static inline void clear_silent(struct qdsp_t * dsp)
+{
+    for (int i=0; i<dsp->outchannels; i++)
+        dsp->outsilent[i] = false;
+}
+
+static inline bool buffers_aligned(const struct qdsp_t * dsp, int nchannels)
+{
+    unsigned long bits = 0;
+    for (int i=0; i<nchannels; i++)
+        bits |= (unsigned long)dsp->inbufs[i] | (unsigned long)dsp->outbufs[i];
+    return !(bits & (KERNEL_ALIGN - 1));
+}
+
+/* Specialised variants only run on aligned buffers of the expected size */
+#define DEFINE_KERNEL(name, nch, nfr) \
+static void name##_##nch##_##nfr(struct qdsp_t * dsp) \
+{ \
+    if (dsp->nframes == nfr && buffers_aligned(dsp, nch)) \
+        name##_kernel(dsp, nch, nfr, true); \
+    else \
+        name(dsp); \
+}
+
+#define KERNEL_ENTRY(name, nch, nfr) { nch, nfr, name##_##nch##_##nfr },
+#define KERNEL_TABLE(name) \
+static const struct qdsp_kernel_t name##_kernels[] = { \
+    SPECIALISED_KERNELS(KERNEL_ENTRY, name) \
+    { 0, 0, name } \
+}
+
 void create_dsp(struct qdsp_t * dsp, char * subopts);
 void init_dsp(struct qdsp_t * dsphead);
+struct qdsp_t * clone_dsp(const struct qdsp_t * dsphead);
+long preroll_dsp(struct qdsp_t * dsphead, double tolerance);
 void destroy_dsp(struct qdsp_t * dsphead);
+int codegen_dsp(struct qdsp_t * dsphead, FILE * out);
+int control_dsp(struct qdsp_t * dsphead, int stage, char * subopts);
+int outchannels_dsp(const struct qdsp_t * dsphead);
+int maxchannels_dsp(const struct qdsp_t * dsphead);
 void endprogram(char * str);
 void debugprint(int level, const char * fmt, ...);
 int get_debuglevel(void);
@@ -56,4 +140,4 @@ struct dspfuncs_t * get_dspfuncs(void);
 #define DEBUG3(...)
 #endif
 
-
+#endif
@@ -4,13 +4,29 @@
 #include <errno.h>
 #include <unistd.h>
 #include <stdlib.h>
+#include <stdarg.h>
 #include <string.h>
 #include <signal.h>
 #include <sndfile.h>
 #include <stdbool.h>
 #include <time.h>
 #include <fenv.h>
+#include <math.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <sys/socket.h>
+#include <sys/un.h>
 #include "dsp.h"
+#include "trace.h"
+#include "profile.h"
+#include "interleave.h"
+#include "mapfile.h"
+#include "quantize.h"
+
+volatile sig_atomic_t trace_requested;
+static char * trace_filename;
+static struct profile_t * profile;
+static enum dither_type dither = DITHER_TPDF;
 
 int debuglevel;
 int get_debuglevel(void)
@@ -23,7 +39,9 @@ struct qdsp_t * process (unsigned int nframes, void *arg)
     struct qdsp_t * dsphead = (struct qdsp_t *)arg;
     struct qdsp_t * dsp = dsphead;
     struct qdsp_t * lastdsp = dsp;
+    int stage = 0;
 
+    trace_begin("period");
     while (dsp)
     {
         if (dsp->sequencecount == 0) {
@@ -32,10 +50,16 @@ struct qdsp_t * process (unsigned int nframes, void *arg)
 
         dsp->nframes = nframes;
         dsp->sequencecount++;
+        trace_begin(dsp->name);
+        if (profile) profile_begin(profile, stage);
         dsp->process((void*)dsp);
+        if (profile) profile_end(profile, stage);
+        trace_end(dsp->name);
+        stage++;
         lastdsp = dsp;
         dsp = dsp->next;
     }
+    trace_end("period");
 
     return lastdsp;
 }
@@ -43,12 +67,28 @@ struct qdsp_t * process (unsigned int nframes, void *arg)
 void print_help()
 {
     int i=0;
-    debugprint(0, "file-qdsp -i inputfile -o outputfile [general-options] -p dsp-name <dsp-options> [-p ...]\n\n");
+    debugprint(0, "file-qdsp -i inputfile -o outputfile [general-options] -p dsp-name <dsp-options> [-p ...]\n");
+    debugprint(0, "file-qdsp -b batchfile [-j workers] [general-options] -p dsp-name <dsp-options> [-p ...]\n");
+    debugprint(0, "file-qdsp -L socket [-j workers] [general-options] -p dsp-name <dsp-options> [-p ...]\n\n");
     debugprint(0, "Version: %s\n", VERSION);
     debugprint(0, "General options\n");
     debugprint(0, " -i input filename, all types supported by libsndfile, - for stdin\n");
     debugprint(0, " -o output filename, all types supported by libsndfile, - for stdout\n");
-    debugprint(0, " -n framesize in samples, default=1024, must be a power-of-two\n");
+    debugprint(0, " -n framesize the chain runs at in samples, default=1024, must be a power-of-two,\n");
+    debugprint(0, "    auto to fit the chain's buffers in the L1 data cache\n");
+    debugprint(0, " -c frames read and written at a time, default=65536, rounded up to whole framesizes\n");
+    debugprint(0, " -d dither for 8 to 32 bit PCM output, none, tpdf or shaped, default=tpdf\n");
+    debugprint(0, " -g write the chain as C source to filename, see dsp 'so'\n");
+    debugprint(0, " -T write a Chrome/Perfetto trace to filename on exit and on SIGUSR1\n");
+    debugprint(0, " -P, --profile print per stage hardware performance counters at exit,\n");
+    debugprint(0, "    of the processing thread only, without stages' work on OpenMP threads\n");
+    debugprint(0, " -b batch mode, process the input output filename pairs listed in filename, one pair per line\n");
+    debugprint(0, " -L serve \"file <input> <output>\" requests, or input and output descriptors passed with\n");
+    debugprint(0, "    an \"fd\" request, on a Unix seqpacket socket at filename. \"control <stage> <options>\"\n");
+    debugprint(0, "    changes runtime options of a stage, counted from 0\n");
+    debugprint(0, " -j number of batch, segment or server workers, default is the number of CPUs\n");
+    debugprint(0, " -S process the input in segments of this many seconds in parallel\n");
+    debugprint(0, " -E largest difference from a serial run allowed at segment seams, default=1e-6\n");
     debugprint(0, " -r raw file options:\n");
     debugprint(0, "    c=channels\n    r=samplerate in Hz\n    f=format 1=S8,2=S16,3=S24,4=S32,5=U8,6=F32\n");
     debugprint(0, "\nDSP options\n");
@@ -64,6 +104,10 @@ void print_help()
 
 void sig_handler(int signo)
 {
+    if (signo == SIGUSR1) {
+        trace_requested = 1;
+        return;
+    }
     debugprint(0, "sig_handler\n");
     if (signo == SIGINT) {
         debugprint(0, "received SIGINT\n");
@@ -97,24 +141,104 @@ struct timespec timespecadd(struct timespec start, struct timespec end)
     return temp;
 }
 
-void deinterleave(float * restrict dst, float * restrict src, int nch, int nfr)
+/*
+ * Decoding and encoding run on their own threads so file I/O overlaps with
+ * processing. Blocks travel around a fixed ring, reader -> process ->
+ * writer -> reader. Each thread owns its ring index and the semaphores
+ * count the blocks handed over, so there are no locks around the ring.
+ * A block with nframes 0 marks the end of the input.
+ */
+#define PIPELINE_BLOCKS 8
+
+struct block_t {
+    float * buf;                    /* interleaved, nframes * channels */
+    float * out;                    /* processed, buf unless there are more output channels */
+    unsigned int nframes;
+};
+
+struct pipeline_t {
+    SNDFILE * input_file;
+    SNDFILE * output_file;
+    unsigned int nframes;
+    struct quantizer_t * quantizer; /* PCM output, NULL to write floats */
+    int32_t * intbuf;
+    struct block_t block[PIPELINE_BLOCKS];
+    sem_t free;
+    sem_t filled;
+    sem_t processed;
+    int write_failed;
+};
+
+static void sem_wait_intr(sem_t * sem)
+{
+    while (sem_wait(sem) && errno == EINTR)
+        ;
+}
+
+void * reader_thread(void * arg)
 {
-    int c,n;
-    for (c=0; c<nch; c++) {
-        for (n=0; n<nfr; n++) {
-            dst[c*nfr+n] = src[n*nch+c];
-        }
+    struct pipeline_t * pl = (struct pipeline_t *)arg;
+    unsigned int r = 0;
+
+    trace_thread_name("reader");
+    for (;;) {
+        struct block_t * block = &pl->block[r++ % PIPELINE_BLOCKS];
+        sem_wait_intr(&pl->free);
+        trace_begin("read");
+        if (__atomic_load_n(&pl->write_failed, __ATOMIC_RELAXED))
+            block->nframes = 0;
+        else
+            block->nframes = sf_readf_float(pl->input_file, block->buf, pl->nframes);
+        trace_end("read");
+        sem_post(&pl->filled);
+        if (!block->nframes)
+            break;
     }
+    return NULL;
 }
 
-void interleave(float * restrict dst, float * restrict src, int nch, int nfr)
+void * writer_thread(void * arg)
 {
-    int c,n;
-    for (c=0; c<nch; c++) {
-        for (n=0; n<nfr; n++) {
-            dst[n*nch+c] = src[c*nfr+n];
+    struct pipeline_t * pl = (struct pipeline_t *)arg;
+    unsigned int w = 0;
+
+    trace_thread_name("writer");
+    for (;;) {
+        struct block_t * block = &pl->block[w++ % PIPELINE_BLOCKS];
+        sem_wait_intr(&pl->processed);
+        if (!block->nframes)
+            break;
+        if (!__atomic_load_n(&pl->write_failed, __ATOMIC_RELAXED)) {
+            sf_count_t written;
+            trace_begin("write");
+            if (pl->quantizer) {
+                quantize(pl->quantizer, pl->intbuf, block->out, block->nframes);
+                written = sf_writef_int(pl->output_file, pl->intbuf, block->nframes);
+            }
+            else
+                written = sf_writef_float(pl->output_file, block->out, block->nframes);
+            if (block->nframes != written) {
+                debugprint(0, "Failed writing output: %s\n", sf_strerror(pl->output_file));
+                __atomic_store_n(&pl->write_failed, 1, __ATOMIC_RELAXED);
+            }
+            trace_end("write");
         }
+        sem_post(&pl->free);
+    }
+    return NULL;
+}
+
+void write_codegen(struct qdsp_t * dsphead, char * filename)
+{
+    FILE * fid = fopen(filename, "w");
+    if (!fid) {
+        debugprint(0, "Could not open file %s for writing.\n", filename);
+        endprogram("");
     }
+    if (codegen_dsp(dsphead, fid))
+        endprogram("Could not generate code for chain\n");
+    fclose(fid);
+    debugprint(0, "Wrote chain source to %s\n", filename);
 }
 
 bool get_rawfileopts(SF_INFO * input_sfinfo, char * subopts)
@@ -184,25 +308,930 @@ bool get_rawfileopts(SF_INFO * input_sfinfo, char * subopts)
     return !errfnd;
 }
 
-int main (int argc, char *argv[])
+/*
+ * Converts and processes nframes interleaved frames from src to dst, running
+ * the chain once per tile of tileframes. nframes is a multiple of tileframes.
+ * dst can be src unless the chain has more output than input channels.
+ */
+void process_block(struct qdsp_t * dsphead, float * dst, const float * src, unsigned int channels,
+                   unsigned int outchannels, unsigned int nframes, unsigned int tileframes, struct timespec * ttot)
+{
+    struct qdsp_t * dsp;
+    struct timespec t,t2;
+    unsigned int pos;
+    int raised;
+
+    for (pos = 0; pos < nframes; pos += tileframes) {
+        debugprint(3, "inbufs=%p\n", dsphead->inbufs[0]);
+
+        deinterleave((float*)dsphead->inbufs[0], src + pos * channels, channels, tileframes);
+
+        feclearexcept(FE_ALL_EXCEPT);
+        clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t);
+
+        dsp = process(tileframes, dsphead);
+
+        clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t2); t = timespecsub(t,t2); *ttot = timespecadd(t,*ttot);
+        raised = fetestexcept(FE_INEXACT | FE_DIVBYZERO | FE_UNDERFLOW | FE_OVERFLOW | FE_INVALID);
+        if (raised) debugprint(3, "FE exception raised: 0x%02X\n", raised);
+
+        debugprint(3, "outbufs=%p\n", dsp->outbufs[0]);
+
+        interleave(dst + pos * outchannels, dsp->outbufs[0], outchannels, tileframes);
+    }
+
+    if (trace_requested) {
+        trace_requested = 0;
+        trace_write(trace_filename);
+    }
+}
+
+/*
+ * Processing with decoding and encoding on the pipeline threads, which
+ * transfer chunks of chunkframes. The writer converts to integers with
+ * quantizer, if given. Returns the number of frames processed.
+ */
+unsigned int run_pipeline(struct qdsp_t * dsphead, SNDFILE * input_file, SNDFILE * output_file,
+                          struct quantizer_t * quantizer, unsigned int channels, unsigned int outchannels,
+                          unsigned int chunkframes, unsigned int tileframes, struct timespec * ttot)
+{
+    struct pipeline_t pl;
+    pthread_t reader, writer;
+    unsigned int totframes=0, p=0;
+    int i;
+
+    pl.input_file = input_file;
+    pl.output_file = output_file;
+    pl.nframes = chunkframes;
+    pl.quantizer = quantizer;
+    pl.intbuf = NULL;
+    if (quantizer && !(pl.intbuf = malloc(chunkframes*outchannels*sizeof(int32_t))))
+        endprogram("Could not allocate memory for file buffers.\n");
+    pl.write_failed = 0;
+    for (i = 0; i < PIPELINE_BLOCKS; i++) {
+        pl.block[i].buf = malloc(chunkframes*channels*sizeof(float));
+        pl.block[i].out = outchannels > channels ? malloc(chunkframes*outchannels*sizeof(float)) : pl.block[i].buf;
+        if (!pl.block[i].buf || !pl.block[i].out) endprogram("Could not allocate memory for file buffers.\n");
+    }
+    if (sem_init(&pl.free, 0, PIPELINE_BLOCKS) || sem_init(&pl.filled, 0, 0) || sem_init(&pl.processed, 0, 0))
+        endprogram("Could not create pipeline semaphores\n");
+
+    if (pthread_create(&reader, NULL, reader_thread, &pl) || pthread_create(&writer, NULL, writer_thread, &pl))
+        endprogram("Could not create file I/O threads\n");
+
+    for (;;) {
+        struct block_t * block = &pl.block[p++ % PIPELINE_BLOCKS];
+        unsigned int nframes;
+
+        sem_wait_intr(&pl.filled);
+        if (!block->nframes) {
+            sem_post(&pl.processed);
+            break;
+        }
+        /* the last chunk is zero padded to whole tiles */
+        nframes = (block->nframes + tileframes - 1) & ~(tileframes - 1);
+        if (block->nframes < nframes) {
+            memset(block->buf + (block->nframes * channels), 0, (nframes-block->nframes) * channels * sizeof(float));
+        }
+        totframes += nframes;
+
+        process_block(dsphead, block->out, block->buf, channels, outchannels, nframes, tileframes, ttot);
+        sem_post(&pl.processed);
+    }
+    pthread_join(reader, NULL);
+    pthread_join(writer, NULL);
+
+    sem_destroy(&pl.free);
+    sem_destroy(&pl.filled);
+    sem_destroy(&pl.processed);
+    for (i = 0; i < PIPELINE_BLOCKS; i++) {
+        if (pl.block[i].out != pl.block[i].buf)
+            free(pl.block[i].out);
+        free(pl.block[i].buf);
+    }
+    free(pl.intbuf);
+
+    return totframes;
+}
+
+/* Processing straight between the input and output mappings, returns the number of frames processed */
+unsigned int run_mapped(struct qdsp_t * dsphead, struct mapfile_t * input, struct mapfile_t * output,
+                        unsigned int channels, unsigned int outchannels, unsigned int nframes, struct timespec * ttot)
+{
+    float * tail = malloc(nframes*(channels > outchannels ? channels : outchannels)*sizeof(float));
+    unsigned int totframes=0;
+    sf_count_t pos;
+
+    if (!tail) endprogram("Could not allocate memory for file buffers.\n");
+
+    for (pos = 0; pos < input->frames; pos += nframes) {
+        const float * src = input->data + pos * channels;
+        float * dst = output->data + pos * outchannels;
+        sf_count_t n = input->frames - pos;
+
+        totframes += nframes;
+        if (n >= nframes) {
+            process_block(dsphead, dst, src, channels, outchannels, nframes, nframes, ttot);
+            continue;
+        }
+        /* the last partial block goes through a zero padded buffer */
+        memcpy(tail, src, n * channels * sizeof(float));
+        memset(tail + n * channels, 0, (nframes - n) * channels * sizeof(float));
+        process_block(dsphead, tail, tail, channels, outchannels, nframes, nframes, ttot);
+        memcpy(dst, tail, n * outchannels * sizeof(float));
+    }
+
+    free(tail);
+    return totframes;
+}
+
+/*
+ * Largest power of two tile whose working set fits in half the L1 data
+ * cache: the ping and pong buffers, sized for the widest point of the
+ * chain, and the tile's share of the input and output blocks. Valid after
+ * init_dsp, as stages like mix and xover change the number of channels.
+ */
+unsigned int auto_framesize(const struct qdsp_t * dsphead)
+{
+    const size_t width = 2 * maxchannels_dsp(dsphead) + dsphead->nchannels + outchannels_dsp(dsphead);
+    long cache = sysconf(_SC_LEVEL1_DCACHE_SIZE);
+    unsigned int nframes = 64;
+
+    if (cache <= 0) {
+        /* guess from the L2 size, or assume a common 32 KiB L1 */
+        cache = sysconf(_SC_LEVEL2_CACHE_SIZE);
+        cache = cache > 0 ? cache / 16 : 32768;
+    }
+    /* double while the doubled tile still fits */
+    while (nframes < 4096 && width * 2 * nframes * sizeof(float) <= (size_t)cache / 2)
+        nframes *= 2;
+    return nframes;
+}
+
+/* Initialises the chain at a tile of nframes, or at the automatic size if 0, and returns the tile */
+static unsigned int init_tiled(struct qdsp_t * dsphead, unsigned int fs, int channels, unsigned int nframes)
+{
+    dsphead->fs = fs;
+    dsphead->nchannels = channels;
+    dsphead->nframes = nframes ? nframes : 64;
+    init_dsp(dsphead);
+    if (!nframes && (nframes = auto_framesize(dsphead)) != (unsigned int)dsphead->nframes) {
+        dsphead->nframes = nframes;
+        init_dsp(dsphead);
+    }
+    return dsphead->nframes;
+}
+
+/*
+ * Runs one file through the chain, which is initialised for the file's
+ * format first. nframes is the tile size the chain runs at, 0 to size it
+ * from the cache, and chunkframes the number of frames read and written
+ * at a time, rounded up to whole tiles. Native float32 files are processed through memory
+ * mappings, everything else through libsndfile on the pipeline threads.
+ * Messages about the file are printed at debug level infolevel. Returns
+ * false if the file could not be opened or has an unsupported format.
+ */
+bool process_file(struct qdsp_t * dsphead, const SF_INFO * raw_sfinfo, unsigned int nframes,
+                  unsigned int chunkframes, const char * input_filename, const char * output_filename,
+                  const char * codegen_filename, int infolevel, unsigned long long * samples)
 {
     SNDFILE *input_file = NULL;
     SNDFILE *output_file = NULL;
     SF_INFO input_sfinfo;
     SF_INFO output_sfinfo;
+    struct mapfile_t input_map, output_map;
+    struct quantizer_t quantizer;
+    bool mapped = false;
+    int bits;
+    unsigned int totframes=0;
+    struct timespec ttot,res,wall,wall2;
+    unsigned int channels, outchannels;
+
+    memcpy(&input_sfinfo, raw_sfinfo, sizeof(input_sfinfo));
+    if (!(input_file = sf_open(input_filename, SFM_READ, &input_sfinfo))) {
+        debugprint(0, "Could not open file %s for reading.\n", input_filename);
+        return false;
+    }
+
+    /* get the current samplerate. */
+    debugprint(infolevel,  "input file samplerate: %d\n", input_sfinfo.samplerate);
+    debugprint(infolevel,  "input file channels: %d\n", input_sfinfo.channels);
+    channels = input_sfinfo.channels;
+    if (channels < 1 || channels > NCHANNELS_MAX) {
+        debugprint(0, "Invalid number of channels in %s\n", input_filename);
+        sf_close(input_file);
+        return false;
+    }
+
+    /* the chain decides the number of output channels */
+    nframes = init_tiled(dsphead, input_sfinfo.samplerate, channels, nframes);
+    outchannels = outchannels_dsp(dsphead);
+    /* short clips do not need the full pipeline blocks */
+    if (input_sfinfo.frames > 0 && (sf_count_t)chunkframes > input_sfinfo.frames)
+        chunkframes = input_sfinfo.frames;
+    chunkframes = chunkframes > nframes ? (chunkframes + nframes - 1) & ~(nframes - 1) : nframes;
+    debugprint(infolevel + 1, "%s: tile %u frames, chunk %u frames\n", __func__, nframes, chunkframes);
+
+    memcpy(&output_sfinfo, &input_sfinfo, sizeof(input_sfinfo));
+    output_sfinfo.channels = outchannels;
+    if (mapfile_open_input(&input_map, input_filename, &input_sfinfo)) {
+        mapped = mapfile_create_output(&output_map, output_filename, &output_sfinfo, input_sfinfo.frames);
+        if (!mapped)
+            mapfile_close(&input_map);
+    }
+    debugprint(infolevel + 1, "%s: %s\n", __func__, mapped ? "memory mapped" : "libsndfile");
+
+    if (!mapped && !(output_file = sf_open(output_filename, SFM_WRITE, &output_sfinfo))) {
+        debugprint(0, "Could not open file %s for writing.\n", output_filename);
+        sf_close(input_file);
+        return false;
+    }
+
+    bits = mapped ? 0 : quantize_bits(output_sfinfo.format);
+    if (bits)
+        quantize_init(&quantizer, dither, bits, outchannels);
+
+    if (codegen_filename)
+        write_codegen(dsphead, (char *)codegen_filename);
+
+    /* Run processing until EOF */
+    ttot.tv_sec=0;
+    ttot.tv_nsec=0;
+    clock_gettime(CLOCK_MONOTONIC, &wall);
+    if (mapped)
+        totframes = run_mapped(dsphead, &input_map, &output_map, channels, outchannels, nframes, &ttot);
+    else
+        totframes = run_pipeline(dsphead, input_file, output_file, bits ? &quantizer : NULL,
+                                 channels, outchannels, chunkframes, nframes, &ttot);
+    clock_gettime(CLOCK_MONOTONIC, &wall2); wall = timespecsub(wall,wall2);
+    clock_getres(CLOCK_THREAD_CPUTIME_ID, &res);
+    /* wrap up */
+    debugprint(infolevel,  "Done! Processed %d samples in %lld.%.9ld sec, res=%ld nsec, wall clock %lld.%.9ld sec\n", totframes,
+               (long long)ttot.tv_sec, ttot.tv_nsec, res.tv_nsec, (long long)wall.tv_sec, wall.tv_nsec);
+
+    if (mapped) {
+        mapfile_close(&input_map);
+        mapfile_close(&output_map);
+    }
+    if (sf_close(input_file)!=0) debugprint(0,  "Failed closing %s: %s\n", input_filename, sf_strerror(input_file));
+    if (output_file && sf_close(output_file)!=0) debugprint(0,  "Failed closing %s: %s\n", output_filename, sf_strerror(output_file));
+
+    *samples = (unsigned long long)totframes * channels;
+    return true;
+}
+
+/*
+ * Batch mode: files are handed out to the workers from a shared index.
+ * Each worker has a clone of the chain, so filter state is per worker and
+ * coefficient data is shared.
+ */
+struct batch_t {
+    char ** input_filenames;
+    char ** output_filenames;
+    int nfiles;
+    int next;
+    int failed;
+    unsigned long long samples;
+    const SF_INFO * raw_sfinfo;
+    unsigned int nframes;
+    unsigned int chunkframes;
+};
+
+struct batch_worker_t {
+    struct batch_t * batch;
+    struct qdsp_t * dsphead;
+    pthread_t thread;
+};
+
+void * batch_worker(void * arg)
+{
+    struct batch_worker_t * worker = (struct batch_worker_t *)arg;
+    struct batch_t * batch = worker->batch;
+    unsigned long long samples;
+    int i;
+
+    trace_thread_name("batch worker");
+    while ((i = __atomic_fetch_add(&batch->next, 1, __ATOMIC_RELAXED)) < batch->nfiles) {
+        debugprint(1, "Processing %s -> %s\n", batch->input_filenames[i], batch->output_filenames[i]);
+        if (process_file(worker->dsphead, batch->raw_sfinfo, batch->nframes, batch->chunkframes, batch->input_filenames[i],
+                         batch->output_filenames[i], NULL, 1, &samples))
+            __atomic_fetch_add(&batch->samples, samples, __ATOMIC_RELAXED);
+        else
+            __atomic_fetch_add(&batch->failed, 1, __ATOMIC_RELAXED);
+    }
+    return NULL;
+}
+
+/* Reads "input output" pairs, one per line. Empty lines and lines starting with # are skipped */
+void read_batchfile(struct batch_t * batch, const char * filename)
+{
+    FILE * fid = fopen(filename, "r");
+    char line[4096];
+    int size = 0;
+
+    if (!fid) {
+        debugprint(0, "Could not open file %s for reading.\n", filename);
+        endprogram("");
+    }
+    batch->nfiles = 0;
+    batch->input_filenames = NULL;
+    batch->output_filenames = NULL;
+    while (fgets(line, sizeof(line), fid)) {
+        char * input = strtok(line, " \t\r\n");
+        char * output = strtok(NULL, " \t\r\n");
+        if (!input || input[0] == '#')
+            continue;
+        if (!output || strtok(NULL, " \t\r\n")) {
+            debugprint(0, "%s: Expected input and output filename: %s\n", filename, input);
+            endprogram("Wrong format of batch file\n");
+        }
+        if (batch->nfiles == size) {
+            size = size ? size * 2 : 64;
+            batch->input_filenames = realloc(batch->input_filenames, size * sizeof(char *));
+            batch->output_filenames = realloc(batch->output_filenames, size * sizeof(char *));
+            if (!batch->input_filenames || !batch->output_filenames)
+                endprogram("Could not allocate memory for batch.\n");
+        }
+        batch->input_filenames[batch->nfiles] = strdup(input);
+        batch->output_filenames[batch->nfiles] = strdup(output);
+        batch->nfiles++;
+    }
+    fclose(fid);
+}
+
+int run_batch(struct qdsp_t * dsphead, const SF_INFO * raw_sfinfo, unsigned int nframes,
+              unsigned int chunkframes, const char * batch_filename, int nworkers)
+{
+    struct batch_t batch;
+    struct batch_worker_t * workers;
+    struct timespec wall, wall2;
+    int i;
+
+    read_batchfile(&batch, batch_filename);
+    batch.next = 0;
+    batch.failed = 0;
+    batch.samples = 0;
+    batch.raw_sfinfo = raw_sfinfo;
+    batch.nframes = nframes;
+    batch.chunkframes = chunkframes;
+
+    if (nworkers > batch.nfiles)
+        nworkers = batch.nfiles > 0 ? batch.nfiles : 1;
+    debugprint(0, "Processing %d files on %d workers\n", batch.nfiles, nworkers);
+
+    workers = malloc(nworkers * sizeof(struct batch_worker_t));
+    if (!workers) endprogram("Could not allocate memory for workers.\n");
+
+    clock_gettime(CLOCK_MONOTONIC, &wall);
+    for (i = 0; i < nworkers; i++) {
+        workers[i].batch = &batch;
+        workers[i].dsphead = clone_dsp(dsphead);
+        if (pthread_create(&workers[i].thread, NULL, batch_worker, &workers[i]))
+            endprogram("Could not create batch worker\n");
+    }
+    for (i = 0; i < nworkers; i++) {
+        pthread_join(workers[i].thread, NULL);
+        destroy_dsp(workers[i].dsphead);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &wall2); wall = timespecsub(wall,wall2);
+
+    debugprint(0, "Done! Processed %d files, %llu samples in %lld.%.9ld sec wall clock, %d failed\n",
+               batch.nfiles - batch.failed, batch.samples, (long long)wall.tv_sec, wall.tv_nsec, batch.failed);
+
+    for (i = 0; i < batch.nfiles; i++) {
+        free(batch.input_filenames[i]);
+        free(batch.output_filenames[i]);
+    }
+    free(batch.input_filenames);
+    free(batch.output_filenames);
+    free(workers);
+
+    return batch.failed;
+}
+
+/*
+ * Segmented mode: one file is cut into segments of whole tiles that the
+ * workers process concurrently, each on its own clone of the chain and
+ * its own handle to the input. A segment is processed from preroll frames
+ * before its start so the chain state has settled when its output begins.
+ * The main thread writes segments in order and checks each seam: the
+ * previous segment is run verify frames past its end, which must match
+ * the start of the next one to within tolerance.
+ */
+struct segment_t {
+    float * buf;                    /* interleaved, offset + frames + verify */
+    float * out;                    /* processed, buf unless there are more output channels */
+    sf_count_t offset;              /* preroll frames before the segment */
+    sf_count_t frames;
+    sf_count_t verify;
+    sem_t done;
+};
+
+struct segmenter_t {
+    const char * input_filename;
+    SF_INFO sfinfo;
+    unsigned int outchannels;
+    unsigned int nframes;
+    sf_count_t segment_frames;
+    sf_count_t preroll;
+    sf_count_t verify;
+    int nsegments;
+    int next;
+    sem_t slots;                    /* bounds the segments held in memory */
+    struct segment_t * segments;
+};
+
+struct segment_worker_t {
+    struct segmenter_t * sg;
+    struct qdsp_t * dsphead;
+    pthread_t thread;
+};
+
+static void free_segment(struct segment_t * seg)
+{
+    if (seg->out != seg->buf)
+        free(seg->out);
+    free(seg->buf);
+}
+
+void * segment_worker(void * arg)
+{
+    struct segment_worker_t * worker = (struct segment_worker_t *)arg;
+    struct segmenter_t * sg = worker->sg;
+    unsigned int channels = sg->sfinfo.channels;
+    SF_INFO sfinfo;
+    SNDFILE * input_file;
+    struct timespec ttot = { 0, 0 };
+    int k;
+
+    trace_thread_name("segment worker");
+    memcpy(&sfinfo, &sg->sfinfo, sizeof(sfinfo));
+    if (!(input_file = sf_open(sg->input_filename, SFM_READ, &sfinfo)))
+        endprogram("Could not reopen input for segment\n");
+
+    for (;;) {
+        struct segment_t * seg;
+        sf_count_t start, len, padded, nread;
+
+        sem_wait_intr(&sg->slots);
+        k = __atomic_fetch_add(&sg->next, 1, __ATOMIC_RELAXED);
+        if (k >= sg->nsegments) {
+            sem_post(&sg->slots);
+            break;
+        }
+        seg = &sg->segments[k];
+        start = k * sg->segment_frames;
+        seg->offset = start < sg->preroll ? start : sg->preroll;
+        seg->frames = sg->sfinfo.frames - start < sg->segment_frames ? sg->sfinfo.frames - start : sg->segment_frames;
+        seg->verify = sg->sfinfo.frames - start - seg->frames < sg->verify ? sg->sfinfo.frames - start - seg->frames : sg->verify;
+        len = seg->offset + seg->frames + seg->verify;
+        padded = (len + sg->nframes - 1) & ~(sf_count_t)(sg->nframes - 1);
+
+        seg->buf = malloc(padded * channels * sizeof(float));
+        seg->out = sg->outchannels > channels ? malloc(padded * sg->outchannels * sizeof(float)) : seg->buf;
+        if (!seg->buf || !seg->out) endprogram("Could not allocate memory for segment.\n");
+        trace_begin("read");
+        if (sf_seek(input_file, start - seg->offset, SEEK_SET) < 0)
+            endprogram("Could not seek in input\n");
+        nread = sf_readf_float(input_file, seg->buf, len);
+        trace_end("read");
+        memset(seg->buf + nread * channels, 0, (padded - nread) * channels * sizeof(float));
+
+        init_dsp(worker->dsphead);
+        process_block(worker->dsphead, seg->out, seg->buf, channels, sg->outchannels, padded, sg->nframes, &ttot);
+        sem_post(&seg->done);
+    }
+
+    sf_close(input_file);
+    return NULL;
+}
+
+/* Returns the largest difference found at the seams, or a negative number on failure */
+double run_segmented(struct qdsp_t * dsphead, const SF_INFO * raw_sfinfo, unsigned int nframes,
+                     const char * input_filename, const char * output_filename,
+                     double segment_seconds, double tolerance, int nworkers)
+{
+    struct segmenter_t sg;
+    struct segment_worker_t * workers;
+    struct segment_t * prev = NULL;
+    SNDFILE * input_file, * output_file;
+    SF_INFO output_sfinfo;
+    struct quantizer_t quantizer;
+    int32_t * intbuf = NULL;
+    struct timespec wall, wall2;
+    double max_error = 0;
+    unsigned int channels, outchannels;
+    long preroll;
+    int i, k, bits;
+
+    memcpy(&sg.sfinfo, raw_sfinfo, sizeof(sg.sfinfo));
+    if (!(input_file = sf_open(input_filename, SFM_READ, &sg.sfinfo))) {
+        debugprint(0, "Could not open file %s for reading.\n", input_filename);
+        return -1;
+    }
+    if (!sg.sfinfo.seekable) endprogram("Segmented processing needs a seekable input\n");
+    sf_close(input_file);
+    channels = sg.sfinfo.channels;
+    if (channels < 1 || channels > NCHANNELS_MAX) endprogram("Invalid number of channels specified\n");
+
+    nframes = init_tiled(dsphead, sg.sfinfo.samplerate, channels, nframes);
+    outchannels = sg.outchannels = outchannels_dsp(dsphead);
+
+    memcpy(&output_sfinfo, &sg.sfinfo, sizeof(output_sfinfo));
+    output_sfinfo.channels = outchannels;
+    if (!(output_file = sf_open(output_filename, SFM_WRITE, &output_sfinfo))) {
+        debugprint(0, "Could not open file %s for writing.\n", output_filename);
+        return -1;
+    }
+
+    /* segment boundaries stay on the tile grid of a serial run */
+    preroll = preroll_dsp(dsphead, tolerance);
+    if (preroll < 0) endprogram("Chain can not be processed in segments\n");
+    sg.input_filename = input_filename;
+    sg.nframes = nframes;
+    sg.preroll = (preroll + nframes - 1) & ~(long)(nframes - 1);
+    sg.verify = nframes > 1024 ? nframes : 1024;
+    sg.segment_frames = ((sf_count_t)(segment_seconds * sg.sfinfo.samplerate) + nframes - 1) & ~(sf_count_t)(nframes - 1);
+    if (sg.segment_frames < sg.verify)
+        sg.segment_frames = sg.verify;
+    sg.nsegments = sg.sfinfo.frames ? (sg.sfinfo.frames + sg.segment_frames - 1) / sg.segment_frames : 0;
+    sg.next = 0;
+    sg.segments = calloc(sg.nsegments ? sg.nsegments : 1, sizeof(struct segment_t));
+    if (!sg.segments) endprogram("Could not allocate memory for segments.\n");
+    for (k = 0; k < sg.nsegments; k++)
+        sem_init(&sg.segments[k].done, 0, 0);
+    /* one slot per worker, plus the segment waiting for its seam check */
+    sem_init(&sg.slots, 0, nworkers + 1);
+
+    if ((bits = quantize_bits(output_sfinfo.format))) {
+        quantize_init(&quantizer, dither, bits, outchannels);
+        intbuf = malloc(sg.segment_frames * outchannels * sizeof(int32_t));
+        if (!intbuf) endprogram("Could not allocate memory for segments.\n");
+    }
+
+    debugprint(0, "Processing %d segments of %lld frames with %lld frames preroll on %d workers\n",
+               sg.nsegments, (long long)sg.segment_frames, (long long)sg.preroll, nworkers);
+
+    workers = malloc(nworkers * sizeof(struct segment_worker_t));
+    if (!workers) endprogram("Could not allocate memory for workers.\n");
+
+    clock_gettime(CLOCK_MONOTONIC, &wall);
+    for (i = 0; i < nworkers; i++) {
+        workers[i].sg = &sg;
+        workers[i].dsphead = clone_dsp(dsphead);
+        if (pthread_create(&workers[i].thread, NULL, segment_worker, &workers[i]))
+            endprogram("Could not create segment worker\n");
+    }
+
+    for (k = 0; k < sg.nsegments; k++) {
+        struct segment_t * seg = &sg.segments[k];
+        sem_wait_intr(&seg->done);
+
+        if (prev) {
+            const float * a = prev->out + (prev->offset + prev->frames) * outchannels;
+            const float * b = seg->out + seg->offset * outchannels;
+            double error = 0;
+            for (i = 0; i < prev->verify * outchannels; i++)
+                error = fmax(error, fabs((double)a[i] - b[i]));
+            debugprint(1, "seam %d: max difference %g\n", k, error);
+            max_error = fmax(max_error, error);
+            free_segment(prev);
+            sem_post(&sg.slots);
+        }
+
+        trace_begin("write");
+        if (bits) {
+            quantize(&quantizer, intbuf, seg->out + seg->offset * outchannels, seg->frames);
+            if (seg->frames != sf_writef_int(output_file, intbuf, seg->frames))
+                endprogram("Failed writing output\n");
+        }
+        else if (seg->frames != sf_writef_float(output_file, seg->out + seg->offset * outchannels, seg->frames))
+            endprogram("Failed writing output\n");
+        trace_end("write");
+        prev = seg;
+    }
+    if (prev) {
+        free_segment(prev);
+        sem_post(&sg.slots);
+    }
+
+    for (i = 0; i < nworkers; i++) {
+        pthread_join(workers[i].thread, NULL);
+        destroy_dsp(workers[i].dsphead);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &wall2); wall = timespecsub(wall,wall2);
+
+    debugprint(0, "Done! Processed %lld samples in %lld.%.9ld sec wall clock, largest seam difference %g\n",
+               (long long)sg.sfinfo.frames, (long long)wall.tv_sec, wall.tv_nsec, max_error);
+
+    if (sf_close(output_file)!=0) debugprint(0,  "Failed closing %s: %s\n", output_filename, sf_strerror(output_file));
+
+    for (k = 0; k < sg.nsegments; k++)
+        sem_destroy(&sg.segments[k].done);
+    sem_destroy(&sg.slots);
+    free(sg.segments);
+    free(intbuf);
+    free(workers);
+
+    return max_error;
+}
+
+/*
+ * Server mode: the chain is created once and the workers wait for jobs on
+ * a Unix domain socket, each on its own clone of the chain, so a job only
+ * pays for init_dsp, which also resets the filter state, and the DSP.
+ * Every request is one SOCK_SEQPACKET message and gets a one line reply:
+ *   "file <input> <output>"    process input to output, as with -i and -o
+ *   "fd"                       process the two descriptors passed with the
+ *                              message (SCM_RIGHTS), input then output,
+ *                              e.g. memfds holding the audio
+ *   "control <stage> <options>" change runtime options of a stage in the
+ *                              chains of all workers, see control_dsp
+ * The reply is "ok <samples> <usec>" with the wall clock time of the job,
+ * "ok" to a control request, or "error <reason>". A connection can send
+ * any number of requests.
+ */
+#define SERVER_REQUEST_MAX 4096
+
+struct server_t {
+    int fd;
+    int stopping;
+    const SF_INFO * raw_sfinfo;
+    unsigned int nframes;
+    unsigned int chunkframes;
+    struct server_worker_t * workers;
+    int nworkers;
+};
+
+struct server_worker_t {
+    struct server_t * server;
+    struct qdsp_t * dsphead;
+    int conn;                       /* the connection being served, -1 if none */
+    pthread_t thread;
+};
+
+static void server_reply(int conn, const char * fmt, ...)
+{
+    char reply[256];
+    va_list ap;
+    int len;
+
+    va_start(ap, fmt);
+    len = vsnprintf(reply, sizeof(reply), fmt, ap);
+    va_end(ap);
+    if (len >= (int)sizeof(reply))
+        len = sizeof(reply) - 1;
+    if (send(conn, reply, len, MSG_NOSIGNAL) != len)
+        debugprint(1, "%s: could not send reply\n", __func__);
+}
+
+static void server_control(struct server_t * server, int conn, char * stage, char * subopts)
+{
+    char buf[SERVER_REQUEST_MAX];
+    char * end;
+    long n = stage ? strtol(stage, &end, 10) : 0;
+    int i;
+
+    if (!stage || *end || !subopts) {
+        server_reply(conn, "error expected control <stage> <options>\n");
+        return;
+    }
+    for (i = 0; i < server->nworkers; i++) {
+        /* getsubopt writes into the options */
+        strcpy(buf, subopts);
+        if (control_dsp(server->workers[i].dsphead, n, buf)) {
+            server_reply(conn, "error could not change stage %ld\n", n);
+            return;
+        }
+    }
+    server_reply(conn, "ok\n");
+}
+
+static void server_job(struct server_worker_t * worker, int conn, char * request, const int * fds, int nfds)
+{
+    struct server_t * server = worker->server;
+    /* passed descriptors are opened through procfs so they take the same paths as files */
+    char input_fdname[32], output_fdname[32];
+    const char * input, * output;
+    struct timespec wall, wall2;
+    unsigned long long samples;
+    char * cmd, * saveptr;
+
+    cmd = strtok_r(request, " \t\r\n", &saveptr);
+    if (cmd && !strcmp(cmd, "file")) {
+        input = strtok_r(NULL, " \t\r\n", &saveptr);
+        output = strtok_r(NULL, " \t\r\n", &saveptr);
+        if (!input || !output || nfds) {
+            server_reply(conn, "error expected file <input> <output>\n");
+            return;
+        }
+    }
+    else if (cmd && !strcmp(cmd, "fd")) {
+        if (nfds != 2) {
+            server_reply(conn, "error expected an input and an output descriptor\n");
+            return;
+        }
+        snprintf(input_fdname, sizeof(input_fdname), "/proc/self/fd/%d", fds[0]);
+        snprintf(output_fdname, sizeof(output_fdname), "/proc/self/fd/%d", fds[1]);
+        input = input_fdname;
+        output = output_fdname;
+    }
+    else if (cmd && !strcmp(cmd, "control")) {
+        char * stage = strtok_r(NULL, " \t\r\n", &saveptr);
+        server_control(server, conn, stage, strtok_r(NULL, " \t\r\n", &saveptr));
+        return;
+    }
+    else {
+        server_reply(conn, "error unknown request\n");
+        return;
+    }
+
+    debugprint(1, "Processing %s -> %s\n", input, output);
+    clock_gettime(CLOCK_MONOTONIC, &wall);
+    if (!process_file(worker->dsphead, server->raw_sfinfo, server->nframes, server->chunkframes,
+                      input, output, NULL, 1, &samples)) {
+        server_reply(conn, "error could not process %s\n", input);
+        return;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &wall2); wall = timespecsub(wall,wall2);
+    server_reply(conn, "ok %llu %ld\n", samples, (long)(wall.tv_sec * 1000000 + wall.tv_nsec / 1000));
+}
+
+void * server_worker(void * arg)
+{
+    struct server_worker_t * worker = (struct server_worker_t *)arg;
+    char request[SERVER_REQUEST_MAX];
+    union {
+        struct cmsghdr hdr;
+        char buf[CMSG_SPACE(2 * sizeof(int))];
+    } control;
+
+    trace_thread_name("server worker");
+    for (;;) {
+        int conn = accept(worker->server->fd, NULL, NULL);
+        if (conn < 0) {
+            if (__atomic_load_n(&worker->server->stopping, __ATOMIC_SEQ_CST))
+                break;
+            if (errno == EINTR || errno == ECONNABORTED)
+                continue;
+            debugprint(0, "%s: accept failed: %s\n", __func__, strerror(errno));
+            break;
+        }
+        /* published before checking stopping, so run_server either sees it or we stop */
+        __atomic_store_n(&worker->conn, conn, __ATOMIC_SEQ_CST);
+        while (!__atomic_load_n(&worker->server->stopping, __ATOMIC_SEQ_CST)) {
+            struct iovec iov = { request, sizeof(request) - 1 };
+            struct msghdr msg;
+            struct cmsghdr * cmsg;
+            int fds[2], nfds = 0, i;
+            ssize_t len;
+
+            memset(&msg, 0, sizeof(msg));
+            msg.msg_iov = &iov;
+            msg.msg_iovlen = 1;
+            msg.msg_control = control.buf;
+            msg.msg_controllen = sizeof(control.buf);
+            len = recvmsg(conn, &msg, 0);
+            if (len < 0 && errno == EINTR)
+                continue;
+            if (len <= 0)
+                break;
+            request[len] = '\0';
+
+            for (cmsg = CMSG_FIRSTHDR(&msg); cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+                if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_RIGHTS) {
+                    int n = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+                    for (i = 0; i < n && nfds < 2; i++)
+                        memcpy(&fds[nfds++], CMSG_DATA(cmsg) + i * sizeof(int), sizeof(int));
+                }
+            }
+            if (msg.msg_flags & (MSG_TRUNC | MSG_CTRUNC))
+                server_reply(conn, "error request too long\n");
+            else
+                server_job(worker, conn, request, fds, nfds);
+            for (i = 0; i < nfds; i++)
+                close(fds[i]);
+        }
+        __atomic_store_n(&worker->conn, -1, __ATOMIC_SEQ_CST);
+        close(conn);
+    }
+    return NULL;
+}
+
+/*
+ * Serves jobs until SIGINT or SIGTERM, then lets the jobs in progress
+ * finish. Returns false if the socket could not be set up.
+ */
+bool run_server(struct qdsp_t * dsphead, const SF_INFO * raw_sfinfo, unsigned int nframes,
+                unsigned int chunkframes, const char * socket_filename, int nworkers)
+{
+    struct server_t server;
+    struct server_worker_t * workers;
+    struct sockaddr_un addr;
+    sigset_t stopsignals;
+    int i, signo;
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (strlen(socket_filename) >= sizeof(addr.sun_path)) {
+        debugprint(0, "Socket filename too long: %s\n", socket_filename);
+        return false;
+    }
+    strcpy(addr.sun_path, socket_filename);
+
+    server.stopping = 0;
+    server.raw_sfinfo = raw_sfinfo;
+    server.nframes = nframes;
+    server.chunkframes = chunkframes;
+    if ((server.fd = socket(AF_UNIX, SOCK_SEQPACKET, 0)) < 0) {
+        debugprint(0, "Could not create socket: %s\n", strerror(errno));
+        return false;
+    }
+    /* a socket left behind by an earlier server */
+    unlink(socket_filename);
+    if (bind(server.fd, (struct sockaddr *)&addr, sizeof(addr)) || listen(server.fd, 64)) {
+        debugprint(0, "Could not listen on %s: %s\n", socket_filename, strerror(errno));
+        close(server.fd);
+        return false;
+    }
+
+    /* the workers inherit the mask, so the stop signals are only taken by sigwait below */
+    sigemptyset(&stopsignals);
+    sigaddset(&stopsignals, SIGINT);
+    sigaddset(&stopsignals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &stopsignals, NULL);
+
+    workers = malloc(nworkers * sizeof(struct server_worker_t));
+    if (!workers) endprogram("Could not allocate memory for workers.\n");
+    server.workers = workers;
+    server.nworkers = nworkers;
+    /* all chains exist before the first control request can arrive */
+    for (i = 0; i < nworkers; i++) {
+        workers[i].server = &server;
+        workers[i].dsphead = clone_dsp(dsphead);
+        workers[i].conn = -1;
+    }
+    for (i = 0; i < nworkers; i++) {
+        if (pthread_create(&workers[i].thread, NULL, server_worker, &workers[i]))
+            endprogram("Could not create server worker\n");
+    }
+    debugprint(0, "Listening on %s with %d workers\n", socket_filename, nworkers);
+
+    while (sigwait(&stopsignals, &signo))
+        ;
+    debugprint(0, "Received signal %d, stopping\n", signo);
+
+    /* wake the workers blocked in accept or waiting for a request */
+    __atomic_store_n(&server.stopping, 1, __ATOMIC_SEQ_CST);
+    unlink(socket_filename);
+    shutdown(server.fd, SHUT_RDWR);
+    for (i = 0; i < nworkers; i++) {
+        int conn = __atomic_load_n(&workers[i].conn, __ATOMIC_SEQ_CST);
+        if (conn >= 0)
+            shutdown(conn, SHUT_RD);
+    }
+
+    for (i = 0; i < nworkers; i++) {
+        pthread_join(workers[i].thread, NULL);
+        destroy_dsp(workers[i].dsphead);
+    }
+    free(workers);
+    close(server.fd);
+    pthread_sigmask(SIG_UNBLOCK, &stopsignals, NULL);
+    return true;
+}
+
+int main (int argc, char *argv[])
+{
+    SF_INFO input_sfinfo;
     char *input_filename = NULL;
     char *output_filename = NULL;
+    char *codegen_filename = NULL;
+    char *batch_filename = NULL;
+    char *socket_filename = NULL;
     struct qdsp_t *dsphead = NULL;
     struct qdsp_t *dsp = NULL;
-    float *readbuf, *writebuf;
-    unsigned int nframes=1024, totframes=0, nframesread=0;
-    struct timespec t,t2,ttot,res;
-    int i,c,itmp;
+    unsigned int nframes=1024, chunkframes=65536;
+    double segment_seconds = 0, tolerance = 1e-6;
+    unsigned long long samples = 0;
+    int i,c,itmp,failed = 0;
+    int nworkers = sysconf(_SC_NPROCESSORS_ONLN);
     debuglevel = 0;
-    unsigned int channels;
-
-    if (signal(SIGINT, sig_handler) == SIG_ERR)
+    bool do_profile = false;
+    struct sigaction sa;
+    const struct option long_options[] = {
+        { "profile", no_argument, NULL, 'P' },
+        { NULL, 0, NULL, 0 }
+    };
+    /* signal() resets the handler after one signal with _XOPEN_SOURCE, SIGUSR1 may come often */
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = sig_handler;
+    sa.sa_flags = SA_RESTART;
+    sigemptyset(&sa.sa_mask);
+    if (sigaction(SIGINT, &sa, NULL))
         debugprint(0, "\ncan't catch SIGINT\n");
+    if (sigaction(SIGUSR1, &sa, NULL))
+        debugprint(0, "\ncan't catch SIGUSR1\n");
 
     if (argc == 1) {
         print_help();
@@ -212,7 +1241,7 @@ int main (int argc, char *argv[])
     memset(&input_sfinfo, 0, sizeof(input_sfinfo));
 
     /* Get command line options */
-    while ((c = getopt (argc, argv, "r:n:i:o:p:v::h?")) != -1) {
+    while ((c = getopt_long (argc, argv, "r:n:c:i:o:p:g:T:b:j:S:E:L:d:Pv::h?", long_options, NULL)) != -1) {
         switch (c) {
         case 'r':
             // for raw file support
@@ -220,7 +1249,13 @@ int main (int argc, char *argv[])
                 endprogram("Wrong options for -r\n");
             break;
         case 'n':
-            nframes = atoi(optarg);
+            if (!strcmp(optarg, "auto"))
+                nframes = 0;
+            else if (!(nframes = atoi(optarg)))
+                endprogram("Framesize must be a power of two.\n");
+            break;
+        case 'c':
+            chunkframes = atoi(optarg);
             break;
         case 'i':
             input_filename = optarg;
@@ -243,6 +1278,40 @@ int main (int argc, char *argv[])
             create_dsp(dsp, optarg);
             debugprint(2, "%s: dsp->next=%p\n",__func__, dsp);
             break;
+        case 'g':
+            codegen_filename = optarg;
+            break;
+        case 'T':
+            trace_filename = optarg;
+            break;
+        case 'P':
+            do_profile = true;
+            break;
+        case 'b':
+            batch_filename = optarg;
+            break;
+        case 'j':
+            nworkers = atoi(optarg);
+            break;
+        case 'L':
+            socket_filename = optarg;
+            break;
+        case 'd':
+            if (!strcmp(optarg, "none"))
+                dither = DITHER_NONE;
+            else if (!strcmp(optarg, "tpdf"))
+                dither = DITHER_TPDF;
+            else if (!strcmp(optarg, "shaped"))
+                dither = DITHER_SHAPED;
+            else
+                endprogram("Dither must be none, tpdf or shaped\n");
+            break;
+        case 'S':
+            segment_seconds = atof(optarg);
+            break;
+        case 'E':
+            tolerance = atof(optarg);
+            break;
         case 'v':
             if (optarg) {
                 itmp = atoi(optarg);
@@ -268,81 +1337,68 @@ int main (int argc, char *argv[])
         print_help();
     }
 
-    if ((nframes == 0) || (nframes & (nframes - 1))) endprogram("Framesize must be a power of two.\n");
-
-    /* open files */
-    if (!input_filename)
-        endprogram("Must specify input file\n");
+    if (nframes & (nframes - 1)) endprogram("Framesize must be a power of two.\n");
 
-    if (!output_filename)
-        endprogram("Must specify output file\n");
+    if (!dsphead) endprogram("No processing specified\n");
 
-    if (!(input_file = sf_open(input_filename, SFM_READ, &input_sfinfo))) {
-        debugprint(0, "Could not open file %s for reading.\n", input_filename);
-        endprogram("");
+    if (trace_filename) {
+        trace_create(20);
+        trace_thread_name("main");
     }
 
-    memcpy(&output_sfinfo, &input_sfinfo, sizeof(input_sfinfo));
-    if (!(output_file = sf_open(output_filename, SFM_WRITE, &output_sfinfo))) {
-        debugprint(0, "Could not open file %s for writing.\n", output_filename);
-        endprogram("");
+    if (socket_filename) {
+        if (input_filename || output_filename || batch_filename || segment_seconds > 0 || codegen_filename || do_profile)
+            endprogram("-L can not be combined with -i, -o, -b, -S, -g or -P\n");
+        if (nworkers < 1) endprogram("Need at least one worker\n");
+        if (!run_server(dsphead, &input_sfinfo, nframes, chunkframes, socket_filename, nworkers))
+            endprogram("");
     }
-
-    /* get the current samplerate. */
-    debugprint(0,  "input file samplerate: %d\n", input_sfinfo.samplerate);
-    debugprint(0,  "input file channels: %d\n", input_sfinfo.channels);
-    channels = input_sfinfo.channels;
-    if (channels < 1 || channels > NCHANNELS_MAX) endprogram("Invalid number of channels specified\n");
-
-    if (!dsphead) endprogram("No processing specified\n");
-    dsphead->fs = input_sfinfo.samplerate;
-    dsphead->nchannels = channels;
-    dsphead->nframes = nframes;
-    init_dsp(dsphead);
-
-    readbuf = malloc(nframes*channels*sizeof(float));
-    writebuf = malloc(nframes*channels*sizeof(float));
-
-    /* Run processing until EOF */
-    ttot.tv_sec=0;
-    ttot.tv_nsec=0;
-    while ((nframesread = sf_readf_float(input_file, readbuf, nframes))) {
-        int raised;
-        if (nframesread < nframes) {
-            memset(readbuf + (nframesread * channels), 0, (nframes-nframesread) * channels * sizeof(float));
+    else if (segment_seconds > 0) {
+        double error;
+        if (!input_filename || !output_filename)
+            endprogram("Must specify input and output file\n");
+        if (batch_filename || codegen_filename || do_profile)
+            endprogram("-S can not be combined with -b, -g or -P\n");
+        if (nworkers < 1) endprogram("Need at least one worker\n");
+        error = run_segmented(dsphead, &input_sfinfo, nframes, input_filename, output_filename,
+                              segment_seconds, tolerance, nworkers);
+        if (error < 0)
+            endprogram("");
+        if (error > tolerance) {
+            debugprint(0, "Seams differ from a serial run by more than %g\n", tolerance);
+            failed = 1;
         }
-        totframes += nframes;
-        debugprint(3, "inbufs=%p\n", dsp->inbufs[0]);
-
-        deinterleave((float*)dsphead->inbufs[0], readbuf, channels, nframes);
-
-        feclearexcept(FE_ALL_EXCEPT);
-        clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t);
-
-        dsp = process(nframes, dsphead);
+    }
+    else if (batch_filename) {
+        if (input_filename || output_filename || codegen_filename || do_profile)
+            endprogram("-b can not be combined with -i, -o, -g or -P\n");
+        if (nworkers < 1) endprogram("Need at least one worker\n");
+        failed = run_batch(dsphead, &input_sfinfo, nframes, chunkframes, batch_filename, nworkers);
+    }
+    else {
+        /* open files */
+        if (!input_filename)
+            endprogram("Must specify input file\n");
 
-        clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t2); t = timespecsub(t,t2); ttot = timespecadd(t,ttot);
-        raised = fetestexcept(FE_INEXACT | FE_DIVBYZERO | FE_UNDERFLOW | FE_OVERFLOW | FE_INVALID);
-        if (raised) debugprint(3, "FE exception raised: 0x%02X\n", raised);
+        if (!output_filename)
+            endprogram("Must specify output file\n");
 
-        debugprint(3, "outbufs=%p\n", dsp->outbufs[0]);
+        if (do_profile)
+            profile = profile_create(dsphead);
 
-        interleave(writebuf, dsp->outbufs[0], channels, nframes);
+        if (!process_file(dsphead, &input_sfinfo, nframes, chunkframes, input_filename, output_filename, codegen_filename, 0, &samples))
+            endprogram("");
 
-        if (nframesread != sf_writef_float(output_file, writebuf, nframesread))
-            break;
+        if (profile) {
+            profile_report(profile, samples);
+            profile_destroy(profile);
+        }
     }
-    clock_getres(CLOCK_THREAD_CPUTIME_ID, &res);
-    /* wrap up */
-    debugprint(0,  "Done! Processed %d samples in %lld.%.9ld sec, res=%ld nsec\n", totframes, (long long)ttot.tv_sec, ttot.tv_nsec, res.tv_nsec);
 
-    if (sf_close(input_file)!=0) debugprint(0,  "Failed closing %s: %s\n", input_filename, sf_strerror(input_file));
-    if (sf_close(output_file)!=0) debugprint(0,  "Failed closing %s: %s\n", output_filename, sf_strerror(output_file));
+    if (trace_filename) trace_write(trace_filename);
+    trace_destroy();
 
-    free(writebuf);
-    free(readbuf);
     destroy_dsp(dsphead);
 
-    return 0;
+    return failed ? EXIT_FAILURE : 0;
 }
-
@@ -0,0 +1,247 @@
+#define _XOPEN_SOURCE 500
+#include <string.h>
+#include "interleave.h"
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#endif
+
+static void deinterleave_frames(float * restrict dst, const float * restrict src, int nch, int nfr, int first)
+{
+    int c,n;
+    for (c=0; c<nch; c++) {
+        for (n=first; n<nfr; n++) {
+            dst[c*nfr+n] = src[n*nch+c];
+        }
+    }
+}
+
+static void interleave_frames(float * restrict dst, const float * restrict src, int nch, int nfr, int first)
+{
+    int c,n;
+    for (c=0; c<nch; c++) {
+        for (n=first; n<nfr; n++) {
+            dst[n*nch+c] = src[c*nfr+n];
+        }
+    }
+}
+
+void deinterleave_generic(float * restrict dst, const float * restrict src, int nch, int nfr)
+{
+    deinterleave_frames(dst, src, nch, nfr, 0);
+}
+
+void interleave_generic(float * restrict dst, const float * restrict src, int nch, int nfr)
+{
+    interleave_frames(dst, src, nch, nfr, 0);
+}
+
+#if defined(__AVX__)
+/* In place transpose of eight rows of eight floats */
+static inline void transpose8x8(__m256 * r)
+{
+    __m256 t0 = _mm256_unpacklo_ps(r[0], r[1]);
+    __m256 t1 = _mm256_unpackhi_ps(r[0], r[1]);
+    __m256 t2 = _mm256_unpacklo_ps(r[2], r[3]);
+    __m256 t3 = _mm256_unpackhi_ps(r[2], r[3]);
+    __m256 t4 = _mm256_unpacklo_ps(r[4], r[5]);
+    __m256 t5 = _mm256_unpackhi_ps(r[4], r[5]);
+    __m256 t6 = _mm256_unpacklo_ps(r[6], r[7]);
+    __m256 t7 = _mm256_unpackhi_ps(r[6], r[7]);
+    __m256 s0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1,0,1,0));
+    __m256 s1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3,2,3,2));
+    __m256 s2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1,0,1,0));
+    __m256 s3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3,2,3,2));
+    __m256 s4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1,0,1,0));
+    __m256 s5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3,2,3,2));
+    __m256 s6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1,0,1,0));
+    __m256 s7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3,2,3,2));
+    r[0] = _mm256_permute2f128_ps(s0, s4, 0x20);
+    r[1] = _mm256_permute2f128_ps(s1, s5, 0x20);
+    r[2] = _mm256_permute2f128_ps(s2, s6, 0x20);
+    r[3] = _mm256_permute2f128_ps(s3, s7, 0x20);
+    r[4] = _mm256_permute2f128_ps(s0, s4, 0x31);
+    r[5] = _mm256_permute2f128_ps(s1, s5, 0x31);
+    r[6] = _mm256_permute2f128_ps(s2, s6, 0x31);
+    r[7] = _mm256_permute2f128_ps(s3, s7, 0x31);
+}
+
+/* Lane wise 4x4 transpose, two frames of four channels per lane pair and back */
+static inline void transpose4x4x2(__m256 * r)
+{
+    __m256 u0 = _mm256_unpacklo_ps(r[0], r[1]);
+    __m256 u1 = _mm256_unpackhi_ps(r[0], r[1]);
+    __m256 u2 = _mm256_unpacklo_ps(r[2], r[3]);
+    __m256 u3 = _mm256_unpackhi_ps(r[2], r[3]);
+    r[0] = _mm256_shuffle_ps(u0, u2, _MM_SHUFFLE(1,0,1,0));
+    r[1] = _mm256_shuffle_ps(u0, u2, _MM_SHUFFLE(3,2,3,2));
+    r[2] = _mm256_shuffle_ps(u1, u3, _MM_SHUFFLE(1,0,1,0));
+    r[3] = _mm256_shuffle_ps(u1, u3, _MM_SHUFFLE(3,2,3,2));
+}
+
+/* Each function below handles whole groups of eight frames and returns the number of frames done */
+static int deinterleave2_avx(float * restrict dst, const float * restrict src, int nfr)
+{
+    int n;
+    for (n = 0; n + 8 <= nfr; n += 8) {
+        __m256 a = _mm256_loadu_ps(&src[2*n]);
+        __m256 b = _mm256_loadu_ps(&src[2*n + 8]);
+        __m256 lo = _mm256_permute2f128_ps(a, b, 0x20);
+        __m256 hi = _mm256_permute2f128_ps(a, b, 0x31);
+        _mm256_storeu_ps(&dst[n], _mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(2,0,2,0)));
+        _mm256_storeu_ps(&dst[nfr + n], _mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(3,1,3,1)));
+    }
+    return n;
+}
+
+static int interleave2_avx(float * restrict dst, const float * restrict src, int nfr)
+{
+    int n;
+    for (n = 0; n + 8 <= nfr; n += 8) {
+        __m256 l = _mm256_loadu_ps(&src[n]);
+        __m256 r = _mm256_loadu_ps(&src[nfr + n]);
+        __m256 lo = _mm256_unpacklo_ps(l, r);
+        __m256 hi = _mm256_unpackhi_ps(l, r);
+        _mm256_storeu_ps(&dst[2*n], _mm256_permute2f128_ps(lo, hi, 0x20));
+        _mm256_storeu_ps(&dst[2*n + 8], _mm256_permute2f128_ps(lo, hi, 0x31));
+    }
+    return n;
+}
+
+static int deinterleave4_avx(float * restrict dst, const float * restrict src, int nfr)
+{
+    int n, c;
+    for (n = 0; n + 8 <= nfr; n += 8) {
+        const float * s = &src[4*n];
+        __m256 r0 = _mm256_loadu_ps(s);
+        __m256 r1 = _mm256_loadu_ps(s + 8);
+        __m256 r2 = _mm256_loadu_ps(s + 16);
+        __m256 r3 = _mm256_loadu_ps(s + 24);
+        __m256 r[4] = {
+            _mm256_permute2f128_ps(r0, r2, 0x20),
+            _mm256_permute2f128_ps(r0, r2, 0x31),
+            _mm256_permute2f128_ps(r1, r3, 0x20),
+            _mm256_permute2f128_ps(r1, r3, 0x31),
+        };
+        transpose4x4x2(r);
+        for (c = 0; c < 4; c++)
+            _mm256_storeu_ps(&dst[c*nfr + n], r[c]);
+    }
+    return n;
+}
+
+static int interleave4_avx(float * restrict dst, const float * restrict src, int nfr)
+{
+    int n, c;
+    for (n = 0; n + 8 <= nfr; n += 8) {
+        float * d = &dst[4*n];
+        __m256 r[4];
+        for (c = 0; c < 4; c++)
+            r[c] = _mm256_loadu_ps(&src[c*nfr + n]);
+        transpose4x4x2(r);
+        _mm256_storeu_ps(d, _mm256_permute2f128_ps(r[0], r[1], 0x20));
+        _mm256_storeu_ps(d + 8, _mm256_permute2f128_ps(r[2], r[3], 0x20));
+        _mm256_storeu_ps(d + 16, _mm256_permute2f128_ps(r[0], r[1], 0x31));
+        _mm256_storeu_ps(d + 24, _mm256_permute2f128_ps(r[2], r[3], 0x31));
+    }
+    return n;
+}
+
+static int deinterleave8_avx(float * restrict dst, const float * restrict src, int nfr)
+{
+    int n, c;
+    for (n = 0; n + 8 <= nfr; n += 8) {
+        __m256 r[8];
+        for (c = 0; c < 8; c++)
+            r[c] = _mm256_loadu_ps(&src[8*(n + c)]);
+        transpose8x8(r);
+        for (c = 0; c < 8; c++)
+            _mm256_storeu_ps(&dst[c*nfr + n], r[c]);
+    }
+    return n;
+}
+
+static int interleave8_avx(float * restrict dst, const float * restrict src, int nfr)
+{
+    int n, c;
+    for (n = 0; n + 8 <= nfr; n += 8) {
+        __m256 r[8];
+        for (c = 0; c < 8; c++)
+            r[c] = _mm256_loadu_ps(&src[c*nfr + n]);
+        transpose8x8(r);
+        for (c = 0; c < 8; c++)
+            _mm256_storeu_ps(&dst[8*(n + c)], r[c]);
+    }
+    return n;
+}
+
+/* Six channel frames go through the 8x8 transpose with masked loads and stores of the padding */
+static int deinterleave6_avx(float * restrict dst, const float * restrict src, int nfr)
+{
+    const __m256i mask = _mm256_setr_epi32(-1, -1, -1, -1, -1, -1, 0, 0);
+    int n, c;
+    for (n = 0; n + 8 <= nfr; n += 8) {
+        __m256 r[8];
+        for (c = 0; c < 8; c++)
+            r[c] = _mm256_maskload_ps(&src[6*(n + c)], mask);
+        transpose8x8(r);
+        for (c = 0; c < 6; c++)
+            _mm256_storeu_ps(&dst[c*nfr + n], r[c]);
+    }
+    return n;
+}
+
+static int interleave6_avx(float * restrict dst, const float * restrict src, int nfr)
+{
+    const __m256i mask = _mm256_setr_epi32(-1, -1, -1, -1, -1, -1, 0, 0);
+    int n, c;
+    for (n = 0; n + 8 <= nfr; n += 8) {
+        __m256 r[8];
+        for (c = 0; c < 6; c++)
+            r[c] = _mm256_loadu_ps(&src[c*nfr + n]);
+        r[6] = r[7] = _mm256_setzero_ps();
+        transpose8x8(r);
+        for (c = 0; c < 8; c++)
+            _mm256_maskstore_ps(&dst[6*(n + c)], mask, r[c]);
+    }
+    return n;
+}
+#endif
+
+void deinterleave(float * restrict dst, const float * restrict src, int nch, int nfr)
+{
+    int done = 0;
+
+    if (nch == 1) {
+        memcpy(dst, src, nfr * sizeof(float));
+        return;
+    }
+#if defined(__AVX__)
+    switch (nch) {
+    case 2: done = deinterleave2_avx(dst, src, nfr); break;
+    case 4: done = deinterleave4_avx(dst, src, nfr); break;
+    case 6: done = deinterleave6_avx(dst, src, nfr); break;
+    case 8: done = deinterleave8_avx(dst, src, nfr); break;
+    }
+#endif
+    deinterleave_frames(dst, src, nch, nfr, done);
+}
+
+void interleave(float * restrict dst, const float * restrict src, int nch, int nfr)
+{
+    int done = 0;
+
+    if (nch == 1) {
+        memcpy(dst, src, nfr * sizeof(float));
+        return;
+    }
+#if defined(__AVX__)
+    switch (nch) {
+    case 2: done = interleave2_avx(dst, src, nfr); break;
+    case 4: done = interleave4_avx(dst, src, nfr); break;
+    case 6: done = interleave6_avx(dst, src, nfr); break;
+    case 8: done = interleave8_avx(dst, src, nfr); break;
+    }
+#endif
+    interleave_frames(dst, src, nch, nfr, done);
+}
@@ -0,0 +1,15 @@
+#ifndef INTERLEAVE_H
+#define INTERLEAVE_H
+
+/*
+ * Conversion between interleaved file frames and the planar channel
+ * buffers of the chain, where channel c starts at c * nfr.
+ * 1, 2, 4, 6 and 8 channels use vectorised transposes on AVX, any other
+ * count uses the scalar *_generic loops.
+ */
+void deinterleave(float * restrict dst, const float * restrict src, int nch, int nfr);
+void interleave(float * restrict dst, const float * restrict src, int nch, int nfr);
+void deinterleave_generic(float * restrict dst, const float * restrict src, int nch, int nfr);
+void interleave_generic(float * restrict dst, const float * restrict src, int nch, int nfr);
+
+#endif
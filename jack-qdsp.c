@@ -7,12 +7,25 @@
 #include <string.h>
 #include <signal.h>
 #include <stdbool.h>
+#include <pthread.h>
 #include <jack/jack.h>
 #include "dsp.h"
+#include "timing.h"
+#include "shmstats.h"
+#include "trace.h"
 
 jack_port_t *input_port[NCHANNELS_MAX];
 jack_port_t *output_port[NCHANNELS_MAX];
 jack_client_t *client;
+struct chain_timing_t *timing;
+unsigned int timing_interval;
+struct shmstats_t *shmstats;
+char *shmstats_name;
+char *trace_filename;
+volatile sig_atomic_t trace_requested;
+pthread_t trace_pthread;
+bool trace_started;
+int trace_stop;
 
 int debuglevel;
 int get_debuglevel(void)
@@ -29,6 +42,20 @@ int process (jack_nframes_t nframes, void *arg)
     struct qdsp_t * dsphead = (struct qdsp_t *)arg;
     struct qdsp_t * dsp = dsphead;
     bool ping = false;
+    uint64_t tstart = 0, t0 = 0;
+    int bank = 0, stage = 0;
+    struct timespec tp0, tp1;
+
+    if (shmstats)
+        clock_gettime(CLOCK_MONOTONIC, &tp0);
+
+    trace_thread_name("jack process");
+    trace_begin("period");
+
+    if (timing) {
+        bank = timing_begin(timing);
+        tstart = timing_cycles();
+    }
 
     if (dsp) {
         for (int i=0; i<dsp->nchannels; i++)
@@ -42,9 +69,9 @@ int process (jack_nframes_t nframes, void *arg)
         }
 
         if (!dsp->next) {
-            for (int i=0; i<dsp->nchannels; i++) {
+            for (int i=0; i<dsp->outchannels; i++) {
                 dsp->outbufs[i] = jack_port_get_buffer (output_port[i], nframes);
-                if (dsp->outbufs[i] == dsp->inbufs[i]) {
+                if (i < dsp->nchannels && dsp->outbufs[i] == dsp->inbufs[i]) {
                     endprogram("inbufs == outbufs\n");
                 }
             }
@@ -52,11 +79,110 @@ int process (jack_nframes_t nframes, void *arg)
 
         dsp->nframes = nframes;
         dsp->sequencecount++;
+        if (timing) t0 = timing_cycles();
+        trace_begin(dsp->name);
         dsp->process((void*)dsp);
+        trace_end(dsp->name);
+        if (timing) timing_record(timing, bank, stage++, timing_cycles() - t0);
         dsp = dsp->next;
         ping = !ping;
     }
 
+    if (timing) timing_record(timing, bank, timing->nstages, timing_cycles() - tstart);
+
+    trace_end("period");
+
+    if (shmstats) {
+        clock_gettime(CLOCK_MONOTONIC, &tp1);
+        shmstats_period(shmstats, (tp1.tv_sec - tp0.tv_sec) * 1000000000LL + tp1.tv_nsec - tp0.tv_nsec);
+    }
+
+    return 0;
+}
+
+
+/**
+ * Prints the per-stage timing every timing_interval seconds,
+ * outside of the realtime thread.
+ */
+void * timing_thread(void *arg)
+{
+    struct qdsp_t * dsphead = (struct qdsp_t *)arg;
+    trace_thread_name("timing");
+    for (;;) {
+        sleep(timing_interval);
+        trace_begin("timing_publish");
+        timing_publish(timing, stderr, dsphead->fs, dsphead->nframes);
+        trace_end("timing_publish");
+    }
+    return NULL;
+}
+
+
+/**
+ * Writes the trace file when requested with SIGUSR1, until write_trace()
+ * stops it.
+ */
+void * trace_thread(void *arg)
+{
+    (void)arg;
+    while (!__atomic_load_n(&trace_stop, __ATOMIC_ACQUIRE)) {
+        usleep(100000);
+        if (trace_requested) {
+            trace_requested = 0;
+            trace_write(trace_filename);
+        }
+    }
+    return NULL;
+}
+
+
+/**
+ * Writes the trace on exit, once. Must run before destroy_dsp() as events
+ * point at the stage names. The trace thread is joined first so it is not
+ * inside trace_write(). The buffer is not freed: the JACK threads may still
+ * add events until the process exits.
+ */
+void write_trace(void)
+{
+    static int written;
+
+    if (!trace_filename || __atomic_exchange_n(&written, 1, __ATOMIC_ACQ_REL))
+        return;
+    if (trace_started) {
+        __atomic_store_n(&trace_stop, 1, __ATOMIC_RELEASE);
+        pthread_join(trace_pthread, NULL);
+    }
+    trace_write(trace_filename);
+}
+
+
+/**
+ * Updates the DSP load in the shared memory stats once a second.
+ */
+void * shmstats_thread(void *arg)
+{
+    (void)arg;
+    trace_thread_name("telemetry");
+    for (;;) {
+        shmstats_load(shmstats, jack_cpu_load(client));
+        sleep(1);
+    }
+    return NULL;
+}
+
+
+/**
+ * JACK calls this callback after an xrun, outside of the process thread.
+ */
+int xrunCb(void *arg)
+{
+    (void)arg;
+    trace_thread_name("jack notify");
+    trace_begin("xrun");
+    trace_end("xrun");
+    if (shmstats) shmstats_xrun(shmstats);
+    debugprint(1, "%s: xrun\n", __func__);
     return 0;
 }
 
@@ -71,7 +197,10 @@ int bufferSizeCb(jack_nframes_t nframes, void *arg)
     if ((int)nframes != dsphead->nframes) {
         debugprint(0, "%s: Changing buffer size from %d to %d\n", __func__, dsphead->nframes, nframes);
         dsphead->nframes = nframes;
+        trace_begin("init_dsp");
         init_dsp(dsphead);
+        trace_end("init_dsp");
+        if (shmstats) shmstats_format(shmstats, dsphead->fs, nframes);
     }
     return 0;
 }
@@ -84,21 +213,55 @@ int bufferSizeCb(jack_nframes_t nframes, void *arg)
 void jack_shutdown (void *arg)
 {
     struct qdsp_t * dsphead = (struct qdsp_t *)arg;
+    write_trace();
     destroy_dsp(dsphead);
+    shmstats_destroy(shmstats, shmstats_name);
     exit(EXIT_FAILURE);
 }
 
+/*
+ * Runtime stage options, one "stage suboptions" per line on stdin, e.g.
+ * "1 g=-6" for the second stage. Returns at end of input.
+ */
+static void read_controls(struct qdsp_t * dsphead)
+{
+    char line[1024];
+
+    while (fgets(line, sizeof(line), stdin)) {
+        char * subopts;
+        long stage = strtol(line, &subopts, 10);
+        /* no stage number, checked before the separator is skipped */
+        const bool nostage = subopts == line;
+
+        subopts += strspn(subopts, " \t");
+        subopts[strcspn(subopts, "\r\n")] = '\0';
+        if (nostage || !*subopts) {
+            debugprint(0, "Expected: stage suboptions\n");
+            continue;
+        }
+        if (control_dsp(dsphead, stage, subopts))
+            debugprint(0, "Could not change stage %ld\n", stage);
+    }
+}
+
 void print_help()
 {
     int i=0;
     debugprint(0, "jack-qdsp -c channels [general-options] -p dsp-name <dsp-options> [-p ...]\n\n");
     debugprint(0, "Version: %s\n", VERSION);
     debugprint(0, "General options\n");
-    debugprint(0, " -c channels\n");
+    debugprint(0, " -c channels, the number of outputs follows the chain\n");
     debugprint(0, " -s server name\n");
     debugprint(0, " -n client name\n");
     debugprint(0, " -i input ports\n");
     debugprint(0, " -o output ports\n");
+    debugprint(0, " -g write the chain as C source to filename, see dsp 'so'\n");
+    debugprint(0, " -t print per-stage timing every t seconds\n");
+    debugprint(0, " -m publish xrun and load telemetry in shared memory /name, read with qdsp-stat\n");
+    debugprint(0, " -T write a Chrome/Perfetto trace to filename on exit and on SIGUSR1\n");
+    debugprint(0, " -C read runtime options from stdin, lines of \"stage suboptions\" with the stage\n");
+    debugprint(0, "    counted from 0, e.g. \"0 g=-6\". Without it stdin is not read, so jack-qdsp can\n");
+    debugprint(0, "    run in the background of a shell\n");
     debugprint(0, "\nDSP options\n");
 
     struct dspfuncs_t * dspfuncs = get_dspfuncs();
@@ -112,10 +275,15 @@ void print_help()
 
 void sig_handler(int signo)
 {
+    if (signo == SIGUSR1) {
+        trace_requested = 1;
+        return;
+    }
     debugprint(0, "sig_handler\n");
     if (signo == SIGINT) {
         debugprint(0, "received SIGINT\n");
         jack_client_close (client);
+        shmstats_destroy(shmstats, shmstats_name);
         exit(0);
     }
 }
@@ -133,17 +301,28 @@ int main (int argc, char *argv[])
     char *server_name = NULL;
     char *input_ports = NULL;
     char *output_ports = NULL;
+    char *codegen_filename = NULL;
     jack_options_t options = JackNullOption;
     jack_status_t status;
     struct qdsp_t *dsphead = NULL;
     struct qdsp_t *dsp = NULL;
     int channels = 0;
+    int outchannels;
+    bool controls = false;
+    struct sigaction sa;
     int i,c,itmp;
 
     debuglevel = 0;
 
-    if (signal(SIGINT, sig_handler) == SIG_ERR)
+    /* signal() resets the handler after one signal with _XOPEN_SOURCE, SIGUSR1 may come often */
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = sig_handler;
+    sa.sa_flags = SA_RESTART;
+    sigemptyset(&sa.sa_mask);
+    if (sigaction(SIGINT, &sa, NULL))
         debugprint(0, "\ncan't catch SIGINT\n");
+    if (sigaction(SIGUSR1, &sa, NULL))
+        debugprint(0, "\ncan't catch SIGUSR1\n");
 
     if (argc == 1) {
         print_help();
@@ -151,7 +330,7 @@ int main (int argc, char *argv[])
     }
 
     /* Get command line options */
-    while ((c = getopt (argc, argv, "c:n:s:i:o:p:v::h?")) != -1) {
+    while ((c = getopt (argc, argv, "c:n:s:i:o:p:g:t:m:T:Cv::h?")) != -1) {
         switch (c) {
         case 'c':
             channels = atoi(optarg);
@@ -184,6 +363,21 @@ int main (int argc, char *argv[])
             create_dsp(dsp, optarg);
             debugprint(2, "%s: dsp->next=%p\n",__func__, dsp);
             break;
+        case 'g':
+            codegen_filename = optarg;
+            break;
+        case 't':
+            timing_interval = atoi(optarg);
+            break;
+        case 'm':
+            shmstats_name = optarg;
+            break;
+        case 'T':
+            trace_filename = optarg;
+            break;
+        case 'C':
+            controls = true;
+            break;
         case 'v':
             if (optarg) {
                 itmp = atoi(optarg);
@@ -233,6 +427,8 @@ int main (int argc, char *argv[])
 
     jack_set_buffer_size_callback (client, bufferSizeCb, dsphead);
 
+    jack_set_xrun_callback (client, xrunCb, dsphead);
+
     jack_on_shutdown (client, jack_shutdown, dsphead);
 
     /* Get the current samplerate and buffersize. */
@@ -241,6 +437,42 @@ int main (int argc, char *argv[])
     dsphead->nframes = jack_get_buffer_size (client);
 
     init_dsp(dsphead);
+    outchannels = outchannels_dsp(dsphead);
+
+    if (codegen_filename) {
+        FILE * fid = fopen(codegen_filename, "w");
+        if (!fid || codegen_dsp(dsphead, fid))
+            endprogram("Could not generate code for chain\n");
+        fclose(fid);
+        debugprint(0, "Wrote chain source to %s\n", codegen_filename);
+    }
+
+    if (trace_filename) {
+        trace_create(18);
+        trace_thread_name("main");
+        atexit(write_trace);
+        if (pthread_create(&trace_pthread, NULL, trace_thread, NULL))
+            endprogram("Could not start trace thread\n");
+        trace_started = true;
+    }
+
+    if (timing_interval) {
+        pthread_t thread;
+        timing = timing_create(dsphead);
+        if (pthread_create(&thread, NULL, timing_thread, dsphead))
+            endprogram("Could not start timing thread\n");
+    }
+
+    if (shmstats_name) {
+        pthread_t thread;
+        shmstats = shmstats_create(shmstats_name, dsphead, client_name);
+        if (!shmstats) {
+            debugprint(0, "Could not create shared memory %s\n", shmstats_name);
+            endprogram("");
+        }
+        if (pthread_create(&thread, NULL, shmstats_thread, NULL))
+            endprogram("Could not start telemetry thread\n");
+    }
 
     /* Create ports */
     for (i=0; i<channels; i++) {
@@ -249,7 +481,9 @@ int main (int argc, char *argv[])
         input_port[i] = jack_port_register (client, name,
                                      JACK_DEFAULT_AUDIO_TYPE,
                                      JackPortIsInput, 0);
-
+    }
+    for (i=0; i<outchannels; i++) {
+        char name[20];
         sprintf(name, "out_%d", i+1);
         output_port[i] = jack_port_register (client, name,
                                       JACK_DEFAULT_AUDIO_TYPE,
@@ -257,7 +491,8 @@ int main (int argc, char *argv[])
     }
 
     /* Activate, process() will be called from now on */
-    debugprint(0,  "Activate %s: Samplerate: %d, Channels: %d, Buffersize: %d\n", client_name, dsphead->fs, channels, dsphead->nframes);
+    debugprint(0,  "Activate %s: Samplerate: %d, Channels: %d in, %d out, Buffersize: %d\n", client_name, dsphead->fs,
+               channels, outchannels, dsphead->nframes);
     if (jack_activate (client)) {
         debugprint(0, "cannot activate client");
         exit (1);
@@ -291,7 +526,7 @@ int main (int argc, char *argv[])
         char * token = strtok(output_ports,",");
         i=0;
         while (token) {
-            if (i >= channels) {
+            if (i >= outchannels) {
                 debugprint(0, "error: channels > 1 and number of output ports > number of channels!");
                 jack_client_close (client);
                 exit(1);
@@ -301,16 +536,23 @@ int main (int argc, char *argv[])
                 debugprint(0, "cannot connect output port with %s\n", token);
             }
             token = strtok(NULL, ",");
-            if (channels > 1) i++;
+            if (outchannels > 1) i++;
         }
     }
 
-    /* Keep running until stopped by the user */
-    sleep (-1);
+    /* Keep running until stopped by the user, taking runtime options if asked to */
+    if (controls)
+        read_controls(dsphead);
+    /* a SIGUSR1 trace dump ends the sleep, SIGINT exits from its handler */
+    for (;;)
+        sleep (-1);
 
     /* Just to be safe */
     jack_client_close (client);
+    write_trace();
     destroy_dsp(dsphead);
+    timing_destroy(timing);
+    shmstats_destroy(shmstats, shmstats_name);
     exit (0);
 }
 
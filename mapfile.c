@@ -0,0 +1,176 @@
+#define _XOPEN_SOURCE 600
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "dsp.h"
+#include "mapfile.h"
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define HOST_ENDIAN SF_ENDIAN_BIG
+#else
+#define HOST_ENDIAN SF_ENDIAN_LITTLE
+#endif
+
+static uint32_t get_le32(const unsigned char * p)
+{
+    return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static void put_le32(unsigned char * p, uint32_t v)
+{
+    p[0] = v; p[1] = v >> 8; p[2] = v >> 16; p[3] = v >> 24;
+}
+
+bool mapfile_supported(const SF_INFO * info)
+{
+    int major = info->format & SF_FORMAT_TYPEMASK;
+    int endian = info->format & SF_FORMAT_ENDMASK;
+
+    if ((info->format & SF_FORMAT_SUBMASK) != SF_FORMAT_FLOAT)
+        return false;
+    /* RIFF is little endian, raw files default to the host's byte order */
+    if (major == SF_FORMAT_WAV || major == SF_FORMAT_WAVEX)
+        return HOST_ENDIAN == SF_ENDIAN_LITTLE && (endian == SF_ENDIAN_FILE || endian == SF_ENDIAN_LITTLE);
+    if (major == SF_FORMAT_RAW)
+        return endian == SF_ENDIAN_FILE || endian == SF_ENDIAN_CPU || endian == HOST_ENDIAN;
+    return false;
+}
+
+/*
+ * Offset of the sample data and of the size fields to patch, walking the
+ * chunks of a RIFF header. fact is 0 if there is no fact chunk.
+ */
+static bool riff_find_data(const unsigned char * p, size_t len, size_t * data, size_t * fact)
+{
+    size_t pos = 12;
+
+    if (len < 12 || memcmp(p, "RIFF", 4) || memcmp(p + 8, "WAVE", 4))
+        return false;
+    *fact = 0;
+    while (pos + 8 <= len) {
+        uint32_t size = get_le32(p + pos + 4);
+        if (!memcmp(p + pos, "data", 4)) {
+            *data = pos + 8;
+            return true;
+        }
+        if (!memcmp(p + pos, "fact", 4) && size >= 4)
+            *fact = pos + 8;
+        pos += 8 + size + (size & 1);
+    }
+    return false;
+}
+
+/* Maps len bytes of fd and finds the data chunk, 0 offset for raw files */
+static bool map_data(struct mapfile_t * mf, const SF_INFO * info, size_t len, int prot, size_t * fact)
+{
+    size_t offset = 0;
+
+    mf->maplen = len;
+    mf->map = mmap(NULL, len, prot, MAP_SHARED, mf->fd, 0);
+    if (mf->map == MAP_FAILED) {
+        mf->map = NULL;
+        return false;
+    }
+    if ((info->format & SF_FORMAT_TYPEMASK) != SF_FORMAT_RAW
+        && !riff_find_data(mf->map, len, &offset, fact))
+        return false;
+    /* float samples must be aligned for the vector loads to be reasonable */
+    if (offset & (sizeof(float) - 1))
+        return false;
+    mf->data = (float *)((char *)mf->map + offset);
+    posix_madvise(mf->map, len, POSIX_MADV_SEQUENTIAL);
+    return true;
+}
+
+bool mapfile_open_input(struct mapfile_t * mf, const char * filename, const SF_INFO * info)
+{
+    struct stat st;
+    size_t fact;
+
+    memset(mf, 0, sizeof(*mf));
+    mf->fd = -1;
+    if (!mapfile_supported(info))
+        return false;
+    mf->fd = open(filename, O_RDONLY);
+    if (mf->fd < 0 || fstat(mf->fd, &st) || !S_ISREG(st.st_mode) || st.st_size == 0)
+        goto fail;
+    if (!map_data(mf, info, st.st_size, PROT_READ, &fact))
+        goto fail;
+    mf->frames = info->frames;
+    if ((char *)(mf->data + mf->frames * info->channels) > (char *)mf->map + mf->maplen)
+        goto fail;
+    debugprint(1, "%s: mapped %s, %lld frames\n", __func__, filename, (long long)mf->frames);
+    return true;
+
+fail:
+    mapfile_close(mf);
+    return false;
+}
+
+/*
+ * libsndfile writes the header of an empty file, which is then extended to
+ * hold frames and has its size fields patched.
+ */
+bool mapfile_create_output(struct mapfile_t * mf, const char * filename, const SF_INFO * info, sf_count_t frames)
+{
+    SF_INFO sfinfo;
+    SNDFILE * file;
+    struct stat st;
+    size_t header, data, fact = 0;
+    size_t bytes = (size_t)frames * info->channels * sizeof(float);
+
+    memset(mf, 0, sizeof(*mf));
+    mf->fd = -1;
+    if (!mapfile_supported(info) || !strcmp(filename, "-"))
+        return false;
+    /* leave files too large for RIFF size fields to libsndfile */
+    if ((info->format & SF_FORMAT_TYPEMASK) != SF_FORMAT_RAW && bytes > UINT32_MAX - 4096)
+        return false;
+
+    memcpy(&sfinfo, info, sizeof(sfinfo));
+    if (!(file = sf_open(filename, SFM_WRITE, &sfinfo)))
+        return false;
+    sf_command(file, SFC_SET_ADD_PEAK_CHUNK, NULL, SF_FALSE);
+    sf_close(file);
+
+    mf->fd = open(filename, O_RDWR);
+    if (mf->fd < 0 || fstat(mf->fd, &st) || !S_ISREG(st.st_mode))
+        goto fail;
+    header = st.st_size;
+    if (ftruncate(mf->fd, header + bytes))
+        goto fail;
+    if (!map_data(mf, info, header + bytes, PROT_READ | PROT_WRITE, &fact))
+        goto fail;
+    data = (char *)mf->data - (char *)mf->map;
+    if (data != header)
+        goto fail;
+
+    if ((info->format & SF_FORMAT_TYPEMASK) != SF_FORMAT_RAW) {
+        unsigned char * p = mf->map;
+        put_le32(p + 4, header + bytes - 8);
+        put_le32(p + data - 4, bytes);
+        if (fact)
+            put_le32(p + fact, frames);
+    }
+    mf->frames = frames;
+    debugprint(1, "%s: mapped %s, %lld frames\n", __func__, filename, (long long)mf->frames);
+    return true;
+
+fail:
+    mapfile_close(mf);
+    return false;
+}
+
+void mapfile_close(struct mapfile_t * mf)
+{
+    if (mf->map)
+        munmap(mf->map, mf->maplen);
+    if (mf->fd >= 0)
+        close(mf->fd);
+    mf->map = NULL;
+    mf->fd = -1;
+}
@@ -0,0 +1,25 @@
+#ifndef MAPFILE_H
+#define MAPFILE_H
+
+#include <stdbool.h>
+#include <sndfile.h>
+
+/*
+ * Memory mapped access to the sample data of float32 WAV and raw files in
+ * native byte order, so file-qdsp can convert blocks directly between the
+ * mapping and the chain buffers without going through libsndfile.
+ */
+struct mapfile_t {
+    int fd;
+    void * map;
+    size_t maplen;
+    float * data;                   /* interleaved frames */
+    sf_count_t frames;
+};
+
+bool mapfile_supported(const SF_INFO * info);
+bool mapfile_open_input(struct mapfile_t * mf, const char * filename, const SF_INFO * info);
+bool mapfile_create_output(struct mapfile_t * mf, const char * filename, const SF_INFO * info, sf_count_t frames);
+void mapfile_close(struct mapfile_t * mf);
+
+#endif
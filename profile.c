@@ -0,0 +1,146 @@
+#define _GNU_SOURCE
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#include "profile.h"
+
+static const struct {
+    const char * name;
+    uint32_t type;
+    uint64_t config;
+} counters[PROFILE_NCOUNTERS] = {
+    [PROFILE_CYCLES]        = { "cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+    [PROFILE_INSTRUCTIONS]  = { "instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+    [PROFILE_L1D_MISSES]    = { "L1D misses", PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D |
+                                (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+    [PROFILE_LLC_MISSES]    = { "LLC misses", PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_LL |
+                                (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+    [PROFILE_BRANCH_MISSES] = { "branch misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+};
+
+/* Counts the calling thread only, see profile.h */
+static int open_counter(int counter, int group_fd)
+{
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = counters[counter].type;
+    attr.config = counters[counter].config;
+    attr.disabled = group_fd < 0;
+    attr.exclude_kernel = 1;        /* works with perf_event_paranoid=2 */
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    return syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0);
+}
+
+struct profile_t * profile_create(struct qdsp_t * dsphead)
+{
+    struct profile_t * profile;
+    struct qdsp_t * dsp;
+    int nstages = 0, opened = 0;
+
+    for (dsp = dsphead; dsp; dsp = dsp->next)
+        nstages++;
+
+    profile = malloc(sizeof(struct profile_t) + nstages * sizeof(struct profile_stage_t));
+    if (!profile) endprogram("Could not allocate memory for profile.\n");
+    profile->nstages = nstages;
+
+    for (dsp = dsphead, nstages = 0; dsp; dsp = dsp->next, nstages++) {
+        struct profile_stage_t * stage = &profile->stage[nstages];
+        stage->name = dsp->name;
+        stage->leader = -1;
+        for (int i = 0; i < PROFILE_NCOUNTERS; i++) {
+            stage->fd[i] = open_counter(i, stage->leader);
+            if (stage->fd[i] < 0) {
+                debugprint(1, "%s: %s counter not available for %s\n", __func__, counters[i].name, dsp->name);
+                continue;
+            }
+            if (stage->leader < 0)
+                stage->leader = stage->fd[i];
+            opened++;
+        }
+    }
+
+    if (!opened)
+        debugprint(0, "No performance counters available, check /proc/sys/kernel/perf_event_paranoid\n");
+
+    return profile;
+}
+
+void profile_begin(struct profile_t * profile, int stage)
+{
+    if (profile->stage[stage].leader >= 0)
+        ioctl(profile->stage[stage].leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+void profile_end(struct profile_t * profile, int stage)
+{
+    if (profile->stage[stage].leader >= 0)
+        ioctl(profile->stage[stage].leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+}
+
+/* Count scaled up for the time the counter was multiplexed out, -1 if not available */
+static double read_counter(int fd)
+{
+    uint64_t v[3];
+
+    if (fd < 0 || read(fd, v, sizeof(v)) != sizeof(v) || !v[2])
+        return -1;
+    return (double)v[0] * v[1] / v[2];
+}
+
+static void print_value(double value, double scale, const char * format)
+{
+    if (value < 0)
+        debugprint(0, " %12s", "n/a");
+    else
+        debugprint(0, format, value * scale);
+}
+
+void profile_report(struct profile_t * profile, unsigned long long samples)
+{
+    debugprint(0, "\nPer stage counters, per sample and channel over %llu samples\n", samples);
+    debugprint(0, "%-32s %12s %12s %12s %12s %12s %12s\n", "stage",
+               "cycles", "instr", "IPC", "L1D miss", "LLC miss", "br miss");
+
+    for (int s = 0; s < profile->nstages; s++) {
+        struct profile_stage_t * stage = &profile->stage[s];
+        double count[PROFILE_NCOUNTERS];
+        double ipc = -1;
+
+        for (int i = 0; i < PROFILE_NCOUNTERS; i++)
+            count[i] = read_counter(stage->fd[i]);
+        if (count[PROFILE_CYCLES] > 0 && count[PROFILE_INSTRUCTIONS] >= 0)
+            ipc = count[PROFILE_INSTRUCTIONS] / count[PROFILE_CYCLES];
+
+        debugprint(0, "%-32.32s ", stage->name);
+        print_value(count[PROFILE_CYCLES], 1.0 / samples, " %12.3f");
+        print_value(count[PROFILE_INSTRUCTIONS], 1.0 / samples, " %12.3f");
+        print_value(ipc, 1.0, " %12.2f");
+        print_value(count[PROFILE_L1D_MISSES], 1.0 / samples, " %12.5f");
+        print_value(count[PROFILE_LLC_MISSES], 1.0 / samples, " %12.5f");
+        print_value(count[PROFILE_BRANCH_MISSES], 1.0 / samples, " %12.5f");
+        debugprint(0, "\n");
+    }
+#if defined(_OPENMP)
+    debugprint(0, "Counts are of the processing thread, work on OpenMP worker threads is not included\n");
+#endif
+}
+
+void profile_destroy(struct profile_t * profile)
+{
+    if (!profile)
+        return;
+    for (int s = 0; s < profile->nstages; s++)
+        for (int i = 0; i < PROFILE_NCOUNTERS; i++)
+            if (profile->stage[s].fd[i] >= 0)
+                close(profile->stage[s].fd[i]);
+    free(profile);
+}
@@ -0,0 +1,42 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <stdio.h>
+#include "dsp.h"
+
+/*
+ * Per-stage hardware performance counters for file-qdsp --profile.
+ * Each stage gets its own perf_event group which is only enabled around
+ * that stage's process call, so the counts exclude file I/O and the other
+ * stages. Counters the CPU or kernel does not provide are reported as n/a.
+ * Only the processing thread is counted: inherited counters would also
+ * count the file I/O threads, which run while a stage is enabled. Work a
+ * stage hands to OpenMP workers, like multichannel fir, is left out.
+ */
+enum profile_counter {
+    PROFILE_CYCLES = 0,
+    PROFILE_INSTRUCTIONS,
+    PROFILE_L1D_MISSES,
+    PROFILE_LLC_MISSES,
+    PROFILE_BRANCH_MISSES,
+    PROFILE_NCOUNTERS
+};
+
+struct profile_stage_t {
+    const char * name;
+    int leader;                     /* fd of the group leader, -1 if none opened */
+    int fd[PROFILE_NCOUNTERS];
+};
+
+struct profile_t {
+    int nstages;
+    struct profile_stage_t stage[];
+};
+
+struct profile_t * profile_create(struct qdsp_t * dsphead);
+void profile_begin(struct profile_t * profile, int stage);
+void profile_end(struct profile_t * profile, int stage);
+void profile_report(struct profile_t * profile, unsigned long long samples);
+void profile_destroy(struct profile_t * profile);
+
+#endif
@@ -0,0 +1,105 @@
+#define _XOPEN_SOURCE 500
+#include <getopt.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include "shmstats.h"
+
+void print_help()
+{
+    fprintf(stderr, "qdsp-stat [-j] [-w seconds] name\n\n");
+    fprintf(stderr, "Version: %s\n", VERSION);
+    fprintf(stderr, "Dumps the telemetry published by jack-qdsp -m name\n");
+    fprintf(stderr, " -j JSON output\n");
+    fprintf(stderr, " -w repeat every w seconds\n");
+    exit(EXIT_SUCCESS);
+}
+
+static void print_json_string(const char * str)
+{
+    putchar('"');
+    for (; *str; str++) {
+        if (*str == '"' || *str == '\\')
+            printf("\\%c", *str);
+        else if ((unsigned char)*str < 0x20)
+            printf("\\u%04x", *str);
+        else
+            putchar(*str);
+    }
+    putchar('"');
+}
+
+static void print_stats(const struct shmstats_t * s, bool json)
+{
+    double mean_us = s->periods ? s->sum_ns / 1000.0 / s->periods : 0;
+
+    if (json) {
+        printf("{\"pid\":%d,\"client\":", s->pid);
+        print_json_string(s->client_name);
+        printf(",\"chain\":");
+        print_json_string(s->chain);
+        printf(",\"chain_hash\":\"%016llx\",\"fs\":%u,\"nframes\":%u,\"nchannels\":%u,"
+               "\"period_us\":%.3f,\"periods\":%llu,\"xruns\":%llu,\"deadline_misses\":%llu,"
+               "\"dsp_load\":%.3f,\"last_us\":%.3f,\"mean_us\":%.3f,\"max_us\":%.3f}\n",
+               (unsigned long long)s->chain_hash, s->fs, s->nframes, s->nchannels,
+               s->period_ns / 1000.0, (unsigned long long)s->periods, (unsigned long long)s->xruns,
+               (unsigned long long)s->deadline_misses, s->dsp_load / 1000.0,
+               s->last_ns / 1000.0, mean_us, s->max_ns / 1000.0);
+    }
+    else {
+        printf("client:          %s (pid %d)\n", s->client_name, s->pid);
+        printf("chain:           %s\n", s->chain);
+        printf("chain hash:      %016llx\n", (unsigned long long)s->chain_hash);
+        printf("format:          %u Hz, %u frames, %u channels\n", s->fs, s->nframes, s->nchannels);
+        printf("periods:         %llu\n", (unsigned long long)s->periods);
+        printf("xruns:           %llu\n", (unsigned long long)s->xruns);
+        printf("deadline misses: %llu\n", (unsigned long long)s->deadline_misses);
+        printf("dsp load:        %.1f%%\n", s->dsp_load / 1000.0);
+        printf("process time:    last %.2f us, mean %.2f us, max %.2f us of %.2f us\n",
+               s->last_ns / 1000.0, mean_us, s->max_ns / 1000.0, s->period_ns / 1000.0);
+    }
+    fflush(stdout);
+}
+
+int main(int argc, char *argv[])
+{
+    struct shmstats_t * stats;
+    struct shmstats_t copy;
+    bool json = false;
+    int interval = 0;
+    int c;
+
+    while ((c = getopt (argc, argv, "jw:h?")) != -1) {
+        switch (c) {
+        case 'j':
+            json = true;
+            break;
+        case 'w':
+            interval = atoi(optarg);
+            break;
+        case 'h':
+        case '?':
+            print_help();
+            break;
+        }
+    }
+
+    if (optind + 1 != argc)
+        print_help();
+
+    if (!(stats = shmstats_open(argv[optind]))) {
+        fprintf(stderr, "Could not open stats %s\n", argv[optind]);
+        exit(EXIT_FAILURE);
+    }
+
+    for (;;) {
+        shmstats_snapshot(stats, &copy);
+        print_stats(&copy, json);
+        if (interval <= 0)
+            break;
+        sleep(interval);
+    }
+
+    return 0;
+}
@@ -0,0 +1,159 @@
+#define _XOPEN_SOURCE 600
+#include <math.h>
+#include <stdbool.h>
+#include <string.h>
+#include <sndfile.h>
+#include "quantize.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+/* Bits per sample of the PCM subtypes, 0 for formats written as float */
+int quantize_bits(int format)
+{
+    switch (format & SF_FORMAT_SUBMASK) {
+    case SF_FORMAT_PCM_S8:
+    case SF_FORMAT_PCM_U8:
+        return 8;
+    case SF_FORMAT_PCM_16:
+        return 16;
+    case SF_FORMAT_PCM_24:
+        return 24;
+    case SF_FORMAT_PCM_32:
+        return 32;
+    default:
+        return 0;
+    }
+}
+
+void quantize_init(struct quantizer_t * q, enum dither_type type, int bits, int channels)
+{
+    int i;
+
+    memset(q, 0, sizeof(*q));
+    q->type = type;
+    q->bits = bits;
+    q->channels = channels;
+    q->scale = ldexpf(1.0f, bits - 1);
+    q->lo = -q->scale;
+    /* above 24 bits full scale - 1 LSB is not a float */
+    q->hi = bits > 24 ? nextafterf(q->scale, 0) : q->scale - 1;
+    for (i = 0; i < QUANTIZE_LANES; i++)
+        q->seed[i] = 0x9e3779b9u * (i + 1);
+}
+
+/* xorshift32, uniform in [0, 1) */
+static inline float uniform(uint32_t * seed)
+{
+    uint32_t x = *seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *seed = x;
+    return (x >> 8) * (1.0f / 16777216.0f);
+}
+
+/* Triangular in (-1, 1) LSB from the lane of the current stream position */
+static inline float tpdf(struct quantizer_t * q)
+{
+    uint32_t * seed = &q->seed[q->pos & (QUANTIZE_LANES - 1)];
+    float a = uniform(seed);
+    return a - uniform(seed);
+}
+
+static inline int32_t clip_and_shift(const struct quantizer_t * q, float y)
+{
+    y = fminf(fmaxf(y, q->lo), q->hi);
+    return (int32_t)((uint32_t)lrintf(y) << (32 - q->bits));
+}
+
+static inline int32_t quantize_sample(struct quantizer_t * q, float x)
+{
+    float y = x * q->scale;
+    if (q->type == DITHER_TPDF)
+        y += tpdf(q);
+    q->pos++;
+    return clip_and_shift(q, y);
+}
+
+#if defined(__AVX2__)
+static inline __m256i xorshift8(__m256i x)
+{
+    x = _mm256_xor_si256(x, _mm256_slli_epi32(x, 13));
+    x = _mm256_xor_si256(x, _mm256_srli_epi32(x, 17));
+    return _mm256_xor_si256(x, _mm256_slli_epi32(x, 5));
+}
+
+/* Eight samples at a time from i, which must be on lane 0. Returns where it stopped */
+static int quantize_avx2(struct quantizer_t * q, int32_t * restrict dst, const float * restrict src, int i, int n)
+{
+    const __m256 scale = _mm256_set1_ps(q->scale);
+    const __m256 lo = _mm256_set1_ps(q->lo);
+    const __m256 hi = _mm256_set1_ps(q->hi);
+    const __m256 unit = _mm256_set1_ps(1.0f / 16777216.0f);
+    const __m128i shift = _mm_cvtsi32_si128(32 - q->bits);
+    const bool dither = q->type == DITHER_TPDF;
+    __m256i seed = _mm256_loadu_si256((const __m256i *)q->seed);
+    int first = i;
+
+    for (; i + QUANTIZE_LANES <= n; i += QUANTIZE_LANES) {
+        __m256 y = _mm256_mul_ps(_mm256_loadu_ps(src + i), scale);
+        if (dither) {
+            __m256 a, b;
+            seed = xorshift8(seed);
+            a = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(seed, 8)), unit);
+            seed = xorshift8(seed);
+            b = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(seed, 8)), unit);
+            y = _mm256_add_ps(y, _mm256_sub_ps(a, b));
+        }
+        y = _mm256_min_ps(_mm256_max_ps(y, lo), hi);
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_sll_epi32(_mm256_cvtps_epi32(y), shift));
+    }
+    _mm256_storeu_si256((__m256i *)q->seed, seed);
+    q->pos += i - first;
+    return i;
+}
+#endif
+
+/*
+ * Second order error feedback, the output is x + (1 - z^-1)^2 e for the
+ * error e of each rounding. The error is taken before clipping so the
+ * loop stays bounded on overloads.
+ */
+static void quantize_shaped(struct quantizer_t * q, int32_t * restrict dst, const float * restrict src, int nframes)
+{
+    int n, c, nch = q->channels;
+
+    for (n = 0; n < nframes; n++) {
+        for (c = 0; c < nch; c++) {
+            float * e = q->error[c];
+            float v = src[n * nch + c] * q->scale - 2.0f * e[0] + e[1];
+            float y = rintf(v + tpdf(q));
+            q->pos++;
+            e[1] = e[0];
+            e[0] = y - v;
+            dst[n * nch + c] = clip_and_shift(q, y);
+        }
+    }
+}
+
+/* Converts nframes interleaved frames */
+void quantize(struct quantizer_t * q, int32_t * restrict dst, const float * restrict src, int nframes)
+{
+    int n = nframes * q->channels;
+    int i = 0;
+
+    if (q->type == DITHER_SHAPED) {
+        quantize_shaped(q, dst, src, nframes);
+        return;
+    }
+#if defined(__AVX2__)
+    /* the vector loop starts on lane 0, so the dither does not depend on the block sizes */
+    for (; i < n && (q->pos & (QUANTIZE_LANES - 1)); i++)
+        dst[i] = quantize_sample(q, src[i]);
+    i = quantize_avx2(q, dst, src, i, n);
+#endif
+    for (; i < n; i++)
+        dst[i] = quantize_sample(q, src[i]);
+}
@@ -0,0 +1,41 @@
+#ifndef QUANTIZE_H
+#define QUANTIZE_H
+
+#include <stdint.h>
+#include "dsp.h"
+
+/*
+ * Conversion of the interleaved float output to integer samples for PCM
+ * files, written with sf_writef_int. Clipping, dither and rounding are
+ * done in one pass and the result is left aligned in the int, so
+ * libsndfile only drops the low bits. TPDF dither of +-1 LSB comes from
+ * eight xorshift generators, one per lane of an AVX2 register, and
+ * shaped dither adds second order error feedback, which moves the
+ * requantisation noise towards high frequencies. The dither of a sample
+ * only depends on its position in the stream, so the output does not
+ * depend on how the stream is cut into blocks.
+ */
+enum dither_type {
+    DITHER_NONE = 0,
+    DITHER_TPDF,
+    DITHER_SHAPED,
+};
+
+#define QUANTIZE_LANES 8
+
+struct quantizer_t {
+    enum dither_type type;
+    int bits;
+    int channels;
+    float scale;                    /* 1 LSB is 1 after scaling */
+    float lo, hi;                   /* clip limits in LSB */
+    uint32_t seed[QUANTIZE_LANES];
+    unsigned long long pos;         /* samples converted so far */
+    float error[NCHANNELS_MAX][2];  /* shaped dither, previous two errors */
+};
+
+int quantize_bits(int format);
+void quantize_init(struct quantizer_t * q, enum dither_type type, int bits, int channels);
+void quantize(struct quantizer_t * q, int32_t * restrict dst, const float * restrict src, int nframes);
+
+#endif
@@ -0,0 +1,112 @@
+#define _XOPEN_SOURCE 500
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "shmstats.h"
+
+static uint64_t fnv1a(const char * str)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    while (*str) {
+        hash ^= (unsigned char)*str++;
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+struct shmstats_t * shmstats_create(const char * name, struct qdsp_t * dsphead, const char * client_name)
+{
+    struct shmstats_t * stats;
+    struct qdsp_t * dsp;
+    size_t len = 0;
+    int fd;
+
+    fd = shm_open(name, O_CREAT | O_RDWR, 0644);
+    if (fd < 0)
+        return NULL;
+    if (ftruncate(fd, sizeof(struct shmstats_t))) {
+        close(fd);
+        return NULL;
+    }
+    stats = mmap(NULL, sizeof(struct shmstats_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (stats == MAP_FAILED)
+        return NULL;
+
+    memset(stats, 0, sizeof(struct shmstats_t));
+    stats->version = SHMSTATS_VERSION;
+    stats->pid = getpid();
+    stats->nchannels = dsphead->nchannels;
+    strncpy(stats->client_name, client_name, sizeof(stats->client_name) - 1);
+
+    /* chain identity, as given on the command line */
+    for (dsp = dsphead; dsp && len < SHMSTATS_CHAIN_MAX; dsp = dsp->next)
+        len += snprintf(stats->chain + len, SHMSTATS_CHAIN_MAX - len, "%s-p %s", len ? " " : "", dsp->name);
+    stats->chain_hash = fnv1a(stats->chain);
+
+    shmstats_format(stats, dsphead->fs, dsphead->nframes);
+
+    /* readers check magic last */
+    __atomic_store_n(&stats->magic, SHMSTATS_MAGIC, __ATOMIC_RELEASE);
+
+    return stats;
+}
+
+/* Not realtime safe, only call while the process callback is not running */
+void shmstats_format(struct shmstats_t * stats, unsigned int fs, int nframes)
+{
+    uint32_t seq = stats->seq;
+    __atomic_store_n(&stats->seq, seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    stats->fs = fs;
+    stats->nframes = nframes;
+    stats->period_ns = 1000000000ULL * nframes / fs;
+    __atomic_store_n(&stats->seq, seq + 2, __ATOMIC_RELEASE);
+}
+
+void shmstats_destroy(struct shmstats_t * stats, const char * name)
+{
+    if (stats) {
+        munmap(stats, sizeof(struct shmstats_t));
+        shm_unlink(name);
+    }
+}
+
+struct shmstats_t * shmstats_open(const char * name)
+{
+    struct shmstats_t * stats;
+    struct stat st;
+    int fd;
+
+    fd = shm_open(name, O_RDONLY, 0);
+    if (fd < 0)
+        return NULL;
+    if (fstat(fd, &st) || st.st_size < (off_t)sizeof(struct shmstats_t)) {
+        close(fd);
+        return NULL;
+    }
+    stats = mmap(NULL, sizeof(struct shmstats_t), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (stats == MAP_FAILED)
+        return NULL;
+    if (__atomic_load_n(&stats->magic, __ATOMIC_ACQUIRE) != SHMSTATS_MAGIC || stats->version != SHMSTATS_VERSION) {
+        munmap(stats, sizeof(struct shmstats_t));
+        return NULL;
+    }
+    return stats;
+}
+
+/* Consistent copy of the per-period fields, retried while a writer is active */
+void shmstats_snapshot(const struct shmstats_t * stats, struct shmstats_t * copy)
+{
+    uint32_t seq0, seq1;
+    do {
+        seq0 = __atomic_load_n(&stats->seq, __ATOMIC_ACQUIRE);
+        memcpy(copy, stats, sizeof(struct shmstats_t));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        seq1 = __atomic_load_n(&stats->seq, __ATOMIC_RELAXED);
+    } while ((seq0 & 1) || seq0 != seq1);
+}
@@ -0,0 +1,69 @@
+#ifndef SHMSTATS_H
+#define SHMSTATS_H
+
+#include <stdint.h>
+#include "dsp.h"
+
+/*
+ * Telemetry published in a POSIX shared memory segment, see qdsp-stat.c.
+ * Per-period fields are written by the realtime thread under a seqlock
+ * (seq is odd while an update is in progress). xruns and dsp_load are
+ * written atomically from the JACK notification and telemetry threads.
+ * Nothing in here does any I/O.
+ */
+#define SHMSTATS_MAGIC 0x71647370
+#define SHMSTATS_VERSION 1
+#define SHMSTATS_CHAIN_MAX 1024
+
+struct shmstats_t {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t seq;
+    int32_t pid;
+    uint32_t fs;
+    uint32_t nframes;
+    uint32_t nchannels;
+    uint32_t dsp_load;              /* jack_cpu_load in 1/1000 percent */
+    uint64_t period_ns;             /* deadline for processing one period */
+    uint64_t periods;
+    uint64_t xruns;
+    uint64_t deadline_misses;       /* periods that took longer than period_ns */
+    uint64_t last_ns;
+    uint64_t max_ns;
+    uint64_t sum_ns;
+    uint64_t chain_hash;            /* FNV-1a of chain */
+    char client_name[64];
+    char chain[SHMSTATS_CHAIN_MAX];
+};
+
+/* Called from the realtime thread only */
+static inline void shmstats_period(struct shmstats_t * stats, uint64_t ns)
+{
+    uint32_t seq = stats->seq;
+    __atomic_store_n(&stats->seq, seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    stats->periods++;
+    stats->last_ns = ns;
+    stats->sum_ns += ns;
+    if (ns > stats->max_ns) stats->max_ns = ns;
+    if (ns > stats->period_ns) stats->deadline_misses++;
+    __atomic_store_n(&stats->seq, seq + 2, __ATOMIC_RELEASE);
+}
+
+static inline void shmstats_xrun(struct shmstats_t * stats)
+{
+    __atomic_fetch_add(&stats->xruns, 1, __ATOMIC_RELAXED);
+}
+
+static inline void shmstats_load(struct shmstats_t * stats, float load)
+{
+    __atomic_store_n(&stats->dsp_load, (uint32_t)(load * 1000), __ATOMIC_RELAXED);
+}
+
+struct shmstats_t * shmstats_create(const char * name, struct qdsp_t * dsphead, const char * client_name);
+void shmstats_format(struct shmstats_t * stats, unsigned int fs, int nframes);
+void shmstats_destroy(struct shmstats_t * stats, const char * name);
+struct shmstats_t * shmstats_open(const char * name);
+void shmstats_snapshot(const struct shmstats_t * stats, struct shmstats_t * copy);
+
+#endif
@@ -0,0 +1,289 @@
+#define _XOPEN_SOURCE 500
+#include <getopt.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+#include <math.h>
+#include "../dsp.h"
+#include "../interleave.h"
+
+/*
+ * Kernel micro-benchmark.
+ * Drives create_dsp/init_dsp/process directly on synthetic buffers, so no
+ * file or JACK I/O is measured. Prints one CSV line per configuration.
+ */
+
+int debuglevel;
+int get_debuglevel(void)
+{
+    return debuglevel;
+}
+
+static int nreps = 10;
+static double rep_seconds = 0.01;
+static char * filter;
+static char coeff_filename[] = "/tmp/bench-dsp-XXXXXX";
+
+static double now(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static int cmp_double(const void * a, const void * b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static void process(struct qdsp_t * dsphead, int nframes)
+{
+    struct qdsp_t * dsp;
+    for (dsp = dsphead; dsp; dsp = dsp->next) {
+        dsp->nframes = nframes;
+        dsp->sequencecount++;
+        dsp->process(dsp);
+    }
+}
+
+static void write_coeffs(int len)
+{
+    FILE * fid = fopen(coeff_filename, "w");
+    if (!fid) endprogram("Could not write coefficient file\n");
+    for (int i = 0; i < len; i++)
+        fprintf(fid, "%e\n", sin(0.1 * i) / (i + 1));
+    fclose(fid);
+}
+
+/* Builds a chain of nstages copies of opts, which may list several stages separated by spaces, then times it */
+static void bench(const char * stage, const char * opts, int nstages, int param, int nchannels, int nframes, bool generic)
+{
+    struct qdsp_t * dsphead = NULL, * dsp = NULL;
+    double t[nreps];
+    double ns_per_sample, mean = 0, var = 0;
+    long periods, i;
+    int r, nbuilt = 0;
+
+    if (filter && strcmp(filter, stage))
+        return;
+
+    for (i = 0; i < nstages; i++) {
+        char * list = strdup(opts), * save;
+        if (!list) endprogram("Could not allocate memory for dsp.\n");
+        for (char * subopts = strtok_r(list, " ", &save); subopts; subopts = strtok_r(NULL, " ", &save)) {
+            struct qdsp_t * next = malloc(sizeof(struct qdsp_t));
+            if (!next) endprogram("Could not allocate memory for dsp.\n");
+            create_dsp(next, subopts);
+            nbuilt++;
+            if (generic)
+                next->kernels = NULL;
+            if (dsp) dsp->next = next; else dsphead = next;
+            dsp = next;
+        }
+        free(list);
+    }
+    dsphead->fs = 48000;
+    dsphead->nchannels = nchannels;
+    dsphead->nframes = nframes;
+    init_dsp(dsphead);
+
+    /* noise above any gate threshold */
+    float * in = (float *)dsphead->inbufs[0];
+    for (i = 0; i < (long)nchannels * nframes; i++)
+        in[i] = 2.0f * rand() / RAND_MAX - 1.0f;
+
+    /* warm up and size a repetition to roughly rep_seconds */
+    double t0 = now();
+    for (periods = 0; now() - t0 < rep_seconds / 4 || periods < 4; periods++)
+        process(dsphead, nframes);
+    periods = periods * 4 > 16 ? periods * 4 : 16;
+
+    for (r = 0; r < nreps; r++) {
+        t0 = now();
+        for (i = 0; i < periods; i++)
+            process(dsphead, nframes);
+        t[r] = (now() - t0) * 1e9 / ((double)periods * nframes * nchannels);
+    }
+
+    for (r = 0; r < nreps; r++)
+        mean += t[r] / nreps;
+    for (r = 0; r < nreps; r++)
+        var += (t[r] - mean) * (t[r] - mean) / nreps;
+    qsort(t, nreps, sizeof(double), cmp_double);
+    ns_per_sample = t[nreps / 2];
+
+    /* every stage reads and writes one float per sample */
+    printf("%s,%s,%d,%d,%d,%d,%ld,%.4f,%.4f,%.4f,%.4f,%.3f\n", stage, generic ? "generic" : "specialised",
+           nchannels, nframes, param, nreps, periods, t[0], ns_per_sample, mean, sqrt(var),
+           8.0 * nbuilt / ns_per_sample);
+    fflush(stdout);
+
+    destroy_dsp(dsphead);
+}
+
+/* Times one block conversion between interleaved and planar layout, checked against the generic loop */
+static void bench_transpose(const char * name, int nchannels, int nframes, bool generic,
+                            void (*convert)(float * restrict, const float * restrict, int, int),
+                            void (*reference)(float * restrict, const float * restrict, int, int))
+{
+    size_t len = (size_t)nchannels * nframes;
+    float * src = malloc(len * sizeof(float));
+    float * dst = malloc(len * sizeof(float));
+    float * ref = malloc(len * sizeof(float));
+    double t[nreps];
+    double ns_per_sample, mean = 0, var = 0;
+    long periods, i;
+    int r;
+
+    if (filter && strcmp(filter, "interleave"))
+        goto out;
+    if (!src || !dst || !ref) endprogram("Could not allocate memory for buffers.\n");
+
+    for (i = 0; i < (long)len; i++)
+        src[i] = i;
+    convert(dst, src, nchannels, nframes);
+    reference(ref, src, nchannels, nframes);
+    if (memcmp(dst, ref, len * sizeof(float))) {
+        debugprint(0, "%s: mismatch for %d channels, %d frames\n", name, nchannels, nframes);
+        endprogram("");
+    }
+
+    double t0 = now();
+    for (periods = 0; now() - t0 < rep_seconds / 4 || periods < 4; periods++)
+        convert(dst, src, nchannels, nframes);
+    periods = periods * 4 > 16 ? periods * 4 : 16;
+
+    for (r = 0; r < nreps; r++) {
+        t0 = now();
+        for (i = 0; i < periods; i++)
+            convert(dst, src, nchannels, nframes);
+        t[r] = (now() - t0) * 1e9 / ((double)periods * len);
+    }
+
+    for (r = 0; r < nreps; r++)
+        mean += t[r] / nreps;
+    for (r = 0; r < nreps; r++)
+        var += (t[r] - mean) * (t[r] - mean) / nreps;
+    qsort(t, nreps, sizeof(double), cmp_double);
+    ns_per_sample = t[nreps / 2];
+
+    printf("%s,%s,%d,%d,%d,%d,%ld,%.4f,%.4f,%.4f,%.4f,%.3f\n", name, generic ? "generic" : "specialised",
+           nchannels, nframes, 0, nreps, periods, t[0], ns_per_sample, mean, sqrt(var), 8.0 / ns_per_sample);
+    fflush(stdout);
+
+out:
+    free(src);
+    free(dst);
+    free(ref);
+}
+
+static void sweep_transpose(void)
+{
+    const int nchannels[] = { 1, 2, 3, 4, 6, 8 };
+    const int nframes[] = { 64, 256, 1024 };
+
+    for (size_t c = 0; c < sizeof(nchannels) / sizeof(nchannels[0]); c++) {
+        for (size_t n = 0; n < sizeof(nframes) / sizeof(nframes[0]); n++) {
+            bench_transpose("deinterleave", nchannels[c], nframes[n], true, deinterleave_generic, deinterleave_generic);
+            bench_transpose("deinterleave", nchannels[c], nframes[n], false, deinterleave, deinterleave_generic);
+            bench_transpose("interleave", nchannels[c], nframes[n], true, interleave_generic, interleave_generic);
+            bench_transpose("interleave", nchannels[c], nframes[n], false, interleave, interleave_generic);
+        }
+    }
+}
+
+static bool has_specialised(int nchannels, int nframes)
+{
+    return (nchannels == 2 || nchannels == 8) && (nframes == 64 || nframes == 128 || nframes == 256);
+}
+
+static void sweep(const char * stage, const char * opts, int nstages, int param)
+{
+    const int nchannels[] = { 1, 2, 8 };
+    const int nframes[] = { 64, 128, 256, 1024 };
+
+    for (size_t c = 0; c < sizeof(nchannels) / sizeof(nchannels[0]); c++) {
+        for (size_t n = 0; n < sizeof(nframes) / sizeof(nframes[0]); n++) {
+            bench(stage, opts, nstages, param, nchannels[c], nframes[n], true);
+            if (has_specialised(nchannels[c], nframes[n]))
+                bench(stage, opts, nstages, param, nchannels[c], nframes[n], false);
+        }
+    }
+}
+
+void print_help()
+{
+    debugprint(0, "bench-dsp [-r repetitions] [-t seconds per repetition] [-s stage]\n\n");
+    debugprint(0, "Stages: gain, delay, limiter, gate, gate-closed, comp, comp-linked, iir, fir, gated, silence, mix, xover, interleave (file host block conversion)\n");
+    debugprint(0, "Output is CSV with times in ns per sample and channel over all repetitions,\n");
+    debugprint(0, "gbps is the median stage throughput, param the number of iir sections, fir taps or\ncrossover frequencies\n");
+    exit(EXIT_SUCCESS);
+}
+
+int main(int argc, char *argv[])
+{
+    char opts[128];
+    int c, fd;
+
+    while ((c = getopt (argc, argv, "r:t:s:h?")) != -1) {
+        switch (c) {
+        case 'r':
+            nreps = atoi(optarg);
+            if (nreps < 1) endprogram("Need at least one repetition\n");
+            break;
+        case 't':
+            rep_seconds = atof(optarg);
+            break;
+        case 's':
+            filter = optarg;
+            break;
+        case 'h':
+        case '?':
+            print_help();
+        }
+    }
+
+    fd = mkstemp(coeff_filename);
+    if (fd < 0) endprogram("Could not create coefficient file\n");
+    close(fd);
+
+    printf("stage,variant,nchannels,nframes,param,reps,periods,min_ns,median_ns,mean_ns,stddev_ns,gbps\n");
+
+    sweep("gain", "gain,g=-3", 1, 0);
+    sweep("delay", "gain,g=-3,d=0.002", 1, 0);
+    sweep("limiter", "gain,g=12,l=0.002", 1, 0);
+    sweep("gate", "gate,t=-120", 1, 0);
+    sweep("comp", "comp,t=-20,ra=4,k=6", 1, 0);
+    sweep("comp-linked", "comp,t=-20,ra=4,k=6,l", 1, 0);
+    /* noise never reaches +6 dBFS, the gate closes and stays closed */
+    sweep("gate-closed", "gate,t=6", 1, 0);
+    for (int sections = 1; sections <= 8; sections *= 2)
+        sweep("iir", "iir,peq,f=1000,q=2,g=3", sections, sections);
+    for (int taps = 32; taps <= 4096; taps *= 4) {
+        write_coeffs(taps);
+        snprintf(opts, sizeof(opts), "fir,h=%s", coeff_filename);
+        sweep("fir", opts, 1, taps);
+    }
+    /* the same chain behind an open and a closed gate, which the stages after it skip */
+    write_coeffs(512);
+    snprintf(opts, sizeof(opts), "gate,t=-120 fir,h=%s iir,peq,f=1000,q=2,g=3 gain,g=-3", coeff_filename);
+    sweep("gated", opts, 1, 512);
+    snprintf(opts, sizeof(opts), "gate,t=6 fir,h=%s iir,peq,f=1000,q=2,g=3 gain,g=-3", coeff_filename);
+    sweep("silence", opts, 1, 512);
+    /* the matrix fixes the number of channels, mid/side on stereo */
+    for (int nframes = 64; nframes <= 1024; nframes *= 4)
+        bench("mix", "mix,m=0.5:0.5/0.5:-0.5", 1, 0, 2, nframes, true);
+    /* the bands fan out into more channels, stereo 2 and 3-way and mono 4-way */
+    for (int nframes = 64; nframes <= 1024; nframes *= 4) {
+        bench("xover", "xover,f=2000", 1, 1, 2, nframes, true);
+        bench("xover", "xover,f=300:3000", 1, 2, 2, nframes, true);
+        bench("xover", "xover,f=200:1000:5000", 1, 3, 1, nframes, true);
+    }
+    sweep_transpose();
+
+    unlink(coeff_filename);
+    return 0;
+}
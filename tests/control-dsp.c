@@ -0,0 +1,121 @@
+#define _XOPEN_SOURCE 500
+#include <getopt.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "../dsp.h"
+
+/*
+ * Runtime control harness.
+ * Runs a chain on a constant input of CONTROL_LEVEL in all channels and
+ * applies control_dsp at given periods, between process calls as a host
+ * does. Writes the interleaved float32 output to stdout, so the caller
+ * can check the per sample gain.
+ */
+#define CONTROL_LEVEL 0.25f
+#define CONTROLS_MAX 32
+
+int debuglevel;
+int get_debuglevel(void)
+{
+    return debuglevel;
+}
+
+struct control_t {
+    long period;
+    int stage;
+    char * subopts;
+};
+
+void print_help()
+{
+    debugprint(0, "control-dsp [-c channels] [-n nframes] [-N periods] [-C period:stage:suboptions] -p dsp-name <dsp-options> [-p ...]\n\n");
+    debugprint(0, "Processes a constant %g in every channel and writes float32 output to stdout,\n", CONTROL_LEVEL);
+    debugprint(0, "-C applies suboptions to a stage before the given period, e.g. -C 2:0:g=-6\n");
+    exit(EXIT_SUCCESS);
+}
+
+int main(int argc, char *argv[])
+{
+    struct qdsp_t * dsphead = NULL, * dsp = NULL;
+    struct control_t controls[CONTROLS_MAX];
+    int ncontrols = 0, nchannels = 1, nframes = 64;
+    long nperiods = 8;
+    char * end;
+    int c, i, n;
+
+    while ((c = getopt (argc, argv, "c:n:N:C:p:h?")) != -1) {
+        switch (c) {
+        case 'c':
+            nchannels = atoi(optarg);
+            break;
+        case 'n':
+            nframes = atoi(optarg);
+            break;
+        case 'N':
+            nperiods = atol(optarg);
+            break;
+        case 'C':
+            if (ncontrols == CONTROLS_MAX) endprogram("Too many controls\n");
+            controls[ncontrols].period = strtol(optarg, &end, 10);
+            if (*end != ':') endprogram("Expected: period:stage:suboptions\n");
+            controls[ncontrols].stage = strtol(end + 1, &end, 10);
+            if (*end != ':') endprogram("Expected: period:stage:suboptions\n");
+            controls[ncontrols++].subopts = end + 1;
+            break;
+        case 'p': {
+            struct qdsp_t * next = malloc(sizeof(struct qdsp_t));
+            if (!next) endprogram("Could not allocate memory for dsp.\n");
+            create_dsp(next, optarg);
+            if (dsp) dsp->next = next; else dsphead = next;
+            dsp = next;
+            break;
+        }
+        case 'h':
+        case '?':
+            print_help();
+        }
+    }
+    if (!dsphead) print_help();
+    if (nchannels < 1 || nchannels > NCHANNELS_MAX || nframes < 1 || nperiods < 1)
+        endprogram("Invalid number of channels, frames or periods\n");
+
+    dsphead->fs = 48000;
+    dsphead->nchannels = nchannels;
+    dsphead->nframes = nframes;
+    init_dsp(dsphead);
+
+    const int outchannels = outchannels_dsp(dsphead);
+    float * out = malloc(outchannels * nframes * sizeof(float));
+    if (!out) endprogram("Could not allocate memory for output.\n");
+
+    for (long p = 0; p < nperiods; p++) {
+        for (i = 0; i < ncontrols; i++) {
+            if (controls[i].period == p && control_dsp(dsphead, controls[i].stage, controls[i].subopts))
+                endprogram("Could not apply control\n");
+        }
+        /* stages may write into the buffers of the chain input */
+        for (i = 0; i < nchannels; i++) {
+            for (n = 0; n < nframes; n++)
+                ((float *)dsphead->inbufs[i])[n] = CONTROL_LEVEL;
+        }
+        for (dsp = dsphead; dsp; dsp = dsp->next) {
+            dsp->nframes = nframes;
+            dsp->sequencecount++;
+            dsp->process(dsp);
+        }
+        for (dsp = dsphead; dsp->next; dsp = dsp->next)
+            ;
+        for (n = 0; n < nframes; n++) {
+            for (i = 0; i < outchannels; i++)
+                out[n * outchannels + i] = dsp->outbufs[i][n];
+        }
+        if (fwrite(out, sizeof(float), outchannels * nframes, stdout) != (size_t)(outchannels * nframes))
+            endprogram("Could not write output\n");
+    }
+
+    free(out);
+    destroy_dsp(dsphead);
+    return 0;
+}
@@ -5,6 +5,9 @@ import os as os
 import soundfile as sf
 from scipy import signal
 import sys
+import socket
+import subprocess
+import time
 
 def writeaudio(data, filename='test_in.wav'):
     sf.write(file=filename, data=data, samplerate=48000, subtype='FLOAT')
@@ -50,6 +53,15 @@ def test_gain():
     os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav -p gain,d=0.002")
     compareaudio(expected, readaudio())
 
+    #fractional delays are interpolated, exact enough for a 1 kHz tone
+    n = arange(2000)
+    for d in [0.4, 10.25, 100.7]:
+        writeaudio(0.5 * sin(2 * pi * 1000 * n / 48000))
+        os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav -p gain,d=%r" % (d / 48000))
+        expected = 0.5 * sin(2 * pi * 1000 * (n - d) / 48000)
+        compareaudio(expected[200:], readaudio()[200:], 1e-5)
+    writeaudio(ref)
+
     expected = minimum(maximum(ref * -0.3, -(10**(-20.0/20))), (10**(-20.0/20)))
     os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav -p gain,gl=-0.3,t=-20")
     compareaudio(expected, readaudio())
@@ -58,6 +70,116 @@ def test_gain():
     os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav -p gain,gl=2")
     compareaudio(expected, readaudio())
 
+    #the limiter delays by the lookahead plus 8 samples and leaves quiet signals alone
+    os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav -p gain,gl=0.5,l=0.001")
+    compareaudio(concatenate((zeros(56), 0.5 * ref[0:-56])), readaudio())
+
+    #loud signals are held at the ceiling, also between the samples
+    n = arange(4800)
+    writeaudio(transpose([0.5 * sin(2 * pi * 1000 * n / 48000), 0.5 * sin(2 * pi * 15000 * n / 48000 + 0.3)]))
+    os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav -p gain,g=12,l=0.005,t=-1")
+    out = readaudio()
+    ceiling = 10**(-1.0/20)
+    peak = amax(abs(out))
+    truepeak = amax(abs(signal.resample_poly(out, 8, 1, axis=0)))
+    if peak > ceiling or peak < 0.99 * ceiling or truepeak > ceiling * 10**(0.5/20):
+        print("Fail peak %f, true peak %f, ceiling %f" % (peak, truepeak, ceiling))
+        quit()
+    else:
+        print("Pass")
+    writeaudio(ref)
+
+    #multichannel files with a partial last block exercise the interleave kernels
+    for ch in [2, 3, 4, 6, 8]:
+        ref = (2.0 * random.rand(1000, ch)) - 1.0
+        writeaudio(ref)
+        os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav -p gain,g=-1")
+        compareaudio(ref*(10**(-1.0/20)), readaudio())
+
+    #float32 wav and raw files are memory mapped, other formats go through libsndfile
+    ref = (2.0 * random.rand(1000, 2)) - 1.0
+    sf.write(file='test_in.wav', data=ref, samplerate=48000, subtype='PCM_24')
+    os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav -p gain,g=0")
+    compareaudio(readaudio('test_in.wav'), readaudio(), 2.0**-22)
+    #the I/O chunk size must not change the result
+    os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav -p gain,g=-1,d=0.001")
+    expected = readaudio()
+    os.system("../file-qdsp -n 64 -c 200 -i test_in.wav -o test_out.wav -p gain,g=-1,d=0.001")
+    compareaudio(expected, readaudio(), 0)
+    #PCM output is rounded to within 0.5 LSB, plus up to 1 LSB of TPDF dither
+    sf.write(file='test_in.wav', data=ref, samplerate=48000, subtype='PCM_16')
+    expected = readaudio('test_in.wav')*(10**(-1.0/20))
+    os.system("../file-qdsp -n 64 -d none -i test_in.wav -o test_out.wav -p gain,g=-1")
+    compareaudio(expected, readaudio(), 0.51 * 2.0**-15)
+    os.system("../file-qdsp -n 64 -d tpdf -i test_in.wav -o test_out.wav -p gain,g=-1")
+    compareaudio(expected, readaudio(), 1.51 * 2.0**-15)
+    ref.astype(float32).tofile('test_in.raw')
+    os.system("../file-qdsp -n 64 -r c=2,r=48000,f=6 -i test_in.raw -o test_out.raw -p gain,g=-1")
+    compareaudio(ref.astype(float32)*(10**(-1.0/20)), fromfile('test_out.raw', dtype=float32), 2e-7)
+    os.remove('test_in.raw')
+    os.remove('test_out.raw')
+
+
+def ramp_model(controls, nframes, nperiods, ramplen, exponential, gain=1.0):
+    #per sample gain from {period: linear target}, the state is a float between periods
+    gains = zeros(nframes * nperiods)
+    target = ramp_to = float32(gain)
+    left = 0
+    for p in range(nperiods):
+        target = float32(controls.get(p, target))
+        if target != ramp_to:
+            ramp_to, left = target, ramplen
+            mul = exponential and gain * target > 0
+            step = (float64(target) / gain)**(1.0 / ramplen) if mul else (float64(target) - gain) / ramplen
+        g = float64(gain)
+        for n in range(nframes):
+            if left:
+                g = g * step if mul else g + step
+                left -= 1
+                if not left:
+                    g = ramp_to
+            gains[p * nframes + n] = g
+        gain = float32(g)
+    return gains
+
+def test_ramp():
+    print("Testing runtime gain ramps")
+
+    #control-dsp applies the controls between periods of a constant 0.25 input
+    os.system("make -s control-dsp")
+    ramplen = 192
+    #a ramp over three periods, retargeted in its second one, then a sign change which ramps linearly
+    controls = {2: 10**(-12/20.0), 3: 10**(6/20.0), 7: -0.5}
+    args = "-C 2:0:g=-12 -C 3:0:g=6 -C 7:0:gl=-0.5"
+    for nframes, options in [(64, ""), (60, ",e"), (64, ",e,d=0.001"), (64, ",d=0.0001"), (60, ",e,d=0.0001")]:
+        for ch in [1, 3]:
+            out = subprocess.run(("./control-dsp -c %d -n %d -N 12 %s -p gain,r=0.004%s" % (ch, nframes, args, options)).split(),
+                                 stdout=subprocess.PIPE).stdout
+            out = frombuffer(out, dtype=float32).reshape(-1, ch)
+            expected = 0.25 * ramp_model(controls, nframes, 12, ramplen, ",e" in options)
+            #the delay line starts empty, the ramps begin after it is filled
+            compareaudio(expected[64:], out[64:, ch - 1], 1e-6)
+
+def gate_model(x, threshold, hold, attack, release, fs=48000):
+    threshold = float32(10**(threshold/20.0))
+    holdlen = int(round(hold * fs))
+    attackstep = 1.0 / (attack * fs) if attack * fs >= 1 else 1.0
+    releasestep = 1.0 / (release * fs) if release * fs >= 1 else 1.0
+    gain = 1.0
+    holdleft = holdlen
+    y = zeros(len(x))
+    for n in range(len(x)):
+        if abs(x[n]) > threshold:
+            holdleft = holdlen
+            gain = minimum(gain + attackstep, 1.0)
+        elif holdleft:
+            holdleft -= 1
+            gain = minimum(gain + attackstep, 1.0)
+        else:
+            gain = maximum(gain - releasestep, 0.0)
+        y[n] = gain * x[n]
+    return y
+
 
 def test_gate():
     print("Testing dsp-gate")
@@ -66,33 +188,81 @@ def test_gate():
     writeaudio(ref)
 
     # test open gate
-    expected = ref # * array((zeros(50), ones(100), zeros(50))
     os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav -p gate,t=-120")
-    compareaudio(expected, readaudio())
+    compareaudio(ref, readaudio())
 
-    #test closing gate with zero hold
-    expected = ref * concatenate((ones(64), linspace(1,0,64), zeros(72)))
-    os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav -p gate,t=-6")
-    compareaudio(expected, readaudio(), 2e-7)
+    #bursts of a 1 kHz tone, the hold bridges the zero crossings
+    n = arange(3000)
+    level = concatenate((0.5 * ones(300), 0.001 * ones(700), 0.5 * ones(500), 0.001 * ones(1500)))
+    ref = (level * sin(2 * pi * 1000 * n / 48000)).astype(float32)
+    writeaudio(ref)
+    for opts in [(-20, 0.002, 0.0005, 0.003), (-20, 0, 0, 0.001), (-40, 0.0001, 0.0001, 0.0002)]:
+        expected = gate_model(ref, *opts)
+        os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav -p gate,t=%r,h=%r,a=%r,r=%r" % opts)
+        compareaudio(expected, readaudio(), 1e-5)
+
+    #the period size does not change the result
+    os.system("../file-qdsp -n 32 -i test_in.wav -o test_out.wav -p gate,t=-20,h=0.002,a=0.0005,r=0.003")
+    expected = readaudio()
+    for nframes in [128, 1024]:
+        os.system("../file-qdsp -n %d -i test_in.wav -o test_out.wav -p gate,t=-20,h=0.002,a=0.0005,r=0.003" % nframes)
+        compareaudio(expected, readaudio(), 0)
+
+    #8 channels through the specialised kernels
+    writeaudio(transpose([ref, -ref, 0.5 * ref, 0.01 * ref] * 2))
+    expected = gate_model(ref, -20, 0.002, 0.0005, 0.003)
+    expected = transpose([expected, -expected, gate_model(0.5 * ref, -20, 0.002, 0.0005, 0.003), gate_model(0.01 * ref, -20, 0.002, 0.0005, 0.003)] * 2)
+    os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav -p gate,t=-20,h=0.002,a=0.0005,r=0.003")
+    compareaudio(expected, readaudio(), 1e-5)
 
-    #test closing gate with hold
-    expected = ref * concatenate((ones(64), ones(64), linspace(1,0,64), zeros(8)))
-    os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav -p gate,t=-6,h=0.003")
-    compareaudio(expected, readaudio(), 2e-7)
 
-    #test closing and opening gate with zero hold
-    ref = linspace(-0.25, 1, 256)
-    writeaudio(ref)
-    expected = ref * concatenate((ones(64), linspace(1,0,64), zeros(64), linspace(0,1,64)))
-    os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav -p gate,t=-6")
-    compareaudio(expected, readaudio(), 2e-7)
+def comp_gains(level, threshold, ratio, knee, attack, release, makeup=0, fs=48000):
+    sign = 1 if ratio >= 1 else -1
+    over = sign * (20 * log10(maximum(level, 1e-10)) - threshold)
+    k = clip(over + knee / 2.0, 0, knee)
+    curve = sign * (1.0 / ratio - 1) * ((k * k / (2.0 * knee) if knee > 0 else 0) + maximum(over - knee / 2.0, 0))
+    attack = exp(-1.0 / (attack * fs)) if attack * fs >= 1 else 0
+    release = exp(-1.0 / (release * fs)) if release * fs >= 1 else 0
+    y = 0
+    gains = zeros(len(level))
+    for n in range(len(level)):
+        y = curve[n] + (y - curve[n]) * (attack if curve[n] < y else release)
+        gains[n] = 10**((y + makeup) / 20.0)
+    return gains
 
-    #test closing and opening gate with hold
-    ref = linspace(-0.25, 1, 384)
+
+def test_comp():
+    print("Testing dsp-comp")
+
+    n = arange(4800)
+    level = concatenate((0.05 * ones(1200), 0.8 * ones(1200), 0.02 * ones(1200), 0.3 * ones(1200)))
+    ref = (level * sin(2 * pi * 440 * n / 48000)).astype(float32)
     writeaudio(ref)
-    expected = ref * concatenate((ones(64), ones(64), linspace(1,0,64), zeros(64), linspace(0,1,64), ones(64)))
-    os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav -p gate,t=-6,h=0.003")
-    compareaudio(expected, readaudio(), 2e-7)
+
+    #compressor with a soft knee and makeup gain, a hard knee without smoothing, an expander
+    for opts in [(-20, 4, 6, 0.002, 0.02, 3), (-20, 3, 0, 0, 0, 0), (-30, 0.5, 6, 0.001, 0.01, 0)]:
+        expected = ref * comp_gains(abs(ref), *opts)
+        os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav -p comp,t=%r,ra=%r,k=%r,a=%r,r=%r,g=%r" % opts)
+        compareaudio(expected, readaudio(), 1e-5)
+
+    #the period size does not change the result
+    os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav -p comp,t=-20,ra=4,a=0.002,r=0.02")
+    expected = readaudio()
+    os.system("../file-qdsp -n 1024 -i test_in.wav -o test_out.wav -p comp,t=-20,ra=4,a=0.002,r=0.02")
+    compareaudio(expected, readaudio(), 0)
+
+    #linked channels follow the loudest one, unlinked ones are independent, 8 channels run specialised
+    data = transpose([ref, 0.1 * ref[::-1]])
+    writeaudio(data)
+    gains = comp_gains(amax(abs(data), axis=1), -20, 4, 6, 0.002, 0.02)
+    os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav -p comp,t=-20,ra=4,k=6,a=0.002,r=0.02,l")
+    compareaudio(data * gains[:, newaxis], readaudio(), 1e-5)
+    data = transpose([ref, 0.1 * ref[::-1]] * 4)
+    writeaudio(data)
+    expected = transpose([ref * comp_gains(abs(ref), -20, 4, 6, 0.002, 0.02),
+                          0.1 * ref[::-1] * comp_gains(abs(0.1 * ref[::-1]), -20, 4, 6, 0.002, 0.02)] * 4)
+    os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav -p comp,t=-20,ra=4,k=6,a=0.002,r=0.02")
+    compareaudio(expected, readaudio(), 1e-5)
 
 
 def test_iir():
@@ -118,6 +288,13 @@ def test_iir():
     os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav -p iir,hp2,f=100,q=0.7071,g=-6")
     compareaudio(transpose([expected, -expected]), readaudio(), 1e-6)
 
+    #test HP2 8 channels, specialised and generic period sizes
+    writeaudio(transpose([ref,-ref]*4))
+    os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav -p iir,hp2,f=100,q=0.7071,g=-6")
+    compareaudio(transpose([expected, -expected]*4), readaudio(), 1e-6)
+    os.system("../file-qdsp -n 32 -i test_in.wav -o test_out.wav -p iir,hp2,f=100,q=0.7071,g=-6")
+    compareaudio(transpose([expected, -expected]*4), readaudio(), 1e-6)
+
 def test_fir():
     print("Testing dsp-fir")
 
@@ -176,8 +353,230 @@ def test_fir():
     os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav -p fir,h=test_coeffs.txt")
     compareaudio(transpose([expected, -expected]), readaudio(), 1e-6)
 
+    #the second run maps the coefficients prepared by the first from the cache
+    os.makedirs("test_cache", exist_ok=True)
+    for i in range(2):
+        os.system("QDSP_CACHE_DIR=test_cache ../file-qdsp -n 64 -i test_in.wav -o test_out.wav -p fir,h=test_coeffs.txt")
+        compareaudio(transpose([expected, -expected]), readaudio(), 1e-6)
+    for f in os.listdir("test_cache"):
+        os.remove(os.path.join("test_cache", f))
+    os.rmdir("test_cache")
+
+    os.remove('test_coeffs.txt')
+
+def test_mix():
+    print("Testing dsp-mix")
+
+    ref = (2.0 * random.rand(3000, 2)) - 1.0
+    writeaudio(ref)
+
+    #stereo to mono downmix
+    os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav -p mix,m=0.5:0.5")
+    compareaudio(0.5 * (ref[:, 0] + ref[:, 1]), readaudio())
+
+    #mid/side and back, with stages on the mid/side channels in between
+    os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav -p mix,m=0.5:0.5/0.5:-0.5 -p gain,g=-6 -p mix,m=1:1/1:-1")
+    compareaudio(ref * 10**(-6.0/20), readaudio())
+
+    #upmix from a matrix file, through the pipeline and in segments
+    savetxt("test_matrix.txt", [[1, 0], [0, 0], [0.25, -0.5]])
+    expected = transpose([ref[:, 0], zeros(3000), 0.25 * ref[:, 0] - 0.5 * ref[:, 1]])
+    sf.write(file="test_in.wav", data=ref, samplerate=48000, subtype='PCM_24')
+    os.system("../file-qdsp -n 64 -c 256 -i test_in.wav -o test_out.wav -p mix,f=test_matrix.txt")
+    compareaudio(expected, readaudio(), 1e-6)
+    os.system("../file-qdsp -n 64 -S 0.005 -j 2 -i test_in.wav -o test_out.wav -p mix,f=test_matrix.txt")
+    compareaudio(expected, readaudio(), 1e-6)
+
+    os.remove('test_matrix.txt')
+
+def test_xover():
+    print("Testing dsp-xover")
+
+    #each split is a pair of 2nd order butterworth filters, bands below it also get its allpass
+    def lr4(x, f, btype):
+        b, a = signal.butter(2, f/24000, btype)
+        return signal.lfilter(b, a, signal.lfilter(b, a, x, axis=0), axis=0)
+    def ap(x, f):
+        return lr4(x, f, 'low') + lr4(x, f, 'high')
+
+    ref = (2.0 * random.rand(4000, 2)) - 1.0
+    writeaudio(ref)
+    #stereo 3-way, the bands of both channels in turn
+    bands = [ap(lr4(ref, 300, 'low'), 3000),
+             lr4(lr4(ref, 300, 'high'), 3000, 'low'),
+             lr4(lr4(ref, 300, 'high'), 3000, 'high')]
+    os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav -p xover,f=300:3000")
+    compareaudio(hstack(bands), readaudio(), 1e-6)
+    #the bands sum to an allpass
+    os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav -p xover,f=300:3000 -p mix,m=1:0:1:0:1:0/0:1:0:1:0:1")
+    compareaudio(ap(ap(ref, 300), 3000), readaudio(), 1e-6)
+
+    #mono 2-way in another period size
+    writeaudio(ref[:, 0])
+    os.system("../file-qdsp -n 256 -i test_in.wav -o test_out.wav -p xover,f=1000")
+    compareaudio(transpose([lr4(ref[:, 0], 1000, 'low'), lr4(ref[:, 0], 1000, 'high')]), readaudio(), 1e-6)
+
+def test_silence():
+    print("Testing silence propagation")
+
+    #the stages after a closed gate skip its silent channels, which must not change the result
+    n = arange(6000)
+    h = signal.firwin(101, 0.2)
+    savetxt("test_coeffs.txt", h)
+    stages = "-p fir,h=test_coeffs.txt -p iir,lp2,f=500,q=0.7071 -p gain,g=-3,d=0.001"
+    for ch in [2, 8]:
+        bursts = [(n // (500 + 300 * c)) % 2 for c in range(ch)]
+        ref = transpose([(0.5 * b + 0.001) * sin(2 * pi * 700 * n / 48000) for b in bursts])
+        writeaudio(ref)
+        os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav -p gate,t=-20,h=0.001,r=0.001")
+        os.rename("test_out.wav", "test_gated.wav")
+        os.system("../file-qdsp -n 64 -i test_gated.wav -o test_out.wav " + stages)
+        expected = readaudio()
+        os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav -p gate,t=-20,h=0.001,r=0.001 " + stages)
+        compareaudio(expected, readaudio(), 1e-6)
+    #silent inputs give silent mix outputs
+    os.system("../file-qdsp -n 64 -i test_gated.wav -o test_out.wav -p mix,m=1:1:0:0:0:0:0:0/0:0:0:0:0:0:0:1")
+    expected = readaudio()
+    os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav -p gate,t=-20,h=0.001,r=0.001 -p mix,m=1:1:0:0:0:0:0:0/0:0:0:0:0:0:0:1")
+    compareaudio(expected, readaudio(), 0)
+    #xover runs the lanes of quiet channels along with the others
+    os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav -p gate,t=-20,h=0.001,r=0.001 -p mix,m=1:0:0:0:0:0:0:0/0:0:0:1:0:0:0:0")
+    os.rename("test_out.wav", "test_gated.wav")
+    os.system("../file-qdsp -n 64 -i test_gated.wav -o test_out.wav -p xover,f=300:3000")
+    expected = readaudio()
+    os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav -p gate,t=-20,h=0.001,r=0.001 -p mix,m=1:0:0:0:0:0:0:0/0:0:0:1:0:0:0:0 -p xover,f=300:3000")
+    compareaudio(expected, readaudio(), 1e-6)
+
+    os.remove('test_gated.wav')
     os.remove('test_coeffs.txt')
 
+def test_codegen():
+    print("Testing chain code generation")
+
+    ref = (2.0 * random.rand(512)) - 1.0
+    writeaudio(transpose([ref,-ref]))
+    h = signal.firwin(21, 0.4)
+    savetxt("test_coeffs.txt", h)
+
+    #generate a chain while writing the reference output, then run the compiled chain
+    chain = "-p iir,hp2,f=100,q=0.7071 -p gain,g=-3,d=0.002,t=-1 -p fir,h=test_coeffs.txt"
+    os.system("../file-qdsp -n 64 -g test_chain.c -i test_in.wav -o test_out.wav " + chain)
+    expected = readaudio()
+    os.system("cc -std=c99 -O2 -shared -fPIC test_chain.c -o test_chain.so -lm")
+    os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav -p so,f=test_chain.so")
+    compareaudio(expected, readaudio(), 1e-6)
+
+    #a compiled iir clears its decayed state, silence after the input stays exact instead of decaying
+    writeaudio(concatenate((ref, zeros(4000))))
+    os.system("../file-qdsp -n 64 -g test_chain.c -i test_in.wav -o test_out.wav -p iir,lp2,f=1000,q=0.7071")
+    os.system("cc -std=c99 -O2 -shared -fPIC test_chain.c -o test_chain.so -lm")
+    os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav -p so,f=test_chain.so")
+    compareaudio(zeros(3000), readaudio()[-3000:], 0)
+
+    #a compiled gate follows the per sample envelope through the bursts
+    n = arange(3000)
+    level = concatenate((0.5 * ones(300), 0.001 * ones(700), 0.5 * ones(500), 0.001 * ones(1500)))
+    burst = (level * sin(2 * pi * 1000 * n / 48000)).astype(float32)
+    writeaudio(transpose([burst, 0.01 * burst]))
+    chain = "-p gate,t=-20,h=0.002,a=0.0005,r=0.003 -p iir,hp2,f=100,q=0.7071"
+    os.system("../file-qdsp -n 64 -g test_chain.c -i test_in.wav -o test_out.wav " + chain)
+    expected = readaudio()
+    os.system("cc -std=c99 -O2 -shared -fPIC test_chain.c -o test_chain.so -lm")
+    os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav -p so,f=test_chain.so")
+    compareaudio(expected, readaudio(), 1e-6)
+
+    os.remove('test_coeffs.txt')
+    os.remove('test_chain.c')
+    os.remove('test_chain.so')
+
+def test_batch():
+    print("Testing batch mode")
+
+    h = signal.firwin(21, 0.4)
+    savetxt("test_coeffs.txt", h)
+    chain = " -p iir,hp2,f=100,q=0.7071 -p gain,g=-3,d=0.001 -p fir,h=test_coeffs.txt"
+
+    #each file must come out as if processed on its own, whichever worker gets it
+    with open("test_batch.txt", "w") as f:
+        for i in range(4):
+            ref = (2.0 * random.rand(1000 + 100 * i, 1 + i % 2)) - 1.0
+            writeaudio(ref, "test_in%d.wav" % i)
+            f.write("test_in%d.wav test_batch%d.wav\n" % (i, i))
+    os.system("../file-qdsp -n 64 -j 2 -b test_batch.txt" + chain)
+    for i in range(4):
+        os.system("../file-qdsp -n 64 -i test_in%d.wav -o test_out.wav" % i + chain)
+        compareaudio(readaudio(), readaudio("test_batch%d.wav" % i), 0)
+        os.remove("test_in%d.wav" % i)
+        os.remove("test_batch%d.wav" % i)
+
+    os.remove('test_batch.txt')
+    os.remove('test_coeffs.txt')
+
+def test_segments():
+    print("Testing segmented processing")
+
+    ref = (2.0 * random.rand(3 * 48000, 2)) - 1.0
+    writeaudio(ref)
+    h = signal.firwin(101, 0.4)
+    savetxt("test_coeffs.txt", h)
+    chain = " -p iir,hp2,f=100,q=0.7071 -p gain,g=-3,d=0.001 -p fir,h=test_coeffs.txt -p iir,peq,f=1000,q=2,g=3"
+
+    os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav" + chain)
+    expected = readaudio()
+    os.system("../file-qdsp -n 64 -S 0.5 -j 3 -i test_in.wav -o test_out.wav" + chain)
+    compareaudio(expected, readaudio(), 1e-6)
+
+    os.remove('test_coeffs.txt')
+
+def test_server():
+    print("Testing server mode")
+
+    chain = " -p iir,hp2,f=100,q=0.7071 -p gain,g=-3,d=0.001"
+    if os.path.exists("test.sock"):
+        os.remove("test.sock")
+    server = subprocess.Popen(("../file-qdsp -n 64 -j 2 -L test.sock" + chain).split())
+    client = socket.socket(socket.AF_UNIX, socket.SOCK_SEQPACKET)
+    while client.connect_ex("test.sock"):
+        time.sleep(0.01)
+
+    #state is reset between jobs, so each one matches a run on its own
+    for i in range(2):
+        ref = (2.0 * random.rand(1000 + 100 * i, 2)) - 1.0
+        writeaudio(ref)
+        os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav" + chain)
+        expected = readaudio()
+        client.send(b"file test_in.wav test_server.wav")
+        print(client.recv(256).decode().strip())
+        compareaudio(expected, readaudio("test_server.wav"), 0)
+
+    #audio passed in memfds
+    infd = os.memfd_create("in")
+    outfd = os.memfd_create("out")
+    with open("test_in.wav", "rb") as f:
+        os.write(infd, f.read())
+    socket.send_fds(client, [b"fd"], [infd, outfd])
+    print(client.recv(256).decode().strip())
+    os.lseek(outfd, 0, os.SEEK_SET)
+    with open("test_server.wav", "wb") as f:
+        f.write(os.read(outfd, os.fstat(outfd).st_size))
+    compareaudio(expected, readaudio("test_server.wav"), 0)
+    os.close(infd)
+    os.close(outfd)
+
+    #a runtime gain holds for the following jobs, which start at it
+    client.send(b"control 1 g=-9")
+    print(client.recv(256).decode().strip())
+    os.system("../file-qdsp -n 64 -i test_in.wav -o test_out.wav" + chain.replace("g=-3", "g=-9"))
+    expected = readaudio()
+    client.send(b"file test_in.wav test_server.wav")
+    print(client.recv(256).decode().strip())
+    compareaudio(expected, readaudio("test_server.wav"), 0)
+
+    client.close()
+    server.send_signal(2)
+    server.wait()
+    os.remove("test_server.wav")
+
 def test_signal():
     print("Testing dsp-signal")
 
@@ -223,9 +622,18 @@ def main():
         benchmarks()
     else:
         test_gain()
+        test_ramp()
         test_gate()
+        test_comp()
         test_iir()
         test_fir()
+        test_mix()
+        test_xover()
+        test_silence()
+        test_codegen()
+        test_batch()
+        test_segments()
+        test_server()
 #        test_signal()
 
     os.remove('test_in.wav')
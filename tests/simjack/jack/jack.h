@@ -0,0 +1,60 @@
+#ifndef SIMJACK_JACK_H
+#define SIMJACK_JACK_H
+
+/*
+ * Stand-in for <jack/jack.h>, declaring only what jack-qdsp uses.
+ * Implemented by simjack.c, which drives the process callback from a
+ * timer instead of a JACK server.
+ */
+#include <stdint.h>
+
+typedef uint32_t jack_nframes_t;
+typedef float jack_default_audio_sample_t;
+typedef struct _jack_port jack_port_t;
+typedef struct _jack_client jack_client_t;
+
+typedef enum {
+    JackNullOption = 0x00,
+    JackNoStartServer = 0x01,
+    JackUseExactName = 0x02,
+    JackServerName = 0x04,
+} jack_options_t;
+
+typedef enum {
+    JackFailure = 0x01,
+    JackInvalidOption = 0x02,
+    JackNameNotUnique = 0x04,
+    JackServerStarted = 0x08,
+    JackServerFailed = 0x10,
+} jack_status_t;
+
+enum JackPortFlags {
+    JackPortIsInput = 0x1,
+    JackPortIsOutput = 0x2,
+};
+
+#define JACK_DEFAULT_AUDIO_TYPE "32 bit float mono audio"
+
+typedef int (*JackProcessCallback)(jack_nframes_t nframes, void *arg);
+typedef int (*JackBufferSizeCallback)(jack_nframes_t nframes, void *arg);
+typedef int (*JackXRunCallback)(void *arg);
+typedef void (*JackShutdownCallback)(void *arg);
+
+jack_client_t * jack_client_open(const char *client_name, jack_options_t options, jack_status_t *status, ...);
+int jack_client_close(jack_client_t *client);
+char * jack_get_client_name(jack_client_t *client);
+int jack_set_process_callback(jack_client_t *client, JackProcessCallback process_callback, void *arg);
+int jack_set_buffer_size_callback(jack_client_t *client, JackBufferSizeCallback bufsize_callback, void *arg);
+int jack_set_xrun_callback(jack_client_t *client, JackXRunCallback xrun_callback, void *arg);
+void jack_on_shutdown(jack_client_t *client, JackShutdownCallback function, void *arg);
+jack_nframes_t jack_get_sample_rate(jack_client_t *client);
+jack_nframes_t jack_get_buffer_size(jack_client_t *client);
+float jack_cpu_load(jack_client_t *client);
+jack_port_t * jack_port_register(jack_client_t *client, const char *port_name, const char *port_type,
+                                 unsigned long flags, unsigned long buffer_size);
+void * jack_port_get_buffer(jack_port_t *port, jack_nframes_t nframes);
+const char * jack_port_name(const jack_port_t *port);
+int jack_activate(jack_client_t *client);
+int jack_connect(jack_client_t *client, const char *source_port, const char *destination_port);
+
+#endif
@@ -0,0 +1,321 @@
+#define _XOPEN_SOURCE 600
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <jack/jack.h>
+
+/*
+ * Simulated JACK driver.
+ *
+ * Linked instead of libjack, it runs the client's process callback from a
+ * SCHED_FIFO thread woken by an absolute timer once per period. Each period
+ * the input ports are filled with noise, the callback is run and its
+ * completion time is recorded against the period deadline. When the run
+ * is over a latency report is printed and the program exits.
+ *
+ * Configured through the environment:
+ *   SIMJACK_RATE       sample rate, default 48000
+ *   SIMJACK_PERIOD     period size in frames, default 64
+ *   SIMJACK_SECONDS    length of the run, default 10
+ *   SIMJACK_PRIORITY   SCHED_FIFO priority, default 80
+ *   SIMJACK_MAX_XRUNS  exit with failure if there are more xruns than this
+ * Rate, period and length must be positive and the run at least one period.
+ */
+
+#define SIMJACK_NPORTS_MAX 64
+#define SIMJACK_ALIGN 32
+
+struct _jack_port {
+    char name[160];
+    unsigned long flags;
+    float * buffer;
+};
+
+struct _jack_client {
+    char name[64];
+    jack_nframes_t fs;
+    jack_nframes_t nframes;
+    double seconds;
+    int priority;
+    long max_xruns;
+    JackProcessCallback process;
+    void * process_arg;
+    JackXRunCallback xrun;
+    void * xrun_arg;
+    JackShutdownCallback shutdown;
+    void * shutdown_arg;
+    int nports;
+    struct _jack_port port[SIMJACK_NPORTS_MAX];
+    float load;
+    pthread_t thread;
+};
+
+static struct _jack_client simclient;
+
+static long getenv_long(const char * name, long def)
+{
+    const char * value = getenv(name);
+    return value ? strtol(value, NULL, 10) : def;
+}
+
+static double ts_to_ns(const struct timespec * t)
+{
+    return t->tv_sec * 1e9 + t->tv_nsec;
+}
+
+static void ts_add_ns(struct timespec * t, long long ns)
+{
+    ns += t->tv_nsec;
+    t->tv_sec += ns / 1000000000;
+    t->tv_nsec = ns % 1000000000;
+}
+
+static int cmp_double(const void * a, const void * b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static void report_line(const char * name, double * ns, long n)
+{
+    double mean = 0;
+    for (long i = 0; i < n; i++)
+        mean += ns[i] / n;
+    qsort(ns, n, sizeof(double), cmp_double);
+    printf("%-12s %10.2f %10.2f %10.2f %10.2f %10.2f\n", name, ns[0] / 1000, mean / 1000,
+           ns[(long)(0.99 * (n - 1))] / 1000, ns[(long)(0.999 * (n - 1))] / 1000, ns[n - 1] / 1000);
+}
+
+static void * driver_thread(void * arg)
+{
+    jack_client_t * client = (jack_client_t *)arg;
+    long nperiods = client->seconds * client->fs / client->nframes;
+    long long period_ns = 1000000000LL * client->nframes / client->fs;
+    double * callback = malloc(nperiods * sizeof(double));
+    double * completion = malloc(nperiods * sizeof(double));
+    long xruns = 0, skipped = 0, k;
+    uint32_t noise = 1;
+    struct timespec deadline, start, end;
+    double busy = 0;
+
+    if (!callback || !completion) {
+        fprintf(stderr, "simjack: Could not allocate memory for %ld periods\n", nperiods);
+        exit(EXIT_FAILURE);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    ts_add_ns(&deadline, period_ns);
+
+    for (k = 0; k < nperiods; k++) {
+        struct timespec period_start = deadline;
+        ts_add_ns(&deadline, period_ns);
+
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &period_start, NULL) == EINTR)
+            ;
+
+        for (int p = 0; p < client->nports; p++) {
+            if (!(client->port[p].flags & JackPortIsInput))
+                continue;
+            for (jack_nframes_t n = 0; n < client->nframes; n++) {
+                noise = noise * 1664525 + 1013904223;
+                client->port[p].buffer[n] = 0.1f * ((int32_t)noise * (1.0f / 2147483648.0f));
+            }
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        client->process(client->nframes, client->process_arg);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        callback[k] = ts_to_ns(&end) - ts_to_ns(&start);
+        completion[k] = ts_to_ns(&end) - ts_to_ns(&period_start);
+        busy += callback[k];
+
+        if (completion[k] > period_ns) {
+            xruns++;
+            if (client->xrun)
+                client->xrun(client->xrun_arg);
+            /* restart on the next period boundary, like a server would */
+            while (ts_to_ns(&deadline) < ts_to_ns(&end)) {
+                ts_add_ns(&deadline, period_ns);
+                skipped++;
+            }
+        }
+
+        if ((k + 1) % 1024 == 0) {
+            client->load = 100.0 * busy / (1024.0 * period_ns);
+            busy = 0;
+        }
+    }
+
+    printf("simjack: %u Hz, %u frames, %ld periods, deadline %.2f us, %s\n", client->fs, client->nframes,
+           nperiods, period_ns / 1000.0, client->priority ? "SCHED_FIFO" : "SCHED_OTHER");
+    printf("%-12s %10s %10s %10s %10s %10s\n", "", "min(us)", "mean(us)", "p99(us)", "p99.9(us)", "max(us)");
+    report_line("callback", callback, nperiods);
+    report_line("completion", completion, nperiods);
+    printf("xruns: %ld (%.3f%%), skipped periods: %ld\n", xruns, 100.0 * xruns / nperiods, skipped);
+    fflush(stdout);
+
+    free(callback);
+    free(completion);
+
+    exit(client->max_xruns >= 0 && xruns > client->max_xruns ? EXIT_FAILURE : EXIT_SUCCESS);
+    return NULL;
+}
+
+jack_client_t * jack_client_open(const char *client_name, jack_options_t options, jack_status_t *status, ...)
+{
+    jack_client_t * client = &simclient;
+    (void)options;
+
+    long fs = getenv_long("SIMJACK_RATE", 48000);
+    long nframes = getenv_long("SIMJACK_PERIOD", 64);
+    long seconds = getenv_long("SIMJACK_SECONDS", 10);
+
+    if (status)
+        *status = 0;
+    /* the driver needs at least one whole period to report on */
+    if (fs <= 0 || nframes <= 0 || seconds <= 0 || seconds * fs < nframes) {
+        fprintf(stderr, "simjack: SIMJACK_RATE, SIMJACK_PERIOD and SIMJACK_SECONDS must be positive "
+                "and the run at least one period long\n");
+        if (status)
+            *status = JackFailure | JackServerFailed;
+        return NULL;
+    }
+
+    memset(client, 0, sizeof(*client));
+    strncpy(client->name, client_name, sizeof(client->name) - 1);
+    client->fs = fs;
+    client->nframes = nframes;
+    client->seconds = seconds;
+    client->priority = getenv_long("SIMJACK_PRIORITY", 80);
+    client->max_xruns = getenv_long("SIMJACK_MAX_XRUNS", -1);
+    return client;
+}
+
+int jack_client_close(jack_client_t *client)
+{
+    (void)client;
+    return 0;
+}
+
+char * jack_get_client_name(jack_client_t *client)
+{
+    return client->name;
+}
+
+int jack_set_process_callback(jack_client_t *client, JackProcessCallback process_callback, void *arg)
+{
+    client->process = process_callback;
+    client->process_arg = arg;
+    return 0;
+}
+
+int jack_set_buffer_size_callback(jack_client_t *client, JackBufferSizeCallback bufsize_callback, void *arg)
+{
+    (void)client;
+    (void)bufsize_callback;
+    (void)arg;
+    return 0;
+}
+
+int jack_set_xrun_callback(jack_client_t *client, JackXRunCallback xrun_callback, void *arg)
+{
+    client->xrun = xrun_callback;
+    client->xrun_arg = arg;
+    return 0;
+}
+
+void jack_on_shutdown(jack_client_t *client, JackShutdownCallback function, void *arg)
+{
+    client->shutdown = function;
+    client->shutdown_arg = arg;
+}
+
+jack_nframes_t jack_get_sample_rate(jack_client_t *client)
+{
+    return client->fs;
+}
+
+jack_nframes_t jack_get_buffer_size(jack_client_t *client)
+{
+    return client->nframes;
+}
+
+float jack_cpu_load(jack_client_t *client)
+{
+    return client->load;
+}
+
+jack_port_t * jack_port_register(jack_client_t *client, const char *port_name, const char *port_type,
+                                 unsigned long flags, unsigned long buffer_size)
+{
+    jack_port_t * port;
+    (void)port_type;
+    (void)buffer_size;
+
+    if (client->nports == SIMJACK_NPORTS_MAX)
+        return NULL;
+    port = &client->port[client->nports];
+    strcpy(port->name, client->name);
+    strcat(port->name, ":");
+    strncat(port->name, port_name, sizeof(port->name) - strlen(port->name) - 1);
+    port->flags = flags;
+    if (posix_memalign((void **)&port->buffer, SIMJACK_ALIGN, client->nframes * sizeof(float)))
+        return NULL;
+    memset(port->buffer, 0, client->nframes * sizeof(float));
+    client->nports++;
+    return port;
+}
+
+void * jack_port_get_buffer(jack_port_t *port, jack_nframes_t nframes)
+{
+    (void)nframes;
+    return port->buffer;
+}
+
+const char * jack_port_name(const jack_port_t *port)
+{
+    return port->name;
+}
+
+int jack_activate(jack_client_t *client)
+{
+    pthread_attr_t attr;
+    struct sched_param param;
+
+    if (!client->process)
+        return 1;
+
+    mlockall(MCL_CURRENT | MCL_FUTURE);
+
+    pthread_attr_init(&attr);
+    if (client->priority) {
+        param.sched_priority = client->priority;
+        pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+        pthread_attr_setschedpolicy(&attr, SCHED_FIFO);
+        pthread_attr_setschedparam(&attr, &param);
+    }
+    if (pthread_create(&client->thread, &attr, driver_thread, client)) {
+        fprintf(stderr, "simjack: Could not use SCHED_FIFO, running with normal priority\n");
+        client->priority = 0;
+        pthread_attr_destroy(&attr);
+        pthread_attr_init(&attr);
+        if (pthread_create(&client->thread, &attr, driver_thread, client))
+            return 1;
+    }
+    pthread_attr_destroy(&attr);
+    return 0;
+}
+
+int jack_connect(jack_client_t *client, const char *source_port, const char *destination_port)
+{
+    (void)client;
+    (void)source_port;
+    (void)destination_port;
+    return 0;
+}
@@ -0,0 +1,116 @@
+#define _XOPEN_SOURCE 500
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "timing.h"
+
+static void clear_bank(struct timing_bank_t * b)
+{
+    memset(b, 0, sizeof(*b));
+    b->min = UINT64_MAX;
+}
+
+static uint64_t nsec_now(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000000ULL + t.tv_nsec;
+}
+
+/* Lower bound in cycles of a histogram bucket */
+static uint64_t bucket_floor(int idx)
+{
+    if (idx < 4)
+        return idx;
+    return (uint64_t)(4 + (idx & 3)) << (idx / 4 - 1);
+}
+
+static double calibrate_cycles_per_ns(void)
+{
+    struct timespec delay = { .tv_sec = 0, .tv_nsec = 20000000 };
+    uint64_t t0 = nsec_now();
+    uint64_t c0 = timing_cycles();
+    nanosleep(&delay, NULL);
+    uint64_t c1 = timing_cycles();
+    uint64_t t1 = nsec_now();
+    return (double)(c1 - c0) / (double)(t1 - t0);
+}
+
+struct chain_timing_t * timing_create(struct qdsp_t * dsphead)
+{
+    struct chain_timing_t * timing = malloc(sizeof(struct chain_timing_t));
+    struct qdsp_t * dsp;
+    int i;
+
+    if (!timing) endprogram("Could not allocate memory for timing.\n");
+
+    timing->nstages = 0;
+    for (dsp = dsphead; dsp; dsp = dsp->next)
+        timing->nstages++;
+
+    timing->stage = malloc((timing->nstages + 1) * sizeof(struct stage_timing_t));
+    if (!timing->stage) endprogram("Could not allocate memory for timing.\n");
+
+    for (dsp = dsphead, i = 0; i <= timing->nstages; i++) {
+        timing->stage[i].name = dsp ? dsp->name : "total";
+        clear_bank(&timing->stage[i].bank[0]);
+        clear_bank(&timing->stage[i].bank[1]);
+        if (dsp) dsp = dsp->next;
+    }
+
+    timing->bank = 0;
+    timing->cycles_per_ns = calibrate_cycles_per_ns();
+    debugprint(1, "%s: %.3f cycles/ns\n", __func__, timing->cycles_per_ns);
+
+    return timing;
+}
+
+void timing_destroy(struct chain_timing_t * timing)
+{
+    if (timing) {
+        free(timing->stage);
+        free(timing);
+    }
+}
+
+/*
+ * Flip banks and print the idle one. Not realtime safe, it sleeps until the
+ * realtime thread has finished any period still using the old bank.
+ */
+void timing_publish(struct chain_timing_t * timing, FILE * out, unsigned int fs, int nframes)
+{
+    double period_ns = 1e9 * nframes / fs;
+    double ns = 1.0 / timing->cycles_per_ns;
+    struct timespec delay = { .tv_sec = 0, .tv_nsec = (long)(2 * period_ns) + 1000000 };
+    int old = timing->bank;
+    int i, j;
+
+    __atomic_store_n(&timing->bank, !old, __ATOMIC_RELEASE);
+    nanosleep(&delay, NULL);
+
+    fprintf(out, "%-32s %8s %9s %9s %9s %9s %7s %7s\n", "stage", "count", "min(us)", "mean(us)", "p99(us)", "max(us)", "mean%", "max%");
+    for (i = 0; i <= timing->nstages; i++) {
+        struct timing_bank_t * b = &timing->stage[i].bank[old];
+        uint64_t p99 = 0, seen = 0;
+
+        if (b->count == 0) {
+            fprintf(out, "%-32.32s %8d\n", timing->stage[i].name, 0);
+            continue;
+        }
+        for (j = 0; j < TIMING_NBUCKETS; j++) {
+            seen += b->buckets[j];
+            if (seen * 100 >= b->count * 99) {
+                p99 = j + 1 < TIMING_NBUCKETS ? bucket_floor(j + 1) : b->max;
+                break;
+            }
+        }
+        if (p99 > b->max) p99 = b->max;
+
+        double mean = (double)b->sum / b->count;
+        fprintf(out, "%-32.32s %8llu %9.2f %9.2f %9.2f %9.2f %6.1f%% %6.1f%%\n", timing->stage[i].name,
+                (unsigned long long)b->count, b->min * ns / 1000, mean * ns / 1000, p99 * ns / 1000, b->max * ns / 1000,
+                100 * mean * ns / period_ns, 100 * b->max * ns / period_ns);
+        clear_bank(b);
+    }
+    fflush(out);
+}
@@ -0,0 +1,85 @@
+#ifndef TIMING_H
+#define TIMING_H
+
+#include <stdint.h>
+#include <time.h>
+#include "dsp.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/*
+ * Per-stage realtime timing.
+ * The realtime thread is the only writer of the histograms. Each stage has
+ * two banks; the publisher thread flips the active bank, waits for the
+ * realtime thread to move over, then reads and clears the idle one.
+ * Buckets are log-linear with four buckets per octave of cycles.
+ */
+#define TIMING_NBUCKETS 256
+
+struct timing_bank_t {
+    uint64_t count;
+    uint64_t sum;
+    uint64_t min;
+    uint64_t max;
+    uint32_t buckets[TIMING_NBUCKETS];
+};
+
+struct stage_timing_t {
+    const char * name;
+    struct timing_bank_t bank[2];
+};
+
+struct chain_timing_t {
+    int bank;
+    int nstages;                    /* dsp stages, stage[nstages] is the whole chain */
+    double cycles_per_ns;
+    struct stage_timing_t * stage;
+};
+
+static inline uint64_t timing_cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    uint64_t cnt;
+    __asm__ volatile ("mrs %0, cntvct_el0" : "=r"(cnt));
+    return cnt;
+#else
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000000ULL + t.tv_nsec;
+#endif
+}
+
+static inline int timing_bucket(uint64_t cycles)
+{
+    int msb;
+    if (cycles < 4)
+        return cycles;
+    msb = 63 - __builtin_clzll(cycles);
+    return (msb - 1) * 4 + ((cycles >> (msb - 2)) & 3);
+}
+
+/* Called from the realtime thread only */
+static inline int timing_begin(struct chain_timing_t * timing)
+{
+    return __atomic_load_n(&timing->bank, __ATOMIC_ACQUIRE);
+}
+
+static inline void timing_record(struct chain_timing_t * timing, int bank, int stage, uint64_t cycles)
+{
+    struct timing_bank_t * b = &timing->stage[stage].bank[bank];
+    b->count++;
+    b->sum += cycles;
+    if (cycles < b->min) b->min = cycles;
+    if (cycles > b->max) b->max = cycles;
+    b->buckets[timing_bucket(cycles)]++;
+}
+
+struct chain_timing_t * timing_create(struct qdsp_t * dsphead);
+void timing_destroy(struct chain_timing_t * timing);
+void timing_publish(struct chain_timing_t * timing, FILE * out, unsigned int fs, int nframes);
+
+#endif
@@ -0,0 +1,122 @@
+#define _XOPEN_SOURCE 500
+#include <stdlib.h>
+#include <string.h>
+#include "dsp.h"
+#include "trace.h"
+
+#define TRACE_THREADS_MAX 64
+
+struct trace_t * tracebuf;
+
+static uint32_t ntids;
+static __thread uint32_t tid;
+static const char * thread_names[TRACE_THREADS_MAX];
+
+/* Small sequential thread ids, assigned on a thread's first event */
+uint32_t trace_tid(void)
+{
+    if (!tid)
+        tid = __atomic_add_fetch(&ntids, 1, __ATOMIC_RELAXED);
+    return tid;
+}
+
+void trace_create(unsigned int log2_events)
+{
+    size_t nevents = (size_t)1 << log2_events;
+    struct trace_t * trace = malloc(sizeof(struct trace_t));
+    if (!trace) endprogram("Could not allocate memory for trace.\n");
+
+    /* touch every page now so the realtime thread never faults on it */
+    trace->events = malloc(nevents * sizeof(struct trace_event_t));
+    if (!trace->events) endprogram("Could not allocate memory for trace.\n");
+    memset(trace->events, 0, nevents * sizeof(struct trace_event_t));
+    trace->mask = nevents - 1;
+    trace->head = 0;
+
+    __atomic_store_n(&tracebuf, trace, __ATOMIC_RELEASE);
+}
+
+/* Not realtime safe on the first call from a thread, cheap after that */
+void trace_thread_name(const char * name)
+{
+    uint32_t id = trace_tid();
+    if (id < TRACE_THREADS_MAX && !thread_names[id])
+        thread_names[id] = name;
+}
+
+static void write_string(FILE * fid, const char * str)
+{
+    fputc('"', fid);
+    for (; *str; str++) {
+        if (*str == '"' || *str == '\\')
+            fputc('\\', fid);
+        fputc(*str, fid);
+    }
+    fputc('"', fid);
+}
+
+/* Writes the events still in the ring buffer as Chrome trace JSON */
+int trace_write(const char * filename)
+{
+    uint64_t head, first, idx;
+    bool comma = false;
+    FILE * fid;
+    uint32_t i;
+
+    if (!tracebuf)
+        return 0;
+    if (!(fid = fopen(filename, "w"))) {
+        debugprint(0, "%s: Could not open %s for writing\n", __func__, filename);
+        return 1;
+    }
+
+    head = __atomic_load_n(&tracebuf->head, __ATOMIC_ACQUIRE);
+    first = head > tracebuf->mask + 1 ? head - tracebuf->mask - 1 : 0;
+
+    fprintf(fid, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    for (i = 1; i < TRACE_THREADS_MAX && i <= ntids; i++) {
+        if (!thread_names[i])
+            continue;
+        fprintf(fid, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":", comma ? ",\n" : "", i);
+        write_string(fid, thread_names[i]);
+        fprintf(fid, "}}");
+        comma = true;
+    }
+    for (idx = first; idx < head; idx++) {
+        struct trace_event_t * slot = &tracebuf->events[idx & tracebuf->mask];
+        struct trace_event_t ev;
+        /* skip events overwritten or still being written, seq must hold before and after the copy */
+        if (__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) != idx + 1)
+            continue;
+        ev.ts = __atomic_load_n(&slot->ts, __ATOMIC_RELAXED);
+        ev.name = __atomic_load_n(&slot->name, __ATOMIC_RELAXED);
+        ev.tid = __atomic_load_n(&slot->tid, __ATOMIC_RELAXED);
+        ev.phase = __atomic_load_n(&slot->phase, __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&slot->seq, __ATOMIC_RELAXED) != idx + 1)
+            continue;
+        fprintf(fid, "%s{\"name\":", comma ? ",\n" : "");
+        write_string(fid, ev.name);
+        fprintf(fid, ",\"ph\":\"%c\",\"ts\":%llu.%03llu,\"pid\":1,\"tid\":%u}", ev.phase,
+                (unsigned long long)(ev.ts / 1000), (unsigned long long)(ev.ts % 1000), ev.tid);
+        comma = true;
+    }
+    fprintf(fid, "\n]}\n");
+
+    if (fclose(fid)) {
+        debugprint(0, "%s: Could not write %s\n", __func__, filename);
+        return 1;
+    }
+    debugprint(0, "Wrote %llu trace events to %s\n", (unsigned long long)(head - first), filename);
+    return 0;
+}
+
+/* Only once no other thread can add events or write the trace */
+void trace_destroy(void)
+{
+    struct trace_t * trace = __atomic_exchange_n(&tracebuf, NULL, __ATOMIC_ACQ_REL);
+    if (trace) {
+        free(trace->events);
+        free(trace);
+    }
+}
@@ -0,0 +1,61 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdint.h>
+#include <time.h>
+
+/*
+ * Opt-in execution tracing.
+ * Events go into a preallocated ring buffer that any thread, including the
+ * realtime thread, can append to without locking. trace_write() dumps the
+ * most recent events as Chrome trace JSON, which Perfetto also opens.
+ * All calls are no-ops until trace_create() has been called.
+ */
+struct trace_event_t {
+    uint64_t seq;                   /* index + 1 once the event is complete, 0 while it is written */
+    uint64_t ts;                    /* CLOCK_MONOTONIC ns */
+    const char * name;
+    uint32_t tid;
+    char phase;                     /* 'B'egin or 'E'nd */
+};
+
+struct trace_t {
+    struct trace_event_t * events;
+    uint64_t mask;
+    uint64_t head;
+};
+
+extern struct trace_t * tracebuf;
+
+uint32_t trace_tid(void);
+
+static inline void trace_event(const char * name, char phase)
+{
+    struct trace_event_t * ev;
+    struct timespec t;
+    uint64_t idx;
+
+    if (!tracebuf)
+        return;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    idx = __atomic_fetch_add(&tracebuf->head, 1, __ATOMIC_RELAXED);
+    ev = &tracebuf->events[idx & tracebuf->mask];
+    /* a seqlock: invalidate the slot before any field of the new event lands in it */
+    __atomic_store_n(&ev->seq, 0, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&ev->ts, (uint64_t)t.tv_sec * 1000000000ULL + t.tv_nsec, __ATOMIC_RELAXED);
+    __atomic_store_n(&ev->name, name, __ATOMIC_RELAXED);
+    __atomic_store_n(&ev->tid, trace_tid(), __ATOMIC_RELAXED);
+    __atomic_store_n(&ev->phase, phase, __ATOMIC_RELAXED);
+    __atomic_store_n(&ev->seq, idx + 1, __ATOMIC_RELEASE);
+}
+
+#define trace_begin(name) trace_event(name, 'B')
+#define trace_end(name) trace_event(name, 'E')
+
+void trace_create(unsigned int log2_events);
+void trace_thread_name(const char * name);
+int trace_write(const char * filename);
+void trace_destroy(void);
+
+#endif